@@ -44,6 +44,9 @@ extern "C" {
  * @brief Singly-linked List module provides APIs to handle singly-linked list
  *        operations such as insert, push, pop, push back, sort and remove.
  *
+ * sl_slist_queue_t adds a tail pointer to the list for constant time push
+ * back, and sl_dlist_t is a doubly-linked variant for constant time removal.
+ *
  * @note The pop operation follows FIFO method.
  * @n @section slist_usage Singly-Linked List module Usage
  * @{
@@ -57,6 +60,27 @@ struct sl_slist_node {
   sl_slist_node_t *node; ///< List node
 };
 
+/// List with tail pointer, for constant time push back
+typedef struct {
+  sl_slist_node_t *head; ///< First node of the list
+  sl_slist_node_t *tail; ///< Last node of the list
+} sl_slist_queue_t;
+
+/// Doubly-linked list node type
+typedef struct sl_dlist_node sl_dlist_node_t;
+
+/// Doubly-linked list node
+struct sl_dlist_node {
+  sl_dlist_node_t *next; ///< Next node
+  sl_dlist_node_t *prev; ///< Previous node
+};
+
+/// Doubly-linked list, for constant time removal
+typedef struct {
+  sl_dlist_node_t *head; ///< First node of the list
+  sl_dlist_node_t *tail; ///< Last node of the list
+} sl_dlist_t;
+
 #ifndef DOXYGEN
 #define  container_of(ptr, type, member)  (type *)((uintptr_t)(ptr) - ((uintptr_t)(&((type *)0)->member)))
 
@@ -67,6 +91,14 @@ struct sl_slist_node {
 #define  SL_SLIST_FOR_EACH_ENTRY(list_head, entry, type, member) for (  (entry) = SL_SLIST_ENTRY(list_head, type, member);     \
                                                                         (type *)(entry) != SL_SLIST_ENTRY(NULL, type, member); \
                                                                         (entry) = SL_SLIST_ENTRY((entry)->member.node, type, member))
+
+#define  SL_DLIST_ENTRY                               container_of
+
+#define  SL_DLIST_FOR_EACH(list, iterator)            for ((iterator) = (list)->head; (iterator) != NULL; (iterator) = (iterator)->next)
+
+#define  SL_DLIST_FOR_EACH_ENTRY(list, entry, type, member) for (  (entry) = SL_DLIST_ENTRY((list)->head, type, member);        \
+                                                                   (type *)(entry) != SL_DLIST_ENTRY(NULL, type, member);    \
+                                                                   (entry) = SL_DLIST_ENTRY((entry)->member.next, type, member))
 #endif
 
 // -----------------------------------------------------------------------------
@@ -139,11 +171,133 @@ void sl_slist_remove(sl_slist_node_t **head,
  *                     item_l    Pointer to left  item.
  *                     item_r    Pointer to right item.
  *                     Returns whether the two items are ordered (true) or not (false).
+ *
+ * @note     The sort is a stable merge sort, O(n log n). Items for which
+ *           cmp_fnct returns true keep their relative order.
  ******************************************************************************/
 void sl_slist_sort(sl_slist_node_t **head,
                    bool (*cmp_fnct)(sl_slist_node_t *item_l,
                                     sl_slist_node_t *item_r));
 
+/*******************************************************************************
+ * Initialize a singly-linked list with tail pointer.
+ *
+ * @param    list  Pointer to the list.
+ ******************************************************************************/
+void sl_slist_queue_init(sl_slist_queue_t *list);
+
+/*******************************************************************************
+ * Add given item at beginning of the list with tail pointer.
+ *
+ * @param    list  Pointer to the list.
+ *
+ * @param    item  Pointer to an item to add.
+ ******************************************************************************/
+void sl_slist_queue_push(sl_slist_queue_t *list,
+                         sl_slist_node_t *item);
+
+/*******************************************************************************
+ * Add item at the end of the list with tail pointer, in constant time.
+ *
+ * @param    list  Pointer to the list.
+ *
+ * @param    item  Pointer to the item to add.
+ ******************************************************************************/
+void sl_slist_queue_push_back(sl_slist_queue_t *list,
+                              sl_slist_node_t *item);
+
+/*******************************************************************************
+ * Remove and return the first element of the list with tail pointer.
+ *
+ * @param    list  Pointer to the list.
+ *
+ * @return   Pointer to item that was at top of the list.
+ ******************************************************************************/
+sl_slist_node_t *sl_slist_queue_pop(sl_slist_queue_t *list);
+
+/*******************************************************************************
+ * Remove an item from the list with tail pointer.
+ *
+ * @param    list  Pointer to the list.
+ *
+ * @param    item  Pointer to the item to remove.
+ *
+ * @note     (1) An EFM_ASSERT is thrown if the item is not found within the list.
+ ******************************************************************************/
+void sl_slist_queue_remove(sl_slist_queue_t *list,
+                           sl_slist_node_t *item);
+
+/*******************************************************************************
+ * Sort the items of the list with tail pointer.
+ *
+ * @param    list      Pointer to the list.
+ *
+ * @param    cmp_fnct  Pointer to function to use for sorting the list.
+ *                     Same as for sl_slist_sort().
+ ******************************************************************************/
+void sl_slist_queue_sort(sl_slist_queue_t *list,
+                         bool (*cmp_fnct)(sl_slist_node_t *item_l,
+                                          sl_slist_node_t *item_r));
+
+/*******************************************************************************
+ * Initialize a doubly-linked list.
+ *
+ * @param    list  Pointer to the list.
+ ******************************************************************************/
+void sl_dlist_init(sl_dlist_t *list);
+
+/*******************************************************************************
+ * Add given item at beginning of the doubly-linked list.
+ *
+ * @param    list  Pointer to the list.
+ *
+ * @param    item  Pointer to an item to add.
+ ******************************************************************************/
+void sl_dlist_push(sl_dlist_t *list,
+                   sl_dlist_node_t *item);
+
+/*******************************************************************************
+ * Add item at the end of the doubly-linked list.
+ *
+ * @param    list  Pointer to the list.
+ *
+ * @param    item  Pointer to the item to add.
+ ******************************************************************************/
+void sl_dlist_push_back(sl_dlist_t *list,
+                        sl_dlist_node_t *item);
+
+/*******************************************************************************
+ * Remove and return the first element of the doubly-linked list.
+ *
+ * @param    list  Pointer to the list.
+ *
+ * @return   Pointer to item that was at top of the list.
+ ******************************************************************************/
+sl_dlist_node_t *sl_dlist_pop(sl_dlist_t *list);
+
+/*******************************************************************************
+ * Insert an item after the given item of the doubly-linked list.
+ *
+ * @param    list  Pointer to the list.
+ *
+ * @param    item  Pointer to an item to add.
+ *
+ * @param    pos   Pointer to an item after which the item to add will be inserted.
+ ******************************************************************************/
+void sl_dlist_insert(sl_dlist_t *list,
+                     sl_dlist_node_t *item,
+                     sl_dlist_node_t *pos);
+
+/*******************************************************************************
+ * Remove an item from the doubly-linked list, in constant time.
+ *
+ * @param    list  Pointer to the list.
+ *
+ * @param    item  Pointer to the item to remove. Must be part of the list.
+ ******************************************************************************/
+void sl_dlist_remove(sl_dlist_t *list,
+                     sl_dlist_node_t *item);
+
 /** @} (end addtogroup slist) */
 
 #ifdef __cplusplus
@@ -34,6 +34,87 @@
 #include <stdlib.h>
 #include <stdint.h>
 
+/*******************************************************************************
+ **************************   LOCAL FUNCTIONS   ********************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Sorts a list with a stable bottom-up merge sort.
+ *
+ * @param    head      Pointer to the pointer of the head element of the list.
+ *
+ * @param    cmp_fnct  Compare function, see sl_slist_sort().
+ *
+ * @return   Last item of the sorted list, NULL if the list is empty.
+ *
+ * @note     Runs in O(n log n) without recursion nor extra memory. Runs of
+ *           doubling size are merged until a single run is left. Ties take
+ *           the left item, which keeps the sort stable.
+ ******************************************************************************/
+static sl_slist_node_t *slist_merge_sort(sl_slist_node_t **head,
+                                         bool (*cmp_fnct)(sl_slist_node_t *item_l,
+                                                          sl_slist_node_t *item_r))
+{
+  sl_slist_node_t *list = *head;
+  sl_slist_node_t *tail = NULL;
+  size_t run = 1;
+  size_t merges;
+
+  if (list == NULL) {
+    return NULL;
+  }
+
+  do {
+    sl_slist_node_t *p_left = list;
+    sl_slist_node_t **pp_out = &list;
+
+    merges = 0;
+    tail = NULL;
+    while (p_left != NULL) {
+      sl_slist_node_t *p_right = p_left;
+      size_t len_l = 0;
+      size_t len_r = run;
+
+      merges++;
+      // Split off the left run.
+      while ((len_l < run) && (p_right != NULL)) {
+        len_l++;
+        p_right = p_right->node;
+      }
+
+      // Merge the left run with the right run that follows it.
+      while ((len_l > 0) || ((len_r > 0) && (p_right != NULL))) {
+        sl_slist_node_t *p_item;
+
+        if (len_l == 0) {
+          p_item = p_right;
+          p_right = p_right->node;
+          len_r--;
+        } else if ((len_r == 0) || (p_right == NULL)
+                   || cmp_fnct(p_left, p_right)) {
+          p_item = p_left;
+          p_left = p_left->node;
+          len_l--;
+        } else {
+          p_item = p_right;
+          p_right = p_right->node;
+          len_r--;
+        }
+        *pp_out = p_item;
+        pp_out = &p_item->node;
+        tail = p_item;
+      }
+      p_left = p_right;
+    }
+    *pp_out = NULL;
+    run *= 2;
+  } while (merges > 1);
+
+  *head = list;
+
+  return tail;
+}
+
 /*******************************************************************************
  **************************   GLOBAL FUNCTIONS   *******************************
  ******************************************************************************/
@@ -136,37 +217,215 @@ void sl_slist_sort(sl_slist_node_t **head,
                    bool (*cmp_fnct)(sl_slist_node_t *item_l,
                                     sl_slist_node_t *item_r))
 {
-  bool  swapped;
-  sl_slist_node_t **pp_item_l;
-
   EFM_ASSERT((head != NULL) && (cmp_fnct != NULL));
 
-  do {
-    swapped = false;
-
-    pp_item_l = head;
-    // Loop until end of list is found.
-    while ((*pp_item_l != NULL) && ((*pp_item_l)->node != NULL)) {
-      sl_slist_node_t *p_item_r = (*pp_item_l)->node;
-      bool  ordered;
-
-      // Call provided compare fnct.
-      ordered = cmp_fnct(*pp_item_l, p_item_r);
-      if (ordered == false) {
-        // If order is not correct, swap items.
-        sl_slist_node_t *p_tmp = p_item_r->node;
-
-        // Swap the two items.
-        p_item_r->node = *pp_item_l;
-        (*pp_item_l)->node = p_tmp;
-        *pp_item_l = p_item_r;
-        pp_item_l = &(p_item_r->node);
-        // Indicate a swap has been done.
-        swapped = true;
-      } else {
-        pp_item_l = &((*pp_item_l)->node);
+  (void)slist_merge_sort(head, cmp_fnct);
+}
+
+/***************************************************************************//**
+ * Initializes a singly-linked list with tail pointer.
+ ******************************************************************************/
+void sl_slist_queue_init(sl_slist_queue_t *list)
+{
+  EFM_ASSERT(list != NULL);
+
+  list->head = NULL;
+  list->tail = NULL;
+}
+
+/***************************************************************************//**
+ * Add given item at beginning of list with tail pointer.
+ ******************************************************************************/
+void sl_slist_queue_push(sl_slist_queue_t *list,
+                         sl_slist_node_t *item)
+{
+  EFM_ASSERT((item != NULL) && (list != NULL));
+
+  item->node = list->head;
+  list->head = item;
+  if (list->tail == NULL) {
+    list->tail = item;
+  }
+}
+
+/***************************************************************************//**
+ * Add item at end of list with tail pointer.
+ ******************************************************************************/
+void sl_slist_queue_push_back(sl_slist_queue_t *list,
+                              sl_slist_node_t *item)
+{
+  EFM_ASSERT((item != NULL) && (list != NULL));
+
+  item->node = NULL;
+  if (list->tail == NULL) {
+    list->head = item;
+  } else {
+    list->tail->node = item;
+  }
+  list->tail = item;
+}
+
+/***************************************************************************//**
+ * Removes and returns first element of list with tail pointer.
+ ******************************************************************************/
+sl_slist_node_t *sl_slist_queue_pop(sl_slist_queue_t *list)
+{
+  sl_slist_node_t *item;
+
+  EFM_ASSERT(list != NULL);
+
+  item = sl_slist_pop(&list->head);
+  if (list->head == NULL) {
+    list->tail = NULL;
+  }
+
+  return (item);
+}
+
+/***************************************************************************//**
+ * Remove item from list with tail pointer.
+ ******************************************************************************/
+void sl_slist_queue_remove(sl_slist_queue_t *list,
+                           sl_slist_node_t *item)
+{
+  sl_slist_node_t **node_ptr;
+  sl_slist_node_t *prev = NULL;
+
+  EFM_ASSERT((item != NULL) && (list != NULL));
+
+  for (node_ptr = &list->head; *node_ptr != NULL; node_ptr = &((*node_ptr)->node)) {
+    if (*node_ptr == item) {
+      *node_ptr = item->node;
+      if (list->tail == item) {
+        list->tail = prev;
       }
+      return;
     }
-    // Re-loop until no items have been swapped.
-  } while (swapped == true);
+    prev = *node_ptr;
+  }
+
+  EFM_ASSERT(node_ptr != NULL);
+}
+
+/***************************************************************************//**
+ * Sorts items of list with tail pointer.
+ ******************************************************************************/
+void sl_slist_queue_sort(sl_slist_queue_t *list,
+                         bool (*cmp_fnct)(sl_slist_node_t *item_l,
+                                          sl_slist_node_t *item_r))
+{
+  EFM_ASSERT((list != NULL) && (cmp_fnct != NULL));
+
+  list->tail = slist_merge_sort(&list->head, cmp_fnct);
+}
+
+/***************************************************************************//**
+ * Initializes a doubly-linked list.
+ ******************************************************************************/
+void sl_dlist_init(sl_dlist_t *list)
+{
+  EFM_ASSERT(list != NULL);
+
+  list->head = NULL;
+  list->tail = NULL;
+}
+
+/***************************************************************************//**
+ * Add given item at beginning of doubly-linked list.
+ ******************************************************************************/
+void sl_dlist_push(sl_dlist_t *list,
+                   sl_dlist_node_t *item)
+{
+  EFM_ASSERT((item != NULL) && (list != NULL));
+
+  item->prev = NULL;
+  item->next = list->head;
+  if (list->head == NULL) {
+    list->tail = item;
+  } else {
+    list->head->prev = item;
+  }
+  list->head = item;
+}
+
+/***************************************************************************//**
+ * Add item at end of doubly-linked list.
+ ******************************************************************************/
+void sl_dlist_push_back(sl_dlist_t *list,
+                        sl_dlist_node_t *item)
+{
+  EFM_ASSERT((item != NULL) && (list != NULL));
+
+  item->next = NULL;
+  item->prev = list->tail;
+  if (list->tail == NULL) {
+    list->head = item;
+  } else {
+    list->tail->next = item;
+  }
+  list->tail = item;
+}
+
+/***************************************************************************//**
+ * Removes and returns first element of doubly-linked list.
+ ******************************************************************************/
+sl_dlist_node_t *sl_dlist_pop(sl_dlist_t *list)
+{
+  sl_dlist_node_t *item;
+
+  EFM_ASSERT(list != NULL);
+
+  item = list->head;
+  if (item == NULL) {
+    return (NULL);
+  }
+
+  sl_dlist_remove(list, item);
+
+  return (item);
+}
+
+/***************************************************************************//**
+ * Insert item after given item of doubly-linked list.
+ ******************************************************************************/
+void sl_dlist_insert(sl_dlist_t *list,
+                     sl_dlist_node_t *item,
+                     sl_dlist_node_t *pos)
+{
+  EFM_ASSERT((list != NULL) && (item != NULL) && (pos != NULL));
+
+  item->prev = pos;
+  item->next = pos->next;
+  if (pos->next == NULL) {
+    list->tail = item;
+  } else {
+    pos->next->prev = item;
+  }
+  pos->next = item;
+}
+
+/***************************************************************************//**
+ * Remove item from doubly-linked list.
+ ******************************************************************************/
+void sl_dlist_remove(sl_dlist_t *list,
+                     sl_dlist_node_t *item)
+{
+  EFM_ASSERT((item != NULL) && (list != NULL));
+
+  if (item->prev == NULL) {
+    EFM_ASSERT(list->head == item);
+    list->head = item->next;
+  } else {
+    item->prev->next = item->next;
+  }
+
+  if (item->next == NULL) {
+    EFM_ASSERT(list->tail == item);
+    list->tail = item->prev;
+  } else {
+    item->next->prev = item->prev;
+  }
+
+  item->next = NULL;
+  item->prev = NULL;
 }
@@ -109,6 +109,14 @@ extern "C" {
  *   to avoid breaking security. See the specific cipher mode
  *   theory for details.
  *
+ *   On devices with an LDMA, @ref CRYPTO_AES_DmaStart() runs any of the
+ *   modes above in the background. The instruction sequence is loaded once
+ *   and repeated for each block, and two LDMA channels serviced by the
+ *   CRYPTO DATA0/DATA1 DMA requests move the blocks in and out of CRYPTO.
+ *   Completion is signaled through a callback from
+ *   @ref CRYPTO_AES_DmaIRQHandler(), which the application must call from the
+ *   CRYPTO interrupt handler. Buffers must be word aligned.
+ *
  *   References:
  *   @li Wikipedia - Cipher modes, en.wikipedia.org/wiki/Cipher_modes
  *
@@ -147,6 +155,24 @@ extern "C" {
  *   -D USE_VARIABLE_SIZED_DATA_LOADS to load these numbers
  *   directly into CRYPTO without converting the number representation.
  *
+ *   @n @section crypto_mod Modular Arithmetic
+ *   The modular arithmetic APIs use the MADD, MSUB and MMUL instructions,
+ *   which reduce modulo one of the fixed moduli of the CRYPTO module
+ *   (see @ref CRYPTO_ModulusId_TypeDef). Arbitrary moduli, such as RSA
+ *   moduli, are not supported by the hardware reduction and must use
+ *   @ref CRYPTO_Mul with a software reduction.
+ *   @li @ref CRYPTO_ModInit - Select the modulus and operand widths.
+ *   @li @ref CRYPTO_ModAdd, @ref CRYPTO_ModSub, @ref CRYPTO_ModMul
+ *   @li @ref CRYPTO_ModExp, @ref CRYPTO_ModInv
+ *   @li @ref CRYPTO_EccPointDouble, @ref CRYPTO_EccPointAdd and
+ *       @ref CRYPTO_EccPointToAffine for the NIST P-256 and P-192 curves.
+ *
+ *   Operands are 256 bit little endian word arrays and must be reduced, i.e.
+ *   smaller than the modulus. During @ref CRYPTO_ModExp the base and the
+ *   accumulator stay in the DDATA registers, so only the exponent bits are
+ *   handled by the MCU. Points are kept in Jacobian coordinates, where a
+ *   point with Z equal to zero is the point at infinity.
+ *
  *   @n @section crypto_exec Load and Execute Instruction Sequences
  *   The functions for loading data and executing instruction sequences can
  *   be used to implement complex algorithms, such as elliptic curve cryptography
@@ -590,6 +616,70 @@ typedef uint8_t CRYPTO_SHA256_Digest_TypeDef[CRYPTO_SHA256_DIGEST_SIZE_IN_BYTES]
  */
 typedef void (*CRYPTO_AES_CtrFuncPtr_TypeDef)(uint8_t * ctr);
 
+/** Elliptic curve point in Jacobian coordinates (X/Z^2, Y/Z^3). */
+typedef struct {
+  CRYPTO_DData_TypeDef X; /**< X coordinate */
+  CRYPTO_DData_TypeDef Y; /**< Y coordinate */
+  CRYPTO_DData_TypeDef Z; /**< Z coordinate, zero for the point at infinity */
+} CRYPTO_EccPoint_TypeDef;
+
+#if defined(LDMA_PRESENT) && (LDMA_COUNT == 1)
+/** AES cipher modes supported by the DMA driven AES API. */
+typedef enum {
+  cryptoAesModeEcb,  /**< Electronic codebook. */
+  cryptoAesModeCbc,  /**< Cipher block chaining. */
+  cryptoAesModePcbc, /**< Propagating cipher block chaining. */
+  cryptoAesModeCfb,  /**< Cipher feedback. */
+  cryptoAesModeOfb,  /**< Output feedback. */
+  cryptoAesModeCtr   /**< Counter. */
+} CRYPTO_AesMode_TypeDef;
+
+struct CRYPTO_AES_DmaTransfer;
+
+/**
+ * @brief
+ *   DMA driven AES completion callback, called from CRYPTO interrupt context.
+ *
+ * @param[in] transfer
+ *   The transfer that completed.
+ */
+typedef void (*CRYPTO_AES_DmaCallback_TypeDef)(struct CRYPTO_AES_DmaTransfer *transfer);
+
+/**
+ * DMA driven AES transfer. The structure is owned by the CRYPTO driver from
+ * the call to @ref CRYPTO_AES_DmaStart() until the callback is called.
+ */
+typedef struct CRYPTO_AES_DmaTransfer {
+  CRYPTO_AesMode_TypeDef         mode;      /**< Cipher mode. */
+  CRYPTO_KeyWidth_TypeDef        keyWidth;  /**< Set to cryptoKey128Bits or
+                                                 cryptoKey256Bits. */
+  bool                           encrypt;   /**< Set to true to encrypt, false
+                                                 to decrypt. Ignored for OFB
+                                                 and CTR modes. */
+  const uint8_t                  *key;      /**< Encryption or decryption key,
+                                                 see the blocking function of
+                                                 the same mode. */
+  uint8_t                        *iv;       /**< 128 bit initialization vector,
+                                                 or the counter in CTR mode,
+                                                 which is updated on
+                                                 completion. Unused in ECB. */
+  unsigned int                   dmaChIn;   /**< LDMA channel moving input
+                                                 blocks into CRYPTO. */
+  unsigned int                   dmaChOut;  /**< LDMA channel moving output
+                                                 blocks out of CRYPTO. */
+  CRYPTO_AES_DmaCallback_TypeDef callback;  /**< Completion callback, may be
+                                                 NULL. */
+  void                           *userData; /**< User data, not used by the
+                                                 driver. */
+  /** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+  uint8_t                        *out;
+  const uint8_t                  *in;
+  unsigned int                   len;
+  unsigned int                   offset;
+  /** @endcond */
+} CRYPTO_AES_DmaTransfer_TypeDef;
+#endif /* defined(LDMA_PRESENT) && (LDMA_COUNT == 1) */
+
 /*******************************************************************************
  *****************************   PROTOTYPES   **********************************
  ******************************************************************************/
@@ -1175,6 +1265,50 @@ void CRYPTO_Mul(CRYPTO_TypeDef *crypto,
                 uint32_t * B, int bSize,
                 uint32_t * R, int rSize);
 
+void CRYPTO_ModInit(CRYPTO_TypeDef *crypto,
+                    CRYPTO_ModulusId_TypeDef modulusId);
+
+void CRYPTO_ModAdd(CRYPTO_TypeDef *crypto,
+                   const CRYPTO_DData_TypeDef A,
+                   const CRYPTO_DData_TypeDef B,
+                   CRYPTO_DData_TypeDef R);
+
+void CRYPTO_ModSub(CRYPTO_TypeDef *crypto,
+                   const CRYPTO_DData_TypeDef A,
+                   const CRYPTO_DData_TypeDef B,
+                   CRYPTO_DData_TypeDef R);
+
+void CRYPTO_ModMul(CRYPTO_TypeDef *crypto,
+                   const CRYPTO_DData_TypeDef A,
+                   const CRYPTO_DData_TypeDef B,
+                   CRYPTO_DData_TypeDef R);
+
+void CRYPTO_ModExp(CRYPTO_TypeDef *crypto,
+                   const CRYPTO_DData_TypeDef A,
+                   const CRYPTO_DData_TypeDef E,
+                   CRYPTO_DData_TypeDef R);
+
+void CRYPTO_ModInv(CRYPTO_TypeDef *crypto,
+                   CRYPTO_ModulusId_TypeDef modulusId,
+                   const CRYPTO_DData_TypeDef A,
+                   CRYPTO_DData_TypeDef R);
+
+void CRYPTO_EccPointDouble(CRYPTO_TypeDef *crypto,
+                           CRYPTO_ModulusId_TypeDef curve,
+                           const CRYPTO_EccPoint_TypeDef *P,
+                           CRYPTO_EccPoint_TypeDef *R);
+
+void CRYPTO_EccPointAdd(CRYPTO_TypeDef *crypto,
+                        CRYPTO_ModulusId_TypeDef curve,
+                        const CRYPTO_EccPoint_TypeDef *P,
+                        const CRYPTO_EccPoint_TypeDef *Q,
+                        CRYPTO_EccPoint_TypeDef *R);
+
+void CRYPTO_EccPointToAffine(CRYPTO_TypeDef *crypto,
+                             CRYPTO_ModulusId_TypeDef curve,
+                             const CRYPTO_EccPoint_TypeDef *P,
+                             CRYPTO_EccPoint_TypeDef *R);
+
 void CRYPTO_AES_CBC128(CRYPTO_TypeDef *crypto,
                        uint8_t * out,
                        const uint8_t * in,
@@ -1271,6 +1405,16 @@ void CRYPTO_AES_OFB256(CRYPTO_TypeDef *crypto,
                        const uint8_t * key,
                        const uint8_t * iv);
 
+#if defined(LDMA_PRESENT) && (LDMA_COUNT == 1)
+void CRYPTO_AES_DmaStart(CRYPTO_TypeDef *crypto,
+                         CRYPTO_AES_DmaTransfer_TypeDef *transfer,
+                         uint8_t * out,
+                         const uint8_t * in,
+                         unsigned int len);
+bool CRYPTO_AES_DmaBusy(CRYPTO_TypeDef *crypto);
+void CRYPTO_AES_DmaIRQHandler(CRYPTO_TypeDef *crypto);
+#endif
+
 /***************************************************************************//**
  * @brief
  *   Clear one or more pending CRYPTO interrupts.
@@ -62,6 +62,11 @@ extern "C" {
 #endif
 #endif
 
+#if !defined(SL_EMLIB_EMU_ENABLE_WAKEUP_TIMING)
+/** Set to 1 to record EM2/EM3 wakeup latency with the DWT cycle counter. */
+#define SL_EMLIB_EMU_ENABLE_WAKEUP_TIMING   0
+#endif
+
 #if defined(_EMU_DCDCCTRL_MASK)
 /** DC-DC buck converter present */
 #define EMU_SERIES1_DCDC_BUCK_PRESENT
@@ -1114,6 +1119,16 @@ void EMU_EnterEM2(bool restore);
 void EMU_EnterEM3(bool restore);
 void EMU_Save(void);
 void EMU_Restore(void);
+#if (_SILICON_LABS_32B_SERIES < 2)
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+void sli_em_emu_RestoreImageInvalidate(void);
+/** @endcond */
+#endif
+#if (SL_EMLIB_EMU_ENABLE_WAKEUP_TIMING == 1)
+uint32_t EMU_EM23WakeupCyclesGet(void);
+uint32_t EMU_EM23WakeupCyclesMaxGet(void);
+void EMU_EM23WakeupCyclesClear(void);
+#endif
 #if defined(_EMU_EM4CONF_MASK) || defined(_EMU_EM4CTRL_MASK)
 void EMU_EM4Init(const EMU_EM4Init_TypeDef *em4Init);
 #endif
@@ -34,6 +34,7 @@
 #include "em_device.h"
 
 #if defined(LCD_COUNT) && (LCD_COUNT > 0)
+#include "sl_assert.h"
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -68,6 +69,22 @@ extern "C" {
 #define LCD_SEGMENT_LINES_MAX       LCD_SEG_NUM
 #endif
 
+/** Number of COM lines in an LCD frame buffer. */
+#if defined(_SILICON_LABS_32B_SERIES_2)
+#define LCD_FRAMEBUFFER_COM_LINES   LCD_COM_LINES_MAX
+#elif defined(_LCD_SEGD7L_MASK)
+#define LCD_FRAMEBUFFER_COM_LINES   8
+#else
+#define LCD_FRAMEBUFFER_COM_LINES   4
+#endif
+
+/** Number of 32 bit segment data words per COM line in an LCD frame buffer. */
+#if defined(_LCD_SEGD0H_MASK)
+#define LCD_FRAMEBUFFER_COM_WORDS   2
+#else
+#define LCD_FRAMEBUFFER_COM_WORDS   1
+#endif
+
 /*******************************************************************************
  ********************************   ENUMS   ************************************
  ******************************************************************************/
@@ -399,6 +416,20 @@ typedef struct {
 #endif
 } LCD_Init_TypeDef;
 
+/**
+ * LCD shadow frame buffer.
+ *
+ * Holds a full display image in RAM, in the same bit layout as the SEGD
+ * registers, so that it can be built with plain memory accesses and written
+ * to the LCD in one @ref LCD_FrameBufferCommit().
+ */
+typedef struct {
+  /** Segment data, bit n of word w is segment (32 * w + n) of the COM line. */
+  uint32_t segd[LCD_FRAMEBUFFER_COM_LINES][LCD_FRAMEBUFFER_COM_WORDS];
+  /** Words changed since the last commit, bit (com * LCD_FRAMEBUFFER_COM_WORDS + w). */
+  uint32_t dirty;
+} LCD_FrameBuffer_TypeDef;
+
 /** Default configuration for LCD initialization structure, enables 160 segments.  */
 #if defined(_SILICON_LABS_32B_SERIES_0)
 #define LCD_INIT_DEFAULT \
@@ -462,6 +493,8 @@ void LCD_ComEnable(uint8_t com, bool enable);
 void LCD_DmaModeSet(LCD_DmaMode_Typedef mode);
 #endif
 void LCD_SegmentSet(int com, int bit, bool enable);
+void LCD_FrameBufferInit(LCD_FrameBuffer_TypeDef *fb);
+void LCD_FrameBufferCommit(LCD_FrameBuffer_TypeDef *fb);
 void LCD_SegmentSetLow(int com, uint32_t mask, uint32_t bits);
 #if defined(_LCD_SEGD0H_MASK)
 void LCD_SegmentSetHigh(int com, uint32_t mask, uint32_t bits);
@@ -480,6 +513,44 @@ void LCD_ModeSet(LCD_Mode_Typedef mode);
 void LCD_ChargeRedistributionCyclesSet(uint8_t cycles);
 #endif
 
+/***************************************************************************//**
+ * @brief
+ *   Turn on or clear a segment in an LCD shadow frame buffer.
+ *
+ * @details
+ *   Only the RAM image is changed. Call @ref LCD_FrameBufferCommit() to
+ *   write the changes to the LCD.
+ *
+ * @param[in] fb
+ *   A pointer to the frame buffer.
+ *
+ * @param[in] com
+ *   A COM line to change.
+ *
+ * @param[in] bit
+ *   A bit index indicating which segment to change.
+ *
+ * @param[in] enable
+ *   True will set segment, false will clear segment.
+ ******************************************************************************/
+__STATIC_INLINE void LCD_FrameBufferSegmentSet(LCD_FrameBuffer_TypeDef *fb,
+                                               int com,
+                                               int bit,
+                                               bool enable)
+{
+  int word = bit >> 5;
+
+  EFM_ASSERT((com >= 0) && (com < (int)LCD_FRAMEBUFFER_COM_LINES));
+  EFM_ASSERT((bit >= 0) && (word < (int)LCD_FRAMEBUFFER_COM_WORDS));
+
+  if (enable) {
+    fb->segd[com][word] |= 1UL << (bit & 31);
+  } else {
+    fb->segd[com][word] &= ~(1UL << (bit & 31));
+  }
+  fb->dirty |= 1UL << ((com * LCD_FRAMEBUFFER_COM_WORDS) + word);
+}
+
 #if defined(_SILICON_LABS_32B_SERIES_2)
 /***************************************************************************//**
  * @brief
@@ -36,6 +36,9 @@
 #if defined(LESENSE_COUNT) && (LESENSE_COUNT > 0)
 #include <stdint.h>
 #include <stdbool.h>
+#if defined(_SILICON_LABS_32B_SERIES_1) && defined(LDMA_PRESENT) && (LDMA_COUNT == 1)
+#include "em_ldma.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -1517,6 +1520,103 @@ typedef struct {
   }
 #endif
 
+#if defined(_SILICON_LABS_32B_SERIES_1) && defined(LDMA_PRESENT) && (LDMA_COUNT == 1)
+/** Capacitive touch engine is available. */
+#define LESENSE_TOUCH_PRESENT
+
+/** Number of fractional bits of the touch baseline. */
+#define LESENSE_TOUCH_BASELINE_FRAC   8U
+
+/** Capacitive touch events. */
+typedef enum {
+  lesenseTouchEventNone,     /**< No state change. */
+  lesenseTouchEventPress,    /**< Channel became touched. */
+  lesenseTouchEventRelease   /**< Channel was released. */
+} LESENSE_TouchEvent_TypeDef;
+
+/** Capacitive touch configuration of one LESENSE channel. A touch lowers the
+ *  oscillation count of the channel below its baseline. */
+typedef struct {
+  /** LESENSE channel index. */
+  uint8_t  chIdx;
+
+  /** Count drop below the baseline that is reported as a press. */
+  uint16_t touchDelta;
+
+  /** Count drop below the baseline under which a touched channel is
+   *  released. Must be less than touchDelta, the difference is the
+   *  hysteresis. */
+  uint16_t releaseDelta;
+
+  /** Baseline IIR filter coefficient, the baseline moves by
+   *  2^-baselineShift of the difference to each untouched sample. */
+  uint8_t  baselineShift;
+
+  /** Number of consecutive samples needed to change state. */
+  uint8_t  debounce;
+} LESENSE_TouchChannel_TypeDef;
+
+/** Capacitive touch processing state of one channel. */
+typedef struct {
+  /** Baseline count with LESENSE_TOUCH_BASELINE_FRAC fractional bits. */
+  uint32_t baseline;
+
+  /** Consecutive samples seen in favor of a state change. */
+  uint8_t  debounceCnt;
+
+  /** Channel is touched. */
+  bool     touched;
+
+  /** Baseline has been initialized from the first sample. */
+  bool     valid;
+} LESENSE_TouchState_TypeDef;
+
+/***************************************************************************//**
+ * @brief
+ *   Capacitive touch event callback, called from interrupt context.
+ *
+ * @param[in] chIdx
+ *   LESENSE channel index.
+ *
+ * @param[in] event
+ *   Press or release event.
+ ******************************************************************************/
+typedef void (*LESENSE_TouchCallback_TypeDef)(uint8_t chIdx,
+                                              LESENSE_TouchEvent_TypeDef event);
+
+/** Capacitive touch engine instance. Owned by the driver between
+ *  @ref LESENSE_TouchStart() and @ref LESENSE_TouchStop(). */
+typedef struct {
+  /** Configuration of each processed channel. */
+  const LESENSE_TouchChannel_TypeDef *channels;
+
+  /** State of each processed channel, same number of entries as channels. */
+  LESENSE_TouchState_TypeDef         *state;
+
+  /** Number of processed channels. */
+  uint8_t                            numChannels;
+
+  /** RAM ring receiving the raw LESENSE results through LDMA. */
+  uint32_t                           *buffer;
+
+  /** Number of words in buffer, at least 2. The CPU is woken for baseline
+   *  tracking each time half of the ring has been filled. */
+  uint16_t                           size;
+
+  /** LDMA channel draining the LESENSE result buffer. */
+  unsigned int                       dmaCh;
+
+  /** Press and release callback, may be NULL. */
+  LESENSE_TouchCallback_TypeDef      callback;
+
+  /** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+  uint16_t                           readIndex;
+  uint8_t                            chMap[LESENSE_NUM_CHANNELS];
+  LDMA_Descriptor_t                  desc[2];
+  /** @endcond */
+} LESENSE_Touch_TypeDef;
+#endif /* LESENSE_TOUCH_PRESENT */
+
 /*******************************************************************************
  *****************************   PROTOTYPES   **********************************
  ******************************************************************************/
@@ -1572,6 +1672,17 @@ void LESENSE_ScanStop(void);
 void LESENSE_DecoderStart(void);
 void LESENSE_ResultBufferClear(void);
 
+#if defined(LESENSE_TOUCH_PRESENT)
+void LESENSE_TouchStart(LESENSE_Touch_TypeDef *touch);
+void LESENSE_TouchStop(LESENSE_Touch_TypeDef *touch);
+void LESENSE_TouchProcess(LESENSE_Touch_TypeDef *touch);
+LESENSE_TouchEvent_TypeDef LESENSE_TouchFilter(LESENSE_TouchState_TypeDef *state,
+                                               const LESENSE_TouchChannel_TypeDef *channel,
+                                               uint16_t count);
+uint16_t LESENSE_TouchThresholdGet(const LESENSE_TouchState_TypeDef *state,
+                                   const LESENSE_TouchChannel_TypeDef *channel);
+#endif
+
 /***************************************************************************//**
  * @brief
  *   Stop LESENSE decoder.
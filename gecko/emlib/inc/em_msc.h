@@ -92,6 +92,14 @@ extern "C" {
  *  The following steps are necessary to perform a page erase and write:
  *  @include em_msc_erase_write.c
  *
+ *  On devices with erase and write done interrupts, @ref MSC_ErasePageAsync(),
+ *  @ref MSC_WriteWordAsync() and @ref MSC_AsyncSubmit() queue operations that
+ *  complete from the MSC interrupt instead of busy-waiting. Multiple requests
+ *  can be queued back-to-back; each one reports completion through its own
+ *  callback. The application must call @ref MSC_AsyncIRQHandler() from
+ *  MSC_IRQHandler(). Code executing from flash still stalls while the flash
+ *  is busy, so the CPU is only free to do other work from RAM or while asleep.
+ *
  * @deprecated
  *   The configuration called EM_MSC_RUN_FROM_FLASH is deprecated. This was
  *   previously used for allocating the flash write functions in either flash
@@ -311,6 +319,60 @@ typedef struct {
 
 #endif /* #if defined(_MSC_ECCCTRL_MASK) */
 
+#if defined(MSC_IF_ERASE) && defined(MSC_IF_WRITE) \
+  && !defined(SL_CATALOG_TZ_SECURE_KEY_LIBRARY_NS_PRESENT)
+/** Interrupt-driven flash erase and program API is available. */
+#define MSC_ASYNC_PRESENT
+
+/** Asynchronous flash operation type. */
+typedef enum {
+  mscAsyncOpErase, /**< Erase one or more consecutive flash pages. */
+  mscAsyncOpWrite  /**< Program one or more consecutive flash words. */
+} MSC_AsyncOp_TypeDef;
+
+struct MSC_AsyncRequest;
+
+/***************************************************************************//**
+ * @brief
+ *   Asynchronous flash operation completion callback.
+ *
+ * @details
+ *   Called from MSC interrupt context when all pages or words of a request
+ *   have been processed, or when the first error is detected.
+ *
+ * @param[in] request
+ *   The request that completed.
+ *
+ * @param[in] status
+ *   Final status of the operation, @ref MSC_Status_TypeDef.
+ ******************************************************************************/
+typedef void (*MSC_AsyncCallback_TypeDef)(struct MSC_AsyncRequest *request,
+                                          MSC_Status_TypeDef status);
+
+/**
+ * Asynchronous flash operation request. The structure is owned by the MSC
+ * driver from the moment it is submitted until its callback is called, and
+ * must not be modified or go out of scope during that time.
+ */
+typedef struct MSC_AsyncRequest {
+  MSC_AsyncOp_TypeDef       op;       /**< Erase or program operation. */
+  uint32_t                  *address; /**< Start address in flash. Must be page
+                                           aligned for erase and word aligned
+                                           for program operations. */
+  const void                *data;    /**< Data to program, must remain valid
+                                           until completion. Unused for erase. */
+  uint32_t                  numBytes; /**< Number of bytes to process. Multiple
+                                           of FLASH_PAGE_SIZE for erase and of
+                                           four for program operations. */
+  MSC_AsyncCallback_TypeDef callback; /**< Completion callback, may be NULL. */
+  void                      *userData;/**< User data, not used by the driver. */
+  /** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+  uint32_t                  offset;   /* Bytes processed so far. */
+  struct MSC_AsyncRequest   *next;    /* Next request in the queue. */
+  /** @endcond */
+} MSC_AsyncRequest_TypeDef;
+#endif /* MSC_IF_ERASE && MSC_IF_WRITE */
+
 /** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
 /* Deprecated type names. */
 #define mscBusStrategy_Typedef MSC_BusStrategy_Typedef
@@ -872,6 +934,24 @@ MSC_Status_TypeDef MSC_WriteWordDma(int ch,
 void MSC_Init(void);
 void MSC_Deinit(void);
 
+#if defined(MSC_ASYNC_PRESENT)
+MSC_Status_TypeDef MSC_AsyncSubmit(MSC_AsyncRequest_TypeDef *request);
+MSC_Status_TypeDef MSC_ErasePageAsync(MSC_AsyncRequest_TypeDef *request,
+                                      uint32_t *startAddress,
+                                      uint32_t numPages,
+                                      MSC_AsyncCallback_TypeDef callback,
+                                      void *userData);
+MSC_Status_TypeDef MSC_WriteWordAsync(MSC_AsyncRequest_TypeDef *request,
+                                      uint32_t *address,
+                                      void const *data,
+                                      uint32_t numBytes,
+                                      MSC_AsyncCallback_TypeDef callback,
+                                      void *userData);
+bool MSC_AsyncIsBusy(void);
+MSC_RAMFUNC_DECLARATOR
+void MSC_AsyncIRQHandler(void);
+#endif
+
 /** @} (end addtogroup msc) */
 
 #ifdef __cplusplus
@@ -563,6 +563,9 @@ void PCNT_PRSInputEnable(PCNT_TypeDef *pcnt,
 
 #if defined(PCNT_CTRL_TCCMODE_DEFAULT)
 void PCNT_TCCConfiguration(PCNT_TypeDef *pcnt, const PCNT_TCC_TypeDef *config);
+void PCNT_GatedCountStart(PCNT_TypeDef *pcnt,
+                          PCNT_PRSSel_TypeDef prsSel,
+                          bool prsPolarity);
 #endif
 
 /***************************************************************************//**
@@ -36,6 +36,9 @@
 
 #include <stdbool.h>
 #include "sl_assert.h"
+#if defined(LDMA_PRESENT) && (LDMA_COUNT == 1)
+#include "em_ldma.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -569,6 +572,77 @@ typedef struct {
   }
 #endif /* _TIMER_DTCTRL_MASK */
 
+#if defined(LDMA_PRESENT) && (LDMA_COUNT == 1)
+/** TIMER capture to LDMA measurement engine is available. */
+#define TIMER_CAPTURE_PRESENT
+
+/** Period and high time statistics of a captured signal, in timer ticks. */
+typedef struct {
+  /** Number of periods accumulated. */
+  uint32_t periods;
+
+  /** Shortest period. */
+  uint32_t periodMin;
+
+  /** Longest period. */
+  uint32_t periodMax;
+
+  /** Sum of all periods. */
+  uint64_t periodSum;
+
+  /** Number of high times accumulated. */
+  uint32_t highs;
+
+  /** Sum of all high times. */
+  uint64_t highSum;
+} TIMER_CaptureStats_TypeDef;
+
+/**
+ * TIMER capture to LDMA measurement engine.
+ *
+ * The TIMER must be set up by the application with the @p riseAction of
+ * @ref TIMER_Init_TypeDef set to @ref timerInputActionReloadStart, CC0 capturing rising edges and CC1
+ * capturing falling edges of the same signal, for instance through a PRS
+ * channel. Each CC0 capture is then the length of the period that just ended
+ * and each CC1 capture the high time of the current period. The TOP value
+ * must be larger than the longest expected period.
+ */
+typedef struct {
+  /** TIMER instance. */
+  TIMER_TypeDef            *timer;
+
+  /** LDMA channel moving CC0 captures (periods). */
+  unsigned int             periodDmaCh;
+
+  /** LDMA channel moving CC1 captures (high times). */
+  unsigned int             highDmaCh;
+
+  /** LDMA request of CC0, for instance ldmaPeripheralSignal_TIMER0_CC0. */
+  LDMA_PeripheralSignal_t  periodSignal;
+
+  /** LDMA request of CC1, for instance ldmaPeripheralSignal_TIMER0_CC1. */
+  LDMA_PeripheralSignal_t  highSignal;
+
+  /** Ring receiving the periods, @p size words. */
+  uint32_t                 *periodBuffer;
+
+  /** Ring receiving the high times, @p size words. */
+  uint32_t                 *highBuffer;
+
+  /** Number of words in each ring. Must be at least 2. */
+  uint16_t                 size;
+
+  /** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+  uint16_t                 periodRead;
+  uint16_t                 highRead;
+  bool                     periodPrimed;
+  bool                     highPrimed;
+  LDMA_Descriptor_t        periodDesc[2];
+  LDMA_Descriptor_t        highDesc[2];
+  /** @endcond */
+} TIMER_Capture_TypeDef;
+#endif /* LDMA_PRESENT */
+
 /*******************************************************************************
  *****************************   PROTOTYPES   **********************************
  ******************************************************************************/
@@ -1149,6 +1223,22 @@ __STATIC_INLINE void TIMER_Lock(TIMER_TypeDef *timer)
 
 void TIMER_Reset(TIMER_TypeDef *timer);
 
+#if defined(TIMER_CAPTURE_PRESENT)
+void TIMER_CaptureStart(TIMER_Capture_TypeDef *capture);
+void TIMER_CaptureStop(TIMER_Capture_TypeDef *capture);
+void TIMER_CaptureProcess(TIMER_Capture_TypeDef *capture,
+                          TIMER_CaptureStats_TypeDef *stats);
+void TIMER_CaptureStatsClear(TIMER_CaptureStats_TypeDef *stats);
+void TIMER_CaptureStatsUpdate(TIMER_CaptureStats_TypeDef *stats,
+                              const uint32_t *periods,
+                              unsigned int periodCount,
+                              const uint32_t *highs,
+                              unsigned int highCount);
+uint32_t TIMER_CaptureStatsFreqGet(const TIMER_CaptureStats_TypeDef *stats,
+                                   uint32_t timerFreq);
+uint32_t TIMER_CaptureStatsDutyGet(const TIMER_CaptureStats_TypeDef *stats);
+#endif
+
 /***************************************************************************//**
  * @brief
  *   Set the top value buffer for the timer.
@@ -9287,6 +9287,7 @@ void sli_em_cmu_HFClockSelectCLKIN0(void)
 
   // Select HF clock source.
   CMU->HFCLKSEL = CMU_HFCLKSEL_HF_CLKIN0;
+  sli_em_emu_RestoreImageInvalidate();
 #if defined(CMU_MAX_FREQ_HFLE)
   setHfLeConfig(SystemHFClockGet());
 #endif
@@ -9389,6 +9390,12 @@ void sli_em_cmu_HFClockSelectUSHFRCO(void)
  *   @if CMU_OSCENCMD_PLFRCOEN
  *   @li #cmuSelect_PLFRCO
  *   @endif
+ *
+ * @note
+ *   This function also invalidates the oscillator and clock state that
+ *   @ref EMU_EnterEM2() and @ref EMU_EnterEM3() restore on wakeup. Writing
+ *   the CMU registers directly does not. Call @ref EMU_Save() after such
+ *   writes.
  ******************************************************************************/
 void CMU_ClockSelectSet(CMU_Clock_TypeDef clock, CMU_Select_TypeDef ref)
 {
@@ -9552,6 +9559,7 @@ void CMU_ClockSelectSet(CMU_Clock_TypeDef clock, CMU_Select_TypeDef ref)
 #else
       CMU->CMD = select;
 #endif
+      sli_em_emu_RestoreImageInvalidate();
       /* Update the CMSIS core clock variable. */
       /* (The function will update the global variable). */
       freq = SystemCoreClockGet();
@@ -10288,6 +10296,7 @@ bool CMU_DPLLLock(const CMU_DPLLInit_TypeDef *init)
   CMU->DPLLCTRL1 = ((uint32_t)init->n   << _CMU_DPLLCTRL1_N_SHIFT)
                    | ((uint32_t)init->m << _CMU_DPLLCTRL1_M_SHIFT);
   CMU->HFRCOCTRL = hfrcoCtrlVal;
+  sli_em_emu_RestoreImageInvalidate();
   CMU->DPLLCTRL  = ((uint32_t)init->refClk << _CMU_DPLLCTRL_REFSEL_SHIFT)
                    | ((init->autoRecover ? 1UL : 0UL)
                       << _CMU_DPLLCTRL_AUTORECOVER_SHIFT)
@@ -10464,6 +10473,7 @@ void CMU_HFRCOBandSet(CMU_HFRCOBand_TypeDef band)
                     & ~(_CMU_HFRCOCTRL_BAND_MASK | _CMU_HFRCOCTRL_TUNING_MASK))
                    | (band << _CMU_HFRCOCTRL_BAND_SHIFT)
                    | (tuning << _CMU_HFRCOCTRL_TUNING_SHIFT);
+  sli_em_emu_RestoreImageInvalidate();
 
   /* If HFRCO is used for the core clock, optimize flash WS. */
   if (osc == cmuSelect_HFRCO) {
@@ -10631,6 +10641,7 @@ void CMU_HFRCOBandSet(CMU_HFRCOFreq_TypeDef setFreq)
   }
 
   CMU->HFRCOCTRL = freqCal;
+  sli_em_emu_RestoreImageInvalidate();
 
   /* If HFRCO is selected as an HF clock, optimize the flash access wait-state configuration
      for this frequency and update the CMSIS core clock variable. */
@@ -10846,6 +10857,7 @@ void CMU_HFXOAutostartEnable(uint32_t userSel,
   /* Update HFXOCTRL after wait-states are updated as HF may automatically switch
      to HFXO when automatic select is enabled . */
   CMU->HFXOCTRL = hfxoCtrl;
+  sli_em_emu_RestoreImageInvalidate();
 }
 #endif
 
@@ -11165,6 +11177,12 @@ uint16_t CMU_HFXOPrecisionGet(void)
  *   @li true - wait for oscillator start-up time to timeout before returning.
  *   @li false - do not wait for oscillator start-up time to timeout before
  *     returning.
+ *
+ * @note
+ *   This function also invalidates the oscillator and clock state that
+ *   @ref EMU_EnterEM2() and @ref EMU_EnterEM3() restore on wakeup. Writing
+ *   the CMU registers directly does not. Call @ref EMU_Save() after such
+ *   writes.
  ******************************************************************************/
 void CMU_OscillatorEnable(CMU_Osc_TypeDef osc, bool enable, bool wait)
 {
@@ -11282,6 +11300,7 @@ void CMU_OscillatorEnable(CMU_Osc_TypeDef osc, bool enable, bool wait)
     }
 #endif
     CMU->OSCENCMD = enBit;
+    sli_em_emu_RestoreImageInvalidate();
 
 #if defined(_SILICON_LABS_32B_SERIES_1)
     /* Always wait for ENS to go high. */
@@ -11324,6 +11343,7 @@ void CMU_OscillatorEnable(CMU_Osc_TypeDef osc, bool enable, bool wait)
     }
   } else {
     CMU->OSCENCMD = disBit;
+    sli_em_emu_RestoreImageInvalidate();
 
 #if defined(_SILICON_LABS_32B_SERIES_1)
     /* Always wait for ENS to go low. */
@@ -11464,6 +11484,7 @@ void CMU_OscillatorTuningSet(CMU_Osc_TypeDef osc, uint32_t val)
 #endif
       CMU->HFRCOCTRL = (CMU->HFRCOCTRL & ~(_CMU_HFRCOCTRL_TUNING_MASK))
                        | (val << _CMU_HFRCOCTRL_TUNING_SHIFT);
+      sli_em_emu_RestoreImageInvalidate();
       break;
 
 #if defined (_CMU_USHFRCOCTRL_TUNING_MASK)
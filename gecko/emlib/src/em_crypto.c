@@ -33,6 +33,9 @@
 
 #include "em_crypto.h"
 #include "sl_assert.h"
+#if defined(LDMA_PRESENT) && (LDMA_COUNT == 1)
+#include "em_ldma.h"
+#endif
 #include <stddef.h>
 #include <string.h>
 
@@ -1059,6 +1062,486 @@ void CRYPTO_Mul(CRYPTO_TypeDef * crypto,
   } /* for (i=0; i<numPartialOperandsA; i++) */
 }
 
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+
+/* Prime moduli and curve orders, least significant word first. */
+static const CRYPTO_DData_TypeDef cryptoModP256 = {
+  0xFFFFFFFFUL, 0xFFFFFFFFUL, 0xFFFFFFFFUL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000001UL, 0xFFFFFFFFUL
+};
+static const CRYPTO_DData_TypeDef cryptoModP256Order = {
+  0xFC632551UL, 0xF3B9CAC2UL, 0xA7179E84UL, 0xBCE6FAADUL,
+  0xFFFFFFFFUL, 0xFFFFFFFFUL, 0x00000000UL, 0xFFFFFFFFUL
+};
+static const CRYPTO_DData_TypeDef cryptoModP224 = {
+  0x00000001UL, 0x00000000UL, 0x00000000UL, 0xFFFFFFFFUL,
+  0xFFFFFFFFUL, 0xFFFFFFFFUL, 0xFFFFFFFFUL, 0x00000000UL
+};
+static const CRYPTO_DData_TypeDef cryptoModP224Order = {
+  0x5C5C2A3DUL, 0x13DD2945UL, 0xE0B8F03EUL, 0xFFFF16A2UL,
+  0xFFFFFFFFUL, 0xFFFFFFFFUL, 0xFFFFFFFFUL, 0x00000000UL
+};
+static const CRYPTO_DData_TypeDef cryptoModP192 = {
+  0xFFFFFFFFUL, 0xFFFFFFFFUL, 0xFFFFFFFEUL, 0xFFFFFFFFUL,
+  0xFFFFFFFFUL, 0xFFFFFFFFUL, 0x00000000UL, 0x00000000UL
+};
+static const CRYPTO_DData_TypeDef cryptoModP192Order = {
+  0xB4D22831UL, 0x146BC9B1UL, 0x99DEF836UL, 0xFFFFFFFFUL,
+  0xFFFFFFFFUL, 0xFFFFFFFFUL, 0x00000000UL, 0x00000000UL
+};
+static const CRYPTO_DData_TypeDef cryptoModOne = {
+  1UL, 0UL, 0UL, 0UL, 0UL, 0UL, 0UL, 0UL
+};
+
+/***************************************************************************//**
+ * @brief
+ *   Get the value of a prime modulus.
+ ******************************************************************************/
+static const uint32_t * cryptoModulusValue(CRYPTO_ModulusId_TypeDef modulusId)
+{
+  switch (modulusId) {
+    case cryptoModulusEccP256:
+      return cryptoModP256;
+    case cryptoModulusEccP224:
+      return cryptoModP224;
+    case cryptoModulusEccP192:
+      return cryptoModP192;
+#ifdef _CRYPTO_WAC_MODULUS_ECCPRIME256P
+    case cryptoModulusEccP256Order:
+      return cryptoModP256Order;
+    case cryptoModulusEccP224Order:
+      return cryptoModP224Order;
+    case cryptoModulusEccP192Order:
+      return cryptoModP192Order;
+#endif
+    default:
+      /* Not a prime modulus. */
+      EFM_ASSERT(false);
+      return NULL;
+  }
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Check whether a 256 bit value is zero.
+ ******************************************************************************/
+static bool cryptoDDataIsZero(const uint32_t * val)
+{
+  unsigned i;
+  uint32_t acc = 0;
+
+  for (i = 0; i < CRYPTO_DDATA_SIZE_IN_32BIT_WORDS; i++) {
+    acc |= val[i];
+  }
+  return acc == 0UL;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Execute one modular instruction with DDATA1 and DDATA2 as operands.
+ *
+ * @details
+ *   When @p A is NULL, the result of the previous operation, which is still
+ *   in DDATA0, is used as the first operand instead of loading it from memory.
+ *   When @p R is NULL, the result is left in DDATA0 for the next operation.
+ ******************************************************************************/
+static void cryptoModOp(CRYPTO_TypeDef * crypto,
+                        uint32_t         instr,
+                        const uint32_t * A,
+                        const uint32_t * B,
+                        uint32_t *       R)
+{
+  CRYPTO_DDataWrite(&crypto->DDATA2, B);
+  if (A != NULL) {
+    CRYPTO_DDataWrite(&crypto->DDATA1, A);
+    CRYPTO_EXECUTE_2(crypto,
+                     CRYPTO_CMD_INSTR_SELDDATA1DDATA2,
+                     instr);
+  } else {
+    CRYPTO_EXECUTE_3(crypto,
+                     CRYPTO_CMD_INSTR_DDATA0TODDATA1,
+                     CRYPTO_CMD_INSTR_SELDDATA1DDATA2,
+                     instr);
+  }
+  CRYPTO_InstructionSequenceWait(crypto);
+
+  if (R != NULL) {
+    CRYPTO_DDataRead(&crypto->DDATA0, R);
+  }
+}
+
+/** @endcond */
+
+/***************************************************************************//**
+ * @brief
+ *   Prepare the CRYPTO module for modular arithmetic.
+ *
+ * @details
+ *   Select the modulus used by the MADD, MSUB and MMUL instructions and set
+ *   the multiplication operand width to the modulus width with a 256 bit
+ *   result. Must be called before @ref CRYPTO_ModAdd, @ref CRYPTO_ModSub,
+ *   @ref CRYPTO_ModMul, @ref CRYPTO_ModExp and @ref CRYPTO_ModInv.
+ *
+ * @param[in]  crypto     CRYPTO module
+ * @param[in]  modulusId  The modulus to use.
+ ******************************************************************************/
+void CRYPTO_ModInit(CRYPTO_TypeDef *          crypto,
+                    CRYPTO_ModulusId_TypeDef  modulusId)
+{
+  crypto->CTRL     = 0;
+  crypto->SEQCTRL  = 0;
+  crypto->SEQCTRLB = 0;
+  crypto->WAC      = CRYPTO_WAC_MULWIDTH_MULMOD | CRYPTO_WAC_RESULTWIDTH_256BIT;
+  CRYPTO_ModulusSet(crypto, modulusId);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Modular addition, R = (A + B) mod N.
+ *
+ * @param[in]  crypto   CRYPTO module
+ * @param[in]  A        An operand A, smaller than N
+ * @param[in]  B        An operand B, smaller than N
+ * @param[out] R        The result. May be the same buffer as A or B.
+ ******************************************************************************/
+void CRYPTO_ModAdd(CRYPTO_TypeDef *           crypto,
+                   const CRYPTO_DData_TypeDef A,
+                   const CRYPTO_DData_TypeDef B,
+                   CRYPTO_DData_TypeDef       R)
+{
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MADD, A, B, R);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Modular subtraction, R = (A - B) mod N.
+ *
+ * @param[in]  crypto   CRYPTO module
+ * @param[in]  A        An operand A, smaller than N
+ * @param[in]  B        An operand B, smaller than N
+ * @param[out] R        The result. May be the same buffer as A or B.
+ ******************************************************************************/
+void CRYPTO_ModSub(CRYPTO_TypeDef *           crypto,
+                   const CRYPTO_DData_TypeDef A,
+                   const CRYPTO_DData_TypeDef B,
+                   CRYPTO_DData_TypeDef       R)
+{
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MSUB, A, B, R);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Modular multiplication, R = (A * B) mod N.
+ *
+ * @details
+ *   The reduction is done by the MMUL instruction, so no Montgomery
+ *   representation of the operands is needed.
+ *
+ * @param[in]  crypto   CRYPTO module
+ * @param[in]  A        An operand A, smaller than N
+ * @param[in]  B        An operand B, smaller than N
+ * @param[out] R        The result. May be the same buffer as A or B.
+ ******************************************************************************/
+void CRYPTO_ModMul(CRYPTO_TypeDef *           crypto,
+                   const CRYPTO_DData_TypeDef A,
+                   const CRYPTO_DData_TypeDef B,
+                   CRYPTO_DData_TypeDef       R)
+{
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MMUL, A, B, R);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Modular exponentiation, R = (A ^ E) mod N.
+ *
+ * @details
+ *   Left-to-right square and multiply. The base is kept in DDATA3 and the
+ *   accumulator in DDATA4 for the whole operation, so each exponent bit costs
+ *   one short instruction sequence and no data transfers.
+ *
+ * @note
+ *   The execution time depends on the exponent. Do not use this function
+ *   with secret exponents.
+ *
+ * @param[in]  crypto   CRYPTO module
+ * @param[in]  A        The base, smaller than N
+ * @param[in]  E        The exponent
+ * @param[out] R        The result. May be the same buffer as A or E.
+ ******************************************************************************/
+void CRYPTO_ModExp(CRYPTO_TypeDef *           crypto,
+                   const CRYPTO_DData_TypeDef A,
+                   const CRYPTO_DData_TypeDef E,
+                   CRYPTO_DData_TypeDef       R)
+{
+  int i = (int)(CRYPTO_DDATA_SIZE_IN_32BIT_WORDS * 32U) - 1;
+
+  /* Skip leading zero bits of the exponent. */
+  while ((i >= 0) && (((E[i / 32] >> (i % 32)) & 1UL) == 0UL)) {
+    i--;
+  }
+
+  CRYPTO_DDataWrite(&crypto->DDATA3, A);
+  CRYPTO_DDataWrite(&crypto->DDATA4, cryptoModOne);
+
+  for (; i >= 0; i--) {
+    if (((E[i / 32] >> (i % 32)) & 1UL) != 0UL) {
+      CRYPTO_EXECUTE_6(crypto,
+                       CRYPTO_CMD_INSTR_SELDDATA4DDATA4,
+                       CRYPTO_CMD_INSTR_MMUL,
+                       CRYPTO_CMD_INSTR_DDATA0TODDATA4,
+                       CRYPTO_CMD_INSTR_SELDDATA4DDATA3,
+                       CRYPTO_CMD_INSTR_MMUL,
+                       CRYPTO_CMD_INSTR_DDATA0TODDATA4);
+    } else {
+      CRYPTO_EXECUTE_3(crypto,
+                       CRYPTO_CMD_INSTR_SELDDATA4DDATA4,
+                       CRYPTO_CMD_INSTR_MMUL,
+                       CRYPTO_CMD_INSTR_DDATA0TODDATA4);
+    }
+    CRYPTO_InstructionSequenceWait(crypto);
+  }
+
+  CRYPTO_DDataRead(&crypto->DDATA4, R);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Modular inversion, R = (A ^ -1) mod N, for a prime modulus N.
+ *
+ * @details
+ *   Computed as A ^ (N - 2) mod N. The CRYPTO module must be prepared with
+ *   @ref CRYPTO_ModInit using the same modulus.
+ *
+ * @param[in]  crypto     CRYPTO module
+ * @param[in]  modulusId  One of the ECC prime or order moduli.
+ * @param[in]  A          An operand A, non-zero and smaller than N
+ * @param[out] R          The result. May be the same buffer as A.
+ ******************************************************************************/
+void CRYPTO_ModInv(CRYPTO_TypeDef *           crypto,
+                   CRYPTO_ModulusId_TypeDef   modulusId,
+                   const CRYPTO_DData_TypeDef A,
+                   CRYPTO_DData_TypeDef       R)
+{
+  const uint32_t *N = cryptoModulusValue(modulusId);
+  CRYPTO_DData_TypeDef E;
+  uint32_t borrow = 2UL;
+  unsigned i;
+
+  EFM_ASSERT((crypto->WAC & _CRYPTO_WAC_MODULUS_MASK) == (uint32_t)modulusId);
+  if (N == NULL) {
+    return;
+  }
+
+  for (i = 0; i < CRYPTO_DDATA_SIZE_IN_32BIT_WORDS; i++) {
+    E[i]   = N[i] - borrow;
+    borrow = (N[i] < borrow) ? 1UL : 0UL;
+  }
+
+  CRYPTO_ModExp(crypto, A, E, R);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Double an elliptic curve point in Jacobian coordinates, R = 2P.
+ *
+ * @details
+ *   Uses the dbl-2001-b formulas for curves with a = -3.
+ *   The CRYPTO module is prepared for arithmetic modulo the curve prime.
+ *
+ * @param[in]  crypto   CRYPTO module
+ * @param[in]  curve    cryptoModulusEccP256, cryptoModulusEccP224 or
+ *                      cryptoModulusEccP192
+ * @param[in]  P        The point to double
+ * @param[out] R        The result. May be the same as P.
+ ******************************************************************************/
+void CRYPTO_EccPointDouble(CRYPTO_TypeDef *                crypto,
+                           CRYPTO_ModulusId_TypeDef        curve,
+                           const CRYPTO_EccPoint_TypeDef * P,
+                           CRYPTO_EccPoint_TypeDef *       R)
+{
+  CRYPTO_DData_TypeDef delta, gamma, beta, alpha, t1, t2;
+  CRYPTO_EccPoint_TypeDef res;
+
+  EFM_ASSERT((curve == cryptoModulusEccP256)
+             || (curve == cryptoModulusEccP224)
+             || (curve == cryptoModulusEccP192));
+
+  CRYPTO_ModInit(crypto, curve);
+
+  /* delta = Z^2, gamma = Y^2, beta = X * gamma */
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MMUL, P->Z, P->Z, delta);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MMUL, P->Y, P->Y, gamma);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MMUL, P->X, gamma, beta);
+
+  /* alpha = 3 * (X - delta) * (X + delta) */
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MSUB, P->X, delta, t1);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MADD, P->X, delta, t2);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MMUL, t1, t2, t1);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MADD, t1, t1, NULL);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MADD, NULL, t1, alpha);
+
+  /* Z3 = (Y + Z)^2 - gamma - delta */
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MADD, P->Y, P->Z, t1);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MMUL, t1, t1, NULL);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MSUB, NULL, gamma, NULL);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MSUB, NULL, delta, res.Z);
+
+  /* X3 = alpha^2 - 8 * beta, beta = 4 * beta */
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MADD, beta, beta, beta);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MADD, beta, beta, beta);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MADD, beta, beta, t2);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MMUL, alpha, alpha, NULL);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MSUB, NULL, t2, res.X);
+
+  /* Y3 = alpha * (4 * beta - X3) - 8 * gamma^2 */
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MSUB, beta, res.X, NULL);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MMUL, NULL, alpha, t1);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MMUL, gamma, gamma, t2);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MADD, t2, t2, t2);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MADD, t2, t2, t2);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MADD, t2, t2, t2);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MSUB, t1, t2, res.Y);
+
+  memcpy(R, &res, sizeof(res));
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Add two elliptic curve points in Jacobian coordinates, R = P + Q.
+ *
+ * @details
+ *   Uses the add-2007-bl formulas. The point at infinity and P equal to Q
+ *   are handled. The CRYPTO module is prepared for arithmetic modulo the
+ *   curve prime.
+ *
+ * @param[in]  crypto   CRYPTO module
+ * @param[in]  curve    cryptoModulusEccP256, cryptoModulusEccP224 or
+ *                      cryptoModulusEccP192
+ * @param[in]  P        The first point
+ * @param[in]  Q        The second point
+ * @param[out] R        The result. May be the same as P or Q.
+ ******************************************************************************/
+void CRYPTO_EccPointAdd(CRYPTO_TypeDef *                crypto,
+                        CRYPTO_ModulusId_TypeDef        curve,
+                        const CRYPTO_EccPoint_TypeDef * P,
+                        const CRYPTO_EccPoint_TypeDef * Q,
+                        CRYPTO_EccPoint_TypeDef *       R)
+{
+  CRYPTO_DData_TypeDef z1z1, z2z2, u1, u2, s1, s2, h, r;
+  CRYPTO_EccPoint_TypeDef res;
+
+  EFM_ASSERT((curve == cryptoModulusEccP256)
+             || (curve == cryptoModulusEccP224)
+             || (curve == cryptoModulusEccP192));
+
+  if (cryptoDDataIsZero(P->Z)) {
+    memmove(R, Q, sizeof(*R));
+    return;
+  }
+  if (cryptoDDataIsZero(Q->Z)) {
+    memmove(R, P, sizeof(*R));
+    return;
+  }
+
+  CRYPTO_ModInit(crypto, curve);
+
+  /* U1 = X1 * Z2^2, U2 = X2 * Z1^2 */
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MMUL, P->Z, P->Z, z1z1);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MMUL, Q->Z, Q->Z, z2z2);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MMUL, P->X, z2z2, u1);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MMUL, Q->X, z1z1, u2);
+
+  /* S1 = Y1 * Z2^3, S2 = Y2 * Z1^3 */
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MMUL, P->Y, Q->Z, NULL);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MMUL, NULL, z2z2, s1);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MMUL, Q->Y, P->Z, NULL);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MMUL, NULL, z1z1, s2);
+
+  /* H = U2 - U1, r = 2 * (S2 - S1) */
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MSUB, u2, u1, h);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MSUB, s2, s1, r);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MADD, r, r, r);
+
+  if (cryptoDDataIsZero(h)) {
+    if (cryptoDDataIsZero(r)) {
+      /* P == Q */
+      CRYPTO_EccPointDouble(crypto, curve, P, R);
+    } else {
+      /* P == -Q */
+      memset(R, 0, sizeof(*R));
+    }
+    return;
+  }
+
+  /* Z3 = ((Z1 + Z2)^2 - Z1Z1 - Z2Z2) * H */
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MADD, P->Z, Q->Z, s2);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MMUL, s2, s2, NULL);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MSUB, NULL, z1z1, NULL);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MSUB, NULL, z2z2, NULL);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MMUL, NULL, h, res.Z);
+
+  /* I = (2 * H)^2, J = H * I, V = U1 * I, reusing u2, z1z1 and z2z2. */
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MADD, h, h, u2);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MMUL, u2, u2, u2);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MMUL, h, u2, z1z1);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MMUL, u1, u2, z2z2);
+
+  /* X3 = r^2 - J - 2 * V */
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MMUL, r, r, NULL);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MSUB, NULL, z1z1, NULL);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MSUB, NULL, z2z2, NULL);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MSUB, NULL, z2z2, res.X);
+
+  /* Y3 = r * (V - X3) - 2 * S1 * J */
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MSUB, z2z2, res.X, NULL);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MMUL, NULL, r, res.Y);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MMUL, s1, z1z1, s2);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MADD, s2, s2, s2);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MSUB, res.Y, s2, res.Y);
+
+  memcpy(R, &res, sizeof(res));
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Convert an elliptic curve point from Jacobian to affine coordinates.
+ *
+ * @details
+ *   R = (X / Z^2, Y / Z^3, 1). The point at infinity is returned as all zero.
+ *   The CRYPTO module is prepared for arithmetic modulo the curve prime.
+ *
+ * @param[in]  crypto   CRYPTO module
+ * @param[in]  curve    cryptoModulusEccP256, cryptoModulusEccP224 or
+ *                      cryptoModulusEccP192
+ * @param[in]  P        The point to convert
+ * @param[out] R        The result. May be the same as P.
+ ******************************************************************************/
+void CRYPTO_EccPointToAffine(CRYPTO_TypeDef *                crypto,
+                             CRYPTO_ModulusId_TypeDef        curve,
+                             const CRYPTO_EccPoint_TypeDef * P,
+                             CRYPTO_EccPoint_TypeDef *       R)
+{
+  CRYPTO_DData_TypeDef zInv, zInv2;
+
+  EFM_ASSERT((curve == cryptoModulusEccP256)
+             || (curve == cryptoModulusEccP224)
+             || (curve == cryptoModulusEccP192));
+
+  if (cryptoDDataIsZero(P->Z)) {
+    memset(R, 0, sizeof(*R));
+    return;
+  }
+
+  CRYPTO_ModInit(crypto, curve);
+  CRYPTO_ModInv(crypto, curve, P->Z, zInv);
+
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MMUL, zInv, zInv, zInv2);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MMUL, P->X, zInv2, R->X);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MMUL, P->Y, zInv2, NULL);
+  cryptoModOp(crypto, CRYPTO_CMD_INSTR_MMUL, NULL, zInv, R->Y);
+  memcpy(R->Z, cryptoModOne, sizeof(R->Z));
+}
+
 /***************************************************************************//**
  * @brief
  *   AES Cipher-block chaining (CBC) cipher mode encryption/decryption, 128 bit key.
@@ -2367,6 +2850,390 @@ __STATIC_INLINE void CRYPTO_AES_ProcessLoop(CRYPTO_TypeDef *        crypto,
   }
 }
 
+#if defined(LDMA_PRESENT) && (LDMA_COUNT == 1)
+
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+
+/* Largest number of bytes processed by a single sequence run. This is bounded
+   by the LDMA transfer count and the SEQCTRL LENGTHA field. */
+#define CRYPTO_AES_DMA_CHUNK_MAX                                              \
+  SL_MIN(((_LDMA_CH_CTRL_XFERCNT_MASK >> _LDMA_CH_CTRL_XFERCNT_SHIFT) + 1UL) \
+         * sizeof(uint32_t),                                                  \
+         _CRYPTO_SEQCTRL_LENGTHA_MASK & ~(CRYPTO_AES_BLOCKSIZE - 1UL))
+
+/* LDMA request signals of one CRYPTO instance. */
+typedef struct {
+  LDMA_PeripheralSignal_t data0Wr;
+  LDMA_PeripheralSignal_t data0XWr;
+  LDMA_PeripheralSignal_t data0Rd;
+  LDMA_PeripheralSignal_t data1Wr;
+} CRYPTO_DmaSignals_TypeDef;
+
+static const CRYPTO_DmaSignals_TypeDef cryptoDmaSignals[CRYPTO_COUNT] = {
+#if defined(LDMA_CH_REQSEL_SIGSEL_CRYPTO0DATA0WR)
+  {
+    ldmaPeripheralSignal_CRYPTO0_DATA0WR, ldmaPeripheralSignal_CRYPTO0_DATA0XWR,
+    ldmaPeripheralSignal_CRYPTO0_DATA0RD, ldmaPeripheralSignal_CRYPTO0_DATA1WR
+  },
+#else
+  {
+    ldmaPeripheralSignal_CRYPTO_DATA0WR, ldmaPeripheralSignal_CRYPTO_DATA0XWR,
+    ldmaPeripheralSignal_CRYPTO_DATA0RD, ldmaPeripheralSignal_CRYPTO_DATA1WR
+  },
+#endif
+#if defined(CRYPTO1)
+  {
+    ldmaPeripheralSignal_CRYPTO1_DATA0WR, ldmaPeripheralSignal_CRYPTO1_DATA0XWR,
+    ldmaPeripheralSignal_CRYPTO1_DATA0RD, ldmaPeripheralSignal_CRYPTO1_DATA1WR
+  },
+#endif
+};
+
+/* Active transfer and LDMA descriptors of each CRYPTO instance. */
+static CRYPTO_AES_DmaTransfer_TypeDef * volatile cryptoDmaTransfer[CRYPTO_COUNT];
+static LDMA_Descriptor_t cryptoDmaDesc[CRYPTO_COUNT][2];
+
+/***************************************************************************//**
+ * @brief
+ *   Get the index of a CRYPTO instance.
+ ******************************************************************************/
+static unsigned int cryptoDmaIndex(CRYPTO_TypeDef *crypto)
+{
+#if defined(CRYPTO1)
+  if (crypto == CRYPTO1) {
+    return 1U;
+  }
+#endif
+  (void) crypto;
+  return 0U;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Get the interrupt number of a CRYPTO instance.
+ ******************************************************************************/
+static IRQn_Type cryptoDmaIrq(unsigned int index)
+{
+#if defined(CRYPTO1)
+  if (index == 1U) {
+    return CRYPTO1_IRQn;
+  }
+#endif
+  (void) index;
+#if defined(CRYPTO0)
+  return CRYPTO0_IRQn;
+#else
+  return CRYPTO_IRQn;
+#endif
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Program both LDMA channels and start the instruction sequence for the
+ *   next chunk of a DMA driven AES transfer.
+ *
+ * @details
+ *   DATA0 is selected as the DMA0 register and DATA1 as the DMA1 register.
+ *   Output blocks are always read from DATA0 by the DATATODMA0 instruction,
+ *   input blocks are written to DATA0 or DATA1 depending on the mode.
+ ******************************************************************************/
+static void cryptoAesDmaChunkStart(CRYPTO_TypeDef *crypto,
+                                   unsigned int index,
+                                   CRYPTO_AES_DmaTransfer_TypeDef *transfer)
+{
+  const CRYPTO_DmaSignals_TypeDef *signals = &cryptoDmaSignals[index];
+  LDMA_Descriptor_t *descIn  = &cryptoDmaDesc[index][0];
+  LDMA_Descriptor_t *descOut = &cryptoDmaDesc[index][1];
+  unsigned int chunk = SL_MIN(transfer->len - transfer->offset,
+                              (unsigned int)CRYPTO_AES_DMA_CHUNK_MAX);
+  LDMA_TransferCfg_t cfgIn;
+  LDMA_TransferCfg_t cfgOut = LDMA_TRANSFER_CFG_PERIPHERAL(signals->data0Rd);
+  volatile uint32_t *inReg;
+
+  switch (transfer->mode) {
+    case cryptoAesModeCbc:
+    case cryptoAesModePcbc:
+    case cryptoAesModeCfb:
+      inReg = &crypto->DATA1;
+      cfgIn = (LDMA_TransferCfg_t)LDMA_TRANSFER_CFG_PERIPHERAL(signals->data1Wr);
+      break;
+
+    case cryptoAesModeOfb:
+    case cryptoAesModeCtr:
+      inReg = &crypto->DATA0XOR;
+      cfgIn = (LDMA_TransferCfg_t)LDMA_TRANSFER_CFG_PERIPHERAL(signals->data0XWr);
+      break;
+
+    default:
+      inReg = &crypto->DATA0;
+      cfgIn = (LDMA_TransferCfg_t)LDMA_TRANSFER_CFG_PERIPHERAL(signals->data0Wr);
+      break;
+  }
+
+  *descIn = (LDMA_Descriptor_t)LDMA_DESCRIPTOR_SINGLE_M2P_BYTE(
+    transfer->in + transfer->offset, inReg, chunk / sizeof(uint32_t));
+  descIn->xfer.size      = ldmaCtrlSizeWord;
+  descIn->xfer.blockSize = ldmaCtrlBlockSizeUnit4;
+  descIn->xfer.doneIfs   = 0;
+
+  *descOut = (LDMA_Descriptor_t)LDMA_DESCRIPTOR_SINGLE_P2M_BYTE(
+    &crypto->DATA0, transfer->out + transfer->offset, chunk / sizeof(uint32_t));
+  descOut->xfer.size      = ldmaCtrlSizeWord;
+  descOut->xfer.blockSize = ldmaCtrlBlockSizeUnit4;
+  descOut->xfer.doneIfs   = 0;
+
+  LDMA_StartTransfer((int)transfer->dmaChOut, &cfgOut, descOut);
+  LDMA_StartTransfer((int)transfer->dmaChIn, &cfgIn, descIn);
+
+  /* The sequence is repeated once per block until LENGTHA bytes are done. */
+  crypto->SEQCTRL = CRYPTO_SEQCTRL_BLOCKSIZE_16BYTES | chunk;
+  transfer->offset += chunk;
+  CRYPTO_InstructionSequenceExecute(crypto);
+}
+
+/** @endcond */
+
+/***************************************************************************//**
+ * @brief
+ *   Start a DMA driven AES encryption or decryption of a whole buffer.
+ *
+ * @details
+ *   The key and IV are loaded and the instruction sequence of the selected
+ *   mode is set up once. The sequence is then repeated by CRYPTO for every
+ *   block, with one LDMA channel feeding input blocks on the CRYPTO DATA
+ *   write DMA request and another draining output blocks on the DATA0 read
+ *   DMA request. The CPU is free while the transfer runs; it is only
+ *   interrupted once every CRYPTO_AES_DMA_CHUNK_MAX bytes to restart the
+ *   sequence, and once at the end to call the completion callback.
+ *
+ *   See the blocking function of the same mode, e.g. CRYPTO_AES_CBC128(), for
+ *   a description of the mode and the key and IV parameters.
+ *
+ * @note
+ *   The LDMA must be initialized with LDMA_Init() before calling this
+ *   function, and the application must call @ref CRYPTO_AES_DmaIRQHandler()
+ *   from the CRYPTO interrupt handler. The CRYPTO interrupt is enabled by
+ *   this function. The CRYPTO instance must not be used for other operations
+ *   until the transfer is complete.
+ *
+ * @param[in] crypto
+ *   A pointer to the CRYPTO peripheral register block.
+ *
+ * @param[in] transfer
+ *   Transfer configuration. Must remain valid until the callback is called.
+ *
+ * @param[out] out
+ *   A buffer to place encrypted/decrypted data. Must be at least @p len long
+ *   and word aligned. It may be set equal to @p in.
+ *
+ * @param[in] in
+ *   A buffer holding data to encrypt/decrypt. Must be at least @p len long
+ *   and word aligned.
+ *
+ * @param[in] len
+ *   A number of bytes to encrypt/decrypt. Must be a multiple of 16.
+ ******************************************************************************/
+void CRYPTO_AES_DmaStart(CRYPTO_TypeDef *crypto,
+                         CRYPTO_AES_DmaTransfer_TypeDef *transfer,
+                         uint8_t * out,
+                         const uint8_t * in,
+                         unsigned int len)
+{
+  unsigned int index = cryptoDmaIndex(crypto);
+  bool encrypt = transfer->encrypt;
+
+  EFM_ASSERT((len % CRYPTO_AES_BLOCKSIZE) == 0U);
+  EFM_ASSERT((((uintptr_t)in | (uintptr_t)out) & 0x3U) == 0U);
+  EFM_ASSERT(transfer->dmaChIn != transfer->dmaChOut);
+  EFM_ASSERT(cryptoDmaTransfer[index] == NULL);
+
+  transfer->out    = out;
+  transfer->in     = in;
+  transfer->len    = len;
+  transfer->offset = 0;
+
+  if (len == 0U) {
+    if (transfer->callback != NULL) {
+      transfer->callback(transfer);
+    }
+    return;
+  }
+
+  /* Initialize control registers. DATA0 and DATA1 are the DMA registers. */
+  crypto->CTRL = CRYPTO_CTRL_DMA0RSEL_DATA0 | CRYPTO_CTRL_DMA0MODE_FULL
+                 | CRYPTO_CTRL_DMA1RSEL_DATA1 | CRYPTO_CTRL_DMA1MODE_FULL;
+  crypto->WAC  = 0;
+  crypto->SEQCTRLB = 0;
+
+  CRYPTO_KeyBufWriteUnaligned(crypto, transfer->key, transfer->keyWidth);
+
+  /* These are the instruction sequences of the blocking functions, with
+     the CPU writes of the input register and reads of the output register
+     replaced by DMA0TODATA/DMA1TODATA and DATATODMA0 instructions. */
+  switch (transfer->mode) {
+    case cryptoAesModeEcb:
+      CRYPTO_SEQ_LOAD_3(crypto,
+                        CRYPTO_CMD_INSTR_DMA0TODATA,
+                        encrypt ? CRYPTO_CMD_INSTR_AESENC : CRYPTO_CMD_INSTR_AESDEC,
+                        CRYPTO_CMD_INSTR_DATATODMA0);
+      break;
+
+    case cryptoAesModeCbc:
+      if (encrypt) {
+        CRYPTO_DataWriteUnaligned(&crypto->DATA0, transfer->iv);
+        CRYPTO_SEQ_LOAD_4(crypto,
+                          CRYPTO_CMD_INSTR_DMA1TODATA,
+                          CRYPTO_CMD_INSTR_DATA1TODATA0XOR,
+                          CRYPTO_CMD_INSTR_AESENC,
+                          CRYPTO_CMD_INSTR_DATATODMA0);
+      } else {
+        CRYPTO_DataWriteUnaligned(&crypto->DATA2, transfer->iv);
+        CRYPTO_SEQ_LOAD_6(crypto,
+                          CRYPTO_CMD_INSTR_DMA1TODATA,
+                          CRYPTO_CMD_INSTR_DATA1TODATA0,
+                          CRYPTO_CMD_INSTR_AESDEC,
+                          CRYPTO_CMD_INSTR_DATA2TODATA0XOR,
+                          CRYPTO_CMD_INSTR_DATATODMA0,
+                          CRYPTO_CMD_INSTR_DATA1TODATA2);
+      }
+      break;
+
+    case cryptoAesModePcbc:
+      CRYPTO_DataWriteUnaligned(&crypto->DATA0, transfer->iv);
+      if (encrypt) {
+        CRYPTO_SEQ_LOAD_5(crypto,
+                          CRYPTO_CMD_INSTR_DMA1TODATA,
+                          CRYPTO_CMD_INSTR_DATA1TODATA0XOR,
+                          CRYPTO_CMD_INSTR_AESENC,
+                          CRYPTO_CMD_INSTR_DATATODMA0,
+                          CRYPTO_CMD_INSTR_DATA1TODATA0XOR);
+      } else {
+        CRYPTO_SEQ_LOAD_7(crypto,
+                          CRYPTO_CMD_INSTR_DMA1TODATA,
+                          CRYPTO_CMD_INSTR_DATA0TODATA3,
+                          CRYPTO_CMD_INSTR_DATA1TODATA0,
+                          CRYPTO_CMD_INSTR_AESDEC,
+                          CRYPTO_CMD_INSTR_DATA3TODATA0XOR,
+                          CRYPTO_CMD_INSTR_DATATODMA0,
+                          CRYPTO_CMD_INSTR_DATA1TODATA0XOR);
+      }
+      break;
+
+    case cryptoAesModeCfb:
+      if (encrypt) {
+        CRYPTO_DataWriteUnaligned(&crypto->DATA0, transfer->iv);
+        CRYPTO_SEQ_LOAD_4(crypto,
+                          CRYPTO_CMD_INSTR_DMA1TODATA,
+                          CRYPTO_CMD_INSTR_AESENC,
+                          CRYPTO_CMD_INSTR_DATA1TODATA0XOR,
+                          CRYPTO_CMD_INSTR_DATATODMA0);
+      } else {
+        CRYPTO_DataWriteUnaligned(&crypto->DATA2, transfer->iv);
+        CRYPTO_SEQ_LOAD_6(crypto,
+                          CRYPTO_CMD_INSTR_DMA1TODATA,
+                          CRYPTO_CMD_INSTR_DATA2TODATA0,
+                          CRYPTO_CMD_INSTR_AESENC,
+                          CRYPTO_CMD_INSTR_DATA1TODATA0XOR,
+                          CRYPTO_CMD_INSTR_DATATODMA0,
+                          CRYPTO_CMD_INSTR_DATA1TODATA2);
+      }
+      break;
+
+    case cryptoAesModeOfb:
+      CRYPTO_DataWriteUnaligned(&crypto->DATA2, transfer->iv);
+      CRYPTO_SEQ_LOAD_5(crypto,
+                        CRYPTO_CMD_INSTR_DATA2TODATA0,
+                        CRYPTO_CMD_INSTR_AESENC,
+                        CRYPTO_CMD_INSTR_DATA0TODATA2,
+                        CRYPTO_CMD_INSTR_DMA0TODATAXOR,
+                        CRYPTO_CMD_INSTR_DATATODMA0);
+      break;
+
+    case cryptoAesModeCtr:
+      crypto->CTRL |= CRYPTO_CTRL_INCWIDTH_INCWIDTH4;
+      CRYPTO_DataWriteUnaligned(&crypto->DATA1, transfer->iv);
+      CRYPTO_SEQ_LOAD_5(crypto,
+                        CRYPTO_CMD_INSTR_DATA1TODATA0,
+                        CRYPTO_CMD_INSTR_AESENC,
+                        CRYPTO_CMD_INSTR_DMA0TODATAXOR,
+                        CRYPTO_CMD_INSTR_DATATODMA0,
+                        CRYPTO_CMD_INSTR_DATA1INC);
+      break;
+
+    default:
+      EFM_ASSERT(false);
+      return;
+  }
+
+  cryptoDmaTransfer[index] = transfer;
+
+  CRYPTO_IntClear(crypto, CRYPTO_IF_SEQDONE);
+  CRYPTO_IntEnable(crypto, CRYPTO_IF_SEQDONE);
+  NVIC_ClearPendingIRQ(cryptoDmaIrq(index));
+  NVIC_EnableIRQ(cryptoDmaIrq(index));
+
+  cryptoAesDmaChunkStart(crypto, index, transfer);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Check whether a DMA driven AES transfer is in progress.
+ *
+ * @param[in] crypto
+ *   A pointer to the CRYPTO peripheral register block.
+ *
+ * @return
+ *   True if a transfer started by @ref CRYPTO_AES_DmaStart() has not
+ *   completed yet.
+ ******************************************************************************/
+bool CRYPTO_AES_DmaBusy(CRYPTO_TypeDef *crypto)
+{
+  return cryptoDmaTransfer[cryptoDmaIndex(crypto)] != NULL;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   CRYPTO interrupt handler for DMA driven AES transfers.
+ *
+ * @details
+ *   Must be called from the CRYPTO interrupt handler. When the instruction
+ *   sequence for a chunk is done, either the next chunk is started or, at
+ *   the end of the buffer, the CTR counter is read back, the CRYPTO
+ *   interrupt is disabled and the completion callback is called.
+ *
+ * @param[in] crypto
+ *   A pointer to the CRYPTO peripheral register block.
+ ******************************************************************************/
+void CRYPTO_AES_DmaIRQHandler(CRYPTO_TypeDef *crypto)
+{
+  unsigned int index = cryptoDmaIndex(crypto);
+  CRYPTO_AES_DmaTransfer_TypeDef *transfer = cryptoDmaTransfer[index];
+
+  if (((CRYPTO_IntGetEnabled(crypto) & CRYPTO_IF_SEQDONE) == 0U)
+      || (transfer == NULL)) {
+    return;
+  }
+  CRYPTO_IntClear(crypto, CRYPTO_IF_SEQDONE);
+
+  if (transfer->offset < transfer->len) {
+    cryptoAesDmaChunkStart(crypto, index, transfer);
+    return;
+  }
+
+  if (transfer->mode == cryptoAesModeCtr) {
+    CRYPTO_DataReadUnaligned(&crypto->DATA1, transfer->iv);
+  }
+
+  CRYPTO_IntDisable(crypto, CRYPTO_IF_SEQDONE);
+  cryptoDmaTransfer[index] = NULL;
+
+  if (transfer->callback != NULL) {
+    transfer->callback(transfer);
+  }
+}
+
+#endif /* defined(LDMA_PRESENT) && (LDMA_COUNT == 1) */
+
 /** @} (end addtogroup crypto) */
 
 #endif /* defined(CRYPTO_COUNT) && (CRYPTO_COUNT > 0) */
@@ -380,6 +380,24 @@ SL_RAMFUNC_DEFINITION_END
 #endif
 
 #if (_SILICON_LABS_32B_SERIES < 2)
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+/* Precomputed EM2/EM3 restore image, replayed on wakeup. The image stays valid
+ * until the clock configuration is changed through the CMU or EMU APIs, which
+ * call sli_em_emu_RestoreImageInvalidate(). */
+typedef struct {
+  bool valid;
+#if defined(EMU_VSCALE_PRESENT)
+  uint32_t hfrcoCtrl;           /* CMU->HFRCOCTRL to restore. */
+  uint8_t vScaleStatus;         /* EM01 voltage scaling level to restore. */
+#endif
+  CMU_Select_TypeDef hfClock;   /* HF clock to reselect on wakeup. */
+  uint32_t oscEnCmd;            /* Oscillator enable command to replay. */
+  bool hfrcoDisable;            /* Turn HFRCO off after HF clock reselect. */
+} emRestoreImage_TypeDef;
+
+static emRestoreImage_TypeDef emRestoreImage;
+/** @endcond */
+
 /***************************************************************************//**
  * @brief
  *   Save/restore/update oscillator, core clock and voltage scaling configuration on
@@ -387,8 +405,11 @@ SL_RAMFUNC_DEFINITION_END
  *
  * @details
  *   Hardware may automatically change the oscillator and the voltage scaling configuration
- *   when going into or out of an energy mode. Static data in this function keeps track of
- *   such configuration bits and is used to restore state if needed.
+ *   when going into or out of an energy mode. On save, a restore image holding the
+ *   oscillator enable command and HF clock selection is built from the current
+ *   configuration. The image is kept until it is invalidated by a change of the
+ *   clock configuration, so a save with a valid image reads no CMU/EMU registers.
+ *   On restore, the image is replayed with no further decoding.
  *
  ******************************************************************************/
 typedef enum {
@@ -398,28 +419,60 @@ typedef enum {
 
 static void emState(emState_TypeDef action)
 {
-  uint32_t oscEnCmd;
+  uint32_t cmuStatus;
   uint32_t cmuLocked;
-  static uint32_t cmuStatus;
-  static CMU_Select_TypeDef hfClock;
-#if defined(EMU_VSCALE_PRESENT)
-  static uint8_t vScaleStatus;
-  static uint32_t hfrcoCtrl;
-#endif
+  bool imageValid;
 
   /* Save or update state. */
   if (action == emState_Save) {
-    /* Save configuration. */
+    /* Keep the current image if the clock configuration is unchanged. */
+    if (emRestoreImage.valid) {
+      return;
+    }
+
+    /* Rebuild the restore image. */
     cmuStatus = CMU->STATUS;
-    hfClock = CMU_ClockSelectGet(cmuClock_HF);
+    emRestoreImage.hfClock = CMU_ClockSelectGet(cmuClock_HF);
 #if defined(EMU_VSCALE_PRESENT)
     /* Save vscale. */
     EMU_VScaleWait();
-    vScaleStatus = (uint8_t)((EMU->STATUS & _EMU_STATUS_VSCALE_MASK)
-                             >> _EMU_STATUS_VSCALE_SHIFT);
-    hfrcoCtrl = CMU->HFRCOCTRL;
+    emRestoreImage.vScaleStatus = (uint8_t)((EMU->STATUS & _EMU_STATUS_VSCALE_MASK)
+                                            >> _EMU_STATUS_VSCALE_SHIFT);
+    emRestoreImage.hfrcoCtrl = CMU->HFRCOCTRL;
+#endif
+
+#if defined(_CMU_OSCENCMD_MASK)
+    /* AUXHFRCO are automatically disabled (except if using debugger). */
+    /* HFRCO, USHFRCO and HFXO are automatically disabled. */
+    /* LFRCO/LFXO may be disabled by SW in EM3. */
+    /* Restore according to status prior to entering energy mode. */
+    emRestoreImage.oscEnCmd = 0;
+    emRestoreImage.oscEnCmd |= (cmuStatus & CMU_STATUS_HFRCOENS) != 0U
+                               ? CMU_OSCENCMD_HFRCOEN : 0U;
+    emRestoreImage.oscEnCmd |= (cmuStatus & CMU_STATUS_AUXHFRCOENS) != 0U
+                               ? CMU_OSCENCMD_AUXHFRCOEN : 0U;
+    emRestoreImage.oscEnCmd |= (cmuStatus & CMU_STATUS_LFRCOENS) != 0U
+                               ? CMU_OSCENCMD_LFRCOEN : 0U;
+    emRestoreImage.oscEnCmd |= (cmuStatus & CMU_STATUS_HFXOENS) != 0U
+                               ? CMU_OSCENCMD_HFXOEN : 0U;
+    emRestoreImage.oscEnCmd |= (cmuStatus & CMU_STATUS_LFXOENS) != 0U
+                               ? CMU_OSCENCMD_LFXOEN : 0U;
+#if defined(_CMU_STATUS_USHFRCOENS_MASK)
+    emRestoreImage.oscEnCmd |= (cmuStatus & CMU_STATUS_USHFRCOENS) != 0U
+                               ? CMU_OSCENCMD_USHFRCOEN : 0U;
+#endif
+    /* HFRCO is automatically enabled by wake up. */
+    emRestoreImage.hfrcoDisable = (cmuStatus & CMU_STATUS_HFRCOENS) == 0U;
+#else
+    (void)cmuStatus;
 #endif
+    emRestoreImage.valid = true;
   } else { /* Restore state. */
+    /* Reselecting the HF clock below goes through the CMU APIs, which
+       invalidate the image. Once replayed, the clock configuration matches
+       the image again. */
+    imageValid = emRestoreImage.valid;
+
     /* Apply saved configuration. */
 #if defined(EMU_VSCALE_PRESENT)
 #if defined(_SILICON_LABS_32B_SERIES_1)
@@ -430,7 +483,7 @@ static void emState(emState_TypeDef action)
       /* Restore EM0 and 1 voltage scaling level.
          @ref EMU_VScaleWait() is called later,
          just before HF clock select is set. */
-      EMU->CMD = vScaleEM01Cmd((EMU_VScaleEM01_TypeDef)vScaleStatus);
+      EMU->CMD = vScaleEM01Cmd((EMU_VScaleEM01_TypeDef)emRestoreImage.vScaleStatus);
     }
 #endif
     /* CMU registers may be locked. */
@@ -438,26 +491,7 @@ static void emState(emState_TypeDef action)
     CMU_Unlock();
 
 #if defined(_CMU_OSCENCMD_MASK)
-    /* AUXHFRCO are automatically disabled (except if using debugger). */
-    /* HFRCO, USHFRCO and HFXO are automatically disabled. */
-    /* LFRCO/LFXO may be disabled by SW in EM3. */
-    /* Restore according to status prior to entering energy mode. */
-    oscEnCmd = 0;
-    oscEnCmd |= (cmuStatus & CMU_STATUS_HFRCOENS) != 0U
-                ? CMU_OSCENCMD_HFRCOEN : 0U;
-    oscEnCmd |= (cmuStatus & CMU_STATUS_AUXHFRCOENS) != 0U
-                ? CMU_OSCENCMD_AUXHFRCOEN : 0U;
-    oscEnCmd |= (cmuStatus & CMU_STATUS_LFRCOENS) != 0U
-                ? CMU_OSCENCMD_LFRCOEN : 0U;
-    oscEnCmd |= (cmuStatus & CMU_STATUS_HFXOENS) != 0U
-                ? CMU_OSCENCMD_HFXOEN : 0U;
-    oscEnCmd |= (cmuStatus & CMU_STATUS_LFXOENS) != 0U
-                ? CMU_OSCENCMD_LFXOEN : 0U;
-#if defined(_CMU_STATUS_USHFRCOENS_MASK)
-    oscEnCmd |= (cmuStatus & CMU_STATUS_USHFRCOENS) != 0U
-                ? CMU_OSCENCMD_USHFRCOEN : 0U;
-#endif
-    CMU->OSCENCMD = oscEnCmd;
+    CMU->OSCENCMD = emRestoreImage.oscEnCmd;
 #endif
 
 #if defined(_EMU_STATUS_VSCALE_MASK)
@@ -467,8 +501,8 @@ static void emState(emState_TypeDef action)
       /* Restore HFRCO frequency which was automatically adjusted by hardware. */
       while ((CMU->SYNCBUSY & CMU_SYNCBUSY_HFRCOBSY) != 0U) {
       }
-      CMU->HFRCOCTRL = hfrcoCtrl;
-      if (hfClock == cmuSelect_HFRCO) {
+      CMU->HFRCOCTRL = emRestoreImage.hfrcoCtrl;
+      if (emRestoreImage.hfClock == cmuSelect_HFRCO) {
         /* Optimize wait state after EM2/EM3 wakeup because hardware has
          * modified them. */
         CMU_UpdateWaitStates(SystemHfrcoFreq, (int)EMU_VScaleGet());
@@ -476,7 +510,7 @@ static void emState(emState_TypeDef action)
     }
 #endif
 
-    switch (hfClock) {
+    switch (emRestoreImage.hfClock) {
       case cmuSelect_LFXO:
         CMU_CLOCK_SELECT_SET(HF, LFXO);
         break;
@@ -506,22 +540,67 @@ static void emState(emState_TypeDef action)
         CMU_CLOCK_SELECT_SET(HF, USHFRCO);
         break;
 #endif
+      default:
+        /* HFRCO is selected by hardware on wakeup. */
+        break;
     }
 
 #if defined(_CMU_OSCENCMD_MASK)
     /* If HFRCO was disabled before entering Energy Mode, turn it off again */
     /* as it is automatically enabled by wake up */
-    if ((cmuStatus & CMU_STATUS_HFRCOENS) == 0U) {
+    if (emRestoreImage.hfrcoDisable) {
       CMU->OSCENCMD = CMU_OSCENCMD_HFRCODIS;
     }
 #endif
 
+    emRestoreImage.valid = imageValid;
+
     /* Restore CMU register locking */
     if (cmuLocked != 0U) {
       CMU_Lock();
     }
   }
 }
+
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+/***************************************************************************//**
+ * @brief
+ *   Invalidate the EM2/EM3 restore image.
+ *
+ * @note FOR INTERNAL USE ONLY.
+ *
+ * @note This function is called by the CMU and EMU functions which change the
+ *       oscillator enable, HF clock select, HFRCO band or voltage scaling
+ *       configuration, so that the next save rebuilds the restore image.
+ ******************************************************************************/
+void sli_em_emu_RestoreImageInvalidate(void)
+{
+  emRestoreImage.valid = false;
+}
+/** @endcond */
+#endif
+
+#if (SL_EMLIB_EMU_ENABLE_WAKEUP_TIMING == 1)
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+/* EM2/EM3 wakeup latency, in core clock cycles, measured from WFI return until
+ * EMU_EnterEM2()/EMU_EnterEM3() returns to the caller. */
+static uint32_t emWakeupStart;
+static uint32_t emWakeupCycles;
+static uint32_t emWakeupCyclesMax;
+
+__STATIC_INLINE void emWakeupTimingStart(void)
+{
+  emWakeupStart = DWT->CYCCNT;
+}
+
+__STATIC_INLINE void emWakeupTimingStop(void)
+{
+  emWakeupCycles = DWT->CYCCNT - emWakeupStart;
+  if (emWakeupCycles > emWakeupCyclesMax) {
+    emWakeupCyclesMax = emWakeupCycles;
+  }
+}
+/** @endcond */
 #endif
 
 #if defined(ERRATA_FIX_EMU_E107_ENABLE)
@@ -951,7 +1030,13 @@ SL_WEAK void EMU_EFPEM23PostsleepHook(void)
  *   details.
  * @par
  *   The @p restore option should only be used if all clock control is done
- *   via the CMU API.
+ *   via the CMU API. On Series 0 and Series 1 devices, the state to restore
+ *   is captured once and reused by later calls until a CMU or EMU API
+ *   function changes the oscillator enable, HF clock select, HFRCO band or
+ *   voltage scaling configuration. If this configuration is changed in any
+ *   other way, e.g. by writing the CMU registers directly or from a radio
+ *   stack, call @ref EMU_Save() afterwards. Otherwise, the stale state is
+ *   restored on wakeup.
  ******************************************************************************/
 void EMU_EnterEM2(bool restore)
 {
@@ -1032,6 +1117,9 @@ void EMU_EnterEM2(bool restore)
   }
 #else
   __WFI();
+#endif
+#if (SL_EMLIB_EMU_ENABLE_WAKEUP_TIMING == 1)
+  emWakeupTimingStart();
 #endif
   EMU_EFPEM23PostsleepHook();
   EMU_EM23PostsleepHook();
@@ -1078,7 +1166,14 @@ void EMU_EnterEM2(bool restore)
     /* core clock variable must be updated since HF clock has changed */
     /* to HFRCO. */
     SystemCoreClockUpdate();
+#if (_SILICON_LABS_32B_SERIES < 2)
+    /* Clocks are left as hardware set them on wakeup. */
+    sli_em_emu_RestoreImageInvalidate();
+#endif
   }
+#if (SL_EMLIB_EMU_ENABLE_WAKEUP_TIMING == 1)
+  emWakeupTimingStop();
+#endif
 }
 
 /***************************************************************************//**
@@ -1138,7 +1233,13 @@ void EMU_EnterEM2(bool restore)
  *   details.
  * @par
  *   The @p restore option should only be used if all clock control is done
- *   via the CMU API.
+ *   via the CMU API. On Series 0 and Series 1 devices, the state to restore
+ *   is captured once and reused by later calls until a CMU or EMU API
+ *   function changes the oscillator enable, HF clock select, HFRCO band or
+ *   voltage scaling configuration. If this configuration is changed in any
+ *   other way, e.g. by writing the CMU registers directly or from a radio
+ *   stack, call @ref EMU_Save() afterwards. Otherwise, the stale state is
+ *   restored on wakeup.
  ******************************************************************************/
 void EMU_EnterEM3(bool restore)
 {
@@ -1232,6 +1333,9 @@ void EMU_EnterEM3(bool restore)
   }
 #else
   __WFI();
+#endif
+#if (SL_EMLIB_EMU_ENABLE_WAKEUP_TIMING == 1)
+  emWakeupTimingStart();
 #endif
   EMU_EM23PostsleepHook();
 
@@ -1277,7 +1381,14 @@ void EMU_EnterEM3(bool restore)
     /* core clock variable must be updated since HF clock has changed */
     /* to HFRCO. */
     SystemCoreClockUpdate();
+#if (_SILICON_LABS_32B_SERIES < 2)
+    /* Clocks are left as hardware set them on wakeup. */
+    sli_em_emu_RestoreImageInvalidate();
+#endif
   }
+#if (SL_EMLIB_EMU_ENABLE_WAKEUP_TIMING == 1)
+  emWakeupTimingStop();
+#endif
 }
 
 /***************************************************************************//**
@@ -1289,10 +1400,16 @@ void EMU_EnterEM3(bool restore)
  *   restore parameter set to true, but it allows the state to be saved without
  *   going to sleep. The state can be restored manually by calling
  *   @ref EMU_Restore().
+ *
+ * @note
+ *   This function also refreshes the state reused by @ref EMU_EnterEM2() and
+ *   @ref EMU_EnterEM3(). Call it after changing the oscillator or HF clock
+ *   configuration without the CMU API.
  ******************************************************************************/
 void EMU_Save(void)
 {
 #if (_SILICON_LABS_32B_SERIES < 2)
+  sli_em_emu_RestoreImageInvalidate();
   emState(emState_Save);
 #endif
 #if defined(_SILICON_LABS_32B_SERIES_2_CONFIG_2) || defined(_SILICON_LABS_32B_SERIES_2_CONFIG_7)
@@ -1319,6 +1436,58 @@ void EMU_Restore(void)
 #endif
 }
 
+#if (SL_EMLIB_EMU_ENABLE_WAKEUP_TIMING == 1) || defined(DOXYGEN)
+/***************************************************************************//**
+ * @brief
+ *   Get the latency of the last EM2/EM3 wakeup.
+ *
+ * @details
+ *   The latency is measured from the instruction following WFI until
+ *   @ref EMU_EnterEM2() or @ref EMU_EnterEM3() returns, i.e. it covers the
+ *   post-sleep hooks, errata fixes and the oscillator/HF clock restore.
+ *
+ * @note
+ *   SL_EMLIB_EMU_ENABLE_WAKEUP_TIMING must be enabled, and the application
+ *   must enable the DWT cycle counter.
+ *
+ * @return
+ *   Wakeup latency in core clock cycles.
+ ******************************************************************************/
+uint32_t EMU_EM23WakeupCyclesGet(void)
+{
+  return emWakeupCycles;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Get the maximum EM2/EM3 wakeup latency since startup or since the last
+ *   call to @ref EMU_EM23WakeupCyclesClear().
+ *
+ * @note
+ *   SL_EMLIB_EMU_ENABLE_WAKEUP_TIMING must be enabled.
+ *
+ * @return
+ *   Maximum wakeup latency in core clock cycles.
+ ******************************************************************************/
+uint32_t EMU_EM23WakeupCyclesMaxGet(void)
+{
+  return emWakeupCyclesMax;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Clear the recorded EM2/EM3 wakeup latencies.
+ *
+ * @note
+ *   SL_EMLIB_EMU_ENABLE_WAKEUP_TIMING must be enabled.
+ ******************************************************************************/
+void EMU_EM23WakeupCyclesClear(void)
+{
+  emWakeupCycles = 0;
+  emWakeupCyclesMax = 0;
+}
+#endif
+
 #if defined(_EMU_EM4CONF_MASK) || defined(_EMU_EM4CTRL_MASK)
 /***************************************************************************//**
  * @brief
@@ -1797,12 +1966,19 @@ void EMU_PeripheralRetention(EMU_PeripheralRetention_TypeDef periMask, bool enab
  * @brief
  *   Update EMU module with CMU oscillator selection/enable status.
  *
+ * @details
+ *   The oscillator status saved by @ref EMU_EnterEM2() and @ref EMU_EnterEM3()
+ *   is only refreshed when the configuration is changed through the CMU and
+ *   EMU API. Call this function after writing the CMU oscillator or HF clock
+ *   select registers directly.
+ *
  * @deprecated
  *   Oscillator status is saved in @ref EMU_EnterEM2() and @ref EMU_EnterEM3().
  ******************************************************************************/
 void EMU_UpdateOscConfig(void)
 {
 #if (_SILICON_LABS_32B_SERIES < 2)
+  sli_em_emu_RestoreImageInvalidate();
   emState(emState_Save);
 #endif
 }
@@ -1951,6 +2127,7 @@ void EMU_VScaleEM01(EMU_VScaleEM01_TypeDef voltage, bool wait)
   }
 
   EMU->CMD = vScaleEM01Cmd(voltage);
+  sli_em_emu_RestoreImageInvalidate();
 
   if (wait) {
     EMU_VScaleWait();
@@ -667,6 +667,170 @@ void LCD_SegmentSet(int com, int bit, bool enable)
 #endif
 }
 
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+
+#if defined(_SILICON_LABS_32B_SERIES_2)
+#define LCD_SEGD_LOW(n)   (&LCD->SEGD ## n)
+#else
+#define LCD_SEGD_LOW(n)   (&LCD->SEGD ## n ## L)
+#endif
+
+/***************************************************************************//**
+ * @brief
+ *   Get the SEGD register holding a 32 bit word of a COM line.
+ ******************************************************************************/
+static volatile uint32_t *lcdSegdReg(int com, int word)
+{
+  (void) word;
+
+  switch (com) {
+    case 0:
+#if defined(_LCD_SEGD0H_MASK)
+      return (word == 0) ? LCD_SEGD_LOW(0) : &LCD->SEGD0H;
+#else
+      return LCD_SEGD_LOW(0);
+#endif
+    case 1:
+#if defined(_LCD_SEGD1H_MASK)
+      return (word == 0) ? LCD_SEGD_LOW(1) : &LCD->SEGD1H;
+#else
+      return LCD_SEGD_LOW(1);
+#endif
+    case 2:
+#if defined(_LCD_SEGD2H_MASK)
+      return (word == 0) ? LCD_SEGD_LOW(2) : &LCD->SEGD2H;
+#else
+      return LCD_SEGD_LOW(2);
+#endif
+    case 3:
+#if defined(_LCD_SEGD3H_MASK)
+      return (word == 0) ? LCD_SEGD_LOW(3) : &LCD->SEGD3H;
+#else
+      return LCD_SEGD_LOW(3);
+#endif
+#if defined(_LCD_SEGD4_MASK) || defined(_LCD_SEGD4L_MASK)
+    case 4:
+#if defined(_LCD_SEGD4H_MASK)
+      return (word == 0) ? LCD_SEGD_LOW(4) : &LCD->SEGD4H;
+#else
+      return LCD_SEGD_LOW(4);
+#endif
+#endif
+#if defined(_LCD_SEGD5_MASK) || defined(_LCD_SEGD5L_MASK)
+    case 5:
+#if defined(_LCD_SEGD5H_MASK)
+      return (word == 0) ? LCD_SEGD_LOW(5) : &LCD->SEGD5H;
+#else
+      return LCD_SEGD_LOW(5);
+#endif
+#endif
+#if defined(_LCD_SEGD6_MASK) || defined(_LCD_SEGD6L_MASK)
+    case 6:
+#if defined(_LCD_SEGD6H_MASK)
+      return (word == 0) ? LCD_SEGD_LOW(6) : &LCD->SEGD6H;
+#else
+      return LCD_SEGD_LOW(6);
+#endif
+#endif
+#if defined(_LCD_SEGD7_MASK) || defined(_LCD_SEGD7L_MASK)
+    case 7:
+#if defined(_LCD_SEGD7H_MASK)
+      return (word == 0) ? LCD_SEGD_LOW(7) : &LCD->SEGD7H;
+#else
+      return LCD_SEGD_LOW(7);
+#endif
+#endif
+    default:
+      EFM_ASSERT(0);
+      return NULL;
+  }
+}
+
+/** @endcond */
+
+/***************************************************************************//**
+ * @brief
+ *   Initialize an LCD shadow frame buffer.
+ *
+ * @details
+ *   All segments are cleared and every word is marked as changed, so that
+ *   the first @ref LCD_FrameBufferCommit() writes the complete image.
+ *
+ * @param[in] fb
+ *   A pointer to the frame buffer.
+ ******************************************************************************/
+void LCD_FrameBufferInit(LCD_FrameBuffer_TypeDef *fb)
+{
+  int com;
+  int word;
+
+  EFM_ASSERT(fb != NULL);
+
+  for (com = 0; com < (int)LCD_FRAMEBUFFER_COM_LINES; com++) {
+    for (word = 0; word < (int)LCD_FRAMEBUFFER_COM_WORDS; word++) {
+      fb->segd[com][word] = 0;
+    }
+  }
+  fb->dirty = (1UL << (LCD_FRAMEBUFFER_COM_LINES * LCD_FRAMEBUFFER_COM_WORDS)) - 1UL;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Write an LCD shadow frame buffer to the segment data registers.
+ *
+ * @details
+ *   Every SEGD register that changed since the last commit is written with
+ *   one word-wide access. Register updates are held back while the registers
+ *   are written, by freezing the LCD on Series 0 and 1 devices and by a
+ *   single manual load on Series 2 devices, so the new image is transferred
+ *   to the display as a whole. Combined with @ref LCD_UpdateCtrl() set to
+ *   @ref lcdUpdateCtrlFrameStart or @ref lcdUpdateCtrlFCEvent, the transfer
+ *   is also aligned to a frame boundary, avoiding a torn display.
+ *
+ * @note
+ *   On Series 2 devices with Auto Load enabled, the load is started by the
+ *   write to the configured load address register instead.
+ *
+ * @param[in] fb
+ *   A pointer to the frame buffer.
+ ******************************************************************************/
+void LCD_FrameBufferCommit(LCD_FrameBuffer_TypeDef *fb)
+{
+  uint32_t dirty;
+  int com;
+  int word;
+
+  EFM_ASSERT(fb != NULL);
+
+  dirty = fb->dirty;
+  if (dirty == 0UL) {
+    return;
+  }
+
+#if defined(_SILICON_LABS_32B_SERIES_2)
+  LCD_LoadBusyWait();
+#else
+  LCD_FreezeEnable(true);
+#endif
+
+  for (com = 0; com < (int)LCD_FRAMEBUFFER_COM_LINES; com++) {
+    for (word = 0; word < (int)LCD_FRAMEBUFFER_COM_WORDS; word++) {
+      if (dirty & (1UL << ((com * LCD_FRAMEBUFFER_COM_WORDS) + word))) {
+        *lcdSegdReg(com, word) = fb->segd[com][word];
+      }
+    }
+  }
+  fb->dirty = 0;
+
+#if defined(_SILICON_LABS_32B_SERIES_2)
+  if ((LCD->UPDATECTRL & _LCD_UPDATECTRL_AUTOLOAD_MASK) == 0UL) {
+    LCD_SyncStart(false, lcdLoadAddrNone);
+  }
+#else
+  LCD_FreezeEnable(false);
+#endif
+}
+
 /***************************************************************************//**
  * @brief
  *   Update 0-31 lowest segments on a given COM-line in one operation
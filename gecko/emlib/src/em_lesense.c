@@ -34,6 +34,7 @@
 #include "sl_assert.h"
 #include "em_bus.h"
 #include "em_cmu.h"
+#include <stddef.h>
 
 /** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
 #if !defined(UINT32_MAX)
@@ -49,6 +50,13 @@
  *  Labs 32-bit MCUs and SoCs. LESENSE is a low-energy sensor interface capable
  *  of autonomously collecting and processing data from multiple sensors even
  *  when in EM2.
+ *
+ *  On Series 1 devices, @ref LESENSE_TouchStart() runs a capacitive touch
+ *  engine on top of the scan results. The results are moved to RAM by LDMA
+ *  in EM2, and each channel gets a drift compensated baseline with
+ *  hysteresis. The count thresholds are kept adjusted so that the CPU is
+ *  only woken by press and release candidates and for periodic baseline
+ *  tracking.
  * @{
  ******************************************************************************/
 
@@ -1640,6 +1648,327 @@ void LESENSE_ResultBufferClear(void)
 #endif
 }
 
+#if defined(LESENSE_TOUCH_PRESENT)
+/***************************************************************************//**
+ * @brief
+ *   Start the capacitive touch engine.
+ *
+ * @details
+ *   The LESENSE result buffer is drained by LDMA into the RAM ring of
+ *   @p touch, waking the LDMA from EM2 with the LESENSE DMAWU signal. Each
+ *   processed channel is switched to threshold evaluation, stores its count
+ *   together with the channel index, and raises its interrupt at every scan
+ *   where the comparison triggers. The engine keeps the count threshold and
+ *   the comparison direction of each channel set so that the comparison only
+ *   triggers when the channel may be pressed or released. The CPU is
+ *   therefore only woken by real touch activity, and once per half ring for
+ *   baseline tracking.
+ *
+ *   The application must call @ref LESENSE_TouchProcess() from both the
+ *   LESENSE and the LDMA interrupt handlers.
+ *
+ * @note
+ *   Configure the channels with @ref LESENSE_ChannelConfig(), and call
+ *   LDMA_Init(), before calling this function. The first sample of each
+ *   channel is used as its initial baseline, so channels must not be touched
+ *   while the engine starts.
+ *
+ * @param[in] touch
+ *   Engine instance. Must remain valid until @ref LESENSE_TouchStop().
+ ******************************************************************************/
+void LESENSE_TouchStart(LESENSE_Touch_TypeDef *touch)
+{
+  LDMA_TransferCfg_t cfg =
+    LDMA_TRANSFER_CFG_PERIPHERAL(ldmaPeripheralSignal_LESENSE_BUFDATAV);
+  uint32_t chMask = 0;
+  uint16_t half;
+  uint8_t i;
+  uint8_t ch;
+
+  EFM_ASSERT(touch != NULL);
+  EFM_ASSERT((touch->channels != NULL) && (touch->state != NULL));
+  EFM_ASSERT((touch->numChannels > 0U)
+             && (touch->numChannels <= LESENSE_NUM_CHANNELS));
+  EFM_ASSERT((touch->buffer != NULL) && (touch->size >= 2U));
+  EFM_ASSERT(touch->dmaCh < DMA_CHAN_COUNT);
+
+  for (i = 0; i < LESENSE_NUM_CHANNELS; i++) {
+    touch->chMap[i] = 0xFFU;
+  }
+  for (i = 0; i < touch->numChannels; i++) {
+    ch = touch->channels[i].chIdx;
+    EFM_ASSERT(ch < LESENSE_NUM_CHANNELS);
+    EFM_ASSERT(touch->channels[i].releaseDelta < touch->channels[i].touchDelta);
+    EFM_ASSERT(touch->channels[i].baselineShift < 16U);
+
+    touch->chMap[ch] = i;
+    touch->state[i].baseline = 0;
+    touch->state[i].debounceCnt = 0;
+    touch->state[i].touched = false;
+    touch->state[i].valid = false;
+    chMask |= 1UL << ch;
+
+    /* Threshold evaluation, storing count and channel index of each sample.
+       A zero threshold with the "less" comparison never triggers, the
+       threshold is set once the baseline is known. */
+    BUS_RegMaskedWrite(&LESENSE->CH[ch].EVAL,
+                       _LESENSE_CH_EVAL_MODE_MASK
+                       | _LESENSE_CH_EVAL_STRSAMPLE_MASK
+                       | _LESENSE_CH_EVAL_COMP_MASK
+                       | _LESENSE_CH_EVAL_COMPTHRES_MASK,
+                       LESENSE_CH_EVAL_MODE_THRES
+                       | LESENSE_CH_EVAL_STRSAMPLE_DATASRC
+                       | LESENSE_CH_EVAL_COMP_LESS);
+    BUS_RegMaskedWrite(&LESENSE->CH[ch].INTERACT,
+                       _LESENSE_CH_INTERACT_SETIF_MASK,
+                       LESENSE_CH_INTERACT_SETIF_LEVEL);
+  }
+
+  /* Ring of two linked descriptors, each half raising the LDMA interrupt. */
+  half = touch->size / 2U;
+  touch->readIndex = 0;
+  touch->desc[0] = (LDMA_Descriptor_t)
+                   LDMA_DESCRIPTOR_LINKREL_P2M_WORD(&LESENSE->BUFDATA,
+                                                    touch->buffer,
+                                                    half,
+                                                    1);
+  touch->desc[1] = (LDMA_Descriptor_t)
+                   LDMA_DESCRIPTOR_LINKREL_P2M_WORD(&LESENSE->BUFDATA,
+                                                    &touch->buffer[half],
+                                                    touch->size - half,
+                                                    -1);
+
+  LESENSE_ResultBufferClear();
+  BUS_RegMaskedWrite(&LESENSE->CTRL,
+                     _LESENSE_CTRL_DMAWU_MASK,
+                     LESENSE_CTRL_DMAWU_BUFDATAV);
+  LDMA_StartTransfer((int)touch->dmaCh, &cfg, &touch->desc[0]);
+
+  LESENSE_IntClear(chMask);
+  LESENSE_IntEnable(chMask);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Stop the capacitive touch engine.
+ *
+ * @details
+ *   Stops the LDMA channel and disables the channel interrupts of the engine.
+ *   LESENSE scanning is not stopped.
+ *
+ * @param[in] touch
+ *   Engine instance.
+ ******************************************************************************/
+void LESENSE_TouchStop(LESENSE_Touch_TypeDef *touch)
+{
+  uint32_t chMask = 0;
+  uint8_t i;
+
+  EFM_ASSERT(touch != NULL);
+
+  for (i = 0; i < touch->numChannels; i++) {
+    chMask |= 1UL << touch->channels[i].chIdx;
+  }
+  LESENSE_IntDisable(chMask);
+  LDMA_StopTransfer((int)touch->dmaCh);
+  BUS_RegMaskedWrite(&LESENSE->CTRL,
+                     _LESENSE_CTRL_DMAWU_MASK,
+                     LESENSE_CTRL_DMAWU_DISABLE);
+  LESENSE_IntClear(chMask);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Process the samples received by the capacitive touch engine.
+ *
+ * @details
+ *   Runs @ref LESENSE_TouchFilter() on each new sample, reports press and
+ *   release events through the callback, and updates the count threshold and
+ *   comparison direction of the channels whose baseline or state changed.
+ *   Call from the LESENSE and LDMA interrupt handlers.
+ *
+ * @param[in] touch
+ *   Engine instance.
+ ******************************************************************************/
+void LESENSE_TouchProcess(LESENSE_Touch_TypeDef *touch)
+{
+  uint32_t writeIndex;
+  uint32_t raw;
+  uint32_t eval;
+  uint32_t chMask = 0;
+  uint32_t updateMask = 0;
+  uint16_t thres;
+  uint8_t ch;
+  uint8_t i;
+  LESENSE_TouchEvent_TypeDef event;
+
+  EFM_ASSERT(touch != NULL);
+
+  for (i = 0; i < touch->numChannels; i++) {
+    chMask |= 1UL << touch->channels[i].chIdx;
+  }
+  /* Samples are taken from the ring below, the flags only wake the CPU. */
+  LESENSE_IntClear(LESENSE_IntGet() & chMask);
+
+  /* DST points at the end of the ring until the first descriptor is
+     reloaded. */
+  writeIndex = ((LDMA->CH[touch->dmaCh].DST - (uint32_t)touch->buffer)
+                / sizeof(uint32_t)) % touch->size;
+
+  while (touch->readIndex != writeIndex) {
+    raw = touch->buffer[touch->readIndex];
+    touch->readIndex = (uint16_t)((touch->readIndex + 1U) % touch->size);
+
+    ch = (uint8_t)((raw & _LESENSE_BUFDATA_BUFDATASRC_MASK)
+                   >> _LESENSE_BUFDATA_BUFDATASRC_SHIFT);
+    i = touch->chMap[ch];
+    if (i >= touch->numChannels) {
+      continue;
+    }
+    event = LESENSE_TouchFilter(&touch->state[i],
+                                &touch->channels[i],
+                                (uint16_t)(raw & _LESENSE_BUFDATA_BUFDATA_MASK));
+    updateMask |= 1UL << i;
+    if ((event != lesenseTouchEventNone) && (touch->callback != NULL)) {
+      touch->callback(ch, event);
+    }
+  }
+
+  /* Only rewrite thresholds that actually moved. */
+  for (i = 0; i < touch->numChannels; i++) {
+    if ((updateMask & (1UL << i)) == 0U) {
+      continue;
+    }
+    ch = touch->channels[i].chIdx;
+    thres = LESENSE_TouchThresholdGet(&touch->state[i], &touch->channels[i]);
+    eval = (uint32_t)thres << _LESENSE_CH_EVAL_COMPTHRES_SHIFT;
+    eval |= touch->state[i].touched ? LESENSE_CH_EVAL_COMP_GE
+            : LESENSE_CH_EVAL_COMP_LESS;
+    if ((LESENSE->CH[ch].EVAL
+         & (_LESENSE_CH_EVAL_COMP_MASK | _LESENSE_CH_EVAL_COMPTHRES_MASK))
+        != eval) {
+      LESENSE_ChannelThresSet(ch,
+                              (uint16_t)(LESENSE->CH[ch].INTERACT
+                                         & _LESENSE_CH_INTERACT_THRES_MASK),
+                              thres);
+      BUS_RegMaskedWrite(&LESENSE->CH[ch].EVAL,
+                         _LESENSE_CH_EVAL_COMP_MASK,
+                         eval & _LESENSE_CH_EVAL_COMP_MASK);
+    }
+  }
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Run the capacitive touch filter on one sample.
+ *
+ * @details
+ *   The first sample initializes the baseline. While the channel is
+ *   untouched, samples that do not drop @p channel->touchDelta counts below
+ *   the baseline update it with a first order IIR filter to compensate for
+ *   drift. A press is reported after @p channel->debounce consecutive samples
+ *   at or below baseline - touchDelta, and a release after as many samples
+ *   above baseline - releaseDelta. The baseline is frozen while the channel
+ *   is touched or a press is being debounced.
+ *
+ *   This function does not access any hardware register.
+ *
+ * @param[in,out] state
+ *   Channel state.
+ *
+ * @param[in] channel
+ *   Channel configuration.
+ *
+ * @param[in] count
+ *   LESENSE count sample.
+ *
+ * @return
+ *   Press or release event, or @ref lesenseTouchEventNone.
+ ******************************************************************************/
+LESENSE_TouchEvent_TypeDef LESENSE_TouchFilter(LESENSE_TouchState_TypeDef *state,
+                                               const LESENSE_TouchChannel_TypeDef *channel,
+                                               uint16_t count)
+{
+  int32_t sample = (int32_t)((uint32_t)count << LESENSE_TOUCH_BASELINE_FRAC);
+  int32_t drop;
+  uint8_t debounce = (channel->debounce > 0U) ? channel->debounce : 1U;
+
+  if (!state->valid) {
+    state->baseline = (uint32_t)sample;
+    state->debounceCnt = 0;
+    state->touched = false;
+    state->valid = true;
+    return lesenseTouchEventNone;
+  }
+
+  drop = (int32_t)(state->baseline >> LESENSE_TOUCH_BASELINE_FRAC) - (int32_t)count;
+
+  if (!state->touched) {
+    if (drop >= (int32_t)channel->touchDelta) {
+      state->debounceCnt++;
+      if (state->debounceCnt >= debounce) {
+        state->debounceCnt = 0;
+        state->touched = true;
+        return lesenseTouchEventPress;
+      }
+    } else {
+      state->debounceCnt = 0;
+      state->baseline = (uint32_t)((int32_t)state->baseline
+                                   + ((sample - (int32_t)state->baseline)
+                                      / (1L << channel->baselineShift)));
+    }
+  } else {
+    if (drop < (int32_t)channel->releaseDelta) {
+      state->debounceCnt++;
+      if (state->debounceCnt >= debounce) {
+        state->debounceCnt = 0;
+        state->touched = false;
+        return lesenseTouchEventRelease;
+      }
+    } else {
+      state->debounceCnt = 0;
+    }
+  }
+
+  return lesenseTouchEventNone;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Get the LESENSE count threshold matching the state of a touch channel.
+ *
+ * @details
+ *   For an untouched channel, the threshold is used with the "less"
+ *   comparison and triggers on samples at or below baseline - touchDelta.
+ *   For a touched channel, it is used with the "greater or equal" comparison
+ *   and triggers on samples above baseline - releaseDelta. This function
+ *   does not access any hardware register.
+ *
+ * @param[in] state
+ *   Channel state.
+ *
+ * @param[in] channel
+ *   Channel configuration.
+ *
+ * @return
+ *   Count threshold, 0 if the baseline is not known yet.
+ ******************************************************************************/
+uint16_t LESENSE_TouchThresholdGet(const LESENSE_TouchState_TypeDef *state,
+                                   const LESENSE_TouchChannel_TypeDef *channel)
+{
+  int32_t thres;
+
+  if (!state->valid) {
+    return 0;
+  }
+  thres = (int32_t)(state->baseline >> LESENSE_TOUCH_BASELINE_FRAC) + 1;
+  thres -= state->touched ? (int32_t)channel->releaseDelta
+           : (int32_t)channel->touchDelta;
+
+  return (thres > 0) ? (uint16_t)thres : 0U;
+}
+#endif /* LESENSE_TOUCH_PRESENT */
+
 /***************************************************************************//**
  * @brief
  *   Reset the LESENSE module.
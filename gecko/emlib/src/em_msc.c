@@ -36,6 +36,7 @@
 #include "sl_common.h"
 #include "em_core.h"
 #include "em_system.h"
+#include <stddef.h>
 
 /** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
 
@@ -1545,6 +1546,407 @@ SL_RAMFUNC_DEFINITION_END
 
 #endif // defined(_SILICON_LABS_32B_SERIES_2)
 
+#if defined(MSC_ASYNC_PRESENT)
+
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+
+/* Queue of asynchronous requests. The head of the queue is the active one. */
+static MSC_AsyncRequest_TypeDef * volatile mscAsyncHead = NULL;
+static MSC_AsyncRequest_TypeDef * volatile mscAsyncTail = NULL;
+/* MSC register lock state to restore when the queue has drained. */
+static bool mscAsyncWasLocked = false;
+
+MSC_RAMFUNC_DECLARATOR MSC_Status_TypeDef
+mscAsyncStartStep(const MSC_AsyncRequest_TypeDef *request);
+
+MSC_RAMFUNC_DECLARATOR MSC_AsyncRequest_TypeDef *
+mscAsyncStartNext(void);
+
+MSC_RAMFUNC_DECLARATOR void
+mscAsyncCompleteFailed(MSC_AsyncRequest_TypeDef *failed);
+
+/***************************************************************************//**
+ * @brief
+ *   Start the next page erase or word write of an asynchronous request.
+ *
+ * @param[in] request
+ *   The active request. Its offset selects the page or word to process.
+ * @return
+ *   Returns the status of the address phase, @ref MSC_Status_TypeDef
+ * @verbatim
+ *   mscReturnOk - The operation was started, completion is signalled by
+ *                 the MSC ERASE or WRITE interrupt flag.
+ *   mscReturnInvalidAddr - The operation tried to access a non-flash area.
+ * @endverbatim
+ ******************************************************************************/
+MSC_RAMFUNC_DEFINITION_BEGIN
+MSC_Status_TypeDef mscAsyncStartStep(const MSC_AsyncRequest_TypeDef *request)
+{
+  uint32_t address = (uint32_t)request->address + request->offset;
+
+  MSC->ADDRB = address;
+#if !defined(_SILICON_LABS_32B_SERIES_2)
+  MSC->WRITECMD = MSC_WRITECMD_LADDRIM;
+#endif
+
+  if (MSC->STATUS & MSC_STATUS_INVADDR) {
+    return mscReturnInvalidAddr;
+  }
+
+  if (request->op == mscAsyncOpErase) {
+    MSC->WRITECMD = MSC_WRITECMD_ERASEPAGE;
+  } else {
+    MSC->WDATA = *(const uint32_t *)((const uint8_t *)request->data
+                                     + request->offset);
+#if defined(_SILICON_LABS_32B_SERIES_2)
+    MSC->WRITECMD = MSC_WRITECMD_WRITEEND;
+#else
+    MSC->WRITECMD = MSC_WRITECMD_WRITEONCE;
+#endif
+  }
+
+  return mscReturnOk;
+}
+MSC_RAMFUNC_DEFINITION_END
+
+/***************************************************************************//**
+ * @brief
+ *   Start the first queued request that has a valid address. Requests that
+ *   fail to start are removed from the queue. When the queue drains, flash
+ *   write is disabled and the MSC lock state restored. Must be called with
+ *   interrupts disabled.
+ *
+ * @return
+ *   List of the requests that failed to start, linked through their next
+ *   field. Their callbacks must be called once interrupts are enabled again.
+ ******************************************************************************/
+MSC_RAMFUNC_DEFINITION_BEGIN
+MSC_AsyncRequest_TypeDef *mscAsyncStartNext(void)
+{
+  MSC_AsyncRequest_TypeDef *failed = NULL;
+  MSC_AsyncRequest_TypeDef **failedTail = &failed;
+  MSC_AsyncRequest_TypeDef *request;
+
+  while ((request = mscAsyncHead) != NULL) {
+    if (mscAsyncStartStep(request) == mscReturnOk) {
+      return failed;
+    }
+
+    mscAsyncHead = request->next;
+    if (mscAsyncHead == NULL) {
+      mscAsyncTail = NULL;
+    }
+    request->next = NULL;
+    *failedTail   = request;
+    failedTail    = &request->next;
+  }
+
+  // Queue drained, restore the MSC write and lock state.
+  MSC_IntDisable(MSC_IF_ERASE | MSC_IF_WRITE);
+#if defined(_SILICON_LABS_32B_SERIES_2)
+  MSC->WRITECTRL_CLR = MSC_WRITECTRL_WREN;
+#else
+  MSC->WRITECTRL &= ~MSC_WRITECTRL_WREN;
+#endif
+  if (mscAsyncWasLocked) {
+    MSC->LOCK = MSC_LOCK_LOCKKEY_LOCK;
+  }
+
+  return failed;
+}
+MSC_RAMFUNC_DEFINITION_END
+
+/***************************************************************************//**
+ * @brief
+ *   Call the callbacks of a list of requests that could not be started.
+ *
+ * @param[in] failed
+ *   List returned by mscAsyncStartNext().
+ ******************************************************************************/
+MSC_RAMFUNC_DEFINITION_BEGIN
+void mscAsyncCompleteFailed(MSC_AsyncRequest_TypeDef *failed)
+{
+  MSC_AsyncRequest_TypeDef *request;
+
+  while ((request = failed) != NULL) {
+    failed        = request->next;
+    request->next = NULL;
+    if (request->callback != NULL) {
+      request->callback(request, mscReturnInvalidAddr);
+    }
+  }
+}
+MSC_RAMFUNC_DEFINITION_END
+
+/** @endcond */
+
+/***************************************************************************//**
+ * @brief
+ *   Queue an asynchronous flash erase or program request.
+ *
+ * @details
+ *   The request is appended to the MSC operation queue and this function
+ *   returns immediately. If the queue was empty, the first page erase or word
+ *   write is started at once. Each following step is started from
+ *   @ref MSC_AsyncIRQHandler() when the MSC signals that the previous step is
+ *   done, so queued requests are processed back-to-back without CPU polling.
+ *   The callback of a request is called from interrupt context when all its
+ *   pages or words have been processed, or on the first error.
+ *
+ * @note
+ *   The MSC interrupt is enabled in the NVIC by this function. The
+ *   application must provide an MSC_IRQHandler() that calls
+ *   @ref MSC_AsyncIRQHandler(). Do not call the blocking erase and write
+ *   functions while @ref MSC_AsyncIsBusy() returns true.
+ *
+ * @note
+ *   On Series 1 devices, flash erase and write require VSCALE2 for the whole
+ *   duration of the queued operations.
+ *
+ * @param[in] request
+ *   Request to queue. The driver owns the request until its callback is
+ *   called.
+ *
+ * @return
+ *   Returns the status of the submission, @ref MSC_Status_TypeDef
+ * @verbatim
+ *   mscReturnOk - The request was queued.
+ *   mscReturnUnaligned - The address or size does not match the operation
+ *                        alignment requirements.
+ * @endverbatim
+ ******************************************************************************/
+MSC_Status_TypeDef MSC_AsyncSubmit(MSC_AsyncRequest_TypeDef *request)
+{
+  MSC_AsyncRequest_TypeDef *failed;
+  CORE_DECLARE_IRQ_STATE;
+
+  EFM_ASSERT(request != NULL);
+
+  if (request->op == mscAsyncOpErase) {
+    if ((((uint32_t)request->address & (FLASH_PAGE_SIZE - 1U)) != 0U)
+        || ((request->numBytes & (FLASH_PAGE_SIZE - 1U)) != 0U)) {
+      return mscReturnUnaligned;
+    }
+  } else {
+    EFM_ASSERT(request->data != NULL);
+    if ((((uint32_t)request->address & 0x3U) != 0U)
+        || (((uint32_t)request->data & 0x3U) != 0U)
+        || ((request->numBytes & 0x3U) != 0U)) {
+      return mscReturnUnaligned;
+    }
+  }
+
+  request->offset = 0;
+  request->next   = NULL;
+
+  if (request->numBytes == 0U) {
+    if (request->callback != NULL) {
+      request->callback(request, mscReturnOk);
+    }
+    return mscReturnOk;
+  }
+
+  CORE_ENTER_CRITICAL();
+  if (mscAsyncHead != NULL) {
+    // The queue is already running, the request is started from the IRQ.
+    mscAsyncTail->next = request;
+    mscAsyncTail       = request;
+    CORE_EXIT_CRITICAL();
+    return mscReturnOk;
+  }
+
+  mscAsyncHead = request;
+  mscAsyncTail = request;
+
+#if defined(_EMU_STATUS_VSCALE_MASK) && defined(_SILICON_LABS_32B_SERIES_1)
+  /* VSCALE must be done and flash erase and write requires VSCALE2. */
+  EFM_ASSERT(!(EMU->STATUS & _EMU_STATUS_VSCALEBUSY_MASK));
+  EFM_ASSERT((EMU->STATUS & _EMU_STATUS_VSCALE_MASK) == EMU_STATUS_VSCALE_VSCALE2);
+#endif
+
+#if defined(_CMU_CLKEN1_MASK)
+  CMU->CLKEN1_SET = CMU_CLKEN1_MSC;
+#endif
+  mscAsyncWasLocked = MSC_IS_LOCKED();
+  MSC->LOCK = MSC_LOCK_LOCKKEY_UNLOCK;
+#if defined(_SILICON_LABS_32B_SERIES_2)
+  MSC->WRITECTRL_SET = MSC_WRITECTRL_WREN;
+#else
+  MSC->WRITECTRL |= MSC_WRITECTRL_WREN;
+#endif
+
+  MSC_IntClear(MSC_IF_ERASE | MSC_IF_WRITE);
+  MSC_IntEnable(MSC_IF_ERASE | MSC_IF_WRITE);
+  NVIC_ClearPendingIRQ(MSC_IRQn);
+  NVIC_EnableIRQ(MSC_IRQn);
+
+  failed = mscAsyncStartNext();
+  CORE_EXIT_CRITICAL();
+
+  mscAsyncCompleteFailed(failed);
+
+  return mscReturnOk;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Erase one or more consecutive flash pages without blocking.
+ *
+ * @details
+ *   Convenience wrapper that fills in @p request and passes it to
+ *   @ref MSC_AsyncSubmit().
+ *
+ * @param[out] request
+ *   Request storage, owned by the driver until @p callback is called.
+ * @param[in] startAddress
+ *   Pointer to the first flash page to erase. Must be page aligned.
+ * @param[in] numPages
+ *   Number of pages to erase.
+ * @param[in] callback
+ *   Completion callback, called from interrupt context. May be NULL.
+ * @param[in] userData
+ *   User data stored in the request.
+ *
+ * @return
+ *   Returns the status of the submission, see @ref MSC_AsyncSubmit().
+ ******************************************************************************/
+MSC_Status_TypeDef MSC_ErasePageAsync(MSC_AsyncRequest_TypeDef *request,
+                                      uint32_t *startAddress,
+                                      uint32_t numPages,
+                                      MSC_AsyncCallback_TypeDef callback,
+                                      void *userData)
+{
+  request->op       = mscAsyncOpErase;
+  request->address  = startAddress;
+  request->data     = NULL;
+  request->numBytes = numPages * FLASH_PAGE_SIZE;
+  request->callback = callback;
+  request->userData = userData;
+
+  return MSC_AsyncSubmit(request);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Write data to flash memory without blocking.
+ *
+ * @details
+ *   Convenience wrapper that fills in @p request and passes it to
+ *   @ref MSC_AsyncSubmit(). Words are programmed one at a time, each started
+ *   from the MSC write done interrupt of the previous one.
+ *
+ * @param[out] request
+ *   Request storage, owned by the driver until @p callback is called.
+ * @param[in] address
+ *   Pointer to the flash word to write to. Must be aligned to words.
+ * @param[in] data
+ *   Data to write to flash. Must be aligned to words and remain valid until
+ *   @p callback is called.
+ * @param[in] numBytes
+ *   Number of bytes to write to flash. NB: Must be divisible by four.
+ * @param[in] callback
+ *   Completion callback, called from interrupt context. May be NULL.
+ * @param[in] userData
+ *   User data stored in the request.
+ *
+ * @return
+ *   Returns the status of the submission, see @ref MSC_AsyncSubmit().
+ ******************************************************************************/
+MSC_Status_TypeDef MSC_WriteWordAsync(MSC_AsyncRequest_TypeDef *request,
+                                      uint32_t *address,
+                                      void const *data,
+                                      uint32_t numBytes,
+                                      MSC_AsyncCallback_TypeDef callback,
+                                      void *userData)
+{
+  request->op       = mscAsyncOpWrite;
+  request->address  = address;
+  request->data     = data;
+  request->numBytes = numBytes;
+  request->callback = callback;
+  request->userData = userData;
+
+  return MSC_AsyncSubmit(request);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Check whether asynchronous flash operations are in progress.
+ *
+ * @return
+ *   True if the asynchronous operation queue is not empty.
+ ******************************************************************************/
+bool MSC_AsyncIsBusy(void)
+{
+  return mscAsyncHead != NULL;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   MSC interrupt handler for the asynchronous erase and program API.
+ *
+ * @details
+ *   Must be called from MSC_IRQHandler(). Checks the outcome of the completed
+ *   page erase or word write, starts the next step of the active request,
+ *   and calls the completion callback when a request is done before moving
+ *   on to the next queued request.
+ ******************************************************************************/
+MSC_RAMFUNC_DEFINITION_BEGIN
+void MSC_AsyncIRQHandler(void)
+{
+  MSC_AsyncRequest_TypeDef *request = mscAsyncHead;
+  MSC_AsyncRequest_TypeDef *failed;
+  MSC_Status_TypeDef status = mscReturnOk;
+  uint32_t flags = MSC_IntGet() & (MSC_IF_ERASE | MSC_IF_WRITE);
+  uint32_t step;
+  CORE_DECLARE_IRQ_STATE;
+
+  if ((flags == 0U) || (request == NULL)) {
+    return;
+  }
+  MSC_IntClear(flags);
+
+#if defined(_SILICON_LABS_32B_SERIES_2)
+  // The done flag may be raised while PENDING is still set, the remaining
+  // time is short compared to the operation itself.
+  status = mscStatusWait((MSC_STATUS_BUSY | MSC_STATUS_PENDING), 0);
+#else
+  if (MSC->STATUS & MSC_STATUS_LOCKED) {
+    status = mscReturnLocked;
+  }
+#endif
+
+  CORE_ENTER_CRITICAL();
+  step = (request->op == mscAsyncOpErase) ? FLASH_PAGE_SIZE : 4U;
+  request->offset += step;
+
+  if ((status == mscReturnOk) && (request->offset < request->numBytes)) {
+    status = mscAsyncStartStep(request);
+    if (status == mscReturnOk) {
+      CORE_EXIT_CRITICAL();
+      return;
+    }
+  }
+
+  // The active request is done, pop it and start the next one before
+  // reporting completion so the flash is kept busy.
+  mscAsyncHead = request->next;
+  if (mscAsyncHead == NULL) {
+    mscAsyncTail = NULL;
+  }
+  request->next = NULL;
+  failed = mscAsyncStartNext();
+  CORE_EXIT_CRITICAL();
+
+  if (request->callback != NULL) {
+    request->callback(request, status);
+  }
+  mscAsyncCompleteFailed(failed);
+}
+MSC_RAMFUNC_DEFINITION_END
+
+#endif /* defined(MSC_ASYNC_PRESENT) */
+
 #if defined(_MSC_ECCCTRL_MASK)          \
   || defined(_SYSCFG_DMEM0ECCCTRL_MASK) \
   || defined(_MPAHBRAM_CTRL_MASK)
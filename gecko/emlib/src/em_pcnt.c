@@ -980,6 +980,46 @@ void PCNT_TCCConfiguration(PCNT_TypeDef *pcnt, const PCNT_TCC_TypeDef *config)
   PCNT_Sync(pcnt, PCNT_SYNCBUSY_CTRL);
   pcnt->CTRL = (pcnt->CTRL & (~mask)) | ctrl;
 }
+
+/***************************************************************************//**
+ * @brief
+ *   Start gated counting of the PCNT input.
+ *
+ * @details
+ *   This function will configure the TCC module to gate the PCNT input with a
+ *   PRS signal, without any compare and clear, and reset the counter. With a
+ *   gate window of known length, for instance a TIMER output routed through
+ *   PRS, the counter then holds the number of input events seen during the
+ *   window without any CPU involvement per event. Read it with
+ *   @ref PCNT_CounterGet() once the window is over, the input frequency being
+ *   the count divided by the window length.
+ *
+ *   This is the counterpart of the TIMER capture engine for signals too fast
+ *   for per edge captures.
+ *
+ * @param[in] pcnt
+ *   A pointer to the PCNT peripheral register block.
+ *
+ * @param[in] prsSel
+ *   PRS channel carrying the gate signal.
+ *
+ * @param[in] prsPolarity
+ *   Gate polarity, see @p prsPolarity of @ref PCNT_TCC_TypeDef.
+ ******************************************************************************/
+void PCNT_GatedCountStart(PCNT_TypeDef *pcnt,
+                          PCNT_PRSSel_TypeDef prsSel,
+                          bool prsPolarity)
+{
+  PCNT_TCC_TypeDef tcc = PCNT_TCC_DEFAULT;
+
+  EFM_ASSERT(PCNT_REF_VALID(pcnt));
+
+  tcc.tccPRS = prsSel;
+  tcc.prsPolarity = prsPolarity;
+  tcc.prsGateEnable = true;
+  PCNT_TCCConfiguration(pcnt, &tcc);
+  PCNT_CounterReset(pcnt);
+}
 #endif
 
 /***************************************************************************//**
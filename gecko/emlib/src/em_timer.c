@@ -32,6 +32,7 @@
 #if defined(TIMER_COUNT) && (TIMER_COUNT > 0)
 
 #include "sl_assert.h"
+#include <stddef.h>
 
 /***************************************************************************//**
  * @addtogroup timer TIMER - Timer/Counter
@@ -41,6 +42,11 @@
  *   @li General timer configuration and enable control.
  *   @li Compare/capture control.
  *   @li Dead time insertion control (may not be available for all timers).
+ *
+ *   On devices with LDMA, @ref TIMER_CaptureStart() measures the period and
+ *   duty cycle of an external signal without any interrupt per edge. The
+ *   capture values are moved to RAM rings by LDMA and accumulated into
+ *   statistics in batches.
  * @{
  ******************************************************************************/
 
@@ -516,5 +522,333 @@ void TIMER_SyncWait(TIMER_TypeDef * timer)
 }
 #endif
 
+
+#if defined(TIMER_CAPTURE_PRESENT)
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+
+/* Address of the capture value of a CC channel. */
+#if defined(_TIMER_CC_CFG_MASK)
+#define TIMER_CAPTURE_REG(timer, cc)    (&(timer)->CC[cc].ICF)
+#else
+#define TIMER_CAPTURE_REG(timer, cc)    (&(timer)->CC[cc].CCV)
+#endif
+
+/***************************************************************************//**
+ * @brief
+ *   Start an LDMA ring of two linked descriptors moving a CC capture value.
+ ******************************************************************************/
+static void timerCaptureRingStart(unsigned int dmaCh,
+                                  LDMA_PeripheralSignal_t signal,
+                                  volatile const uint32_t *src,
+                                  uint32_t *buffer,
+                                  uint16_t size,
+                                  LDMA_Descriptor_t *desc)
+{
+  LDMA_TransferCfg_t cfg = LDMA_TRANSFER_CFG_PERIPHERAL(signal);
+  uint16_t half = size / 2U;
+
+  desc[0] = (LDMA_Descriptor_t)
+            LDMA_DESCRIPTOR_LINKREL_P2M_WORD(src, buffer, half, 1);
+  desc[1] = (LDMA_Descriptor_t)
+            LDMA_DESCRIPTOR_LINKREL_P2M_WORD(src, &buffer[half], size - half, -1);
+  LDMA_StartTransfer((int)dmaCh, &cfg, &desc[0]);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Get the next index of a ring that the LDMA will write to.
+ ******************************************************************************/
+static uint16_t timerCaptureRingWriteIndex(unsigned int dmaCh,
+                                           const uint32_t *buffer,
+                                           uint16_t size)
+{
+  /* DST is reloaded from the next descriptor as soon as one completes. */
+  return (uint16_t)(((LDMA->CH[dmaCh].DST - (uint32_t)buffer)
+                     / sizeof(uint32_t)) % size);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Get the contiguous part of a ring waiting to be processed.
+ *
+ * @return
+ *   Number of words starting at *read.
+ ******************************************************************************/
+static unsigned int timerCaptureRingSpan(uint16_t read,
+                                         uint16_t write,
+                                         uint16_t size)
+{
+  return (write >= read) ? (unsigned int)(write - read)
+         : (unsigned int)(size - read);
+}
+
+/** @endcond */
+
+/***************************************************************************//**
+ * @brief
+ *   Start the TIMER capture to LDMA measurement engine.
+ *
+ * @details
+ *   Two LDMA channels move the CC0 and CC1 capture values of the TIMER into
+ *   the rings of @p capture, so no CPU is involved per edge. Each channel
+ *   raises its LDMA interrupt every half ring. Call
+ *   @ref TIMER_CaptureProcess() at least that often, for instance from the
+ *   LDMA interrupt handler, to move the captures into statistics.
+ *
+ * @note
+ *   This function does not configure the TIMER. The application must set up
+ *   the reload-start rise action and the CC0/CC1 input captures as described
+ *   in @ref TIMER_Capture_TypeDef before calling it. LDMA_Init() must have
+ *   been called. The first capture of each channel is discarded, since it
+ *   does not cover a full period.
+ *
+ * @param[in] capture
+ *   Engine instance. Must remain valid until @ref TIMER_CaptureStop().
+ ******************************************************************************/
+void TIMER_CaptureStart(TIMER_Capture_TypeDef *capture)
+{
+  EFM_ASSERT(capture != NULL);
+  EFM_ASSERT(TIMER_Valid(capture->timer));
+  EFM_ASSERT((capture->periodBuffer != NULL) && (capture->highBuffer != NULL));
+  EFM_ASSERT(capture->size >= 2U);
+  EFM_ASSERT((capture->periodDmaCh < DMA_CHAN_COUNT)
+             && (capture->highDmaCh < DMA_CHAN_COUNT)
+             && (capture->periodDmaCh != capture->highDmaCh));
+
+  capture->periodRead = 0;
+  capture->highRead = 0;
+  capture->periodPrimed = false;
+  capture->highPrimed = false;
+
+  timerCaptureRingStart(capture->periodDmaCh,
+                        capture->periodSignal,
+                        TIMER_CAPTURE_REG(capture->timer, 0),
+                        capture->periodBuffer,
+                        capture->size,
+                        capture->periodDesc);
+  timerCaptureRingStart(capture->highDmaCh,
+                        capture->highSignal,
+                        TIMER_CAPTURE_REG(capture->timer, 1),
+                        capture->highBuffer,
+                        capture->size,
+                        capture->highDesc);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Stop the TIMER capture to LDMA measurement engine.
+ *
+ * @details
+ *   Stops both LDMA channels. The TIMER is left running.
+ *
+ * @param[in] capture
+ *   Engine instance.
+ ******************************************************************************/
+void TIMER_CaptureStop(TIMER_Capture_TypeDef *capture)
+{
+  EFM_ASSERT(capture != NULL);
+
+  LDMA_StopTransfer((int)capture->periodDmaCh);
+  LDMA_StopTransfer((int)capture->highDmaCh);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Accumulate the captures received since the last call into statistics.
+ *
+ * @param[in] capture
+ *   Engine instance.
+ *
+ * @param[in,out] stats
+ *   Statistics to update, see @ref TIMER_CaptureStatsClear().
+ ******************************************************************************/
+void TIMER_CaptureProcess(TIMER_Capture_TypeDef *capture,
+                          TIMER_CaptureStats_TypeDef *stats)
+{
+  uint16_t periodWrite;
+  uint16_t highWrite;
+  unsigned int periodCount;
+  unsigned int highCount;
+
+  EFM_ASSERT((capture != NULL) && (stats != NULL));
+
+  periodWrite = timerCaptureRingWriteIndex(capture->periodDmaCh,
+                                           capture->periodBuffer,
+                                           capture->size);
+  highWrite = timerCaptureRingWriteIndex(capture->highDmaCh,
+                                         capture->highBuffer,
+                                         capture->size);
+
+  /* Drop the first capture of each channel. */
+  if (!capture->periodPrimed && (capture->periodRead != periodWrite)) {
+    capture->periodRead = (uint16_t)((capture->periodRead + 1U) % capture->size);
+    capture->periodPrimed = true;
+  }
+  if (!capture->highPrimed && (capture->highRead != highWrite)) {
+    capture->highRead = (uint16_t)((capture->highRead + 1U) % capture->size);
+    capture->highPrimed = true;
+  }
+
+  /* At most two contiguous spans per ring. */
+  while ((capture->periodRead != periodWrite) || (capture->highRead != highWrite)) {
+    periodCount = timerCaptureRingSpan(capture->periodRead, periodWrite, capture->size);
+    highCount = timerCaptureRingSpan(capture->highRead, highWrite, capture->size);
+
+    TIMER_CaptureStatsUpdate(stats,
+                             &capture->periodBuffer[capture->periodRead],
+                             periodCount,
+                             &capture->highBuffer[capture->highRead],
+                             highCount);
+
+    capture->periodRead = (uint16_t)((capture->periodRead + periodCount) % capture->size);
+    capture->highRead = (uint16_t)((capture->highRead + highCount) % capture->size);
+  }
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Clear capture statistics.
+ *
+ * @param[out] stats
+ *   Statistics to clear.
+ ******************************************************************************/
+void TIMER_CaptureStatsClear(TIMER_CaptureStats_TypeDef *stats)
+{
+  EFM_ASSERT(stats != NULL);
+
+  stats->periods = 0;
+  stats->periodMin = UINT32_MAX;
+  stats->periodMax = 0;
+  stats->periodSum = 0;
+  stats->highs = 0;
+  stats->highSum = 0;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Accumulate a batch of periods and high times into statistics.
+ *
+ * @details
+ *   This function does not access any hardware register, and can be fed with
+ *   any capture stream.
+ *
+ * @param[in,out] stats
+ *   Statistics to update.
+ *
+ * @param[in] periods
+ *   Periods, in timer ticks.
+ *
+ * @param[in] periodCount
+ *   Number of periods.
+ *
+ * @param[in] highs
+ *   High times, in timer ticks.
+ *
+ * @param[in] highCount
+ *   Number of high times.
+ ******************************************************************************/
+void TIMER_CaptureStatsUpdate(TIMER_CaptureStats_TypeDef *stats,
+                              const uint32_t *periods,
+                              unsigned int periodCount,
+                              const uint32_t *highs,
+                              unsigned int highCount)
+{
+  unsigned int i;
+  uint32_t period;
+
+  EFM_ASSERT(stats != NULL);
+  EFM_ASSERT((periods != NULL) || (periodCount == 0U));
+  EFM_ASSERT((highs != NULL) || (highCount == 0U));
+
+  for (i = 0; i < periodCount; i++) {
+    period = periods[i];
+    if (period < stats->periodMin) {
+      stats->periodMin = period;
+    }
+    if (period > stats->periodMax) {
+      stats->periodMax = period;
+    }
+    stats->periodSum += period;
+  }
+  stats->periods += periodCount;
+
+  for (i = 0; i < highCount; i++) {
+    stats->highSum += highs[i];
+  }
+  stats->highs += highCount;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Get the mean frequency of the captured signal.
+ *
+ * @param[in] stats
+ *   Statistics.
+ *
+ * @param[in] timerFreq
+ *   Counting frequency of the TIMER in Hz, that is its clock frequency
+ *   divided by the prescaler.
+ *
+ * @return
+ *   Frequency in mHz, 0 if no period was captured.
+ ******************************************************************************/
+uint32_t TIMER_CaptureStatsFreqGet(const TIMER_CaptureStats_TypeDef *stats,
+                                   uint32_t timerFreq)
+{
+  uint64_t freq;
+  uint64_t scale = (uint64_t)timerFreq * 1000U;
+  uint64_t periods;
+  uint64_t periodSum;
+
+  EFM_ASSERT(stats != NULL);
+
+  periods = stats->periods;
+  periodSum = stats->periodSum;
+
+  /* Scale the period count and sum down together until the product below
+     fits in 64 bits. The mean period, and so the result, is kept. */
+  while ((scale != 0U) && (periods > (UINT64_MAX / scale))) {
+    periods >>= 1;
+    periodSum >>= 1;
+  }
+  if (periodSum == 0U) {
+    return 0;
+  }
+  freq = (scale * periods) / periodSum;
+
+  return (freq > UINT32_MAX) ? UINT32_MAX : (uint32_t)freq;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Get the mean duty cycle of the captured signal.
+ *
+ * @param[in] stats
+ *   Statistics.
+ *
+ * @return
+ *   Duty cycle in per mille, 0 if nothing was captured.
+ ******************************************************************************/
+uint32_t TIMER_CaptureStatsDutyGet(const TIMER_CaptureStats_TypeDef *stats)
+{
+  uint64_t meanPeriod;
+  uint64_t meanHigh;
+
+  EFM_ASSERT(stats != NULL);
+
+  if ((stats->periods == 0U) || (stats->highs == 0U)) {
+    return 0;
+  }
+  meanPeriod = stats->periodSum / stats->periods;
+  meanHigh = stats->highSum / stats->highs;
+  if (meanPeriod == 0U) {
+    return 0;
+  }
+
+  return (meanHigh >= meanPeriod) ? 1000U
+         : (uint32_t)((meanHigh * 1000U) / meanPeriod);
+}
+#endif /* TIMER_CAPTURE_PRESENT */
+
 /** @} (end addtogroup timer) */
 #endif /* defined(TIMER_COUNT) && (TIMER_COUNT > 0) */
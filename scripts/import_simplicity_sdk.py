@@ -62,6 +62,9 @@ paths = [
   "platform/service/clock_manager/config/**/*.h", # TODO
   "platform/service/clock_manager/inc/*.h",
   "platform/service/clock_manager/src/*.[ch]",
+  "platform/service/coulomb_counter/config/*.h", # TODO
+  "platform/service/coulomb_counter/inc/*.h",
+  "platform/service/coulomb_counter/src/*.[ch]",
   "platform/service/device_init/config/**/*.h", # TODO
   "platform/service/device_init/inc/*.h",
   "platform/service/device_init/src/*.[ch]",
@@ -70,6 +73,9 @@ paths = [
   "platform/service/hfxo_manager/inc/*.h",
   "platform/service/hfxo_manager/src/*.[ch]",
   "platform/service/interrupt_manager/inc/*.h",
+  "platform/service/keyscan/config/*.h", # TODO
+  "platform/service/keyscan/inc/*.h",
+  "platform/service/keyscan/src/*.[ch]",
   "platform/service/mem_pool/inc/*.h",
   "platform/service/mem_pool/src/*.[ch]",
   "platform/service/memory_manager/config/*.h", # TODO
@@ -177,6 +177,7 @@ paths = [
     "components/device/silabs/si91x/wireless/asynchronous_socket/src/sl_si91x_socket.c",
     "components/device/silabs/si91x/wireless/ble/inc/rsi_ble_apis.h",
     "components/device/silabs/si91x/wireless/ble/inc/rsi_ble_common_config.h",
+    "components/device/silabs/si91x/wireless/ble/inc/rsi_ble_scan_filter.h",
     "components/device/silabs/si91x/wireless/ble/inc/rsi_ble.h",
     "components/device/silabs/si91x/wireless/ble/inc/rsi_bt_common_apis.h",
     "components/device/silabs/si91x/wireless/ble/inc/rsi_bt_common_config.h",
@@ -186,6 +187,7 @@ paths = [
     "components/device/silabs/si91x/wireless/ble/inc/rsi_user.h",
     "components/device/silabs/si91x/wireless/ble/inc/rsi_utils.h",
     "components/device/silabs/si91x/wireless/ble/inc/sl_si91x_ble.h",
+    "components/device/silabs/si91x/wireless/ble/src/rsi_ble_scan_filter.c",
     "components/device/silabs/si91x/wireless/ble/src/rsi_bt_ble.c",
     "components/device/silabs/si91x/wireless/ble/src/rsi_common_apis.c",
     "components/device/silabs/si91x/wireless/ble/src/rsi_utils.c",
@@ -264,6 +266,7 @@ paths = [
     "components/device/silabs/si91x/wireless/socket/inc/sl_si91x_socket_utility.h",
     "components/device/silabs/si91x/wireless/socket/src/sl_si91x_socket_utility.c",
     "components/device/silabs/si91x/wireless/src/sl_rsi_utility.c",
+    "components/device/silabs/si91x/wireless/src/sl_si91x_command_window.c",
     "components/device/silabs/si91x/wireless/src/sl_si91x_driver.c",
     "components/protocol/wifi/inc/sli_wifi_constants.h",
     "components/protocol/wifi/inc/sl_wifi_callback_framework.h",
@@ -277,6 +280,7 @@ paths = [
     "components/protocol/wifi/src/sl_wifi_callback_framework.c",
     "components/service/bsd_socket/si91x_socket/sl_si91x_socket_support.h",
     "components/service/network_manager/inc/sli_net_types.h",
+    "components/service/network_manager/inc/sli_net_auto_join.h",
     "components/service/network_manager/inc/sli_net_common_utility.h",
     "components/service/network_manager/inc/sli_net_constants.h",
     "components/service/network_manager/inc/sl_net_constants.h",
@@ -285,6 +289,7 @@ paths = [
     "components/service/network_manager/inc/sl_net_ip_types.h",
     "components/service/network_manager/inc/sl_net_types.h",
     "components/service/network_manager/inc/sl_net_wifi_types.h",
+    "components/service/network_manager/src/sli_net_auto_join.c",
     "components/service/network_manager/src/sli_net_common_utility.c",
     "components/service/network_manager/src/sl_net_basic_profiles.c",
     "components/service/network_manager/src/sl_net.c",
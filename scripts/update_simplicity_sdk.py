@@ -8,6 +8,7 @@ SPDX-License-Identifier: Apache-2.0
 
 import argparse
 import json
+import re
 from pathlib import Path
 
 import git
@@ -15,6 +16,10 @@ from ruamel.yaml import YAML
 
 import import_simplicity_sdk
 
+# Commit subjects may carry a bracketed tracking tag, e.g. "[ABC-123] simplicity_sdk: Patch ..."
+PATCH_RE = re.compile(r"^(\[[^\]]+\] )?simplicity_sdk: Patch")
+IMPORT_RE = re.compile(r"^(\[[^\]]+\] )?simplicity_sdk: Import")
+
 if __name__ == "__main__":
     parser = argparse.ArgumentParser(description="Update SiSDK")
     parser.add_argument("--src", help="Source directory", type=Path, default=Path(__file__).parent / "cache" / "simplicity_sdk")
@@ -52,9 +57,9 @@ if __name__ == "__main__":
     repo = git.Repo(Path.cwd())
     patches = []
     for c in repo.iter_commits(max_count=200):
-        if c.message.startswith("simplicity_sdk: Patch"):
+        if PATCH_RE.match(c.message):
             patches.append(c)
-        elif c.message.startswith("simplicity_sdk: Import"):
+        elif IMPORT_RE.match(c.message):
             break
         else:
             print(f"  keep {c}")
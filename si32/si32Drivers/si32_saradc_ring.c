@@ -0,0 +1,244 @@
+//------------------------------------------------------------------------------
+// Copyright 2025 (c) Silicon Laboratories Inc.
+//
+// SPDX-License-Identifier: Zlib
+//
+// This siHAL software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//------------------------------------------------------------------------------
+/// @file si32_saradc_ring.c
+
+#include <assert.h>
+#include <stddef.h>
+#include "si32_saradc_ring.h"
+
+#define RING_BLOCK_CONFIG    SI32_DMADESC_A_CONFIG_WORD_RX_PP
+#define RING_DISCARD_CONFIG  SI32_DMADESC_A_CONFIG_PIPE(WORD, PING_PONG)
+
+//-----------------------------------------------------------------------------
+// ring_assign
+//
+// Builds the descriptor of a slot for the next free block, or for the
+// discard word if the application holds all the other blocks.
+//-----------------------------------------------------------------------------
+static void
+ring_assign(
+   si32_saradc_ring_t * ring,
+   uint32_t slot,
+   SI32_DMADESC_A_Type * descriptor)
+{
+   uint32_t held = ring->completed - ring->released;
+   uint32_t block;
+
+   if (ring->assigned + held < ring->block_count)
+   {
+      block = ring->write_index;
+      ring->write_index = (block + 1 == ring->block_count) ? 0 : block + 1;
+      ring->assigned++;
+      SI32_DMADESC_A_configure(descriptor, ring->source,
+         &ring->buffer[block * ring->block_size], ring->block_size,
+         RING_BLOCK_CONFIG);
+   }
+   else
+   {
+      block = SI32_SARADC_RING_DISCARD;
+      SI32_DMADESC_A_configure(descriptor, ring->source, &ring->discard,
+         ring->block_size, RING_DISCARD_CONFIG);
+   }
+   ring->slot_block[slot] = block;
+}
+
+//-----------------------------------------------------------------------------
+// si32_saradc_ring_initialize
+//
+//-----------------------------------------------------------------------------
+void
+si32_saradc_ring_initialize(
+   si32_saradc_ring_t * ring,
+   volatile uint32_t * source,
+   uint32_t * buffer,
+   uint32_t block_size,
+   uint32_t block_count)
+{
+   assert((block_size >= 1) && (block_size <= SI32_SARADC_RING_MAX_BLOCK_SIZE));
+   assert(block_count >= 2);
+
+   ring->source = source;
+   ring->buffer = buffer;
+   ring->block_size = block_size;
+   ring->block_count = block_count;
+   ring->callback = NULL;
+   ring->context = NULL;
+   ring->completed = 0;
+   ring->released = 0;
+   ring->overruns = 0;
+   ring->assigned = 0;
+   ring->write_index = 0;
+   ring->read_index = 0;
+   ring->active_slot = 0;
+   ring->slot_block[0] = SI32_SARADC_RING_DISCARD;
+   ring->slot_block[1] = SI32_SARADC_RING_DISCARD;
+}
+
+//-----------------------------------------------------------------------------
+// si32_saradc_ring_set_callback
+//
+//-----------------------------------------------------------------------------
+void
+si32_saradc_ring_set_callback(
+   si32_saradc_ring_t * ring,
+   si32_saradc_ring_callback_t callback,
+   void * context)
+{
+   ring->callback = callback;
+   ring->context = context;
+}
+
+//-----------------------------------------------------------------------------
+// si32_saradc_ring_start
+//
+//-----------------------------------------------------------------------------
+void
+si32_saradc_ring_start(
+   si32_saradc_ring_t * ring,
+   SI32_DMADESC_A_Type * primary,
+   SI32_DMADESC_A_Type * alternate)
+{
+   ring->completed = 0;
+   ring->released = 0;
+   ring->overruns = 0;
+   ring->assigned = 0;
+   ring->write_index = 0;
+   ring->read_index = 0;
+   ring->active_slot = 0;
+   ring_assign(ring, 0, primary);
+   ring_assign(ring, 1, alternate);
+}
+
+//-----------------------------------------------------------------------------
+// si32_saradc_ring_dma_done
+//
+//-----------------------------------------------------------------------------
+bool
+si32_saradc_ring_dma_done(
+   si32_saradc_ring_t * ring,
+   SI32_DMADESC_A_Type * primary,
+   SI32_DMADESC_A_Type * alternate)
+{
+   SI32_DMADESC_A_Type * descriptor[2];
+   uint32_t done = 0;
+
+   descriptor[0] = primary;
+   descriptor[1] = alternate;
+
+   // The controller leaves a completed descriptor in the stop mode, and
+   // the descriptors complete in turn.
+   while ((done < 2)
+      && (descriptor[ring->active_slot]->CONFIG.TMD == SI32_DMADESC_A_CONFIG_TMD_STOP_VALUE))
+   {
+      uint32_t slot = ring->active_slot;
+      uint32_t block = ring->slot_block[slot];
+
+      if (block == SI32_SARADC_RING_DISCARD)
+      {
+         ring->overruns++;
+      }
+      else
+      {
+         ring->assigned--;
+         ring->completed++;
+      }
+
+      // Rebuild the descriptor before the other one completes.
+      ring_assign(ring, slot, descriptor[slot]);
+      ring->active_slot = slot ^ 1;
+      done++;
+
+      if ((block != SI32_SARADC_RING_DISCARD) && (ring->callback != NULL))
+      {
+         ring->callback(&ring->buffer[block * ring->block_size],
+            ring->block_size, ring->context);
+      }
+   }
+
+   return done == 2;
+}
+
+//-----------------------------------------------------------------------------
+// si32_saradc_ring_is_primary_next
+//
+//-----------------------------------------------------------------------------
+bool
+si32_saradc_ring_is_primary_next(
+   si32_saradc_ring_t * ring)
+{
+   return ring->active_slot == 0;
+}
+
+//-----------------------------------------------------------------------------
+// si32_saradc_ring_get_block
+//
+//-----------------------------------------------------------------------------
+uint32_t *
+si32_saradc_ring_get_block(
+   si32_saradc_ring_t * ring)
+{
+   if (ring->completed == ring->released)
+   {
+      return NULL;
+   }
+   return &ring->buffer[ring->read_index * ring->block_size];
+}
+
+//-----------------------------------------------------------------------------
+// si32_saradc_ring_release_block
+//
+//-----------------------------------------------------------------------------
+void
+si32_saradc_ring_release_block(
+   si32_saradc_ring_t * ring)
+{
+   if (ring->completed == ring->released)
+   {
+      return;
+   }
+   ring->read_index = (ring->read_index + 1 == ring->block_count) ? 0 : ring->read_index + 1;
+   ring->released++;
+}
+
+//-----------------------------------------------------------------------------
+// si32_saradc_ring_get_block_count
+//
+//-----------------------------------------------------------------------------
+uint32_t
+si32_saradc_ring_get_block_count(
+   si32_saradc_ring_t * ring)
+{
+   return ring->completed - ring->released;
+}
+
+//-----------------------------------------------------------------------------
+// si32_saradc_ring_get_overruns
+//
+//-----------------------------------------------------------------------------
+uint32_t
+si32_saradc_ring_get_overruns(
+   si32_saradc_ring_t * ring)
+{
+   return ring->overruns;
+}
+
+//-eof--------------------------------------------------------------------------
@@ -0,0 +1,210 @@
+//------------------------------------------------------------------------------
+// Copyright 2025 (c) Silicon Laboratories Inc.
+//
+// SPDX-License-Identifier: Zlib
+//
+// This siHAL software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//------------------------------------------------------------------------------
+/// @file si32_saradc_ring.h
+///
+/// Block ring filled by a DMA channel in ping-pong mode.
+///
+/// The ring is split in blocks of equal size. The primary and alternate
+/// descriptors of the channel each target one block. When a descriptor
+/// completes, its block is handed to the application and the descriptor is
+/// rebuilt for the next free block while the other descriptor keeps the
+/// transfer going. When no block is free, the descriptor targets a single
+/// discard word instead and the data of that block is counted as lost.
+///
+/// This module only touches the descriptors in memory, so it can be driven
+/// by a simulated DMA controller.
+
+#ifndef __SI32_SARADC_RING_H__
+#define __SI32_SARADC_RING_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "SI32_DMADESC_A_Type.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Largest block handled by one descriptor, in words.
+#define SI32_SARADC_RING_MAX_BLOCK_SIZE  1024
+
+/// Descriptor slot target when no block was free.
+#define SI32_SARADC_RING_DISCARD  0xFFFFFFFF
+
+/// Called from the DMA interrupt each time a block is full.
+typedef void (*si32_saradc_ring_callback_t)(uint32_t * block,
+   uint32_t length,
+   void * context);
+
+typedef struct si32_saradc_ring
+{
+   // Peripheral data register read by the DMA channel.
+   volatile uint32_t * source;
+   // Blocks, block_count * block_size words.
+   uint32_t * buffer;
+   uint32_t block_size;
+   uint32_t block_count;
+   // Block targeted by the primary (0) and alternate (1) descriptors.
+   uint32_t slot_block[2];
+   // Descriptor slot expected to complete next.
+   uint32_t active_slot;
+   // Blocks targeted by a descriptor.
+   uint32_t assigned;
+   // Next block given to a descriptor.
+   uint32_t write_index;
+   // Oldest block held by the application.
+   uint32_t read_index;
+   // Full blocks and released blocks since start, the difference is the
+   // number of blocks held by the application.
+   volatile uint32_t completed;
+   volatile uint32_t released;
+   // Blocks lost because the application held all of them.
+   volatile uint32_t overruns;
+   // Target of the discarding descriptor.
+   uint32_t discard;
+   si32_saradc_ring_callback_t callback;
+   void * context;
+} si32_saradc_ring_t;
+
+/// @fn si32_saradc_ring_initialize(si32_saradc_ring_t* ring,
+///      volatile uint32_t* source,
+///      uint32_t* buffer,
+///      uint32_t block_size,
+///      uint32_t block_count)
+///
+/// @param[in]
+///  ring
+///
+/// @param[in]
+///  source
+///  Peripheral data register read by the DMA channel.
+///
+/// @param[in]
+///  buffer
+///  block_count * block_size words.
+///
+/// @param[in]
+///  block_size
+///  Words per block, 1 to SI32_SARADC_RING_MAX_BLOCK_SIZE.
+///
+/// @param[in]
+///  block_count
+///  Number of blocks, at least 2.
+///
+void
+si32_saradc_ring_initialize(si32_saradc_ring_t* ring,
+   volatile uint32_t* source,
+   uint32_t* buffer,
+   uint32_t block_size,
+   uint32_t block_count);
+
+/// @fn si32_saradc_ring_set_callback(si32_saradc_ring_t* ring,
+///      si32_saradc_ring_callback_t callback,
+///      void* context)
+///
+/// @param[in]
+///  callback
+///  Called from the DMA interrupt for each full block, or NULL. The block
+///  is still held by the application until it is released.
+///
+void
+si32_saradc_ring_set_callback(si32_saradc_ring_t* ring,
+   si32_saradc_ring_callback_t callback,
+   void* context);
+
+/// @fn si32_saradc_ring_start(si32_saradc_ring_t* ring,
+///      SI32_DMADESC_A_Type* primary,
+///      SI32_DMADESC_A_Type* alternate)
+///
+/// Drops all blocks and builds the ping-pong descriptors for the first two
+/// blocks. The channel must be started with the primary descriptor.
+///
+void
+si32_saradc_ring_start(si32_saradc_ring_t* ring,
+   SI32_DMADESC_A_Type* primary,
+   SI32_DMADESC_A_Type* alternate);
+
+/// @fn si32_saradc_ring_dma_done(si32_saradc_ring_t* ring,
+///      SI32_DMADESC_A_Type* primary,
+///      SI32_DMADESC_A_Type* alternate)
+///
+/// Hands the blocks of the completed descriptors to the application and
+/// rebuilds these descriptors. Call from the DMA channel interrupt.
+///
+/// @return
+///  True if both descriptors had completed, in which case the channel has
+///  stopped and must be restarted with the descriptor selected by
+///  si32_saradc_ring_is_primary_next().
+///
+bool
+si32_saradc_ring_dma_done(si32_saradc_ring_t* ring,
+   SI32_DMADESC_A_Type* primary,
+   SI32_DMADESC_A_Type* alternate);
+
+/// @fn si32_saradc_ring_is_primary_next(si32_saradc_ring_t* ring)
+///
+/// @return
+///  True if the primary descriptor is the next one to complete.
+///
+bool
+si32_saradc_ring_is_primary_next(si32_saradc_ring_t* ring);
+
+/// @fn si32_saradc_ring_get_block(si32_saradc_ring_t* ring)
+///
+/// @return
+///  Oldest full block held by the application, or NULL.
+///
+uint32_t*
+si32_saradc_ring_get_block(si32_saradc_ring_t* ring);
+
+/// @fn si32_saradc_ring_release_block(si32_saradc_ring_t* ring)
+///
+/// Gives the block returned by si32_saradc_ring_get_block() back to the
+/// DMA channel.
+///
+void
+si32_saradc_ring_release_block(si32_saradc_ring_t* ring);
+
+/// @fn si32_saradc_ring_get_block_count(si32_saradc_ring_t* ring)
+///
+/// @return
+///  Number of full blocks held by the application.
+///
+uint32_t
+si32_saradc_ring_get_block_count(si32_saradc_ring_t* ring);
+
+/// @fn si32_saradc_ring_get_overruns(si32_saradc_ring_t* ring)
+///
+/// @return
+///  Number of blocks lost since the ring was started.
+///
+uint32_t
+si32_saradc_ring_get_overruns(si32_saradc_ring_t* ring);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __SI32_SARADC_RING_H__
+
+//-eof--------------------------------------------------------------------------
@@ -0,0 +1,196 @@
+//------------------------------------------------------------------------------
+// Copyright 2025 (c) Silicon Laboratories Inc.
+//
+// SPDX-License-Identifier: Zlib
+//
+// This siHAL software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//------------------------------------------------------------------------------
+/// @file si32_saradc_stream.c
+
+#include <assert.h>
+#include "si32_saradc_stream.h"
+
+// Time slot fields, 8 bits per time slot in SQ3210 and SQ7654.
+#define STREAM_TIMESLOT(channel) \
+   (((channel) << SI32_SARADC_A_SQ3210_TS0MUX_SHIFT) | SI32_SARADC_A_SQ3210_TS0CHR_CC0_U32)
+#define STREAM_TIMESLOT_SHIFT(timeslot)  (((timeslot) & 3) * 8)
+
+//-----------------------------------------------------------------------------
+// stream_primary
+//
+//-----------------------------------------------------------------------------
+static SI32_DMADESC_A_Type *
+stream_primary(
+   si32_saradc_stream_t * stream)
+{
+   return (SI32_DMADESC_A_Type *)SI32_DMACTRL_A_read_baseptr(stream->dmactrl)
+      + stream->dma_channel;
+}
+
+//-----------------------------------------------------------------------------
+// stream_alternate
+//
+//-----------------------------------------------------------------------------
+static SI32_DMADESC_A_Type *
+stream_alternate(
+   si32_saradc_stream_t * stream)
+{
+   return (SI32_DMADESC_A_Type *)SI32_DMACTRL_A_read_abaseptr(stream->dmactrl)
+      + stream->dma_channel;
+}
+
+//-----------------------------------------------------------------------------
+// stream_arm
+//
+// Enables the DMA channel on the descriptor expected to complete next.
+//-----------------------------------------------------------------------------
+static void
+stream_arm(
+   si32_saradc_stream_t * stream)
+{
+   if (si32_saradc_ring_is_primary_next(&stream->ring))
+   {
+      SI32_DMACTRL_A_select_primary_data_structure(stream->dmactrl, stream->dma_channel);
+   }
+   else
+   {
+      SI32_DMACTRL_A_select_alternate_data_structure(stream->dmactrl, stream->dma_channel);
+   }
+   SI32_DMACTRL_A_enable_channel(stream->dmactrl, stream->dma_channel);
+}
+
+//-----------------------------------------------------------------------------
+// si32_saradc_stream_initialize
+//
+//-----------------------------------------------------------------------------
+void
+si32_saradc_stream_initialize(
+   si32_saradc_stream_t * stream,
+   SI32_SARADC_A_Type * saradc,
+   SI32_DMACTRL_A_Type * dmactrl,
+   uint32_t dma_channel,
+   const si32_saradc_stream_config_t * config,
+   uint32_t * buffer,
+   uint32_t block_size,
+   uint32_t block_count)
+{
+   uint32_t sq[2] = { 0, 0 };
+   uint32_t timeslot;
+   uint32_t char10;
+
+   assert(dma_channel < 16);
+   assert((config->channel_count >= 1)
+      && (config->channel_count <= SI32_SARADC_STREAM_MAX_CHANNELS));
+   assert(config->left_shift <= 7);
+   assert(config->start_source <= 15);
+   assert(config->clock_divider <= 2047);
+
+   stream->saradc = saradc;
+   stream->dmactrl = dmactrl;
+   stream->dma_channel = dma_channel;
+   stream->restarts = 0;
+   si32_saradc_ring_initialize(&stream->ring, &saradc->DATA.U32, buffer,
+      block_size, block_count);
+
+   // One time slot per channel, all with characteristic 0. The first unused
+   // time slot ends the scan.
+   for (timeslot = 0; timeslot < SI32_SARADC_STREAM_MAX_CHANNELS; timeslot++)
+   {
+      uint32_t channel = SI32_SARADC_STREAM_END_OF_SCAN;
+
+      if (timeslot < config->channel_count)
+      {
+         assert(config->channels[timeslot] < SI32_SARADC_STREAM_END_OF_SCAN);
+         channel = config->channels[timeslot];
+      }
+      sq[timeslot / 4] |= STREAM_TIMESLOT(channel) << STREAM_TIMESLOT_SHIFT(timeslot);
+   }
+
+   char10 = SI32_SARADC_A_CHAR10_CHR0GN_UNITY_U32
+      | ((uint32_t)config->repeat_count << SI32_SARADC_A_CHAR10_CHR0RPT_SHIFT)
+      | (config->left_shift << SI32_SARADC_A_CHAR10_CHR0LS_SHIFT)
+      | (config->resolution_12bit ? SI32_SARADC_A_CHAR10_CHR0RSEL_B12_U32
+                                  : SI32_SARADC_A_CHAR10_CHR0RSEL_B10_U32);
+
+   SI32_SARADC_A_disable_module(saradc);
+   SI32_SARADC_A_initialize_channels(saradc, char10, 0, sq[0], sq[1]);
+   SI32_SARADC_A_write_config(saradc,
+      SI32_SARADC_A_CONFIG_SCANEN_ENABLED_U32
+      | SI32_SARADC_A_CONFIG_SCANMD_LOOP_U32
+      | SI32_SARADC_A_CONFIG_DMAEN_ENABLED_U32
+      | SI32_SARADC_A_CONFIG_BCLKSEL_APB_U32
+      | (config->clock_divider << SI32_SARADC_A_CONFIG_CLKDIV_SHIFT));
+   SI32_SARADC_A_write_control(saradc,
+      (config->control
+         & ~(SI32_SARADC_A_CONTROL_SCSEL_MASK | SI32_SARADC_A_CONTROL_BURSTEN_MASK
+            | SI32_SARADC_A_CONTROL_ADCEN_MASK | SI32_SARADC_A_CONTROL_ACCMD_MASK))
+      | (config->start_source << SI32_SARADC_A_CONTROL_SCSEL_SHIFT)
+      | SI32_SARADC_A_CONTROL_BURSTEN_ENABLED_U32
+      | SI32_SARADC_A_CONTROL_ACCMD_ACCUMULATE_U32);
+}
+
+//-----------------------------------------------------------------------------
+// si32_saradc_stream_start
+//
+//-----------------------------------------------------------------------------
+void
+si32_saradc_stream_start(
+   si32_saradc_stream_t * stream)
+{
+   SI32_DMACTRL_A_disable_channel(stream->dmactrl, stream->dma_channel);
+   si32_saradc_ring_start(&stream->ring, stream_primary(stream), stream_alternate(stream));
+   stream->restarts = 0;
+
+   SI32_DMACTRL_A_select_channel_high_priority(stream->dmactrl, stream->dma_channel);
+   SI32_DMACTRL_A_enable_data_request(stream->dmactrl, stream->dma_channel);
+   stream_arm(stream);
+
+   SI32_SARADC_A_clear_accumulator(stream->saradc);
+   SI32_SARADC_A_clear_all_interrupts(stream->saradc);
+   SI32_SARADC_A_enable_module(stream->saradc);
+}
+
+//-----------------------------------------------------------------------------
+// si32_saradc_stream_stop
+//
+//-----------------------------------------------------------------------------
+void
+si32_saradc_stream_stop(
+   si32_saradc_stream_t * stream)
+{
+   SI32_SARADC_A_disable_module(stream->saradc);
+   SI32_DMACTRL_A_disable_channel(stream->dmactrl, stream->dma_channel);
+}
+
+//-----------------------------------------------------------------------------
+// si32_saradc_stream_dma_handler
+//
+//-----------------------------------------------------------------------------
+void
+si32_saradc_stream_dma_handler(
+   si32_saradc_stream_t * stream)
+{
+   if (si32_saradc_ring_dma_done(&stream->ring, stream_primary(stream), stream_alternate(stream)))
+   {
+      // The controller stopped on a completed descriptor before it was
+      // rebuilt, the conversions made meanwhile wait in the SARADC FIFO.
+      stream->restarts++;
+      stream_arm(stream);
+   }
+}
+
+//-eof--------------------------------------------------------------------------
@@ -0,0 +1,153 @@
+//------------------------------------------------------------------------------
+// Copyright 2025 (c) Silicon Laboratories Inc.
+//
+// SPDX-License-Identifier: Zlib
+//
+// This siHAL software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//------------------------------------------------------------------------------
+/// @file si32_saradc_stream.h
+///
+/// SARADC streaming through a DMA channel.
+///
+/// The channel sequencer converts the configured input channels in turn, in
+/// loop scan mode. Each time slot is a burst of conversions summed by the
+/// accumulator, so one data word is produced per channel and per burst. The
+/// words are moved by a DMA channel in ping-pong mode into the blocks of a
+/// si32_saradc_ring_t, and full blocks are handed to the application without
+/// any per-conversion interrupt.
+///
+/// The DMA controller must be enabled with its descriptor base pointer set,
+/// and the DMA channel must be routed to the SARADC by the DMA crossbar
+/// (for example SI32_DMAXBAR_CHAN2_SARADC0 on SiM3U1xx) before the stream is
+/// started. The DMA channel interrupt handler must call
+/// si32_saradc_stream_dma_handler().
+
+#ifndef __SI32_SARADC_STREAM_H__
+#define __SI32_SARADC_STREAM_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "SI32_DMACTRL_A_Type.h"
+#include "SI32_SARADC_A_Type.h"
+#include "si32_saradc_ring.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Number of sequencer time slots.
+#define SI32_SARADC_STREAM_MAX_CHANNELS  8
+
+/// Time slot input channel ending the scan.
+#define SI32_SARADC_STREAM_END_OF_SCAN   31
+
+typedef struct si32_saradc_stream_config
+{
+   // Input channels converted in turn, one per time slot.
+   uint8_t channels[SI32_SARADC_STREAM_MAX_CHANNELS];
+   uint32_t channel_count;
+   // Conversions accumulated into each data word.
+   SI32_SARADC_A_BURST_MODE_REPEAT_COUNT_Enum_Type repeat_count;
+   // Left shift applied to each data word (0 to 7).
+   uint32_t left_shift;
+   // 12-bit conversions instead of 10-bit ones.
+   bool resolution_12bit;
+   // Start-of-conversion source, one burst per trigger (0 to 15).
+   uint32_t start_source;
+   // SAR clock divider (0 to 2047).
+   uint32_t clock_divider;
+   // Other CONTROL register bits, such as the voltage reference and the
+   // burst mode tracking and power up times.
+   uint32_t control;
+} si32_saradc_stream_config_t;
+
+typedef struct si32_saradc_stream
+{
+   SI32_SARADC_A_Type * saradc;
+   SI32_DMACTRL_A_Type * dmactrl;
+   uint32_t dma_channel;
+   // Full blocks, see si32_saradc_ring_get_block().
+   si32_saradc_ring_t ring;
+   // DMA channel restarts after both descriptors completed.
+   uint32_t restarts;
+} si32_saradc_stream_t;
+
+/// @fn si32_saradc_stream_initialize(si32_saradc_stream_t* stream,
+///      SI32_SARADC_A_Type* saradc,
+///      SI32_DMACTRL_A_Type* dmactrl,
+///      uint32_t dma_channel,
+///      const si32_saradc_stream_config_t* config,
+///      uint32_t* buffer,
+///      uint32_t block_size,
+///      uint32_t block_count)
+///
+/// Configures the SARADC sequencer, accumulator and DMA interface. The
+/// SARADC stays disabled until the stream is started.
+///
+/// @param[in]
+///  dma_channel
+///  DMA channel routed to the SARADC.
+///
+/// @param[in]
+///  buffer
+///  block_count * block_size words.
+///
+/// @param[in]
+///  block_size
+///  Words per block. A multiple of the channel count keeps the first word
+///  of every block on the first channel.
+///
+void
+si32_saradc_stream_initialize(si32_saradc_stream_t* stream,
+   SI32_SARADC_A_Type* saradc,
+   SI32_DMACTRL_A_Type* dmactrl,
+   uint32_t dma_channel,
+   const si32_saradc_stream_config_t* config,
+   uint32_t* buffer,
+   uint32_t block_size,
+   uint32_t block_count);
+
+/// @fn si32_saradc_stream_start(si32_saradc_stream_t* stream)
+///
+/// Drops all blocks, arms the DMA channel and enables the SARADC.
+///
+void
+si32_saradc_stream_start(si32_saradc_stream_t* stream);
+
+/// @fn si32_saradc_stream_stop(si32_saradc_stream_t* stream)
+///
+/// Disables the SARADC and the DMA channel. Full blocks stay available.
+///
+void
+si32_saradc_stream_stop(si32_saradc_stream_t* stream);
+
+/// @fn si32_saradc_stream_dma_handler(si32_saradc_stream_t* stream)
+///
+/// Hands the full blocks to the ring and rearms the DMA channel. Call from
+/// the DMA channel interrupt handler.
+///
+void
+si32_saradc_stream_dma_handler(si32_saradc_stream_t* stream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __SI32_SARADC_STREAM_H__
+
+//-eof--------------------------------------------------------------------------
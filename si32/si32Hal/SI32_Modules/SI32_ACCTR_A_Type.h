@@ -98,6 +98,35 @@ extern "C" {
 ///  comp1
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_initialize_module(
+   SI32_ACCTR_A_Type * basePointer,
+   uint32_t config,
+   uint32_t control,
+   uint32_t lcconfig,
+   uint32_t lctiming,
+   uint32_t lcmode,
+   uint32_t lcclkcontrol,
+   uint32_t lccount,
+   uint32_t dbconfig,
+   uint32_t comp0,
+   uint32_t comp1)
+{
+   //{{
+   basePointer->CONFIG.U32=config;
+   basePointer->CONTROL.U32=control;
+   basePointer->LCCONFIG.U32=lcconfig;
+   basePointer->TIMING.U32=lctiming;
+   basePointer->LCMODE.U32=lcmode;
+   basePointer->LCCLKCONTROL.U32=lcclkcontrol;
+   basePointer->LCCOUNT.U32=lccount;
+   basePointer->DBCONFIG.U32=dbconfig;
+   basePointer->COMP0.U32=comp0;
+   basePointer->COMP1.U32=comp1;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_initialize_module(SI32_ACCTR_A_Type* /*basePointer*/,
    uint32_t, /*config*/
@@ -110,6 +139,7 @@ _SI32_ACCTR_A_initialize_module(SI32_ACCTR_A_Type* /*basePointer*/,
    uint32_t, /*dbconfig*/
    uint32_t, /*comp0*/
    uint32_t /*comp1*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_initialize_module(basePointer, config, control, lcconfig, lctiming, lcmode, lcclkcontrol, lccount, dbconfig, comp0, comp1)
 #define SI32_ACCTR_A_initialize_module(basePointer, config, control, lcconfig, lctiming, lcmode, lcclkcontrol, lccount, dbconfig, comp0, comp1) do{  \
@@ -141,9 +171,21 @@ _SI32_ACCTR_A_initialize_module(SI32_ACCTR_A_Type* /*basePointer*/,
 ///  config
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_write_config(
+   SI32_ACCTR_A_Type * basePointer,
+   uint32_t config)
+{
+   //{{
+   basePointer->CONFIG.U32 = config;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_write_config(SI32_ACCTR_A_Type* /*basePointer*/,
    uint32_t /*config*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_write_config(basePointer, config)
 #define SI32_ACCTR_A_write_config(basePointer, config) \
@@ -158,8 +200,19 @@ _SI32_ACCTR_A_write_config(SI32_ACCTR_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_ACCTR_A_read_config(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONFIG.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_ACCTR_A_read_config(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_read_config(basePointer)
 #define SI32_ACCTR_A_read_config(basePointer) \
@@ -171,8 +224,19 @@ _SI32_ACCTR_A_read_config(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_reset_module(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG.U32 = (basePointer->CONFIG.U32);
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_reset_module(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_reset_module(basePointer)
 #define SI32_ACCTR_A_reset_module(basePointer) \
@@ -184,8 +248,19 @@ _SI32_ACCTR_A_reset_module(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_disable_module(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG.PCMD = SI32_ACCTR_A_CONFIG_PCMD_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_disable_module(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_disable_module(basePointer)
 #define SI32_ACCTR_A_disable_module(basePointer) \
@@ -197,8 +272,19 @@ _SI32_ACCTR_A_disable_module(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_ACCTR_A_is_write_in_progress(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONFIG.UPDSTSF;
+   //}}
+}
+#else
 bool
 _SI32_ACCTR_A_is_write_in_progress(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_is_write_in_progress(basePointer)
 #define SI32_ACCTR_A_is_write_in_progress(basePointer) \
@@ -210,8 +296,19 @@ _SI32_ACCTR_A_is_write_in_progress(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_no_debug_outputs(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG.DBGSEL = SI32_ACCTR_A_CONFIG_DBGSEL_NONE_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_no_debug_outputs(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_no_debug_outputs(basePointer)
 #define SI32_ACCTR_A_select_no_debug_outputs(basePointer) \
@@ -223,8 +320,19 @@ _SI32_ACCTR_A_select_no_debug_outputs(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_mode_cmp0_and_cmp1_debug_outputs(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG.DBGSEL = SI32_ACCTR_A_CONFIG_DBGSEL_LCC0_LCC1_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_mode_cmp0_and_cmp1_debug_outputs(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_mode_cmp0_and_cmp1_debug_outputs(basePointer)
 #define SI32_ACCTR_A_select_lc_mode_cmp0_and_cmp1_debug_outputs(basePointer) \
@@ -236,8 +344,19 @@ _SI32_ACCTR_A_select_lc_mode_cmp0_and_cmp1_debug_outputs(SI32_ACCTR_A_Type* /*ba
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_mode_cmp0_and_integ0_debug_outputs(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG.DBGSEL = SI32_ACCTR_A_CONFIG_DBGSEL_LCC0_INT0_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_mode_cmp0_and_integ0_debug_outputs(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_mode_cmp0_and_integ0_debug_outputs(basePointer)
 #define SI32_ACCTR_A_select_lc_mode_cmp0_and_integ0_debug_outputs(basePointer) \
@@ -249,8 +368,19 @@ _SI32_ACCTR_A_select_lc_mode_cmp0_and_integ0_debug_outputs(SI32_ACCTR_A_Type* /*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_mode_cmp1_and_integ1_debug_outputs(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG.DBGSEL = SI32_ACCTR_A_CONFIG_DBGSEL_LCC1_INT1_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_mode_cmp1_and_integ1_debug_outputs(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_mode_cmp1_and_integ1_debug_outputs(basePointer)
 #define SI32_ACCTR_A_select_lc_mode_cmp1_and_integ1_debug_outputs(basePointer) \
@@ -262,8 +392,19 @@ _SI32_ACCTR_A_select_lc_mode_cmp1_and_integ1_debug_outputs(SI32_ACCTR_A_Type* /*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_integ0_and_integ1_debug_outputs(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG.DBGSEL = SI32_ACCTR_A_CONFIG_DBGSEL_INT0_INT1_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_integ0_and_integ1_debug_outputs(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_integ0_and_integ1_debug_outputs(basePointer)
 #define SI32_ACCTR_A_select_integ0_and_integ1_debug_outputs(basePointer) \
@@ -275,8 +416,19 @@ _SI32_ACCTR_A_select_integ0_and_integ1_debug_outputs(SI32_ACCTR_A_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_switch_mode_cmp0_and_cmp1_debug_outputs(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG.DBGSEL = SI32_ACCTR_A_CONFIG_DBGSEL_CMP0_CMP1_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_switch_mode_cmp0_and_cmp1_debug_outputs(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_switch_mode_cmp0_and_cmp1_debug_outputs(basePointer)
 #define SI32_ACCTR_A_select_switch_mode_cmp0_and_cmp1_debug_outputs(basePointer) \
@@ -288,8 +440,19 @@ _SI32_ACCTR_A_select_switch_mode_cmp0_and_cmp1_debug_outputs(SI32_ACCTR_A_Type*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_switch_mode_cmp0_and_integ0_debug_outputs(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG.DBGSEL = SI32_ACCTR_A_CONFIG_DBGSEL_CMP0_INT0_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_switch_mode_cmp0_and_integ0_debug_outputs(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_switch_mode_cmp0_and_integ0_debug_outputs(basePointer)
 #define SI32_ACCTR_A_select_switch_mode_cmp0_and_integ0_debug_outputs(basePointer) \
@@ -301,8 +464,19 @@ _SI32_ACCTR_A_select_switch_mode_cmp0_and_integ0_debug_outputs(SI32_ACCTR_A_Type
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_switch_mode_cmp1_and_integ1_debug_outputs(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG.DBGSEL = SI32_ACCTR_A_CONFIG_DBGSEL_CMP1_INT1_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_switch_mode_cmp1_and_integ1_debug_outputs(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_switch_mode_cmp1_and_integ1_debug_outputs(basePointer)
 #define SI32_ACCTR_A_select_switch_mode_cmp1_and_integ1_debug_outputs(basePointer) \
@@ -314,8 +488,19 @@ _SI32_ACCTR_A_select_switch_mode_cmp1_and_integ1_debug_outputs(SI32_ACCTR_A_Type
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_enable_switch_from_quadrature_to_dual_on_flutter(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG.FLQDEN = SI32_ACCTR_A_CONFIG_FLQDEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_enable_switch_from_quadrature_to_dual_on_flutter(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_enable_switch_from_quadrature_to_dual_on_flutter(basePointer)
 #define SI32_ACCTR_A_enable_switch_from_quadrature_to_dual_on_flutter(basePointer) \
@@ -327,8 +512,19 @@ _SI32_ACCTR_A_enable_switch_from_quadrature_to_dual_on_flutter(SI32_ACCTR_A_Type
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_disable_switch_from_quadrature_to_dual_on_flutter(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG.FLQDEN = SI32_ACCTR_A_CONFIG_FLQDEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_disable_switch_from_quadrature_to_dual_on_flutter(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_disable_switch_from_quadrature_to_dual_on_flutter(basePointer)
 #define SI32_ACCTR_A_disable_switch_from_quadrature_to_dual_on_flutter(basePointer) \
@@ -340,8 +536,19 @@ _SI32_ACCTR_A_disable_switch_from_quadrature_to_dual_on_flutter(SI32_ACCTR_A_Typ
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_enable_stop_count_on_flutter(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG.FLSTPEN = SI32_ACCTR_A_CONFIG_FLSTPEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_enable_stop_count_on_flutter(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_enable_stop_count_on_flutter(basePointer)
 #define SI32_ACCTR_A_enable_stop_count_on_flutter(basePointer) \
@@ -353,8 +560,19 @@ _SI32_ACCTR_A_enable_stop_count_on_flutter(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_disable_stop_count_on_flutter(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG.FLSTPEN = SI32_ACCTR_A_CONFIG_FLSTPEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_disable_stop_count_on_flutter(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_disable_stop_count_on_flutter(basePointer)
 #define SI32_ACCTR_A_disable_stop_count_on_flutter(basePointer) \
@@ -366,8 +584,19 @@ _SI32_ACCTR_A_disable_stop_count_on_flutter(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_reed_switch_mode(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG.TOPMD = SI32_ACCTR_A_CONFIG_TOPMD_SWITCH_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_reed_switch_mode(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_reed_switch_mode(basePointer)
 #define SI32_ACCTR_A_select_reed_switch_mode(basePointer) \
@@ -379,8 +608,19 @@ _SI32_ACCTR_A_select_reed_switch_mode(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_mode(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG.TOPMD = SI32_ACCTR_A_CONFIG_TOPMD_LC_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_mode(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_mode(basePointer)
 #define SI32_ACCTR_A_select_lc_mode(basePointer) \
@@ -392,8 +632,19 @@ _SI32_ACCTR_A_select_lc_mode(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_single_channel_mode(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG.PCMD = SI32_ACCTR_A_CONFIG_PCMD_SINGLE_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_single_channel_mode(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_single_channel_mode(basePointer)
 #define SI32_ACCTR_A_select_single_channel_mode(basePointer) \
@@ -405,8 +656,19 @@ _SI32_ACCTR_A_select_single_channel_mode(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_dual_mode(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG.PCMD = SI32_ACCTR_A_CONFIG_PCMD_DUAL_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_dual_mode(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_dual_mode(basePointer)
 #define SI32_ACCTR_A_select_dual_mode(basePointer) \
@@ -418,8 +680,19 @@ _SI32_ACCTR_A_select_dual_mode(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_quadrature_mode(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG.PCMD = SI32_ACCTR_A_CONFIG_PCMD_QUADRATURE_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_quadrature_mode(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_quadrature_mode(basePointer)
 #define SI32_ACCTR_A_select_quadrature_mode(basePointer) \
@@ -439,9 +712,21 @@ _SI32_ACCTR_A_select_quadrature_mode(SI32_ACCTR_A_Type* /*basePointer*/);
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_write_control(
+   SI32_ACCTR_A_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_write_control(SI32_ACCTR_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_write_control(basePointer, control)
 #define SI32_ACCTR_A_write_control(basePointer, control) \
@@ -456,8 +741,19 @@ _SI32_ACCTR_A_write_control(SI32_ACCTR_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_ACCTR_A_read_control(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_ACCTR_A_read_control(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_read_control(basePointer)
 #define SI32_ACCTR_A_read_control(basePointer) \
@@ -469,8 +765,20 @@ _SI32_ACCTR_A_read_control(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_analog_comparator_low_threshold_32_percent(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.CMPLTH =
+      SI32_ACCTR_A_CONTROL_CMPLTH_32_PERCENT_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_analog_comparator_low_threshold_32_percent(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_analog_comparator_low_threshold_32_percent(basePointer)
 #define SI32_ACCTR_A_select_analog_comparator_low_threshold_32_percent(basePointer) do{  \
@@ -484,8 +792,20 @@ _SI32_ACCTR_A_select_analog_comparator_low_threshold_32_percent(SI32_ACCTR_A_Typ
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_analog_comparator_low_threshold_36_percent(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.CMPLTH =
+      SI32_ACCTR_A_CONTROL_CMPLTH_36_PERCENT_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_analog_comparator_low_threshold_36_percent(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_analog_comparator_low_threshold_36_percent(basePointer)
 #define SI32_ACCTR_A_select_analog_comparator_low_threshold_36_percent(basePointer) do{  \
@@ -499,8 +819,20 @@ _SI32_ACCTR_A_select_analog_comparator_low_threshold_36_percent(SI32_ACCTR_A_Typ
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_analog_comparator_low_threshold_40_percent(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.CMPLTH =
+      SI32_ACCTR_A_CONTROL_CMPLTH_40_PERCENT_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_analog_comparator_low_threshold_40_percent(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_analog_comparator_low_threshold_40_percent(basePointer)
 #define SI32_ACCTR_A_select_analog_comparator_low_threshold_40_percent(basePointer) do{  \
@@ -514,8 +846,20 @@ _SI32_ACCTR_A_select_analog_comparator_low_threshold_40_percent(SI32_ACCTR_A_Typ
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_analog_comparator_low_threshold_44_percent(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.CMPLTH =
+      SI32_ACCTR_A_CONTROL_CMPLTH_44_PERCENT_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_analog_comparator_low_threshold_44_percent(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_analog_comparator_low_threshold_44_percent(basePointer)
 #define SI32_ACCTR_A_select_analog_comparator_low_threshold_44_percent(basePointer) do{  \
@@ -529,8 +873,20 @@ _SI32_ACCTR_A_select_analog_comparator_low_threshold_44_percent(SI32_ACCTR_A_Typ
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_analog_comparator_high_threshold_48_percent(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.CMPHTH =
+      SI32_ACCTR_A_CONTROL_CMPHTH_48_PERCENT_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_analog_comparator_high_threshold_48_percent(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_analog_comparator_high_threshold_48_percent(basePointer)
 #define SI32_ACCTR_A_select_analog_comparator_high_threshold_48_percent(basePointer) do{  \
@@ -544,8 +900,20 @@ _SI32_ACCTR_A_select_analog_comparator_high_threshold_48_percent(SI32_ACCTR_A_Ty
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_analog_comparator_high_threshold_52_percent(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.CMPHTH =
+      SI32_ACCTR_A_CONTROL_CMPHTH_52_PERCENT_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_analog_comparator_high_threshold_52_percent(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_analog_comparator_high_threshold_52_percent(basePointer)
 #define SI32_ACCTR_A_select_analog_comparator_high_threshold_52_percent(basePointer) do{  \
@@ -559,8 +927,20 @@ _SI32_ACCTR_A_select_analog_comparator_high_threshold_52_percent(SI32_ACCTR_A_Ty
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_analog_comparator_high_threshold_56_percent(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.CMPHTH =
+      SI32_ACCTR_A_CONTROL_CMPHTH_56_PERCENT_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_analog_comparator_high_threshold_56_percent(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_analog_comparator_high_threshold_56_percent(basePointer)
 #define SI32_ACCTR_A_select_analog_comparator_high_threshold_56_percent(basePointer) do{  \
@@ -574,8 +954,20 @@ _SI32_ACCTR_A_select_analog_comparator_high_threshold_56_percent(SI32_ACCTR_A_Ty
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_analog_comparator_high_threshold_60_percent(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.CMPHTH =
+      SI32_ACCTR_A_CONTROL_CMPHTH_60_PERCENT_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_analog_comparator_high_threshold_60_percent(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_analog_comparator_high_threshold_60_percent(basePointer)
 #define SI32_ACCTR_A_select_analog_comparator_high_threshold_60_percent(basePointer) do{  \
@@ -589,8 +981,19 @@ _SI32_ACCTR_A_select_analog_comparator_high_threshold_60_percent(SI32_ACCTR_A_Ty
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_calibrate_until_pass(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.CALMD = SI32_ACCTR_A_CONTROL_CALMD_UNTIL_PASS_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_calibrate_until_pass(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_calibrate_until_pass(basePointer)
 #define SI32_ACCTR_A_select_calibrate_until_pass(basePointer) \
@@ -602,8 +1005,19 @@ _SI32_ACCTR_A_select_calibrate_until_pass(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_calibrate_until_fail(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.CALMD = SI32_ACCTR_A_CONTROL_CALMD_UNTIL_FAIL_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_calibrate_until_fail(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_calibrate_until_fail(basePointer)
 #define SI32_ACCTR_A_select_calibrate_until_fail(basePointer) \
@@ -615,8 +1029,19 @@ _SI32_ACCTR_A_select_calibrate_until_fail(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_full_pull_up_mode(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.CALPUMD = SI32_ACCTR_A_CONTROL_CALPUMD_FULL_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_full_pull_up_mode(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_full_pull_up_mode(basePointer)
 #define SI32_ACCTR_A_select_full_pull_up_mode(basePointer) \
@@ -628,8 +1053,19 @@ _SI32_ACCTR_A_select_full_pull_up_mode(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_small_pull_up_mode(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.CALPUMD = SI32_ACCTR_A_CONTROL_CALPUMD_SMALL_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_small_pull_up_mode(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_small_pull_up_mode(basePointer)
 #define SI32_ACCTR_A_select_small_pull_up_mode(basePointer) \
@@ -641,8 +1077,19 @@ _SI32_ACCTR_A_select_small_pull_up_mode(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_medium_pull_up_mode(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.CALPUMD = SI32_ACCTR_A_CONTROL_CALPUMD_MEDIUM_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_medium_pull_up_mode(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_medium_pull_up_mode(basePointer)
 #define SI32_ACCTR_A_select_medium_pull_up_mode(basePointer) \
@@ -654,8 +1101,19 @@ _SI32_ACCTR_A_select_medium_pull_up_mode(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_large_pull_up_mode(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.CALPUMD = SI32_ACCTR_A_CONTROL_CALPUMD_LARGE_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_large_pull_up_mode(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_large_pull_up_mode(basePointer)
 #define SI32_ACCTR_A_select_large_pull_up_mode(basePointer) \
@@ -667,8 +1125,19 @@ _SI32_ACCTR_A_select_large_pull_up_mode(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_enable_force_continuous_pull_ups(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.FPUPEN = SI32_ACCTR_A_CONTROL_FPUPEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_enable_force_continuous_pull_ups(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_enable_force_continuous_pull_ups(basePointer)
 #define SI32_ACCTR_A_enable_force_continuous_pull_ups(basePointer) \
@@ -680,8 +1149,19 @@ _SI32_ACCTR_A_enable_force_continuous_pull_ups(SI32_ACCTR_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_disable_force_continuous_pull_ups(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.FPUPEN = SI32_ACCTR_A_CONTROL_FPUPEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_disable_force_continuous_pull_ups(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_disable_force_continuous_pull_ups(basePointer)
 #define SI32_ACCTR_A_disable_force_continuous_pull_ups(basePointer) \
@@ -693,8 +1173,19 @@ _SI32_ACCTR_A_disable_force_continuous_pull_ups(SI32_ACCTR_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_enable_force_input_to_ground(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.FPDNEN = SI32_ACCTR_A_CONTROL_FPDNEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_enable_force_input_to_ground(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_enable_force_input_to_ground(basePointer)
 #define SI32_ACCTR_A_enable_force_input_to_ground(basePointer) \
@@ -706,8 +1197,19 @@ _SI32_ACCTR_A_enable_force_input_to_ground(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_disable_force_input_to_ground(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.FPDNEN = SI32_ACCTR_A_CONTROL_FPDNEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_disable_force_input_to_ground(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_disable_force_input_to_ground(basePointer)
 #define SI32_ACCTR_A_disable_force_input_to_ground(basePointer) \
@@ -727,9 +1229,22 @@ _SI32_ACCTR_A_disable_force_input_to_ground(SI32_ACCTR_A_Type* /*basePointer*/);
 ///  puval
 ///  Valid range is 5 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_set_pull_up_value(
+   SI32_ACCTR_A_Type * basePointer,
+   uwide8_t puval)
+{
+   assert(puval < 32);   // puval < 2^5
+   //{{
+   basePointer->CONTROL.PUVAL = puval;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_set_pull_up_value(SI32_ACCTR_A_Type* /*basePointer*/,
    uwide8_t /*puval*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_set_pull_up_value(basePointer, puval)
 #define SI32_ACCTR_A_set_pull_up_value(basePointer, puval) \
@@ -744,8 +1259,19 @@ _SI32_ACCTR_A_set_pull_up_value(SI32_ACCTR_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide8_t
+_SI32_ACCTR_A_get_pull_up_value(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.PUVAL;
+   //}}
+}
+#else
 uwide8_t
 _SI32_ACCTR_A_get_pull_up_value(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_get_pull_up_value(basePointer)
 #define SI32_ACCTR_A_get_pull_up_value(basePointer) \
@@ -757,8 +1283,19 @@ _SI32_ACCTR_A_get_pull_up_value(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_calibrate_pc0(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.CALSEL = SI32_ACCTR_A_CONTROL_CALSEL_IN0_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_calibrate_pc0(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_calibrate_pc0(basePointer)
 #define SI32_ACCTR_A_select_calibrate_pc0(basePointer) \
@@ -770,8 +1307,19 @@ _SI32_ACCTR_A_select_calibrate_pc0(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_calibrate_pc1(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.CALSEL = SI32_ACCTR_A_CONTROL_CALSEL_IN1_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_calibrate_pc1(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_calibrate_pc1(basePointer)
 #define SI32_ACCTR_A_select_calibrate_pc1(basePointer) \
@@ -783,8 +1331,19 @@ _SI32_ACCTR_A_select_calibrate_pc1(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_ACCTR_A_was_calibration_successful(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.CALRF;
+   //}}
+}
+#else
 bool
 _SI32_ACCTR_A_was_calibration_successful(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_was_calibration_successful(basePointer)
 #define SI32_ACCTR_A_was_calibration_successful(basePointer) \
@@ -796,8 +1355,19 @@ _SI32_ACCTR_A_was_calibration_successful(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_start_calibration(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.CALBUSYF = SI32_ACCTR_A_CONTROL_CALBUSYF_SET_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_start_calibration(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_start_calibration(basePointer)
 #define SI32_ACCTR_A_start_calibration(basePointer) \
@@ -809,8 +1379,19 @@ _SI32_ACCTR_A_start_calibration(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_ACCTR_A_is_calibration_busy(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.CALBUSYF;
+   //}}
+}
+#else
 bool
 _SI32_ACCTR_A_is_calibration_busy(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_is_calibration_busy(basePointer)
 #define SI32_ACCTR_A_is_calibration_busy(basePointer) \
@@ -830,9 +1411,21 @@ _SI32_ACCTR_A_is_calibration_busy(SI32_ACCTR_A_Type* /*basePointer*/);
 ///  lcconfig
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_write_lcconfig(
+   SI32_ACCTR_A_Type * basePointer,
+   uint32_t lcconfig)
+{
+   //{{
+   basePointer->LCCONFIG.U32=lcconfig;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_write_lcconfig(SI32_ACCTR_A_Type* /*basePointer*/,
    uint32_t /*lcconfig*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_write_lcconfig(basePointer, lcconfig)
 #define SI32_ACCTR_A_write_lcconfig(basePointer, lcconfig) \
@@ -847,8 +1440,19 @@ _SI32_ACCTR_A_write_lcconfig(SI32_ACCTR_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_ACCTR_A_read_lcconfig(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->LCCONFIG.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_ACCTR_A_read_lcconfig(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_read_lcconfig(basePointer)
 #define SI32_ACCTR_A_read_lcconfig(basePointer) \
@@ -860,8 +1464,19 @@ _SI32_ACCTR_A_read_lcconfig(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_extend_low_pulses(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCCONFIG.PEMD = SI32_ACCTR_A_LCCONFIG_PEMD_LOW_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_extend_low_pulses(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_extend_low_pulses(basePointer)
 #define SI32_ACCTR_A_select_extend_low_pulses(basePointer) \
@@ -873,8 +1488,19 @@ _SI32_ACCTR_A_select_extend_low_pulses(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_extend_high_pulses(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCCONFIG.PEMD = SI32_ACCTR_A_LCCONFIG_PEMD_HIGH_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_extend_high_pulses(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_extend_high_pulses(basePointer)
 #define SI32_ACCTR_A_select_extend_high_pulses(basePointer) \
@@ -886,8 +1512,19 @@ _SI32_ACCTR_A_select_extend_high_pulses(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_no_pulse_extension(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCCONFIG.PEMD = SI32_ACCTR_A_LCCONFIG_PEMD_NONE_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_no_pulse_extension(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_no_pulse_extension(basePointer)
 #define SI32_ACCTR_A_select_no_pulse_extension(basePointer) \
@@ -899,8 +1536,19 @@ _SI32_ACCTR_A_select_no_pulse_extension(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_comparator_0_full_range(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCCONFIG.CMP0THR = SI32_ACCTR_A_LCCONFIG_CMP0THR_FULL_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_comparator_0_full_range(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_comparator_0_full_range(basePointer)
 #define SI32_ACCTR_A_select_comparator_0_full_range(basePointer) \
@@ -912,8 +1560,19 @@ _SI32_ACCTR_A_select_comparator_0_full_range(SI32_ACCTR_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_comparator_0_low_range(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCCONFIG.CMP0THR = SI32_ACCTR_A_LCCONFIG_CMP0THR_LOW_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_comparator_0_low_range(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_comparator_0_low_range(basePointer)
 #define SI32_ACCTR_A_select_comparator_0_low_range(basePointer) \
@@ -925,8 +1584,19 @@ _SI32_ACCTR_A_select_comparator_0_low_range(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_comparator_1_full_range(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCCONFIG.CMP1THR = SI32_ACCTR_A_LCCONFIG_CMP1THR_FULL_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_comparator_1_full_range(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_comparator_1_full_range(basePointer)
 #define SI32_ACCTR_A_select_comparator_1_full_range(basePointer) \
@@ -938,8 +1608,19 @@ _SI32_ACCTR_A_select_comparator_1_full_range(SI32_ACCTR_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_comparator_1_low_range(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCCONFIG.CMP1THR = SI32_ACCTR_A_LCCONFIG_CMP1THR_LOW_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_comparator_1_low_range(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_comparator_1_low_range(basePointer)
 #define SI32_ACCTR_A_select_comparator_1_low_range(basePointer) \
@@ -956,9 +1637,22 @@ _SI32_ACCTR_A_select_comparator_1_low_range(SI32_ACCTR_A_Type* /*basePointer*/);
 ///  threshold
 ///  Valid range is 0 to 63.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_set_lc_comparator_0_coarse_threshold(
+   SI32_ACCTR_A_Type * basePointer,
+   uwide8_t threshold)
+{
+   assert(threshold <= 63);
+   //{{
+   basePointer->LCCONFIG.CMP0CTH = threshold;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_set_lc_comparator_0_coarse_threshold(SI32_ACCTR_A_Type* /*basePointer*/,
    uwide8_t /*threshold*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_set_lc_comparator_0_coarse_threshold(basePointer, threshold)
 #define SI32_ACCTR_A_set_lc_comparator_0_coarse_threshold(basePointer, threshold) \
@@ -975,9 +1669,22 @@ _SI32_ACCTR_A_set_lc_comparator_0_coarse_threshold(SI32_ACCTR_A_Type* /*basePoin
 ///  threshold
 ///  Valid range is 0 to 7.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_set_lc_comparator_0_fine_threshold(
+   SI32_ACCTR_A_Type * basePointer,
+   uwide8_t threshold)
+{
+   assert(threshold <= 7);
+   //{{
+   basePointer->LCCONFIG.CMP0FTH = threshold;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_set_lc_comparator_0_fine_threshold(SI32_ACCTR_A_Type* /*basePointer*/,
    uwide8_t /*threshold*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_set_lc_comparator_0_fine_threshold(basePointer, threshold)
 #define SI32_ACCTR_A_set_lc_comparator_0_fine_threshold(basePointer, threshold) \
@@ -994,9 +1701,22 @@ _SI32_ACCTR_A_set_lc_comparator_0_fine_threshold(SI32_ACCTR_A_Type* /*basePointe
 ///  threshold
 ///  Valid range is 0 to 63.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_set_lc_comparator_1_coarse_threshold(
+   SI32_ACCTR_A_Type * basePointer,
+   uwide8_t threshold)
+{
+   assert(threshold <= 63);
+   //{{
+   basePointer->LCCONFIG.CMP1CTH = threshold;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_set_lc_comparator_1_coarse_threshold(SI32_ACCTR_A_Type* /*basePointer*/,
    uwide8_t /*threshold*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_set_lc_comparator_1_coarse_threshold(basePointer, threshold)
 #define SI32_ACCTR_A_set_lc_comparator_1_coarse_threshold(basePointer, threshold) \
@@ -1013,9 +1733,22 @@ _SI32_ACCTR_A_set_lc_comparator_1_coarse_threshold(SI32_ACCTR_A_Type* /*basePoin
 ///  threshold
 ///  Valid range is 0 to 7.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_set_lc_comparator_1_fine_threshold(
+   SI32_ACCTR_A_Type * basePointer,
+   uwide8_t threshold)
+{
+   assert(threshold <= 7);
+   //{{
+   basePointer->LCCONFIG.CMP1FTH = threshold;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_set_lc_comparator_1_fine_threshold(SI32_ACCTR_A_Type* /*basePointer*/,
    uwide8_t /*threshold*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_set_lc_comparator_1_fine_threshold(basePointer, threshold)
 #define SI32_ACCTR_A_set_lc_comparator_1_fine_threshold(basePointer, threshold) \
@@ -1032,9 +1765,29 @@ _SI32_ACCTR_A_set_lc_comparator_1_fine_threshold(SI32_ACCTR_A_Type* /*basePointe
 ///  threshold
 ///  Valid range is 0 to 63.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_set_lc_comparator_0_full_range_threshold(
+   SI32_ACCTR_A_Type * basePointer,
+   uwide8_t threshold)
+{
+   assert(threshold <= 63);
+   //{{
+   // This register requires a sinle 32-bit read modify write.
+   basePointer->LCCONFIG.U32 =
+      (basePointer->LCCONFIG.U32
+      // clear bits
+      & (~SI32_ACCTR_A_LCCONFIG_CMP0CTH_MASK))
+      // set bits
+      | (SI32_ACCTR_A_LCCONFIG_CMP0THR_MASK |
+        (threshold<<SI32_ACCTR_A_LCCONFIG_CMP0CTH_SHIFT));
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_set_lc_comparator_0_full_range_threshold(SI32_ACCTR_A_Type* /*basePointer*/,
    uwide8_t /*threshold*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_set_lc_comparator_0_full_range_threshold(basePointer, threshold)
 #define SI32_ACCTR_A_set_lc_comparator_0_full_range_threshold(basePointer, threshold) do{  \
@@ -1056,9 +1809,31 @@ _SI32_ACCTR_A_set_lc_comparator_0_full_range_threshold(SI32_ACCTR_A_Type* /*base
 ///  threshold
 ///  Valid range is 0 to 48.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_set_lc_comparator_0_low_range_threshold(
+   SI32_ACCTR_A_Type * basePointer,
+   uwide8_t threshold)
+{
+   assert(threshold <= 48);
+   //{{
+   // This register requires a single 32-bit read modify write.
+   basePointer->LCCONFIG.U32 =
+      (basePointer->LCCONFIG.U32
+      // clear bits
+      & (~SI32_ACCTR_A_LCCONFIG_CMP0THR_MASK &
+         ~SI32_ACCTR_A_LCCONFIG_CMP0CTH_MASK &
+         ~SI32_ACCTR_A_LCCONFIG_CMP0FTH_MASK))
+      // set bits
+      | (((threshold/6)<<SI32_ACCTR_A_LCCONFIG_CMP0CTH_SHIFT) |
+         (threshold%6)<<SI32_ACCTR_A_LCCONFIG_CMP0FTH_SHIFT);
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_set_lc_comparator_0_low_range_threshold(SI32_ACCTR_A_Type* /*basePointer*/,
    uwide8_t /*threshold*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_set_lc_comparator_0_low_range_threshold(basePointer, threshold)
 #define SI32_ACCTR_A_set_lc_comparator_0_low_range_threshold(basePointer, threshold) do{  \
@@ -1082,9 +1857,29 @@ _SI32_ACCTR_A_set_lc_comparator_0_low_range_threshold(SI32_ACCTR_A_Type* /*baseP
 ///  threshold
 ///  Valid range is 0 to 63.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_set_lc_comparator_1_full_range_threshold(
+   SI32_ACCTR_A_Type * basePointer,
+   uwide8_t threshold)
+{
+   assert(threshold <= 63);
+   //{{
+   // This register requires a single 32-bit read modify write.
+   basePointer->LCCONFIG.U32 =
+      (basePointer->LCCONFIG.U32
+      // clear bits
+      & (~SI32_ACCTR_A_LCCONFIG_CMP1CTH_MASK))
+      // set bits
+      | (SI32_ACCTR_A_LCCONFIG_CMP1THR_MASK |
+        (threshold<<SI32_ACCTR_A_LCCONFIG_CMP1CTH_SHIFT));
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_set_lc_comparator_1_full_range_threshold(SI32_ACCTR_A_Type* /*basePointer*/,
    uwide8_t /*threshold*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_set_lc_comparator_1_full_range_threshold(basePointer, threshold)
 #define SI32_ACCTR_A_set_lc_comparator_1_full_range_threshold(basePointer, threshold) do{  \
@@ -1106,9 +1901,31 @@ _SI32_ACCTR_A_set_lc_comparator_1_full_range_threshold(SI32_ACCTR_A_Type* /*base
 ///  threshold
 ///  Valid range is 0 to 48.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_set_lc_comparator_1_low_range_threshold(
+   SI32_ACCTR_A_Type * basePointer,
+   uwide8_t threshold)
+{
+   assert(threshold <= 48);
+   //{{
+   // This register requires a single 32-bit read modify write.
+   basePointer->LCCONFIG.U32 =
+      (basePointer->LCCONFIG.U32
+      // clear bits
+      & (~SI32_ACCTR_A_LCCONFIG_CMP1THR_MASK &
+         ~SI32_ACCTR_A_LCCONFIG_CMP1CTH_MASK &
+         ~SI32_ACCTR_A_LCCONFIG_CMP1FTH_MASK))
+      // set bits
+      | (((threshold/6)<<SI32_ACCTR_A_LCCONFIG_CMP1CTH_SHIFT) |
+         (threshold%6)<<SI32_ACCTR_A_LCCONFIG_CMP1FTH_SHIFT);
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_set_lc_comparator_1_low_range_threshold(SI32_ACCTR_A_Type* /*basePointer*/,
    uwide8_t /*threshold*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_set_lc_comparator_1_low_range_threshold(basePointer, threshold)
 #define SI32_ACCTR_A_set_lc_comparator_1_low_range_threshold(basePointer, threshold) do{  \
@@ -1127,8 +1944,19 @@ _SI32_ACCTR_A_set_lc_comparator_1_low_range_threshold(SI32_ACCTR_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_comparator_low_side_hysteresis_0_mV(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCCONFIG.CMPLHYS = SI32_ACCTR_A_LCCONFIG_CMPLHYS_0_MV_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_comparator_low_side_hysteresis_0_mV(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_comparator_low_side_hysteresis_0_mV(basePointer)
 #define SI32_ACCTR_A_select_comparator_low_side_hysteresis_0_mV(basePointer) \
@@ -1140,8 +1968,19 @@ _SI32_ACCTR_A_select_comparator_low_side_hysteresis_0_mV(SI32_ACCTR_A_Type* /*ba
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_comparator_low_side_hysteresis_5_mV(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCCONFIG.CMPLHYS = SI32_ACCTR_A_LCCONFIG_CMPLHYS_5_MV_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_comparator_low_side_hysteresis_5_mV(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_comparator_low_side_hysteresis_5_mV(basePointer)
 #define SI32_ACCTR_A_select_comparator_low_side_hysteresis_5_mV(basePointer) \
@@ -1153,8 +1992,19 @@ _SI32_ACCTR_A_select_comparator_low_side_hysteresis_5_mV(SI32_ACCTR_A_Type* /*ba
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_comparator_low_side_hysteresis_10_mV(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCCONFIG.CMPLHYS = SI32_ACCTR_A_LCCONFIG_CMPLHYS_10_MV_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_comparator_low_side_hysteresis_10_mV(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_comparator_low_side_hysteresis_10_mV(basePointer)
 #define SI32_ACCTR_A_select_comparator_low_side_hysteresis_10_mV(basePointer) \
@@ -1166,8 +2016,19 @@ _SI32_ACCTR_A_select_comparator_low_side_hysteresis_10_mV(SI32_ACCTR_A_Type* /*b
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_comparator_low_side_hysteresis_20_mV(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCCONFIG.CMPLHYS = SI32_ACCTR_A_LCCONFIG_CMPLHYS_20_MV_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_comparator_low_side_hysteresis_20_mV(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_comparator_low_side_hysteresis_20_mV(basePointer)
 #define SI32_ACCTR_A_select_comparator_low_side_hysteresis_20_mV(basePointer) \
@@ -1179,8 +2040,19 @@ _SI32_ACCTR_A_select_comparator_low_side_hysteresis_20_mV(SI32_ACCTR_A_Type* /*b
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_comparator_high_side_hysteresis_0_mV(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCCONFIG.CMPHHYS = SI32_ACCTR_A_LCCONFIG_CMPHHYS_0_MV_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_comparator_high_side_hysteresis_0_mV(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_comparator_high_side_hysteresis_0_mV(basePointer)
 #define SI32_ACCTR_A_select_comparator_high_side_hysteresis_0_mV(basePointer) \
@@ -1192,8 +2064,19 @@ _SI32_ACCTR_A_select_comparator_high_side_hysteresis_0_mV(SI32_ACCTR_A_Type* /*b
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_comparator_high_side_hysteresis_5_mV(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCCONFIG.CMPHHYS = SI32_ACCTR_A_LCCONFIG_CMPHHYS_5_MV_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_comparator_high_side_hysteresis_5_mV(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_comparator_high_side_hysteresis_5_mV(basePointer)
 #define SI32_ACCTR_A_select_comparator_high_side_hysteresis_5_mV(basePointer) \
@@ -1205,8 +2088,19 @@ _SI32_ACCTR_A_select_comparator_high_side_hysteresis_5_mV(SI32_ACCTR_A_Type* /*b
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_comparator_high_side_hysteresis_10_mV(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCCONFIG.CMPHHYS = SI32_ACCTR_A_LCCONFIG_CMPHHYS_10_MV_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_comparator_high_side_hysteresis_10_mV(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_comparator_high_side_hysteresis_10_mV(basePointer)
 #define SI32_ACCTR_A_select_comparator_high_side_hysteresis_10_mV(basePointer) \
@@ -1218,8 +2112,19 @@ _SI32_ACCTR_A_select_comparator_high_side_hysteresis_10_mV(SI32_ACCTR_A_Type* /*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_comparator_high_side_hysteresis_20_mV(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCCONFIG.CMPHHYS = SI32_ACCTR_A_LCCONFIG_CMPHHYS_20_MV_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_comparator_high_side_hysteresis_20_mV(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_comparator_high_side_hysteresis_20_mV(basePointer)
 #define SI32_ACCTR_A_select_comparator_high_side_hysteresis_20_mV(basePointer) \
@@ -1231,8 +2136,19 @@ _SI32_ACCTR_A_select_comparator_high_side_hysteresis_20_mV(SI32_ACCTR_A_Type* /*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_comparator_response_time_200_ns(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCCONFIG.CMPMD = SI32_ACCTR_A_LCCONFIG_CMPMD_200_NS_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_comparator_response_time_200_ns(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_comparator_response_time_200_ns(basePointer)
 #define SI32_ACCTR_A_select_comparator_response_time_200_ns(basePointer) \
@@ -1244,8 +2160,19 @@ _SI32_ACCTR_A_select_comparator_response_time_200_ns(SI32_ACCTR_A_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_comparator_response_time_400_ns(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCCONFIG.CMPMD = SI32_ACCTR_A_LCCONFIG_CMPMD_400_NS_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_comparator_response_time_400_ns(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_comparator_response_time_400_ns(basePointer)
 #define SI32_ACCTR_A_select_comparator_response_time_400_ns(basePointer) \
@@ -1257,8 +2184,19 @@ _SI32_ACCTR_A_select_comparator_response_time_400_ns(SI32_ACCTR_A_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_comparator_response_time_1_us(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCCONFIG.CMPMD = SI32_ACCTR_A_LCCONFIG_CMPMD_1_US_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_comparator_response_time_1_us(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_comparator_response_time_1_us(basePointer)
 #define SI32_ACCTR_A_select_comparator_response_time_1_us(basePointer) \
@@ -1270,8 +2208,19 @@ _SI32_ACCTR_A_select_comparator_response_time_1_us(SI32_ACCTR_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_comparator_response_time_5_us(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCCONFIG.CMPMD = SI32_ACCTR_A_LCCONFIG_CMPMD_5_US_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_comparator_response_time_5_us(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_comparator_response_time_5_us(basePointer)
 #define SI32_ACCTR_A_select_comparator_response_time_5_us(basePointer) \
@@ -1283,8 +2232,20 @@ _SI32_ACCTR_A_select_comparator_response_time_5_us(SI32_ACCTR_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_enable_use_lc_comparator_0_for_counter_1(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCCONFIG.CMP0CNT1EN =
+      SI32_ACCTR_A_LCCONFIG_CMP0CNT1EN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_enable_use_lc_comparator_0_for_counter_1(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_enable_use_lc_comparator_0_for_counter_1(basePointer)
 #define SI32_ACCTR_A_enable_use_lc_comparator_0_for_counter_1(basePointer) do{  \
@@ -1298,8 +2259,20 @@ _SI32_ACCTR_A_enable_use_lc_comparator_0_for_counter_1(SI32_ACCTR_A_Type* /*base
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_disable_use_lc_comparator_0_for_counter_1(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCCONFIG.CMP0CNT1EN =
+      SI32_ACCTR_A_LCCONFIG_CMP0CNT1EN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_disable_use_lc_comparator_0_for_counter_1(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_disable_use_lc_comparator_0_for_counter_1(basePointer)
 #define SI32_ACCTR_A_disable_use_lc_comparator_0_for_counter_1(basePointer) do{  \
@@ -1313,8 +2286,20 @@ _SI32_ACCTR_A_disable_use_lc_comparator_0_for_counter_1(SI32_ACCTR_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_enable_force_lc_comparator_0_on(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCCONFIG.FCMP0EN =
+      SI32_ACCTR_A_LCCONFIG_FCMP0EN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_enable_force_lc_comparator_0_on(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_enable_force_lc_comparator_0_on(basePointer)
 #define SI32_ACCTR_A_enable_force_lc_comparator_0_on(basePointer) do{  \
@@ -1328,8 +2313,20 @@ _SI32_ACCTR_A_enable_force_lc_comparator_0_on(SI32_ACCTR_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_disable_force_lc_comparator_0_on(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCCONFIG.FCMP0EN =
+      SI32_ACCTR_A_LCCONFIG_FCMP0EN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_disable_force_lc_comparator_0_on(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_disable_force_lc_comparator_0_on(basePointer)
 #define SI32_ACCTR_A_disable_force_lc_comparator_0_on(basePointer) do{  \
@@ -1343,8 +2340,20 @@ _SI32_ACCTR_A_disable_force_lc_comparator_0_on(SI32_ACCTR_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_enable_force_lc_comparator_1_on(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCCONFIG.FCMP1EN =
+      SI32_ACCTR_A_LCCONFIG_FCMP1EN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_enable_force_lc_comparator_1_on(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_enable_force_lc_comparator_1_on(basePointer)
 #define SI32_ACCTR_A_enable_force_lc_comparator_1_on(basePointer) do{  \
@@ -1358,8 +2367,20 @@ _SI32_ACCTR_A_enable_force_lc_comparator_1_on(SI32_ACCTR_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_disable_force_lc_comparator_1_on(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCCONFIG.FCMP1EN =
+      SI32_ACCTR_A_LCCONFIG_FCMP1EN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_disable_force_lc_comparator_1_on(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_disable_force_lc_comparator_1_on(basePointer)
 #define SI32_ACCTR_A_disable_force_lc_comparator_1_on(basePointer) do{  \
@@ -1381,9 +2402,21 @@ _SI32_ACCTR_A_disable_force_lc_comparator_1_on(SI32_ACCTR_A_Type* /*basePointer*
 ///  lctiming
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_write_lctiming(
+   SI32_ACCTR_A_Type * basePointer,
+   uint32_t lctiming)
+{
+   //{{
+   basePointer->TIMING.U32=lctiming;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_write_lctiming(SI32_ACCTR_A_Type* /*basePointer*/,
    uint32_t /*lctiming*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_write_lctiming(basePointer, lctiming)
 #define SI32_ACCTR_A_write_lctiming(basePointer, lctiming) \
@@ -1398,8 +2431,19 @@ _SI32_ACCTR_A_write_lctiming(SI32_ACCTR_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_ACCTR_A_read_lctiming(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->TIMING.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_ACCTR_A_read_lctiming(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_read_lctiming(basePointer)
 #define SI32_ACCTR_A_read_lctiming(basePointer) \
@@ -1411,8 +2455,19 @@ _SI32_ACCTR_A_read_lctiming(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide8_t
+_SI32_ACCTR_A_get_lc_timing_state(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->TIMING.STATE;
+   //}}
+}
+#else
 uwide8_t
 _SI32_ACCTR_A_get_lc_timing_state(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_get_lc_timing_state(basePointer)
 #define SI32_ACCTR_A_get_lc_timing_state(basePointer) \
@@ -1424,8 +2479,19 @@ _SI32_ACCTR_A_get_lc_timing_state(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_enable_lc_bias_pulse_0_offset(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->TIMING.B0OEN=SI32_ACCTR_A_TIMING_B0OEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_enable_lc_bias_pulse_0_offset(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_enable_lc_bias_pulse_0_offset(basePointer)
 #define SI32_ACCTR_A_enable_lc_bias_pulse_0_offset(basePointer) \
@@ -1437,8 +2503,19 @@ _SI32_ACCTR_A_enable_lc_bias_pulse_0_offset(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_disable_lc_bias_pulse_0_offset(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->TIMING.B0OEN=SI32_ACCTR_A_TIMING_B0OEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_disable_lc_bias_pulse_0_offset(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_disable_lc_bias_pulse_0_offset(basePointer)
 #define SI32_ACCTR_A_disable_lc_bias_pulse_0_offset(basePointer) \
@@ -1450,8 +2527,19 @@ _SI32_ACCTR_A_disable_lc_bias_pulse_0_offset(SI32_ACCTR_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_enable_lc_bias_pulse_1_offset(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->TIMING.B1OEN=SI32_ACCTR_A_TIMING_B1OEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_enable_lc_bias_pulse_1_offset(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_enable_lc_bias_pulse_1_offset(basePointer)
 #define SI32_ACCTR_A_enable_lc_bias_pulse_1_offset(basePointer) \
@@ -1463,8 +2551,19 @@ _SI32_ACCTR_A_enable_lc_bias_pulse_1_offset(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_disable_lc_bias_pulse_1_offset(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->TIMING.B1OEN=SI32_ACCTR_A_TIMING_B1OEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_disable_lc_bias_pulse_1_offset(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_disable_lc_bias_pulse_1_offset(basePointer)
 #define SI32_ACCTR_A_disable_lc_bias_pulse_1_offset(basePointer) \
@@ -1481,9 +2580,22 @@ _SI32_ACCTR_A_disable_lc_bias_pulse_1_offset(SI32_ACCTR_A_Type* /*basePointer*/)
 ///  time
 ///  Valid range is 3 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_set_zone_p_time(
+   SI32_ACCTR_A_Type * basePointer,
+   uwide8_t time)
+{
+   assert(time < 8);   // time < 2^3
+   //{{
+   basePointer->TIMING.ZONEP = time;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_set_zone_p_time(SI32_ACCTR_A_Type* /*basePointer*/,
    uwide8_t /*time*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_set_zone_p_time(basePointer, time)
 #define SI32_ACCTR_A_set_zone_p_time(basePointer, time) \
@@ -1495,8 +2607,19 @@ _SI32_ACCTR_A_set_zone_p_time(SI32_ACCTR_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide8_t
+_SI32_ACCTR_A_get_zone_p_time(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->TIMING.ZONEP;
+   //}}
+}
+#else
 uwide8_t
 _SI32_ACCTR_A_get_zone_p_time(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_get_zone_p_time(basePointer)
 #define SI32_ACCTR_A_get_zone_p_time(basePointer) \
@@ -1513,9 +2636,22 @@ _SI32_ACCTR_A_get_zone_p_time(SI32_ACCTR_A_Type* /*basePointer*/);
 ///  time
 ///  Valid range is 3 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_set_zone_a_time(
+   SI32_ACCTR_A_Type * basePointer,
+   uwide8_t time)
+{
+   assert(time < 8);   // time < 2^3
+   //{{
+   basePointer->TIMING.ZONEA = time;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_set_zone_a_time(SI32_ACCTR_A_Type* /*basePointer*/,
    uwide8_t /*time*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_set_zone_a_time(basePointer, time)
 #define SI32_ACCTR_A_set_zone_a_time(basePointer, time) \
@@ -1527,8 +2663,19 @@ _SI32_ACCTR_A_set_zone_a_time(SI32_ACCTR_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide8_t
+_SI32_ACCTR_A_get_zone_a_time(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->TIMING.ZONEA;
+   //}}
+}
+#else
 uwide8_t
 _SI32_ACCTR_A_get_zone_a_time(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_get_zone_a_time(basePointer)
 #define SI32_ACCTR_A_get_zone_a_time(basePointer) \
@@ -1545,9 +2692,22 @@ _SI32_ACCTR_A_get_zone_a_time(SI32_ACCTR_A_Type* /*basePointer*/);
 ///  time
 ///  Valid range is 3 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_set_zone_b_time(
+   SI32_ACCTR_A_Type * basePointer,
+   uwide8_t time)
+{
+   assert(time < 8);   // time < 2^3
+   //{{
+   basePointer->TIMING.ZONEB = time;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_set_zone_b_time(SI32_ACCTR_A_Type* /*basePointer*/,
    uwide8_t /*time*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_set_zone_b_time(basePointer, time)
 #define SI32_ACCTR_A_set_zone_b_time(basePointer, time) \
@@ -1559,8 +2719,19 @@ _SI32_ACCTR_A_set_zone_b_time(SI32_ACCTR_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide8_t
+_SI32_ACCTR_A_get_zone_b_time(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->TIMING.ZONEB;
+   //}}
+}
+#else
 uwide8_t
 _SI32_ACCTR_A_get_zone_b_time(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_get_zone_b_time(basePointer)
 #define SI32_ACCTR_A_get_zone_b_time(basePointer) \
@@ -1577,9 +2748,22 @@ _SI32_ACCTR_A_get_zone_b_time(SI32_ACCTR_A_Type* /*basePointer*/);
 ///  time
 ///  Valid range is 3 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_set_zone_c_time(
+   SI32_ACCTR_A_Type * basePointer,
+   uwide8_t time)
+{
+   assert(time < 8);   // time < 2^3
+   //{{
+   basePointer->TIMING.ZONEC = time;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_set_zone_c_time(SI32_ACCTR_A_Type* /*basePointer*/,
    uwide8_t /*time*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_set_zone_c_time(basePointer, time)
 #define SI32_ACCTR_A_set_zone_c_time(basePointer, time) \
@@ -1591,8 +2775,19 @@ _SI32_ACCTR_A_set_zone_c_time(SI32_ACCTR_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide8_t
+_SI32_ACCTR_A_get_zone_c_time(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->TIMING.ZONEC;
+   //}}
+}
+#else
 uwide8_t
 _SI32_ACCTR_A_get_zone_c_time(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_get_zone_c_time(basePointer)
 #define SI32_ACCTR_A_get_zone_c_time(basePointer) \
@@ -1609,9 +2804,22 @@ _SI32_ACCTR_A_get_zone_c_time(SI32_ACCTR_A_Type* /*basePointer*/);
 ///  time
 ///  Valid range is 3 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_set_zone_d_time(
+   SI32_ACCTR_A_Type * basePointer,
+   uwide8_t time)
+{
+   assert(time < 8);   // time < 2^3
+   //{{
+   basePointer->TIMING.ZONED = time;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_set_zone_d_time(SI32_ACCTR_A_Type* /*basePointer*/,
    uwide8_t /*time*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_set_zone_d_time(basePointer, time)
 #define SI32_ACCTR_A_set_zone_d_time(basePointer, time) \
@@ -1623,8 +2831,19 @@ _SI32_ACCTR_A_set_zone_d_time(SI32_ACCTR_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide8_t
+_SI32_ACCTR_A_get_zone_d_time(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->TIMING.ZONED;
+   //}}
+}
+#else
 uwide8_t
 _SI32_ACCTR_A_get_zone_d_time(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_get_zone_d_time(basePointer)
 #define SI32_ACCTR_A_get_zone_d_time(basePointer) \
@@ -1636,8 +2855,19 @@ _SI32_ACCTR_A_get_zone_d_time(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_disable_wake_after_zone(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->TIMING.WAKEMD = SI32_ACCTR_A_TIMING_WAKEMD_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_disable_wake_after_zone(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_disable_wake_after_zone(basePointer)
 #define SI32_ACCTR_A_select_disable_wake_after_zone(basePointer) \
@@ -1649,8 +2879,19 @@ _SI32_ACCTR_A_select_disable_wake_after_zone(SI32_ACCTR_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_wake_after_zone_p(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->TIMING.WAKEMD = SI32_ACCTR_A_TIMING_WAKEMD_WZONEP_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_wake_after_zone_p(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_wake_after_zone_p(basePointer)
 #define SI32_ACCTR_A_select_wake_after_zone_p(basePointer) \
@@ -1662,8 +2903,19 @@ _SI32_ACCTR_A_select_wake_after_zone_p(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_wake_after_zone_a(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->TIMING.WAKEMD = SI32_ACCTR_A_TIMING_WAKEMD_WZONEA_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_wake_after_zone_a(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_wake_after_zone_a(basePointer)
 #define SI32_ACCTR_A_select_wake_after_zone_a(basePointer) \
@@ -1675,8 +2927,19 @@ _SI32_ACCTR_A_select_wake_after_zone_a(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_wake_after_zone_b(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->TIMING.WAKEMD = SI32_ACCTR_A_TIMING_WAKEMD_WZONEB_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_wake_after_zone_b(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_wake_after_zone_b(basePointer)
 #define SI32_ACCTR_A_select_wake_after_zone_b(basePointer) \
@@ -1688,8 +2951,19 @@ _SI32_ACCTR_A_select_wake_after_zone_b(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_wake_after_zone_c(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->TIMING.WAKEMD = SI32_ACCTR_A_TIMING_WAKEMD_WZONEC_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_wake_after_zone_c(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_wake_after_zone_c(basePointer)
 #define SI32_ACCTR_A_select_wake_after_zone_c(basePointer) \
@@ -1701,8 +2975,19 @@ _SI32_ACCTR_A_select_wake_after_zone_c(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_wake_after_zone_d(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->TIMING.WAKEMD = SI32_ACCTR_A_TIMING_WAKEMD_WZONED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_wake_after_zone_d(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_wake_after_zone_d(basePointer)
 #define SI32_ACCTR_A_select_wake_after_zone_d(basePointer) \
@@ -1714,8 +2999,19 @@ _SI32_ACCTR_A_select_wake_after_zone_d(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_wake_after_lc_sequence(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->TIMING.WAKEMD = SI32_ACCTR_A_TIMING_WAKEMD_WEND_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_wake_after_lc_sequence(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_wake_after_lc_sequence(basePointer)
 #define SI32_ACCTR_A_select_wake_after_lc_sequence(basePointer) \
@@ -1727,8 +3023,19 @@ _SI32_ACCTR_A_select_wake_after_lc_sequence(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_wake_and_stop_after_lc_sequence(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->TIMING.WAKEMD = SI32_ACCTR_A_TIMING_WAKEMD_WKSTOP_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_wake_and_stop_after_lc_sequence(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_wake_and_stop_after_lc_sequence(basePointer)
 #define SI32_ACCTR_A_select_wake_and_stop_after_lc_sequence(basePointer) \
@@ -1740,8 +3047,19 @@ _SI32_ACCTR_A_select_wake_and_stop_after_lc_sequence(SI32_ACCTR_A_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_start_sequencer(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->TIMING.START = SI32_ACCTR_A_TIMING_START_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_start_sequencer(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_start_sequencer(basePointer)
 #define SI32_ACCTR_A_start_sequencer(basePointer) \
@@ -1753,8 +3071,19 @@ _SI32_ACCTR_A_start_sequencer(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_4_cycle_period(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->TIMING.PERIOD = SI32_ACCTR_A_TIMING_PERIOD_4_CYCLES_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_4_cycle_period(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_4_cycle_period(basePointer)
 #define SI32_ACCTR_A_select_4_cycle_period(basePointer) \
@@ -1766,8 +3095,19 @@ _SI32_ACCTR_A_select_4_cycle_period(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_8_cycle_period(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->TIMING.PERIOD = SI32_ACCTR_A_TIMING_PERIOD_8_CYCLES_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_8_cycle_period(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_8_cycle_period(basePointer)
 #define SI32_ACCTR_A_select_8_cycle_period(basePointer) \
@@ -1779,8 +3119,19 @@ _SI32_ACCTR_A_select_8_cycle_period(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_16_cycle_period(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->TIMING.PERIOD = SI32_ACCTR_A_TIMING_PERIOD_16_CYCLES_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_16_cycle_period(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_16_cycle_period(basePointer)
 #define SI32_ACCTR_A_select_16_cycle_period(basePointer) \
@@ -1792,8 +3143,19 @@ _SI32_ACCTR_A_select_16_cycle_period(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_32_cycle_period(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->TIMING.PERIOD = SI32_ACCTR_A_TIMING_PERIOD_32_CYCLES_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_32_cycle_period(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_32_cycle_period(basePointer)
 #define SI32_ACCTR_A_select_32_cycle_period(basePointer) \
@@ -1805,8 +3167,19 @@ _SI32_ACCTR_A_select_32_cycle_period(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_64_cycle_period(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->TIMING.PERIOD = SI32_ACCTR_A_TIMING_PERIOD_64_CYCLES_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_64_cycle_period(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_64_cycle_period(basePointer)
 #define SI32_ACCTR_A_select_64_cycle_period(basePointer) \
@@ -1818,8 +3191,19 @@ _SI32_ACCTR_A_select_64_cycle_period(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_128_cycle_period(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->TIMING.PERIOD = SI32_ACCTR_A_TIMING_PERIOD_128_CYCLES_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_128_cycle_period(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_128_cycle_period(basePointer)
 #define SI32_ACCTR_A_select_128_cycle_period(basePointer) \
@@ -1831,8 +3215,19 @@ _SI32_ACCTR_A_select_128_cycle_period(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_256_cycle_period(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->TIMING.PERIOD = SI32_ACCTR_A_TIMING_PERIOD_256_CYCLES_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_256_cycle_period(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_256_cycle_period(basePointer)
 #define SI32_ACCTR_A_select_256_cycle_period(basePointer) \
@@ -1844,8 +3239,19 @@ _SI32_ACCTR_A_select_256_cycle_period(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_512_cycle_period(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->TIMING.PERIOD = SI32_ACCTR_A_TIMING_PERIOD_512_CYCLES_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_512_cycle_period(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_512_cycle_period(basePointer)
 #define SI32_ACCTR_A_select_512_cycle_period(basePointer) \
@@ -1857,8 +3263,19 @@ _SI32_ACCTR_A_select_512_cycle_period(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_1024_cycle_period(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->TIMING.PERIOD = SI32_ACCTR_A_TIMING_PERIOD_1024_CYCLES_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_1024_cycle_period(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_1024_cycle_period(basePointer)
 #define SI32_ACCTR_A_select_1024_cycle_period(basePointer) \
@@ -1870,8 +3287,19 @@ _SI32_ACCTR_A_select_1024_cycle_period(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_2048_cycle_period(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->TIMING.PERIOD = SI32_ACCTR_A_TIMING_PERIOD_2048_CYCLES_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_2048_cycle_period(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_2048_cycle_period(basePointer)
 #define SI32_ACCTR_A_select_2048_cycle_period(basePointer) \
@@ -1883,8 +3311,19 @@ _SI32_ACCTR_A_select_2048_cycle_period(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_4096_cycle_period(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->TIMING.PERIOD = SI32_ACCTR_A_TIMING_PERIOD_4096_CYCLES_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_4096_cycle_period(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_4096_cycle_period(basePointer)
 #define SI32_ACCTR_A_select_4096_cycle_period(basePointer) \
@@ -1896,8 +3335,19 @@ _SI32_ACCTR_A_select_4096_cycle_period(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_single_sample_mode(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->TIMING.PERIOD = SI32_ACCTR_A_TIMING_PERIOD_SINGLE_SAMPLE_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_single_sample_mode(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_single_sample_mode(basePointer)
 #define SI32_ACCTR_A_select_single_sample_mode(basePointer) \
@@ -1909,8 +3359,19 @@ _SI32_ACCTR_A_select_single_sample_mode(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_consecutive_mode(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->TIMING.PERIOD = SI32_ACCTR_A_TIMING_PERIOD_CONSECUTIVE_SAMPLE_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_consecutive_mode(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_consecutive_mode(basePointer)
 #define SI32_ACCTR_A_select_consecutive_mode(basePointer) \
@@ -1930,9 +3391,22 @@ _SI32_ACCTR_A_select_consecutive_mode(SI32_ACCTR_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 4 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_set_period_value(
+   SI32_ACCTR_A_Type * basePointer,
+   uwide8_t value)
+{
+   assert(value < 16);   // value < 2^4
+   //{{
+   basePointer->TIMING.PERIOD = value;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_set_period_value(SI32_ACCTR_A_Type* /*basePointer*/,
    uwide8_t /*value*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_set_period_value(basePointer, value)
 #define SI32_ACCTR_A_set_period_value(basePointer, value) \
@@ -1947,8 +3421,19 @@ _SI32_ACCTR_A_set_period_value(SI32_ACCTR_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide16_t
+_SI32_ACCTR_A_get_period_value(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->TIMING.PERIOD;
+   //}}
+}
+#else
 uwide16_t
 _SI32_ACCTR_A_get_period_value(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_get_period_value(basePointer)
 #define SI32_ACCTR_A_get_period_value(basePointer) \
@@ -1963,8 +3448,19 @@ _SI32_ACCTR_A_get_period_value(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide16_t
+_SI32_ACCTR_A_get_period_cycles(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return ((basePointer->TIMING.PERIOD<11)?(0x00000004<<basePointer->TIMING.PERIOD):0xFFFF);
+   //}}
+}
+#else
 uwide16_t
 _SI32_ACCTR_A_get_period_cycles(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_get_period_cycles(basePointer)
 #define SI32_ACCTR_A_get_period_cycles(basePointer) \
@@ -1984,9 +3480,21 @@ _SI32_ACCTR_A_get_period_cycles(SI32_ACCTR_A_Type* /*basePointer*/);
 ///  lcmode
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_write_lcmode(
+   SI32_ACCTR_A_Type * basePointer,
+   uint32_t lcmode)
+{
+   //{{
+   basePointer->LCMODE.U32=lcmode;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_write_lcmode(SI32_ACCTR_A_Type* /*basePointer*/,
    uint32_t /*lcmode*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_write_lcmode(basePointer, lcmode)
 #define SI32_ACCTR_A_write_lcmode(basePointer, lcmode) \
@@ -2001,8 +3509,19 @@ _SI32_ACCTR_A_write_lcmode(SI32_ACCTR_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_ACCTR_A_read_lcmode(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->LCMODE.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_ACCTR_A_read_lcmode(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_read_lcmode(basePointer)
 #define SI32_ACCTR_A_read_lcmode(basePointer) \
@@ -2014,8 +3533,19 @@ _SI32_ACCTR_A_read_lcmode(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_enable_lc_automatic_tracking(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.ATRKEN=SI32_ACCTR_A_LCMODE_ATRKEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_enable_lc_automatic_tracking(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_enable_lc_automatic_tracking(basePointer)
 #define SI32_ACCTR_A_enable_lc_automatic_tracking(basePointer) \
@@ -2027,8 +3557,19 @@ _SI32_ACCTR_A_enable_lc_automatic_tracking(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_disable_lc_automatic_tracking(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.ATRKEN=SI32_ACCTR_A_LCMODE_ATRKEN_DISABLED_VALUE;\
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_disable_lc_automatic_tracking(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_disable_lc_automatic_tracking(basePointer)
 #define SI32_ACCTR_A_disable_lc_automatic_tracking(basePointer) \
@@ -2040,8 +3581,19 @@ _SI32_ACCTR_A_disable_lc_automatic_tracking(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_enable_lc_automatic_center_discriminator(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.ACDEN=SI32_ACCTR_A_LCMODE_ACDEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_enable_lc_automatic_center_discriminator(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_enable_lc_automatic_center_discriminator(basePointer)
 #define SI32_ACCTR_A_enable_lc_automatic_center_discriminator(basePointer) \
@@ -2053,8 +3605,19 @@ _SI32_ACCTR_A_enable_lc_automatic_center_discriminator(SI32_ACCTR_A_Type* /*base
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_disable_lc_automatic_center_discriminator(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.ACDEN=SI32_ACCTR_A_LCMODE_ACDEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_disable_lc_automatic_center_discriminator(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_disable_lc_automatic_center_discriminator(basePointer)
 #define SI32_ACCTR_A_disable_lc_automatic_center_discriminator(basePointer) \
@@ -2066,8 +3629,19 @@ _SI32_ACCTR_A_disable_lc_automatic_center_discriminator(SI32_ACCTR_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_discriminator_0_hysterisis_zero(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.LCD0HYS=SI32_ACCTR_A_LCMODE_LCD0HYS_ZERO_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_discriminator_0_hysterisis_zero(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_discriminator_0_hysterisis_zero(basePointer)
 #define SI32_ACCTR_A_select_lc_discriminator_0_hysterisis_zero(basePointer) \
@@ -2079,8 +3653,19 @@ _SI32_ACCTR_A_select_lc_discriminator_0_hysterisis_zero(SI32_ACCTR_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_discriminator_0_hysterisis_minus_1(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.LCD0HYS=SI32_ACCTR_A_LCMODE_LCD0HYS_MINUS1_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_discriminator_0_hysterisis_minus_1(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_discriminator_0_hysterisis_minus_1(basePointer)
 #define SI32_ACCTR_A_select_lc_discriminator_0_hysterisis_minus_1(basePointer) \
@@ -2092,8 +3677,19 @@ _SI32_ACCTR_A_select_lc_discriminator_0_hysterisis_minus_1(SI32_ACCTR_A_Type* /*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_discriminator_0_hysterisis_minus_2(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.LCD0HYS=SI32_ACCTR_A_LCMODE_LCD0HYS_MINUS2_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_discriminator_0_hysterisis_minus_2(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_discriminator_0_hysterisis_minus_2(basePointer)
 #define SI32_ACCTR_A_select_lc_discriminator_0_hysterisis_minus_2(basePointer) \
@@ -2105,8 +3701,19 @@ _SI32_ACCTR_A_select_lc_discriminator_0_hysterisis_minus_2(SI32_ACCTR_A_Type* /*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_discriminator_0_hysterisis_minus_3(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.LCD0HYS=SI32_ACCTR_A_LCMODE_LCD0HYS_MINUS3_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_discriminator_0_hysterisis_minus_3(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_discriminator_0_hysterisis_minus_3(basePointer)
 #define SI32_ACCTR_A_select_lc_discriminator_0_hysterisis_minus_3(basePointer) \
@@ -2118,8 +3725,19 @@ _SI32_ACCTR_A_select_lc_discriminator_0_hysterisis_minus_3(SI32_ACCTR_A_Type* /*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_discriminator_1_hysterisis_zero(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.LCD1HYS=SI32_ACCTR_A_LCMODE_LCD1HYS_ZERO_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_discriminator_1_hysterisis_zero(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_discriminator_1_hysterisis_zero(basePointer)
 #define SI32_ACCTR_A_select_lc_discriminator_1_hysterisis_zero(basePointer) \
@@ -2131,8 +3749,19 @@ _SI32_ACCTR_A_select_lc_discriminator_1_hysterisis_zero(SI32_ACCTR_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_discriminator_1_hysterisis_minus_1(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.LCD1HYS=SI32_ACCTR_A_LCMODE_LCD1HYS_MINUS1_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_discriminator_1_hysterisis_minus_1(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_discriminator_1_hysterisis_minus_1(basePointer)
 #define SI32_ACCTR_A_select_lc_discriminator_1_hysterisis_minus_1(basePointer) \
@@ -2144,8 +3773,19 @@ _SI32_ACCTR_A_select_lc_discriminator_1_hysterisis_minus_1(SI32_ACCTR_A_Type* /*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_discriminator_1_hysterisis_minus_2(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.LCD1HYS=SI32_ACCTR_A_LCMODE_LCD1HYS_MINUS2_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_discriminator_1_hysterisis_minus_2(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_discriminator_1_hysterisis_minus_2(basePointer)
 #define SI32_ACCTR_A_select_lc_discriminator_1_hysterisis_minus_2(basePointer) \
@@ -2157,8 +3797,19 @@ _SI32_ACCTR_A_select_lc_discriminator_1_hysterisis_minus_2(SI32_ACCTR_A_Type* /*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_discriminator_1_hysterisis_minus_3(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.LCD1HYS=SI32_ACCTR_A_LCMODE_LCD1HYS_MINUS3_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_discriminator_1_hysterisis_minus_3(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_discriminator_1_hysterisis_minus_3(basePointer)
 #define SI32_ACCTR_A_select_lc_discriminator_1_hysterisis_minus_3(basePointer) \
@@ -2170,8 +3821,19 @@ _SI32_ACCTR_A_select_lc_discriminator_1_hysterisis_minus_3(SI32_ACCTR_A_Type* /*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_counter_0_input_active_zone_a(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.C0ZONE=SI32_ACCTR_A_LCMODE_C0ZONE_ZONEA_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_counter_0_input_active_zone_a(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_counter_0_input_active_zone_a(basePointer)
 #define SI32_ACCTR_A_select_lc_counter_0_input_active_zone_a(basePointer) \
@@ -2183,8 +3845,19 @@ _SI32_ACCTR_A_select_lc_counter_0_input_active_zone_a(SI32_ACCTR_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_counter_0_input_active_zone_b(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.C0ZONE=SI32_ACCTR_A_LCMODE_C0ZONE_ZONEB_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_counter_0_input_active_zone_b(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_counter_0_input_active_zone_b(basePointer)
 #define SI32_ACCTR_A_select_lc_counter_0_input_active_zone_b(basePointer) \
@@ -2196,8 +3869,19 @@ _SI32_ACCTR_A_select_lc_counter_0_input_active_zone_b(SI32_ACCTR_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_counter_0_input_active_zone_c(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.C0ZONE=SI32_ACCTR_A_LCMODE_C0ZONE_ZONEC_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_counter_0_input_active_zone_c(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_counter_0_input_active_zone_c(basePointer)
 #define SI32_ACCTR_A_select_lc_counter_0_input_active_zone_c(basePointer) \
@@ -2209,8 +3893,19 @@ _SI32_ACCTR_A_select_lc_counter_0_input_active_zone_c(SI32_ACCTR_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_counter_0_input_active_zone_d(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.C0ZONE=SI32_ACCTR_A_LCMODE_C0ZONE_ZONED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_counter_0_input_active_zone_d(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_counter_0_input_active_zone_d(basePointer)
 #define SI32_ACCTR_A_select_lc_counter_0_input_active_zone_d(basePointer) \
@@ -2222,8 +3917,19 @@ _SI32_ACCTR_A_select_lc_counter_0_input_active_zone_d(SI32_ACCTR_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_counter_1_input_active_zone_a(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.C1ZONE=SI32_ACCTR_A_LCMODE_C1ZONE_ZONEA_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_counter_1_input_active_zone_a(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_counter_1_input_active_zone_a(basePointer)
 #define SI32_ACCTR_A_select_lc_counter_1_input_active_zone_a(basePointer) \
@@ -2235,8 +3941,19 @@ _SI32_ACCTR_A_select_lc_counter_1_input_active_zone_a(SI32_ACCTR_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_counter_1_input_active_zone_b(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.C1ZONE=SI32_ACCTR_A_LCMODE_C1ZONE_ZONEB_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_counter_1_input_active_zone_b(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_counter_1_input_active_zone_b(basePointer)
 #define SI32_ACCTR_A_select_lc_counter_1_input_active_zone_b(basePointer) \
@@ -2248,8 +3965,19 @@ _SI32_ACCTR_A_select_lc_counter_1_input_active_zone_b(SI32_ACCTR_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_counter_1_input_active_zone_c(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.C1ZONE=SI32_ACCTR_A_LCMODE_C1ZONE_ZONEC_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_counter_1_input_active_zone_c(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_counter_1_input_active_zone_c(basePointer)
 #define SI32_ACCTR_A_select_lc_counter_1_input_active_zone_c(basePointer) \
@@ -2261,8 +3989,19 @@ _SI32_ACCTR_A_select_lc_counter_1_input_active_zone_c(SI32_ACCTR_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_counter_1_input_active_zone_d(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.C1ZONE=SI32_ACCTR_A_LCMODE_C1ZONE_ZONED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_counter_1_input_active_zone_d(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_counter_1_input_active_zone_d(basePointer)
 #define SI32_ACCTR_A_select_lc_counter_1_input_active_zone_d(basePointer) \
@@ -2274,8 +4013,19 @@ _SI32_ACCTR_A_select_lc_counter_1_input_active_zone_d(SI32_ACCTR_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_pulse_0_output_disable(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.P0ZONE=SI32_ACCTR_A_LCMODE_P0ZONE_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_pulse_0_output_disable(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_pulse_0_output_disable(basePointer)
 #define SI32_ACCTR_A_select_lc_pulse_0_output_disable(basePointer) \
@@ -2287,8 +4037,19 @@ _SI32_ACCTR_A_select_lc_pulse_0_output_disable(SI32_ACCTR_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_pulse_0_output_active_zone_c(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.P0ZONE=SI32_ACCTR_A_LCMODE_P0ZONE_C_ONLY_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_pulse_0_output_active_zone_c(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_pulse_0_output_active_zone_c(basePointer)
 #define SI32_ACCTR_A_select_lc_pulse_0_output_active_zone_c(basePointer) \
@@ -2300,8 +4061,19 @@ _SI32_ACCTR_A_select_lc_pulse_0_output_active_zone_c(SI32_ACCTR_A_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_pulse_0_output_active_zone_a(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.P0ZONE=SI32_ACCTR_A_LCMODE_P0ZONE_A_ONLY_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_pulse_0_output_active_zone_a(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_pulse_0_output_active_zone_a(basePointer)
 #define SI32_ACCTR_A_select_lc_pulse_0_output_active_zone_a(basePointer) \
@@ -2313,8 +4085,19 @@ _SI32_ACCTR_A_select_lc_pulse_0_output_active_zone_a(SI32_ACCTR_A_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_pulse_0_output_active_zone_a_and_c(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.P0ZONE=SI32_ACCTR_A_LCMODE_P0ZONE_A_AND_C_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_pulse_0_output_active_zone_a_and_c(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_pulse_0_output_active_zone_a_and_c(basePointer)
 #define SI32_ACCTR_A_select_lc_pulse_0_output_active_zone_a_and_c(basePointer) \
@@ -2326,8 +4109,19 @@ _SI32_ACCTR_A_select_lc_pulse_0_output_active_zone_a_and_c(SI32_ACCTR_A_Type* /*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_pulse_1_output_disable(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.P1ZONE=SI32_ACCTR_A_LCMODE_P1ZONE_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_pulse_1_output_disable(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_pulse_1_output_disable(basePointer)
 #define SI32_ACCTR_A_select_lc_pulse_1_output_disable(basePointer) \
@@ -2339,8 +4133,19 @@ _SI32_ACCTR_A_select_lc_pulse_1_output_disable(SI32_ACCTR_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_pulse_1_output_active_zone_c(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.P1ZONE=SI32_ACCTR_A_LCMODE_P1ZONE_C_ONLY_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_pulse_1_output_active_zone_c(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_pulse_1_output_active_zone_c(basePointer)
 #define SI32_ACCTR_A_select_lc_pulse_1_output_active_zone_c(basePointer) \
@@ -2352,8 +4157,19 @@ _SI32_ACCTR_A_select_lc_pulse_1_output_active_zone_c(SI32_ACCTR_A_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_pulse_1_output_active_zone_a(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.P1ZONE=SI32_ACCTR_A_LCMODE_P1ZONE_A_ONLY_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_pulse_1_output_active_zone_a(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_pulse_1_output_active_zone_a(basePointer)
 #define SI32_ACCTR_A_select_lc_pulse_1_output_active_zone_a(basePointer) \
@@ -2365,8 +4181,19 @@ _SI32_ACCTR_A_select_lc_pulse_1_output_active_zone_a(SI32_ACCTR_A_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_pulse_1_output_active_zone_a_and_c(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.P1ZONE=SI32_ACCTR_A_LCMODE_P1ZONE_A_AND_C_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_pulse_1_output_active_zone_a_and_c(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_pulse_1_output_active_zone_a_and_c(basePointer)
 #define SI32_ACCTR_A_select_lc_pulse_1_output_active_zone_a_and_c(basePointer) \
@@ -2378,8 +4205,19 @@ _SI32_ACCTR_A_select_lc_pulse_1_output_active_zone_a_and_c(SI32_ACCTR_A_Type* /*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_output_pulse_mode_disabled(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.PMD=SI32_ACCTR_A_LCMODE_PMD_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_output_pulse_mode_disabled(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_output_pulse_mode_disabled(basePointer)
 #define SI32_ACCTR_A_select_lc_output_pulse_mode_disabled(basePointer) \
@@ -2391,8 +4229,19 @@ _SI32_ACCTR_A_select_lc_output_pulse_mode_disabled(SI32_ACCTR_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_output_pulse_mode_toggle(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.PMD=SI32_ACCTR_A_LCMODE_PMD_TOGGLE_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_output_pulse_mode_toggle(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_output_pulse_mode_toggle(basePointer)
 #define SI32_ACCTR_A_select_lc_output_pulse_mode_toggle(basePointer) \
@@ -2404,8 +4253,19 @@ _SI32_ACCTR_A_select_lc_output_pulse_mode_toggle(SI32_ACCTR_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_output_pulse_mode_pulse_low(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.PMD=SI32_ACCTR_A_LCMODE_PMD_PULSE_LOW_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_output_pulse_mode_pulse_low(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_output_pulse_mode_pulse_low(basePointer)
 #define SI32_ACCTR_A_select_lc_output_pulse_mode_pulse_low(basePointer) \
@@ -2417,8 +4277,19 @@ _SI32_ACCTR_A_select_lc_output_pulse_mode_pulse_low(SI32_ACCTR_A_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_output_pulse_mode_pulse_high(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.PMD=SI32_ACCTR_A_LCMODE_PMD_PULSE_HIGH_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_output_pulse_mode_pulse_high(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_output_pulse_mode_pulse_high(basePointer)
 #define SI32_ACCTR_A_select_lc_output_pulse_mode_pulse_high(basePointer) \
@@ -2430,8 +4301,19 @@ _SI32_ACCTR_A_select_lc_output_pulse_mode_pulse_high(SI32_ACCTR_A_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_enable_lc_bias_counter_0_zone_a(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.B0ZONEAEN=SI32_ACCTR_A_LCMODE_B0ZONEAEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_enable_lc_bias_counter_0_zone_a(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_enable_lc_bias_counter_0_zone_a(basePointer)
 #define SI32_ACCTR_A_enable_lc_bias_counter_0_zone_a(basePointer) \
@@ -2443,8 +4325,19 @@ _SI32_ACCTR_A_enable_lc_bias_counter_0_zone_a(SI32_ACCTR_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_disable_lc_bias_counter_0_zone_a(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+basePointer->LCMODE.B0ZONEAEN=SI32_ACCTR_A_LCMODE_B0ZONEAEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_disable_lc_bias_counter_0_zone_a(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_disable_lc_bias_counter_0_zone_a(basePointer)
 #define SI32_ACCTR_A_disable_lc_bias_counter_0_zone_a(basePointer) \
@@ -2456,8 +4349,19 @@ _SI32_ACCTR_A_disable_lc_bias_counter_0_zone_a(SI32_ACCTR_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_enable_lc_bias_counter_0_zone_b(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.B0ZONEBEN=SI32_ACCTR_A_LCMODE_B0ZONEBEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_enable_lc_bias_counter_0_zone_b(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_enable_lc_bias_counter_0_zone_b(basePointer)
 #define SI32_ACCTR_A_enable_lc_bias_counter_0_zone_b(basePointer) \
@@ -2469,8 +4373,19 @@ _SI32_ACCTR_A_enable_lc_bias_counter_0_zone_b(SI32_ACCTR_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_disable_lc_bias_counter_0_zone_b(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.B0ZONEBEN=SI32_ACCTR_A_LCMODE_B0ZONEBEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_disable_lc_bias_counter_0_zone_b(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_disable_lc_bias_counter_0_zone_b(basePointer)
 #define SI32_ACCTR_A_disable_lc_bias_counter_0_zone_b(basePointer) \
@@ -2482,8 +4397,19 @@ _SI32_ACCTR_A_disable_lc_bias_counter_0_zone_b(SI32_ACCTR_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_enable_lc_bias_counter_0_zone_c(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.B0ZONECEN=SI32_ACCTR_A_LCMODE_B0ZONECEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_enable_lc_bias_counter_0_zone_c(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_enable_lc_bias_counter_0_zone_c(basePointer)
 #define SI32_ACCTR_A_enable_lc_bias_counter_0_zone_c(basePointer) \
@@ -2495,8 +4421,19 @@ _SI32_ACCTR_A_enable_lc_bias_counter_0_zone_c(SI32_ACCTR_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_disable_lc_bias_counter_0_zone_c(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.B0ZONECEN=SI32_ACCTR_A_LCMODE_B0ZONECEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_disable_lc_bias_counter_0_zone_c(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_disable_lc_bias_counter_0_zone_c(basePointer)
 #define SI32_ACCTR_A_disable_lc_bias_counter_0_zone_c(basePointer) \
@@ -2508,8 +4445,19 @@ _SI32_ACCTR_A_disable_lc_bias_counter_0_zone_c(SI32_ACCTR_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_enable_lc_bias_counter_0_zone_p(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.B0ZONEPEN=SI32_ACCTR_A_LCMODE_B0ZONEPEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_enable_lc_bias_counter_0_zone_p(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_enable_lc_bias_counter_0_zone_p(basePointer)
 #define SI32_ACCTR_A_enable_lc_bias_counter_0_zone_p(basePointer) \
@@ -2521,8 +4469,19 @@ _SI32_ACCTR_A_enable_lc_bias_counter_0_zone_p(SI32_ACCTR_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_disable_lc_bias_counter_0_zone_p(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.B0ZONEPEN=SI32_ACCTR_A_LCMODE_B0ZONEPEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_disable_lc_bias_counter_0_zone_p(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_disable_lc_bias_counter_0_zone_p(basePointer)
 #define SI32_ACCTR_A_disable_lc_bias_counter_0_zone_p(basePointer) \
@@ -2534,8 +4493,19 @@ _SI32_ACCTR_A_disable_lc_bias_counter_0_zone_p(SI32_ACCTR_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_bias_counter_0_pulse_high_polarity(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.B0POL=SI32_ACCTR_A_LCMODE_B0POL_PULSE_HIGH_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_bias_counter_0_pulse_high_polarity(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_bias_counter_0_pulse_high_polarity(basePointer)
 #define SI32_ACCTR_A_select_lc_bias_counter_0_pulse_high_polarity(basePointer) \
@@ -2547,8 +4517,19 @@ _SI32_ACCTR_A_select_lc_bias_counter_0_pulse_high_polarity(SI32_ACCTR_A_Type* /*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_bias_counter_0_pulse_low_polarity(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.B0POL=SI32_ACCTR_A_LCMODE_B0POL_PULSE_LOW_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_bias_counter_0_pulse_low_polarity(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_bias_counter_0_pulse_low_polarity(basePointer)
 #define SI32_ACCTR_A_select_lc_bias_counter_0_pulse_low_polarity(basePointer) \
@@ -2560,8 +4541,19 @@ _SI32_ACCTR_A_select_lc_bias_counter_0_pulse_low_polarity(SI32_ACCTR_A_Type* /*b
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_enable_lc_bias_counter_1_zone_a(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.B1ZONEAEN=SI32_ACCTR_A_LCMODE_B1ZONEAEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_enable_lc_bias_counter_1_zone_a(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_enable_lc_bias_counter_1_zone_a(basePointer)
 #define SI32_ACCTR_A_enable_lc_bias_counter_1_zone_a(basePointer) \
@@ -2573,8 +4565,19 @@ _SI32_ACCTR_A_enable_lc_bias_counter_1_zone_a(SI32_ACCTR_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_disable_lc_bias_counter_1_zone_a(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.B1ZONEAEN=SI32_ACCTR_A_LCMODE_B1ZONEAEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_disable_lc_bias_counter_1_zone_a(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_disable_lc_bias_counter_1_zone_a(basePointer)
 #define SI32_ACCTR_A_disable_lc_bias_counter_1_zone_a(basePointer) \
@@ -2586,8 +4589,19 @@ _SI32_ACCTR_A_disable_lc_bias_counter_1_zone_a(SI32_ACCTR_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_enable_lc_bias_counter_1_zone_b(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.B1ZONEBEN=SI32_ACCTR_A_LCMODE_B1ZONEBEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_enable_lc_bias_counter_1_zone_b(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_enable_lc_bias_counter_1_zone_b(basePointer)
 #define SI32_ACCTR_A_enable_lc_bias_counter_1_zone_b(basePointer) \
@@ -2599,8 +4613,19 @@ _SI32_ACCTR_A_enable_lc_bias_counter_1_zone_b(SI32_ACCTR_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_disable_lc_bias_counter_1_zone_b(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.B1ZONEBEN=SI32_ACCTR_A_LCMODE_B1ZONEBEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_disable_lc_bias_counter_1_zone_b(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_disable_lc_bias_counter_1_zone_b(basePointer)
 #define SI32_ACCTR_A_disable_lc_bias_counter_1_zone_b(basePointer) \
@@ -2612,8 +4637,19 @@ _SI32_ACCTR_A_disable_lc_bias_counter_1_zone_b(SI32_ACCTR_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_enable_lc_bias_counter_1_zone_c(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.B1ZONECEN=SI32_ACCTR_A_LCMODE_B1ZONECEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_enable_lc_bias_counter_1_zone_c(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_enable_lc_bias_counter_1_zone_c(basePointer)
 #define SI32_ACCTR_A_enable_lc_bias_counter_1_zone_c(basePointer) \
@@ -2625,8 +4661,19 @@ _SI32_ACCTR_A_enable_lc_bias_counter_1_zone_c(SI32_ACCTR_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_disable_lc_bias_counter_1_zone_c(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.B1ZONECEN=SI32_ACCTR_A_LCMODE_B1ZONECEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_disable_lc_bias_counter_1_zone_c(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_disable_lc_bias_counter_1_zone_c(basePointer)
 #define SI32_ACCTR_A_disable_lc_bias_counter_1_zone_c(basePointer) \
@@ -2638,8 +4685,19 @@ _SI32_ACCTR_A_disable_lc_bias_counter_1_zone_c(SI32_ACCTR_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_enable_lc_bias_counter_1_zone_p(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.B1ZONEPEN=SI32_ACCTR_A_LCMODE_B1ZONEPEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_enable_lc_bias_counter_1_zone_p(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_enable_lc_bias_counter_1_zone_p(basePointer)
 #define SI32_ACCTR_A_enable_lc_bias_counter_1_zone_p(basePointer) \
@@ -2651,8 +4709,19 @@ _SI32_ACCTR_A_enable_lc_bias_counter_1_zone_p(SI32_ACCTR_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_disable_lc_bias_counter_1_zone_p(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+basePointer->LCMODE.B1ZONEPEN=SI32_ACCTR_A_LCMODE_B1ZONEPEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_disable_lc_bias_counter_1_zone_p(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_disable_lc_bias_counter_1_zone_p(basePointer)
 #define SI32_ACCTR_A_disable_lc_bias_counter_1_zone_p(basePointer) \
@@ -2664,8 +4733,19 @@ _SI32_ACCTR_A_disable_lc_bias_counter_1_zone_p(SI32_ACCTR_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_bias_counter_1_pulse_high_polarity(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.B1POL=SI32_ACCTR_A_LCMODE_B1POL_PULSE_HIGH_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_bias_counter_1_pulse_high_polarity(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_bias_counter_1_pulse_high_polarity(basePointer)
 #define SI32_ACCTR_A_select_lc_bias_counter_1_pulse_high_polarity(basePointer) \
@@ -2677,8 +4757,19 @@ _SI32_ACCTR_A_select_lc_bias_counter_1_pulse_high_polarity(SI32_ACCTR_A_Type* /*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_bias_counter_1_pulse_low_polarity(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.B1POL=SI32_ACCTR_A_LCMODE_B1POL_PULSE_LOW_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_bias_counter_1_pulse_low_polarity(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_bias_counter_1_pulse_low_polarity(basePointer)
 #define SI32_ACCTR_A_select_lc_bias_counter_1_pulse_low_polarity(basePointer) \
@@ -2690,8 +4781,19 @@ _SI32_ACCTR_A_select_lc_bias_counter_1_pulse_low_polarity(SI32_ACCTR_A_Type* /*b
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_bias_mode_0_disable(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.BMD=SI32_ACCTR_A_LCMODE_BMD_MODE0_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_bias_mode_0_disable(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_bias_mode_0_disable(basePointer)
 #define SI32_ACCTR_A_select_lc_bias_mode_0_disable(basePointer) \
@@ -2703,8 +4805,19 @@ _SI32_ACCTR_A_select_lc_bias_mode_0_disable(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_bias_mode_1_external_only(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.BMD=SI32_ACCTR_A_LCMODE_BMD_MODE1_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_bias_mode_1_external_only(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_bias_mode_1_external_only(basePointer)
 #define SI32_ACCTR_A_select_lc_bias_mode_1_external_only(basePointer) \
@@ -2716,8 +4829,19 @@ _SI32_ACCTR_A_select_lc_bias_mode_1_external_only(SI32_ACCTR_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_bias_mode_2_internal_only(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.BMD=SI32_ACCTR_A_LCMODE_BMD_MODE2_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_bias_mode_2_internal_only(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_bias_mode_2_internal_only(basePointer)
 #define SI32_ACCTR_A_select_lc_bias_mode_2_internal_only(basePointer) \
@@ -2729,8 +4853,19 @@ _SI32_ACCTR_A_select_lc_bias_mode_2_internal_only(SI32_ACCTR_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_bias_mode_3_internal_external(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.BMD=SI32_ACCTR_A_LCMODE_BMD_MODE3_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_bias_mode_3_internal_external(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_bias_mode_3_internal_external(basePointer)
 #define SI32_ACCTR_A_select_lc_bias_mode_3_internal_external(basePointer) \
@@ -2742,8 +4877,19 @@ _SI32_ACCTR_A_select_lc_bias_mode_3_internal_external(SI32_ACCTR_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_mode_0_pass_through_single_ended(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.LCMD=SI32_ACCTR_A_LCMODE_LCMD_MODE0_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_mode_0_pass_through_single_ended(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_mode_0_pass_through_single_ended(basePointer)
 #define SI32_ACCTR_A_select_lc_mode_0_pass_through_single_ended(basePointer) \
@@ -2755,8 +4901,19 @@ _SI32_ACCTR_A_select_lc_mode_0_pass_through_single_ended(SI32_ACCTR_A_Type* /*ba
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_mode_1_pass_through_differential(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.LCMD=SI32_ACCTR_A_LCMODE_LCMD_MODE1_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_mode_1_pass_through_differential(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_mode_1_pass_through_differential(basePointer)
 #define SI32_ACCTR_A_select_lc_mode_1_pass_through_differential(basePointer) \
@@ -2768,8 +4925,19 @@ _SI32_ACCTR_A_select_lc_mode_1_pass_through_differential(SI32_ACCTR_A_Type* /*ba
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_mode_2_pass_through_sample_and_hold_single_ended(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.LCMD=SI32_ACCTR_A_LCMODE_LCMD_MODE2_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_mode_2_pass_through_sample_and_hold_single_ended(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_mode_2_pass_through_sample_and_hold_single_ended(basePointer)
 #define SI32_ACCTR_A_select_lc_mode_2_pass_through_sample_and_hold_single_ended(basePointer) \
@@ -2781,8 +4949,19 @@ _SI32_ACCTR_A_select_lc_mode_2_pass_through_sample_and_hold_single_ended(SI32_AC
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_mode_3_pass_through_sample_and_hold_differential(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.LCMD=SI32_ACCTR_A_LCMODE_LCMD_MODE3_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_mode_3_pass_through_sample_and_hold_differential(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_mode_3_pass_through_sample_and_hold_differential(basePointer)
 #define SI32_ACCTR_A_select_lc_mode_3_pass_through_sample_and_hold_differential(basePointer) \
@@ -2794,8 +4973,19 @@ _SI32_ACCTR_A_select_lc_mode_3_pass_through_sample_and_hold_differential(SI32_AC
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_mode_4_timed_single_ended(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.LCMD=SI32_ACCTR_A_LCMODE_LCMD_MODE4_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_mode_4_timed_single_ended(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_mode_4_timed_single_ended(basePointer)
 #define SI32_ACCTR_A_select_lc_mode_4_timed_single_ended(basePointer) \
@@ -2807,8 +4997,19 @@ _SI32_ACCTR_A_select_lc_mode_4_timed_single_ended(SI32_ACCTR_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_mode_5_timed_differential(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.LCMD=SI32_ACCTR_A_LCMODE_LCMD_MODE5_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_mode_5_timed_differential(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_mode_5_timed_differential(basePointer)
 #define SI32_ACCTR_A_select_lc_mode_5_timed_differential(basePointer) \
@@ -2820,8 +5021,19 @@ _SI32_ACCTR_A_select_lc_mode_5_timed_differential(SI32_ACCTR_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_mode_6_timed_sample_and_hold_single_ended(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.LCMD=SI32_ACCTR_A_LCMODE_LCMD_MODE6_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_mode_6_timed_sample_and_hold_single_ended(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_mode_6_timed_sample_and_hold_single_ended(basePointer)
 #define SI32_ACCTR_A_select_lc_mode_6_timed_sample_and_hold_single_ended(basePointer) \
@@ -2833,8 +5045,19 @@ _SI32_ACCTR_A_select_lc_mode_6_timed_sample_and_hold_single_ended(SI32_ACCTR_A_T
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_mode_7_timed_sample_and_hold_differential(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.LCMD=SI32_ACCTR_A_LCMODE_LCMD_MODE7_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_mode_7_timed_sample_and_hold_differential(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_mode_7_timed_sample_and_hold_differential(basePointer)
 #define SI32_ACCTR_A_select_lc_mode_7_timed_sample_and_hold_differential(basePointer) \
@@ -2846,8 +5069,19 @@ _SI32_ACCTR_A_select_lc_mode_7_timed_sample_and_hold_differential(SI32_ACCTR_A_T
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_mode_8_external_stop_rising_edge(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.LCMD=SI32_ACCTR_A_LCMODE_LCMD_MODE8_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_mode_8_external_stop_rising_edge(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_mode_8_external_stop_rising_edge(basePointer)
 #define SI32_ACCTR_A_select_lc_mode_8_external_stop_rising_edge(basePointer) \
@@ -2859,8 +5093,19 @@ _SI32_ACCTR_A_select_lc_mode_8_external_stop_rising_edge(SI32_ACCTR_A_Type* /*ba
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_mode_9_external_stop_falling_edge(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.LCMD=SI32_ACCTR_A_LCMODE_LCMD_MODE9_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_mode_9_external_stop_falling_edge(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_mode_9_external_stop_falling_edge(basePointer)
 #define SI32_ACCTR_A_select_lc_mode_9_external_stop_falling_edge(basePointer) \
@@ -2872,8 +5117,19 @@ _SI32_ACCTR_A_select_lc_mode_9_external_stop_falling_edge(SI32_ACCTR_A_Type* /*b
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_mode_10_external_stop_sample_and_hold_rising_edge(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.LCMD=SI32_ACCTR_A_LCMODE_LCMD_MODE10_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_mode_10_external_stop_sample_and_hold_rising_edge(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_mode_10_external_stop_sample_and_hold_rising_edge(basePointer)
 #define SI32_ACCTR_A_select_lc_mode_10_external_stop_sample_and_hold_rising_edge(basePointer) \
@@ -2885,8 +5141,19 @@ _SI32_ACCTR_A_select_lc_mode_10_external_stop_sample_and_hold_rising_edge(SI32_A
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_mode_11_external_stop_sample_and_hold_falling_edge(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.LCMD=SI32_ACCTR_A_LCMODE_LCMD_MODE11_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_mode_11_external_stop_sample_and_hold_falling_edge(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_mode_11_external_stop_sample_and_hold_falling_edge(basePointer)
 #define SI32_ACCTR_A_select_lc_mode_11_external_stop_sample_and_hold_falling_edge(basePointer) \
@@ -2898,8 +5165,19 @@ _SI32_ACCTR_A_select_lc_mode_11_external_stop_sample_and_hold_falling_edge(SI32_
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_mode_12_no_pulse_single_ended(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.LCMD=SI32_ACCTR_A_LCMODE_LCMD_MODE12_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_mode_12_no_pulse_single_ended(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_mode_12_no_pulse_single_ended(basePointer)
 #define SI32_ACCTR_A_select_lc_mode_12_no_pulse_single_ended(basePointer) \
@@ -2911,8 +5189,19 @@ _SI32_ACCTR_A_select_lc_mode_12_no_pulse_single_ended(SI32_ACCTR_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_mode_13_no_pulse_differential(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.LCMD=SI32_ACCTR_A_LCMODE_LCMD_MODE13_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_mode_13_no_pulse_differential(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_mode_13_no_pulse_differential(basePointer)
 #define SI32_ACCTR_A_select_lc_mode_13_no_pulse_differential(basePointer) \
@@ -2924,8 +5213,19 @@ _SI32_ACCTR_A_select_lc_mode_13_no_pulse_differential(SI32_ACCTR_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_mode_14_no_pulse_sample_and_hold_single_ended(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.LCMD=SI32_ACCTR_A_LCMODE_LCMD_MODE14_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_mode_14_no_pulse_sample_and_hold_single_ended(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_mode_14_no_pulse_sample_and_hold_single_ended(basePointer)
 #define SI32_ACCTR_A_select_lc_mode_14_no_pulse_sample_and_hold_single_ended(basePointer) \
@@ -2937,8 +5237,19 @@ _SI32_ACCTR_A_select_lc_mode_14_no_pulse_sample_and_hold_single_ended(SI32_ACCTR
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_select_lc_mode_15_no_pulse_sample_and_hold_differential(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCMODE.LCMD=SI32_ACCTR_A_LCMODE_LCMD_MODE15_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_select_lc_mode_15_no_pulse_sample_and_hold_differential(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_select_lc_mode_15_no_pulse_sample_and_hold_differential(basePointer)
 #define SI32_ACCTR_A_select_lc_mode_15_no_pulse_sample_and_hold_differential(basePointer) \
@@ -2958,9 +5269,21 @@ _SI32_ACCTR_A_select_lc_mode_15_no_pulse_sample_and_hold_differential(SI32_ACCTR
 ///  lcclkcontrol
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_write_lcclkcontrol(
+   SI32_ACCTR_A_Type * basePointer,
+   uint32_t lcclkcontrol)
+{
+   //{{
+   basePointer->LCCLKCONTROL.U32=lcclkcontrol;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_write_lcclkcontrol(SI32_ACCTR_A_Type* /*basePointer*/,
    uint32_t /*lcclkcontrol*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_write_lcclkcontrol(basePointer, lcclkcontrol)
 #define SI32_ACCTR_A_write_lcclkcontrol(basePointer, lcclkcontrol) \
@@ -2975,8 +5298,19 @@ _SI32_ACCTR_A_write_lcclkcontrol(SI32_ACCTR_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_ACCTR_A_read_lcclkcontrol(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->LCCLKCONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_ACCTR_A_read_lcclkcontrol(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_read_lcclkcontrol(basePointer)
 #define SI32_ACCTR_A_read_lcclkcontrol(basePointer) \
@@ -2988,8 +5322,19 @@ _SI32_ACCTR_A_read_lcclkcontrol(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide16_t
+_SI32_ACCTR_A_get_lc_oscillator_calibration_value(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->LCCLKCONTROL.CLKCYCLES;
+   //}}
+}
+#else
 uwide16_t
 _SI32_ACCTR_A_get_lc_oscillator_calibration_value(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_get_lc_oscillator_calibration_value(basePointer)
 #define SI32_ACCTR_A_get_lc_oscillator_calibration_value(basePointer) \
@@ -3001,8 +5346,20 @@ _SI32_ACCTR_A_get_lc_oscillator_calibration_value(SI32_ACCTR_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_start_lc_oscillator_calibration(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->LCCLKCONTROL.CLKCAL =
+      SI32_ACCTR_A_LCCLKCONTROL_CLKCAL_START_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_start_lc_oscillator_calibration(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_start_lc_oscillator_calibration(basePointer)
 #define SI32_ACCTR_A_start_lc_oscillator_calibration(basePointer) do{  \
@@ -3016,8 +5373,19 @@ _SI32_ACCTR_A_start_lc_oscillator_calibration(SI32_ACCTR_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_ACCTR_A_is_lc_oscillator_calibration_in_progess(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->LCCLKCONTROL.CLKCAL;
+   //}}
+}
+#else
 bool
 _SI32_ACCTR_A_is_lc_oscillator_calibration_in_progess(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_is_lc_oscillator_calibration_in_progess(basePointer)
 #define SI32_ACCTR_A_is_lc_oscillator_calibration_in_progess(basePointer) \
@@ -3037,9 +5405,22 @@ _SI32_ACCTR_A_is_lc_oscillator_calibration_in_progess(SI32_ACCTR_A_Type* /*baseP
 ///  reload
 ///  Valid range is 12 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_set_lc_oscillator_reload_value(
+   SI32_ACCTR_A_Type * basePointer,
+   uwide16_t reload)
+{
+   assert(reload < 4096);   // reload < 2^12
+   //{{
+   basePointer->LCCLKCONTROL.RELOAD = reload;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_set_lc_oscillator_reload_value(SI32_ACCTR_A_Type* /*basePointer*/,
    uwide16_t /*reload*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_set_lc_oscillator_reload_value(basePointer, reload)
 #define SI32_ACCTR_A_set_lc_oscillator_reload_value(basePointer, reload) \
@@ -3054,8 +5435,19 @@ _SI32_ACCTR_A_set_lc_oscillator_reload_value(SI32_ACCTR_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide16_t
+_SI32_ACCTR_A_get_lc_oscillator_reload_value(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->LCCLKCONTROL.RELOAD ;
+   //}}
+}
+#else
 uwide16_t
 _SI32_ACCTR_A_get_lc_oscillator_reload_value(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_get_lc_oscillator_reload_value(basePointer)
 #define SI32_ACCTR_A_get_lc_oscillator_reload_value(basePointer) \
@@ -3070,8 +5462,19 @@ _SI32_ACCTR_A_get_lc_oscillator_reload_value(SI32_ACCTR_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_ACCTR_A_read_lc_limits(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->LCLIMITS.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_ACCTR_A_read_lc_limits(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_read_lc_limits(basePointer)
 #define SI32_ACCTR_A_read_lc_limits(basePointer) \
@@ -3091,9 +5494,21 @@ _SI32_ACCTR_A_read_lc_limits(SI32_ACCTR_A_Type* /*basePointer*/);
 ///  lccount
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_write_lccount(
+   SI32_ACCTR_A_Type * basePointer,
+   uint32_t lccount)
+{
+   //{{
+   basePointer->LCCOUNT.U32=lccount;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_write_lccount(SI32_ACCTR_A_Type* /*basePointer*/,
    uint32_t /*lccount*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_write_lccount(basePointer, lccount)
 #define SI32_ACCTR_A_write_lccount(basePointer, lccount) \
@@ -3108,8 +5523,19 @@ _SI32_ACCTR_A_write_lccount(SI32_ACCTR_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_ACCTR_A_read_lccount(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->LCCOUNT.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_ACCTR_A_read_lccount(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_read_lccount(basePointer)
 #define SI32_ACCTR_A_read_lccount(basePointer) \
@@ -3127,9 +5553,23 @@ _SI32_ACCTR_A_read_lccount(SI32_ACCTR_A_Type* /*basePointer*/);
 ///  Valid range is 8 bits.
 ///  Set count 0 discriminator field.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_set_lc_count_0_discriminator(
+   SI32_ACCTR_A_Type * basePointer,
+   // Set count 0 discriminator field.
+   uwide8_t value)
+{
+   assert(value < 256);   // value < 2^8
+   //{{
+   basePointer->LCCOUNT.CD0 = value;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_set_lc_count_0_discriminator(SI32_ACCTR_A_Type* /*basePointer*/,
    uwide8_t /*value*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_set_lc_count_0_discriminator(basePointer, value)
 #define SI32_ACCTR_A_set_lc_count_0_discriminator(basePointer, value) \
@@ -3144,8 +5584,19 @@ _SI32_ACCTR_A_set_lc_count_0_discriminator(SI32_ACCTR_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide8_t
+_SI32_ACCTR_A_get_lc_count_0_discriminator(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->LCCOUNT.CD0;
+   //}}
+}
+#else
 uwide8_t
 _SI32_ACCTR_A_get_lc_count_0_discriminator(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_get_lc_count_0_discriminator(basePointer)
 #define SI32_ACCTR_A_get_lc_count_0_discriminator(basePointer) \
@@ -3163,9 +5614,23 @@ _SI32_ACCTR_A_get_lc_count_0_discriminator(SI32_ACCTR_A_Type* /*basePointer*/);
 ///  Valid range is 8 bits.
 ///  Set count 1 discriminator field.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_set_lc_count_1_discriminator(
+   SI32_ACCTR_A_Type * basePointer,
+   // Set count 1 discriminator field.
+   uwide8_t value)
+{
+   assert(value < 256);   // value < 2^8
+   //{{
+   basePointer->LCCOUNT.CD1 = value;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_set_lc_count_1_discriminator(SI32_ACCTR_A_Type* /*basePointer*/,
    uwide8_t /*value*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_set_lc_count_1_discriminator(basePointer, value)
 #define SI32_ACCTR_A_set_lc_count_1_discriminator(basePointer, value) \
@@ -3180,8 +5645,19 @@ _SI32_ACCTR_A_set_lc_count_1_discriminator(SI32_ACCTR_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide8_t
+_SI32_ACCTR_A_get_lc_count_1_discriminator(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->LCCOUNT.CD1;
+   //}}
+}
+#else
 uwide8_t
 _SI32_ACCTR_A_get_lc_count_1_discriminator(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_get_lc_count_1_discriminator(basePointer)
 #define SI32_ACCTR_A_get_lc_count_1_discriminator(basePointer) \
@@ -3201,9 +5677,21 @@ _SI32_ACCTR_A_get_lc_count_1_discriminator(SI32_ACCTR_A_Type* /*basePointer*/);
 ///  dbconfig
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_write_dbconfig(
+   SI32_ACCTR_A_Type * basePointer,
+   uint32_t dbconfig)
+{
+   //{{
+   basePointer->DBCONFIG.U32=dbconfig;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_write_dbconfig(SI32_ACCTR_A_Type* /*basePointer*/,
    uint32_t /*dbconfig*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_write_dbconfig(basePointer, dbconfig)
 #define SI32_ACCTR_A_write_dbconfig(basePointer, dbconfig) \
@@ -3218,8 +5706,19 @@ _SI32_ACCTR_A_write_dbconfig(SI32_ACCTR_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_ACCTR_A_read_dbconfig(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DBCONFIG.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_ACCTR_A_read_dbconfig(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_read_dbconfig(basePointer)
 #define SI32_ACCTR_A_read_dbconfig(basePointer) \
@@ -3239,9 +5738,22 @@ _SI32_ACCTR_A_read_dbconfig(SI32_ACCTR_A_Type* /*basePointer*/);
 ///  ldbth
 ///  Valid range is 8 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_set_debounce_low_threshold(
+   SI32_ACCTR_A_Type * basePointer,
+   uwide8_t ldbth)
+{
+   assert(ldbth < 256);   // ldbth < 2^8
+   //{{
+   basePointer->DBCONFIG.LDBTH = ldbth;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_set_debounce_low_threshold(SI32_ACCTR_A_Type* /*basePointer*/,
    uwide8_t /*ldbth*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_set_debounce_low_threshold(basePointer, ldbth)
 #define SI32_ACCTR_A_set_debounce_low_threshold(basePointer, ldbth) \
@@ -3256,8 +5768,19 @@ _SI32_ACCTR_A_set_debounce_low_threshold(SI32_ACCTR_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide8_t
+_SI32_ACCTR_A_get_debounce_low_threshold(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DBCONFIG.LDBTH;
+   //}}
+}
+#else
 uwide8_t
 _SI32_ACCTR_A_get_debounce_low_threshold(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_get_debounce_low_threshold(basePointer)
 #define SI32_ACCTR_A_get_debounce_low_threshold(basePointer) \
@@ -3277,9 +5800,22 @@ _SI32_ACCTR_A_get_debounce_low_threshold(SI32_ACCTR_A_Type* /*basePointer*/);
 ///  hdbth
 ///  Valid range is 8 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_set_debounce_high_threshold(
+   SI32_ACCTR_A_Type * basePointer,
+   uwide8_t hdbth)
+{
+   assert(hdbth < 256);   // hdbth < 2^8
+   //{{
+   basePointer->DBCONFIG.HDBTH = hdbth;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_set_debounce_high_threshold(SI32_ACCTR_A_Type* /*basePointer*/,
    uwide8_t /*hdbth*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_set_debounce_high_threshold(basePointer, hdbth)
 #define SI32_ACCTR_A_set_debounce_high_threshold(basePointer, hdbth) \
@@ -3294,8 +5830,19 @@ _SI32_ACCTR_A_set_debounce_high_threshold(SI32_ACCTR_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide8_t
+_SI32_ACCTR_A_get_debounce_high_threshold(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DBCONFIG.HDBTH;
+   //}}
+}
+#else
 uwide8_t
 _SI32_ACCTR_A_get_debounce_high_threshold(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_get_debounce_high_threshold(basePointer)
 #define SI32_ACCTR_A_get_debounce_high_threshold(basePointer) \
@@ -3307,8 +5854,20 @@ _SI32_ACCTR_A_get_debounce_high_threshold(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_enable_debounce_integrator_disconnect(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->DBCONFIG.INTEGDCEN =
+      SI32_ACCTR_A_DBCONFIG_INTEGDCEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_enable_debounce_integrator_disconnect(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_enable_debounce_integrator_disconnect(basePointer)
 #define SI32_ACCTR_A_enable_debounce_integrator_disconnect(basePointer) do{  \
@@ -3322,8 +5881,20 @@ _SI32_ACCTR_A_enable_debounce_integrator_disconnect(SI32_ACCTR_A_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_disable_debounce_integrator_disconnect(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->DBCONFIG.INTEGDCEN =
+      SI32_ACCTR_A_DBCONFIG_INTEGDCEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_disable_debounce_integrator_disconnect(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_disable_debounce_integrator_disconnect(basePointer)
 #define SI32_ACCTR_A_disable_debounce_integrator_disconnect(basePointer) do{  \
@@ -3337,8 +5908,19 @@ _SI32_ACCTR_A_disable_debounce_integrator_disconnect(SI32_ACCTR_A_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_ACCTR_A_is_debounce_integrator_0_high(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DBCONFIG.INTEG0;
+   //}}
+}
+#else
 bool
 _SI32_ACCTR_A_is_debounce_integrator_0_high(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_is_debounce_integrator_0_high(basePointer)
 #define SI32_ACCTR_A_is_debounce_integrator_0_high(basePointer) \
@@ -3350,8 +5932,19 @@ _SI32_ACCTR_A_is_debounce_integrator_0_high(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_ACCTR_A_is_debounce_integrator_1_high(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DBCONFIG.INTEG1;
+   //}}
+}
+#else
 bool
 _SI32_ACCTR_A_is_debounce_integrator_1_high(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_is_debounce_integrator_1_high(basePointer)
 #define SI32_ACCTR_A_is_debounce_integrator_1_high(basePointer) \
@@ -3366,8 +5959,19 @@ _SI32_ACCTR_A_is_debounce_integrator_1_high(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_ACCTR_A_read_count0(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->COUNT0.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_ACCTR_A_read_count0(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_read_count0(basePointer)
 #define SI32_ACCTR_A_read_count0(basePointer) \
@@ -3382,8 +5986,19 @@ _SI32_ACCTR_A_read_count0(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_ACCTR_A_read_count1(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->COUNT1.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_ACCTR_A_read_count1(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_read_count1(basePointer)
 #define SI32_ACCTR_A_read_count1(basePointer) \
@@ -3403,9 +6018,22 @@ _SI32_ACCTR_A_read_count1(SI32_ACCTR_A_Type* /*basePointer*/);
 ///  comp0
 ///  Valid range is 24 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_write_comp0(
+   SI32_ACCTR_A_Type * basePointer,
+   uint32_t comp0)
+{
+   assert(comp0 < 16777216);   // comp0 < 2^24
+   //{{
+   basePointer->COMP0.U32=comp0;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_write_comp0(SI32_ACCTR_A_Type* /*basePointer*/,
    uint32_t /*comp0*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_write_comp0(basePointer, comp0)
 #define SI32_ACCTR_A_write_comp0(basePointer, comp0) \
@@ -3420,8 +6048,19 @@ _SI32_ACCTR_A_write_comp0(SI32_ACCTR_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_ACCTR_A_read_comp0(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->COMP0.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_ACCTR_A_read_comp0(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_read_comp0(basePointer)
 #define SI32_ACCTR_A_read_comp0(basePointer) \
@@ -3441,9 +6080,22 @@ _SI32_ACCTR_A_read_comp0(SI32_ACCTR_A_Type* /*basePointer*/);
 ///  comp1
 ///  Valid range is 24 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_write_comp1(
+   SI32_ACCTR_A_Type * basePointer,
+   uint32_t comp1)
+{
+   assert(comp1 < 16777216);   // comp1 < 2^24
+   //{{
+   basePointer->COMP1.U32=comp1;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_write_comp1(SI32_ACCTR_A_Type* /*basePointer*/,
    uint32_t /*comp1*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_write_comp1(basePointer, comp1)
 #define SI32_ACCTR_A_write_comp1(basePointer, comp1) \
@@ -3458,8 +6110,19 @@ _SI32_ACCTR_A_write_comp1(SI32_ACCTR_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_ACCTR_A_read_comp1(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->COMP1.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_ACCTR_A_read_comp1(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_read_comp1(basePointer)
 #define SI32_ACCTR_A_read_comp1(basePointer) \
@@ -3479,9 +6142,21 @@ _SI32_ACCTR_A_read_comp1(SI32_ACCTR_A_Type* /*basePointer*/);
 ///  status
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_write_status(
+   SI32_ACCTR_A_Type * basePointer,
+   uint32_t status)
+{
+   //{{
+   basePointer->STATUS.U32 = status;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_write_status(SI32_ACCTR_A_Type* /*basePointer*/,
    uint32_t /*status*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_write_status(basePointer, status)
 #define SI32_ACCTR_A_write_status(basePointer, status) \
@@ -3496,8 +6171,19 @@ _SI32_ACCTR_A_write_status(SI32_ACCTR_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_ACCTR_A_read_status(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_ACCTR_A_read_status(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_read_status(basePointer)
 #define SI32_ACCTR_A_read_status(basePointer) \
@@ -3509,8 +6195,19 @@ _SI32_ACCTR_A_read_status(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_ACCTR_A_is_direction_change_interrupt_flag_set(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.DIRCHGI;
+   //}}
+}
+#else
 bool
 _SI32_ACCTR_A_is_direction_change_interrupt_flag_set(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_is_direction_change_interrupt_flag_set(basePointer)
 #define SI32_ACCTR_A_is_direction_change_interrupt_flag_set(basePointer) \
@@ -3522,8 +6219,19 @@ _SI32_ACCTR_A_is_direction_change_interrupt_flag_set(SI32_ACCTR_A_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_clear_direction_change_interrupt_flag(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS.DIRCHGI = SI32_ACCTR_A_STATUS_DIRCHGI_NOT_SET_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_clear_direction_change_interrupt_flag(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_clear_direction_change_interrupt_flag(basePointer)
 #define SI32_ACCTR_A_clear_direction_change_interrupt_flag(basePointer) \
@@ -3535,8 +6243,19 @@ _SI32_ACCTR_A_clear_direction_change_interrupt_flag(SI32_ACCTR_A_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_ACCTR_A_is_overflow_interrupt_flag_set(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.OVFI;
+   //}}
+}
+#else
 bool
 _SI32_ACCTR_A_is_overflow_interrupt_flag_set(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_is_overflow_interrupt_flag_set(basePointer)
 #define SI32_ACCTR_A_is_overflow_interrupt_flag_set(basePointer) \
@@ -3548,8 +6267,19 @@ _SI32_ACCTR_A_is_overflow_interrupt_flag_set(SI32_ACCTR_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_clear_overflow_interrupt_flag(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS.OVFI = SI32_ACCTR_A_STATUS_OVFI_NOT_SET_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_clear_overflow_interrupt_flag(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_clear_overflow_interrupt_flag(basePointer)
 #define SI32_ACCTR_A_clear_overflow_interrupt_flag(basePointer) \
@@ -3561,8 +6291,19 @@ _SI32_ACCTR_A_clear_overflow_interrupt_flag(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_ACCTR_A_is_digital_comparator_0_interrupt_flag_set(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.CMP0I;
+   //}}
+}
+#else
 bool
 _SI32_ACCTR_A_is_digital_comparator_0_interrupt_flag_set(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_is_digital_comparator_0_interrupt_flag_set(basePointer)
 #define SI32_ACCTR_A_is_digital_comparator_0_interrupt_flag_set(basePointer) \
@@ -3574,8 +6315,19 @@ _SI32_ACCTR_A_is_digital_comparator_0_interrupt_flag_set(SI32_ACCTR_A_Type* /*ba
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_clear_digital_comparator_0_interrupt_flag(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS.CMP0I = SI32_ACCTR_A_STATUS_CMP0I_NOT_SET_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_clear_digital_comparator_0_interrupt_flag(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_clear_digital_comparator_0_interrupt_flag(basePointer)
 #define SI32_ACCTR_A_clear_digital_comparator_0_interrupt_flag(basePointer) \
@@ -3587,8 +6339,19 @@ _SI32_ACCTR_A_clear_digital_comparator_0_interrupt_flag(SI32_ACCTR_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_ACCTR_A_is_digital_comparator_1_interrupt_flag_set(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.CMP1I;
+   //}}
+}
+#else
 bool
 _SI32_ACCTR_A_is_digital_comparator_1_interrupt_flag_set(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_is_digital_comparator_1_interrupt_flag_set(basePointer)
 #define SI32_ACCTR_A_is_digital_comparator_1_interrupt_flag_set(basePointer) \
@@ -3600,8 +6363,19 @@ _SI32_ACCTR_A_is_digital_comparator_1_interrupt_flag_set(SI32_ACCTR_A_Type* /*ba
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_clear_digital_comparator_1_interrupt_flag(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS.CMP1I = SI32_ACCTR_A_STATUS_CMP1I_NOT_SET_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_clear_digital_comparator_1_interrupt_flag(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_clear_digital_comparator_1_interrupt_flag(basePointer)
 #define SI32_ACCTR_A_clear_digital_comparator_1_interrupt_flag(basePointer) \
@@ -3613,8 +6387,19 @@ _SI32_ACCTR_A_clear_digital_comparator_1_interrupt_flag(SI32_ACCTR_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_ACCTR_A_is_debounce_integrator_interrupt_flag_set(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.TRANSI;
+   //}}
+}
+#else
 bool
 _SI32_ACCTR_A_is_debounce_integrator_interrupt_flag_set(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_is_debounce_integrator_interrupt_flag_set(basePointer)
 #define SI32_ACCTR_A_is_debounce_integrator_interrupt_flag_set(basePointer) \
@@ -3626,8 +6411,19 @@ _SI32_ACCTR_A_is_debounce_integrator_interrupt_flag_set(SI32_ACCTR_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_clear_debounce_integrator_interrupt_flag(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS.TRANSI = SI32_ACCTR_A_STATUS_TRANSI_NOT_SET_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_clear_debounce_integrator_interrupt_flag(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_clear_debounce_integrator_interrupt_flag(basePointer)
 #define SI32_ACCTR_A_clear_debounce_integrator_interrupt_flag(basePointer) \
@@ -3639,8 +6435,19 @@ _SI32_ACCTR_A_clear_debounce_integrator_interrupt_flag(SI32_ACCTR_A_Type* /*base
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_ACCTR_A_is_quadrature_error_interrupt_flag_set(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.QERRI;
+   //}}
+}
+#else
 bool
 _SI32_ACCTR_A_is_quadrature_error_interrupt_flag_set(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_is_quadrature_error_interrupt_flag_set(basePointer)
 #define SI32_ACCTR_A_is_quadrature_error_interrupt_flag_set(basePointer) \
@@ -3652,8 +6459,19 @@ _SI32_ACCTR_A_is_quadrature_error_interrupt_flag_set(SI32_ACCTR_A_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_clear_quadrature_error_interrupt_flag(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS.QERRI = SI32_ACCTR_A_STATUS_QERRI_NOT_SET_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_clear_quadrature_error_interrupt_flag(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_clear_quadrature_error_interrupt_flag(basePointer)
 #define SI32_ACCTR_A_clear_quadrature_error_interrupt_flag(basePointer) \
@@ -3665,8 +6483,19 @@ _SI32_ACCTR_A_clear_quadrature_error_interrupt_flag(SI32_ACCTR_A_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_ACCTR_A_is_flutter_stop_interrupt_flag_set(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.FLSTOPI;
+   //}}
+}
+#else
 bool
 _SI32_ACCTR_A_is_flutter_stop_interrupt_flag_set(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_is_flutter_stop_interrupt_flag_set(basePointer)
 #define SI32_ACCTR_A_is_flutter_stop_interrupt_flag_set(basePointer) \
@@ -3678,8 +6507,19 @@ _SI32_ACCTR_A_is_flutter_stop_interrupt_flag_set(SI32_ACCTR_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_clear_flutter_stop_interrupt_flag(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS.FLSTOPI = SI32_ACCTR_A_STATUS_FLSTOPI_NOT_SET_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_clear_flutter_stop_interrupt_flag(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_clear_flutter_stop_interrupt_flag(basePointer)
 #define SI32_ACCTR_A_clear_flutter_stop_interrupt_flag(basePointer) \
@@ -3691,8 +6531,19 @@ _SI32_ACCTR_A_clear_flutter_stop_interrupt_flag(SI32_ACCTR_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_ACCTR_A_is_flutter_start_interrupt_flag_set(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.FLSTARTI;
+   //}}
+}
+#else
 bool
 _SI32_ACCTR_A_is_flutter_start_interrupt_flag_set(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_is_flutter_start_interrupt_flag_set(basePointer)
 #define SI32_ACCTR_A_is_flutter_start_interrupt_flag_set(basePointer) \
@@ -3704,8 +6555,19 @@ _SI32_ACCTR_A_is_flutter_start_interrupt_flag_set(SI32_ACCTR_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_clear_flutter_start_interrupt_flag(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS.FLSTARTI = SI32_ACCTR_A_STATUS_FLSTARTI_NOT_SET_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_clear_flutter_start_interrupt_flag(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_clear_flutter_start_interrupt_flag(basePointer)
 #define SI32_ACCTR_A_clear_flutter_start_interrupt_flag(basePointer) \
@@ -3717,8 +6579,19 @@ _SI32_ACCTR_A_clear_flutter_start_interrupt_flag(SI32_ACCTR_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_enable_direction_change_interrupt(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS.DIRCHGIEN = SI32_ACCTR_A_STATUS_DIRCHGIEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_enable_direction_change_interrupt(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_enable_direction_change_interrupt(basePointer)
 #define SI32_ACCTR_A_enable_direction_change_interrupt(basePointer) \
@@ -3730,8 +6603,19 @@ _SI32_ACCTR_A_enable_direction_change_interrupt(SI32_ACCTR_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_disable_direction_change_interrupt(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS.DIRCHGIEN = SI32_ACCTR_A_STATUS_DIRCHGIEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_disable_direction_change_interrupt(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_disable_direction_change_interrupt(basePointer)
 #define SI32_ACCTR_A_disable_direction_change_interrupt(basePointer) \
@@ -3743,8 +6627,19 @@ _SI32_ACCTR_A_disable_direction_change_interrupt(SI32_ACCTR_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_enable_counter_overflow_interrupt(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS.OVFIEN = SI32_ACCTR_A_STATUS_OVFIEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_enable_counter_overflow_interrupt(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_enable_counter_overflow_interrupt(basePointer)
 #define SI32_ACCTR_A_enable_counter_overflow_interrupt(basePointer) \
@@ -3756,8 +6651,19 @@ _SI32_ACCTR_A_enable_counter_overflow_interrupt(SI32_ACCTR_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_disable_counter_overflow_interrupt(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS.OVFIEN = SI32_ACCTR_A_STATUS_OVFIEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_disable_counter_overflow_interrupt(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_disable_counter_overflow_interrupt(basePointer)
 #define SI32_ACCTR_A_disable_counter_overflow_interrupt(basePointer) \
@@ -3769,8 +6675,19 @@ _SI32_ACCTR_A_disable_counter_overflow_interrupt(SI32_ACCTR_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_enable_digital_comparator_0_interrupt(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS.CMP0IEN = SI32_ACCTR_A_STATUS_CMP0IEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_enable_digital_comparator_0_interrupt(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_enable_digital_comparator_0_interrupt(basePointer)
 #define SI32_ACCTR_A_enable_digital_comparator_0_interrupt(basePointer) \
@@ -3782,8 +6699,19 @@ _SI32_ACCTR_A_enable_digital_comparator_0_interrupt(SI32_ACCTR_A_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_disable_digital_comparator_0_interrupt(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS.CMP0IEN = SI32_ACCTR_A_STATUS_CMP0IEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_disable_digital_comparator_0_interrupt(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_disable_digital_comparator_0_interrupt(basePointer)
 #define SI32_ACCTR_A_disable_digital_comparator_0_interrupt(basePointer) \
@@ -3795,8 +6723,19 @@ _SI32_ACCTR_A_disable_digital_comparator_0_interrupt(SI32_ACCTR_A_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_enable_digital_comparator_1_interrupt(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS.CMP1IEN = SI32_ACCTR_A_STATUS_CMP1IEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_enable_digital_comparator_1_interrupt(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_enable_digital_comparator_1_interrupt(basePointer)
 #define SI32_ACCTR_A_enable_digital_comparator_1_interrupt(basePointer) \
@@ -3808,8 +6747,19 @@ _SI32_ACCTR_A_enable_digital_comparator_1_interrupt(SI32_ACCTR_A_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_disable_digital_comparator_1_interrupt(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS.CMP1IEN = SI32_ACCTR_A_STATUS_CMP1IEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_disable_digital_comparator_1_interrupt(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_disable_digital_comparator_1_interrupt(basePointer)
 #define SI32_ACCTR_A_disable_digital_comparator_1_interrupt(basePointer) \
@@ -3821,8 +6771,19 @@ _SI32_ACCTR_A_disable_digital_comparator_1_interrupt(SI32_ACCTR_A_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_enable_debounce_integrator_interrupt(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS.TRANSIEN = SI32_ACCTR_A_STATUS_TRANSIEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_enable_debounce_integrator_interrupt(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_enable_debounce_integrator_interrupt(basePointer)
 #define SI32_ACCTR_A_enable_debounce_integrator_interrupt(basePointer) \
@@ -3834,8 +6795,19 @@ _SI32_ACCTR_A_enable_debounce_integrator_interrupt(SI32_ACCTR_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_disable_debounce_integrator_interrupt(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS.TRANSIEN = SI32_ACCTR_A_STATUS_TRANSIEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_disable_debounce_integrator_interrupt(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_disable_debounce_integrator_interrupt(basePointer)
 #define SI32_ACCTR_A_disable_debounce_integrator_interrupt(basePointer) \
@@ -3847,8 +6819,19 @@ _SI32_ACCTR_A_disable_debounce_integrator_interrupt(SI32_ACCTR_A_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_enable_quadrature_error_interrupt(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS.QERRIEN = SI32_ACCTR_A_STATUS_QERRIEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_enable_quadrature_error_interrupt(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_enable_quadrature_error_interrupt(basePointer)
 #define SI32_ACCTR_A_enable_quadrature_error_interrupt(basePointer) \
@@ -3860,8 +6843,19 @@ _SI32_ACCTR_A_enable_quadrature_error_interrupt(SI32_ACCTR_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_disable_quadrature_error_interrupt(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS.QERRIEN = SI32_ACCTR_A_STATUS_QERRIEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_disable_quadrature_error_interrupt(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_disable_quadrature_error_interrupt(basePointer)
 #define SI32_ACCTR_A_disable_quadrature_error_interrupt(basePointer) \
@@ -3873,8 +6867,19 @@ _SI32_ACCTR_A_disable_quadrature_error_interrupt(SI32_ACCTR_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_enable_flutter_stop_interrupt(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS.FLSTOPIEN = SI32_ACCTR_A_STATUS_FLSTOPIEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_enable_flutter_stop_interrupt(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_enable_flutter_stop_interrupt(basePointer)
 #define SI32_ACCTR_A_enable_flutter_stop_interrupt(basePointer) \
@@ -3886,8 +6891,19 @@ _SI32_ACCTR_A_enable_flutter_stop_interrupt(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_disable_flutter_stop_interrupt(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS.FLSTOPIEN = SI32_ACCTR_A_STATUS_FLSTOPIEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_disable_flutter_stop_interrupt(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_disable_flutter_stop_interrupt(basePointer)
 #define SI32_ACCTR_A_disable_flutter_stop_interrupt(basePointer) \
@@ -3899,8 +6915,19 @@ _SI32_ACCTR_A_disable_flutter_stop_interrupt(SI32_ACCTR_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_enable_flutter_start_interrupt(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS.FLSTARTIEN = SI32_ACCTR_A_STATUS_FLSTARTIEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_enable_flutter_start_interrupt(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_enable_flutter_start_interrupt(basePointer)
 #define SI32_ACCTR_A_enable_flutter_start_interrupt(basePointer) \
@@ -3912,8 +6939,19 @@ _SI32_ACCTR_A_enable_flutter_start_interrupt(SI32_ACCTR_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_disable_flutter_start_interrupt(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS.FLSTARTIEN = SI32_ACCTR_A_STATUS_FLSTARTIEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_disable_flutter_start_interrupt(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_disable_flutter_start_interrupt(basePointer)
 #define SI32_ACCTR_A_disable_flutter_start_interrupt(basePointer) \
@@ -3925,8 +6963,19 @@ _SI32_ACCTR_A_disable_flutter_start_interrupt(SI32_ACCTR_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_ACCTR_A_is_debounce_integrator_0_output_high(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.IN0;
+   //}}
+}
+#else
 bool
 _SI32_ACCTR_A_is_debounce_integrator_0_output_high(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_is_debounce_integrator_0_output_high(basePointer)
 #define SI32_ACCTR_A_is_debounce_integrator_0_output_high(basePointer) \
@@ -3938,8 +6987,19 @@ _SI32_ACCTR_A_is_debounce_integrator_0_output_high(SI32_ACCTR_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_ACCTR_A_is_debounce_integrator_1_output_high(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.IN1;
+   //}}
+}
+#else
 bool
 _SI32_ACCTR_A_is_debounce_integrator_1_output_high(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_is_debounce_integrator_1_output_high(basePointer)
 #define SI32_ACCTR_A_is_debounce_integrator_1_output_high(basePointer) \
@@ -3951,8 +7011,19 @@ _SI32_ACCTR_A_is_debounce_integrator_1_output_high(SI32_ACCTR_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide8_t
+_SI32_ACCTR_A_get_pulse_counter_state(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.STATE;
+   //}}
+}
+#else
 uwide8_t
 _SI32_ACCTR_A_get_pulse_counter_state(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_get_pulse_counter_state(basePointer)
 #define SI32_ACCTR_A_get_pulse_counter_state(basePointer) \
@@ -3964,8 +7035,19 @@ _SI32_ACCTR_A_get_pulse_counter_state(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_ACCTR_A_is_flutter_detetion_flag_set(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.FLF;
+   //}}
+}
+#else
 bool
 _SI32_ACCTR_A_is_flutter_detetion_flag_set(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_is_flutter_detetion_flag_set(basePointer)
 #define SI32_ACCTR_A_is_flutter_detetion_flag_set(basePointer) \
@@ -3977,8 +7059,19 @@ _SI32_ACCTR_A_is_flutter_detetion_flag_set(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide8_t
+_SI32_ACCTR_A_get_history(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.DIRHIST;
+   //}}
+}
+#else
 uwide8_t
 _SI32_ACCTR_A_get_history(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_get_history(basePointer)
 #define SI32_ACCTR_A_get_history(basePointer) \
@@ -3990,8 +7083,19 @@ _SI32_ACCTR_A_get_history(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_ACCTR_A_is_analog_comparator_0_output_high(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.CMP0OUT;
+   //}}
+}
+#else
 bool
 _SI32_ACCTR_A_is_analog_comparator_0_output_high(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_is_analog_comparator_0_output_high(basePointer)
 #define SI32_ACCTR_A_is_analog_comparator_0_output_high(basePointer) \
@@ -4003,8 +7107,19 @@ _SI32_ACCTR_A_is_analog_comparator_0_output_high(SI32_ACCTR_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_ACCTR_A_is_analog_comparator_1_output_high(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.CMP1OUT;
+   //}}
+}
+#else
 bool
 _SI32_ACCTR_A_is_analog_comparator_1_output_high(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_is_analog_comparator_1_output_high(basePointer)
 #define SI32_ACCTR_A_is_analog_comparator_1_output_high(basePointer) \
@@ -4019,8 +7134,19 @@ _SI32_ACCTR_A_is_analog_comparator_1_output_high(SI32_ACCTR_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_enable_debug_output(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->DEBUGEN.DBGOEN = SI32_ACCTR_A_DEBUGEN_DBGOEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_enable_debug_output(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_enable_debug_output(basePointer)
 #define SI32_ACCTR_A_enable_debug_output(basePointer) \
@@ -4035,8 +7161,19 @@ _SI32_ACCTR_A_enable_debug_output(SI32_ACCTR_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ACCTR_A_disable_debug_output(
+   SI32_ACCTR_A_Type * basePointer)
+{
+   //{{
+   basePointer->DEBUGEN.DBGOEN = SI32_ACCTR_A_DEBUGEN_DBGOEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ACCTR_A_disable_debug_output(SI32_ACCTR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ACCTR_A_disable_debug_output(basePointer)
 #define SI32_ACCTR_A_disable_debug_output(basePointer) \
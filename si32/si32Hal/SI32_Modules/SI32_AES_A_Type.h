@@ -66,11 +66,27 @@ extern "C" {
 ///  status
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_initialize(
+   SI32_AES_A_Type * basePointer,
+   uint32_t control,
+   uint32_t xfrsize,
+   uint32_t status)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   basePointer->XFRSIZE.U32 = xfrsize;
+   basePointer->STATUS.U32 = status;
+   //}}
+}
+#else
 void
 _SI32_AES_A_initialize(SI32_AES_A_Type* /*basePointer*/,
    uint32_t, /*control*/
    uint32_t, /*xfrsize*/
    uint32_t /*status*/);
+#endif
 ///
 /// @def SI32_AES_A_initialize(basePointer, control, xfrsize, status)
 #define SI32_AES_A_initialize(basePointer, control, xfrsize, status) do{  \
@@ -93,9 +109,21 @@ _SI32_AES_A_initialize(SI32_AES_A_Type* /*basePointer*/,
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_write_control(
+   SI32_AES_A_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_AES_A_write_control(SI32_AES_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_AES_A_write_control(basePointer, control)
 #define SI32_AES_A_write_control(basePointer, control) \
@@ -110,8 +138,19 @@ _SI32_AES_A_write_control(SI32_AES_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_AES_A_read_control(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_AES_A_read_control(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_read_control(basePointer)
 #define SI32_AES_A_read_control(basePointer) \
@@ -123,8 +162,19 @@ _SI32_AES_A_read_control(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_start_operation(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_AES_A_CONTROL_XFRSTA_START_U32;
+   //}}
+}
+#else
 void
 _SI32_AES_A_start_operation(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_start_operation(basePointer)
 #define SI32_AES_A_start_operation(basePointer) \
@@ -136,8 +186,19 @@ _SI32_AES_A_start_operation(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_enable_key_capture(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_AES_A_CONTROL_KEYCPEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_AES_A_enable_key_capture(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_enable_key_capture(basePointer)
 #define SI32_AES_A_enable_key_capture(basePointer) \
@@ -149,8 +210,19 @@ _SI32_AES_A_enable_key_capture(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_disable_key_capture(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_AES_A_CONTROL_KEYCPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_AES_A_disable_key_capture(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_disable_key_capture(basePointer)
 #define SI32_AES_A_disable_key_capture(basePointer) \
@@ -162,8 +234,19 @@ _SI32_AES_A_disable_key_capture(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_select_encryption_mode(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_AES_A_CONTROL_EDMD_ENCRYPT_U32;
+   //}}
+}
+#else
 void
 _SI32_AES_A_select_encryption_mode(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_select_encryption_mode(basePointer)
 #define SI32_AES_A_select_encryption_mode(basePointer) \
@@ -175,8 +258,19 @@ _SI32_AES_A_select_encryption_mode(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_select_decryption_mode(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_AES_A_CONTROL_EDMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_AES_A_select_decryption_mode(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_select_decryption_mode(basePointer)
 #define SI32_AES_A_select_decryption_mode(basePointer) \
@@ -191,8 +285,19 @@ _SI32_AES_A_select_decryption_mode(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_select_software_mode(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_AES_A_CONTROL_SWMDEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_AES_A_select_software_mode(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_select_software_mode(basePointer)
 #define SI32_AES_A_select_software_mode(basePointer) \
@@ -207,8 +312,19 @@ _SI32_AES_A_select_software_mode(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_select_dma_mode(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_AES_A_CONTROL_SWMDEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_AES_A_select_dma_mode(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_select_dma_mode(basePointer)
 #define SI32_AES_A_select_dma_mode(basePointer) \
@@ -220,8 +336,19 @@ _SI32_AES_A_select_dma_mode(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_enter_bypass_hardware_mode(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_AES_A_CONTROL_BEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_AES_A_enter_bypass_hardware_mode(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_enter_bypass_hardware_mode(basePointer)
 #define SI32_AES_A_enter_bypass_hardware_mode(basePointer) \
@@ -233,8 +360,19 @@ _SI32_AES_A_enter_bypass_hardware_mode(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_exit_bypass_hardware_mode(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_AES_A_CONTROL_BEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_AES_A_exit_bypass_hardware_mode(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_exit_bypass_hardware_mode(basePointer)
 #define SI32_AES_A_exit_bypass_hardware_mode(basePointer) \
@@ -246,8 +384,19 @@ _SI32_AES_A_exit_bypass_hardware_mode(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_select_xor_path_none(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_AES_A_CONTROL_XOREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_AES_A_select_xor_path_none(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_select_xor_path_none(basePointer)
 #define SI32_AES_A_select_xor_path_none(basePointer) \
@@ -259,8 +408,20 @@ _SI32_AES_A_select_xor_path_none(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_select_xor_path_input(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_AES_A_CONTROL_XOREN_MASK;
+   basePointer->CONTROL_SET = SI32_AES_A_CONTROL_XOREN_XOR_INPUT_U32;
+   //}}
+}
+#else
 void
 _SI32_AES_A_select_xor_path_input(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_select_xor_path_input(basePointer)
 #define SI32_AES_A_select_xor_path_input(basePointer) do{  \
@@ -274,8 +435,20 @@ _SI32_AES_A_select_xor_path_input(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_select_xor_path_output(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_AES_A_CONTROL_XOREN_MASK;
+   basePointer->CONTROL_SET = SI32_AES_A_CONTROL_XOREN_XOR_OUTPUT_U32;
+   //}}
+}
+#else
 void
 _SI32_AES_A_select_xor_path_output(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_select_xor_path_output(basePointer)
 #define SI32_AES_A_select_xor_path_output(basePointer) do{  \
@@ -289,8 +462,19 @@ _SI32_AES_A_select_xor_path_output(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_enter_counter_mode(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_AES_A_CONTROL_HCTREN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_AES_A_enter_counter_mode(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_enter_counter_mode(basePointer)
 #define SI32_AES_A_enter_counter_mode(basePointer) \
@@ -302,8 +486,19 @@ _SI32_AES_A_enter_counter_mode(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_exit_counter_mode(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_AES_A_CONTROL_HCTREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_AES_A_exit_counter_mode(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_exit_counter_mode(basePointer)
 #define SI32_AES_A_exit_counter_mode(basePointer) \
@@ -315,8 +510,19 @@ _SI32_AES_A_exit_counter_mode(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_enter_cipher_block_chaining_mode(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_AES_A_CONTROL_HCBCEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_AES_A_enter_cipher_block_chaining_mode(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_enter_cipher_block_chaining_mode(basePointer)
 #define SI32_AES_A_enter_cipher_block_chaining_mode(basePointer) \
@@ -328,8 +534,19 @@ _SI32_AES_A_enter_cipher_block_chaining_mode(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_exit_cipher_block_chaining_mode(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_AES_A_CONTROL_HCBCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_AES_A_exit_cipher_block_chaining_mode(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_exit_cipher_block_chaining_mode(basePointer)
 #define SI32_AES_A_exit_cipher_block_chaining_mode(basePointer) \
@@ -341,8 +558,19 @@ _SI32_AES_A_exit_cipher_block_chaining_mode(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_select_key_size_128(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_AES_A_CONTROL_KEYSIZE_MASK;
+   //}}
+}
+#else
 void
 _SI32_AES_A_select_key_size_128(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_select_key_size_128(basePointer)
 #define SI32_AES_A_select_key_size_128(basePointer) \
@@ -354,8 +582,20 @@ _SI32_AES_A_select_key_size_128(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_select_key_size_192(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_AES_A_CONTROL_KEYSIZE_MASK;
+   basePointer->CONTROL_SET = SI32_AES_A_CONTROL_KEYSIZE_KEY192_U32;
+   //}}
+}
+#else
 void
 _SI32_AES_A_select_key_size_192(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_select_key_size_192(basePointer)
 #define SI32_AES_A_select_key_size_192(basePointer) do{  \
@@ -369,8 +609,20 @@ _SI32_AES_A_select_key_size_192(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_select_key_size_256(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_AES_A_CONTROL_KEYSIZE_MASK;
+   basePointer->CONTROL_SET = SI32_AES_A_CONTROL_KEYSIZE_KEY256_U32;
+   //}}
+}
+#else
 void
 _SI32_AES_A_select_key_size_256(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_select_key_size_256(basePointer)
 #define SI32_AES_A_select_key_size_256(basePointer) do{  \
@@ -384,8 +636,19 @@ _SI32_AES_A_select_key_size_256(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_enable_error_interrupt(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_AES_A_CONTROL_ERRIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_AES_A_enable_error_interrupt(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_enable_error_interrupt(basePointer)
 #define SI32_AES_A_enable_error_interrupt(basePointer) \
@@ -397,8 +660,19 @@ _SI32_AES_A_enable_error_interrupt(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_disable_error_interrupt(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_AES_A_CONTROL_ERRIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_AES_A_disable_error_interrupt(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_disable_error_interrupt(basePointer)
 #define SI32_AES_A_disable_error_interrupt(basePointer) \
@@ -410,8 +684,19 @@ _SI32_AES_A_disable_error_interrupt(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_AES_A_is_error_interrupt_enabled(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.ERRIEN);
+   //}}
+}
+#else
 bool
 _SI32_AES_A_is_error_interrupt_enabled(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_is_error_interrupt_enabled(basePointer)
 #define SI32_AES_A_is_error_interrupt_enabled(basePointer) \
@@ -423,8 +708,19 @@ _SI32_AES_A_is_error_interrupt_enabled(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_enable_operation_complete_interrupt(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_AES_A_CONTROL_OCIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_AES_A_enable_operation_complete_interrupt(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_enable_operation_complete_interrupt(basePointer)
 #define SI32_AES_A_enable_operation_complete_interrupt(basePointer) \
@@ -436,8 +732,19 @@ _SI32_AES_A_enable_operation_complete_interrupt(SI32_AES_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_disable_operation_complete_interrupt(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_AES_A_CONTROL_OCIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_AES_A_disable_operation_complete_interrupt(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_disable_operation_complete_interrupt(basePointer)
 #define SI32_AES_A_disable_operation_complete_interrupt(basePointer) \
@@ -449,8 +756,19 @@ _SI32_AES_A_disable_operation_complete_interrupt(SI32_AES_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_AES_A_is_operation_complete_interrupt_enabled(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.OCIEN);
+   //}}
+}
+#else
 bool
 _SI32_AES_A_is_operation_complete_interrupt_enabled(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_is_operation_complete_interrupt_enabled(basePointer)
 #define SI32_AES_A_is_operation_complete_interrupt_enabled(basePointer) \
@@ -462,8 +780,19 @@ _SI32_AES_A_is_operation_complete_interrupt_enabled(SI32_AES_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_enable_stall_in_debug_mode(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_AES_A_CONTROL_DBGMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_AES_A_enable_stall_in_debug_mode(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_enable_stall_in_debug_mode(basePointer)
 #define SI32_AES_A_enable_stall_in_debug_mode(basePointer) \
@@ -475,8 +804,19 @@ _SI32_AES_A_enable_stall_in_debug_mode(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_disable_stall_in_debug_mode(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_AES_A_CONTROL_DBGMD_RUN_U32;
+   //}}
+}
+#else
 void
 _SI32_AES_A_disable_stall_in_debug_mode(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_disable_stall_in_debug_mode(basePointer)
 #define SI32_AES_A_disable_stall_in_debug_mode(basePointer) \
@@ -488,8 +828,19 @@ _SI32_AES_A_disable_stall_in_debug_mode(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_enable_module(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_AES_A_CONTROL_RESET_MASK;
+   //}}
+}
+#else
 void
 _SI32_AES_A_enable_module(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_enable_module(basePointer)
 #define SI32_AES_A_enable_module(basePointer) \
@@ -501,8 +852,19 @@ _SI32_AES_A_enable_module(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_disable_module(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_AES_A_CONTROL_RESET_ACTIVE_U32;
+   //}}
+}
+#else
 void
 _SI32_AES_A_disable_module(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_disable_module(basePointer)
 #define SI32_AES_A_disable_module(basePointer) \
@@ -517,8 +879,20 @@ _SI32_AES_A_disable_module(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_reset_module(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_AES_A_CONTROL_RESET_ACTIVE_U32;
+   basePointer->CONTROL_CLR = SI32_AES_A_CONTROL_RESET_MASK;
+   //}}
+}
+#else
 void
 _SI32_AES_A_reset_module(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_reset_module(basePointer)
 #define SI32_AES_A_reset_module(basePointer) do{  \
@@ -541,9 +915,21 @@ _SI32_AES_A_reset_module(SI32_AES_A_Type* /*basePointer*/);
 ///  xfrsize
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_write_xfrsize(
+   SI32_AES_A_Type * basePointer,
+   uint32_t xfrsize)
+{
+   //{{
+   basePointer->XFRSIZE.U32 = xfrsize;
+   //}}
+}
+#else
 void
 _SI32_AES_A_write_xfrsize(SI32_AES_A_Type* /*basePointer*/,
    uint32_t /*xfrsize*/);
+#endif
 ///
 /// @def SI32_AES_A_write_xfrsize(basePointer, xfrsize)
 #define SI32_AES_A_write_xfrsize(basePointer, xfrsize) \
@@ -559,8 +945,19 @@ _SI32_AES_A_write_xfrsize(SI32_AES_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_AES_A_read_xfrsize(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   return basePointer->XFRSIZE.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_AES_A_read_xfrsize(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_read_xfrsize(basePointer)
 #define SI32_AES_A_read_xfrsize(basePointer) \
@@ -579,9 +976,21 @@ _SI32_AES_A_read_xfrsize(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  data_word
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_write_datafifo(
+   SI32_AES_A_Type * basePointer,
+   uint32_t data_word)
+{
+   //{{
+   basePointer->DATAFIFO.U32 = data_word;
+   //}}
+}
+#else
 void
 _SI32_AES_A_write_datafifo(SI32_AES_A_Type* /*basePointer*/,
    uint32_t /*data_word*/);
+#endif
 ///
 /// @def SI32_AES_A_write_datafifo(basePointer, data_word)
 #define SI32_AES_A_write_datafifo(basePointer, data_word) \
@@ -596,8 +1005,19 @@ _SI32_AES_A_write_datafifo(SI32_AES_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_AES_A_read_datafifo(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DATAFIFO.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_AES_A_read_datafifo(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_read_datafifo(basePointer)
 #define SI32_AES_A_read_datafifo(basePointer) \
@@ -616,9 +1036,21 @@ _SI32_AES_A_read_datafifo(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  xor_word
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_write_xorfifo(
+   SI32_AES_A_Type * basePointer,
+   uint32_t xor_word)
+{
+   //{{
+   basePointer->XORFIFO.U32 = xor_word;
+   //}}
+}
+#else
 void
 _SI32_AES_A_write_xorfifo(SI32_AES_A_Type* /*basePointer*/,
    uint32_t /*xor_word*/);
+#endif
 ///
 /// @def SI32_AES_A_write_xorfifo(basePointer, xor_word)
 #define SI32_AES_A_write_xorfifo(basePointer, xor_word) \
@@ -638,9 +1070,24 @@ _SI32_AES_A_write_xorfifo(SI32_AES_A_Type* /*basePointer*/,
 /// @param[in]
 ///  xor_vector
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_write_xorfifo_full(
+   SI32_AES_A_Type * basePointer,
+   SI32_AES_A_Initialization_Vector_Type xor_vector)
+{
+   //{{
+   basePointer->XORFIFO.U32 = xor_vector.iv[0];
+   basePointer->XORFIFO.U32 = xor_vector.iv[1];
+   basePointer->XORFIFO.U32 = xor_vector.iv[2];
+   basePointer->XORFIFO.U32 = xor_vector.iv[3];
+   //}}
+}
+#else
 void
 _SI32_AES_A_write_xorfifo_full(SI32_AES_A_Type* /*basePointer*/,
    SI32_AES_A_Initialization_Vector_Type /*xor_vector*/);
+#endif
 ///
 /// @def SI32_AES_A_write_xorfifo_full(basePointer, xor_vector)
 #define SI32_AES_A_write_xorfifo_full(basePointer, xor_vector) do{  \
@@ -666,9 +1113,48 @@ _SI32_AES_A_write_xorfifo_full(SI32_AES_A_Type* /*basePointer*/,
 /// @param[in]
 ///  key
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_write_hardware_key(
+   SI32_AES_A_Type * basePointer,
+   SI32_AES_A_Hardware_Key_Type key)
+{
+   //{{
+   basePointer->HWKEY0.HWKEY0_BITS = key.hwkey[0];
+   basePointer->HWKEY1.HWKEY1_BITS = key.hwkey[1];
+   basePointer->HWKEY2.HWKEY2_BITS = key.hwkey[2];
+   basePointer->HWKEY3.HWKEY3_BITS = key.hwkey[3];
+   if (basePointer->CONTROL.KEYSIZE
+       == SI32_AES_A_CONTROL_KEYSIZE_KEY128_VALUE)
+   {
+      basePointer->HWKEY4.HWKEY4_BITS = 0;
+      basePointer->HWKEY5.HWKEY5_BITS = 0;
+      basePointer->HWKEY6.HWKEY6_BITS = 0;
+      basePointer->HWKEY7.HWKEY7_BITS = 0;
+   }
+   else if (basePointer->CONTROL.KEYSIZE
+            == SI32_AES_A_CONTROL_KEYSIZE_KEY192_VALUE)
+   {
+      basePointer->HWKEY4.HWKEY4_BITS = key.hwkey[4];
+      basePointer->HWKEY5.HWKEY5_BITS = key.hwkey[5];
+      basePointer->HWKEY6.HWKEY6_BITS = 0;
+      basePointer->HWKEY7.HWKEY7_BITS = 0;
+   }
+   else if (basePointer->CONTROL.KEYSIZE
+            == SI32_AES_A_CONTROL_KEYSIZE_KEY256_VALUE)
+   {
+      basePointer->HWKEY4.HWKEY4_BITS = key.hwkey[4];
+      basePointer->HWKEY5.HWKEY5_BITS = key.hwkey[5];
+      basePointer->HWKEY6.HWKEY6_BITS = key.hwkey[6];
+      basePointer->HWKEY7.HWKEY7_BITS = key.hwkey[7];
+   }
+   //}}
+}
+#else
 void
 _SI32_AES_A_write_hardware_key(SI32_AES_A_Type* /*basePointer*/,
    SI32_AES_A_Hardware_Key_Type /*key*/);
+#endif
 ///
 /// @def SI32_AES_A_write_hardware_key(basePointer, key)
 #define SI32_AES_A_write_hardware_key(basePointer, key) \
@@ -686,8 +1172,48 @@ _SI32_AES_A_write_hardware_key(SI32_AES_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline SI32_AES_A_Hardware_Key_Type
+_SI32_AES_A_read_hardware_key(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   SI32_AES_A_Hardware_Key_Type ret;
+   ret.hwkey[0] = basePointer->HWKEY0.HWKEY0_BITS;
+   ret.hwkey[1] = basePointer->HWKEY1.HWKEY1_BITS;
+   ret.hwkey[2] = basePointer->HWKEY2.HWKEY2_BITS;
+   ret.hwkey[3] = basePointer->HWKEY3.HWKEY3_BITS;
+   if (basePointer->CONTROL.KEYSIZE
+       == SI32_AES_A_CONTROL_KEYSIZE_KEY128_VALUE)
+   {
+      ret.hwkey[4] = 0;
+      ret.hwkey[5] = 0;
+      ret.hwkey[6] = 0;
+      ret.hwkey[7] = 0;
+   }
+   else if (basePointer->CONTROL.KEYSIZE
+            == SI32_AES_A_CONTROL_KEYSIZE_KEY192_VALUE)
+   {
+      ret.hwkey[4] = basePointer->HWKEY4.HWKEY4_BITS;
+      ret.hwkey[5] = basePointer->HWKEY5.HWKEY5_BITS;
+      ret.hwkey[6] = 0;
+      ret.hwkey[7] = 0;
+   }
+   else if (basePointer->CONTROL.KEYSIZE
+            == SI32_AES_A_CONTROL_KEYSIZE_KEY256_VALUE)
+   {
+      ret.hwkey[4] = basePointer->HWKEY4.HWKEY4_BITS;
+      ret.hwkey[5] = basePointer->HWKEY5.HWKEY5_BITS;
+      ret.hwkey[6] = basePointer->HWKEY6.HWKEY6_BITS;
+      ret.hwkey[7] = basePointer->HWKEY7.HWKEY7_BITS;
+   }
+   return ret;
+   //}}
+}
+#else
 SI32_AES_A_Hardware_Key_Type
 _SI32_AES_A_read_hardware_key(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_read_hardware_key(basePointer)
 #define SI32_AES_A_read_hardware_key(basePointer) \
@@ -707,9 +1233,24 @@ _SI32_AES_A_read_hardware_key(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  counter
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_write_hardware_counter(
+   SI32_AES_A_Type * basePointer,
+   SI32_AES_A_Hardware_Counter_Type counter)
+{
+   //{{
+   basePointer->HWCTR0.HWCTR0_BITS = counter.hwctr[0];
+   basePointer->HWCTR1.HWCTR1_BITS = counter.hwctr[1];
+   basePointer->HWCTR2.HWCTR2_BITS = counter.hwctr[2];
+   basePointer->HWCTR3.HWCTR3_BITS = counter.hwctr[3];
+   //}}
+}
+#else
 void
 _SI32_AES_A_write_hardware_counter(SI32_AES_A_Type* /*basePointer*/,
    SI32_AES_A_Hardware_Counter_Type /*counter*/);
+#endif
 ///
 /// @def SI32_AES_A_write_hardware_counter(basePointer, counter)
 #define SI32_AES_A_write_hardware_counter(basePointer, counter) do{  \
@@ -729,8 +1270,24 @@ _SI32_AES_A_write_hardware_counter(SI32_AES_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline SI32_AES_A_Hardware_Counter_Type
+_SI32_AES_A_read_hardware_counter(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   SI32_AES_A_Hardware_Counter_Type counter;
+   counter.hwctr[0] = basePointer->HWCTR0.HWCTR0_BITS;
+   counter.hwctr[1] = basePointer->HWCTR1.HWCTR1_BITS;
+   counter.hwctr[2] = basePointer->HWCTR2.HWCTR2_BITS;
+   counter.hwctr[3] = basePointer->HWCTR3.HWCTR3_BITS;
+   return counter;
+   //}}
+}
+#else
 SI32_AES_A_Hardware_Counter_Type
 _SI32_AES_A_read_hardware_counter(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_read_hardware_counter(basePointer)
 #define SI32_AES_A_read_hardware_counter(basePointer) \
@@ -750,9 +1307,21 @@ _SI32_AES_A_read_hardware_counter(SI32_AES_A_Type* /*basePointer*/);
 ///  status
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_write_status(
+   SI32_AES_A_Type * basePointer,
+   uint32_t status)
+{
+   //{{
+   basePointer->STATUS.U32 = status;
+   //}}
+}
+#else
 void
 _SI32_AES_A_write_status(SI32_AES_A_Type* /*basePointer*/,
    uint32_t /*status*/);
+#endif
 ///
 /// @def SI32_AES_A_write_status(basePointer, status)
 #define SI32_AES_A_write_status(basePointer, status) \
@@ -767,8 +1336,19 @@ _SI32_AES_A_write_status(SI32_AES_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_AES_A_read_status(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_AES_A_read_status(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_read_status(basePointer)
 #define SI32_AES_A_read_status(basePointer) \
@@ -780,8 +1360,19 @@ _SI32_AES_A_read_status(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_AES_A_has_data_underrun_occurred(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->STATUS.DURF);
+   //}}
+}
+#else
 bool
 _SI32_AES_A_has_data_underrun_occurred(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_has_data_underrun_occurred(basePointer)
 #define SI32_AES_A_has_data_underrun_occurred(basePointer) \
@@ -793,8 +1384,19 @@ _SI32_AES_A_has_data_underrun_occurred(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_AES_A_has_data_overrun_occurred(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->STATUS.DORF);
+   //}}
+}
+#else
 bool
 _SI32_AES_A_has_data_overrun_occurred(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_has_data_overrun_occurred(basePointer)
 #define SI32_AES_A_has_data_overrun_occurred(basePointer) \
@@ -806,8 +1408,19 @@ _SI32_AES_A_has_data_overrun_occurred(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_AES_A_has_xor_data_overrun_occurred(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->STATUS.XORF);
+   //}}
+}
+#else
 bool
 _SI32_AES_A_has_xor_data_overrun_occurred(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_has_xor_data_overrun_occurred(basePointer)
 #define SI32_AES_A_has_xor_data_overrun_occurred(basePointer) \
@@ -822,8 +1435,19 @@ _SI32_AES_A_has_xor_data_overrun_occurred(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_AES_A_get_datafifo_count(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.DFIFOLVL;
+   //}}
+}
+#else
 uint32_t
 _SI32_AES_A_get_datafifo_count(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_get_datafifo_count(basePointer)
 #define SI32_AES_A_get_datafifo_count(basePointer) \
@@ -838,8 +1462,19 @@ _SI32_AES_A_get_datafifo_count(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_AES_A_get_xorfifo_count(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.XFIFOLVL;
+   //}}
+}
+#else
 uint32_t
 _SI32_AES_A_get_xorfifo_count(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_get_xorfifo_count(basePointer)
 #define SI32_AES_A_get_xorfifo_count(basePointer) \
@@ -851,8 +1486,19 @@ _SI32_AES_A_get_xorfifo_count(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_AES_A_is_busy(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->STATUS.BUSYF);
+   //}}
+}
+#else
 bool
 _SI32_AES_A_is_busy(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_is_busy(basePointer)
 #define SI32_AES_A_is_busy(basePointer) \
@@ -864,8 +1510,19 @@ _SI32_AES_A_is_busy(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_AES_A_is_operation_complete_interrupt_pending(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->STATUS.OCI);
+   //}}
+}
+#else
 bool
 _SI32_AES_A_is_operation_complete_interrupt_pending(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_is_operation_complete_interrupt_pending(basePointer)
 #define SI32_AES_A_is_operation_complete_interrupt_pending(basePointer) \
@@ -877,8 +1534,19 @@ _SI32_AES_A_is_operation_complete_interrupt_pending(SI32_AES_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_clear_operation_complete_interrupt(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS_CLR = SI32_AES_A_STATUS_OCI_MASK;
+   //}}
+}
+#else
 void
 _SI32_AES_A_clear_operation_complete_interrupt(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_clear_operation_complete_interrupt(basePointer)
 #define SI32_AES_A_clear_operation_complete_interrupt(basePointer) \
@@ -890,8 +1558,19 @@ _SI32_AES_A_clear_operation_complete_interrupt(SI32_AES_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_AES_A_is_error_interrupt_pending(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->STATUS.ERRI);
+   //}}
+}
+#else
 bool
 _SI32_AES_A_is_error_interrupt_pending(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_is_error_interrupt_pending(basePointer)
 #define SI32_AES_A_is_error_interrupt_pending(basePointer) \
@@ -903,8 +1582,19 @@ _SI32_AES_A_is_error_interrupt_pending(SI32_AES_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_A_clear_error_interrupt(
+   SI32_AES_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS_CLR = SI32_AES_A_STATUS_ERRI_MASK;
+   //}}
+}
+#else
 void
 _SI32_AES_A_clear_error_interrupt(SI32_AES_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_A_clear_error_interrupt(basePointer)
 #define SI32_AES_A_clear_error_interrupt(basePointer) \
@@ -64,11 +64,27 @@ extern "C" {
 ///  status
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_initialize(
+   SI32_AES_B_Type * basePointer,
+   uint32_t control,
+   uint32_t xfrsize,
+   uint32_t status)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   basePointer->XFRSIZE.U32 = xfrsize;
+   basePointer->STATUS.U32 = status;
+   //}}
+}
+#else
 void
 _SI32_AES_B_initialize(SI32_AES_B_Type* /*basePointer*/,
    uint32_t, /*control*/
    uint32_t, /*xfrsize*/
    uint32_t /*status*/);
+#endif
 ///
 /// @def SI32_AES_B_initialize(basePointer, control, xfrsize, status)
 #define SI32_AES_B_initialize(basePointer, control, xfrsize, status) do{  \
@@ -91,9 +107,21 @@ _SI32_AES_B_initialize(SI32_AES_B_Type* /*basePointer*/,
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_write_control(
+   SI32_AES_B_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_AES_B_write_control(SI32_AES_B_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_AES_B_write_control(basePointer, control)
 #define SI32_AES_B_write_control(basePointer, control) \
@@ -108,8 +136,19 @@ _SI32_AES_B_write_control(SI32_AES_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_AES_B_read_control(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_AES_B_read_control(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_read_control(basePointer)
 #define SI32_AES_B_read_control(basePointer) \
@@ -121,8 +160,19 @@ _SI32_AES_B_read_control(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_start_operation(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_AES_B_CONTROL_XFRSTA_START_U32;
+   //}}
+}
+#else
 void
 _SI32_AES_B_start_operation(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_start_operation(basePointer)
 #define SI32_AES_B_start_operation(basePointer) \
@@ -134,8 +184,19 @@ _SI32_AES_B_start_operation(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_enable_key_capture(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_AES_B_CONTROL_KEYCPEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_AES_B_enable_key_capture(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_enable_key_capture(basePointer)
 #define SI32_AES_B_enable_key_capture(basePointer) \
@@ -147,8 +208,19 @@ _SI32_AES_B_enable_key_capture(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_disable_key_capture(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_AES_B_CONTROL_KEYCPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_AES_B_disable_key_capture(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_disable_key_capture(basePointer)
 #define SI32_AES_B_disable_key_capture(basePointer) \
@@ -160,8 +232,19 @@ _SI32_AES_B_disable_key_capture(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_select_encryption_mode(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_AES_B_CONTROL_EDMD_ENCRYPT_U32;
+   //}}
+}
+#else
 void
 _SI32_AES_B_select_encryption_mode(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_select_encryption_mode(basePointer)
 #define SI32_AES_B_select_encryption_mode(basePointer) \
@@ -173,8 +256,19 @@ _SI32_AES_B_select_encryption_mode(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_select_decryption_mode(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_AES_B_CONTROL_EDMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_AES_B_select_decryption_mode(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_select_decryption_mode(basePointer)
 #define SI32_AES_B_select_decryption_mode(basePointer) \
@@ -189,8 +283,19 @@ _SI32_AES_B_select_decryption_mode(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_select_software_mode(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_AES_B_CONTROL_SWMDEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_AES_B_select_software_mode(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_select_software_mode(basePointer)
 #define SI32_AES_B_select_software_mode(basePointer) \
@@ -205,8 +310,19 @@ _SI32_AES_B_select_software_mode(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_select_dma_mode(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_AES_B_CONTROL_SWMDEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_AES_B_select_dma_mode(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_select_dma_mode(basePointer)
 #define SI32_AES_B_select_dma_mode(basePointer) \
@@ -218,8 +334,19 @@ _SI32_AES_B_select_dma_mode(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_enter_bypass_hardware_mode(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_AES_B_CONTROL_BEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_AES_B_enter_bypass_hardware_mode(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_enter_bypass_hardware_mode(basePointer)
 #define SI32_AES_B_enter_bypass_hardware_mode(basePointer) \
@@ -231,8 +358,19 @@ _SI32_AES_B_enter_bypass_hardware_mode(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_exit_bypass_hardware_mode(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_AES_B_CONTROL_BEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_AES_B_exit_bypass_hardware_mode(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_exit_bypass_hardware_mode(basePointer)
 #define SI32_AES_B_exit_bypass_hardware_mode(basePointer) \
@@ -244,8 +382,19 @@ _SI32_AES_B_exit_bypass_hardware_mode(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_select_xor_path_none(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_AES_B_CONTROL_XOREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_AES_B_select_xor_path_none(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_select_xor_path_none(basePointer)
 #define SI32_AES_B_select_xor_path_none(basePointer) \
@@ -257,8 +406,20 @@ _SI32_AES_B_select_xor_path_none(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_select_xor_path_input(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_AES_B_CONTROL_XOREN_MASK;
+   basePointer->CONTROL_SET = SI32_AES_B_CONTROL_XOREN_XOR_INPUT_U32;
+   //}}
+}
+#else
 void
 _SI32_AES_B_select_xor_path_input(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_select_xor_path_input(basePointer)
 #define SI32_AES_B_select_xor_path_input(basePointer) do{  \
@@ -272,8 +433,20 @@ _SI32_AES_B_select_xor_path_input(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_select_xor_path_output(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_AES_B_CONTROL_XOREN_MASK;
+   basePointer->CONTROL_SET = SI32_AES_B_CONTROL_XOREN_XOR_OUTPUT_U32;
+   //}}
+}
+#else
 void
 _SI32_AES_B_select_xor_path_output(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_select_xor_path_output(basePointer)
 #define SI32_AES_B_select_xor_path_output(basePointer) do{  \
@@ -287,8 +460,19 @@ _SI32_AES_B_select_xor_path_output(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_enter_counter_mode(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_AES_B_CONTROL_HCTREN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_AES_B_enter_counter_mode(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_enter_counter_mode(basePointer)
 #define SI32_AES_B_enter_counter_mode(basePointer) \
@@ -300,8 +484,19 @@ _SI32_AES_B_enter_counter_mode(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_exit_counter_mode(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_AES_B_CONTROL_HCTREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_AES_B_exit_counter_mode(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_exit_counter_mode(basePointer)
 #define SI32_AES_B_exit_counter_mode(basePointer) \
@@ -313,8 +508,19 @@ _SI32_AES_B_exit_counter_mode(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_enter_cipher_block_chaining_mode(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_AES_B_CONTROL_HCBCEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_AES_B_enter_cipher_block_chaining_mode(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_enter_cipher_block_chaining_mode(basePointer)
 #define SI32_AES_B_enter_cipher_block_chaining_mode(basePointer) \
@@ -326,8 +532,19 @@ _SI32_AES_B_enter_cipher_block_chaining_mode(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_exit_cipher_block_chaining_mode(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_AES_B_CONTROL_HCBCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_AES_B_exit_cipher_block_chaining_mode(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_exit_cipher_block_chaining_mode(basePointer)
 #define SI32_AES_B_exit_cipher_block_chaining_mode(basePointer) \
@@ -339,8 +556,19 @@ _SI32_AES_B_exit_cipher_block_chaining_mode(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_select_key_size_128(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_AES_B_CONTROL_KEYSIZE_MASK;
+   //}}
+}
+#else
 void
 _SI32_AES_B_select_key_size_128(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_select_key_size_128(basePointer)
 #define SI32_AES_B_select_key_size_128(basePointer) \
@@ -352,8 +580,20 @@ _SI32_AES_B_select_key_size_128(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_select_key_size_192(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_AES_B_CONTROL_KEYSIZE_MASK;
+   basePointer->CONTROL_SET = SI32_AES_B_CONTROL_KEYSIZE_KEY192_U32;
+   //}}
+}
+#else
 void
 _SI32_AES_B_select_key_size_192(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_select_key_size_192(basePointer)
 #define SI32_AES_B_select_key_size_192(basePointer) do{  \
@@ -367,8 +607,20 @@ _SI32_AES_B_select_key_size_192(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_select_key_size_256(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_AES_B_CONTROL_KEYSIZE_MASK;
+   basePointer->CONTROL_SET = SI32_AES_B_CONTROL_KEYSIZE_KEY256_U32;
+   //}}
+}
+#else
 void
 _SI32_AES_B_select_key_size_256(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_select_key_size_256(basePointer)
 #define SI32_AES_B_select_key_size_256(basePointer) do{  \
@@ -382,8 +634,19 @@ _SI32_AES_B_select_key_size_256(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_enable_error_interrupt(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_AES_B_CONTROL_ERRIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_AES_B_enable_error_interrupt(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_enable_error_interrupt(basePointer)
 #define SI32_AES_B_enable_error_interrupt(basePointer) \
@@ -395,8 +658,19 @@ _SI32_AES_B_enable_error_interrupt(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_disable_error_interrupt(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_AES_B_CONTROL_ERRIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_AES_B_disable_error_interrupt(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_disable_error_interrupt(basePointer)
 #define SI32_AES_B_disable_error_interrupt(basePointer) \
@@ -408,8 +682,19 @@ _SI32_AES_B_disable_error_interrupt(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_AES_B_is_error_interrupt_enabled(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.ERRIEN);
+   //}}
+}
+#else
 bool
 _SI32_AES_B_is_error_interrupt_enabled(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_is_error_interrupt_enabled(basePointer)
 #define SI32_AES_B_is_error_interrupt_enabled(basePointer) \
@@ -421,8 +706,19 @@ _SI32_AES_B_is_error_interrupt_enabled(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_enable_operation_complete_interrupt(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_AES_B_CONTROL_OCIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_AES_B_enable_operation_complete_interrupt(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_enable_operation_complete_interrupt(basePointer)
 #define SI32_AES_B_enable_operation_complete_interrupt(basePointer) \
@@ -434,8 +730,19 @@ _SI32_AES_B_enable_operation_complete_interrupt(SI32_AES_B_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_disable_operation_complete_interrupt(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_AES_B_CONTROL_OCIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_AES_B_disable_operation_complete_interrupt(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_disable_operation_complete_interrupt(basePointer)
 #define SI32_AES_B_disable_operation_complete_interrupt(basePointer) \
@@ -447,8 +754,19 @@ _SI32_AES_B_disable_operation_complete_interrupt(SI32_AES_B_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_AES_B_is_operation_complete_interrupt_enabled(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.OCIEN);
+   //}}
+}
+#else
 bool
 _SI32_AES_B_is_operation_complete_interrupt_enabled(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_is_operation_complete_interrupt_enabled(basePointer)
 #define SI32_AES_B_is_operation_complete_interrupt_enabled(basePointer) \
@@ -460,8 +778,19 @@ _SI32_AES_B_is_operation_complete_interrupt_enabled(SI32_AES_B_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_enable_stall_in_debug_mode(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_AES_B_CONTROL_DBGMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_AES_B_enable_stall_in_debug_mode(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_enable_stall_in_debug_mode(basePointer)
 #define SI32_AES_B_enable_stall_in_debug_mode(basePointer) \
@@ -473,8 +802,19 @@ _SI32_AES_B_enable_stall_in_debug_mode(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_disable_stall_in_debug_mode(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_AES_B_CONTROL_DBGMD_RUN_U32;
+   //}}
+}
+#else
 void
 _SI32_AES_B_disable_stall_in_debug_mode(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_disable_stall_in_debug_mode(basePointer)
 #define SI32_AES_B_disable_stall_in_debug_mode(basePointer) \
@@ -486,8 +826,19 @@ _SI32_AES_B_disable_stall_in_debug_mode(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_enable_module(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_AES_B_CONTROL_RESET_MASK;
+   //}}
+}
+#else
 void
 _SI32_AES_B_enable_module(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_enable_module(basePointer)
 #define SI32_AES_B_enable_module(basePointer) \
@@ -499,8 +850,19 @@ _SI32_AES_B_enable_module(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_disable_module(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_AES_B_CONTROL_RESET_ACTIVE_U32;
+   //}}
+}
+#else
 void
 _SI32_AES_B_disable_module(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_disable_module(basePointer)
 #define SI32_AES_B_disable_module(basePointer) \
@@ -515,8 +877,20 @@ _SI32_AES_B_disable_module(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_reset_module(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_AES_B_CONTROL_RESET_ACTIVE_U32;
+   basePointer->CONTROL_CLR = SI32_AES_B_CONTROL_RESET_MASK;
+   //}}
+}
+#else
 void
 _SI32_AES_B_reset_module(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_reset_module(basePointer)
 #define SI32_AES_B_reset_module(basePointer) do{  \
@@ -539,9 +913,21 @@ _SI32_AES_B_reset_module(SI32_AES_B_Type* /*basePointer*/);
 ///  xfrsize
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_write_xfrsize(
+   SI32_AES_B_Type * basePointer,
+   uint32_t xfrsize)
+{
+   //{{
+   basePointer->XFRSIZE.U32 = xfrsize;
+   //}}
+}
+#else
 void
 _SI32_AES_B_write_xfrsize(SI32_AES_B_Type* /*basePointer*/,
    uint32_t /*xfrsize*/);
+#endif
 ///
 /// @def SI32_AES_B_write_xfrsize(basePointer, xfrsize)
 #define SI32_AES_B_write_xfrsize(basePointer, xfrsize) \
@@ -557,8 +943,19 @@ _SI32_AES_B_write_xfrsize(SI32_AES_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_AES_B_read_xfrsize(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   return basePointer->XFRSIZE.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_AES_B_read_xfrsize(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_read_xfrsize(basePointer)
 #define SI32_AES_B_read_xfrsize(basePointer) \
@@ -578,9 +975,21 @@ _SI32_AES_B_read_xfrsize(SI32_AES_B_Type* /*basePointer*/);
 ///  dataval
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_write_datafifo_u32(
+   SI32_AES_B_Type * basePointer,
+   uint32_t dataval)
+{
+   //{{
+   basePointer->DATAFIFO.U32 = dataval;
+   //}}
+}
+#else
 void
 _SI32_AES_B_write_datafifo_u32(SI32_AES_B_Type* /*basePointer*/,
    uint32_t /*dataval*/);
+#endif
 ///
 /// @def SI32_AES_B_write_datafifo_u32(basePointer, dataval)
 #define SI32_AES_B_write_datafifo_u32(basePointer, dataval) \
@@ -600,9 +1009,22 @@ _SI32_AES_B_write_datafifo_u32(SI32_AES_B_Type* /*basePointer*/,
 ///  dataval
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_write_datafifo_u16(
+   SI32_AES_B_Type * basePointer,
+   uwide16_t dataval)
+{
+   assert(dataval < 65536);   // dataval < 2^16
+   //{{
+   basePointer->DATAFIFO.U16 = dataval;
+   //}}
+}
+#else
 void
 _SI32_AES_B_write_datafifo_u16(SI32_AES_B_Type* /*basePointer*/,
    uwide16_t /*dataval*/);
+#endif
 ///
 /// @def SI32_AES_B_write_datafifo_u16(basePointer, dataval)
 #define SI32_AES_B_write_datafifo_u16(basePointer, dataval) \
@@ -622,9 +1044,22 @@ _SI32_AES_B_write_datafifo_u16(SI32_AES_B_Type* /*basePointer*/,
 ///  dataval
 ///  Valid range is 8 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_write_datafifo_u8(
+   SI32_AES_B_Type * basePointer,
+   uwide8_t dataval)
+{
+   assert(dataval < 256);   // dataval < 2^8
+   //{{
+   basePointer->DATAFIFO.U8 = dataval;
+   //}}
+}
+#else
 void
 _SI32_AES_B_write_datafifo_u8(SI32_AES_B_Type* /*basePointer*/,
    uwide8_t /*dataval*/);
+#endif
 ///
 /// @def SI32_AES_B_write_datafifo_u8(basePointer, dataval)
 #define SI32_AES_B_write_datafifo_u8(basePointer, dataval) \
@@ -639,8 +1074,19 @@ _SI32_AES_B_write_datafifo_u8(SI32_AES_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_AES_B_read_datafifo_u32(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   return basePointer->DATAFIFO.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_AES_B_read_datafifo_u32(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_read_datafifo_u32(basePointer)
 #define SI32_AES_B_read_datafifo_u32(basePointer) \
@@ -655,8 +1101,19 @@ _SI32_AES_B_read_datafifo_u32(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint16_t
+_SI32_AES_B_read_datafifo_u16(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   return basePointer->DATAFIFO.U16;
+   //}}
+}
+#else
 uint16_t
 _SI32_AES_B_read_datafifo_u16(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_read_datafifo_u16(basePointer)
 #define SI32_AES_B_read_datafifo_u16(basePointer) \
@@ -671,8 +1128,19 @@ _SI32_AES_B_read_datafifo_u16(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint8_t
+_SI32_AES_B_read_datafifo_u8(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   return basePointer->DATAFIFO.U8;
+   //}}
+}
+#else
 uint8_t
 _SI32_AES_B_read_datafifo_u8(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_read_datafifo_u8(basePointer)
 #define SI32_AES_B_read_datafifo_u8(basePointer) \
@@ -692,9 +1160,21 @@ _SI32_AES_B_read_datafifo_u8(SI32_AES_B_Type* /*basePointer*/);
 ///  xorval
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_write_xorfifo_u32(
+   SI32_AES_B_Type * basePointer,
+   uint32_t xorval)
+{
+   //{{
+   basePointer->XORFIFO.U32 = xorval;
+   //}}
+}
+#else
 void
 _SI32_AES_B_write_xorfifo_u32(SI32_AES_B_Type* /*basePointer*/,
    uint32_t /*xorval*/);
+#endif
 ///
 /// @def SI32_AES_B_write_xorfifo_u32(basePointer, xorval)
 #define SI32_AES_B_write_xorfifo_u32(basePointer, xorval) \
@@ -714,9 +1194,22 @@ _SI32_AES_B_write_xorfifo_u32(SI32_AES_B_Type* /*basePointer*/,
 ///  xorval
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_write_xorfifo_u16(
+   SI32_AES_B_Type * basePointer,
+   uwide16_t xorval)
+{
+   assert(xorval < 65536);   // xorval < 2^16
+   //{{
+   basePointer->XORFIFO.U16 = xorval;
+   //}}
+}
+#else
 void
 _SI32_AES_B_write_xorfifo_u16(SI32_AES_B_Type* /*basePointer*/,
    uwide16_t /*xorval*/);
+#endif
 ///
 /// @def SI32_AES_B_write_xorfifo_u16(basePointer, xorval)
 #define SI32_AES_B_write_xorfifo_u16(basePointer, xorval) \
@@ -736,9 +1229,22 @@ _SI32_AES_B_write_xorfifo_u16(SI32_AES_B_Type* /*basePointer*/,
 ///  xorval
 ///  Valid range is 8 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_write_xorfifo_u8(
+   SI32_AES_B_Type * basePointer,
+   uwide8_t xorval)
+{
+   assert(xorval < 256);   // xorval < 2^8
+   //{{
+   basePointer->XORFIFO.U8 = xorval;
+   //}}
+}
+#else
 void
 _SI32_AES_B_write_xorfifo_u8(SI32_AES_B_Type* /*basePointer*/,
    uwide8_t /*xorval*/);
+#endif
 ///
 /// @def SI32_AES_B_write_xorfifo_u8(basePointer, xorval)
 #define SI32_AES_B_write_xorfifo_u8(basePointer, xorval) \
@@ -758,9 +1264,24 @@ _SI32_AES_B_write_xorfifo_u8(SI32_AES_B_Type* /*basePointer*/,
 /// @param[in]
 ///  xor_vector
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_write_xorfifo_full(
+   SI32_AES_B_Type * basePointer,
+   SI32_AES_B_Initialization_Vector_Type xor_vector)
+{
+   //{{
+   basePointer->XORFIFO.U32 = xor_vector.iv[0];
+   basePointer->XORFIFO.U32 = xor_vector.iv[1];
+   basePointer->XORFIFO.U32 = xor_vector.iv[2];
+   basePointer->XORFIFO.U32 = xor_vector.iv[3];
+   //}}
+}
+#else
 void
 _SI32_AES_B_write_xorfifo_full(SI32_AES_B_Type* /*basePointer*/,
    SI32_AES_B_Initialization_Vector_Type /*xor_vector*/);
+#endif
 ///
 /// @def SI32_AES_B_write_xorfifo_full(basePointer, xor_vector)
 #define SI32_AES_B_write_xorfifo_full(basePointer, xor_vector) do{  \
@@ -786,9 +1307,48 @@ _SI32_AES_B_write_xorfifo_full(SI32_AES_B_Type* /*basePointer*/,
 /// @param[in]
 ///  key
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_write_hardware_key(
+   SI32_AES_B_Type * basePointer,
+   SI32_AES_B_Hardware_Key_Type key)
+{
+   //{{
+   basePointer->HWKEY0.HWKEY0_BITS = key.hwkey[0];
+   basePointer->HWKEY1.HWKEY1_BITS = key.hwkey[1];
+   basePointer->HWKEY2.HWKEY2_BITS = key.hwkey[2];
+   basePointer->HWKEY3.HWKEY3_BITS = key.hwkey[3];
+   if (basePointer->CONTROL.KEYSIZE
+       == SI32_AES_B_CONTROL_KEYSIZE_KEY128_VALUE)
+   {
+      basePointer->HWKEY4.HWKEY4_BITS = 0;
+      basePointer->HWKEY5.HWKEY5_BITS = 0;
+      basePointer->HWKEY6.HWKEY6_BITS = 0;
+      basePointer->HWKEY7.HWKEY7_BITS = 0;
+   }
+   else if (basePointer->CONTROL.KEYSIZE
+            == SI32_AES_B_CONTROL_KEYSIZE_KEY192_VALUE)
+   {
+      basePointer->HWKEY4.HWKEY4_BITS = key.hwkey[4];
+      basePointer->HWKEY5.HWKEY5_BITS = key.hwkey[5];
+      basePointer->HWKEY6.HWKEY6_BITS = 0;
+      basePointer->HWKEY7.HWKEY7_BITS = 0;
+   }
+   else if (basePointer->CONTROL.KEYSIZE
+            == SI32_AES_B_CONTROL_KEYSIZE_KEY256_VALUE)
+   {
+      basePointer->HWKEY4.HWKEY4_BITS = key.hwkey[4];
+      basePointer->HWKEY5.HWKEY5_BITS = key.hwkey[5];
+      basePointer->HWKEY6.HWKEY6_BITS = key.hwkey[6];
+      basePointer->HWKEY7.HWKEY7_BITS = key.hwkey[7];
+   }
+   //}}
+}
+#else
 void
 _SI32_AES_B_write_hardware_key(SI32_AES_B_Type* /*basePointer*/,
    SI32_AES_B_Hardware_Key_Type /*key*/);
+#endif
 ///
 /// @def SI32_AES_B_write_hardware_key(basePointer, key)
 #define SI32_AES_B_write_hardware_key(basePointer, key) \
@@ -806,8 +1366,48 @@ _SI32_AES_B_write_hardware_key(SI32_AES_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline SI32_AES_B_Hardware_Key_Type
+_SI32_AES_B_read_hardware_key(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   SI32_AES_B_Hardware_Key_Type ret;
+   ret.hwkey[0] = basePointer->HWKEY0.HWKEY0_BITS;
+   ret.hwkey[1] = basePointer->HWKEY1.HWKEY1_BITS;
+   ret.hwkey[2] = basePointer->HWKEY2.HWKEY2_BITS;
+   ret.hwkey[3] = basePointer->HWKEY3.HWKEY3_BITS;
+   if (basePointer->CONTROL.KEYSIZE
+       == SI32_AES_B_CONTROL_KEYSIZE_KEY128_VALUE)
+   {
+      ret.hwkey[4] = 0;
+      ret.hwkey[5] = 0;
+      ret.hwkey[6] = 0;
+      ret.hwkey[7] = 0;
+   }
+   else if (basePointer->CONTROL.KEYSIZE
+            == SI32_AES_B_CONTROL_KEYSIZE_KEY192_VALUE)
+   {
+      ret.hwkey[4] = basePointer->HWKEY4.HWKEY4_BITS;
+      ret.hwkey[5] = basePointer->HWKEY5.HWKEY5_BITS;
+      ret.hwkey[6] = 0;
+      ret.hwkey[7] = 0;
+   }
+   else if (basePointer->CONTROL.KEYSIZE
+            == SI32_AES_B_CONTROL_KEYSIZE_KEY256_VALUE)
+   {
+      ret.hwkey[4] = basePointer->HWKEY4.HWKEY4_BITS;
+      ret.hwkey[5] = basePointer->HWKEY5.HWKEY5_BITS;
+      ret.hwkey[6] = basePointer->HWKEY6.HWKEY6_BITS;
+      ret.hwkey[7] = basePointer->HWKEY7.HWKEY7_BITS;
+   }
+   return ret;
+   //}}
+}
+#else
 SI32_AES_B_Hardware_Key_Type
 _SI32_AES_B_read_hardware_key(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_read_hardware_key(basePointer)
 #define SI32_AES_B_read_hardware_key(basePointer) \
@@ -827,9 +1427,24 @@ _SI32_AES_B_read_hardware_key(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  counter
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_write_hardware_counter(
+   SI32_AES_B_Type * basePointer,
+   SI32_AES_B_Hardware_Counter_Type counter)
+{
+   //{{
+   basePointer->HWCTR0.HWCTR0_BITS = counter.hwctr[0];
+   basePointer->HWCTR1.HWCTR1_BITS = counter.hwctr[1];
+   basePointer->HWCTR2.HWCTR2_BITS = counter.hwctr[2];
+   basePointer->HWCTR3.HWCTR3_BITS = counter.hwctr[3];
+   //}}
+}
+#else
 void
 _SI32_AES_B_write_hardware_counter(SI32_AES_B_Type* /*basePointer*/,
    SI32_AES_B_Hardware_Counter_Type /*counter*/);
+#endif
 ///
 /// @def SI32_AES_B_write_hardware_counter(basePointer, counter)
 #define SI32_AES_B_write_hardware_counter(basePointer, counter) do{  \
@@ -849,8 +1464,24 @@ _SI32_AES_B_write_hardware_counter(SI32_AES_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline SI32_AES_B_Hardware_Counter_Type
+_SI32_AES_B_read_hardware_counter(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   SI32_AES_B_Hardware_Counter_Type counter;
+   counter.hwctr[0] = basePointer->HWCTR0.HWCTR0_BITS;
+   counter.hwctr[1] = basePointer->HWCTR1.HWCTR1_BITS;
+   counter.hwctr[2] = basePointer->HWCTR2.HWCTR2_BITS;
+   counter.hwctr[3] = basePointer->HWCTR3.HWCTR3_BITS;
+   return counter;
+   //}}
+}
+#else
 SI32_AES_B_Hardware_Counter_Type
 _SI32_AES_B_read_hardware_counter(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_read_hardware_counter(basePointer)
 #define SI32_AES_B_read_hardware_counter(basePointer) \
@@ -870,9 +1501,21 @@ _SI32_AES_B_read_hardware_counter(SI32_AES_B_Type* /*basePointer*/);
 ///  status
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_write_status(
+   SI32_AES_B_Type * basePointer,
+   uint32_t status)
+{
+   //{{
+   basePointer->STATUS.U32 = status;
+   //}}
+}
+#else
 void
 _SI32_AES_B_write_status(SI32_AES_B_Type* /*basePointer*/,
    uint32_t /*status*/);
+#endif
 ///
 /// @def SI32_AES_B_write_status(basePointer, status)
 #define SI32_AES_B_write_status(basePointer, status) \
@@ -887,8 +1530,19 @@ _SI32_AES_B_write_status(SI32_AES_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_AES_B_read_status(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_AES_B_read_status(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_read_status(basePointer)
 #define SI32_AES_B_read_status(basePointer) \
@@ -900,8 +1554,19 @@ _SI32_AES_B_read_status(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_AES_B_has_data_underrun_occurred(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->STATUS.DURI);
+   //}}
+}
+#else
 bool
 _SI32_AES_B_has_data_underrun_occurred(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_has_data_underrun_occurred(basePointer)
 #define SI32_AES_B_has_data_underrun_occurred(basePointer) \
@@ -913,8 +1578,19 @@ _SI32_AES_B_has_data_underrun_occurred(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_clear_data_underrun_flag(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS_CLR = SI32_AES_B_STATUS_DURI_MASK;
+   //}}
+}
+#else
 void
 _SI32_AES_B_clear_data_underrun_flag(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_clear_data_underrun_flag(basePointer)
 #define SI32_AES_B_clear_data_underrun_flag(basePointer) \
@@ -926,8 +1602,19 @@ _SI32_AES_B_clear_data_underrun_flag(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_AES_B_has_data_overrun_occurred(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->STATUS.DORI);
+   //}}
+}
+#else
 bool
 _SI32_AES_B_has_data_overrun_occurred(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_has_data_overrun_occurred(basePointer)
 #define SI32_AES_B_has_data_overrun_occurred(basePointer) \
@@ -939,8 +1626,19 @@ _SI32_AES_B_has_data_overrun_occurred(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_clear_data_overrun_flag(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS_CLR = SI32_AES_B_STATUS_DORI_MASK;
+   //}}
+}
+#else
 void
 _SI32_AES_B_clear_data_overrun_flag(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_clear_data_overrun_flag(basePointer)
 #define SI32_AES_B_clear_data_overrun_flag(basePointer) \
@@ -952,8 +1650,19 @@ _SI32_AES_B_clear_data_overrun_flag(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_AES_B_has_xor_data_overrun_occurred(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->STATUS.XORI);
+   //}}
+}
+#else
 bool
 _SI32_AES_B_has_xor_data_overrun_occurred(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_has_xor_data_overrun_occurred(basePointer)
 #define SI32_AES_B_has_xor_data_overrun_occurred(basePointer) \
@@ -965,8 +1674,19 @@ _SI32_AES_B_has_xor_data_overrun_occurred(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_clear_xor_data_overrun_flag(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+  basePointer->STATUS_CLR = SI32_AES_B_STATUS_XORI_MASK;
+   //}}
+}
+#else
 void
 _SI32_AES_B_clear_xor_data_overrun_flag(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_clear_xor_data_overrun_flag(basePointer)
 #define SI32_AES_B_clear_xor_data_overrun_flag(basePointer) \
@@ -981,8 +1701,19 @@ _SI32_AES_B_clear_xor_data_overrun_flag(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_AES_B_get_datafifo_count(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.DFIFOLVL;
+   //}}
+}
+#else
 uint32_t
 _SI32_AES_B_get_datafifo_count(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_get_datafifo_count(basePointer)
 #define SI32_AES_B_get_datafifo_count(basePointer) \
@@ -997,8 +1728,19 @@ _SI32_AES_B_get_datafifo_count(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_AES_B_get_xorfifo_count(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.XFIFOLVL;
+   //}}
+}
+#else
 uint32_t
 _SI32_AES_B_get_xorfifo_count(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_get_xorfifo_count(basePointer)
 #define SI32_AES_B_get_xorfifo_count(basePointer) \
@@ -1010,8 +1752,19 @@ _SI32_AES_B_get_xorfifo_count(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_AES_B_is_busy(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->STATUS.BUSYF);
+   //}}
+}
+#else
 bool
 _SI32_AES_B_is_busy(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_is_busy(basePointer)
 #define SI32_AES_B_is_busy(basePointer) \
@@ -1023,8 +1776,19 @@ _SI32_AES_B_is_busy(SI32_AES_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_AES_B_is_operation_complete_interrupt_pending(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->STATUS.OCI);
+   //}}
+}
+#else
 bool
 _SI32_AES_B_is_operation_complete_interrupt_pending(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_is_operation_complete_interrupt_pending(basePointer)
 #define SI32_AES_B_is_operation_complete_interrupt_pending(basePointer) \
@@ -1036,8 +1800,19 @@ _SI32_AES_B_is_operation_complete_interrupt_pending(SI32_AES_B_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_AES_B_clear_operation_complete_interrupt(
+   SI32_AES_B_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS_CLR = SI32_AES_B_STATUS_OCI_MASK;
+   //}}
+}
+#else
 void
 _SI32_AES_B_clear_operation_complete_interrupt(SI32_AES_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_AES_B_clear_operation_complete_interrupt(basePointer)
 #define SI32_AES_B_clear_operation_complete_interrupt(basePointer) \
@@ -76,6 +76,30 @@ extern "C" {
 ///  Valid range is 32 bits.
 ///  Write to MUX register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_initialize(
+   SI32_CAPSENSE_A_Type * basePointer,
+   // Write to CONTROL register.
+   uint32_t control,
+   // Write to MODE register.
+   uint32_t mode,
+   // Write to SCANM register.
+   uint32_t scanm,
+   // Write to CSTH register.
+   uint32_t csth,
+   // Write to MUX register.
+   uint32_t mux)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   basePointer->MODE.U32    = mode;
+   basePointer->SCAN.U32    = scanm;
+   basePointer->CSTH.U32    = csth;
+   basePointer->MUX.U32     = mux;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_initialize(SI32_CAPSENSE_A_Type* /*basePointer*/,
    uint32_t, /*control*/
@@ -83,6 +107,7 @@ _SI32_CAPSENSE_A_initialize(SI32_CAPSENSE_A_Type* /*basePointer*/,
    uint32_t, /*scanm*/
    uint32_t, /*csth*/
    uint32_t /*mux*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_initialize(basePointer, control, mode, scanm, csth, mux)
 #define SI32_CAPSENSE_A_initialize(basePointer, control, mode, scanm, csth, mux) do{  \
@@ -105,9 +130,22 @@ _SI32_CAPSENSE_A_initialize(SI32_CAPSENSE_A_Type* /*basePointer*/,
 ///  Valid range is 32 bits.
 ///  Write to CONTROL register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_write_control(
+   SI32_CAPSENSE_A_Type * basePointer,
+   // Write to CONTROL register.
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_write_control(SI32_CAPSENSE_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_write_control(basePointer, control)
 #define SI32_CAPSENSE_A_write_control(basePointer, control) \
@@ -122,8 +160,19 @@ _SI32_CAPSENSE_A_write_control(SI32_CAPSENSE_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_CAPSENSE_A_read_control(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_CAPSENSE_A_read_control(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_read_control(basePointer)
 #define SI32_CAPSENSE_A_read_control(basePointer) \
@@ -139,8 +188,19 @@ _SI32_CAPSENSE_A_read_control(SI32_CAPSENSE_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_CAPSENSE_A_is_conversion_in_progress(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.BUSYF);
+   //}}
+}
+#else
 bool
 _SI32_CAPSENSE_A_is_conversion_in_progress(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_is_conversion_in_progress(basePointer)
 #define SI32_CAPSENSE_A_is_conversion_in_progress(basePointer) \
@@ -152,8 +212,19 @@ _SI32_CAPSENSE_A_is_conversion_in_progress(SI32_CAPSENSE_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_start_manual_conversion(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_CAPSENSE_A_CONTROL_BUSYF_MASK;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_start_manual_conversion(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_start_manual_conversion(basePointer)
 #define SI32_CAPSENSE_A_start_manual_conversion(basePointer) \
@@ -165,8 +236,19 @@ _SI32_CAPSENSE_A_start_manual_conversion(SI32_CAPSENSE_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_enable_module(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_CAPSENSE_A_CONTROL_CSEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_enable_module(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_enable_module(basePointer)
 #define SI32_CAPSENSE_A_enable_module(basePointer) \
@@ -178,8 +260,19 @@ _SI32_CAPSENSE_A_enable_module(SI32_CAPSENSE_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_disable_module(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_CAPSENSE_A_CONTROL_CSEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_disable_module(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_disable_module(basePointer)
 #define SI32_CAPSENSE_A_disable_module(basePointer) \
@@ -191,8 +284,19 @@ _SI32_CAPSENSE_A_disable_module(SI32_CAPSENSE_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_enable_bias(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_CAPSENSE_A_CONTROL_BIASEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_enable_bias(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_enable_bias(basePointer)
 #define SI32_CAPSENSE_A_enable_bias(basePointer) \
@@ -204,8 +308,19 @@ _SI32_CAPSENSE_A_enable_bias(SI32_CAPSENSE_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_disable_bias(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_CAPSENSE_A_CONTROL_BIASEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_disable_bias(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_disable_bias(basePointer)
 #define SI32_CAPSENSE_A_disable_bias(basePointer) \
@@ -217,8 +332,19 @@ _SI32_CAPSENSE_A_disable_bias(SI32_CAPSENSE_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_set_threshold_polarity_to_less_than_or_equal(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_CAPSENSE_A_CONTROL_CMPPOL_MASK;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_set_threshold_polarity_to_less_than_or_equal(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_set_threshold_polarity_to_less_than_or_equal(basePointer)
 #define SI32_CAPSENSE_A_set_threshold_polarity_to_less_than_or_equal(basePointer) \
@@ -230,8 +356,19 @@ _SI32_CAPSENSE_A_set_threshold_polarity_to_less_than_or_equal(SI32_CAPSENSE_A_Ty
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_set_threshold_polarity_to_greater_than(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_CAPSENSE_A_CONTROL_CMPPOL_MASK;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_set_threshold_polarity_to_greater_than(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_set_threshold_polarity_to_greater_than(basePointer)
 #define SI32_CAPSENSE_A_set_threshold_polarity_to_greater_than(basePointer) \
@@ -243,8 +380,19 @@ _SI32_CAPSENSE_A_set_threshold_polarity_to_greater_than(SI32_CAPSENSE_A_Type* /*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_select_single_conversion_mode(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_CAPSENSE_A_CONTROL_CMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_select_single_conversion_mode(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_select_single_conversion_mode(basePointer)
 #define SI32_CAPSENSE_A_select_single_conversion_mode(basePointer) \
@@ -256,8 +404,20 @@ _SI32_CAPSENSE_A_select_single_conversion_mode(SI32_CAPSENSE_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_select_single_scan_mode(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_CAPSENSE_A_CONTROL_CMD_MASK;
+   basePointer->CONTROL_SET = SI32_CAPSENSE_A_CONTROL_CMD_SCAN_U32;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_select_single_scan_mode(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_select_single_scan_mode(basePointer)
 #define SI32_CAPSENSE_A_select_single_scan_mode(basePointer) do{  \
@@ -271,8 +431,20 @@ _SI32_CAPSENSE_A_select_single_scan_mode(SI32_CAPSENSE_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_select_continuous_single_conversion_mode(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_CAPSENSE_A_CONTROL_CMD_MASK;
+   basePointer->CONTROL_SET = SI32_CAPSENSE_A_CONTROL_CMD_CONT_SINGLE_U32;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_select_continuous_single_conversion_mode(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_select_continuous_single_conversion_mode(basePointer)
 #define SI32_CAPSENSE_A_select_continuous_single_conversion_mode(basePointer) do{  \
@@ -286,8 +458,19 @@ _SI32_CAPSENSE_A_select_continuous_single_conversion_mode(SI32_CAPSENSE_A_Type*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_select_continuous_scan_mode(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_CAPSENSE_A_CONTROL_CMD_CONT_SCAN_U32;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_select_continuous_scan_mode(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_select_continuous_scan_mode(basePointer)
 #define SI32_CAPSENSE_A_select_continuous_scan_mode(basePointer) \
@@ -306,9 +489,25 @@ _SI32_CAPSENSE_A_select_continuous_scan_mode(SI32_CAPSENSE_A_Type* /*basePointer
 ///  Conversions last n internal capsense clocks and are n bits in length:
 ///  0 = n is 12, 1 = n is 13, 2 = n is 14, 3 = n is 16.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_set_conversion_rate(
+   SI32_CAPSENSE_A_Type * basePointer,
+   // Conversions last n internal capsense clocks and are n bits in length:
+   // 0 = n is 12, 1 = n is 13, 2 = n is 14, 3 = n is 16.
+   SI32_CAPSENSE_A_CONVERSION_RATE_Enum_Type rate)
+{
+   assert(rate < 4);   // rate < 2^2
+   //{{
+   basePointer->CONTROL_CLR = SI32_CAPSENSE_A_CONTROL_CNVR_MASK;
+   basePointer->CONTROL_SET = rate << SI32_CAPSENSE_A_CONTROL_CNVR_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_set_conversion_rate(SI32_CAPSENSE_A_Type* /*basePointer*/,
    SI32_CAPSENSE_A_CONVERSION_RATE_Enum_Type /*rate*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_set_conversion_rate(basePointer, rate)
 #define SI32_CAPSENSE_A_set_conversion_rate(basePointer, rate) do{  \
@@ -329,9 +528,25 @@ _SI32_CAPSENSE_A_set_conversion_rate(SI32_CAPSENSE_A_Type* /*basePointer*/,
 ///  Accumulate n samples: 0 = 1 sample, 1 = 4 samples, 2 = 8 samples, 3 =
 ///  16 samples, 4 = 32 samples, 5 = 64 samples.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_set_number_to_accumulate(
+   SI32_CAPSENSE_A_Type * basePointer,
+   // Accumulate n samples: 0 = 1 sample, 1 = 4 samples, 2 = 8 samples, 3 =
+   // 16 samples, 4 = 32 samples, 5 = 64 samples.
+   SI32_CAPSENSE_A_ACCUMULATOR_MODE_Enum_Type samples)
+{
+   assert(samples <= 5);
+   //{{
+   basePointer->CONTROL_CLR = SI32_CAPSENSE_A_CONTROL_ACCMD_MASK;
+   basePointer->CONTROL_SET = samples << SI32_CAPSENSE_A_CONTROL_ACCMD_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_set_number_to_accumulate(SI32_CAPSENSE_A_Type* /*basePointer*/,
    SI32_CAPSENSE_A_ACCUMULATOR_MODE_Enum_Type /*samples*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_set_number_to_accumulate(basePointer, samples)
 #define SI32_CAPSENSE_A_set_number_to_accumulate(basePointer, samples) do{  \
@@ -351,8 +566,19 @@ _SI32_CAPSENSE_A_set_number_to_accumulate(SI32_CAPSENSE_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_enter_channels_connected_mode(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_CAPSENSE_A_CONTROL_MCEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_enter_channels_connected_mode(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_enter_channels_connected_mode(basePointer)
 #define SI32_CAPSENSE_A_enter_channels_connected_mode(basePointer) \
@@ -367,8 +593,19 @@ _SI32_CAPSENSE_A_enter_channels_connected_mode(SI32_CAPSENSE_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_exit_channels_connected_mode(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_CAPSENSE_A_CONTROL_MCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_exit_channels_connected_mode(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_exit_channels_connected_mode(basePointer)
 #define SI32_CAPSENSE_A_exit_channels_connected_mode(basePointer) \
@@ -386,9 +623,25 @@ _SI32_CAPSENSE_A_exit_channels_connected_mode(SI32_CAPSENSE_A_Type* /*basePointe
 ///  Valid range is 4 bits.
 ///  See datasheet for settings information.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_set_conversion_start_source(
+   SI32_CAPSENSE_A_Type * basePointer,
+   // See datasheet for settings information.
+   uint32_t source)
+{
+   assert(source < 16);   // source < 2^4
+   //{{
+   basePointer->CONTROL_CLR = SI32_CAPSENSE_A_CONTROL_CSCM_MASK;
+   basePointer->CONTROL_SET = source <<
+      SI32_CAPSENSE_A_CONTROL_CSCM_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_set_conversion_start_source(SI32_CAPSENSE_A_Type* /*basePointer*/,
    uint32_t /*source*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_set_conversion_start_source(basePointer, source)
 #define SI32_CAPSENSE_A_set_conversion_start_source(basePointer, source) do{  \
@@ -412,9 +665,28 @@ _SI32_CAPSENSE_A_set_conversion_start_source(SI32_CAPSENSE_A_Type* /*basePointer
 ///  retry up to four times on consecutive pin change cycles, 3 = ignore
 ///  monitored signal state change.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_set_number_of_retries(
+   SI32_CAPSENSE_A_Type * basePointer,
+   // Configures the Pin Monitor Mode bits: 0 = always retry on pin state
+   // change, 1 = retry up to twice on consecutive pin change cycles, 2 =
+   // retry up to four times on consecutive pin change cycles, 3 = ignore
+   // monitored signal state change.
+   SI32_CAPSENSE_A_PIN_MONITOR_MODE_Enum_Type retries)
+{
+   assert(retries < 4);   // retries < 2^2
+   //{{
+   basePointer->CONTROL_CLR = SI32_CAPSENSE_A_CONTROL_PMMD_MASK;
+   basePointer->CONTROL_SET = retries <<
+      SI32_CAPSENSE_A_CONTROL_PMMD_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_set_number_of_retries(SI32_CAPSENSE_A_Type* /*basePointer*/,
    SI32_CAPSENSE_A_PIN_MONITOR_MODE_Enum_Type /*retries*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_set_number_of_retries(basePointer, retries)
 #define SI32_CAPSENSE_A_set_number_of_retries(basePointer, retries) do{  \
@@ -434,8 +706,19 @@ _SI32_CAPSENSE_A_set_number_of_retries(SI32_CAPSENSE_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_CAPSENSE_A_has_retry_occurred(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.PMEF);
+   //}}
+}
+#else
 bool
 _SI32_CAPSENSE_A_has_retry_occurred(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_has_retry_occurred(basePointer)
 #define SI32_CAPSENSE_A_has_retry_occurred(basePointer) \
@@ -450,8 +733,19 @@ _SI32_CAPSENSE_A_has_retry_occurred(SI32_CAPSENSE_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_clear_retries_flag(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_CAPSENSE_A_CONTROL_PMEF_MASK;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_clear_retries_flag(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_clear_retries_flag(basePointer)
 #define SI32_CAPSENSE_A_clear_retries_flag(basePointer) \
@@ -463,8 +757,20 @@ _SI32_CAPSENSE_A_clear_retries_flag(SI32_CAPSENSE_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_enable_threshold_compare(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_CAPSENSE_A_CONTROL_CMPEN_MASK;
+   basePointer->CONTROL_SET = SI32_CAPSENSE_A_CONTROL_CMPEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_enable_threshold_compare(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_enable_threshold_compare(basePointer)
 #define SI32_CAPSENSE_A_enable_threshold_compare(basePointer) do{  \
@@ -478,8 +784,19 @@ _SI32_CAPSENSE_A_enable_threshold_compare(SI32_CAPSENSE_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_disable_threshold_compare(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_CAPSENSE_A_CONTROL_CMPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_disable_threshold_compare(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_disable_threshold_compare(basePointer)
 #define SI32_CAPSENSE_A_disable_threshold_compare(basePointer) \
@@ -491,8 +808,19 @@ _SI32_CAPSENSE_A_disable_threshold_compare(SI32_CAPSENSE_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_CAPSENSE_A_is_threshold_compare_enabled(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.CMPEN);
+   //}}
+}
+#else
 bool
 _SI32_CAPSENSE_A_is_threshold_compare_enabled(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_is_threshold_compare_enabled(basePointer)
 #define SI32_CAPSENSE_A_is_threshold_compare_enabled(basePointer) \
@@ -504,8 +832,19 @@ _SI32_CAPSENSE_A_is_threshold_compare_enabled(SI32_CAPSENSE_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_enable_conversion_done_interrupt(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_CAPSENSE_A_CONTROL_CDIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_enable_conversion_done_interrupt(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_enable_conversion_done_interrupt(basePointer)
 #define SI32_CAPSENSE_A_enable_conversion_done_interrupt(basePointer) \
@@ -517,8 +856,19 @@ _SI32_CAPSENSE_A_enable_conversion_done_interrupt(SI32_CAPSENSE_A_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_disable_conversion_done_interrupt(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_CAPSENSE_A_CONTROL_CDIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_disable_conversion_done_interrupt(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_disable_conversion_done_interrupt(basePointer)
 #define SI32_CAPSENSE_A_disable_conversion_done_interrupt(basePointer) \
@@ -530,8 +880,19 @@ _SI32_CAPSENSE_A_disable_conversion_done_interrupt(SI32_CAPSENSE_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_CAPSENSE_A_is_conversion_done_interrupt_enabled(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.CDIEN);
+   //}}
+}
+#else
 bool
 _SI32_CAPSENSE_A_is_conversion_done_interrupt_enabled(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_is_conversion_done_interrupt_enabled(basePointer)
 #define SI32_CAPSENSE_A_is_conversion_done_interrupt_enabled(basePointer) \
@@ -543,8 +904,19 @@ _SI32_CAPSENSE_A_is_conversion_done_interrupt_enabled(SI32_CAPSENSE_A_Type* /*ba
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_enable_end_of_scan_interrupt(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_CAPSENSE_A_CONTROL_EOSIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_enable_end_of_scan_interrupt(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_enable_end_of_scan_interrupt(basePointer)
 #define SI32_CAPSENSE_A_enable_end_of_scan_interrupt(basePointer) \
@@ -556,8 +928,19 @@ _SI32_CAPSENSE_A_enable_end_of_scan_interrupt(SI32_CAPSENSE_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_disable_end_of_scan_interrupt(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_CAPSENSE_A_CONTROL_EOSIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_disable_end_of_scan_interrupt(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_disable_end_of_scan_interrupt(basePointer)
 #define SI32_CAPSENSE_A_disable_end_of_scan_interrupt(basePointer) \
@@ -569,8 +952,19 @@ _SI32_CAPSENSE_A_disable_end_of_scan_interrupt(SI32_CAPSENSE_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_CAPSENSE_A_is_end_of_scan_interrupt_enabled(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.EOSIEN);
+   //}}
+}
+#else
 bool
 _SI32_CAPSENSE_A_is_end_of_scan_interrupt_enabled(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_is_end_of_scan_interrupt_enabled(basePointer)
 #define SI32_CAPSENSE_A_is_end_of_scan_interrupt_enabled(basePointer) \
@@ -587,8 +981,19 @@ _SI32_CAPSENSE_A_is_end_of_scan_interrupt_enabled(SI32_CAPSENSE_A_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_CAPSENSE_A_is_threshold_compare_interrupt_pending(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.CMPI);
+   //}}
+}
+#else
 bool
 _SI32_CAPSENSE_A_is_threshold_compare_interrupt_pending(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_is_threshold_compare_interrupt_pending(basePointer)
 #define SI32_CAPSENSE_A_is_threshold_compare_interrupt_pending(basePointer) \
@@ -605,8 +1010,19 @@ _SI32_CAPSENSE_A_is_threshold_compare_interrupt_pending(SI32_CAPSENSE_A_Type* /*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_CAPSENSE_A_is_conversion_complete_interrupt_pending(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.CDI);
+   //}}
+}
+#else
 bool
 _SI32_CAPSENSE_A_is_conversion_complete_interrupt_pending(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_is_conversion_complete_interrupt_pending(basePointer)
 #define SI32_CAPSENSE_A_is_conversion_complete_interrupt_pending(basePointer) \
@@ -618,8 +1034,19 @@ _SI32_CAPSENSE_A_is_conversion_complete_interrupt_pending(SI32_CAPSENSE_A_Type*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_clear_conversion_complete_interrupt(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_CAPSENSE_A_CONTROL_CDI_MASK;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_clear_conversion_complete_interrupt(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_clear_conversion_complete_interrupt(basePointer)
 #define SI32_CAPSENSE_A_clear_conversion_complete_interrupt(basePointer) \
@@ -636,8 +1063,19 @@ _SI32_CAPSENSE_A_clear_conversion_complete_interrupt(SI32_CAPSENSE_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_CAPSENSE_A_is_end_of_scan_interrupt_pending(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.EOSI);
+   //}}
+}
+#else
 bool
 _SI32_CAPSENSE_A_is_end_of_scan_interrupt_pending(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_is_end_of_scan_interrupt_pending(basePointer)
 #define SI32_CAPSENSE_A_is_end_of_scan_interrupt_pending(basePointer) \
@@ -655,9 +1093,22 @@ _SI32_CAPSENSE_A_is_end_of_scan_interrupt_pending(SI32_CAPSENSE_A_Type* /*basePo
 ///  Valid range is 32 bits.
 ///  Write to MODE register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_write_mode(
+   SI32_CAPSENSE_A_Type * basePointer,
+   // Write to MODE register.
+   uint32_t mode)
+{
+   //{{
+   basePointer->MODE.U32 = mode;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_write_mode(SI32_CAPSENSE_A_Type* /*basePointer*/,
    uint32_t /*mode*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_write_mode(basePointer, mode)
 #define SI32_CAPSENSE_A_write_mode(basePointer, mode) \
@@ -672,8 +1123,19 @@ _SI32_CAPSENSE_A_write_mode(SI32_CAPSENSE_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_CAPSENSE_A_read_mode(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   return basePointer->MODE.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_CAPSENSE_A_read_mode(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_read_mode(basePointer)
 #define SI32_CAPSENSE_A_read_mode(basePointer) \
@@ -693,9 +1155,26 @@ _SI32_CAPSENSE_A_read_mode(SI32_CAPSENSE_A_Type* /*basePointer*/);
 ///  values increase the size of the capacitance that can be measured with
 ///  the capsense module. The capacitance gain is equivalent to gain + 1.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_set_gain(
+   SI32_CAPSENSE_A_Type * basePointer,
+   // Select the gain applied to the capacitance measurement. Lower gain
+   // values increase the size of the capacitance that can be measured with
+   // the capsense module. The capacitance gain is equivalent to gain + 1.
+   uint32_t gain)
+{
+   assert(gain < 8);   // gain < 2^3
+   //{{
+   basePointer->MODE_CLR = SI32_CAPSENSE_A_MODE_CGSEL_MASK;
+   basePointer->MODE_SET = gain << SI32_CAPSENSE_A_MODE_CGSEL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_set_gain(SI32_CAPSENSE_A_Type* /*basePointer*/,
    uint32_t /*gain*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_set_gain(basePointer, gain)
 #define SI32_CAPSENSE_A_set_gain(basePointer, gain) do{  \
@@ -721,9 +1200,26 @@ _SI32_CAPSENSE_A_set_gain(SI32_CAPSENSE_A_Type* /*basePointer*/,
 ///  between 1.5 us and 3 us, 2 = ramp time is between 3 us and 6 us, 3 =
 ///  ramp time is greater than 6 us.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_set_ramp_selection(
+   SI32_CAPSENSE_A_Type * basePointer,
+   // Ramp value of 0 = ramp time is less than 1.5 us, 1 = ramp time is
+   // between 1.5 us and 3 us, 2 = ramp time is between 3 us and 6 us, 3 =
+   // ramp time is greater than 6 us.
+   uint32_t ramp)
+{
+   assert(ramp < 4);   // ramp < 2^2
+   //{{
+   basePointer->MODE_CLR = SI32_CAPSENSE_A_MODE_RAMPSEL_MASK;
+   basePointer->MODE_SET = ramp << SI32_CAPSENSE_A_MODE_RAMPSEL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_set_ramp_selection(SI32_CAPSENSE_A_Type* /*basePointer*/,
    uint32_t /*ramp*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_set_ramp_selection(basePointer, ramp)
 #define SI32_CAPSENSE_A_set_ramp_selection(basePointer, ramp) do{  \
@@ -748,9 +1244,26 @@ _SI32_CAPSENSE_A_set_ramp_selection(SI32_CAPSENSE_A_Type* /*basePointer*/,
 ///  = 3/8 current, 4 = 1/2 current, 5 = 5/8 current, 6 = 3/4 current, 7 =
 ///  7/8 current.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_set_output_current(
+   SI32_CAPSENSE_A_Type * basePointer,
+   // Current value of 0 = full current, 1 = 1/8 current, 2 = 1/4 current, 3
+   // = 3/8 current, 4 = 1/2 current, 5 = 5/8 current, 6 = 3/4 current, 7 =
+   // 7/8 current.
+   uint32_t current)
+{
+   assert(current < 8);   // current < 2^3
+   //{{
+   basePointer->MODE_CLR = SI32_CAPSENSE_A_MODE_IASEL_MASK;
+   basePointer->MODE_SET = current << SI32_CAPSENSE_A_MODE_IASEL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_set_output_current(SI32_CAPSENSE_A_Type* /*basePointer*/,
    uint32_t /*current*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_set_output_current(basePointer, current)
 #define SI32_CAPSENSE_A_set_output_current(basePointer, current) do{  \
@@ -774,9 +1287,25 @@ _SI32_CAPSENSE_A_set_output_current(SI32_CAPSENSE_A_Type* /*basePointer*/,
 ///  Time value of  0 = 0.75 us, 1 = 1.0 us, 2 = 1.2 us, 3 = 1.5 us, 4 = 2
 ///  us, 5 = 3 us, 6 = 6 us, 7 = 12 us.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_set_discharge_time(
+   SI32_CAPSENSE_A_Type * basePointer,
+   // Time value of  0 = 0.75 us, 1 = 1.0 us, 2 = 1.2 us, 3 = 1.5 us, 4 = 2
+   // us, 5 = 3 us, 6 = 6 us, 7 = 12 us.
+   uint32_t time)
+{
+   assert(time < 8);   // time < 2^3
+   //{{
+   basePointer->MODE_CLR = SI32_CAPSENSE_A_MODE_DTSEL_MASK;
+   basePointer->MODE_SET = time << SI32_CAPSENSE_A_MODE_DTSEL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_set_discharge_time(SI32_CAPSENSE_A_Type* /*basePointer*/,
    uint32_t /*time*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_set_discharge_time(basePointer, time)
 #define SI32_CAPSENSE_A_set_discharge_time(basePointer, time) do{  \
@@ -790,8 +1319,19 @@ _SI32_CAPSENSE_A_set_discharge_time(SI32_CAPSENSE_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_CAPSENSE_A_read_data(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DATA.DATA_BITS;
+   //}}
+}
+#else
 uint32_t
 _SI32_CAPSENSE_A_read_data(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_read_data(basePointer)
 #define SI32_CAPSENSE_A_read_data(basePointer) \
@@ -809,9 +1349,22 @@ _SI32_CAPSENSE_A_read_data(SI32_CAPSENSE_A_Type* /*basePointer*/);
 ///  Valid range is 32 bits.
 ///  Write to SCANM register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_write_scanm(
+   SI32_CAPSENSE_A_Type * basePointer,
+   // Write to SCANM register.
+   uint32_t scanm)
+{
+   //{{
+   basePointer->SCAN.U32 = scanm;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_write_scanm(SI32_CAPSENSE_A_Type* /*basePointer*/,
    uint32_t /*scanm*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_write_scanm(basePointer, scanm)
 #define SI32_CAPSENSE_A_write_scanm(basePointer, scanm) \
@@ -826,8 +1379,19 @@ _SI32_CAPSENSE_A_write_scanm(SI32_CAPSENSE_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_CAPSENSE_A_read_scanm(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   return basePointer->SCAN.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_CAPSENSE_A_read_scanm(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_read_scanm(basePointer)
 #define SI32_CAPSENSE_A_read_scanm(basePointer) \
@@ -844,9 +1408,22 @@ _SI32_CAPSENSE_A_read_scanm(SI32_CAPSENSE_A_Type* /*basePointer*/);
 ///  mask
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_set_channel_scan_mask(
+   SI32_CAPSENSE_A_Type * basePointer,
+   uint32_t mask)
+{
+   assert(mask < 65536);   // mask < 2^16
+   //{{
+   basePointer->SCAN.U32 = mask;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_set_channel_scan_mask(SI32_CAPSENSE_A_Type* /*basePointer*/,
    uint32_t /*mask*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_set_channel_scan_mask(basePointer, mask)
 #define SI32_CAPSENSE_A_set_channel_scan_mask(basePointer, mask) \
@@ -858,8 +1435,19 @@ _SI32_CAPSENSE_A_set_channel_scan_mask(SI32_CAPSENSE_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_CAPSENSE_A_get_channel_scan_mask(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   return basePointer->SCAN.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_CAPSENSE_A_get_channel_scan_mask(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_get_channel_scan_mask(basePointer)
 #define SI32_CAPSENSE_A_get_channel_scan_mask(basePointer) \
@@ -877,9 +1465,22 @@ _SI32_CAPSENSE_A_get_channel_scan_mask(SI32_CAPSENSE_A_Type* /*basePointer*/);
 ///  Valid range is 32 bits.
 ///  Write to CSTH register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_write_csth(
+   SI32_CAPSENSE_A_Type * basePointer,
+   // Write to CSTH register.
+   uint32_t csth)
+{
+   //{{
+   basePointer->CSTH.U32 = csth;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_write_csth(SI32_CAPSENSE_A_Type* /*basePointer*/,
    uint32_t /*csth*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_write_csth(basePointer, csth)
 #define SI32_CAPSENSE_A_write_csth(basePointer, csth) \
@@ -894,8 +1495,19 @@ _SI32_CAPSENSE_A_write_csth(SI32_CAPSENSE_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_CAPSENSE_A_read_csth(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CSTH.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_CAPSENSE_A_read_csth(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_read_csth(basePointer)
 #define SI32_CAPSENSE_A_read_csth(basePointer) \
@@ -913,9 +1525,22 @@ _SI32_CAPSENSE_A_read_csth(SI32_CAPSENSE_A_Type* /*basePointer*/);
 ///  Valid range is 32 bits.
 ///  Write to MUX register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_write_mux(
+   SI32_CAPSENSE_A_Type * basePointer,
+   // Write to MUX register.
+   uint32_t mux)
+{
+   //{{
+   basePointer->MUX.U32 = mux;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_write_mux(SI32_CAPSENSE_A_Type* /*basePointer*/,
    uint32_t /*mux*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_write_mux(basePointer, mux)
 #define SI32_CAPSENSE_A_write_mux(basePointer, mux) \
@@ -930,8 +1555,19 @@ _SI32_CAPSENSE_A_write_mux(SI32_CAPSENSE_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_CAPSENSE_A_read_mux(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   return basePointer->MUX.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_CAPSENSE_A_read_mux(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_read_mux(basePointer)
 #define SI32_CAPSENSE_A_read_mux(basePointer) \
@@ -946,8 +1582,19 @@ _SI32_CAPSENSE_A_read_mux(SI32_CAPSENSE_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_connect_capsense_channel(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   basePointer->MUX.CSDISC = SI32_CAPSENSE_A_MUX_CSDISC_CONNECT_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_connect_capsense_channel(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_connect_capsense_channel(basePointer)
 #define SI32_CAPSENSE_A_connect_capsense_channel(basePointer) \
@@ -962,8 +1609,19 @@ _SI32_CAPSENSE_A_connect_capsense_channel(SI32_CAPSENSE_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_disconnect_capsense_channel(
+   SI32_CAPSENSE_A_Type * basePointer)
+{
+   //{{
+   basePointer->MUX.CSDISC = SI32_CAPSENSE_A_MUX_CSDISC_DISCONNECT_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_disconnect_capsense_channel(SI32_CAPSENSE_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_disconnect_capsense_channel(basePointer)
 #define SI32_CAPSENSE_A_disconnect_capsense_channel(basePointer) \
@@ -985,9 +1643,23 @@ _SI32_CAPSENSE_A_disconnect_capsense_channel(SI32_CAPSENSE_A_Type* /*basePointer
 ///  reset
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_set_double_reset(
+   SI32_CAPSENSE_A_Type * basePointer,
+   uint32_t reset)
+{
+   (void)basePointer;
+   (void)reset;
+   assert(reset < 4);   // reset < 2^2
+   //{{
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_set_double_reset(SI32_CAPSENSE_A_Type* /*basePointer*/,
    uint32_t /*reset*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_set_double_reset(basePointer, reset)
 #define SI32_CAPSENSE_A_set_double_reset(basePointer, reset) \
@@ -1008,9 +1680,23 @@ _SI32_CAPSENSE_A_set_double_reset(SI32_CAPSENSE_A_Type* /*basePointer*/,
 ///  filter
 ///  Valid range is 3 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CAPSENSE_A_set_low_pass_filter_corner_frequency(
+   SI32_CAPSENSE_A_Type * basePointer,
+   uint32_t filter)
+{
+   (void)basePointer;
+   (void)filter;
+   assert(filter < 8);   // filter < 2^3
+   //{{
+   //}}
+}
+#else
 void
 _SI32_CAPSENSE_A_set_low_pass_filter_corner_frequency(SI32_CAPSENSE_A_Type* /*basePointer*/,
    uint32_t /*filter*/);
+#endif
 ///
 /// @def SI32_CAPSENSE_A_set_low_pass_filter_corner_frequency(basePointer, filter)
 #define SI32_CAPSENSE_A_set_low_pass_filter_corner_frequency(basePointer, filter) \
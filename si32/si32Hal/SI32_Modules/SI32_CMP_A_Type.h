@@ -61,10 +61,24 @@ extern "C" {
 ///  mode
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CMP_A_initialize(
+   SI32_CMP_A_Type * basePointer,
+   uint32_t control,
+   uint32_t mode)
+{
+   //{{
+	basePointer->CONTROL.U32 = control;
+	basePointer->MODE.U32 = mode;
+   //}}
+}
+#else
 void
 _SI32_CMP_A_initialize(SI32_CMP_A_Type* /*basePointer*/,
    uint32_t, /*control*/
    uint32_t /*mode*/);
+#endif
 ///
 /// @def SI32_CMP_A_initialize(basePointer, control, mode)
 #define SI32_CMP_A_initialize(basePointer, control, mode) do{  \
@@ -86,9 +100,21 @@ _SI32_CMP_A_initialize(SI32_CMP_A_Type* /*basePointer*/,
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CMP_A_write_control(
+   SI32_CMP_A_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_CMP_A_write_control(SI32_CMP_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_CMP_A_write_control(basePointer, control)
 #define SI32_CMP_A_write_control(basePointer, control) \
@@ -103,8 +129,19 @@ _SI32_CMP_A_write_control(SI32_CMP_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_CMP_A_read_control(
+   SI32_CMP_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_CMP_A_read_control(SI32_CMP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CMP_A_read_control(basePointer)
 #define SI32_CMP_A_read_control(basePointer) \
@@ -116,8 +153,19 @@ _SI32_CMP_A_read_control(SI32_CMP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_CMP_A_is_rising_edge_interrupt_pending(
+   SI32_CMP_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.CMPRI);
+   //}}
+}
+#else
 bool
 _SI32_CMP_A_is_rising_edge_interrupt_pending(SI32_CMP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CMP_A_is_rising_edge_interrupt_pending(basePointer)
 #define SI32_CMP_A_is_rising_edge_interrupt_pending(basePointer) \
@@ -129,8 +177,19 @@ _SI32_CMP_A_is_rising_edge_interrupt_pending(SI32_CMP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CMP_A_clear_rising_edge_interrupt(
+   SI32_CMP_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_CMP_A_CONTROL_CMPRI_MASK;
+   //}}
+}
+#else
 void
 _SI32_CMP_A_clear_rising_edge_interrupt(SI32_CMP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CMP_A_clear_rising_edge_interrupt(basePointer)
 #define SI32_CMP_A_clear_rising_edge_interrupt(basePointer) \
@@ -142,8 +201,19 @@ _SI32_CMP_A_clear_rising_edge_interrupt(SI32_CMP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_CMP_A_is_falling_edge_interrupt_pending(
+   SI32_CMP_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.CMPFI);
+   //}}
+}
+#else
 bool
 _SI32_CMP_A_is_falling_edge_interrupt_pending(SI32_CMP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CMP_A_is_falling_edge_interrupt_pending(basePointer)
 #define SI32_CMP_A_is_falling_edge_interrupt_pending(basePointer) \
@@ -155,8 +225,19 @@ _SI32_CMP_A_is_falling_edge_interrupt_pending(SI32_CMP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CMP_A_clear_falling_edge_interrupt(
+   SI32_CMP_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_CMP_A_CONTROL_CMPFI_MASK;
+   //}}
+}
+#else
 void
 _SI32_CMP_A_clear_falling_edge_interrupt(SI32_CMP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CMP_A_clear_falling_edge_interrupt(basePointer)
 #define SI32_CMP_A_clear_falling_edge_interrupt(basePointer) \
@@ -168,8 +249,19 @@ _SI32_CMP_A_clear_falling_edge_interrupt(SI32_CMP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_CMP_A_is_positive_input_greater_than_negative_input(
+   SI32_CMP_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.CMPOUT);
+   //}}
+}
+#else
 bool
 _SI32_CMP_A_is_positive_input_greater_than_negative_input(SI32_CMP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CMP_A_is_positive_input_greater_than_negative_input(basePointer)
 #define SI32_CMP_A_is_positive_input_greater_than_negative_input(basePointer) \
@@ -181,8 +273,19 @@ _SI32_CMP_A_is_positive_input_greater_than_negative_input(SI32_CMP_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CMP_A_enable_module(
+   SI32_CMP_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_CMP_A_CONTROL_CMPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CMP_A_enable_module(SI32_CMP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CMP_A_enable_module(basePointer)
 #define SI32_CMP_A_enable_module(basePointer) \
@@ -194,8 +297,19 @@ _SI32_CMP_A_enable_module(SI32_CMP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CMP_A_disable_module(
+   SI32_CMP_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_CMP_A_CONTROL_CMPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CMP_A_disable_module(SI32_CMP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CMP_A_disable_module(basePointer)
 #define SI32_CMP_A_disable_module(basePointer) \
@@ -215,9 +329,21 @@ _SI32_CMP_A_disable_module(SI32_CMP_A_Type* /*basePointer*/);
 ///  mode
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CMP_A_write_mode(
+   SI32_CMP_A_Type * basePointer,
+   uint32_t mode)
+{
+   //{{
+   basePointer->MODE.U32 = mode;
+   //}}
+}
+#else
 void
 _SI32_CMP_A_write_mode(SI32_CMP_A_Type* /*basePointer*/,
    uint32_t /*mode*/);
+#endif
 ///
 /// @def SI32_CMP_A_write_mode(basePointer, mode)
 #define SI32_CMP_A_write_mode(basePointer, mode) \
@@ -232,8 +358,19 @@ _SI32_CMP_A_write_mode(SI32_CMP_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_CMP_A_read_mode(
+   SI32_CMP_A_Type * basePointer)
+{
+   //{{
+   return basePointer->MODE.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_CMP_A_read_mode(SI32_CMP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CMP_A_read_mode(basePointer)
 #define SI32_CMP_A_read_mode(basePointer) \
@@ -251,9 +388,24 @@ _SI32_CMP_A_read_mode(SI32_CMP_A_Type* /*basePointer*/);
 ///  Valid range is 4 bits.
 ///  Selects negative input from 0 (CMPnN.0) to 15 (CMPnN.15).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CMP_A_select_negative_input(
+   SI32_CMP_A_Type * basePointer,
+   // Selects negative input from 0 (CMPnN.0) to 15 (CMPnN.15).
+   uint32_t input)
+{
+   assert(input < 16);   // input < 2^4
+   //{{
+   basePointer->MODE_CLR = SI32_CMP_A_MODE_NMUX_MASK;
+   basePointer->MODE_SET = input << SI32_CMP_A_MODE_NMUX_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_CMP_A_select_negative_input(SI32_CMP_A_Type* /*basePointer*/,
    uint32_t /*input*/);
+#endif
 ///
 /// @def SI32_CMP_A_select_negative_input(basePointer, input)
 #define SI32_CMP_A_select_negative_input(basePointer, input) do{  \
@@ -273,9 +425,24 @@ _SI32_CMP_A_select_negative_input(SI32_CMP_A_Type* /*basePointer*/,
 ///  Valid range is 4 bits.
 ///  Selects positive input from 0 (CMPnP.0) to 15 (CMPnP.15).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CMP_A_select_positive_input(
+   SI32_CMP_A_Type * basePointer,
+   // Selects positive input from 0 (CMPnP.0) to 15 (CMPnP.15).
+   uint32_t input)
+{
+   assert(input < 16);   // input < 2^4
+   //{{
+   basePointer->MODE_CLR = SI32_CMP_A_MODE_PMUX_MASK;
+   basePointer->MODE_SET = input << SI32_CMP_A_MODE_PMUX_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_CMP_A_select_positive_input(SI32_CMP_A_Type* /*basePointer*/,
    uint32_t /*input*/);
+#endif
 ///
 /// @def SI32_CMP_A_select_positive_input(basePointer, input)
 #define SI32_CMP_A_select_positive_input(basePointer, input) do{  \
@@ -302,9 +469,31 @@ _SI32_CMP_A_select_positive_input(SI32_CMP_A_Type* /*basePointer*/,
 ///  negative input to connect to the DAC and the positive input to connect
 ///  to the signal based off of CMXOP.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CMP_A_select_mux(
+   SI32_CMP_A_Type * basePointer,
+   // 0: Configures the positive input to connect to the signal based off of
+   // CMXOP and the negative input to connect to the signal based off of
+   // CMXON.  1: Configures the negative input to connect to VDD and the
+   // positive input to connect to the signal based off of CMXOP.  2:
+   // Configures the negative input to connect to the signal based off of
+   // CMXON and the positive input to connect to the DAC.  3: Configures the
+   // negative input to connect to the DAC and the positive input to connect
+   // to the signal based off of CMXOP.
+   SI32_CMP_A_INPUT_MUX_Enum_Type mux)
+{
+   assert(mux < 4);   // mux < 2^2
+   //{{
+   basePointer->MODE_CLR = SI32_CMP_A_MODE_INMUX_MASK;
+   basePointer->MODE_SET = mux << SI32_CMP_A_MODE_INMUX_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_CMP_A_select_mux(SI32_CMP_A_Type* /*basePointer*/,
    SI32_CMP_A_INPUT_MUX_Enum_Type /*mux*/);
+#endif
 ///
 /// @def SI32_CMP_A_select_mux(basePointer, mux)
 #define SI32_CMP_A_select_mux(basePointer, mux) do{  \
@@ -325,9 +514,25 @@ _SI32_CMP_A_select_mux(SI32_CMP_A_Type* /*basePointer*/,
 ///  From mode 0 (fastest response time, highest power consumption) to mode
 ///  3 (slowest response time, lowest power consumption).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CMP_A_select_response_power_mode(
+   SI32_CMP_A_Type * basePointer,
+   // From mode 0 (fastest response time, highest power consumption) to mode
+   // 3 (slowest response time, lowest power consumption).
+   SI32_CMP_A_RESPONSE_POWER_MODE_Enum_Type mode)
+{
+   assert(mode < 4);   // mode < 2^2
+   //{{
+   basePointer->MODE_CLR = SI32_CMP_A_MODE_CMPMD_MASK;
+   basePointer->MODE_SET = mode << SI32_CMP_A_MODE_CMPMD_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_CMP_A_select_response_power_mode(SI32_CMP_A_Type* /*basePointer*/,
    SI32_CMP_A_RESPONSE_POWER_MODE_Enum_Type /*mode*/);
+#endif
 ///
 /// @def SI32_CMP_A_select_response_power_mode(basePointer, mode)
 #define SI32_CMP_A_select_response_power_mode(basePointer, mode) do{  \
@@ -341,8 +546,19 @@ _SI32_CMP_A_select_response_power_mode(SI32_CMP_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CMP_A_enable_falling_edge_interrupt(
+   SI32_CMP_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_SET = SI32_CMP_A_MODE_FIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CMP_A_enable_falling_edge_interrupt(SI32_CMP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CMP_A_enable_falling_edge_interrupt(basePointer)
 #define SI32_CMP_A_enable_falling_edge_interrupt(basePointer) \
@@ -354,8 +570,19 @@ _SI32_CMP_A_enable_falling_edge_interrupt(SI32_CMP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CMP_A_disable_falling_edge_interrupt(
+   SI32_CMP_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_CLR = SI32_CMP_A_MODE_FIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CMP_A_disable_falling_edge_interrupt(SI32_CMP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CMP_A_disable_falling_edge_interrupt(basePointer)
 #define SI32_CMP_A_disable_falling_edge_interrupt(basePointer) \
@@ -367,8 +594,19 @@ _SI32_CMP_A_disable_falling_edge_interrupt(SI32_CMP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_CMP_A_is_falling_edge_interrupt_enabled(
+   SI32_CMP_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->MODE.FIEN);
+   //}}
+}
+#else
 bool
 _SI32_CMP_A_is_falling_edge_interrupt_enabled(SI32_CMP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CMP_A_is_falling_edge_interrupt_enabled(basePointer)
 #define SI32_CMP_A_is_falling_edge_interrupt_enabled(basePointer) \
@@ -380,8 +618,19 @@ _SI32_CMP_A_is_falling_edge_interrupt_enabled(SI32_CMP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CMP_A_enable_rising_edge_interrupt(
+   SI32_CMP_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_SET = SI32_CMP_A_MODE_RIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CMP_A_enable_rising_edge_interrupt(SI32_CMP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CMP_A_enable_rising_edge_interrupt(basePointer)
 #define SI32_CMP_A_enable_rising_edge_interrupt(basePointer) \
@@ -393,8 +642,19 @@ _SI32_CMP_A_enable_rising_edge_interrupt(SI32_CMP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CMP_A_disable_rising_edge_interrupt(
+   SI32_CMP_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_CLR = SI32_CMP_A_MODE_RIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CMP_A_disable_rising_edge_interrupt(SI32_CMP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CMP_A_disable_rising_edge_interrupt(basePointer)
 #define SI32_CMP_A_disable_rising_edge_interrupt(basePointer) \
@@ -406,8 +666,19 @@ _SI32_CMP_A_disable_rising_edge_interrupt(SI32_CMP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_CMP_A_is_rising_edge_interrupt_enabled(
+   SI32_CMP_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->MODE.RIEN);
+   //}}
+}
+#else
 bool
 _SI32_CMP_A_is_rising_edge_interrupt_enabled(SI32_CMP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CMP_A_is_rising_edge_interrupt_enabled(basePointer)
 #define SI32_CMP_A_is_rising_edge_interrupt_enabled(basePointer) \
@@ -428,9 +699,23 @@ _SI32_CMP_A_is_rising_edge_interrupt_enabled(SI32_CMP_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 6 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CMP_A_write_dac_level_setting(
+   SI32_CMP_A_Type * basePointer,
+   uint32_t value)
+{
+   assert(value < 64);   // value < 2^6
+   //{{
+   basePointer->MODE_CLR = SI32_CMP_A_MODE_DACLVL_MASK;
+   basePointer->MODE_SET = value << SI32_CMP_A_MODE_DACLVL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_CMP_A_write_dac_level_setting(SI32_CMP_A_Type* /*basePointer*/,
    uint32_t /*value*/);
+#endif
 ///
 /// @def SI32_CMP_A_write_dac_level_setting(basePointer, value)
 #define SI32_CMP_A_write_dac_level_setting(basePointer, value) do{  \
@@ -448,8 +733,19 @@ _SI32_CMP_A_write_dac_level_setting(SI32_CMP_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_CMP_A_read_dac_level_setting(
+   SI32_CMP_A_Type * basePointer)
+{
+   //{{
+   return basePointer->MODE.DACLVL;
+   //}}
+}
+#else
 uint32_t
 _SI32_CMP_A_read_dac_level_setting(SI32_CMP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CMP_A_read_dac_level_setting(basePointer)
 #define SI32_CMP_A_read_dac_level_setting(basePointer) \
@@ -461,8 +757,19 @@ _SI32_CMP_A_read_dac_level_setting(SI32_CMP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CMP_A_enable_negative_weak_pullup(
+   SI32_CMP_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_SET = SI32_CMP_A_MODE_NWPUEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CMP_A_enable_negative_weak_pullup(SI32_CMP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CMP_A_enable_negative_weak_pullup(basePointer)
 #define SI32_CMP_A_enable_negative_weak_pullup(basePointer) \
@@ -474,8 +781,19 @@ _SI32_CMP_A_enable_negative_weak_pullup(SI32_CMP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CMP_A_disable_negative_weak_pullup(
+   SI32_CMP_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_CLR = SI32_CMP_A_MODE_NWPUEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CMP_A_disable_negative_weak_pullup(SI32_CMP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CMP_A_disable_negative_weak_pullup(basePointer)
 #define SI32_CMP_A_disable_negative_weak_pullup(basePointer) \
@@ -487,8 +805,19 @@ _SI32_CMP_A_disable_negative_weak_pullup(SI32_CMP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CMP_A_enable_positive_weak_pullup(
+   SI32_CMP_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_SET = SI32_CMP_A_MODE_PWPUEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CMP_A_enable_positive_weak_pullup(SI32_CMP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CMP_A_enable_positive_weak_pullup(basePointer)
 #define SI32_CMP_A_enable_positive_weak_pullup(basePointer) \
@@ -500,8 +829,19 @@ _SI32_CMP_A_enable_positive_weak_pullup(SI32_CMP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CMP_A_disable_positive_weak_pullup(
+   SI32_CMP_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_CLR = SI32_CMP_A_MODE_PWPUEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CMP_A_disable_positive_weak_pullup(SI32_CMP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CMP_A_disable_positive_weak_pullup(basePointer)
 #define SI32_CMP_A_disable_positive_weak_pullup(basePointer) \
@@ -513,8 +853,19 @@ _SI32_CMP_A_disable_positive_weak_pullup(SI32_CMP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CMP_A_select_negative_hysteresis_disabled(
+   SI32_CMP_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_CLR = SI32_CMP_A_MODE_CMPHYN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CMP_A_select_negative_hysteresis_disabled(SI32_CMP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CMP_A_select_negative_hysteresis_disabled(basePointer)
 #define SI32_CMP_A_select_negative_hysteresis_disabled(basePointer) \
@@ -526,8 +877,20 @@ _SI32_CMP_A_select_negative_hysteresis_disabled(SI32_CMP_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CMP_A_select_negative_hysteresis_5mv(
+   SI32_CMP_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_CLR = SI32_CMP_A_MODE_CMPHYN_MASK;
+   basePointer->MODE_SET = SI32_CMP_A_MODE_CMPHYN_NEG_5_MV_U32;
+   //}}
+}
+#else
 void
 _SI32_CMP_A_select_negative_hysteresis_5mv(SI32_CMP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CMP_A_select_negative_hysteresis_5mv(basePointer)
 #define SI32_CMP_A_select_negative_hysteresis_5mv(basePointer) do{  \
@@ -541,8 +904,20 @@ _SI32_CMP_A_select_negative_hysteresis_5mv(SI32_CMP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CMP_A_select_negative_hysteresis_10mv(
+   SI32_CMP_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_CLR = SI32_CMP_A_MODE_CMPHYN_MASK;
+   basePointer->MODE_SET = SI32_CMP_A_MODE_CMPHYN_NEG_10_MV_U32;
+   //}}
+}
+#else
 void
 _SI32_CMP_A_select_negative_hysteresis_10mv(SI32_CMP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CMP_A_select_negative_hysteresis_10mv(basePointer)
 #define SI32_CMP_A_select_negative_hysteresis_10mv(basePointer) do{  \
@@ -556,8 +931,20 @@ _SI32_CMP_A_select_negative_hysteresis_10mv(SI32_CMP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CMP_A_select_negative_hysteresis_20mv(
+   SI32_CMP_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_CLR = SI32_CMP_A_MODE_CMPHYN_MASK;
+   basePointer->MODE_SET = SI32_CMP_A_MODE_CMPHYN_NEG_20_MV_U32;
+   //}}
+}
+#else
 void
 _SI32_CMP_A_select_negative_hysteresis_20mv(SI32_CMP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CMP_A_select_negative_hysteresis_20mv(basePointer)
 #define SI32_CMP_A_select_negative_hysteresis_20mv(basePointer) do{  \
@@ -571,8 +958,19 @@ _SI32_CMP_A_select_negative_hysteresis_20mv(SI32_CMP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CMP_A_select_positive_hysteresis_disabled(
+   SI32_CMP_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_CLR = SI32_CMP_A_MODE_CMPHYP_MASK;
+   //}}
+}
+#else
 void
 _SI32_CMP_A_select_positive_hysteresis_disabled(SI32_CMP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CMP_A_select_positive_hysteresis_disabled(basePointer)
 #define SI32_CMP_A_select_positive_hysteresis_disabled(basePointer) \
@@ -584,8 +982,20 @@ _SI32_CMP_A_select_positive_hysteresis_disabled(SI32_CMP_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CMP_A_select_positive_hysteresis_5mv(
+   SI32_CMP_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_CLR = SI32_CMP_A_MODE_CMPHYP_MASK;
+   basePointer->MODE_SET = SI32_CMP_A_MODE_CMPHYP_POS_5_MV_U32;
+   //}}
+}
+#else
 void
 _SI32_CMP_A_select_positive_hysteresis_5mv(SI32_CMP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CMP_A_select_positive_hysteresis_5mv(basePointer)
 #define SI32_CMP_A_select_positive_hysteresis_5mv(basePointer) do{  \
@@ -599,8 +1009,20 @@ _SI32_CMP_A_select_positive_hysteresis_5mv(SI32_CMP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CMP_A_select_positive_hysteresis_10mv(
+   SI32_CMP_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_CLR = SI32_CMP_A_MODE_CMPHYP_MASK;
+   basePointer->MODE_SET = SI32_CMP_A_MODE_CMPHYP_POS_10_MV_U32;
+   //}}
+}
+#else
 void
 _SI32_CMP_A_select_positive_hysteresis_10mv(SI32_CMP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CMP_A_select_positive_hysteresis_10mv(basePointer)
 #define SI32_CMP_A_select_positive_hysteresis_10mv(basePointer) do{  \
@@ -614,8 +1036,20 @@ _SI32_CMP_A_select_positive_hysteresis_10mv(SI32_CMP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CMP_A_select_positive_hysteresis_20mv(
+   SI32_CMP_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_CLR = SI32_CMP_A_MODE_CMPHYP_MASK;
+   basePointer->MODE_SET = SI32_CMP_A_MODE_CMPHYP_POS_20_MV_U32;
+   //}}
+}
+#else
 void
 _SI32_CMP_A_select_positive_hysteresis_20mv(SI32_CMP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CMP_A_select_positive_hysteresis_20mv(basePointer)
 #define SI32_CMP_A_select_positive_hysteresis_20mv(basePointer) do{  \
@@ -629,8 +1063,19 @@ _SI32_CMP_A_select_positive_hysteresis_20mv(SI32_CMP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CMP_A_enable_inverted_output(
+   SI32_CMP_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_SET = SI32_CMP_A_MODE_INVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CMP_A_enable_inverted_output(SI32_CMP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CMP_A_enable_inverted_output(basePointer)
 #define SI32_CMP_A_enable_inverted_output(basePointer) \
@@ -642,8 +1087,19 @@ _SI32_CMP_A_enable_inverted_output(SI32_CMP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CMP_A_disable_inverted_output(
+   SI32_CMP_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_CLR = SI32_CMP_A_MODE_INVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CMP_A_disable_inverted_output(SI32_CMP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CMP_A_disable_inverted_output(basePointer)
 #define SI32_CMP_A_disable_inverted_output(basePointer) \
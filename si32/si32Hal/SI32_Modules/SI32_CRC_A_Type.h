@@ -54,9 +54,22 @@ extern "C" {
 ///  Valid range is 32 bits.
 ///  Write to the CONTROL register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CRC_A_initialize(
+   SI32_CRC_A_Type * basePointer,
+   // Write to the CONTROL register.
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_CRC_A_initialize(SI32_CRC_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_CRC_A_initialize(basePointer, control)
 #define SI32_CRC_A_initialize(basePointer, control) \
@@ -74,9 +87,22 @@ _SI32_CRC_A_initialize(SI32_CRC_A_Type* /*basePointer*/,
 ///  Valid range is 32 bits.
 ///  Write to CONTROL register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CRC_A_write_control(
+   SI32_CRC_A_Type * basePointer,
+   // Write to CONTROL register.
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_CRC_A_write_control(SI32_CRC_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_CRC_A_write_control(basePointer, control)
 #define SI32_CRC_A_write_control(basePointer, control) \
@@ -91,8 +117,19 @@ _SI32_CRC_A_write_control(SI32_CRC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_CRC_A_read_control(
+   SI32_CRC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_CRC_A_read_control(SI32_CRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CRC_A_read_control(basePointer)
 #define SI32_CRC_A_read_control(basePointer) \
@@ -104,8 +141,19 @@ _SI32_CRC_A_read_control(SI32_CRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CRC_A_initialize_seed_to_zero(
+   SI32_CRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_CRC_A_CONTROL_SINITEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CRC_A_initialize_seed_to_zero(SI32_CRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CRC_A_initialize_seed_to_zero(basePointer)
 #define SI32_CRC_A_initialize_seed_to_zero(basePointer) \
@@ -120,8 +168,20 @@ _SI32_CRC_A_initialize_seed_to_zero(SI32_CRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CRC_A_initialize_seed_to_one(
+   SI32_CRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_CRC_A_CONTROL_SEED_ALL_ONES_U32
+                              | SI32_CRC_A_CONTROL_SINITEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CRC_A_initialize_seed_to_one(SI32_CRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CRC_A_initialize_seed_to_one(basePointer)
 #define SI32_CRC_A_initialize_seed_to_one(basePointer) do{  \
@@ -135,8 +195,19 @@ _SI32_CRC_A_initialize_seed_to_one(SI32_CRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CRC_A_enable_module(
+   SI32_CRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_CRC_A_CONTROL_CRCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CRC_A_enable_module(SI32_CRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CRC_A_enable_module(basePointer)
 #define SI32_CRC_A_enable_module(basePointer) \
@@ -148,8 +219,19 @@ _SI32_CRC_A_enable_module(SI32_CRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CRC_A_disable_module(
+   SI32_CRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_CRC_A_CONTROL_CRCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CRC_A_disable_module(SI32_CRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CRC_A_disable_module(basePointer)
 #define SI32_CRC_A_disable_module(basePointer) \
@@ -161,8 +243,19 @@ _SI32_CRC_A_disable_module(SI32_CRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CRC_A_select_polynomial_32_bit_04C11DB7(
+   SI32_CRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_CRC_A_CONTROL_POLYSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_CRC_A_select_polynomial_32_bit_04C11DB7(SI32_CRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CRC_A_select_polynomial_32_bit_04C11DB7(basePointer)
 #define SI32_CRC_A_select_polynomial_32_bit_04C11DB7(basePointer) \
@@ -174,8 +267,20 @@ _SI32_CRC_A_select_polynomial_32_bit_04C11DB7(SI32_CRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CRC_A_select_polynomial_16_bit_1021(
+   SI32_CRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_CRC_A_CONTROL_POLYSEL_MASK;
+   basePointer->CONTROL_SET = SI32_CRC_A_CONTROL_POLYSEL_CRC_16_1021_U32;
+   //}}
+}
+#else
 void
 _SI32_CRC_A_select_polynomial_16_bit_1021(SI32_CRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CRC_A_select_polynomial_16_bit_1021(basePointer)
 #define SI32_CRC_A_select_polynomial_16_bit_1021(basePointer) do{  \
@@ -189,8 +294,20 @@ _SI32_CRC_A_select_polynomial_16_bit_1021(SI32_CRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CRC_A_select_polynomial_16_bit_3D65(
+   SI32_CRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_CRC_A_CONTROL_POLYSEL_MASK;
+   basePointer->CONTROL_SET = SI32_CRC_A_CONTROL_POLYSEL_CRC_16_3D65_U32;
+   //}}
+}
+#else
 void
 _SI32_CRC_A_select_polynomial_16_bit_3D65(SI32_CRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CRC_A_select_polynomial_16_bit_3D65(basePointer)
 #define SI32_CRC_A_select_polynomial_16_bit_3D65(basePointer) do{  \
@@ -204,8 +321,19 @@ _SI32_CRC_A_select_polynomial_16_bit_3D65(SI32_CRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CRC_A_select_polynomial_16_bit_8005(
+   SI32_CRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_CRC_A_CONTROL_POLYSEL_CRC_16_8005_U32;
+   //}}
+}
+#else
 void
 _SI32_CRC_A_select_polynomial_16_bit_8005(SI32_CRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CRC_A_select_polynomial_16_bit_8005(basePointer)
 #define SI32_CRC_A_select_polynomial_16_bit_8005(basePointer) \
@@ -221,8 +349,31 @@ _SI32_CRC_A_select_polynomial_16_bit_8005(SI32_CRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline SI32_CRC_A_POLYNOMIAL_Enum_Type
+_SI32_CRC_A_get_polynomial(
+   SI32_CRC_A_Type * basePointer)
+{
+   //{{
+	SI32_CRC_A_POLYNOMIAL_Enum_Type result;
+	switch (basePointer->CONTROL.POLYSEL)
+	{
+	   case SI32_CRC_A_CONTROL_POLYSEL_CRC_32_04C11DB7_VALUE:
+	      result = SI32_CRC_A_POLYNOMIAL_32_BIT_04C11DB7;
+	   case SI32_CRC_A_CONTROL_POLYSEL_CRC_16_1021_VALUE:
+	      result = SI32_CRC_A_POLYNOMIAL_16_BIT_1021;
+	   case SI32_CRC_A_CONTROL_POLYSEL_CRC_16_3D65_VALUE:
+	      result = SI32_CRC_A_POLYNOMIAL_16_BIT_3D65;
+	   case SI32_CRC_A_CONTROL_POLYSEL_CRC_16_8005_VALUE:
+	      result = SI32_CRC_A_POLYNOMIAL_16_BIT_8005;
+	}
+	return result;
+   //}}
+}
+#else
 SI32_CRC_A_POLYNOMIAL_Enum_Type
 _SI32_CRC_A_get_polynomial(SI32_CRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CRC_A_get_polynomial(basePointer)
 #define SI32_CRC_A_get_polynomial(basePointer) \
@@ -234,8 +385,19 @@ _SI32_CRC_A_get_polynomial(SI32_CRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CRC_A_select_byte_mode(
+   SI32_CRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_CRC_A_CONTROL_BMDEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CRC_A_select_byte_mode(SI32_CRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CRC_A_select_byte_mode(basePointer)
 #define SI32_CRC_A_select_byte_mode(basePointer) \
@@ -247,8 +409,19 @@ _SI32_CRC_A_select_byte_mode(SI32_CRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CRC_A_select_word_mode(
+   SI32_CRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_CRC_A_CONTROL_BMDEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CRC_A_select_word_mode(SI32_CRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CRC_A_select_word_mode(basePointer)
 #define SI32_CRC_A_select_word_mode(basePointer) \
@@ -260,8 +433,19 @@ _SI32_CRC_A_select_word_mode(SI32_CRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CRC_A_enable_bit_reversal(
+   SI32_CRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_CRC_A_CONTROL_BBREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CRC_A_enable_bit_reversal(SI32_CRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CRC_A_enable_bit_reversal(basePointer)
 #define SI32_CRC_A_enable_bit_reversal(basePointer) \
@@ -273,8 +457,19 @@ _SI32_CRC_A_enable_bit_reversal(SI32_CRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CRC_A_disable_bit_reversal(
+   SI32_CRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_CRC_A_CONTROL_BBREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CRC_A_disable_bit_reversal(SI32_CRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CRC_A_disable_bit_reversal(basePointer)
 #define SI32_CRC_A_disable_bit_reversal(basePointer) \
@@ -294,9 +489,26 @@ _SI32_CRC_A_disable_bit_reversal(SI32_CRC_A_Type* /*basePointer*/);
 ///  B1 B0, output: B2 B3 B0 B1), 2 = 32-bit big endian order (input: B3 B2
 ///  B1 B0, output: B0 B1 B2 B3), 3 = reserved.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CRC_A_set_processing_order(
+   SI32_CRC_A_Type * basePointer,
+   // 0 = no byte reorientation, 1 = 16-bit big endian order (input: B3 B2
+   // B1 B0, output: B2 B3 B0 B1), 2 = 32-bit big endian order (input: B3 B2
+   // B1 B0, output: B0 B1 B2 B3), 3 = reserved.
+   SI32_CRC_A_PROCESSING_ORDER_Enum_Type order)
+{
+   assert(order < 4);   // order < 2^2
+   //{{
+   basePointer->CONTROL_CLR = SI32_CRC_A_CONTROL_ORDER_MASK;
+   basePointer->CONTROL_SET = order << SI32_CRC_A_CONTROL_ORDER_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_CRC_A_set_processing_order(SI32_CRC_A_Type* /*basePointer*/,
    SI32_CRC_A_PROCESSING_ORDER_Enum_Type /*order*/);
+#endif
 ///
 /// @def SI32_CRC_A_set_processing_order(basePointer, order)
 #define SI32_CRC_A_set_processing_order(basePointer, order) do{  \
@@ -315,8 +527,29 @@ _SI32_CRC_A_set_processing_order(SI32_CRC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline SI32_CRC_A_PROCESSING_ORDER_Enum_Type
+_SI32_CRC_A_get_processing_order(
+   SI32_CRC_A_Type * basePointer)
+{
+   //{{
+	SI32_CRC_A_PROCESSING_ORDER_Enum_Type result;
+   switch (basePointer->CONTROL.ORDER)
+  	{
+	   case SI32_CRC_A_CONTROL_ORDER_NO_REORDER_VALUE:
+	      result = SI32_CRC_A_PROCESSING_ORDER_NO_BYTE_REORIENTATION;
+	   case SI32_CRC_A_CONTROL_ORDER_BIG_ENDIAN_16_VALUE:
+	      result= SI32_CRC_A_PROCESSING_ORDER_16_BIT_BIG_ENDIAN;
+	   case SI32_CRC_A_CONTROL_ORDER_BIG_ENDIAN_32_VALUE:
+	      result = SI32_CRC_A_PROCESSING_ORDER_32_BIT_BIG_ENDIAN;
+	}
+	return result;
+   //}}
+}
+#else
 SI32_CRC_A_PROCESSING_ORDER_Enum_Type
 _SI32_CRC_A_get_processing_order(SI32_CRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CRC_A_get_processing_order(basePointer)
 #define SI32_CRC_A_get_processing_order(basePointer) \
@@ -333,9 +566,21 @@ _SI32_CRC_A_get_processing_order(SI32_CRC_A_Type* /*basePointer*/);
 ///  crcin
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CRC_A_write_data(
+   SI32_CRC_A_Type * basePointer,
+   uint32_t crcin)
+{
+   //{{
+   basePointer->DATA.U32 = crcin;
+   //}}
+}
+#else
 void
 _SI32_CRC_A_write_data(SI32_CRC_A_Type* /*basePointer*/,
    uint32_t /*crcin*/);
+#endif
 ///
 /// @def SI32_CRC_A_write_data(basePointer, crcin)
 #define SI32_CRC_A_write_data(basePointer, crcin) \
@@ -347,8 +592,19 @@ _SI32_CRC_A_write_data(SI32_CRC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_CRC_A_read_result(
+   SI32_CRC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DATA.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_CRC_A_read_result(SI32_CRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CRC_A_read_result(basePointer)
 #define SI32_CRC_A_read_result(basePointer) \
@@ -360,8 +616,19 @@ _SI32_CRC_A_read_result(SI32_CRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_CRC_A_read_bit_reversed_result(
+   SI32_CRC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->RDATA.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_CRC_A_read_bit_reversed_result(SI32_CRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CRC_A_read_bit_reversed_result(basePointer)
 #define SI32_CRC_A_read_bit_reversed_result(basePointer) \
@@ -58,10 +58,26 @@ extern "C" {
 ///  Valid range is 32 bits.
 ///  Write to CONFIG register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DCDC_A_initialize(
+   SI32_DCDC_A_Type * basePointer,
+   // Write to CONTROL register.
+   uint32_t control,
+   // Write to CONFIG register.
+   uint32_t config)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   basePointer->CONFIG.U32 = config;
+   //}}
+}
+#else
 void
 _SI32_DCDC_A_initialize(SI32_DCDC_A_Type* /*basePointer*/,
    uint32_t, /*control*/
    uint32_t /*config*/);
+#endif
 ///
 /// @def SI32_DCDC_A_initialize(basePointer, control, config)
 #define SI32_DCDC_A_initialize(basePointer, control, config) do{  \
@@ -83,9 +99,22 @@ _SI32_DCDC_A_initialize(SI32_DCDC_A_Type* /*basePointer*/,
 ///  control
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DCDC_A_write_control(
+   SI32_DCDC_A_Type * basePointer,
+   uint32_t control)
+{
+   assert(control < 4);   // control < 2^2
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_DCDC_A_write_control(SI32_DCDC_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_DCDC_A_write_control(basePointer, control)
 #define SI32_DCDC_A_write_control(basePointer, control) \
@@ -100,8 +129,19 @@ _SI32_DCDC_A_write_control(SI32_DCDC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_DCDC_A_read_control(
+   SI32_DCDC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_DCDC_A_read_control(SI32_DCDC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DCDC_A_read_control(basePointer)
 #define SI32_DCDC_A_read_control(basePointer) \
@@ -118,8 +158,19 @@ _SI32_DCDC_A_read_control(SI32_DCDC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_DCDC_A_is_output_high_flag_set(
+   SI32_DCDC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.RDYHIGHF;
+   //}}
+}
+#else
 bool
 _SI32_DCDC_A_is_output_high_flag_set(SI32_DCDC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DCDC_A_is_output_high_flag_set(basePointer)
 #define SI32_DCDC_A_is_output_high_flag_set(basePointer) \
@@ -136,8 +187,19 @@ _SI32_DCDC_A_is_output_high_flag_set(SI32_DCDC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_DCDC_A_is_output_low_flag_set(
+   SI32_DCDC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.RDYLOWF;
+   //}}
+}
+#else
 bool
 _SI32_DCDC_A_is_output_low_flag_set(SI32_DCDC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DCDC_A_is_output_low_flag_set(basePointer)
 #define SI32_DCDC_A_is_output_low_flag_set(basePointer) \
@@ -154,8 +216,19 @@ _SI32_DCDC_A_is_output_low_flag_set(SI32_DCDC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_DCDC_A_is_dropout_flag_set(
+   SI32_DCDC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.DROPOUTF;
+   //}}
+}
+#else
 bool
 _SI32_DCDC_A_is_dropout_flag_set(SI32_DCDC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DCDC_A_is_dropout_flag_set(basePointer)
 #define SI32_DCDC_A_is_dropout_flag_set(basePointer) \
@@ -171,8 +244,19 @@ _SI32_DCDC_A_is_dropout_flag_set(SI32_DCDC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_DCDC_A_is_bandgap_voltage_above_threshold(
+   SI32_DCDC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.BGRDYF;
+   //}}
+}
+#else
 bool
 _SI32_DCDC_A_is_bandgap_voltage_above_threshold(SI32_DCDC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DCDC_A_is_bandgap_voltage_above_threshold(basePointer)
 #define SI32_DCDC_A_is_bandgap_voltage_above_threshold(basePointer) \
@@ -187,8 +271,19 @@ _SI32_DCDC_A_is_bandgap_voltage_above_threshold(SI32_DCDC_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DCDC_A_enable_dcdc_oscillator(
+   SI32_DCDC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_DCDC_A_CONTROL_OSCDIS_MASK;
+   //}}
+}
+#else
 void
 _SI32_DCDC_A_enable_dcdc_oscillator(SI32_DCDC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DCDC_A_enable_dcdc_oscillator(basePointer)
 #define SI32_DCDC_A_enable_dcdc_oscillator(basePointer) \
@@ -203,8 +298,19 @@ _SI32_DCDC_A_enable_dcdc_oscillator(SI32_DCDC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DCDC_A_disable_dcdc_oscillator(
+   SI32_DCDC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_DCDC_A_CONTROL_OSCDIS_ACTIVE_U32;
+   //}}
+}
+#else
 void
 _SI32_DCDC_A_disable_dcdc_oscillator(SI32_DCDC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DCDC_A_disable_dcdc_oscillator(basePointer)
 #define SI32_DCDC_A_disable_dcdc_oscillator(basePointer) \
@@ -219,8 +325,19 @@ _SI32_DCDC_A_disable_dcdc_oscillator(SI32_DCDC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DCDC_A_select_clock_source_apb(
+   SI32_DCDC_A_Type * basePointer)
+{
+   //{{
+      basePointer->CONTROL_SET = SI32_DCDC_A_CONTROL_CLKSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_DCDC_A_select_clock_source_apb(SI32_DCDC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DCDC_A_select_clock_source_apb(basePointer)
 #define SI32_DCDC_A_select_clock_source_apb(basePointer) \
@@ -236,8 +353,19 @@ _SI32_DCDC_A_select_clock_source_apb(SI32_DCDC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DCDC_A_select_clock_source_local(
+   SI32_DCDC_A_Type * basePointer)
+{
+   //{{
+      basePointer->CONTROL_CLR = SI32_DCDC_A_CONTROL_CLKSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_DCDC_A_select_clock_source_local(SI32_DCDC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DCDC_A_select_clock_source_local(basePointer)
 #define SI32_DCDC_A_select_clock_source_local(basePointer) \
@@ -258,9 +386,23 @@ _SI32_DCDC_A_select_clock_source_local(SI32_DCDC_A_Type* /*basePointer*/);
 ///  divider
 ///  Valid range is 0 to 4.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DCDC_A_select_clock_divider(
+   SI32_DCDC_A_Type * basePointer,
+   uint32_t divider)
+{
+   assert(divider <= 4);
+   //{{
+   basePointer->CONTROL_CLR = SI32_DCDC_A_CONTROL_CLKDIV_MASK;
+   basePointer->CONTROL_SET = divider << SI32_DCDC_A_CONTROL_CLKDIV_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_DCDC_A_select_clock_divider(SI32_DCDC_A_Type* /*basePointer*/,
    uint32_t /*divider*/);
+#endif
 ///
 /// @def SI32_DCDC_A_select_clock_divider(basePointer, divider)
 #define SI32_DCDC_A_select_clock_divider(basePointer, divider) do{  \
@@ -277,8 +419,19 @@ _SI32_DCDC_A_select_clock_divider(SI32_DCDC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DCDC_A_select_adc_synchronous_mode(
+   SI32_DCDC_A_Type * basePointer)
+{
+   //{{
+      basePointer->CONTROL_SET = SI32_DCDC_A_CONTROL_ADCSYNCEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_DCDC_A_select_adc_synchronous_mode(SI32_DCDC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DCDC_A_select_adc_synchronous_mode(basePointer)
 #define SI32_DCDC_A_select_adc_synchronous_mode(basePointer) \
@@ -293,8 +446,19 @@ _SI32_DCDC_A_select_adc_synchronous_mode(SI32_DCDC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DCDC_A_select_adc_asynchronous_mode(
+   SI32_DCDC_A_Type * basePointer)
+{
+   //{{
+    basePointer->CONTROL_CLR = SI32_DCDC_A_CONTROL_ADCSYNCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_DCDC_A_select_adc_asynchronous_mode(SI32_DCDC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DCDC_A_select_adc_asynchronous_mode(basePointer)
 #define SI32_DCDC_A_select_adc_asynchronous_mode(basePointer) \
@@ -306,8 +470,19 @@ _SI32_DCDC_A_select_adc_asynchronous_mode(SI32_DCDC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DCDC_A_enable_converter_clock_inversion(
+   SI32_DCDC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_DCDC_A_CONTROL_CLKINVEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_DCDC_A_enable_converter_clock_inversion(SI32_DCDC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DCDC_A_enable_converter_clock_inversion(basePointer)
 #define SI32_DCDC_A_enable_converter_clock_inversion(basePointer) \
@@ -319,8 +494,19 @@ _SI32_DCDC_A_enable_converter_clock_inversion(SI32_DCDC_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DCDC_A_disable_converter_clock_inversion(
+   SI32_DCDC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_DCDC_A_CONTROL_CLKINVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_DCDC_A_disable_converter_clock_inversion(SI32_DCDC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DCDC_A_disable_converter_clock_inversion(basePointer)
 #define SI32_DCDC_A_disable_converter_clock_inversion(basePointer) \
@@ -336,8 +522,19 @@ _SI32_DCDC_A_disable_converter_clock_inversion(SI32_DCDC_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DCDC_A_enable_adc_clock_inversion(
+   SI32_DCDC_A_Type * basePointer)
+{
+   //{{
+        basePointer->CONTROL_SET = SI32_DCDC_A_CONTROL_ADCCLKINVEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_DCDC_A_enable_adc_clock_inversion(SI32_DCDC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DCDC_A_enable_adc_clock_inversion(basePointer)
 #define SI32_DCDC_A_enable_adc_clock_inversion(basePointer) \
@@ -349,8 +546,19 @@ _SI32_DCDC_A_enable_adc_clock_inversion(SI32_DCDC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DCDC_A_disable_adc_clock_inversion(
+   SI32_DCDC_A_Type * basePointer)
+{
+   //{{
+         basePointer->CONTROL_CLR = SI32_DCDC_A_CONTROL_ADCCLKINVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_DCDC_A_disable_adc_clock_inversion(SI32_DCDC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DCDC_A_disable_adc_clock_inversion(basePointer)
 #define SI32_DCDC_A_disable_adc_clock_inversion(basePointer) \
@@ -373,9 +581,23 @@ _SI32_DCDC_A_disable_adc_clock_inversion(SI32_DCDC_A_Type* /*basePointer*/);
 ///  voltage
 ///  Valid range is 5 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DCDC_A_select_output_voltage(
+   SI32_DCDC_A_Type * basePointer,
+   uint32_t voltage)
+{
+   assert(voltage < 32);   // voltage < 2^5
+   //{{
+   basePointer->CONTROL_CLR = SI32_DCDC_A_CONTROL_OUTVSEL_MASK;
+   basePointer->CONTROL_SET = voltage << SI32_DCDC_A_CONTROL_OUTVSEL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_DCDC_A_select_output_voltage(SI32_DCDC_A_Type* /*basePointer*/,
    uint32_t /*voltage*/);
+#endif
 ///
 /// @def SI32_DCDC_A_select_output_voltage(basePointer, voltage)
 #define SI32_DCDC_A_select_output_voltage(basePointer, voltage) do{  \
@@ -389,8 +611,19 @@ _SI32_DCDC_A_select_output_voltage(SI32_DCDC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DCDC_A_enable_interrupt(
+   SI32_DCDC_A_Type * basePointer)
+{
+   //{{
+      basePointer->CONTROL_SET = SI32_DCDC_A_CONTROL_MIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_DCDC_A_enable_interrupt(SI32_DCDC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DCDC_A_enable_interrupt(basePointer)
 #define SI32_DCDC_A_enable_interrupt(basePointer) \
@@ -402,8 +635,19 @@ _SI32_DCDC_A_enable_interrupt(SI32_DCDC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DCDC_A_disable_interrupt(
+   SI32_DCDC_A_Type * basePointer)
+{
+   //{{
+      basePointer->CONTROL_CLR = SI32_DCDC_A_CONTROL_MIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_DCDC_A_disable_interrupt(SI32_DCDC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DCDC_A_disable_interrupt(basePointer)
 #define SI32_DCDC_A_disable_interrupt(basePointer) \
@@ -424,9 +668,23 @@ _SI32_DCDC_A_disable_interrupt(SI32_DCDC_A_Type* /*basePointer*/);
 ///  width
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DCDC_A_select_minimum_pulse_width(
+   SI32_DCDC_A_Type * basePointer,
+   SI32_DCDC_MIN_PULSE_WIDTH_Enum_Type width)
+{
+   assert(width < 4);   // width < 2^2
+   //{{
+   basePointer->CONTROL_CLR = SI32_DCDC_A_CONTROL_MINPWSEL_MASK;
+   basePointer->CONTROL_SET = width << SI32_DCDC_A_CONTROL_MINPWSEL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_DCDC_A_select_minimum_pulse_width(SI32_DCDC_A_Type* /*basePointer*/,
    SI32_DCDC_MIN_PULSE_WIDTH_Enum_Type /*width*/);
+#endif
 ///
 /// @def SI32_DCDC_A_select_minimum_pulse_width(basePointer, width)
 #define SI32_DCDC_A_select_minimum_pulse_width(basePointer, width) do{  \
@@ -449,9 +707,23 @@ _SI32_DCDC_A_select_minimum_pulse_width(SI32_DCDC_A_Type* /*basePointer*/,
 ///  size
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DCDC_A_select_power_switch_size(
+   SI32_DCDC_A_Type * basePointer,
+   uint32_t size)
+{
+   assert(size < 4);   // size < 2^2
+   //{{
+   basePointer->CONTROL_CLR = SI32_DCDC_A_CONTROL_PSMD_MASK;
+   basePointer->CONTROL_SET = size << SI32_DCDC_A_CONTROL_PSMD_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_DCDC_A_select_power_switch_size(SI32_DCDC_A_Type* /*basePointer*/,
    uint32_t /*size*/);
+#endif
 ///
 /// @def SI32_DCDC_A_select_power_switch_size(basePointer, size)
 #define SI32_DCDC_A_select_power_switch_size(basePointer, size) do{  \
@@ -465,8 +737,19 @@ _SI32_DCDC_A_select_power_switch_size(SI32_DCDC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DCDC_A_enable_async_mode(
+   SI32_DCDC_A_Type * basePointer)
+{
+   //{{
+      basePointer->CONTROL_SET = SI32_DCDC_A_CONTROL_ASYNCEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_DCDC_A_enable_async_mode(SI32_DCDC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DCDC_A_enable_async_mode(basePointer)
 #define SI32_DCDC_A_enable_async_mode(basePointer) \
@@ -478,8 +761,19 @@ _SI32_DCDC_A_enable_async_mode(SI32_DCDC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DCDC_A_enable_sync_mode(
+   SI32_DCDC_A_Type * basePointer)
+{
+   //{{
+      basePointer->CONTROL_CLR = SI32_DCDC_A_CONTROL_ASYNCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_DCDC_A_enable_sync_mode(SI32_DCDC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DCDC_A_enable_sync_mode(basePointer)
 #define SI32_DCDC_A_enable_sync_mode(basePointer) \
@@ -491,8 +785,19 @@ _SI32_DCDC_A_enable_sync_mode(SI32_DCDC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DCDC_A_enter_auto_bypass_mode(
+   SI32_DCDC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_DCDC_A_CONTROL_ABEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_DCDC_A_enter_auto_bypass_mode(SI32_DCDC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DCDC_A_enter_auto_bypass_mode(basePointer)
 #define SI32_DCDC_A_enter_auto_bypass_mode(basePointer) \
@@ -504,8 +809,19 @@ _SI32_DCDC_A_enter_auto_bypass_mode(SI32_DCDC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DCDC_A_exit_auto_bypass_mode(
+   SI32_DCDC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_DCDC_A_CONTROL_ABEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_DCDC_A_exit_auto_bypass_mode(SI32_DCDC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DCDC_A_exit_auto_bypass_mode(basePointer)
 #define SI32_DCDC_A_exit_auto_bypass_mode(basePointer) \
@@ -517,8 +833,19 @@ _SI32_DCDC_A_exit_auto_bypass_mode(SI32_DCDC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DCDC_A_enter_bypass_mode(
+   SI32_DCDC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_DCDC_A_CONTROL_BEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_DCDC_A_enter_bypass_mode(SI32_DCDC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DCDC_A_enter_bypass_mode(basePointer)
 #define SI32_DCDC_A_enter_bypass_mode(basePointer) \
@@ -530,8 +857,19 @@ _SI32_DCDC_A_enter_bypass_mode(SI32_DCDC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DCDC_A_exit_bypass_mode(
+   SI32_DCDC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_DCDC_A_CONTROL_BEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_DCDC_A_exit_bypass_mode(SI32_DCDC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DCDC_A_exit_bypass_mode(basePointer)
 #define SI32_DCDC_A_exit_bypass_mode(basePointer) \
@@ -543,8 +881,19 @@ _SI32_DCDC_A_exit_bypass_mode(SI32_DCDC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DCDC_A_enable_module(
+   SI32_DCDC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_DCDC_A_CONTROL_DCDCEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_DCDC_A_enable_module(SI32_DCDC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DCDC_A_enable_module(basePointer)
 #define SI32_DCDC_A_enable_module(basePointer) \
@@ -556,8 +905,19 @@ _SI32_DCDC_A_enable_module(SI32_DCDC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DCDC_A_disable_module(
+   SI32_DCDC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_DCDC_A_CONTROL_DCDCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_DCDC_A_disable_module(SI32_DCDC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DCDC_A_disable_module(basePointer)
 #define SI32_DCDC_A_disable_module(basePointer) \
@@ -577,9 +937,21 @@ _SI32_DCDC_A_disable_module(SI32_DCDC_A_Type* /*basePointer*/);
 ///  config
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DCDC_A_write_config(
+   SI32_DCDC_A_Type * basePointer,
+   uint32_t config)
+{
+   //{{
+   basePointer->CONFIG.U32 = config;
+   //}}
+}
+#else
 void
 _SI32_DCDC_A_write_config(SI32_DCDC_A_Type* /*basePointer*/,
    uint32_t /*config*/);
+#endif
 ///
 /// @def SI32_DCDC_A_write_config(basePointer, config)
 #define SI32_DCDC_A_write_config(basePointer, config) \
@@ -594,8 +966,19 @@ _SI32_DCDC_A_write_config(SI32_DCDC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_DCDC_A_read_config(
+   SI32_DCDC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONFIG.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_DCDC_A_read_config(SI32_DCDC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DCDC_A_read_config(basePointer)
 #define SI32_DCDC_A_read_config(basePointer) \
@@ -616,9 +999,22 @@ _SI32_DCDC_A_read_config(SI32_DCDC_A_Type* /*basePointer*/);
 ///  limit
 ///  Valid range is 3 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DCDC_A_select_current_limit(
+   SI32_DCDC_A_Type * basePointer,
+   uint32_t limit)
+{
+   assert(limit < 8);   // limit < 2^3
+   //{{
+   basePointer->CONFIG.ILIMIT = limit;
+   //}}
+}
+#else
 void
 _SI32_DCDC_A_select_current_limit(SI32_DCDC_A_Type* /*basePointer*/,
    uint32_t /*limit*/);
+#endif
 ///
 /// @def SI32_DCDC_A_select_current_limit(basePointer, limit)
 #define SI32_DCDC_A_select_current_limit(basePointer, limit) \
@@ -639,9 +1035,22 @@ _SI32_DCDC_A_select_current_limit(SI32_DCDC_A_Type* /*basePointer*/,
 ///  mode
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DCDC_A_select_interrupt_mode(
+   SI32_DCDC_A_Type * basePointer,
+   SI32_DCDC_INTERRUPT_MODE_Enum_Type mode)
+{
+   assert(mode < 4);   // mode < 2^2
+   //{{
+      basePointer->CONFIG.INTMD = mode;
+   //}}
+}
+#else
 void
 _SI32_DCDC_A_select_interrupt_mode(SI32_DCDC_A_Type* /*basePointer*/,
    SI32_DCDC_INTERRUPT_MODE_Enum_Type /*mode*/);
+#endif
 ///
 /// @def SI32_DCDC_A_select_interrupt_mode(basePointer, mode)
 #define SI32_DCDC_A_select_interrupt_mode(basePointer, mode) \
@@ -663,9 +1072,22 @@ _SI32_DCDC_A_select_interrupt_mode(SI32_DCDC_A_Type* /*basePointer*/,
 ///  threshold
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DCDC_A_select_converter_ready_low_threshold(
+   SI32_DCDC_A_Type * basePointer,
+   SI32_DCDC_READY_LOW_THRESHOLD_Enum_Type threshold)
+{
+   assert(threshold < 4);   // threshold < 2^2
+   //{{
+       basePointer->CONFIG.RDYLOWTH = threshold;
+   //}}
+}
+#else
 void
 _SI32_DCDC_A_select_converter_ready_low_threshold(SI32_DCDC_A_Type* /*basePointer*/,
    SI32_DCDC_READY_LOW_THRESHOLD_Enum_Type /*threshold*/);
+#endif
 ///
 /// @def SI32_DCDC_A_select_converter_ready_low_threshold(basePointer, threshold)
 #define SI32_DCDC_A_select_converter_ready_low_threshold(basePointer, threshold) \
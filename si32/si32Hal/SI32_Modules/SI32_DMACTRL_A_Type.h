@@ -96,6 +96,43 @@ extern "C" {
 ///  Valid range is 32 bits.
 ///  Write to BERR register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DMACTRL_A_initialize(
+   SI32_DMACTRL_A_Type * basePointer,
+   // Write to CONFIG register.
+   uint32_t config,
+   // Write to BASEPTR register.
+   uint32_t baseptr,
+   // Write to CHSWRCN register.
+   uint32_t chswrcn,
+   // Write to CHREQM register.
+   uint32_t chreqm,
+   // Write to CHEN register.
+   uint32_t chen,
+   // Write to CHALT register.
+   uint32_t chalt,
+   // Write to CHHP register.
+   uint32_t chhp,
+   // Write to BERR register.
+   uint32_t berr)
+{
+   //{{
+   basePointer->CONFIG.U32 = config;
+   basePointer->BASEPTR.U32 = baseptr;
+   basePointer->CHSWRCN.U32 = chswrcn;
+   basePointer->CHREQMCLR.U32 = 0xFFFFFFFF;
+   basePointer->CHREQMSET.U32 = chreqm;
+   basePointer->CHENCLR.U32 = 0xFFFFFFFF;
+   basePointer->CHENSET.U32 = chen;
+   basePointer->CHALTCLR.U32 = 0xFFFFFFFF;
+   basePointer->CHALTSET.U32 = chalt;
+   basePointer->CHHPCLR.U32 = 0xFFFFFFFF;
+   basePointer->CHHPSET.U32 = chhp;
+   basePointer->BERRCLR.U32 = berr;
+   //}}
+}
+#else
 void
 _SI32_DMACTRL_A_initialize(SI32_DMACTRL_A_Type* /*basePointer*/,
    uint32_t, /*config*/
@@ -106,6 +143,7 @@ _SI32_DMACTRL_A_initialize(SI32_DMACTRL_A_Type* /*basePointer*/,
    uint32_t, /*chalt*/
    uint32_t, /*chhp*/
    uint32_t /*berr*/);
+#endif
 ///
 /// @def SI32_DMACTRL_A_initialize(basePointer, config, baseptr, chswrcn, chreqm, chen, chalt, chhp, berr)
 #define SI32_DMACTRL_A_initialize(basePointer, config, baseptr, chswrcn, chreqm, chen, chalt, chhp, berr) do{  \
@@ -129,8 +167,19 @@ _SI32_DMACTRL_A_initialize(SI32_DMACTRL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_DMACTRL_A_is_enabled(
+   SI32_DMACTRL_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->STATUS.DMAENSTS);
+   //}}
+}
+#else
 bool
 _SI32_DMACTRL_A_is_enabled(SI32_DMACTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DMACTRL_A_is_enabled(basePointer)
 #define SI32_DMACTRL_A_is_enabled(basePointer) \
@@ -145,8 +194,19 @@ _SI32_DMACTRL_A_is_enabled(SI32_DMACTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline SI32_DMACTRL_A_STATE_Enum_Type
+_SI32_DMACTRL_A_get_state(
+   SI32_DMACTRL_A_Type * basePointer)
+{
+   //{{
+   return (SI32_DMACTRL_A_STATE_Enum_Type)basePointer->STATUS.STATE;
+   //}}
+}
+#else
 SI32_DMACTRL_A_STATE_Enum_Type
 _SI32_DMACTRL_A_get_state(SI32_DMACTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DMACTRL_A_get_state(basePointer)
 #define SI32_DMACTRL_A_get_state(basePointer) \
@@ -161,8 +221,19 @@ _SI32_DMACTRL_A_get_state(SI32_DMACTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_DMACTRL_A_get_number_of_channels(
+   SI32_DMACTRL_A_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.NUMCHAN + 1;
+   //}}
+}
+#else
 uint32_t
 _SI32_DMACTRL_A_get_number_of_channels(SI32_DMACTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DMACTRL_A_get_number_of_channels(basePointer)
 #define SI32_DMACTRL_A_get_number_of_channels(basePointer) \
@@ -182,9 +253,21 @@ _SI32_DMACTRL_A_get_number_of_channels(SI32_DMACTRL_A_Type* /*basePointer*/);
 ///  config
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DMACTRL_A_write_config(
+   SI32_DMACTRL_A_Type * basePointer,
+   uwide8_t config)
+{
+   //{{
+   basePointer->CONFIG.U32 = config;
+   //}}
+}
+#else
 void
 _SI32_DMACTRL_A_write_config(SI32_DMACTRL_A_Type* /*basePointer*/,
    uwide8_t /*config*/);
+#endif
 ///
 /// @def SI32_DMACTRL_A_write_config(basePointer, config)
 #define SI32_DMACTRL_A_write_config(basePointer, config) \
@@ -196,8 +279,19 @@ _SI32_DMACTRL_A_write_config(SI32_DMACTRL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DMACTRL_A_enable_module(
+   SI32_DMACTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG.DMAEN = SI32_DMACTRL_A_CONFIG_DMAEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_DMACTRL_A_enable_module(SI32_DMACTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DMACTRL_A_enable_module(basePointer)
 #define SI32_DMACTRL_A_enable_module(basePointer) \
@@ -209,8 +303,19 @@ _SI32_DMACTRL_A_enable_module(SI32_DMACTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DMACTRL_A_disable_module(
+   SI32_DMACTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG.DMAEN = SI32_DMACTRL_A_CONFIG_DMAEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_DMACTRL_A_disable_module(SI32_DMACTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DMACTRL_A_disable_module(basePointer)
 #define SI32_DMACTRL_A_disable_module(basePointer) \
@@ -225,8 +330,19 @@ _SI32_DMACTRL_A_disable_module(SI32_DMACTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_DMACTRL_A_read_baseptr(
+   SI32_DMACTRL_A_Type * basePointer)
+{
+   //{{
+   return basePointer->BASEPTR.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_DMACTRL_A_read_baseptr(SI32_DMACTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DMACTRL_A_read_baseptr(basePointer)
 #define SI32_DMACTRL_A_read_baseptr(basePointer) \
@@ -246,9 +362,21 @@ _SI32_DMACTRL_A_read_baseptr(SI32_DMACTRL_A_Type* /*basePointer*/);
 ///  baseptr
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DMACTRL_A_write_baseptr(
+   SI32_DMACTRL_A_Type * basePointer,
+   uint32_t baseptr)
+{
+   //{{
+   basePointer->BASEPTR.U32 = (baseptr & SI32_DMACTRL_A_BASEPTR_BASEPTR_MASK);
+   //}}
+}
+#else
 void
 _SI32_DMACTRL_A_write_baseptr(SI32_DMACTRL_A_Type* /*basePointer*/,
    uint32_t /*baseptr*/);
+#endif
 ///
 /// @def SI32_DMACTRL_A_write_baseptr(basePointer, baseptr)
 #define SI32_DMACTRL_A_write_baseptr(basePointer, baseptr) \
@@ -263,8 +391,19 @@ _SI32_DMACTRL_A_write_baseptr(SI32_DMACTRL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_DMACTRL_A_read_abaseptr(
+   SI32_DMACTRL_A_Type * basePointer)
+{
+   //{{
+   return basePointer->ABASEPTR.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_DMACTRL_A_read_abaseptr(SI32_DMACTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DMACTRL_A_read_abaseptr(basePointer)
 #define SI32_DMACTRL_A_read_abaseptr(basePointer) \
@@ -284,9 +423,21 @@ _SI32_DMACTRL_A_read_abaseptr(SI32_DMACTRL_A_Type* /*basePointer*/);
 ///  chswrcn
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DMACTRL_A_write_chswrcn(
+   SI32_DMACTRL_A_Type * basePointer,
+   uint32_t chswrcn)
+{
+   //{{
+   basePointer->CHSWRCN.U32 = chswrcn;
+   //}}
+}
+#else
 void
 _SI32_DMACTRL_A_write_chswrcn(SI32_DMACTRL_A_Type* /*basePointer*/,
    uint32_t /*chswrcn*/);
+#endif
 ///
 /// @def SI32_DMACTRL_A_write_chswrcn(basePointer, chswrcn)
 #define SI32_DMACTRL_A_write_chswrcn(basePointer, chswrcn) \
@@ -304,9 +455,23 @@ _SI32_DMACTRL_A_write_chswrcn(SI32_DMACTRL_A_Type* /*basePointer*/,
 ///  Valid range is 4 bits.
 ///  Set the channels software request bit.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DMACTRL_A_generate_software_request(
+   SI32_DMACTRL_A_Type * basePointer,
+   // Set the channels software request bit.
+   uint32_t channel_number)
+{
+   assert(channel_number < 16);   // channel_number < 2^4
+   //{{
+   basePointer->CHSWRCN.U32 |= (1 << channel_number);
+   //}}
+}
+#else
 void
 _SI32_DMACTRL_A_generate_software_request(SI32_DMACTRL_A_Type* /*basePointer*/,
    uint32_t /*channel_number*/);
+#endif
 ///
 /// @def SI32_DMACTRL_A_generate_software_request(basePointer, channel_number)
 #define SI32_DMACTRL_A_generate_software_request(basePointer, channel_number) \
@@ -321,8 +486,19 @@ _SI32_DMACTRL_A_generate_software_request(SI32_DMACTRL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide16_t
+_SI32_DMACTRL_A_read_chreqm(
+   SI32_DMACTRL_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CHREQMSET.U32;
+   //}}
+}
+#else
 uwide16_t
 _SI32_DMACTRL_A_read_chreqm(SI32_DMACTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DMACTRL_A_read_chreqm(basePointer)
 #define SI32_DMACTRL_A_read_chreqm(basePointer) \
@@ -342,9 +518,22 @@ _SI32_DMACTRL_A_read_chreqm(SI32_DMACTRL_A_Type* /*basePointer*/);
 ///  chreqm
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DMACTRL_A_write_chreqm(
+   SI32_DMACTRL_A_Type * basePointer,
+   uint32_t chreqm)
+{
+   //{{
+   basePointer->CHREQMCLR.U32 = 0xFFFFFFFF;
+   basePointer->CHREQMSET.U32 = chreqm;
+   //}}
+}
+#else
 void
 _SI32_DMACTRL_A_write_chreqm(SI32_DMACTRL_A_Type* /*basePointer*/,
    uint32_t /*chreqm*/);
+#endif
 ///
 /// @def SI32_DMACTRL_A_write_chreqm(basePointer, chreqm)
 #define SI32_DMACTRL_A_write_chreqm(basePointer, chreqm) do{  \
@@ -363,9 +552,22 @@ _SI32_DMACTRL_A_write_chreqm(SI32_DMACTRL_A_Type* /*basePointer*/,
 ///  channel_number
 ///  Valid range is 4 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DMACTRL_A_enable_data_request(
+   SI32_DMACTRL_A_Type * basePointer,
+   uint32_t channel_number)
+{
+   assert(channel_number < 16);   // channel_number < 2^4
+   //{{
+   basePointer->CHREQMCLR.U32 = (1 << channel_number);
+   //}}
+}
+#else
 void
 _SI32_DMACTRL_A_enable_data_request(SI32_DMACTRL_A_Type* /*basePointer*/,
    uint32_t /*channel_number*/);
+#endif
 ///
 /// @def SI32_DMACTRL_A_enable_data_request(basePointer, channel_number)
 #define SI32_DMACTRL_A_enable_data_request(basePointer, channel_number) \
@@ -382,9 +584,22 @@ _SI32_DMACTRL_A_enable_data_request(SI32_DMACTRL_A_Type* /*basePointer*/,
 ///  channel_number
 ///  Valid range is 4 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DMACTRL_A_disable_data_request(
+   SI32_DMACTRL_A_Type * basePointer,
+   uint32_t channel_number)
+{
+   assert(channel_number < 16);   // channel_number < 2^4
+   //{{
+   basePointer->CHREQMSET.U32 = (1 << channel_number);
+   //}}
+}
+#else
 void
 _SI32_DMACTRL_A_disable_data_request(SI32_DMACTRL_A_Type* /*basePointer*/,
    uint32_t /*channel_number*/);
+#endif
 ///
 /// @def SI32_DMACTRL_A_disable_data_request(basePointer, channel_number)
 #define SI32_DMACTRL_A_disable_data_request(basePointer, channel_number) \
@@ -399,8 +614,19 @@ _SI32_DMACTRL_A_disable_data_request(SI32_DMACTRL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide16_t
+_SI32_DMACTRL_A_read_chen(
+   SI32_DMACTRL_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CHENSET.U32;
+   //}}
+}
+#else
 uwide16_t
 _SI32_DMACTRL_A_read_chen(SI32_DMACTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DMACTRL_A_read_chen(basePointer)
 #define SI32_DMACTRL_A_read_chen(basePointer) \
@@ -420,9 +646,22 @@ _SI32_DMACTRL_A_read_chen(SI32_DMACTRL_A_Type* /*basePointer*/);
 ///  chen
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DMACTRL_A_write_chen(
+   SI32_DMACTRL_A_Type * basePointer,
+   uint32_t chen)
+{
+   //{{
+   basePointer->CHENCLR.U32 = 0xFFFFFFFF;
+   basePointer->CHENSET.U32 = chen;
+   //}}
+}
+#else
 void
 _SI32_DMACTRL_A_write_chen(SI32_DMACTRL_A_Type* /*basePointer*/,
    uint32_t /*chen*/);
+#endif
 ///
 /// @def SI32_DMACTRL_A_write_chen(basePointer, chen)
 #define SI32_DMACTRL_A_write_chen(basePointer, chen) do{  \
@@ -445,9 +684,22 @@ _SI32_DMACTRL_A_write_chen(SI32_DMACTRL_A_Type* /*basePointer*/,
 ///  channel_number
 ///  Valid range is 4 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_DMACTRL_A_is_channel_enabled(
+   SI32_DMACTRL_A_Type * basePointer,
+   uint32_t channel_number)
+{
+   assert(channel_number < 16);   // channel_number < 2^4
+   //{{
+   return (bool)((basePointer->CHENSET.U32 >> channel_number) & 0x1);
+   //}}
+}
+#else
 bool
 _SI32_DMACTRL_A_is_channel_enabled(SI32_DMACTRL_A_Type* /*basePointer*/,
    uint32_t /*channel_number*/);
+#endif
 ///
 /// @def SI32_DMACTRL_A_is_channel_enabled(basePointer, channel_number)
 #define SI32_DMACTRL_A_is_channel_enabled(basePointer, channel_number) \
@@ -464,9 +716,22 @@ _SI32_DMACTRL_A_is_channel_enabled(SI32_DMACTRL_A_Type* /*basePointer*/,
 ///  channel_number
 ///  Valid range is 4 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DMACTRL_A_enable_channel(
+   SI32_DMACTRL_A_Type * basePointer,
+   uint32_t channel_number)
+{
+   assert(channel_number < 16);   // channel_number < 2^4
+   //{{
+   basePointer->CHENSET.U32 = (1 << channel_number);
+   //}}
+}
+#else
 void
 _SI32_DMACTRL_A_enable_channel(SI32_DMACTRL_A_Type* /*basePointer*/,
    uint32_t /*channel_number*/);
+#endif
 ///
 /// @def SI32_DMACTRL_A_enable_channel(basePointer, channel_number)
 #define SI32_DMACTRL_A_enable_channel(basePointer, channel_number) \
@@ -483,9 +748,22 @@ _SI32_DMACTRL_A_enable_channel(SI32_DMACTRL_A_Type* /*basePointer*/,
 ///  channel_number
 ///  Valid range is 4 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DMACTRL_A_disable_channel(
+   SI32_DMACTRL_A_Type * basePointer,
+   uint32_t channel_number)
+{
+   assert(channel_number < 16);   // channel_number < 2^4
+   //{{
+   basePointer->CHENCLR.U32 = (1 << channel_number);
+   //}}
+}
+#else
 void
 _SI32_DMACTRL_A_disable_channel(SI32_DMACTRL_A_Type* /*basePointer*/,
    uint32_t /*channel_number*/);
+#endif
 ///
 /// @def SI32_DMACTRL_A_disable_channel(basePointer, channel_number)
 #define SI32_DMACTRL_A_disable_channel(basePointer, channel_number) \
@@ -500,8 +778,19 @@ _SI32_DMACTRL_A_disable_channel(SI32_DMACTRL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide16_t
+_SI32_DMACTRL_A_read_chalt(
+   SI32_DMACTRL_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CHALTSET.U32;
+   //}}
+}
+#else
 uwide16_t
 _SI32_DMACTRL_A_read_chalt(SI32_DMACTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DMACTRL_A_read_chalt(basePointer)
 #define SI32_DMACTRL_A_read_chalt(basePointer) \
@@ -521,9 +810,22 @@ _SI32_DMACTRL_A_read_chalt(SI32_DMACTRL_A_Type* /*basePointer*/);
 ///  chalt
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DMACTRL_A_write_chalt(
+   SI32_DMACTRL_A_Type * basePointer,
+   uint32_t chalt)
+{
+   //{{
+   basePointer->CHALTCLR.U32 = 0xFFFFFFFF;
+   basePointer->CHALTSET.U32 = chalt;
+   //}}
+}
+#else
 void
 _SI32_DMACTRL_A_write_chalt(SI32_DMACTRL_A_Type* /*basePointer*/,
    uint32_t /*chalt*/);
+#endif
 ///
 /// @def SI32_DMACTRL_A_write_chalt(basePointer, chalt)
 #define SI32_DMACTRL_A_write_chalt(basePointer, chalt) do{  \
@@ -546,9 +848,22 @@ _SI32_DMACTRL_A_write_chalt(SI32_DMACTRL_A_Type* /*basePointer*/,
 ///  channel_number
 ///  Valid range is 4 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_DMACTRL_A_is_primary_selected(
+   SI32_DMACTRL_A_Type * basePointer,
+   uint32_t channel_number)
+{
+   assert(channel_number < 16);   // channel_number < 2^4
+   //{{
+   return !(bool)((basePointer->CHALTSET.U32 >> channel_number) & 0x1);
+   //}}
+}
+#else
 bool
 _SI32_DMACTRL_A_is_primary_selected(SI32_DMACTRL_A_Type* /*basePointer*/,
    uint32_t /*channel_number*/);
+#endif
 ///
 /// @def SI32_DMACTRL_A_is_primary_selected(basePointer, channel_number)
 #define SI32_DMACTRL_A_is_primary_selected(basePointer, channel_number) \
@@ -565,9 +880,22 @@ _SI32_DMACTRL_A_is_primary_selected(SI32_DMACTRL_A_Type* /*basePointer*/,
 ///  channel_number
 ///  Valid range is 4 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DMACTRL_A_select_alternate_data_structure(
+   SI32_DMACTRL_A_Type * basePointer,
+   uint32_t channel_number)
+{
+   assert(channel_number < 16);   // channel_number < 2^4
+   //{{
+   basePointer->CHALTSET.U32 = (1 << channel_number);
+   //}}
+}
+#else
 void
 _SI32_DMACTRL_A_select_alternate_data_structure(SI32_DMACTRL_A_Type* /*basePointer*/,
    uint32_t /*channel_number*/);
+#endif
 ///
 /// @def SI32_DMACTRL_A_select_alternate_data_structure(basePointer, channel_number)
 #define SI32_DMACTRL_A_select_alternate_data_structure(basePointer, channel_number) \
@@ -584,9 +912,22 @@ _SI32_DMACTRL_A_select_alternate_data_structure(SI32_DMACTRL_A_Type* /*basePoint
 ///  channel_number
 ///  Valid range is 4 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DMACTRL_A_select_primary_data_structure(
+   SI32_DMACTRL_A_Type * basePointer,
+   uint32_t channel_number)
+{
+   assert(channel_number < 16);   // channel_number < 2^4
+   //{{
+   basePointer->CHALTCLR.U32 = (1 << channel_number);
+   //}}
+}
+#else
 void
 _SI32_DMACTRL_A_select_primary_data_structure(SI32_DMACTRL_A_Type* /*basePointer*/,
    uint32_t /*channel_number*/);
+#endif
 ///
 /// @def SI32_DMACTRL_A_select_primary_data_structure(basePointer, channel_number)
 #define SI32_DMACTRL_A_select_primary_data_structure(basePointer, channel_number) \
@@ -601,8 +942,19 @@ _SI32_DMACTRL_A_select_primary_data_structure(SI32_DMACTRL_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide16_t
+_SI32_DMACTRL_A_read_chhp(
+   SI32_DMACTRL_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CHHPSET.U32;
+   //}}
+}
+#else
 uwide16_t
 _SI32_DMACTRL_A_read_chhp(SI32_DMACTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DMACTRL_A_read_chhp(basePointer)
 #define SI32_DMACTRL_A_read_chhp(basePointer) \
@@ -622,9 +974,22 @@ _SI32_DMACTRL_A_read_chhp(SI32_DMACTRL_A_Type* /*basePointer*/);
 ///  chhp
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DMACTRL_A_write_chhp(
+   SI32_DMACTRL_A_Type * basePointer,
+   uint32_t chhp)
+{
+   //{{
+   basePointer->CHHPCLR.U32 = 0xFFFFFFFF;
+   basePointer->CHHPSET.U32 = chhp;
+   //}}
+}
+#else
 void
 _SI32_DMACTRL_A_write_chhp(SI32_DMACTRL_A_Type* /*basePointer*/,
    uint32_t /*chhp*/);
+#endif
 ///
 /// @def SI32_DMACTRL_A_write_chhp(basePointer, chhp)
 #define SI32_DMACTRL_A_write_chhp(basePointer, chhp) do{  \
@@ -643,9 +1008,22 @@ _SI32_DMACTRL_A_write_chhp(SI32_DMACTRL_A_Type* /*basePointer*/,
 ///  channel_number
 ///  Valid range is 4 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DMACTRL_A_select_channel_high_priority(
+   SI32_DMACTRL_A_Type * basePointer,
+   uint32_t channel_number)
+{
+   assert(channel_number < 16);   // channel_number < 2^4
+   //{{
+   basePointer->CHHPSET.U32 = (1 << channel_number);
+   //}}
+}
+#else
 void
 _SI32_DMACTRL_A_select_channel_high_priority(SI32_DMACTRL_A_Type* /*basePointer*/,
    uint32_t /*channel_number*/);
+#endif
 ///
 /// @def SI32_DMACTRL_A_select_channel_high_priority(basePointer, channel_number)
 #define SI32_DMACTRL_A_select_channel_high_priority(basePointer, channel_number) \
@@ -662,9 +1040,22 @@ _SI32_DMACTRL_A_select_channel_high_priority(SI32_DMACTRL_A_Type* /*basePointer*
 ///  channel_number
 ///  Valid range is 4 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DMACTRL_A_select_channel_default_priority(
+   SI32_DMACTRL_A_Type * basePointer,
+   uint32_t channel_number)
+{
+   assert(channel_number < 16);   // channel_number < 2^4
+   //{{
+   basePointer->CHHPCLR.U32 = (1 << channel_number);
+   //}}
+}
+#else
 void
 _SI32_DMACTRL_A_select_channel_default_priority(SI32_DMACTRL_A_Type* /*basePointer*/,
    uint32_t /*channel_number*/);
+#endif
 ///
 /// @def SI32_DMACTRL_A_select_channel_default_priority(basePointer, channel_number)
 #define SI32_DMACTRL_A_select_channel_default_priority(basePointer, channel_number) \
@@ -679,8 +1070,19 @@ _SI32_DMACTRL_A_select_channel_default_priority(SI32_DMACTRL_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_DMACTRL_A_read_berr(
+   SI32_DMACTRL_A_Type * basePointer)
+{
+   //{{
+   return basePointer->BERRCLR.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_DMACTRL_A_read_berr(SI32_DMACTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DMACTRL_A_read_berr(basePointer)
 #define SI32_DMACTRL_A_read_berr(basePointer) \
@@ -700,9 +1102,21 @@ _SI32_DMACTRL_A_read_berr(SI32_DMACTRL_A_Type* /*basePointer*/);
 ///  berr
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DMACTRL_A_write_berr(
+   SI32_DMACTRL_A_Type * basePointer,
+   uint32_t berr)
+{
+   //{{
+   basePointer->BERRCLR.U32 = berr;
+   //}}
+}
+#else
 void
 _SI32_DMACTRL_A_write_berr(SI32_DMACTRL_A_Type* /*basePointer*/,
    uint32_t /*berr*/);
+#endif
 ///
 /// @def SI32_DMACTRL_A_write_berr(basePointer, berr)
 #define SI32_DMACTRL_A_write_berr(basePointer, berr) \
@@ -714,8 +1128,19 @@ _SI32_DMACTRL_A_write_berr(SI32_DMACTRL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DMACTRL_A_clear_bus_error(
+   SI32_DMACTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->BERRCLR.ERROR = SI32_DMACTRL_A_BERRCLR_ERROR_CLEAR_VALUE;
+   //}}
+}
+#else
 void
 _SI32_DMACTRL_A_clear_bus_error(SI32_DMACTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DMACTRL_A_clear_bus_error(basePointer)
 #define SI32_DMACTRL_A_clear_bus_error(basePointer) \
@@ -727,8 +1152,19 @@ _SI32_DMACTRL_A_clear_bus_error(SI32_DMACTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_DMACTRL_A_is_bus_error_set(
+   SI32_DMACTRL_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->BERRCLR.ERROR);
+   //}}
+}
+#else
 bool
 _SI32_DMACTRL_A_is_bus_error_set(SI32_DMACTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DMACTRL_A_is_bus_error_set(basePointer)
 #define SI32_DMACTRL_A_is_bus_error_set(basePointer) \
@@ -66,11 +66,30 @@ extern "C" {
 ///  Valid range is 32 bits.
 ///  Transfer configuration value. See SI32_DMADESC_A_Support.h for values.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DMADESC_A_initialize(
+   SI32_DMADESC_A_Type * basePointer,
+   // Source data end pointer.
+   uint32_t srcend,
+   // Destination data end pointer.
+   uint32_t dstend,
+   // Transfer configuration value. See SI32_DMADESC_A_Support.h for values.
+   uint32_t config)
+{
+   //{{
+   (basePointer)->SRCEND.U32 = srcend;
+   (basePointer)->DSTEND.U32 = dstend;
+   (basePointer)->CONFIG.U32 = config;
+   //}}
+}
+#else
 void
 _SI32_DMADESC_A_initialize(SI32_DMADESC_A_Type* /*basePointer*/,
    uint32_t, /*srcend*/
    uint32_t, /*dstend*/
    uint32_t /*config*/);
+#endif
 ///
 /// @def SI32_DMADESC_A_initialize(basePointer, srcend, dstend, config)
 #define SI32_DMADESC_A_initialize(basePointer, srcend, dstend, config) do{  \
@@ -108,12 +127,56 @@ _SI32_DMADESC_A_initialize(SI32_DMADESC_A_Type* /*basePointer*/,
 ///  Valid range is 32 bits.
 ///  Transfer configuration value. See SI32_DMADESC_A_Support.h for values.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DMADESC_A_configure(
+   SI32_DMADESC_A_Type * basePointer,
+   // Source data pointer.
+   void volatile * srcPointer,
+   // Destination data pointer.
+   void volatile * dstPointer,
+   // Transfer count. Units are in words, half words or bytes depending on
+   // the config parameter.
+   uint32_t count,
+   // Transfer configuration value. See SI32_DMADESC_A_Support.h for values.
+   uint32_t config)
+{
+   assert(count <= 1025);   // count <= 2^10 + 1
+   //{{
+   uint32_t size;
+
+   // Adjust the transfer count
+   count -= 1;
+   
+   // Fill in channel structure
+   basePointer->SRCEND.U32 = (uint32_t)srcPointer;
+   basePointer->DSTEND.U32 = (uint32_t)dstPointer;
+   basePointer->CONFIG.U32 = config;
+   basePointer->CONFIG.NCOUNT = count;
+
+   // Adjust source data pointer
+   size = basePointer->CONFIG.SRCAIMD;
+   if (size != SI32_DMADESC_A_CONFIG_SRCAIMD_NO_INCREMENT_VALUE)
+   {
+      basePointer->SRCEND.U32 += (count << size);
+   }
+
+   // Adjust destination data pointer
+   size = basePointer->CONFIG.DSTAIMD;
+   if (size != SI32_DMADESC_A_CONFIG_DSTAIMD_NO_INCREMENT_VALUE)
+   {
+      basePointer->DSTEND.U32 += (count << size);
+   }
+   //}}
+}
+#else
 void
 _SI32_DMADESC_A_configure(SI32_DMADESC_A_Type* /*basePointer*/,
    void volatile *, /*srcPointer*/
    void volatile *, /*dstPointer*/
    uint32_t, /*count*/
    uint32_t /*config*/);
+#endif
 ///
 /// @def SI32_DMADESC_A_configure(basePointer, srcPointer, dstPointer, count, config)
 #define SI32_DMADESC_A_configure(basePointer, srcPointer, dstPointer, count, config) \
@@ -137,10 +200,30 @@ _SI32_DMADESC_A_configure(SI32_DMADESC_A_Type* /*basePointer*/,
 ///  Valid range is 7 bits.
 ///  Number of scatter-gather descriptors.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DMADESC_A_configure_memory_scatter_gather(
+   SI32_DMADESC_A_Type * basePointer,
+   // Pointer to an array of DMA descriptors for the scatter-gather
+   // transfers.
+   SI32_DMADESC_A_Type * descPointer,
+   // Number of scatter-gather descriptors.
+   uint32_t descCount)
+{
+   assert(descCount < 128);   // descCount < 2^7
+   //{{
+   (basePointer)->SRCEND.U32 = ((uint32_t)&descPointer[descCount]) - sizeof(uint32_t);
+   (basePointer)->DSTEND.U32 = ((uint32_t)&basePointer[SI32_DMADESC_ALT_STRIDE+1]) - sizeof(uint32_t);
+   (basePointer)->CONFIG.U32 = SI32_DMADESC_A_CONFIG_MEMORY_SG;
+   (basePointer)->CONFIG.NCOUNT = (descCount * 4) - 1;
+   //}}
+}
+#else
 void
 _SI32_DMADESC_A_configure_memory_scatter_gather(SI32_DMADESC_A_Type* /*basePointer*/,
    SI32_DMADESC_A_Type *, /*descPointer*/
    uint32_t /*descCount*/);
+#endif
 ///
 /// @def SI32_DMADESC_A_configure_memory_scatter_gather(basePointer, descPointer, descCount)
 #define SI32_DMADESC_A_configure_memory_scatter_gather(basePointer, descPointer, descCount) \
@@ -164,10 +247,30 @@ _SI32_DMADESC_A_configure_memory_scatter_gather(SI32_DMADESC_A_Type* /*basePoint
 ///  Valid range is 7 bits.
 ///  Number of scatter-gather descriptors.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DMADESC_A_configure_peripheral_scatter_gather(
+   SI32_DMADESC_A_Type * basePointer,
+   // Pointer to an array of DMA descriptors for the scatter-gather
+   // transfers.
+   SI32_DMADESC_A_Type * descPointer,
+   // Number of scatter-gather descriptors.
+   uint32_t descCount)
+{
+   assert(descCount < 128);   // descCount < 2^7
+   //{{
+   (basePointer)->SRCEND.U32 = ((uint32_t)&descPointer[descCount]) - sizeof(uint32_t);
+   (basePointer)->DSTEND.U32 = ((uint32_t)&basePointer[SI32_DMADESC_ALT_STRIDE+1]) - sizeof(uint32_t);
+   (basePointer)->CONFIG.U32 = SI32_DMADESC_A_CONFIG_PERIPHERAL_SG;
+   (basePointer)->CONFIG.NCOUNT = (descCount * 4) - 1;
+   //}}
+}
+#else
 void
 _SI32_DMADESC_A_configure_peripheral_scatter_gather(SI32_DMADESC_A_Type* /*basePointer*/,
    SI32_DMADESC_A_Type *, /*descPointer*/
    uint32_t /*descCount*/);
+#endif
 ///
 /// @def SI32_DMADESC_A_configure_peripheral_scatter_gather(basePointer, descPointer, descCount)
 #define SI32_DMADESC_A_configure_peripheral_scatter_gather(basePointer, descPointer, descCount) \
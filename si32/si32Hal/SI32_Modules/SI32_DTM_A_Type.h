@@ -75,12 +75,34 @@ extern "C" {
 ///  Valid range is 32 bits.
 ///  Initial STATEADDR register value.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DTM_A_initialize(
+   SI32_DTM_A_Type * basePointer,
+   // Initial CONTROL register value.
+   uint32_t control,
+   // Initial TIMEOUT register value.
+   uint32_t timeout,
+   // Initial MSTCOUNT register value.
+   uint32_t mstcount,
+   // Initial STATEADDR register value.
+   uint32_t stateaddr)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   basePointer->TIMEOUT.U32 = timeout;
+   basePointer->MSTCOUNT.U32 = mstcount;
+   basePointer->STATEADDR.U32 = stateaddr;
+   //}}
+}
+#else
 void
 _SI32_DTM_A_initialize(SI32_DTM_A_Type* /*basePointer*/,
    uint32_t, /*control*/
    uint32_t, /*timeout*/
    uint32_t, /*mstcount*/
    uint32_t /*stateaddr*/);
+#endif
 ///
 /// @def SI32_DTM_A_initialize(basePointer, control, timeout, mstcount, stateaddr)
 #define SI32_DTM_A_initialize(basePointer, control, timeout, mstcount, stateaddr) do{  \
@@ -105,9 +127,22 @@ _SI32_DTM_A_initialize(SI32_DTM_A_Type* /*basePointer*/,
 ///  Valid range is 32 bits.
 ///  CONTROL register value.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DTM_A_write_control(
+   SI32_DTM_A_Type * basePointer,
+   // CONTROL register value.
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_DTM_A_write_control(SI32_DTM_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_DTM_A_write_control(basePointer, control)
 #define SI32_DTM_A_write_control(basePointer, control) \
@@ -125,8 +160,19 @@ _SI32_DTM_A_write_control(SI32_DTM_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_DTM_A_read_control(
+   SI32_DTM_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_DTM_A_read_control(SI32_DTM_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DTM_A_read_control(basePointer)
 #define SI32_DTM_A_read_control(basePointer) \
@@ -147,9 +193,24 @@ _SI32_DTM_A_read_control(SI32_DTM_A_Type* /*basePointer*/);
 ///  Valid range is 8 bits.
 ///  Requested active state count.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DTM_A_set_active_state_counter(
+   SI32_DTM_A_Type * basePointer,
+   // Requested active state count.
+   uint32_t count)
+{
+   assert(count < 256);   // count < 2^8
+   //{{
+   basePointer->CONTROL_CLR = SI32_DTM_A_CONTROL_STCOUNT_MASK;
+   basePointer->CONTROL_SET = (count)<<SI32_DTM_A_CONTROL_STCOUNT_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_DTM_A_set_active_state_counter(SI32_DTM_A_Type* /*basePointer*/,
    uint32_t /*count*/);
+#endif
 ///
 /// @def SI32_DTM_A_set_active_state_counter(basePointer, count)
 #define SI32_DTM_A_set_active_state_counter(basePointer, count) do{  \
@@ -169,8 +230,19 @@ _SI32_DTM_A_set_active_state_counter(SI32_DTM_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_DTM_A_get_active_state_counter(
+   SI32_DTM_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.STCOUNT;
+   //}}
+}
+#else
 uint32_t
 _SI32_DTM_A_get_active_state_counter(SI32_DTM_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DTM_A_get_active_state_counter(basePointer)
 #define SI32_DTM_A_get_active_state_counter(basePointer) \
@@ -191,9 +263,24 @@ _SI32_DTM_A_get_active_state_counter(SI32_DTM_A_Type* /*basePointer*/);
 ///  Valid range is 4 bits.
 ///  Requested active state.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DTM_A_set_active_state(
+   SI32_DTM_A_Type * basePointer,
+   // Requested active state.
+   uint32_t state)
+{
+   assert(state < 16);   // state < 2^4
+   //{{
+   basePointer->CONTROL_CLR = SI32_DTM_A_CONTROL_ST_MASK;
+   basePointer->CONTROL_SET = (state)<<SI32_DTM_A_CONTROL_ST_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_DTM_A_set_active_state(SI32_DTM_A_Type* /*basePointer*/,
    uint32_t /*state*/);
+#endif
 ///
 /// @def SI32_DTM_A_set_active_state(basePointer, state)
 #define SI32_DTM_A_set_active_state(basePointer, state) do{  \
@@ -213,8 +300,19 @@ _SI32_DTM_A_set_active_state(SI32_DTM_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_DTM_A_get_active_state(
+   SI32_DTM_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.ST;
+   //}}
+}
+#else
 uint32_t
 _SI32_DTM_A_get_active_state(SI32_DTM_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DTM_A_get_active_state(basePointer)
 #define SI32_DTM_A_get_active_state(basePointer) \
@@ -232,8 +330,19 @@ _SI32_DTM_A_get_active_state(SI32_DTM_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_DTM_A_get_last_state(
+   SI32_DTM_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.LASTST;
+   //}}
+}
+#else
 uint32_t
 _SI32_DTM_A_get_last_state(SI32_DTM_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DTM_A_get_last_state(basePointer)
 #define SI32_DTM_A_get_last_state(basePointer) \
@@ -254,9 +363,24 @@ _SI32_DTM_A_get_last_state(SI32_DTM_A_Type* /*basePointer*/);
 ///  Valid range is 4 bits.
 ///  The requested inhibit signal.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DTM_A_set_inhibit_signal_selection(
+   SI32_DTM_A_Type * basePointer,
+   // The requested inhibit signal.
+   uint32_t signal)
+{
+   assert(signal < 16);   // signal < 2^4
+   //{{
+   basePointer->CONTROL_CLR = SI32_DTM_A_CONTROL_INHSSEL_MASK;
+   basePointer->CONTROL_SET = (signal)<<SI32_DTM_A_CONTROL_INHSSEL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_DTM_A_set_inhibit_signal_selection(SI32_DTM_A_Type* /*basePointer*/,
    uint32_t /*signal*/);
+#endif
 ///
 /// @def SI32_DTM_A_set_inhibit_signal_selection(basePointer, signal)
 #define SI32_DTM_A_set_inhibit_signal_selection(basePointer, signal) do{  \
@@ -276,8 +400,19 @@ _SI32_DTM_A_set_inhibit_signal_selection(SI32_DTM_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_DTM_A_get_inhibit_signal_selection(
+   SI32_DTM_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.INHSSEL;
+   //}}
+}
+#else
 uint32_t
 _SI32_DTM_A_get_inhibit_signal_selection(SI32_DTM_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DTM_A_get_inhibit_signal_selection(basePointer)
 #define SI32_DTM_A_get_inhibit_signal_selection(basePointer) \
@@ -295,8 +430,19 @@ _SI32_DTM_A_get_inhibit_signal_selection(SI32_DTM_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_DTM_A_read_inhibit_signal_status(
+   SI32_DTM_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.INHF;
+   //}}
+}
+#else
 uint32_t
 _SI32_DTM_A_read_inhibit_signal_status(SI32_DTM_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DTM_A_read_inhibit_signal_status(basePointer)
 #define SI32_DTM_A_read_inhibit_signal_status(basePointer) \
@@ -311,8 +457,19 @@ _SI32_DTM_A_read_inhibit_signal_status(SI32_DTM_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DTM_A_enable_stall_in_debug_mode(
+   SI32_DTM_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_DTM_A_CONTROL_DBGMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_DTM_A_enable_stall_in_debug_mode(SI32_DTM_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DTM_A_enable_stall_in_debug_mode(basePointer)
 #define SI32_DTM_A_enable_stall_in_debug_mode(basePointer) \
@@ -327,8 +484,19 @@ _SI32_DTM_A_enable_stall_in_debug_mode(SI32_DTM_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DTM_A_disable_stall_in_debug_mode(
+   SI32_DTM_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_DTM_A_CONTROL_DBGMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_DTM_A_disable_stall_in_debug_mode(SI32_DTM_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DTM_A_disable_stall_in_debug_mode(basePointer)
 #define SI32_DTM_A_disable_stall_in_debug_mode(basePointer) \
@@ -346,8 +514,19 @@ _SI32_DTM_A_disable_stall_in_debug_mode(SI32_DTM_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_DTM_A_read_destination_dma_request_status(
+   SI32_DTM_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.DSTREQF;
+   //}}
+}
+#else
 uint32_t
 _SI32_DTM_A_read_destination_dma_request_status(SI32_DTM_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DTM_A_read_destination_dma_request_status(basePointer)
 #define SI32_DTM_A_read_destination_dma_request_status(basePointer) \
@@ -365,8 +544,19 @@ _SI32_DTM_A_read_destination_dma_request_status(SI32_DTM_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_DTM_A_read_source_dma_request_status(
+   SI32_DTM_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.SRCREQF;
+   //}}
+}
+#else
 uint32_t
 _SI32_DTM_A_read_source_dma_request_status(SI32_DTM_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DTM_A_read_source_dma_request_status(basePointer)
 #define SI32_DTM_A_read_source_dma_request_status(basePointer) \
@@ -381,8 +571,19 @@ _SI32_DTM_A_read_source_dma_request_status(SI32_DTM_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DTM_A_enable_module_inhibit(
+   SI32_DTM_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_DTM_A_CONTROL_DTMINH_MASK;
+   //}}
+}
+#else
 void
 _SI32_DTM_A_enable_module_inhibit(SI32_DTM_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DTM_A_enable_module_inhibit(basePointer)
 #define SI32_DTM_A_enable_module_inhibit(basePointer) \
@@ -397,8 +598,19 @@ _SI32_DTM_A_enable_module_inhibit(SI32_DTM_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DTM_A_disable_module_inhibit(
+   SI32_DTM_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_DTM_A_CONTROL_DTMINH_MASK;
+   //}}
+}
+#else
 void
 _SI32_DTM_A_disable_module_inhibit(SI32_DTM_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DTM_A_disable_module_inhibit(basePointer)
 #define SI32_DTM_A_disable_module_inhibit(basePointer) \
@@ -413,8 +625,19 @@ _SI32_DTM_A_disable_module_inhibit(SI32_DTM_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DTM_A_clear_timeout_error_interrupt(
+   SI32_DTM_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_DTM_A_CONTROL_TOERRI_MASK;
+   //}}
+}
+#else
 void
 _SI32_DTM_A_clear_timeout_error_interrupt(SI32_DTM_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DTM_A_clear_timeout_error_interrupt(basePointer)
 #define SI32_DTM_A_clear_timeout_error_interrupt(basePointer) \
@@ -432,8 +655,19 @@ _SI32_DTM_A_clear_timeout_error_interrupt(SI32_DTM_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_DTM_A_is_timeout_error_interrupt_pending(
+   SI32_DTM_A_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->CONTROL.TOERRI;
+   //}}
+}
+#else
 bool
 _SI32_DTM_A_is_timeout_error_interrupt_pending(SI32_DTM_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DTM_A_is_timeout_error_interrupt_pending(basePointer)
 #define SI32_DTM_A_is_timeout_error_interrupt_pending(basePointer) \
@@ -448,8 +682,19 @@ _SI32_DTM_A_is_timeout_error_interrupt_pending(SI32_DTM_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DTM_A_clear_dma_error_interrupt(
+   SI32_DTM_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_DTM_A_CONTROL_DMAERRI_MASK;
+   //}}
+}
+#else
 void
 _SI32_DTM_A_clear_dma_error_interrupt(SI32_DTM_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DTM_A_clear_dma_error_interrupt(basePointer)
 #define SI32_DTM_A_clear_dma_error_interrupt(basePointer) \
@@ -467,8 +712,19 @@ _SI32_DTM_A_clear_dma_error_interrupt(SI32_DTM_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_DTM_A_is_dma_error_interrupt_pending(
+   SI32_DTM_A_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->CONTROL.DMAERRI;
+   //}}
+}
+#else
 bool
 _SI32_DTM_A_is_dma_error_interrupt_pending(SI32_DTM_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DTM_A_is_dma_error_interrupt_pending(basePointer)
 #define SI32_DTM_A_is_dma_error_interrupt_pending(basePointer) \
@@ -483,8 +739,19 @@ _SI32_DTM_A_is_dma_error_interrupt_pending(SI32_DTM_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DTM_A_clear_module_interrupt(
+   SI32_DTM_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_DTM_A_CONTROL_DTMI_MASK;
+   //}}
+}
+#else
 void
 _SI32_DTM_A_clear_module_interrupt(SI32_DTM_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DTM_A_clear_module_interrupt(basePointer)
 #define SI32_DTM_A_clear_module_interrupt(basePointer) \
@@ -502,8 +769,19 @@ _SI32_DTM_A_clear_module_interrupt(SI32_DTM_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_DTM_A_is_module_interrupt_pending(
+   SI32_DTM_A_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->CONTROL.DTMI;
+   //}}
+}
+#else
 bool
 _SI32_DTM_A_is_module_interrupt_pending(SI32_DTM_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DTM_A_is_module_interrupt_pending(basePointer)
 #define SI32_DTM_A_is_module_interrupt_pending(basePointer) \
@@ -518,8 +796,21 @@ _SI32_DTM_A_is_module_interrupt_pending(SI32_DTM_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DTM_A_clear_all_interrupts(
+   SI32_DTM_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_DTM_A_CONTROL_TOERRI_MASK
+                            | SI32_DTM_A_CONTROL_DMAERRI_MASK
+                            | SI32_DTM_A_CONTROL_DTMI_MASK;
+   //}}
+}
+#else
 void
 _SI32_DTM_A_clear_all_interrupts(SI32_DTM_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DTM_A_clear_all_interrupts(basePointer)
 #define SI32_DTM_A_clear_all_interrupts(basePointer) do{  \
@@ -540,8 +831,22 @@ _SI32_DTM_A_clear_all_interrupts(SI32_DTM_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_DTM_A_is_any_interrupt_pending(
+   SI32_DTM_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.U32 
+                 & (SI32_DTM_A_CONTROL_TOERRI_MASK
+                    | SI32_DTM_A_CONTROL_DMAERRI_MASK
+                    | SI32_DTM_A_CONTROL_DTMI_MASK));
+   //}}
+}
+#else
 bool
 _SI32_DTM_A_is_any_interrupt_pending(SI32_DTM_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DTM_A_is_any_interrupt_pending(basePointer)
 #define SI32_DTM_A_is_any_interrupt_pending(basePointer) \
@@ -556,8 +861,19 @@ _SI32_DTM_A_is_any_interrupt_pending(SI32_DTM_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DTM_A_enable_module(
+   SI32_DTM_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_DTM_A_CONTROL_DTMEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_DTM_A_enable_module(SI32_DTM_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DTM_A_enable_module(basePointer)
 #define SI32_DTM_A_enable_module(basePointer) \
@@ -572,8 +888,19 @@ _SI32_DTM_A_enable_module(SI32_DTM_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DTM_A_disable_module(
+   SI32_DTM_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_DTM_A_CONTROL_DTMEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_DTM_A_disable_module(SI32_DTM_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DTM_A_disable_module(basePointer)
 #define SI32_DTM_A_disable_module(basePointer) \
@@ -594,9 +921,22 @@ _SI32_DTM_A_disable_module(SI32_DTM_A_Type* /*basePointer*/);
 ///  Valid range is 32 bits.
 ///  TIMEOUT register value.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DTM_A_write_timeout(
+   SI32_DTM_A_Type * basePointer,
+   // TIMEOUT register value.
+   uint32_t timeout)
+{
+   //{{
+   basePointer->TIMEOUT.U32 = timeout;
+   //}}
+}
+#else
 void
 _SI32_DTM_A_write_timeout(SI32_DTM_A_Type* /*basePointer*/,
    uint32_t /*timeout*/);
+#endif
 ///
 /// @def SI32_DTM_A_write_timeout(basePointer, timeout)
 #define SI32_DTM_A_write_timeout(basePointer, timeout) \
@@ -614,8 +954,19 @@ _SI32_DTM_A_write_timeout(SI32_DTM_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_DTM_A_read_timeout(
+   SI32_DTM_A_Type * basePointer)
+{
+   //{{
+   return basePointer->TIMEOUT.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_DTM_A_read_timeout(SI32_DTM_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DTM_A_read_timeout(basePointer)
 #define SI32_DTM_A_read_timeout(basePointer) \
@@ -636,9 +987,23 @@ _SI32_DTM_A_read_timeout(SI32_DTM_A_Type* /*basePointer*/);
 ///  Valid range is 16 bits.
 ///  Timeout counter reload value.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DTM_A_set_timeout_counter_reload(
+   SI32_DTM_A_Type * basePointer,
+   // Timeout counter reload value.
+   uint32_t toreload)
+{
+   assert(toreload < 65536);   // toreload < 2^16
+   //{{
+   basePointer->TIMEOUT.TORELOAD = toreload;
+   //}}
+}
+#else
 void
 _SI32_DTM_A_set_timeout_counter_reload(SI32_DTM_A_Type* /*basePointer*/,
    uint32_t /*toreload*/);
+#endif
 ///
 /// @def SI32_DTM_A_set_timeout_counter_reload(basePointer, toreload)
 #define SI32_DTM_A_set_timeout_counter_reload(basePointer, toreload) \
@@ -656,8 +1021,19 @@ _SI32_DTM_A_set_timeout_counter_reload(SI32_DTM_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_DTM_A_get_timeout_counter_reload(
+   SI32_DTM_A_Type * basePointer)
+{
+   //{{
+   return basePointer->TIMEOUT.TORELOAD;
+   //}}
+}
+#else
 uint32_t
 _SI32_DTM_A_get_timeout_counter_reload(SI32_DTM_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DTM_A_get_timeout_counter_reload(basePointer)
 #define SI32_DTM_A_get_timeout_counter_reload(basePointer) \
@@ -675,8 +1051,19 @@ _SI32_DTM_A_get_timeout_counter_reload(SI32_DTM_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_DTM_A_get_timeout_count(
+   SI32_DTM_A_Type * basePointer)
+{
+   //{{
+   return basePointer->TIMEOUT.TOCOUNT;
+   //}}
+}
+#else
 uint32_t
 _SI32_DTM_A_get_timeout_count(SI32_DTM_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DTM_A_get_timeout_count(basePointer)
 #define SI32_DTM_A_get_timeout_count(basePointer) \
@@ -697,9 +1084,23 @@ _SI32_DTM_A_get_timeout_count(SI32_DTM_A_Type* /*basePointer*/);
 ///  Valid range is 16 bits.
 ///  The requested master counter value.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DTM_A_set_master_count(
+   SI32_DTM_A_Type * basePointer,
+   // The requested master counter value.
+   uint32_t count)
+{
+   assert(count < 65536);   // count < 2^16
+   //{{
+   basePointer->MSTCOUNT.MSTCOUNT_BITS = count;
+   //}}
+}
+#else
 void
 _SI32_DTM_A_set_master_count(SI32_DTM_A_Type* /*basePointer*/,
    uint32_t /*count*/);
+#endif
 ///
 /// @def SI32_DTM_A_set_master_count(basePointer, count)
 #define SI32_DTM_A_set_master_count(basePointer, count) \
@@ -717,8 +1118,19 @@ _SI32_DTM_A_set_master_count(SI32_DTM_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_DTM_A_get_master_count(
+   SI32_DTM_A_Type * basePointer)
+{
+   //{{
+   return basePointer->MSTCOUNT.MSTCOUNT_BITS;
+   //}}
+}
+#else
 uint32_t
 _SI32_DTM_A_get_master_count(SI32_DTM_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DTM_A_get_master_count(basePointer)
 #define SI32_DTM_A_get_master_count(basePointer) \
@@ -739,9 +1151,22 @@ _SI32_DTM_A_get_master_count(SI32_DTM_A_Type* /*basePointer*/);
 ///  Valid range is 32 bits.
 ///  STATEADDR register value.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DTM_A_write_state_address(
+   SI32_DTM_A_Type * basePointer,
+   // STATEADDR register value.
+   uint32_t stateaddr)
+{
+   //{{
+   basePointer->STATEADDR.U32 = (stateaddr) & SI32_DTM_A_STATEADDR_STATEADDR_MASK;
+   //}}
+}
+#else
 void
 _SI32_DTM_A_write_state_address(SI32_DTM_A_Type* /*basePointer*/,
    uint32_t /*stateaddr*/);
+#endif
 ///
 /// @def SI32_DTM_A_write_state_address(basePointer, stateaddr)
 #define SI32_DTM_A_write_state_address(basePointer, stateaddr) \
@@ -759,8 +1184,19 @@ _SI32_DTM_A_write_state_address(SI32_DTM_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_DTM_A_read_state_address(
+   SI32_DTM_A_Type * basePointer)
+{
+   //{{
+   return basePointer->STATEADDR.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_DTM_A_read_state_address(SI32_DTM_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DTM_A_read_state_address(basePointer)
 #define SI32_DTM_A_read_state_address(basePointer) \
@@ -778,8 +1214,19 @@ _SI32_DTM_A_read_state_address(SI32_DTM_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_DTM_A_read_state(
+   SI32_DTM_A_Type * basePointer)
+{
+   //{{
+   return basePointer->STATE.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_DTM_A_read_state(SI32_DTM_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DTM_A_read_state(basePointer)
 #define SI32_DTM_A_read_state(basePointer) \
@@ -66,11 +66,30 @@ extern "C" {
 ///  Valid range is 32 bits.
 ///  Write to the SCONTROL register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ECRC_A_initialize(
+   SI32_ECRC_A_Type * basePointer,
+   // Write to the CONTROL register.
+   uint32_t control,
+   // Write to the POLY register.
+   uint32_t poly,
+   // Write to the SCONTROL register.
+   uint32_t scontrol)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   basePointer->POLY.U32 = poly;
+   basePointer->SCONTROL.U32 = scontrol;
+   //}}
+}
+#else
 void
 _SI32_ECRC_A_initialize(SI32_ECRC_A_Type* /*basePointer*/,
    uint32_t, /*control*/
    uint32_t, /*poly*/
    uint32_t /*scontrol*/);
+#endif
 ///
 /// @def SI32_ECRC_A_initialize(basePointer, control, poly, scontrol)
 #define SI32_ECRC_A_initialize(basePointer, control, poly, scontrol) do{  \
@@ -91,9 +110,22 @@ _SI32_ECRC_A_initialize(SI32_ECRC_A_Type* /*basePointer*/,
 ///  Valid range is 32 bits.
 ///  Write to CONTROL register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ECRC_A_write_control(
+   SI32_ECRC_A_Type * basePointer,
+   // Write to CONTROL register.
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_ECRC_A_write_control(SI32_ECRC_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_ECRC_A_write_control(basePointer, control)
 #define SI32_ECRC_A_write_control(basePointer, control) \
@@ -108,8 +140,19 @@ _SI32_ECRC_A_write_control(SI32_ECRC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_ECRC_A_read_control(
+   SI32_ECRC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_ECRC_A_read_control(SI32_ECRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ECRC_A_read_control(basePointer)
 #define SI32_ECRC_A_read_control(basePointer) \
@@ -121,8 +164,19 @@ _SI32_ECRC_A_read_control(SI32_ECRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ECRC_A_initialize_seed_to_zero(
+   SI32_ECRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_ECRC_A_CONTROL_SINITEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_ECRC_A_initialize_seed_to_zero(SI32_ECRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ECRC_A_initialize_seed_to_zero(basePointer)
 #define SI32_ECRC_A_initialize_seed_to_zero(basePointer) \
@@ -137,8 +191,20 @@ _SI32_ECRC_A_initialize_seed_to_zero(SI32_ECRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ECRC_A_initialize_seed_to_one(
+   SI32_ECRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_ECRC_A_CONTROL_SEED_ALL_ONES_U32
+                              | SI32_ECRC_A_CONTROL_SINITEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_ECRC_A_initialize_seed_to_one(SI32_ECRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ECRC_A_initialize_seed_to_one(basePointer)
 #define SI32_ECRC_A_initialize_seed_to_one(basePointer) do{  \
@@ -152,8 +218,19 @@ _SI32_ECRC_A_initialize_seed_to_one(SI32_ECRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ECRC_A_enable_module(
+   SI32_ECRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_ECRC_A_CONTROL_CRCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_ECRC_A_enable_module(SI32_ECRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ECRC_A_enable_module(basePointer)
 #define SI32_ECRC_A_enable_module(basePointer) \
@@ -165,8 +242,19 @@ _SI32_ECRC_A_enable_module(SI32_ECRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ECRC_A_disable_module(
+   SI32_ECRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_ECRC_A_CONTROL_CRCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_ECRC_A_disable_module(SI32_ECRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ECRC_A_disable_module(basePointer)
 #define SI32_ECRC_A_disable_module(basePointer) \
@@ -178,8 +266,19 @@ _SI32_ECRC_A_disable_module(SI32_ECRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ECRC_A_select_polynomial_fixed_32_bit(
+   SI32_ECRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_ECRC_A_CONTROL_POLYSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_ECRC_A_select_polynomial_fixed_32_bit(SI32_ECRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ECRC_A_select_polynomial_fixed_32_bit(basePointer)
 #define SI32_ECRC_A_select_polynomial_fixed_32_bit(basePointer) \
@@ -191,8 +290,19 @@ _SI32_ECRC_A_select_polynomial_fixed_32_bit(SI32_ECRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ECRC_A_select_polynomial_programmable_16_bit(
+   SI32_ECRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_ECRC_A_CONTROL_POLYSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_ECRC_A_select_polynomial_programmable_16_bit(SI32_ECRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ECRC_A_select_polynomial_programmable_16_bit(basePointer)
 #define SI32_ECRC_A_select_polynomial_programmable_16_bit(basePointer) \
@@ -204,8 +314,19 @@ _SI32_ECRC_A_select_polynomial_programmable_16_bit(SI32_ECRC_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ECRC_A_select_byte_mode(
+   SI32_ECRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_ECRC_A_CONTROL_BMDEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_ECRC_A_select_byte_mode(SI32_ECRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ECRC_A_select_byte_mode(basePointer)
 #define SI32_ECRC_A_select_byte_mode(basePointer) \
@@ -217,8 +338,19 @@ _SI32_ECRC_A_select_byte_mode(SI32_ECRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ECRC_A_select_word_mode(
+   SI32_ECRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_ECRC_A_CONTROL_BMDEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_ECRC_A_select_word_mode(SI32_ECRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ECRC_A_select_word_mode(basePointer)
 #define SI32_ECRC_A_select_word_mode(basePointer) \
@@ -230,8 +362,19 @@ _SI32_ECRC_A_select_word_mode(SI32_ECRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ECRC_A_enable_bit_reversal(
+   SI32_ECRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_ECRC_A_CONTROL_BBREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_ECRC_A_enable_bit_reversal(SI32_ECRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ECRC_A_enable_bit_reversal(basePointer)
 #define SI32_ECRC_A_enable_bit_reversal(basePointer) \
@@ -243,8 +386,19 @@ _SI32_ECRC_A_enable_bit_reversal(SI32_ECRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ECRC_A_disable_bit_reversal(
+   SI32_ECRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_ECRC_A_CONTROL_BBREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_ECRC_A_disable_bit_reversal(SI32_ECRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ECRC_A_disable_bit_reversal(basePointer)
 #define SI32_ECRC_A_disable_bit_reversal(basePointer) \
@@ -263,9 +417,40 @@ _SI32_ECRC_A_disable_bit_reversal(SI32_ECRC_A_Type* /*basePointer*/);
 ///  B1 B0, output: B2 B3 B0 B1), 2 = 32-bit big endian order (input: B3 B2
 ///  B1 B0, output: B0 B1 B2 B3), 3 = reserved.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ECRC_A_set_processing_order(
+   SI32_ECRC_A_Type * basePointer,
+   // 0 = no byte reorientation, 1 = 16-bit big endian order (input: B3 B2
+   // B1 B0, output: B2 B3 B0 B1), 2 = 32-bit big endian order (input: B3 B2
+   // B1 B0, output: B0 B1 B2 B3), 3 = reserved.
+   SI32_ECRC_A_PROCESSING_ORDER_Enum_Type order)
+{
+   //{{
+   switch (order)
+   {
+      case 0:
+         basePointer->CONTROL_CLR = SI32_ECRC_A_CONTROL_ORDER_MASK
+                                 | SI32_ECRC_A_CONTROL_ORDER_NO_REORDER_U32;
+         break;
+      case 1:
+         basePointer->CONTROL_CLR = SI32_ECRC_A_CONTROL_ORDER_MASK;
+         basePointer->CONTROL_SET = SI32_ECRC_A_CONTROL_ORDER_BIG_ENDIAN_16_U32;
+         break;
+      case 2:
+         basePointer->CONTROL_CLR = SI32_ECRC_A_CONTROL_ORDER_MASK;
+         basePointer->CONTROL_SET = SI32_ECRC_A_CONTROL_ORDER_BIG_ENDIAN_32_U32;
+         break;
+      default:
+         break;
+   }
+   //}}
+}
+#else
 void
 _SI32_ECRC_A_set_processing_order(SI32_ECRC_A_Type* /*basePointer*/,
    SI32_ECRC_A_PROCESSING_ORDER_Enum_Type /*order*/);
+#endif
 ///
 /// @def SI32_ECRC_A_set_processing_order(basePointer, order)
 #define SI32_ECRC_A_set_processing_order(basePointer, order) \
@@ -282,8 +467,19 @@ _SI32_ECRC_A_set_processing_order(SI32_ECRC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_ECRC_A_get_processing_order(
+   SI32_ECRC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.ORDER;
+   //}}
+}
+#else
 uint32_t
 _SI32_ECRC_A_get_processing_order(SI32_ECRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ECRC_A_get_processing_order(basePointer)
 #define SI32_ECRC_A_get_processing_order(basePointer) \
@@ -299,8 +495,19 @@ _SI32_ECRC_A_get_processing_order(SI32_ECRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ECRC_A_enable_autoseed(
+   SI32_ECRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_ECRC_A_CONTROL_ASEEDEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_ECRC_A_enable_autoseed(SI32_ECRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ECRC_A_enable_autoseed(basePointer)
 #define SI32_ECRC_A_enable_autoseed(basePointer) \
@@ -312,8 +519,19 @@ _SI32_ECRC_A_enable_autoseed(SI32_ECRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ECRC_A_disable_autoseed(
+   SI32_ECRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_ECRC_A_CONTROL_ASEEDEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_ECRC_A_disable_autoseed(SI32_ECRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ECRC_A_disable_autoseed(basePointer)
 #define SI32_ECRC_A_disable_autoseed(basePointer) \
@@ -325,8 +543,19 @@ _SI32_ECRC_A_disable_autoseed(SI32_ECRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ECRC_A_select_autoseed_after_reading_lsb_mode(
+   SI32_ECRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_ECRC_A_CONTROL_ASEEDSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_ECRC_A_select_autoseed_after_reading_lsb_mode(SI32_ECRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ECRC_A_select_autoseed_after_reading_lsb_mode(basePointer)
 #define SI32_ECRC_A_select_autoseed_after_reading_lsb_mode(basePointer) \
@@ -338,8 +567,19 @@ _SI32_ECRC_A_select_autoseed_after_reading_lsb_mode(SI32_ECRC_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ECRC_A_select_autoseed_after_reading_msb_mode(
+   SI32_ECRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_ECRC_A_CONTROL_ASEEDSEL_MSB_READ_U32;
+   //}}
+}
+#else
 void
 _SI32_ECRC_A_select_autoseed_after_reading_msb_mode(SI32_ECRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ECRC_A_select_autoseed_after_reading_msb_mode(basePointer)
 #define SI32_ECRC_A_select_autoseed_after_reading_msb_mode(basePointer) \
@@ -359,9 +599,21 @@ _SI32_ECRC_A_select_autoseed_after_reading_msb_mode(SI32_ECRC_A_Type* /*basePoin
 ///  poly
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ECRC_A_write_poly(
+   SI32_ECRC_A_Type * basePointer,
+   uint32_t poly)
+{
+   //{{
+   basePointer->POLY.U32 = poly;
+   //}}
+}
+#else
 void
 _SI32_ECRC_A_write_poly(SI32_ECRC_A_Type* /*basePointer*/,
    uint32_t /*poly*/);
+#endif
 ///
 /// @def SI32_ECRC_A_write_poly(basePointer, poly)
 #define SI32_ECRC_A_write_poly(basePointer, poly) \
@@ -376,8 +628,19 @@ _SI32_ECRC_A_write_poly(SI32_ECRC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_ECRC_A_read_poly(
+   SI32_ECRC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->POLY.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_ECRC_A_read_poly(SI32_ECRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ECRC_A_read_poly(basePointer)
 #define SI32_ECRC_A_read_poly(basePointer) \
@@ -397,9 +660,21 @@ _SI32_ECRC_A_read_poly(SI32_ECRC_A_Type* /*basePointer*/);
 ///  data
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ECRC_A_write_data(
+   SI32_ECRC_A_Type * basePointer,
+   uint32_t data)
+{
+   //{{
+   basePointer->DATA.U32 = data;
+   //}}
+}
+#else
 void
 _SI32_ECRC_A_write_data(SI32_ECRC_A_Type* /*basePointer*/,
    uint32_t /*data*/);
+#endif
 ///
 /// @def SI32_ECRC_A_write_data(basePointer, data)
 #define SI32_ECRC_A_write_data(basePointer, data) \
@@ -414,8 +689,19 @@ _SI32_ECRC_A_write_data(SI32_ECRC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_ECRC_A_read_result(
+   SI32_ECRC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DATA.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_ECRC_A_read_result(SI32_ECRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ECRC_A_read_result(basePointer)
 #define SI32_ECRC_A_read_result(basePointer) \
@@ -430,8 +716,19 @@ _SI32_ECRC_A_read_result(SI32_ECRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_ECRC_A_read_bit_reversed_result(
+   SI32_ECRC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->RDATA.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_ECRC_A_read_bit_reversed_result(SI32_ECRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ECRC_A_read_bit_reversed_result(basePointer)
 #define SI32_ECRC_A_read_bit_reversed_result(basePointer) \
@@ -446,8 +743,19 @@ _SI32_ECRC_A_read_bit_reversed_result(SI32_ECRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_ECRC_A_read_byte_reversed_result(
+   SI32_ECRC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->BRDATA.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_ECRC_A_read_byte_reversed_result(SI32_ECRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ECRC_A_read_byte_reversed_result(basePointer)
 #define SI32_ECRC_A_read_byte_reversed_result(basePointer) \
@@ -467,9 +775,21 @@ _SI32_ECRC_A_read_byte_reversed_result(SI32_ECRC_A_Type* /*basePointer*/);
 ///  scontrol
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ECRC_A_write_scontrol(
+   SI32_ECRC_A_Type * basePointer,
+   uint32_t scontrol)
+{
+   //{{
+   basePointer->SCONTROL.U32 = scontrol;
+   //}}
+}
+#else
 void
 _SI32_ECRC_A_write_scontrol(SI32_ECRC_A_Type* /*basePointer*/,
    uint32_t /*scontrol*/);
+#endif
 ///
 /// @def SI32_ECRC_A_write_scontrol(basePointer, scontrol)
 #define SI32_ECRC_A_write_scontrol(basePointer, scontrol) \
@@ -484,8 +804,19 @@ _SI32_ECRC_A_write_scontrol(SI32_ECRC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_ECRC_A_read_scontrol(
+   SI32_ECRC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->SCONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_ECRC_A_read_scontrol(SI32_ECRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ECRC_A_read_scontrol(basePointer)
 #define SI32_ECRC_A_read_scontrol(basePointer) \
@@ -497,8 +828,19 @@ _SI32_ECRC_A_read_scontrol(SI32_ECRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ECRC_A_enable_snooping(
+   SI32_ECRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SCONTROL_SET = SI32_ECRC_A_SCONTROL_SEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_ECRC_A_enable_snooping(SI32_ECRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ECRC_A_enable_snooping(basePointer)
 #define SI32_ECRC_A_enable_snooping(basePointer) \
@@ -510,8 +852,19 @@ _SI32_ECRC_A_enable_snooping(SI32_ECRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ECRC_A_disable_snooping(
+   SI32_ECRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SCONTROL_CLR = SI32_ECRC_A_SCONTROL_SEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_ECRC_A_disable_snooping(SI32_ECRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ECRC_A_disable_snooping(basePointer)
 #define SI32_ECRC_A_disable_snooping(basePointer) \
@@ -523,8 +876,19 @@ _SI32_ECRC_A_disable_snooping(SI32_ECRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ECRC_A_select_snooping_reads_mode(
+   SI32_ECRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SCONTROL_SET = SI32_ECRC_A_SCONTROL_SDIRSEL_READS_U32;
+   //}}
+}
+#else
 void
 _SI32_ECRC_A_select_snooping_reads_mode(SI32_ECRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ECRC_A_select_snooping_reads_mode(basePointer)
 #define SI32_ECRC_A_select_snooping_reads_mode(basePointer) \
@@ -536,8 +900,19 @@ _SI32_ECRC_A_select_snooping_reads_mode(SI32_ECRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ECRC_A_select_snooping_writes_mode(
+   SI32_ECRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SCONTROL_CLR = SI32_ECRC_A_SCONTROL_SDIRSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_ECRC_A_select_snooping_writes_mode(SI32_ECRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ECRC_A_select_snooping_writes_mode(basePointer)
 #define SI32_ECRC_A_select_snooping_writes_mode(basePointer) \
@@ -553,9 +928,22 @@ _SI32_ECRC_A_select_snooping_writes_mode(SI32_ECRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  speripheral
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ECRC_A_select_snooping_peripheral(
+   SI32_ECRC_A_Type * basePointer,
+   SI32_ECRC_A_DEVICE_PERIPHERAL_Enum_Type speripheral)
+{
+   //{{
+   basePointer->SCONTROL_CLR = SI32_ECRC_A_SCONTROL_SPERISEL_MASK;
+   basePointer->SCONTROL_SET = speripheral << SI32_ECRC_A_SCONTROL_SPERISEL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_ECRC_A_select_snooping_peripheral(SI32_ECRC_A_Type* /*basePointer*/,
    SI32_ECRC_A_DEVICE_PERIPHERAL_Enum_Type /*speripheral*/);
+#endif
 ///
 /// @def SI32_ECRC_A_select_snooping_peripheral(basePointer, speripheral)
 #define SI32_ECRC_A_select_snooping_peripheral(basePointer, speripheral) do{  \
@@ -574,9 +962,22 @@ _SI32_ECRC_A_select_snooping_peripheral(SI32_ECRC_A_Type* /*basePointer*/,
 ///  saddress
 ///  Valid range is 10 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ECRC_A_select_snooping_address(
+   SI32_ECRC_A_Type * basePointer,
+   uint32_t saddress)
+{
+   assert(saddress < 1024);   // saddress < 2^10
+   //{{
+   basePointer->SCONTROL.SADDR = saddress;
+   //}}
+}
+#else
 void
 _SI32_ECRC_A_select_snooping_address(SI32_ECRC_A_Type* /*basePointer*/,
    uint32_t /*saddress*/);
+#endif
 ///
 /// @def SI32_ECRC_A_select_snooping_address(basePointer, saddress)
 #define SI32_ECRC_A_select_snooping_address(basePointer, saddress) \
@@ -75,6 +75,30 @@ extern "C" {
 ///  Valid range is 32 bits.
 ///  Write to IFWCST register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EMIFIF_A_initialize(
+   SI32_EMIFIF_A_Type * basePointer,
+   // Write to IFCONFIG register.
+   uint32_t config,
+   // Write to IFRT register.
+   uint32_t ifrt,
+   // Write to IFWT register.
+   uint32_t ifwt,
+   // Write to IFRCST register.
+   uint32_t ifrcst,
+   // Write to IFWCST register.
+   uint32_t ifwcst)
+{
+   //{{
+   basePointer->CONFIG.U32 = config;
+   basePointer->IFRT.U32     = ifrt;
+   basePointer->IFWT.U32     = ifwt;
+   basePointer->IFRCST.U32   = ifrcst;
+   basePointer->IFWCST.U32   = ifwcst;
+   //}}
+}
+#else
 void
 _SI32_EMIFIF_A_initialize(SI32_EMIFIF_A_Type* /*basePointer*/,
    uint32_t, /*config*/
@@ -82,6 +106,7 @@ _SI32_EMIFIF_A_initialize(SI32_EMIFIF_A_Type* /*basePointer*/,
    uint32_t, /*ifwt*/
    uint32_t, /*ifrcst*/
    uint32_t /*ifwcst*/);
+#endif
 ///
 /// @def SI32_EMIFIF_A_initialize(basePointer, config, ifrt, ifwt, ifrcst, ifwcst)
 #define SI32_EMIFIF_A_initialize(basePointer, config, ifrt, ifwt, ifrcst, ifwcst) \
@@ -96,8 +121,19 @@ _SI32_EMIFIF_A_initialize(SI32_EMIFIF_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_EMIFIF_A_read_config(
+   SI32_EMIFIF_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONFIG.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_EMIFIF_A_read_config(SI32_EMIFIF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EMIFIF_A_read_config(basePointer)
 #define SI32_EMIFIF_A_read_config(basePointer) \
@@ -117,9 +153,21 @@ _SI32_EMIFIF_A_read_config(SI32_EMIFIF_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EMIFIF_A_write_config(
+   SI32_EMIFIF_A_Type * basePointer,
+   uint32_t value)
+{
+   //{{
+   basePointer->CONFIG.U32 = value;
+   //}}
+}
+#else
 void
 _SI32_EMIFIF_A_write_config(SI32_EMIFIF_A_Type* /*basePointer*/,
    uint32_t /*value*/);
+#endif
 ///
 /// @def SI32_EMIFIF_A_write_config(basePointer, value)
 #define SI32_EMIFIF_A_write_config(basePointer, value) \
@@ -131,8 +179,19 @@ _SI32_EMIFIF_A_write_config(SI32_EMIFIF_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EMIFIF_A_select_8bit_mode(
+   SI32_EMIFIF_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_EMIFIF_A_CONFIG_BUSWIDTH_MASK;
+   //}}
+}
+#else
 void
 _SI32_EMIFIF_A_select_8bit_mode(SI32_EMIFIF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EMIFIF_A_select_8bit_mode(basePointer)
 #define SI32_EMIFIF_A_select_8bit_mode(basePointer) \
@@ -144,8 +203,19 @@ _SI32_EMIFIF_A_select_8bit_mode(SI32_EMIFIF_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EMIFIF_A_select_16bit_mode(
+   SI32_EMIFIF_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_EMIFIF_A_CONFIG_BUSWIDTH_MASK;
+   //}}
+}
+#else
 void
 _SI32_EMIFIF_A_select_16bit_mode(SI32_EMIFIF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EMIFIF_A_select_16bit_mode(basePointer)
 #define SI32_EMIFIF_A_select_16bit_mode(basePointer) \
@@ -157,8 +227,19 @@ _SI32_EMIFIF_A_select_16bit_mode(SI32_EMIFIF_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EMIFIF_A_select_muxed_mode(
+   SI32_EMIFIF_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_EMIFIF_A_CONFIG_MUXMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_EMIFIF_A_select_muxed_mode(SI32_EMIFIF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EMIFIF_A_select_muxed_mode(basePointer)
 #define SI32_EMIFIF_A_select_muxed_mode(basePointer) \
@@ -170,8 +251,19 @@ _SI32_EMIFIF_A_select_muxed_mode(SI32_EMIFIF_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EMIFIF_A_select_nonmuxed_mode(
+   SI32_EMIFIF_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_EMIFIF_A_CONFIG_MUXMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_EMIFIF_A_select_nonmuxed_mode(SI32_EMIFIF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EMIFIF_A_select_nonmuxed_mode(basePointer)
 #define SI32_EMIFIF_A_select_nonmuxed_mode(basePointer) \
@@ -183,8 +275,19 @@ _SI32_EMIFIF_A_select_nonmuxed_mode(SI32_EMIFIF_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EMIFIF_A_enable_address_shift(
+   SI32_EMIFIF_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_EMIFIF_A_CONFIG_ASEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EMIFIF_A_enable_address_shift(SI32_EMIFIF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EMIFIF_A_enable_address_shift(basePointer)
 #define SI32_EMIFIF_A_enable_address_shift(basePointer) \
@@ -196,8 +299,19 @@ _SI32_EMIFIF_A_enable_address_shift(SI32_EMIFIF_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EMIFIF_A_disable_address_shift(
+   SI32_EMIFIF_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_EMIFIF_A_CONFIG_ASEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EMIFIF_A_disable_address_shift(SI32_EMIFIF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EMIFIF_A_disable_address_shift(basePointer)
 #define SI32_EMIFIF_A_disable_address_shift(basePointer) \
@@ -209,8 +323,19 @@ _SI32_EMIFIF_A_disable_address_shift(SI32_EMIFIF_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EMIFIF_A_enable_read_only(
+   SI32_EMIFIF_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_EMIFIF_A_CONFIG_ROEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EMIFIF_A_enable_read_only(SI32_EMIFIF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EMIFIF_A_enable_read_only(basePointer)
 #define SI32_EMIFIF_A_enable_read_only(basePointer) \
@@ -222,8 +347,19 @@ _SI32_EMIFIF_A_enable_read_only(SI32_EMIFIF_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EMIFIF_A_disable_read_only(
+   SI32_EMIFIF_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_EMIFIF_A_CONFIG_ROEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EMIFIF_A_disable_read_only(SI32_EMIFIF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EMIFIF_A_disable_read_only(basePointer)
 #define SI32_EMIFIF_A_disable_read_only(basePointer) \
@@ -235,8 +371,19 @@ _SI32_EMIFIF_A_disable_read_only(SI32_EMIFIF_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EMIFIF_A_enable_write_data_hold(
+   SI32_EMIFIF_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_EMIFIF_A_CONFIG_WDHINH_MASK;
+   //}}
+}
+#else
 void
 _SI32_EMIFIF_A_enable_write_data_hold(SI32_EMIFIF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EMIFIF_A_enable_write_data_hold(basePointer)
 #define SI32_EMIFIF_A_enable_write_data_hold(basePointer) \
@@ -248,8 +395,19 @@ _SI32_EMIFIF_A_enable_write_data_hold(SI32_EMIFIF_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EMIFIF_A_disable_write_data_hold(
+   SI32_EMIFIF_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_EMIFIF_A_CONFIG_WDHINH_MASK;
+   //}}
+}
+#else
 void
 _SI32_EMIFIF_A_disable_write_data_hold(SI32_EMIFIF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EMIFIF_A_disable_write_data_hold(basePointer)
 #define SI32_EMIFIF_A_disable_write_data_hold(basePointer) \
@@ -261,8 +419,19 @@ _SI32_EMIFIF_A_disable_write_data_hold(SI32_EMIFIF_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EMIFIF_A_enable_oeb_delay(
+   SI32_EMIFIF_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_EMIFIF_A_CONFIG_DELAYOE_MASK;
+   //}}
+}
+#else
 void
 _SI32_EMIFIF_A_enable_oeb_delay(SI32_EMIFIF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EMIFIF_A_enable_oeb_delay(basePointer)
 #define SI32_EMIFIF_A_enable_oeb_delay(basePointer) \
@@ -274,8 +443,19 @@ _SI32_EMIFIF_A_enable_oeb_delay(SI32_EMIFIF_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EMIFIF_A_disable_oeb_delay(
+   SI32_EMIFIF_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_EMIFIF_A_CONFIG_DELAYOE_MASK;
+   //}}
+}
+#else
 void
 _SI32_EMIFIF_A_disable_oeb_delay(SI32_EMIFIF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EMIFIF_A_disable_oeb_delay(basePointer)
 #define SI32_EMIFIF_A_disable_oeb_delay(basePointer) \
@@ -287,8 +467,19 @@ _SI32_EMIFIF_A_disable_oeb_delay(SI32_EMIFIF_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EMIFIF_A_enable_keep_value(
+   SI32_EMIFIF_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_EMIFIF_A_CONFIG_KLREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EMIFIF_A_enable_keep_value(SI32_EMIFIF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EMIFIF_A_enable_keep_value(basePointer)
 #define SI32_EMIFIF_A_enable_keep_value(basePointer) \
@@ -300,8 +491,19 @@ _SI32_EMIFIF_A_enable_keep_value(SI32_EMIFIF_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EMIFIF_A_disable_keep_value(
+   SI32_EMIFIF_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_EMIFIF_A_CONFIG_KLREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EMIFIF_A_disable_keep_value(SI32_EMIFIF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EMIFIF_A_disable_keep_value(basePointer)
 #define SI32_EMIFIF_A_disable_keep_value(basePointer) \
@@ -316,8 +518,19 @@ _SI32_EMIFIF_A_disable_keep_value(SI32_EMIFIF_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_EMIFIF_A_read_ifrt(
+   SI32_EMIFIF_A_Type * basePointer)
+{
+   //{{
+   return basePointer->IFRT.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_EMIFIF_A_read_ifrt(SI32_EMIFIF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EMIFIF_A_read_ifrt(basePointer)
 #define SI32_EMIFIF_A_read_ifrt(basePointer) \
@@ -337,9 +550,21 @@ _SI32_EMIFIF_A_read_ifrt(SI32_EMIFIF_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EMIFIF_A_write_ifrt(
+   SI32_EMIFIF_A_Type * basePointer,
+   uint32_t value)
+{
+   //{{
+   basePointer->IFRT.U32 = value;
+   //}}
+}
+#else
 void
 _SI32_EMIFIF_A_write_ifrt(SI32_EMIFIF_A_Type* /*basePointer*/,
    uint32_t /*value*/);
+#endif
 ///
 /// @def SI32_EMIFIF_A_write_ifrt(basePointer, value)
 #define SI32_EMIFIF_A_write_ifrt(basePointer, value) \
@@ -375,12 +600,38 @@ _SI32_EMIFIF_A_write_ifrt(SI32_EMIFIF_A_Type* /*basePointer*/,
 ///  Valid range is 6 bits.
 ///  RDATAWAIT bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EMIFIF_A_set_read_timing(
+   SI32_EMIFIF_A_Type * basePointer,
+   // RADDRSET bits.
+   uint32_t addr_setup,
+   // RADDRHOLD bits.
+   uint32_t addr_hold,
+   // RDATAHOLD bits.
+   uint32_t data_hold,
+   // RDATAWAIT bits.
+   uint32_t data_wait)
+{
+   assert(addr_setup < 16);   // addr_setup < 2^4
+   assert(addr_hold < 16);   // addr_hold < 2^4
+   assert(data_hold < 16);   // data_hold < 2^4
+   assert(data_wait < 64);   // data_wait < 2^6
+   //{{
+   basePointer->IFRT.U32 = (addr_setup << SI32_EMIFIF_A_IFRT_RASET_SHIFT)
+                         | (addr_hold << SI32_EMIFIF_A_IFRT_RAHOLD_SHIFT)
+                         | (data_hold << SI32_EMIFIF_A_IFRT_RDHOLD_SHIFT)
+                         | (data_wait << SI32_EMIFIF_A_IFRT_RDWAIT_SHIFT);
+   //}}
+}
+#else
 void
 _SI32_EMIFIF_A_set_read_timing(SI32_EMIFIF_A_Type* /*basePointer*/,
    uint32_t, /*addr_setup*/
    uint32_t, /*addr_hold*/
    uint32_t, /*data_hold*/
    uint32_t /*data_wait*/);
+#endif
 ///
 /// @def SI32_EMIFIF_A_set_read_timing(basePointer, addr_setup, addr_hold, data_hold, data_wait)
 #define SI32_EMIFIF_A_set_read_timing(basePointer, addr_setup, addr_hold, data_hold, data_wait) do{  \
@@ -399,8 +650,19 @@ _SI32_EMIFIF_A_set_read_timing(SI32_EMIFIF_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_EMIFIF_A_read_ifwt(
+   SI32_EMIFIF_A_Type * basePointer)
+{
+   //{{
+   return basePointer->IFWT.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_EMIFIF_A_read_ifwt(SI32_EMIFIF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EMIFIF_A_read_ifwt(basePointer)
 #define SI32_EMIFIF_A_read_ifwt(basePointer) \
@@ -420,9 +682,21 @@ _SI32_EMIFIF_A_read_ifwt(SI32_EMIFIF_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EMIFIF_A_write_ifwt(
+   SI32_EMIFIF_A_Type * basePointer,
+   uint32_t value)
+{
+   //{{
+   basePointer->IFWT.U32 = value;
+   //}}
+}
+#else
 void
 _SI32_EMIFIF_A_write_ifwt(SI32_EMIFIF_A_Type* /*basePointer*/,
    uint32_t /*value*/);
+#endif
 ///
 /// @def SI32_EMIFIF_A_write_ifwt(basePointer, value)
 #define SI32_EMIFIF_A_write_ifwt(basePointer, value) \
@@ -458,12 +732,38 @@ _SI32_EMIFIF_A_write_ifwt(SI32_EMIFIF_A_Type* /*basePointer*/,
 ///  Valid range is 6 bits.
 ///  WDATAWAIT bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EMIFIF_A_set_write_timing(
+   SI32_EMIFIF_A_Type * basePointer,
+   // WADDRSET bits.
+   uint32_t addr_setup,
+   // WADDRHOLD bits.
+   uint32_t addr_hold,
+   // WDATAHOLD bits.
+   uint32_t data_hold,
+   // WDATAWAIT bits.
+   uint32_t data_wait)
+{
+   assert(addr_setup < 16);   // addr_setup < 2^4
+   assert(addr_hold < 16);   // addr_hold < 2^4
+   assert(data_hold < 16);   // data_hold < 2^4
+   assert(data_wait < 64);   // data_wait < 2^6
+   //{{
+   basePointer->IFWT.U32 = (addr_setup << SI32_EMIFIF_A_IFWT_WASET_SHIFT)
+                         | (addr_hold << SI32_EMIFIF_A_IFWT_WAHOLD_SHIFT)
+                         | (data_hold << SI32_EMIFIF_A_IFWT_WDHOLD_SHIFT)
+                         | (data_wait << SI32_EMIFIF_A_IFWT_WDWAIT_SHIFT);
+   //}}
+}
+#else
 void
 _SI32_EMIFIF_A_set_write_timing(SI32_EMIFIF_A_Type* /*basePointer*/,
    uint32_t, /*addr_setup*/
    uint32_t, /*addr_hold*/
    uint32_t, /*data_hold*/
    uint32_t /*data_wait*/);
+#endif
 ///
 /// @def SI32_EMIFIF_A_set_write_timing(basePointer, addr_setup, addr_hold, data_hold, data_wait)
 #define SI32_EMIFIF_A_set_write_timing(basePointer, addr_setup, addr_hold, data_hold, data_wait) do{  \
@@ -482,8 +782,19 @@ _SI32_EMIFIF_A_set_write_timing(SI32_EMIFIF_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_EMIFIF_A_read_ifrcst(
+   SI32_EMIFIF_A_Type * basePointer)
+{
+   //{{
+   return basePointer->IFRCST.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_EMIFIF_A_read_ifrcst(SI32_EMIFIF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EMIFIF_A_read_ifrcst(basePointer)
 #define SI32_EMIFIF_A_read_ifrcst(basePointer) \
@@ -503,9 +814,21 @@ _SI32_EMIFIF_A_read_ifrcst(SI32_EMIFIF_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EMIFIF_A_write_ifrcst(
+   SI32_EMIFIF_A_Type * basePointer,
+   uint32_t value)
+{
+   //{{
+   basePointer->IFRCST.U32 = value;
+   //}}
+}
+#else
 void
 _SI32_EMIFIF_A_write_ifrcst(SI32_EMIFIF_A_Type* /*basePointer*/,
    uint32_t /*value*/);
+#endif
 ///
 /// @def SI32_EMIFIF_A_write_ifrcst(basePointer, value)
 #define SI32_EMIFIF_A_write_ifrcst(basePointer, value) \
@@ -542,12 +865,39 @@ _SI32_EMIFIF_A_write_ifrcst(SI32_EMIFIF_A_Type* /*basePointer*/,
 ///  ALERAS (bit 0), ALERAH (bit 1), ALERDW (bit 2), and ALERDH (bit
 ///  3)bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EMIFIF_A_set_read_control_states(
+   SI32_EMIFIF_A_Type * basePointer,
+   // CSRAS (bit 0), CSRAH (bit 1), CSRDW (bit 2), and CSRDH (bit 3)bits.
+   uint32_t csn,
+   // OERAS (bit 0), OERAH (bit 1), OERDW (bit 2), and OERDH (bit 3)bits.
+   uint32_t oeb,
+   // WRRAS (bit 0), WRRAH (bit 1), WRRDW (bit 2), and WRRDH (bit 3)bits.
+   uint32_t wrb,
+   // ALERAS (bit 0), ALERAH (bit 1), ALERDW (bit 2), and ALERDH (bit
+   // 3)bits.
+   uint32_t alem)
+{
+   assert(csn < 16);   // csn < 2^4
+   assert(oeb < 16);   // oeb < 2^4
+   assert(wrb < 16);   // wrb < 2^4
+   assert(alem < 16);   // alem < 2^4
+   //{{
+   basePointer->IFRCST.U32 = (csn << SI32_EMIFIF_A_IFRCST_CSRAS_SHIFT)
+                           | (oeb << SI32_EMIFIF_A_IFRCST_OERAS_SHIFT)
+                           | (wrb << SI32_EMIFIF_A_IFRCST_WRRAS_SHIFT)
+                           | (alem << SI32_EMIFIF_A_IFRCST_ALERAS_SHIFT);
+   //}}
+}
+#else
 void
 _SI32_EMIFIF_A_set_read_control_states(SI32_EMIFIF_A_Type* /*basePointer*/,
    uint32_t, /*csn*/
    uint32_t, /*oeb*/
    uint32_t, /*wrb*/
    uint32_t /*alem*/);
+#endif
 ///
 /// @def SI32_EMIFIF_A_set_read_control_states(basePointer, csn, oeb, wrb, alem)
 #define SI32_EMIFIF_A_set_read_control_states(basePointer, csn, oeb, wrb, alem) do{  \
@@ -566,8 +916,19 @@ _SI32_EMIFIF_A_set_read_control_states(SI32_EMIFIF_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_EMIFIF_A_read_ifwcst(
+   SI32_EMIFIF_A_Type * basePointer)
+{
+   //{{
+   return basePointer->IFWCST.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_EMIFIF_A_read_ifwcst(SI32_EMIFIF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EMIFIF_A_read_ifwcst(basePointer)
 #define SI32_EMIFIF_A_read_ifwcst(basePointer) \
@@ -587,9 +948,21 @@ _SI32_EMIFIF_A_read_ifwcst(SI32_EMIFIF_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EMIFIF_A_write_ifwcst(
+   SI32_EMIFIF_A_Type * basePointer,
+   uint32_t value)
+{
+   //{{
+   basePointer->IFWCST.U32 = value;
+   //}}
+}
+#else
 void
 _SI32_EMIFIF_A_write_ifwcst(SI32_EMIFIF_A_Type* /*basePointer*/,
    uint32_t /*value*/);
+#endif
 ///
 /// @def SI32_EMIFIF_A_write_ifwcst(basePointer, value)
 #define SI32_EMIFIF_A_write_ifwcst(basePointer, value) \
@@ -626,12 +999,39 @@ _SI32_EMIFIF_A_write_ifwcst(SI32_EMIFIF_A_Type* /*basePointer*/,
 ///  ALEWAS (bit 0), ALEWAH (bit 1), ALEWDW (bit 2), and ALERDH (bit
 ///  3)bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EMIFIF_A_set_write_control_states(
+   SI32_EMIFIF_A_Type * basePointer,
+   // CSWAS (bit 0), CSWAH (bit 1), CSWDW (bit 2), and CSWDH (bit 3)bits.
+   uint32_t csn,
+   // OEWAS (bit 0), OEWAH (bit 1), OEWDW (bit 2), and OEWDH (bit 3)bits.
+   uint32_t oeb,
+   // WRWAS (bit 0), WRWAH (bit 1), WRWDW (bit 2), and WRWDH (bit 3)bits.
+   uint32_t wrb,
+   // ALEWAS (bit 0), ALEWAH (bit 1), ALEWDW (bit 2), and ALERDH (bit
+   // 3)bits.
+   uint32_t alem)
+{
+   assert(csn < 16);   // csn < 2^4
+   assert(oeb < 16);   // oeb < 2^4
+   assert(wrb < 16);   // wrb < 2^4
+   assert(alem < 16);   // alem < 2^4
+   //{{
+   basePointer->IFWCST.U32 = (csn << SI32_EMIFIF_A_IFWCST_CSWAS_SHIFT)
+                           | (oeb << SI32_EMIFIF_A_IFWCST_OEWAS_SHIFT)
+                           | (wrb << SI32_EMIFIF_A_IFWCST_WRWAS_SHIFT)
+                           | (alem << SI32_EMIFIF_A_IFWCST_ALEWAS_SHIFT);
+   //}}
+}
+#else
 void
 _SI32_EMIFIF_A_set_write_control_states(SI32_EMIFIF_A_Type* /*basePointer*/,
    uint32_t, /*csn*/
    uint32_t, /*oeb*/
    uint32_t, /*wrb*/
    uint32_t /*alem*/);
+#endif
 ///
 /// @def SI32_EMIFIF_A_set_write_control_states(basePointer, csn, oeb, wrb, alem)
 #define SI32_EMIFIF_A_set_write_control_states(basePointer, csn, oeb, wrb, alem) do{  \
@@ -51,9 +51,22 @@ extern "C" {
 ///  Valid range is 32 bits.
 ///  Value for the CONTROL register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EMIF_A_initialize(
+   SI32_EMIF_A_Type * basePointer,
+   // Value for the CONTROL register.
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_EMIF_A_initialize(SI32_EMIF_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_EMIF_A_initialize(basePointer, control)
 #define SI32_EMIF_A_initialize(basePointer, control) \
@@ -68,8 +81,19 @@ _SI32_EMIF_A_initialize(SI32_EMIF_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_EMIF_A_read_control(
+   SI32_EMIF_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_EMIF_A_read_control(SI32_EMIF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EMIF_A_read_control(basePointer)
 #define SI32_EMIF_A_read_control(basePointer) \
@@ -89,9 +113,21 @@ _SI32_EMIF_A_read_control(SI32_EMIF_A_Type* /*basePointer*/);
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EMIF_A_write_control(
+   SI32_EMIF_A_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_EMIF_A_write_control(SI32_EMIF_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_EMIF_A_write_control(basePointer, control)
 #define SI32_EMIF_A_write_control(basePointer, control) \
@@ -103,8 +139,19 @@ _SI32_EMIF_A_write_control(SI32_EMIF_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EMIF_A_disable_interface_0(
+   SI32_EMIF_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EMIF_A_CONTROL_IF0EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EMIF_A_disable_interface_0(SI32_EMIF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EMIF_A_disable_interface_0(basePointer)
 #define SI32_EMIF_A_disable_interface_0(basePointer) \
@@ -116,8 +163,19 @@ _SI32_EMIF_A_disable_interface_0(SI32_EMIF_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EMIF_A_enable_interface_0(
+   SI32_EMIF_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_EMIF_A_CONTROL_IF0EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EMIF_A_enable_interface_0(SI32_EMIF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EMIF_A_enable_interface_0(basePointer)
 #define SI32_EMIF_A_enable_interface_0(basePointer) \
@@ -129,8 +187,19 @@ _SI32_EMIF_A_enable_interface_0(SI32_EMIF_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EMIF_A_disable_interface_1(
+   SI32_EMIF_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EMIF_A_CONTROL_IF1EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EMIF_A_disable_interface_1(SI32_EMIF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EMIF_A_disable_interface_1(basePointer)
 #define SI32_EMIF_A_disable_interface_1(basePointer) \
@@ -142,8 +211,19 @@ _SI32_EMIF_A_disable_interface_1(SI32_EMIF_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EMIF_A_enable_interface_1(
+   SI32_EMIF_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_EMIF_A_CONTROL_IF1EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EMIF_A_enable_interface_1(SI32_EMIF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EMIF_A_enable_interface_1(basePointer)
 #define SI32_EMIF_A_enable_interface_1(basePointer) \
@@ -158,8 +238,19 @@ _SI32_EMIF_A_enable_interface_1(SI32_EMIF_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_EMIF_A_is_interface_0_active(
+   SI32_EMIF_A_Type * basePointer)
+{
+   //{{
+  return (bool)basePointer->CONTROL.IF0EN;
+   //}}
+}
+#else
 bool
 _SI32_EMIF_A_is_interface_0_active(SI32_EMIF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EMIF_A_is_interface_0_active(basePointer)
 #define SI32_EMIF_A_is_interface_0_active(basePointer) \
@@ -174,8 +265,19 @@ _SI32_EMIF_A_is_interface_0_active(SI32_EMIF_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_EMIF_A_is_interface_1_active(
+   SI32_EMIF_A_Type * basePointer)
+{
+   //{{
+  return (bool)basePointer->CONTROL.IF1EN;
+   //}}
+}
+#else
 bool
 _SI32_EMIF_A_is_interface_1_active(SI32_EMIF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EMIF_A_is_interface_1_active(basePointer)
 #define SI32_EMIF_A_is_interface_1_active(basePointer) \
@@ -187,8 +289,19 @@ _SI32_EMIF_A_is_interface_1_active(SI32_EMIF_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EMIF_A_enable_off_state(
+   SI32_EMIF_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_EMIF_A_CONTROL_OFFSTEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EMIF_A_enable_off_state(SI32_EMIF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EMIF_A_enable_off_state(basePointer)
 #define SI32_EMIF_A_enable_off_state(basePointer) \
@@ -200,8 +313,19 @@ _SI32_EMIF_A_enable_off_state(SI32_EMIF_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EMIF_A_disable_off_state(
+   SI32_EMIF_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EMIF_A_CONTROL_OFFSTEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EMIF_A_disable_off_state(SI32_EMIF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EMIF_A_disable_off_state(basePointer)
 #define SI32_EMIF_A_disable_off_state(basePointer) \
@@ -216,8 +340,19 @@ _SI32_EMIF_A_disable_off_state(SI32_EMIF_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_EMIF_A_is_off(
+   SI32_EMIF_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->STATUS.OFFSTS);
+   //}}
+}
+#else
 bool
 _SI32_EMIF_A_is_off(SI32_EMIF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EMIF_A_is_off(basePointer)
 #define SI32_EMIF_A_is_off(basePointer) \
@@ -232,8 +367,19 @@ _SI32_EMIF_A_is_off(SI32_EMIF_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_EMIF_A_is_idle(
+   SI32_EMIF_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->STATUS.IDLESTS);
+   //}}
+}
+#else
 bool
 _SI32_EMIF_A_is_idle(SI32_EMIF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EMIF_A_is_idle(basePointer)
 #define SI32_EMIF_A_is_idle(basePointer) \
@@ -248,8 +394,21 @@ _SI32_EMIF_A_is_idle(SI32_EMIF_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_EMIF_A_is_running(
+   SI32_EMIF_A_Type * basePointer)
+{
+   //{{
+   return (bool)!(basePointer->STATUS.U32
+                  & (SI32_EMIF_A_STATUS_IDLESTS_MASK
+                     | SI32_EMIF_A_STATUS_OFFSTS_MASK));
+   //}}
+}
+#else
 bool
 _SI32_EMIF_A_is_running(SI32_EMIF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EMIF_A_is_running(basePointer)
 #define SI32_EMIF_A_is_running(basePointer) \
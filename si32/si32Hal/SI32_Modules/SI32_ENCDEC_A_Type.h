@@ -51,9 +51,22 @@ extern "C" {
 ///  Valid range is 32 bits.
 ///  Write to CONTROL register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_initialize(
+   SI32_ENCDEC_A_Type * basePointer,
+   // Write to CONTROL register.
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_initialize(SI32_ENCDEC_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_initialize(basePointer, control)
 #define SI32_ENCDEC_A_initialize(basePointer, control) \
@@ -73,9 +86,21 @@ _SI32_ENCDEC_A_initialize(SI32_ENCDEC_A_Type* /*basePointer*/,
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_write_control(
+   SI32_ENCDEC_A_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_write_control(SI32_ENCDEC_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_write_control(basePointer, control)
 #define SI32_ENCDEC_A_write_control(basePointer, control) \
@@ -90,8 +115,19 @@ _SI32_ENCDEC_A_write_control(SI32_ENCDEC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_ENCDEC_A_read_control(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_ENCDEC_A_read_control(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_read_control(basePointer)
 #define SI32_ENCDEC_A_read_control(basePointer) \
@@ -103,8 +139,19 @@ _SI32_ENCDEC_A_read_control(SI32_ENCDEC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_enable_input_ready_interrupt(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_ENCDEC_A_CONTROL_INRDYIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_enable_input_ready_interrupt(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_enable_input_ready_interrupt(basePointer)
 #define SI32_ENCDEC_A_enable_input_ready_interrupt(basePointer) \
@@ -116,8 +163,19 @@ _SI32_ENCDEC_A_enable_input_ready_interrupt(SI32_ENCDEC_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_disable_input_ready_interrupt(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_ENCDEC_A_CONTROL_INRDYIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_disable_input_ready_interrupt(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_disable_input_ready_interrupt(basePointer)
 #define SI32_ENCDEC_A_disable_input_ready_interrupt(basePointer) \
@@ -129,8 +187,19 @@ _SI32_ENCDEC_A_disable_input_ready_interrupt(SI32_ENCDEC_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_ENCDEC_A_is_input_ready_interrupt_enabled(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.INRDYIEN;
+   //}}
+}
+#else
 bool
 _SI32_ENCDEC_A_is_input_ready_interrupt_enabled(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_is_input_ready_interrupt_enabled(basePointer)
 #define SI32_ENCDEC_A_is_input_ready_interrupt_enabled(basePointer) \
@@ -142,8 +211,19 @@ _SI32_ENCDEC_A_is_input_ready_interrupt_enabled(SI32_ENCDEC_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_enable_output_ready_interrupt(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_ENCDEC_A_CONTROL_ORDYIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_enable_output_ready_interrupt(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_enable_output_ready_interrupt(basePointer)
 #define SI32_ENCDEC_A_enable_output_ready_interrupt(basePointer) \
@@ -155,8 +235,19 @@ _SI32_ENCDEC_A_enable_output_ready_interrupt(SI32_ENCDEC_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_disable_output_ready_interrupt(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_ENCDEC_A_CONTROL_ORDYIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_disable_output_ready_interrupt(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_disable_output_ready_interrupt(basePointer)
 #define SI32_ENCDEC_A_disable_output_ready_interrupt(basePointer) \
@@ -168,8 +259,19 @@ _SI32_ENCDEC_A_disable_output_ready_interrupt(SI32_ENCDEC_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_ENCDEC_A_is_output_ready_interrupt_enabled(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.ORDYIEN;
+   //}}
+}
+#else
 bool
 _SI32_ENCDEC_A_is_output_ready_interrupt_enabled(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_is_output_ready_interrupt_enabled(basePointer)
 #define SI32_ENCDEC_A_is_output_ready_interrupt_enabled(basePointer) \
@@ -181,8 +283,19 @@ _SI32_ENCDEC_A_is_output_ready_interrupt_enabled(SI32_ENCDEC_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_enable_error_interrupt(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_ENCDEC_A_CONTROL_ERRIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_enable_error_interrupt(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_enable_error_interrupt(basePointer)
 #define SI32_ENCDEC_A_enable_error_interrupt(basePointer) \
@@ -194,8 +307,19 @@ _SI32_ENCDEC_A_enable_error_interrupt(SI32_ENCDEC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_disable_error_interrupt(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_ENCDEC_A_CONTROL_ERRIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_disable_error_interrupt(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_disable_error_interrupt(basePointer)
 #define SI32_ENCDEC_A_disable_error_interrupt(basePointer) \
@@ -207,8 +331,19 @@ _SI32_ENCDEC_A_disable_error_interrupt(SI32_ENCDEC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_ENCDEC_A_is_error_interrupt_enabled(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.ERRIEN;
+   //}}
+}
+#else
 bool
 _SI32_ENCDEC_A_is_error_interrupt_enabled(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_is_error_interrupt_enabled(basePointer)
 #define SI32_ENCDEC_A_is_error_interrupt_enabled(basePointer) \
@@ -220,8 +355,19 @@ _SI32_ENCDEC_A_is_error_interrupt_enabled(SI32_ENCDEC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_reset_module(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_ENCDEC_A_CONTROL_RESET_ACTIVE_U32;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_reset_module(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_reset_module(basePointer)
 #define SI32_ENCDEC_A_reset_module(basePointer) \
@@ -233,8 +379,19 @@ _SI32_ENCDEC_A_reset_module(SI32_ENCDEC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_select_manchester_output_size_small(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_ENCDEC_A_CONTROL_MOSIZE_MASK;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_select_manchester_output_size_small(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_select_manchester_output_size_small(basePointer)
 #define SI32_ENCDEC_A_select_manchester_output_size_small(basePointer) \
@@ -246,8 +403,19 @@ _SI32_ENCDEC_A_select_manchester_output_size_small(SI32_ENCDEC_A_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_select_manchester_output_size_large(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_ENCDEC_A_CONTROL_MOSIZE_LARGE_U32;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_select_manchester_output_size_large(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_select_manchester_output_size_large(basePointer)
 #define SI32_ENCDEC_A_select_manchester_output_size_large(basePointer) \
@@ -259,8 +427,19 @@ _SI32_ENCDEC_A_select_manchester_output_size_large(SI32_ENCDEC_A_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_select_encode_mode(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_ENCDEC_A_CONTROL_EDMD_ENCODE_U32;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_select_encode_mode(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_select_encode_mode(basePointer)
 #define SI32_ENCDEC_A_select_encode_mode(basePointer) \
@@ -272,8 +451,19 @@ _SI32_ENCDEC_A_select_encode_mode(SI32_ENCDEC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_select_decode_mode(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_ENCDEC_A_CONTROL_EDMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_select_decode_mode(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_select_decode_mode(basePointer)
 #define SI32_ENCDEC_A_select_decode_mode(basePointer) \
@@ -285,8 +475,19 @@ _SI32_ENCDEC_A_select_decode_mode(SI32_ENCDEC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_select_manchester_mode(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_ENCDEC_A_CONTROL_OPMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_select_manchester_mode(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_select_manchester_mode(basePointer)
 #define SI32_ENCDEC_A_select_manchester_mode(basePointer) \
@@ -298,8 +499,19 @@ _SI32_ENCDEC_A_select_manchester_mode(SI32_ENCDEC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_select_three_out_of_six_mode(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_ENCDEC_A_CONTROL_OPMD_3OUTOF6_U32;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_select_three_out_of_six_mode(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_select_three_out_of_six_mode(basePointer)
 #define SI32_ENCDEC_A_select_three_out_of_six_mode(basePointer) \
@@ -311,8 +523,19 @@ _SI32_ENCDEC_A_select_three_out_of_six_mode(SI32_ENCDEC_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_enter_bypass_mode(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_ENCDEC_A_CONTROL_BEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_enter_bypass_mode(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_enter_bypass_mode(basePointer)
 #define SI32_ENCDEC_A_enter_bypass_mode(basePointer) \
@@ -324,8 +547,19 @@ _SI32_ENCDEC_A_enter_bypass_mode(SI32_ENCDEC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_exit_bypass_mode(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_ENCDEC_A_CONTROL_BEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_exit_bypass_mode(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_exit_bypass_mode(basePointer)
 #define SI32_ENCDEC_A_exit_bypass_mode(basePointer) \
@@ -337,8 +571,19 @@ _SI32_ENCDEC_A_exit_bypass_mode(SI32_ENCDEC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_enable_dma_mode(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_ENCDEC_A_CONTROL_DMAEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_enable_dma_mode(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_enable_dma_mode(basePointer)
 #define SI32_ENCDEC_A_enable_dma_mode(basePointer) \
@@ -350,8 +595,19 @@ _SI32_ENCDEC_A_enable_dma_mode(SI32_ENCDEC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_disable_dma_mode(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_ENCDEC_A_CONTROL_DMAEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_disable_dma_mode(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_disable_dma_mode(basePointer)
 #define SI32_ENCDEC_A_disable_dma_mode(basePointer) \
@@ -363,8 +619,19 @@ _SI32_ENCDEC_A_disable_dma_mode(SI32_ENCDEC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_enable_stall_in_debug_mode(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_ENCDEC_A_CONTROL_DBGMD_HALT_U32;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_enable_stall_in_debug_mode(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_enable_stall_in_debug_mode(basePointer)
 #define SI32_ENCDEC_A_enable_stall_in_debug_mode(basePointer) \
@@ -376,8 +643,19 @@ _SI32_ENCDEC_A_enable_stall_in_debug_mode(SI32_ENCDEC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_disable_stall_in_debug_mode(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_ENCDEC_A_CONTROL_DBGMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_disable_stall_in_debug_mode(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_disable_stall_in_debug_mode(basePointer)
 #define SI32_ENCDEC_A_disable_stall_in_debug_mode(basePointer) \
@@ -389,8 +667,19 @@ _SI32_ENCDEC_A_disable_stall_in_debug_mode(SI32_ENCDEC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_select_output_order_no_change(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_ENCDEC_A_CONTROL_OORDER_MASK;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_select_output_order_no_change(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_select_output_order_no_change(basePointer)
 #define SI32_ENCDEC_A_select_output_order_no_change(basePointer) \
@@ -402,8 +691,20 @@ _SI32_ENCDEC_A_select_output_order_no_change(SI32_ENCDEC_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_select_output_order_flip_half_word(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_ENCDEC_A_CONTROL_OORDER_MASK;
+   basePointer->CONTROL_SET = SI32_ENCDEC_A_CONTROL_OORDER_HALF_WORD_U32;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_select_output_order_flip_half_word(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_select_output_order_flip_half_word(basePointer)
 #define SI32_ENCDEC_A_select_output_order_flip_half_word(basePointer) do{  \
@@ -417,8 +718,20 @@ _SI32_ENCDEC_A_select_output_order_flip_half_word(SI32_ENCDEC_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_select_output_order_flip_word(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_ENCDEC_A_CONTROL_OORDER_MASK;
+   basePointer->CONTROL_SET = SI32_ENCDEC_A_CONTROL_OORDER_WORD_U32;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_select_output_order_flip_word(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_select_output_order_flip_word(basePointer)
 #define SI32_ENCDEC_A_select_output_order_flip_word(basePointer) do{  \
@@ -432,8 +745,20 @@ _SI32_ENCDEC_A_select_output_order_flip_word(SI32_ENCDEC_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_select_output_order_flip_lower_three_bytes(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_ENCDEC_A_CONTROL_OORDER_MASK;
+   basePointer->CONTROL_SET = SI32_ENCDEC_A_CONTROL_OORDER_LOWER_THREE_BYTES_U32;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_select_output_order_flip_lower_three_bytes(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_select_output_order_flip_lower_three_bytes(basePointer)
 #define SI32_ENCDEC_A_select_output_order_flip_lower_three_bytes(basePointer) do{  \
@@ -447,8 +772,19 @@ _SI32_ENCDEC_A_select_output_order_flip_lower_three_bytes(SI32_ENCDEC_A_Type* /*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_select_input_order_no_change(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_ENCDEC_A_CONTROL_IORDER_MASK;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_select_input_order_no_change(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_select_input_order_no_change(basePointer)
 #define SI32_ENCDEC_A_select_input_order_no_change(basePointer) \
@@ -460,8 +796,20 @@ _SI32_ENCDEC_A_select_input_order_no_change(SI32_ENCDEC_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_select_input_order_flip_half_word(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_ENCDEC_A_CONTROL_IORDER_MASK;
+   basePointer->CONTROL_SET = SI32_ENCDEC_A_CONTROL_IORDER_HALF_WORD_U32;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_select_input_order_flip_half_word(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_select_input_order_flip_half_word(basePointer)
 #define SI32_ENCDEC_A_select_input_order_flip_half_word(basePointer) do{  \
@@ -475,8 +823,20 @@ _SI32_ENCDEC_A_select_input_order_flip_half_word(SI32_ENCDEC_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_select_input_order_flip_word(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_ENCDEC_A_CONTROL_IORDER_MASK;
+   basePointer->CONTROL_SET = SI32_ENCDEC_A_CONTROL_IORDER_WORD_U32;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_select_input_order_flip_word(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_select_input_order_flip_word(basePointer)
 #define SI32_ENCDEC_A_select_input_order_flip_word(basePointer) do{  \
@@ -490,8 +850,20 @@ _SI32_ENCDEC_A_select_input_order_flip_word(SI32_ENCDEC_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_select_input_order_flip_lower_three_bytes(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_ENCDEC_A_CONTROL_IORDER_MASK;
+   basePointer->CONTROL_SET = SI32_ENCDEC_A_CONTROL_IORDER_LOWER_THREE_BYTES_U32;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_select_input_order_flip_lower_three_bytes(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_select_input_order_flip_lower_three_bytes(basePointer)
 #define SI32_ENCDEC_A_select_input_order_flip_lower_three_bytes(basePointer) do{  \
@@ -513,9 +885,21 @@ _SI32_ENCDEC_A_select_input_order_flip_lower_three_bytes(SI32_ENCDEC_A_Type* /*b
 ///  status
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_write_status(
+   SI32_ENCDEC_A_Type * basePointer,
+   uint32_t status)
+{
+   //{{
+   basePointer->STATUS.U32 = status;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_write_status(SI32_ENCDEC_A_Type* /*basePointer*/,
    uint32_t /*status*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_write_status(basePointer, status)
 #define SI32_ENCDEC_A_write_status(basePointer, status) \
@@ -530,8 +914,19 @@ _SI32_ENCDEC_A_write_status(SI32_ENCDEC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_ENCDEC_A_read_status(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_ENCDEC_A_read_status(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_read_status(basePointer)
 #define SI32_ENCDEC_A_read_status(basePointer) \
@@ -543,8 +938,19 @@ _SI32_ENCDEC_A_read_status(SI32_ENCDEC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_ENCDEC_A_is_input_ready_interrupt_pending(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.INRDYI;
+   //}}
+}
+#else
 bool
 _SI32_ENCDEC_A_is_input_ready_interrupt_pending(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_is_input_ready_interrupt_pending(basePointer)
 #define SI32_ENCDEC_A_is_input_ready_interrupt_pending(basePointer) \
@@ -556,8 +962,19 @@ _SI32_ENCDEC_A_is_input_ready_interrupt_pending(SI32_ENCDEC_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_ENCDEC_A_is_output_ready_interrupt_pending(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.ORDYI;
+   //}}
+}
+#else
 bool
 _SI32_ENCDEC_A_is_output_ready_interrupt_pending(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_is_output_ready_interrupt_pending(basePointer)
 #define SI32_ENCDEC_A_is_output_ready_interrupt_pending(basePointer) \
@@ -569,8 +986,19 @@ _SI32_ENCDEC_A_is_output_ready_interrupt_pending(SI32_ENCDEC_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_ENCDEC_A_is_error_interrupt_flag_pending(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.DERRI;
+   //}}
+}
+#else
 bool
 _SI32_ENCDEC_A_is_error_interrupt_flag_pending(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_is_error_interrupt_flag_pending(basePointer)
 #define SI32_ENCDEC_A_is_error_interrupt_flag_pending(basePointer) \
@@ -582,8 +1010,19 @@ _SI32_ENCDEC_A_is_error_interrupt_flag_pending(SI32_ENCDEC_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_clear_error_interrupt_flag(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS.DERRI = SI32_ENCDEC_A_STATUS_DERRI_NOT_SET_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_clear_error_interrupt_flag(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_clear_error_interrupt_flag(basePointer)
 #define SI32_ENCDEC_A_clear_error_interrupt_flag(basePointer) \
@@ -595,8 +1034,19 @@ _SI32_ENCDEC_A_clear_error_interrupt_flag(SI32_ENCDEC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_ENCDEC_A_is_data_underrun_flag_pending(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.DURI;
+   //}}
+}
+#else
 bool
 _SI32_ENCDEC_A_is_data_underrun_flag_pending(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_is_data_underrun_flag_pending(basePointer)
 #define SI32_ENCDEC_A_is_data_underrun_flag_pending(basePointer) \
@@ -608,8 +1058,19 @@ _SI32_ENCDEC_A_is_data_underrun_flag_pending(SI32_ENCDEC_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_clear_data_underrun_flag(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS.DURI = SI32_ENCDEC_A_STATUS_DURI_NOT_SET_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_clear_data_underrun_flag(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_clear_data_underrun_flag(basePointer)
 #define SI32_ENCDEC_A_clear_data_underrun_flag(basePointer) \
@@ -621,8 +1082,19 @@ _SI32_ENCDEC_A_clear_data_underrun_flag(SI32_ENCDEC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_ENCDEC_A_is_data_overrun_flag_pending(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.DORI;
+   //}}
+}
+#else
 bool
 _SI32_ENCDEC_A_is_data_overrun_flag_pending(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_is_data_overrun_flag_pending(basePointer)
 #define SI32_ENCDEC_A_is_data_overrun_flag_pending(basePointer) \
@@ -634,8 +1106,19 @@ _SI32_ENCDEC_A_is_data_overrun_flag_pending(SI32_ENCDEC_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_clear_data_overrun_flag(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS.DORI = SI32_ENCDEC_A_STATUS_DORI_NOT_SET_VALUE;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_clear_data_overrun_flag(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_clear_data_overrun_flag(basePointer)
 #define SI32_ENCDEC_A_clear_data_overrun_flag(basePointer) \
@@ -655,9 +1138,21 @@ _SI32_ENCDEC_A_clear_data_overrun_flag(SI32_ENCDEC_A_Type* /*basePointer*/);
 ///  datain
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_write_datain_u32(
+   SI32_ENCDEC_A_Type * basePointer,
+   uint32_t datain)
+{
+   //{{
+   basePointer->DATAIN.U32 = datain;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_write_datain_u32(SI32_ENCDEC_A_Type* /*basePointer*/,
    uint32_t /*datain*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_write_datain_u32(basePointer, datain)
 #define SI32_ENCDEC_A_write_datain_u32(basePointer, datain) \
@@ -674,9 +1169,22 @@ _SI32_ENCDEC_A_write_datain_u32(SI32_ENCDEC_A_Type* /*basePointer*/,
 ///  datain
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_write_datain_u16(
+   SI32_ENCDEC_A_Type * basePointer,
+   uwide16_t datain)
+{
+   assert(datain < 65536);   // datain < 2^16
+   //{{
+   basePointer->DATAIN.U16 = datain;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_write_datain_u16(SI32_ENCDEC_A_Type* /*basePointer*/,
    uwide16_t /*datain*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_write_datain_u16(basePointer, datain)
 #define SI32_ENCDEC_A_write_datain_u16(basePointer, datain) \
@@ -693,9 +1201,22 @@ _SI32_ENCDEC_A_write_datain_u16(SI32_ENCDEC_A_Type* /*basePointer*/,
 ///  datain
 ///  Valid range is 8 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_ENCDEC_A_write_datain_u8(
+   SI32_ENCDEC_A_Type * basePointer,
+   uwide8_t datain)
+{
+   assert(datain < 256);   // datain < 2^8
+   //{{
+   basePointer->DATAIN.U8 = datain;
+   //}}
+}
+#else
 void
 _SI32_ENCDEC_A_write_datain_u8(SI32_ENCDEC_A_Type* /*basePointer*/,
    uwide8_t /*datain*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_write_datain_u8(basePointer, datain)
 #define SI32_ENCDEC_A_write_datain_u8(basePointer, datain) \
@@ -710,8 +1231,19 @@ _SI32_ENCDEC_A_write_datain_u8(SI32_ENCDEC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_ENCDEC_A_read_dataout_u32(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DATAOUT.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_ENCDEC_A_read_dataout_u32(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_read_dataout_u32(basePointer)
 #define SI32_ENCDEC_A_read_dataout_u32(basePointer) \
@@ -723,8 +1255,19 @@ _SI32_ENCDEC_A_read_dataout_u32(SI32_ENCDEC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint16_t
+_SI32_ENCDEC_A_read_dataout_u16(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DATAOUT.U16;
+   //}}
+}
+#else
 uint16_t
 _SI32_ENCDEC_A_read_dataout_u16(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_read_dataout_u16(basePointer)
 #define SI32_ENCDEC_A_read_dataout_u16(basePointer) \
@@ -736,8 +1279,19 @@ _SI32_ENCDEC_A_read_dataout_u16(SI32_ENCDEC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint8_t
+_SI32_ENCDEC_A_read_dataout_u8(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DATAOUT.U8;
+   //}}
+}
+#else
 uint8_t
 _SI32_ENCDEC_A_read_dataout_u8(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_read_dataout_u8(basePointer)
 #define SI32_ENCDEC_A_read_dataout_u8(basePointer) \
@@ -752,8 +1306,19 @@ _SI32_ENCDEC_A_read_dataout_u8(SI32_ENCDEC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_ENCDEC_A_read_dataoutc_u32(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DATAOUTC.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_ENCDEC_A_read_dataoutc_u32(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_read_dataoutc_u32(basePointer)
 #define SI32_ENCDEC_A_read_dataoutc_u32(basePointer) \
@@ -765,8 +1330,19 @@ _SI32_ENCDEC_A_read_dataoutc_u32(SI32_ENCDEC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint16_t
+_SI32_ENCDEC_A_read_dataoutc_u16(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DATAOUTC.U16;
+   //}}
+}
+#else
 uint16_t
 _SI32_ENCDEC_A_read_dataoutc_u16(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_read_dataoutc_u16(basePointer)
 #define SI32_ENCDEC_A_read_dataoutc_u16(basePointer) \
@@ -778,8 +1354,19 @@ _SI32_ENCDEC_A_read_dataoutc_u16(SI32_ENCDEC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint8_t
+_SI32_ENCDEC_A_read_dataoutc_u8(
+   SI32_ENCDEC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DATAOUTC.U8;
+   //}}
+}
+#else
 uint8_t
 _SI32_ENCDEC_A_read_dataoutc_u8(SI32_ENCDEC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_ENCDEC_A_read_dataoutc_u8(basePointer)
 #define SI32_ENCDEC_A_read_dataoutc_u8(basePointer) \
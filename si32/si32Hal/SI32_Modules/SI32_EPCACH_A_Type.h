@@ -69,12 +69,34 @@ extern "C" {
 ///  Valid range is 32 bits.
 ///  Write to CCAPVUPD register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_initialize(
+   SI32_EPCACH_A_Type * basePointer,
+   // Write to MODE register.
+   uint32_t mode,
+   // Write to CONTROL register.
+   uint32_t control,
+   // Write to CCAPV register.
+   uint32_t ccapv,
+   // Write to CCAPVUPD register.
+   uint32_t ccapvupd)
+{
+   //{{
+   basePointer->MODE.U32 = mode;
+   basePointer->CONTROL.U32 = control;
+   basePointer->CCAPV.U32 = ccapv;
+   basePointer->CCAPVUPD.U32 = ccapvupd;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_initialize(SI32_EPCACH_A_Type* /*basePointer*/,
    uint32_t, /*mode*/
    uint32_t, /*control*/
    uint32_t, /*ccapv*/
    uint32_t /*ccapvupd*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_initialize(basePointer, mode, control, ccapv, ccapvupd)
 #define SI32_EPCACH_A_initialize(basePointer, mode, control, ccapv, ccapvupd) do{  \
@@ -98,9 +120,21 @@ _SI32_EPCACH_A_initialize(SI32_EPCACH_A_Type* /*basePointer*/,
 ///  mode
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_write_mode(
+   SI32_EPCACH_A_Type * basePointer,
+   uint32_t mode)
+{
+   //{{
+   basePointer->MODE.U32 = mode;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_write_mode(SI32_EPCACH_A_Type* /*basePointer*/,
    uint32_t /*mode*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_write_mode(basePointer, mode)
 #define SI32_EPCACH_A_write_mode(basePointer, mode) \
@@ -115,8 +149,19 @@ _SI32_EPCACH_A_write_mode(SI32_EPCACH_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_EPCACH_A_read_mode(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   return basePointer->MODE.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_EPCACH_A_read_mode(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_read_mode(basePointer)
 #define SI32_EPCACH_A_read_mode(basePointer) \
@@ -131,8 +176,19 @@ _SI32_EPCACH_A_read_mode(SI32_EPCACH_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_select_output_mode_toggle(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.COSEL = SI32_EPCACH_A_MODE_COSEL_TOGGLE_OUTPUT_VALUE;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_select_output_mode_toggle(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_select_output_mode_toggle(basePointer)
 #define SI32_EPCACH_A_select_output_mode_toggle(basePointer) \
@@ -147,8 +203,19 @@ _SI32_EPCACH_A_select_output_mode_toggle(SI32_EPCACH_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_select_output_mode_set(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.COSEL = SI32_EPCACH_A_MODE_COSEL_SET_OUTPUT_VALUE;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_select_output_mode_set(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_select_output_mode_set(basePointer)
 #define SI32_EPCACH_A_select_output_mode_set(basePointer) \
@@ -163,8 +230,19 @@ _SI32_EPCACH_A_select_output_mode_set(SI32_EPCACH_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_select_output_mode_clear(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.COSEL = SI32_EPCACH_A_MODE_COSEL_CLEAR_OUTPUT_VALUE;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_select_output_mode_clear(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_select_output_mode_clear(basePointer)
 #define SI32_EPCACH_A_select_output_mode_clear(basePointer) \
@@ -179,8 +257,19 @@ _SI32_EPCACH_A_select_output_mode_clear(SI32_EPCACH_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_select_output_mode_none(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.COSEL = SI32_EPCACH_A_MODE_COSEL_NO_CHANGE_VALUE;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_select_output_mode_none(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_select_output_mode_none(basePointer)
 #define SI32_EPCACH_A_select_output_mode_none(basePointer) \
@@ -202,9 +291,22 @@ _SI32_EPCACH_A_select_output_mode_none(SI32_EPCACH_A_Type* /*basePointer*/);
 ///  nbits
 ///  Valid range is 4 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_set_width_for_n_bit_edge_aligned_pwm_mode(
+   SI32_EPCACH_A_Type * basePointer,
+   uint32_t nbits)
+{
+   assert(nbits < 16);   // nbits < 2^4
+   //{{
+   basePointer->MODE.PWMMD = nbits;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_set_width_for_n_bit_edge_aligned_pwm_mode(SI32_EPCACH_A_Type* /*basePointer*/,
    uint32_t /*nbits*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_set_width_for_n_bit_edge_aligned_pwm_mode(basePointer, nbits)
 #define SI32_EPCACH_A_set_width_for_n_bit_edge_aligned_pwm_mode(basePointer, nbits) \
@@ -216,8 +318,19 @@ _SI32_EPCACH_A_set_width_for_n_bit_edge_aligned_pwm_mode(SI32_EPCACH_A_Type* /*b
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_enable_differential_signal_generator(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.DIFGEN = SI32_EPCACH_A_MODE_DIFGEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_enable_differential_signal_generator(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_enable_differential_signal_generator(basePointer)
 #define SI32_EPCACH_A_enable_differential_signal_generator(basePointer) \
@@ -229,8 +342,19 @@ _SI32_EPCACH_A_enable_differential_signal_generator(SI32_EPCACH_A_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_disable_differential_signal_generator(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.DIFGEN = SI32_EPCACH_A_MODE_DIFGEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_disable_differential_signal_generator(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_disable_differential_signal_generator(basePointer)
 #define SI32_EPCACH_A_disable_differential_signal_generator(basePointer) \
@@ -245,8 +369,19 @@ _SI32_EPCACH_A_disable_differential_signal_generator(SI32_EPCACH_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_select_operating_mode_edge_aligned_pwm(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.CMD = SI32_EPCACH_A_MODE_CMD_EDGE_PWM_VALUE;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_select_operating_mode_edge_aligned_pwm(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_select_operating_mode_edge_aligned_pwm(basePointer)
 #define SI32_EPCACH_A_select_operating_mode_edge_aligned_pwm(basePointer) \
@@ -261,8 +396,19 @@ _SI32_EPCACH_A_select_operating_mode_edge_aligned_pwm(SI32_EPCACH_A_Type* /*base
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_select_operating_mode_center_aligned_pwm(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.CMD = SI32_EPCACH_A_MODE_CMD_CENTER_ALIGNED_PWM_VALUE;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_select_operating_mode_center_aligned_pwm(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_select_operating_mode_center_aligned_pwm(basePointer)
 #define SI32_EPCACH_A_select_operating_mode_center_aligned_pwm(basePointer) \
@@ -277,8 +423,19 @@ _SI32_EPCACH_A_select_operating_mode_center_aligned_pwm(SI32_EPCACH_A_Type* /*ba
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_select_operating_mode_high_frequency_square_wave(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.CMD = SI32_EPCACH_A_MODE_CMD_HF_SQUARE_WAVE_VALUE;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_select_operating_mode_high_frequency_square_wave(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_select_operating_mode_high_frequency_square_wave(basePointer)
 #define SI32_EPCACH_A_select_operating_mode_high_frequency_square_wave(basePointer) \
@@ -293,8 +450,19 @@ _SI32_EPCACH_A_select_operating_mode_high_frequency_square_wave(SI32_EPCACH_A_Ty
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_select_operating_mode_timer_capture(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.CMD = SI32_EPCACH_A_MODE_CMD_TIMER_CAPTURE_VALUE;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_select_operating_mode_timer_capture(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_select_operating_mode_timer_capture(basePointer)
 #define SI32_EPCACH_A_select_operating_mode_timer_capture(basePointer) \
@@ -309,8 +477,19 @@ _SI32_EPCACH_A_select_operating_mode_timer_capture(SI32_EPCACH_A_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_select_operating_mode_n_bit_edge_aligned_pwm(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.CMD = SI32_EPCACH_A_MODE_CMD_N_BIT_PWM_VALUE;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_select_operating_mode_n_bit_edge_aligned_pwm(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_select_operating_mode_n_bit_edge_aligned_pwm(basePointer)
 #define SI32_EPCACH_A_select_operating_mode_n_bit_edge_aligned_pwm(basePointer) \
@@ -330,9 +509,21 @@ _SI32_EPCACH_A_select_operating_mode_n_bit_edge_aligned_pwm(SI32_EPCACH_A_Type*
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_write_control(
+   SI32_EPCACH_A_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_write_control(SI32_EPCACH_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_write_control(basePointer, control)
 #define SI32_EPCACH_A_write_control(basePointer, control) \
@@ -347,8 +538,19 @@ _SI32_EPCACH_A_write_control(SI32_EPCACH_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_EPCACH_A_read_control(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_EPCACH_A_read_control(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_read_control(basePointer)
 #define SI32_EPCACH_A_read_control(basePointer) \
@@ -360,8 +562,19 @@ _SI32_EPCACH_A_read_control(SI32_EPCACH_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_clear_output_state(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EPCACH_A_CONTROL_COUTST_MASK;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_clear_output_state(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_clear_output_state(basePointer)
 #define SI32_EPCACH_A_clear_output_state(basePointer) \
@@ -373,8 +586,19 @@ _SI32_EPCACH_A_clear_output_state(SI32_EPCACH_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_set_output_state(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_EPCACH_A_CONTROL_COUTST_HIGH_U32;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_set_output_state(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_set_output_state(basePointer)
 #define SI32_EPCACH_A_set_output_state(basePointer) \
@@ -389,8 +613,19 @@ _SI32_EPCACH_A_set_output_state(SI32_EPCACH_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_EPCACH_A_get_output_state(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.COUTST);
+   //}}
+}
+#else
 bool
 _SI32_EPCACH_A_get_output_state(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_get_output_state(basePointer)
 #define SI32_EPCACH_A_get_output_state(basePointer) \
@@ -402,8 +637,19 @@ _SI32_EPCACH_A_get_output_state(SI32_EPCACH_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_enable_positive_edge_input_capture(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_EPCACH_A_CONTROL_CPCAPEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_enable_positive_edge_input_capture(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_enable_positive_edge_input_capture(basePointer)
 #define SI32_EPCACH_A_enable_positive_edge_input_capture(basePointer) \
@@ -415,8 +661,19 @@ _SI32_EPCACH_A_enable_positive_edge_input_capture(SI32_EPCACH_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_disable_positive_edge_input_capture(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EPCACH_A_CONTROL_CPCAPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_disable_positive_edge_input_capture(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_disable_positive_edge_input_capture(basePointer)
 #define SI32_EPCACH_A_disable_positive_edge_input_capture(basePointer) \
@@ -428,8 +685,19 @@ _SI32_EPCACH_A_disable_positive_edge_input_capture(SI32_EPCACH_A_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_enable_negative_edge_input_capture(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_EPCACH_A_CONTROL_CNCAPEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_enable_negative_edge_input_capture(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_enable_negative_edge_input_capture(basePointer)
 #define SI32_EPCACH_A_enable_negative_edge_input_capture(basePointer) \
@@ -441,8 +709,19 @@ _SI32_EPCACH_A_enable_negative_edge_input_capture(SI32_EPCACH_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_disable_negative_edge_input_capture(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EPCACH_A_CONTROL_CNCAPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_disable_negative_edge_input_capture(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_disable_negative_edge_input_capture(basePointer)
 #define SI32_EPCACH_A_disable_negative_edge_input_capture(basePointer) \
@@ -458,8 +737,19 @@ _SI32_EPCACH_A_disable_negative_edge_input_capture(SI32_EPCACH_A_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_EPCACH_A_is_register_update_busy(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.CUPDCF);
+   //}}
+}
+#else
 bool
 _SI32_EPCACH_A_is_register_update_busy(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_is_register_update_busy(basePointer)
 #define SI32_EPCACH_A_is_register_update_busy(basePointer) \
@@ -471,8 +761,19 @@ _SI32_EPCACH_A_is_register_update_busy(SI32_EPCACH_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_select_differential_y_phase_state_low(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EPCACH_A_CONTROL_YPHST_MASK;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_select_differential_y_phase_state_low(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_select_differential_y_phase_state_low(basePointer)
 #define SI32_EPCACH_A_select_differential_y_phase_state_low(basePointer) \
@@ -484,8 +785,19 @@ _SI32_EPCACH_A_select_differential_y_phase_state_low(SI32_EPCACH_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_select_differential_y_phase_state_high(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_EPCACH_A_CONTROL_YPHST_HIGH_U32;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_select_differential_y_phase_state_high(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_select_differential_y_phase_state_high(basePointer)
 #define SI32_EPCACH_A_select_differential_y_phase_state_high(basePointer) \
@@ -497,8 +809,19 @@ _SI32_EPCACH_A_select_differential_y_phase_state_high(SI32_EPCACH_A_Type* /*base
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_select_active_y_phase(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EPCACH_A_CONTROL_ACTIVEPH_MASK;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_select_active_y_phase(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_select_active_y_phase(basePointer)
 #define SI32_EPCACH_A_select_active_y_phase(basePointer) \
@@ -510,8 +833,19 @@ _SI32_EPCACH_A_select_active_y_phase(SI32_EPCACH_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_select_active_x_phase(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_EPCACH_A_CONTROL_ACTIVEPH_XACTIVE_U32;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_select_active_x_phase(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_select_active_x_phase(basePointer)
 #define SI32_EPCACH_A_select_active_x_phase(basePointer) \
@@ -523,8 +857,19 @@ _SI32_EPCACH_A_select_active_x_phase(SI32_EPCACH_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_select_differential_x_phase_state_low(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EPCACH_A_CONTROL_XPHST_MASK;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_select_differential_x_phase_state_low(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_select_differential_x_phase_state_low(basePointer)
 #define SI32_EPCACH_A_select_differential_x_phase_state_low(basePointer) \
@@ -536,8 +881,19 @@ _SI32_EPCACH_A_select_differential_x_phase_state_low(SI32_EPCACH_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_select_differential_x_phase_state_high(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_EPCACH_A_CONTROL_XPHST_HIGH_U32;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_select_differential_x_phase_state_high(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_select_differential_x_phase_state_high(basePointer)
 #define SI32_EPCACH_A_select_differential_x_phase_state_high(basePointer) \
@@ -549,8 +905,19 @@ _SI32_EPCACH_A_select_differential_x_phase_state_high(SI32_EPCACH_A_Type* /*base
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_enable_capture_compare_interrupt(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_EPCACH_A_CONTROL_CCIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_enable_capture_compare_interrupt(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_enable_capture_compare_interrupt(basePointer)
 #define SI32_EPCACH_A_enable_capture_compare_interrupt(basePointer) \
@@ -562,8 +929,19 @@ _SI32_EPCACH_A_enable_capture_compare_interrupt(SI32_EPCACH_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_disable_capture_compare_interrupt(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EPCACH_A_CONTROL_CCIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_disable_capture_compare_interrupt(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_disable_capture_compare_interrupt(basePointer)
 #define SI32_EPCACH_A_disable_capture_compare_interrupt(basePointer) \
@@ -575,8 +953,19 @@ _SI32_EPCACH_A_disable_capture_compare_interrupt(SI32_EPCACH_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_EPCACH_A_is_capture_compare_interrupt_enabled(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.CCIEN);
+   //}}
+}
+#else
 bool
 _SI32_EPCACH_A_is_capture_compare_interrupt_enabled(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_is_capture_compare_interrupt_enabled(basePointer)
 #define SI32_EPCACH_A_is_capture_compare_interrupt_enabled(basePointer) \
@@ -588,8 +977,19 @@ _SI32_EPCACH_A_is_capture_compare_interrupt_enabled(SI32_EPCACH_A_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_enable_capture_compare_dma_request(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_EPCACH_A_CONTROL_CCDEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_enable_capture_compare_dma_request(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_enable_capture_compare_dma_request(basePointer)
 #define SI32_EPCACH_A_enable_capture_compare_dma_request(basePointer) \
@@ -601,8 +1001,19 @@ _SI32_EPCACH_A_enable_capture_compare_dma_request(SI32_EPCACH_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_disable_capture_compare_dma_request(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EPCACH_A_CONTROL_CCDEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_disable_capture_compare_dma_request(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_disable_capture_compare_dma_request(basePointer)
 #define SI32_EPCACH_A_disable_capture_compare_dma_request(basePointer) \
@@ -614,8 +1025,19 @@ _SI32_EPCACH_A_disable_capture_compare_dma_request(SI32_EPCACH_A_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_enable_capture_compare_sync_signal(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_EPCACH_A_CONTROL_CCSEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_enable_capture_compare_sync_signal(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_enable_capture_compare_sync_signal(basePointer)
 #define SI32_EPCACH_A_enable_capture_compare_sync_signal(basePointer) \
@@ -627,8 +1049,19 @@ _SI32_EPCACH_A_enable_capture_compare_sync_signal(SI32_EPCACH_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_disable_capture_compare_sync_signal(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EPCACH_A_CONTROL_CCSEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_disable_capture_compare_sync_signal(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_disable_capture_compare_sync_signal(basePointer)
 #define SI32_EPCACH_A_disable_capture_compare_sync_signal(basePointer) \
@@ -640,8 +1073,19 @@ _SI32_EPCACH_A_disable_capture_compare_sync_signal(SI32_EPCACH_A_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_enable_intermediate_overflow_interrupt(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_EPCACH_A_CONTROL_CIOVFIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_enable_intermediate_overflow_interrupt(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_enable_intermediate_overflow_interrupt(basePointer)
 #define SI32_EPCACH_A_enable_intermediate_overflow_interrupt(basePointer) \
@@ -653,8 +1097,19 @@ _SI32_EPCACH_A_enable_intermediate_overflow_interrupt(SI32_EPCACH_A_Type* /*base
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_disable_intermediate_overflow_interrupt(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EPCACH_A_CONTROL_CIOVFIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_disable_intermediate_overflow_interrupt(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_disable_intermediate_overflow_interrupt(basePointer)
 #define SI32_EPCACH_A_disable_intermediate_overflow_interrupt(basePointer) \
@@ -666,8 +1121,19 @@ _SI32_EPCACH_A_disable_intermediate_overflow_interrupt(SI32_EPCACH_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_EPCACH_A_is_intermediate_overflow_interrupt_enabled(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.CIOVFIEN);
+   //}}
+}
+#else
 bool
 _SI32_EPCACH_A_is_intermediate_overflow_interrupt_enabled(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_is_intermediate_overflow_interrupt_enabled(basePointer)
 #define SI32_EPCACH_A_is_intermediate_overflow_interrupt_enabled(basePointer) \
@@ -679,8 +1145,19 @@ _SI32_EPCACH_A_is_intermediate_overflow_interrupt_enabled(SI32_EPCACH_A_Type* /*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_enable_intermediate_overflow_dma_request(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_EPCACH_A_CONTROL_CIOVFDEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_enable_intermediate_overflow_dma_request(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_enable_intermediate_overflow_dma_request(basePointer)
 #define SI32_EPCACH_A_enable_intermediate_overflow_dma_request(basePointer) \
@@ -692,8 +1169,19 @@ _SI32_EPCACH_A_enable_intermediate_overflow_dma_request(SI32_EPCACH_A_Type* /*ba
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_disable_intermediate_overflow_dma_request(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EPCACH_A_CONTROL_CIOVFDEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_disable_intermediate_overflow_dma_request(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_disable_intermediate_overflow_dma_request(basePointer)
 #define SI32_EPCACH_A_disable_intermediate_overflow_dma_request(basePointer) \
@@ -705,8 +1193,19 @@ _SI32_EPCACH_A_disable_intermediate_overflow_dma_request(SI32_EPCACH_A_Type* /*b
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_enable_intermediate_overflow_sync_signal(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_EPCACH_A_CONTROL_CIOVFSEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_enable_intermediate_overflow_sync_signal(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_enable_intermediate_overflow_sync_signal(basePointer)
 #define SI32_EPCACH_A_enable_intermediate_overflow_sync_signal(basePointer) \
@@ -718,8 +1217,19 @@ _SI32_EPCACH_A_enable_intermediate_overflow_sync_signal(SI32_EPCACH_A_Type* /*ba
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_disable_intermediate_overflow_sync_signal(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EPCACH_A_CONTROL_CIOVFSEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_disable_intermediate_overflow_sync_signal(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_disable_intermediate_overflow_sync_signal(basePointer)
 #define SI32_EPCACH_A_disable_intermediate_overflow_sync_signal(basePointer) \
@@ -739,9 +1249,21 @@ _SI32_EPCACH_A_disable_intermediate_overflow_sync_signal(SI32_EPCACH_A_Type* /*b
 ///  ccapv
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_write_ccapv(
+   SI32_EPCACH_A_Type * basePointer,
+   uint32_t ccapv)
+{
+   //{{
+   basePointer->CCAPV.U32 = ccapv;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_write_ccapv(SI32_EPCACH_A_Type* /*basePointer*/,
    uint32_t /*ccapv*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_write_ccapv(basePointer, ccapv)
 #define SI32_EPCACH_A_write_ccapv(basePointer, ccapv) \
@@ -756,8 +1278,19 @@ _SI32_EPCACH_A_write_ccapv(SI32_EPCACH_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_EPCACH_A_read_ccapv(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CCAPV.CCAPV_BITS;
+   //}}
+}
+#else
 uint32_t
 _SI32_EPCACH_A_read_ccapv(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_read_ccapv(basePointer)
 #define SI32_EPCACH_A_read_ccapv(basePointer) \
@@ -777,9 +1310,21 @@ _SI32_EPCACH_A_read_ccapv(SI32_EPCACH_A_Type* /*basePointer*/);
 ///  ccapvupd
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCACH_A_write_ccapvupd(
+   SI32_EPCACH_A_Type * basePointer,
+   uint32_t ccapvupd)
+{
+   //{{
+   basePointer->CCAPVUPD.U32 = ccapvupd;
+   //}}
+}
+#else
 void
 _SI32_EPCACH_A_write_ccapvupd(SI32_EPCACH_A_Type* /*basePointer*/,
    uint32_t /*ccapvupd*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_write_ccapvupd(basePointer, ccapvupd)
 #define SI32_EPCACH_A_write_ccapvupd(basePointer, ccapvupd) \
@@ -794,8 +1339,19 @@ _SI32_EPCACH_A_write_ccapvupd(SI32_EPCACH_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_EPCACH_A_read_ccapvupd(
+   SI32_EPCACH_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CCAPVUPD.CCAPVUPD_BITS;
+   //}}
+}
+#else
 uint32_t
 _SI32_EPCACH_A_read_ccapvupd(SI32_EPCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCACH_A_read_ccapvupd(basePointer)
 #define SI32_EPCACH_A_read_ccapvupd(basePointer) \
@@ -90,6 +90,33 @@ extern "C" {
 ///  Valid range is 32 bits.
 ///  Writes based on the specified DPTR field in the mode parameter.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_initialize(
+   SI32_EPCA_A_Type * basePointer,
+   // The specified DPTR field is incremented after the function completes.
+   uint32_t mode,
+   uint32_t control,
+   uint32_t status,
+   uint32_t counter,
+   uint32_t limit,
+   uint32_t limitupd,
+   uint32_t dtime,
+   // Writes based on the specified DPTR field in the mode parameter.
+   uint32_t dtarget)
+{
+   //{{
+   basePointer->MODE.U32 = mode;
+   basePointer->CONTROL.U32 = control;
+   basePointer->STATUS.U32 = status;
+   basePointer->COUNTER.U32 = counter;
+   basePointer->LIMIT.U32 = limit;
+   basePointer->LIMITUPD.U32 = limitupd;
+   basePointer->DTIME.U32 = dtime;
+   basePointer->DTARGET.U32 = dtarget;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_initialize(SI32_EPCA_A_Type* /*basePointer*/,
    uint32_t, /*mode*/
@@ -100,6 +127,7 @@ _SI32_EPCA_A_initialize(SI32_EPCA_A_Type* /*basePointer*/,
    uint32_t, /*limitupd*/
    uint32_t, /*dtime*/
    uint32_t /*dtarget*/);
+#endif
 ///
 /// @def SI32_EPCA_A_initialize(basePointer, mode, control, status, counter, limit, limitupd, dtime, dtarget)
 #define SI32_EPCA_A_initialize(basePointer, mode, control, status, counter, limit, limitupd, dtime, dtarget) do{  \
@@ -127,9 +155,21 @@ _SI32_EPCA_A_initialize(SI32_EPCA_A_Type* /*basePointer*/,
 ///  mode
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_write_mode(
+   SI32_EPCA_A_Type * basePointer,
+   uint32_t mode)
+{
+   //{{
+   basePointer->MODE.U32 = mode;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_write_mode(SI32_EPCA_A_Type* /*basePointer*/,
    uint32_t /*mode*/);
+#endif
 ///
 /// @def SI32_EPCA_A_write_mode(basePointer, mode)
 #define SI32_EPCA_A_write_mode(basePointer, mode) \
@@ -144,8 +184,19 @@ _SI32_EPCA_A_write_mode(SI32_EPCA_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_EPCA_A_read_mode(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   return basePointer->MODE.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_EPCA_A_read_mode(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_read_mode(basePointer)
 #define SI32_EPCA_A_read_mode(basePointer) \
@@ -167,9 +218,24 @@ _SI32_EPCA_A_read_mode(SI32_EPCA_A_Type* /*basePointer*/);
 ///  EPCA clock frequency is given by (input clock frequency) / (divisor +
 ///  1).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_select_input_clock_divisor(
+   SI32_EPCA_A_Type * basePointer,
+   // EPCA clock frequency is given by (input clock frequency) / (divisor +
+   // 1).
+   uint32_t divisor)
+{
+   assert(divisor < 1024);   // divisor < 2^10
+   //{{
+   basePointer->MODE.CLKDIV = divisor;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_select_input_clock_divisor(SI32_EPCA_A_Type* /*basePointer*/,
    uint32_t /*divisor*/);
+#endif
 ///
 /// @def SI32_EPCA_A_select_input_clock_divisor(basePointer, divisor)
 #define SI32_EPCA_A_select_input_clock_divisor(basePointer, divisor) \
@@ -181,8 +247,19 @@ _SI32_EPCA_A_select_input_clock_divisor(SI32_EPCA_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_select_input_clock_apb(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.CLKSEL = SI32_EPCA_A_MODE_CLKSEL_APB_VALUE;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_select_input_clock_apb(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_select_input_clock_apb(basePointer)
 #define SI32_EPCA_A_select_input_clock_apb(basePointer) \
@@ -194,8 +271,19 @@ _SI32_EPCA_A_select_input_clock_apb(SI32_EPCA_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_select_input_clock_timer0_overflow(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.CLKSEL = SI32_EPCA_A_MODE_CLKSEL_TIMER0_VALUE;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_select_input_clock_timer0_overflow(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_select_input_clock_timer0_overflow(basePointer)
 #define SI32_EPCA_A_select_input_clock_timer0_overflow(basePointer) \
@@ -207,8 +295,19 @@ _SI32_EPCA_A_select_input_clock_timer0_overflow(SI32_EPCA_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_select_input_clock_eci_high_to_low(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.CLKSEL = SI32_EPCA_A_MODE_CLKSEL_HL_ECI_VALUE;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_select_input_clock_eci_high_to_low(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_select_input_clock_eci_high_to_low(basePointer)
 #define SI32_EPCA_A_select_input_clock_eci_high_to_low(basePointer) \
@@ -220,8 +319,19 @@ _SI32_EPCA_A_select_input_clock_eci_high_to_low(SI32_EPCA_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_select_input_clock_external_oscillator(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.CLKSEL = SI32_EPCA_A_MODE_CLKSEL_EXTOSCN_VALUE;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_select_input_clock_external_oscillator(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_select_input_clock_external_oscillator(basePointer)
 #define SI32_EPCA_A_select_input_clock_external_oscillator(basePointer) \
@@ -233,8 +343,19 @@ _SI32_EPCA_A_select_input_clock_external_oscillator(SI32_EPCA_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_select_input_clock_eci(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.CLKSEL = SI32_EPCA_A_MODE_CLKSEL_ECI_VALUE;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_select_input_clock_eci(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_select_input_clock_eci(basePointer)
 #define SI32_EPCA_A_select_input_clock_eci(basePointer) \
@@ -249,8 +370,19 @@ _SI32_EPCA_A_select_input_clock_eci(SI32_EPCA_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_select_high_drive_port_0_differential(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.HDOSEL = SI32_EPCA_A_MODE_HDOSEL_NO_DIFF_VALUE;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_select_high_drive_port_0_differential(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_select_high_drive_port_0_differential(basePointer)
 #define SI32_EPCA_A_select_high_drive_port_0_differential(basePointer) \
@@ -266,8 +398,19 @@ _SI32_EPCA_A_select_high_drive_port_0_differential(SI32_EPCA_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_select_high_drive_port_1_differential(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.HDOSEL = SI32_EPCA_A_MODE_HDOSEL_ONE_DIFF_VALUE;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_select_high_drive_port_1_differential(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_select_high_drive_port_1_differential(basePointer)
 #define SI32_EPCA_A_select_high_drive_port_1_differential(basePointer) \
@@ -283,8 +426,19 @@ _SI32_EPCA_A_select_high_drive_port_1_differential(SI32_EPCA_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_select_high_drive_port_2_differential(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.HDOSEL = SI32_EPCA_A_MODE_HDOSEL_TWO_DIFF_VALUE;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_select_high_drive_port_2_differential(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_select_high_drive_port_2_differential(basePointer)
 #define SI32_EPCA_A_select_high_drive_port_2_differential(basePointer) \
@@ -299,8 +453,19 @@ _SI32_EPCA_A_select_high_drive_port_2_differential(SI32_EPCA_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_select_high_drive_port_3_differential(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.HDOSEL = SI32_EPCA_A_MODE_HDOSEL_THREE_DIFF_VALUE;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_select_high_drive_port_3_differential(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_select_high_drive_port_3_differential(basePointer)
 #define SI32_EPCA_A_select_high_drive_port_3_differential(basePointer) \
@@ -319,8 +484,19 @@ _SI32_EPCA_A_select_high_drive_port_3_differential(SI32_EPCA_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_EPCA_A_get_dma_write_end_index(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   return basePointer->MODE.DEND;
+   //}}
+}
+#else
 uint32_t
 _SI32_EPCA_A_get_dma_write_end_index(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_get_dma_write_end_index(basePointer)
 #define SI32_EPCA_A_get_dma_write_end_index(basePointer) \
@@ -342,9 +518,24 @@ _SI32_EPCA_A_get_dma_write_end_index(SI32_EPCA_A_Type* /*basePointer*/);
 ///  Last register: (0 = LIMIT, 1 = channel 0 CCAPVUPD, ..., 6 = channel 5
 ///  CCAPVUPD).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_set_dma_write_end_index(
+   SI32_EPCA_A_Type * basePointer,
+   // Last register: (0 = LIMIT, 1 = channel 0 CCAPVUPD, ..., 6 = channel 5
+   // CCAPVUPD).
+   uint32_t index)
+{
+   assert(index < 8);   // index < 2^3
+   //{{
+   basePointer->MODE.DEND = index;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_set_dma_write_end_index(SI32_EPCA_A_Type* /*basePointer*/,
    uint32_t /*index*/);
+#endif
 ///
 /// @def SI32_EPCA_A_set_dma_write_end_index(basePointer, index)
 #define SI32_EPCA_A_set_dma_write_end_index(basePointer, index) \
@@ -363,8 +554,19 @@ _SI32_EPCA_A_set_dma_write_end_index(SI32_EPCA_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_EPCA_A_get_dma_write_transfer_pointer(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   return basePointer->MODE.DPTR;
+   //}}
+}
+#else
 uint32_t
 _SI32_EPCA_A_get_dma_write_transfer_pointer(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_get_dma_write_transfer_pointer(basePointer)
 #define SI32_EPCA_A_get_dma_write_transfer_pointer(basePointer) \
@@ -386,9 +588,24 @@ _SI32_EPCA_A_get_dma_write_transfer_pointer(SI32_EPCA_A_Type* /*basePointer*/);
 ///  Target: (0 = LIMIT, 1 = channel 0 CCAPVUPD, ..., 6 = channel 5
 ///  CCAPVUPD).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_set_dma_write_transfer_pointer(
+   SI32_EPCA_A_Type * basePointer,
+   // Target: (0 = LIMIT, 1 = channel 0 CCAPVUPD, ..., 6 = channel 5
+   // CCAPVUPD).
+   uint32_t index)
+{
+   assert(index < 8);   // index < 2^3
+   //{{
+   basePointer->MODE.DPTR = index;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_set_dma_write_transfer_pointer(SI32_EPCA_A_Type* /*basePointer*/,
    uint32_t /*index*/);
+#endif
 ///
 /// @def SI32_EPCA_A_set_dma_write_transfer_pointer(basePointer, index)
 #define SI32_EPCA_A_set_dma_write_transfer_pointer(basePointer, index) \
@@ -407,8 +624,19 @@ _SI32_EPCA_A_set_dma_write_transfer_pointer(SI32_EPCA_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_EPCA_A_get_dma_target_start_index(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   return basePointer->MODE.DSTART;
+   //}}
+}
+#else
 uint32_t
 _SI32_EPCA_A_get_dma_target_start_index(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_get_dma_target_start_index(basePointer)
 #define SI32_EPCA_A_get_dma_target_start_index(basePointer) \
@@ -430,9 +658,24 @@ _SI32_EPCA_A_get_dma_target_start_index(SI32_EPCA_A_Type* /*basePointer*/);
 ///  First register: (0 = LIMIT, 1 = channel 0 CCAPVUPD, ..., 6 = channel 5
 ///  CCAPVUPD).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_set_dma_target_start_index(
+   SI32_EPCA_A_Type * basePointer,
+   // First register: (0 = LIMIT, 1 = channel 0 CCAPVUPD, ..., 6 = channel 5
+   // CCAPVUPD).
+   uint32_t index)
+{
+   assert(index < 8);   // index < 2^3
+   //{{
+   basePointer->MODE.DSTART = index;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_set_dma_target_start_index(SI32_EPCA_A_Type* /*basePointer*/,
    uint32_t /*index*/);
+#endif
 ///
 /// @def SI32_EPCA_A_set_dma_target_start_index(basePointer, index)
 #define SI32_EPCA_A_set_dma_target_start_index(basePointer, index) \
@@ -444,8 +687,19 @@ _SI32_EPCA_A_set_dma_target_start_index(SI32_EPCA_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_EPCA_A_is_dma_busy(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   return basePointer->MODE.DBUSYF;
+   //}}
+}
+#else
 bool
 _SI32_EPCA_A_is_dma_busy(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_is_dma_busy(basePointer)
 #define SI32_EPCA_A_is_dma_busy(basePointer) \
@@ -457,8 +711,19 @@ _SI32_EPCA_A_is_dma_busy(SI32_EPCA_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_set_dma_busy(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.DBUSYF = SI32_EPCA_A_MODE_DBUSYF_BUSY_VALUE;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_set_dma_busy(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_set_dma_busy(basePointer)
 #define SI32_EPCA_A_set_dma_busy(basePointer) \
@@ -470,8 +735,19 @@ _SI32_EPCA_A_set_dma_busy(SI32_EPCA_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_clear_dma_busy(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.DBUSYF = SI32_EPCA_A_MODE_DBUSYF_IDLE_VALUE;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_clear_dma_busy(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_clear_dma_busy(basePointer)
 #define SI32_EPCA_A_clear_dma_busy(basePointer) \
@@ -486,8 +762,19 @@ _SI32_EPCA_A_clear_dma_busy(SI32_EPCA_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_select_standard_drive_port_0_differential(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.STDOSEL = SI32_EPCA_A_MODE_STDOSEL_NO_DIFF_VALUE;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_select_standard_drive_port_0_differential(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_select_standard_drive_port_0_differential(basePointer)
 #define SI32_EPCA_A_select_standard_drive_port_0_differential(basePointer) \
@@ -503,8 +790,19 @@ _SI32_EPCA_A_select_standard_drive_port_0_differential(SI32_EPCA_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_select_standard_drive_port_1_differential(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.STDOSEL = SI32_EPCA_A_MODE_STDOSEL_ONE_DIFF_VALUE;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_select_standard_drive_port_1_differential(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_select_standard_drive_port_1_differential(basePointer)
 #define SI32_EPCA_A_select_standard_drive_port_1_differential(basePointer) \
@@ -520,8 +818,19 @@ _SI32_EPCA_A_select_standard_drive_port_1_differential(SI32_EPCA_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_select_standard_drive_port_2_differential(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.STDOSEL = SI32_EPCA_A_MODE_STDOSEL_TWO_DIFF_VALUE;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_select_standard_drive_port_2_differential(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_select_standard_drive_port_2_differential(basePointer)
 #define SI32_EPCA_A_select_standard_drive_port_2_differential(basePointer) \
@@ -536,8 +845,19 @@ _SI32_EPCA_A_select_standard_drive_port_2_differential(SI32_EPCA_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_select_standard_drive_port_3_differential(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.STDOSEL = SI32_EPCA_A_MODE_STDOSEL_THREE_DIFF_VALUE;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_select_standard_drive_port_3_differential(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_select_standard_drive_port_3_differential(basePointer)
 #define SI32_EPCA_A_select_standard_drive_port_3_differential(basePointer) \
@@ -557,9 +877,21 @@ _SI32_EPCA_A_select_standard_drive_port_3_differential(SI32_EPCA_A_Type* /*baseP
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_write_control(
+   SI32_EPCA_A_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_write_control(SI32_EPCA_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_EPCA_A_write_control(basePointer, control)
 #define SI32_EPCA_A_write_control(basePointer, control) \
@@ -574,8 +906,19 @@ _SI32_EPCA_A_write_control(SI32_EPCA_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_EPCA_A_read_control(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_EPCA_A_read_control(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_read_control(basePointer)
 #define SI32_EPCA_A_read_control(basePointer) \
@@ -587,8 +930,19 @@ _SI32_EPCA_A_read_control(SI32_EPCA_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_enable_counter_overflow_interrupt(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_EPCA_A_CONTROL_OVFIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_enable_counter_overflow_interrupt(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_enable_counter_overflow_interrupt(basePointer)
 #define SI32_EPCA_A_enable_counter_overflow_interrupt(basePointer) \
@@ -600,8 +954,19 @@ _SI32_EPCA_A_enable_counter_overflow_interrupt(SI32_EPCA_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_disable_counter_overflow_interrupt(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EPCA_A_CONTROL_OVFIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_disable_counter_overflow_interrupt(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_disable_counter_overflow_interrupt(basePointer)
 #define SI32_EPCA_A_disable_counter_overflow_interrupt(basePointer) \
@@ -613,8 +978,19 @@ _SI32_EPCA_A_disable_counter_overflow_interrupt(SI32_EPCA_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_EPCA_A_is_counter_overflow_interrupt_enabled(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.OVFIEN);
+   //}}
+}
+#else
 bool
 _SI32_EPCA_A_is_counter_overflow_interrupt_enabled(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_is_counter_overflow_interrupt_enabled(basePointer)
 #define SI32_EPCA_A_is_counter_overflow_interrupt_enabled(basePointer) \
@@ -626,8 +1002,19 @@ _SI32_EPCA_A_is_counter_overflow_interrupt_enabled(SI32_EPCA_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_enable_counter_overflow_dma_request(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_EPCA_A_CONTROL_OVFDEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_enable_counter_overflow_dma_request(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_enable_counter_overflow_dma_request(basePointer)
 #define SI32_EPCA_A_enable_counter_overflow_dma_request(basePointer) \
@@ -639,8 +1026,19 @@ _SI32_EPCA_A_enable_counter_overflow_dma_request(SI32_EPCA_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_disable_counter_overflow_dma_request(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EPCA_A_CONTROL_OVFDEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_disable_counter_overflow_dma_request(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_disable_counter_overflow_dma_request(basePointer)
 #define SI32_EPCA_A_disable_counter_overflow_dma_request(basePointer) \
@@ -652,8 +1050,19 @@ _SI32_EPCA_A_disable_counter_overflow_dma_request(SI32_EPCA_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_enable_counter_overflow_synchronization_signal(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_EPCA_A_CONTROL_OVFSEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_enable_counter_overflow_synchronization_signal(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_enable_counter_overflow_synchronization_signal(basePointer)
 #define SI32_EPCA_A_enable_counter_overflow_synchronization_signal(basePointer) \
@@ -665,8 +1074,19 @@ _SI32_EPCA_A_enable_counter_overflow_synchronization_signal(SI32_EPCA_A_Type* /*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_disable_counter_overflow_synchronization_signal(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EPCA_A_CONTROL_OVFSEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_disable_counter_overflow_synchronization_signal(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_disable_counter_overflow_synchronization_signal(basePointer)
 #define SI32_EPCA_A_disable_counter_overflow_synchronization_signal(basePointer) \
@@ -678,8 +1098,19 @@ _SI32_EPCA_A_disable_counter_overflow_synchronization_signal(SI32_EPCA_A_Type* /
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_enable_halt_input_interrupt(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_EPCA_A_CONTROL_HALTIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_enable_halt_input_interrupt(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_enable_halt_input_interrupt(basePointer)
 #define SI32_EPCA_A_enable_halt_input_interrupt(basePointer) \
@@ -691,8 +1122,19 @@ _SI32_EPCA_A_enable_halt_input_interrupt(SI32_EPCA_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_disable_halt_input_interrupt(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EPCA_A_CONTROL_HALTIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_disable_halt_input_interrupt(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_disable_halt_input_interrupt(basePointer)
 #define SI32_EPCA_A_disable_halt_input_interrupt(basePointer) \
@@ -704,8 +1146,19 @@ _SI32_EPCA_A_disable_halt_input_interrupt(SI32_EPCA_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_EPCA_A_is_halt_interrupt_enabled(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.HALTIEN);
+   //}}
+}
+#else
 bool
 _SI32_EPCA_A_is_halt_interrupt_enabled(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_is_halt_interrupt_enabled(basePointer)
 #define SI32_EPCA_A_is_halt_interrupt_enabled(basePointer) \
@@ -717,8 +1170,19 @@ _SI32_EPCA_A_is_halt_interrupt_enabled(SI32_EPCA_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_enable_internal_register_update_on_overflow(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EPCA_A_CONTROL_NOUPD_MASK;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_enable_internal_register_update_on_overflow(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_enable_internal_register_update_on_overflow(basePointer)
 #define SI32_EPCA_A_enable_internal_register_update_on_overflow(basePointer) \
@@ -730,8 +1194,19 @@ _SI32_EPCA_A_enable_internal_register_update_on_overflow(SI32_EPCA_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_disable_internal_register_update_on_overflow(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_EPCA_A_CONTROL_NOUPD_ACTIVE_U32;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_disable_internal_register_update_on_overflow(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_disable_internal_register_update_on_overflow(basePointer)
 #define SI32_EPCA_A_disable_internal_register_update_on_overflow(basePointer) \
@@ -743,8 +1218,19 @@ _SI32_EPCA_A_disable_internal_register_update_on_overflow(SI32_EPCA_A_Type* /*ba
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_enable_stall_in_debug_mode(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EPCA_A_CONTROL_DBGMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_enable_stall_in_debug_mode(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_enable_stall_in_debug_mode(basePointer)
 #define SI32_EPCA_A_enable_stall_in_debug_mode(basePointer) \
@@ -756,8 +1242,19 @@ _SI32_EPCA_A_enable_stall_in_debug_mode(SI32_EPCA_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_disable_stall_in_debug_mode(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_EPCA_A_CONTROL_DBGMD_RUN_U32;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_disable_stall_in_debug_mode(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_disable_stall_in_debug_mode(basePointer)
 #define SI32_EPCA_A_disable_stall_in_debug_mode(basePointer) \
@@ -769,8 +1266,19 @@ _SI32_EPCA_A_disable_stall_in_debug_mode(SI32_EPCA_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_enable_halt_input(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_EPCA_A_CONTROL_HALTEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_enable_halt_input(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_enable_halt_input(basePointer)
 #define SI32_EPCA_A_enable_halt_input(basePointer) \
@@ -782,8 +1290,19 @@ _SI32_EPCA_A_enable_halt_input(SI32_EPCA_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_disable_halt_input(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EPCA_A_CONTROL_HALTEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_disable_halt_input(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_disable_halt_input(basePointer)
 #define SI32_EPCA_A_disable_halt_input(basePointer) \
@@ -801,9 +1320,24 @@ _SI32_EPCA_A_disable_halt_input(SI32_EPCA_A_Type* /*basePointer*/);
 ///  Valid range is 0 to 3.
 ///  Input trigger number (0 = EPCAnT0, ..., 3 = EPCAnT3).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_select_synchronous_input_trigger(
+   SI32_EPCA_A_Type * basePointer,
+   // Input trigger number (0 = EPCAnT0, ..., 3 = EPCAnT3).
+   uint32_t trigger)
+{
+   assert(trigger <= 3);
+   //{{
+   basePointer->CONTROL_CLR = SI32_EPCA_A_CONTROL_STSEL_MASK;
+   basePointer->CONTROL_SET = trigger << SI32_EPCA_A_CONTROL_STSEL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_select_synchronous_input_trigger(SI32_EPCA_A_Type* /*basePointer*/,
    uint32_t /*trigger*/);
+#endif
 ///
 /// @def SI32_EPCA_A_select_synchronous_input_trigger(basePointer, trigger)
 #define SI32_EPCA_A_select_synchronous_input_trigger(basePointer, trigger) do{  \
@@ -817,8 +1351,19 @@ _SI32_EPCA_A_select_synchronous_input_trigger(SI32_EPCA_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_select_synchronous_input_trigger_edge_falling(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EPCA_A_CONTROL_STESEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_select_synchronous_input_trigger_edge_falling(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_select_synchronous_input_trigger_edge_falling(basePointer)
 #define SI32_EPCA_A_select_synchronous_input_trigger_edge_falling(basePointer) \
@@ -830,8 +1375,19 @@ _SI32_EPCA_A_select_synchronous_input_trigger_edge_falling(SI32_EPCA_A_Type* /*b
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_select_synchronous_input_trigger_edge_rising(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_EPCA_A_CONTROL_STESEL_RISING_U32;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_select_synchronous_input_trigger_edge_rising(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_select_synchronous_input_trigger_edge_rising(basePointer)
 #define SI32_EPCA_A_select_synchronous_input_trigger_edge_rising(basePointer) \
@@ -843,8 +1399,19 @@ _SI32_EPCA_A_select_synchronous_input_trigger_edge_rising(SI32_EPCA_A_Type* /*ba
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_enable_synchronous_input_trigger(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_EPCA_A_CONTROL_STEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_enable_synchronous_input_trigger(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_enable_synchronous_input_trigger(basePointer)
 #define SI32_EPCA_A_enable_synchronous_input_trigger(basePointer) \
@@ -856,8 +1423,19 @@ _SI32_EPCA_A_enable_synchronous_input_trigger(SI32_EPCA_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_disable_synchronous_input_trigger(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EPCA_A_CONTROL_STEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_disable_synchronous_input_trigger(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_disable_synchronous_input_trigger(basePointer)
 #define SI32_EPCA_A_disable_synchronous_input_trigger(basePointer) \
@@ -873,8 +1451,19 @@ _SI32_EPCA_A_disable_synchronous_input_trigger(SI32_EPCA_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_EPCA_A_is_clock_divider_in_phase_2(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.DIVST);
+   //}}
+}
+#else
 bool
 _SI32_EPCA_A_is_clock_divider_in_phase_2(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_is_clock_divider_in_phase_2(basePointer)
 #define SI32_EPCA_A_is_clock_divider_in_phase_2(basePointer) \
@@ -889,8 +1478,19 @@ _SI32_EPCA_A_is_clock_divider_in_phase_2(SI32_EPCA_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_select_clock_divider_state_phase_1(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EPCA_A_CONTROL_DIVST_MASK;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_select_clock_divider_state_phase_1(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_select_clock_divider_state_phase_1(basePointer)
 #define SI32_EPCA_A_select_clock_divider_state_phase_1(basePointer) \
@@ -905,8 +1505,19 @@ _SI32_EPCA_A_select_clock_divider_state_phase_1(SI32_EPCA_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_select_clock_divider_state_phase_2(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_EPCA_A_CONTROL_DIVST_MASK;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_select_clock_divider_state_phase_2(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_select_clock_divider_state_phase_2(basePointer)
 #define SI32_EPCA_A_select_clock_divider_state_phase_2(basePointer) \
@@ -921,8 +1532,19 @@ _SI32_EPCA_A_select_clock_divider_state_phase_2(SI32_EPCA_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_EPCA_A_get_clock_divider(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.DIV;
+   //}}
+}
+#else
 uint32_t
 _SI32_EPCA_A_get_clock_divider(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_get_clock_divider(basePointer)
 #define SI32_EPCA_A_get_clock_divider(basePointer) \
@@ -942,9 +1564,23 @@ _SI32_EPCA_A_get_clock_divider(SI32_EPCA_A_Type* /*basePointer*/);
 ///  divider
 ///  Valid range is 10 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_set_clock_divider(
+   SI32_EPCA_A_Type * basePointer,
+   uint32_t divider)
+{
+   assert(divider < 1024);   // divider < 2^10
+   //{{
+   basePointer->CONTROL_CLR = SI32_EPCA_A_CONTROL_DIV_MASK;
+   basePointer->CONTROL_SET = divider << SI32_EPCA_A_CONTROL_DIV_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_set_clock_divider(SI32_EPCA_A_Type* /*basePointer*/,
    uint32_t /*divider*/);
+#endif
 ///
 /// @def SI32_EPCA_A_set_clock_divider(basePointer, divider)
 #define SI32_EPCA_A_set_clock_divider(basePointer, divider) do{  \
@@ -966,9 +1602,21 @@ _SI32_EPCA_A_set_clock_divider(SI32_EPCA_A_Type* /*basePointer*/,
 ///  status
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_write_status(
+   SI32_EPCA_A_Type * basePointer,
+   uint32_t status)
+{
+   //{{
+   basePointer->STATUS.U32 = status;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_write_status(SI32_EPCA_A_Type* /*basePointer*/,
    uint32_t /*status*/);
+#endif
 ///
 /// @def SI32_EPCA_A_write_status(basePointer, status)
 #define SI32_EPCA_A_write_status(basePointer, status) \
@@ -983,8 +1631,19 @@ _SI32_EPCA_A_write_status(SI32_EPCA_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_EPCA_A_read_status(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_EPCA_A_read_status(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_read_status(basePointer)
 #define SI32_EPCA_A_read_status(basePointer) \
@@ -1002,9 +1661,46 @@ _SI32_EPCA_A_read_status(SI32_EPCA_A_Type* /*basePointer*/);
 ///  Valid range is 0 to 5.
 ///  Channel number (0-5).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_EPCA_A_is_channel_n_capture_compare_interrupt_pending(
+   SI32_EPCA_A_Type * basePointer,
+   // Channel number (0-5).
+   uint32_t channel)
+{
+   assert(channel <= 5);
+   //{{
+   if (channel == 0)
+   {
+      return (bool)(basePointer->STATUS.C0CCI);
+   }
+   else if (channel == 1)
+   {
+      return (bool)(basePointer->STATUS.C1CCI);
+   }
+   else if (channel == 2)
+   {
+      return (bool)(basePointer->STATUS.C2CCI);
+   }
+   else if (channel == 3)
+   {
+      return (bool)(basePointer->STATUS.C3CCI);
+   }
+   else if (channel == 4)
+   {
+      return (bool)(basePointer->STATUS.C4CCI);
+   }
+   else
+   {
+      return (bool)(basePointer->STATUS.C5CCI);
+   }
+   //}}
+}
+#else
 bool
 _SI32_EPCA_A_is_channel_n_capture_compare_interrupt_pending(SI32_EPCA_A_Type* /*basePointer*/,
    uint32_t /*channel*/);
+#endif
 ///
 /// @def SI32_EPCA_A_is_channel_n_capture_compare_interrupt_pending(basePointer, channel)
 #define SI32_EPCA_A_is_channel_n_capture_compare_interrupt_pending(basePointer, channel) \
@@ -1025,9 +1721,46 @@ _SI32_EPCA_A_is_channel_n_capture_compare_interrupt_pending(SI32_EPCA_A_Type* /*
 ///  Valid range is 0 to 5.
 ///  Channel number (0-5).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_set_channel_n_capture_compare_interrupt(
+   SI32_EPCA_A_Type * basePointer,
+   // Channel number (0-5).
+   uint32_t channel)
+{
+   assert(channel <= 5);
+   //{{
+   if (channel == 0)
+   {
+      basePointer->STATUS_SET = SI32_EPCA_A_STATUS_C0CCI_MASK;
+   }
+   else if (channel == 1)
+   {
+      basePointer->STATUS_SET = SI32_EPCA_A_STATUS_C1CCI_MASK;
+   }
+   else if (channel == 2)
+   {
+      basePointer->STATUS_SET = SI32_EPCA_A_STATUS_C2CCI_MASK;
+   }
+   else if (channel == 3)
+   {
+      basePointer->STATUS_SET = SI32_EPCA_A_STATUS_C3CCI_MASK;
+   }
+   else if (channel == 4)
+   {
+      basePointer->STATUS_SET = SI32_EPCA_A_STATUS_C4CCI_MASK;
+   }
+   else if (channel == 5)
+   {
+      basePointer->STATUS_SET = SI32_EPCA_A_STATUS_C5CCI_MASK;
+   }
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_set_channel_n_capture_compare_interrupt(SI32_EPCA_A_Type* /*basePointer*/,
    uint32_t /*channel*/);
+#endif
 ///
 /// @def SI32_EPCA_A_set_channel_n_capture_compare_interrupt(basePointer, channel)
 #define SI32_EPCA_A_set_channel_n_capture_compare_interrupt(basePointer, channel) \
@@ -1045,9 +1778,46 @@ _SI32_EPCA_A_set_channel_n_capture_compare_interrupt(SI32_EPCA_A_Type* /*basePoi
 ///  Valid range is 0 to 5.
 ///  Channel number (0-5).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_clear_channel_n_capture_compare_interrupt(
+   SI32_EPCA_A_Type * basePointer,
+   // Channel number (0-5).
+   uint32_t channel)
+{
+   assert(channel <= 5);
+   //{{
+   if (channel == 0)
+   {
+      basePointer->STATUS_CLR = SI32_EPCA_A_STATUS_C0CCI_MASK;
+   }
+   else if (channel == 1)
+   {
+      basePointer->STATUS_CLR = SI32_EPCA_A_STATUS_C1CCI_MASK;
+   }
+   else if (channel == 2)
+   {
+      basePointer->STATUS_CLR = SI32_EPCA_A_STATUS_C2CCI_MASK;
+   }
+   else if (channel == 3)
+   {
+      basePointer->STATUS_CLR = SI32_EPCA_A_STATUS_C3CCI_MASK;
+   }
+   else if (channel == 4)
+   {
+      basePointer->STATUS_CLR = SI32_EPCA_A_STATUS_C4CCI_MASK;
+   }
+   else if (channel == 5)
+   {
+      basePointer->STATUS_CLR = SI32_EPCA_A_STATUS_C5CCI_MASK;
+   }
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_clear_channel_n_capture_compare_interrupt(SI32_EPCA_A_Type* /*basePointer*/,
    uint32_t /*channel*/);
+#endif
 ///
 /// @def SI32_EPCA_A_clear_channel_n_capture_compare_interrupt(basePointer, channel)
 #define SI32_EPCA_A_clear_channel_n_capture_compare_interrupt(basePointer, channel) \
@@ -1059,8 +1829,19 @@ _SI32_EPCA_A_clear_channel_n_capture_compare_interrupt(SI32_EPCA_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_start_counter_timer(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS_SET = SI32_EPCA_A_STATUS_RUN_START_U32;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_start_counter_timer(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_start_counter_timer(basePointer)
 #define SI32_EPCA_A_start_counter_timer(basePointer) \
@@ -1072,8 +1853,19 @@ _SI32_EPCA_A_start_counter_timer(SI32_EPCA_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_stop_counter_timer(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS_CLR = SI32_EPCA_A_STATUS_RUN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_stop_counter_timer(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_stop_counter_timer(basePointer)
 #define SI32_EPCA_A_stop_counter_timer(basePointer) \
@@ -1085,8 +1877,19 @@ _SI32_EPCA_A_stop_counter_timer(SI32_EPCA_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_EPCA_A_is_counter_timer_overflow_interrupt_pending(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->STATUS.OVFI);
+   //}}
+}
+#else
 bool
 _SI32_EPCA_A_is_counter_timer_overflow_interrupt_pending(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_is_counter_timer_overflow_interrupt_pending(basePointer)
 #define SI32_EPCA_A_is_counter_timer_overflow_interrupt_pending(basePointer) \
@@ -1101,8 +1904,19 @@ _SI32_EPCA_A_is_counter_timer_overflow_interrupt_pending(SI32_EPCA_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_set_counter_timer_overflow_interrupt(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS_SET = SI32_EPCA_A_STATUS_OVFI_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_set_counter_timer_overflow_interrupt(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_set_counter_timer_overflow_interrupt(basePointer)
 #define SI32_EPCA_A_set_counter_timer_overflow_interrupt(basePointer) \
@@ -1114,8 +1928,19 @@ _SI32_EPCA_A_set_counter_timer_overflow_interrupt(SI32_EPCA_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_clear_counter_timer_overflow_interrupt(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS_CLR = SI32_EPCA_A_STATUS_OVFI_MASK;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_clear_counter_timer_overflow_interrupt(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_clear_counter_timer_overflow_interrupt(basePointer)
 #define SI32_EPCA_A_clear_counter_timer_overflow_interrupt(basePointer) \
@@ -1127,8 +1952,19 @@ _SI32_EPCA_A_clear_counter_timer_overflow_interrupt(SI32_EPCA_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_EPCA_A_is_register_update_pending(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->STATUS.UPDCF);
+   //}}
+}
+#else
 bool
 _SI32_EPCA_A_is_register_update_pending(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_is_register_update_pending(basePointer)
 #define SI32_EPCA_A_is_register_update_pending(basePointer) \
@@ -1140,8 +1976,19 @@ _SI32_EPCA_A_is_register_update_pending(SI32_EPCA_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_set_register_update_complete_flag(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS_SET = SI32_EPCA_A_STATUS_UPDCF_FULL_U32;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_set_register_update_complete_flag(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_set_register_update_complete_flag(basePointer)
 #define SI32_EPCA_A_set_register_update_complete_flag(basePointer) \
@@ -1153,8 +2000,19 @@ _SI32_EPCA_A_set_register_update_complete_flag(SI32_EPCA_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_clear_register_update_complete_flag(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS_CLR = SI32_EPCA_A_STATUS_UPDCF_MASK;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_clear_register_update_complete_flag(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_clear_register_update_complete_flag(basePointer)
 #define SI32_EPCA_A_clear_register_update_complete_flag(basePointer) \
@@ -1166,8 +2024,19 @@ _SI32_EPCA_A_clear_register_update_complete_flag(SI32_EPCA_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_EPCA_A_is_halt_input_interrupt_pending(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->STATUS.HALTI);
+   //}}
+}
+#else
 bool
 _SI32_EPCA_A_is_halt_input_interrupt_pending(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_is_halt_input_interrupt_pending(basePointer)
 #define SI32_EPCA_A_is_halt_input_interrupt_pending(basePointer) \
@@ -1182,8 +2051,19 @@ _SI32_EPCA_A_is_halt_input_interrupt_pending(SI32_EPCA_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_set_halt_input_interrupt(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS_SET = SI32_EPCA_A_STATUS_HALTI_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_set_halt_input_interrupt(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_set_halt_input_interrupt(basePointer)
 #define SI32_EPCA_A_set_halt_input_interrupt(basePointer) \
@@ -1195,8 +2075,19 @@ _SI32_EPCA_A_set_halt_input_interrupt(SI32_EPCA_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_clear_halt_input_interrupt(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS_CLR = SI32_EPCA_A_STATUS_HALTI_MASK;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_clear_halt_input_interrupt(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_clear_halt_input_interrupt(basePointer)
 #define SI32_EPCA_A_clear_halt_input_interrupt(basePointer) \
@@ -1214,9 +2105,46 @@ _SI32_EPCA_A_clear_halt_input_interrupt(SI32_EPCA_A_Type* /*basePointer*/);
 ///  Valid range is 0 to 5.
 ///  Channel number (0-5).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_EPCA_A_is_channel_n_intermediate_overflow_interrupt_pending(
+   SI32_EPCA_A_Type * basePointer,
+   // Channel number (0-5).
+   uint32_t channel)
+{
+   assert(channel <= 5);
+   //{{
+   if (channel == 0)
+   {
+      return (bool)(basePointer->STATUS.C0IOVFI);
+   }
+   else if (channel == 1)
+   {
+      return (bool)(basePointer->STATUS.C1IOVFI);
+   }
+   else if (channel == 2)
+   {
+      return (bool)(basePointer->STATUS.C2IOVFI);
+   }
+   else if (channel == 3)
+   {
+      return (bool)(basePointer->STATUS.C3IOVFI);
+   }
+   else if (channel == 4)
+   {
+      return (bool)(basePointer->STATUS.C4IOVFI);
+   }
+   else
+   {
+      return (bool)(basePointer->STATUS.C5IOVFI);
+   }
+   //}}
+}
+#else
 bool
 _SI32_EPCA_A_is_channel_n_intermediate_overflow_interrupt_pending(SI32_EPCA_A_Type* /*basePointer*/,
    uint32_t /*channel*/);
+#endif
 ///
 /// @def SI32_EPCA_A_is_channel_n_intermediate_overflow_interrupt_pending(basePointer, channel)
 #define SI32_EPCA_A_is_channel_n_intermediate_overflow_interrupt_pending(basePointer, channel) \
@@ -1237,9 +2165,46 @@ _SI32_EPCA_A_is_channel_n_intermediate_overflow_interrupt_pending(SI32_EPCA_A_Ty
 ///  Valid range is 0 to 5.
 ///  Channel number (0-5).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_set_channel_n_intermediate_overflow_interrupt(
+   SI32_EPCA_A_Type * basePointer,
+   // Channel number (0-5).
+   uint32_t channel)
+{
+   assert(channel <= 5);
+   //{{
+   if (channel == 0)
+   {
+      basePointer->STATUS_SET = SI32_EPCA_A_STATUS_C0IOVFI_MASK;
+   }
+   else if (channel == 1)
+   {
+      basePointer->STATUS_SET = SI32_EPCA_A_STATUS_C1IOVFI_MASK;
+   }
+   else if (channel == 2)
+   {
+      basePointer->STATUS_SET = SI32_EPCA_A_STATUS_C2IOVFI_MASK;
+   }
+   else if (channel == 3)
+   {
+      basePointer->STATUS_SET = SI32_EPCA_A_STATUS_C3IOVFI_MASK;
+   }
+   else if (channel == 4)
+   {
+      basePointer->STATUS_SET = SI32_EPCA_A_STATUS_C4IOVFI_MASK;
+   }
+   else
+   {
+      basePointer->STATUS_SET = SI32_EPCA_A_STATUS_C5IOVFI_MASK;
+   }
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_set_channel_n_intermediate_overflow_interrupt(SI32_EPCA_A_Type* /*basePointer*/,
    uint32_t /*channel*/);
+#endif
 ///
 /// @def SI32_EPCA_A_set_channel_n_intermediate_overflow_interrupt(basePointer, channel)
 #define SI32_EPCA_A_set_channel_n_intermediate_overflow_interrupt(basePointer, channel) \
@@ -1257,9 +2222,46 @@ _SI32_EPCA_A_set_channel_n_intermediate_overflow_interrupt(SI32_EPCA_A_Type* /*b
 ///  Valid range is 0 to 5.
 ///  Channel number (0-5).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_clear_channel_n_intermediate_overflow_interrupt(
+   SI32_EPCA_A_Type * basePointer,
+   // Channel number (0-5).
+   uint32_t channel)
+{
+   assert(channel <= 5);
+   //{{
+   if (channel == 0)
+   {
+      basePointer->STATUS_CLR = SI32_EPCA_A_STATUS_C0IOVFI_MASK;
+   }
+   else if (channel == 1)
+   {
+      basePointer->STATUS_CLR = SI32_EPCA_A_STATUS_C1IOVFI_MASK;
+   }
+   else if (channel == 2)
+   {
+      basePointer->STATUS_CLR = SI32_EPCA_A_STATUS_C2IOVFI_MASK;
+   }
+   else if (channel == 3)
+   {
+      basePointer->STATUS_CLR = SI32_EPCA_A_STATUS_C3IOVFI_MASK;
+   }
+   else if (channel == 4)
+   {
+      basePointer->STATUS_CLR = SI32_EPCA_A_STATUS_C4IOVFI_MASK;
+   }
+   else if (channel == 5)
+   {
+      basePointer->STATUS_CLR = SI32_EPCA_A_STATUS_C5IOVFI_MASK;
+   }
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_clear_channel_n_intermediate_overflow_interrupt(SI32_EPCA_A_Type* /*basePointer*/,
    uint32_t /*channel*/);
+#endif
 ///
 /// @def SI32_EPCA_A_clear_channel_n_intermediate_overflow_interrupt(basePointer, channel)
 #define SI32_EPCA_A_clear_channel_n_intermediate_overflow_interrupt(basePointer, channel) \
@@ -1279,9 +2281,21 @@ _SI32_EPCA_A_clear_channel_n_intermediate_overflow_interrupt(SI32_EPCA_A_Type* /
 ///  counter
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_write_counter(
+   SI32_EPCA_A_Type * basePointer,
+   uwide16_t counter)
+{
+   //{{
+   basePointer->COUNTER.U32 = counter;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_write_counter(SI32_EPCA_A_Type* /*basePointer*/,
    uwide16_t /*counter*/);
+#endif
 ///
 /// @def SI32_EPCA_A_write_counter(basePointer, counter)
 #define SI32_EPCA_A_write_counter(basePointer, counter) \
@@ -1296,8 +2310,19 @@ _SI32_EPCA_A_write_counter(SI32_EPCA_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide16_t
+_SI32_EPCA_A_read_counter(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   return basePointer->COUNTER.U32;
+   //}}
+}
+#else
 uwide16_t
 _SI32_EPCA_A_read_counter(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_read_counter(basePointer)
 #define SI32_EPCA_A_read_counter(basePointer) \
@@ -1317,9 +2342,21 @@ _SI32_EPCA_A_read_counter(SI32_EPCA_A_Type* /*basePointer*/);
 ///  limit
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_write_limit(
+   SI32_EPCA_A_Type * basePointer,
+   uwide16_t limit)
+{
+   //{{
+   basePointer->LIMIT.U32 = limit;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_write_limit(SI32_EPCA_A_Type* /*basePointer*/,
    uwide16_t /*limit*/);
+#endif
 ///
 /// @def SI32_EPCA_A_write_limit(basePointer, limit)
 #define SI32_EPCA_A_write_limit(basePointer, limit) \
@@ -1334,8 +2371,19 @@ _SI32_EPCA_A_write_limit(SI32_EPCA_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide16_t
+_SI32_EPCA_A_read_limit(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   return basePointer->LIMIT.U32;
+   //}}
+}
+#else
 uwide16_t
 _SI32_EPCA_A_read_limit(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_read_limit(basePointer)
 #define SI32_EPCA_A_read_limit(basePointer) \
@@ -1355,9 +2403,21 @@ _SI32_EPCA_A_read_limit(SI32_EPCA_A_Type* /*basePointer*/);
 ///  limitupd
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_write_limitupd(
+   SI32_EPCA_A_Type * basePointer,
+   uwide16_t limitupd)
+{
+   //{{
+   basePointer->LIMITUPD.U32 = limitupd;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_write_limitupd(SI32_EPCA_A_Type* /*basePointer*/,
    uwide16_t /*limitupd*/);
+#endif
 ///
 /// @def SI32_EPCA_A_write_limitupd(basePointer, limitupd)
 #define SI32_EPCA_A_write_limitupd(basePointer, limitupd) \
@@ -1372,8 +2432,19 @@ _SI32_EPCA_A_write_limitupd(SI32_EPCA_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide16_t
+_SI32_EPCA_A_read_limitupd(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   return basePointer->LIMITUPD.U32;
+   //}}
+}
+#else
 uwide16_t
 _SI32_EPCA_A_read_limitupd(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_read_limitupd(basePointer)
 #define SI32_EPCA_A_read_limitupd(basePointer) \
@@ -1393,9 +2464,21 @@ _SI32_EPCA_A_read_limitupd(SI32_EPCA_A_Type* /*basePointer*/);
 ///  dtime
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_write_dtime(
+   SI32_EPCA_A_Type * basePointer,
+   uwide16_t dtime)
+{
+   //{{
+   basePointer->DTIME.U32 = dtime;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_write_dtime(SI32_EPCA_A_Type* /*basePointer*/,
    uwide16_t /*dtime*/);
+#endif
 ///
 /// @def SI32_EPCA_A_write_dtime(basePointer, dtime)
 #define SI32_EPCA_A_write_dtime(basePointer, dtime) \
@@ -1410,8 +2493,19 @@ _SI32_EPCA_A_write_dtime(SI32_EPCA_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide16_t
+_SI32_EPCA_A_read_dtime(
+   SI32_EPCA_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DTIME.U32;
+   //}}
+}
+#else
 uwide16_t
 _SI32_EPCA_A_read_dtime(SI32_EPCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EPCA_A_read_dtime(basePointer)
 #define SI32_EPCA_A_read_dtime(basePointer) \
@@ -1431,9 +2525,22 @@ _SI32_EPCA_A_read_dtime(SI32_EPCA_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 8 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_write_phase_x_delay_time(
+   SI32_EPCA_A_Type * basePointer,
+   uwide8_t value)
+{
+   assert(value < 256);   // value < 2^8
+   //{{
+   basePointer->DTIME.DTIMEX = value;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_write_phase_x_delay_time(SI32_EPCA_A_Type* /*basePointer*/,
    uwide8_t /*value*/);
+#endif
 ///
 /// @def SI32_EPCA_A_write_phase_x_delay_time(basePointer, value)
 #define SI32_EPCA_A_write_phase_x_delay_time(basePointer, value) \
@@ -1453,9 +2560,22 @@ _SI32_EPCA_A_write_phase_x_delay_time(SI32_EPCA_A_Type* /*basePointer*/,
 ///  value
 ///  Valid range is 8 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_write_phase_y_delay_time(
+   SI32_EPCA_A_Type * basePointer,
+   uwide8_t value)
+{
+   assert(value < 256);   // value < 2^8
+   //{{
+   basePointer->DTIME.DTIMEY = value;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_write_phase_y_delay_time(SI32_EPCA_A_Type* /*basePointer*/,
    uwide8_t /*value*/);
+#endif
 ///
 /// @def SI32_EPCA_A_write_phase_y_delay_time(basePointer, value)
 #define SI32_EPCA_A_write_phase_y_delay_time(basePointer, value) \
@@ -1475,9 +2595,21 @@ _SI32_EPCA_A_write_phase_y_delay_time(SI32_EPCA_A_Type* /*basePointer*/,
 ///  dtarget
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EPCA_A_write_dtarget(
+   SI32_EPCA_A_Type * basePointer,
+   uint32_t dtarget)
+{
+   //{{
+   basePointer->DTARGET.U32 = dtarget;
+   //}}
+}
+#else
 void
 _SI32_EPCA_A_write_dtarget(SI32_EPCA_A_Type* /*basePointer*/,
    uint32_t /*dtarget*/);
+#endif
 ///
 /// @def SI32_EPCA_A_write_dtarget(basePointer, dtarget)
 #define SI32_EPCA_A_write_dtarget(basePointer, dtarget) \
@@ -51,9 +51,22 @@ extern "C" {
 ///  Valid range is 32 bits.
 ///  Write to CONTROL register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTOSC_A_initialize(
+   SI32_EXTOSC_A_Type * basePointer,
+   // Write to CONTROL register.
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_EXTOSC_A_initialize(SI32_EXTOSC_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_EXTOSC_A_initialize(basePointer, control)
 #define SI32_EXTOSC_A_initialize(basePointer, control) \
@@ -71,9 +84,22 @@ _SI32_EXTOSC_A_initialize(SI32_EXTOSC_A_Type* /*basePointer*/,
 ///  Valid range is 32 bits.
 ///  Write to CONTROL register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTOSC_A_write_control(
+   SI32_EXTOSC_A_Type * basePointer,
+   // Write to CONTROL register.
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_EXTOSC_A_write_control(SI32_EXTOSC_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_EXTOSC_A_write_control(basePointer, control)
 #define SI32_EXTOSC_A_write_control(basePointer, control) \
@@ -88,8 +114,19 @@ _SI32_EXTOSC_A_write_control(SI32_EXTOSC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_EXTOSC_A_read_control(
+   SI32_EXTOSC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_EXTOSC_A_read_control(SI32_EXTOSC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EXTOSC_A_read_control(basePointer)
 #define SI32_EXTOSC_A_read_control(basePointer) \
@@ -107,9 +144,24 @@ _SI32_EXTOSC_A_read_control(SI32_EXTOSC_A_Type* /*basePointer*/);
 ///  Valid range is 3 bits.
 ///  Frequency control range value.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTOSC_A_set_frequency_control_range(
+   SI32_EXTOSC_A_Type * basePointer,
+   // Frequency control range value.
+   uint32_t freqcn)
+{
+   assert(freqcn < 8);   // freqcn < 2^3
+   //{{
+   basePointer->CONTROL_CLR = SI32_EXTOSC_A_CONTROL_FREQCN_MASK;
+   basePointer->CONTROL_SET = freqcn;
+   //}}
+}
+#else
 void
 _SI32_EXTOSC_A_set_frequency_control_range(SI32_EXTOSC_A_Type* /*basePointer*/,
    uint32_t /*freqcn*/);
+#endif
 ///
 /// @def SI32_EXTOSC_A_set_frequency_control_range(basePointer, freqcn)
 #define SI32_EXTOSC_A_set_frequency_control_range(basePointer, freqcn) do{  \
@@ -123,8 +175,19 @@ _SI32_EXTOSC_A_set_frequency_control_range(SI32_EXTOSC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_EXTOSC_A_is_oscillator_valid(
+   SI32_EXTOSC_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.OSCVLDF);
+   //}}
+}
+#else
 bool
 _SI32_EXTOSC_A_is_oscillator_valid(SI32_EXTOSC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EXTOSC_A_is_oscillator_valid(basePointer)
 #define SI32_EXTOSC_A_is_oscillator_valid(basePointer) \
@@ -139,8 +202,19 @@ _SI32_EXTOSC_A_is_oscillator_valid(SI32_EXTOSC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTOSC_A_select_oscillator_mode_off(
+   SI32_EXTOSC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EXTOSC_A_CONTROL_OSCMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_EXTOSC_A_select_oscillator_mode_off(SI32_EXTOSC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EXTOSC_A_select_oscillator_mode_off(basePointer)
 #define SI32_EXTOSC_A_select_oscillator_mode_off(basePointer) \
@@ -155,8 +229,20 @@ _SI32_EXTOSC_A_select_oscillator_mode_off(SI32_EXTOSC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTOSC_A_select_oscillator_mode_cmos(
+   SI32_EXTOSC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EXTOSC_A_CONTROL_OSCMD_MASK;
+   basePointer->CONTROL_SET = SI32_EXTOSC_A_CONTROL_OSCMD_CMOS_U32;
+   //}}
+}
+#else
 void
 _SI32_EXTOSC_A_select_oscillator_mode_cmos(SI32_EXTOSC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EXTOSC_A_select_oscillator_mode_cmos(basePointer)
 #define SI32_EXTOSC_A_select_oscillator_mode_cmos(basePointer) do{  \
@@ -174,8 +260,20 @@ _SI32_EXTOSC_A_select_oscillator_mode_cmos(SI32_EXTOSC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTOSC_A_select_oscillator_mode_cmos_div2(
+   SI32_EXTOSC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EXTOSC_A_CONTROL_OSCMD_MASK;
+   basePointer->CONTROL_SET = SI32_EXTOSC_A_CONTROL_OSCMD_CMOSDIV2_U32;
+   //}}
+}
+#else
 void
 _SI32_EXTOSC_A_select_oscillator_mode_cmos_div2(SI32_EXTOSC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EXTOSC_A_select_oscillator_mode_cmos_div2(basePointer)
 #define SI32_EXTOSC_A_select_oscillator_mode_cmos_div2(basePointer) do{  \
@@ -193,8 +291,20 @@ _SI32_EXTOSC_A_select_oscillator_mode_cmos_div2(SI32_EXTOSC_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTOSC_A_select_oscillator_mode_rc_div2(
+   SI32_EXTOSC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EXTOSC_A_CONTROL_OSCMD_MASK;
+   basePointer->CONTROL_SET = SI32_EXTOSC_A_CONTROL_OSCMD_RC_U32;
+   //}}
+}
+#else
 void
 _SI32_EXTOSC_A_select_oscillator_mode_rc_div2(SI32_EXTOSC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EXTOSC_A_select_oscillator_mode_rc_div2(basePointer)
 #define SI32_EXTOSC_A_select_oscillator_mode_rc_div2(basePointer) do{  \
@@ -212,8 +322,20 @@ _SI32_EXTOSC_A_select_oscillator_mode_rc_div2(SI32_EXTOSC_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTOSC_A_select_oscillator_mode_c_div2(
+   SI32_EXTOSC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EXTOSC_A_CONTROL_OSCMD_MASK;
+   basePointer->CONTROL_SET = SI32_EXTOSC_A_CONTROL_OSCMD_C_U32;
+   //}}
+}
+#else
 void
 _SI32_EXTOSC_A_select_oscillator_mode_c_div2(SI32_EXTOSC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EXTOSC_A_select_oscillator_mode_c_div2(basePointer)
 #define SI32_EXTOSC_A_select_oscillator_mode_c_div2(basePointer) do{  \
@@ -230,8 +352,20 @@ _SI32_EXTOSC_A_select_oscillator_mode_c_div2(SI32_EXTOSC_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTOSC_A_select_oscillator_mode_crystal(
+   SI32_EXTOSC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EXTOSC_A_CONTROL_OSCMD_MASK;
+   basePointer->CONTROL_SET = SI32_EXTOSC_A_CONTROL_OSCMD_XTAL_U32;
+   //}}
+}
+#else
 void
 _SI32_EXTOSC_A_select_oscillator_mode_crystal(SI32_EXTOSC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EXTOSC_A_select_oscillator_mode_crystal(basePointer)
 #define SI32_EXTOSC_A_select_oscillator_mode_crystal(basePointer) do{  \
@@ -249,8 +383,19 @@ _SI32_EXTOSC_A_select_oscillator_mode_crystal(SI32_EXTOSC_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTOSC_A_select_oscillator_mode_crystal_div2(
+   SI32_EXTOSC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET	= SI32_EXTOSC_A_CONTROL_OSCMD_XTALDIV2_U32;
+   //}}
+}
+#else
 void
 _SI32_EXTOSC_A_select_oscillator_mode_crystal_div2(SI32_EXTOSC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EXTOSC_A_select_oscillator_mode_crystal_div2(basePointer)
 #define SI32_EXTOSC_A_select_oscillator_mode_crystal_div2(basePointer) \
@@ -72,12 +72,34 @@ extern "C" {
 ///  Valid range is 32 bits.
 ///  Write to CSCONFIG register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTVREG_A_initialize(
+   SI32_EXTVREG_A_Type * basePointer,
+   // Write to CONFIG register.
+   uint32_t config,
+   // Write to CONTROL register.
+   uint32_t control,
+   // Write to CSCONTROL register.
+   uint32_t csconfig,
+   // Write to CSCONFIG register.
+   uint32_t cscontrol)
+{
+   //{{
+   basePointer->CONFIG.U32 = config;
+   basePointer->CONTROL.U32 = control;
+   basePointer->CSCONFIG.U32 = csconfig;
+   basePointer->CSCONTROL.U32 = cscontrol;
+   //}}
+}
+#else
 void
 _SI32_EXTVREG_A_initialize(SI32_EXTVREG_A_Type* /*basePointer*/,
    uint32_t, /*config*/
    uint32_t, /*control*/
    uint32_t, /*csconfig*/
    uint32_t /*cscontrol*/);
+#endif
 ///
 /// @def SI32_EXTVREG_A_initialize(basePointer, config, control, csconfig, cscontrol)
 #define SI32_EXTVREG_A_initialize(basePointer, config, control, csconfig, cscontrol) do{  \
@@ -99,9 +121,22 @@ _SI32_EXTVREG_A_initialize(SI32_EXTVREG_A_Type* /*basePointer*/,
 ///  Valid range is 32 bits.
 ///  Write to CONTROL register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTVREG_A_write_control(
+   SI32_EXTVREG_A_Type * basePointer,
+   // Write to CONTROL register.
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_EXTVREG_A_write_control(SI32_EXTVREG_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_EXTVREG_A_write_control(basePointer, control)
 #define SI32_EXTVREG_A_write_control(basePointer, control) \
@@ -116,8 +151,19 @@ _SI32_EXTVREG_A_write_control(SI32_EXTVREG_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_EXTVREG_A_read_control(
+   SI32_EXTVREG_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_EXTVREG_A_read_control(SI32_EXTVREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EXTVREG_A_read_control(basePointer)
 #define SI32_EXTVREG_A_read_control(basePointer) \
@@ -129,8 +175,19 @@ _SI32_EXTVREG_A_read_control(SI32_EXTVREG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTVREG_A_select_stand_alone_mode(
+   SI32_EXTVREG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_EXTVREG_A_CONTROL_SAEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EXTVREG_A_select_stand_alone_mode(SI32_EXTVREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EXTVREG_A_select_stand_alone_mode(basePointer)
 #define SI32_EXTVREG_A_select_stand_alone_mode(basePointer) \
@@ -142,8 +199,19 @@ _SI32_EXTVREG_A_select_stand_alone_mode(SI32_EXTVREG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTVREG_A_select_normal_mode(
+   SI32_EXTVREG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EXTVREG_A_CONTROL_SAEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EXTVREG_A_select_normal_mode(SI32_EXTVREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EXTVREG_A_select_normal_mode(basePointer)
 #define SI32_EXTVREG_A_select_normal_mode(basePointer) \
@@ -155,8 +223,19 @@ _SI32_EXTVREG_A_select_normal_mode(SI32_EXTVREG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTVREG_A_enable_weak_pull_up(
+   SI32_EXTVREG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_EXTVREG_A_CONTROL_WPULLEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EXTVREG_A_enable_weak_pull_up(SI32_EXTVREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EXTVREG_A_enable_weak_pull_up(basePointer)
 #define SI32_EXTVREG_A_enable_weak_pull_up(basePointer) \
@@ -168,8 +247,19 @@ _SI32_EXTVREG_A_enable_weak_pull_up(SI32_EXTVREG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTVREG_A_disable_weak_pull_up(
+   SI32_EXTVREG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EXTVREG_A_CONTROL_WPULLEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EXTVREG_A_disable_weak_pull_up(SI32_EXTVREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EXTVREG_A_disable_weak_pull_up(basePointer)
 #define SI32_EXTVREG_A_disable_weak_pull_up(basePointer) \
@@ -181,8 +271,19 @@ _SI32_EXTVREG_A_disable_weak_pull_up(SI32_EXTVREG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTVREG_A_enable_foldback_limiting(
+   SI32_EXTVREG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_EXTVREG_A_CONTROL_FBLEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EXTVREG_A_enable_foldback_limiting(SI32_EXTVREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EXTVREG_A_enable_foldback_limiting(basePointer)
 #define SI32_EXTVREG_A_enable_foldback_limiting(basePointer) \
@@ -194,8 +295,19 @@ _SI32_EXTVREG_A_enable_foldback_limiting(SI32_EXTVREG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTVREG_A_disable_foldback_limiting(
+   SI32_EXTVREG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EXTVREG_A_CONTROL_FBLEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EXTVREG_A_disable_foldback_limiting(SI32_EXTVREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EXTVREG_A_disable_foldback_limiting(basePointer)
 #define SI32_EXTVREG_A_disable_foldback_limiting(basePointer) \
@@ -207,8 +319,19 @@ _SI32_EXTVREG_A_disable_foldback_limiting(SI32_EXTVREG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTVREG_A_select_transistor_type_npn(
+   SI32_EXTVREG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EXTVREG_A_CONTROL_PNSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_EXTVREG_A_select_transistor_type_npn(SI32_EXTVREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EXTVREG_A_select_transistor_type_npn(basePointer)
 #define SI32_EXTVREG_A_select_transistor_type_npn(basePointer) \
@@ -220,8 +343,19 @@ _SI32_EXTVREG_A_select_transistor_type_npn(SI32_EXTVREG_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTVREG_A_select_transistor_type_pnp(
+   SI32_EXTVREG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_EXTVREG_A_CONTROL_PNSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_EXTVREG_A_select_transistor_type_pnp(SI32_EXTVREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EXTVREG_A_select_transistor_type_pnp(basePointer)
 #define SI32_EXTVREG_A_select_transistor_type_pnp(basePointer) \
@@ -233,8 +367,19 @@ _SI32_EXTVREG_A_select_transistor_type_pnp(SI32_EXTVREG_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTVREG_A_select_foldback_sensing_to_exregsn_pin(
+   SI32_EXTVREG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EXTVREG_A_CONTROL_FBPINSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_EXTVREG_A_select_foldback_sensing_to_exregsn_pin(SI32_EXTVREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EXTVREG_A_select_foldback_sensing_to_exregsn_pin(basePointer)
 #define SI32_EXTVREG_A_select_foldback_sensing_to_exregsn_pin(basePointer) \
@@ -246,8 +391,19 @@ _SI32_EXTVREG_A_select_foldback_sensing_to_exregsn_pin(SI32_EXTVREG_A_Type* /*ba
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTVREG_A_select_foldback_sensing_to_vregin_pin(
+   SI32_EXTVREG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_EXTVREG_A_CONTROL_FBPINSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_EXTVREG_A_select_foldback_sensing_to_vregin_pin(SI32_EXTVREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EXTVREG_A_select_foldback_sensing_to_vregin_pin(basePointer)
 #define SI32_EXTVREG_A_select_foldback_sensing_to_vregin_pin(basePointer) \
@@ -259,8 +415,19 @@ _SI32_EXTVREG_A_select_foldback_sensing_to_vregin_pin(SI32_EXTVREG_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTVREG_A_enable_module(
+   SI32_EXTVREG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_EXTVREG_A_CONTROL_EVREGEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EXTVREG_A_enable_module(SI32_EXTVREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EXTVREG_A_enable_module(basePointer)
 #define SI32_EXTVREG_A_enable_module(basePointer) \
@@ -272,8 +439,19 @@ _SI32_EXTVREG_A_enable_module(SI32_EXTVREG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTVREG_A_disable_module(
+   SI32_EXTVREG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_EXTVREG_A_CONTROL_EVREGEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EXTVREG_A_disable_module(SI32_EXTVREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EXTVREG_A_disable_module(basePointer)
 #define SI32_EXTVREG_A_disable_module(basePointer) \
@@ -291,9 +469,22 @@ _SI32_EXTVREG_A_disable_module(SI32_EXTVREG_A_Type* /*basePointer*/);
 ///  Valid range is 32 bits.
 ///  Write to CONFIG register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTVREG_A_write_config(
+   SI32_EXTVREG_A_Type * basePointer,
+   // Write to CONFIG register.
+   uint32_t config)
+{
+   //{{
+   basePointer->CONFIG.U32 = config;
+   //}}
+}
+#else
 void
 _SI32_EXTVREG_A_write_config(SI32_EXTVREG_A_Type* /*basePointer*/,
    uint32_t /*config*/);
+#endif
 ///
 /// @def SI32_EXTVREG_A_write_config(basePointer, config)
 #define SI32_EXTVREG_A_write_config(basePointer, config) \
@@ -308,8 +499,19 @@ _SI32_EXTVREG_A_write_config(SI32_EXTVREG_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_EXTVREG_A_read_config(
+   SI32_EXTVREG_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONFIG.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_EXTVREG_A_read_config(SI32_EXTVREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EXTVREG_A_read_config(basePointer)
 #define SI32_EXTVREG_A_read_config(basePointer) \
@@ -337,10 +539,29 @@ _SI32_EXTVREG_A_read_config(SI32_EXTVREG_A_Type* /*basePointer*/);
 ///  Fine current trim, in 0.25 uA steps (0 = 0 uA, 1 = 0.25 uA, 2 = 0.5
 ///  uA, 3 = 0.75 uA).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTVREG_A_set_current_limit_minimum(
+   SI32_EXTVREG_A_Type * basePointer,
+   // Coarse current trim, from 1 uA to 8 uA.
+   SI32_EXTVREG_A_CURRENT_LIMIT_MIN_COARSE_Enum_Type imin,
+   // Fine current trim, in 0.25 uA steps (0 = 0 uA, 1 = 0.25 uA, 2 = 0.5
+   // uA, 3 = 0.75 uA).
+   SI32_EXTVREG_A_CURRENT_LIMIT_MIN_FINE_Enum_Type iminfine)
+{
+   assert((imin >= 1) && (imin <= 8));
+   assert(iminfine <= 3);
+   //{{
+   basePointer->CONFIG.IMIN = imin-1;
+   basePointer->CONFIG.IMINFINE = iminfine;
+   //}}
+}
+#else
 void
 _SI32_EXTVREG_A_set_current_limit_minimum(SI32_EXTVREG_A_Type* /*basePointer*/,
    SI32_EXTVREG_A_CURRENT_LIMIT_MIN_COARSE_Enum_Type, /*imin*/
    SI32_EXTVREG_A_CURRENT_LIMIT_MIN_FINE_Enum_Type /*iminfine*/);
+#endif
 ///
 /// @def SI32_EXTVREG_A_set_current_limit_minimum(basePointer, imin, iminfine)
 #define SI32_EXTVREG_A_set_current_limit_minimum(basePointer, imin, iminfine) do{  \
@@ -361,9 +582,24 @@ _SI32_EXTVREG_A_set_current_limit_minimum(SI32_EXTVREG_A_Type* /*basePointer*/,
 ///  Foldback voltage offset, in 0.5V steps (0 = 0V, 1 = 0.5V, ... 7 =
 ///  3.5V).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTVREG_A_set_foldback_voltage_offset(
+   SI32_EXTVREG_A_Type * basePointer,
+   // Foldback voltage offset, in 0.5V steps (0 = 0V, 1 = 0.5V, ... 7 =
+   // 3.5V).
+   uint32_t fbvoff)
+{
+   assert(fbvoff <= 7);
+   //{{
+   basePointer->CONFIG.FBVOSEL = fbvoff;
+   //}}
+}
+#else
 void
 _SI32_EXTVREG_A_set_foldback_voltage_offset(SI32_EXTVREG_A_Type* /*basePointer*/,
    uint32_t /*fbvoff*/);
+#endif
 ///
 /// @def SI32_EXTVREG_A_set_foldback_voltage_offset(basePointer, fbvoff)
 #define SI32_EXTVREG_A_set_foldback_voltage_offset(basePointer, fbvoff) \
@@ -382,9 +618,24 @@ _SI32_EXTVREG_A_set_foldback_voltage_offset(SI32_EXTVREG_A_Type* /*basePointer*/
 ///  Sets foldback rate (0 = 4uA/V, 1 = 2uA/V, 2 = 1uA/V, 3 = 0.5uA/V, 4 =
 ///  4uA/V, 5 = 8uA/V, 6 = 16uA/V, 7 = 32uA/V).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTVREG_A_set_foldback_rate(
+   SI32_EXTVREG_A_Type * basePointer,
+   // Sets foldback rate (0 = 4uA/V, 1 = 2uA/V, 2 = 1uA/V, 3 = 0.5uA/V, 4 =
+   // 4uA/V, 5 = 8uA/V, 6 = 16uA/V, 7 = 32uA/V).
+   SI32_EXTVREG_A_FOLDBACK_VOLTAGE_OFFSET_Enum_Type fbrate)
+{
+   assert(fbrate <= 7);
+   //{{
+   basePointer->CONFIG.FBRATE = fbrate;
+   //}}
+}
+#else
 void
 _SI32_EXTVREG_A_set_foldback_rate(SI32_EXTVREG_A_Type* /*basePointer*/,
    SI32_EXTVREG_A_FOLDBACK_VOLTAGE_OFFSET_Enum_Type /*fbrate*/);
+#endif
 ///
 /// @def SI32_EXTVREG_A_set_foldback_rate(basePointer, fbrate)
 #define SI32_EXTVREG_A_set_foldback_rate(basePointer, fbrate) \
@@ -402,9 +653,23 @@ _SI32_EXTVREG_A_set_foldback_rate(SI32_EXTVREG_A_Type* /*basePointer*/,
 ///  Valid range is 2 to 9.
 ///  Coarse current limit, in uA.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTVREG_A_set_current_limit_maximum(
+   SI32_EXTVREG_A_Type * basePointer,
+   // Coarse current limit, in uA.
+   SI32_EXTVREG_A_CURRENT_LIMIT_MAX_Enum_Type imax)
+{
+   assert((imax >= 2) && (imax <= 9));
+   //{{
+   basePointer->CONFIG.IMAX = imax-2;
+   //}}
+}
+#else
 void
 _SI32_EXTVREG_A_set_current_limit_maximum(SI32_EXTVREG_A_Type* /*basePointer*/,
    SI32_EXTVREG_A_CURRENT_LIMIT_MAX_Enum_Type /*imax*/);
+#endif
 ///
 /// @def SI32_EXTVREG_A_set_current_limit_maximum(basePointer, imax)
 #define SI32_EXTVREG_A_set_current_limit_maximum(basePointer, imax) \
@@ -423,9 +688,24 @@ _SI32_EXTVREG_A_set_current_limit_maximum(SI32_EXTVREG_A_Type* /*basePointer*/,
 ///  Output voltage times 10 ranging from 18 to 50. (18 = 1.8V, 19 = 1.9V,
 ///  ... 50 = 5.0V).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTVREG_A_set_voltage_output(
+   SI32_EXTVREG_A_Type * basePointer,
+   // Output voltage times 10 ranging from 18 to 50. (18 = 1.8V, 19 = 1.9V,
+   // ... 50 = 5.0V).
+   uint32_t vout)
+{
+   assert((vout >= 18) && (vout <= 50));
+   //{{
+   basePointer->CONFIG.VOUTSEL = vout-18;
+   //}}
+}
+#else
 void
 _SI32_EXTVREG_A_set_voltage_output(SI32_EXTVREG_A_Type* /*basePointer*/,
    uint32_t /*vout*/);
+#endif
 ///
 /// @def SI32_EXTVREG_A_set_voltage_output(basePointer, vout)
 #define SI32_EXTVREG_A_set_voltage_output(basePointer, vout) \
@@ -441,8 +721,19 @@ _SI32_EXTVREG_A_set_voltage_output(SI32_EXTVREG_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_EXTVREG_A_is_max_foldback_reached(
+   SI32_EXTVREG_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->STATUS.FBMAXF);
+   //}}
+}
+#else
 bool
 _SI32_EXTVREG_A_is_max_foldback_reached(SI32_EXTVREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EXTVREG_A_is_max_foldback_reached(basePointer)
 #define SI32_EXTVREG_A_is_max_foldback_reached(basePointer) \
@@ -460,9 +751,22 @@ _SI32_EXTVREG_A_is_max_foldback_reached(SI32_EXTVREG_A_Type* /*basePointer*/);
 ///  Valid range is 32 bits.
 ///  Write to CSCONTROL register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTVREG_A_write_cscontrol(
+   SI32_EXTVREG_A_Type * basePointer,
+   // Write to CSCONTROL register.
+   uint32_t cscontrol)
+{
+   //{{
+   basePointer->CSCONTROL.U32 = cscontrol;
+   //}}
+}
+#else
 void
 _SI32_EXTVREG_A_write_cscontrol(SI32_EXTVREG_A_Type* /*basePointer*/,
    uint32_t /*cscontrol*/);
+#endif
 ///
 /// @def SI32_EXTVREG_A_write_cscontrol(basePointer, cscontrol)
 #define SI32_EXTVREG_A_write_cscontrol(basePointer, cscontrol) \
@@ -477,8 +781,19 @@ _SI32_EXTVREG_A_write_cscontrol(SI32_EXTVREG_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_EXTVREG_A_read_cscontrol(
+   SI32_EXTVREG_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CSCONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_EXTVREG_A_read_cscontrol(SI32_EXTVREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EXTVREG_A_read_cscontrol(basePointer)
 #define SI32_EXTVREG_A_read_cscontrol(basePointer) \
@@ -490,8 +805,19 @@ _SI32_EXTVREG_A_read_cscontrol(SI32_EXTVREG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTVREG_A_enable_current_sense(
+   SI32_EXTVREG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CSCONTROL_SET = SI32_EXTVREG_A_CSCONTROL_ISNSEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EXTVREG_A_enable_current_sense(SI32_EXTVREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EXTVREG_A_enable_current_sense(basePointer)
 #define SI32_EXTVREG_A_enable_current_sense(basePointer) \
@@ -503,8 +829,19 @@ _SI32_EXTVREG_A_enable_current_sense(SI32_EXTVREG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTVREG_A_disable_current_sense(
+   SI32_EXTVREG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CSCONTROL_CLR = SI32_EXTVREG_A_CSCONTROL_ISNSEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EXTVREG_A_disable_current_sense(SI32_EXTVREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EXTVREG_A_disable_current_sense(basePointer)
 #define SI32_EXTVREG_A_disable_current_sense(basePointer) \
@@ -516,8 +853,19 @@ _SI32_EXTVREG_A_disable_current_sense(SI32_EXTVREG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTVREG_A_enable_adc_current_sense(
+   SI32_EXTVREG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CSCONTROL_SET = SI32_EXTVREG_A_CSCONTROL_ADCISNSEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EXTVREG_A_enable_adc_current_sense(SI32_EXTVREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EXTVREG_A_enable_adc_current_sense(basePointer)
 #define SI32_EXTVREG_A_enable_adc_current_sense(basePointer) \
@@ -529,8 +877,19 @@ _SI32_EXTVREG_A_enable_adc_current_sense(SI32_EXTVREG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTVREG_A_disable_adc_current_sense(
+   SI32_EXTVREG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CSCONTROL_CLR = SI32_EXTVREG_A_CSCONTROL_ADCISNSEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_EXTVREG_A_disable_adc_current_sense(SI32_EXTVREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EXTVREG_A_disable_adc_current_sense(basePointer)
 #define SI32_EXTVREG_A_disable_adc_current_sense(basePointer) \
@@ -548,9 +907,22 @@ _SI32_EXTVREG_A_disable_adc_current_sense(SI32_EXTVREG_A_Type* /*basePointer*/);
 ///  Valid range is 32 bits.
 ///  Write to CSCONTROL register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTVREG_A_write_csconfig(
+   SI32_EXTVREG_A_Type * basePointer,
+   // Write to CSCONTROL register.
+   uint32_t csconfig)
+{
+   //{{
+   basePointer->CSCONFIG.U32 = csconfig;
+   //}}
+}
+#else
 void
 _SI32_EXTVREG_A_write_csconfig(SI32_EXTVREG_A_Type* /*basePointer*/,
    uint32_t /*csconfig*/);
+#endif
 ///
 /// @def SI32_EXTVREG_A_write_csconfig(basePointer, csconfig)
 #define SI32_EXTVREG_A_write_csconfig(basePointer, csconfig) \
@@ -565,8 +937,19 @@ _SI32_EXTVREG_A_write_csconfig(SI32_EXTVREG_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_EXTVREG_A_read_csconfig(
+   SI32_EXTVREG_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CSCONFIG.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_EXTVREG_A_read_csconfig(SI32_EXTVREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_EXTVREG_A_read_csconfig(basePointer)
 #define SI32_EXTVREG_A_read_csconfig(basePointer) \
@@ -585,9 +968,24 @@ _SI32_EXTVREG_A_read_csconfig(SI32_EXTVREG_A_Type* /*basePointer*/);
 ///  Selects the ADC current sense gain to: 0 = 16x, 1 = 8x, 2 = 4x, 3 =
 ///  2x, 4 = 1x.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTVREG_A_set_current_sense_adc_channel_gain(
+   SI32_EXTVREG_A_Type * basePointer,
+   // Selects the ADC current sense gain to: 0 = 16x, 1 = 8x, 2 = 4x, 3 =
+   // 2x, 4 = 1x.
+   SI32_EXTVREG_A_ADC_CURRENT_SENSE_GAIN_Enum_Type mode)
+{
+   assert(mode <= 4);
+   //{{
+   basePointer->CSCONFIG.ISADCGAIN = mode;
+   //}}
+}
+#else
 void
 _SI32_EXTVREG_A_set_current_sense_adc_channel_gain(SI32_EXTVREG_A_Type* /*basePointer*/,
    SI32_EXTVREG_A_ADC_CURRENT_SENSE_GAIN_Enum_Type /*mode*/);
+#endif
 ///
 /// @def SI32_EXTVREG_A_set_current_sense_adc_channel_gain(basePointer, mode)
 #define SI32_EXTVREG_A_set_current_sense_adc_channel_gain(basePointer, mode) \
@@ -606,9 +1004,24 @@ _SI32_EXTVREG_A_set_current_sense_adc_channel_gain(SI32_EXTVREG_A_Type* /*basePo
 ///  Selects the external regulator current sense gain to: 0 = 16x, 1 = 8x,
 ///  2 = 4x, 3 = 2x, 4 = 1x.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTVREG_A_set_current_sense_extreg_channel_gain(
+   SI32_EXTVREG_A_Type * basePointer,
+   // Selects the external regulator current sense gain to: 0 = 16x, 1 = 8x,
+   // 2 = 4x, 3 = 2x, 4 = 1x.
+   SI32_EXTVREG_A_REG_CURRENT_SENSE_GAIN_Enum_Type mode)
+{
+   assert(mode <= 4);
+   //{{
+   basePointer->CSCONFIG.ISOGAIN = mode;
+   //}}
+}
+#else
 void
 _SI32_EXTVREG_A_set_current_sense_extreg_channel_gain(SI32_EXTVREG_A_Type* /*basePointer*/,
    SI32_EXTVREG_A_REG_CURRENT_SENSE_GAIN_Enum_Type /*mode*/);
+#endif
 ///
 /// @def SI32_EXTVREG_A_set_current_sense_extreg_channel_gain(basePointer, mode)
 #define SI32_EXTVREG_A_set_current_sense_extreg_channel_gain(basePointer, mode) \
@@ -626,9 +1039,23 @@ _SI32_EXTVREG_A_set_current_sense_extreg_channel_gain(SI32_EXTVREG_A_Type* /*bas
 ///  Valid range is 0 to 2.
 ///  Sets the current sensing mode to 0, 1, or 2.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_EXTVREG_A_set_current_sensing_mode(
+   SI32_EXTVREG_A_Type * basePointer,
+   // Sets the current sensing mode to 0, 1, or 2.
+   uint32_t mode)
+{
+   assert(mode <= 2);
+   //{{
+   basePointer->CSCONFIG.ISINSEL = mode;
+   //}}
+}
+#else
 void
 _SI32_EXTVREG_A_set_current_sensing_mode(SI32_EXTVREG_A_Type* /*basePointer*/,
    uint32_t /*mode*/);
+#endif
 ///
 /// @def SI32_EXTVREG_A_set_current_sensing_mode(basePointer, mode)
 #define SI32_EXTVREG_A_set_current_sensing_mode(basePointer, mode) \
@@ -55,10 +55,26 @@ extern "C" {
 ///  tcontrol
 ///  Write to TCONTROL register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_FLASHCTRL_A_initialize(
+   SI32_FLASHCTRL_A_Type * basePointer,
+   // Write to CONFIG register.
+   uint32_t config,
+   // Write to TCONTROL register.
+   uint32_t tcontrol)
+{
+   //{{
+   basePointer->CONFIG.U32 = config;
+   basePointer->TCONTROL.U32 = tcontrol;
+   //}}
+}
+#else
 void
 _SI32_FLASHCTRL_A_initialize(SI32_FLASHCTRL_A_Type* /*basePointer*/,
    uint32_t, /*config*/
    uint32_t /*tcontrol*/);
+#endif
 ///
 /// @def SI32_FLASHCTRL_A_initialize(basePointer, config, tcontrol)
 #define SI32_FLASHCTRL_A_initialize(basePointer, config, tcontrol) do{  \
@@ -79,9 +95,21 @@ _SI32_FLASHCTRL_A_initialize(SI32_FLASHCTRL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  config
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_FLASHCTRL_A_write_config(
+   SI32_FLASHCTRL_A_Type * basePointer,
+   uint32_t config)
+{
+   //{{
+   basePointer->CONFIG.U32 = config;
+   //}}
+}
+#else
 void
 _SI32_FLASHCTRL_A_write_config(SI32_FLASHCTRL_A_Type* /*basePointer*/,
    uint32_t /*config*/);
+#endif
 ///
 /// @def SI32_FLASHCTRL_A_write_config(basePointer, config)
 #define SI32_FLASHCTRL_A_write_config(basePointer, config) \
@@ -96,8 +124,19 @@ _SI32_FLASHCTRL_A_write_config(SI32_FLASHCTRL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_FLASHCTRL_A_read_config(
+   SI32_FLASHCTRL_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONFIG.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_FLASHCTRL_A_read_config(SI32_FLASHCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_FLASHCTRL_A_read_config(basePointer)
 #define SI32_FLASHCTRL_A_read_config(basePointer) \
@@ -118,9 +157,23 @@ _SI32_FLASHCTRL_A_read_config(SI32_FLASHCTRL_A_Type* /*basePointer*/);
 ///  mode
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_FLASHCTRL_A_select_flash_speed_mode(
+   SI32_FLASHCTRL_A_Type * basePointer,
+   uint32_t mode)
+{
+   assert(mode < 4);   // mode < 2^2
+   //{{
+   basePointer->CONFIG_CLR = SI32_FLASHCTRL_A_CONFIG_SPMD_MASK;
+   basePointer->CONFIG_SET = mode;
+   //}}
+}
+#else
 void
 _SI32_FLASHCTRL_A_select_flash_speed_mode(SI32_FLASHCTRL_A_Type* /*basePointer*/,
    uint32_t /*mode*/);
+#endif
 ///
 /// @def SI32_FLASHCTRL_A_select_flash_speed_mode(basePointer, mode)
 #define SI32_FLASHCTRL_A_select_flash_speed_mode(basePointer, mode) do{  \
@@ -137,8 +190,19 @@ _SI32_FLASHCTRL_A_select_flash_speed_mode(SI32_FLASHCTRL_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_FLASHCTRL_A_enter_read_store_mode(
+   SI32_FLASHCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_FLASHCTRL_A_CONFIG_RDSEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_FLASHCTRL_A_enter_read_store_mode(SI32_FLASHCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_FLASHCTRL_A_enter_read_store_mode(basePointer)
 #define SI32_FLASHCTRL_A_enter_read_store_mode(basePointer) \
@@ -154,8 +218,19 @@ _SI32_FLASHCTRL_A_enter_read_store_mode(SI32_FLASHCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_FLASHCTRL_A_exit_read_store_mode(
+   SI32_FLASHCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_FLASHCTRL_A_CONFIG_RDSEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_FLASHCTRL_A_exit_read_store_mode(SI32_FLASHCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_FLASHCTRL_A_exit_read_store_mode(basePointer)
 #define SI32_FLASHCTRL_A_exit_read_store_mode(basePointer) \
@@ -170,8 +245,19 @@ _SI32_FLASHCTRL_A_exit_read_store_mode(SI32_FLASHCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_FLASHCTRL_A_enable_data_prefetch(
+   SI32_FLASHCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_FLASHCTRL_A_CONFIG_DPFEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_FLASHCTRL_A_enable_data_prefetch(SI32_FLASHCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_FLASHCTRL_A_enable_data_prefetch(basePointer)
 #define SI32_FLASHCTRL_A_enable_data_prefetch(basePointer) \
@@ -186,8 +272,19 @@ _SI32_FLASHCTRL_A_enable_data_prefetch(SI32_FLASHCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_FLASHCTRL_A_disable_data_prefetch(
+   SI32_FLASHCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_FLASHCTRL_A_CONFIG_DPFEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_FLASHCTRL_A_disable_data_prefetch(SI32_FLASHCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_FLASHCTRL_A_disable_data_prefetch(basePointer)
 #define SI32_FLASHCTRL_A_disable_data_prefetch(basePointer) \
@@ -202,8 +299,19 @@ _SI32_FLASHCTRL_A_disable_data_prefetch(SI32_FLASHCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_FLASHCTRL_A_enable_prefetch(
+   SI32_FLASHCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_FLASHCTRL_A_CONFIG_PFINH_MASK;
+   //}}
+}
+#else
 void
 _SI32_FLASHCTRL_A_enable_prefetch(SI32_FLASHCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_FLASHCTRL_A_enable_prefetch(basePointer)
 #define SI32_FLASHCTRL_A_enable_prefetch(basePointer) \
@@ -218,8 +326,19 @@ _SI32_FLASHCTRL_A_enable_prefetch(SI32_FLASHCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_FLASHCTRL_A_disable_prefetch(
+   SI32_FLASHCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_FLASHCTRL_A_CONFIG_PFINH_ACTIVE_U32;
+   //}}
+}
+#else
 void
 _SI32_FLASHCTRL_A_disable_prefetch(SI32_FLASHCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_FLASHCTRL_A_disable_prefetch(basePointer)
 #define SI32_FLASHCTRL_A_disable_prefetch(basePointer) \
@@ -238,8 +357,19 @@ _SI32_FLASHCTRL_A_disable_prefetch(SI32_FLASHCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_FLASHCTRL_A_enter_multi_byte_write_mode(
+   SI32_FLASHCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_FLASHCTRL_A_CONFIG_SQWEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_FLASHCTRL_A_enter_multi_byte_write_mode(SI32_FLASHCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_FLASHCTRL_A_enter_multi_byte_write_mode(basePointer)
 #define SI32_FLASHCTRL_A_enter_multi_byte_write_mode(basePointer) \
@@ -255,8 +385,19 @@ _SI32_FLASHCTRL_A_enter_multi_byte_write_mode(SI32_FLASHCTRL_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_FLASHCTRL_A_exit_multi_byte_write_mode(
+   SI32_FLASHCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_FLASHCTRL_A_CONFIG_SQWEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_FLASHCTRL_A_exit_multi_byte_write_mode(SI32_FLASHCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_FLASHCTRL_A_exit_multi_byte_write_mode(basePointer)
 #define SI32_FLASHCTRL_A_exit_multi_byte_write_mode(basePointer) \
@@ -272,8 +413,19 @@ _SI32_FLASHCTRL_A_exit_multi_byte_write_mode(SI32_FLASHCTRL_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_FLASHCTRL_A_enter_flash_erase_mode(
+   SI32_FLASHCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_FLASHCTRL_A_CONFIG_ERASEEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_FLASHCTRL_A_enter_flash_erase_mode(SI32_FLASHCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_FLASHCTRL_A_enter_flash_erase_mode(basePointer)
 #define SI32_FLASHCTRL_A_enter_flash_erase_mode(basePointer) \
@@ -289,8 +441,19 @@ _SI32_FLASHCTRL_A_enter_flash_erase_mode(SI32_FLASHCTRL_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_FLASHCTRL_A_exit_flash_erase_mode(
+   SI32_FLASHCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_FLASHCTRL_A_CONFIG_ERASEEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_FLASHCTRL_A_exit_flash_erase_mode(SI32_FLASHCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_FLASHCTRL_A_exit_flash_erase_mode(basePointer)
 #define SI32_FLASHCTRL_A_exit_flash_erase_mode(basePointer) \
@@ -305,8 +468,19 @@ _SI32_FLASHCTRL_A_exit_flash_erase_mode(SI32_FLASHCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_FLASHCTRL_A_is_flash_busy(
+   SI32_FLASHCTRL_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONFIG.BUSYF);
+   //}}
+}
+#else
 bool
 _SI32_FLASHCTRL_A_is_flash_busy(SI32_FLASHCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_FLASHCTRL_A_is_flash_busy(basePointer)
 #define SI32_FLASHCTRL_A_is_flash_busy(basePointer) \
@@ -322,8 +496,19 @@ _SI32_FLASHCTRL_A_is_flash_busy(SI32_FLASHCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_FLASHCTRL_A_is_buffer_full(
+   SI32_FLASHCTRL_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONFIG.BUFSTS);
+   //}}
+}
+#else
 bool
 _SI32_FLASHCTRL_A_is_buffer_full(SI32_FLASHCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_FLASHCTRL_A_is_buffer_full(basePointer)
 #define SI32_FLASHCTRL_A_is_buffer_full(basePointer) \
@@ -342,9 +527,21 @@ _SI32_FLASHCTRL_A_is_buffer_full(SI32_FLASHCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  address
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_FLASHCTRL_A_write_wraddr(
+   SI32_FLASHCTRL_A_Type * basePointer,
+   uint32_t address)
+{
+   //{{
+   basePointer->WRADDR.U32 = address;
+   //}}
+}
+#else
 void
 _SI32_FLASHCTRL_A_write_wraddr(SI32_FLASHCTRL_A_Type* /*basePointer*/,
    uint32_t /*address*/);
+#endif
 ///
 /// @def SI32_FLASHCTRL_A_write_wraddr(basePointer, address)
 #define SI32_FLASHCTRL_A_write_wraddr(basePointer, address) \
@@ -359,8 +556,19 @@ _SI32_FLASHCTRL_A_write_wraddr(SI32_FLASHCTRL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_FLASHCTRL_A_read_wraddr(
+   SI32_FLASHCTRL_A_Type * basePointer)
+{
+   //{{
+   return (basePointer->WRADDR.U32);
+   //}}
+}
+#else
 uint32_t
 _SI32_FLASHCTRL_A_read_wraddr(SI32_FLASHCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_FLASHCTRL_A_read_wraddr(basePointer)
 #define SI32_FLASHCTRL_A_read_wraddr(basePointer) \
@@ -379,9 +587,21 @@ _SI32_FLASHCTRL_A_read_wraddr(SI32_FLASHCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  dataval
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_FLASHCTRL_A_write_wrdata(
+   SI32_FLASHCTRL_A_Type * basePointer,
+   uint32_t dataval)
+{
+   //{{
+   basePointer->WRDATA.U32 = dataval;
+   //}}
+}
+#else
 void
 _SI32_FLASHCTRL_A_write_wrdata(SI32_FLASHCTRL_A_Type* /*basePointer*/,
    uint32_t /*dataval*/);
+#endif
 ///
 /// @def SI32_FLASHCTRL_A_write_wrdata(basePointer, dataval)
 #define SI32_FLASHCTRL_A_write_wrdata(basePointer, dataval) \
@@ -401,9 +621,22 @@ _SI32_FLASHCTRL_A_write_wrdata(SI32_FLASHCTRL_A_Type* /*basePointer*/,
 ///  key
 ///  Valid range is 8 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_FLASHCTRL_A_write_flash_key(
+   SI32_FLASHCTRL_A_Type * basePointer,
+   uint32_t key)
+{
+   assert(key < 256);   // key < 2^8
+   //{{
+   basePointer->KEY.KEY_BITS = key;
+   //}}
+}
+#else
 void
 _SI32_FLASHCTRL_A_write_flash_key(SI32_FLASHCTRL_A_Type* /*basePointer*/,
    uint32_t /*key*/);
+#endif
 ///
 /// @def SI32_FLASHCTRL_A_write_flash_key(basePointer, key)
 #define SI32_FLASHCTRL_A_write_flash_key(basePointer, key) \
@@ -422,9 +655,21 @@ _SI32_FLASHCTRL_A_write_flash_key(SI32_FLASHCTRL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  tcontrol
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_FLASHCTRL_A_write_tcontrol(
+   SI32_FLASHCTRL_A_Type * basePointer,
+   uint32_t tcontrol)
+{
+   //{{
+   basePointer->TCONTROL.U32 = tcontrol;
+   //}}
+}
+#else
 void
 _SI32_FLASHCTRL_A_write_tcontrol(SI32_FLASHCTRL_A_Type* /*basePointer*/,
    uint32_t /*tcontrol*/);
+#endif
 ///
 /// @def SI32_FLASHCTRL_A_write_tcontrol(basePointer, tcontrol)
 #define SI32_FLASHCTRL_A_write_tcontrol(basePointer, tcontrol) \
@@ -439,8 +684,19 @@ _SI32_FLASHCTRL_A_write_tcontrol(SI32_FLASHCTRL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_FLASHCTRL_A_read_tcontrol(
+   SI32_FLASHCTRL_A_Type * basePointer)
+{
+   //{{
+   return basePointer->TCONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_FLASHCTRL_A_read_tcontrol(SI32_FLASHCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_FLASHCTRL_A_read_tcontrol(basePointer)
 #define SI32_FLASHCTRL_A_read_tcontrol(basePointer) \
@@ -455,8 +711,19 @@ _SI32_FLASHCTRL_A_read_tcontrol(SI32_FLASHCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_FLASHCTRL_A_select_flash_read_time_slow(
+   SI32_FLASHCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->TCONTROL.FLRTMD = SI32_FLASHCTRL_A_TCONTROL_FLRTMD_SLOW_VALUE;
+   //}}
+}
+#else
 void
 _SI32_FLASHCTRL_A_select_flash_read_time_slow(SI32_FLASHCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_FLASHCTRL_A_select_flash_read_time_slow(basePointer)
 #define SI32_FLASHCTRL_A_select_flash_read_time_slow(basePointer) \
@@ -471,8 +738,19 @@ _SI32_FLASHCTRL_A_select_flash_read_time_slow(SI32_FLASHCTRL_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_FLASHCTRL_A_select_flash_read_time_fast(
+   SI32_FLASHCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->TCONTROL.FLRTMD = SI32_FLASHCTRL_A_TCONTROL_FLRTMD_FAST_VALUE;
+   //}}
+}
+#else
 void
 _SI32_FLASHCTRL_A_select_flash_read_time_fast(SI32_FLASHCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_FLASHCTRL_A_select_flash_read_time_fast(basePointer)
 #define SI32_FLASHCTRL_A_select_flash_read_time_fast(basePointer) \
@@ -25,6 +25,9 @@
 // HAL Source: 0.3
 // Version: 10
 
+// Build the out-of-line accessors even when SI32_HAL_INLINE is defined.
+#define SI32_HAL_OUT_OF_LINE
+
 #include <assert.h>
 #include "si32WideTypes.h"
 #include "SI32_I2C_A_Type.h"
@@ -93,6 +93,39 @@ extern "C" {
 ///  Valid range is 32 bits.
 ///  Write to I2CDMA register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_initialize(
+   SI32_I2C_A_Type * basePointer,
+   // Write to CONTROL register.
+   uint32_t control,
+   // Write to CONFIG register.
+   uint32_t config,
+   // Write to SADDRESS register.
+   uint32_t saddress,
+   // Write to SMASK register.
+   uint32_t smask,
+   // Write to TIMER register.
+   uint32_t timer,
+   // Write to TIMERRL register.
+   uint32_t timerrl,
+   // Write to SCONFIG register.
+   uint32_t sconfig,
+   // Write to I2CDMA register.
+   uint32_t i2cdma)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   basePointer->CONFIG.U32 = config;
+   basePointer->SADDRESS.U32 = saddress;
+   basePointer->SMASK.U32 = smask;
+   basePointer->TIMER.U32 = timer;
+   basePointer->TIMERRL.U32 = timerrl;
+   basePointer->SCONFIG.U32 = sconfig;
+   basePointer->I2CDMA.U32 = i2cdma;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_initialize(SI32_I2C_A_Type* /*basePointer*/,
    uint32_t, /*control*/
@@ -103,6 +136,7 @@ _SI32_I2C_A_initialize(SI32_I2C_A_Type* /*basePointer*/,
    uint32_t, /*timerrl*/
    uint32_t, /*sconfig*/
    uint32_t /*i2cdma*/);
+#endif
 ///
 /// @def SI32_I2C_A_initialize(basePointer, control, config, saddress, smask, timer, timerrl, sconfig, i2cdma)
 #define SI32_I2C_A_initialize(basePointer, control, config, saddress, smask, timer, timerrl, sconfig, i2cdma) do{  \
@@ -130,9 +164,21 @@ _SI32_I2C_A_initialize(SI32_I2C_A_Type* /*basePointer*/,
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_write_control(
+   SI32_I2C_A_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_write_control(SI32_I2C_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_I2C_A_write_control(basePointer, control)
 #define SI32_I2C_A_write_control(basePointer, control) \
@@ -147,8 +193,19 @@ _SI32_I2C_A_write_control(SI32_I2C_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_I2C_A_read_control(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_I2C_A_read_control(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_read_control(basePointer)
 #define SI32_I2C_A_read_control(basePointer) \
@@ -160,8 +217,19 @@ _SI32_I2C_A_read_control(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2C_A_is_busy(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.BUSYF);
+   //}}
+}
+#else
 bool
 _SI32_I2C_A_is_busy(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_is_busy(basePointer)
 #define SI32_I2C_A_is_busy(basePointer) \
@@ -177,8 +245,19 @@ _SI32_I2C_A_is_busy(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2C_A_is_ack_received(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.ACK);
+   //}}
+}
+#else
 bool
 _SI32_I2C_A_is_ack_received(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_is_ack_received(basePointer)
 #define SI32_I2C_A_is_ack_received(basePointer) \
@@ -190,8 +269,19 @@ _SI32_I2C_A_is_ack_received(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_send_ack(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_I2C_A_CONTROL_ACK_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_send_ack(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_send_ack(basePointer)
 #define SI32_I2C_A_send_ack(basePointer) \
@@ -203,8 +293,19 @@ _SI32_I2C_A_send_ack(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_send_nack(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_I2C_A_CONTROL_ACK_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_send_nack(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_send_nack(basePointer)
 #define SI32_I2C_A_send_nack(basePointer) \
@@ -216,8 +317,19 @@ _SI32_I2C_A_send_nack(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2C_A_has_arblost_error_occurred(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.ARBLF);
+   //}}
+}
+#else
 bool
 _SI32_I2C_A_has_arblost_error_occurred(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_has_arblost_error_occurred(basePointer)
 #define SI32_I2C_A_has_arblost_error_occurred(basePointer) \
@@ -229,8 +341,19 @@ _SI32_I2C_A_has_arblost_error_occurred(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2C_A_is_ack_requested(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.ACKRQF);
+   //}}
+}
+#else
 bool
 _SI32_I2C_A_is_ack_requested(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_is_ack_requested(basePointer)
 #define SI32_I2C_A_is_ack_requested(basePointer) \
@@ -242,8 +365,19 @@ _SI32_I2C_A_is_ack_requested(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_set_stop(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_I2C_A_CONTROL_STO_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_set_stop(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_set_stop(basePointer)
 #define SI32_I2C_A_set_stop(basePointer) \
@@ -255,8 +389,19 @@ _SI32_I2C_A_set_stop(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_clear_stop(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_I2C_A_CONTROL_STO_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_clear_stop(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_clear_stop(basePointer)
 #define SI32_I2C_A_clear_stop(basePointer) \
@@ -268,8 +413,19 @@ _SI32_I2C_A_clear_stop(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2C_A_is_stop_set(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.STO);
+   //}}
+}
+#else
 bool
 _SI32_I2C_A_is_stop_set(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_is_stop_set(basePointer)
 #define SI32_I2C_A_is_stop_set(basePointer) \
@@ -281,8 +437,19 @@ _SI32_I2C_A_is_stop_set(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_set_start(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_I2C_A_CONTROL_STA_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_set_start(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_set_start(basePointer)
 #define SI32_I2C_A_set_start(basePointer) \
@@ -294,8 +461,19 @@ _SI32_I2C_A_set_start(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_clear_start(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_I2C_A_CONTROL_STA_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_clear_start(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_clear_start(basePointer)
 #define SI32_I2C_A_clear_start(basePointer) \
@@ -307,8 +485,19 @@ _SI32_I2C_A_clear_start(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2C_A_is_start_set(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.STA);
+   //}}
+}
+#else
 bool
 _SI32_I2C_A_is_start_set(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_is_start_set(basePointer)
 #define SI32_I2C_A_is_start_set(basePointer) \
@@ -320,8 +509,19 @@ _SI32_I2C_A_is_start_set(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2C_A_is_tx_mode_enabled(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.TXMDF);
+   //}}
+}
+#else
 bool
 _SI32_I2C_A_is_tx_mode_enabled(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_is_tx_mode_enabled(basePointer)
 #define SI32_I2C_A_is_tx_mode_enabled(basePointer) \
@@ -333,8 +533,19 @@ _SI32_I2C_A_is_tx_mode_enabled(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2C_A_is_master_mode_enabled(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.MSMDF);
+   //}}
+}
+#else
 bool
 _SI32_I2C_A_is_master_mode_enabled(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_is_master_mode_enabled(basePointer)
 #define SI32_I2C_A_is_master_mode_enabled(basePointer) \
@@ -346,8 +557,19 @@ _SI32_I2C_A_is_master_mode_enabled(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_clear_stop_interrupt(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_I2C_A_CONTROL_STOI_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_clear_stop_interrupt(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_clear_stop_interrupt(basePointer)
 #define SI32_I2C_A_clear_stop_interrupt(basePointer) \
@@ -359,8 +581,19 @@ _SI32_I2C_A_clear_stop_interrupt(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2C_A_is_stop_interrupt_pending(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.STOI);
+   //}}
+}
+#else
 bool
 _SI32_I2C_A_is_stop_interrupt_pending(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_is_stop_interrupt_pending(basePointer)
 #define SI32_I2C_A_is_stop_interrupt_pending(basePointer) \
@@ -372,8 +605,19 @@ _SI32_I2C_A_is_stop_interrupt_pending(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_clear_ack_interrupt(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_I2C_A_CONTROL_ACKI_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_clear_ack_interrupt(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_clear_ack_interrupt(basePointer)
 #define SI32_I2C_A_clear_ack_interrupt(basePointer) \
@@ -385,8 +629,19 @@ _SI32_I2C_A_clear_ack_interrupt(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2C_A_is_ack_interrupt_pending(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.ACKI);
+   //}}
+}
+#else
 bool
 _SI32_I2C_A_is_ack_interrupt_pending(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_is_ack_interrupt_pending(basePointer)
 #define SI32_I2C_A_is_ack_interrupt_pending(basePointer) \
@@ -398,8 +653,19 @@ _SI32_I2C_A_is_ack_interrupt_pending(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_clear_rx_interrupt(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_I2C_A_CONTROL_RXI_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_clear_rx_interrupt(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_clear_rx_interrupt(basePointer)
 #define SI32_I2C_A_clear_rx_interrupt(basePointer) \
@@ -411,8 +677,19 @@ _SI32_I2C_A_clear_rx_interrupt(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2C_A_is_rx_interrupt_pending(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.RXI);
+   //}}
+}
+#else
 bool
 _SI32_I2C_A_is_rx_interrupt_pending(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_is_rx_interrupt_pending(basePointer)
 #define SI32_I2C_A_is_rx_interrupt_pending(basePointer) \
@@ -424,8 +701,19 @@ _SI32_I2C_A_is_rx_interrupt_pending(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_clear_tx_interrupt(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_I2C_A_CONTROL_TXI_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_clear_tx_interrupt(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_clear_tx_interrupt(basePointer)
 #define SI32_I2C_A_clear_tx_interrupt(basePointer) \
@@ -437,8 +725,19 @@ _SI32_I2C_A_clear_tx_interrupt(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2C_A_is_tx_interrupt_pending(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.TXI);
+   //}}
+}
+#else
 bool
 _SI32_I2C_A_is_tx_interrupt_pending(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_is_tx_interrupt_pending(basePointer)
 #define SI32_I2C_A_is_tx_interrupt_pending(basePointer) \
@@ -450,8 +749,19 @@ _SI32_I2C_A_is_tx_interrupt_pending(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_clear_start_interrupt(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_I2C_A_CONTROL_STAI_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_clear_start_interrupt(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_clear_start_interrupt(basePointer)
 #define SI32_I2C_A_clear_start_interrupt(basePointer) \
@@ -463,8 +773,19 @@ _SI32_I2C_A_clear_start_interrupt(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2C_A_is_start_interrupt_pending(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.STAI);
+   //}}
+}
+#else
 bool
 _SI32_I2C_A_is_start_interrupt_pending(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_is_start_interrupt_pending(basePointer)
 #define SI32_I2C_A_is_start_interrupt_pending(basePointer) \
@@ -476,8 +797,19 @@ _SI32_I2C_A_is_start_interrupt_pending(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_clear_arblost_interrupt(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_I2C_A_CONTROL_ARBLI_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_clear_arblost_interrupt(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_clear_arblost_interrupt(basePointer)
 #define SI32_I2C_A_clear_arblost_interrupt(basePointer) \
@@ -489,8 +821,19 @@ _SI32_I2C_A_clear_arblost_interrupt(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2C_A_is_arblost_interrupt_pending(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.ARBLI);
+   //}}
+}
+#else
 bool
 _SI32_I2C_A_is_arblost_interrupt_pending(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_is_arblost_interrupt_pending(basePointer)
 #define SI32_I2C_A_is_arblost_interrupt_pending(basePointer) \
@@ -502,8 +845,19 @@ _SI32_I2C_A_is_arblost_interrupt_pending(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_clear_timer0_interrupt(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_I2C_A_CONTROL_T0I_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_clear_timer0_interrupt(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_clear_timer0_interrupt(basePointer)
 #define SI32_I2C_A_clear_timer0_interrupt(basePointer) \
@@ -522,8 +876,19 @@ _SI32_I2C_A_clear_timer0_interrupt(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2C_A_is_timer0_interrupt_pending(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.T0I);
+   //}}
+}
+#else
 bool
 _SI32_I2C_A_is_timer0_interrupt_pending(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_is_timer0_interrupt_pending(basePointer)
 #define SI32_I2C_A_is_timer0_interrupt_pending(basePointer) \
@@ -535,8 +900,19 @@ _SI32_I2C_A_is_timer0_interrupt_pending(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_clear_timer1_interrupt(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_I2C_A_CONTROL_T1I_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_clear_timer1_interrupt(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_clear_timer1_interrupt(basePointer)
 #define SI32_I2C_A_clear_timer1_interrupt(basePointer) \
@@ -555,8 +931,19 @@ _SI32_I2C_A_clear_timer1_interrupt(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2C_A_is_timer1_interrupt_pending(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.T1I);
+   //}}
+}
+#else
 bool
 _SI32_I2C_A_is_timer1_interrupt_pending(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_is_timer1_interrupt_pending(basePointer)
 #define SI32_I2C_A_is_timer1_interrupt_pending(basePointer) \
@@ -568,8 +955,19 @@ _SI32_I2C_A_is_timer1_interrupt_pending(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_clear_timer2_interrupt(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_I2C_A_CONTROL_T2I_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_clear_timer2_interrupt(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_clear_timer2_interrupt(basePointer)
 #define SI32_I2C_A_clear_timer2_interrupt(basePointer) \
@@ -588,8 +986,19 @@ _SI32_I2C_A_clear_timer2_interrupt(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2C_A_is_timer2_interrupt_pending(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.T2I);
+   //}}
+}
+#else
 bool
 _SI32_I2C_A_is_timer2_interrupt_pending(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_is_timer2_interrupt_pending(basePointer)
 #define SI32_I2C_A_is_timer2_interrupt_pending(basePointer) \
@@ -601,8 +1010,19 @@ _SI32_I2C_A_is_timer2_interrupt_pending(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_clear_timer3_interrupt(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_I2C_A_CONTROL_T3I_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_clear_timer3_interrupt(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_clear_timer3_interrupt(basePointer)
 #define SI32_I2C_A_clear_timer3_interrupt(basePointer) \
@@ -621,8 +1041,19 @@ _SI32_I2C_A_clear_timer3_interrupt(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2C_A_is_timer3_interrupt_pending(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.T3I);
+   //}}
+}
+#else
 bool
 _SI32_I2C_A_is_timer3_interrupt_pending(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_is_timer3_interrupt_pending(basePointer)
 #define SI32_I2C_A_is_timer3_interrupt_pending(basePointer) \
@@ -634,8 +1065,19 @@ _SI32_I2C_A_is_timer3_interrupt_pending(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_arm_rx(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_I2C_A_CONTROL_RXARM_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_arm_rx(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_arm_rx(basePointer)
 #define SI32_I2C_A_arm_rx(basePointer) \
@@ -647,8 +1089,19 @@ _SI32_I2C_A_arm_rx(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_disarm_rx(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_I2C_A_CONTROL_RXARM_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_disarm_rx(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_disarm_rx(basePointer)
 #define SI32_I2C_A_disarm_rx(basePointer) \
@@ -664,8 +1117,19 @@ _SI32_I2C_A_disarm_rx(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2C_A_is_rx_in_progress(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.RXARM);
+   //}}
+}
+#else
 bool
 _SI32_I2C_A_is_rx_in_progress(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_is_rx_in_progress(basePointer)
 #define SI32_I2C_A_is_rx_in_progress(basePointer) \
@@ -677,8 +1141,19 @@ _SI32_I2C_A_is_rx_in_progress(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_arm_tx(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_I2C_A_CONTROL_TXARM_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_arm_tx(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_arm_tx(basePointer)
 #define SI32_I2C_A_arm_tx(basePointer) \
@@ -690,8 +1165,19 @@ _SI32_I2C_A_arm_tx(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_disarm_tx(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_I2C_A_CONTROL_TXARM_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_disarm_tx(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_disarm_tx(basePointer)
 #define SI32_I2C_A_disarm_tx(basePointer) \
@@ -707,8 +1193,19 @@ _SI32_I2C_A_disarm_tx(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2C_A_is_tx_in_progress(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.TXARM);
+   //}}
+}
+#else
 bool
 _SI32_I2C_A_is_tx_in_progress(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_is_tx_in_progress(basePointer)
 #define SI32_I2C_A_is_tx_in_progress(basePointer) \
@@ -724,8 +1221,19 @@ _SI32_I2C_A_is_tx_in_progress(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2C_A_is_general_call_address_detected(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.GCEN);
+   //}}
+}
+#else
 bool
 _SI32_I2C_A_is_general_call_address_detected(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_is_general_call_address_detected(basePointer)
 #define SI32_I2C_A_is_general_call_address_detected(basePointer) \
@@ -737,8 +1245,19 @@ _SI32_I2C_A_is_general_call_address_detected(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_enable_auto_tx_or_rx(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_I2C_A_CONTROL_ATXRXEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_enable_auto_tx_or_rx(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_enable_auto_tx_or_rx(basePointer)
 #define SI32_I2C_A_enable_auto_tx_or_rx(basePointer) \
@@ -750,8 +1269,19 @@ _SI32_I2C_A_enable_auto_tx_or_rx(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_disable_auto_tx_or_rx(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_I2C_A_CONTROL_ATXRXEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_disable_auto_tx_or_rx(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_disable_auto_tx_or_rx(basePointer)
 #define SI32_I2C_A_disable_auto_tx_or_rx(basePointer) \
@@ -763,8 +1293,19 @@ _SI32_I2C_A_disable_auto_tx_or_rx(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_enable_input_filter(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_I2C_A_CONTROL_FMD_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_enable_input_filter(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_enable_input_filter(basePointer)
 #define SI32_I2C_A_enable_input_filter(basePointer) \
@@ -776,8 +1317,19 @@ _SI32_I2C_A_enable_input_filter(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_disable_input_filter(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_I2C_A_CONTROL_FMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_disable_input_filter(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_disable_input_filter(basePointer)
 #define SI32_I2C_A_disable_input_filter(basePointer) \
@@ -792,8 +1344,19 @@ _SI32_I2C_A_disable_input_filter(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_enable_stall_in_debug_mode(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_I2C_A_CONTROL_DBGMD_HALT_U32;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_enable_stall_in_debug_mode(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_enable_stall_in_debug_mode(basePointer)
 #define SI32_I2C_A_enable_stall_in_debug_mode(basePointer) \
@@ -808,8 +1371,19 @@ _SI32_I2C_A_enable_stall_in_debug_mode(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_disable_stall_in_debug_mode(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_I2C_A_CONTROL_DBGMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_disable_stall_in_debug_mode(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_disable_stall_in_debug_mode(basePointer)
 #define SI32_I2C_A_disable_stall_in_debug_mode(basePointer) \
@@ -821,8 +1395,19 @@ _SI32_I2C_A_disable_stall_in_debug_mode(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_enable_slave_mode(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_I2C_A_CONTROL_SMINH_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_enable_slave_mode(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_enable_slave_mode(basePointer)
 #define SI32_I2C_A_enable_slave_mode(basePointer) \
@@ -834,8 +1419,19 @@ _SI32_I2C_A_enable_slave_mode(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_disable_slave_mode(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_I2C_A_CONTROL_SMINH_ACTIVE_U32;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_disable_slave_mode(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_disable_slave_mode(basePointer)
 #define SI32_I2C_A_disable_slave_mode(basePointer) \
@@ -847,8 +1443,19 @@ _SI32_I2C_A_disable_slave_mode(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_enable_auto_ack(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_I2C_A_CONTROL_HACKEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_enable_auto_ack(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_enable_auto_ack(basePointer)
 #define SI32_I2C_A_enable_auto_ack(basePointer) \
@@ -860,8 +1467,19 @@ _SI32_I2C_A_enable_auto_ack(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_disable_auto_ack(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_I2C_A_CONTROL_HACKEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_disable_auto_ack(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_disable_auto_ack(basePointer)
 #define SI32_I2C_A_disable_auto_ack(basePointer) \
@@ -873,8 +1491,19 @@ _SI32_I2C_A_disable_auto_ack(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_enable_last_byte_ack(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_I2C_A_CONTROL_LBACKEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_enable_last_byte_ack(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_enable_last_byte_ack(basePointer)
 #define SI32_I2C_A_enable_last_byte_ack(basePointer) \
@@ -886,8 +1515,19 @@ _SI32_I2C_A_enable_last_byte_ack(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_disable_last_byte_ack(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_I2C_A_CONTROL_LBACKEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_disable_last_byte_ack(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_disable_last_byte_ack(basePointer)
 #define SI32_I2C_A_disable_last_byte_ack(basePointer) \
@@ -899,8 +1539,19 @@ _SI32_I2C_A_disable_last_byte_ack(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_enable_general_call_address_decode(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_I2C_A_CONTROL_GCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_enable_general_call_address_decode(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_enable_general_call_address_decode(basePointer)
 #define SI32_I2C_A_enable_general_call_address_decode(basePointer) \
@@ -912,8 +1563,19 @@ _SI32_I2C_A_enable_general_call_address_decode(SI32_I2C_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_disable_general_call_address_decode(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_I2C_A_CONTROL_GCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_disable_general_call_address_decode(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_disable_general_call_address_decode(basePointer)
 #define SI32_I2C_A_disable_general_call_address_decode(basePointer) \
@@ -925,8 +1587,20 @@ _SI32_I2C_A_disable_general_call_address_decode(SI32_I2C_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_reset_module(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_I2C_A_CONTROL_RESET_MASK;
+   basePointer->CONTROL_CLR = SI32_I2C_A_CONTROL_RESET_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_reset_module(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_reset_module(basePointer)
 #define SI32_I2C_A_reset_module(basePointer) do{  \
@@ -940,8 +1614,19 @@ _SI32_I2C_A_reset_module(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_enable_module(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_I2C_A_CONTROL_I2CEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_enable_module(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_enable_module(basePointer)
 #define SI32_I2C_A_enable_module(basePointer) \
@@ -953,8 +1638,19 @@ _SI32_I2C_A_enable_module(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_disable_module(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_I2C_A_CONTROL_I2CEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_disable_module(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_disable_module(basePointer)
 #define SI32_I2C_A_disable_module(basePointer) \
@@ -974,9 +1670,21 @@ _SI32_I2C_A_disable_module(SI32_I2C_A_Type* /*basePointer*/);
 ///  config
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_write_config(
+   SI32_I2C_A_Type * basePointer,
+   uint32_t config)
+{
+   //{{
+   basePointer->CONFIG.U32 = config;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_write_config(SI32_I2C_A_Type* /*basePointer*/,
    uint32_t /*config*/);
+#endif
 ///
 /// @def SI32_I2C_A_write_config(basePointer, config)
 #define SI32_I2C_A_write_config(basePointer, config) \
@@ -991,8 +1699,19 @@ _SI32_I2C_A_write_config(SI32_I2C_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_I2C_A_read_config(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONFIG.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_I2C_A_read_config(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_read_config(basePointer)
 #define SI32_I2C_A_read_config(basePointer) \
@@ -1009,9 +1728,22 @@ _SI32_I2C_A_read_config(SI32_I2C_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 6 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_set_scaler_value(
+   SI32_I2C_A_Type * basePointer,
+   uint32_t value)
+{
+   assert(value < 64);   // value < 2^6
+   //{{
+   basePointer->CONFIG.SCALER = value;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_set_scaler_value(SI32_I2C_A_Type* /*basePointer*/,
    uint32_t /*value*/);
+#endif
 ///
 /// @def SI32_I2C_A_set_scaler_value(basePointer, value)
 #define SI32_I2C_A_set_scaler_value(basePointer, value) \
@@ -1023,8 +1755,19 @@ _SI32_I2C_A_set_scaler_value(SI32_I2C_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_I2C_A_get_scaler_value(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONFIG.SCALER;
+   //}}
+}
+#else
 uint32_t
 _SI32_I2C_A_get_scaler_value(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_get_scaler_value(basePointer)
 #define SI32_I2C_A_get_scaler_value(basePointer) \
@@ -1036,8 +1779,19 @@ _SI32_I2C_A_get_scaler_value(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_enable_stop_interrupt(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_I2C_A_CONFIG_STOIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_enable_stop_interrupt(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_enable_stop_interrupt(basePointer)
 #define SI32_I2C_A_enable_stop_interrupt(basePointer) \
@@ -1049,8 +1803,19 @@ _SI32_I2C_A_enable_stop_interrupt(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_disable_stop_interrupt(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_I2C_A_CONFIG_STOIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_disable_stop_interrupt(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_disable_stop_interrupt(basePointer)
 #define SI32_I2C_A_disable_stop_interrupt(basePointer) \
@@ -1062,8 +1827,19 @@ _SI32_I2C_A_disable_stop_interrupt(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2C_A_is_stop_interrupt_enabled(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONFIG.STOIEN);
+   //}}
+}
+#else
 bool
 _SI32_I2C_A_is_stop_interrupt_enabled(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_is_stop_interrupt_enabled(basePointer)
 #define SI32_I2C_A_is_stop_interrupt_enabled(basePointer) \
@@ -1075,8 +1851,19 @@ _SI32_I2C_A_is_stop_interrupt_enabled(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_enable_ack_interrupt(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_I2C_A_CONFIG_ACKIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_enable_ack_interrupt(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_enable_ack_interrupt(basePointer)
 #define SI32_I2C_A_enable_ack_interrupt(basePointer) \
@@ -1088,8 +1875,19 @@ _SI32_I2C_A_enable_ack_interrupt(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_disable_ack_interrupt(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_I2C_A_CONFIG_ACKIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_disable_ack_interrupt(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_disable_ack_interrupt(basePointer)
 #define SI32_I2C_A_disable_ack_interrupt(basePointer) \
@@ -1101,8 +1899,19 @@ _SI32_I2C_A_disable_ack_interrupt(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2C_A_is_ack_interrupt_enabled(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONFIG.ACKIEN);
+   //}}
+}
+#else
 bool
 _SI32_I2C_A_is_ack_interrupt_enabled(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_is_ack_interrupt_enabled(basePointer)
 #define SI32_I2C_A_is_ack_interrupt_enabled(basePointer) \
@@ -1114,8 +1923,19 @@ _SI32_I2C_A_is_ack_interrupt_enabled(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_enable_rx_interrupt(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_I2C_A_CONFIG_RXIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_enable_rx_interrupt(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_enable_rx_interrupt(basePointer)
 #define SI32_I2C_A_enable_rx_interrupt(basePointer) \
@@ -1127,8 +1947,19 @@ _SI32_I2C_A_enable_rx_interrupt(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_disable_rx_interrupt(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_I2C_A_CONFIG_RXIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_disable_rx_interrupt(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_disable_rx_interrupt(basePointer)
 #define SI32_I2C_A_disable_rx_interrupt(basePointer) \
@@ -1140,8 +1971,19 @@ _SI32_I2C_A_disable_rx_interrupt(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2C_A_is_rx_interrupt_enabled(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONFIG.RXIEN);
+   //}}
+}
+#else
 bool
 _SI32_I2C_A_is_rx_interrupt_enabled(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_is_rx_interrupt_enabled(basePointer)
 #define SI32_I2C_A_is_rx_interrupt_enabled(basePointer) \
@@ -1153,8 +1995,19 @@ _SI32_I2C_A_is_rx_interrupt_enabled(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_enable_tx_interrupt(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_I2C_A_CONFIG_TXIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_enable_tx_interrupt(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_enable_tx_interrupt(basePointer)
 #define SI32_I2C_A_enable_tx_interrupt(basePointer) \
@@ -1166,8 +2019,19 @@ _SI32_I2C_A_enable_tx_interrupt(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_disable_tx_interrupt(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_I2C_A_CONFIG_TXIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_disable_tx_interrupt(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_disable_tx_interrupt(basePointer)
 #define SI32_I2C_A_disable_tx_interrupt(basePointer) \
@@ -1179,8 +2043,19 @@ _SI32_I2C_A_disable_tx_interrupt(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2C_A_is_tx_interrupt_enabled(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONFIG.TXIEN);
+   //}}
+}
+#else
 bool
 _SI32_I2C_A_is_tx_interrupt_enabled(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_is_tx_interrupt_enabled(basePointer)
 #define SI32_I2C_A_is_tx_interrupt_enabled(basePointer) \
@@ -1192,8 +2067,19 @@ _SI32_I2C_A_is_tx_interrupt_enabled(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_enable_start_interrupt(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_I2C_A_CONFIG_STAIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_enable_start_interrupt(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_enable_start_interrupt(basePointer)
 #define SI32_I2C_A_enable_start_interrupt(basePointer) \
@@ -1205,8 +2091,19 @@ _SI32_I2C_A_enable_start_interrupt(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_disable_start_interrupt(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_I2C_A_CONFIG_STAIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_disable_start_interrupt(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_disable_start_interrupt(basePointer)
 #define SI32_I2C_A_disable_start_interrupt(basePointer) \
@@ -1218,8 +2115,19 @@ _SI32_I2C_A_disable_start_interrupt(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2C_A_is_start_interrupt_enabled(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONFIG.STAIEN);
+   //}}
+}
+#else
 bool
 _SI32_I2C_A_is_start_interrupt_enabled(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_is_start_interrupt_enabled(basePointer)
 #define SI32_I2C_A_is_start_interrupt_enabled(basePointer) \
@@ -1231,8 +2139,19 @@ _SI32_I2C_A_is_start_interrupt_enabled(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_enable_arblost_interrupt(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_I2C_A_CONFIG_ARBLIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_enable_arblost_interrupt(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_enable_arblost_interrupt(basePointer)
 #define SI32_I2C_A_enable_arblost_interrupt(basePointer) \
@@ -1244,8 +2163,19 @@ _SI32_I2C_A_enable_arblost_interrupt(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_disable_arblost_interrupt(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_I2C_A_CONFIG_ARBLIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_disable_arblost_interrupt(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_disable_arblost_interrupt(basePointer)
 #define SI32_I2C_A_disable_arblost_interrupt(basePointer) \
@@ -1257,8 +2187,19 @@ _SI32_I2C_A_disable_arblost_interrupt(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2C_A_is_arblost_interrupt_enabled(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONFIG.ARBLIEN);
+   //}}
+}
+#else
 bool
 _SI32_I2C_A_is_arblost_interrupt_enabled(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_is_arblost_interrupt_enabled(basePointer)
 #define SI32_I2C_A_is_arblost_interrupt_enabled(basePointer) \
@@ -1273,8 +2214,19 @@ _SI32_I2C_A_is_arblost_interrupt_enabled(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_enable_timer0_interrupt(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_I2C_A_CONFIG_T0IEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_enable_timer0_interrupt(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_enable_timer0_interrupt(basePointer)
 #define SI32_I2C_A_enable_timer0_interrupt(basePointer) \
@@ -1286,8 +2238,19 @@ _SI32_I2C_A_enable_timer0_interrupt(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_disable_timer0_interrupt(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_I2C_A_CONFIG_T0IEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_disable_timer0_interrupt(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_disable_timer0_interrupt(basePointer)
 #define SI32_I2C_A_disable_timer0_interrupt(basePointer) \
@@ -1299,8 +2262,19 @@ _SI32_I2C_A_disable_timer0_interrupt(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2C_A_is_timer0_interrupt_enabled(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONFIG.T0IEN);
+   //}}
+}
+#else
 bool
 _SI32_I2C_A_is_timer0_interrupt_enabled(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_is_timer0_interrupt_enabled(basePointer)
 #define SI32_I2C_A_is_timer0_interrupt_enabled(basePointer) \
@@ -1315,8 +2289,19 @@ _SI32_I2C_A_is_timer0_interrupt_enabled(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_enable_timer1_interrupt(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_I2C_A_CONFIG_T1IEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_enable_timer1_interrupt(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_enable_timer1_interrupt(basePointer)
 #define SI32_I2C_A_enable_timer1_interrupt(basePointer) \
@@ -1328,8 +2313,19 @@ _SI32_I2C_A_enable_timer1_interrupt(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_disable_timer1_interrupt(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_I2C_A_CONFIG_T1IEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_disable_timer1_interrupt(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_disable_timer1_interrupt(basePointer)
 #define SI32_I2C_A_disable_timer1_interrupt(basePointer) \
@@ -1341,8 +2337,19 @@ _SI32_I2C_A_disable_timer1_interrupt(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2C_A_is_timer1_interrupt_enabled(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONFIG.T1IEN);
+   //}}
+}
+#else
 bool
 _SI32_I2C_A_is_timer1_interrupt_enabled(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_is_timer1_interrupt_enabled(basePointer)
 #define SI32_I2C_A_is_timer1_interrupt_enabled(basePointer) \
@@ -1357,8 +2364,19 @@ _SI32_I2C_A_is_timer1_interrupt_enabled(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_enable_timer2_interrupt(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_I2C_A_CONFIG_T2IEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_enable_timer2_interrupt(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_enable_timer2_interrupt(basePointer)
 #define SI32_I2C_A_enable_timer2_interrupt(basePointer) \
@@ -1370,8 +2388,19 @@ _SI32_I2C_A_enable_timer2_interrupt(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_disable_timer2_interrupt(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_I2C_A_CONFIG_T2IEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_disable_timer2_interrupt(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_disable_timer2_interrupt(basePointer)
 #define SI32_I2C_A_disable_timer2_interrupt(basePointer) \
@@ -1383,8 +2412,19 @@ _SI32_I2C_A_disable_timer2_interrupt(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2C_A_is_timer2_interrupt_enabled(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONFIG.T2IEN);
+   //}}
+}
+#else
 bool
 _SI32_I2C_A_is_timer2_interrupt_enabled(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_is_timer2_interrupt_enabled(basePointer)
 #define SI32_I2C_A_is_timer2_interrupt_enabled(basePointer) \
@@ -1399,8 +2439,19 @@ _SI32_I2C_A_is_timer2_interrupt_enabled(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_enable_timer3_interrupt(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_I2C_A_CONFIG_T3IEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_enable_timer3_interrupt(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_enable_timer3_interrupt(basePointer)
 #define SI32_I2C_A_enable_timer3_interrupt(basePointer) \
@@ -1412,8 +2463,19 @@ _SI32_I2C_A_enable_timer3_interrupt(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_disable_timer3_interrupt(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_I2C_A_CONFIG_T3IEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_disable_timer3_interrupt(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_disable_timer3_interrupt(basePointer)
 #define SI32_I2C_A_disable_timer3_interrupt(basePointer) \
@@ -1425,8 +2487,19 @@ _SI32_I2C_A_disable_timer3_interrupt(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2C_A_is_timer3_interrupt_enabled(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONFIG.T3IEN);
+   //}}
+}
+#else
 bool
 _SI32_I2C_A_is_timer3_interrupt_enabled(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_is_timer3_interrupt_enabled(basePointer)
 #define SI32_I2C_A_is_timer3_interrupt_enabled(basePointer) \
@@ -1444,8 +2517,19 @@ _SI32_I2C_A_is_timer3_interrupt_enabled(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_I2C_A_get_byte_count(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONFIG.BC;
+   //}}
+}
+#else
 uint32_t
 _SI32_I2C_A_get_byte_count(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_get_byte_count(basePointer)
 #define SI32_I2C_A_get_byte_count(basePointer) \
@@ -1466,9 +2550,23 @@ _SI32_I2C_A_get_byte_count(SI32_I2C_A_Type* /*basePointer*/);
 ///  Valid range is 2 bits.
 ///  0 = four bytes, 1 = one byte, 2 = two bytes, and 3 = three bytes.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_set_byte_count(
+   SI32_I2C_A_Type * basePointer,
+   // 0 = four bytes, 1 = one byte, 2 = two bytes, and 3 = three bytes.
+   uint32_t value)
+{
+   assert(value < 4);   // value < 2^2
+   //{{
+   basePointer->CONFIG.BC = value;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_set_byte_count(SI32_I2C_A_Type* /*basePointer*/,
    uint32_t /*value*/);
+#endif
 ///
 /// @def SI32_I2C_A_set_byte_count(basePointer, value)
 #define SI32_I2C_A_set_byte_count(basePointer, value) \
@@ -1485,8 +2583,19 @@ _SI32_I2C_A_set_byte_count(SI32_I2C_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_I2C_A_get_byte_pointer(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONFIG.BP;
+   //}}
+}
+#else
 uint32_t
 _SI32_I2C_A_get_byte_pointer(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_get_byte_pointer(basePointer)
 #define SI32_I2C_A_get_byte_pointer(basePointer) \
@@ -1498,8 +2607,19 @@ _SI32_I2C_A_get_byte_pointer(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_start_timer0(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_I2C_A_CONFIG_T0RUN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_start_timer0(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_start_timer0(basePointer)
 #define SI32_I2C_A_start_timer0(basePointer) \
@@ -1511,8 +2631,19 @@ _SI32_I2C_A_start_timer0(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_stop_timer0(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_I2C_A_CONFIG_T0RUN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_stop_timer0(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_stop_timer0(basePointer)
 #define SI32_I2C_A_stop_timer0(basePointer) \
@@ -1524,8 +2655,19 @@ _SI32_I2C_A_stop_timer0(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_start_timer1(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_I2C_A_CONFIG_T1RUN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_start_timer1(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_start_timer1(basePointer)
 #define SI32_I2C_A_start_timer1(basePointer) \
@@ -1537,8 +2679,19 @@ _SI32_I2C_A_start_timer1(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_stop_timer1(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_I2C_A_CONFIG_T1RUN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_stop_timer1(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_stop_timer1(basePointer)
 #define SI32_I2C_A_stop_timer1(basePointer) \
@@ -1550,8 +2703,19 @@ _SI32_I2C_A_stop_timer1(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_start_timer2(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_I2C_A_CONFIG_T2RUN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_start_timer2(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_start_timer2(basePointer)
 #define SI32_I2C_A_start_timer2(basePointer) \
@@ -1563,8 +2727,19 @@ _SI32_I2C_A_start_timer2(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_stop_timer2(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_I2C_A_CONFIG_T2RUN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_stop_timer2(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_stop_timer2(basePointer)
 #define SI32_I2C_A_stop_timer2(basePointer) \
@@ -1576,8 +2751,19 @@ _SI32_I2C_A_stop_timer2(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_start_timer3(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_I2C_A_CONFIG_T3RUN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_start_timer3(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_start_timer3(basePointer)
 #define SI32_I2C_A_start_timer3(basePointer) \
@@ -1589,8 +2775,19 @@ _SI32_I2C_A_start_timer3(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_stop_timer3(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_I2C_A_CONFIG_T3RUN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_stop_timer3(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_stop_timer3(basePointer)
 #define SI32_I2C_A_stop_timer3(basePointer) \
@@ -1605,8 +2802,19 @@ _SI32_I2C_A_stop_timer3(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_enter_32bit_timer_mode(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_I2C_A_CONFIG_TMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_enter_32bit_timer_mode(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_enter_32bit_timer_mode(basePointer)
 #define SI32_I2C_A_enter_32bit_timer_mode(basePointer) \
@@ -1621,8 +2829,20 @@ _SI32_I2C_A_enter_32bit_timer_mode(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_enter_16bit_timer_mode(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_I2C_A_CONFIG_TMD_MASK;
+   basePointer->CONFIG_SET = SI32_I2C_A_CONFIG_TMD_MODE1_U32;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_enter_16bit_timer_mode(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_enter_16bit_timer_mode(basePointer)
 #define SI32_I2C_A_enter_16bit_timer_mode(basePointer) do{  \
@@ -1640,8 +2860,20 @@ _SI32_I2C_A_enter_16bit_timer_mode(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_enter_8bit_timer_mode(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_I2C_A_CONFIG_TMD_MASK;
+   basePointer->CONFIG_SET = SI32_I2C_A_CONFIG_TMD_MODE2_U32;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_enter_8bit_timer_mode(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_enter_8bit_timer_mode(basePointer)
 #define SI32_I2C_A_enter_8bit_timer_mode(basePointer) do{  \
@@ -1659,8 +2891,19 @@ _SI32_I2C_A_enter_8bit_timer_mode(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_enter_16bit_two_8bit_timer_mode(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_I2C_A_CONFIG_TMD_MODE3_U32;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_enter_16bit_two_8bit_timer_mode(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_enter_16bit_two_8bit_timer_mode(basePointer)
 #define SI32_I2C_A_enter_16bit_two_8bit_timer_mode(basePointer) \
@@ -1672,8 +2915,19 @@ _SI32_I2C_A_enter_16bit_two_8bit_timer_mode(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_enable_all_timers(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_I2C_A_CONFIG_TIMEREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_enable_all_timers(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_enable_all_timers(basePointer)
 #define SI32_I2C_A_enable_all_timers(basePointer) \
@@ -1685,8 +2939,19 @@ _SI32_I2C_A_enable_all_timers(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_disable_all_timers(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_I2C_A_CONFIG_TIMEREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_disable_all_timers(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_disable_all_timers(basePointer)
 #define SI32_I2C_A_disable_all_timers(basePointer) \
@@ -1706,9 +2971,21 @@ _SI32_I2C_A_disable_all_timers(SI32_I2C_A_Type* /*basePointer*/);
 ///  saddress
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_write_saddress(
+   SI32_I2C_A_Type * basePointer,
+   uint32_t saddress)
+{
+   //{{
+   basePointer->SADDRESS.U32 = saddress;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_write_saddress(SI32_I2C_A_Type* /*basePointer*/,
    uint32_t /*saddress*/);
+#endif
 ///
 /// @def SI32_I2C_A_write_saddress(basePointer, saddress)
 #define SI32_I2C_A_write_saddress(basePointer, saddress) \
@@ -1723,8 +3000,19 @@ _SI32_I2C_A_write_saddress(SI32_I2C_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_I2C_A_read_saddress(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return basePointer->SADDRESS.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_I2C_A_read_saddress(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_read_saddress(basePointer)
 #define SI32_I2C_A_read_saddress(basePointer) \
@@ -1744,9 +3032,21 @@ _SI32_I2C_A_read_saddress(SI32_I2C_A_Type* /*basePointer*/);
 ///  smask
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_write_smask(
+   SI32_I2C_A_Type * basePointer,
+   uint32_t smask)
+{
+   //{{
+   basePointer->SMASK.U32 = smask;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_write_smask(SI32_I2C_A_Type* /*basePointer*/,
    uint32_t /*smask*/);
+#endif
 ///
 /// @def SI32_I2C_A_write_smask(basePointer, smask)
 #define SI32_I2C_A_write_smask(basePointer, smask) \
@@ -1761,8 +3061,19 @@ _SI32_I2C_A_write_smask(SI32_I2C_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_I2C_A_read_smask(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return basePointer->SMASK.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_I2C_A_read_smask(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_read_smask(basePointer)
 #define SI32_I2C_A_read_smask(basePointer) \
@@ -1784,9 +3095,21 @@ _SI32_I2C_A_read_smask(SI32_I2C_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_write_data(
+   SI32_I2C_A_Type * basePointer,
+   uint32_t value)
+{
+   //{{
+   basePointer->DATA.DATA_BITS = value;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_write_data(SI32_I2C_A_Type* /*basePointer*/,
    uint32_t /*value*/);
+#endif
 ///
 /// @def SI32_I2C_A_write_data(basePointer, value)
 #define SI32_I2C_A_write_data(basePointer, value) \
@@ -1803,8 +3126,19 @@ _SI32_I2C_A_write_data(SI32_I2C_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_I2C_A_read_data(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DATA.DATA_BITS;
+   //}}
+}
+#else
 uint32_t
 _SI32_I2C_A_read_data(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_read_data(basePointer)
 #define SI32_I2C_A_read_data(basePointer) \
@@ -1824,9 +3158,21 @@ _SI32_I2C_A_read_data(SI32_I2C_A_Type* /*basePointer*/);
 ///  timer
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_write_timer(
+   SI32_I2C_A_Type * basePointer,
+   uint32_t timer)
+{
+   //{{
+   basePointer->TIMER.U32 = timer;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_write_timer(SI32_I2C_A_Type* /*basePointer*/,
    uint32_t /*timer*/);
+#endif
 ///
 /// @def SI32_I2C_A_write_timer(basePointer, timer)
 #define SI32_I2C_A_write_timer(basePointer, timer) \
@@ -1841,8 +3187,19 @@ _SI32_I2C_A_write_timer(SI32_I2C_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_I2C_A_read_timer(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return basePointer->TIMER.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_I2C_A_read_timer(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_read_timer(basePointer)
 #define SI32_I2C_A_read_timer(basePointer) \
@@ -1859,9 +3216,22 @@ _SI32_I2C_A_read_timer(SI32_I2C_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 8 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_set_timer0_u8(
+   SI32_I2C_A_Type * basePointer,
+   uwide8_t value)
+{
+   assert(value < 256);   // value < 2^8
+   //{{
+   basePointer->TIMER.T0 = value;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_set_timer0_u8(SI32_I2C_A_Type* /*basePointer*/,
    uwide8_t /*value*/);
+#endif
 ///
 /// @def SI32_I2C_A_set_timer0_u8(basePointer, value)
 #define SI32_I2C_A_set_timer0_u8(basePointer, value) \
@@ -1873,8 +3243,19 @@ _SI32_I2C_A_set_timer0_u8(SI32_I2C_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide8_t
+_SI32_I2C_A_get_timer0_u8(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return basePointer->TIMER.T0;
+   //}}
+}
+#else
 uwide8_t
 _SI32_I2C_A_get_timer0_u8(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_get_timer0_u8(basePointer)
 #define SI32_I2C_A_get_timer0_u8(basePointer) \
@@ -1891,9 +3272,22 @@ _SI32_I2C_A_get_timer0_u8(SI32_I2C_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 8 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_set_timer1_u8(
+   SI32_I2C_A_Type * basePointer,
+   uwide8_t value)
+{
+   assert(value < 256);   // value < 2^8
+   //{{
+   basePointer->TIMER.T1 = value;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_set_timer1_u8(SI32_I2C_A_Type* /*basePointer*/,
    uwide8_t /*value*/);
+#endif
 ///
 /// @def SI32_I2C_A_set_timer1_u8(basePointer, value)
 #define SI32_I2C_A_set_timer1_u8(basePointer, value) \
@@ -1905,8 +3299,19 @@ _SI32_I2C_A_set_timer1_u8(SI32_I2C_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide8_t
+_SI32_I2C_A_get_timer1_u8(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return basePointer->TIMER.T1;
+   //}}
+}
+#else
 uwide8_t
 _SI32_I2C_A_get_timer1_u8(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_get_timer1_u8(basePointer)
 #define SI32_I2C_A_get_timer1_u8(basePointer) \
@@ -1923,9 +3328,22 @@ _SI32_I2C_A_get_timer1_u8(SI32_I2C_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 8 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_set_timer2_u8(
+   SI32_I2C_A_Type * basePointer,
+   uwide8_t value)
+{
+   assert(value < 256);   // value < 2^8
+   //{{
+   basePointer->TIMER.T2 = value;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_set_timer2_u8(SI32_I2C_A_Type* /*basePointer*/,
    uwide8_t /*value*/);
+#endif
 ///
 /// @def SI32_I2C_A_set_timer2_u8(basePointer, value)
 #define SI32_I2C_A_set_timer2_u8(basePointer, value) \
@@ -1937,8 +3355,19 @@ _SI32_I2C_A_set_timer2_u8(SI32_I2C_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide8_t
+_SI32_I2C_A_get_timer2_u8(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return basePointer->TIMER.T2;
+   //}}
+}
+#else
 uwide8_t
 _SI32_I2C_A_get_timer2_u8(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_get_timer2_u8(basePointer)
 #define SI32_I2C_A_get_timer2_u8(basePointer) \
@@ -1955,9 +3384,22 @@ _SI32_I2C_A_get_timer2_u8(SI32_I2C_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 8 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_set_timer3_u8(
+   SI32_I2C_A_Type * basePointer,
+   uwide8_t value)
+{
+   assert(value < 256);   // value < 2^8
+   //{{
+   basePointer->TIMER.T3 = value;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_set_timer3_u8(SI32_I2C_A_Type* /*basePointer*/,
    uwide8_t /*value*/);
+#endif
 ///
 /// @def SI32_I2C_A_set_timer3_u8(basePointer, value)
 #define SI32_I2C_A_set_timer3_u8(basePointer, value) \
@@ -1969,8 +3411,19 @@ _SI32_I2C_A_set_timer3_u8(SI32_I2C_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide8_t
+_SI32_I2C_A_get_timer3_u8(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return basePointer->TIMER.T3;
+   //}}
+}
+#else
 uwide8_t
 _SI32_I2C_A_get_timer3_u8(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_get_timer3_u8(basePointer)
 #define SI32_I2C_A_get_timer3_u8(basePointer) \
@@ -1987,9 +3440,23 @@ _SI32_I2C_A_get_timer3_u8(SI32_I2C_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_set_timer_low_u16(
+   SI32_I2C_A_Type * basePointer,
+   uwide16_t value)
+{
+   assert(value < 65536);   // value < 2^16
+   //{{
+   basePointer->TIMER.T1 = (value >> 8) & 0xFF;
+   basePointer->TIMER.T0 = (value     ) & 0xFF;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_set_timer_low_u16(SI32_I2C_A_Type* /*basePointer*/,
    uwide16_t /*value*/);
+#endif
 ///
 /// @def SI32_I2C_A_set_timer_low_u16(basePointer, value)
 #define SI32_I2C_A_set_timer_low_u16(basePointer, value) do{  \
@@ -2003,8 +3470,19 @@ _SI32_I2C_A_set_timer_low_u16(SI32_I2C_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide16_t
+_SI32_I2C_A_get_timer_low_u16(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return (basePointer->TIMER.T1 << 8) | basePointer->TIMER.T0;
+   //}}
+}
+#else
 uwide16_t
 _SI32_I2C_A_get_timer_low_u16(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_get_timer_low_u16(basePointer)
 #define SI32_I2C_A_get_timer_low_u16(basePointer) \
@@ -2021,9 +3499,23 @@ _SI32_I2C_A_get_timer_low_u16(SI32_I2C_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_set_timer_high_u16(
+   SI32_I2C_A_Type * basePointer,
+   uwide16_t value)
+{
+   assert(value < 65536);   // value < 2^16
+   //{{
+   basePointer->TIMER.T3 = (value >>  8) & 0xFF;
+   basePointer->TIMER.T2 = (value      ) & 0xFF;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_set_timer_high_u16(SI32_I2C_A_Type* /*basePointer*/,
    uwide16_t /*value*/);
+#endif
 ///
 /// @def SI32_I2C_A_set_timer_high_u16(basePointer, value)
 #define SI32_I2C_A_set_timer_high_u16(basePointer, value) do{  \
@@ -2037,8 +3529,19 @@ _SI32_I2C_A_set_timer_high_u16(SI32_I2C_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide16_t
+_SI32_I2C_A_get_timer_high_u16(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return (basePointer->TIMER.T3 << 8) | basePointer->TIMER.T2;
+   //}}
+}
+#else
 uwide16_t
 _SI32_I2C_A_get_timer_high_u16(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_get_timer_high_u16(basePointer)
 #define SI32_I2C_A_get_timer_high_u16(basePointer) \
@@ -2058,9 +3561,21 @@ _SI32_I2C_A_get_timer_high_u16(SI32_I2C_A_Type* /*basePointer*/);
 ///  timerrl
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_write_timerrl(
+   SI32_I2C_A_Type * basePointer,
+   uint32_t timerrl)
+{
+   //{{
+   basePointer->TIMERRL.U32 = timerrl;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_write_timerrl(SI32_I2C_A_Type* /*basePointer*/,
    uint32_t /*timerrl*/);
+#endif
 ///
 /// @def SI32_I2C_A_write_timerrl(basePointer, timerrl)
 #define SI32_I2C_A_write_timerrl(basePointer, timerrl) \
@@ -2075,8 +3590,19 @@ _SI32_I2C_A_write_timerrl(SI32_I2C_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_I2C_A_read_timerrl(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return basePointer->TIMERRL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_I2C_A_read_timerrl(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_read_timerrl(basePointer)
 #define SI32_I2C_A_read_timerrl(basePointer) \
@@ -2093,9 +3619,22 @@ _SI32_I2C_A_read_timerrl(SI32_I2C_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 8 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_set_timer0_reload(
+   SI32_I2C_A_Type * basePointer,
+   uwide8_t value)
+{
+   assert(value < 256);   // value < 2^8
+   //{{
+   basePointer->TIMERRL.T0RL = value;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_set_timer0_reload(SI32_I2C_A_Type* /*basePointer*/,
    uwide8_t /*value*/);
+#endif
 ///
 /// @def SI32_I2C_A_set_timer0_reload(basePointer, value)
 #define SI32_I2C_A_set_timer0_reload(basePointer, value) \
@@ -2107,8 +3646,19 @@ _SI32_I2C_A_set_timer0_reload(SI32_I2C_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide8_t
+_SI32_I2C_A_get_timer0_reload(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return basePointer->TIMERRL.T0RL;
+   //}}
+}
+#else
 uwide8_t
 _SI32_I2C_A_get_timer0_reload(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_get_timer0_reload(basePointer)
 #define SI32_I2C_A_get_timer0_reload(basePointer) \
@@ -2125,9 +3675,22 @@ _SI32_I2C_A_get_timer0_reload(SI32_I2C_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 8 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_set_timer1_reload(
+   SI32_I2C_A_Type * basePointer,
+   uwide8_t value)
+{
+   assert(value < 256);   // value < 2^8
+   //{{
+   basePointer->TIMERRL.T1RL = value;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_set_timer1_reload(SI32_I2C_A_Type* /*basePointer*/,
    uwide8_t /*value*/);
+#endif
 ///
 /// @def SI32_I2C_A_set_timer1_reload(basePointer, value)
 #define SI32_I2C_A_set_timer1_reload(basePointer, value) \
@@ -2139,8 +3702,19 @@ _SI32_I2C_A_set_timer1_reload(SI32_I2C_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide8_t
+_SI32_I2C_A_get_timer1_reload(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return basePointer->TIMERRL.T1RL;
+   //}}
+}
+#else
 uwide8_t
 _SI32_I2C_A_get_timer1_reload(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_get_timer1_reload(basePointer)
 #define SI32_I2C_A_get_timer1_reload(basePointer) \
@@ -2157,9 +3731,22 @@ _SI32_I2C_A_get_timer1_reload(SI32_I2C_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 8 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_set_timer2_reload(
+   SI32_I2C_A_Type * basePointer,
+   uwide8_t value)
+{
+   assert(value < 256);   // value < 2^8
+   //{{
+   basePointer->TIMERRL.T2RL = value;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_set_timer2_reload(SI32_I2C_A_Type* /*basePointer*/,
    uwide8_t /*value*/);
+#endif
 ///
 /// @def SI32_I2C_A_set_timer2_reload(basePointer, value)
 #define SI32_I2C_A_set_timer2_reload(basePointer, value) \
@@ -2171,8 +3758,19 @@ _SI32_I2C_A_set_timer2_reload(SI32_I2C_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide8_t
+_SI32_I2C_A_get_timer2_reload(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return basePointer->TIMERRL.T2RL;
+   //}}
+}
+#else
 uwide8_t
 _SI32_I2C_A_get_timer2_reload(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_get_timer2_reload(basePointer)
 #define SI32_I2C_A_get_timer2_reload(basePointer) \
@@ -2189,9 +3787,22 @@ _SI32_I2C_A_get_timer2_reload(SI32_I2C_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 8 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_set_timer3_reload(
+   SI32_I2C_A_Type * basePointer,
+   uwide8_t value)
+{
+   assert(value < 256);   // value < 2^8
+   //{{
+   basePointer->TIMERRL.T3RL = value;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_set_timer3_reload(SI32_I2C_A_Type* /*basePointer*/,
    uwide8_t /*value*/);
+#endif
 ///
 /// @def SI32_I2C_A_set_timer3_reload(basePointer, value)
 #define SI32_I2C_A_set_timer3_reload(basePointer, value) \
@@ -2203,8 +3814,19 @@ _SI32_I2C_A_set_timer3_reload(SI32_I2C_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide8_t
+_SI32_I2C_A_get_timer3_reload(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return basePointer->TIMERRL.T3RL;
+   //}}
+}
+#else
 uwide8_t
 _SI32_I2C_A_get_timer3_reload(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_get_timer3_reload(basePointer)
 #define SI32_I2C_A_get_timer3_reload(basePointer) \
@@ -2221,9 +3843,23 @@ _SI32_I2C_A_get_timer3_reload(SI32_I2C_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_set_16bit_timer_reload_low(
+   SI32_I2C_A_Type * basePointer,
+   uwide16_t value)
+{
+   assert(value < 65536);   // value < 2^16
+   //{{
+   basePointer->TIMERRL.T1RL = (value >> 8) & 0xFF;
+   basePointer->TIMERRL.T0RL = (value     ) & 0xFF;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_set_16bit_timer_reload_low(SI32_I2C_A_Type* /*basePointer*/,
    uwide16_t /*value*/);
+#endif
 ///
 /// @def SI32_I2C_A_set_16bit_timer_reload_low(basePointer, value)
 #define SI32_I2C_A_set_16bit_timer_reload_low(basePointer, value) do{  \
@@ -2237,8 +3873,19 @@ _SI32_I2C_A_set_16bit_timer_reload_low(SI32_I2C_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide16_t
+_SI32_I2C_A_get_16bit_timer_reload_low(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return (basePointer->TIMERRL.T1RL << 8) | basePointer->TIMERRL.T0RL;
+   //}}
+}
+#else
 uwide16_t
 _SI32_I2C_A_get_16bit_timer_reload_low(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_get_16bit_timer_reload_low(basePointer)
 #define SI32_I2C_A_get_16bit_timer_reload_low(basePointer) \
@@ -2255,9 +3902,23 @@ _SI32_I2C_A_get_16bit_timer_reload_low(SI32_I2C_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_set_16bit_timer_reload_high(
+   SI32_I2C_A_Type * basePointer,
+   uwide16_t value)
+{
+   assert(value < 65536);   // value < 2^16
+   //{{
+   basePointer->TIMERRL.T3RL = (value >>  8) & 0xFF;
+   basePointer->TIMERRL.T2RL = (value      ) & 0xFF;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_set_16bit_timer_reload_high(SI32_I2C_A_Type* /*basePointer*/,
    uwide16_t /*value*/);
+#endif
 ///
 /// @def SI32_I2C_A_set_16bit_timer_reload_high(basePointer, value)
 #define SI32_I2C_A_set_16bit_timer_reload_high(basePointer, value) do{  \
@@ -2271,8 +3932,19 @@ _SI32_I2C_A_set_16bit_timer_reload_high(SI32_I2C_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide16_t
+_SI32_I2C_A_get_16bit_timer_reload_high(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return (basePointer->TIMERRL.T3RL << 8) | basePointer->TIMERRL.T2RL;
+   //}}
+}
+#else
 uwide16_t
 _SI32_I2C_A_get_16bit_timer_reload_high(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_get_16bit_timer_reload_high(basePointer)
 #define SI32_I2C_A_get_16bit_timer_reload_high(basePointer) \
@@ -2292,9 +3964,21 @@ _SI32_I2C_A_get_16bit_timer_reload_high(SI32_I2C_A_Type* /*basePointer*/);
 ///  sconfig
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_write_sconfig(
+   SI32_I2C_A_Type * basePointer,
+   uint32_t sconfig)
+{
+   //{{
+   basePointer->SCONFIG.U32 = sconfig;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_write_sconfig(SI32_I2C_A_Type* /*basePointer*/,
    uint32_t /*sconfig*/);
+#endif
 ///
 /// @def SI32_I2C_A_write_sconfig(basePointer, sconfig)
 #define SI32_I2C_A_write_sconfig(basePointer, sconfig) \
@@ -2309,8 +3993,19 @@ _SI32_I2C_A_write_sconfig(SI32_I2C_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_I2C_A_read_sconfig(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return basePointer->SCONFIG.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_I2C_A_read_sconfig(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_read_sconfig(basePointer)
 #define SI32_I2C_A_read_sconfig(basePointer) \
@@ -2327,9 +4022,22 @@ _SI32_I2C_A_read_sconfig(SI32_I2C_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 4 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_set_extended_data_setup_time(
+   SI32_I2C_A_Type * basePointer,
+   uint32_t value)
+{
+   assert(value < 16);   // value < 2^4
+   //{{
+   basePointer->SCONFIG.SETUP = value;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_set_extended_data_setup_time(SI32_I2C_A_Type* /*basePointer*/,
    uint32_t /*value*/);
+#endif
 ///
 /// @def SI32_I2C_A_set_extended_data_setup_time(basePointer, value)
 #define SI32_I2C_A_set_extended_data_setup_time(basePointer, value) \
@@ -2341,8 +4049,19 @@ _SI32_I2C_A_set_extended_data_setup_time(SI32_I2C_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_I2C_A_get_extended_data_setup_time(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return basePointer->SCONFIG.SETUP;
+   //}}
+}
+#else
 uint32_t
 _SI32_I2C_A_get_extended_data_setup_time(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_get_extended_data_setup_time(basePointer)
 #define SI32_I2C_A_get_extended_data_setup_time(basePointer) \
@@ -2359,9 +4078,22 @@ _SI32_I2C_A_get_extended_data_setup_time(SI32_I2C_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 4 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_set_extended_data_hold_time(
+   SI32_I2C_A_Type * basePointer,
+   uint32_t value)
+{
+   assert(value < 16);   // value < 2^4
+   //{{
+   basePointer->SCONFIG.HOLD = value;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_set_extended_data_hold_time(SI32_I2C_A_Type* /*basePointer*/,
    uint32_t /*value*/);
+#endif
 ///
 /// @def SI32_I2C_A_set_extended_data_hold_time(basePointer, value)
 #define SI32_I2C_A_set_extended_data_hold_time(basePointer, value) \
@@ -2373,8 +4105,19 @@ _SI32_I2C_A_set_extended_data_hold_time(SI32_I2C_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_I2C_A_get_extended_data_hold_time(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return basePointer->SCONFIG.HOLD;
+   //}}
+}
+#else
 uint32_t
 _SI32_I2C_A_get_extended_data_hold_time(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_get_extended_data_hold_time(basePointer)
 #define SI32_I2C_A_get_extended_data_hold_time(basePointer) \
@@ -2391,9 +4134,22 @@ _SI32_I2C_A_get_extended_data_hold_time(SI32_I2C_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 8 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_set_scl_low_period_reload(
+   SI32_I2C_A_Type * basePointer,
+   uwide8_t value)
+{
+   assert(value < 256);   // value < 2^8
+   //{{
+   basePointer->SCONFIG.SCLL = value;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_set_scl_low_period_reload(SI32_I2C_A_Type* /*basePointer*/,
    uwide8_t /*value*/);
+#endif
 ///
 /// @def SI32_I2C_A_set_scl_low_period_reload(basePointer, value)
 #define SI32_I2C_A_set_scl_low_period_reload(basePointer, value) \
@@ -2405,8 +4161,19 @@ _SI32_I2C_A_set_scl_low_period_reload(SI32_I2C_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide8_t
+_SI32_I2C_A_get_scl_low_period_reload(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return basePointer->SCONFIG.SCLL;
+   //}}
+}
+#else
 uwide8_t
 _SI32_I2C_A_get_scl_low_period_reload(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_get_scl_low_period_reload(basePointer)
 #define SI32_I2C_A_get_scl_low_period_reload(basePointer) \
@@ -2426,9 +4193,21 @@ _SI32_I2C_A_get_scl_low_period_reload(SI32_I2C_A_Type* /*basePointer*/);
 ///  i2cdma
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_write_i2cdma(
+   SI32_I2C_A_Type * basePointer,
+   uint32_t i2cdma)
+{
+   //{{
+   basePointer->I2CDMA.U32 = i2cdma;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_write_i2cdma(SI32_I2C_A_Type* /*basePointer*/,
    uint32_t /*i2cdma*/);
+#endif
 ///
 /// @def SI32_I2C_A_write_i2cdma(basePointer, i2cdma)
 #define SI32_I2C_A_write_i2cdma(basePointer, i2cdma) \
@@ -2443,8 +4222,19 @@ _SI32_I2C_A_write_i2cdma(SI32_I2C_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_I2C_A_read_i2cdma(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return basePointer->I2CDMA.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_I2C_A_read_i2cdma(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_read_i2cdma(basePointer)
 #define SI32_I2C_A_read_i2cdma(basePointer) \
@@ -2464,9 +4254,22 @@ _SI32_I2C_A_read_i2cdma(SI32_I2C_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 8 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_set_dma_byte_count(
+   SI32_I2C_A_Type * basePointer,
+   uwide8_t value)
+{
+   assert(value < 256);   // value < 2^8
+   //{{
+   basePointer->I2CDMA.DMALEN = value;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_set_dma_byte_count(SI32_I2C_A_Type* /*basePointer*/,
    uwide8_t /*value*/);
+#endif
 ///
 /// @def SI32_I2C_A_set_dma_byte_count(basePointer, value)
 #define SI32_I2C_A_set_dma_byte_count(basePointer, value) \
@@ -2481,8 +4284,19 @@ _SI32_I2C_A_set_dma_byte_count(SI32_I2C_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide8_t
+_SI32_I2C_A_get_dma_byte_count(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return basePointer->I2CDMA.DMALEN;
+   //}}
+}
+#else
 uwide8_t
 _SI32_I2C_A_get_dma_byte_count(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_get_dma_byte_count(basePointer)
 #define SI32_I2C_A_get_dma_byte_count(basePointer) \
@@ -2494,8 +4308,19 @@ _SI32_I2C_A_get_dma_byte_count(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_enable_dma(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->I2CDMA.DMAEN = SI32_I2C_A_I2CDMA_DMAEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_enable_dma(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_enable_dma(basePointer)
 #define SI32_I2C_A_enable_dma(basePointer) \
@@ -2507,8 +4332,19 @@ _SI32_I2C_A_enable_dma(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2C_A_disable_dma(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   basePointer->I2CDMA.DMAEN = SI32_I2C_A_I2CDMA_DMAEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_I2C_A_disable_dma(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_disable_dma(basePointer)
 #define SI32_I2C_A_disable_dma(basePointer) \
@@ -2520,8 +4356,19 @@ _SI32_I2C_A_disable_dma(SI32_I2C_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2C_A_is_dma_enabled(
+   SI32_I2C_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->I2CDMA.DMAEN);
+   //}}
+}
+#else
 bool
 _SI32_I2C_A_is_dma_enabled(SI32_I2C_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2C_A_is_dma_enabled(basePointer)
 #define SI32_I2C_A_is_dma_enabled(basePointer) \
@@ -104,6 +104,45 @@ extern "C" {
 ///  Valid range is 32 bits.
 ///  DBGCONTROL register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_initialize(
+   SI32_I2S_A_Type * basePointer,
+   // TXCONTROL register.
+   uint32_t txcontrol,
+   // TXMODE register.
+   uint32_t txmode,
+   // FSDUTY register.
+   uint32_t fsduty,
+   // RXCONTROL register.
+   uint32_t rxcontrol,
+   // RXMODE register.
+   uint32_t rxmode,
+   // CLKCONTROL register.
+   uint32_t clkcontrol,
+   // FIFOCONTROL register.
+   uint32_t fifocontrol,
+   // INTCONTROL register.
+   uint32_t intcontrol,
+   // DMACONTROL register.
+   uint32_t dmacontrol,
+   // DBGCONTROL register.
+   uint32_t dbgcontrol)
+{
+   //{{
+   basePointer->TXCONTROL.U32   = txcontrol;
+   basePointer->TXMODE.U32      = txmode;
+   basePointer->FSDUTY.U32      = fsduty;
+   basePointer->RXCONTROL.U32   = rxcontrol;
+   basePointer->RXMODE.U32      = rxmode;
+   basePointer->CLKCONTROL.U32  = clkcontrol;
+   basePointer->FIFOCONTROL.U32 = fifocontrol;
+   basePointer->INTCONTROL.U32  = intcontrol;
+   basePointer->DMACONTROL.U32  = dmacontrol;
+   basePointer->DBGCONTROL.U32  = dbgcontrol;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_initialize(SI32_I2S_A_Type* /*basePointer*/,
    uint32_t, /*txcontrol*/
@@ -116,6 +155,7 @@ _SI32_I2S_A_initialize(SI32_I2S_A_Type* /*basePointer*/,
    uint32_t, /*intcontrol*/
    uint32_t, /*dmacontrol*/
    uint32_t /*dbgcontrol*/);
+#endif
 ///
 /// @def SI32_I2S_A_initialize(basePointer, txcontrol, txmode, fsduty, rxcontrol, rxmode, clkcontrol, fifocontrol, intcontrol, dmacontrol, dbgcontrol)
 #define SI32_I2S_A_initialize(basePointer, txcontrol, txmode, fsduty, rxcontrol, rxmode, clkcontrol, fifocontrol, intcontrol, dmacontrol, dbgcontrol) \
@@ -130,8 +170,19 @@ _SI32_I2S_A_initialize(SI32_I2S_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_I2S_A_read_txcontrol(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+  return basePointer->TXCONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_I2S_A_read_txcontrol(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_read_txcontrol(basePointer)
 #define SI32_I2S_A_read_txcontrol(basePointer) \
@@ -150,9 +201,21 @@ _SI32_I2S_A_read_txcontrol(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  txcontrol
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_write_txcontrol(
+   SI32_I2S_A_Type * basePointer,
+   uint32_t txcontrol)
+{
+   //{{
+   basePointer->TXCONTROL.U32   = txcontrol;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_write_txcontrol(SI32_I2S_A_Type* /*basePointer*/,
    uint32_t /*txcontrol*/);
+#endif
 ///
 /// @def SI32_I2S_A_write_txcontrol(basePointer, txcontrol)
 #define SI32_I2S_A_write_txcontrol(basePointer, txcontrol) \
@@ -164,8 +227,19 @@ _SI32_I2S_A_write_txcontrol(SI32_I2S_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_enable_frame_sync(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->TXCONTROL_SET = SI32_I2S_A_TXCONTROL_FSGEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_enable_frame_sync(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_enable_frame_sync(basePointer)
 #define SI32_I2S_A_enable_frame_sync(basePointer) \
@@ -177,8 +251,19 @@ _SI32_I2S_A_enable_frame_sync(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_disable_frame_sync(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->TXCONTROL_CLR = SI32_I2S_A_TXCONTROL_FSGEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_disable_frame_sync(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_disable_frame_sync(basePointer)
 #define SI32_I2S_A_disable_frame_sync(basePointer) \
@@ -193,8 +278,19 @@ _SI32_I2S_A_disable_frame_sync(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_tx_frame_sync_synchronize(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->TXCONTROL_SET = SI32_I2S_A_TXCONTROL_FSSEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_tx_frame_sync_synchronize(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_tx_frame_sync_synchronize(basePointer)
 #define SI32_I2S_A_select_tx_frame_sync_synchronize(basePointer) \
@@ -209,8 +305,19 @@ _SI32_I2S_A_select_tx_frame_sync_synchronize(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_tx_frame_sync_immediate(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->TXCONTROL_CLR = SI32_I2S_A_TXCONTROL_FSSEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_tx_frame_sync_immediate(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_tx_frame_sync_immediate(basePointer)
 #define SI32_I2S_A_select_tx_frame_sync_immediate(basePointer) \
@@ -222,8 +329,19 @@ _SI32_I2S_A_select_tx_frame_sync_immediate(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_tx_data_first_rising_edge(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->TXCONTROL_SET = SI32_I2S_A_TXCONTROL_DDIS_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_tx_data_first_rising_edge(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_tx_data_first_rising_edge(basePointer)
 #define SI32_I2S_A_select_tx_data_first_rising_edge(basePointer) \
@@ -241,9 +359,26 @@ _SI32_I2S_A_select_tx_data_first_rising_edge(SI32_I2S_A_Type* /*basePointer*/);
 ///  Valid range is 2 to 257.
 ///  Number of cycles (n) to delay data capture.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_tx_data_nth_rising_edge(
+   SI32_I2S_A_Type * basePointer,
+   // Number of cycles (n) to delay data capture.
+   uint32_t cycles_delay)
+{
+   assert((cycles_delay >= 2) && (cycles_delay <= 257));
+   //{{
+
+   basePointer->TXCONTROL_CLR = SI32_I2S_A_TXCONTROL_FSDEL_MASK;
+   basePointer->TXCONTROL_SET = (cycles_delay-2) << SI32_I2S_A_TXCONTROL_FSDEL_SHIFT;
+   basePointer->TXCONTROL_CLR = SI32_I2S_A_TXCONTROL_DDIS_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_tx_data_nth_rising_edge(SI32_I2S_A_Type* /*basePointer*/,
    uint32_t /*cycles_delay*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_tx_data_nth_rising_edge(basePointer, cycles_delay)
 #define SI32_I2S_A_select_tx_data_nth_rising_edge(basePointer, cycles_delay) do{  \
@@ -259,8 +394,19 @@ _SI32_I2S_A_select_tx_data_nth_rising_edge(SI32_I2S_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_tx_unused_data_fill_zeros(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->TXCONTROL_CLR = SI32_I2S_A_TXCONTROL_FILLSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_tx_unused_data_fill_zeros(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_tx_unused_data_fill_zeros(basePointer)
 #define SI32_I2S_A_select_tx_unused_data_fill_zeros(basePointer) \
@@ -272,8 +418,20 @@ _SI32_I2S_A_select_tx_unused_data_fill_zeros(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_tx_unused_data_fill_ones(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->TXCONTROL_CLR = SI32_I2S_A_TXCONTROL_FILLSEL_MASK;
+   basePointer->TXCONTROL_SET = 0x1 << SI32_I2S_A_TXCONTROL_FILLSEL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_tx_unused_data_fill_ones(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_tx_unused_data_fill_ones(basePointer)
 #define SI32_I2S_A_select_tx_unused_data_fill_ones(basePointer) do{  \
@@ -287,8 +445,20 @@ _SI32_I2S_A_select_tx_unused_data_fill_ones(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_tx_unused_data_fill_sign(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->TXCONTROL_CLR = SI32_I2S_A_TXCONTROL_FILLSEL_MASK;
+   basePointer->TXCONTROL_SET = 0x2 << SI32_I2S_A_TXCONTROL_FILLSEL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_tx_unused_data_fill_sign(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_tx_unused_data_fill_sign(basePointer)
 #define SI32_I2S_A_select_tx_unused_data_fill_sign(basePointer) do{  \
@@ -302,8 +472,19 @@ _SI32_I2S_A_select_tx_unused_data_fill_sign(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_tx_unused_data_fill_random(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->TXCONTROL_SET = SI32_I2S_A_TXCONTROL_FILLSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_tx_unused_data_fill_random(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_tx_unused_data_fill_random(basePointer)
 #define SI32_I2S_A_select_tx_unused_data_fill_random(basePointer) \
@@ -318,8 +499,19 @@ _SI32_I2S_A_select_tx_unused_data_fill_random(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_tx_frame_sync_as_external_pin(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->TXCONTROL_CLR = SI32_I2S_A_TXCONTROL_FSSRCSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_tx_frame_sync_as_external_pin(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_tx_frame_sync_as_external_pin(basePointer)
 #define SI32_I2S_A_select_tx_frame_sync_as_external_pin(basePointer) \
@@ -334,8 +526,19 @@ _SI32_I2S_A_select_tx_frame_sync_as_external_pin(SI32_I2S_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_tx_frame_sync_as_internal_generator(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->TXCONTROL_SET = SI32_I2S_A_TXCONTROL_FSSRCSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_tx_frame_sync_as_internal_generator(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_tx_frame_sync_as_internal_generator(basePointer)
 #define SI32_I2S_A_select_tx_frame_sync_as_internal_generator(basePointer) \
@@ -347,8 +550,19 @@ _SI32_I2S_A_select_tx_frame_sync_as_internal_generator(SI32_I2S_A_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_tx_right_justified_data(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->TXCONTROL_SET = SI32_I2S_A_TXCONTROL_JSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_tx_right_justified_data(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_tx_right_justified_data(basePointer)
 #define SI32_I2S_A_select_tx_right_justified_data(basePointer) \
@@ -360,8 +574,19 @@ _SI32_I2S_A_select_tx_right_justified_data(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_tx_left_justified_data(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->TXCONTROL_CLR = SI32_I2S_A_TXCONTROL_JSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_tx_left_justified_data(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_tx_left_justified_data(basePointer)
 #define SI32_I2S_A_select_tx_left_justified_data(basePointer) \
@@ -373,8 +598,19 @@ _SI32_I2S_A_select_tx_left_justified_data(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_enable_tx_frame_sync_inversion(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->TXCONTROL_SET = SI32_I2S_A_TXCONTROL_FSINVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_enable_tx_frame_sync_inversion(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_enable_tx_frame_sync_inversion(basePointer)
 #define SI32_I2S_A_enable_tx_frame_sync_inversion(basePointer) \
@@ -386,8 +622,19 @@ _SI32_I2S_A_enable_tx_frame_sync_inversion(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_disable_tx_frame_sync_inversion(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->TXCONTROL_CLR = SI32_I2S_A_TXCONTROL_FSINVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_disable_tx_frame_sync_inversion(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_disable_tx_frame_sync_inversion(basePointer)
 #define SI32_I2S_A_disable_tx_frame_sync_inversion(basePointer) \
@@ -399,8 +646,19 @@ _SI32_I2S_A_disable_tx_frame_sync_inversion(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_enable_tx_clock_inversion(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->TXCONTROL_SET = SI32_I2S_A_TXCONTROL_SCLKINVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_enable_tx_clock_inversion(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_enable_tx_clock_inversion(basePointer)
 #define SI32_I2S_A_enable_tx_clock_inversion(basePointer) \
@@ -412,8 +670,19 @@ _SI32_I2S_A_enable_tx_clock_inversion(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_disable_tx_clock_inversion(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->TXCONTROL_CLR = SI32_I2S_A_TXCONTROL_SCLKINVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_disable_tx_clock_inversion(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_disable_tx_clock_inversion(basePointer)
 #define SI32_I2S_A_disable_tx_clock_inversion(basePointer) \
@@ -425,8 +694,19 @@ _SI32_I2S_A_disable_tx_clock_inversion(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_tx_left_channel_first(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->TXCONTROL_CLR = SI32_I2S_A_TXCONTROL_ORDER_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_tx_left_channel_first(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_tx_left_channel_first(basePointer)
 #define SI32_I2S_A_select_tx_left_channel_first(basePointer) \
@@ -438,8 +718,19 @@ _SI32_I2S_A_select_tx_left_channel_first(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_tx_right_channel_first(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->TXCONTROL_SET = SI32_I2S_A_TXCONTROL_ORDER_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_tx_right_channel_first(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_tx_right_channel_first(basePointer)
 #define SI32_I2S_A_select_tx_right_channel_first(basePointer) \
@@ -451,8 +742,19 @@ _SI32_I2S_A_select_tx_right_channel_first(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_tx_8bits_per_mono_sample(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->TXCONTROL_CLR = SI32_I2S_A_TXCONTROL_MBSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_tx_8bits_per_mono_sample(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_tx_8bits_per_mono_sample(basePointer)
 #define SI32_I2S_A_select_tx_8bits_per_mono_sample(basePointer) \
@@ -464,8 +766,20 @@ _SI32_I2S_A_select_tx_8bits_per_mono_sample(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_tx_9bits_per_mono_sample(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->TXCONTROL_CLR = SI32_I2S_A_TXCONTROL_MBSEL_MASK;
+   basePointer->TXCONTROL_SET = 0x1 <<SI32_I2S_A_TXCONTROL_MBSEL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_tx_9bits_per_mono_sample(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_tx_9bits_per_mono_sample(basePointer)
 #define SI32_I2S_A_select_tx_9bits_per_mono_sample(basePointer) do{  \
@@ -479,8 +793,20 @@ _SI32_I2S_A_select_tx_9bits_per_mono_sample(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_tx_16bits_per_mono_sample(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->TXCONTROL_CLR = SI32_I2S_A_TXCONTROL_MBSEL_MASK;
+   basePointer->TXCONTROL_SET = 0x2 <<SI32_I2S_A_TXCONTROL_MBSEL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_tx_16bits_per_mono_sample(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_tx_16bits_per_mono_sample(basePointer)
 #define SI32_I2S_A_select_tx_16bits_per_mono_sample(basePointer) do{  \
@@ -494,8 +820,20 @@ _SI32_I2S_A_select_tx_16bits_per_mono_sample(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_tx_24bits_per_mono_sample(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->TXCONTROL_CLR = SI32_I2S_A_TXCONTROL_MBSEL_MASK;
+   basePointer->TXCONTROL_SET = 0x3 <<SI32_I2S_A_TXCONTROL_MBSEL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_tx_24bits_per_mono_sample(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_tx_24bits_per_mono_sample(basePointer)
 #define SI32_I2S_A_select_tx_24bits_per_mono_sample(basePointer) do{  \
@@ -509,8 +847,20 @@ _SI32_I2S_A_select_tx_24bits_per_mono_sample(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_tx_32bits_per_mono_sample(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->TXCONTROL_CLR = SI32_I2S_A_TXCONTROL_MBSEL_MASK;
+   basePointer->TXCONTROL_SET = 0x4 <<SI32_I2S_A_TXCONTROL_MBSEL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_tx_32bits_per_mono_sample(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_tx_32bits_per_mono_sample(basePointer)
 #define SI32_I2S_A_select_tx_32bits_per_mono_sample(basePointer) do{  \
@@ -524,8 +874,19 @@ _SI32_I2S_A_select_tx_32bits_per_mono_sample(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_enable_tx(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->TXCONTROL_SET = SI32_I2S_A_TXCONTROL_TXEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_enable_tx(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_enable_tx(basePointer)
 #define SI32_I2S_A_enable_tx(basePointer) \
@@ -537,8 +898,19 @@ _SI32_I2S_A_enable_tx(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_disable_tx(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->TXCONTROL_CLR = SI32_I2S_A_TXCONTROL_TXEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_disable_tx(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_disable_tx(basePointer)
 #define SI32_I2S_A_disable_tx(basePointer) \
@@ -553,8 +925,19 @@ _SI32_I2S_A_disable_tx(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_I2S_A_read_txmode(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   return basePointer->TXMODE.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_I2S_A_read_txmode(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_read_txmode(basePointer)
 #define SI32_I2S_A_read_txmode(basePointer) \
@@ -573,9 +956,21 @@ _SI32_I2S_A_read_txmode(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  txmode
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_write_txmode(
+   SI32_I2S_A_Type * basePointer,
+   uint32_t txmode)
+{
+   //{{
+   basePointer->TXMODE.U32      = txmode;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_write_txmode(SI32_I2S_A_Type* /*basePointer*/,
    uint32_t /*txmode*/);
+#endif
 ///
 /// @def SI32_I2S_A_write_txmode(basePointer, txmode)
 #define SI32_I2S_A_write_txmode(basePointer, txmode) \
@@ -605,11 +1000,38 @@ _SI32_I2S_A_write_txmode(SI32_I2S_A_Type* /*basePointer*/,
 ///  Valid range is 1 to 32.
 ///  Number of slots for which to send data.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_set_tx_tdm_slots(
+   SI32_I2S_A_Type * basePointer,
+   // Bits per slot.
+   uint32_t number_bits,
+   // First slot in which to send data.
+   uwide8_t slot_number,
+   // Number of slots for which to send data.
+   uint32_t length)
+{
+   assert((number_bits >= 1) && (number_bits <= 4096));
+   assert(slot_number < 256);   // slot_number < 2^8
+   assert((length >= 1) && (length <= 32));
+   //{{
+
+   basePointer->TXMODE_CLR = SI32_I2S_A_TXMODE_CYCLE_MASK
+                             | SI32_I2S_A_TXMODE_START_MASK
+                             | SI32_I2S_A_TXMODE_SLOTS_MASK;
+
+   basePointer->TXMODE_SET = ((number_bits-1) << SI32_I2S_A_TXMODE_CYCLE_SHIFT)
+                             | ((slot_number-1) << SI32_I2S_A_TXMODE_START_SHIFT)
+                             | ((length-1) << SI32_I2S_A_TXMODE_SLOTS_SHIFT);
+   //}}
+}
+#else
 void
 _SI32_I2S_A_set_tx_tdm_slots(SI32_I2S_A_Type* /*basePointer*/,
    uint32_t, /*number_bits*/
    uwide8_t, /*slot_number*/
    uint32_t /*length*/);
+#endif
 ///
 /// @def SI32_I2S_A_set_tx_tdm_slots(basePointer, number_bits, slot_number, length)
 #define SI32_I2S_A_set_tx_tdm_slots(basePointer, number_bits, slot_number, length) do{  \
@@ -629,8 +1051,19 @@ _SI32_I2S_A_set_tx_tdm_slots(SI32_I2S_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_tx_last_bit_drive(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->TXMODE_CLR = SI32_I2S_A_TXMODE_DEDIS_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_tx_last_bit_drive(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_tx_last_bit_drive(basePointer)
 #define SI32_I2S_A_select_tx_last_bit_drive(basePointer) \
@@ -642,8 +1075,19 @@ _SI32_I2S_A_select_tx_last_bit_drive(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_tx_last_bit_hiz(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->TXMODE_SET = SI32_I2S_A_TXMODE_DEDIS_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_tx_last_bit_hiz(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_tx_last_bit_hiz(basePointer)
 #define SI32_I2S_A_select_tx_last_bit_hiz(basePointer) \
@@ -655,8 +1099,19 @@ _SI32_I2S_A_select_tx_last_bit_hiz(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_tx_unselected_bits_drive_zero(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->TXMODE_CLR = SI32_I2S_A_TXMODE_DIMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_tx_unselected_bits_drive_zero(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_tx_unselected_bits_drive_zero(basePointer)
 #define SI32_I2S_A_select_tx_unselected_bits_drive_zero(basePointer) \
@@ -668,8 +1123,19 @@ _SI32_I2S_A_select_tx_unselected_bits_drive_zero(SI32_I2S_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_tx_unselected_bits_hiz(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->TXMODE_SET = SI32_I2S_A_TXMODE_DIMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_tx_unselected_bits_hiz(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_tx_unselected_bits_hiz(basePointer)
 #define SI32_I2S_A_select_tx_unselected_bits_hiz(basePointer) \
@@ -681,8 +1147,19 @@ _SI32_I2S_A_select_tx_unselected_bits_hiz(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_enable_tx_tdm(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->TXMODE_SET = SI32_I2S_A_TXMODE_TDMEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_enable_tx_tdm(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_enable_tx_tdm(basePointer)
 #define SI32_I2S_A_enable_tx_tdm(basePointer) \
@@ -694,8 +1171,19 @@ _SI32_I2S_A_enable_tx_tdm(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_disable_tx_tdm(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->TXMODE_CLR = SI32_I2S_A_TXMODE_TDMEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_disable_tx_tdm(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_disable_tx_tdm(basePointer)
 #define SI32_I2S_A_disable_tx_tdm(basePointer) \
@@ -710,8 +1198,19 @@ _SI32_I2S_A_disable_tx_tdm(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_I2S_A_read_fsduty(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   return basePointer->FSDUTY.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_I2S_A_read_fsduty(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_read_fsduty(basePointer)
 #define SI32_I2S_A_read_fsduty(basePointer) \
@@ -730,9 +1229,21 @@ _SI32_I2S_A_read_fsduty(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  fsduty
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_write_fsduty(
+   SI32_I2S_A_Type * basePointer,
+   uint32_t fsduty)
+{
+   //{{
+   basePointer->FSDUTY.U32 = fsduty;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_write_fsduty(SI32_I2S_A_Type* /*basePointer*/,
    uint32_t /*fsduty*/);
+#endif
 ///
 /// @def SI32_I2S_A_write_fsduty(basePointer, fsduty)
 #define SI32_I2S_A_write_fsduty(basePointer, fsduty) \
@@ -756,10 +1267,29 @@ _SI32_I2S_A_write_fsduty(SI32_I2S_A_Type* /*basePointer*/,
 ///  Valid range is 16 bits.
 ///  Clock cycles for high phase.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_set_frame_sync_duty_cycle(
+   SI32_I2S_A_Type * basePointer,
+   // Clock cycles for low phase.
+   uwide16_t low_cycles,
+   // Clock cycles for high phase.
+   uwide16_t high_cycles)
+{
+   assert(low_cycles < 65536);   // low_cycles < 2^16
+   assert(high_cycles < 65536);   // high_cycles < 2^16
+   //{{
+   // NO SET/CLR AVALIABLE
+   basePointer->FSDUTY.FSLOW = low_cycles-1;
+   basePointer->FSDUTY.FSHIGH = high_cycles-1;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_set_frame_sync_duty_cycle(SI32_I2S_A_Type* /*basePointer*/,
    uwide16_t, /*low_cycles*/
    uwide16_t /*high_cycles*/);
+#endif
 ///
 /// @def SI32_I2S_A_set_frame_sync_duty_cycle(basePointer, low_cycles, high_cycles)
 #define SI32_I2S_A_set_frame_sync_duty_cycle(basePointer, low_cycles, high_cycles) do{  \
@@ -776,8 +1306,19 @@ _SI32_I2S_A_set_frame_sync_duty_cycle(SI32_I2S_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_I2S_A_read_rxcontrol(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   return basePointer->RXCONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_I2S_A_read_rxcontrol(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_read_rxcontrol(basePointer)
 #define SI32_I2S_A_read_rxcontrol(basePointer) \
@@ -796,9 +1337,21 @@ _SI32_I2S_A_read_rxcontrol(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  rxcontrol
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_write_rxcontrol(
+   SI32_I2S_A_Type * basePointer,
+   uint32_t rxcontrol)
+{
+   //{{
+   basePointer->RXCONTROL.U32   = rxcontrol;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_write_rxcontrol(SI32_I2S_A_Type* /*basePointer*/,
    uint32_t /*rxcontrol*/);
+#endif
 ///
 /// @def SI32_I2S_A_write_rxcontrol(basePointer, rxcontrol)
 #define SI32_I2S_A_write_rxcontrol(basePointer, rxcontrol) \
@@ -810,8 +1363,19 @@ _SI32_I2S_A_write_rxcontrol(SI32_I2S_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_rx_data_first_rising_edge(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->RXCONTROL_SET = SI32_I2S_A_RXCONTROL_DDIS_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_rx_data_first_rising_edge(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_rx_data_first_rising_edge(basePointer)
 #define SI32_I2S_A_select_rx_data_first_rising_edge(basePointer) \
@@ -829,9 +1393,25 @@ _SI32_I2S_A_select_rx_data_first_rising_edge(SI32_I2S_A_Type* /*basePointer*/);
 ///  Valid range is 2 to 257.
 ///  Number of cycles (n) to delay data capture.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_rx_data_nth_rising_edge(
+   SI32_I2S_A_Type * basePointer,
+   // Number of cycles (n) to delay data capture.
+   uint32_t cycles_delay)
+{
+   assert((cycles_delay >= 2) && (cycles_delay <= 257));
+   //{{
+   basePointer->RXCONTROL_CLR = SI32_I2S_A_RXCONTROL_FSDEL_MASK;
+   basePointer->RXCONTROL_SET = cycles_delay-2;
+   basePointer->RXCONTROL_CLR = SI32_I2S_A_RXCONTROL_DDIS_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_rx_data_nth_rising_edge(SI32_I2S_A_Type* /*basePointer*/,
    uint32_t /*cycles_delay*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_rx_data_nth_rising_edge(basePointer, cycles_delay)
 #define SI32_I2S_A_select_rx_data_nth_rising_edge(basePointer, cycles_delay) do{  \
@@ -846,8 +1426,19 @@ _SI32_I2S_A_select_rx_data_nth_rising_edge(SI32_I2S_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_rx_right_justified_data(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->RXCONTROL_SET = SI32_I2S_A_RXCONTROL_JSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_rx_right_justified_data(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_rx_right_justified_data(basePointer)
 #define SI32_I2S_A_select_rx_right_justified_data(basePointer) \
@@ -859,8 +1450,19 @@ _SI32_I2S_A_select_rx_right_justified_data(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_rx_left_justified_data(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->RXCONTROL_CLR = SI32_I2S_A_RXCONTROL_JSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_rx_left_justified_data(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_rx_left_justified_data(basePointer)
 #define SI32_I2S_A_select_rx_left_justified_data(basePointer) \
@@ -872,8 +1474,19 @@ _SI32_I2S_A_select_rx_left_justified_data(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_enable_rx_frame_sync_inversion(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->RXCONTROL_SET = SI32_I2S_A_RXCONTROL_FSINVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_enable_rx_frame_sync_inversion(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_enable_rx_frame_sync_inversion(basePointer)
 #define SI32_I2S_A_enable_rx_frame_sync_inversion(basePointer) \
@@ -885,8 +1498,19 @@ _SI32_I2S_A_enable_rx_frame_sync_inversion(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_disable_rx_frame_sync_inversion(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->RXCONTROL_CLR = SI32_I2S_A_RXCONTROL_FSINVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_disable_rx_frame_sync_inversion(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_disable_rx_frame_sync_inversion(basePointer)
 #define SI32_I2S_A_disable_rx_frame_sync_inversion(basePointer) \
@@ -898,8 +1522,19 @@ _SI32_I2S_A_disable_rx_frame_sync_inversion(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_enable_rx_clock_inversion(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->RXCONTROL_SET = SI32_I2S_A_RXCONTROL_SCLKINVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_enable_rx_clock_inversion(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_enable_rx_clock_inversion(basePointer)
 #define SI32_I2S_A_enable_rx_clock_inversion(basePointer) \
@@ -911,8 +1546,19 @@ _SI32_I2S_A_enable_rx_clock_inversion(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_disable_rx_clock_inversion(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->RXCONTROL_CLR = SI32_I2S_A_RXCONTROL_SCLKINVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_disable_rx_clock_inversion(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_disable_rx_clock_inversion(basePointer)
 #define SI32_I2S_A_disable_rx_clock_inversion(basePointer) \
@@ -924,8 +1570,19 @@ _SI32_I2S_A_disable_rx_clock_inversion(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_rx_left_channel_first(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->RXCONTROL_CLR = SI32_I2S_A_RXCONTROL_ORDER_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_rx_left_channel_first(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_rx_left_channel_first(basePointer)
 #define SI32_I2S_A_select_rx_left_channel_first(basePointer) \
@@ -937,8 +1594,19 @@ _SI32_I2S_A_select_rx_left_channel_first(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_rx_right_channel_first(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->RXCONTROL_SET = SI32_I2S_A_RXCONTROL_ORDER_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_rx_right_channel_first(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_rx_right_channel_first(basePointer)
 #define SI32_I2S_A_select_rx_right_channel_first(basePointer) \
@@ -950,8 +1618,19 @@ _SI32_I2S_A_select_rx_right_channel_first(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_rx_8bits_per_mono_sample(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->RXCONTROL_CLR = SI32_I2S_A_RXCONTROL_MBSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_rx_8bits_per_mono_sample(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_rx_8bits_per_mono_sample(basePointer)
 #define SI32_I2S_A_select_rx_8bits_per_mono_sample(basePointer) \
@@ -963,8 +1642,20 @@ _SI32_I2S_A_select_rx_8bits_per_mono_sample(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_rx_9bits_per_mono_sample(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->RXCONTROL_CLR = SI32_I2S_A_RXCONTROL_MBSEL_MASK;
+   basePointer->RXCONTROL_SET = 0x1 <<SI32_I2S_A_RXCONTROL_MBSEL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_rx_9bits_per_mono_sample(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_rx_9bits_per_mono_sample(basePointer)
 #define SI32_I2S_A_select_rx_9bits_per_mono_sample(basePointer) do{  \
@@ -978,8 +1669,20 @@ _SI32_I2S_A_select_rx_9bits_per_mono_sample(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_rx_16bits_per_mono_sample(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->RXCONTROL_CLR = SI32_I2S_A_RXCONTROL_MBSEL_MASK;
+   basePointer->RXCONTROL_SET = 0x2 <<SI32_I2S_A_RXCONTROL_MBSEL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_rx_16bits_per_mono_sample(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_rx_16bits_per_mono_sample(basePointer)
 #define SI32_I2S_A_select_rx_16bits_per_mono_sample(basePointer) do{  \
@@ -993,8 +1696,20 @@ _SI32_I2S_A_select_rx_16bits_per_mono_sample(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_rx_24bits_per_mono_sample(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->RXCONTROL_CLR = SI32_I2S_A_RXCONTROL_MBSEL_MASK;
+   basePointer->RXCONTROL_SET = 0x3 <<SI32_I2S_A_RXCONTROL_MBSEL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_rx_24bits_per_mono_sample(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_rx_24bits_per_mono_sample(basePointer)
 #define SI32_I2S_A_select_rx_24bits_per_mono_sample(basePointer) do{  \
@@ -1008,8 +1723,20 @@ _SI32_I2S_A_select_rx_24bits_per_mono_sample(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_rx_32bits_per_mono_sample(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->RXCONTROL_CLR = SI32_I2S_A_RXCONTROL_MBSEL_MASK;
+   basePointer->RXCONTROL_SET = 0x4 <<SI32_I2S_A_RXCONTROL_MBSEL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_rx_32bits_per_mono_sample(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_rx_32bits_per_mono_sample(basePointer)
 #define SI32_I2S_A_select_rx_32bits_per_mono_sample(basePointer) do{  \
@@ -1026,8 +1753,19 @@ _SI32_I2S_A_select_rx_32bits_per_mono_sample(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_rx_frame_sync_as_external_pin(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->RXCONTROL_CLR = SI32_I2S_A_RXCONTROL_FSSRCSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_rx_frame_sync_as_external_pin(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_rx_frame_sync_as_external_pin(basePointer)
 #define SI32_I2S_A_select_rx_frame_sync_as_external_pin(basePointer) \
@@ -1042,8 +1780,19 @@ _SI32_I2S_A_select_rx_frame_sync_as_external_pin(SI32_I2S_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_rx_frame_sync_as_internal_generator(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->RXCONTROL_SET = SI32_I2S_A_RXCONTROL_FSSRCSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_rx_frame_sync_as_internal_generator(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_rx_frame_sync_as_internal_generator(basePointer)
 #define SI32_I2S_A_select_rx_frame_sync_as_internal_generator(basePointer) \
@@ -1055,8 +1804,19 @@ _SI32_I2S_A_select_rx_frame_sync_as_internal_generator(SI32_I2S_A_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_enable_rx(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->RXCONTROL_SET = SI32_I2S_A_RXCONTROL_RXEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_enable_rx(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_enable_rx(basePointer)
 #define SI32_I2S_A_enable_rx(basePointer) \
@@ -1068,8 +1828,19 @@ _SI32_I2S_A_enable_rx(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_disable_rx(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->RXCONTROL_CLR = SI32_I2S_A_RXCONTROL_RXEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_disable_rx(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_disable_rx(basePointer)
 #define SI32_I2S_A_disable_rx(basePointer) \
@@ -1084,8 +1855,19 @@ _SI32_I2S_A_disable_rx(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_I2S_A_read_rxmode(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   return basePointer->RXMODE.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_I2S_A_read_rxmode(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_read_rxmode(basePointer)
 #define SI32_I2S_A_read_rxmode(basePointer) \
@@ -1104,9 +1886,21 @@ _SI32_I2S_A_read_rxmode(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  rxmode
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_write_rxmode(
+   SI32_I2S_A_Type * basePointer,
+   uint32_t rxmode)
+{
+   //{{
+   basePointer->RXMODE.U32      = rxmode;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_write_rxmode(SI32_I2S_A_Type* /*basePointer*/,
    uint32_t /*rxmode*/);
+#endif
 ///
 /// @def SI32_I2S_A_write_rxmode(basePointer, rxmode)
 #define SI32_I2S_A_write_rxmode(basePointer, rxmode) \
@@ -1136,11 +1930,37 @@ _SI32_I2S_A_write_rxmode(SI32_I2S_A_Type* /*basePointer*/,
 ///  Valid range is 1 to 32.
 ///  Number of slots for which to send data.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_set_rx_tdm_slots(
+   SI32_I2S_A_Type * basePointer,
+   // Bits per slot.
+   uint32_t number_bits,
+   // First slot in which to receive data.
+   uwide8_t slot_number,
+   // Number of slots for which to send data.
+   uint32_t length)
+{
+   assert((number_bits >= 1) && (number_bits <= 4096));
+   assert(slot_number < 256);   // slot_number < 2^8
+   assert((length >= 1) && (length <= 32));
+   //{{
+   basePointer->RXMODE_CLR = SI32_I2S_A_RXMODE_CYCLE_MASK
+                             | SI32_I2S_A_RXMODE_START_MASK
+                             | SI32_I2S_A_RXMODE_SLOTS_MASK;
+
+   basePointer->RXMODE_SET = ((number_bits-1) << SI32_I2S_A_RXMODE_CYCLE_SHIFT)
+                             | ((slot_number-1) << SI32_I2S_A_RXMODE_START_SHIFT)
+                             | ((length-1) << SI32_I2S_A_RXMODE_SLOTS_SHIFT);
+   //}}
+}
+#else
 void
 _SI32_I2S_A_set_rx_tdm_slots(SI32_I2S_A_Type* /*basePointer*/,
    uint32_t, /*number_bits*/
    uwide8_t, /*slot_number*/
    uint32_t /*length*/);
+#endif
 ///
 /// @def SI32_I2S_A_set_rx_tdm_slots(basePointer, number_bits, slot_number, length)
 #define SI32_I2S_A_set_rx_tdm_slots(basePointer, number_bits, slot_number, length) do{  \
@@ -1159,8 +1979,19 @@ _SI32_I2S_A_set_rx_tdm_slots(SI32_I2S_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_enable_rx_tdm(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+    basePointer->RXMODE_SET = SI32_I2S_A_RXMODE_TDMEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_enable_rx_tdm(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_enable_rx_tdm(basePointer)
 #define SI32_I2S_A_enable_rx_tdm(basePointer) \
@@ -1172,8 +2003,19 @@ _SI32_I2S_A_enable_rx_tdm(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_disable_rx_tdm(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+    basePointer->RXMODE_CLR = SI32_I2S_A_RXMODE_TDMEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_disable_rx_tdm(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_disable_rx_tdm(basePointer)
 #define SI32_I2S_A_disable_rx_tdm(basePointer) \
@@ -1188,8 +2030,19 @@ _SI32_I2S_A_disable_rx_tdm(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_I2S_A_read_clkcontrol(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CLKCONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_I2S_A_read_clkcontrol(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_read_clkcontrol(basePointer)
 #define SI32_I2S_A_read_clkcontrol(basePointer) \
@@ -1208,9 +2061,21 @@ _SI32_I2S_A_read_clkcontrol(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  clkcontrol
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_write_clkcontrol(
+   SI32_I2S_A_Type * basePointer,
+   uint32_t clkcontrol)
+{
+   //{{
+   basePointer->CLKCONTROL.U32  = clkcontrol;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_write_clkcontrol(SI32_I2S_A_Type* /*basePointer*/,
    uint32_t /*clkcontrol*/);
+#endif
 ///
 /// @def SI32_I2S_A_write_clkcontrol(basePointer, clkcontrol)
 #define SI32_I2S_A_write_clkcontrol(basePointer, clkcontrol) \
@@ -1234,10 +2099,30 @@ _SI32_I2S_A_write_clkcontrol(SI32_I2S_A_Type* /*basePointer*/,
 ///  Valid range is 8 bits.
 ///  Fractional portion of clock divider.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_set_clock_divider(
+   SI32_I2S_A_Type * basePointer,
+   // Integer portion of clock divider.
+   uint32_t integer,
+   // Fractional portion of clock divider.
+   uwide8_t fractional)
+{
+   assert((integer >= 1) && (integer <= 1023));
+   assert(fractional < 256);   // fractional < 2^8
+   //{{
+   basePointer->CLKCONTROL_CLR = SI32_I2S_A_CLKCONTROL_INTDIV_MASK
+                                | SI32_I2S_A_CLKCONTROL_FRACDIV_MASK;
+   basePointer->CLKCONTROL_SET = (integer << SI32_I2S_A_CLKCONTROL_INTDIV_SHIFT)
+                                  |(fractional << SI32_I2S_A_CLKCONTROL_FRACDIV_SHIFT);
+   //}}
+}
+#else
 void
 _SI32_I2S_A_set_clock_divider(SI32_I2S_A_Type* /*basePointer*/,
    uint32_t, /*integer*/
    uwide8_t /*fractional*/);
+#endif
 ///
 /// @def SI32_I2S_A_set_clock_divider(basePointer, integer, fractional)
 #define SI32_I2S_A_set_clock_divider(basePointer, integer, fractional) do{  \
@@ -1256,8 +2141,19 @@ _SI32_I2S_A_set_clock_divider(SI32_I2S_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_extend_high_cycle(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->CLKCONTROL_CLR  = SI32_I2S_A_CLKCONTROL_DUTYMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_extend_high_cycle(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_extend_high_cycle(basePointer)
 #define SI32_I2S_A_select_extend_high_cycle(basePointer) \
@@ -1272,8 +2168,19 @@ _SI32_I2S_A_select_extend_high_cycle(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_extend_low_cycle(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->CLKCONTROL_SET  = SI32_I2S_A_CLKCONTROL_DUTYMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_extend_low_cycle(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_extend_low_cycle(basePointer)
 #define SI32_I2S_A_select_extend_low_cycle(basePointer) \
@@ -1285,8 +2192,19 @@ _SI32_I2S_A_select_extend_low_cycle(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_enable_clock_divider(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->CLKCONTROL_SET  = SI32_I2S_A_CLKCONTROL_DIVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_enable_clock_divider(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_enable_clock_divider(basePointer)
 #define SI32_I2S_A_enable_clock_divider(basePointer) \
@@ -1298,8 +2216,19 @@ _SI32_I2S_A_enable_clock_divider(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_disable_clock_divider(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->CLKCONTROL_CLR  = SI32_I2S_A_CLKCONTROL_DIVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_disable_clock_divider(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_disable_clock_divider(basePointer)
 #define SI32_I2S_A_disable_clock_divider(basePointer) \
@@ -1315,8 +2244,19 @@ _SI32_I2S_A_disable_clock_divider(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_update_clock_divider(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->CLKCONTROL_SET  = SI32_I2S_A_CLKCONTROL_CLKUPD_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_update_clock_divider(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_update_clock_divider(basePointer)
 #define SI32_I2S_A_update_clock_divider(basePointer) \
@@ -1328,8 +2268,19 @@ _SI32_I2S_A_update_clock_divider(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_tx_clock_source_as_divider_out(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->CLKCONTROL_CLR  = SI32_I2S_A_CLKCONTROL_TXCLKSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_tx_clock_source_as_divider_out(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_tx_clock_source_as_divider_out(basePointer)
 #define SI32_I2S_A_select_tx_clock_source_as_divider_out(basePointer) \
@@ -1341,8 +2292,19 @@ _SI32_I2S_A_select_tx_clock_source_as_divider_out(SI32_I2S_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_tx_clock_source_as_pin_in(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->CLKCONTROL_SET  = SI32_I2S_A_CLKCONTROL_TXCLKSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_tx_clock_source_as_pin_in(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_tx_clock_source_as_pin_in(basePointer)
 #define SI32_I2S_A_select_tx_clock_source_as_pin_in(basePointer) \
@@ -1354,8 +2316,19 @@ _SI32_I2S_A_select_tx_clock_source_as_pin_in(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_rx_clock_source_as_divider_out(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->CLKCONTROL_CLR  = SI32_I2S_A_CLKCONTROL_RXCLKSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_rx_clock_source_as_divider_out(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_rx_clock_source_as_divider_out(basePointer)
 #define SI32_I2S_A_select_rx_clock_source_as_divider_out(basePointer) \
@@ -1367,8 +2340,19 @@ _SI32_I2S_A_select_rx_clock_source_as_divider_out(SI32_I2S_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_rx_clock_source_as_pin_in(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->CLKCONTROL_SET  = SI32_I2S_A_CLKCONTROL_RXCLKSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_rx_clock_source_as_pin_in(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_rx_clock_source_as_pin_in(basePointer)
 #define SI32_I2S_A_select_rx_clock_source_as_pin_in(basePointer) \
@@ -1383,8 +2367,19 @@ _SI32_I2S_A_select_rx_clock_source_as_pin_in(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_reset_divider(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->CLKCONTROL_SET  = SI32_I2S_A_CLKCONTROL_RESET_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_reset_divider(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_reset_divider(basePointer)
 #define SI32_I2S_A_reset_divider(basePointer) \
@@ -1396,8 +2391,19 @@ _SI32_I2S_A_reset_divider(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_start_rx_clock(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->CLKCONTROL_SET  = SI32_I2S_A_CLKCONTROL_RXCLKEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_start_rx_clock(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_start_rx_clock(basePointer)
 #define SI32_I2S_A_start_rx_clock(basePointer) \
@@ -1409,8 +2415,19 @@ _SI32_I2S_A_start_rx_clock(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_stop_rx_clock(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->CLKCONTROL_CLR  = SI32_I2S_A_CLKCONTROL_RXCLKEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_stop_rx_clock(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_stop_rx_clock(basePointer)
 #define SI32_I2S_A_stop_rx_clock(basePointer) \
@@ -1422,8 +2439,19 @@ _SI32_I2S_A_stop_rx_clock(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_start_tx_clock(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->CLKCONTROL_SET  = SI32_I2S_A_CLKCONTROL_TXCLKEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_start_tx_clock(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_start_tx_clock(basePointer)
 #define SI32_I2S_A_start_tx_clock(basePointer) \
@@ -1435,8 +2463,19 @@ _SI32_I2S_A_start_tx_clock(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_stop_tx_clock(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->CLKCONTROL_CLR  = SI32_I2S_A_CLKCONTROL_TXCLKEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_stop_tx_clock(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_stop_tx_clock(basePointer)
 #define SI32_I2S_A_stop_tx_clock(basePointer) \
@@ -1451,8 +2490,19 @@ _SI32_I2S_A_stop_tx_clock(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_rx_dclk_pin_as_output(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->CLKCONTROL_CLR  = SI32_I2S_A_CLKCONTROL_RXSCLKMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_rx_dclk_pin_as_output(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_rx_dclk_pin_as_output(basePointer)
 #define SI32_I2S_A_select_rx_dclk_pin_as_output(basePointer) \
@@ -1467,8 +2517,19 @@ _SI32_I2S_A_select_rx_dclk_pin_as_output(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_rx_dclk_pin_as_input(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->CLKCONTROL_SET  = SI32_I2S_A_CLKCONTROL_RXSCLKMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_rx_dclk_pin_as_input(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_rx_dclk_pin_as_input(basePointer)
 #define SI32_I2S_A_select_rx_dclk_pin_as_input(basePointer) \
@@ -1483,8 +2544,19 @@ _SI32_I2S_A_select_rx_dclk_pin_as_input(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_tx_dclk_pin_as_output(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->CLKCONTROL_CLR  = SI32_I2S_A_CLKCONTROL_TXSCLKMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_tx_dclk_pin_as_output(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_tx_dclk_pin_as_output(basePointer)
 #define SI32_I2S_A_select_tx_dclk_pin_as_output(basePointer) \
@@ -1499,8 +2571,19 @@ _SI32_I2S_A_select_tx_dclk_pin_as_output(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_tx_dclk_pin_as_input(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->CLKCONTROL_SET  = SI32_I2S_A_CLKCONTROL_TXSCLKMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_tx_dclk_pin_as_input(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_tx_dclk_pin_as_input(basePointer)
 #define SI32_I2S_A_select_tx_dclk_pin_as_input(basePointer) \
@@ -1515,8 +2598,19 @@ _SI32_I2S_A_select_tx_dclk_pin_as_input(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_I2S_A_read_fifocontrol(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   return basePointer->FIFOCONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_I2S_A_read_fifocontrol(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_read_fifocontrol(basePointer)
 #define SI32_I2S_A_read_fifocontrol(basePointer) \
@@ -1535,9 +2629,21 @@ _SI32_I2S_A_read_fifocontrol(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  fifocontrol
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_write_fifocontrol(
+   SI32_I2S_A_Type * basePointer,
+   uint32_t fifocontrol)
+{
+   //{{
+   basePointer->FIFOCONTROL.U32 = fifocontrol;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_write_fifocontrol(SI32_I2S_A_Type* /*basePointer*/,
    uint32_t /*fifocontrol*/);
+#endif
 ///
 /// @def SI32_I2S_A_write_fifocontrol(basePointer, fifocontrol)
 #define SI32_I2S_A_write_fifocontrol(basePointer, fifocontrol) \
@@ -1561,10 +2667,31 @@ _SI32_I2S_A_write_fifocontrol(SI32_I2S_A_Type* /*basePointer*/,
 ///  Valid range is 4 bits.
 ///  Receive FIFO depth.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_set_fifo_watermarks(
+   SI32_I2S_A_Type * basePointer,
+   // Transmit FIFO depth.
+   uint32_t tx_watermark,
+   // Receive FIFO depth.
+   uint32_t rx_watermark)
+{
+   assert(tx_watermark < 16);   // tx_watermark < 2^4
+   assert(rx_watermark < 16);   // rx_watermark < 2^4
+   //{{
+   basePointer->FIFOCONTROL_CLR = SI32_I2S_A_FIFOCONTROL_TXFIFOWM_MASK
+                                  | SI32_I2S_A_FIFOCONTROL_RXFIFOWM_MASK;
+
+   basePointer->FIFOCONTROL_SET =  tx_watermark
+                                   | (rx_watermark << SI32_I2S_A_FIFOCONTROL_RXFIFOWM_SHIFT);
+   //}}
+}
+#else
 void
 _SI32_I2S_A_set_fifo_watermarks(SI32_I2S_A_Type* /*basePointer*/,
    uint32_t, /*tx_watermark*/
    uint32_t /*rx_watermark*/);
+#endif
 ///
 /// @def SI32_I2S_A_set_fifo_watermarks(basePointer, tx_watermark, rx_watermark)
 #define SI32_I2S_A_set_fifo_watermarks(basePointer, tx_watermark, rx_watermark) do{  \
@@ -1581,8 +2708,19 @@ _SI32_I2S_A_set_fifo_watermarks(SI32_I2S_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_flush_tx_fifo(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->FIFOCONTROL_SET = SI32_I2S_A_FIFOCONTROL_TXFIFOFL_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_flush_tx_fifo(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_flush_tx_fifo(basePointer)
 #define SI32_I2S_A_flush_tx_fifo(basePointer) \
@@ -1594,8 +2732,19 @@ _SI32_I2S_A_flush_tx_fifo(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_flush_rx_fifo(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->FIFOCONTROL_SET = SI32_I2S_A_FIFOCONTROL_RXFIFOFL_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_flush_rx_fifo(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_flush_rx_fifo(basePointer)
 #define SI32_I2S_A_flush_rx_fifo(basePointer) \
@@ -1610,8 +2759,19 @@ _SI32_I2S_A_flush_rx_fifo(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_I2S_A_read_intcontrol(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   return basePointer->INTCONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_I2S_A_read_intcontrol(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_read_intcontrol(basePointer)
 #define SI32_I2S_A_read_intcontrol(basePointer) \
@@ -1630,9 +2790,21 @@ _SI32_I2S_A_read_intcontrol(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  intcontrol
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_write_intcontrol(
+   SI32_I2S_A_Type * basePointer,
+   uint32_t intcontrol)
+{
+   //{{
+   basePointer->INTCONTROL.U32  = intcontrol;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_write_intcontrol(SI32_I2S_A_Type* /*basePointer*/,
    uint32_t /*intcontrol*/);
+#endif
 ///
 /// @def SI32_I2S_A_write_intcontrol(basePointer, intcontrol)
 #define SI32_I2S_A_write_intcontrol(basePointer, intcontrol) \
@@ -1644,8 +2816,19 @@ _SI32_I2S_A_write_intcontrol(SI32_I2S_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_enable_tx_fifo_underflow_interrupt(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+  basePointer->INTCONTROL_SET = SI32_I2S_A_INTCONTROL_TXUFIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_enable_tx_fifo_underflow_interrupt(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_enable_tx_fifo_underflow_interrupt(basePointer)
 #define SI32_I2S_A_enable_tx_fifo_underflow_interrupt(basePointer) \
@@ -1657,8 +2840,19 @@ _SI32_I2S_A_enable_tx_fifo_underflow_interrupt(SI32_I2S_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_disable_tx_fifo_underflow_interrupt(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->INTCONTROL_CLR = SI32_I2S_A_INTCONTROL_TXUFIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_disable_tx_fifo_underflow_interrupt(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_disable_tx_fifo_underflow_interrupt(basePointer)
 #define SI32_I2S_A_disable_tx_fifo_underflow_interrupt(basePointer) \
@@ -1670,8 +2864,19 @@ _SI32_I2S_A_disable_tx_fifo_underflow_interrupt(SI32_I2S_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2S_A_is_tx_fifo_underflow_interrupt_enabled(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->INTCONTROL.TXUFIEN);
+   //}}
+}
+#else
 bool
 _SI32_I2S_A_is_tx_fifo_underflow_interrupt_enabled(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_is_tx_fifo_underflow_interrupt_enabled(basePointer)
 #define SI32_I2S_A_is_tx_fifo_underflow_interrupt_enabled(basePointer) \
@@ -1683,8 +2888,19 @@ _SI32_I2S_A_is_tx_fifo_underflow_interrupt_enabled(SI32_I2S_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_enable_tx_fifo_watermark_interrupt(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->INTCONTROL_SET = SI32_I2S_A_INTCONTROL_TXLWMIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_enable_tx_fifo_watermark_interrupt(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_enable_tx_fifo_watermark_interrupt(basePointer)
 #define SI32_I2S_A_enable_tx_fifo_watermark_interrupt(basePointer) \
@@ -1696,8 +2912,19 @@ _SI32_I2S_A_enable_tx_fifo_watermark_interrupt(SI32_I2S_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_disable_tx_fifo_watermark_interrupt(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->INTCONTROL_CLR = SI32_I2S_A_INTCONTROL_TXLWMIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_disable_tx_fifo_watermark_interrupt(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_disable_tx_fifo_watermark_interrupt(basePointer)
 #define SI32_I2S_A_disable_tx_fifo_watermark_interrupt(basePointer) \
@@ -1709,8 +2936,19 @@ _SI32_I2S_A_disable_tx_fifo_watermark_interrupt(SI32_I2S_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2S_A_is_tx_fifo_watermark_interrupt_enabled(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->INTCONTROL.TXLWMIEN);
+   //}}
+}
+#else
 bool
 _SI32_I2S_A_is_tx_fifo_watermark_interrupt_enabled(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_is_tx_fifo_watermark_interrupt_enabled(basePointer)
 #define SI32_I2S_A_is_tx_fifo_watermark_interrupt_enabled(basePointer) \
@@ -1722,8 +2960,19 @@ _SI32_I2S_A_is_tx_fifo_watermark_interrupt_enabled(SI32_I2S_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_enable_rx_fifo_overflow_interrupt(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->INTCONTROL_SET = SI32_I2S_A_INTCONTROL_RXOFIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_enable_rx_fifo_overflow_interrupt(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_enable_rx_fifo_overflow_interrupt(basePointer)
 #define SI32_I2S_A_enable_rx_fifo_overflow_interrupt(basePointer) \
@@ -1735,8 +2984,19 @@ _SI32_I2S_A_enable_rx_fifo_overflow_interrupt(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_disable_rx_fifo_overflow_interrupt(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->INTCONTROL_CLR = SI32_I2S_A_INTCONTROL_RXOFIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_disable_rx_fifo_overflow_interrupt(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_disable_rx_fifo_overflow_interrupt(basePointer)
 #define SI32_I2S_A_disable_rx_fifo_overflow_interrupt(basePointer) \
@@ -1748,8 +3008,19 @@ _SI32_I2S_A_disable_rx_fifo_overflow_interrupt(SI32_I2S_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2S_A_is_rx_fifo_overflow_interrupt_enabled(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->INTCONTROL.RXOFIEN);
+   //}}
+}
+#else
 bool
 _SI32_I2S_A_is_rx_fifo_overflow_interrupt_enabled(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_is_rx_fifo_overflow_interrupt_enabled(basePointer)
 #define SI32_I2S_A_is_rx_fifo_overflow_interrupt_enabled(basePointer) \
@@ -1761,8 +3032,19 @@ _SI32_I2S_A_is_rx_fifo_overflow_interrupt_enabled(SI32_I2S_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_disable_rx_fifo_watermark_interrupt(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+  basePointer->INTCONTROL_CLR = SI32_I2S_A_INTCONTROL_RXHWMIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_disable_rx_fifo_watermark_interrupt(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_disable_rx_fifo_watermark_interrupt(basePointer)
 #define SI32_I2S_A_disable_rx_fifo_watermark_interrupt(basePointer) \
@@ -1774,8 +3056,19 @@ _SI32_I2S_A_disable_rx_fifo_watermark_interrupt(SI32_I2S_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_enable_rx_fifo_watermark_interrupt(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->INTCONTROL_SET = SI32_I2S_A_INTCONTROL_RXHWMIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_enable_rx_fifo_watermark_interrupt(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_enable_rx_fifo_watermark_interrupt(basePointer)
 #define SI32_I2S_A_enable_rx_fifo_watermark_interrupt(basePointer) \
@@ -1787,8 +3080,19 @@ _SI32_I2S_A_enable_rx_fifo_watermark_interrupt(SI32_I2S_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2S_A_is_rx_fifo_watermark_interrupt_enabled(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->INTCONTROL.RXHWMIEN);
+   //}}
+}
+#else
 bool
 _SI32_I2S_A_is_rx_fifo_watermark_interrupt_enabled(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_is_rx_fifo_watermark_interrupt_enabled(basePointer)
 #define SI32_I2S_A_is_rx_fifo_watermark_interrupt_enabled(basePointer) \
@@ -1803,8 +3107,19 @@ _SI32_I2S_A_is_rx_fifo_watermark_interrupt_enabled(SI32_I2S_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_I2S_A_read_dmacontrol(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DMACONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_I2S_A_read_dmacontrol(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_read_dmacontrol(basePointer)
 #define SI32_I2S_A_read_dmacontrol(basePointer) \
@@ -1823,9 +3138,21 @@ _SI32_I2S_A_read_dmacontrol(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  dmacontrol
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_write_dmacontrol(
+   SI32_I2S_A_Type * basePointer,
+   uint32_t dmacontrol)
+{
+   //{{
+   basePointer->DMACONTROL.U32  = dmacontrol;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_write_dmacontrol(SI32_I2S_A_Type* /*basePointer*/,
    uint32_t /*dmacontrol*/);
+#endif
 ///
 /// @def SI32_I2S_A_write_dmacontrol(basePointer, dmacontrol)
 #define SI32_I2S_A_write_dmacontrol(basePointer, dmacontrol) \
@@ -1837,8 +3164,19 @@ _SI32_I2S_A_write_dmacontrol(SI32_I2S_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_enable_tx_dma_channel(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->DMACONTROL_SET = SI32_I2S_A_DMACONTROL_TXDMAEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_enable_tx_dma_channel(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_enable_tx_dma_channel(basePointer)
 #define SI32_I2S_A_enable_tx_dma_channel(basePointer) \
@@ -1850,8 +3188,19 @@ _SI32_I2S_A_enable_tx_dma_channel(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_disable_tx_dma_channel(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->DMACONTROL_CLR = SI32_I2S_A_DMACONTROL_TXDMAEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_disable_tx_dma_channel(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_disable_tx_dma_channel(basePointer)
 #define SI32_I2S_A_disable_tx_dma_channel(basePointer) \
@@ -1863,8 +3212,19 @@ _SI32_I2S_A_disable_tx_dma_channel(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_enable_rx_dma_channel(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->DMACONTROL_SET = SI32_I2S_A_DMACONTROL_RXDMAEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_enable_rx_dma_channel(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_enable_rx_dma_channel(basePointer)
 #define SI32_I2S_A_enable_rx_dma_channel(basePointer) \
@@ -1876,8 +3236,19 @@ _SI32_I2S_A_enable_rx_dma_channel(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_disable_rx_dma_channel(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->DMACONTROL_CLR = SI32_I2S_A_DMACONTROL_RXDMAEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_disable_rx_dma_channel(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_disable_rx_dma_channel(basePointer)
 #define SI32_I2S_A_disable_rx_dma_channel(basePointer) \
@@ -1889,8 +3260,19 @@ _SI32_I2S_A_disable_rx_dma_channel(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_tx_dma_single_word_transfer(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->DMACONTROL_CLR = SI32_I2S_A_DMACONTROL_TXDMABMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_tx_dma_single_word_transfer(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_tx_dma_single_word_transfer(basePointer)
 #define SI32_I2S_A_select_tx_dma_single_word_transfer(basePointer) \
@@ -1902,8 +3284,19 @@ _SI32_I2S_A_select_tx_dma_single_word_transfer(SI32_I2S_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_tx_dma_four_word_transfer(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->DMACONTROL_SET = SI32_I2S_A_DMACONTROL_TXDMABMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_tx_dma_four_word_transfer(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_tx_dma_four_word_transfer(basePointer)
 #define SI32_I2S_A_select_tx_dma_four_word_transfer(basePointer) \
@@ -1915,8 +3308,19 @@ _SI32_I2S_A_select_tx_dma_four_word_transfer(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_rx_dma_single_word_transfer(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->DMACONTROL_CLR = SI32_I2S_A_DMACONTROL_RXDMABMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_rx_dma_single_word_transfer(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_rx_dma_single_word_transfer(basePointer)
 #define SI32_I2S_A_select_rx_dma_single_word_transfer(basePointer) \
@@ -1928,8 +3332,19 @@ _SI32_I2S_A_select_rx_dma_single_word_transfer(SI32_I2S_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_select_rx_dma_four_word_transfer(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->DMACONTROL_SET = SI32_I2S_A_DMACONTROL_RXDMABMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_select_rx_dma_four_word_transfer(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_select_rx_dma_four_word_transfer(basePointer)
 #define SI32_I2S_A_select_rx_dma_four_word_transfer(basePointer) \
@@ -1944,8 +3359,19 @@ _SI32_I2S_A_select_rx_dma_four_word_transfer(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_I2S_A_read_dbgcontrol(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DBGCONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_I2S_A_read_dbgcontrol(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_read_dbgcontrol(basePointer)
 #define SI32_I2S_A_read_dbgcontrol(basePointer) \
@@ -1964,9 +3390,21 @@ _SI32_I2S_A_read_dbgcontrol(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  dbgcontrol
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_write_dbgcontrol(
+   SI32_I2S_A_Type * basePointer,
+   uint32_t dbgcontrol)
+{
+   //{{
+   basePointer->DBGCONTROL.U32  = dbgcontrol;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_write_dbgcontrol(SI32_I2S_A_Type* /*basePointer*/,
    uint32_t /*dbgcontrol*/);
+#endif
 ///
 /// @def SI32_I2S_A_write_dbgcontrol(basePointer, dbgcontrol)
 #define SI32_I2S_A_write_dbgcontrol(basePointer, dbgcontrol) \
@@ -1978,8 +3416,19 @@ _SI32_I2S_A_write_dbgcontrol(SI32_I2S_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_enable_tx_clock_stall_in_debug_mode(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->DBGCONTROL_SET = SI32_I2S_A_DBGCONTROL_TXDBGMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_enable_tx_clock_stall_in_debug_mode(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_enable_tx_clock_stall_in_debug_mode(basePointer)
 #define SI32_I2S_A_enable_tx_clock_stall_in_debug_mode(basePointer) \
@@ -1991,8 +3440,19 @@ _SI32_I2S_A_enable_tx_clock_stall_in_debug_mode(SI32_I2S_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_disable_tx_clock_stall_in_debug_mode(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->DBGCONTROL_CLR = SI32_I2S_A_DBGCONTROL_TXDBGMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_disable_tx_clock_stall_in_debug_mode(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_disable_tx_clock_stall_in_debug_mode(basePointer)
 #define SI32_I2S_A_disable_tx_clock_stall_in_debug_mode(basePointer) \
@@ -2004,8 +3464,19 @@ _SI32_I2S_A_disable_tx_clock_stall_in_debug_mode(SI32_I2S_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_enable_rx_clock_stall_in_debug_mode(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->DBGCONTROL_SET = SI32_I2S_A_DBGCONTROL_RXDBGMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_enable_rx_clock_stall_in_debug_mode(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_enable_rx_clock_stall_in_debug_mode(basePointer)
 #define SI32_I2S_A_enable_rx_clock_stall_in_debug_mode(basePointer) \
@@ -2017,8 +3488,19 @@ _SI32_I2S_A_enable_rx_clock_stall_in_debug_mode(SI32_I2S_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_disable_rx_clock_stall_in_debug_mode(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->DBGCONTROL_CLR = SI32_I2S_A_DBGCONTROL_RXDBGMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_disable_rx_clock_stall_in_debug_mode(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_disable_rx_clock_stall_in_debug_mode(basePointer)
 #define SI32_I2S_A_disable_rx_clock_stall_in_debug_mode(basePointer) \
@@ -2030,8 +3512,19 @@ _SI32_I2S_A_disable_rx_clock_stall_in_debug_mode(SI32_I2S_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_enable_tx_dma_stall_in_debug_mode(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->DBGCONTROL_SET = SI32_I2S_A_DBGCONTROL_TXDBGHEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_enable_tx_dma_stall_in_debug_mode(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_enable_tx_dma_stall_in_debug_mode(basePointer)
 #define SI32_I2S_A_enable_tx_dma_stall_in_debug_mode(basePointer) \
@@ -2043,8 +3536,19 @@ _SI32_I2S_A_enable_tx_dma_stall_in_debug_mode(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_disable_tx_dma_stall_in_debug_mode(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->DBGCONTROL_CLR = SI32_I2S_A_DBGCONTROL_TXDBGHEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_disable_tx_dma_stall_in_debug_mode(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_disable_tx_dma_stall_in_debug_mode(basePointer)
 #define SI32_I2S_A_disable_tx_dma_stall_in_debug_mode(basePointer) \
@@ -2056,8 +3560,19 @@ _SI32_I2S_A_disable_tx_dma_stall_in_debug_mode(SI32_I2S_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_enable_rx_dma_stall_in_debug_mode(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->DBGCONTROL_SET = SI32_I2S_A_DBGCONTROL_RXDBGHEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_enable_rx_dma_stall_in_debug_mode(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_enable_rx_dma_stall_in_debug_mode(basePointer)
 #define SI32_I2S_A_enable_rx_dma_stall_in_debug_mode(basePointer) \
@@ -2069,8 +3584,19 @@ _SI32_I2S_A_enable_rx_dma_stall_in_debug_mode(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_disable_rx_dma_stall_in_debug_mode(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->DBGCONTROL_CLR = SI32_I2S_A_DBGCONTROL_RXDBGHEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_disable_rx_dma_stall_in_debug_mode(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_disable_rx_dma_stall_in_debug_mode(basePointer)
 #define SI32_I2S_A_disable_rx_dma_stall_in_debug_mode(basePointer) \
@@ -2085,8 +3611,19 @@ _SI32_I2S_A_disable_rx_dma_stall_in_debug_mode(SI32_I2S_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2S_A_is_tx_fifo_underflow_interrupt_pending(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->STATUS.TXUFI;
+   //}}
+}
+#else
 bool
 _SI32_I2S_A_is_tx_fifo_underflow_interrupt_pending(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_is_tx_fifo_underflow_interrupt_pending(basePointer)
 #define SI32_I2S_A_is_tx_fifo_underflow_interrupt_pending(basePointer) \
@@ -2101,8 +3638,19 @@ _SI32_I2S_A_is_tx_fifo_underflow_interrupt_pending(SI32_I2S_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2S_A_is_rx_fifo_overflow_interrupt_pending(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->STATUS.RXOFI;
+   //}}
+}
+#else
 bool
 _SI32_I2S_A_is_rx_fifo_overflow_interrupt_pending(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_is_rx_fifo_overflow_interrupt_pending(basePointer)
 #define SI32_I2S_A_is_rx_fifo_overflow_interrupt_pending(basePointer) \
@@ -2117,8 +3665,19 @@ _SI32_I2S_A_is_rx_fifo_overflow_interrupt_pending(SI32_I2S_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2S_A_is_tx_fifo_watermark_interrupt_pending(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->STATUS.TXLWMI;
+   //}}
+}
+#else
 bool
 _SI32_I2S_A_is_tx_fifo_watermark_interrupt_pending(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_is_tx_fifo_watermark_interrupt_pending(basePointer)
 #define SI32_I2S_A_is_tx_fifo_watermark_interrupt_pending(basePointer) \
@@ -2133,8 +3692,19 @@ _SI32_I2S_A_is_tx_fifo_watermark_interrupt_pending(SI32_I2S_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2S_A_is_rx_fifo_watermark_interrupt_pending(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->STATUS.RXHWMI;
+   //}}
+}
+#else
 bool
 _SI32_I2S_A_is_rx_fifo_watermark_interrupt_pending(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_is_rx_fifo_watermark_interrupt_pending(basePointer)
 #define SI32_I2S_A_is_rx_fifo_watermark_interrupt_pending(basePointer) \
@@ -2146,8 +3716,19 @@ _SI32_I2S_A_is_rx_fifo_watermark_interrupt_pending(SI32_I2S_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_clear_tx_fifo_underflow_interrupt(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS_CLR = SI32_I2S_A_STATUS_TXUFI_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_clear_tx_fifo_underflow_interrupt(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_clear_tx_fifo_underflow_interrupt(basePointer)
 #define SI32_I2S_A_clear_tx_fifo_underflow_interrupt(basePointer) \
@@ -2159,8 +3740,19 @@ _SI32_I2S_A_clear_tx_fifo_underflow_interrupt(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_clear_rx_fifo_overflow_interrupt(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS_CLR = SI32_I2S_A_STATUS_RXOFI_MASK;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_clear_rx_fifo_overflow_interrupt(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_clear_rx_fifo_overflow_interrupt(basePointer)
 #define SI32_I2S_A_clear_rx_fifo_overflow_interrupt(basePointer) \
@@ -2175,8 +3767,23 @@ _SI32_I2S_A_clear_rx_fifo_overflow_interrupt(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2S_A_is_any_interrupt_pending(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->STATUS.U32
+                 & (SI32_I2S_A_STATUS_TXUFI_MASK
+ 	                | SI32_I2S_A_STATUS_RXOFI_MASK
+ 	                | SI32_I2S_A_STATUS_TXLWMI_MASK
+                    | SI32_I2S_A_STATUS_RXHWMI_MASK));
+   //}}
+}
+#else
 bool
 _SI32_I2S_A_is_any_interrupt_pending(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_is_any_interrupt_pending(basePointer)
 #define SI32_I2S_A_is_any_interrupt_pending(basePointer) \
@@ -2188,8 +3795,20 @@ _SI32_I2S_A_is_any_interrupt_pending(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_clear_all_interrupts(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS_CLR = (SI32_I2S_A_STATUS_TXUFI_MASK
+	                           | SI32_I2S_A_STATUS_RXOFI_MASK);
+   //}}
+}
+#else
 void
 _SI32_I2S_A_clear_all_interrupts(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_clear_all_interrupts(basePointer)
 #define SI32_I2S_A_clear_all_interrupts(basePointer) do{  \
@@ -2206,8 +3825,19 @@ _SI32_I2S_A_clear_all_interrupts(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2S_A_is_divider_update_pending(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->STATUS.CDBUSYF;
+   //}}
+}
+#else
 bool
 _SI32_I2S_A_is_divider_update_pending(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_is_divider_update_pending(basePointer)
 #define SI32_I2S_A_is_divider_update_pending(basePointer) \
@@ -2222,8 +3852,19 @@ _SI32_I2S_A_is_divider_update_pending(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2S_A_is_counter_stopped(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->STATUS.CDSTS;
+   //}}
+}
+#else
 bool
 _SI32_I2S_A_is_counter_stopped(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_is_counter_stopped(basePointer)
 #define SI32_I2S_A_is_counter_stopped(basePointer) \
@@ -2238,8 +3879,19 @@ _SI32_I2S_A_is_counter_stopped(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2S_A_is_tx_extclock_synchronized(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->STATUS.TXCLKSELRF;
+   //}}
+}
+#else
 bool
 _SI32_I2S_A_is_tx_extclock_synchronized(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_is_tx_extclock_synchronized(basePointer)
 #define SI32_I2S_A_is_tx_extclock_synchronized(basePointer) \
@@ -2254,8 +3906,19 @@ _SI32_I2S_A_is_tx_extclock_synchronized(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2S_A_is_rx_extclock_synchronized(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->STATUS.RXCLKSELRF;
+   //}}
+}
+#else
 bool
 _SI32_I2S_A_is_rx_extclock_synchronized(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_is_rx_extclock_synchronized(basePointer)
 #define SI32_I2S_A_is_rx_extclock_synchronized(basePointer) \
@@ -2270,8 +3933,19 @@ _SI32_I2S_A_is_rx_extclock_synchronized(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2S_A_is_tx_clock_synchronized(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->STATUS.TXCLKENRF;
+   //}}
+}
+#else
 bool
 _SI32_I2S_A_is_tx_clock_synchronized(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_is_tx_clock_synchronized(basePointer)
 #define SI32_I2S_A_is_tx_clock_synchronized(basePointer) \
@@ -2286,8 +3960,19 @@ _SI32_I2S_A_is_tx_clock_synchronized(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_I2S_A_is_rx_clock_synchronized(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->STATUS.RXCLKENRF;
+   //}}
+}
+#else
 bool
 _SI32_I2S_A_is_rx_clock_synchronized(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_is_rx_clock_synchronized(basePointer)
 #define SI32_I2S_A_is_rx_clock_synchronized(basePointer) \
@@ -2302,8 +3987,19 @@ _SI32_I2S_A_is_rx_clock_synchronized(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_I2S_A_get_tx_fifo_count(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   return basePointer->FIFOSTATUS.TXFIFONUM;
+   //}}
+}
+#else
 uint32_t
 _SI32_I2S_A_get_tx_fifo_count(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_get_tx_fifo_count(basePointer)
 #define SI32_I2S_A_get_tx_fifo_count(basePointer) \
@@ -2318,8 +4014,19 @@ _SI32_I2S_A_get_tx_fifo_count(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_I2S_A_get_rx_fifo_count(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   return basePointer->FIFOSTATUS.RXFIFONUM;
+   //}}
+}
+#else
 uint32_t
 _SI32_I2S_A_get_rx_fifo_count(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_get_rx_fifo_count(basePointer)
 #define SI32_I2S_A_get_rx_fifo_count(basePointer) \
@@ -2335,9 +4042,21 @@ _SI32_I2S_A_get_rx_fifo_count(SI32_I2S_A_Type* /*basePointer*/);
 /// @param[in]
 ///  data_out
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_I2S_A_write_tx_fifo_u32(
+   SI32_I2S_A_Type * basePointer,
+   uint32_t data_out)
+{
+   //{{
+   basePointer->TXFIFO.U32 = data_out;
+   //}}
+}
+#else
 void
 _SI32_I2S_A_write_tx_fifo_u32(SI32_I2S_A_Type* /*basePointer*/,
    uint32_t /*data_out*/);
+#endif
 ///
 /// @def SI32_I2S_A_write_tx_fifo_u32(basePointer, data_out)
 #define SI32_I2S_A_write_tx_fifo_u32(basePointer, data_out) \
@@ -2349,8 +4068,19 @@ _SI32_I2S_A_write_tx_fifo_u32(SI32_I2S_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_I2S_A_read_rx_fifo_u32(
+   SI32_I2S_A_Type * basePointer)
+{
+   //{{
+   return basePointer->RXFIFO.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_I2S_A_read_rx_fifo_u32(SI32_I2S_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_I2S_A_read_rx_fifo_u32(basePointer)
 #define SI32_I2S_A_read_rx_fifo_u32(basePointer) \
@@ -54,9 +54,22 @@ extern "C" {
 ///  Valid range is 32 bits.
 ///  Write to the CONTROL register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_initialize(
+   SI32_IDAC_A_Type * basePointer,
+   // Write to the CONTROL register.
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_initialize(SI32_IDAC_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_IDAC_A_initialize(basePointer, control)
 #define SI32_IDAC_A_initialize(basePointer, control) \
@@ -76,9 +89,21 @@ _SI32_IDAC_A_initialize(SI32_IDAC_A_Type* /*basePointer*/,
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_write_control(
+   SI32_IDAC_A_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_write_control(SI32_IDAC_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_IDAC_A_write_control(basePointer, control)
 #define SI32_IDAC_A_write_control(basePointer, control) \
@@ -93,8 +118,19 @@ _SI32_IDAC_A_write_control(SI32_IDAC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_IDAC_A_read_control(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_IDAC_A_read_control(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_read_control(basePointer)
 #define SI32_IDAC_A_read_control(basePointer) \
@@ -116,9 +152,25 @@ _SI32_IDAC_A_read_control(SI32_IDAC_A_Type* /*basePointer*/);
 ///  IDAC output update trigger source - 0 to 7; see IDAC under Peripheral
 ///  Interface Description on datasheet for options.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_set_output_update_trigger(
+   SI32_IDAC_A_Type * basePointer,
+   // IDAC output update trigger source - 0 to 7; see IDAC under Peripheral
+   // Interface Description on datasheet for options.
+   SI32_IDAC_A_OUTPUT_UPDATE_TRIGGER_Enum_Type trigger)
+{
+   assert(trigger < 8);   // trigger < 2^3
+   //{{
+   basePointer->CONTROL_CLR = SI32_IDAC_A_CONTROL_OUPDT_MASK;
+   basePointer->CONTROL_SET = trigger;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_set_output_update_trigger(SI32_IDAC_A_Type* /*basePointer*/,
    SI32_IDAC_A_OUTPUT_UPDATE_TRIGGER_Enum_Type /*trigger*/);
+#endif
 ///
 /// @def SI32_IDAC_A_set_output_update_trigger(basePointer, trigger)
 #define SI32_IDAC_A_set_output_update_trigger(basePointer, trigger) do{  \
@@ -143,9 +195,25 @@ _SI32_IDAC_A_set_output_update_trigger(SI32_IDAC_A_Type* /*basePointer*/,
 ///  DACnTn external trigger source number  - 0 to 7; see IDAC under
 ///  Peripheral Interface Description on datasheet for options.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_set_external_trigger_channel(
+   SI32_IDAC_A_Type * basePointer,
+   // DACnTn external trigger source number  - 0 to 7; see IDAC under
+   // Peripheral Interface Description on datasheet for options.
+   uint32_t trigger_src)
+{
+   assert(trigger_src < 8);   // trigger_src < 2^3
+   //{{
+   basePointer->CONTROL_CLR = SI32_IDAC_A_CONTROL_ETRIG_MASK;
+   basePointer->CONTROL_SET = trigger_src << SI32_IDAC_A_CONTROL_ETRIG_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_set_external_trigger_channel(SI32_IDAC_A_Type* /*basePointer*/,
    uint32_t /*trigger_src*/);
+#endif
 ///
 /// @def SI32_IDAC_A_set_external_trigger_channel(basePointer, trigger_src)
 #define SI32_IDAC_A_set_external_trigger_channel(basePointer, trigger_src) do{  \
@@ -162,8 +230,20 @@ _SI32_IDAC_A_set_external_trigger_channel(SI32_IDAC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_select_output_fullscale_2ma(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_IDAC_A_CONTROL_OUTMD_MASK;
+   basePointer->CONTROL_SET = SI32_IDAC_A_CONTROL_OUTMD_2_MA_U32;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_select_output_fullscale_2ma(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_select_output_fullscale_2ma(basePointer)
 #define SI32_IDAC_A_select_output_fullscale_2ma(basePointer) do{  \
@@ -180,8 +260,20 @@ _SI32_IDAC_A_select_output_fullscale_2ma(SI32_IDAC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_select_output_fullscale_1ma(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_IDAC_A_CONTROL_OUTMD_MASK;
+   basePointer->CONTROL_SET = SI32_IDAC_A_CONTROL_OUTMD_1_MA_U32;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_select_output_fullscale_1ma(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_select_output_fullscale_1ma(basePointer)
 #define SI32_IDAC_A_select_output_fullscale_1ma(basePointer) do{  \
@@ -198,8 +290,19 @@ _SI32_IDAC_A_select_output_fullscale_1ma(SI32_IDAC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_select_output_fullscale_0p5ma(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_IDAC_A_CONTROL_OUTMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_select_output_fullscale_0p5ma(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_select_output_fullscale_0p5ma(basePointer)
 #define SI32_IDAC_A_select_output_fullscale_0p5ma(basePointer) \
@@ -214,8 +317,20 @@ _SI32_IDAC_A_select_output_fullscale_0p5ma(SI32_IDAC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_select_2x10bit_input_format(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_IDAC_A_CONTROL_INFMT_MASK;
+   basePointer->CONTROL_SET = SI32_IDAC_A_CONTROL_INFMT_2_10_BIT_U32;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_select_2x10bit_input_format(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_select_2x10bit_input_format(basePointer)
 #define SI32_IDAC_A_select_2x10bit_input_format(basePointer) do{  \
@@ -232,8 +347,19 @@ _SI32_IDAC_A_select_2x10bit_input_format(SI32_IDAC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_select_1x10bit_input_format(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_IDAC_A_CONTROL_INFMT_MASK;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_select_1x10bit_input_format(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_select_1x10bit_input_format(basePointer)
 #define SI32_IDAC_A_select_1x10bit_input_format(basePointer) \
@@ -248,8 +374,20 @@ _SI32_IDAC_A_select_1x10bit_input_format(SI32_IDAC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_select_4x8bit_input_format(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_IDAC_A_CONTROL_INFMT_MASK;
+   basePointer->CONTROL_SET = SI32_IDAC_A_CONTROL_INFMT_4_8_BIT_U32;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_select_4x8bit_input_format(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_select_4x8bit_input_format(basePointer)
 #define SI32_IDAC_A_select_4x8bit_input_format(basePointer) do{  \
@@ -263,8 +401,19 @@ _SI32_IDAC_A_select_4x8bit_input_format(SI32_IDAC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_start_dma_operation(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_IDAC_A_CONTROL_DMARUN_MASK;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_start_dma_operation(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_start_dma_operation(basePointer)
 #define SI32_IDAC_A_start_dma_operation(basePointer) \
@@ -279,8 +428,19 @@ _SI32_IDAC_A_start_dma_operation(SI32_IDAC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_IDAC_A_is_dma_operation_in_progress(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.DMARUN);
+   //}}
+}
+#else
 bool
 _SI32_IDAC_A_is_dma_operation_in_progress(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_is_dma_operation_in_progress(basePointer)
 #define SI32_IDAC_A_is_dma_operation_in_progress(basePointer) \
@@ -295,8 +455,19 @@ _SI32_IDAC_A_is_dma_operation_in_progress(SI32_IDAC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_select_left_justification(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_IDAC_A_CONTROL_JSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_select_left_justification(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_select_left_justification(basePointer)
 #define SI32_IDAC_A_select_left_justification(basePointer) \
@@ -311,8 +482,19 @@ _SI32_IDAC_A_select_left_justification(SI32_IDAC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_select_right_justification(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+  basePointer->CONTROL_CLR = SI32_IDAC_A_CONTROL_JSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_select_right_justification(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_select_right_justification(basePointer)
 #define SI32_IDAC_A_select_right_justification(basePointer) \
@@ -327,8 +509,19 @@ _SI32_IDAC_A_select_right_justification(SI32_IDAC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_reset_buffer(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_IDAC_A_CONTROL_BUFRESET_MASK;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_reset_buffer(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_reset_buffer(basePointer)
 #define SI32_IDAC_A_reset_buffer(basePointer) \
@@ -343,8 +536,19 @@ _SI32_IDAC_A_reset_buffer(SI32_IDAC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_enable_trigger(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_IDAC_A_CONTROL_TRIGINH_MASK;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_enable_trigger(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_enable_trigger(basePointer)
 #define SI32_IDAC_A_enable_trigger(basePointer) \
@@ -359,8 +563,19 @@ _SI32_IDAC_A_enable_trigger(SI32_IDAC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_disable_trigger(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_IDAC_A_CONTROL_TRIGINH_MASK;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_disable_trigger(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_disable_trigger(basePointer)
 #define SI32_IDAC_A_disable_trigger(basePointer) \
@@ -375,8 +590,19 @@ _SI32_IDAC_A_disable_trigger(SI32_IDAC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_enable_buffer_wrap(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_IDAC_A_CONTROL_WRAPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_enable_buffer_wrap(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_enable_buffer_wrap(basePointer)
 #define SI32_IDAC_A_enable_buffer_wrap(basePointer) \
@@ -391,8 +617,19 @@ _SI32_IDAC_A_enable_buffer_wrap(SI32_IDAC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_disable_buffer_wrap(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_IDAC_A_CONTROL_WRAPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_disable_buffer_wrap(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_disable_buffer_wrap(basePointer)
 #define SI32_IDAC_A_disable_buffer_wrap(basePointer) \
@@ -404,8 +641,19 @@ _SI32_IDAC_A_disable_buffer_wrap(SI32_IDAC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_enable_buffer_overrun_interrupt(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_IDAC_A_CONTROL_ORIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_enable_buffer_overrun_interrupt(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_enable_buffer_overrun_interrupt(basePointer)
 #define SI32_IDAC_A_enable_buffer_overrun_interrupt(basePointer) \
@@ -417,8 +665,19 @@ _SI32_IDAC_A_enable_buffer_overrun_interrupt(SI32_IDAC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_disable_buffer_overrun_interrupt(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_IDAC_A_CONTROL_ORIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_disable_buffer_overrun_interrupt(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_disable_buffer_overrun_interrupt(basePointer)
 #define SI32_IDAC_A_disable_buffer_overrun_interrupt(basePointer) \
@@ -430,8 +689,19 @@ _SI32_IDAC_A_disable_buffer_overrun_interrupt(SI32_IDAC_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_IDAC_A_is_buffer_overrun_interrupt_enabled(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.ORIEN);
+   //}}
+}
+#else
 bool
 _SI32_IDAC_A_is_buffer_overrun_interrupt_enabled(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_is_buffer_overrun_interrupt_enabled(basePointer)
 #define SI32_IDAC_A_is_buffer_overrun_interrupt_enabled(basePointer) \
@@ -443,8 +713,19 @@ _SI32_IDAC_A_is_buffer_overrun_interrupt_enabled(SI32_IDAC_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_enable_buffer_underrun_interrupt(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_IDAC_A_CONTROL_URIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_enable_buffer_underrun_interrupt(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_enable_buffer_underrun_interrupt(basePointer)
 #define SI32_IDAC_A_enable_buffer_underrun_interrupt(basePointer) \
@@ -456,8 +737,19 @@ _SI32_IDAC_A_enable_buffer_underrun_interrupt(SI32_IDAC_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_disable_buffer_underrun_interrupt(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_IDAC_A_CONTROL_URIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_disable_buffer_underrun_interrupt(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_disable_buffer_underrun_interrupt(basePointer)
 #define SI32_IDAC_A_disable_buffer_underrun_interrupt(basePointer) \
@@ -469,8 +761,19 @@ _SI32_IDAC_A_disable_buffer_underrun_interrupt(SI32_IDAC_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_IDAC_A_is_buffer_underrun_interrupt_enabled(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.URIEN);
+   //}}
+}
+#else
 bool
 _SI32_IDAC_A_is_buffer_underrun_interrupt_enabled(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_is_buffer_underrun_interrupt_enabled(basePointer)
 #define SI32_IDAC_A_is_buffer_underrun_interrupt_enabled(basePointer) \
@@ -482,8 +785,19 @@ _SI32_IDAC_A_is_buffer_underrun_interrupt_enabled(SI32_IDAC_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_enable_buffer_went_empty_interrupt(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_IDAC_A_CONTROL_WEIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_enable_buffer_went_empty_interrupt(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_enable_buffer_went_empty_interrupt(basePointer)
 #define SI32_IDAC_A_enable_buffer_went_empty_interrupt(basePointer) \
@@ -495,8 +809,19 @@ _SI32_IDAC_A_enable_buffer_went_empty_interrupt(SI32_IDAC_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_disable_buffer_went_empty_interrupt(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_IDAC_A_CONTROL_WEIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_disable_buffer_went_empty_interrupt(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_disable_buffer_went_empty_interrupt(basePointer)
 #define SI32_IDAC_A_disable_buffer_went_empty_interrupt(basePointer) \
@@ -508,8 +833,19 @@ _SI32_IDAC_A_disable_buffer_went_empty_interrupt(SI32_IDAC_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_IDAC_A_is_buffer_went_empty_interrupt_enabled(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.WEIEN);
+   //}}
+}
+#else
 bool
 _SI32_IDAC_A_is_buffer_went_empty_interrupt_enabled(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_is_buffer_went_empty_interrupt_enabled(basePointer)
 #define SI32_IDAC_A_is_buffer_went_empty_interrupt_enabled(basePointer) \
@@ -521,8 +857,19 @@ _SI32_IDAC_A_is_buffer_went_empty_interrupt_enabled(SI32_IDAC_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_enable_stall_in_debug_mode(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_IDAC_A_CONTROL_DBGMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_enable_stall_in_debug_mode(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_enable_stall_in_debug_mode(basePointer)
 #define SI32_IDAC_A_enable_stall_in_debug_mode(basePointer) \
@@ -534,8 +881,19 @@ _SI32_IDAC_A_enable_stall_in_debug_mode(SI32_IDAC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_disable_stall_in_debug_mode(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_IDAC_A_CONTROL_DBGMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_disable_stall_in_debug_mode(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_disable_stall_in_debug_mode(basePointer)
 #define SI32_IDAC_A_disable_stall_in_debug_mode(basePointer) \
@@ -550,8 +908,19 @@ _SI32_IDAC_A_disable_stall_in_debug_mode(SI32_IDAC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_enable_load_resistor(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_IDAC_A_CONTROL_LOADEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_enable_load_resistor(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_enable_load_resistor(basePointer)
 #define SI32_IDAC_A_enable_load_resistor(basePointer) \
@@ -566,8 +935,19 @@ _SI32_IDAC_A_enable_load_resistor(SI32_IDAC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_disable_load_resistor(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_IDAC_A_CONTROL_LOADEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_disable_load_resistor(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_disable_load_resistor(basePointer)
 #define SI32_IDAC_A_disable_load_resistor(basePointer) \
@@ -579,8 +959,19 @@ _SI32_IDAC_A_disable_load_resistor(SI32_IDAC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_enable_module(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_IDAC_A_CONTROL_IDACEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_enable_module(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_enable_module(basePointer)
 #define SI32_IDAC_A_enable_module(basePointer) \
@@ -592,8 +983,19 @@ _SI32_IDAC_A_enable_module(SI32_IDAC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_disable_module(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_IDAC_A_CONTROL_IDACEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_disable_module(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_disable_module(basePointer)
 #define SI32_IDAC_A_disable_module(basePointer) \
@@ -615,9 +1017,22 @@ _SI32_IDAC_A_disable_module(SI32_IDAC_A_Type* /*basePointer*/);
 ///  Valid range is 32 bits.
 ///  Data, formatted per INFMT bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_write_data(
+   SI32_IDAC_A_Type * basePointer,
+   // Data, formatted per INFMT bits.
+   uint32_t data_in)
+{
+   //{{
+   basePointer->DATA.U32 = data_in;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_write_data(SI32_IDAC_A_Type* /*basePointer*/,
    uint32_t /*data_in*/);
+#endif
 ///
 /// @def SI32_IDAC_A_write_data(basePointer, data_in)
 #define SI32_IDAC_A_write_data(basePointer, data_in) \
@@ -632,8 +1047,19 @@ _SI32_IDAC_A_write_data(SI32_IDAC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_IDAC_A_read_data(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DATA.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_IDAC_A_read_data(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_read_data(basePointer)
 #define SI32_IDAC_A_read_data(basePointer) \
@@ -651,9 +1077,22 @@ _SI32_IDAC_A_read_data(SI32_IDAC_A_Type* /*basePointer*/);
 ///  Valid range is 32 bits.
 ///  Write to BUFSTATUS register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_write_bufstatus(
+   SI32_IDAC_A_Type * basePointer,
+   // Write to BUFSTATUS register.
+   uint32_t bufstatus)
+{
+   //{{
+   basePointer->BUFSTATUS.U32 = bufstatus;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_write_bufstatus(SI32_IDAC_A_Type* /*basePointer*/,
    uint32_t /*bufstatus*/);
+#endif
 ///
 /// @def SI32_IDAC_A_write_bufstatus(basePointer, bufstatus)
 #define SI32_IDAC_A_write_bufstatus(basePointer, bufstatus) \
@@ -668,8 +1107,19 @@ _SI32_IDAC_A_write_bufstatus(SI32_IDAC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_IDAC_A_read_bufstatus(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->BUFSTATUS.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_IDAC_A_read_bufstatus(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_read_bufstatus(basePointer)
 #define SI32_IDAC_A_read_bufstatus(basePointer) \
@@ -687,8 +1137,19 @@ _SI32_IDAC_A_read_bufstatus(SI32_IDAC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_IDAC_A_read_buffer_level(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->BUFSTATUS.LEVEL;
+   //}}
+}
+#else
 uint32_t
 _SI32_IDAC_A_read_buffer_level(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_read_buffer_level(basePointer)
 #define SI32_IDAC_A_read_buffer_level(basePointer) \
@@ -703,8 +1164,19 @@ _SI32_IDAC_A_read_buffer_level(SI32_IDAC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_IDAC_A_is_buffer_overrun_interrupt_pending(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->BUFSTATUS.ORI);
+   //}}
+}
+#else
 bool
 _SI32_IDAC_A_is_buffer_overrun_interrupt_pending(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_is_buffer_overrun_interrupt_pending(basePointer)
 #define SI32_IDAC_A_is_buffer_overrun_interrupt_pending(basePointer) \
@@ -716,8 +1188,19 @@ _SI32_IDAC_A_is_buffer_overrun_interrupt_pending(SI32_IDAC_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_clear_buffer_overrun_interrupt(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   basePointer->BUFSTATUS_CLR = SI32_IDAC_A_BUFSTATUS_ORI_MASK;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_clear_buffer_overrun_interrupt(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_clear_buffer_overrun_interrupt(basePointer)
 #define SI32_IDAC_A_clear_buffer_overrun_interrupt(basePointer) \
@@ -732,8 +1215,19 @@ _SI32_IDAC_A_clear_buffer_overrun_interrupt(SI32_IDAC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_IDAC_A_is_buffer_underrun_interrupt_pending(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->BUFSTATUS.URI);
+   //}}
+}
+#else
 bool
 _SI32_IDAC_A_is_buffer_underrun_interrupt_pending(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_is_buffer_underrun_interrupt_pending(basePointer)
 #define SI32_IDAC_A_is_buffer_underrun_interrupt_pending(basePointer) \
@@ -745,8 +1239,19 @@ _SI32_IDAC_A_is_buffer_underrun_interrupt_pending(SI32_IDAC_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_clear_buffer_underrun_interrupt(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   basePointer->BUFSTATUS_CLR = SI32_IDAC_A_BUFSTATUS_URI_MASK;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_clear_buffer_underrun_interrupt(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_clear_buffer_underrun_interrupt(basePointer)
 #define SI32_IDAC_A_clear_buffer_underrun_interrupt(basePointer) \
@@ -761,8 +1266,19 @@ _SI32_IDAC_A_clear_buffer_underrun_interrupt(SI32_IDAC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_IDAC_A_is_buffer_went_empty_interrupt_pending(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->BUFSTATUS.WEI);
+   //}}
+}
+#else
 bool
 _SI32_IDAC_A_is_buffer_went_empty_interrupt_pending(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_is_buffer_went_empty_interrupt_pending(basePointer)
 #define SI32_IDAC_A_is_buffer_went_empty_interrupt_pending(basePointer) \
@@ -774,8 +1290,19 @@ _SI32_IDAC_A_is_buffer_went_empty_interrupt_pending(SI32_IDAC_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_clear_buffer_went_empty_interrupt(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   basePointer->BUFSTATUS_CLR = SI32_IDAC_A_BUFSTATUS_WEI_MASK;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_clear_buffer_went_empty_interrupt(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_clear_buffer_went_empty_interrupt(basePointer)
 #define SI32_IDAC_A_clear_buffer_went_empty_interrupt(basePointer) \
@@ -790,8 +1317,29 @@ _SI32_IDAC_A_clear_buffer_went_empty_interrupt(SI32_IDAC_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_IDAC_A_is_any_interrupt_pending(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   if (basePointer->BUFSTATUS.U32
+     &  (SI32_IDAC_A_BUFSTATUS_ORI_MASK
+	     | SI32_IDAC_A_BUFSTATUS_URI_MASK
+         | SI32_IDAC_A_BUFSTATUS_WEI_MASK))
+   {
+      return true;
+   }
+   else
+   {
+      return false;
+   }
+   //}}
+}
+#else
 bool
 _SI32_IDAC_A_is_any_interrupt_pending(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_is_any_interrupt_pending(basePointer)
 #define SI32_IDAC_A_is_any_interrupt_pending(basePointer) \
@@ -803,8 +1351,22 @@ _SI32_IDAC_A_is_any_interrupt_pending(SI32_IDAC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_clear_all_interrupts(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   basePointer->BUFSTATUS_CLR =
+        (SI32_IDAC_A_BUFSTATUS_ORI_MASK
+	     | SI32_IDAC_A_BUFSTATUS_URI_MASK
+         | SI32_IDAC_A_BUFSTATUS_WEI_MASK);
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_clear_all_interrupts(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_clear_all_interrupts(basePointer)
 #define SI32_IDAC_A_clear_all_interrupts(basePointer) do{  \
@@ -826,8 +1388,19 @@ _SI32_IDAC_A_clear_all_interrupts(SI32_IDAC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_IDAC_A_read_buffer_entry_0(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->BUFFER10.BUFFER0;
+   //}}
+}
+#else
 uint32_t
 _SI32_IDAC_A_read_buffer_entry_0(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_read_buffer_entry_0(basePointer)
 #define SI32_IDAC_A_read_buffer_entry_0(basePointer) \
@@ -845,8 +1418,19 @@ _SI32_IDAC_A_read_buffer_entry_0(SI32_IDAC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_IDAC_A_read_buffer_entry_1(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->BUFFER10.BUFFER1;
+   //}}
+}
+#else
 uint32_t
 _SI32_IDAC_A_read_buffer_entry_1(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_read_buffer_entry_1(basePointer)
 #define SI32_IDAC_A_read_buffer_entry_1(basePointer) \
@@ -864,8 +1448,19 @@ _SI32_IDAC_A_read_buffer_entry_1(SI32_IDAC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_IDAC_A_read_buffer_entry_2(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->BUFFER32.BUFFER2;
+   //}}
+}
+#else
 uint32_t
 _SI32_IDAC_A_read_buffer_entry_2(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_read_buffer_entry_2(basePointer)
 #define SI32_IDAC_A_read_buffer_entry_2(basePointer) \
@@ -883,8 +1478,19 @@ _SI32_IDAC_A_read_buffer_entry_2(SI32_IDAC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_IDAC_A_read_buffer_entry_3(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->BUFFER32.BUFFER3;
+   //}}
+}
+#else
 uint32_t
 _SI32_IDAC_A_read_buffer_entry_3(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_read_buffer_entry_3(basePointer)
 #define SI32_IDAC_A_read_buffer_entry_3(basePointer) \
@@ -902,9 +1508,22 @@ _SI32_IDAC_A_read_buffer_entry_3(SI32_IDAC_A_Type* /*basePointer*/);
 ///  Valid range is 32 bits.
 ///  Write to GAINADJ register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_write_gainadj(
+   SI32_IDAC_A_Type * basePointer,
+   // Write to GAINADJ register.
+   uint32_t gainadj)
+{
+   //{{
+   basePointer->GAINADJ.U32 = gainadj;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_write_gainadj(SI32_IDAC_A_Type* /*basePointer*/,
    uint32_t /*gainadj*/);
+#endif
 ///
 /// @def SI32_IDAC_A_write_gainadj(basePointer, gainadj)
 #define SI32_IDAC_A_write_gainadj(basePointer, gainadj) \
@@ -919,8 +1538,19 @@ _SI32_IDAC_A_write_gainadj(SI32_IDAC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_IDAC_A_read_gainadj(
+   SI32_IDAC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->GAINADJ.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_IDAC_A_read_gainadj(SI32_IDAC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IDAC_A_read_gainadj(basePointer)
 #define SI32_IDAC_A_read_gainadj(basePointer) \
@@ -938,9 +1568,23 @@ _SI32_IDAC_A_read_gainadj(SI32_IDAC_A_Type* /*basePointer*/);
 ///  Valid range is 5 bits.
 ///  Adjust full-scale output current.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IDAC_A_set_output_fullscale_adjust(
+   SI32_IDAC_A_Type * basePointer,
+   // Adjust full-scale output current.
+   uint32_t gainadj)
+{
+   assert(gainadj < 32);   // gainadj < 2^5
+   //{{
+   basePointer->GAINADJ.GAINADJ_BITS = gainadj;
+   //}}
+}
+#else
 void
 _SI32_IDAC_A_set_output_fullscale_adjust(SI32_IDAC_A_Type* /*basePointer*/,
    uint32_t /*gainadj*/);
+#endif
 ///
 /// @def SI32_IDAC_A_set_output_fullscale_adjust(basePointer, gainadj)
 #define SI32_IDAC_A_set_output_fullscale_adjust(basePointer, gainadj) \
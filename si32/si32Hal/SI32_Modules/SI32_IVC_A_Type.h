@@ -53,9 +53,21 @@ extern "C" {
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IVC_A_initialize(
+   SI32_IVC_A_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_IVC_A_initialize(SI32_IVC_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_IVC_A_initialize(basePointer, control)
 #define SI32_IVC_A_initialize(basePointer, control) \
@@ -75,9 +87,21 @@ _SI32_IVC_A_initialize(SI32_IVC_A_Type* /*basePointer*/,
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IVC_A_write_control(
+   SI32_IVC_A_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_IVC_A_write_control(SI32_IVC_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_IVC_A_write_control(basePointer, control)
 #define SI32_IVC_A_write_control(basePointer, control) \
@@ -92,8 +116,19 @@ _SI32_IVC_A_write_control(SI32_IVC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_IVC_A_read_control(
+   SI32_IVC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_IVC_A_read_control(SI32_IVC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IVC_A_read_control(basePointer)
 #define SI32_IVC_A_read_control(basePointer) \
@@ -111,9 +146,23 @@ _SI32_IVC_A_read_control(SI32_IVC_A_Type* /*basePointer*/);
 ///  Valid range is 1 to 6.
 ///  Desired range in mA from 1 to 6 (1 = 1 mA range, ..., 6 = 6 mA range).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IVC_A_select_channel_0_range(
+   SI32_IVC_A_Type * basePointer,
+   // Desired range in mA from 1 to 6 (1 = 1 mA range, ..., 6 = 6 mA range).
+   uint32_t range)
+{
+   assert((range >= 1) && (range <= 6));
+   //{{
+   basePointer->CONTROL.IN0RANGE = 6 - range;
+   //}}
+}
+#else
 void
 _SI32_IVC_A_select_channel_0_range(SI32_IVC_A_Type* /*basePointer*/,
    uint32_t /*range*/);
+#endif
 ///
 /// @def SI32_IVC_A_select_channel_0_range(basePointer, range)
 #define SI32_IVC_A_select_channel_0_range(basePointer, range) \
@@ -131,9 +180,23 @@ _SI32_IVC_A_select_channel_0_range(SI32_IVC_A_Type* /*basePointer*/,
 ///  Valid range is 1 to 6.
 ///  Desired range in mA from 1 to 6 (1 = 1 mA range, ..., 6 = 6 mA range).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IVC_A_select_channel_1_range(
+   SI32_IVC_A_Type * basePointer,
+   // Desired range in mA from 1 to 6 (1 = 1 mA range, ..., 6 = 6 mA range).
+   uint32_t range)
+{
+   assert((range >= 1) && (range <= 6));
+   //{{
+   basePointer->CONTROL.IN1RANGE = 6 - range;
+   //}}
+}
+#else
 void
 _SI32_IVC_A_select_channel_1_range(SI32_IVC_A_Type* /*basePointer*/,
    uint32_t /*range*/);
+#endif
 ///
 /// @def SI32_IVC_A_select_channel_1_range(basePointer, range)
 #define SI32_IVC_A_select_channel_1_range(basePointer, range) \
@@ -145,8 +208,19 @@ _SI32_IVC_A_select_channel_1_range(SI32_IVC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IVC_A_enable_channel_0(
+   SI32_IVC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_IVC_A_CONTROL_C0EN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_IVC_A_enable_channel_0(SI32_IVC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IVC_A_enable_channel_0(basePointer)
 #define SI32_IVC_A_enable_channel_0(basePointer) \
@@ -158,8 +232,19 @@ _SI32_IVC_A_enable_channel_0(SI32_IVC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IVC_A_disable_channel_0(
+   SI32_IVC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_IVC_A_CONTROL_C0EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_IVC_A_disable_channel_0(SI32_IVC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IVC_A_disable_channel_0(basePointer)
 #define SI32_IVC_A_disable_channel_0(basePointer) \
@@ -171,8 +256,19 @@ _SI32_IVC_A_disable_channel_0(SI32_IVC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IVC_A_enable_channel_1(
+   SI32_IVC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_IVC_A_CONTROL_C1EN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_IVC_A_enable_channel_1(SI32_IVC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IVC_A_enable_channel_1(basePointer)
 #define SI32_IVC_A_enable_channel_1(basePointer) \
@@ -184,8 +280,19 @@ _SI32_IVC_A_enable_channel_1(SI32_IVC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_IVC_A_disable_channel_1(
+   SI32_IVC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_IVC_A_CONTROL_C1EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_IVC_A_disable_channel_1(SI32_IVC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_IVC_A_disable_channel_1(basePointer)
 #define SI32_IVC_A_disable_channel_1(basePointer) \
@@ -45,8 +45,31 @@ extern "C" {
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_reset_module(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+         basePointer->CONFIG.U32       = 0x000C7E35;
+         basePointer->CLKCONTROL.U32   = 0x14B0FC00;
+         basePointer->CTRSTCONTROL.U32 = 0x32800000;
+         basePointer->VBMCONTROL.U32   = 0xE2C00000;
+         basePointer->BLKCONTROL.U32   = 0x00000000;
+         basePointer->SEGCONTROL.U32   = 0x00000000;
+         basePointer->SEGMASK0.U32     = 0x00000000;
+         basePointer->SEGMASK1.U32     = 0x00000000;
+         basePointer->SEGDATA0.U32     = 0x00000000;
+         basePointer->SEGDATA1.U32     = 0x00000000;
+         basePointer->SEGDATA2.U32     = 0x00000000;
+         basePointer->SEGDATA3.U32     = 0x00000000;
+         basePointer->SEGDATA4.U32     = 0x00000000;
+      //}}
+}
+#else
 void
 _SI32_LCD_A_reset_module(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_reset_module(basePointer)
 #define SI32_LCD_A_reset_module(basePointer) do{  \
@@ -111,6 +134,37 @@ _SI32_LCD_A_reset_module(SI32_LCD_A_Type* /*basePointer*/);
 ///  segment_mask_1
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_initialize_module(
+   SI32_LCD_A_Type * basePointer,
+   uint32_t config0,
+   uint32_t clock_control,
+   uint32_t write_blink_control,
+   uint32_t segment_control,
+   uint32_t write_contrast_control,
+   uint32_t vbat_monitor_control,
+   uint32_t segment_mask_0,
+   uint32_t segment_mask_1)
+{
+   //{{
+   basePointer->CONFIG.U32 = config0;
+   basePointer->CLKCONTROL.U32 = clock_control;
+   basePointer->BLKCONTROL.U32 = write_blink_control;
+   basePointer->SEGCONTROL.U32 = segment_control;
+   basePointer->CTRSTCONTROL.U32 = write_contrast_control;
+   basePointer->VBMCONTROL.U32 = vbat_monitor_control;
+   basePointer->SEGMASK0.U32 = segment_mask_0;
+   basePointer->SEGMASK1.U32 = segment_mask_1;
+   basePointer->SEGDATA0.U32 = 0x00000000;
+   basePointer->SEGDATA1.U32 = 0x00000000;
+   basePointer->SEGDATA2.U32 = 0x00000000;
+   basePointer->SEGDATA3.U32 = 0x00000000;
+   basePointer->SEGDATA4.U32 = 0x00000000;
+
+   //}}
+}
+#else
 void
 _SI32_LCD_A_initialize_module(SI32_LCD_A_Type* /*basePointer*/,
    uint32_t, /*config0*/
@@ -121,6 +175,7 @@ _SI32_LCD_A_initialize_module(SI32_LCD_A_Type* /*basePointer*/,
    uint32_t, /*vbat_monitor_control*/
    uint32_t, /*segment_mask_0*/
    uint32_t /*segment_mask_1*/);
+#endif
 ///
 /// @def SI32_LCD_A_initialize_module(basePointer, config0, clock_control, write_blink_control, segment_control, write_contrast_control, vbat_monitor_control, segment_mask_0, segment_mask_1)
 #define SI32_LCD_A_initialize_module(basePointer, config0, clock_control, write_blink_control, segment_control, write_contrast_control, vbat_monitor_control, segment_mask_0, segment_mask_1) do{  \
@@ -145,8 +200,20 @@ _SI32_LCD_A_initialize_module(SI32_LCD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_enable_module(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_LCD_A_CONFIG_LCDEN_MASK;
+   basePointer->CONFIG_SET = SI32_LCD_A_CONFIG_RTCCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_enable_module(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_enable_module(basePointer)
 #define SI32_LCD_A_enable_module(basePointer) do{  \
@@ -160,8 +227,20 @@ _SI32_LCD_A_enable_module(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_disable_module(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_LCD_A_CONFIG_LCDEN_MASK;
+   basePointer->CONFIG_CLR = SI32_LCD_A_CONFIG_RTCCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_disable_module(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_disable_module(basePointer)
 #define SI32_LCD_A_disable_module(basePointer) do{  \
@@ -175,8 +254,19 @@ _SI32_LCD_A_disable_module(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_LCD_A_is_module_enabled(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONFIG.LCDEN;
+   //}}
+}
+#else
 bool
 _SI32_LCD_A_is_module_enabled(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_is_module_enabled(basePointer)
 #define SI32_LCD_A_is_module_enabled(basePointer) \
@@ -192,8 +282,27 @@ _SI32_LCD_A_is_module_enabled(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_select_static_mode(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+
+   // select static mode
+   basePointer->SEGCONTROL.SEGMD =
+      SI32_LCD_A_SEGCONTROL_SEGMD_STATIC_VALUE;
+
+   // Reset bias mode.
+   basePointer->SEGCONTROL.BIASMD =
+      SI32_LCD_A_SEGCONTROL_BIASMD_ONE_THIRD_VALUE;
+
+   //}}
+}
+#else
 void
 _SI32_LCD_A_select_static_mode(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_select_static_mode(basePointer)
 #define SI32_LCD_A_select_static_mode(basePointer) do{  \
@@ -215,8 +324,29 @@ _SI32_LCD_A_select_static_mode(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_select_2_mux_mode(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+
+   // select 2-mux mode
+   basePointer->SEGCONTROL.SEGMD =
+      SI32_LCD_A_SEGCONTROL_SEGMD_2_MUX_VALUE;
+
+   // 2-mux mode requires one-half bias
+   basePointer->SEGCONTROL.BIASMD =
+      SI32_LCD_A_SEGCONTROL_BIASMD_ONE_HALF_VALUE;
+
+   // enable bias
+   basePointer->CONFIG_SET = SI32_LCD_A_CONFIG_BIASEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_select_2_mux_mode(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_select_2_mux_mode(basePointer)
 #define SI32_LCD_A_select_2_mux_mode(basePointer) do{  \
@@ -240,8 +370,29 @@ _SI32_LCD_A_select_2_mux_mode(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_select_3_mux_mode(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+
+   // select 3-mux mode
+   basePointer->SEGCONTROL.SEGMD =
+      SI32_LCD_A_SEGCONTROL_SEGMD_3_MUX_VALUE;
+
+   // 3-mux mode requires one-third bias
+   basePointer->SEGCONTROL.BIASMD =
+      SI32_LCD_A_SEGCONTROL_BIASMD_ONE_THIRD_VALUE;
+
+   // enable bias
+   basePointer->CONFIG_SET = SI32_LCD_A_CONFIG_BIASEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_select_3_mux_mode(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_select_3_mux_mode(basePointer)
 #define SI32_LCD_A_select_3_mux_mode(basePointer) do{  \
@@ -265,8 +416,29 @@ _SI32_LCD_A_select_3_mux_mode(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_select_4_mux_mode(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+
+   // select 4-mux mode
+   basePointer->SEGCONTROL.SEGMD =
+      SI32_LCD_A_SEGCONTROL_SEGMD_4_MUX_VALUE;
+
+   // 4-mux mode requires one-third bias
+   basePointer->SEGCONTROL.BIASMD =
+      SI32_LCD_A_SEGCONTROL_BIASMD_ONE_THIRD_VALUE;
+
+   // enable bias
+   basePointer->CONFIG_SET = SI32_LCD_A_CONFIG_BIASEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_select_4_mux_mode(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_select_4_mux_mode(basePointer)
 #define SI32_LCD_A_select_4_mux_mode(basePointer) do{  \
@@ -290,8 +462,30 @@ _SI32_LCD_A_select_4_mux_mode(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_select_auto_contrast_bypass_mode(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+
+   // disable full-power charge pump
+   basePointer->CONFIG_CLR = SI32_LCD_A_CONFIG_CPFPDEN_MASK;
+
+   // enable charge pump bypass
+   basePointer->CONFIG_SET = SI32_LCD_A_CONFIG_CPBEN_MASK;
+
+   // clear charge pump auto-contrast mode
+   basePointer->CONFIG_CLR = SI32_LCD_A_CONFIG_CPACEN_MASK;
+
+   // Disable VBAT monitor
+   basePointer->VBMCONTROL.VBMEN = SI32_LCD_A_VBMCONTROL_VBMOEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_select_auto_contrast_bypass_mode(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_select_auto_contrast_bypass_mode(basePointer)
 #define SI32_LCD_A_select_auto_contrast_bypass_mode(basePointer) do{  \
@@ -315,8 +509,36 @@ _SI32_LCD_A_select_auto_contrast_bypass_mode(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_select_auto_contrast_minimum_contrast_mode(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+
+   // enable bias
+   basePointer->CONFIG_SET = SI32_LCD_A_CONFIG_BIASEN_MASK;
+
+   // disable full-power charge pump
+   basePointer->CONFIG_CLR = SI32_LCD_A_CONFIG_CPFPDEN_MASK;
+
+   // enable charge pump bypass
+   basePointer->CONFIG_SET = SI32_LCD_A_CONFIG_CPBEN_MASK;
+
+   // enable charge pump auto-contrast mode
+   basePointer->CONFIG_SET = SI32_LCD_A_CONFIG_CPACEN_MASK;
+
+   // Enable Vbat monitor, offset mode, add 1 count.
+   basePointer->VBMCONTROL.U32 = (
+      SI32_LCD_A_VBMCONTROL_VBMEN_ENABLED_U32|
+      SI32_LCD_A_VBMCONTROL_VBMOEN_ENABLED_U32|
+      0x00000001);
+   //}}
+}
+#else
 void
 _SI32_LCD_A_select_auto_contrast_minimum_contrast_mode(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_select_auto_contrast_minimum_contrast_mode(basePointer)
 #define SI32_LCD_A_select_auto_contrast_minimum_contrast_mode(basePointer) do{  \
@@ -345,8 +567,36 @@ _SI32_LCD_A_select_auto_contrast_minimum_contrast_mode(SI32_LCD_A_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_select_auto_contrast_constant_contrast_mode(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+
+   // enable bias
+   basePointer->CONFIG_SET = SI32_LCD_A_CONFIG_BIASEN_MASK;
+
+   // enable full-power charge pump
+   basePointer->CONFIG_SET = SI32_LCD_A_CONFIG_CPFPDEN_MASK;
+
+   // disable charge pump bypass
+   basePointer->CONFIG_CLR = SI32_LCD_A_CONFIG_CPBEN_MASK;
+
+   // enable charge pump auto-contrast mode
+   basePointer->CONFIG_SET = SI32_LCD_A_CONFIG_CPACEN_MASK;
+
+   // Enable Vbat monitor, offset mode, add 1 count.
+   basePointer->VBMCONTROL.U32 = (
+      SI32_LCD_A_VBMCONTROL_VBMEN_ENABLED_U32|
+      SI32_LCD_A_VBMCONTROL_VBMOEN_ENABLED_U32|
+      0x00000001);
+   //}}
+}
+#else
 void
 _SI32_LCD_A_select_auto_contrast_constant_contrast_mode(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_select_auto_contrast_constant_contrast_mode(basePointer)
 #define SI32_LCD_A_select_auto_contrast_constant_contrast_mode(basePointer) do{  \
@@ -375,8 +625,36 @@ _SI32_LCD_A_select_auto_contrast_constant_contrast_mode(SI32_LCD_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_select_auto_contrast_auto_bypass_mode(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+
+   // enable bias
+   basePointer->CONFIG_SET = SI32_LCD_A_CONFIG_BIASEN_MASK;
+
+   // enable full-power charge pump
+   basePointer->CONFIG_SET = SI32_LCD_A_CONFIG_CPFPDEN_MASK;
+
+   // disable charge pump bypass
+   basePointer->CONFIG_CLR = SI32_LCD_A_CONFIG_CPBEN_MASK;
+
+   // clear charge pump auto-contrast mode
+   basePointer->CONFIG_CLR = SI32_LCD_A_CONFIG_CPACEN_MASK;
+
+   // Enable Vbat monitor, offset mode, add 1 count.
+   basePointer->VBMCONTROL.U32 = (
+      SI32_LCD_A_VBMCONTROL_VBMEN_ENABLED_U32|
+      SI32_LCD_A_VBMCONTROL_VBMOEN_ENABLED_U32|
+      0x00000001);
+   //}}
+}
+#else
 void
 _SI32_LCD_A_select_auto_contrast_auto_bypass_mode(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_select_auto_contrast_auto_bypass_mode(basePointer)
 #define SI32_LCD_A_select_auto_contrast_auto_bypass_mode(basePointer) do{  \
@@ -409,9 +687,21 @@ _SI32_LCD_A_select_auto_contrast_auto_bypass_mode(SI32_LCD_A_Type* /*basePointer
 ///  config
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_write_config(
+   SI32_LCD_A_Type * basePointer,
+   uint32_t config)
+{
+   //{{
+   basePointer->CONFIG.U32 = config;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_write_config(SI32_LCD_A_Type* /*basePointer*/,
    uint32_t /*config*/);
+#endif
 ///
 /// @def SI32_LCD_A_write_config(basePointer, config)
 #define SI32_LCD_A_write_config(basePointer, config) \
@@ -426,8 +716,19 @@ _SI32_LCD_A_write_config(SI32_LCD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_LCD_A_read_config(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONFIG.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_LCD_A_read_config(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_read_config(basePointer)
 #define SI32_LCD_A_read_config(basePointer) \
@@ -439,8 +740,19 @@ _SI32_LCD_A_read_config(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_enable_charge_pump_full_drive_mode(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_LCD_A_CONFIG_CPFPDEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_enable_charge_pump_full_drive_mode(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_enable_charge_pump_full_drive_mode(basePointer)
 #define SI32_LCD_A_enable_charge_pump_full_drive_mode(basePointer) \
@@ -452,8 +764,19 @@ _SI32_LCD_A_enable_charge_pump_full_drive_mode(SI32_LCD_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_disable_charge_pump_full_drive_mode(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_LCD_A_CONFIG_CPFPDEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_disable_charge_pump_full_drive_mode(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_disable_charge_pump_full_drive_mode(basePointer)
 #define SI32_LCD_A_disable_charge_pump_full_drive_mode(basePointer) \
@@ -465,8 +788,19 @@ _SI32_LCD_A_disable_charge_pump_full_drive_mode(SI32_LCD_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_enable_lcd_missing_clock_detector(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_LCD_A_CONFIG_MCDEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_enable_lcd_missing_clock_detector(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_enable_lcd_missing_clock_detector(basePointer)
 #define SI32_LCD_A_enable_lcd_missing_clock_detector(basePointer) \
@@ -478,8 +812,19 @@ _SI32_LCD_A_enable_lcd_missing_clock_detector(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_disable_lcd_missing_clock_detector(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_LCD_A_CONFIG_MCDEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_disable_lcd_missing_clock_detector(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_disable_lcd_missing_clock_detector(basePointer)
 #define SI32_LCD_A_disable_lcd_missing_clock_detector(basePointer) \
@@ -491,8 +836,19 @@ _SI32_LCD_A_disable_lcd_missing_clock_detector(SI32_LCD_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_LCD_A_is_lcd_missing_clock_detector_enabled(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONFIG.MCDEN;
+   //}}
+}
+#else
 bool
 _SI32_LCD_A_is_lcd_missing_clock_detector_enabled(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_is_lcd_missing_clock_detector_enabled(basePointer)
 #define SI32_LCD_A_is_lcd_missing_clock_detector_enabled(basePointer) \
@@ -504,8 +860,19 @@ _SI32_LCD_A_is_lcd_missing_clock_detector_enabled(SI32_LCD_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_enable_rtc_clock_request(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_LCD_A_CONFIG_RTCCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_enable_rtc_clock_request(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_enable_rtc_clock_request(basePointer)
 #define SI32_LCD_A_enable_rtc_clock_request(basePointer) \
@@ -517,8 +884,19 @@ _SI32_LCD_A_enable_rtc_clock_request(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_disable_rtc_clock_request(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_LCD_A_CONFIG_RTCCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_disable_rtc_clock_request(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_disable_rtc_clock_request(basePointer)
 #define SI32_LCD_A_disable_rtc_clock_request(basePointer) \
@@ -530,8 +908,19 @@ _SI32_LCD_A_disable_rtc_clock_request(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_enable_lcd_bias(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_LCD_A_CONFIG_BIASEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_enable_lcd_bias(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_enable_lcd_bias(basePointer)
 #define SI32_LCD_A_enable_lcd_bias(basePointer) \
@@ -543,8 +932,19 @@ _SI32_LCD_A_enable_lcd_bias(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_disable_lcd_bias(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_LCD_A_CONFIG_BIASEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_disable_lcd_bias(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_disable_lcd_bias(basePointer)
 #define SI32_LCD_A_disable_lcd_bias(basePointer) \
@@ -556,8 +956,19 @@ _SI32_LCD_A_disable_lcd_bias(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_LCD_A_is_lcd_bias_enabled(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONFIG.BIASEN;
+   //}}
+}
+#else
 bool
 _SI32_LCD_A_is_lcd_bias_enabled(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_is_lcd_bias_enabled(basePointer)
 #define SI32_LCD_A_is_lcd_bias_enabled(basePointer) \
@@ -569,8 +980,19 @@ _SI32_LCD_A_is_lcd_bias_enabled(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_enable_dcdc_bias(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_LCD_A_CONFIG_DCDCBIASEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_enable_dcdc_bias(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_enable_dcdc_bias(basePointer)
 #define SI32_LCD_A_enable_dcdc_bias(basePointer) \
@@ -582,8 +1004,19 @@ _SI32_LCD_A_enable_dcdc_bias(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_disable_dcdc_bias(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_LCD_A_CONFIG_DCDCBIASEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_disable_dcdc_bias(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_disable_dcdc_bias(basePointer)
 #define SI32_LCD_A_disable_dcdc_bias(basePointer) \
@@ -595,8 +1028,19 @@ _SI32_LCD_A_disable_dcdc_bias(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_LCD_A_is_dcdc_bias_enabled(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONFIG.DCDCBIASEN;
+   //}}
+}
+#else
 bool
 _SI32_LCD_A_is_dcdc_bias_enabled(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_is_dcdc_bias_enabled(basePointer)
 #define SI32_LCD_A_is_dcdc_bias_enabled(basePointer) \
@@ -608,8 +1052,19 @@ _SI32_LCD_A_is_dcdc_bias_enabled(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_enable_dcdc_standby(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_LCD_A_CONFIG_DCDCSTDBYEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_enable_dcdc_standby(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_enable_dcdc_standby(basePointer)
 #define SI32_LCD_A_enable_dcdc_standby(basePointer) \
@@ -621,8 +1076,19 @@ _SI32_LCD_A_enable_dcdc_standby(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_disable_dcdc_standby(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_LCD_A_CONFIG_DCDCSTDBYEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_disable_dcdc_standby(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_disable_dcdc_standby(basePointer)
 #define SI32_LCD_A_disable_dcdc_standby(basePointer) \
@@ -634,8 +1100,19 @@ _SI32_LCD_A_disable_dcdc_standby(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_LCD_A_is_dcdc_standby_enabled(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONFIG.DCDCSTDBYEN;
+   //}}
+}
+#else
 bool
 _SI32_LCD_A_is_dcdc_standby_enabled(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_is_dcdc_standby_enabled(basePointer)
 #define SI32_LCD_A_is_dcdc_standby_enabled(basePointer) \
@@ -647,8 +1124,19 @@ _SI32_LCD_A_is_dcdc_standby_enabled(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_enable_charge_pump_bypass(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_LCD_A_CONFIG_CPBEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_enable_charge_pump_bypass(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_enable_charge_pump_bypass(basePointer)
 #define SI32_LCD_A_enable_charge_pump_bypass(basePointer) \
@@ -660,8 +1148,19 @@ _SI32_LCD_A_enable_charge_pump_bypass(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_disable_charge_pump_bypass(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_LCD_A_CONFIG_CPBEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_disable_charge_pump_bypass(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_disable_charge_pump_bypass(basePointer)
 #define SI32_LCD_A_disable_charge_pump_bypass(basePointer) \
@@ -673,8 +1172,19 @@ _SI32_LCD_A_disable_charge_pump_bypass(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_enable_high_contrast_voltage_low_power_mode(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_LCD_A_CONFIG_HCVLPMEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_enable_high_contrast_voltage_low_power_mode(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_enable_high_contrast_voltage_low_power_mode(basePointer)
 #define SI32_LCD_A_enable_high_contrast_voltage_low_power_mode(basePointer) \
@@ -686,8 +1196,19 @@ _SI32_LCD_A_enable_high_contrast_voltage_low_power_mode(SI32_LCD_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_disable_high_contrast_voltage_low_power_mode(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_LCD_A_CONFIG_HCVLPMEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_disable_high_contrast_voltage_low_power_mode(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_disable_high_contrast_voltage_low_power_mode(basePointer)
 #define SI32_LCD_A_disable_high_contrast_voltage_low_power_mode(basePointer) \
@@ -699,8 +1220,19 @@ _SI32_LCD_A_disable_high_contrast_voltage_low_power_mode(SI32_LCD_A_Type* /*base
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_enable_vbat_monitor_low_power_mode(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_LCD_A_CONFIG_VBMLPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_enable_vbat_monitor_low_power_mode(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_enable_vbat_monitor_low_power_mode(basePointer)
 #define SI32_LCD_A_enable_vbat_monitor_low_power_mode(basePointer) \
@@ -712,8 +1244,19 @@ _SI32_LCD_A_enable_vbat_monitor_low_power_mode(SI32_LCD_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_disable_vbat_monitor_low_power_mode(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_LCD_A_CONFIG_VBMLPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_disable_vbat_monitor_low_power_mode(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_disable_vbat_monitor_low_power_mode(basePointer)
 #define SI32_LCD_A_disable_vbat_monitor_low_power_mode(basePointer) \
@@ -725,8 +1268,19 @@ _SI32_LCD_A_disable_vbat_monitor_low_power_mode(SI32_LCD_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_enable_charge_pump_oscillator_low_power_mode(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_LCD_A_CONFIG_CPOLPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_enable_charge_pump_oscillator_low_power_mode(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_enable_charge_pump_oscillator_low_power_mode(basePointer)
 #define SI32_LCD_A_enable_charge_pump_oscillator_low_power_mode(basePointer) \
@@ -738,8 +1292,19 @@ _SI32_LCD_A_enable_charge_pump_oscillator_low_power_mode(SI32_LCD_A_Type* /*base
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_disable_charge_pump_oscillator_low_power_mode(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_LCD_A_CONFIG_CPOLPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_disable_charge_pump_oscillator_low_power_mode(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_disable_charge_pump_oscillator_low_power_mode(basePointer)
 #define SI32_LCD_A_disable_charge_pump_oscillator_low_power_mode(basePointer) \
@@ -751,8 +1316,19 @@ _SI32_LCD_A_disable_charge_pump_oscillator_low_power_mode(SI32_LCD_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_enable_comparator_buffer_low_power_mode(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_LCD_A_CONFIG_CMPBLPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_enable_comparator_buffer_low_power_mode(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_enable_comparator_buffer_low_power_mode(basePointer)
 #define SI32_LCD_A_enable_comparator_buffer_low_power_mode(basePointer) \
@@ -764,8 +1340,19 @@ _SI32_LCD_A_enable_comparator_buffer_low_power_mode(SI32_LCD_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_disable_comparator_buffer_low_power_mode(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_LCD_A_CONFIG_CMPBLPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_disable_comparator_buffer_low_power_mode(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_disable_comparator_buffer_low_power_mode(basePointer)
 #define SI32_LCD_A_disable_comparator_buffer_low_power_mode(basePointer) \
@@ -777,8 +1364,19 @@ _SI32_LCD_A_disable_comparator_buffer_low_power_mode(SI32_LCD_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_enable_automatic_bias_switching(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_LCD_A_CONFIG_BIASSEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_enable_automatic_bias_switching(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_enable_automatic_bias_switching(basePointer)
 #define SI32_LCD_A_enable_automatic_bias_switching(basePointer) \
@@ -790,8 +1388,19 @@ _SI32_LCD_A_enable_automatic_bias_switching(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_disable_automatic_bias_switching(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_LCD_A_CONFIG_BIASSEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_disable_automatic_bias_switching(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_disable_automatic_bias_switching(basePointer)
 #define SI32_LCD_A_disable_automatic_bias_switching(basePointer) \
@@ -803,8 +1412,19 @@ _SI32_LCD_A_disable_automatic_bias_switching(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_enable_force_bias_continuous_mode(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_LCD_A_CONFIG_FBIASCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_enable_force_bias_continuous_mode(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_enable_force_bias_continuous_mode(basePointer)
 #define SI32_LCD_A_enable_force_bias_continuous_mode(basePointer) \
@@ -816,8 +1436,19 @@ _SI32_LCD_A_enable_force_bias_continuous_mode(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_disable_force_bias_continuous_mode(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_LCD_A_CONFIG_FBIASCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_disable_force_bias_continuous_mode(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_disable_force_bias_continuous_mode(basePointer)
 #define SI32_LCD_A_disable_force_bias_continuous_mode(basePointer) \
@@ -829,8 +1460,19 @@ _SI32_LCD_A_disable_force_bias_continuous_mode(SI32_LCD_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_enable_high_contrast_voltage_comparator_bypass(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_LCD_A_CONFIG_HCVCBYPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_enable_high_contrast_voltage_comparator_bypass(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_enable_high_contrast_voltage_comparator_bypass(basePointer)
 #define SI32_LCD_A_enable_high_contrast_voltage_comparator_bypass(basePointer) \
@@ -842,8 +1484,19 @@ _SI32_LCD_A_enable_high_contrast_voltage_comparator_bypass(SI32_LCD_A_Type* /*ba
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_disable_high_contrast_voltage_comparator_bypass(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_LCD_A_CONFIG_HCVCBYPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_disable_high_contrast_voltage_comparator_bypass(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_disable_high_contrast_voltage_comparator_bypass(basePointer)
 #define SI32_LCD_A_disable_high_contrast_voltage_comparator_bypass(basePointer) \
@@ -855,8 +1508,19 @@ _SI32_LCD_A_disable_high_contrast_voltage_comparator_bypass(SI32_LCD_A_Type* /*b
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_enable_high_contrast_voltage_comparator_force_on(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_LCD_A_CONFIG_HCVCFOEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_enable_high_contrast_voltage_comparator_force_on(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_enable_high_contrast_voltage_comparator_force_on(basePointer)
 #define SI32_LCD_A_enable_high_contrast_voltage_comparator_force_on(basePointer) \
@@ -868,8 +1532,19 @@ _SI32_LCD_A_enable_high_contrast_voltage_comparator_force_on(SI32_LCD_A_Type* /*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_disable_high_contrast_voltage_comparator_force_on(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_LCD_A_CONFIG_HCVCFOEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_disable_high_contrast_voltage_comparator_force_on(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_disable_high_contrast_voltage_comparator_force_on(basePointer)
 #define SI32_LCD_A_disable_high_contrast_voltage_comparator_force_on(basePointer) \
@@ -881,8 +1556,19 @@ _SI32_LCD_A_disable_high_contrast_voltage_comparator_force_on(SI32_LCD_A_Type* /
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_select_high_contrast_voltage_comparator_high_hysterisis_mode(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_LCD_A_CONFIG_HCVCHMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_select_high_contrast_voltage_comparator_high_hysterisis_mode(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_select_high_contrast_voltage_comparator_high_hysterisis_mode(basePointer)
 #define SI32_LCD_A_select_high_contrast_voltage_comparator_high_hysterisis_mode(basePointer) \
@@ -894,8 +1580,19 @@ _SI32_LCD_A_select_high_contrast_voltage_comparator_high_hysterisis_mode(SI32_LC
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_select_high_contrast_voltage_comparator_low_hysterisis_mode(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_LCD_A_CONFIG_HCVCHMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_select_high_contrast_voltage_comparator_low_hysterisis_mode(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_select_high_contrast_voltage_comparator_low_hysterisis_mode(basePointer)
 #define SI32_LCD_A_select_high_contrast_voltage_comparator_low_hysterisis_mode(basePointer) \
@@ -907,8 +1604,19 @@ _SI32_LCD_A_select_high_contrast_voltage_comparator_low_hysterisis_mode(SI32_LCD
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_select_high_contrast_voltage_comparator_high_bias_mode(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_LCD_A_CONFIG_HCVCBMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_select_high_contrast_voltage_comparator_high_bias_mode(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_select_high_contrast_voltage_comparator_high_bias_mode(basePointer)
 #define SI32_LCD_A_select_high_contrast_voltage_comparator_high_bias_mode(basePointer) \
@@ -920,8 +1628,19 @@ _SI32_LCD_A_select_high_contrast_voltage_comparator_high_bias_mode(SI32_LCD_A_Ty
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_select_high_contrast_voltage_comparator_low_bias_mode(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_LCD_A_CONFIG_HCVCBMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_select_high_contrast_voltage_comparator_low_bias_mode(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_select_high_contrast_voltage_comparator_low_bias_mode(basePointer)
 #define SI32_LCD_A_select_high_contrast_voltage_comparator_low_bias_mode(basePointer) \
@@ -941,9 +1660,21 @@ _SI32_LCD_A_select_high_contrast_voltage_comparator_low_bias_mode(SI32_LCD_A_Typ
 ///  value
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_write_clkcontrol(
+   SI32_LCD_A_Type * basePointer,
+   uint32_t value)
+{
+   //{{
+   basePointer->CLKCONTROL.U32 = value;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_write_clkcontrol(SI32_LCD_A_Type* /*basePointer*/,
    uint32_t /*value*/);
+#endif
 ///
 /// @def SI32_LCD_A_write_clkcontrol(basePointer, value)
 #define SI32_LCD_A_write_clkcontrol(basePointer, value) \
@@ -958,8 +1689,19 @@ _SI32_LCD_A_write_clkcontrol(SI32_LCD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_LCD_A_read_clkcontrol(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CLKCONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_LCD_A_read_clkcontrol(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_read_clkcontrol(basePointer)
 #define SI32_LCD_A_read_clkcontrol(basePointer) \
@@ -976,9 +1718,22 @@ _SI32_LCD_A_read_clkcontrol(SI32_LCD_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 10 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_write_clock_divider(
+   SI32_LCD_A_Type * basePointer,
+   uwide16_t value)
+{
+   assert(value < 1024);   // value < 2^10
+   //{{
+   basePointer->CLKCONTROL.CLKDIV = value;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_write_clock_divider(SI32_LCD_A_Type* /*basePointer*/,
    uwide16_t /*value*/);
+#endif
 ///
 /// @def SI32_LCD_A_write_clock_divider(basePointer, value)
 #define SI32_LCD_A_write_clock_divider(basePointer, value) \
@@ -990,8 +1745,20 @@ _SI32_LCD_A_write_clock_divider(SI32_LCD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_select_rtc_clock_divider_divide_by_1(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CLKCONTROL.RTCCLKDIV =
+      SI32_LCD_A_CLKCONTROL_RTCCLKDIV_DIVIDE_BY_1_VALUE;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_select_rtc_clock_divider_divide_by_1(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_select_rtc_clock_divider_divide_by_1(basePointer)
 #define SI32_LCD_A_select_rtc_clock_divider_divide_by_1(basePointer) do{  \
@@ -1005,8 +1772,20 @@ _SI32_LCD_A_select_rtc_clock_divider_divide_by_1(SI32_LCD_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_select_rtc_clock_divider_divide_by_2(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CLKCONTROL.RTCCLKDIV =
+      SI32_LCD_A_CLKCONTROL_RTCCLKDIV_DIVIDE_BY_2_VALUE;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_select_rtc_clock_divider_divide_by_2(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_select_rtc_clock_divider_divide_by_2(basePointer)
 #define SI32_LCD_A_select_rtc_clock_divider_divide_by_2(basePointer) do{  \
@@ -1020,8 +1799,20 @@ _SI32_LCD_A_select_rtc_clock_divider_divide_by_2(SI32_LCD_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_select_rtc_clock_divider_divide_by_4(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CLKCONTROL.RTCCLKDIV =
+      SI32_LCD_A_CLKCONTROL_RTCCLKDIV_DIVIDE_BY_4_VALUE;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_select_rtc_clock_divider_divide_by_4(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_select_rtc_clock_divider_divide_by_4(basePointer)
 #define SI32_LCD_A_select_rtc_clock_divider_divide_by_4(basePointer) do{  \
@@ -1035,8 +1826,20 @@ _SI32_LCD_A_select_rtc_clock_divider_divide_by_4(SI32_LCD_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_select_rtc_clock_divider_divide_by_8(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->CLKCONTROL.RTCCLKDIV =
+      SI32_LCD_A_CLKCONTROL_RTCCLKDIV_DIVIDE_BY_8_VALUE;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_select_rtc_clock_divider_divide_by_8(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_select_rtc_clock_divider_divide_by_8(basePointer)
 #define SI32_LCD_A_select_rtc_clock_divider_divide_by_8(basePointer) do{  \
@@ -1058,9 +1861,21 @@ _SI32_LCD_A_select_rtc_clock_divider_divide_by_8(SI32_LCD_A_Type* /*basePointer*
 ///  value
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_write_blkcontrol(
+   SI32_LCD_A_Type * basePointer,
+   uint32_t value)
+{
+   //{{
+   basePointer->BLKCONTROL.U32 = value;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_write_blkcontrol(SI32_LCD_A_Type* /*basePointer*/,
    uint32_t /*value*/);
+#endif
 ///
 /// @def SI32_LCD_A_write_blkcontrol(basePointer, value)
 #define SI32_LCD_A_write_blkcontrol(basePointer, value) \
@@ -1075,8 +1890,19 @@ _SI32_LCD_A_write_blkcontrol(SI32_LCD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_LCD_A_read_blkcontrol(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->BLKCONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_LCD_A_read_blkcontrol(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_read_blkcontrol(basePointer)
 #define SI32_LCD_A_read_blkcontrol(basePointer) \
@@ -1096,9 +1922,22 @@ _SI32_LCD_A_read_blkcontrol(SI32_LCD_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 8 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_write_lcd_blink_mask(
+   SI32_LCD_A_Type * basePointer,
+   uwide8_t value)
+{
+   assert(value < 256);   // value < 2^8
+   //{{
+   basePointer->BLKCONTROL.BLKMASK = value;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_write_lcd_blink_mask(SI32_LCD_A_Type* /*basePointer*/,
    uwide8_t /*value*/);
+#endif
 ///
 /// @def SI32_LCD_A_write_lcd_blink_mask(basePointer, value)
 #define SI32_LCD_A_write_lcd_blink_mask(basePointer, value) \
@@ -1118,9 +1957,22 @@ _SI32_LCD_A_write_lcd_blink_mask(SI32_LCD_A_Type* /*basePointer*/,
 ///  value
 ///  Valid range is 4 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_write_lcd_blink_exponent(
+   SI32_LCD_A_Type * basePointer,
+   uwide8_t value)
+{
+   assert(value < 16);   // value < 2^4
+   //{{
+   basePointer->BLKCONTROL.BLKREXP = value;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_write_lcd_blink_exponent(SI32_LCD_A_Type* /*basePointer*/,
    uwide8_t /*value*/);
+#endif
 ///
 /// @def SI32_LCD_A_write_lcd_blink_exponent(basePointer, value)
 #define SI32_LCD_A_write_lcd_blink_exponent(basePointer, value) \
@@ -1140,9 +1992,21 @@ _SI32_LCD_A_write_lcd_blink_exponent(SI32_LCD_A_Type* /*basePointer*/,
 ///  value
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_write_segcontrol(
+   SI32_LCD_A_Type * basePointer,
+   uint32_t value)
+{
+   //{{
+   basePointer->SEGCONTROL.U32 = value;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_write_segcontrol(SI32_LCD_A_Type* /*basePointer*/,
    uint32_t /*value*/);
+#endif
 ///
 /// @def SI32_LCD_A_write_segcontrol(basePointer, value)
 #define SI32_LCD_A_write_segcontrol(basePointer, value) \
@@ -1157,8 +2021,19 @@ _SI32_LCD_A_write_segcontrol(SI32_LCD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_LCD_A_read_segcontrol(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->SEGCONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_LCD_A_read_segcontrol(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_read_segcontrol(basePointer)
 #define SI32_LCD_A_read_segcontrol(basePointer) \
@@ -1170,8 +2045,20 @@ _SI32_LCD_A_read_segcontrol(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_select_one_third_bias(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->SEGCONTROL.BIASMD =
+      SI32_LCD_A_SEGCONTROL_BIASMD_ONE_THIRD_VALUE;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_select_one_third_bias(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_select_one_third_bias(basePointer)
 #define SI32_LCD_A_select_one_third_bias(basePointer) do{  \
@@ -1185,8 +2072,20 @@ _SI32_LCD_A_select_one_third_bias(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_select_one_half_bias(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->SEGCONTROL.BIASMD =
+      SI32_LCD_A_SEGCONTROL_BIASMD_ONE_HALF_VALUE;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_select_one_half_bias(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_select_one_half_bias(basePointer)
 #define SI32_LCD_A_select_one_half_bias(basePointer) do{  \
@@ -1200,8 +2099,20 @@ _SI32_LCD_A_select_one_half_bias(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_select_segment_mode_static(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->SEGCONTROL.SEGMD =
+      SI32_LCD_A_SEGCONTROL_SEGMD_STATIC_VALUE;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_select_segment_mode_static(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_select_segment_mode_static(basePointer)
 #define SI32_LCD_A_select_segment_mode_static(basePointer) do{  \
@@ -1215,8 +2126,20 @@ _SI32_LCD_A_select_segment_mode_static(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_select_segment_mode_2_mux(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->SEGCONTROL.SEGMD =
+      SI32_LCD_A_SEGCONTROL_SEGMD_2_MUX_VALUE;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_select_segment_mode_2_mux(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_select_segment_mode_2_mux(basePointer)
 #define SI32_LCD_A_select_segment_mode_2_mux(basePointer) do{  \
@@ -1230,8 +2153,20 @@ _SI32_LCD_A_select_segment_mode_2_mux(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_select_segment_mode_3_mux(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->SEGCONTROL.SEGMD =
+      SI32_LCD_A_SEGCONTROL_SEGMD_3_MUX_VALUE;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_select_segment_mode_3_mux(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_select_segment_mode_3_mux(basePointer)
 #define SI32_LCD_A_select_segment_mode_3_mux(basePointer) do{  \
@@ -1245,8 +2180,20 @@ _SI32_LCD_A_select_segment_mode_3_mux(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_select_segment_mode_4_mux(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->SEGCONTROL.SEGMD =
+      SI32_LCD_A_SEGCONTROL_SEGMD_4_MUX_VALUE;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_select_segment_mode_4_mux(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_select_segment_mode_4_mux(basePointer)
 #define SI32_LCD_A_select_segment_mode_4_mux(basePointer) do{  \
@@ -1260,8 +2207,20 @@ _SI32_LCD_A_select_segment_mode_4_mux(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_enable_blank_all_segments(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->SEGCONTROL.BLANKEN =
+      SI32_LCD_A_SEGCONTROL_BLANKEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_enable_blank_all_segments(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_enable_blank_all_segments(basePointer)
 #define SI32_LCD_A_enable_blank_all_segments(basePointer) do{  \
@@ -1275,8 +2234,20 @@ _SI32_LCD_A_enable_blank_all_segments(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_disable_blank_all_segments(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->SEGCONTROL.BLANKEN =
+      SI32_LCD_A_SEGCONTROL_BLANKEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_disable_blank_all_segments(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_disable_blank_all_segments(basePointer)
 #define SI32_LCD_A_disable_blank_all_segments(basePointer) do{  \
@@ -1290,8 +2261,19 @@ _SI32_LCD_A_disable_blank_all_segments(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_enable_reset_phase(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->SEGCONTROL.RPHEN = SI32_LCD_A_SEGCONTROL_RPHEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_enable_reset_phase(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_enable_reset_phase(basePointer)
 #define SI32_LCD_A_enable_reset_phase(basePointer) \
@@ -1303,8 +2285,19 @@ _SI32_LCD_A_enable_reset_phase(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_disable_reset_phase(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->SEGCONTROL.RPHEN = SI32_LCD_A_SEGCONTROL_RPHEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_disable_reset_phase(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_disable_reset_phase(basePointer)
 #define SI32_LCD_A_disable_reset_phase(basePointer) \
@@ -1324,9 +2317,22 @@ _SI32_LCD_A_disable_reset_phase(SI32_LCD_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 3 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_write_reset_phase_count_u8(
+   SI32_LCD_A_Type * basePointer,
+   uwide8_t value)
+{
+   assert(value < 8);   // value < 2^3
+   //{{
+   basePointer->SEGCONTROL.RPHMD = value;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_write_reset_phase_count_u8(SI32_LCD_A_Type* /*basePointer*/,
    uwide8_t /*value*/);
+#endif
 ///
 /// @def SI32_LCD_A_write_reset_phase_count_u8(basePointer, value)
 #define SI32_LCD_A_write_reset_phase_count_u8(basePointer, value) \
@@ -1346,9 +2352,21 @@ _SI32_LCD_A_write_reset_phase_count_u8(SI32_LCD_A_Type* /*basePointer*/,
 ///  value
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_write_ctrstcontrol(
+   SI32_LCD_A_Type * basePointer,
+   uint32_t value)
+{
+   //{{
+   basePointer->CTRSTCONTROL.U32 = value;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_write_ctrstcontrol(SI32_LCD_A_Type* /*basePointer*/,
    uint32_t /*value*/);
+#endif
 ///
 /// @def SI32_LCD_A_write_ctrstcontrol(basePointer, value)
 #define SI32_LCD_A_write_ctrstcontrol(basePointer, value) \
@@ -1363,8 +2381,19 @@ _SI32_LCD_A_write_ctrstcontrol(SI32_LCD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_LCD_A_read_ctrstcontrol(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CTRSTCONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_LCD_A_read_ctrstcontrol(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_read_ctrstcontrol(basePointer)
 #define SI32_LCD_A_read_ctrstcontrol(basePointer) \
@@ -1384,9 +2413,22 @@ _SI32_LCD_A_read_ctrstcontrol(SI32_LCD_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 5 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_write_lcd_contrast(
+   SI32_LCD_A_Type * basePointer,
+   uwide8_t value)
+{
+   assert(value < 32);   // value < 2^5
+   //{{
+   basePointer->CTRSTCONTROL.CTRST = value;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_write_lcd_contrast(SI32_LCD_A_Type* /*basePointer*/,
    uwide8_t /*value*/);
+#endif
 ///
 /// @def SI32_LCD_A_write_lcd_contrast(basePointer, value)
 #define SI32_LCD_A_write_lcd_contrast(basePointer, value) \
@@ -1406,9 +2448,21 @@ _SI32_LCD_A_write_lcd_contrast(SI32_LCD_A_Type* /*basePointer*/,
 ///  value
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_write_vbmcontrol(
+   SI32_LCD_A_Type * basePointer,
+   uint32_t value)
+{
+   //{{
+   basePointer->VBMCONTROL.U32 = value;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_write_vbmcontrol(SI32_LCD_A_Type* /*basePointer*/,
    uint32_t /*value*/);
+#endif
 ///
 /// @def SI32_LCD_A_write_vbmcontrol(basePointer, value)
 #define SI32_LCD_A_write_vbmcontrol(basePointer, value) \
@@ -1423,8 +2477,19 @@ _SI32_LCD_A_write_vbmcontrol(SI32_LCD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_LCD_A_read_vbmcontrol(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->VBMCONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_LCD_A_read_vbmcontrol(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_read_vbmcontrol(basePointer)
 #define SI32_LCD_A_read_vbmcontrol(basePointer) \
@@ -1444,9 +2509,22 @@ _SI32_LCD_A_read_vbmcontrol(SI32_LCD_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 5 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_write_vbat_monitor_threshold(
+   SI32_LCD_A_Type * basePointer,
+   uwide8_t value)
+{
+   assert(value < 32);   // value < 2^5
+   //{{
+   basePointer->VBMCONTROL.VBMTH = value;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_write_vbat_monitor_threshold(SI32_LCD_A_Type* /*basePointer*/,
    uwide8_t /*value*/);
+#endif
 ///
 /// @def SI32_LCD_A_write_vbat_monitor_threshold(basePointer, value)
 #define SI32_LCD_A_write_vbat_monitor_threshold(basePointer, value) \
@@ -1458,8 +2536,19 @@ _SI32_LCD_A_write_vbat_monitor_threshold(SI32_LCD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_enable_vbat_monitor_capacitor_divider(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->VBMCONTROL.VBMCDEN = SI32_LCD_A_VBMCONTROL_VBMCDEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_enable_vbat_monitor_capacitor_divider(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_enable_vbat_monitor_capacitor_divider(basePointer)
 #define SI32_LCD_A_enable_vbat_monitor_capacitor_divider(basePointer) \
@@ -1471,8 +2560,19 @@ _SI32_LCD_A_enable_vbat_monitor_capacitor_divider(SI32_LCD_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_disable_vbat_monitor_capacitor_divider(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->VBMCONTROL.VBMCDEN = SI32_LCD_A_VBMCONTROL_VBMCDEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_disable_vbat_monitor_capacitor_divider(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_disable_vbat_monitor_capacitor_divider(basePointer)
 #define SI32_LCD_A_disable_vbat_monitor_capacitor_divider(basePointer) \
@@ -1484,8 +2584,19 @@ _SI32_LCD_A_disable_vbat_monitor_capacitor_divider(SI32_LCD_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_enable_vbat_monitor_offset(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->VBMCONTROL.VBMOEN = SI32_LCD_A_VBMCONTROL_VBMOEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_enable_vbat_monitor_offset(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_enable_vbat_monitor_offset(basePointer)
 #define SI32_LCD_A_enable_vbat_monitor_offset(basePointer) \
@@ -1497,8 +2608,19 @@ _SI32_LCD_A_enable_vbat_monitor_offset(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_disable_vbat_monitor_offset(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->VBMCONTROL.VBMOEN = SI32_LCD_A_VBMCONTROL_VBMOEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_disable_vbat_monitor_offset(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_disable_vbat_monitor_offset(basePointer)
 #define SI32_LCD_A_disable_vbat_monitor_offset(basePointer) \
@@ -1510,8 +2632,19 @@ _SI32_LCD_A_disable_vbat_monitor_offset(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_enable_vbat_monitor(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->VBMCONTROL.VBMEN = SI32_LCD_A_VBMCONTROL_VBMEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_enable_vbat_monitor(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_enable_vbat_monitor(basePointer)
 #define SI32_LCD_A_enable_vbat_monitor(basePointer) \
@@ -1523,8 +2656,19 @@ _SI32_LCD_A_enable_vbat_monitor(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_disable_vbat_monitor(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   basePointer->VBMCONTROL.VBMEN = SI32_LCD_A_VBMCONTROL_VBMEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_disable_vbat_monitor(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_disable_vbat_monitor(basePointer)
 #define SI32_LCD_A_disable_vbat_monitor(basePointer) \
@@ -1536,8 +2680,19 @@ _SI32_LCD_A_disable_vbat_monitor(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_LCD_A_is_vbat_monitor_enabled(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   return (basePointer->VBMCONTROL.VBMEN);
+   //}}
+}
+#else
 bool
 _SI32_LCD_A_is_vbat_monitor_enabled(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_is_vbat_monitor_enabled(basePointer)
 #define SI32_LCD_A_is_vbat_monitor_enabled(basePointer) \
@@ -1557,9 +2712,21 @@ _SI32_LCD_A_is_vbat_monitor_enabled(SI32_LCD_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_write_segmask0(
+   SI32_LCD_A_Type * basePointer,
+   uint32_t value)
+{
+   //{{
+   basePointer->SEGMASK0.U32 = value;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_write_segmask0(SI32_LCD_A_Type* /*basePointer*/,
    uint32_t /*value*/);
+#endif
 ///
 /// @def SI32_LCD_A_write_segmask0(basePointer, value)
 #define SI32_LCD_A_write_segmask0(basePointer, value) \
@@ -1571,8 +2738,19 @@ _SI32_LCD_A_write_segmask0(SI32_LCD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_LCD_A_read_segmask0(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->SEGMASK0.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_LCD_A_read_segmask0(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_read_segmask0(basePointer)
 #define SI32_LCD_A_read_segmask0(basePointer) \
@@ -1592,9 +2770,22 @@ _SI32_LCD_A_read_segmask0(SI32_LCD_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 8 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_write_segmask1(
+   SI32_LCD_A_Type * basePointer,
+   uwide8_t value)
+{
+   assert(value < 256);   // value < 2^8
+   //{{
+   basePointer->SEGMASK1.SEGEN = value;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_write_segmask1(SI32_LCD_A_Type* /*basePointer*/,
    uwide8_t /*value*/);
+#endif
 ///
 /// @def SI32_LCD_A_write_segmask1(basePointer, value)
 #define SI32_LCD_A_write_segmask1(basePointer, value) \
@@ -1606,8 +2797,19 @@ _SI32_LCD_A_write_segmask1(SI32_LCD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide8_t
+_SI32_LCD_A_read_segmask1(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->SEGMASK1.SEGEN;
+   //}}
+}
+#else
 uwide8_t
 _SI32_LCD_A_read_segmask1(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_read_segmask1(basePointer)
 #define SI32_LCD_A_read_segmask1(basePointer) \
@@ -1627,9 +2829,31 @@ _SI32_LCD_A_read_segmask1(SI32_LCD_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 0 to 40.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_write_number_of_segments(
+   SI32_LCD_A_Type * basePointer,
+   uwide8_t value)
+{
+   assert(value <= 40);
+   //{{
+   if(value>32)
+   {
+      basePointer->SEGMASK0.U32 = 0xFFFFFFFF;;
+      basePointer->SEGMASK1.U32 = 0x000000FF>>(40-value);
+   }
+   else
+   {
+      basePointer->SEGMASK0.U32 = 0xFFFFFFFF>>(32-value);;
+      basePointer->SEGMASK1.U32 = 0x00000000;
+   }
+   //}}
+}
+#else
 void
 _SI32_LCD_A_write_number_of_segments(SI32_LCD_A_Type* /*basePointer*/,
    uwide8_t /*value*/);
+#endif
 ///
 /// @def SI32_LCD_A_write_number_of_segments(basePointer, value)
 #define SI32_LCD_A_write_number_of_segments(basePointer, value) \
@@ -1649,9 +2873,21 @@ _SI32_LCD_A_write_number_of_segments(SI32_LCD_A_Type* /*basePointer*/,
 ///  value
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_write_segdata0(
+   SI32_LCD_A_Type * basePointer,
+   uint32_t value)
+{
+   //{{
+   basePointer->SEGDATA0.U32 = value;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_write_segdata0(SI32_LCD_A_Type* /*basePointer*/,
    uint32_t /*value*/);
+#endif
 ///
 /// @def SI32_LCD_A_write_segdata0(basePointer, value)
 #define SI32_LCD_A_write_segdata0(basePointer, value) \
@@ -1666,8 +2902,19 @@ _SI32_LCD_A_write_segdata0(SI32_LCD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_LCD_A_read_segdata0(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->SEGDATA0.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_LCD_A_read_segdata0(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_read_segdata0(basePointer)
 #define SI32_LCD_A_read_segdata0(basePointer) \
@@ -1687,9 +2934,21 @@ _SI32_LCD_A_read_segdata0(SI32_LCD_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_write_segdata1(
+   SI32_LCD_A_Type * basePointer,
+   uint32_t value)
+{
+   //{{
+   basePointer->SEGDATA1.U32 = value;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_write_segdata1(SI32_LCD_A_Type* /*basePointer*/,
    uint32_t /*value*/);
+#endif
 ///
 /// @def SI32_LCD_A_write_segdata1(basePointer, value)
 #define SI32_LCD_A_write_segdata1(basePointer, value) \
@@ -1704,8 +2963,19 @@ _SI32_LCD_A_write_segdata1(SI32_LCD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_LCD_A_read_segdata1(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->SEGDATA1.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_LCD_A_read_segdata1(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_read_segdata1(basePointer)
 #define SI32_LCD_A_read_segdata1(basePointer) \
@@ -1725,9 +2995,21 @@ _SI32_LCD_A_read_segdata1(SI32_LCD_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_write_segdata2(
+   SI32_LCD_A_Type * basePointer,
+   uint32_t value)
+{
+   //{{
+   basePointer->SEGDATA2.U32 = value;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_write_segdata2(SI32_LCD_A_Type* /*basePointer*/,
    uint32_t /*value*/);
+#endif
 ///
 /// @def SI32_LCD_A_write_segdata2(basePointer, value)
 #define SI32_LCD_A_write_segdata2(basePointer, value) \
@@ -1742,8 +3024,19 @@ _SI32_LCD_A_write_segdata2(SI32_LCD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_LCD_A_read_segdata2(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->SEGDATA2.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_LCD_A_read_segdata2(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_read_segdata2(basePointer)
 #define SI32_LCD_A_read_segdata2(basePointer) \
@@ -1763,9 +3056,21 @@ _SI32_LCD_A_read_segdata2(SI32_LCD_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_write_segdata3(
+   SI32_LCD_A_Type * basePointer,
+   uint32_t value)
+{
+   //{{
+   basePointer->SEGDATA3.U32 = value;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_write_segdata3(SI32_LCD_A_Type* /*basePointer*/,
    uint32_t /*value*/);
+#endif
 ///
 /// @def SI32_LCD_A_write_segdata3(basePointer, value)
 #define SI32_LCD_A_write_segdata3(basePointer, value) \
@@ -1780,8 +3085,19 @@ _SI32_LCD_A_write_segdata3(SI32_LCD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_LCD_A_read_segdata3(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->SEGDATA3.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_LCD_A_read_segdata3(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_read_segdata3(basePointer)
 #define SI32_LCD_A_read_segdata3(basePointer) \
@@ -1801,9 +3117,21 @@ _SI32_LCD_A_read_segdata3(SI32_LCD_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_write_segdata4(
+   SI32_LCD_A_Type * basePointer,
+   uint32_t value)
+{
+   //{{
+   basePointer->SEGDATA4.U32 = value;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_write_segdata4(SI32_LCD_A_Type* /*basePointer*/,
    uint32_t /*value*/);
+#endif
 ///
 /// @def SI32_LCD_A_write_segdata4(basePointer, value)
 #define SI32_LCD_A_write_segdata4(basePointer, value) \
@@ -1818,8 +3146,19 @@ _SI32_LCD_A_write_segdata4(SI32_LCD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_LCD_A_read_segdata4(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->SEGDATA4.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_LCD_A_read_segdata4(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_read_segdata4(basePointer)
 #define SI32_LCD_A_read_segdata4(basePointer) \
@@ -1831,8 +3170,23 @@ _SI32_LCD_A_read_segdata4(SI32_LCD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_clear_all_segment_data(
+   SI32_LCD_A_Type * basePointer)
+{
+   //{{
+      basePointer->SEGDATA0.U32 = 0x00000000;
+      basePointer->SEGDATA1.U32 = 0x00000000;
+      basePointer->SEGDATA2.U32 = 0x00000000;
+      basePointer->SEGDATA3.U32 = 0x00000000;
+      basePointer->SEGDATA4.U32 = 0x00000000;
+   //}}
+}
+#else
 void
 _SI32_LCD_A_clear_all_segment_data(SI32_LCD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LCD_A_clear_all_segment_data(basePointer)
 #define SI32_LCD_A_clear_all_segment_data(basePointer) do{  \
@@ -1862,10 +3216,45 @@ _SI32_LCD_A_clear_all_segment_data(SI32_LCD_A_Type* /*basePointer*/);
 ///  index
 ///  Valid range is 0 to 4.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_write_segment_data_u32(
+   SI32_LCD_A_Type * basePointer,
+   uint32_t value,
+   uwide8_t index)
+{
+   assert(index <= 4);
+   //{{
+   switch (index)
+   {
+      case 0:
+         basePointer->SEGDATA0.U32 = value;
+         break;
+
+      case 1:
+         basePointer->SEGDATA1.U32 = value;
+         break;
+
+      case 2:
+         basePointer->SEGDATA2.U32 = value;
+         break;
+
+      case 3:
+         basePointer->SEGDATA3.U32 = value;
+         break;
+
+      case 4:
+         basePointer->SEGDATA4.U32 = value;
+         break;
+   }
+   //}}
+}
+#else
 void
 _SI32_LCD_A_write_segment_data_u32(SI32_LCD_A_Type* /*basePointer*/,
    uint32_t, /*value*/
    uwide8_t /*index*/);
+#endif
 ///
 /// @def SI32_LCD_A_write_segment_data_u32(basePointer, value, index)
 #define SI32_LCD_A_write_segment_data_u32(basePointer, value, index) \
@@ -1890,10 +3279,51 @@ _SI32_LCD_A_write_segment_data_u32(SI32_LCD_A_Type* /*basePointer*/,
 ///  index
 ///  Valid range is 0 to 9.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_write_segment_data_u16(
+   SI32_LCD_A_Type * basePointer,
+   uwide16_t value,
+   uwide8_t index)
+{
+   assert(value < 65536);   // value < 2^16
+   assert(index <= 9);
+   //{{
+   switch (index>>1)
+   {
+      case 0:
+         basePointer->SEGDATA0.U16[index&1] = value;
+         //*((uint16_t *)(&(basePointer->SEGDATA0.U32))[index&1]) = value;
+         break;
+
+      case 1:
+         basePointer->SEGDATA1.U16[index&1] = value;
+         //*((uint16_t *)(&(basePointer->SEGDATA1.U32))[index&0x00000001]) = value;
+         break;
+
+      case 2:
+         basePointer->SEGDATA2.U16[index&1] = value;
+         //*((uint16_t *)(&(basePointer->SEGDATA2.U32))[index&0x00000001]) = value;
+         break;
+
+      case 3:
+         basePointer->SEGDATA3.U16[index&1] = value;
+         //*((uint16_t *)(&(basePointer->SEGDATA3.U32))[index&0x00000001]) = value;
+         break;
+
+      case 4:
+         basePointer->SEGDATA4.U16[index&1] = value;
+         //*((uint16_t *)(&(basePointer->SEGDATA4.U32))[index&0x00000001]) = value;
+         break;
+   }
+   //}}
+}
+#else
 void
 _SI32_LCD_A_write_segment_data_u16(SI32_LCD_A_Type* /*basePointer*/,
    uwide16_t, /*value*/
    uwide8_t /*index*/);
+#endif
 ///
 /// @def SI32_LCD_A_write_segment_data_u16(basePointer, value, index)
 #define SI32_LCD_A_write_segment_data_u16(basePointer, value, index) \
@@ -1918,10 +3348,52 @@ _SI32_LCD_A_write_segment_data_u16(SI32_LCD_A_Type* /*basePointer*/,
 ///  index
 ///  Valid range is 0 to 19.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_write_segment_data_u8(
+   SI32_LCD_A_Type * basePointer,
+   uwide8_t value,
+   uwide8_t index)
+{
+   assert(value < 256);   // value < 2^8
+   assert(index <= 19);
+   //{{
+
+   switch (index>>2)
+   {
+      case 0:
+         basePointer->SEGDATA0.U8[index&3] = value;
+         //*((uint8_t *)(&(basePointer->SEGDATA0.U32))[index&0x00000003]) = value;
+         break;
+
+      case 1:
+         basePointer->SEGDATA1.U8[index&3] = value;
+         //*((uint8_t *)(&(basePointer->SEGDATA1.U32))[index&0x00000003]) = value;
+         break;
+
+      case 2:
+         basePointer->SEGDATA2.U8[index&3] = value;
+         //*((uint8_t *)(&(basePointer->SEGDATA2.U32))[index&0x00000003]) = value;
+         break;
+
+      case 3:
+         basePointer->SEGDATA3.U8[index&3] = value;
+         //*((uint8_t *)(&(basePointer->SEGDATA3.U32))[index&0x00000003]) = value;
+         break;
+
+      case 4:
+         basePointer->SEGDATA4.U8[index&3] = value;
+         //*((uint8_t *)(&(basePointer->SEGDATA4.U32))[index&0x00000003]) = value;
+         break;
+   }
+   //}}
+}
+#else
 void
 _SI32_LCD_A_write_segment_data_u8(SI32_LCD_A_Type* /*basePointer*/,
    uwide8_t, /*value*/
    uwide8_t /*index*/);
+#endif
 ///
 /// @def SI32_LCD_A_write_segment_data_u8(basePointer, value, index)
 #define SI32_LCD_A_write_segment_data_u8(basePointer, value, index) \
@@ -1941,9 +3413,42 @@ _SI32_LCD_A_write_segment_data_u8(SI32_LCD_A_Type* /*basePointer*/,
 ///  index
 ///  Valid range is 0 to 4.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_LCD_A_read_segment_data_u32(
+   SI32_LCD_A_Type * basePointer,
+   uwide8_t index)
+{
+   assert(index <= 4);
+   //{{
+   switch (index)
+   {
+      case 0:
+         return basePointer->SEGDATA0.U32;
+
+      case 1:
+         return basePointer->SEGDATA1.U32;
+
+      case 2:
+         return basePointer->SEGDATA2.U32;
+
+      case 3:
+         return basePointer->SEGDATA3.U32;
+
+      case 4:
+         return basePointer->SEGDATA4.U32;
+
+      default:
+         return 0;
+
+   }
+   //}}
+}
+#else
 uint32_t
 _SI32_LCD_A_read_segment_data_u32(SI32_LCD_A_Type* /*basePointer*/,
    uwide8_t /*index*/);
+#endif
 ///
 /// @def SI32_LCD_A_read_segment_data_u32(basePointer, index)
 #define SI32_LCD_A_read_segment_data_u32(basePointer, index) \
@@ -1963,9 +3468,46 @@ _SI32_LCD_A_read_segment_data_u32(SI32_LCD_A_Type* /*basePointer*/,
 ///  index
 ///  Valid range is 0 to 9.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide16_t
+_SI32_LCD_A_read_segment_data_u16(
+   SI32_LCD_A_Type * basePointer,
+   uwide8_t index)
+{
+   assert(index <= 9);
+   //{{
+   switch (index>>1)
+   {
+      case 0:
+         return basePointer->SEGDATA0.U16[index&1];
+         //return *((uint16_t *)(&(basePointer->SEGDATA0.U32))[index&1]);
+
+      case 1:
+         return basePointer->SEGDATA1.U16[index&1];
+         //return *((uint16_t *)(&(basePointer->SEGDATA1.U32))[index&1]);
+
+      case 2:
+         return basePointer->SEGDATA2.U16[index&1];
+         //return *((uint16_t *)(&(basePointer->SEGDATA2.U32))[index&1]);
+
+      case 3:
+         return basePointer->SEGDATA3.U16[index&1];
+         //return *((uint16_t *)(&(basePointer->SEGDATA3.U32))[index&1]);
+
+      case 4:
+         return basePointer->SEGDATA4.U16[index&1];
+         //return *((uint16_t *)(&(basePointer->SEGDATA4.U32))[index&1]);
+
+      default:
+         return 0;
+   }
+   //}}
+}
+#else
 uwide16_t
 _SI32_LCD_A_read_segment_data_u16(SI32_LCD_A_Type* /*basePointer*/,
    uwide8_t /*index*/);
+#endif
 ///
 /// @def SI32_LCD_A_read_segment_data_u16(basePointer, index)
 #define SI32_LCD_A_read_segment_data_u16(basePointer, index) \
@@ -1985,9 +3527,47 @@ _SI32_LCD_A_read_segment_data_u16(SI32_LCD_A_Type* /*basePointer*/,
 ///  index
 ///  Valid range is 0 to 19.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide8_t
+_SI32_LCD_A_read_segment_data_u8(
+   SI32_LCD_A_Type * basePointer,
+   uwide8_t index)
+{
+   assert(index <= 19);
+   //{{
+   switch (index>>2)
+   {
+      case 0:
+         return basePointer->SEGDATA0.U8[index&3];
+         //return *((uint8_t *)(&(basePointer->SEGDATA0.U32))[index&3]);
+
+      case 1:
+         return basePointer->SEGDATA1.U8[index&3];
+         //return *((uint8_t *)(&(basePointer->SEGDATA0.U32))[index&3]);
+
+      case 2:
+         return basePointer->SEGDATA2.U8[index&3];
+         //return *((uint8_t *)(&(basePointer->SEGDATA0.U32))[index&3]);
+
+      case 3:
+         return basePointer->SEGDATA3.U8[index&3];
+         //return *((uint8_t *)(&(basePointer->SEGDATA0.U32))[index&3]);
+
+      case 4:
+         return basePointer->SEGDATA4.U8[index&3];
+         //return *((uint8_t *)(&(basePointer->SEGDATA0.U32))[index&3]);
+
+      default:
+         return 0;
+
+   }
+   //}}
+}
+#else
 uwide8_t
 _SI32_LCD_A_read_segment_data_u8(SI32_LCD_A_Type* /*basePointer*/,
    uwide8_t /*index*/);
+#endif
 ///
 /// @def SI32_LCD_A_read_segment_data_u8(basePointer, index)
 #define SI32_LCD_A_read_segment_data_u8(basePointer, index) \
@@ -2005,9 +3585,44 @@ _SI32_LCD_A_read_segment_data_u8(SI32_LCD_A_Type* /*basePointer*/,
 ///  Valid range is 0 to 159.
 ///  Set segment bit (0 thorugh 159).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_set_segment_bit(
+   SI32_LCD_A_Type * basePointer,
+   // Set segment bit (0 thorugh 159).
+   uwide8_t index)
+{
+   assert(index <= 159);
+   //{{
+   switch (index >> 5 )
+   {
+      case 0:
+         basePointer->SEGDATA0.U32 |= (1<<(index&0x1F));
+         break;
+
+      case 1:
+         basePointer->SEGDATA1.U32 |= (1<<(index&0x1F));
+         break;
+
+      case 2:
+         basePointer->SEGDATA2.U32 |= (1<<(index&0x1F));
+         break;
+
+      case 3:
+         basePointer->SEGDATA3.U32 |= (1<<(index&0x1F));
+         break;
+
+      case 4:
+         basePointer->SEGDATA4.U32 |= (1<<(index&0x1F));
+         break;
+   }
+   //}}
+}
+#else
 void
 _SI32_LCD_A_set_segment_bit(SI32_LCD_A_Type* /*basePointer*/,
    uwide8_t /*index*/);
+#endif
 ///
 /// @def SI32_LCD_A_set_segment_bit(basePointer, index)
 #define SI32_LCD_A_set_segment_bit(basePointer, index) \
@@ -2025,9 +3640,44 @@ _SI32_LCD_A_set_segment_bit(SI32_LCD_A_Type* /*basePointer*/,
 ///  Valid range is 0 to 159.
 ///  Set segment bit (0 thorugh 159).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LCD_A_clear_segment_bit(
+   SI32_LCD_A_Type * basePointer,
+   // Set segment bit (0 thorugh 159).
+   uwide8_t index)
+{
+   assert(index <= 159);
+   //{{
+   switch (index >> 5 )
+   {
+      case 0:
+         basePointer->SEGDATA0.U32 &= ~(1<<(index&0x1F));
+         break;
+
+      case 1:
+         basePointer->SEGDATA1.U32 &= ~(1<<(index&0x1F));
+         break;
+
+      case 2:
+         basePointer->SEGDATA2.U32 &= ~(1<<(index&0x1F));
+         break;
+
+      case 3:
+         basePointer->SEGDATA3.U32 &= ~(1<<(index&0x1F));
+         break;
+
+      case 4:
+         basePointer->SEGDATA4.U32 &= ~(1<<(index&0x1F));
+         break;
+   }
+   //}}
+}
+#else
 void
 _SI32_LCD_A_clear_segment_bit(SI32_LCD_A_Type* /*basePointer*/,
    uwide8_t /*index*/);
+#endif
 ///
 /// @def SI32_LCD_A_clear_segment_bit(basePointer, index)
 #define SI32_LCD_A_clear_segment_bit(basePointer, index) \
@@ -63,11 +63,27 @@ extern "C" {
 ///  status
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_A_initialize(
+   SI32_LPTIMER_A_Type * basePointer,
+   uint32_t control,
+   uint32_t data,
+   uint32_t status)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   basePointer->DATA.U32 = data;
+   basePointer->STATUS.U32 = status;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_A_initialize(SI32_LPTIMER_A_Type* /*basePointer*/,
    uint32_t, /*control*/
    uint32_t, /*data*/
    uint32_t /*status*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_initialize(basePointer, control, data, status)
 #define SI32_LPTIMER_A_initialize(basePointer, control, data, status) do{  \
@@ -90,9 +106,21 @@ _SI32_LPTIMER_A_initialize(SI32_LPTIMER_A_Type* /*basePointer*/,
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_A_write_control(
+   SI32_LPTIMER_A_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_A_write_control(SI32_LPTIMER_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_write_control(basePointer, control)
 #define SI32_LPTIMER_A_write_control(basePointer, control) \
@@ -107,8 +135,19 @@ _SI32_LPTIMER_A_write_control(SI32_LPTIMER_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_LPTIMER_A_read_control(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_LPTIMER_A_read_control(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_read_control(basePointer)
 #define SI32_LPTIMER_A_read_control(basePointer) \
@@ -120,8 +159,19 @@ _SI32_LPTIMER_A_read_control(SI32_LPTIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_A_select_free_run_mode(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LPTIMER_A_CONTROL_CMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_A_select_free_run_mode(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_select_free_run_mode(basePointer)
 #define SI32_LPTIMER_A_select_free_run_mode(basePointer) \
@@ -133,8 +183,20 @@ _SI32_LPTIMER_A_select_free_run_mode(SI32_LPTIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_A_select_rising_edge_increment_mode(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LPTIMER_A_CONTROL_CMD_MASK;
+   basePointer->CONTROL_SET = SI32_LPTIMER_A_CONTROL_CMD_RISING_EDGE_U32;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_A_select_rising_edge_increment_mode(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_select_rising_edge_increment_mode(basePointer)
 #define SI32_LPTIMER_A_select_rising_edge_increment_mode(basePointer) do{  \
@@ -148,8 +210,20 @@ _SI32_LPTIMER_A_select_rising_edge_increment_mode(SI32_LPTIMER_A_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_A_select_falling_edge_increment_mode(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LPTIMER_A_CONTROL_CMD_MASK;
+   basePointer->CONTROL_SET = SI32_LPTIMER_A_CONTROL_CMD_FALLING_EDGE_U32;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_A_select_falling_edge_increment_mode(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_select_falling_edge_increment_mode(basePointer)
 #define SI32_LPTIMER_A_select_falling_edge_increment_mode(basePointer) do{  \
@@ -163,8 +237,19 @@ _SI32_LPTIMER_A_select_falling_edge_increment_mode(SI32_LPTIMER_A_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_A_select_both_edge_increment_mode(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LPTIMER_A_CONTROL_CMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_A_select_both_edge_increment_mode(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_select_both_edge_increment_mode(basePointer)
 #define SI32_LPTIMER_A_select_both_edge_increment_mode(basePointer) \
@@ -186,9 +271,25 @@ _SI32_LPTIMER_A_select_both_edge_increment_mode(SI32_LPTIMER_A_Type* /*basePoint
 ///  External trigger source select from 0 to 15 (0 = LPTnT0, ..., 15 =
 ///  LPTnT15).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_A_select_timer_source(
+   SI32_LPTIMER_A_Type * basePointer,
+   // External trigger source select from 0 to 15 (0 = LPTnT0, ..., 15 =
+   // LPTnT15).
+   uint32_t source)
+{
+   assert(source < 16);   // source < 2^4
+   //{{
+   basePointer->CONTROL_CLR = SI32_LPTIMER_A_CONTROL_EXTSEL_MASK;
+   basePointer->CONTROL_SET = source << SI32_LPTIMER_A_CONTROL_EXTSEL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_A_select_timer_source(SI32_LPTIMER_A_Type* /*basePointer*/,
    uint32_t /*source*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_select_timer_source(basePointer, source)
 #define SI32_LPTIMER_A_select_timer_source(basePointer, source) do{  \
@@ -205,8 +306,19 @@ _SI32_LPTIMER_A_select_timer_source(SI32_LPTIMER_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_A_start_timer_write(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LPTIMER_A_CONTROL_TMRSET_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_A_start_timer_write(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_start_timer_write(basePointer)
 #define SI32_LPTIMER_A_start_timer_write(basePointer) \
@@ -221,8 +333,19 @@ _SI32_LPTIMER_A_start_timer_write(SI32_LPTIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_LPTIMER_A_has_timer_write_occurred(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+   return !(bool)(basePointer->CONTROL.TMRSET);
+   //}}
+}
+#else
 bool
 _SI32_LPTIMER_A_has_timer_write_occurred(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_has_timer_write_occurred(basePointer)
 #define SI32_LPTIMER_A_has_timer_write_occurred(basePointer) \
@@ -237,8 +360,19 @@ _SI32_LPTIMER_A_has_timer_write_occurred(SI32_LPTIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_A_start_timer_read(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LPTIMER_A_CONTROL_TMRCAP_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_A_start_timer_read(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_start_timer_read(basePointer)
 #define SI32_LPTIMER_A_start_timer_read(basePointer) \
@@ -253,8 +387,19 @@ _SI32_LPTIMER_A_start_timer_read(SI32_LPTIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_LPTIMER_A_has_timer_read_occurred(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+   return !(bool)(basePointer->CONTROL.TMRCAP);
+   //}}
+}
+#else
 bool
 _SI32_LPTIMER_A_has_timer_read_occurred(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_has_timer_read_occurred(basePointer)
 #define SI32_LPTIMER_A_has_timer_read_occurred(basePointer) \
@@ -269,8 +414,19 @@ _SI32_LPTIMER_A_has_timer_read_occurred(SI32_LPTIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_A_start_comparator_write(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LPTIMER_A_CONTROL_CMPSET_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_A_start_comparator_write(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_start_comparator_write(basePointer)
 #define SI32_LPTIMER_A_start_comparator_write(basePointer) \
@@ -285,8 +441,19 @@ _SI32_LPTIMER_A_start_comparator_write(SI32_LPTIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_LPTIMER_A_has_comparator_write_occurred(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+   return !(bool)(basePointer->CONTROL.CMPSET);
+   //}}
+}
+#else
 bool
 _SI32_LPTIMER_A_has_comparator_write_occurred(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_has_comparator_write_occurred(basePointer)
 #define SI32_LPTIMER_A_has_comparator_write_occurred(basePointer) \
@@ -301,8 +468,19 @@ _SI32_LPTIMER_A_has_comparator_write_occurred(SI32_LPTIMER_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_A_start_comparator_read(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LPTIMER_A_CONTROL_CMPCAP_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_A_start_comparator_read(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_start_comparator_read(basePointer)
 #define SI32_LPTIMER_A_start_comparator_read(basePointer) \
@@ -317,8 +495,19 @@ _SI32_LPTIMER_A_start_comparator_read(SI32_LPTIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_LPTIMER_A_has_comparator_read_occurred(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+   return !(bool)(basePointer->CONTROL.CMPCAP);
+   //}}
+}
+#else
 bool
 _SI32_LPTIMER_A_has_comparator_read_occurred(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_has_comparator_read_occurred(basePointer)
 #define SI32_LPTIMER_A_has_comparator_read_occurred(basePointer) \
@@ -330,8 +519,19 @@ _SI32_LPTIMER_A_has_comparator_read_occurred(SI32_LPTIMER_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_A_enable_overflow_interrupt(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LPTIMER_A_CONTROL_OVFIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_A_enable_overflow_interrupt(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_enable_overflow_interrupt(basePointer)
 #define SI32_LPTIMER_A_enable_overflow_interrupt(basePointer) \
@@ -343,8 +543,19 @@ _SI32_LPTIMER_A_enable_overflow_interrupt(SI32_LPTIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_A_disable_overflow_interrupt(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LPTIMER_A_CONTROL_OVFIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_A_disable_overflow_interrupt(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_disable_overflow_interrupt(basePointer)
 #define SI32_LPTIMER_A_disable_overflow_interrupt(basePointer) \
@@ -356,8 +567,19 @@ _SI32_LPTIMER_A_disable_overflow_interrupt(SI32_LPTIMER_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_LPTIMER_A_is_overflow_interrupt_enabled(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.OVFIEN);
+   //}}
+}
+#else
 bool
 _SI32_LPTIMER_A_is_overflow_interrupt_enabled(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_is_overflow_interrupt_enabled(basePointer)
 #define SI32_LPTIMER_A_is_overflow_interrupt_enabled(basePointer) \
@@ -369,8 +591,19 @@ _SI32_LPTIMER_A_is_overflow_interrupt_enabled(SI32_LPTIMER_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_A_enable_compare_interrupt(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LPTIMER_A_CONTROL_CMPIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_A_enable_compare_interrupt(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_enable_compare_interrupt(basePointer)
 #define SI32_LPTIMER_A_enable_compare_interrupt(basePointer) \
@@ -382,8 +615,19 @@ _SI32_LPTIMER_A_enable_compare_interrupt(SI32_LPTIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_A_disable_compare_interrupt(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LPTIMER_A_CONTROL_CMPIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_A_disable_compare_interrupt(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_disable_compare_interrupt(basePointer)
 #define SI32_LPTIMER_A_disable_compare_interrupt(basePointer) \
@@ -395,8 +639,19 @@ _SI32_LPTIMER_A_disable_compare_interrupt(SI32_LPTIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_LPTIMER_A_is_compare_interrupt_enabled(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.CMPIEN);
+   //}}
+}
+#else
 bool
 _SI32_LPTIMER_A_is_compare_interrupt_enabled(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_is_compare_interrupt_enabled(basePointer)
 #define SI32_LPTIMER_A_is_compare_interrupt_enabled(basePointer) \
@@ -408,8 +663,19 @@ _SI32_LPTIMER_A_is_compare_interrupt_enabled(SI32_LPTIMER_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_A_enable_output_toggle_upon_overflow(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LPTIMER_A_CONTROL_OVFTMD_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_A_enable_output_toggle_upon_overflow(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_enable_output_toggle_upon_overflow(basePointer)
 #define SI32_LPTIMER_A_enable_output_toggle_upon_overflow(basePointer) \
@@ -421,8 +687,19 @@ _SI32_LPTIMER_A_enable_output_toggle_upon_overflow(SI32_LPTIMER_A_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_A_disable_output_toggle_upon_overflow(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LPTIMER_A_CONTROL_OVFTMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_A_disable_output_toggle_upon_overflow(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_disable_output_toggle_upon_overflow(basePointer)
 #define SI32_LPTIMER_A_disable_output_toggle_upon_overflow(basePointer) \
@@ -434,8 +711,19 @@ _SI32_LPTIMER_A_disable_output_toggle_upon_overflow(SI32_LPTIMER_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_A_enable_output_toggle_upon_compare(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LPTIMER_A_CONTROL_CMPTMD_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_A_enable_output_toggle_upon_compare(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_enable_output_toggle_upon_compare(basePointer)
 #define SI32_LPTIMER_A_enable_output_toggle_upon_compare(basePointer) \
@@ -447,8 +735,19 @@ _SI32_LPTIMER_A_enable_output_toggle_upon_compare(SI32_LPTIMER_A_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_A_disable_output_toggle_upon_compare(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LPTIMER_A_CONTROL_CMPTMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_A_disable_output_toggle_upon_compare(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_disable_output_toggle_upon_compare(basePointer)
 #define SI32_LPTIMER_A_disable_output_toggle_upon_compare(basePointer) \
@@ -460,8 +759,19 @@ _SI32_LPTIMER_A_disable_output_toggle_upon_compare(SI32_LPTIMER_A_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_A_enable_timer_reset_upon_compare(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LPTIMER_A_CONTROL_CMPRSTEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_A_enable_timer_reset_upon_compare(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_enable_timer_reset_upon_compare(basePointer)
 #define SI32_LPTIMER_A_enable_timer_reset_upon_compare(basePointer) \
@@ -473,8 +783,19 @@ _SI32_LPTIMER_A_enable_timer_reset_upon_compare(SI32_LPTIMER_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_A_disable_timer_reset_upon_compare(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LPTIMER_A_CONTROL_CMPRSTEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_A_disable_timer_reset_upon_compare(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_disable_timer_reset_upon_compare(basePointer)
 #define SI32_LPTIMER_A_disable_timer_reset_upon_compare(basePointer) \
@@ -486,8 +807,19 @@ _SI32_LPTIMER_A_disable_timer_reset_upon_compare(SI32_LPTIMER_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_A_enable_stall_in_debug_mode(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LPTIMER_A_CONTROL_DBGMD_HALT_U32;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_A_enable_stall_in_debug_mode(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_enable_stall_in_debug_mode(basePointer)
 #define SI32_LPTIMER_A_enable_stall_in_debug_mode(basePointer) \
@@ -499,8 +831,19 @@ _SI32_LPTIMER_A_enable_stall_in_debug_mode(SI32_LPTIMER_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_A_disable_stall_in_debug_mode(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LPTIMER_A_CONTROL_DBGMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_A_disable_stall_in_debug_mode(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_disable_stall_in_debug_mode(basePointer)
 #define SI32_LPTIMER_A_disable_stall_in_debug_mode(basePointer) \
@@ -512,8 +855,19 @@ _SI32_LPTIMER_A_disable_stall_in_debug_mode(SI32_LPTIMER_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_A_start_timer(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LPTIMER_A_CONTROL_RUN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_A_start_timer(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_start_timer(basePointer)
 #define SI32_LPTIMER_A_start_timer(basePointer) \
@@ -525,8 +879,19 @@ _SI32_LPTIMER_A_start_timer(SI32_LPTIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_A_stop_timer(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LPTIMER_A_CONTROL_RUN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_A_stop_timer(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_stop_timer(basePointer)
 #define SI32_LPTIMER_A_stop_timer(basePointer) \
@@ -546,9 +911,21 @@ _SI32_LPTIMER_A_stop_timer(SI32_LPTIMER_A_Type* /*basePointer*/);
 ///  data
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_A_write_data(
+   SI32_LPTIMER_A_Type * basePointer,
+   uint32_t data)
+{
+   //{{
+   basePointer->DATA.U32 = data;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_A_write_data(SI32_LPTIMER_A_Type* /*basePointer*/,
    uint32_t /*data*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_write_data(basePointer, data)
 #define SI32_LPTIMER_A_write_data(basePointer, data) \
@@ -563,8 +940,19 @@ _SI32_LPTIMER_A_write_data(SI32_LPTIMER_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_LPTIMER_A_read_data(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DATA.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_LPTIMER_A_read_data(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_read_data(basePointer)
 #define SI32_LPTIMER_A_read_data(basePointer) \
@@ -584,9 +972,21 @@ _SI32_LPTIMER_A_read_data(SI32_LPTIMER_A_Type* /*basePointer*/);
 ///  status
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_A_write_status(
+   SI32_LPTIMER_A_Type * basePointer,
+   uint32_t status)
+{
+   //{{
+   basePointer->STATUS.U32 = status;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_A_write_status(SI32_LPTIMER_A_Type* /*basePointer*/,
    uint32_t /*status*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_write_status(basePointer, status)
 #define SI32_LPTIMER_A_write_status(basePointer, status) \
@@ -601,8 +1001,19 @@ _SI32_LPTIMER_A_write_status(SI32_LPTIMER_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_LPTIMER_A_read_status(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_LPTIMER_A_read_status(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_read_status(basePointer)
 #define SI32_LPTIMER_A_read_status(basePointer) \
@@ -614,8 +1025,19 @@ _SI32_LPTIMER_A_read_status(SI32_LPTIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_LPTIMER_A_is_overflow_interrupt_pending(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->STATUS.OVFI);
+   //}}
+}
+#else
 bool
 _SI32_LPTIMER_A_is_overflow_interrupt_pending(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_is_overflow_interrupt_pending(basePointer)
 #define SI32_LPTIMER_A_is_overflow_interrupt_pending(basePointer) \
@@ -627,8 +1049,19 @@ _SI32_LPTIMER_A_is_overflow_interrupt_pending(SI32_LPTIMER_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_A_clear_overflow_interrupt(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS_CLR = SI32_LPTIMER_A_STATUS_OVFI_MASK;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_A_clear_overflow_interrupt(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_clear_overflow_interrupt(basePointer)
 #define SI32_LPTIMER_A_clear_overflow_interrupt(basePointer) \
@@ -640,8 +1073,19 @@ _SI32_LPTIMER_A_clear_overflow_interrupt(SI32_LPTIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_LPTIMER_A_is_compare_interrupt_pending(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->STATUS.CMPI);
+   //}}
+}
+#else
 bool
 _SI32_LPTIMER_A_is_compare_interrupt_pending(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_is_compare_interrupt_pending(basePointer)
 #define SI32_LPTIMER_A_is_compare_interrupt_pending(basePointer) \
@@ -653,8 +1097,19 @@ _SI32_LPTIMER_A_is_compare_interrupt_pending(SI32_LPTIMER_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_A_clear_compare_interrupt(
+   SI32_LPTIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS_CLR = SI32_LPTIMER_A_STATUS_CMPI_MASK;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_A_clear_compare_interrupt(SI32_LPTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_A_clear_compare_interrupt(basePointer)
 #define SI32_LPTIMER_A_clear_compare_interrupt(basePointer) \
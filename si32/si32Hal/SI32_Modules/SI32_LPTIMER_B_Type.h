@@ -68,12 +68,30 @@ extern "C" {
 ///  status
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_initialize(
+   SI32_LPTIMER_B_Type * basePointer,
+   uint32_t control,
+   uint32_t count,
+   uint32_t threshold,
+   uint32_t status)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   basePointer->COUNT.U32 = count;
+   basePointer->THRESHOLD.U32 = threshold;
+   basePointer->STATUS.U32 = status;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_initialize(SI32_LPTIMER_B_Type* /*basePointer*/,
    uint32_t, /*control*/
    uint32_t, /*count*/
    uint32_t, /*threshold*/
    uint32_t /*status*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_initialize(basePointer, control, count, threshold, status)
 #define SI32_LPTIMER_B_initialize(basePointer, control, count, threshold, status) do{  \
@@ -97,9 +115,21 @@ _SI32_LPTIMER_B_initialize(SI32_LPTIMER_B_Type* /*basePointer*/,
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_write_control(
+   SI32_LPTIMER_B_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_write_control(SI32_LPTIMER_B_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_write_control(basePointer, control)
 #define SI32_LPTIMER_B_write_control(basePointer, control) \
@@ -114,8 +144,19 @@ _SI32_LPTIMER_B_write_control(SI32_LPTIMER_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_LPTIMER_B_read_control(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_LPTIMER_B_read_control(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_read_control(basePointer)
 #define SI32_LPTIMER_B_read_control(basePointer) \
@@ -127,8 +168,19 @@ _SI32_LPTIMER_B_read_control(SI32_LPTIMER_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_select_free_run_mode(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LPTIMER_B_CONTROL_CMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_select_free_run_mode(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_select_free_run_mode(basePointer)
 #define SI32_LPTIMER_B_select_free_run_mode(basePointer) \
@@ -140,8 +192,20 @@ _SI32_LPTIMER_B_select_free_run_mode(SI32_LPTIMER_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_select_rising_edge_increment_mode(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LPTIMER_B_CONTROL_CMD_MASK;
+   basePointer->CONTROL_SET = SI32_LPTIMER_B_CONTROL_CMD_RISING_EDGE_U32;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_select_rising_edge_increment_mode(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_select_rising_edge_increment_mode(basePointer)
 #define SI32_LPTIMER_B_select_rising_edge_increment_mode(basePointer) do{  \
@@ -155,8 +219,20 @@ _SI32_LPTIMER_B_select_rising_edge_increment_mode(SI32_LPTIMER_B_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_select_falling_edge_increment_mode(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LPTIMER_B_CONTROL_CMD_MASK;
+   basePointer->CONTROL_SET = SI32_LPTIMER_B_CONTROL_CMD_FALLING_EDGE_U32;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_select_falling_edge_increment_mode(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_select_falling_edge_increment_mode(basePointer)
 #define SI32_LPTIMER_B_select_falling_edge_increment_mode(basePointer) do{  \
@@ -170,8 +246,19 @@ _SI32_LPTIMER_B_select_falling_edge_increment_mode(SI32_LPTIMER_B_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_select_both_edge_increment_mode(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LPTIMER_B_CONTROL_CMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_select_both_edge_increment_mode(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_select_both_edge_increment_mode(basePointer)
 #define SI32_LPTIMER_B_select_both_edge_increment_mode(basePointer) \
@@ -193,9 +280,25 @@ _SI32_LPTIMER_B_select_both_edge_increment_mode(SI32_LPTIMER_B_Type* /*basePoint
 ///  External trigger source select from 0 to 15 (0 = LPTnT0, ..., 15 =
 ///  LPTnT15).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_select_timer_source(
+   SI32_LPTIMER_B_Type * basePointer,
+   // External trigger source select from 0 to 15 (0 = LPTnT0, ..., 15 =
+   // LPTnT15).
+   uint32_t source)
+{
+   assert(source < 16);   // source < 2^4
+   //{{
+   basePointer->CONTROL_CLR = SI32_LPTIMER_B_CONTROL_EXTSEL_MASK;
+   basePointer->CONTROL_SET = source << SI32_LPTIMER_B_CONTROL_EXTSEL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_select_timer_source(SI32_LPTIMER_B_Type* /*basePointer*/,
    uint32_t /*source*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_select_timer_source(basePointer, source)
 #define SI32_LPTIMER_B_select_timer_source(basePointer, source) do{  \
@@ -212,8 +315,19 @@ _SI32_LPTIMER_B_select_timer_source(SI32_LPTIMER_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_start_timer_write(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LPTIMER_B_CONTROL_TMRSET_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_start_timer_write(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_start_timer_write(basePointer)
 #define SI32_LPTIMER_B_start_timer_write(basePointer) \
@@ -228,8 +342,19 @@ _SI32_LPTIMER_B_start_timer_write(SI32_LPTIMER_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_LPTIMER_B_has_timer_write_occurred(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   return !(bool)(basePointer->CONTROL.TMRSET);
+   //}}
+}
+#else
 bool
 _SI32_LPTIMER_B_has_timer_write_occurred(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_has_timer_write_occurred(basePointer)
 #define SI32_LPTIMER_B_has_timer_write_occurred(basePointer) \
@@ -244,8 +369,19 @@ _SI32_LPTIMER_B_has_timer_write_occurred(SI32_LPTIMER_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_start_timer_read(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LPTIMER_B_CONTROL_TMRCAP_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_start_timer_read(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_start_timer_read(basePointer)
 #define SI32_LPTIMER_B_start_timer_read(basePointer) \
@@ -260,8 +396,19 @@ _SI32_LPTIMER_B_start_timer_read(SI32_LPTIMER_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_LPTIMER_B_has_timer_read_occurred(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   return !(bool)(basePointer->CONTROL.TMRCAP);
+   //}}
+}
+#else
 bool
 _SI32_LPTIMER_B_has_timer_read_occurred(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_has_timer_read_occurred(basePointer)
 #define SI32_LPTIMER_B_has_timer_read_occurred(basePointer) \
@@ -273,8 +420,19 @@ _SI32_LPTIMER_B_has_timer_read_occurred(SI32_LPTIMER_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_enter_high_speed_timer_access_mode(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LPTIMER_B_CONTROL_HSMDEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_enter_high_speed_timer_access_mode(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_enter_high_speed_timer_access_mode(basePointer)
 #define SI32_LPTIMER_B_enter_high_speed_timer_access_mode(basePointer) \
@@ -286,8 +444,19 @@ _SI32_LPTIMER_B_enter_high_speed_timer_access_mode(SI32_LPTIMER_B_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_exit_high_speed_timer_access_mode(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LPTIMER_B_CONTROL_HSMDEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_exit_high_speed_timer_access_mode(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_exit_high_speed_timer_access_mode(basePointer)
 #define SI32_LPTIMER_B_exit_high_speed_timer_access_mode(basePointer) \
@@ -299,8 +468,19 @@ _SI32_LPTIMER_B_exit_high_speed_timer_access_mode(SI32_LPTIMER_B_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_enable_compare0_threshold(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LPTIMER_B_CONTROL_CMP0EN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_enable_compare0_threshold(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_enable_compare0_threshold(basePointer)
 #define SI32_LPTIMER_B_enable_compare0_threshold(basePointer) \
@@ -312,8 +492,19 @@ _SI32_LPTIMER_B_enable_compare0_threshold(SI32_LPTIMER_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_disable_compare0_threshold(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LPTIMER_B_CONTROL_CMP0EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_disable_compare0_threshold(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_disable_compare0_threshold(basePointer)
 #define SI32_LPTIMER_B_disable_compare0_threshold(basePointer) \
@@ -325,8 +516,19 @@ _SI32_LPTIMER_B_disable_compare0_threshold(SI32_LPTIMER_B_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_enable_compare1_threshold(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LPTIMER_B_CONTROL_CMP1EN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_enable_compare1_threshold(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_enable_compare1_threshold(basePointer)
 #define SI32_LPTIMER_B_enable_compare1_threshold(basePointer) \
@@ -338,8 +540,19 @@ _SI32_LPTIMER_B_enable_compare1_threshold(SI32_LPTIMER_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_disable_compare1_threshold(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LPTIMER_B_CONTROL_CMP1EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_disable_compare1_threshold(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_disable_compare1_threshold(basePointer)
 #define SI32_LPTIMER_B_disable_compare1_threshold(basePointer) \
@@ -351,8 +564,19 @@ _SI32_LPTIMER_B_disable_compare1_threshold(SI32_LPTIMER_B_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_enable_output(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LPTIMER_B_CONTROL_OUTEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_enable_output(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_enable_output(basePointer)
 #define SI32_LPTIMER_B_enable_output(basePointer) \
@@ -364,8 +588,19 @@ _SI32_LPTIMER_B_enable_output(SI32_LPTIMER_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_disable_output(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LPTIMER_B_CONTROL_OUTEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_disable_output(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_disable_output(basePointer)
 #define SI32_LPTIMER_B_disable_output(basePointer) \
@@ -377,8 +612,19 @@ _SI32_LPTIMER_B_disable_output(SI32_LPTIMER_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_enable_overflow_interrupt(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LPTIMER_B_CONTROL_OVFIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_enable_overflow_interrupt(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_enable_overflow_interrupt(basePointer)
 #define SI32_LPTIMER_B_enable_overflow_interrupt(basePointer) \
@@ -390,8 +636,19 @@ _SI32_LPTIMER_B_enable_overflow_interrupt(SI32_LPTIMER_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_disable_overflow_interrupt(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LPTIMER_B_CONTROL_OVFIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_disable_overflow_interrupt(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_disable_overflow_interrupt(basePointer)
 #define SI32_LPTIMER_B_disable_overflow_interrupt(basePointer) \
@@ -403,8 +660,19 @@ _SI32_LPTIMER_B_disable_overflow_interrupt(SI32_LPTIMER_B_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_LPTIMER_B_is_overflow_interrupt_enabled(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.OVFIEN);
+   //}}
+}
+#else
 bool
 _SI32_LPTIMER_B_is_overflow_interrupt_enabled(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_is_overflow_interrupt_enabled(basePointer)
 #define SI32_LPTIMER_B_is_overflow_interrupt_enabled(basePointer) \
@@ -416,8 +684,19 @@ _SI32_LPTIMER_B_is_overflow_interrupt_enabled(SI32_LPTIMER_B_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_enable_compare0_interrupt(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LPTIMER_B_CONTROL_CMP0IEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_enable_compare0_interrupt(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_enable_compare0_interrupt(basePointer)
 #define SI32_LPTIMER_B_enable_compare0_interrupt(basePointer) \
@@ -429,8 +708,19 @@ _SI32_LPTIMER_B_enable_compare0_interrupt(SI32_LPTIMER_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_disable_compare0_interrupt(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LPTIMER_B_CONTROL_CMP0IEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_disable_compare0_interrupt(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_disable_compare0_interrupt(basePointer)
 #define SI32_LPTIMER_B_disable_compare0_interrupt(basePointer) \
@@ -442,8 +732,19 @@ _SI32_LPTIMER_B_disable_compare0_interrupt(SI32_LPTIMER_B_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_LPTIMER_B_is_compare0_interrupt_enabled(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.CMP0IEN);
+   //}}
+}
+#else
 bool
 _SI32_LPTIMER_B_is_compare0_interrupt_enabled(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_is_compare0_interrupt_enabled(basePointer)
 #define SI32_LPTIMER_B_is_compare0_interrupt_enabled(basePointer) \
@@ -455,8 +756,19 @@ _SI32_LPTIMER_B_is_compare0_interrupt_enabled(SI32_LPTIMER_B_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_enable_overflow_set_output(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LPTIMER_B_CONTROL_OVFOEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_enable_overflow_set_output(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_enable_overflow_set_output(basePointer)
 #define SI32_LPTIMER_B_enable_overflow_set_output(basePointer) \
@@ -468,8 +780,19 @@ _SI32_LPTIMER_B_enable_overflow_set_output(SI32_LPTIMER_B_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_disable_overflow_set_output(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LPTIMER_B_CONTROL_OVFOEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_disable_overflow_set_output(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_disable_overflow_set_output(basePointer)
 #define SI32_LPTIMER_B_disable_overflow_set_output(basePointer) \
@@ -481,8 +804,19 @@ _SI32_LPTIMER_B_disable_overflow_set_output(SI32_LPTIMER_B_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_enable_compare0_event_to_clear_output(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LPTIMER_B_CONTROL_CMP0OEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_enable_compare0_event_to_clear_output(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_enable_compare0_event_to_clear_output(basePointer)
 #define SI32_LPTIMER_B_enable_compare0_event_to_clear_output(basePointer) \
@@ -494,8 +828,19 @@ _SI32_LPTIMER_B_enable_compare0_event_to_clear_output(SI32_LPTIMER_B_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_disable_compare0_event_to_clear_output(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LPTIMER_B_CONTROL_CMP0OEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_disable_compare0_event_to_clear_output(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_disable_compare0_event_to_clear_output(basePointer)
 #define SI32_LPTIMER_B_disable_compare0_event_to_clear_output(basePointer) \
@@ -507,8 +852,19 @@ _SI32_LPTIMER_B_disable_compare0_event_to_clear_output(SI32_LPTIMER_B_Type* /*ba
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_enable_compare1_interrupt(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LPTIMER_B_CONTROL_CMP1IEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_enable_compare1_interrupt(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_enable_compare1_interrupt(basePointer)
 #define SI32_LPTIMER_B_enable_compare1_interrupt(basePointer) \
@@ -520,8 +876,19 @@ _SI32_LPTIMER_B_enable_compare1_interrupt(SI32_LPTIMER_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_disable_compare1_interrupt(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LPTIMER_B_CONTROL_CMP1IEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_disable_compare1_interrupt(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_disable_compare1_interrupt(basePointer)
 #define SI32_LPTIMER_B_disable_compare1_interrupt(basePointer) \
@@ -533,8 +900,19 @@ _SI32_LPTIMER_B_disable_compare1_interrupt(SI32_LPTIMER_B_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_LPTIMER_B_is_compare1_interrupt_enabled(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.CMP1IEN);
+   //}}
+}
+#else
 bool
 _SI32_LPTIMER_B_is_compare1_interrupt_enabled(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_is_compare1_interrupt_enabled(basePointer)
 #define SI32_LPTIMER_B_is_compare1_interrupt_enabled(basePointer) \
@@ -546,8 +924,19 @@ _SI32_LPTIMER_B_is_compare1_interrupt_enabled(SI32_LPTIMER_B_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_enable_compare1_event_to_set_output(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LPTIMER_B_CONTROL_CMP1OEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_enable_compare1_event_to_set_output(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_enable_compare1_event_to_set_output(basePointer)
 #define SI32_LPTIMER_B_enable_compare1_event_to_set_output(basePointer) \
@@ -559,8 +948,19 @@ _SI32_LPTIMER_B_enable_compare1_event_to_set_output(SI32_LPTIMER_B_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_disable_compare1_event_to_set_output(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LPTIMER_B_CONTROL_CMP1OEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_disable_compare1_event_to_set_output(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_disable_compare1_event_to_set_output(basePointer)
 #define SI32_LPTIMER_B_disable_compare1_event_to_set_output(basePointer) \
@@ -572,8 +972,19 @@ _SI32_LPTIMER_B_disable_compare1_event_to_set_output(SI32_LPTIMER_B_Type* /*base
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_enable_output_inversion(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LPTIMER_B_CONTROL_OUTINVEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_enable_output_inversion(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_enable_output_inversion(basePointer)
 #define SI32_LPTIMER_B_enable_output_inversion(basePointer) \
@@ -585,8 +996,19 @@ _SI32_LPTIMER_B_enable_output_inversion(SI32_LPTIMER_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_disable_output_inversion(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LPTIMER_B_CONTROL_OUTINVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_disable_output_inversion(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_disable_output_inversion(basePointer)
 #define SI32_LPTIMER_B_disable_output_inversion(basePointer) \
@@ -598,8 +1020,19 @@ _SI32_LPTIMER_B_disable_output_inversion(SI32_LPTIMER_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_enable_timer_reset_upon_compare0(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LPTIMER_B_CONTROL_CMP0RSTEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_enable_timer_reset_upon_compare0(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_enable_timer_reset_upon_compare0(basePointer)
 #define SI32_LPTIMER_B_enable_timer_reset_upon_compare0(basePointer) \
@@ -611,8 +1044,19 @@ _SI32_LPTIMER_B_enable_timer_reset_upon_compare0(SI32_LPTIMER_B_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_disable_timer_reset_upon_compare0(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LPTIMER_B_CONTROL_CMP0RSTEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_disable_timer_reset_upon_compare0(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_disable_timer_reset_upon_compare0(basePointer)
 #define SI32_LPTIMER_B_disable_timer_reset_upon_compare0(basePointer) \
@@ -624,8 +1068,19 @@ _SI32_LPTIMER_B_disable_timer_reset_upon_compare0(SI32_LPTIMER_B_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_enable_timer_reset_upon_compare1(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LPTIMER_B_CONTROL_CMP1RSTEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_enable_timer_reset_upon_compare1(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_enable_timer_reset_upon_compare1(basePointer)
 #define SI32_LPTIMER_B_enable_timer_reset_upon_compare1(basePointer) \
@@ -637,8 +1092,19 @@ _SI32_LPTIMER_B_enable_timer_reset_upon_compare1(SI32_LPTIMER_B_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_disable_timer_reset_upon_compare1(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LPTIMER_B_CONTROL_CMP1RSTEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_disable_timer_reset_upon_compare1(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_disable_timer_reset_upon_compare1(basePointer)
 #define SI32_LPTIMER_B_disable_timer_reset_upon_compare1(basePointer) \
@@ -650,8 +1116,19 @@ _SI32_LPTIMER_B_disable_timer_reset_upon_compare1(SI32_LPTIMER_B_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_enable_module_clock(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LPTIMER_B_CONTROL_MCLKEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_enable_module_clock(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_enable_module_clock(basePointer)
 #define SI32_LPTIMER_B_enable_module_clock(basePointer) \
@@ -663,8 +1140,19 @@ _SI32_LPTIMER_B_enable_module_clock(SI32_LPTIMER_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_disable_module_clock(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LPTIMER_B_CONTROL_MCLKEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_disable_module_clock(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_disable_module_clock(basePointer)
 #define SI32_LPTIMER_B_disable_module_clock(basePointer) \
@@ -676,8 +1164,19 @@ _SI32_LPTIMER_B_disable_module_clock(SI32_LPTIMER_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_enable_stall_in_debug_mode(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LPTIMER_B_CONTROL_DBGMD_HALT_U32;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_enable_stall_in_debug_mode(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_enable_stall_in_debug_mode(basePointer)
 #define SI32_LPTIMER_B_enable_stall_in_debug_mode(basePointer) \
@@ -689,8 +1188,19 @@ _SI32_LPTIMER_B_enable_stall_in_debug_mode(SI32_LPTIMER_B_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_disable_stall_in_debug_mode(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LPTIMER_B_CONTROL_DBGMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_disable_stall_in_debug_mode(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_disable_stall_in_debug_mode(basePointer)
 #define SI32_LPTIMER_B_disable_stall_in_debug_mode(basePointer) \
@@ -702,8 +1212,19 @@ _SI32_LPTIMER_B_disable_stall_in_debug_mode(SI32_LPTIMER_B_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_start_timer(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LPTIMER_B_CONTROL_RUN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_start_timer(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_start_timer(basePointer)
 #define SI32_LPTIMER_B_start_timer(basePointer) \
@@ -715,8 +1236,19 @@ _SI32_LPTIMER_B_start_timer(SI32_LPTIMER_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_stop_timer(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LPTIMER_B_CONTROL_RUN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_stop_timer(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_stop_timer(basePointer)
 #define SI32_LPTIMER_B_stop_timer(basePointer) \
@@ -736,9 +1268,21 @@ _SI32_LPTIMER_B_stop_timer(SI32_LPTIMER_B_Type* /*basePointer*/);
 ///  count
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_write_count(
+   SI32_LPTIMER_B_Type * basePointer,
+   uint32_t count)
+{
+   //{{
+   basePointer->COUNT.U32 = count;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_write_count(SI32_LPTIMER_B_Type* /*basePointer*/,
    uint32_t /*count*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_write_count(basePointer, count)
 #define SI32_LPTIMER_B_write_count(basePointer, count) \
@@ -753,8 +1297,19 @@ _SI32_LPTIMER_B_write_count(SI32_LPTIMER_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_LPTIMER_B_read_count(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   return basePointer->COUNT.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_LPTIMER_B_read_count(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_read_count(basePointer)
 #define SI32_LPTIMER_B_read_count(basePointer) \
@@ -774,9 +1329,22 @@ _SI32_LPTIMER_B_read_count(SI32_LPTIMER_B_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_write_timer_value(
+   SI32_LPTIMER_B_Type * basePointer,
+   uint32_t value)
+{
+   assert(value < 65536);   // value < 2^16
+   //{{
+   basePointer->COUNT.TIMER = value;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_write_timer_value(SI32_LPTIMER_B_Type* /*basePointer*/,
    uint32_t /*value*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_write_timer_value(basePointer, value)
 #define SI32_LPTIMER_B_write_timer_value(basePointer, value) \
@@ -791,8 +1359,19 @@ _SI32_LPTIMER_B_write_timer_value(SI32_LPTIMER_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_LPTIMER_B_read_timer_value(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   return basePointer->COUNT.TIMER;
+   //}}
+}
+#else
 uint32_t
 _SI32_LPTIMER_B_read_timer_value(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_read_timer_value(basePointer)
 #define SI32_LPTIMER_B_read_timer_value(basePointer) \
@@ -812,9 +1391,21 @@ _SI32_LPTIMER_B_read_timer_value(SI32_LPTIMER_B_Type* /*basePointer*/);
 ///  threshold
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_write_threshold(
+   SI32_LPTIMER_B_Type * basePointer,
+   uint32_t threshold)
+{
+   //{{
+   basePointer->THRESHOLD.U32 = threshold;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_write_threshold(SI32_LPTIMER_B_Type* /*basePointer*/,
    uint32_t /*threshold*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_write_threshold(basePointer, threshold)
 #define SI32_LPTIMER_B_write_threshold(basePointer, threshold) \
@@ -829,8 +1420,19 @@ _SI32_LPTIMER_B_write_threshold(SI32_LPTIMER_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_LPTIMER_B_read_threshold(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   return basePointer->THRESHOLD.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_LPTIMER_B_read_threshold(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_read_threshold(basePointer)
 #define SI32_LPTIMER_B_read_threshold(basePointer) \
@@ -847,9 +1449,22 @@ _SI32_LPTIMER_B_read_threshold(SI32_LPTIMER_B_Type* /*basePointer*/);
 ///  compare0
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_write_compare0(
+   SI32_LPTIMER_B_Type * basePointer,
+   uint32_t compare0)
+{
+   assert(compare0 < 65536);   // compare0 < 2^16
+   //{{
+   basePointer->THRESHOLD.COMPARE0 = compare0;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_write_compare0(SI32_LPTIMER_B_Type* /*basePointer*/,
    uint32_t /*compare0*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_write_compare0(basePointer, compare0)
 #define SI32_LPTIMER_B_write_compare0(basePointer, compare0) \
@@ -861,8 +1476,19 @@ _SI32_LPTIMER_B_write_compare0(SI32_LPTIMER_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_LPTIMER_B_read_compare0(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   return basePointer->THRESHOLD.COMPARE0;
+   //}}
+}
+#else
 uint32_t
 _SI32_LPTIMER_B_read_compare0(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_read_compare0(basePointer)
 #define SI32_LPTIMER_B_read_compare0(basePointer) \
@@ -879,9 +1505,22 @@ _SI32_LPTIMER_B_read_compare0(SI32_LPTIMER_B_Type* /*basePointer*/);
 ///  compare1
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_write_compare1(
+   SI32_LPTIMER_B_Type * basePointer,
+   uint32_t compare1)
+{
+   assert(compare1 < 65536);   // compare1 < 2^16
+   //{{
+   basePointer->THRESHOLD.COMPARE1 = compare1;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_write_compare1(SI32_LPTIMER_B_Type* /*basePointer*/,
    uint32_t /*compare1*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_write_compare1(basePointer, compare1)
 #define SI32_LPTIMER_B_write_compare1(basePointer, compare1) \
@@ -893,8 +1532,19 @@ _SI32_LPTIMER_B_write_compare1(SI32_LPTIMER_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_LPTIMER_B_read_compare1(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   return basePointer->THRESHOLD.COMPARE1;
+   //}}
+}
+#else
 uint32_t
 _SI32_LPTIMER_B_read_compare1(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_read_compare1(basePointer)
 #define SI32_LPTIMER_B_read_compare1(basePointer) \
@@ -914,9 +1564,21 @@ _SI32_LPTIMER_B_read_compare1(SI32_LPTIMER_B_Type* /*basePointer*/);
 ///  status
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_write_status(
+   SI32_LPTIMER_B_Type * basePointer,
+   uint32_t status)
+{
+   //{{
+   basePointer->STATUS.U32 = status;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_write_status(SI32_LPTIMER_B_Type* /*basePointer*/,
    uint32_t /*status*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_write_status(basePointer, status)
 #define SI32_LPTIMER_B_write_status(basePointer, status) \
@@ -931,8 +1593,19 @@ _SI32_LPTIMER_B_write_status(SI32_LPTIMER_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_LPTIMER_B_read_status(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_LPTIMER_B_read_status(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_read_status(basePointer)
 #define SI32_LPTIMER_B_read_status(basePointer) \
@@ -944,8 +1617,19 @@ _SI32_LPTIMER_B_read_status(SI32_LPTIMER_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_LPTIMER_B_is_overflow_interrupt_pending(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->STATUS.OVFI);
+   //}}
+}
+#else
 bool
 _SI32_LPTIMER_B_is_overflow_interrupt_pending(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_is_overflow_interrupt_pending(basePointer)
 #define SI32_LPTIMER_B_is_overflow_interrupt_pending(basePointer) \
@@ -957,8 +1641,19 @@ _SI32_LPTIMER_B_is_overflow_interrupt_pending(SI32_LPTIMER_B_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_clear_overflow_interrupt(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS_CLR = SI32_LPTIMER_B_STATUS_OVFI_MASK;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_clear_overflow_interrupt(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_clear_overflow_interrupt(basePointer)
 #define SI32_LPTIMER_B_clear_overflow_interrupt(basePointer) \
@@ -970,8 +1665,19 @@ _SI32_LPTIMER_B_clear_overflow_interrupt(SI32_LPTIMER_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_LPTIMER_B_is_compare0_interrupt_pending(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->STATUS.CMP0I);
+   //}}
+}
+#else
 bool
 _SI32_LPTIMER_B_is_compare0_interrupt_pending(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_is_compare0_interrupt_pending(basePointer)
 #define SI32_LPTIMER_B_is_compare0_interrupt_pending(basePointer) \
@@ -983,8 +1689,19 @@ _SI32_LPTIMER_B_is_compare0_interrupt_pending(SI32_LPTIMER_B_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_clear_compare0_interrupt(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS_CLR = SI32_LPTIMER_B_STATUS_CMP0I_MASK;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_clear_compare0_interrupt(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_clear_compare0_interrupt(basePointer)
 #define SI32_LPTIMER_B_clear_compare0_interrupt(basePointer) \
@@ -996,8 +1713,20 @@ _SI32_LPTIMER_B_clear_compare0_interrupt(SI32_LPTIMER_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_LPTIMER_B_is_compare1_interrupt_pending(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   //{{
+   return (bool)(basePointer->STATUS.CMP1I);
+   //}}
+}
+#else
 bool
 _SI32_LPTIMER_B_is_compare1_interrupt_pending(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_is_compare1_interrupt_pending(basePointer)
 #define SI32_LPTIMER_B_is_compare1_interrupt_pending(basePointer) \
@@ -1009,8 +1738,19 @@ _SI32_LPTIMER_B_is_compare1_interrupt_pending(SI32_LPTIMER_B_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LPTIMER_B_clear_compare1_interrupt(
+   SI32_LPTIMER_B_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS_CLR = SI32_LPTIMER_B_STATUS_CMP1I_MASK;
+   //}}
+}
+#else
 void
 _SI32_LPTIMER_B_clear_compare1_interrupt(SI32_LPTIMER_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LPTIMER_B_clear_compare1_interrupt(basePointer)
 #define SI32_LPTIMER_B_clear_compare1_interrupt(basePointer) \
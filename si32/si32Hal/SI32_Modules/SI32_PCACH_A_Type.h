@@ -68,12 +68,30 @@ extern "C" {
 ///  ccapvupd
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCACH_A_initialize(
+   SI32_PCACH_A_Type * basePointer,
+   uint32_t mode,
+   uint32_t control,
+   uint32_t ccapv,
+   uint32_t ccapvupd)
+{
+   //{{
+   basePointer->MODE.U32 = mode;
+   basePointer->CONTROL.U32 = control;
+   basePointer->CCAPV.U32 = ccapv;
+   basePointer->CCAPVUPD.U32 = ccapvupd;
+   //}}
+}
+#else
 void
 _SI32_PCACH_A_initialize(SI32_PCACH_A_Type* /*basePointer*/,
    uint32_t, /*mode*/
    uint32_t, /*control*/
    uint32_t, /*ccapv*/
    uint32_t /*ccapvupd*/);
+#endif
 ///
 /// @def SI32_PCACH_A_initialize(basePointer, mode, control, ccapv, ccapvupd)
 #define SI32_PCACH_A_initialize(basePointer, mode, control, ccapv, ccapvupd) do{  \
@@ -97,9 +115,21 @@ _SI32_PCACH_A_initialize(SI32_PCACH_A_Type* /*basePointer*/,
 ///  mode
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCACH_A_write_mode(
+   SI32_PCACH_A_Type * basePointer,
+   uint32_t mode)
+{
+   //{{
+   basePointer->MODE.U32 = mode;
+   //}}
+}
+#else
 void
 _SI32_PCACH_A_write_mode(SI32_PCACH_A_Type* /*basePointer*/,
    uint32_t /*mode*/);
+#endif
 ///
 /// @def SI32_PCACH_A_write_mode(basePointer, mode)
 #define SI32_PCACH_A_write_mode(basePointer, mode) \
@@ -114,8 +144,19 @@ _SI32_PCACH_A_write_mode(SI32_PCACH_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PCACH_A_read_mode(
+   SI32_PCACH_A_Type * basePointer)
+{
+   //{{
+   return basePointer->MODE.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PCACH_A_read_mode(SI32_PCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCACH_A_read_mode(basePointer)
 #define SI32_PCACH_A_read_mode(basePointer) \
@@ -130,8 +171,19 @@ _SI32_PCACH_A_read_mode(SI32_PCACH_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCACH_A_select_output_mode_toggle(
+   SI32_PCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.COSEL = SI32_PCACH_A_MODE_COSEL_TOGGLE_OUTPUT_VALUE;
+   //}}
+}
+#else
 void
 _SI32_PCACH_A_select_output_mode_toggle(SI32_PCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCACH_A_select_output_mode_toggle(basePointer)
 #define SI32_PCACH_A_select_output_mode_toggle(basePointer) \
@@ -146,8 +198,19 @@ _SI32_PCACH_A_select_output_mode_toggle(SI32_PCACH_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCACH_A_select_output_mode_set(
+   SI32_PCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.COSEL = SI32_PCACH_A_MODE_COSEL_SET_OUTPUT_VALUE;
+   //}}
+}
+#else
 void
 _SI32_PCACH_A_select_output_mode_set(SI32_PCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCACH_A_select_output_mode_set(basePointer)
 #define SI32_PCACH_A_select_output_mode_set(basePointer) \
@@ -162,8 +225,19 @@ _SI32_PCACH_A_select_output_mode_set(SI32_PCACH_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCACH_A_select_output_mode_clear(
+   SI32_PCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.COSEL = SI32_PCACH_A_MODE_COSEL_CLEAR_OUTPUT_VALUE;
+   //}}
+}
+#else
 void
 _SI32_PCACH_A_select_output_mode_clear(SI32_PCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCACH_A_select_output_mode_clear(basePointer)
 #define SI32_PCACH_A_select_output_mode_clear(basePointer) \
@@ -178,8 +252,19 @@ _SI32_PCACH_A_select_output_mode_clear(SI32_PCACH_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCACH_A_select_output_mode_none(
+   SI32_PCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.COSEL = SI32_PCACH_A_MODE_COSEL_NO_CHANGE_VALUE;
+   //}}
+}
+#else
 void
 _SI32_PCACH_A_select_output_mode_none(SI32_PCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCACH_A_select_output_mode_none(basePointer)
 #define SI32_PCACH_A_select_output_mode_none(basePointer) \
@@ -201,9 +286,22 @@ _SI32_PCACH_A_select_output_mode_none(SI32_PCACH_A_Type* /*basePointer*/);
 ///  nbits
 ///  Valid range is 4 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCACH_A_set_width_for_n_bit_edge_aligned_pwm_mode(
+   SI32_PCACH_A_Type * basePointer,
+   uint32_t nbits)
+{
+   assert(nbits < 16);   // nbits < 2^4
+   //{{
+   basePointer->MODE.PWMMD = nbits;
+   //}}
+}
+#else
 void
 _SI32_PCACH_A_set_width_for_n_bit_edge_aligned_pwm_mode(SI32_PCACH_A_Type* /*basePointer*/,
    uint32_t /*nbits*/);
+#endif
 ///
 /// @def SI32_PCACH_A_set_width_for_n_bit_edge_aligned_pwm_mode(basePointer, nbits)
 #define SI32_PCACH_A_set_width_for_n_bit_edge_aligned_pwm_mode(basePointer, nbits) \
@@ -218,8 +316,19 @@ _SI32_PCACH_A_set_width_for_n_bit_edge_aligned_pwm_mode(SI32_PCACH_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCACH_A_select_operating_mode_edge_aligned_pwm(
+   SI32_PCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.CMD = SI32_PCACH_A_MODE_CMD_EDGE_PWM_VALUE;
+   //}}
+}
+#else
 void
 _SI32_PCACH_A_select_operating_mode_edge_aligned_pwm(SI32_PCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCACH_A_select_operating_mode_edge_aligned_pwm(basePointer)
 #define SI32_PCACH_A_select_operating_mode_edge_aligned_pwm(basePointer) \
@@ -234,8 +343,19 @@ _SI32_PCACH_A_select_operating_mode_edge_aligned_pwm(SI32_PCACH_A_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCACH_A_select_operating_mode_center_aligned_pwm(
+   SI32_PCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.CMD = SI32_PCACH_A_MODE_CMD_CENTER_ALIGNED_PWM_VALUE;
+   //}}
+}
+#else
 void
 _SI32_PCACH_A_select_operating_mode_center_aligned_pwm(SI32_PCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCACH_A_select_operating_mode_center_aligned_pwm(basePointer)
 #define SI32_PCACH_A_select_operating_mode_center_aligned_pwm(basePointer) \
@@ -250,8 +370,19 @@ _SI32_PCACH_A_select_operating_mode_center_aligned_pwm(SI32_PCACH_A_Type* /*base
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCACH_A_select_operating_mode_high_frequency_square_wave(
+   SI32_PCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.CMD =SI32_PCACH_A_MODE_CMD_HF_SQUARE_WAVE_VALUE;
+   //}}
+}
+#else
 void
 _SI32_PCACH_A_select_operating_mode_high_frequency_square_wave(SI32_PCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCACH_A_select_operating_mode_high_frequency_square_wave(basePointer)
 #define SI32_PCACH_A_select_operating_mode_high_frequency_square_wave(basePointer) \
@@ -266,8 +397,19 @@ _SI32_PCACH_A_select_operating_mode_high_frequency_square_wave(SI32_PCACH_A_Type
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCACH_A_select_operating_mode_timer_capture(
+   SI32_PCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.CMD = SI32_PCACH_A_MODE_CMD_TIMER_CAPTURE_VALUE;
+   //}}
+}
+#else
 void
 _SI32_PCACH_A_select_operating_mode_timer_capture(SI32_PCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCACH_A_select_operating_mode_timer_capture(basePointer)
 #define SI32_PCACH_A_select_operating_mode_timer_capture(basePointer) \
@@ -282,8 +424,19 @@ _SI32_PCACH_A_select_operating_mode_timer_capture(SI32_PCACH_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCACH_A_select_operating_mode_n_bit_edge_aligned_pwm(
+   SI32_PCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.CMD = SI32_PCACH_A_MODE_CMD_N_BIT_PWM_VALUE;
+   //}}
+}
+#else
 void
 _SI32_PCACH_A_select_operating_mode_n_bit_edge_aligned_pwm(SI32_PCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCACH_A_select_operating_mode_n_bit_edge_aligned_pwm(basePointer)
 #define SI32_PCACH_A_select_operating_mode_n_bit_edge_aligned_pwm(basePointer) \
@@ -303,9 +456,21 @@ _SI32_PCACH_A_select_operating_mode_n_bit_edge_aligned_pwm(SI32_PCACH_A_Type* /*
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCACH_A_write_control(
+   SI32_PCACH_A_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_PCACH_A_write_control(SI32_PCACH_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_PCACH_A_write_control(basePointer, control)
 #define SI32_PCACH_A_write_control(basePointer, control) \
@@ -320,8 +485,19 @@ _SI32_PCACH_A_write_control(SI32_PCACH_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PCACH_A_read_control(
+   SI32_PCACH_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PCACH_A_read_control(SI32_PCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCACH_A_read_control(basePointer)
 #define SI32_PCACH_A_read_control(basePointer) \
@@ -333,8 +509,19 @@ _SI32_PCACH_A_read_control(SI32_PCACH_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCACH_A_clear_output_state(
+   SI32_PCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PCACH_A_CONTROL_COUTST_MASK;
+   //}}
+}
+#else
 void
 _SI32_PCACH_A_clear_output_state(SI32_PCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCACH_A_clear_output_state(basePointer)
 #define SI32_PCACH_A_clear_output_state(basePointer) \
@@ -346,8 +533,19 @@ _SI32_PCACH_A_clear_output_state(SI32_PCACH_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCACH_A_set_output_state(
+   SI32_PCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_PCACH_A_CONTROL_COUTST_MASK;
+   //}}
+}
+#else
 void
 _SI32_PCACH_A_set_output_state(SI32_PCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCACH_A_set_output_state(basePointer)
 #define SI32_PCACH_A_set_output_state(basePointer) \
@@ -362,8 +560,19 @@ _SI32_PCACH_A_set_output_state(SI32_PCACH_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PCACH_A_get_output_state(
+   SI32_PCACH_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.COUTST);
+   //}}
+}
+#else
 bool
 _SI32_PCACH_A_get_output_state(SI32_PCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCACH_A_get_output_state(basePointer)
 #define SI32_PCACH_A_get_output_state(basePointer) \
@@ -375,8 +584,19 @@ _SI32_PCACH_A_get_output_state(SI32_PCACH_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCACH_A_enable_positive_edge_input_capture(
+   SI32_PCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_PCACH_A_CONTROL_CPCAPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PCACH_A_enable_positive_edge_input_capture(SI32_PCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCACH_A_enable_positive_edge_input_capture(basePointer)
 #define SI32_PCACH_A_enable_positive_edge_input_capture(basePointer) \
@@ -388,8 +608,19 @@ _SI32_PCACH_A_enable_positive_edge_input_capture(SI32_PCACH_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCACH_A_disable_positive_edge_input_capture(
+   SI32_PCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PCACH_A_CONTROL_CPCAPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PCACH_A_disable_positive_edge_input_capture(SI32_PCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCACH_A_disable_positive_edge_input_capture(basePointer)
 #define SI32_PCACH_A_disable_positive_edge_input_capture(basePointer) \
@@ -401,8 +632,19 @@ _SI32_PCACH_A_disable_positive_edge_input_capture(SI32_PCACH_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCACH_A_enable_negative_edge_input_capture(
+   SI32_PCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_PCACH_A_CONTROL_CNCAPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PCACH_A_enable_negative_edge_input_capture(SI32_PCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCACH_A_enable_negative_edge_input_capture(basePointer)
 #define SI32_PCACH_A_enable_negative_edge_input_capture(basePointer) \
@@ -414,8 +656,19 @@ _SI32_PCACH_A_enable_negative_edge_input_capture(SI32_PCACH_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCACH_A_disable_negative_edge_input_capture(
+   SI32_PCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PCACH_A_CONTROL_CNCAPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PCACH_A_disable_negative_edge_input_capture(SI32_PCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCACH_A_disable_negative_edge_input_capture(basePointer)
 #define SI32_PCACH_A_disable_negative_edge_input_capture(basePointer) \
@@ -431,8 +684,19 @@ _SI32_PCACH_A_disable_negative_edge_input_capture(SI32_PCACH_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PCACH_A_is_register_update_busy(
+   SI32_PCACH_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.CUPDCF);
+   //}}
+}
+#else
 bool
 _SI32_PCACH_A_is_register_update_busy(SI32_PCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCACH_A_is_register_update_busy(basePointer)
 #define SI32_PCACH_A_is_register_update_busy(basePointer) \
@@ -444,8 +708,19 @@ _SI32_PCACH_A_is_register_update_busy(SI32_PCACH_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCACH_A_enable_capture_compare_interrupt(
+   SI32_PCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_PCACH_A_CONTROL_CCIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PCACH_A_enable_capture_compare_interrupt(SI32_PCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCACH_A_enable_capture_compare_interrupt(basePointer)
 #define SI32_PCACH_A_enable_capture_compare_interrupt(basePointer) \
@@ -457,8 +732,19 @@ _SI32_PCACH_A_enable_capture_compare_interrupt(SI32_PCACH_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCACH_A_disable_capture_compare_interrupt(
+   SI32_PCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PCACH_A_CONTROL_CCIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PCACH_A_disable_capture_compare_interrupt(SI32_PCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCACH_A_disable_capture_compare_interrupt(basePointer)
 #define SI32_PCACH_A_disable_capture_compare_interrupt(basePointer) \
@@ -470,8 +756,19 @@ _SI32_PCACH_A_disable_capture_compare_interrupt(SI32_PCACH_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PCACH_A_is_capture_compare_interrupt_enabled(
+   SI32_PCACH_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.CCIEN);
+   //}}
+}
+#else
 bool
 _SI32_PCACH_A_is_capture_compare_interrupt_enabled(SI32_PCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCACH_A_is_capture_compare_interrupt_enabled(basePointer)
 #define SI32_PCACH_A_is_capture_compare_interrupt_enabled(basePointer) \
@@ -483,8 +780,19 @@ _SI32_PCACH_A_is_capture_compare_interrupt_enabled(SI32_PCACH_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCACH_A_enable_intermediate_overflow_interrupt(
+   SI32_PCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_PCACH_A_CONTROL_CIOVFIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PCACH_A_enable_intermediate_overflow_interrupt(SI32_PCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCACH_A_enable_intermediate_overflow_interrupt(basePointer)
 #define SI32_PCACH_A_enable_intermediate_overflow_interrupt(basePointer) \
@@ -496,8 +804,19 @@ _SI32_PCACH_A_enable_intermediate_overflow_interrupt(SI32_PCACH_A_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCACH_A_disable_intermediate_overflow_interrupt(
+   SI32_PCACH_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PCACH_A_CONTROL_CIOVFIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PCACH_A_disable_intermediate_overflow_interrupt(SI32_PCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCACH_A_disable_intermediate_overflow_interrupt(basePointer)
 #define SI32_PCACH_A_disable_intermediate_overflow_interrupt(basePointer) \
@@ -509,8 +828,19 @@ _SI32_PCACH_A_disable_intermediate_overflow_interrupt(SI32_PCACH_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PCACH_A_is_intermediate_overflow_interrupt_enabled(
+   SI32_PCACH_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.CIOVFIEN);
+   //}}
+}
+#else
 bool
 _SI32_PCACH_A_is_intermediate_overflow_interrupt_enabled(SI32_PCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCACH_A_is_intermediate_overflow_interrupt_enabled(basePointer)
 #define SI32_PCACH_A_is_intermediate_overflow_interrupt_enabled(basePointer) \
@@ -530,9 +860,21 @@ _SI32_PCACH_A_is_intermediate_overflow_interrupt_enabled(SI32_PCACH_A_Type* /*ba
 ///  ccapv
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCACH_A_write_ccapv(
+   SI32_PCACH_A_Type * basePointer,
+   uint32_t ccapv)
+{
+   //{{
+   basePointer->CCAPV.U32 = ccapv;
+   //}}
+}
+#else
 void
 _SI32_PCACH_A_write_ccapv(SI32_PCACH_A_Type* /*basePointer*/,
    uint32_t /*ccapv*/);
+#endif
 ///
 /// @def SI32_PCACH_A_write_ccapv(basePointer, ccapv)
 #define SI32_PCACH_A_write_ccapv(basePointer, ccapv) \
@@ -547,8 +889,19 @@ _SI32_PCACH_A_write_ccapv(SI32_PCACH_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PCACH_A_read_ccapv(
+   SI32_PCACH_A_Type * basePointer)
+{
+   //{{
+   return (uint32_t)(basePointer->CCAPV.U32);
+   //}}
+}
+#else
 uint32_t
 _SI32_PCACH_A_read_ccapv(SI32_PCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCACH_A_read_ccapv(basePointer)
 #define SI32_PCACH_A_read_ccapv(basePointer) \
@@ -568,9 +921,21 @@ _SI32_PCACH_A_read_ccapv(SI32_PCACH_A_Type* /*basePointer*/);
 ///  ccapvupd
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCACH_A_write_ccapvupd(
+   SI32_PCACH_A_Type * basePointer,
+   uint32_t ccapvupd)
+{
+   //{{
+   basePointer->CCAPVUPD.U32 = ccapvupd;
+   //}}
+}
+#else
 void
 _SI32_PCACH_A_write_ccapvupd(SI32_PCACH_A_Type* /*basePointer*/,
    uint32_t /*ccapvupd*/);
+#endif
 ///
 /// @def SI32_PCACH_A_write_ccapvupd(basePointer, ccapvupd)
 #define SI32_PCACH_A_write_ccapvupd(basePointer, ccapvupd) \
@@ -585,8 +950,19 @@ _SI32_PCACH_A_write_ccapvupd(SI32_PCACH_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PCACH_A_read_ccapvupd(
+   SI32_PCACH_A_Type * basePointer)
+{
+   //{{
+   return (uint32_t)(basePointer->CCAPVUPD.U32);
+   //}}
+}
+#else
 uint32_t
 _SI32_PCACH_A_read_ccapvupd(SI32_PCACH_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCACH_A_read_ccapvupd(basePointer)
 #define SI32_PCACH_A_read_ccapvupd(basePointer) \
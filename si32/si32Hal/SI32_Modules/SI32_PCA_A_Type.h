@@ -73,6 +73,25 @@ extern "C" {
 ///  limit
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCA_A_initialize(
+   SI32_PCA_A_Type * basePointer,
+   uint32_t mode,
+   uint32_t control,
+   uint32_t status,
+   uint32_t counter,
+   uint32_t limit)
+{
+   //{{
+   basePointer->MODE.U32 = mode;
+   basePointer->CONTROL.U32 = control;
+   basePointer->STATUS.U32 = status;
+   basePointer->COUNTER.U32 = counter;
+   basePointer->LIMIT.U32 = limit;
+   //}}
+}
+#else
 void
 _SI32_PCA_A_initialize(SI32_PCA_A_Type* /*basePointer*/,
    uint32_t, /*mode*/
@@ -80,6 +99,7 @@ _SI32_PCA_A_initialize(SI32_PCA_A_Type* /*basePointer*/,
    uint32_t, /*status*/
    uint32_t, /*counter*/
    uint32_t /*limit*/);
+#endif
 ///
 /// @def SI32_PCA_A_initialize(basePointer, mode, control, status, counter, limit)
 #define SI32_PCA_A_initialize(basePointer, mode, control, status, counter, limit) do{  \
@@ -104,9 +124,21 @@ _SI32_PCA_A_initialize(SI32_PCA_A_Type* /*basePointer*/,
 ///  mode
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCA_A_write_mode(
+   SI32_PCA_A_Type * basePointer,
+   uint32_t mode)
+{
+   //{{
+   basePointer->MODE.U32 = mode;
+   //}}
+}
+#else
 void
 _SI32_PCA_A_write_mode(SI32_PCA_A_Type* /*basePointer*/,
    uint32_t /*mode*/);
+#endif
 ///
 /// @def SI32_PCA_A_write_mode(basePointer, mode)
 #define SI32_PCA_A_write_mode(basePointer, mode) \
@@ -121,8 +153,19 @@ _SI32_PCA_A_write_mode(SI32_PCA_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PCA_A_read_mode(
+   SI32_PCA_A_Type * basePointer)
+{
+   //{{
+   return basePointer->MODE.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PCA_A_read_mode(SI32_PCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCA_A_read_mode(basePointer)
 #define SI32_PCA_A_read_mode(basePointer) \
@@ -144,9 +187,24 @@ _SI32_PCA_A_read_mode(SI32_PCA_A_Type* /*basePointer*/);
 ///  PCA clock frequency is given by (input clock frequency) / (divisor +
 ///  1).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCA_A_select_input_clock_divisor(
+   SI32_PCA_A_Type * basePointer,
+   // PCA clock frequency is given by (input clock frequency) / (divisor +
+   // 1).
+   uint32_t divisor)
+{
+   assert(divisor < 1024);   // divisor < 2^10
+   //{{
+   basePointer->MODE.CLKDIV = divisor;
+   //}}
+}
+#else
 void
 _SI32_PCA_A_select_input_clock_divisor(SI32_PCA_A_Type* /*basePointer*/,
    uint32_t /*divisor*/);
+#endif
 ///
 /// @def SI32_PCA_A_select_input_clock_divisor(basePointer, divisor)
 #define SI32_PCA_A_select_input_clock_divisor(basePointer, divisor) \
@@ -158,8 +216,19 @@ _SI32_PCA_A_select_input_clock_divisor(SI32_PCA_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCA_A_select_input_clock_apb(
+   SI32_PCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.CLKSEL = SI32_PCA_A_MODE_CLKSEL_APB_VALUE;
+   //}}
+}
+#else
 void
 _SI32_PCA_A_select_input_clock_apb(SI32_PCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCA_A_select_input_clock_apb(basePointer)
 #define SI32_PCA_A_select_input_clock_apb(basePointer) \
@@ -171,8 +240,19 @@ _SI32_PCA_A_select_input_clock_apb(SI32_PCA_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCA_A_select_input_clock_timer0_overflow(
+   SI32_PCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.CLKSEL = SI32_PCA_A_MODE_CLKSEL_TIMER0_VALUE;
+   //}}
+}
+#else
 void
 _SI32_PCA_A_select_input_clock_timer0_overflow(SI32_PCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCA_A_select_input_clock_timer0_overflow(basePointer)
 #define SI32_PCA_A_select_input_clock_timer0_overflow(basePointer) \
@@ -184,8 +264,19 @@ _SI32_PCA_A_select_input_clock_timer0_overflow(SI32_PCA_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCA_A_select_input_clock_eci_high_to_low(
+   SI32_PCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.CLKSEL = SI32_PCA_A_MODE_CLKSEL_HL_ECI_VALUE;
+   //}}
+}
+#else
 void
 _SI32_PCA_A_select_input_clock_eci_high_to_low(SI32_PCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCA_A_select_input_clock_eci_high_to_low(basePointer)
 #define SI32_PCA_A_select_input_clock_eci_high_to_low(basePointer) \
@@ -197,8 +288,19 @@ _SI32_PCA_A_select_input_clock_eci_high_to_low(SI32_PCA_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCA_A_select_input_clock_external_oscillator(
+   SI32_PCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.CLKSEL = SI32_PCA_A_MODE_CLKSEL_EXTOSCN_VALUE;
+   //}}
+}
+#else
 void
 _SI32_PCA_A_select_input_clock_external_oscillator(SI32_PCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCA_A_select_input_clock_external_oscillator(basePointer)
 #define SI32_PCA_A_select_input_clock_external_oscillator(basePointer) \
@@ -210,8 +312,19 @@ _SI32_PCA_A_select_input_clock_external_oscillator(SI32_PCA_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCA_A_select_input_clock_eci(
+   SI32_PCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE.CLKSEL = SI32_PCA_A_MODE_CLKSEL_ECI_VALUE;
+   //}}
+}
+#else
 void
 _SI32_PCA_A_select_input_clock_eci(SI32_PCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCA_A_select_input_clock_eci(basePointer)
 #define SI32_PCA_A_select_input_clock_eci(basePointer) \
@@ -231,9 +344,21 @@ _SI32_PCA_A_select_input_clock_eci(SI32_PCA_A_Type* /*basePointer*/);
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCA_A_write_control(
+   SI32_PCA_A_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_PCA_A_write_control(SI32_PCA_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_PCA_A_write_control(basePointer, control)
 #define SI32_PCA_A_write_control(basePointer, control) \
@@ -248,8 +373,19 @@ _SI32_PCA_A_write_control(SI32_PCA_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PCA_A_read_control(
+   SI32_PCA_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PCA_A_read_control(SI32_PCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCA_A_read_control(basePointer)
 #define SI32_PCA_A_read_control(basePointer) \
@@ -261,8 +397,19 @@ _SI32_PCA_A_read_control(SI32_PCA_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCA_A_enable_counter_overflow_interrupt(
+   SI32_PCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_PCA_A_CONTROL_OVFIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PCA_A_enable_counter_overflow_interrupt(SI32_PCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCA_A_enable_counter_overflow_interrupt(basePointer)
 #define SI32_PCA_A_enable_counter_overflow_interrupt(basePointer) \
@@ -274,8 +421,19 @@ _SI32_PCA_A_enable_counter_overflow_interrupt(SI32_PCA_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCA_A_disable_counter_overflow_interrupt(
+   SI32_PCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PCA_A_CONTROL_OVFIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PCA_A_disable_counter_overflow_interrupt(SI32_PCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCA_A_disable_counter_overflow_interrupt(basePointer)
 #define SI32_PCA_A_disable_counter_overflow_interrupt(basePointer) \
@@ -287,8 +445,19 @@ _SI32_PCA_A_disable_counter_overflow_interrupt(SI32_PCA_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PCA_A_is_counter_overflow_interrupt_enabled(
+   SI32_PCA_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.OVFIEN);
+   //}}
+}
+#else
 bool
 _SI32_PCA_A_is_counter_overflow_interrupt_enabled(SI32_PCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCA_A_is_counter_overflow_interrupt_enabled(basePointer)
 #define SI32_PCA_A_is_counter_overflow_interrupt_enabled(basePointer) \
@@ -300,8 +469,19 @@ _SI32_PCA_A_is_counter_overflow_interrupt_enabled(SI32_PCA_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCA_A_enable_stall_in_debug_mode(
+   SI32_PCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PCA_A_CONTROL_DBGMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_PCA_A_enable_stall_in_debug_mode(SI32_PCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCA_A_enable_stall_in_debug_mode(basePointer)
 #define SI32_PCA_A_enable_stall_in_debug_mode(basePointer) \
@@ -313,8 +493,19 @@ _SI32_PCA_A_enable_stall_in_debug_mode(SI32_PCA_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCA_A_disable_stall_in_debug_mode(
+   SI32_PCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_PCA_A_CONTROL_DBGMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_PCA_A_disable_stall_in_debug_mode(SI32_PCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCA_A_disable_stall_in_debug_mode(basePointer)
 #define SI32_PCA_A_disable_stall_in_debug_mode(basePointer) \
@@ -330,8 +521,19 @@ _SI32_PCA_A_disable_stall_in_debug_mode(SI32_PCA_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PCA_A_is_clock_divider_in_phase_2(
+   SI32_PCA_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.DIVST);
+   //}}
+}
+#else
 bool
 _SI32_PCA_A_is_clock_divider_in_phase_2(SI32_PCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCA_A_is_clock_divider_in_phase_2(basePointer)
 #define SI32_PCA_A_is_clock_divider_in_phase_2(basePointer) \
@@ -346,8 +548,19 @@ _SI32_PCA_A_is_clock_divider_in_phase_2(SI32_PCA_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCA_A_select_clock_divider_state_phase_1(
+   SI32_PCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PCA_A_CONTROL_DIVST_MASK;
+   //}}
+}
+#else
 void
 _SI32_PCA_A_select_clock_divider_state_phase_1(SI32_PCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCA_A_select_clock_divider_state_phase_1(basePointer)
 #define SI32_PCA_A_select_clock_divider_state_phase_1(basePointer) \
@@ -362,8 +575,19 @@ _SI32_PCA_A_select_clock_divider_state_phase_1(SI32_PCA_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCA_A_select_clock_divider_state_phase_2(
+   SI32_PCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_PCA_A_CONTROL_DIVST_MASK;
+   //}}
+}
+#else
 void
 _SI32_PCA_A_select_clock_divider_state_phase_2(SI32_PCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCA_A_select_clock_divider_state_phase_2(basePointer)
 #define SI32_PCA_A_select_clock_divider_state_phase_2(basePointer) \
@@ -378,8 +602,19 @@ _SI32_PCA_A_select_clock_divider_state_phase_2(SI32_PCA_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PCA_A_get_clock_divider(
+   SI32_PCA_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.DIV;
+   //}}
+}
+#else
 uint32_t
 _SI32_PCA_A_get_clock_divider(SI32_PCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCA_A_get_clock_divider(basePointer)
 #define SI32_PCA_A_get_clock_divider(basePointer) \
@@ -399,9 +634,22 @@ _SI32_PCA_A_get_clock_divider(SI32_PCA_A_Type* /*basePointer*/);
 ///  divider
 ///  Valid range is 10 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCA_A_set_clock_divider(
+   SI32_PCA_A_Type * basePointer,
+   uint32_t divider)
+{
+   assert(divider < 1024);   // divider < 2^10
+   //{{
+   basePointer->CONTROL.DIV = divider;
+   //}}
+}
+#else
 void
 _SI32_PCA_A_set_clock_divider(SI32_PCA_A_Type* /*basePointer*/,
    uint32_t /*divider*/);
+#endif
 ///
 /// @def SI32_PCA_A_set_clock_divider(basePointer, divider)
 #define SI32_PCA_A_set_clock_divider(basePointer, divider) \
@@ -421,9 +669,21 @@ _SI32_PCA_A_set_clock_divider(SI32_PCA_A_Type* /*basePointer*/,
 ///  status
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCA_A_write_status(
+   SI32_PCA_A_Type * basePointer,
+   uint32_t status)
+{
+   //{{
+   basePointer->STATUS.U32 = status;
+   //}}
+}
+#else
 void
 _SI32_PCA_A_write_status(SI32_PCA_A_Type* /*basePointer*/,
    uint32_t /*status*/);
+#endif
 ///
 /// @def SI32_PCA_A_write_status(basePointer, status)
 #define SI32_PCA_A_write_status(basePointer, status) \
@@ -438,8 +698,19 @@ _SI32_PCA_A_write_status(SI32_PCA_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PCA_A_read_status(
+   SI32_PCA_A_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PCA_A_read_status(SI32_PCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCA_A_read_status(basePointer)
 #define SI32_PCA_A_read_status(basePointer) \
@@ -457,9 +728,34 @@ _SI32_PCA_A_read_status(SI32_PCA_A_Type* /*basePointer*/);
 ///  Valid range is 0 to 1.
 ///  Channel number (0-1).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PCA_A_is_channel_n_capture_compare_interrupt_pending(
+   SI32_PCA_A_Type * basePointer,
+   // Channel number (0-1).
+   uint32_t channel)
+{
+   assert(channel <= 1);
+   //{{
+   if (channel == 0)
+   {
+      return (bool)(basePointer->STATUS.C0CCI);
+   }
+   else if (channel == 1)
+   {
+      return (bool)(basePointer->STATUS.C1CCI);
+   }
+   else
+   {
+      return false;
+   }
+   //}}
+}
+#else
 bool
 _SI32_PCA_A_is_channel_n_capture_compare_interrupt_pending(SI32_PCA_A_Type* /*basePointer*/,
    uint32_t /*channel*/);
+#endif
 ///
 /// @def SI32_PCA_A_is_channel_n_capture_compare_interrupt_pending(basePointer, channel)
 #define SI32_PCA_A_is_channel_n_capture_compare_interrupt_pending(basePointer, channel) \
@@ -480,9 +776,30 @@ _SI32_PCA_A_is_channel_n_capture_compare_interrupt_pending(SI32_PCA_A_Type* /*ba
 ///  Valid range is 0 to 1.
 ///  Channel number (0-1).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCA_A_set_channel_n_capture_compare_interrupt(
+   SI32_PCA_A_Type * basePointer,
+   // Channel number (0-1).
+   uint32_t channel)
+{
+   assert(channel <= 1);
+   //{{
+   if (channel == 0)
+   {
+      basePointer->STATUS_SET = SI32_PCA_A_STATUS_C0CCI_MASK;
+   }
+   else if (channel == 1)
+   {
+      basePointer->STATUS_SET = SI32_PCA_A_STATUS_C1CCI_MASK;
+   }
+   //}}
+}
+#else
 void
 _SI32_PCA_A_set_channel_n_capture_compare_interrupt(SI32_PCA_A_Type* /*basePointer*/,
    uint32_t /*channel*/);
+#endif
 ///
 /// @def SI32_PCA_A_set_channel_n_capture_compare_interrupt(basePointer, channel)
 #define SI32_PCA_A_set_channel_n_capture_compare_interrupt(basePointer, channel) \
@@ -500,9 +817,30 @@ _SI32_PCA_A_set_channel_n_capture_compare_interrupt(SI32_PCA_A_Type* /*basePoint
 ///  Valid range is 0 to 1.
 ///  Channel number (0-1).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCA_A_clear_channel_n_capture_compare_interrupt(
+   SI32_PCA_A_Type * basePointer,
+   // Channel number (0-1).
+   uint32_t channel)
+{
+   assert(channel <= 1);
+   //{{
+   if (channel == 0)
+   {
+      basePointer->STATUS_CLR = SI32_PCA_A_STATUS_C0CCI_MASK;
+   }
+   else if (channel == 1)
+   {
+      basePointer->STATUS_CLR = SI32_PCA_A_STATUS_C1CCI_MASK;
+   }
+   //}}
+}
+#else
 void
 _SI32_PCA_A_clear_channel_n_capture_compare_interrupt(SI32_PCA_A_Type* /*basePointer*/,
    uint32_t /*channel*/);
+#endif
 ///
 /// @def SI32_PCA_A_clear_channel_n_capture_compare_interrupt(basePointer, channel)
 #define SI32_PCA_A_clear_channel_n_capture_compare_interrupt(basePointer, channel) \
@@ -514,8 +852,19 @@ _SI32_PCA_A_clear_channel_n_capture_compare_interrupt(SI32_PCA_A_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCA_A_start_counter_timer(
+   SI32_PCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS_SET = SI32_PCA_A_STATUS_RUN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PCA_A_start_counter_timer(SI32_PCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCA_A_start_counter_timer(basePointer)
 #define SI32_PCA_A_start_counter_timer(basePointer) \
@@ -527,8 +876,19 @@ _SI32_PCA_A_start_counter_timer(SI32_PCA_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCA_A_stop_counter_timer(
+   SI32_PCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS_CLR = SI32_PCA_A_STATUS_RUN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PCA_A_stop_counter_timer(SI32_PCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCA_A_stop_counter_timer(basePointer)
 #define SI32_PCA_A_stop_counter_timer(basePointer) \
@@ -540,8 +900,19 @@ _SI32_PCA_A_stop_counter_timer(SI32_PCA_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PCA_A_is_counter_timer_overflow_interrupt_pending(
+   SI32_PCA_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->STATUS.OVFI);
+   //}}
+}
+#else
 bool
 _SI32_PCA_A_is_counter_timer_overflow_interrupt_pending(SI32_PCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCA_A_is_counter_timer_overflow_interrupt_pending(basePointer)
 #define SI32_PCA_A_is_counter_timer_overflow_interrupt_pending(basePointer) \
@@ -556,8 +927,19 @@ _SI32_PCA_A_is_counter_timer_overflow_interrupt_pending(SI32_PCA_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCA_A_set_counter_timer_overflow_interrupt(
+   SI32_PCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS_SET = SI32_PCA_A_STATUS_OVFI_MASK;
+   //}}
+}
+#else
 void
 _SI32_PCA_A_set_counter_timer_overflow_interrupt(SI32_PCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCA_A_set_counter_timer_overflow_interrupt(basePointer)
 #define SI32_PCA_A_set_counter_timer_overflow_interrupt(basePointer) \
@@ -569,8 +951,19 @@ _SI32_PCA_A_set_counter_timer_overflow_interrupt(SI32_PCA_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCA_A_clear_counter_timer_overflow_interrupt(
+   SI32_PCA_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS_CLR = SI32_PCA_A_STATUS_OVFI_MASK;
+   //}}
+}
+#else
 void
 _SI32_PCA_A_clear_counter_timer_overflow_interrupt(SI32_PCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCA_A_clear_counter_timer_overflow_interrupt(basePointer)
 #define SI32_PCA_A_clear_counter_timer_overflow_interrupt(basePointer) \
@@ -588,9 +981,34 @@ _SI32_PCA_A_clear_counter_timer_overflow_interrupt(SI32_PCA_A_Type* /*basePointe
 ///  Valid range is 0 to 1.
 ///  Channel number (0-1).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PCA_A_is_channel_n_intermediate_overflow_interrupt_pending(
+   SI32_PCA_A_Type * basePointer,
+   // Channel number (0-1).
+   uint32_t channel)
+{
+   assert(channel <= 1);
+   //{{
+   if (channel == 0)
+   {
+      return (bool)(basePointer->STATUS.C0IOVFI);
+   }
+   else if (channel == 1)
+   {
+      return (bool)(basePointer->STATUS.C1IOVFI);
+   }
+   else
+   {
+      return false;
+   }
+   //}}
+}
+#else
 bool
 _SI32_PCA_A_is_channel_n_intermediate_overflow_interrupt_pending(SI32_PCA_A_Type* /*basePointer*/,
    uint32_t /*channel*/);
+#endif
 ///
 /// @def SI32_PCA_A_is_channel_n_intermediate_overflow_interrupt_pending(basePointer, channel)
 #define SI32_PCA_A_is_channel_n_intermediate_overflow_interrupt_pending(basePointer, channel) \
@@ -611,9 +1029,30 @@ _SI32_PCA_A_is_channel_n_intermediate_overflow_interrupt_pending(SI32_PCA_A_Type
 ///  Valid range is 0 to 1.
 ///  Channel number (0-1).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCA_A_set_channel_n_intermediate_overflow_interrupt(
+   SI32_PCA_A_Type * basePointer,
+   // Channel number (0-1).
+   uint32_t channel)
+{
+   assert(channel <= 1);
+   //{{
+   if (channel == 0)
+   {
+      basePointer->STATUS_SET = SI32_PCA_A_STATUS_C0IOVFI_MASK;
+   }
+   else if (channel == 1)
+   {
+      basePointer->STATUS_SET = SI32_PCA_A_STATUS_C1IOVFI_MASK;
+   }
+   //}}
+}
+#else
 void
 _SI32_PCA_A_set_channel_n_intermediate_overflow_interrupt(SI32_PCA_A_Type* /*basePointer*/,
    uint32_t /*channel*/);
+#endif
 ///
 /// @def SI32_PCA_A_set_channel_n_intermediate_overflow_interrupt(basePointer, channel)
 #define SI32_PCA_A_set_channel_n_intermediate_overflow_interrupt(basePointer, channel) \
@@ -631,9 +1070,30 @@ _SI32_PCA_A_set_channel_n_intermediate_overflow_interrupt(SI32_PCA_A_Type* /*bas
 ///  Valid range is 0 to 1.
 ///  Channel number (0-1).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCA_A_clear_channel_n_intermediate_overflow_interrupt(
+   SI32_PCA_A_Type * basePointer,
+   // Channel number (0-1).
+   uint32_t channel)
+{
+   assert(channel <= 1);
+   //{{
+   if (channel == 0)
+   {
+      basePointer->STATUS_CLR = SI32_PCA_A_STATUS_C0IOVFI_MASK;
+   }
+   else if (channel == 1)
+   {
+      basePointer->STATUS_CLR = SI32_PCA_A_STATUS_C1IOVFI_MASK;
+   }
+   //}}
+}
+#else
 void
 _SI32_PCA_A_clear_channel_n_intermediate_overflow_interrupt(SI32_PCA_A_Type* /*basePointer*/,
    uint32_t /*channel*/);
+#endif
 ///
 /// @def SI32_PCA_A_clear_channel_n_intermediate_overflow_interrupt(basePointer, channel)
 #define SI32_PCA_A_clear_channel_n_intermediate_overflow_interrupt(basePointer, channel) \
@@ -653,9 +1113,21 @@ _SI32_PCA_A_clear_channel_n_intermediate_overflow_interrupt(SI32_PCA_A_Type* /*b
 ///  counter
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCA_A_write_counter(
+   SI32_PCA_A_Type * basePointer,
+   uint32_t counter)
+{
+   //{{
+   basePointer->COUNTER.U32 = counter;
+   //}}
+}
+#else
 void
 _SI32_PCA_A_write_counter(SI32_PCA_A_Type* /*basePointer*/,
    uint32_t /*counter*/);
+#endif
 ///
 /// @def SI32_PCA_A_write_counter(basePointer, counter)
 #define SI32_PCA_A_write_counter(basePointer, counter) \
@@ -670,8 +1142,19 @@ _SI32_PCA_A_write_counter(SI32_PCA_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PCA_A_read_counter(
+   SI32_PCA_A_Type * basePointer)
+{
+   //{{
+   return (uint32_t)(basePointer->COUNTER.U32);
+   //}}
+}
+#else
 uint32_t
 _SI32_PCA_A_read_counter(SI32_PCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCA_A_read_counter(basePointer)
 #define SI32_PCA_A_read_counter(basePointer) \
@@ -691,9 +1174,21 @@ _SI32_PCA_A_read_counter(SI32_PCA_A_Type* /*basePointer*/);
 ///  limit
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PCA_A_write_limit(
+   SI32_PCA_A_Type * basePointer,
+   uint32_t limit)
+{
+   //{{
+   basePointer->LIMIT.U32 = limit;
+   //}}
+}
+#else
 void
 _SI32_PCA_A_write_limit(SI32_PCA_A_Type* /*basePointer*/,
    uint32_t /*limit*/);
+#endif
 ///
 /// @def SI32_PCA_A_write_limit(basePointer, limit)
 #define SI32_PCA_A_write_limit(basePointer, limit) \
@@ -708,8 +1203,19 @@ _SI32_PCA_A_write_limit(SI32_PCA_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PCA_A_read_limit(
+   SI32_PCA_A_Type * basePointer)
+{
+   //{{
+   return (uint32_t)(basePointer->LIMIT.U32);
+   //}}
+}
+#else
 uint32_t
 _SI32_PCA_A_read_limit(SI32_PCA_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PCA_A_read_limit(basePointer)
 #define SI32_PCA_A_read_limit(basePointer) \
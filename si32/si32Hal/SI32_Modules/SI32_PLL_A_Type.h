@@ -70,12 +70,34 @@ extern "C" {
 ///  Valid range is 32 bits.
 ///  Write to CALCONFIG register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PLL_A_initialize(
+   SI32_PLL_A_Type * basePointer,
+   // Write to DIVIDER register.
+   uint32_t divider,
+   // Write to CONTROL register.
+   uint32_t control,
+   // Write to SSPR register.
+   uint32_t sspr,
+   // Write to CALCONFIG register.
+   uint32_t calconfig)
+{
+   //{{
+   basePointer->DIVIDER.U32 = divider;
+   basePointer->CONTROL.U32 = control;
+   basePointer->SSPR.U32 = sspr;
+   basePointer->CALCONFIG.U32 = calconfig;
+   //}}
+}
+#else
 void
 _SI32_PLL_A_initialize(SI32_PLL_A_Type* /*basePointer*/,
    uint32_t, /*divider*/
    uint32_t, /*control*/
    uint32_t, /*sspr*/
    uint32_t /*calconfig*/);
+#endif
 ///
 /// @def SI32_PLL_A_initialize(basePointer, divider, control, sspr, calconfig)
 #define SI32_PLL_A_initialize(basePointer, divider, control, sspr, calconfig) do{  \
@@ -97,9 +119,22 @@ _SI32_PLL_A_initialize(SI32_PLL_A_Type* /*basePointer*/,
 ///  Valid range is 32 bits.
 ///  Write to DIVIDER register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PLL_A_write_divider(
+   SI32_PLL_A_Type * basePointer,
+   // Write to DIVIDER register.
+   uint32_t divider)
+{
+   //{{
+   basePointer->DIVIDER.U32 = divider;
+   //}}
+}
+#else
 void
 _SI32_PLL_A_write_divider(SI32_PLL_A_Type* /*basePointer*/,
    uint32_t /*divider*/);
+#endif
 ///
 /// @def SI32_PLL_A_write_divider(basePointer, divider)
 #define SI32_PLL_A_write_divider(basePointer, divider) \
@@ -114,8 +149,19 @@ _SI32_PLL_A_write_divider(SI32_PLL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PLL_A_read_divider(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DIVIDER.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PLL_A_read_divider(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_read_divider(basePointer)
 #define SI32_PLL_A_read_divider(basePointer) \
@@ -137,9 +183,24 @@ _SI32_PLL_A_read_divider(SI32_PLL_A_Type* /*basePointer*/);
 ///  n_value
 ///  Valid range is 12 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PLL_A_set_numerator(
+   SI32_PLL_A_Type * basePointer,
+   uint32_t n_value)
+{
+   assert(n_value < 4096);   // n_value < 2^12
+   //{{
+   basePointer->DIVIDER.U32 =
+      ((basePointer->DIVIDER.U32) & ~SI32_PLL_A_DIVIDER_N_MASK) |
+     ((n_value - 1) << SI32_PLL_A_DIVIDER_N_SHIFT);
+   //}}
+}
+#else
 void
 _SI32_PLL_A_set_numerator(SI32_PLL_A_Type* /*basePointer*/,
    uint32_t /*n_value*/);
+#endif
 ///
 /// @def SI32_PLL_A_set_numerator(basePointer, n_value)
 #define SI32_PLL_A_set_numerator(basePointer, n_value) do{  \
@@ -157,8 +218,19 @@ _SI32_PLL_A_set_numerator(SI32_PLL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PLL_A_get_numerator(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DIVIDER.N;
+   //}}
+}
+#else
 uint32_t
 _SI32_PLL_A_get_numerator(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_get_numerator(basePointer)
 #define SI32_PLL_A_get_numerator(basePointer) \
@@ -180,9 +252,23 @@ _SI32_PLL_A_get_numerator(SI32_PLL_A_Type* /*basePointer*/);
 ///  m_value
 ///  Valid range is 12 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PLL_A_set_denominator(
+   SI32_PLL_A_Type * basePointer,
+   uint32_t m_value)
+{
+   assert(m_value < 4096);   // m_value < 2^12
+   //{{
+   basePointer->DIVIDER.U32 =
+     ((basePointer->DIVIDER.U32) & ~SI32_PLL_A_DIVIDER_M_MASK) | (m_value - 1);
+   //}}
+}
+#else
 void
 _SI32_PLL_A_set_denominator(SI32_PLL_A_Type* /*basePointer*/,
    uint32_t /*m_value*/);
+#endif
 ///
 /// @def SI32_PLL_A_set_denominator(basePointer, m_value)
 #define SI32_PLL_A_set_denominator(basePointer, m_value) do{  \
@@ -199,8 +285,19 @@ _SI32_PLL_A_set_denominator(SI32_PLL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PLL_A_get_denominator(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DIVIDER.M;
+   //}}
+}
+#else
 uint32_t
 _SI32_PLL_A_get_denominator(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_get_denominator(basePointer)
 #define SI32_PLL_A_get_denominator(basePointer) \
@@ -218,9 +315,22 @@ _SI32_PLL_A_get_denominator(SI32_PLL_A_Type* /*basePointer*/);
 ///  Valid range is 32 bits.
 ///  Write to CONTROL register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PLL_A_write_control(
+   SI32_PLL_A_Type * basePointer,
+   // Write to CONTROL register.
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_PLL_A_write_control(SI32_PLL_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_PLL_A_write_control(basePointer, control)
 #define SI32_PLL_A_write_control(basePointer, control) \
@@ -235,8 +345,19 @@ _SI32_PLL_A_write_control(SI32_PLL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PLL_A_read_control(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PLL_A_read_control(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_read_control(basePointer)
 #define SI32_PLL_A_read_control(basePointer) \
@@ -248,8 +369,20 @@ _SI32_PLL_A_read_control(SI32_PLL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PLL_A_select_dco_free_running_mode(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PLL_A_CONTROL_OUTMD_MASK;
+   basePointer->CONTROL_SET = SI32_PLL_A_CONTROL_OUTMD_DCO_U32;
+   //}}
+}
+#else
 void
 _SI32_PLL_A_select_dco_free_running_mode(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_select_dco_free_running_mode(basePointer)
 #define SI32_PLL_A_select_dco_free_running_mode(basePointer) do{  \
@@ -263,8 +396,20 @@ _SI32_PLL_A_select_dco_free_running_mode(SI32_PLL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PLL_A_select_dco_frequency_lock_mode(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PLL_A_CONTROL_OUTMD_MASK;
+   basePointer->CONTROL_SET = SI32_PLL_A_CONTROL_OUTMD_FLL_U32;
+   //}}
+}
+#else
 void
 _SI32_PLL_A_select_dco_frequency_lock_mode(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_select_dco_frequency_lock_mode(basePointer)
 #define SI32_PLL_A_select_dco_frequency_lock_mode(basePointer) do{  \
@@ -278,8 +423,19 @@ _SI32_PLL_A_select_dco_frequency_lock_mode(SI32_PLL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PLL_A_select_dco_phase_lock_mode(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_PLL_A_CONTROL_OUTMD_PLL_U32;
+   //}}
+}
+#else
 void
 _SI32_PLL_A_select_dco_phase_lock_mode(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_select_dco_phase_lock_mode(basePointer)
 #define SI32_PLL_A_select_dco_phase_lock_mode(basePointer) \
@@ -291,8 +447,19 @@ _SI32_PLL_A_select_dco_phase_lock_mode(SI32_PLL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PLL_A_select_disable_dco_output(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PLL_A_CONTROL_OUTMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_PLL_A_select_disable_dco_output(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_select_disable_dco_output(basePointer)
 #define SI32_PLL_A_select_disable_dco_output(basePointer) \
@@ -304,8 +471,19 @@ _SI32_PLL_A_select_disable_dco_output(SI32_PLL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PLL_A_lock_on_rising_edge(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_PLL_A_CONTROL_EDGSEL_RISING_EDGE_U32;
+   //}}
+}
+#else
 void
 _SI32_PLL_A_lock_on_rising_edge(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_lock_on_rising_edge(basePointer)
 #define SI32_PLL_A_lock_on_rising_edge(basePointer) \
@@ -317,8 +495,19 @@ _SI32_PLL_A_lock_on_rising_edge(SI32_PLL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PLL_A_lock_on_falling_edge(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PLL_A_CONTROL_EDGSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_PLL_A_lock_on_falling_edge(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_lock_on_falling_edge(basePointer)
 #define SI32_PLL_A_lock_on_falling_edge(basePointer) \
@@ -330,8 +519,19 @@ _SI32_PLL_A_lock_on_falling_edge(SI32_PLL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PLL_A_enable_dither(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_PLL_A_CONTROL_DITHEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_PLL_A_enable_dither(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_enable_dither(basePointer)
 #define SI32_PLL_A_enable_dither(basePointer) \
@@ -343,8 +543,19 @@ _SI32_PLL_A_enable_dither(SI32_PLL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PLL_A_disable_dither(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PLL_A_CONTROL_DITHEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PLL_A_disable_dither(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_disable_dither(basePointer)
 #define SI32_PLL_A_disable_dither(basePointer) \
@@ -356,8 +567,19 @@ _SI32_PLL_A_disable_dither(SI32_PLL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PLL_A_enable_dco_update_stall(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_PLL_A_CONTROL_STALL_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_PLL_A_enable_dco_update_stall(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_enable_dco_update_stall(basePointer)
 #define SI32_PLL_A_enable_dco_update_stall(basePointer) \
@@ -369,8 +591,19 @@ _SI32_PLL_A_enable_dco_update_stall(SI32_PLL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PLL_A_disable_dco_update_stall(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PLL_A_CONTROL_STALL_MASK;
+   //}}
+}
+#else
 void
 _SI32_PLL_A_disable_dco_update_stall(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_disable_dco_update_stall(basePointer)
 #define SI32_PLL_A_disable_dco_update_stall(basePointer) \
@@ -387,9 +620,22 @@ _SI32_PLL_A_disable_dco_update_stall(SI32_PLL_A_Type* /*basePointer*/);
 ///  threshold
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PLL_A_set_lock_threshold_value(
+   SI32_PLL_A_Type * basePointer,
+   uint32_t threshold)
+{
+   assert(threshold < 4);   // threshold < 2^2
+   //{{
+   basePointer->CONTROL.LOCKTH = threshold;
+   //}}
+}
+#else
 void
 _SI32_PLL_A_set_lock_threshold_value(SI32_PLL_A_Type* /*basePointer*/,
    uint32_t /*threshold*/);
+#endif
 ///
 /// @def SI32_PLL_A_set_lock_threshold_value(basePointer, threshold)
 #define SI32_PLL_A_set_lock_threshold_value(basePointer, threshold) \
@@ -401,8 +647,19 @@ _SI32_PLL_A_set_lock_threshold_value(SI32_PLL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PLL_A_get_lock_threshold_value(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.LOCKTH;
+   //}}
+}
+#else
 uint32_t
 _SI32_PLL_A_get_lock_threshold_value(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_get_lock_threshold_value(basePointer)
 #define SI32_PLL_A_get_lock_threshold_value(basePointer) \
@@ -414,8 +671,19 @@ _SI32_PLL_A_get_lock_threshold_value(SI32_PLL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PLL_A_select_reference_clock_source_rtc0osc(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PLL_A_CONTROL_REFSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_PLL_A_select_reference_clock_source_rtc0osc(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_select_reference_clock_source_rtc0osc(basePointer)
 #define SI32_PLL_A_select_reference_clock_source_rtc0osc(basePointer) \
@@ -427,8 +695,20 @@ _SI32_PLL_A_select_reference_clock_source_rtc0osc(SI32_PLL_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PLL_A_select_reference_clock_source_lp0oscdiv(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PLL_A_CONTROL_REFSEL_MASK;
+   basePointer->CONTROL_SET = SI32_PLL_A_CONTROL_REFSEL_LPOSC0DIV_U32;
+   //}}
+}
+#else
 void
 _SI32_PLL_A_select_reference_clock_source_lp0oscdiv(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_select_reference_clock_source_lp0oscdiv(basePointer)
 #define SI32_PLL_A_select_reference_clock_source_lp0oscdiv(basePointer) do{  \
@@ -442,8 +722,20 @@ _SI32_PLL_A_select_reference_clock_source_lp0oscdiv(SI32_PLL_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PLL_A_select_reference_clock_source_ext0osc(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PLL_A_CONTROL_REFSEL_MASK;
+   basePointer->CONTROL_SET = SI32_PLL_A_CONTROL_REFSEL_EXTOSC0_U32;
+   //}}
+}
+#else
 void
 _SI32_PLL_A_select_reference_clock_source_ext0osc(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_select_reference_clock_source_ext0osc(basePointer)
 #define SI32_PLL_A_select_reference_clock_source_ext0osc(basePointer) do{  \
@@ -457,8 +749,20 @@ _SI32_PLL_A_select_reference_clock_source_ext0osc(SI32_PLL_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PLL_A_select_reference_clock_source_usb0osc(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PLL_A_CONTROL_REFSEL_MASK;
+   basePointer->CONTROL_SET = SI32_PLL_A_CONTROL_REFSEL_USBOSC0_U32;
+   //}}
+}
+#else
 void
 _SI32_PLL_A_select_reference_clock_source_usb0osc(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_select_reference_clock_source_usb0osc(basePointer)
 #define SI32_PLL_A_select_reference_clock_source_usb0osc(basePointer) do{  \
@@ -472,8 +776,20 @@ _SI32_PLL_A_select_reference_clock_source_usb0osc(SI32_PLL_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PLL_A_select_reference_clock_source_lp0osc(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PLL_A_CONTROL_REFSEL_MASK;
+   basePointer->CONTROL_SET = SI32_PLL_A_CONTROL_REFSEL_LPOSC0_U32;
+   //}}
+}
+#else
 void
 _SI32_PLL_A_select_reference_clock_source_lp0osc(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_select_reference_clock_source_lp0osc(basePointer)
 #define SI32_PLL_A_select_reference_clock_source_lp0osc(basePointer) do{  \
@@ -491,8 +807,19 @@ _SI32_PLL_A_select_reference_clock_source_lp0osc(SI32_PLL_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PLL_A_select_locked_interrupt_on_locked_mode(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_PLL_A_CONTROL_LCKPOL_ACTIVE_HIGH_U32;
+   //}}
+}
+#else
 void
 _SI32_PLL_A_select_locked_interrupt_on_locked_mode(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_select_locked_interrupt_on_locked_mode(basePointer)
 #define SI32_PLL_A_select_locked_interrupt_on_locked_mode(basePointer) \
@@ -508,8 +835,19 @@ _SI32_PLL_A_select_locked_interrupt_on_locked_mode(SI32_PLL_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PLL_A_select_locked_interrupt_on_unlocked_mode(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PLL_A_CONTROL_LCKPOL_MASK;
+   //}}
+}
+#else
 void
 _SI32_PLL_A_select_locked_interrupt_on_unlocked_mode(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_select_locked_interrupt_on_unlocked_mode(basePointer)
 #define SI32_PLL_A_select_locked_interrupt_on_unlocked_mode(basePointer) \
@@ -521,8 +859,19 @@ _SI32_PLL_A_select_locked_interrupt_on_unlocked_mode(SI32_PLL_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PLL_A_enable_locked_interrupt(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_PLL_A_CONTROL_LCKIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_PLL_A_enable_locked_interrupt(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_enable_locked_interrupt(basePointer)
 #define SI32_PLL_A_enable_locked_interrupt(basePointer) \
@@ -534,8 +883,19 @@ _SI32_PLL_A_enable_locked_interrupt(SI32_PLL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PLL_A_disable_locked_interrupt(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PLL_A_CONTROL_LCKIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PLL_A_disable_locked_interrupt(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_disable_locked_interrupt(basePointer)
 #define SI32_PLL_A_disable_locked_interrupt(basePointer) \
@@ -547,8 +907,19 @@ _SI32_PLL_A_disable_locked_interrupt(SI32_PLL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PLL_A_is_locked_interrupt_enabled(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.LCKIEN);
+   //}}
+}
+#else
 bool
 _SI32_PLL_A_is_locked_interrupt_enabled(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_is_locked_interrupt_enabled(basePointer)
 #define SI32_PLL_A_is_locked_interrupt_enabled(basePointer) \
@@ -560,8 +931,19 @@ _SI32_PLL_A_is_locked_interrupt_enabled(SI32_PLL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PLL_A_enable_saturation_interrupt(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_PLL_A_CONTROL_LMTIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_PLL_A_enable_saturation_interrupt(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_enable_saturation_interrupt(basePointer)
 #define SI32_PLL_A_enable_saturation_interrupt(basePointer) \
@@ -573,8 +955,19 @@ _SI32_PLL_A_enable_saturation_interrupt(SI32_PLL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PLL_A_disable_saturation_interrupt(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PLL_A_CONTROL_LMTIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PLL_A_disable_saturation_interrupt(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_disable_saturation_interrupt(basePointer)
 #define SI32_PLL_A_disable_saturation_interrupt(basePointer) \
@@ -586,8 +979,19 @@ _SI32_PLL_A_disable_saturation_interrupt(SI32_PLL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PLL_A_is_saturation_interrupt_enabled(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.LMTIEN);
+   //}}
+}
+#else
 bool
 _SI32_PLL_A_is_saturation_interrupt_enabled(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_is_saturation_interrupt_enabled(basePointer)
 #define SI32_PLL_A_is_saturation_interrupt_enabled(basePointer) \
@@ -602,8 +1006,19 @@ _SI32_PLL_A_is_saturation_interrupt_enabled(SI32_PLL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PLL_A_is_locked(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.LCKI);
+   //}}
+}
+#else
 bool
 _SI32_PLL_A_is_locked(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_is_locked(basePointer)
 #define SI32_PLL_A_is_locked(basePointer) \
@@ -618,8 +1033,19 @@ _SI32_PLL_A_is_locked(SI32_PLL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PLL_A_is_locked_interrupt_pending(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   return (bool)!(basePointer->CONTROL.LCKI ^ basePointer->CONTROL.LCKPOL);
+   //}}
+}
+#else
 bool
 _SI32_PLL_A_is_locked_interrupt_pending(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_is_locked_interrupt_pending(basePointer)
 #define SI32_PLL_A_is_locked_interrupt_pending(basePointer) \
@@ -634,8 +1060,19 @@ _SI32_PLL_A_is_locked_interrupt_pending(SI32_PLL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PLL_A_is_saturation_high_interrupt_pending(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.HLMTF);
+   //}}
+}
+#else
 bool
 _SI32_PLL_A_is_saturation_high_interrupt_pending(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_is_saturation_high_interrupt_pending(basePointer)
 #define SI32_PLL_A_is_saturation_high_interrupt_pending(basePointer) \
@@ -650,8 +1087,19 @@ _SI32_PLL_A_is_saturation_high_interrupt_pending(SI32_PLL_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PLL_A_is_saturation_low_interrupt_pending(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.LLMTF);
+   //}}
+}
+#else
 bool
 _SI32_PLL_A_is_saturation_low_interrupt_pending(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_is_saturation_low_interrupt_pending(basePointer)
 #define SI32_PLL_A_is_saturation_low_interrupt_pending(basePointer) \
@@ -669,9 +1117,22 @@ _SI32_PLL_A_is_saturation_low_interrupt_pending(SI32_PLL_A_Type* /*basePointer*/
 ///  Valid range is 32 bits.
 ///  Write to SSPR register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PLL_A_write_sspr(
+   SI32_PLL_A_Type * basePointer,
+   // Write to SSPR register.
+   uint32_t sspr)
+{
+   //{{
+   basePointer->SSPR.U32 = sspr;
+   //}}
+}
+#else
 void
 _SI32_PLL_A_write_sspr(SI32_PLL_A_Type* /*basePointer*/,
    uint32_t /*sspr*/);
+#endif
 ///
 /// @def SI32_PLL_A_write_sspr(basePointer, sspr)
 #define SI32_PLL_A_write_sspr(basePointer, sspr) \
@@ -686,8 +1147,19 @@ _SI32_PLL_A_write_sspr(SI32_PLL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PLL_A_read_sspr(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   return basePointer->SSPR.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PLL_A_read_sspr(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_read_sspr(basePointer)
 #define SI32_PLL_A_read_sspr(basePointer) \
@@ -705,9 +1177,23 @@ _SI32_PLL_A_read_sspr(SI32_PLL_A_Type* /*basePointer*/);
 ///  Valid range is 5 bits.
 ///  Interval is given by 4 * TDCO * (update_interval + 1).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PLL_A_set_spectrum_spreading_update_interval(
+   SI32_PLL_A_Type * basePointer,
+   // Interval is given by 4 * TDCO * (update_interval + 1).
+   uint32_t update_interval)
+{
+   assert(update_interval < 32);   // update_interval < 2^5
+   //{{
+   basePointer->SSPR.SSUINV = update_interval;
+   //}}
+}
+#else
 void
 _SI32_PLL_A_set_spectrum_spreading_update_interval(SI32_PLL_A_Type* /*basePointer*/,
    uint32_t /*update_interval*/);
+#endif
 ///
 /// @def SI32_PLL_A_set_spectrum_spreading_update_interval(basePointer, update_interval)
 #define SI32_PLL_A_set_spectrum_spreading_update_interval(basePointer, update_interval) \
@@ -726,9 +1212,24 @@ _SI32_PLL_A_set_spectrum_spreading_update_interval(SI32_PLL_A_Type* /*basePointe
 ///  0 = disabled, 1 = +/- 0.1% of TDCO, 2 = +/- 0.2% of TDCO, 3 = +/- 0.4%
 ///  of TDCO, 4 = +/- 0.8% of TDCO, 5 = +/- 1.6% of TDCO, 6-7 = reserved.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PLL_A_set_spectrum_spreading_amplitude(
+   SI32_PLL_A_Type * basePointer,
+   // 0 = disabled, 1 = +/- 0.1% of TDCO, 2 = +/- 0.2% of TDCO, 3 = +/- 0.4%
+   // of TDCO, 4 = +/- 0.8% of TDCO, 5 = +/- 1.6% of TDCO, 6-7 = reserved.
+   SI32_PLL_A_SPECTRUM_SPREADING_AMPLITUDE_Enum_Type ss_amplitude)
+{
+   assert(ss_amplitude < 8);   // ss_amplitude < 2^3
+   //{{
+   basePointer->SSPR.SSAMP = ss_amplitude;
+   //}}
+}
+#else
 void
 _SI32_PLL_A_set_spectrum_spreading_amplitude(SI32_PLL_A_Type* /*basePointer*/,
    SI32_PLL_A_SPECTRUM_SPREADING_AMPLITUDE_Enum_Type /*ss_amplitude*/);
+#endif
 ///
 /// @def SI32_PLL_A_set_spectrum_spreading_amplitude(basePointer, ss_amplitude)
 #define SI32_PLL_A_set_spectrum_spreading_amplitude(basePointer, ss_amplitude) \
@@ -746,9 +1247,22 @@ _SI32_PLL_A_set_spectrum_spreading_amplitude(SI32_PLL_A_Type* /*basePointer*/,
 ///  Valid range is 32 bits.
 ///  Write to CALCONFIG register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PLL_A_write_calconfig(
+   SI32_PLL_A_Type * basePointer,
+   // Write to CALCONFIG register.
+   uint32_t calconfig)
+{
+   //{{
+   basePointer->CALCONFIG.U32 = calconfig;
+   //}}
+}
+#else
 void
 _SI32_PLL_A_write_calconfig(SI32_PLL_A_Type* /*basePointer*/,
    uint32_t /*calconfig*/);
+#endif
 ///
 /// @def SI32_PLL_A_write_calconfig(basePointer, calconfig)
 #define SI32_PLL_A_write_calconfig(basePointer, calconfig) \
@@ -763,8 +1277,19 @@ _SI32_PLL_A_write_calconfig(SI32_PLL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PLL_A_read_calconfig(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CALCONFIG.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PLL_A_read_calconfig(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_read_calconfig(basePointer)
 #define SI32_PLL_A_read_calconfig(basePointer) \
@@ -783,9 +1308,25 @@ _SI32_PLL_A_read_calconfig(SI32_PLL_A_Type* /*basePointer*/);
 ///  0 = 23 to 37 MHz, 1 = 33 to 54 MHz, 2 = 45 to 71 MHz, 3 = 53 to 82
 ///  MHz, 4 = 73 to maximum SYSCLK MHz, 5-7 = reserved.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PLL_A_set_output_frequency_range(
+   SI32_PLL_A_Type * basePointer,
+   // 0 = 23 to 37 MHz, 1 = 33 to 54 MHz, 2 = 45 to 71 MHz, 3 = 53 to 82
+   // MHz, 4 = 73 to maximum SYSCLK MHz, 5-7 = reserved.
+   SI32_PLL_A_OUTPUT_FREQUENCY_RANGE_Enum_Type range)
+{
+   assert(range < 8);   // range < 2^3
+   //{{
+   basePointer->CALCONFIG.U32 &= ~SI32_PLL_A_CALCONFIG_RANGE_MASK;
+   basePointer->CALCONFIG.U32 |= range << SI32_PLL_A_CALCONFIG_RANGE_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_PLL_A_set_output_frequency_range(SI32_PLL_A_Type* /*basePointer*/,
    SI32_PLL_A_OUTPUT_FREQUENCY_RANGE_Enum_Type /*range*/);
+#endif
 ///
 /// @def SI32_PLL_A_set_output_frequency_range(basePointer, range)
 #define SI32_PLL_A_set_output_frequency_range(basePointer, range) do{  \
@@ -804,9 +1345,24 @@ _SI32_PLL_A_set_output_frequency_range(SI32_PLL_A_Type* /*basePointer*/,
 ///  adjust_value
 ///  Valid range is 12 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PLL_A_set_frequency_adjuster_value(
+   SI32_PLL_A_Type * basePointer,
+   uint32_t adjust_value)
+{
+   assert(adjust_value < 4096);   // adjust_value < 2^12
+   //{{
+   basePointer->CALCONFIG.U32 &= !SI32_PLL_A_CALCONFIG_CAL_MASK;
+   basePointer->CALCONFIG.U32 |=
+      adjust_value << SI32_PLL_A_CALCONFIG_CAL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_PLL_A_set_frequency_adjuster_value(SI32_PLL_A_Type* /*basePointer*/,
    uint32_t /*adjust_value*/);
+#endif
 ///
 /// @def SI32_PLL_A_set_frequency_adjuster_value(basePointer, adjust_value)
 #define SI32_PLL_A_set_frequency_adjuster_value(basePointer, adjust_value) do{  \
@@ -821,8 +1377,19 @@ _SI32_PLL_A_set_frequency_adjuster_value(SI32_PLL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PLL_A_get_frequency_adjuster_value(
+   SI32_PLL_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CALCONFIG.CAL;
+   //}}
+}
+#else
 uint32_t
 _SI32_PLL_A_get_frequency_adjuster_value(SI32_PLL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PLL_A_get_frequency_adjuster_value(basePointer)
 #define SI32_PLL_A_get_frequency_adjuster_value(basePointer) \
@@ -844,9 +1411,24 @@ _SI32_PLL_A_get_frequency_adjuster_value(SI32_PLL_A_Type* /*basePointer*/);
 ///  dither_value
 ///  Valid range is 4 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PLL_A_set_dithering_value(
+   SI32_PLL_A_Type * basePointer,
+   uint32_t dither_value)
+{
+   assert(dither_value < 16);   // dither_value < 2^4
+   //{{
+   basePointer->CALCONFIG.U32 &= !SI32_PLL_A_CALCONFIG_DITHER_MASK;
+   basePointer->CALCONFIG.U32 |=
+      dither_value << SI32_PLL_A_CALCONFIG_DITHER_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_PLL_A_set_dithering_value(SI32_PLL_A_Type* /*basePointer*/,
    uint32_t /*dither_value*/);
+#endif
 ///
 /// @def SI32_PLL_A_set_dithering_value(basePointer, dither_value)
 #define SI32_PLL_A_set_dithering_value(basePointer, dither_value) do{  \
@@ -53,9 +53,21 @@ extern "C" {
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PVTOSC_A_initialize(
+   SI32_PVTOSC_A_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_PVTOSC_A_initialize(SI32_PVTOSC_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_PVTOSC_A_initialize(basePointer, control)
 #define SI32_PVTOSC_A_initialize(basePointer, control) \
@@ -75,9 +87,21 @@ _SI32_PVTOSC_A_initialize(SI32_PVTOSC_A_Type* /*basePointer*/,
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PVTOSC_A_write_control(
+   SI32_PVTOSC_A_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_PVTOSC_A_write_control(SI32_PVTOSC_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_PVTOSC_A_write_control(basePointer, control)
 #define SI32_PVTOSC_A_write_control(basePointer, control) \
@@ -92,8 +116,19 @@ _SI32_PVTOSC_A_write_control(SI32_PVTOSC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PVTOSC_A_read_control(
+   SI32_PVTOSC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PVTOSC_A_read_control(SI32_PVTOSC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PVTOSC_A_read_control(basePointer)
 #define SI32_PVTOSC_A_read_control(basePointer) \
@@ -108,8 +143,19 @@ _SI32_PVTOSC_A_read_control(SI32_PVTOSC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PVTOSC_A_enable_digital_ldo_oscillator(
+   SI32_PVTOSC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_PVTOSC_A_CONTROL_DIGOSCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PVTOSC_A_enable_digital_ldo_oscillator(SI32_PVTOSC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PVTOSC_A_enable_digital_ldo_oscillator(basePointer)
 #define SI32_PVTOSC_A_enable_digital_ldo_oscillator(basePointer) \
@@ -124,8 +170,19 @@ _SI32_PVTOSC_A_enable_digital_ldo_oscillator(SI32_PVTOSC_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PVTOSC_A_disable_digital_ldo_oscillator(
+   SI32_PVTOSC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PVTOSC_A_CONTROL_DIGOSCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PVTOSC_A_disable_digital_ldo_oscillator(SI32_PVTOSC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PVTOSC_A_disable_digital_ldo_oscillator(basePointer)
 #define SI32_PVTOSC_A_disable_digital_ldo_oscillator(basePointer) \
@@ -140,8 +197,19 @@ _SI32_PVTOSC_A_disable_digital_ldo_oscillator(SI32_PVTOSC_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PVTOSC_A_enable_memory_ldo_oscillator(
+   SI32_PVTOSC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_PVTOSC_A_CONTROL_MEMOSCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PVTOSC_A_enable_memory_ldo_oscillator(SI32_PVTOSC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PVTOSC_A_enable_memory_ldo_oscillator(basePointer)
 #define SI32_PVTOSC_A_enable_memory_ldo_oscillator(basePointer) \
@@ -156,8 +224,19 @@ _SI32_PVTOSC_A_enable_memory_ldo_oscillator(SI32_PVTOSC_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PVTOSC_A_disable_memory_ldo_oscillator(
+   SI32_PVTOSC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PVTOSC_A_CONTROL_MEMOSCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PVTOSC_A_disable_memory_ldo_oscillator(SI32_PVTOSC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PVTOSC_A_disable_memory_ldo_oscillator(basePointer)
 #define SI32_PVTOSC_A_disable_memory_ldo_oscillator(basePointer) \
@@ -172,8 +251,19 @@ _SI32_PVTOSC_A_disable_memory_ldo_oscillator(SI32_PVTOSC_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PVTOSC_A_select_digital_ldo_oscillator_slow_mode(
+   SI32_PVTOSC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_PVTOSC_A_CONTROL_DIGOSCMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_PVTOSC_A_select_digital_ldo_oscillator_slow_mode(SI32_PVTOSC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PVTOSC_A_select_digital_ldo_oscillator_slow_mode(basePointer)
 #define SI32_PVTOSC_A_select_digital_ldo_oscillator_slow_mode(basePointer) \
@@ -188,8 +278,19 @@ _SI32_PVTOSC_A_select_digital_ldo_oscillator_slow_mode(SI32_PVTOSC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PVTOSC_A_select_digital_ldo_oscillator_fast_mode(
+   SI32_PVTOSC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PVTOSC_A_CONTROL_DIGOSCMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_PVTOSC_A_select_digital_ldo_oscillator_fast_mode(SI32_PVTOSC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PVTOSC_A_select_digital_ldo_oscillator_fast_mode(basePointer)
 #define SI32_PVTOSC_A_select_digital_ldo_oscillator_fast_mode(basePointer) \
@@ -204,8 +305,19 @@ _SI32_PVTOSC_A_select_digital_ldo_oscillator_fast_mode(SI32_PVTOSC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PVTOSC_A_select_memory_ldo_oscillator_slow_mode(
+   SI32_PVTOSC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_PVTOSC_A_CONTROL_MEMOSCMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_PVTOSC_A_select_memory_ldo_oscillator_slow_mode(SI32_PVTOSC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PVTOSC_A_select_memory_ldo_oscillator_slow_mode(basePointer)
 #define SI32_PVTOSC_A_select_memory_ldo_oscillator_slow_mode(basePointer) \
@@ -220,8 +332,19 @@ _SI32_PVTOSC_A_select_memory_ldo_oscillator_slow_mode(SI32_PVTOSC_A_Type* /*base
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PVTOSC_A_select_memory_ldo_oscillator_fast_mode(
+   SI32_PVTOSC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PVTOSC_A_CONTROL_MEMOSCMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_PVTOSC_A_select_memory_ldo_oscillator_fast_mode(SI32_PVTOSC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PVTOSC_A_select_memory_ldo_oscillator_fast_mode(basePointer)
 #define SI32_PVTOSC_A_select_memory_ldo_oscillator_fast_mode(basePointer) \
@@ -236,8 +359,19 @@ _SI32_PVTOSC_A_select_memory_ldo_oscillator_fast_mode(SI32_PVTOSC_A_Type* /*base
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PVTOSC_A_select_divider_source_apb_clock(
+   SI32_PVTOSC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_PVTOSC_A_CONTROL_CLKSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_PVTOSC_A_select_divider_source_apb_clock(SI32_PVTOSC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PVTOSC_A_select_divider_source_apb_clock(basePointer)
 #define SI32_PVTOSC_A_select_divider_source_apb_clock(basePointer) \
@@ -252,8 +386,19 @@ _SI32_PVTOSC_A_select_divider_source_apb_clock(SI32_PVTOSC_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PVTOSC_A_select_divider_source_oscillators(
+   SI32_PVTOSC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PVTOSC_A_CONTROL_CLKSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_PVTOSC_A_select_divider_source_oscillators(SI32_PVTOSC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PVTOSC_A_select_divider_source_oscillators(basePointer)
 #define SI32_PVTOSC_A_select_divider_source_oscillators(basePointer) \
@@ -25,6 +25,9 @@
 // HAL Source: 0.93
 // Version: 16
 
+// Build the out-of-line accessors even when SI32_HAL_INLINE is defined.
+#define SI32_HAL_OUT_OF_LINE
+
 #include <assert.h>
 #include "si32WideTypes.h"
 #include "SI32_RTC_B_Type.h"
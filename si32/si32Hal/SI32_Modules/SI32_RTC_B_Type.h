@@ -87,6 +87,36 @@ extern "C" {
 ///  Valid range is 32 bits.
 ///  Write to LFOCONTROL register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_initialize(
+   SI32_RTC_B_Type * basePointer,
+   // Write to CONFIG register.
+   uint32_t config,
+   // Write to CONTROL register.
+   uint32_t control,
+   // Write to ALARM0 register.
+   uint32_t alarm0,
+   // Write to ALARM1 register.
+   uint32_t alarm1,
+   // Write to ALARM2 register.
+   uint32_t alarm2,
+   // Write to SETCAP register.
+   uint32_t setcap,
+   // Write to LFOCONTROL register.
+   uint32_t lfocontrol)
+{
+   //{{
+   basePointer->CONFIG.U32 = config;
+   basePointer->CONTROL.U32 = control;
+   basePointer->ALARM0.U32 = alarm0;
+   basePointer->ALARM1.U32 = alarm1;
+   basePointer->ALARM2.U32 = alarm2;
+   basePointer->SETCAP.U32 = setcap;
+   basePointer->LFOCONTROL.U32 = lfocontrol;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_initialize(SI32_RTC_B_Type* /*basePointer*/,
    uint32_t, /*config*/
@@ -96,6 +126,7 @@ _SI32_RTC_B_initialize(SI32_RTC_B_Type* /*basePointer*/,
    uint32_t, /*alarm2*/
    uint32_t, /*setcap*/
    uint32_t /*lfocontrol*/);
+#endif
 ///
 /// @def SI32_RTC_B_initialize(basePointer, config, control, alarm0, alarm1, alarm2, setcap, lfocontrol)
 #define SI32_RTC_B_initialize(basePointer, config, control, alarm0, alarm1, alarm2, setcap, lfocontrol) do{  \
@@ -120,9 +151,22 @@ _SI32_RTC_B_initialize(SI32_RTC_B_Type* /*basePointer*/,
 ///  Valid range is 32 bits.
 ///  Write to CONFIG register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_write_config(
+   SI32_RTC_B_Type * basePointer,
+   // Write to CONFIG register.
+   uint32_t config)
+{
+   //{{
+   basePointer->CONFIG.U32 = config;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_write_config(SI32_RTC_B_Type* /*basePointer*/,
    uint32_t /*config*/);
+#endif
 ///
 /// @def SI32_RTC_B_write_config(basePointer, config)
 #define SI32_RTC_B_write_config(basePointer, config) \
@@ -137,8 +181,19 @@ _SI32_RTC_B_write_config(SI32_RTC_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_RTC_B_read_config(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   return basePointer->CONFIG.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_RTC_B_read_config(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_read_config(basePointer)
 #define SI32_RTC_B_read_config(basePointer) \
@@ -150,8 +205,19 @@ _SI32_RTC_B_read_config(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_enable_alarm0_auto_reset(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_RTC_B_CONFIG_ALM0AREN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_enable_alarm0_auto_reset(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_enable_alarm0_auto_reset(basePointer)
 #define SI32_RTC_B_enable_alarm0_auto_reset(basePointer) \
@@ -163,8 +229,19 @@ _SI32_RTC_B_enable_alarm0_auto_reset(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_disable_alarm0_auto_reset(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_RTC_B_CONFIG_ALM0AREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_disable_alarm0_auto_reset(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_disable_alarm0_auto_reset(basePointer)
 #define SI32_RTC_B_disable_alarm0_auto_reset(basePointer) \
@@ -176,8 +253,19 @@ _SI32_RTC_B_disable_alarm0_auto_reset(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_start_timer(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_RTC_B_CONFIG_RUN_START_U32;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_start_timer(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_start_timer(basePointer)
 #define SI32_RTC_B_start_timer(basePointer) \
@@ -189,8 +277,19 @@ _SI32_RTC_B_start_timer(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_stop_timer(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_RTC_B_CONFIG_RUN_MASK;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_stop_timer(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_stop_timer(basePointer)
 #define SI32_RTC_B_stop_timer(basePointer) \
@@ -202,8 +301,19 @@ _SI32_RTC_B_stop_timer(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_enable_missing_clock_detector(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_RTC_B_CONFIG_MCLKEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_enable_missing_clock_detector(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_enable_missing_clock_detector(basePointer)
 #define SI32_RTC_B_enable_missing_clock_detector(basePointer) \
@@ -215,8 +325,19 @@ _SI32_RTC_B_enable_missing_clock_detector(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_disable_missing_clock_detector(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_RTC_B_CONFIG_MCLKEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_disable_missing_clock_detector(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_disable_missing_clock_detector(basePointer)
 #define SI32_RTC_B_disable_missing_clock_detector(basePointer) \
@@ -228,8 +349,19 @@ _SI32_RTC_B_disable_missing_clock_detector(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_enable_autostep(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_RTC_B_CONFIG_ASEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_enable_autostep(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_enable_autostep(basePointer)
 #define SI32_RTC_B_enable_autostep(basePointer) \
@@ -241,8 +373,19 @@ _SI32_RTC_B_enable_autostep(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_disable_autostep(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_RTC_B_CONFIG_ASEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_disable_autostep(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_disable_autostep(basePointer)
 #define SI32_RTC_B_disable_autostep(basePointer) \
@@ -259,9 +402,23 @@ _SI32_RTC_B_disable_autostep(SI32_RTC_B_Type* /*basePointer*/);
 ///  rtclc
 ///  Valid range is 4 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_set_rtc_load_capacitance(
+   SI32_RTC_B_Type * basePointer,
+   uint32_t rtclc)
+{
+   assert(rtclc < 16);   // rtclc < 2^4
+   //{{
+   basePointer->CONFIG_CLR = SI32_RTC_B_CONFIG_RTCLC_MASK;
+   basePointer->CONFIG_SET = (rtclc << SI32_RTC_B_CONFIG_RTCLC_SHIFT);
+   //}}
+}
+#else
 void
 _SI32_RTC_B_set_rtc_load_capacitance(SI32_RTC_B_Type* /*basePointer*/,
    uint32_t /*rtclc*/);
+#endif
 ///
 /// @def SI32_RTC_B_set_rtc_load_capacitance(basePointer, rtclc)
 #define SI32_RTC_B_set_rtc_load_capacitance(basePointer, rtclc) do{  \
@@ -275,8 +432,19 @@ _SI32_RTC_B_set_rtc_load_capacitance(SI32_RTC_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_enable_bias_doubler(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_RTC_B_CONFIG_BDEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_enable_bias_doubler(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_enable_bias_doubler(basePointer)
 #define SI32_RTC_B_enable_bias_doubler(basePointer) \
@@ -288,8 +456,19 @@ _SI32_RTC_B_enable_bias_doubler(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_disable_bias_doubler(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_RTC_B_CONFIG_BDEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_disable_bias_doubler(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_disable_bias_doubler(basePointer)
 #define SI32_RTC_B_disable_bias_doubler(basePointer) \
@@ -301,8 +480,19 @@ _SI32_RTC_B_disable_bias_doubler(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_enable_crystal_oscillator(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_RTC_B_CONFIG_CRYSEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_enable_crystal_oscillator(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_enable_crystal_oscillator(basePointer)
 #define SI32_RTC_B_enable_crystal_oscillator(basePointer) \
@@ -314,8 +504,19 @@ _SI32_RTC_B_enable_crystal_oscillator(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_disable_crystal_oscillator(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_RTC_B_CONFIG_CRYSEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_disable_crystal_oscillator(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_disable_crystal_oscillator(basePointer)
 #define SI32_RTC_B_disable_crystal_oscillator(basePointer) \
@@ -327,8 +528,19 @@ _SI32_RTC_B_disable_crystal_oscillator(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_enable_auto_gain_control(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_RTC_B_CONFIG_AGCEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_enable_auto_gain_control(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_enable_auto_gain_control(basePointer)
 #define SI32_RTC_B_enable_auto_gain_control(basePointer) \
@@ -340,8 +552,19 @@ _SI32_RTC_B_enable_auto_gain_control(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_disable_auto_gain_control(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_RTC_B_CONFIG_AGCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_disable_auto_gain_control(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_disable_auto_gain_control(basePointer)
 #define SI32_RTC_B_disable_auto_gain_control(basePointer) \
@@ -353,8 +576,19 @@ _SI32_RTC_B_disable_auto_gain_control(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_enable_alarm0(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_RTC_B_CONFIG_ALM0EN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_enable_alarm0(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_enable_alarm0(basePointer)
 #define SI32_RTC_B_enable_alarm0(basePointer) \
@@ -366,8 +600,19 @@ _SI32_RTC_B_enable_alarm0(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_disable_alarm0(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_RTC_B_CONFIG_ALM0EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_disable_alarm0(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_disable_alarm0(basePointer)
 #define SI32_RTC_B_disable_alarm0(basePointer) \
@@ -379,8 +624,19 @@ _SI32_RTC_B_disable_alarm0(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_RTC_B_is_alarm0_enabled(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONFIG.ALM0EN);
+   //}}
+}
+#else
 bool
 _SI32_RTC_B_is_alarm0_enabled(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_is_alarm0_enabled(basePointer)
 #define SI32_RTC_B_is_alarm0_enabled(basePointer) \
@@ -392,8 +648,19 @@ _SI32_RTC_B_is_alarm0_enabled(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_enable_alarm1(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_RTC_B_CONFIG_ALM1EN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_enable_alarm1(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_enable_alarm1(basePointer)
 #define SI32_RTC_B_enable_alarm1(basePointer) \
@@ -405,8 +672,19 @@ _SI32_RTC_B_enable_alarm1(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_disable_alarm1(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_RTC_B_CONFIG_ALM1EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_disable_alarm1(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_disable_alarm1(basePointer)
 #define SI32_RTC_B_disable_alarm1(basePointer) \
@@ -418,8 +696,19 @@ _SI32_RTC_B_disable_alarm1(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_RTC_B_is_alarm1_enabled(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONFIG.ALM1EN);
+   //}}
+}
+#else
 bool
 _SI32_RTC_B_is_alarm1_enabled(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_is_alarm1_enabled(basePointer)
 #define SI32_RTC_B_is_alarm1_enabled(basePointer) \
@@ -431,8 +720,19 @@ _SI32_RTC_B_is_alarm1_enabled(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_enable_alarm2(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_RTC_B_CONFIG_ALM2EN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_enable_alarm2(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_enable_alarm2(basePointer)
 #define SI32_RTC_B_enable_alarm2(basePointer) \
@@ -444,8 +744,19 @@ _SI32_RTC_B_enable_alarm2(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_disable_alarm2(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_RTC_B_CONFIG_ALM2EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_disable_alarm2(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_disable_alarm2(basePointer)
 #define SI32_RTC_B_disable_alarm2(basePointer) \
@@ -457,8 +768,19 @@ _SI32_RTC_B_disable_alarm2(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_RTC_B_is_alarm2_enabled(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONFIG.ALM2EN);
+   //}}
+}
+#else
 bool
 _SI32_RTC_B_is_alarm2_enabled(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_is_alarm2_enabled(basePointer)
 #define SI32_RTC_B_is_alarm2_enabled(basePointer) \
@@ -470,8 +792,19 @@ _SI32_RTC_B_is_alarm2_enabled(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_enable_clock_out(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET =SI32_RTC_B_CONFIG_CLKOEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_enable_clock_out(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_enable_clock_out(basePointer)
 #define SI32_RTC_B_enable_clock_out(basePointer) \
@@ -483,8 +816,19 @@ _SI32_RTC_B_enable_clock_out(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_disable_clock_out(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_RTC_B_CONFIG_CLKOEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_disable_clock_out(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_disable_clock_out(basePointer)
 #define SI32_RTC_B_disable_clock_out(basePointer) \
@@ -496,8 +840,19 @@ _SI32_RTC_B_disable_clock_out(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_enable_external_pin_clock_drive(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET =SI32_RTC_B_CONFIG_RTCOEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_enable_external_pin_clock_drive(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_enable_external_pin_clock_drive(basePointer)
 #define SI32_RTC_B_enable_external_pin_clock_drive(basePointer) \
@@ -509,8 +864,19 @@ _SI32_RTC_B_enable_external_pin_clock_drive(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_disable_external_pin_clock_drive(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_RTC_B_CONFIG_RTCOEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_disable_external_pin_clock_drive(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_disable_external_pin_clock_drive(basePointer)
 #define SI32_RTC_B_disable_external_pin_clock_drive(basePointer) \
@@ -522,8 +888,19 @@ _SI32_RTC_B_disable_external_pin_clock_drive(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_set_clock_source_rtc(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_RTC_B_CONFIG_CLKSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_set_clock_source_rtc(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_set_clock_source_rtc(basePointer)
 #define SI32_RTC_B_set_clock_source_rtc(basePointer) \
@@ -535,8 +912,19 @@ _SI32_RTC_B_set_clock_source_rtc(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_set_clock_source_lfo(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_RTC_B_CONFIG_CLKSEL_LFOSCN_U32;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_set_clock_source_lfo(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_set_clock_source_lfo(basePointer)
 #define SI32_RTC_B_set_clock_source_lfo(basePointer) \
@@ -548,8 +936,19 @@ _SI32_RTC_B_set_clock_source_lfo(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_enable_rtc_timer(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_SET = SI32_RTC_B_CONFIG_RTCEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_enable_rtc_timer(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_enable_rtc_timer(basePointer)
 #define SI32_RTC_B_enable_rtc_timer(basePointer) \
@@ -561,8 +960,19 @@ _SI32_RTC_B_enable_rtc_timer(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_disable_rtc_timer(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_RTC_B_CONFIG_RTCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_disable_rtc_timer(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_disable_rtc_timer(basePointer)
 #define SI32_RTC_B_disable_rtc_timer(basePointer) \
@@ -580,9 +990,22 @@ _SI32_RTC_B_disable_rtc_timer(SI32_RTC_B_Type* /*basePointer*/);
 ///  Valid range is 32 bits.
 ///  Write to CONTROL register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_write_control(
+   SI32_RTC_B_Type * basePointer,
+   // Write to CONTROL register.
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_write_control(SI32_RTC_B_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_RTC_B_write_control(basePointer, control)
 #define SI32_RTC_B_write_control(basePointer, control) \
@@ -597,8 +1020,19 @@ _SI32_RTC_B_write_control(SI32_RTC_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_RTC_B_read_control(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_RTC_B_read_control(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_read_control(basePointer)
 #define SI32_RTC_B_read_control(basePointer) \
@@ -613,8 +1047,19 @@ _SI32_RTC_B_read_control(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_RTC_B_is_alarm0_interrupt_pending(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.ALM0I);
+   //}}
+}
+#else
 bool
 _SI32_RTC_B_is_alarm0_interrupt_pending(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_is_alarm0_interrupt_pending(basePointer)
 #define SI32_RTC_B_is_alarm0_interrupt_pending(basePointer) \
@@ -629,8 +1074,19 @@ _SI32_RTC_B_is_alarm0_interrupt_pending(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_RTC_B_is_alarm1_interrupt_pending(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.ALM1I);
+   //}}
+}
+#else
 bool
 _SI32_RTC_B_is_alarm1_interrupt_pending(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_is_alarm1_interrupt_pending(basePointer)
 #define SI32_RTC_B_is_alarm1_interrupt_pending(basePointer) \
@@ -645,8 +1101,19 @@ _SI32_RTC_B_is_alarm1_interrupt_pending(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_RTC_B_is_alarm2_interrupt_pending(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.ALM2I);
+   //}}
+}
+#else
 bool
 _SI32_RTC_B_is_alarm2_interrupt_pending(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_is_alarm2_interrupt_pending(basePointer)
 #define SI32_RTC_B_is_alarm2_interrupt_pending(basePointer) \
@@ -658,8 +1125,19 @@ _SI32_RTC_B_is_alarm2_interrupt_pending(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_start_timer_set(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_RTC_B_CONTROL_TMRSET_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_start_timer_set(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_start_timer_set(basePointer)
 #define SI32_RTC_B_start_timer_set(basePointer) \
@@ -674,8 +1152,19 @@ _SI32_RTC_B_start_timer_set(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_RTC_B_is_timer_set_in_progress(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.TMRSET);
+   //}}
+}
+#else
 bool
 _SI32_RTC_B_is_timer_set_in_progress(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_is_timer_set_in_progress(basePointer)
 #define SI32_RTC_B_is_timer_set_in_progress(basePointer) \
@@ -687,8 +1176,19 @@ _SI32_RTC_B_is_timer_set_in_progress(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_start_timer_capture(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_RTC_B_CONTROL_TMRCAP_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_start_timer_capture(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_start_timer_capture(basePointer)
 #define SI32_RTC_B_start_timer_capture(basePointer) \
@@ -703,8 +1203,19 @@ _SI32_RTC_B_start_timer_capture(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_RTC_B_is_timer_capture_in_progress(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.TMRCAP);
+   //}}
+}
+#else
 bool
 _SI32_RTC_B_is_timer_capture_in_progress(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_is_timer_capture_in_progress(basePointer)
 #define SI32_RTC_B_is_timer_capture_in_progress(basePointer) \
@@ -716,8 +1227,19 @@ _SI32_RTC_B_is_timer_capture_in_progress(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_clear_alarm0_interrupt(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_RTC_B_CONTROL_ALM0I_MASK;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_clear_alarm0_interrupt(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_clear_alarm0_interrupt(basePointer)
 #define SI32_RTC_B_clear_alarm0_interrupt(basePointer) \
@@ -729,8 +1251,19 @@ _SI32_RTC_B_clear_alarm0_interrupt(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_clear_alarm1_interrupt(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_RTC_B_CONTROL_ALM1I_MASK;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_clear_alarm1_interrupt(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_clear_alarm1_interrupt(basePointer)
 #define SI32_RTC_B_clear_alarm1_interrupt(basePointer) \
@@ -742,8 +1275,19 @@ _SI32_RTC_B_clear_alarm1_interrupt(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_clear_alarm2_interrupt(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_RTC_B_CONTROL_ALM2I_MASK;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_clear_alarm2_interrupt(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_clear_alarm2_interrupt(basePointer)
 #define SI32_RTC_B_clear_alarm2_interrupt(basePointer) \
@@ -758,8 +1302,19 @@ _SI32_RTC_B_clear_alarm2_interrupt(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_RTC_B_is_external_oscillator_valid(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.CLKVF);
+   //}}
+}
+#else
 bool
 _SI32_RTC_B_is_external_oscillator_valid(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_is_external_oscillator_valid(basePointer)
 #define SI32_RTC_B_is_external_oscillator_valid(basePointer) \
@@ -774,8 +1329,19 @@ _SI32_RTC_B_is_external_oscillator_valid(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_RTC_B_is_oscillator_running(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.OSCFI == SI32_RTC_B_CONTROL_OSCFI_NOT_SET_VALUE);
+   //}}
+}
+#else
 bool
 _SI32_RTC_B_is_oscillator_running(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_is_oscillator_running(basePointer)
 #define SI32_RTC_B_is_oscillator_running(basePointer) \
@@ -787,8 +1353,19 @@ _SI32_RTC_B_is_oscillator_running(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_clear_oscillator_fail_flag(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_RTC_B_CONTROL_OSCFI_MASK;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_clear_oscillator_fail_flag(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_clear_oscillator_fail_flag(basePointer)
 #define SI32_RTC_B_clear_oscillator_fail_flag(basePointer) \
@@ -800,8 +1377,19 @@ _SI32_RTC_B_clear_oscillator_fail_flag(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_enable_high_speed_mode(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_RTC_B_CONTROL_HSMDEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_enable_high_speed_mode(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_enable_high_speed_mode(basePointer)
 #define SI32_RTC_B_enable_high_speed_mode(basePointer) \
@@ -813,8 +1401,19 @@ _SI32_RTC_B_enable_high_speed_mode(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_disable_high_speed_mode(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_RTC_B_CONTROL_HSMDEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_disable_high_speed_mode(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_disable_high_speed_mode(basePointer)
 #define SI32_RTC_B_disable_high_speed_mode(basePointer) \
@@ -829,8 +1428,19 @@ _SI32_RTC_B_disable_high_speed_mode(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_RTC_B_is_load_capacitance_ready(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.LRDYF);
+   //}}
+}
+#else
 bool
 _SI32_RTC_B_is_load_capacitance_ready(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_is_load_capacitance_ready(basePointer)
 #define SI32_RTC_B_is_load_capacitance_ready(basePointer) \
@@ -848,9 +1458,22 @@ _SI32_RTC_B_is_load_capacitance_ready(SI32_RTC_B_Type* /*basePointer*/);
 ///  Valid range is 32 bits.
 ///  Write to ALARM0 register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_write_alarm0(
+   SI32_RTC_B_Type * basePointer,
+   // Write to ALARM0 register.
+   uint32_t alarm0)
+{
+   //{{
+   basePointer->ALARM0.U32 = alarm0;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_write_alarm0(SI32_RTC_B_Type* /*basePointer*/,
    uint32_t /*alarm0*/);
+#endif
 ///
 /// @def SI32_RTC_B_write_alarm0(basePointer, alarm0)
 #define SI32_RTC_B_write_alarm0(basePointer, alarm0) \
@@ -865,8 +1488,19 @@ _SI32_RTC_B_write_alarm0(SI32_RTC_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_RTC_B_read_alarm0(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   return basePointer->ALARM0.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_RTC_B_read_alarm0(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_read_alarm0(basePointer)
 #define SI32_RTC_B_read_alarm0(basePointer) \
@@ -884,9 +1518,22 @@ _SI32_RTC_B_read_alarm0(SI32_RTC_B_Type* /*basePointer*/);
 ///  Valid range is 32 bits.
 ///  Write to ALARM1 register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_write_alarm1(
+   SI32_RTC_B_Type * basePointer,
+   // Write to ALARM1 register.
+   uint32_t alarm1)
+{
+   //{{
+   basePointer->ALARM1.U32 = alarm1;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_write_alarm1(SI32_RTC_B_Type* /*basePointer*/,
    uint32_t /*alarm1*/);
+#endif
 ///
 /// @def SI32_RTC_B_write_alarm1(basePointer, alarm1)
 #define SI32_RTC_B_write_alarm1(basePointer, alarm1) \
@@ -901,8 +1548,19 @@ _SI32_RTC_B_write_alarm1(SI32_RTC_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_RTC_B_read_alarm1(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   return basePointer->ALARM1.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_RTC_B_read_alarm1(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_read_alarm1(basePointer)
 #define SI32_RTC_B_read_alarm1(basePointer) \
@@ -920,9 +1578,22 @@ _SI32_RTC_B_read_alarm1(SI32_RTC_B_Type* /*basePointer*/);
 ///  Valid range is 32 bits.
 ///  Write to ALARM2 register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_write_alarm2(
+   SI32_RTC_B_Type * basePointer,
+   // Write to ALARM2 register.
+   uint32_t alarm2)
+{
+   //{{
+   basePointer->ALARM2.U32 = alarm2;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_write_alarm2(SI32_RTC_B_Type* /*basePointer*/,
    uint32_t /*alarm2*/);
+#endif
 ///
 /// @def SI32_RTC_B_write_alarm2(basePointer, alarm2)
 #define SI32_RTC_B_write_alarm2(basePointer, alarm2) \
@@ -937,8 +1608,19 @@ _SI32_RTC_B_write_alarm2(SI32_RTC_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_RTC_B_read_alarm2(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   return basePointer->ALARM2.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_RTC_B_read_alarm2(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_read_alarm2(basePointer)
 #define SI32_RTC_B_read_alarm2(basePointer) \
@@ -959,9 +1641,22 @@ _SI32_RTC_B_read_alarm2(SI32_RTC_B_Type* /*basePointer*/);
 ///  Valid range is 32 bits.
 ///  Write to SETCAP register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_write_setcap(
+   SI32_RTC_B_Type * basePointer,
+   // Write to SETCAP register.
+   uint32_t setcap)
+{
+   //{{
+   basePointer->SETCAP.U32 = setcap;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_write_setcap(SI32_RTC_B_Type* /*basePointer*/,
    uint32_t /*setcap*/);
+#endif
 ///
 /// @def SI32_RTC_B_write_setcap(basePointer, setcap)
 #define SI32_RTC_B_write_setcap(basePointer, setcap) \
@@ -979,8 +1674,19 @@ _SI32_RTC_B_write_setcap(SI32_RTC_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_RTC_B_read_setcap(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   return basePointer->SETCAP.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_RTC_B_read_setcap(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_read_setcap(basePointer)
 #define SI32_RTC_B_read_setcap(basePointer) \
@@ -998,9 +1704,22 @@ _SI32_RTC_B_read_setcap(SI32_RTC_B_Type* /*basePointer*/);
 ///  Valid range is 32 bits.
 ///  Write to LFOCONTROL register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_write_lfocontrol(
+   SI32_RTC_B_Type * basePointer,
+   // Write to LFOCONTROL register.
+   uint32_t lfocontrol)
+{
+   //{{
+   basePointer->LFOCONTROL.U32 = lfocontrol;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_write_lfocontrol(SI32_RTC_B_Type* /*basePointer*/,
    uint32_t /*lfocontrol*/);
+#endif
 ///
 /// @def SI32_RTC_B_write_lfocontrol(basePointer, lfocontrol)
 #define SI32_RTC_B_write_lfocontrol(basePointer, lfocontrol) \
@@ -1015,8 +1734,19 @@ _SI32_RTC_B_write_lfocontrol(SI32_RTC_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_RTC_B_read_lfocontrol(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   return basePointer->LFOCONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_RTC_B_read_lfocontrol(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_read_lfocontrol(basePointer)
 #define SI32_RTC_B_read_lfocontrol(basePointer) \
@@ -1028,8 +1758,19 @@ _SI32_RTC_B_read_lfocontrol(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_enable_low_frequency_oscillator_output(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->LFOCONTROL.LFOOEN = SI32_RTC_B_LFOCONTROL_LFOOEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_enable_low_frequency_oscillator_output(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_enable_low_frequency_oscillator_output(basePointer)
 #define SI32_RTC_B_enable_low_frequency_oscillator_output(basePointer) \
@@ -1041,8 +1782,19 @@ _SI32_RTC_B_enable_low_frequency_oscillator_output(SI32_RTC_B_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_disable_low_frequency_oscillator_output(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->LFOCONTROL.LFOOEN = SI32_RTC_B_LFOCONTROL_LFOOEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_disable_low_frequency_oscillator_output(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_disable_low_frequency_oscillator_output(basePointer)
 #define SI32_RTC_B_disable_low_frequency_oscillator_output(basePointer) \
@@ -1054,8 +1806,19 @@ _SI32_RTC_B_disable_low_frequency_oscillator_output(SI32_RTC_B_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_enable_low_frequency_oscillator(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->LFOCONTROL.LFOSCEN = SI32_RTC_B_LFOCONTROL_LFOSCEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_enable_low_frequency_oscillator(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_enable_low_frequency_oscillator(basePointer)
 #define SI32_RTC_B_enable_low_frequency_oscillator(basePointer) \
@@ -1067,8 +1830,19 @@ _SI32_RTC_B_enable_low_frequency_oscillator(SI32_RTC_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RTC_B_disable_low_frequency_oscillator(
+   SI32_RTC_B_Type * basePointer)
+{
+   //{{
+   basePointer->LFOCONTROL.LFOSCEN = SI32_RTC_B_LFOCONTROL_LFOSCEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_RTC_B_disable_low_frequency_oscillator(SI32_RTC_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RTC_B_disable_low_frequency_oscillator(basePointer)
 #define SI32_RTC_B_disable_low_frequency_oscillator(basePointer) \
@@ -67,11 +67,30 @@ extern "C" {
 ///  Valid range is 32 bits.
 ///  Value to write to the WCLIMITS register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_initialize(
+   SI32_SARADC_A_Type * basePointer,
+   // Value to write to the CONFIG register.
+   uint32_t config,
+   // Value to write to the CONTROL register.
+   uint32_t control,
+   // Value to write to the WCLIMITS register.
+   uint32_t wclimits)
+{
+   //{{
+   basePointer->CONFIG.U32 = config;
+   basePointer->CONTROL.U32 = control;
+   basePointer->WCLIMITS.U32 = wclimits;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_initialize(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t, /*config*/
    uint32_t, /*control*/
    uint32_t /*wclimits*/);
+#endif
 ///
 /// @def SI32_SARADC_A_initialize(basePointer, config, control, wclimits)
 #define SI32_SARADC_A_initialize(basePointer, config, control, wclimits) do{  \
@@ -110,12 +129,34 @@ _SI32_SARADC_A_initialize(SI32_SARADC_A_Type* /*basePointer*/,
 ///  Valid range is 32 bits.
 ///  Value to write to the SQ7654 register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_initialize_channels(
+   SI32_SARADC_A_Type * basePointer,
+   // Value to write to the CHAR10 register.
+   uint32_t char10,
+   // Value to write to the CHAR32 register.
+   uint32_t char32,
+   // Value to write to the SQ3210 register.
+   uint32_t sq3210,
+   // Value to write to the SQ7654 register.
+   uint32_t sq7654)
+{
+   //{{
+   basePointer->CHAR10.U32 = char10;
+   basePointer->CHAR32.U32 = char32;
+   basePointer->SQ3210.U32 = sq3210;
+   basePointer->SQ7654.U32 = sq7654;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_initialize_channels(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t, /*char10*/
    uint32_t, /*char32*/
    uint32_t, /*sq3210*/
    uint32_t /*sq7654*/);
+#endif
 ///
 /// @def SI32_SARADC_A_initialize_channels(basePointer, char10, char32, sq3210, sq7654)
 #define SI32_SARADC_A_initialize_channels(basePointer, char10, char32, sq3210, sq7654) do{  \
@@ -139,9 +180,21 @@ _SI32_SARADC_A_initialize_channels(SI32_SARADC_A_Type* /*basePointer*/,
 ///  config
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_write_config(
+   SI32_SARADC_A_Type * basePointer,
+   uint32_t config)
+{
+   //{{
+   basePointer->CONFIG.U32 = config;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_write_config(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t /*config*/);
+#endif
 ///
 /// @def SI32_SARADC_A_write_config(basePointer, config)
 #define SI32_SARADC_A_write_config(basePointer, config) \
@@ -156,8 +209,19 @@ _SI32_SARADC_A_write_config(SI32_SARADC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_SARADC_A_read_config(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONFIG.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_SARADC_A_read_config(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_read_config(basePointer)
 #define SI32_SARADC_A_read_config(basePointer) \
@@ -179,9 +243,24 @@ _SI32_SARADC_A_read_config(SI32_SARADC_A_Type* /*basePointer*/);
 ///  Valid range is 0 to 15.
 ///  1 = Phase one, 2 = Phase two,..., 15 = Phase fifteen.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_set_sampling_phase(
+   SI32_SARADC_A_Type * basePointer,
+   // 1 = Phase one, 2 = Phase two,..., 15 = Phase fifteen.
+   uint32_t sphase)
+{
+   assert(sphase <= 15);
+   //{{
+   basePointer->CONFIG_CLR = 0x0000000F;
+   basePointer->CONFIG_SET = sphase;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_set_sampling_phase(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t /*sphase*/);
+#endif
 ///
 /// @def SI32_SARADC_A_set_sampling_phase(basePointer, sphase)
 #define SI32_SARADC_A_set_sampling_phase(basePointer, sphase) do{  \
@@ -198,8 +277,19 @@ _SI32_SARADC_A_set_sampling_phase(SI32_SARADC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_enable_sampling_phase(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SARADC_A_CONFIG_SPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_enable_sampling_phase(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_enable_sampling_phase(basePointer)
 #define SI32_SARADC_A_enable_sampling_phase(basePointer) \
@@ -214,8 +304,19 @@ _SI32_SARADC_A_enable_sampling_phase(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_disable_sampling_phase(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SARADC_A_CONFIG_SPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_disable_sampling_phase(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_disable_sampling_phase(basePointer)
 #define SI32_SARADC_A_disable_sampling_phase(basePointer) \
@@ -227,8 +328,19 @@ _SI32_SARADC_A_disable_sampling_phase(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_enable_ssg_conversion_start(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SARADC_A_CONFIG_SSGEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_enable_ssg_conversion_start(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_enable_ssg_conversion_start(basePointer)
 #define SI32_SARADC_A_enable_ssg_conversion_start(basePointer) \
@@ -240,8 +352,19 @@ _SI32_SARADC_A_enable_ssg_conversion_start(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_disable_ssg_conversion_start(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SARADC_A_CONFIG_SSGEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_disable_ssg_conversion_start(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_disable_ssg_conversion_start(basePointer)
 #define SI32_SARADC_A_disable_ssg_conversion_start(basePointer) \
@@ -257,8 +380,19 @@ _SI32_SARADC_A_disable_ssg_conversion_start(SI32_SARADC_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_output_packing_mode_upper_halfword_only(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SARADC_A_CONFIG_PACKMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_output_packing_mode_upper_halfword_only(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_output_packing_mode_upper_halfword_only(basePointer)
 #define SI32_SARADC_A_select_output_packing_mode_upper_halfword_only(basePointer) \
@@ -274,8 +408,20 @@ _SI32_SARADC_A_select_output_packing_mode_upper_halfword_only(SI32_SARADC_A_Type
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_output_packing_mode_lower_halfword_only(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SARADC_A_CONFIG_PACKMD_MASK;
+   basePointer->CONFIG_SET = SI32_SARADC_A_CONFIG_PACKMD_LOWER_ONLY_U32;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_output_packing_mode_lower_halfword_only(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_output_packing_mode_lower_halfword_only(basePointer)
 #define SI32_SARADC_A_select_output_packing_mode_lower_halfword_only(basePointer) do{  \
@@ -294,8 +440,20 @@ _SI32_SARADC_A_select_output_packing_mode_lower_halfword_only(SI32_SARADC_A_Type
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_output_packing_mode_upper_halfword_first(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SARADC_A_CONFIG_PACKMD_MASK;
+   basePointer->CONFIG_SET = SI32_SARADC_A_CONFIG_PACKMD_UPPER_FIRST_U32;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_output_packing_mode_upper_halfword_first(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_output_packing_mode_upper_halfword_first(basePointer)
 #define SI32_SARADC_A_select_output_packing_mode_upper_halfword_first(basePointer) do{  \
@@ -314,8 +472,19 @@ _SI32_SARADC_A_select_output_packing_mode_upper_halfword_first(SI32_SARADC_A_Typ
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_output_packing_mode_lower_halfword_first(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SARADC_A_CONFIG_PACKMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_output_packing_mode_lower_halfword_first(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_output_packing_mode_lower_halfword_first(basePointer)
 #define SI32_SARADC_A_select_output_packing_mode_lower_halfword_first(basePointer) \
@@ -327,8 +496,19 @@ _SI32_SARADC_A_select_output_packing_mode_lower_halfword_first(SI32_SARADC_A_Typ
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_enable_simultaneous_conversion(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SARADC_A_CONFIG_SIMCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_enable_simultaneous_conversion(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_enable_simultaneous_conversion(basePointer)
 #define SI32_SARADC_A_enable_simultaneous_conversion(basePointer) \
@@ -340,8 +520,19 @@ _SI32_SARADC_A_enable_simultaneous_conversion(SI32_SARADC_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_disable_simultaneous_conversion(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SARADC_A_CONFIG_SIMCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_disable_simultaneous_conversion(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_disable_simultaneous_conversion(basePointer)
 #define SI32_SARADC_A_disable_simultaneous_conversion(basePointer) \
@@ -353,8 +544,19 @@ _SI32_SARADC_A_disable_simultaneous_conversion(SI32_SARADC_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_enable_interleaved_mode(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SARADC_A_CONFIG_INTLVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_enable_interleaved_mode(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_enable_interleaved_mode(basePointer)
 #define SI32_SARADC_A_enable_interleaved_mode(basePointer) \
@@ -366,8 +568,19 @@ _SI32_SARADC_A_enable_interleaved_mode(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_disable_interleaved_mode(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SARADC_A_CONFIG_INTLVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_disable_interleaved_mode(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_disable_interleaved_mode(basePointer)
 #define SI32_SARADC_A_disable_interleaved_mode(basePointer) \
@@ -383,8 +596,19 @@ _SI32_SARADC_A_disable_interleaved_mode(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_enable_autoscan(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SARADC_A_CONFIG_SCANEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_enable_autoscan(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_enable_autoscan(basePointer)
 #define SI32_SARADC_A_enable_autoscan(basePointer) \
@@ -400,8 +624,19 @@ _SI32_SARADC_A_enable_autoscan(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_disable_autoscan(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SARADC_A_CONFIG_SCANEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_disable_autoscan(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_disable_autoscan(basePointer)
 #define SI32_SARADC_A_disable_autoscan(basePointer) \
@@ -417,8 +652,19 @@ _SI32_SARADC_A_disable_autoscan(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_autoscan_mode_once(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SARADC_A_CONFIG_SCANMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_autoscan_mode_once(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_autoscan_mode_once(basePointer)
 #define SI32_SARADC_A_select_autoscan_mode_once(basePointer) \
@@ -434,8 +680,19 @@ _SI32_SARADC_A_select_autoscan_mode_once(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_autoscan_mode_loop(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SARADC_A_CONFIG_SCANMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_autoscan_mode_loop(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_autoscan_mode_loop(basePointer)
 #define SI32_SARADC_A_select_autoscan_mode_loop(basePointer) \
@@ -447,8 +704,19 @@ _SI32_SARADC_A_select_autoscan_mode_loop(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_enable_dma(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SARADC_A_CONFIG_DMAEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_enable_dma(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_enable_dma(basePointer)
 #define SI32_SARADC_A_enable_dma(basePointer) \
@@ -460,8 +728,19 @@ _SI32_SARADC_A_enable_dma(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_disable_dma(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SARADC_A_CONFIG_DMAEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_disable_dma(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_disable_dma(basePointer)
 #define SI32_SARADC_A_disable_dma(basePointer) \
@@ -476,8 +755,19 @@ _SI32_SARADC_A_disable_dma(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_burst_mode_clock_lposc0(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SARADC_A_CONFIG_BCLKSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_burst_mode_clock_lposc0(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_burst_mode_clock_lposc0(basePointer)
 #define SI32_SARADC_A_select_burst_mode_clock_lposc0(basePointer) \
@@ -492,8 +782,19 @@ _SI32_SARADC_A_select_burst_mode_clock_lposc0(SI32_SARADC_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_burst_mode_clock_apb_clock(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SARADC_A_CONFIG_BCLKSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_burst_mode_clock_apb_clock(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_burst_mode_clock_apb_clock(basePointer)
 #define SI32_SARADC_A_select_burst_mode_clock_apb_clock(basePointer) \
@@ -517,9 +818,24 @@ _SI32_SARADC_A_select_burst_mode_clock_apb_clock(SI32_SARADC_A_Type* /*basePoint
 ///  Valid range is 11 bits.
 ///  SAR Clock Divider.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_sar_clock_divider(
+   SI32_SARADC_A_Type * basePointer,
+   // SAR Clock Divider.
+   uint32_t sar_clk_div)
+{
+   assert(sar_clk_div < 2048);   // sar_clk_div < 2^11
+   //{{
+   basePointer->CONFIG_CLR = SI32_SARADC_A_CONFIG_CLKDIV_MASK;
+   basePointer->CONFIG_SET = sar_clk_div << SI32_SARADC_A_CONFIG_CLKDIV_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_sar_clock_divider(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t /*sar_clk_div*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_sar_clock_divider(basePointer, sar_clk_div)
 #define SI32_SARADC_A_select_sar_clock_divider(basePointer, sar_clk_div) do{  \
@@ -533,8 +849,19 @@ _SI32_SARADC_A_select_sar_clock_divider(SI32_SARADC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_enable_single_conversion_complete_interrupt(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SARADC_A_CONFIG_SCCIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_enable_single_conversion_complete_interrupt(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_enable_single_conversion_complete_interrupt(basePointer)
 #define SI32_SARADC_A_enable_single_conversion_complete_interrupt(basePointer) \
@@ -546,8 +873,19 @@ _SI32_SARADC_A_enable_single_conversion_complete_interrupt(SI32_SARADC_A_Type* /
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_disable_single_conversion_complete_interrupt(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SARADC_A_CONFIG_SCCIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_disable_single_conversion_complete_interrupt(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_disable_single_conversion_complete_interrupt(basePointer)
 #define SI32_SARADC_A_disable_single_conversion_complete_interrupt(basePointer) \
@@ -559,8 +897,19 @@ _SI32_SARADC_A_disable_single_conversion_complete_interrupt(SI32_SARADC_A_Type*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SARADC_A_is_single_conversion_complete_interrupt_enabled(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONFIG.SCCIEN);
+   //}}
+}
+#else
 bool
 _SI32_SARADC_A_is_single_conversion_complete_interrupt_enabled(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_is_single_conversion_complete_interrupt_enabled(basePointer)
 #define SI32_SARADC_A_is_single_conversion_complete_interrupt_enabled(basePointer) \
@@ -572,8 +921,19 @@ _SI32_SARADC_A_is_single_conversion_complete_interrupt_enabled(SI32_SARADC_A_Typ
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_enable_scan_done_interrupt(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SARADC_A_CONFIG_SDIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_enable_scan_done_interrupt(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_enable_scan_done_interrupt(basePointer)
 #define SI32_SARADC_A_enable_scan_done_interrupt(basePointer) \
@@ -585,8 +945,19 @@ _SI32_SARADC_A_enable_scan_done_interrupt(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_disable_scan_done_interrupt(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SARADC_A_CONFIG_SDIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_disable_scan_done_interrupt(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_disable_scan_done_interrupt(basePointer)
 #define SI32_SARADC_A_disable_scan_done_interrupt(basePointer) \
@@ -598,8 +969,19 @@ _SI32_SARADC_A_disable_scan_done_interrupt(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SARADC_A_is_scan_done_interrupt_enabled(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONFIG.SDIEN);
+   //}}
+}
+#else
 bool
 _SI32_SARADC_A_is_scan_done_interrupt_enabled(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_is_scan_done_interrupt_enabled(basePointer)
 #define SI32_SARADC_A_is_scan_done_interrupt_enabled(basePointer) \
@@ -611,8 +993,19 @@ _SI32_SARADC_A_is_scan_done_interrupt_enabled(SI32_SARADC_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_enable_fifo_overrun_interrupt(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SARADC_A_CONFIG_FORIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_enable_fifo_overrun_interrupt(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_enable_fifo_overrun_interrupt(basePointer)
 #define SI32_SARADC_A_enable_fifo_overrun_interrupt(basePointer) \
@@ -624,8 +1017,19 @@ _SI32_SARADC_A_enable_fifo_overrun_interrupt(SI32_SARADC_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_disable_fifo_overrun_interrupt(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SARADC_A_CONFIG_FORIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_disable_fifo_overrun_interrupt(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_disable_fifo_overrun_interrupt(basePointer)
 #define SI32_SARADC_A_disable_fifo_overrun_interrupt(basePointer) \
@@ -637,8 +1041,19 @@ _SI32_SARADC_A_disable_fifo_overrun_interrupt(SI32_SARADC_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SARADC_A_is_fifo_overrun_interrupt_enabled(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONFIG.FORIEN);
+   //}}
+}
+#else
 bool
 _SI32_SARADC_A_is_fifo_overrun_interrupt_enabled(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_is_fifo_overrun_interrupt_enabled(basePointer)
 #define SI32_SARADC_A_is_fifo_overrun_interrupt_enabled(basePointer) \
@@ -650,8 +1065,19 @@ _SI32_SARADC_A_is_fifo_overrun_interrupt_enabled(SI32_SARADC_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_enable_fifo_underrun_interrupt(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SARADC_A_CONFIG_FURIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_enable_fifo_underrun_interrupt(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_enable_fifo_underrun_interrupt(basePointer)
 #define SI32_SARADC_A_enable_fifo_underrun_interrupt(basePointer) \
@@ -663,8 +1089,19 @@ _SI32_SARADC_A_enable_fifo_underrun_interrupt(SI32_SARADC_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_disable_fifo_underrun_interrupt(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SARADC_A_CONFIG_FURIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_disable_fifo_underrun_interrupt(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_disable_fifo_underrun_interrupt(basePointer)
 #define SI32_SARADC_A_disable_fifo_underrun_interrupt(basePointer) \
@@ -676,8 +1113,19 @@ _SI32_SARADC_A_disable_fifo_underrun_interrupt(SI32_SARADC_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SARADC_A_is_fifo_underrun_interrupt_enabled(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONFIG.FURIEN);
+   //}}
+}
+#else
 bool
 _SI32_SARADC_A_is_fifo_underrun_interrupt_enabled(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_is_fifo_underrun_interrupt_enabled(basePointer)
 #define SI32_SARADC_A_is_fifo_underrun_interrupt_enabled(basePointer) \
@@ -697,9 +1145,21 @@ _SI32_SARADC_A_is_fifo_underrun_interrupt_enabled(SI32_SARADC_A_Type* /*basePoin
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_write_control(
+   SI32_SARADC_A_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_write_control(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_SARADC_A_write_control(basePointer, control)
 #define SI32_SARADC_A_write_control(basePointer, control) \
@@ -714,8 +1174,19 @@ _SI32_SARADC_A_write_control(SI32_SARADC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_SARADC_A_read_control(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_SARADC_A_read_control(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_read_control(basePointer)
 #define SI32_SARADC_A_read_control(basePointer) \
@@ -727,8 +1198,19 @@ _SI32_SARADC_A_read_control(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_reference_ground_internal(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SARADC_A_CONTROL_REFGNDSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_reference_ground_internal(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_reference_ground_internal(basePointer)
 #define SI32_SARADC_A_select_reference_ground_internal(basePointer) \
@@ -740,8 +1222,19 @@ _SI32_SARADC_A_select_reference_ground_internal(SI32_SARADC_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_reference_ground_external(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_SARADC_A_CONTROL_REFGNDSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_reference_ground_external(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_reference_ground_external(basePointer)
 #define SI32_SARADC_A_select_reference_ground_external(basePointer) \
@@ -753,8 +1246,19 @@ _SI32_SARADC_A_select_reference_ground_external(SI32_SARADC_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_rising_clock_edge_sampling(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SARADC_A_CONTROL_CLKESEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_rising_clock_edge_sampling(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_rising_clock_edge_sampling(basePointer)
 #define SI32_SARADC_A_select_rising_clock_edge_sampling(basePointer) \
@@ -766,8 +1270,19 @@ _SI32_SARADC_A_select_rising_clock_edge_sampling(SI32_SARADC_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_falling_clock_edge_sampling(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_SARADC_A_CONTROL_CLKESEL_FALLING_U32;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_falling_clock_edge_sampling(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_falling_clock_edge_sampling(basePointer)
 #define SI32_SARADC_A_select_falling_clock_edge_sampling(basePointer) \
@@ -789,9 +1304,23 @@ _SI32_SARADC_A_select_falling_clock_edge_sampling(SI32_SARADC_A_Type* /*basePoin
 ///  burst_track
 ///  Valid range is 0 to 63.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_burst_mode_track_time(
+   SI32_SARADC_A_Type * basePointer,
+   uint32_t burst_track)
+{
+   assert(burst_track <= 63);
+   //{{
+   basePointer->CONTROL_CLR = SI32_SARADC_A_CONTROL_BMTK_MASK;
+   basePointer->CONTROL_SET = burst_track << SI32_SARADC_A_CONTROL_BMTK_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_burst_mode_track_time(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t /*burst_track*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_burst_mode_track_time(basePointer, burst_track)
 #define SI32_SARADC_A_select_burst_mode_track_time(basePointer, burst_track) do{  \
@@ -814,9 +1343,23 @@ _SI32_SARADC_A_select_burst_mode_track_time(SI32_SARADC_A_Type* /*basePointer*/,
 ///  soc_source
 ///  Valid range is 0 to 15.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_start_of_conversion_source(
+   SI32_SARADC_A_Type * basePointer,
+   uint32_t soc_source)
+{
+   assert(soc_source <= 15);
+   //{{
+   basePointer->CONTROL_CLR = SI32_SARADC_A_CONTROL_SCSEL_MASK;
+   basePointer->CONTROL_SET = soc_source << SI32_SARADC_A_CONTROL_SCSEL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_start_of_conversion_source(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t /*soc_source*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_start_of_conversion_source(basePointer, soc_source)
 #define SI32_SARADC_A_select_start_of_conversion_source(basePointer, soc_source) do{  \
@@ -840,9 +1383,23 @@ _SI32_SARADC_A_select_start_of_conversion_source(SI32_SARADC_A_Type* /*basePoint
 ///  burst_pwrup
 ///  Valid range is 0 to 15.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_burst_mode_power_up_time(
+   SI32_SARADC_A_Type * basePointer,
+   uint32_t burst_pwrup)
+{
+   assert(burst_pwrup <= 15);
+   //{{
+   basePointer->CONTROL_CLR = SI32_SARADC_A_CONTROL_PWRTIME_MASK;
+   basePointer->CONTROL_SET = burst_pwrup << SI32_SARADC_A_CONTROL_PWRTIME_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_burst_mode_power_up_time(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t /*burst_pwrup*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_burst_mode_power_up_time(basePointer, burst_pwrup)
 #define SI32_SARADC_A_select_burst_mode_power_up_time(basePointer, burst_pwrup) do{  \
@@ -856,8 +1413,19 @@ _SI32_SARADC_A_select_burst_mode_power_up_time(SI32_SARADC_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_enable_burst_mode(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_SARADC_A_CONTROL_BURSTEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_enable_burst_mode(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_enable_burst_mode(basePointer)
 #define SI32_SARADC_A_enable_burst_mode(basePointer) \
@@ -869,8 +1437,19 @@ _SI32_SARADC_A_enable_burst_mode(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_disable_burst_mode(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SARADC_A_CONTROL_BURSTEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_disable_burst_mode(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_disable_burst_mode(basePointer)
 #define SI32_SARADC_A_disable_burst_mode(basePointer) \
@@ -882,8 +1461,19 @@ _SI32_SARADC_A_disable_burst_mode(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_enable_module(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_SARADC_A_CONTROL_ADCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_enable_module(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_enable_module(basePointer)
 #define SI32_SARADC_A_enable_module(basePointer) \
@@ -895,8 +1485,19 @@ _SI32_SARADC_A_enable_module(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_disable_module(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SARADC_A_CONTROL_ADCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_disable_module(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_disable_module(basePointer)
 #define SI32_SARADC_A_disable_module(basePointer) \
@@ -911,8 +1512,19 @@ _SI32_SARADC_A_disable_module(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_12bit_sample_mode_four(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SARADC_A_CONTROL_AD12BSSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_12bit_sample_mode_four(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_12bit_sample_mode_four(basePointer)
 #define SI32_SARADC_A_select_12bit_sample_mode_four(basePointer) \
@@ -927,8 +1539,19 @@ _SI32_SARADC_A_select_12bit_sample_mode_four(SI32_SARADC_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_12bit_sample_mode_one(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_SARADC_A_CONTROL_AD12BSSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_12bit_sample_mode_one(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_12bit_sample_mode_one(basePointer)
 #define SI32_SARADC_A_select_12bit_sample_mode_one(basePointer) \
@@ -943,8 +1566,19 @@ _SI32_SARADC_A_select_12bit_sample_mode_one(SI32_SARADC_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_enable_common_mode_buffer(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_SARADC_A_CONTROL_VCMEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_enable_common_mode_buffer(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_enable_common_mode_buffer(basePointer)
 #define SI32_SARADC_A_enable_common_mode_buffer(basePointer) \
@@ -959,8 +1593,19 @@ _SI32_SARADC_A_enable_common_mode_buffer(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_disable_common_mode_buffer(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SARADC_A_CONTROL_VCMEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_disable_common_mode_buffer(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_disable_common_mode_buffer(basePointer)
 #define SI32_SARADC_A_disable_common_mode_buffer(basePointer) \
@@ -976,8 +1621,19 @@ _SI32_SARADC_A_disable_common_mode_buffer(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_enable_accumulator(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SARADC_A_CONTROL_ACCMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_enable_accumulator(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_enable_accumulator(basePointer)
 #define SI32_SARADC_A_enable_accumulator(basePointer) \
@@ -992,8 +1648,19 @@ _SI32_SARADC_A_enable_accumulator(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_disable_accumulator(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_SARADC_A_CONTROL_ACCMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_disable_accumulator(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_disable_accumulator(basePointer)
 #define SI32_SARADC_A_disable_accumulator(basePointer) \
@@ -1009,8 +1676,19 @@ _SI32_SARADC_A_disable_accumulator(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_normal_track_mode(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SARADC_A_CONTROL_TRKMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_normal_track_mode(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_normal_track_mode(basePointer)
 #define SI32_SARADC_A_select_normal_track_mode(basePointer) \
@@ -1026,8 +1704,19 @@ _SI32_SARADC_A_select_normal_track_mode(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_delayed_track_mode(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_SARADC_A_CONTROL_TRKMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_delayed_track_mode(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_delayed_track_mode(basePointer)
 #define SI32_SARADC_A_select_delayed_track_mode(basePointer) \
@@ -1043,8 +1732,19 @@ _SI32_SARADC_A_select_delayed_track_mode(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_start_conversion(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_SARADC_A_CONTROL_ADBUSY_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_start_conversion(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_start_conversion(basePointer)
 #define SI32_SARADC_A_start_conversion(basePointer) \
@@ -1059,8 +1759,19 @@ _SI32_SARADC_A_start_conversion(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SARADC_A_is_busy(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->CONTROL.ADBUSY;
+   //}}
+}
+#else
 bool
 _SI32_SARADC_A_is_busy(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_is_busy(basePointer)
 #define SI32_SARADC_A_is_busy(basePointer) \
@@ -1080,9 +1791,23 @@ _SI32_SARADC_A_is_busy(SI32_SARADC_A_Type* /*basePointer*/);
 ///  bias
 ///  Valid range is 0 to 3.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_bias_power(
+   SI32_SARADC_A_Type * basePointer,
+   SI32_SARADC_A_BIAS_POWER_Enum_Type bias)
+{
+   assert(bias <= 3);
+   //{{
+   basePointer->CONTROL_CLR = SI32_SARADC_A_CONTROL_BIASSEL_MASK;
+   basePointer->CONTROL_SET = bias << SI32_SARADC_A_CONTROL_BIASSEL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_bias_power(SI32_SARADC_A_Type* /*basePointer*/,
    SI32_SARADC_A_BIAS_POWER_Enum_Type /*bias*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_bias_power(basePointer, bias)
 #define SI32_SARADC_A_select_bias_power(basePointer, bias) do{  \
@@ -1096,8 +1821,19 @@ _SI32_SARADC_A_select_bias_power(SI32_SARADC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_enable_low_power_mode(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_SARADC_A_CONTROL_LPMDEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_enable_low_power_mode(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_enable_low_power_mode(basePointer)
 #define SI32_SARADC_A_enable_low_power_mode(basePointer) \
@@ -1109,8 +1845,19 @@ _SI32_SARADC_A_enable_low_power_mode(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_disable_low_power_mode(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SARADC_A_CONTROL_LPMDEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_disable_low_power_mode(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_disable_low_power_mode(basePointer)
 #define SI32_SARADC_A_disable_low_power_mode(basePointer) \
@@ -1122,8 +1869,19 @@ _SI32_SARADC_A_disable_low_power_mode(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_enable_mux_vref_low_power_mode(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_SARADC_A_CONTROL_MREFLPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_enable_mux_vref_low_power_mode(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_enable_mux_vref_low_power_mode(basePointer)
 #define SI32_SARADC_A_enable_mux_vref_low_power_mode(basePointer) \
@@ -1135,8 +1893,19 @@ _SI32_SARADC_A_enable_mux_vref_low_power_mode(SI32_SARADC_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_disable_mux_vref_low_power_mode(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SARADC_A_CONTROL_MREFLPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_disable_mux_vref_low_power_mode(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_disable_mux_vref_low_power_mode(basePointer)
 #define SI32_SARADC_A_disable_mux_vref_low_power_mode(basePointer) \
@@ -1148,8 +1917,19 @@ _SI32_SARADC_A_disable_mux_vref_low_power_mode(SI32_SARADC_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_vref_internal(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SARADC_A_CONTROL_VREFSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_vref_internal(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_vref_internal(basePointer)
 #define SI32_SARADC_A_select_vref_internal(basePointer) \
@@ -1161,8 +1941,20 @@ _SI32_SARADC_A_select_vref_internal(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_vref_vdd(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SARADC_A_CONTROL_VREFSEL_MASK;
+   basePointer->CONTROL_SET = SI32_SARADC_A_CONTROL_VREFSEL_VDD_U32;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_vref_vdd(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_vref_vdd(basePointer)
 #define SI32_SARADC_A_select_vref_vdd(basePointer) do{  \
@@ -1176,8 +1968,20 @@ _SI32_SARADC_A_select_vref_vdd(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_vref_ldo_output(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SARADC_A_CONTROL_VREFSEL_MASK;
+   basePointer->CONTROL_SET = SI32_SARADC_A_CONTROL_VREFSEL_LDO_OUT_U32;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_vref_ldo_output(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_vref_ldo_output(basePointer)
 #define SI32_SARADC_A_select_vref_ldo_output(basePointer) do{  \
@@ -1191,8 +1995,19 @@ _SI32_SARADC_A_select_vref_ldo_output(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_vref_external(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_SARADC_A_CONTROL_VREFSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_vref_external(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_vref_external(basePointer)
 #define SI32_SARADC_A_select_vref_external(basePointer) \
@@ -1212,9 +2027,21 @@ _SI32_SARADC_A_select_vref_external(SI32_SARADC_A_Type* /*basePointer*/);
 ///  sq7654
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_write_sq7654(
+   SI32_SARADC_A_Type * basePointer,
+   uint32_t sq7654)
+{
+   //{{
+   basePointer->SQ7654.U32 = sq7654;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_write_sq7654(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t /*sq7654*/);
+#endif
 ///
 /// @def SI32_SARADC_A_write_sq7654(basePointer, sq7654)
 #define SI32_SARADC_A_write_sq7654(basePointer, sq7654) \
@@ -1229,8 +2056,19 @@ _SI32_SARADC_A_write_sq7654(SI32_SARADC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_SARADC_A_read_sq7654(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->SQ7654.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_SARADC_A_read_sq7654(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_read_sq7654(basePointer)
 #define SI32_SARADC_A_read_sq7654(basePointer) \
@@ -1250,9 +2088,21 @@ _SI32_SARADC_A_read_sq7654(SI32_SARADC_A_Type* /*basePointer*/);
 ///  sq3210
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_write_sq3210(
+   SI32_SARADC_A_Type * basePointer,
+   uint32_t sq3210)
+{
+   //{{
+   basePointer->SQ3210.U32 = sq3210;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_write_sq3210(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t /*sq3210*/);
+#endif
 ///
 /// @def SI32_SARADC_A_write_sq3210(basePointer, sq3210)
 #define SI32_SARADC_A_write_sq3210(basePointer, sq3210) \
@@ -1267,8 +2117,19 @@ _SI32_SARADC_A_write_sq3210(SI32_SARADC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_SARADC_A_read_sq3210(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->SQ3210.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_SARADC_A_read_sq3210(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_read_sq3210(basePointer)
 #define SI32_SARADC_A_read_sq3210(basePointer) \
@@ -1296,10 +2157,55 @@ _SI32_SARADC_A_read_sq3210(SI32_SARADC_A_Type* /*basePointer*/);
 ///  Valid range is 0 to 3.
 ///  Channel characteristic group number (0 to 3).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot_channel_character_group(
+   SI32_SARADC_A_Type * basePointer,
+   // Sequencer time slot number (0 to 7).
+   uint32_t timeslot_num,
+   // Channel characteristic group number (0 to 3).
+   uint32_t ch_char_group_num)
+{
+   assert(timeslot_num <= 7);
+   assert(ch_char_group_num <= 3);
+   //{{
+   switch (timeslot_num)
+   {
+      case 0:
+        basePointer->SQ3210.TS0CHR = ch_char_group_num;
+        break;
+      case 1:
+        basePointer->SQ3210.TS1CHR = ch_char_group_num;
+        break;
+      case 2:
+        basePointer->SQ3210.TS2CHR = ch_char_group_num;
+        break;
+      case 3:
+        basePointer->SQ3210.TS3CHR = ch_char_group_num;
+        break;
+      case 4:
+        basePointer->SQ7654.TS4CHR = ch_char_group_num;
+        break;
+      case 5:
+        basePointer->SQ7654.TS5CHR = ch_char_group_num;
+        break;
+      case 6:
+        basePointer->SQ7654.TS6CHR = ch_char_group_num;
+        break;
+      case 7:
+        basePointer->SQ7654.TS7CHR = ch_char_group_num;
+        break;
+      default:
+        break;
+   }
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot_channel_character_group(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t, /*timeslot_num*/
    uint32_t /*ch_char_group_num*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot_channel_character_group(basePointer, timeslot_num, ch_char_group_num)
 #define SI32_SARADC_A_select_timeslot_channel_character_group(basePointer, timeslot_num, ch_char_group_num) \
@@ -1311,8 +2217,19 @@ _SI32_SARADC_A_select_timeslot_channel_character_group(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot0_to_use_characteristic0(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SQ3210.TS0CHR = 0;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot0_to_use_characteristic0(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot0_to_use_characteristic0(basePointer)
 #define SI32_SARADC_A_select_timeslot0_to_use_characteristic0(basePointer) \
@@ -1324,8 +2241,19 @@ _SI32_SARADC_A_select_timeslot0_to_use_characteristic0(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot0_to_use_characteristic1(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SQ3210.TS0CHR = 1;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot0_to_use_characteristic1(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot0_to_use_characteristic1(basePointer)
 #define SI32_SARADC_A_select_timeslot0_to_use_characteristic1(basePointer) \
@@ -1337,8 +2265,19 @@ _SI32_SARADC_A_select_timeslot0_to_use_characteristic1(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot0_to_use_characteristic2(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SQ3210.TS0CHR = 2;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot0_to_use_characteristic2(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot0_to_use_characteristic2(basePointer)
 #define SI32_SARADC_A_select_timeslot0_to_use_characteristic2(basePointer) \
@@ -1350,8 +2289,19 @@ _SI32_SARADC_A_select_timeslot0_to_use_characteristic2(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot0_to_use_characteristic3(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SQ3210.TS0CHR = 3;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot0_to_use_characteristic3(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot0_to_use_characteristic3(basePointer)
 #define SI32_SARADC_A_select_timeslot0_to_use_characteristic3(basePointer) \
@@ -1363,8 +2313,19 @@ _SI32_SARADC_A_select_timeslot0_to_use_characteristic3(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot1_to_use_characteristic0(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SQ3210.TS1CHR = 0;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot1_to_use_characteristic0(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot1_to_use_characteristic0(basePointer)
 #define SI32_SARADC_A_select_timeslot1_to_use_characteristic0(basePointer) \
@@ -1376,8 +2337,19 @@ _SI32_SARADC_A_select_timeslot1_to_use_characteristic0(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot1_to_use_characteristic1(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SQ3210.TS1CHR = 1;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot1_to_use_characteristic1(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot1_to_use_characteristic1(basePointer)
 #define SI32_SARADC_A_select_timeslot1_to_use_characteristic1(basePointer) \
@@ -1389,8 +2361,19 @@ _SI32_SARADC_A_select_timeslot1_to_use_characteristic1(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot1_to_use_characteristic2(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SQ3210.TS1CHR = 2;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot1_to_use_characteristic2(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot1_to_use_characteristic2(basePointer)
 #define SI32_SARADC_A_select_timeslot1_to_use_characteristic2(basePointer) \
@@ -1402,8 +2385,19 @@ _SI32_SARADC_A_select_timeslot1_to_use_characteristic2(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot1_to_use_characteristic3(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SQ3210.TS1CHR = 3;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot1_to_use_characteristic3(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot1_to_use_characteristic3(basePointer)
 #define SI32_SARADC_A_select_timeslot1_to_use_characteristic3(basePointer) \
@@ -1415,8 +2409,19 @@ _SI32_SARADC_A_select_timeslot1_to_use_characteristic3(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot2_to_use_characteristic0(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SQ3210.TS2CHR = 0;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot2_to_use_characteristic0(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot2_to_use_characteristic0(basePointer)
 #define SI32_SARADC_A_select_timeslot2_to_use_characteristic0(basePointer) \
@@ -1428,8 +2433,19 @@ _SI32_SARADC_A_select_timeslot2_to_use_characteristic0(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot2_to_use_characteristic1(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SQ3210.TS2CHR = 1;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot2_to_use_characteristic1(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot2_to_use_characteristic1(basePointer)
 #define SI32_SARADC_A_select_timeslot2_to_use_characteristic1(basePointer) \
@@ -1441,8 +2457,19 @@ _SI32_SARADC_A_select_timeslot2_to_use_characteristic1(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot2_to_use_characteristic2(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SQ3210.TS2CHR = 2;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot2_to_use_characteristic2(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot2_to_use_characteristic2(basePointer)
 #define SI32_SARADC_A_select_timeslot2_to_use_characteristic2(basePointer) \
@@ -1454,8 +2481,19 @@ _SI32_SARADC_A_select_timeslot2_to_use_characteristic2(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot2_to_use_characteristic3(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SQ3210.TS2CHR = 3;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot2_to_use_characteristic3(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot2_to_use_characteristic3(basePointer)
 #define SI32_SARADC_A_select_timeslot2_to_use_characteristic3(basePointer) \
@@ -1467,8 +2505,19 @@ _SI32_SARADC_A_select_timeslot2_to_use_characteristic3(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot3_to_use_characteristic0(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SQ3210.TS3CHR = 0;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot3_to_use_characteristic0(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot3_to_use_characteristic0(basePointer)
 #define SI32_SARADC_A_select_timeslot3_to_use_characteristic0(basePointer) \
@@ -1480,8 +2529,19 @@ _SI32_SARADC_A_select_timeslot3_to_use_characteristic0(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot3_to_use_characteristic1(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SQ3210.TS3CHR = 1;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot3_to_use_characteristic1(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot3_to_use_characteristic1(basePointer)
 #define SI32_SARADC_A_select_timeslot3_to_use_characteristic1(basePointer) \
@@ -1493,8 +2553,19 @@ _SI32_SARADC_A_select_timeslot3_to_use_characteristic1(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot3_to_use_characteristic2(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SQ3210.TS3CHR = 2;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot3_to_use_characteristic2(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot3_to_use_characteristic2(basePointer)
 #define SI32_SARADC_A_select_timeslot3_to_use_characteristic2(basePointer) \
@@ -1506,8 +2577,19 @@ _SI32_SARADC_A_select_timeslot3_to_use_characteristic2(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot3_to_use_characteristic3(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SQ3210.TS3CHR = 3;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot3_to_use_characteristic3(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot3_to_use_characteristic3(basePointer)
 #define SI32_SARADC_A_select_timeslot3_to_use_characteristic3(basePointer) \
@@ -1519,8 +2601,19 @@ _SI32_SARADC_A_select_timeslot3_to_use_characteristic3(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot4_to_use_characteristic0(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SQ7654.TS4CHR = 0;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot4_to_use_characteristic0(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot4_to_use_characteristic0(basePointer)
 #define SI32_SARADC_A_select_timeslot4_to_use_characteristic0(basePointer) \
@@ -1532,8 +2625,19 @@ _SI32_SARADC_A_select_timeslot4_to_use_characteristic0(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot4_to_use_characteristic1(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SQ7654.TS4CHR = 1;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot4_to_use_characteristic1(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot4_to_use_characteristic1(basePointer)
 #define SI32_SARADC_A_select_timeslot4_to_use_characteristic1(basePointer) \
@@ -1545,8 +2649,19 @@ _SI32_SARADC_A_select_timeslot4_to_use_characteristic1(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot4_to_use_characteristic2(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SQ7654.TS4CHR = 2;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot4_to_use_characteristic2(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot4_to_use_characteristic2(basePointer)
 #define SI32_SARADC_A_select_timeslot4_to_use_characteristic2(basePointer) \
@@ -1558,8 +2673,19 @@ _SI32_SARADC_A_select_timeslot4_to_use_characteristic2(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot4_to_use_characteristic3(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SQ7654.TS4CHR = 3;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot4_to_use_characteristic3(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot4_to_use_characteristic3(basePointer)
 #define SI32_SARADC_A_select_timeslot4_to_use_characteristic3(basePointer) \
@@ -1571,8 +2697,19 @@ _SI32_SARADC_A_select_timeslot4_to_use_characteristic3(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot5_to_use_characteristic0(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SQ7654.TS5CHR = 0;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot5_to_use_characteristic0(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot5_to_use_characteristic0(basePointer)
 #define SI32_SARADC_A_select_timeslot5_to_use_characteristic0(basePointer) \
@@ -1584,8 +2721,19 @@ _SI32_SARADC_A_select_timeslot5_to_use_characteristic0(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot5_to_use_characteristic1(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SQ7654.TS5CHR = 1;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot5_to_use_characteristic1(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot5_to_use_characteristic1(basePointer)
 #define SI32_SARADC_A_select_timeslot5_to_use_characteristic1(basePointer) \
@@ -1597,8 +2745,19 @@ _SI32_SARADC_A_select_timeslot5_to_use_characteristic1(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot5_to_use_characteristic2(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SQ7654.TS5CHR = 2;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot5_to_use_characteristic2(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot5_to_use_characteristic2(basePointer)
 #define SI32_SARADC_A_select_timeslot5_to_use_characteristic2(basePointer) \
@@ -1610,8 +2769,19 @@ _SI32_SARADC_A_select_timeslot5_to_use_characteristic2(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot5_to_use_characteristic3(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SQ7654.TS5CHR = 3;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot5_to_use_characteristic3(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot5_to_use_characteristic3(basePointer)
 #define SI32_SARADC_A_select_timeslot5_to_use_characteristic3(basePointer) \
@@ -1623,8 +2793,19 @@ _SI32_SARADC_A_select_timeslot5_to_use_characteristic3(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot6_to_use_characteristic0(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SQ7654.TS6CHR = 0;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot6_to_use_characteristic0(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot6_to_use_characteristic0(basePointer)
 #define SI32_SARADC_A_select_timeslot6_to_use_characteristic0(basePointer) \
@@ -1636,8 +2817,19 @@ _SI32_SARADC_A_select_timeslot6_to_use_characteristic0(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot6_to_use_characteristic1(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SQ7654.TS6CHR = 1;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot6_to_use_characteristic1(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot6_to_use_characteristic1(basePointer)
 #define SI32_SARADC_A_select_timeslot6_to_use_characteristic1(basePointer) \
@@ -1649,8 +2841,19 @@ _SI32_SARADC_A_select_timeslot6_to_use_characteristic1(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot6_to_use_characteristic2(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SQ7654.TS6CHR = 2;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot6_to_use_characteristic2(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot6_to_use_characteristic2(basePointer)
 #define SI32_SARADC_A_select_timeslot6_to_use_characteristic2(basePointer) \
@@ -1662,8 +2865,19 @@ _SI32_SARADC_A_select_timeslot6_to_use_characteristic2(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot6_to_use_characteristic3(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SQ7654.TS6CHR = 3;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot6_to_use_characteristic3(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot6_to_use_characteristic3(basePointer)
 #define SI32_SARADC_A_select_timeslot6_to_use_characteristic3(basePointer) \
@@ -1675,8 +2889,19 @@ _SI32_SARADC_A_select_timeslot6_to_use_characteristic3(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot7_to_use_characteristic0(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SQ7654.TS7CHR = 0;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot7_to_use_characteristic0(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot7_to_use_characteristic0(basePointer)
 #define SI32_SARADC_A_select_timeslot7_to_use_characteristic0(basePointer) \
@@ -1688,8 +2913,19 @@ _SI32_SARADC_A_select_timeslot7_to_use_characteristic0(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot7_to_use_characteristic1(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SQ7654.TS7CHR = 1;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot7_to_use_characteristic1(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot7_to_use_characteristic1(basePointer)
 #define SI32_SARADC_A_select_timeslot7_to_use_characteristic1(basePointer) \
@@ -1701,8 +2937,19 @@ _SI32_SARADC_A_select_timeslot7_to_use_characteristic1(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot7_to_use_characteristic2(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SQ7654.TS7CHR = 2;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot7_to_use_characteristic2(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot7_to_use_characteristic2(basePointer)
 #define SI32_SARADC_A_select_timeslot7_to_use_characteristic2(basePointer) \
@@ -1714,8 +2961,19 @@ _SI32_SARADC_A_select_timeslot7_to_use_characteristic2(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot7_to_use_characteristic3(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->SQ7654.TS7CHR = 3;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot7_to_use_characteristic3(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot7_to_use_characteristic3(basePointer)
 #define SI32_SARADC_A_select_timeslot7_to_use_characteristic3(basePointer) \
@@ -1742,10 +3000,55 @@ _SI32_SARADC_A_select_timeslot7_to_use_characteristic3(SI32_SARADC_A_Type* /*bas
 ///  Valid range is 0 to 31.
 ///  Channel number (0 to 31).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot_channel(
+   SI32_SARADC_A_Type * basePointer,
+   // Sequencer time slot number (0 to 7).
+   uint32_t timeslot_num,
+   // Channel number (0 to 31).
+   uint32_t channel)
+{
+   assert(timeslot_num <= 7);
+   assert(channel <= 31);
+   //{{
+   switch (timeslot_num)
+   {
+      case 0:
+      basePointer->SQ3210.TS0MUX = channel;
+       break;
+      case 1:
+      basePointer->SQ3210.TS1MUX = channel;
+       break;
+    case 2:
+      basePointer->SQ3210.TS2MUX = channel;
+       break;
+      case 3:
+      basePointer->SQ3210.TS3MUX = channel;
+       break;
+    case 4:
+         basePointer->SQ7654.TS4MUX = channel;
+       break;
+      case 5:
+      basePointer->SQ7654.TS5MUX = channel;
+       break;
+    case 6:
+      basePointer->SQ7654.TS6MUX = channel;
+       break;
+    case 7:
+      basePointer->SQ7654.TS7MUX = channel;
+       break;
+      default:
+       break;
+   }
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot_channel(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t, /*timeslot_num*/
    uint32_t /*channel*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot_channel(basePointer, timeslot_num, channel)
 #define SI32_SARADC_A_select_timeslot_channel(basePointer, timeslot_num, channel) \
@@ -1763,9 +3066,23 @@ _SI32_SARADC_A_select_timeslot_channel(SI32_SARADC_A_Type* /*basePointer*/,
 ///  Valid range is 0 to 31.
 ///  Channel number (0 to 31).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot0_channel(
+   SI32_SARADC_A_Type * basePointer,
+   // Channel number (0 to 31).
+   uint32_t channel)
+{
+   assert(channel <= 31);
+   //{{
+   basePointer->SQ3210.TS0MUX = channel;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot0_channel(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t /*channel*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot0_channel(basePointer, channel)
 #define SI32_SARADC_A_select_timeslot0_channel(basePointer, channel) \
@@ -1783,9 +3100,23 @@ _SI32_SARADC_A_select_timeslot0_channel(SI32_SARADC_A_Type* /*basePointer*/,
 ///  Valid range is 0 to 31.
 ///  Channel number (0 to 31).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot1_channel(
+   SI32_SARADC_A_Type * basePointer,
+   // Channel number (0 to 31).
+   uint32_t channel)
+{
+   assert(channel <= 31);
+   //{{
+   basePointer->SQ3210.TS1MUX = channel;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot1_channel(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t /*channel*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot1_channel(basePointer, channel)
 #define SI32_SARADC_A_select_timeslot1_channel(basePointer, channel) \
@@ -1803,9 +3134,23 @@ _SI32_SARADC_A_select_timeslot1_channel(SI32_SARADC_A_Type* /*basePointer*/,
 ///  Valid range is 0 to 31.
 ///  Channel number (0 to 31).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot2_channel(
+   SI32_SARADC_A_Type * basePointer,
+   // Channel number (0 to 31).
+   uint32_t channel)
+{
+   assert(channel <= 31);
+   //{{
+   basePointer->SQ3210.TS2MUX = channel;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot2_channel(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t /*channel*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot2_channel(basePointer, channel)
 #define SI32_SARADC_A_select_timeslot2_channel(basePointer, channel) \
@@ -1823,9 +3168,23 @@ _SI32_SARADC_A_select_timeslot2_channel(SI32_SARADC_A_Type* /*basePointer*/,
 ///  Valid range is 0 to 31.
 ///  Channel number (0 to 31).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot3_channel(
+   SI32_SARADC_A_Type * basePointer,
+   // Channel number (0 to 31).
+   uint32_t channel)
+{
+   assert(channel <= 31);
+   //{{
+   basePointer->SQ3210.TS3MUX = channel;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot3_channel(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t /*channel*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot3_channel(basePointer, channel)
 #define SI32_SARADC_A_select_timeslot3_channel(basePointer, channel) \
@@ -1843,9 +3202,23 @@ _SI32_SARADC_A_select_timeslot3_channel(SI32_SARADC_A_Type* /*basePointer*/,
 ///  Valid range is 0 to 31.
 ///  Channel number (0 to 31).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot4_channel(
+   SI32_SARADC_A_Type * basePointer,
+   // Channel number (0 to 31).
+   uint32_t channel)
+{
+   assert(channel <= 31);
+   //{{
+   basePointer->SQ7654.TS4MUX = channel;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot4_channel(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t /*channel*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot4_channel(basePointer, channel)
 #define SI32_SARADC_A_select_timeslot4_channel(basePointer, channel) \
@@ -1863,9 +3236,23 @@ _SI32_SARADC_A_select_timeslot4_channel(SI32_SARADC_A_Type* /*basePointer*/,
 ///  Valid range is 0 to 31.
 ///  Channel number (0 to 31).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot5_channel(
+   SI32_SARADC_A_Type * basePointer,
+   // Channel number (0 to 31).
+   uint32_t channel)
+{
+   assert(channel <= 31);
+   //{{
+   basePointer->SQ7654.TS5MUX = channel;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot5_channel(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t /*channel*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot5_channel(basePointer, channel)
 #define SI32_SARADC_A_select_timeslot5_channel(basePointer, channel) \
@@ -1883,9 +3270,23 @@ _SI32_SARADC_A_select_timeslot5_channel(SI32_SARADC_A_Type* /*basePointer*/,
 ///  Valid range is 0 to 31.
 ///  Channel number (0 to 31).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot6_channel(
+   SI32_SARADC_A_Type * basePointer,
+   // Channel number (0 to 31).
+   uint32_t channel)
+{
+   assert(channel <= 31);
+   //{{
+   basePointer->SQ7654.TS6MUX = channel;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot6_channel(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t /*channel*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot6_channel(basePointer, channel)
 #define SI32_SARADC_A_select_timeslot6_channel(basePointer, channel) \
@@ -1903,9 +3304,23 @@ _SI32_SARADC_A_select_timeslot6_channel(SI32_SARADC_A_Type* /*basePointer*/,
 ///  Valid range is 0 to 31.
 ///  Channel number (0 to 31).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_timeslot7_channel(
+   SI32_SARADC_A_Type * basePointer,
+   // Channel number (0 to 31).
+   uint32_t channel)
+{
+   assert(channel <= 31);
+   //{{
+   basePointer->SQ7654.TS7MUX = channel;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_timeslot7_channel(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t /*channel*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_timeslot7_channel(basePointer, channel)
 #define SI32_SARADC_A_select_timeslot7_channel(basePointer, channel) \
@@ -1925,9 +3340,21 @@ _SI32_SARADC_A_select_timeslot7_channel(SI32_SARADC_A_Type* /*basePointer*/,
 ///  char32
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_write_char32(
+   SI32_SARADC_A_Type * basePointer,
+   uint32_t char32)
+{
+   //{{
+   basePointer->CHAR32.U32 = char32;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_write_char32(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t /*char32*/);
+#endif
 ///
 /// @def SI32_SARADC_A_write_char32(basePointer, char32)
 #define SI32_SARADC_A_write_char32(basePointer, char32) \
@@ -1942,8 +3369,19 @@ _SI32_SARADC_A_write_char32(SI32_SARADC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_SARADC_A_read_char32(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CHAR32.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_SARADC_A_read_char32(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_read_char32(basePointer)
 #define SI32_SARADC_A_read_char32(basePointer) \
@@ -1963,9 +3401,21 @@ _SI32_SARADC_A_read_char32(SI32_SARADC_A_Type* /*basePointer*/);
 ///  char10
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_write_char10(
+   SI32_SARADC_A_Type * basePointer,
+   uint32_t char10)
+{
+   //{{
+   basePointer->CHAR10.U32 = char10;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_write_char10(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t /*char10*/);
+#endif
 ///
 /// @def SI32_SARADC_A_write_char10(basePointer, char10)
 #define SI32_SARADC_A_write_char10(basePointer, char10) \
@@ -1980,8 +3430,19 @@ _SI32_SARADC_A_write_char10(SI32_SARADC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_SARADC_A_read_char10(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CHAR10.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_SARADC_A_read_char10(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_read_char10(basePointer)
 #define SI32_SARADC_A_read_char10(basePointer) \
@@ -2003,9 +3464,39 @@ _SI32_SARADC_A_read_char10(SI32_SARADC_A_Type* /*basePointer*/);
 ///  Valid range is 0 to 3.
 ///  Channel characteristic group number (0 to 3).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_channel_character_group_gain_one(
+   SI32_SARADC_A_Type * basePointer,
+   // Channel characteristic group number (0 to 3).
+   uint32_t ch_char_group_num)
+{
+   assert(ch_char_group_num <= 3);
+   //{{
+   switch (ch_char_group_num)
+   {
+      case 0:
+       basePointer->CHAR10_CLR = SI32_SARADC_A_CHAR10_CHR0GN_MASK;
+       break;
+    case 1:
+       basePointer->CHAR10_CLR = SI32_SARADC_A_CHAR10_CHR1GN_MASK;
+       break;
+    case 2:
+       basePointer->CHAR32_CLR = SI32_SARADC_A_CHAR32_CHR2GN_MASK;
+       break;
+    case 3:
+       basePointer->CHAR32_CLR = SI32_SARADC_A_CHAR32_CHR3GN_MASK;
+       break;
+    default:
+       break;
+   }
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_channel_character_group_gain_one(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t /*ch_char_group_num*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_channel_character_group_gain_one(basePointer, ch_char_group_num)
 #define SI32_SARADC_A_select_channel_character_group_gain_one(basePointer, ch_char_group_num) \
@@ -2017,8 +3508,19 @@ _SI32_SARADC_A_select_channel_character_group_gain_one(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_channel_characteristic0_gain_one(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CHAR10_CLR = SI32_SARADC_A_CHAR10_CHR0GN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_channel_characteristic0_gain_one(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_channel_characteristic0_gain_one(basePointer)
 #define SI32_SARADC_A_select_channel_characteristic0_gain_one(basePointer) \
@@ -2030,8 +3532,19 @@ _SI32_SARADC_A_select_channel_characteristic0_gain_one(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_channel_characteristic1_gain_one(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CHAR10_CLR = SI32_SARADC_A_CHAR10_CHR1GN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_channel_characteristic1_gain_one(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_channel_characteristic1_gain_one(basePointer)
 #define SI32_SARADC_A_select_channel_characteristic1_gain_one(basePointer) \
@@ -2043,8 +3556,19 @@ _SI32_SARADC_A_select_channel_characteristic1_gain_one(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_channel_characteristic2_gain_one(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CHAR32_CLR = SI32_SARADC_A_CHAR32_CHR2GN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_channel_characteristic2_gain_one(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_channel_characteristic2_gain_one(basePointer)
 #define SI32_SARADC_A_select_channel_characteristic2_gain_one(basePointer) \
@@ -2056,8 +3580,19 @@ _SI32_SARADC_A_select_channel_characteristic2_gain_one(SI32_SARADC_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_channel_characteristic3_gain_one(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CHAR32_CLR = SI32_SARADC_A_CHAR32_CHR3GN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_channel_characteristic3_gain_one(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_channel_characteristic3_gain_one(basePointer)
 #define SI32_SARADC_A_select_channel_characteristic3_gain_one(basePointer) \
@@ -2079,9 +3614,39 @@ _SI32_SARADC_A_select_channel_characteristic3_gain_one(SI32_SARADC_A_Type* /*bas
 ///  Valid range is 0 to 3.
 ///  Channel characteristic group number (0 to 3).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_channel_character_group_gain_half(
+   SI32_SARADC_A_Type * basePointer,
+   // Channel characteristic group number (0 to 3).
+   uint32_t ch_char_group_num)
+{
+   assert(ch_char_group_num <= 3);
+   //{{
+   switch (ch_char_group_num)
+   {
+      case 0:
+       basePointer->CHAR10_SET = SI32_SARADC_A_CHAR10_CHR0GN_MASK;
+       break;
+    case 1:
+       basePointer->CHAR10_SET = SI32_SARADC_A_CHAR10_CHR1GN_MASK;
+       break;
+    case 2:
+       basePointer->CHAR32_SET = SI32_SARADC_A_CHAR32_CHR2GN_MASK;
+       break;
+    case 3:
+       basePointer->CHAR32_SET = SI32_SARADC_A_CHAR32_CHR3GN_MASK;
+       break;
+    default:
+       break;
+   }
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_channel_character_group_gain_half(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t /*ch_char_group_num*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_channel_character_group_gain_half(basePointer, ch_char_group_num)
 #define SI32_SARADC_A_select_channel_character_group_gain_half(basePointer, ch_char_group_num) \
@@ -2093,8 +3658,19 @@ _SI32_SARADC_A_select_channel_character_group_gain_half(SI32_SARADC_A_Type* /*ba
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_channel_characteristic0_gain_half(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CHAR10_SET = SI32_SARADC_A_CHAR10_CHR0GN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_channel_characteristic0_gain_half(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_channel_characteristic0_gain_half(basePointer)
 #define SI32_SARADC_A_select_channel_characteristic0_gain_half(basePointer) \
@@ -2106,8 +3682,19 @@ _SI32_SARADC_A_select_channel_characteristic0_gain_half(SI32_SARADC_A_Type* /*ba
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_channel_characteristic1_gain_half(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CHAR10_SET = SI32_SARADC_A_CHAR10_CHR1GN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_channel_characteristic1_gain_half(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_channel_characteristic1_gain_half(basePointer)
 #define SI32_SARADC_A_select_channel_characteristic1_gain_half(basePointer) \
@@ -2119,8 +3706,19 @@ _SI32_SARADC_A_select_channel_characteristic1_gain_half(SI32_SARADC_A_Type* /*ba
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_channel_characteristic2_gain_half(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CHAR32_SET = SI32_SARADC_A_CHAR32_CHR2GN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_channel_characteristic2_gain_half(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_channel_characteristic2_gain_half(basePointer)
 #define SI32_SARADC_A_select_channel_characteristic2_gain_half(basePointer) \
@@ -2132,8 +3730,19 @@ _SI32_SARADC_A_select_channel_characteristic2_gain_half(SI32_SARADC_A_Type* /*ba
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_channel_characteristic3_gain_half(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CHAR32_SET = SI32_SARADC_A_CHAR32_CHR3GN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_channel_characteristic3_gain_half(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_channel_characteristic3_gain_half(basePointer)
 #define SI32_SARADC_A_select_channel_characteristic3_gain_half(basePointer) \
@@ -2162,10 +3771,48 @@ _SI32_SARADC_A_select_channel_characteristic3_gain_half(SI32_SARADC_A_Type* /*ba
 ///  Number of samples to accumulate: 0=1 sample, 1=4 samples, 2=8 samples,
 ///  3=16 samples, 4=32 samples, 5=64 samples.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_burst_mode_repeat_count(
+   SI32_SARADC_A_Type * basePointer,
+   // Channel characteristic group number (0 to 3).
+   uint32_t ch_char_group_num,
+   // Number of samples to accumulate: 0=1 sample, 1=4 samples, 2=8 samples,
+   // 3=16 samples, 4=32 samples, 5=64 samples.
+   SI32_SARADC_A_BURST_MODE_REPEAT_COUNT_Enum_Type repeat_count)
+{
+   assert(ch_char_group_num <= 3);
+   assert(repeat_count <= 5);
+   //{{
+   switch (ch_char_group_num)
+   {
+      case 0:
+         basePointer->CHAR10_CLR = SI32_SARADC_A_CHAR10_CHR0RPT_MASK;
+      basePointer->CHAR10_SET = repeat_count << SI32_SARADC_A_CHAR10_CHR0RPT_SHIFT;
+       break;
+    case 1:
+         basePointer->CHAR10_CLR = SI32_SARADC_A_CHAR10_CHR1RPT_MASK;
+      basePointer->CHAR10_SET = repeat_count << SI32_SARADC_A_CHAR10_CHR1RPT_SHIFT;
+       break;
+    case 2:
+         basePointer->CHAR32_CLR = SI32_SARADC_A_CHAR32_CHR2RPT_MASK;
+      basePointer->CHAR32_SET = repeat_count << SI32_SARADC_A_CHAR32_CHR2RPT_SHIFT;
+       break;
+    case 3:
+         basePointer->CHAR32_CLR = SI32_SARADC_A_CHAR32_CHR3RPT_MASK;
+      basePointer->CHAR32_SET = repeat_count << SI32_SARADC_A_CHAR32_CHR3RPT_SHIFT;
+       break;
+    default:
+       break;
+   }
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_burst_mode_repeat_count(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t, /*ch_char_group_num*/
    SI32_SARADC_A_BURST_MODE_REPEAT_COUNT_Enum_Type /*repeat_count*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_burst_mode_repeat_count(basePointer, ch_char_group_num, repeat_count)
 #define SI32_SARADC_A_select_burst_mode_repeat_count(basePointer, ch_char_group_num, repeat_count) \
@@ -2184,9 +3831,25 @@ _SI32_SARADC_A_select_burst_mode_repeat_count(SI32_SARADC_A_Type* /*basePointer*
 ///  Number of samples to accumulate: 0=1 sample, 1=4 samples, 2=8 samples,
 ///  3=16 samples, 4=32 samples, 5=64 samples.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_channel_characteristic0_burst_mode_repeat_count(
+   SI32_SARADC_A_Type * basePointer,
+   // Number of samples to accumulate: 0=1 sample, 1=4 samples, 2=8 samples,
+   // 3=16 samples, 4=32 samples, 5=64 samples.
+   SI32_SARADC_A_BURST_MODE_REPEAT_COUNT_Enum_Type repeat_count)
+{
+   assert(repeat_count <= 5);
+   //{{
+   basePointer->CHAR10_CLR = SI32_SARADC_A_CHAR10_CHR0RPT_MASK;
+   basePointer->CHAR10_SET = repeat_count << SI32_SARADC_A_CHAR10_CHR0RPT_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_channel_characteristic0_burst_mode_repeat_count(SI32_SARADC_A_Type* /*basePointer*/,
    SI32_SARADC_A_BURST_MODE_REPEAT_COUNT_Enum_Type /*repeat_count*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_channel_characteristic0_burst_mode_repeat_count(basePointer, repeat_count)
 #define SI32_SARADC_A_select_channel_characteristic0_burst_mode_repeat_count(basePointer, repeat_count) do{  \
@@ -2207,9 +3870,25 @@ _SI32_SARADC_A_select_channel_characteristic0_burst_mode_repeat_count(SI32_SARAD
 ///  Number of samples to accumulate: 0=1 sample, 1=4 samples, 2=8 samples,
 ///  3=16 samples, 4=32 samples, 5=64 samples.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_channel_characteristic1_burst_mode_repeat_count(
+   SI32_SARADC_A_Type * basePointer,
+   // Number of samples to accumulate: 0=1 sample, 1=4 samples, 2=8 samples,
+   // 3=16 samples, 4=32 samples, 5=64 samples.
+   SI32_SARADC_A_BURST_MODE_REPEAT_COUNT_Enum_Type repeat_count)
+{
+   assert(repeat_count <= 5);
+   //{{
+   basePointer->CHAR10_CLR = SI32_SARADC_A_CHAR10_CHR1RPT_MASK;
+   basePointer->CHAR10_SET = repeat_count << SI32_SARADC_A_CHAR10_CHR1RPT_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_channel_characteristic1_burst_mode_repeat_count(SI32_SARADC_A_Type* /*basePointer*/,
    SI32_SARADC_A_BURST_MODE_REPEAT_COUNT_Enum_Type /*repeat_count*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_channel_characteristic1_burst_mode_repeat_count(basePointer, repeat_count)
 #define SI32_SARADC_A_select_channel_characteristic1_burst_mode_repeat_count(basePointer, repeat_count) do{  \
@@ -2230,9 +3909,25 @@ _SI32_SARADC_A_select_channel_characteristic1_burst_mode_repeat_count(SI32_SARAD
 ///  Number of samples to accumulate: 0=1 sample, 1=4 samples, 2=8 samples,
 ///  3=16 samples, 4=32 samples, 5=64 samples.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_channel_characteristic2_burst_mode_repeat_count(
+   SI32_SARADC_A_Type * basePointer,
+   // Number of samples to accumulate: 0=1 sample, 1=4 samples, 2=8 samples,
+   // 3=16 samples, 4=32 samples, 5=64 samples.
+   SI32_SARADC_A_BURST_MODE_REPEAT_COUNT_Enum_Type repeat_count)
+{
+   assert(repeat_count <= 5);
+   //{{
+   basePointer->CHAR32_CLR = SI32_SARADC_A_CHAR32_CHR2RPT_MASK;
+   basePointer->CHAR32_SET = repeat_count << SI32_SARADC_A_CHAR32_CHR2RPT_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_channel_characteristic2_burst_mode_repeat_count(SI32_SARADC_A_Type* /*basePointer*/,
    SI32_SARADC_A_BURST_MODE_REPEAT_COUNT_Enum_Type /*repeat_count*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_channel_characteristic2_burst_mode_repeat_count(basePointer, repeat_count)
 #define SI32_SARADC_A_select_channel_characteristic2_burst_mode_repeat_count(basePointer, repeat_count) do{  \
@@ -2253,9 +3948,25 @@ _SI32_SARADC_A_select_channel_characteristic2_burst_mode_repeat_count(SI32_SARAD
 ///  Number of samples to accumulate: 0=1 sample, 1=4 samples, 2=8 samples,
 ///  3=16 samples, 4=32 samples, 5=64 samples.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_channel_characteristic3_burst_mode_repeat_count(
+   SI32_SARADC_A_Type * basePointer,
+   // Number of samples to accumulate: 0=1 sample, 1=4 samples, 2=8 samples,
+   // 3=16 samples, 4=32 samples, 5=64 samples.
+   SI32_SARADC_A_BURST_MODE_REPEAT_COUNT_Enum_Type repeat_count)
+{
+   assert(repeat_count <= 5);
+   //{{
+   basePointer->CHAR32_CLR = SI32_SARADC_A_CHAR32_CHR3RPT_MASK;
+   basePointer->CHAR32_SET = repeat_count << SI32_SARADC_A_CHAR32_CHR3RPT_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_channel_characteristic3_burst_mode_repeat_count(SI32_SARADC_A_Type* /*basePointer*/,
    SI32_SARADC_A_BURST_MODE_REPEAT_COUNT_Enum_Type /*repeat_count*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_channel_characteristic3_burst_mode_repeat_count(basePointer, repeat_count)
 #define SI32_SARADC_A_select_channel_characteristic3_burst_mode_repeat_count(basePointer, repeat_count) do{  \
@@ -2285,10 +3996,46 @@ _SI32_SARADC_A_select_channel_characteristic3_burst_mode_repeat_count(SI32_SARAD
 ///  Valid range is 0 to 7.
 ///  Number of left shift bits (0 to 7).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_number_of_left_shift_bits(
+   SI32_SARADC_A_Type * basePointer,
+   // Channel characteristic group number (0 to 3).
+   uint32_t ch_char_group_num,
+   // Number of left shift bits (0 to 7).
+   uint32_t num_left_shift_bits)
+{
+   assert(ch_char_group_num <= 3);
+   assert(num_left_shift_bits <= 7);
+   //{{
+   switch (ch_char_group_num)
+   {
+      case 0:
+         basePointer->CHAR10_CLR = SI32_SARADC_A_CHAR10_CHR0LS_MASK;
+      basePointer->CHAR10_SET = num_left_shift_bits << SI32_SARADC_A_CHAR10_CHR0LS_SHIFT;
+       break;
+    case 1:
+         basePointer->CHAR10_CLR = SI32_SARADC_A_CHAR10_CHR1LS_MASK;
+      basePointer->CHAR10_SET = num_left_shift_bits << SI32_SARADC_A_CHAR10_CHR1LS_SHIFT;
+       break;
+    case 2:
+         basePointer->CHAR32_CLR = SI32_SARADC_A_CHAR32_CHR2LS_MASK;
+      basePointer->CHAR32_SET = num_left_shift_bits << SI32_SARADC_A_CHAR32_CHR2LS_SHIFT;      break;
+    case 3:
+         basePointer->CHAR32_CLR = SI32_SARADC_A_CHAR32_CHR3LS_MASK;
+      basePointer->CHAR32_SET = num_left_shift_bits << SI32_SARADC_A_CHAR32_CHR3LS_SHIFT;
+       break;
+    default:
+       break;
+   }
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_number_of_left_shift_bits(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t, /*ch_char_group_num*/
    uint32_t /*num_left_shift_bits*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_number_of_left_shift_bits(basePointer, ch_char_group_num, num_left_shift_bits)
 #define SI32_SARADC_A_select_number_of_left_shift_bits(basePointer, ch_char_group_num, num_left_shift_bits) \
@@ -2306,9 +4053,24 @@ _SI32_SARADC_A_select_number_of_left_shift_bits(SI32_SARADC_A_Type* /*basePointe
 ///  Valid range is 0 to 7.
 ///  Number of left shift bits (0 to 7).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_channel_characteristic0_left_shift_bits(
+   SI32_SARADC_A_Type * basePointer,
+   // Number of left shift bits (0 to 7).
+   uint32_t num_left_shift_bits)
+{
+   assert(num_left_shift_bits <= 7);
+   //{{
+   basePointer->CHAR10_CLR = SI32_SARADC_A_CHAR10_CHR0LS_MASK;
+   basePointer->CHAR10_SET = num_left_shift_bits << SI32_SARADC_A_CHAR10_CHR0LS_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_channel_characteristic0_left_shift_bits(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t /*num_left_shift_bits*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_channel_characteristic0_left_shift_bits(basePointer, num_left_shift_bits)
 #define SI32_SARADC_A_select_channel_characteristic0_left_shift_bits(basePointer, num_left_shift_bits) \
@@ -2326,9 +4088,24 @@ _SI32_SARADC_A_select_channel_characteristic0_left_shift_bits(SI32_SARADC_A_Type
 ///  Valid range is 0 to 7.
 ///  Number of left shift bits (0 to 7).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_channel_characteristic1_left_shift_bits(
+   SI32_SARADC_A_Type * basePointer,
+   // Number of left shift bits (0 to 7).
+   uint32_t num_left_shift_bits)
+{
+   assert(num_left_shift_bits <= 7);
+   //{{
+   basePointer->CHAR10_CLR = SI32_SARADC_A_CHAR10_CHR1LS_MASK;
+   basePointer->CHAR10_SET = num_left_shift_bits << SI32_SARADC_A_CHAR10_CHR1LS_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_channel_characteristic1_left_shift_bits(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t /*num_left_shift_bits*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_channel_characteristic1_left_shift_bits(basePointer, num_left_shift_bits)
 #define SI32_SARADC_A_select_channel_characteristic1_left_shift_bits(basePointer, num_left_shift_bits) \
@@ -2346,9 +4123,24 @@ _SI32_SARADC_A_select_channel_characteristic1_left_shift_bits(SI32_SARADC_A_Type
 ///  Valid range is 0 to 7.
 ///  Number of left shift bits (0 to 7).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_channel_characteristic2_left_shift_bits(
+   SI32_SARADC_A_Type * basePointer,
+   // Number of left shift bits (0 to 7).
+   uint32_t num_left_shift_bits)
+{
+   assert(num_left_shift_bits <= 7);
+   //{{
+   basePointer->CHAR32_CLR = SI32_SARADC_A_CHAR32_CHR2LS_MASK;
+   basePointer->CHAR32_SET = num_left_shift_bits << SI32_SARADC_A_CHAR32_CHR2LS_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_channel_characteristic2_left_shift_bits(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t /*num_left_shift_bits*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_channel_characteristic2_left_shift_bits(basePointer, num_left_shift_bits)
 #define SI32_SARADC_A_select_channel_characteristic2_left_shift_bits(basePointer, num_left_shift_bits) \
@@ -2366,9 +4158,24 @@ _SI32_SARADC_A_select_channel_characteristic2_left_shift_bits(SI32_SARADC_A_Type
 ///  Valid range is 0 to 7.
 ///  Number of left shift bits (0 to 7).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_channel_characteristic3_left_shift_bits(
+   SI32_SARADC_A_Type * basePointer,
+   // Number of left shift bits (0 to 7).
+   uint32_t num_left_shift_bits)
+{
+   assert(num_left_shift_bits <= 7);
+   //{{
+   basePointer->CHAR32_CLR = SI32_SARADC_A_CHAR32_CHR3LS_MASK;
+   basePointer->CHAR32_SET = num_left_shift_bits << SI32_SARADC_A_CHAR32_CHR3LS_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_channel_characteristic3_left_shift_bits(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t /*num_left_shift_bits*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_channel_characteristic3_left_shift_bits(basePointer, num_left_shift_bits)
 #define SI32_SARADC_A_select_channel_characteristic3_left_shift_bits(basePointer, num_left_shift_bits) \
@@ -2390,9 +4197,39 @@ _SI32_SARADC_A_select_channel_characteristic3_left_shift_bits(SI32_SARADC_A_Type
 ///  Valid range is 0 to 3.
 ///  Channel characteristic group number (0 to 3).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_enter_12bit_mode(
+   SI32_SARADC_A_Type * basePointer,
+   // Channel characteristic group number (0 to 3).
+   uint32_t ch_char_group_num)
+{
+   assert(ch_char_group_num <= 3);
+   //{{
+   switch (ch_char_group_num)
+   {
+      case 0:
+       basePointer->CHAR10_SET = SI32_SARADC_A_CHAR10_CHR0RSEL_MASK;
+       break;
+    case 1:
+       basePointer->CHAR10_SET = SI32_SARADC_A_CHAR10_CHR1RSEL_MASK;
+       break;
+    case 2:
+       basePointer->CHAR32_SET = SI32_SARADC_A_CHAR32_CHR2RSEL_MASK;
+       break;
+    case 3:
+       basePointer->CHAR32_SET = SI32_SARADC_A_CHAR32_CHR3RSEL_MASK;
+       break;
+    default:
+       break;
+   }
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_enter_12bit_mode(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t /*ch_char_group_num*/);
+#endif
 ///
 /// @def SI32_SARADC_A_enter_12bit_mode(basePointer, ch_char_group_num)
 #define SI32_SARADC_A_enter_12bit_mode(basePointer, ch_char_group_num) \
@@ -2404,8 +4241,19 @@ _SI32_SARADC_A_enter_12bit_mode(SI32_SARADC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_channel_characteristic0_12bit_mode(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CHAR10_SET = SI32_SARADC_A_CHAR10_CHR0RSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_channel_characteristic0_12bit_mode(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_channel_characteristic0_12bit_mode(basePointer)
 #define SI32_SARADC_A_select_channel_characteristic0_12bit_mode(basePointer) \
@@ -2417,8 +4265,19 @@ _SI32_SARADC_A_select_channel_characteristic0_12bit_mode(SI32_SARADC_A_Type* /*b
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_channel_characteristic1_12bit_mode(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CHAR10_SET = SI32_SARADC_A_CHAR10_CHR1RSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_channel_characteristic1_12bit_mode(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_channel_characteristic1_12bit_mode(basePointer)
 #define SI32_SARADC_A_select_channel_characteristic1_12bit_mode(basePointer) \
@@ -2430,8 +4289,19 @@ _SI32_SARADC_A_select_channel_characteristic1_12bit_mode(SI32_SARADC_A_Type* /*b
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_channel_characteristic2_12bit_mode(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CHAR32_SET = SI32_SARADC_A_CHAR32_CHR2RSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_channel_characteristic2_12bit_mode(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_channel_characteristic2_12bit_mode(basePointer)
 #define SI32_SARADC_A_select_channel_characteristic2_12bit_mode(basePointer) \
@@ -2443,8 +4313,19 @@ _SI32_SARADC_A_select_channel_characteristic2_12bit_mode(SI32_SARADC_A_Type* /*b
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_channel_characteristic3_12bit_mode(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CHAR32_SET = SI32_SARADC_A_CHAR32_CHR3RSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_channel_characteristic3_12bit_mode(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_channel_characteristic3_12bit_mode(basePointer)
 #define SI32_SARADC_A_select_channel_characteristic3_12bit_mode(basePointer) \
@@ -2466,9 +4347,39 @@ _SI32_SARADC_A_select_channel_characteristic3_12bit_mode(SI32_SARADC_A_Type* /*b
 ///  Valid range is 0 to 3.
 ///  Channel characteristic group number (0 to 3).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_enter_10bit_mode(
+   SI32_SARADC_A_Type * basePointer,
+   // Channel characteristic group number (0 to 3).
+   uint32_t ch_char_group_num)
+{
+   assert(ch_char_group_num <= 3);
+   //{{
+   switch (ch_char_group_num)
+   {
+      case 0:
+       basePointer->CHAR10_CLR = SI32_SARADC_A_CHAR10_CHR0RSEL_MASK;
+       break;
+    case 1:
+       basePointer->CHAR10_CLR = SI32_SARADC_A_CHAR10_CHR1RSEL_MASK;
+       break;
+    case 2:
+       basePointer->CHAR32_CLR = SI32_SARADC_A_CHAR32_CHR2RSEL_MASK;
+       break;
+    case 3:
+       basePointer->CHAR32_CLR = SI32_SARADC_A_CHAR32_CHR3RSEL_MASK;
+       break;
+    default:
+       break;
+   }
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_enter_10bit_mode(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t /*ch_char_group_num*/);
+#endif
 ///
 /// @def SI32_SARADC_A_enter_10bit_mode(basePointer, ch_char_group_num)
 #define SI32_SARADC_A_enter_10bit_mode(basePointer, ch_char_group_num) \
@@ -2480,8 +4391,19 @@ _SI32_SARADC_A_enter_10bit_mode(SI32_SARADC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_channel_characteristic0_10bit_mode(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CHAR10_CLR = SI32_SARADC_A_CHAR10_CHR0RSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_channel_characteristic0_10bit_mode(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_channel_characteristic0_10bit_mode(basePointer)
 #define SI32_SARADC_A_select_channel_characteristic0_10bit_mode(basePointer) \
@@ -2493,8 +4415,19 @@ _SI32_SARADC_A_select_channel_characteristic0_10bit_mode(SI32_SARADC_A_Type* /*b
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_channel_characteristic1_10bit_mode(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CHAR10_CLR = SI32_SARADC_A_CHAR10_CHR1RSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_channel_characteristic1_10bit_mode(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_channel_characteristic1_10bit_mode(basePointer)
 #define SI32_SARADC_A_select_channel_characteristic1_10bit_mode(basePointer) \
@@ -2506,8 +4439,19 @@ _SI32_SARADC_A_select_channel_characteristic1_10bit_mode(SI32_SARADC_A_Type* /*b
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_channel_characteristic2_10bit_mode(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CHAR32_CLR = SI32_SARADC_A_CHAR32_CHR2RSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_channel_characteristic2_10bit_mode(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_channel_characteristic2_10bit_mode(basePointer)
 #define SI32_SARADC_A_select_channel_characteristic2_10bit_mode(basePointer) \
@@ -2519,8 +4463,19 @@ _SI32_SARADC_A_select_channel_characteristic2_10bit_mode(SI32_SARADC_A_Type* /*b
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_channel_characteristic3_10bit_mode(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CHAR32_CLR = SI32_SARADC_A_CHAR32_CHR3RSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_channel_characteristic3_10bit_mode(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_channel_characteristic3_10bit_mode(basePointer)
 #define SI32_SARADC_A_select_channel_characteristic3_10bit_mode(basePointer) \
@@ -2542,9 +4497,39 @@ _SI32_SARADC_A_select_channel_characteristic3_10bit_mode(SI32_SARADC_A_Type* /*b
 ///  Valid range is 0 to 3.
 ///  Channel characteristic group number (0 to 3).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_enable_window_comparison_interrupt(
+   SI32_SARADC_A_Type * basePointer,
+   // Channel characteristic group number (0 to 3).
+   uint32_t ch_char_group_num)
+{
+   assert(ch_char_group_num <= 3);
+   //{{
+   switch (ch_char_group_num)
+   {
+      case 0:
+       basePointer->CHAR10_SET = SI32_SARADC_A_CHAR10_CHR0WCIEN_MASK;
+       break;
+    case 1:
+       basePointer->CHAR10_SET = SI32_SARADC_A_CHAR10_CHR1WCIEN_MASK;
+       break;
+    case 2:
+       basePointer->CHAR32_SET = SI32_SARADC_A_CHAR32_CHR2WCIEN_MASK;
+       break;
+    case 3:
+       basePointer->CHAR32_SET = SI32_SARADC_A_CHAR32_CHR3WCIEN_MASK;
+       break;
+    default:
+       break;
+   }
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_enable_window_comparison_interrupt(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t /*ch_char_group_num*/);
+#endif
 ///
 /// @def SI32_SARADC_A_enable_window_comparison_interrupt(basePointer, ch_char_group_num)
 #define SI32_SARADC_A_enable_window_comparison_interrupt(basePointer, ch_char_group_num) \
@@ -2556,8 +4541,19 @@ _SI32_SARADC_A_enable_window_comparison_interrupt(SI32_SARADC_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_enable_characteristic0_window_comparison_interrupt(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CHAR10_SET = SI32_SARADC_A_CHAR10_CHR0WCIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_enable_characteristic0_window_comparison_interrupt(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_enable_characteristic0_window_comparison_interrupt(basePointer)
 #define SI32_SARADC_A_enable_characteristic0_window_comparison_interrupt(basePointer) \
@@ -2569,8 +4565,19 @@ _SI32_SARADC_A_enable_characteristic0_window_comparison_interrupt(SI32_SARADC_A_
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_enable_characteristic1_window_comparison_interrupt(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CHAR10_SET = SI32_SARADC_A_CHAR10_CHR1WCIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_enable_characteristic1_window_comparison_interrupt(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_enable_characteristic1_window_comparison_interrupt(basePointer)
 #define SI32_SARADC_A_enable_characteristic1_window_comparison_interrupt(basePointer) \
@@ -2582,8 +4589,19 @@ _SI32_SARADC_A_enable_characteristic1_window_comparison_interrupt(SI32_SARADC_A_
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_enable_characteristic2_window_comparison_interrupt(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CHAR32_SET = SI32_SARADC_A_CHAR32_CHR2WCIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_enable_characteristic2_window_comparison_interrupt(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_enable_characteristic2_window_comparison_interrupt(basePointer)
 #define SI32_SARADC_A_enable_characteristic2_window_comparison_interrupt(basePointer) \
@@ -2595,8 +4613,19 @@ _SI32_SARADC_A_enable_characteristic2_window_comparison_interrupt(SI32_SARADC_A_
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_enable_characteristic3_window_comparison_interrupt(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CHAR32_SET = SI32_SARADC_A_CHAR32_CHR3WCIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_enable_characteristic3_window_comparison_interrupt(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_enable_characteristic3_window_comparison_interrupt(basePointer)
 #define SI32_SARADC_A_enable_characteristic3_window_comparison_interrupt(basePointer) \
@@ -2618,9 +4647,39 @@ _SI32_SARADC_A_enable_characteristic3_window_comparison_interrupt(SI32_SARADC_A_
 ///  Valid range is 0 to 3.
 ///  Channel characteristic group number (0 to 3).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_disable_window_comparison_interrupt(
+   SI32_SARADC_A_Type * basePointer,
+   // Channel characteristic group number (0 to 3).
+   uint32_t ch_char_group_num)
+{
+   assert(ch_char_group_num <= 3);
+   //{{
+   switch (ch_char_group_num)
+   {
+      case 0:
+       basePointer->CHAR10_CLR = SI32_SARADC_A_CHAR10_CHR0WCIEN_MASK;
+       break;
+    case 1:
+       basePointer->CHAR10_CLR = SI32_SARADC_A_CHAR10_CHR1WCIEN_MASK;
+       break;
+    case 2:
+       basePointer->CHAR32_CLR = SI32_SARADC_A_CHAR32_CHR2WCIEN_MASK;
+       break;
+    case 3:
+       basePointer->CHAR32_CLR = SI32_SARADC_A_CHAR32_CHR3WCIEN_MASK;
+       break;
+    default:
+       break;
+   }
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_disable_window_comparison_interrupt(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t /*ch_char_group_num*/);
+#endif
 ///
 /// @def SI32_SARADC_A_disable_window_comparison_interrupt(basePointer, ch_char_group_num)
 #define SI32_SARADC_A_disable_window_comparison_interrupt(basePointer, ch_char_group_num) \
@@ -2632,8 +4691,19 @@ _SI32_SARADC_A_disable_window_comparison_interrupt(SI32_SARADC_A_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_disable_characteristic0_window_comparison_interrupt(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CHAR10_CLR = SI32_SARADC_A_CHAR10_CHR0WCIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_disable_characteristic0_window_comparison_interrupt(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_disable_characteristic0_window_comparison_interrupt(basePointer)
 #define SI32_SARADC_A_disable_characteristic0_window_comparison_interrupt(basePointer) \
@@ -2645,8 +4715,19 @@ _SI32_SARADC_A_disable_characteristic0_window_comparison_interrupt(SI32_SARADC_A
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_disable_characteristic1_window_comparison_interrupt(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CHAR10_CLR = SI32_SARADC_A_CHAR10_CHR1WCIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_disable_characteristic1_window_comparison_interrupt(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_disable_characteristic1_window_comparison_interrupt(basePointer)
 #define SI32_SARADC_A_disable_characteristic1_window_comparison_interrupt(basePointer) \
@@ -2658,8 +4739,19 @@ _SI32_SARADC_A_disable_characteristic1_window_comparison_interrupt(SI32_SARADC_A
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_disable_characteristic2_window_comparison_interrupt(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CHAR32_CLR = SI32_SARADC_A_CHAR32_CHR2WCIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_disable_characteristic2_window_comparison_interrupt(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_disable_characteristic2_window_comparison_interrupt(basePointer)
 #define SI32_SARADC_A_disable_characteristic2_window_comparison_interrupt(basePointer) \
@@ -2671,8 +4763,19 @@ _SI32_SARADC_A_disable_characteristic2_window_comparison_interrupt(SI32_SARADC_A
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_disable_characteristic3_window_comparison_interrupt(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CHAR32_CLR = SI32_SARADC_A_CHAR32_CHR3WCIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_disable_characteristic3_window_comparison_interrupt(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_disable_characteristic3_window_comparison_interrupt(basePointer)
 #define SI32_SARADC_A_disable_characteristic3_window_comparison_interrupt(basePointer) \
@@ -2684,8 +4787,19 @@ _SI32_SARADC_A_disable_characteristic3_window_comparison_interrupt(SI32_SARADC_A
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SARADC_A_is_characteristic0_window_comparison_interrupt_enabled(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CHAR10.CHR0WCIEN);
+   //}}
+}
+#else
 bool
 _SI32_SARADC_A_is_characteristic0_window_comparison_interrupt_enabled(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_is_characteristic0_window_comparison_interrupt_enabled(basePointer)
 #define SI32_SARADC_A_is_characteristic0_window_comparison_interrupt_enabled(basePointer) \
@@ -2697,8 +4811,19 @@ _SI32_SARADC_A_is_characteristic0_window_comparison_interrupt_enabled(SI32_SARAD
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SARADC_A_is_characteristic1_window_comparison_interrupt_enabled(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CHAR10.CHR1WCIEN);
+   //}}
+}
+#else
 bool
 _SI32_SARADC_A_is_characteristic1_window_comparison_interrupt_enabled(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_is_characteristic1_window_comparison_interrupt_enabled(basePointer)
 #define SI32_SARADC_A_is_characteristic1_window_comparison_interrupt_enabled(basePointer) \
@@ -2710,8 +4835,19 @@ _SI32_SARADC_A_is_characteristic1_window_comparison_interrupt_enabled(SI32_SARAD
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SARADC_A_is_characteristic2_window_comparison_interrupt_enabled(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CHAR32.CHR2WCIEN);
+   //}}
+}
+#else
 bool
 _SI32_SARADC_A_is_characteristic2_window_comparison_interrupt_enabled(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_is_characteristic2_window_comparison_interrupt_enabled(basePointer)
 #define SI32_SARADC_A_is_characteristic2_window_comparison_interrupt_enabled(basePointer) \
@@ -2723,8 +4859,19 @@ _SI32_SARADC_A_is_characteristic2_window_comparison_interrupt_enabled(SI32_SARAD
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SARADC_A_is_characteristic3_window_comparison_interrupt_enabled(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CHAR32.CHR3WCIEN);
+   //}}
+}
+#else
 bool
 _SI32_SARADC_A_is_characteristic3_window_comparison_interrupt_enabled(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_is_characteristic3_window_comparison_interrupt_enabled(basePointer)
 #define SI32_SARADC_A_is_characteristic3_window_comparison_interrupt_enabled(basePointer) \
@@ -2739,8 +4886,19 @@ _SI32_SARADC_A_is_characteristic3_window_comparison_interrupt_enabled(SI32_SARAD
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_SARADC_A_read_data(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DATA.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_SARADC_A_read_data(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_read_data(basePointer)
 #define SI32_SARADC_A_read_data(basePointer) \
@@ -2760,9 +4918,21 @@ _SI32_SARADC_A_read_data(SI32_SARADC_A_Type* /*basePointer*/);
 ///  wclimits
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_write_wclimits(
+   SI32_SARADC_A_Type * basePointer,
+   uint32_t wclimits)
+{
+   //{{
+   basePointer->WCLIMITS.U32 = wclimits;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_write_wclimits(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t /*wclimits*/);
+#endif
 ///
 /// @def SI32_SARADC_A_write_wclimits(basePointer, wclimits)
 #define SI32_SARADC_A_write_wclimits(basePointer, wclimits) \
@@ -2777,8 +4947,19 @@ _SI32_SARADC_A_write_wclimits(SI32_SARADC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_SARADC_A_read_wclimits(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->WCLIMITS.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_SARADC_A_read_wclimits(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_read_wclimits(basePointer)
 #define SI32_SARADC_A_read_wclimits(basePointer) \
@@ -2800,9 +4981,23 @@ _SI32_SARADC_A_read_wclimits(SI32_SARADC_A_Type* /*basePointer*/);
 ///  Valid range is 0 to 65535.
 ///  16-bit right-justified Greater-Than window compare value.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_greater_than_window_comparator_limit(
+   SI32_SARADC_A_Type * basePointer,
+   // 16-bit right-justified Greater-Than window compare value.
+   uint32_t adc_gt)
+{
+   assert(adc_gt <= 65535);
+   //{{
+   basePointer->WCLIMITS.WCGT = adc_gt;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_greater_than_window_comparator_limit(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t /*adc_gt*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_greater_than_window_comparator_limit(basePointer, adc_gt)
 #define SI32_SARADC_A_select_greater_than_window_comparator_limit(basePointer, adc_gt) \
@@ -2824,9 +5019,23 @@ _SI32_SARADC_A_select_greater_than_window_comparator_limit(SI32_SARADC_A_Type* /
 ///  Valid range is 0 to 65535.
 ///  16-bit right-justified Less-Than window compare value.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_less_than_window_comparator_limit(
+   SI32_SARADC_A_Type * basePointer,
+   // 16-bit right-justified Less-Than window compare value.
+   uint32_t adc_lt)
+{
+   assert(adc_lt <= 65535);
+   //{{
+   basePointer->WCLIMITS.WCLT = adc_lt;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_less_than_window_comparator_limit(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t /*adc_lt*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_less_than_window_comparator_limit(basePointer, adc_lt)
 #define SI32_SARADC_A_select_less_than_window_comparator_limit(basePointer, adc_lt) \
@@ -2861,11 +5070,42 @@ _SI32_SARADC_A_select_less_than_window_comparator_limit(SI32_SARADC_A_Type* /*ba
 ///  Returns TRUE if data is within the specified limits, returns FALSE if
 ///  the data is outside the specified limits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_select_window_limits(
+   SI32_SARADC_A_Type * basePointer,
+   // 16-bit right-justified window compare limit 0.
+   uint32_t adc_limit0,
+   // 16-bit right-justified window compare limit 1.
+   uint32_t adc_limit1,
+   // Returns TRUE if data is within the specified limits, returns FALSE if
+   // the data is outside the specified limits.
+   bool interrupt_in_window)
+{
+   assert(adc_limit0 <= 65535);
+   assert(adc_limit1 <= 65535);
+   //{{
+   if (interrupt_in_window == true)
+   {
+      // If ADLT < ADGT, interrupt occurs when data is in between the limits
+      basePointer->WCLIMITS.WCLT = (adc_limit0 < adc_limit1) ? adc_limit0 : adc_limit1;
+      basePointer->WCLIMITS.WCGT = (adc_limit0 < adc_limit1) ? adc_limit1 : adc_limit0;
+   }
+   else
+   {
+      // If ADLT > ADGT, interrupt occurs when data is outside the limits
+      basePointer->WCLIMITS.WCLT = (adc_limit0 > adc_limit1) ? adc_limit0 : adc_limit1;
+      basePointer->WCLIMITS.WCGT = (adc_limit0 > adc_limit1) ? adc_limit1 : adc_limit0;
+   }
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_select_window_limits(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t, /*adc_limit0*/
    uint32_t, /*adc_limit1*/
    bool /*interrupt_in_window*/);
+#endif
 ///
 /// @def SI32_SARADC_A_select_window_limits(basePointer, adc_limit0, adc_limit1, interrupt_in_window)
 #define SI32_SARADC_A_select_window_limits(basePointer, adc_limit0, adc_limit1, interrupt_in_window) \
@@ -2885,9 +5125,22 @@ _SI32_SARADC_A_select_window_limits(SI32_SARADC_A_Type* /*basePointer*/,
 ///  acc
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_write_acc(
+   SI32_SARADC_A_Type * basePointer,
+   uint32_t acc)
+{
+   assert(acc < 65536);   // acc < 2^16
+   //{{
+   basePointer->ACC.U32 = acc;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_write_acc(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t /*acc*/);
+#endif
 ///
 /// @def SI32_SARADC_A_write_acc(basePointer, acc)
 #define SI32_SARADC_A_write_acc(basePointer, acc) \
@@ -2902,8 +5155,19 @@ _SI32_SARADC_A_write_acc(SI32_SARADC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_clear_accumulator(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->ACC.U32 = 0;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_clear_accumulator(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_clear_accumulator(basePointer)
 #define SI32_SARADC_A_clear_accumulator(basePointer) \
@@ -2923,9 +5187,21 @@ _SI32_SARADC_A_clear_accumulator(SI32_SARADC_A_Type* /*basePointer*/);
 ///  status
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_write_status(
+   SI32_SARADC_A_Type * basePointer,
+   uint32_t status)
+{
+   //{{
+   basePointer->STATUS.U32 = status;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_write_status(SI32_SARADC_A_Type* /*basePointer*/,
    uint32_t /*status*/);
+#endif
 ///
 /// @def SI32_SARADC_A_write_status(basePointer, status)
 #define SI32_SARADC_A_write_status(basePointer, status) \
@@ -2940,8 +5216,19 @@ _SI32_SARADC_A_write_status(SI32_SARADC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_SARADC_A_read_status(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_SARADC_A_read_status(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_read_status(basePointer)
 #define SI32_SARADC_A_read_status(basePointer) \
@@ -2956,8 +5243,19 @@ _SI32_SARADC_A_read_status(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SARADC_A_is_window_compare_interrupt_pending(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->STATUS.WCI;
+   //}}
+}
+#else
 bool
 _SI32_SARADC_A_is_window_compare_interrupt_pending(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_is_window_compare_interrupt_pending(basePointer)
 #define SI32_SARADC_A_is_window_compare_interrupt_pending(basePointer) \
@@ -2972,8 +5270,19 @@ _SI32_SARADC_A_is_window_compare_interrupt_pending(SI32_SARADC_A_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_clear_window_compare_interrupt(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS_CLR = SI32_SARADC_A_STATUS_WCI_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_clear_window_compare_interrupt(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_clear_window_compare_interrupt(basePointer)
 #define SI32_SARADC_A_clear_window_compare_interrupt(basePointer) \
@@ -2988,8 +5297,19 @@ _SI32_SARADC_A_clear_window_compare_interrupt(SI32_SARADC_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SARADC_A_is_single_conversion_complete_interrupt_pending(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->STATUS.SCCI;
+   //}}
+}
+#else
 bool
 _SI32_SARADC_A_is_single_conversion_complete_interrupt_pending(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_is_single_conversion_complete_interrupt_pending(basePointer)
 #define SI32_SARADC_A_is_single_conversion_complete_interrupt_pending(basePointer) \
@@ -3004,8 +5324,19 @@ _SI32_SARADC_A_is_single_conversion_complete_interrupt_pending(SI32_SARADC_A_Typ
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_clear_single_conversion_complete_interrupt(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS_CLR = SI32_SARADC_A_STATUS_SCCI_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_clear_single_conversion_complete_interrupt(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_clear_single_conversion_complete_interrupt(basePointer)
 #define SI32_SARADC_A_clear_single_conversion_complete_interrupt(basePointer) \
@@ -3020,8 +5351,19 @@ _SI32_SARADC_A_clear_single_conversion_complete_interrupt(SI32_SARADC_A_Type* /*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SARADC_A_is_scan_done_interrupt_pending(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->STATUS.SDI;
+   //}}
+}
+#else
 bool
 _SI32_SARADC_A_is_scan_done_interrupt_pending(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_is_scan_done_interrupt_pending(basePointer)
 #define SI32_SARADC_A_is_scan_done_interrupt_pending(basePointer) \
@@ -3036,8 +5378,19 @@ _SI32_SARADC_A_is_scan_done_interrupt_pending(SI32_SARADC_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_clear_scan_done_interrupt(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS_CLR = SI32_SARADC_A_STATUS_SDI_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_clear_scan_done_interrupt(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_clear_scan_done_interrupt(basePointer)
 #define SI32_SARADC_A_clear_scan_done_interrupt(basePointer) \
@@ -3052,8 +5405,19 @@ _SI32_SARADC_A_clear_scan_done_interrupt(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SARADC_A_is_fifo_overrun_interrupt_pending(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->STATUS.FORI;
+   //}}
+}
+#else
 bool
 _SI32_SARADC_A_is_fifo_overrun_interrupt_pending(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_is_fifo_overrun_interrupt_pending(basePointer)
 #define SI32_SARADC_A_is_fifo_overrun_interrupt_pending(basePointer) \
@@ -3068,8 +5432,19 @@ _SI32_SARADC_A_is_fifo_overrun_interrupt_pending(SI32_SARADC_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_clear_fifo_overrun_interrupt(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS_CLR = SI32_SARADC_A_STATUS_FORI_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_clear_fifo_overrun_interrupt(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_clear_fifo_overrun_interrupt(basePointer)
 #define SI32_SARADC_A_clear_fifo_overrun_interrupt(basePointer) \
@@ -3084,8 +5459,19 @@ _SI32_SARADC_A_clear_fifo_overrun_interrupt(SI32_SARADC_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SARADC_A_is_fifo_underrun_interrupt_pending(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->STATUS.FURI;
+   //}}
+}
+#else
 bool
 _SI32_SARADC_A_is_fifo_underrun_interrupt_pending(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_is_fifo_underrun_interrupt_pending(basePointer)
 #define SI32_SARADC_A_is_fifo_underrun_interrupt_pending(basePointer) \
@@ -3100,8 +5486,19 @@ _SI32_SARADC_A_is_fifo_underrun_interrupt_pending(SI32_SARADC_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_clear_fifo_underrun_interrupt(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS_CLR = SI32_SARADC_A_STATUS_FURI_MASK;
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_clear_fifo_underrun_interrupt(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_clear_fifo_underrun_interrupt(basePointer)
 #define SI32_SARADC_A_clear_fifo_underrun_interrupt(basePointer) \
@@ -3113,8 +5510,32 @@ _SI32_SARADC_A_clear_fifo_underrun_interrupt(SI32_SARADC_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SARADC_A_is_any_interrupt_pending(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   if (basePointer->STATUS.U32
+     && (SI32_SARADC_A_STATUS_WCI_MASK
+     | SI32_SARADC_A_STATUS_SCCI_MASK
+     | SI32_SARADC_A_STATUS_SDI_MASK
+     | SI32_SARADC_A_STATUS_FORI_MASK
+     | SI32_SARADC_A_STATUS_FURI_MASK)
+     != 0)
+   {
+      return true;
+   }
+   else
+   {
+      return false;
+   }
+   //}}
+}
+#else
 bool
 _SI32_SARADC_A_is_any_interrupt_pending(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_is_any_interrupt_pending(basePointer)
 #define SI32_SARADC_A_is_any_interrupt_pending(basePointer) \
@@ -3129,8 +5550,24 @@ _SI32_SARADC_A_is_any_interrupt_pending(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SARADC_A_clear_all_interrupts(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   basePointer->STATUS_CLR =
+     (SI32_SARADC_A_STATUS_WCI_MASK
+     | SI32_SARADC_A_STATUS_SCCI_MASK
+     | SI32_SARADC_A_STATUS_SDI_MASK
+     | SI32_SARADC_A_STATUS_FORI_MASK
+     | SI32_SARADC_A_STATUS_FURI_MASK);
+   //}}
+}
+#else
 void
 _SI32_SARADC_A_clear_all_interrupts(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_clear_all_interrupts(basePointer)
 #define SI32_SARADC_A_clear_all_interrupts(basePointer) do{  \
@@ -3151,8 +5588,19 @@ _SI32_SARADC_A_clear_all_interrupts(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_SARADC_A_read_fifostatus(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->FIFOSTATUS.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_SARADC_A_read_fifostatus(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_read_fifostatus(basePointer)
 #define SI32_SARADC_A_read_fifostatus(basePointer) \
@@ -3171,8 +5619,19 @@ _SI32_SARADC_A_read_fifostatus(SI32_SARADC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_SARADC_A_get_num_words_in_fifo(
+   SI32_SARADC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->FIFOSTATUS.FIFOLVL;
+   //}}
+}
+#else
 uint32_t
 _SI32_SARADC_A_get_num_words_in_fifo(SI32_SARADC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SARADC_A_get_num_words_in_fifo(basePointer)
 #define SI32_SARADC_A_get_num_words_in_fifo(basePointer) \
@@ -64,11 +64,30 @@ extern "C" {
 ///  Valid range is 32 bits.
 ///  Write to CLKRATE register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_initialize(
+   SI32_SPI_A_Type * basePointer,
+   // Write to CONTROL register.
+   uint32_t control,
+   // Write to CONFIG register.
+   uint32_t config,
+   // Write to CLKRATE register.
+   uint32_t clkrate)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   basePointer->CONFIG.U32 = config;
+   basePointer->CLKRATE.U32 = clkrate;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_initialize(SI32_SPI_A_Type* /*basePointer*/,
    uint32_t, /*control*/
    uint32_t, /*config*/
    uint32_t /*clkrate*/);
+#endif
 ///
 /// @def SI32_SPI_A_initialize(basePointer, control, config, clkrate)
 #define SI32_SPI_A_initialize(basePointer, control, config, clkrate) do{  \
@@ -92,9 +111,22 @@ _SI32_SPI_A_initialize(SI32_SPI_A_Type* /*basePointer*/,
 ///  Valid range is 32 bits.
 ///  Data to write to SPI Transmit FIFO.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_write_tx_fifo_u32(
+   SI32_SPI_A_Type * basePointer,
+   // Data to write to SPI Transmit FIFO.
+   uint32_t data_u32)
+{
+   //{{
+   basePointer->DATA.U32 = data_u32;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_write_tx_fifo_u32(SI32_SPI_A_Type* /*basePointer*/,
    uint32_t /*data_u32*/);
+#endif
 ///
 /// @def SI32_SPI_A_write_tx_fifo_u32(basePointer, data_u32)
 #define SI32_SPI_A_write_tx_fifo_u32(basePointer, data_u32) \
@@ -115,9 +147,22 @@ _SI32_SPI_A_write_tx_fifo_u32(SI32_SPI_A_Type* /*basePointer*/,
 ///  Valid range is 32 bits.
 ///  Data to write to SPI Transmit FIFO.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_write_tx_fifo_u16(
+   SI32_SPI_A_Type * basePointer,
+   // Data to write to SPI Transmit FIFO.
+   uwide16_t data_u16)
+{
+   //{{
+   basePointer->DATA.U16 = data_u16;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_write_tx_fifo_u16(SI32_SPI_A_Type* /*basePointer*/,
    uwide16_t /*data_u16*/);
+#endif
 ///
 /// @def SI32_SPI_A_write_tx_fifo_u16(basePointer, data_u16)
 #define SI32_SPI_A_write_tx_fifo_u16(basePointer, data_u16) \
@@ -138,9 +183,22 @@ _SI32_SPI_A_write_tx_fifo_u16(SI32_SPI_A_Type* /*basePointer*/,
 ///  Valid range is 32 bits.
 ///  Data to write to SPI Transmit FIFO.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_write_tx_fifo_u8(
+   SI32_SPI_A_Type * basePointer,
+   // Data to write to SPI Transmit FIFO.
+   uwide8_t data_u8)
+{
+   //{{
+   basePointer->DATA.U8 = data_u8;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_write_tx_fifo_u8(SI32_SPI_A_Type* /*basePointer*/,
    uwide8_t /*data_u8*/);
+#endif
 ///
 /// @def SI32_SPI_A_write_tx_fifo_u8(basePointer, data_u8)
 #define SI32_SPI_A_write_tx_fifo_u8(basePointer, data_u8) \
@@ -158,8 +216,19 @@ _SI32_SPI_A_write_tx_fifo_u8(SI32_SPI_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_SPI_A_read_rx_fifo_u32(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DATA.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_SPI_A_read_rx_fifo_u32(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_read_rx_fifo_u32(basePointer)
 #define SI32_SPI_A_read_rx_fifo_u32(basePointer) \
@@ -177,8 +246,19 @@ _SI32_SPI_A_read_rx_fifo_u32(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide16_t
+_SI32_SPI_A_read_rx_fifo_u16(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DATA.U16;
+   //}}
+}
+#else
 uwide16_t
 _SI32_SPI_A_read_rx_fifo_u16(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_read_rx_fifo_u16(basePointer)
 #define SI32_SPI_A_read_rx_fifo_u16(basePointer) \
@@ -196,8 +276,19 @@ _SI32_SPI_A_read_rx_fifo_u16(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide8_t
+_SI32_SPI_A_read_rx_fifo_u8(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DATA.U8;
+   //}}
+}
+#else
 uwide8_t
 _SI32_SPI_A_read_rx_fifo_u8(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_read_rx_fifo_u8(basePointer)
 #define SI32_SPI_A_read_rx_fifo_u8(basePointer) \
@@ -212,8 +303,19 @@ _SI32_SPI_A_read_rx_fifo_u8(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_SPI_A_read_control(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_SPI_A_read_control(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_read_control(basePointer)
 #define SI32_SPI_A_read_control(basePointer) \
@@ -233,9 +335,21 @@ _SI32_SPI_A_read_control(SI32_SPI_A_Type* /*basePointer*/);
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_write_control(
+   SI32_SPI_A_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_write_control(SI32_SPI_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_SPI_A_write_control(basePointer, control)
 #define SI32_SPI_A_write_control(basePointer, control) \
@@ -250,8 +364,19 @@ _SI32_SPI_A_write_control(SI32_SPI_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_A_is_rx_fifo_read_request_interrupt_pending(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->CONTROL.RFRQI;
+   //}}
+}
+#else
 bool
 _SI32_SPI_A_is_rx_fifo_read_request_interrupt_pending(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_is_rx_fifo_read_request_interrupt_pending(basePointer)
 #define SI32_SPI_A_is_rx_fifo_read_request_interrupt_pending(basePointer) \
@@ -266,8 +391,19 @@ _SI32_SPI_A_is_rx_fifo_read_request_interrupt_pending(SI32_SPI_A_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_A_is_rx_fifo_overrun_interrupt_pending(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->CONTROL.RFORI;
+   //}}
+}
+#else
 bool
 _SI32_SPI_A_is_rx_fifo_overrun_interrupt_pending(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_is_rx_fifo_overrun_interrupt_pending(basePointer)
 #define SI32_SPI_A_is_rx_fifo_overrun_interrupt_pending(basePointer) \
@@ -279,8 +415,19 @@ _SI32_SPI_A_is_rx_fifo_overrun_interrupt_pending(SI32_SPI_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_clear_rx_fifo_overrun_interrupt(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SPI_A_CONTROL_RFORI_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_clear_rx_fifo_overrun_interrupt(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_clear_rx_fifo_overrun_interrupt(basePointer)
 #define SI32_SPI_A_clear_rx_fifo_overrun_interrupt(basePointer) \
@@ -295,8 +442,19 @@ _SI32_SPI_A_clear_rx_fifo_overrun_interrupt(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_A_is_tx_fifo_write_request_interrupt_pending(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->CONTROL.TFRQI;
+   //}}
+}
+#else
 bool
 _SI32_SPI_A_is_tx_fifo_write_request_interrupt_pending(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_is_tx_fifo_write_request_interrupt_pending(basePointer)
 #define SI32_SPI_A_is_tx_fifo_write_request_interrupt_pending(basePointer) \
@@ -311,8 +469,19 @@ _SI32_SPI_A_is_tx_fifo_write_request_interrupt_pending(SI32_SPI_A_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_A_is_tx_fifo_overrun_interrupt_pending(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->CONTROL.TFORI;
+   //}}
+}
+#else
 bool
 _SI32_SPI_A_is_tx_fifo_overrun_interrupt_pending(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_is_tx_fifo_overrun_interrupt_pending(basePointer)
 #define SI32_SPI_A_is_tx_fifo_overrun_interrupt_pending(basePointer) \
@@ -324,8 +493,19 @@ _SI32_SPI_A_is_tx_fifo_overrun_interrupt_pending(SI32_SPI_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_clear_tx_fifo_overrun_interrupt(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SPI_A_CONTROL_TFORI_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_clear_tx_fifo_overrun_interrupt(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_clear_tx_fifo_overrun_interrupt(basePointer)
 #define SI32_SPI_A_clear_tx_fifo_overrun_interrupt(basePointer) \
@@ -340,8 +520,19 @@ _SI32_SPI_A_clear_tx_fifo_overrun_interrupt(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_A_is_slave_selected_interrupt_pending(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->CONTROL.SLVSELI;
+   //}}
+}
+#else
 bool
 _SI32_SPI_A_is_slave_selected_interrupt_pending(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_is_slave_selected_interrupt_pending(basePointer)
 #define SI32_SPI_A_is_slave_selected_interrupt_pending(basePointer) \
@@ -356,8 +547,19 @@ _SI32_SPI_A_is_slave_selected_interrupt_pending(SI32_SPI_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_A_is_mode_fault_interrupt_pending(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->CONTROL.MDFI;
+   //}}
+}
+#else
 bool
 _SI32_SPI_A_is_mode_fault_interrupt_pending(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_is_mode_fault_interrupt_pending(basePointer)
 #define SI32_SPI_A_is_mode_fault_interrupt_pending(basePointer) \
@@ -369,8 +571,19 @@ _SI32_SPI_A_is_mode_fault_interrupt_pending(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_clear_mode_fault_interrupt(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SPI_A_CONTROL_MDFI_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_clear_mode_fault_interrupt(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_clear_mode_fault_interrupt(basePointer)
 #define SI32_SPI_A_clear_mode_fault_interrupt(basePointer) \
@@ -385,8 +598,19 @@ _SI32_SPI_A_clear_mode_fault_interrupt(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_A_is_underrun_interrupt_pending(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->CONTROL.URI;
+   //}}
+}
+#else
 bool
 _SI32_SPI_A_is_underrun_interrupt_pending(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_is_underrun_interrupt_pending(basePointer)
 #define SI32_SPI_A_is_underrun_interrupt_pending(basePointer) \
@@ -398,8 +622,19 @@ _SI32_SPI_A_is_underrun_interrupt_pending(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_clear_underrun_interrupt(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SPI_A_CONTROL_URI_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_clear_underrun_interrupt(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_clear_underrun_interrupt(basePointer)
 #define SI32_SPI_A_clear_underrun_interrupt(basePointer) \
@@ -414,8 +649,19 @@ _SI32_SPI_A_clear_underrun_interrupt(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_A_is_shift_register_empty_interrupt_pending(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->CONTROL.SREI;
+   //}}
+}
+#else
 bool
 _SI32_SPI_A_is_shift_register_empty_interrupt_pending(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_is_shift_register_empty_interrupt_pending(basePointer)
 #define SI32_SPI_A_is_shift_register_empty_interrupt_pending(basePointer) \
@@ -430,8 +676,19 @@ _SI32_SPI_A_is_shift_register_empty_interrupt_pending(SI32_SPI_A_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_A_is_illegal_rx_fifo_access_interrupt_pending(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->CONTROL.RFILI;
+   //}}
+}
+#else
 bool
 _SI32_SPI_A_is_illegal_rx_fifo_access_interrupt_pending(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_is_illegal_rx_fifo_access_interrupt_pending(basePointer)
 #define SI32_SPI_A_is_illegal_rx_fifo_access_interrupt_pending(basePointer) \
@@ -443,8 +700,19 @@ _SI32_SPI_A_is_illegal_rx_fifo_access_interrupt_pending(SI32_SPI_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_clear_illegal_rx_fifo_access_interrupt(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SPI_A_CONTROL_RFILI_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_clear_illegal_rx_fifo_access_interrupt(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_clear_illegal_rx_fifo_access_interrupt(basePointer)
 #define SI32_SPI_A_clear_illegal_rx_fifo_access_interrupt(basePointer) \
@@ -459,8 +727,19 @@ _SI32_SPI_A_clear_illegal_rx_fifo_access_interrupt(SI32_SPI_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_A_is_illegal_tx_fifo_access_interrupt_pending(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->CONTROL.TFILI;
+   //}}
+}
+#else
 bool
 _SI32_SPI_A_is_illegal_tx_fifo_access_interrupt_pending(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_is_illegal_tx_fifo_access_interrupt_pending(basePointer)
 #define SI32_SPI_A_is_illegal_tx_fifo_access_interrupt_pending(basePointer) \
@@ -472,8 +751,19 @@ _SI32_SPI_A_is_illegal_tx_fifo_access_interrupt_pending(SI32_SPI_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_clear_illegal_tx_fifo_access_interrupt(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SPI_A_CONTROL_TFILI_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_clear_illegal_tx_fifo_access_interrupt(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_clear_illegal_tx_fifo_access_interrupt(basePointer)
 #define SI32_SPI_A_clear_illegal_tx_fifo_access_interrupt(basePointer) \
@@ -491,8 +781,29 @@ _SI32_SPI_A_clear_illegal_tx_fifo_access_interrupt(SI32_SPI_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_A_is_any_interrupt_pending(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.U32
+                 & (SI32_SPI_A_CONTROL_RFRQI_MASK
+                    | SI32_SPI_A_CONTROL_RFORI_MASK
+                    | SI32_SPI_A_CONTROL_TFRQI_MASK
+                    | SI32_SPI_A_CONTROL_TFORI_MASK
+                    | SI32_SPI_A_CONTROL_SLVSELI_MASK
+                    | SI32_SPI_A_CONTROL_MDFI_MASK
+                    | SI32_SPI_A_CONTROL_URI_MASK
+                    | SI32_SPI_A_CONTROL_SREI_MASK
+                    | SI32_SPI_A_CONTROL_RFILI_MASK
+                    | SI32_SPI_A_CONTROL_TFILI_MASK));
+   //}}
+}
+#else
 bool
 _SI32_SPI_A_is_any_interrupt_pending(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_is_any_interrupt_pending(basePointer)
 #define SI32_SPI_A_is_any_interrupt_pending(basePointer) \
@@ -507,8 +818,28 @@ _SI32_SPI_A_is_any_interrupt_pending(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_clear_all_interrupts(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SPI_A_CONTROL_RFRQI_MASK
+                            | SI32_SPI_A_CONTROL_RFORI_MASK
+                            | SI32_SPI_A_CONTROL_TFRQI_MASK
+                            | SI32_SPI_A_CONTROL_TFORI_MASK
+                            | SI32_SPI_A_CONTROL_SLVSELI_MASK
+                            | SI32_SPI_A_CONTROL_MDFI_MASK
+                            | SI32_SPI_A_CONTROL_URI_MASK
+                            | SI32_SPI_A_CONTROL_SREI_MASK
+                            | SI32_SPI_A_CONTROL_RFILI_MASK
+                            | SI32_SPI_A_CONTROL_TFILI_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_clear_all_interrupts(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_clear_all_interrupts(basePointer)
 #define SI32_SPI_A_clear_all_interrupts(basePointer) do{  \
@@ -536,8 +867,19 @@ _SI32_SPI_A_clear_all_interrupts(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_A_get_nss_pin(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->CONTROL.NSSSTS;
+   //}}
+}
+#else
 bool
 _SI32_SPI_A_get_nss_pin(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_get_nss_pin(basePointer)
 #define SI32_SPI_A_get_nss_pin(basePointer) \
@@ -555,8 +897,19 @@ _SI32_SPI_A_get_nss_pin(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_A_is_transfer_in_progress(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->CONTROL.BUSYF;
+   //}}
+}
+#else
 bool
 _SI32_SPI_A_is_transfer_in_progress(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_is_transfer_in_progress(basePointer)
 #define SI32_SPI_A_is_transfer_in_progress(basePointer) \
@@ -571,8 +924,19 @@ _SI32_SPI_A_is_transfer_in_progress(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_SPI_A_get_rx_fifo_count(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.RFCNT;
+   //}}
+}
+#else
 uint32_t
 _SI32_SPI_A_get_rx_fifo_count(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_get_rx_fifo_count(basePointer)
 #define SI32_SPI_A_get_rx_fifo_count(basePointer) \
@@ -587,8 +951,19 @@ _SI32_SPI_A_get_rx_fifo_count(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_SPI_A_get_tx_fifo_count(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.TFCNT;
+   //}}
+}
+#else
 uint32_t
 _SI32_SPI_A_get_tx_fifo_count(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_get_tx_fifo_count(basePointer)
 #define SI32_SPI_A_get_tx_fifo_count(basePointer) \
@@ -603,8 +978,19 @@ _SI32_SPI_A_get_tx_fifo_count(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_enable_stall_in_debug_mode(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_SPI_A_CONTROL_DBGMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_enable_stall_in_debug_mode(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_enable_stall_in_debug_mode(basePointer)
 #define SI32_SPI_A_enable_stall_in_debug_mode(basePointer) \
@@ -619,8 +1005,19 @@ _SI32_SPI_A_enable_stall_in_debug_mode(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_disable_stall_in_debug_mode(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SPI_A_CONTROL_DBGMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_disable_stall_in_debug_mode(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_disable_stall_in_debug_mode(basePointer)
 #define SI32_SPI_A_disable_stall_in_debug_mode(basePointer) \
@@ -635,8 +1032,19 @@ _SI32_SPI_A_disable_stall_in_debug_mode(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_SPI_A_read_config(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONFIG.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_SPI_A_read_config(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_read_config(basePointer)
 #define SI32_SPI_A_read_config(basePointer) \
@@ -656,9 +1064,21 @@ _SI32_SPI_A_read_config(SI32_SPI_A_Type* /*basePointer*/);
 ///  config
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_write_config(
+   SI32_SPI_A_Type * basePointer,
+   uint32_t config)
+{
+   //{{
+   basePointer->CONFIG.U32 = config;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_write_config(SI32_SPI_A_Type* /*basePointer*/,
    uint32_t /*config*/);
+#endif
 ///
 /// @def SI32_SPI_A_write_config(basePointer, config)
 #define SI32_SPI_A_write_config(basePointer, config) \
@@ -670,8 +1090,19 @@ _SI32_SPI_A_write_config(SI32_SPI_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_enable_rx_fifo_read_request_interrupt(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_A_CONFIG_RFRQIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_enable_rx_fifo_read_request_interrupt(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_enable_rx_fifo_read_request_interrupt(basePointer)
 #define SI32_SPI_A_enable_rx_fifo_read_request_interrupt(basePointer) \
@@ -683,8 +1114,19 @@ _SI32_SPI_A_enable_rx_fifo_read_request_interrupt(SI32_SPI_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_disable_rx_fifo_read_request_interrupt(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_A_CONFIG_RFRQIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_disable_rx_fifo_read_request_interrupt(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_disable_rx_fifo_read_request_interrupt(basePointer)
 #define SI32_SPI_A_disable_rx_fifo_read_request_interrupt(basePointer) \
@@ -696,8 +1138,19 @@ _SI32_SPI_A_disable_rx_fifo_read_request_interrupt(SI32_SPI_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_A_is_rx_fifo_read_request_interrupt_enabled(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONFIG.RFRQIEN);
+   //}}
+}
+#else
 bool
 _SI32_SPI_A_is_rx_fifo_read_request_interrupt_enabled(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_is_rx_fifo_read_request_interrupt_enabled(basePointer)
 #define SI32_SPI_A_is_rx_fifo_read_request_interrupt_enabled(basePointer) \
@@ -709,8 +1162,19 @@ _SI32_SPI_A_is_rx_fifo_read_request_interrupt_enabled(SI32_SPI_A_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_enable_rx_fifo_overrun_interrupt(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_A_CONFIG_RFORIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_enable_rx_fifo_overrun_interrupt(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_enable_rx_fifo_overrun_interrupt(basePointer)
 #define SI32_SPI_A_enable_rx_fifo_overrun_interrupt(basePointer) \
@@ -722,8 +1186,19 @@ _SI32_SPI_A_enable_rx_fifo_overrun_interrupt(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_disable_rx_fifo_overrun_interrupt(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_A_CONFIG_RFORIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_disable_rx_fifo_overrun_interrupt(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_disable_rx_fifo_overrun_interrupt(basePointer)
 #define SI32_SPI_A_disable_rx_fifo_overrun_interrupt(basePointer) \
@@ -735,8 +1210,19 @@ _SI32_SPI_A_disable_rx_fifo_overrun_interrupt(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_A_is_rx_fifo_overrun_interrupt_enabled(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONFIG.RFORIEN);
+   //}}
+}
+#else
 bool
 _SI32_SPI_A_is_rx_fifo_overrun_interrupt_enabled(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_is_rx_fifo_overrun_interrupt_enabled(basePointer)
 #define SI32_SPI_A_is_rx_fifo_overrun_interrupt_enabled(basePointer) \
@@ -748,8 +1234,19 @@ _SI32_SPI_A_is_rx_fifo_overrun_interrupt_enabled(SI32_SPI_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_enable_tx_fifo_write_request_interrupt(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_A_CONFIG_TFRQIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_enable_tx_fifo_write_request_interrupt(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_enable_tx_fifo_write_request_interrupt(basePointer)
 #define SI32_SPI_A_enable_tx_fifo_write_request_interrupt(basePointer) \
@@ -761,8 +1258,19 @@ _SI32_SPI_A_enable_tx_fifo_write_request_interrupt(SI32_SPI_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_disable_tx_fifo_write_request_interrupt(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_A_CONFIG_TFRQIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_disable_tx_fifo_write_request_interrupt(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_disable_tx_fifo_write_request_interrupt(basePointer)
 #define SI32_SPI_A_disable_tx_fifo_write_request_interrupt(basePointer) \
@@ -774,8 +1282,19 @@ _SI32_SPI_A_disable_tx_fifo_write_request_interrupt(SI32_SPI_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_A_is_tx_fifo_write_request_interrupt_enabled(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONFIG.TFRQIEN);
+   //}}
+}
+#else
 bool
 _SI32_SPI_A_is_tx_fifo_write_request_interrupt_enabled(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_is_tx_fifo_write_request_interrupt_enabled(basePointer)
 #define SI32_SPI_A_is_tx_fifo_write_request_interrupt_enabled(basePointer) \
@@ -787,8 +1306,19 @@ _SI32_SPI_A_is_tx_fifo_write_request_interrupt_enabled(SI32_SPI_A_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_enable_tx_fifo_overrun_interrupt(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_A_CONFIG_TFORIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_enable_tx_fifo_overrun_interrupt(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_enable_tx_fifo_overrun_interrupt(basePointer)
 #define SI32_SPI_A_enable_tx_fifo_overrun_interrupt(basePointer) \
@@ -800,8 +1330,19 @@ _SI32_SPI_A_enable_tx_fifo_overrun_interrupt(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_disable_tx_fifo_overrun_interrupt(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_A_CONFIG_TFORIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_disable_tx_fifo_overrun_interrupt(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_disable_tx_fifo_overrun_interrupt(basePointer)
 #define SI32_SPI_A_disable_tx_fifo_overrun_interrupt(basePointer) \
@@ -813,8 +1354,19 @@ _SI32_SPI_A_disable_tx_fifo_overrun_interrupt(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_A_is_tx_fifo_overrun_interrupt_enabled(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONFIG.TFORIEN);
+   //}}
+}
+#else
 bool
 _SI32_SPI_A_is_tx_fifo_overrun_interrupt_enabled(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_is_tx_fifo_overrun_interrupt_enabled(basePointer)
 #define SI32_SPI_A_is_tx_fifo_overrun_interrupt_enabled(basePointer) \
@@ -826,8 +1378,19 @@ _SI32_SPI_A_is_tx_fifo_overrun_interrupt_enabled(SI32_SPI_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_enable_slave_selected_interrupt(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_A_CONFIG_SLVSELIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_enable_slave_selected_interrupt(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_enable_slave_selected_interrupt(basePointer)
 #define SI32_SPI_A_enable_slave_selected_interrupt(basePointer) \
@@ -839,8 +1402,19 @@ _SI32_SPI_A_enable_slave_selected_interrupt(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_disable_slave_selected_interrupt(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_A_CONFIG_SLVSELIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_disable_slave_selected_interrupt(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_disable_slave_selected_interrupt(basePointer)
 #define SI32_SPI_A_disable_slave_selected_interrupt(basePointer) \
@@ -852,8 +1426,19 @@ _SI32_SPI_A_disable_slave_selected_interrupt(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_A_is_slave_selected_interrupt_enabled(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONFIG.SLVSELIEN);
+   //}}
+}
+#else
 bool
 _SI32_SPI_A_is_slave_selected_interrupt_enabled(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_is_slave_selected_interrupt_enabled(basePointer)
 #define SI32_SPI_A_is_slave_selected_interrupt_enabled(basePointer) \
@@ -865,8 +1450,19 @@ _SI32_SPI_A_is_slave_selected_interrupt_enabled(SI32_SPI_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_enable_mode_fault_interrupt(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_A_CONFIG_MDFIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_enable_mode_fault_interrupt(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_enable_mode_fault_interrupt(basePointer)
 #define SI32_SPI_A_enable_mode_fault_interrupt(basePointer) \
@@ -878,8 +1474,19 @@ _SI32_SPI_A_enable_mode_fault_interrupt(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_disable_mode_fault_interrupt(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_A_CONFIG_MDFIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_disable_mode_fault_interrupt(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_disable_mode_fault_interrupt(basePointer)
 #define SI32_SPI_A_disable_mode_fault_interrupt(basePointer) \
@@ -891,8 +1498,19 @@ _SI32_SPI_A_disable_mode_fault_interrupt(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_A_is_mode_fault_interrupt_enabled(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONFIG.MDFIEN);
+   //}}
+}
+#else
 bool
 _SI32_SPI_A_is_mode_fault_interrupt_enabled(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_is_mode_fault_interrupt_enabled(basePointer)
 #define SI32_SPI_A_is_mode_fault_interrupt_enabled(basePointer) \
@@ -904,8 +1522,19 @@ _SI32_SPI_A_is_mode_fault_interrupt_enabled(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_enable_underrun_interrupt(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_A_CONFIG_URIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_enable_underrun_interrupt(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_enable_underrun_interrupt(basePointer)
 #define SI32_SPI_A_enable_underrun_interrupt(basePointer) \
@@ -917,8 +1546,19 @@ _SI32_SPI_A_enable_underrun_interrupt(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_disable_underrun_interrupt(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_A_CONFIG_URIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_disable_underrun_interrupt(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_disable_underrun_interrupt(basePointer)
 #define SI32_SPI_A_disable_underrun_interrupt(basePointer) \
@@ -930,8 +1570,19 @@ _SI32_SPI_A_disable_underrun_interrupt(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_A_is_underrun_interrupt_enabled(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONFIG.URIEN);
+   //}}
+}
+#else
 bool
 _SI32_SPI_A_is_underrun_interrupt_enabled(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_is_underrun_interrupt_enabled(basePointer)
 #define SI32_SPI_A_is_underrun_interrupt_enabled(basePointer) \
@@ -943,8 +1594,19 @@ _SI32_SPI_A_is_underrun_interrupt_enabled(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_enable_shift_register_empty_interrupt(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_A_CONFIG_SREIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_enable_shift_register_empty_interrupt(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_enable_shift_register_empty_interrupt(basePointer)
 #define SI32_SPI_A_enable_shift_register_empty_interrupt(basePointer) \
@@ -956,8 +1618,19 @@ _SI32_SPI_A_enable_shift_register_empty_interrupt(SI32_SPI_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_disable_shift_register_empty_interrupt(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_A_CONFIG_SREIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_disable_shift_register_empty_interrupt(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_disable_shift_register_empty_interrupt(basePointer)
 #define SI32_SPI_A_disable_shift_register_empty_interrupt(basePointer) \
@@ -969,8 +1642,19 @@ _SI32_SPI_A_disable_shift_register_empty_interrupt(SI32_SPI_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_A_is_shift_register_empty_interrupt_enabled(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONFIG.SREIEN);
+   //}}
+}
+#else
 bool
 _SI32_SPI_A_is_shift_register_empty_interrupt_enabled(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_is_shift_register_empty_interrupt_enabled(basePointer)
 #define SI32_SPI_A_is_shift_register_empty_interrupt_enabled(basePointer) \
@@ -982,8 +1666,19 @@ _SI32_SPI_A_is_shift_register_empty_interrupt_enabled(SI32_SPI_A_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_enable_module(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_A_CONFIG_SPIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_enable_module(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_enable_module(basePointer)
 #define SI32_SPI_A_enable_module(basePointer) \
@@ -995,8 +1690,19 @@ _SI32_SPI_A_enable_module(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_disable_module(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_A_CONFIG_SPIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_disable_module(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_disable_module(basePointer)
 #define SI32_SPI_A_disable_module(basePointer) \
@@ -1008,8 +1714,19 @@ _SI32_SPI_A_disable_module(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_select_master_mode(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_A_CONFIG_MSTEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_select_master_mode(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_select_master_mode(basePointer)
 #define SI32_SPI_A_select_master_mode(basePointer) \
@@ -1021,8 +1738,19 @@ _SI32_SPI_A_select_master_mode(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_select_slave_mode(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_A_CONFIG_MSTEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_select_slave_mode(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_select_slave_mode(basePointer)
 #define SI32_SPI_A_select_slave_mode(basePointer) \
@@ -1042,9 +1770,42 @@ _SI32_SPI_A_select_slave_mode(SI32_SPI_A_Type* /*basePointer*/);
 ///  sckmode
 ///  Clock mode.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_select_clock_mode(
+   SI32_SPI_A_Type * basePointer,
+   // Clock mode.
+   SI32_SPI_A_CLOCK_MODE_Enum_Type sckmode)
+{
+   //{{
+   switch (sckmode)
+   {
+      case 0:
+         basePointer->CONFIG_CLR = SI32_SPI_A_CONFIG_CLKPOL_MASK
+                                 | SI32_SPI_A_CONFIG_CLKPHA_MASK;
+         break;
+      case 1:
+         basePointer->CONFIG_CLR = SI32_SPI_A_CONFIG_CLKPOL_MASK;
+         basePointer->CONFIG_SET = SI32_SPI_A_CONFIG_CLKPHA_MASK;
+         break;
+      case 2:
+         basePointer->CONFIG_SET = SI32_SPI_A_CONFIG_CLKPOL_MASK;
+         basePointer->CONFIG_CLR = SI32_SPI_A_CONFIG_CLKPHA_MASK;
+         break;
+      case 3:
+         basePointer->CONFIG_SET = SI32_SPI_A_CONFIG_CLKPOL_MASK
+                                 | SI32_SPI_A_CONFIG_CLKPHA_MASK;
+         break;
+      default:
+         break;
+   }
+   //}}
+}
+#else
 void
 _SI32_SPI_A_select_clock_mode(SI32_SPI_A_Type* /*basePointer*/,
    SI32_SPI_A_CLOCK_MODE_Enum_Type /*sckmode*/);
+#endif
 ///
 /// @def SI32_SPI_A_select_clock_mode(basePointer, sckmode)
 #define SI32_SPI_A_select_clock_mode(basePointer, sckmode) \
@@ -1056,8 +1817,19 @@ _SI32_SPI_A_select_clock_mode(SI32_SPI_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_select_clock_idle_high(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_A_CONFIG_CLKPOL_HIGH_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_select_clock_idle_high(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_select_clock_idle_high(basePointer)
 #define SI32_SPI_A_select_clock_idle_high(basePointer) \
@@ -1069,8 +1841,19 @@ _SI32_SPI_A_select_clock_idle_high(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_select_clock_idle_low(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_A_CONFIG_CLKPOL_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_select_clock_idle_low(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_select_clock_idle_low(basePointer)
 #define SI32_SPI_A_select_clock_idle_low(basePointer) \
@@ -1085,8 +1868,19 @@ _SI32_SPI_A_select_clock_idle_low(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_select_data_change_first_edge(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_A_CONFIG_CLKPHA_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_select_data_change_first_edge(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_select_data_change_first_edge(basePointer)
 #define SI32_SPI_A_select_data_change_first_edge(basePointer) \
@@ -1101,8 +1895,19 @@ _SI32_SPI_A_select_data_change_first_edge(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_select_data_change_second_edge(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_A_CONFIG_CLKPHA_EDGE_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_select_data_change_second_edge(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_select_data_change_second_edge(basePointer)
 #define SI32_SPI_A_select_data_change_second_edge(basePointer) \
@@ -1117,8 +1922,19 @@ _SI32_SPI_A_select_data_change_second_edge(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_select_nss_active_high(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_A_CONFIG_NSSPOL_HIGH_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_select_nss_active_high(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_select_nss_active_high(basePointer)
 #define SI32_SPI_A_select_nss_active_high(basePointer) \
@@ -1133,8 +1949,19 @@ _SI32_SPI_A_select_nss_active_high(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_select_nss_active_low(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_A_CONFIG_NSSPOL_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_select_nss_active_low(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_select_nss_active_low(basePointer)
 #define SI32_SPI_A_select_nss_active_low(basePointer) \
@@ -1149,8 +1976,19 @@ _SI32_SPI_A_select_nss_active_low(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_select_direction_lsb_first(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_A_CONFIG_DDIRSEL_LSB_FIRST_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_select_direction_lsb_first(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_select_direction_lsb_first(basePointer)
 #define SI32_SPI_A_select_direction_lsb_first(basePointer) \
@@ -1165,8 +2003,19 @@ _SI32_SPI_A_select_direction_lsb_first(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_select_direction_msb_first(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_A_CONFIG_DDIRSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_select_direction_msb_first(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_select_direction_msb_first(basePointer)
 #define SI32_SPI_A_select_direction_msb_first(basePointer) \
@@ -1178,8 +2027,20 @@ _SI32_SPI_A_select_direction_msb_first(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_select_3wire_master_mode(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_A_CONFIG_MSTEN_MASK;
+   basePointer->CONFIG_CLR = SI32_SPI_A_CONFIG_NSSMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_select_3wire_master_mode(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_select_3wire_master_mode(basePointer)
 #define SI32_SPI_A_select_3wire_master_mode(basePointer) do{  \
@@ -1193,8 +2054,20 @@ _SI32_SPI_A_select_3wire_master_mode(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_select_4wire_master_mode_nss_high(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_A_CONFIG_NSSMD_MASK
+                           | SI32_SPI_A_CONFIG_MSTEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_select_4wire_master_mode_nss_high(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_select_4wire_master_mode_nss_high(basePointer)
 #define SI32_SPI_A_select_4wire_master_mode_nss_high(basePointer) do{  \
@@ -1208,8 +2081,21 @@ _SI32_SPI_A_select_4wire_master_mode_nss_high(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_select_4wire_master_mode_nss_low(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_A_CONFIG_NSSMD_MASK;
+   basePointer->CONFIG_SET = SI32_SPI_A_CONFIG_NSSMD_4_WIRE_MASTER_NSS_LOW_U32
+                           | SI32_SPI_A_CONFIG_MSTEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_select_4wire_master_mode_nss_low(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_select_4wire_master_mode_nss_low(basePointer)
 #define SI32_SPI_A_select_4wire_master_mode_nss_low(basePointer) do{  \
@@ -1224,8 +2110,20 @@ _SI32_SPI_A_select_4wire_master_mode_nss_low(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_select_3wire_slave_mode(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_A_CONFIG_MSTEN_MASK
+                           | SI32_SPI_A_CONFIG_NSSMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_select_3wire_slave_mode(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_select_3wire_slave_mode(basePointer)
 #define SI32_SPI_A_select_3wire_slave_mode(basePointer) do{  \
@@ -1239,8 +2137,21 @@ _SI32_SPI_A_select_3wire_slave_mode(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_select_4wire_slave_mode(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_A_CONFIG_MSTEN_MASK
+                           | SI32_SPI_A_CONFIG_NSSMD_MASK;
+   basePointer->CONFIG_SET = SI32_SPI_A_CONFIG_NSSMD_4_WIRE_SLAVE_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_select_4wire_slave_mode(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_select_4wire_slave_mode(basePointer)
 #define SI32_SPI_A_select_4wire_slave_mode(basePointer) do{  \
@@ -1255,8 +2166,19 @@ _SI32_SPI_A_select_4wire_slave_mode(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_clear_nss(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_A_CONFIG_NSSMD_4_WIRE_SLAVE_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_clear_nss(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_clear_nss(basePointer)
 #define SI32_SPI_A_clear_nss(basePointer) \
@@ -1268,8 +2190,19 @@ _SI32_SPI_A_clear_nss(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_set_nss(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_A_CONFIG_NSSMD_4_WIRE_SLAVE_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_set_nss(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_set_nss(basePointer)
 #define SI32_SPI_A_set_nss(basePointer) \
@@ -1286,9 +2219,40 @@ _SI32_SPI_A_set_nss(SI32_SPI_A_Type* /*basePointer*/);
 ///  threshold
 ///  Threshold.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_select_tx_fifo_threshold(
+   SI32_SPI_A_Type * basePointer,
+   // Threshold.
+   SI32_SPI_A_FIFO_THRESHOLD_Enum_Type threshold)
+{
+   //{{
+   switch (threshold)
+   {
+      case 0:
+         basePointer->CONFIG_CLR = SI32_SPI_A_CONFIG_TFTH_MASK;
+         break;
+      case 1:
+         basePointer->CONFIG_CLR = SI32_SPI_A_CONFIG_TFTH_MASK;
+         basePointer->CONFIG_SET = SI32_SPI_A_CONFIG_TFTH_TWO_U32;
+         break;
+      case 2:
+         basePointer->CONFIG_CLR = SI32_SPI_A_CONFIG_TFTH_MASK;
+         basePointer->CONFIG_SET = SI32_SPI_A_CONFIG_TFTH_FOUR_U32;
+         break;
+      case 3:
+         basePointer->CONFIG_SET = SI32_SPI_A_CONFIG_TFTH_EMPTY_U32;
+         break;
+      default:
+         break;
+   }
+   //}}
+}
+#else
 void
 _SI32_SPI_A_select_tx_fifo_threshold(SI32_SPI_A_Type* /*basePointer*/,
    SI32_SPI_A_FIFO_THRESHOLD_Enum_Type /*threshold*/);
+#endif
 ///
 /// @def SI32_SPI_A_select_tx_fifo_threshold(basePointer, threshold)
 #define SI32_SPI_A_select_tx_fifo_threshold(basePointer, threshold) \
@@ -1305,9 +2269,40 @@ _SI32_SPI_A_select_tx_fifo_threshold(SI32_SPI_A_Type* /*basePointer*/,
 ///  threshold
 ///  Threshold.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_select_rx_fifo_threshold(
+   SI32_SPI_A_Type * basePointer,
+   // Threshold.
+   SI32_SPI_A_FIFO_THRESHOLD_Enum_Type threshold)
+{
+   //{{
+   switch (threshold)
+   {
+      case 0:
+         basePointer->CONFIG_CLR = SI32_SPI_A_CONFIG_RFTH_MASK;
+         break;
+      case 1:
+         basePointer->CONFIG_CLR = SI32_SPI_A_CONFIG_RFTH_MASK;
+         basePointer->CONFIG_SET = SI32_SPI_A_CONFIG_RFTH_TWO_U32;
+         break;
+      case 2:
+         basePointer->CONFIG_CLR = SI32_SPI_A_CONFIG_RFTH_MASK;
+         basePointer->CONFIG_SET = SI32_SPI_A_CONFIG_RFTH_FOUR_U32;
+         break;
+      case 3:
+         basePointer->CONFIG_SET = SI32_SPI_A_CONFIG_RFTH_FULL_U32;
+         break;
+      default:
+         break;
+   }
+   //}}
+}
+#else
 void
 _SI32_SPI_A_select_rx_fifo_threshold(SI32_SPI_A_Type* /*basePointer*/,
    SI32_SPI_A_FIFO_THRESHOLD_Enum_Type /*threshold*/);
+#endif
 ///
 /// @def SI32_SPI_A_select_rx_fifo_threshold(basePointer, threshold)
 #define SI32_SPI_A_select_rx_fifo_threshold(basePointer, threshold) \
@@ -1328,9 +2323,23 @@ _SI32_SPI_A_select_rx_fifo_threshold(SI32_SPI_A_Type* /*basePointer*/,
 ///  Valid range is 1 to 16.
 ///  Number of bits per transfer (1-16).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_set_data_length(
+   SI32_SPI_A_Type * basePointer,
+   // Number of bits per transfer (1-16).
+   uint32_t dlength)
+{
+   assert((dlength >= 1) && (dlength <= 16));
+   //{{
+   basePointer->CONFIG.DSIZE = (dlength - 1);
+   //}}
+}
+#else
 void
 _SI32_SPI_A_set_data_length(SI32_SPI_A_Type* /*basePointer*/,
    uint32_t /*dlength*/);
+#endif
 ///
 /// @def SI32_SPI_A_set_data_length(basePointer, dlength)
 #define SI32_SPI_A_set_data_length(basePointer, dlength) \
@@ -1342,8 +2351,19 @@ _SI32_SPI_A_set_data_length(SI32_SPI_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_enable_dma_requests(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_A_CONFIG_DMAEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_enable_dma_requests(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_enable_dma_requests(basePointer)
 #define SI32_SPI_A_enable_dma_requests(basePointer) \
@@ -1355,8 +2375,19 @@ _SI32_SPI_A_enable_dma_requests(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_disable_dma_requests(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_A_CONFIG_DMAEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_disable_dma_requests(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_disable_dma_requests(basePointer)
 #define SI32_SPI_A_disable_dma_requests(basePointer) \
@@ -1368,8 +2399,19 @@ _SI32_SPI_A_disable_dma_requests(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_flush_rx_fifo(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_A_CONFIG_RFIFOFL_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_flush_rx_fifo(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_flush_rx_fifo(basePointer)
 #define SI32_SPI_A_flush_rx_fifo(basePointer) \
@@ -1381,8 +2423,19 @@ _SI32_SPI_A_flush_rx_fifo(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_flush_tx_fifo(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_A_CONFIG_TFIFOFL_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_flush_tx_fifo(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_flush_tx_fifo(basePointer)
 #define SI32_SPI_A_flush_tx_fifo(basePointer) \
@@ -1398,8 +2451,19 @@ _SI32_SPI_A_flush_tx_fifo(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_reset_module(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_A_CONFIG_RESET_ACTIVE_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_reset_module(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_reset_module(basePointer)
 #define SI32_SPI_A_reset_module(basePointer) \
@@ -1414,8 +2478,19 @@ _SI32_SPI_A_reset_module(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_A_is_module_reset_pending(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   return (bool) basePointer->CONFIG.RESET;
+   //}}
+}
+#else
 bool
 _SI32_SPI_A_is_module_reset_pending(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_is_module_reset_pending(basePointer)
 #define SI32_SPI_A_is_module_reset_pending(basePointer) \
@@ -1430,8 +2505,19 @@ _SI32_SPI_A_is_module_reset_pending(SI32_SPI_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide16_t
+_SI32_SPI_A_read_clkrate(
+   SI32_SPI_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CLKRATE.U32;
+   //}}
+}
+#else
 uwide16_t
 _SI32_SPI_A_read_clkrate(SI32_SPI_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_A_read_clkrate(basePointer)
 #define SI32_SPI_A_read_clkrate(basePointer) \
@@ -1451,9 +2537,21 @@ _SI32_SPI_A_read_clkrate(SI32_SPI_A_Type* /*basePointer*/);
 ///  clkrate
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_write_clkrate(
+   SI32_SPI_A_Type * basePointer,
+   uwide16_t clkrate)
+{
+   //{{
+   basePointer->CLKRATE.U32 = clkrate;
+   //}}
+}
+#else
 void
 _SI32_SPI_A_write_clkrate(SI32_SPI_A_Type* /*basePointer*/,
    uwide16_t /*clkrate*/);
+#endif
 ///
 /// @def SI32_SPI_A_write_clkrate(basePointer, clkrate)
 #define SI32_SPI_A_write_clkrate(basePointer, clkrate) \
@@ -1471,9 +2569,23 @@ _SI32_SPI_A_write_clkrate(SI32_SPI_A_Type* /*basePointer*/,
 ///  Valid range is 1 to 131072.
 ///  Clock rate divider value.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_A_set_clock_divisor(
+   SI32_SPI_A_Type * basePointer,
+   // Clock rate divider value.
+   uint32_t divisor)
+{
+   assert((divisor >= 1) && (divisor <= 131072));
+   //{{
+   basePointer->CLKRATE.CLKDIV = ((divisor/2)-1);
+   //}}
+}
+#else
 void
 _SI32_SPI_A_set_clock_divisor(SI32_SPI_A_Type* /*basePointer*/,
    uint32_t /*divisor*/);
+#endif
 ///
 /// @def SI32_SPI_A_set_clock_divisor(basePointer, divisor)
 #define SI32_SPI_A_set_clock_divisor(basePointer, divisor) \
@@ -25,6 +25,9 @@
 // HAL Source: 0.6
 // Version: 36
 
+// Build the out-of-line accessors even when SI32_HAL_INLINE is defined.
+#define SI32_HAL_OUT_OF_LINE
+
 #include <assert.h>
 #include "si32WideTypes.h"
 #include "SI32_SPI_B_Type.h"
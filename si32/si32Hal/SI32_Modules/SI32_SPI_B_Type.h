@@ -66,11 +66,31 @@ extern "C" {
 ///  Valid range is 16 bits.
 ///  Write to CLKRATE register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_initialize(
+   SI32_SPI_B_Type * basePointer,
+   // Write to CONTROL register.
+   uint32_t control,
+   // Write to CONFIG register.
+   uint32_t config,
+   // Write to CLKRATE register.
+   uint32_t clkrate)
+{
+   assert(clkrate < 65536);   // clkrate < 2^16
+   //{{
+   basePointer->CONTROL.U32 = control;
+   basePointer->CONFIG.U32 = config;
+   basePointer->CLKRATE.U32 = clkrate;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_initialize(SI32_SPI_B_Type* /*basePointer*/,
    uint32_t, /*control*/
    uint32_t, /*config*/
    uint32_t /*clkrate*/);
+#endif
 ///
 /// @def SI32_SPI_B_initialize(basePointer, control, config, clkrate)
 #define SI32_SPI_B_initialize(basePointer, control, config, clkrate) do{  \
@@ -94,9 +114,22 @@ _SI32_SPI_B_initialize(SI32_SPI_B_Type* /*basePointer*/,
 ///  Valid range is 32 bits.
 ///  Data to write to SPI Transmit FIFO.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_write_tx_fifo_u32(
+   SI32_SPI_B_Type * basePointer,
+   // Data to write to SPI Transmit FIFO.
+   uint32_t data_u32)
+{
+   //{{
+   basePointer->DATA.U32 = data_u32;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_write_tx_fifo_u32(SI32_SPI_B_Type* /*basePointer*/,
    uint32_t /*data_u32*/);
+#endif
 ///
 /// @def SI32_SPI_B_write_tx_fifo_u32(basePointer, data_u32)
 #define SI32_SPI_B_write_tx_fifo_u32(basePointer, data_u32) \
@@ -117,9 +150,23 @@ _SI32_SPI_B_write_tx_fifo_u32(SI32_SPI_B_Type* /*basePointer*/,
 ///  Valid range is 16 bits.
 ///  Data to write to SPI Transmit FIFO.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_write_tx_fifo_u16(
+   SI32_SPI_B_Type * basePointer,
+   // Data to write to SPI Transmit FIFO.
+   uwide16_t data_u16)
+{
+   assert(data_u16 < 65536);   // data_u16 < 2^16
+   //{{
+   basePointer->DATA.U16 = data_u16;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_write_tx_fifo_u16(SI32_SPI_B_Type* /*basePointer*/,
    uwide16_t /*data_u16*/);
+#endif
 ///
 /// @def SI32_SPI_B_write_tx_fifo_u16(basePointer, data_u16)
 #define SI32_SPI_B_write_tx_fifo_u16(basePointer, data_u16) \
@@ -140,9 +187,23 @@ _SI32_SPI_B_write_tx_fifo_u16(SI32_SPI_B_Type* /*basePointer*/,
 ///  Valid range is 8 bits.
 ///  Data to write to SPI Transmit FIFO.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_write_tx_fifo_u8(
+   SI32_SPI_B_Type * basePointer,
+   // Data to write to SPI Transmit FIFO.
+   uwide8_t data_u8)
+{
+   assert(data_u8 < 256);   // data_u8 < 2^8
+   //{{
+   basePointer->DATA.U8 = data_u8;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_write_tx_fifo_u8(SI32_SPI_B_Type* /*basePointer*/,
    uwide8_t /*data_u8*/);
+#endif
 ///
 /// @def SI32_SPI_B_write_tx_fifo_u8(basePointer, data_u8)
 #define SI32_SPI_B_write_tx_fifo_u8(basePointer, data_u8) \
@@ -160,8 +221,19 @@ _SI32_SPI_B_write_tx_fifo_u8(SI32_SPI_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_SPI_B_read_rx_fifo_u32(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   return basePointer->DATA.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_SPI_B_read_rx_fifo_u32(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_read_rx_fifo_u32(basePointer)
 #define SI32_SPI_B_read_rx_fifo_u32(basePointer) \
@@ -179,8 +251,19 @@ _SI32_SPI_B_read_rx_fifo_u32(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide16_t
+_SI32_SPI_B_read_rx_fifo_u16(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   return basePointer->DATA.U16;
+   //}}
+}
+#else
 uwide16_t
 _SI32_SPI_B_read_rx_fifo_u16(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_read_rx_fifo_u16(basePointer)
 #define SI32_SPI_B_read_rx_fifo_u16(basePointer) \
@@ -198,8 +281,19 @@ _SI32_SPI_B_read_rx_fifo_u16(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide8_t
+_SI32_SPI_B_read_rx_fifo_u8(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   return basePointer->DATA.U8;
+   //}}
+}
+#else
 uwide8_t
 _SI32_SPI_B_read_rx_fifo_u8(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_read_rx_fifo_u8(basePointer)
 #define SI32_SPI_B_read_rx_fifo_u8(basePointer) \
@@ -214,8 +308,19 @@ _SI32_SPI_B_read_rx_fifo_u8(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_SPI_B_read_control(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_SPI_B_read_control(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_read_control(basePointer)
 #define SI32_SPI_B_read_control(basePointer) \
@@ -235,9 +340,21 @@ _SI32_SPI_B_read_control(SI32_SPI_B_Type* /*basePointer*/);
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_write_control(
+   SI32_SPI_B_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_write_control(SI32_SPI_B_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_SPI_B_write_control(basePointer, control)
 #define SI32_SPI_B_write_control(basePointer, control) \
@@ -252,8 +369,19 @@ _SI32_SPI_B_write_control(SI32_SPI_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_B_is_rx_fifo_read_request_interrupt_pending(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->CONTROL.RFRQI;
+   //}}
+}
+#else
 bool
 _SI32_SPI_B_is_rx_fifo_read_request_interrupt_pending(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_is_rx_fifo_read_request_interrupt_pending(basePointer)
 #define SI32_SPI_B_is_rx_fifo_read_request_interrupt_pending(basePointer) \
@@ -268,8 +396,19 @@ _SI32_SPI_B_is_rx_fifo_read_request_interrupt_pending(SI32_SPI_B_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_B_is_rx_fifo_overrun_interrupt_pending(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->CONTROL.RFORI;
+   //}}
+}
+#else
 bool
 _SI32_SPI_B_is_rx_fifo_overrun_interrupt_pending(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_is_rx_fifo_overrun_interrupt_pending(basePointer)
 #define SI32_SPI_B_is_rx_fifo_overrun_interrupt_pending(basePointer) \
@@ -281,8 +420,19 @@ _SI32_SPI_B_is_rx_fifo_overrun_interrupt_pending(SI32_SPI_B_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_clear_rx_fifo_overrun_interrupt(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SPI_B_CONTROL_RFORI_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_clear_rx_fifo_overrun_interrupt(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_clear_rx_fifo_overrun_interrupt(basePointer)
 #define SI32_SPI_B_clear_rx_fifo_overrun_interrupt(basePointer) \
@@ -297,8 +447,19 @@ _SI32_SPI_B_clear_rx_fifo_overrun_interrupt(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_B_is_tx_fifo_write_request_interrupt_pending(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->CONTROL.TFRQI;
+   //}}
+}
+#else
 bool
 _SI32_SPI_B_is_tx_fifo_write_request_interrupt_pending(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_is_tx_fifo_write_request_interrupt_pending(basePointer)
 #define SI32_SPI_B_is_tx_fifo_write_request_interrupt_pending(basePointer) \
@@ -313,8 +474,19 @@ _SI32_SPI_B_is_tx_fifo_write_request_interrupt_pending(SI32_SPI_B_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_B_is_tx_fifo_overrun_interrupt_pending(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->CONTROL.TFORI;
+   //}}
+}
+#else
 bool
 _SI32_SPI_B_is_tx_fifo_overrun_interrupt_pending(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_is_tx_fifo_overrun_interrupt_pending(basePointer)
 #define SI32_SPI_B_is_tx_fifo_overrun_interrupt_pending(basePointer) \
@@ -326,8 +498,19 @@ _SI32_SPI_B_is_tx_fifo_overrun_interrupt_pending(SI32_SPI_B_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_clear_tx_fifo_overrun_interrupt(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SPI_B_CONTROL_TFORI_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_clear_tx_fifo_overrun_interrupt(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_clear_tx_fifo_overrun_interrupt(basePointer)
 #define SI32_SPI_B_clear_tx_fifo_overrun_interrupt(basePointer) \
@@ -342,8 +525,19 @@ _SI32_SPI_B_clear_tx_fifo_overrun_interrupt(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_B_is_slave_selected_interrupt_pending(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->CONTROL.SLVSELI;
+   //}}
+}
+#else
 bool
 _SI32_SPI_B_is_slave_selected_interrupt_pending(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_is_slave_selected_interrupt_pending(basePointer)
 #define SI32_SPI_B_is_slave_selected_interrupt_pending(basePointer) \
@@ -358,8 +552,19 @@ _SI32_SPI_B_is_slave_selected_interrupt_pending(SI32_SPI_B_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_B_is_mode_fault_interrupt_pending(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->CONTROL.MDFI;
+   //}}
+}
+#else
 bool
 _SI32_SPI_B_is_mode_fault_interrupt_pending(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_is_mode_fault_interrupt_pending(basePointer)
 #define SI32_SPI_B_is_mode_fault_interrupt_pending(basePointer) \
@@ -371,8 +576,19 @@ _SI32_SPI_B_is_mode_fault_interrupt_pending(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_clear_mode_fault_interrupt(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SPI_B_CONTROL_MDFI_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_clear_mode_fault_interrupt(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_clear_mode_fault_interrupt(basePointer)
 #define SI32_SPI_B_clear_mode_fault_interrupt(basePointer) \
@@ -387,8 +603,19 @@ _SI32_SPI_B_clear_mode_fault_interrupt(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_B_is_underrun_interrupt_pending(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->CONTROL.URI;
+   //}}
+}
+#else
 bool
 _SI32_SPI_B_is_underrun_interrupt_pending(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_is_underrun_interrupt_pending(basePointer)
 #define SI32_SPI_B_is_underrun_interrupt_pending(basePointer) \
@@ -400,8 +627,19 @@ _SI32_SPI_B_is_underrun_interrupt_pending(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_clear_underrun_interrupt(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SPI_B_CONTROL_URI_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_clear_underrun_interrupt(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_clear_underrun_interrupt(basePointer)
 #define SI32_SPI_B_clear_underrun_interrupt(basePointer) \
@@ -416,8 +654,19 @@ _SI32_SPI_B_clear_underrun_interrupt(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_B_is_shift_register_empty_interrupt_pending(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->CONTROL.SREI;
+   //}}
+}
+#else
 bool
 _SI32_SPI_B_is_shift_register_empty_interrupt_pending(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_is_shift_register_empty_interrupt_pending(basePointer)
 #define SI32_SPI_B_is_shift_register_empty_interrupt_pending(basePointer) \
@@ -432,8 +681,19 @@ _SI32_SPI_B_is_shift_register_empty_interrupt_pending(SI32_SPI_B_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_B_is_illegal_rx_fifo_access_interrupt_pending(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->CONTROL.RFILI;
+   //}}
+}
+#else
 bool
 _SI32_SPI_B_is_illegal_rx_fifo_access_interrupt_pending(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_is_illegal_rx_fifo_access_interrupt_pending(basePointer)
 #define SI32_SPI_B_is_illegal_rx_fifo_access_interrupt_pending(basePointer) \
@@ -445,8 +705,19 @@ _SI32_SPI_B_is_illegal_rx_fifo_access_interrupt_pending(SI32_SPI_B_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_clear_illegal_rx_fifo_access_interrupt(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SPI_B_CONTROL_RFILI_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_clear_illegal_rx_fifo_access_interrupt(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_clear_illegal_rx_fifo_access_interrupt(basePointer)
 #define SI32_SPI_B_clear_illegal_rx_fifo_access_interrupt(basePointer) \
@@ -461,8 +732,19 @@ _SI32_SPI_B_clear_illegal_rx_fifo_access_interrupt(SI32_SPI_B_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_B_is_illegal_tx_fifo_access_interrupt_pending(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->CONTROL.TFILI;
+   //}}
+}
+#else
 bool
 _SI32_SPI_B_is_illegal_tx_fifo_access_interrupt_pending(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_is_illegal_tx_fifo_access_interrupt_pending(basePointer)
 #define SI32_SPI_B_is_illegal_tx_fifo_access_interrupt_pending(basePointer) \
@@ -474,8 +756,19 @@ _SI32_SPI_B_is_illegal_tx_fifo_access_interrupt_pending(SI32_SPI_B_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_clear_illegal_tx_fifo_access_interrupt(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SPI_B_CONTROL_TFILI_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_clear_illegal_tx_fifo_access_interrupt(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_clear_illegal_tx_fifo_access_interrupt(basePointer)
 #define SI32_SPI_B_clear_illegal_tx_fifo_access_interrupt(basePointer) \
@@ -493,8 +786,29 @@ _SI32_SPI_B_clear_illegal_tx_fifo_access_interrupt(SI32_SPI_B_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_B_is_any_interrupt_pending(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.U32
+                 & (SI32_SPI_B_CONTROL_RFRQI_MASK
+                    | SI32_SPI_B_CONTROL_RFORI_MASK
+                    | SI32_SPI_B_CONTROL_TFRQI_MASK
+                    | SI32_SPI_B_CONTROL_TFORI_MASK
+                    | SI32_SPI_B_CONTROL_SLVSELI_MASK
+                    | SI32_SPI_B_CONTROL_MDFI_MASK
+                    | SI32_SPI_B_CONTROL_URI_MASK
+                    | SI32_SPI_B_CONTROL_SREI_MASK
+                    | SI32_SPI_B_CONTROL_RFILI_MASK
+                    | SI32_SPI_B_CONTROL_TFILI_MASK));
+   //}}
+}
+#else
 bool
 _SI32_SPI_B_is_any_interrupt_pending(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_is_any_interrupt_pending(basePointer)
 #define SI32_SPI_B_is_any_interrupt_pending(basePointer) \
@@ -509,8 +823,28 @@ _SI32_SPI_B_is_any_interrupt_pending(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_clear_all_interrupts(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SPI_B_CONTROL_RFRQI_MASK
+                            | SI32_SPI_B_CONTROL_RFORI_MASK
+                            | SI32_SPI_B_CONTROL_TFRQI_MASK
+                            | SI32_SPI_B_CONTROL_TFORI_MASK
+                            | SI32_SPI_B_CONTROL_SLVSELI_MASK
+                            | SI32_SPI_B_CONTROL_MDFI_MASK
+                            | SI32_SPI_B_CONTROL_URI_MASK
+                            | SI32_SPI_B_CONTROL_SREI_MASK
+                            | SI32_SPI_B_CONTROL_RFILI_MASK
+                            | SI32_SPI_B_CONTROL_TFILI_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_clear_all_interrupts(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_clear_all_interrupts(basePointer)
 #define SI32_SPI_B_clear_all_interrupts(basePointer) do{  \
@@ -538,8 +872,19 @@ _SI32_SPI_B_clear_all_interrupts(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_B_get_nss_pin(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->CONTROL.NSSSTS;
+   //}}
+}
+#else
 bool
 _SI32_SPI_B_get_nss_pin(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_get_nss_pin(basePointer)
 #define SI32_SPI_B_get_nss_pin(basePointer) \
@@ -557,8 +902,19 @@ _SI32_SPI_B_get_nss_pin(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_B_is_transfer_in_progress(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   return (bool)basePointer->CONTROL.BUSYF;
+   //}}
+}
+#else
 bool
 _SI32_SPI_B_is_transfer_in_progress(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_is_transfer_in_progress(basePointer)
 #define SI32_SPI_B_is_transfer_in_progress(basePointer) \
@@ -573,8 +929,19 @@ _SI32_SPI_B_is_transfer_in_progress(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_SPI_B_get_rx_fifo_count(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.RFCNT;
+   //}}
+}
+#else
 uint32_t
 _SI32_SPI_B_get_rx_fifo_count(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_get_rx_fifo_count(basePointer)
 #define SI32_SPI_B_get_rx_fifo_count(basePointer) \
@@ -589,8 +956,19 @@ _SI32_SPI_B_get_rx_fifo_count(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_SPI_B_get_tx_fifo_count(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.TFCNT;
+   //}}
+}
+#else
 uint32_t
 _SI32_SPI_B_get_tx_fifo_count(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_get_tx_fifo_count(basePointer)
 #define SI32_SPI_B_get_tx_fifo_count(basePointer) \
@@ -605,8 +983,19 @@ _SI32_SPI_B_get_tx_fifo_count(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_enable_stall_in_debug_mode(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_SPI_B_CONTROL_DBGMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_enable_stall_in_debug_mode(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_enable_stall_in_debug_mode(basePointer)
 #define SI32_SPI_B_enable_stall_in_debug_mode(basePointer) \
@@ -621,8 +1010,19 @@ _SI32_SPI_B_enable_stall_in_debug_mode(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_disable_stall_in_debug_mode(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SPI_B_CONTROL_DBGMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_disable_stall_in_debug_mode(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_disable_stall_in_debug_mode(basePointer)
 #define SI32_SPI_B_disable_stall_in_debug_mode(basePointer) \
@@ -637,8 +1037,19 @@ _SI32_SPI_B_disable_stall_in_debug_mode(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_SPI_B_read_config(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   return basePointer->CONFIG.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_SPI_B_read_config(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_read_config(basePointer)
 #define SI32_SPI_B_read_config(basePointer) \
@@ -658,9 +1069,21 @@ _SI32_SPI_B_read_config(SI32_SPI_B_Type* /*basePointer*/);
 ///  config
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_write_config(
+   SI32_SPI_B_Type * basePointer,
+   uint32_t config)
+{
+   //{{
+   basePointer->CONFIG.U32 = config;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_write_config(SI32_SPI_B_Type* /*basePointer*/,
    uint32_t /*config*/);
+#endif
 ///
 /// @def SI32_SPI_B_write_config(basePointer, config)
 #define SI32_SPI_B_write_config(basePointer, config) \
@@ -672,8 +1095,19 @@ _SI32_SPI_B_write_config(SI32_SPI_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_enable_rx_fifo_read_request_interrupt(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_B_CONFIG_RFRQIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_enable_rx_fifo_read_request_interrupt(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_enable_rx_fifo_read_request_interrupt(basePointer)
 #define SI32_SPI_B_enable_rx_fifo_read_request_interrupt(basePointer) \
@@ -685,8 +1119,19 @@ _SI32_SPI_B_enable_rx_fifo_read_request_interrupt(SI32_SPI_B_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_disable_rx_fifo_read_request_interrupt(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_B_CONFIG_RFRQIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_disable_rx_fifo_read_request_interrupt(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_disable_rx_fifo_read_request_interrupt(basePointer)
 #define SI32_SPI_B_disable_rx_fifo_read_request_interrupt(basePointer) \
@@ -698,8 +1143,19 @@ _SI32_SPI_B_disable_rx_fifo_read_request_interrupt(SI32_SPI_B_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_B_is_rx_fifo_read_request_interrupt_enabled(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONFIG.RFRQIEN);
+   //}}
+}
+#else
 bool
 _SI32_SPI_B_is_rx_fifo_read_request_interrupt_enabled(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_is_rx_fifo_read_request_interrupt_enabled(basePointer)
 #define SI32_SPI_B_is_rx_fifo_read_request_interrupt_enabled(basePointer) \
@@ -711,8 +1167,19 @@ _SI32_SPI_B_is_rx_fifo_read_request_interrupt_enabled(SI32_SPI_B_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_enable_rx_fifo_overrun_interrupt(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_B_CONFIG_RFORIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_enable_rx_fifo_overrun_interrupt(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_enable_rx_fifo_overrun_interrupt(basePointer)
 #define SI32_SPI_B_enable_rx_fifo_overrun_interrupt(basePointer) \
@@ -724,8 +1191,19 @@ _SI32_SPI_B_enable_rx_fifo_overrun_interrupt(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_disable_rx_fifo_overrun_interrupt(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_B_CONFIG_RFORIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_disable_rx_fifo_overrun_interrupt(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_disable_rx_fifo_overrun_interrupt(basePointer)
 #define SI32_SPI_B_disable_rx_fifo_overrun_interrupt(basePointer) \
@@ -737,8 +1215,19 @@ _SI32_SPI_B_disable_rx_fifo_overrun_interrupt(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_B_is_rx_fifo_overrun_interrupt_enabled(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONFIG.RFORIEN);
+   //}}
+}
+#else
 bool
 _SI32_SPI_B_is_rx_fifo_overrun_interrupt_enabled(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_is_rx_fifo_overrun_interrupt_enabled(basePointer)
 #define SI32_SPI_B_is_rx_fifo_overrun_interrupt_enabled(basePointer) \
@@ -750,8 +1239,19 @@ _SI32_SPI_B_is_rx_fifo_overrun_interrupt_enabled(SI32_SPI_B_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_enable_tx_fifo_write_request_interrupt(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_B_CONFIG_TFRQIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_enable_tx_fifo_write_request_interrupt(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_enable_tx_fifo_write_request_interrupt(basePointer)
 #define SI32_SPI_B_enable_tx_fifo_write_request_interrupt(basePointer) \
@@ -763,8 +1263,19 @@ _SI32_SPI_B_enable_tx_fifo_write_request_interrupt(SI32_SPI_B_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_disable_tx_fifo_write_request_interrupt(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_B_CONFIG_TFRQIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_disable_tx_fifo_write_request_interrupt(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_disable_tx_fifo_write_request_interrupt(basePointer)
 #define SI32_SPI_B_disable_tx_fifo_write_request_interrupt(basePointer) \
@@ -776,8 +1287,19 @@ _SI32_SPI_B_disable_tx_fifo_write_request_interrupt(SI32_SPI_B_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_B_is_tx_fifo_write_request_interrupt_enabled(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONFIG.TFRQIEN);
+   //}}
+}
+#else
 bool
 _SI32_SPI_B_is_tx_fifo_write_request_interrupt_enabled(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_is_tx_fifo_write_request_interrupt_enabled(basePointer)
 #define SI32_SPI_B_is_tx_fifo_write_request_interrupt_enabled(basePointer) \
@@ -789,8 +1311,19 @@ _SI32_SPI_B_is_tx_fifo_write_request_interrupt_enabled(SI32_SPI_B_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_enable_tx_fifo_overrun_interrupt(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_B_CONFIG_TFORIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_enable_tx_fifo_overrun_interrupt(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_enable_tx_fifo_overrun_interrupt(basePointer)
 #define SI32_SPI_B_enable_tx_fifo_overrun_interrupt(basePointer) \
@@ -802,8 +1335,19 @@ _SI32_SPI_B_enable_tx_fifo_overrun_interrupt(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_disable_tx_fifo_overrun_interrupt(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_B_CONFIG_TFORIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_disable_tx_fifo_overrun_interrupt(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_disable_tx_fifo_overrun_interrupt(basePointer)
 #define SI32_SPI_B_disable_tx_fifo_overrun_interrupt(basePointer) \
@@ -815,8 +1359,19 @@ _SI32_SPI_B_disable_tx_fifo_overrun_interrupt(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_B_is_tx_fifo_overrun_interrupt_enabled(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONFIG.TFORIEN);
+   //}}
+}
+#else
 bool
 _SI32_SPI_B_is_tx_fifo_overrun_interrupt_enabled(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_is_tx_fifo_overrun_interrupt_enabled(basePointer)
 #define SI32_SPI_B_is_tx_fifo_overrun_interrupt_enabled(basePointer) \
@@ -828,8 +1383,19 @@ _SI32_SPI_B_is_tx_fifo_overrun_interrupt_enabled(SI32_SPI_B_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_enable_slave_selected_interrupt(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_B_CONFIG_SLVSELIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_enable_slave_selected_interrupt(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_enable_slave_selected_interrupt(basePointer)
 #define SI32_SPI_B_enable_slave_selected_interrupt(basePointer) \
@@ -841,8 +1407,19 @@ _SI32_SPI_B_enable_slave_selected_interrupt(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_disable_slave_selected_interrupt(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_B_CONFIG_SLVSELIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_disable_slave_selected_interrupt(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_disable_slave_selected_interrupt(basePointer)
 #define SI32_SPI_B_disable_slave_selected_interrupt(basePointer) \
@@ -854,8 +1431,19 @@ _SI32_SPI_B_disable_slave_selected_interrupt(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_B_is_slave_selected_interrupt_enabled(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONFIG.SLVSELIEN);
+   //}}
+}
+#else
 bool
 _SI32_SPI_B_is_slave_selected_interrupt_enabled(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_is_slave_selected_interrupt_enabled(basePointer)
 #define SI32_SPI_B_is_slave_selected_interrupt_enabled(basePointer) \
@@ -867,8 +1455,19 @@ _SI32_SPI_B_is_slave_selected_interrupt_enabled(SI32_SPI_B_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_enable_mode_fault_interrupt(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_B_CONFIG_MDFIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_enable_mode_fault_interrupt(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_enable_mode_fault_interrupt(basePointer)
 #define SI32_SPI_B_enable_mode_fault_interrupt(basePointer) \
@@ -880,8 +1479,19 @@ _SI32_SPI_B_enable_mode_fault_interrupt(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_disable_mode_fault_interrupt(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_B_CONFIG_MDFIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_disable_mode_fault_interrupt(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_disable_mode_fault_interrupt(basePointer)
 #define SI32_SPI_B_disable_mode_fault_interrupt(basePointer) \
@@ -893,8 +1503,19 @@ _SI32_SPI_B_disable_mode_fault_interrupt(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_B_is_mode_fault_interrupt_enabled(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONFIG.MDFIEN);
+   //}}
+}
+#else
 bool
 _SI32_SPI_B_is_mode_fault_interrupt_enabled(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_is_mode_fault_interrupt_enabled(basePointer)
 #define SI32_SPI_B_is_mode_fault_interrupt_enabled(basePointer) \
@@ -906,8 +1527,19 @@ _SI32_SPI_B_is_mode_fault_interrupt_enabled(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_enable_underrun_interrupt(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_B_CONFIG_URIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_enable_underrun_interrupt(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_enable_underrun_interrupt(basePointer)
 #define SI32_SPI_B_enable_underrun_interrupt(basePointer) \
@@ -919,8 +1551,19 @@ _SI32_SPI_B_enable_underrun_interrupt(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_disable_underrun_interrupt(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_B_CONFIG_URIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_disable_underrun_interrupt(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_disable_underrun_interrupt(basePointer)
 #define SI32_SPI_B_disable_underrun_interrupt(basePointer) \
@@ -932,8 +1575,19 @@ _SI32_SPI_B_disable_underrun_interrupt(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_B_is_underrun_interrupt_enabled(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONFIG.URIEN);
+   //}}
+}
+#else
 bool
 _SI32_SPI_B_is_underrun_interrupt_enabled(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_is_underrun_interrupt_enabled(basePointer)
 #define SI32_SPI_B_is_underrun_interrupt_enabled(basePointer) \
@@ -945,8 +1599,19 @@ _SI32_SPI_B_is_underrun_interrupt_enabled(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_enable_shift_register_empty_interrupt(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_B_CONFIG_SREIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_enable_shift_register_empty_interrupt(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_enable_shift_register_empty_interrupt(basePointer)
 #define SI32_SPI_B_enable_shift_register_empty_interrupt(basePointer) \
@@ -958,8 +1623,19 @@ _SI32_SPI_B_enable_shift_register_empty_interrupt(SI32_SPI_B_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_disable_shift_register_empty_interrupt(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_B_CONFIG_SREIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_disable_shift_register_empty_interrupt(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_disable_shift_register_empty_interrupt(basePointer)
 #define SI32_SPI_B_disable_shift_register_empty_interrupt(basePointer) \
@@ -971,8 +1647,19 @@ _SI32_SPI_B_disable_shift_register_empty_interrupt(SI32_SPI_B_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_B_is_shift_register_empty_interrupt_enabled(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONFIG.SREIEN);
+   //}}
+}
+#else
 bool
 _SI32_SPI_B_is_shift_register_empty_interrupt_enabled(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_is_shift_register_empty_interrupt_enabled(basePointer)
 #define SI32_SPI_B_is_shift_register_empty_interrupt_enabled(basePointer) \
@@ -984,8 +1671,19 @@ _SI32_SPI_B_is_shift_register_empty_interrupt_enabled(SI32_SPI_B_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_enable_module(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_B_CONFIG_SPIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_enable_module(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_enable_module(basePointer)
 #define SI32_SPI_B_enable_module(basePointer) \
@@ -997,8 +1695,19 @@ _SI32_SPI_B_enable_module(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_disable_module(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_B_CONFIG_SPIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_disable_module(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_disable_module(basePointer)
 #define SI32_SPI_B_disable_module(basePointer) \
@@ -1010,8 +1719,19 @@ _SI32_SPI_B_disable_module(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_select_master_mode(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_B_CONFIG_MSTEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_select_master_mode(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_select_master_mode(basePointer)
 #define SI32_SPI_B_select_master_mode(basePointer) \
@@ -1023,8 +1743,19 @@ _SI32_SPI_B_select_master_mode(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_select_slave_mode(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_B_CONFIG_MSTEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_select_slave_mode(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_select_slave_mode(basePointer)
 #define SI32_SPI_B_select_slave_mode(basePointer) \
@@ -1044,9 +1775,42 @@ _SI32_SPI_B_select_slave_mode(SI32_SPI_B_Type* /*basePointer*/);
 ///  sckmode
 ///  Clock mode.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_select_clock_mode(
+   SI32_SPI_B_Type * basePointer,
+   // Clock mode.
+   SI32_SPI_B_CLOCK_MODE_Enum_Type sckmode)
+{
+   //{{
+   switch (sckmode)
+   {
+      case 0:
+         basePointer->CONFIG_CLR = SI32_SPI_B_CONFIG_CLKPOL_MASK
+                                 | SI32_SPI_B_CONFIG_CLKPHA_MASK;
+         break;
+      case 1:
+         basePointer->CONFIG_CLR = SI32_SPI_B_CONFIG_CLKPOL_MASK;
+         basePointer->CONFIG_SET = SI32_SPI_B_CONFIG_CLKPHA_MASK;
+         break;
+      case 2:
+         basePointer->CONFIG_SET = SI32_SPI_B_CONFIG_CLKPOL_MASK;
+         basePointer->CONFIG_CLR = SI32_SPI_B_CONFIG_CLKPHA_MASK;
+         break;
+      case 3:
+         basePointer->CONFIG_SET = SI32_SPI_B_CONFIG_CLKPOL_MASK
+                                 | SI32_SPI_B_CONFIG_CLKPHA_MASK;
+         break;
+      default:
+         break;
+   }
+   //}}
+}
+#else
 void
 _SI32_SPI_B_select_clock_mode(SI32_SPI_B_Type* /*basePointer*/,
    SI32_SPI_B_CLOCK_MODE_Enum_Type /*sckmode*/);
+#endif
 ///
 /// @def SI32_SPI_B_select_clock_mode(basePointer, sckmode)
 #define SI32_SPI_B_select_clock_mode(basePointer, sckmode) \
@@ -1058,8 +1822,19 @@ _SI32_SPI_B_select_clock_mode(SI32_SPI_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_select_clock_idle_high(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_B_CONFIG_CLKPOL_HIGH_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_select_clock_idle_high(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_select_clock_idle_high(basePointer)
 #define SI32_SPI_B_select_clock_idle_high(basePointer) \
@@ -1071,8 +1846,19 @@ _SI32_SPI_B_select_clock_idle_high(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_select_clock_idle_low(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_B_CONFIG_CLKPOL_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_select_clock_idle_low(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_select_clock_idle_low(basePointer)
 #define SI32_SPI_B_select_clock_idle_low(basePointer) \
@@ -1087,8 +1873,19 @@ _SI32_SPI_B_select_clock_idle_low(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_select_data_change_first_edge(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_B_CONFIG_CLKPHA_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_select_data_change_first_edge(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_select_data_change_first_edge(basePointer)
 #define SI32_SPI_B_select_data_change_first_edge(basePointer) \
@@ -1103,8 +1900,19 @@ _SI32_SPI_B_select_data_change_first_edge(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_select_data_change_second_edge(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_B_CONFIG_CLKPHA_EDGE_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_select_data_change_second_edge(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_select_data_change_second_edge(basePointer)
 #define SI32_SPI_B_select_data_change_second_edge(basePointer) \
@@ -1119,8 +1927,19 @@ _SI32_SPI_B_select_data_change_second_edge(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_select_nss_active_high(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_B_CONFIG_NSSPOL_HIGH_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_select_nss_active_high(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_select_nss_active_high(basePointer)
 #define SI32_SPI_B_select_nss_active_high(basePointer) \
@@ -1135,8 +1954,19 @@ _SI32_SPI_B_select_nss_active_high(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_select_nss_active_low(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_B_CONFIG_NSSPOL_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_select_nss_active_low(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_select_nss_active_low(basePointer)
 #define SI32_SPI_B_select_nss_active_low(basePointer) \
@@ -1151,8 +1981,19 @@ _SI32_SPI_B_select_nss_active_low(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_select_direction_lsb_first(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_B_CONFIG_DDIRSEL_LSB_FIRST_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_select_direction_lsb_first(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_select_direction_lsb_first(basePointer)
 #define SI32_SPI_B_select_direction_lsb_first(basePointer) \
@@ -1167,8 +2008,19 @@ _SI32_SPI_B_select_direction_lsb_first(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_select_direction_msb_first(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_B_CONFIG_DDIRSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_select_direction_msb_first(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_select_direction_msb_first(basePointer)
 #define SI32_SPI_B_select_direction_msb_first(basePointer) \
@@ -1180,8 +2032,20 @@ _SI32_SPI_B_select_direction_msb_first(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_select_3wire_master_mode(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_B_CONFIG_MSTEN_MASK;
+   basePointer->CONFIG_CLR = SI32_SPI_B_CONFIG_NSSMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_select_3wire_master_mode(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_select_3wire_master_mode(basePointer)
 #define SI32_SPI_B_select_3wire_master_mode(basePointer) do{  \
@@ -1195,8 +2059,20 @@ _SI32_SPI_B_select_3wire_master_mode(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_select_4wire_master_mode_nss_high(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_B_CONFIG_NSSMD_MASK
+                           | SI32_SPI_B_CONFIG_MSTEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_select_4wire_master_mode_nss_high(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_select_4wire_master_mode_nss_high(basePointer)
 #define SI32_SPI_B_select_4wire_master_mode_nss_high(basePointer) do{  \
@@ -1210,8 +2086,21 @@ _SI32_SPI_B_select_4wire_master_mode_nss_high(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_select_4wire_master_mode_nss_low(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_B_CONFIG_NSSMD_MASK;
+   basePointer->CONFIG_SET = SI32_SPI_B_CONFIG_NSSMD_4_WIRE_MASTER_NSS_LOW_U32
+                           | SI32_SPI_B_CONFIG_MSTEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_select_4wire_master_mode_nss_low(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_select_4wire_master_mode_nss_low(basePointer)
 #define SI32_SPI_B_select_4wire_master_mode_nss_low(basePointer) do{  \
@@ -1226,8 +2115,20 @@ _SI32_SPI_B_select_4wire_master_mode_nss_low(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_select_3wire_slave_mode(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_B_CONFIG_MSTEN_MASK
+                           | SI32_SPI_B_CONFIG_NSSMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_select_3wire_slave_mode(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_select_3wire_slave_mode(basePointer)
 #define SI32_SPI_B_select_3wire_slave_mode(basePointer) do{  \
@@ -1241,8 +2142,21 @@ _SI32_SPI_B_select_3wire_slave_mode(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_select_4wire_slave_mode(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_B_CONFIG_MSTEN_MASK
+                           | SI32_SPI_B_CONFIG_NSSMD_MASK;
+   basePointer->CONFIG_SET = SI32_SPI_B_CONFIG_NSSMD_4_WIRE_SLAVE_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_select_4wire_slave_mode(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_select_4wire_slave_mode(basePointer)
 #define SI32_SPI_B_select_4wire_slave_mode(basePointer) do{  \
@@ -1257,8 +2171,19 @@ _SI32_SPI_B_select_4wire_slave_mode(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_clear_nss(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_B_CONFIG_NSSMD_4_WIRE_SLAVE_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_clear_nss(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_clear_nss(basePointer)
 #define SI32_SPI_B_clear_nss(basePointer) \
@@ -1270,8 +2195,19 @@ _SI32_SPI_B_clear_nss(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_set_nss(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_B_CONFIG_NSSMD_4_WIRE_SLAVE_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_set_nss(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_set_nss(basePointer)
 #define SI32_SPI_B_set_nss(basePointer) \
@@ -1288,9 +2224,40 @@ _SI32_SPI_B_set_nss(SI32_SPI_B_Type* /*basePointer*/);
 ///  threshold
 ///  Threshold.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_select_tx_fifo_threshold(
+   SI32_SPI_B_Type * basePointer,
+   // Threshold.
+   SI32_SPI_B_FIFO_THRESHOLD_Enum_Type threshold)
+{
+   //{{
+   switch (threshold)
+   {
+      case 0:
+         basePointer->CONFIG_CLR = SI32_SPI_B_CONFIG_TFTH_MASK;
+         break;
+      case 1:
+         basePointer->CONFIG_CLR = SI32_SPI_B_CONFIG_TFTH_MASK;
+         basePointer->CONFIG_SET = SI32_SPI_B_CONFIG_TFTH_TWO_U32;
+         break;
+      case 2:
+         basePointer->CONFIG_CLR = SI32_SPI_B_CONFIG_TFTH_MASK;
+         basePointer->CONFIG_SET = SI32_SPI_B_CONFIG_TFTH_FOUR_U32;
+         break;
+      case 3:
+         basePointer->CONFIG_SET = SI32_SPI_B_CONFIG_TFTH_EMPTY_U32;
+         break;
+      default:
+         break;
+   }
+   //}}
+}
+#else
 void
 _SI32_SPI_B_select_tx_fifo_threshold(SI32_SPI_B_Type* /*basePointer*/,
    SI32_SPI_B_FIFO_THRESHOLD_Enum_Type /*threshold*/);
+#endif
 ///
 /// @def SI32_SPI_B_select_tx_fifo_threshold(basePointer, threshold)
 #define SI32_SPI_B_select_tx_fifo_threshold(basePointer, threshold) \
@@ -1307,9 +2274,40 @@ _SI32_SPI_B_select_tx_fifo_threshold(SI32_SPI_B_Type* /*basePointer*/,
 ///  threshold
 ///  Threshold.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_select_rx_fifo_threshold(
+   SI32_SPI_B_Type * basePointer,
+   // Threshold.
+   SI32_SPI_B_FIFO_THRESHOLD_Enum_Type threshold)
+{
+   //{{
+   switch (threshold)
+   {
+      case 0:
+         basePointer->CONFIG_CLR = SI32_SPI_B_CONFIG_RFTH_MASK;
+         break;
+      case 1:
+         basePointer->CONFIG_CLR = SI32_SPI_B_CONFIG_RFTH_MASK;
+         basePointer->CONFIG_SET = SI32_SPI_B_CONFIG_RFTH_TWO_U32;
+         break;
+      case 2:
+         basePointer->CONFIG_CLR = SI32_SPI_B_CONFIG_RFTH_MASK;
+         basePointer->CONFIG_SET = SI32_SPI_B_CONFIG_RFTH_FOUR_U32;
+         break;
+      case 3:
+         basePointer->CONFIG_SET = SI32_SPI_B_CONFIG_RFTH_FULL_U32;
+         break;
+      default:
+         break;
+   }
+   //}}
+}
+#else
 void
 _SI32_SPI_B_select_rx_fifo_threshold(SI32_SPI_B_Type* /*basePointer*/,
    SI32_SPI_B_FIFO_THRESHOLD_Enum_Type /*threshold*/);
+#endif
 ///
 /// @def SI32_SPI_B_select_rx_fifo_threshold(basePointer, threshold)
 #define SI32_SPI_B_select_rx_fifo_threshold(basePointer, threshold) \
@@ -1330,9 +2328,23 @@ _SI32_SPI_B_select_rx_fifo_threshold(SI32_SPI_B_Type* /*basePointer*/,
 ///  Valid range is 1 to 16.
 ///  Number of bits per transfer (1-16).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_set_data_length(
+   SI32_SPI_B_Type * basePointer,
+   // Number of bits per transfer (1-16).
+   uint32_t dlength)
+{
+   assert((dlength >= 1) && (dlength <= 16));
+   //{{
+   basePointer->CONFIG.DSIZE = (dlength - 1);
+   //}}
+}
+#else
 void
 _SI32_SPI_B_set_data_length(SI32_SPI_B_Type* /*basePointer*/,
    uint32_t /*dlength*/);
+#endif
 ///
 /// @def SI32_SPI_B_set_data_length(basePointer, dlength)
 #define SI32_SPI_B_set_data_length(basePointer, dlength) \
@@ -1344,8 +2356,19 @@ _SI32_SPI_B_set_data_length(SI32_SPI_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_enable_dma_requests(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_B_CONFIG_DMAEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_enable_dma_requests(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_enable_dma_requests(basePointer)
 #define SI32_SPI_B_enable_dma_requests(basePointer) \
@@ -1357,8 +2380,19 @@ _SI32_SPI_B_enable_dma_requests(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_disable_dma_requests(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SPI_B_CONFIG_DMAEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_disable_dma_requests(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_disable_dma_requests(basePointer)
 #define SI32_SPI_B_disable_dma_requests(basePointer) \
@@ -1370,8 +2404,19 @@ _SI32_SPI_B_disable_dma_requests(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_flush_rx_fifo(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_B_CONFIG_RFIFOFL_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_flush_rx_fifo(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_flush_rx_fifo(basePointer)
 #define SI32_SPI_B_flush_rx_fifo(basePointer) \
@@ -1383,8 +2428,19 @@ _SI32_SPI_B_flush_rx_fifo(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_flush_tx_fifo(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_B_CONFIG_TFIFOFL_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_flush_tx_fifo(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_flush_tx_fifo(basePointer)
 #define SI32_SPI_B_flush_tx_fifo(basePointer) \
@@ -1400,8 +2456,19 @@ _SI32_SPI_B_flush_tx_fifo(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_reset_module(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SPI_B_CONFIG_RESET_ACTIVE_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_reset_module(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_reset_module(basePointer)
 #define SI32_SPI_B_reset_module(basePointer) \
@@ -1416,8 +2483,19 @@ _SI32_SPI_B_reset_module(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SPI_B_is_module_reset_pending(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   return (bool) basePointer->CONFIG.RESET;
+   //}}
+}
+#else
 bool
 _SI32_SPI_B_is_module_reset_pending(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_is_module_reset_pending(basePointer)
 #define SI32_SPI_B_is_module_reset_pending(basePointer) \
@@ -1432,8 +2510,19 @@ _SI32_SPI_B_is_module_reset_pending(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide16_t
+_SI32_SPI_B_read_clkrate(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   return basePointer->CLKRATE.U32;
+   //}}
+}
+#else
 uwide16_t
 _SI32_SPI_B_read_clkrate(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_read_clkrate(basePointer)
 #define SI32_SPI_B_read_clkrate(basePointer) \
@@ -1453,9 +2542,22 @@ _SI32_SPI_B_read_clkrate(SI32_SPI_B_Type* /*basePointer*/);
 ///  clkrate
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_write_clkrate(
+   SI32_SPI_B_Type * basePointer,
+   uwide16_t clkrate)
+{
+   assert(clkrate < 65536);   // clkrate < 2^16
+   //{{
+   basePointer->CLKRATE.U32 = clkrate;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_write_clkrate(SI32_SPI_B_Type* /*basePointer*/,
    uwide16_t /*clkrate*/);
+#endif
 ///
 /// @def SI32_SPI_B_write_clkrate(basePointer, clkrate)
 #define SI32_SPI_B_write_clkrate(basePointer, clkrate) \
@@ -1473,9 +2575,23 @@ _SI32_SPI_B_write_clkrate(SI32_SPI_B_Type* /*basePointer*/,
 ///  Valid range is 1 to 131072.
 ///  Clock rate divider value.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_set_clock_divisor(
+   SI32_SPI_B_Type * basePointer,
+   // Clock rate divider value.
+   uint32_t divisor)
+{
+   assert((divisor >= 1) && (divisor <= 131072));
+   //{{
+   basePointer->CLKRATE.CLKDIV = ((divisor/2)-1);
+   //}}
+}
+#else
 void
 _SI32_SPI_B_set_clock_divisor(SI32_SPI_B_Type* /*basePointer*/,
    uint32_t /*divisor*/);
+#endif
 ///
 /// @def SI32_SPI_B_set_clock_divisor(basePointer, divisor)
 #define SI32_SPI_B_set_clock_divisor(basePointer, divisor) \
@@ -1490,8 +2606,19 @@ _SI32_SPI_B_set_clock_divisor(SI32_SPI_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_SPI_B_read_configmd(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+   return basePointer->CONFIGMD.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_SPI_B_read_configmd(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_read_configmd(basePointer)
 #define SI32_SPI_B_read_configmd(basePointer) \
@@ -1511,9 +2638,21 @@ _SI32_SPI_B_read_configmd(SI32_SPI_B_Type* /*basePointer*/);
 ///  configmd
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_write_configmd(
+   SI32_SPI_B_Type * basePointer,
+   uint32_t configmd)
+{
+   //{{
+   basePointer->CONFIGMD.U32 = configmd;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_write_configmd(SI32_SPI_B_Type* /*basePointer*/,
    uint32_t /*configmd*/);
+#endif
 ///
 /// @def SI32_SPI_B_write_configmd(basePointer, configmd)
 #define SI32_SPI_B_write_configmd(basePointer, configmd) \
@@ -1525,8 +2664,19 @@ _SI32_SPI_B_write_configmd(SI32_SPI_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_select_operation_mode_normal(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIGMD_CLR = SI32_SPI_B_CONFIGMD_OPMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_select_operation_mode_normal(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_select_operation_mode_normal(basePointer)
 #define SI32_SPI_B_select_operation_mode_normal(basePointer) \
@@ -1538,8 +2688,20 @@ _SI32_SPI_B_select_operation_mode_normal(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_select_operation_mode_receive_only(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIGMD_CLR = SI32_SPI_B_CONFIGMD_OPMD_MASK;
+	basePointer->CONFIGMD_SET = SI32_SPI_B_CONFIGMD_OPMD_RECEIVE_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_select_operation_mode_receive_only(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_select_operation_mode_receive_only(basePointer)
 #define SI32_SPI_B_select_operation_mode_receive_only(basePointer) do{  \
@@ -1553,8 +2715,20 @@ _SI32_SPI_B_select_operation_mode_receive_only(SI32_SPI_B_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_select_operation_mode_transmit_only(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIGMD_CLR = SI32_SPI_B_CONFIGMD_OPMD_MASK;
+	basePointer->CONFIGMD_SET = SI32_SPI_B_CONFIGMD_OPMD_TRANSMIT_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_select_operation_mode_transmit_only(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_select_operation_mode_transmit_only(basePointer)
 #define SI32_SPI_B_select_operation_mode_transmit_only(basePointer) do{  \
@@ -1568,8 +2742,19 @@ _SI32_SPI_B_select_operation_mode_transmit_only(SI32_SPI_B_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_select_operation_mode_flow_control(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIGMD_SET = SI32_SPI_B_CONFIGMD_OPMD_FLOWCONTROL_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_select_operation_mode_flow_control(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_select_operation_mode_flow_control(basePointer)
 #define SI32_SPI_B_select_operation_mode_flow_control(basePointer) \
@@ -1585,8 +2770,19 @@ _SI32_SPI_B_select_operation_mode_flow_control(SI32_SPI_B_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_enable_auto_nss_mode(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIGMD_SET = SI32_SPI_B_CONFIGMD_AUTONSS_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_enable_auto_nss_mode(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_enable_auto_nss_mode(basePointer)
 #define SI32_SPI_B_enable_auto_nss_mode(basePointer) \
@@ -1602,8 +2798,19 @@ _SI32_SPI_B_enable_auto_nss_mode(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_disable_auto_nss_mode(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIGMD_CLR = SI32_SPI_B_CONFIGMD_AUTONSS_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_disable_auto_nss_mode(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_disable_auto_nss_mode(basePointer)
 #define SI32_SPI_B_disable_auto_nss_mode(basePointer) \
@@ -1615,8 +2822,19 @@ _SI32_SPI_B_disable_auto_nss_mode(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_enable_cts_flow_control(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIGMD_SET = SI32_SPI_B_CONFIGMD_CTSEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_enable_cts_flow_control(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_enable_cts_flow_control(basePointer)
 #define SI32_SPI_B_enable_cts_flow_control(basePointer) \
@@ -1628,8 +2846,19 @@ _SI32_SPI_B_enable_cts_flow_control(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_disable_cts_flow_control(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIGMD_CLR = SI32_SPI_B_CONFIGMD_CTSEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_disable_cts_flow_control(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_disable_cts_flow_control(basePointer)
 #define SI32_SPI_B_disable_cts_flow_control(basePointer) \
@@ -1641,8 +2870,19 @@ _SI32_SPI_B_disable_cts_flow_control(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_enable_flow_control_mode(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIGMD_SET = SI32_SPI_B_CONFIGMD_FLOWMD_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_enable_flow_control_mode(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_enable_flow_control_mode(basePointer)
 #define SI32_SPI_B_enable_flow_control_mode(basePointer) \
@@ -1654,8 +2894,19 @@ _SI32_SPI_B_enable_flow_control_mode(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_disable_flow_control_mode(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIGMD_CLR = SI32_SPI_B_CONFIGMD_FLOWMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_disable_flow_control_mode(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_disable_flow_control_mode(basePointer)
 #define SI32_SPI_B_disable_flow_control_mode(basePointer) \
@@ -1671,8 +2922,19 @@ _SI32_SPI_B_disable_flow_control_mode(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_enable_software_abort(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIGMD_SET = SI32_SPI_B_CONFIGMD_ABORT_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_enable_software_abort(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_enable_software_abort(basePointer)
 #define SI32_SPI_B_enable_software_abort(basePointer) \
@@ -1684,8 +2946,19 @@ _SI32_SPI_B_enable_software_abort(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_disable_software_abort(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIGMD_CLR = SI32_SPI_B_CONFIGMD_ABORT_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_disable_software_abort(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_disable_software_abort(basePointer)
 #define SI32_SPI_B_disable_software_abort(basePointer) \
@@ -1697,8 +2970,19 @@ _SI32_SPI_B_disable_software_abort(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_enable_transmit_data_on_request(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIGMD_SET = SI32_SPI_B_CONFIGMD_TXONREQ_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_enable_transmit_data_on_request(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_enable_transmit_data_on_request(basePointer)
 #define SI32_SPI_B_enable_transmit_data_on_request(basePointer) \
@@ -1710,8 +2994,19 @@ _SI32_SPI_B_enable_transmit_data_on_request(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_disable_transmit_data_on_request(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIGMD_CLR = SI32_SPI_B_CONFIGMD_TXONREQ_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_disable_transmit_data_on_request(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_disable_transmit_data_on_request(basePointer)
 #define SI32_SPI_B_disable_transmit_data_on_request(basePointer) \
@@ -1731,9 +3026,23 @@ _SI32_SPI_B_disable_transmit_data_on_request(SI32_SPI_B_Type* /*basePointer*/);
 ///  nsscnt
 ///  Valid range is 8 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_select_nss_data_count(
+   SI32_SPI_B_Type * basePointer,
+   uint32_t nsscnt)
+{
+   assert(nsscnt < 256);   // nsscnt < 2^8
+   //{{
+	basePointer->CONFIGMD_CLR = SI32_SPI_B_CONFIGMD_NSSCNT_MASK;
+	basePointer->CONFIGMD_SET = nsscnt << SI32_SPI_B_CONFIGMD_NSSCNT_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_select_nss_data_count(SI32_SPI_B_Type* /*basePointer*/,
    uint32_t /*nsscnt*/);
+#endif
 ///
 /// @def SI32_SPI_B_select_nss_data_count(basePointer, nsscnt)
 #define SI32_SPI_B_select_nss_data_count(basePointer, nsscnt) do{  \
@@ -1757,9 +3066,23 @@ _SI32_SPI_B_select_nss_data_count(SI32_SPI_B_Type* /*basePointer*/,
 ///  nssdelay
 ///  Valid range is 8 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_select_nss_delay(
+   SI32_SPI_B_Type * basePointer,
+   uint32_t nssdelay)
+{
+   assert(nssdelay < 256);   // nssdelay < 2^8
+   //{{
+	basePointer->CONFIGMD_CLR = SI32_SPI_B_CONFIGMD_NSSDELAY_MASK;
+	basePointer->CONFIGMD_SET = nssdelay << SI32_SPI_B_CONFIGMD_NSSDELAY_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_select_nss_delay(SI32_SPI_B_Type* /*basePointer*/,
    uint32_t /*nssdelay*/);
+#endif
 ///
 /// @def SI32_SPI_B_select_nss_delay(basePointer, nssdelay)
 #define SI32_SPI_B_select_nss_delay(basePointer, nssdelay) do{  \
@@ -1773,8 +3096,19 @@ _SI32_SPI_B_select_nss_delay(SI32_SPI_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_select_transfer_count_auto(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIGMD_CLR = SI32_SPI_B_CONFIGMD_TFRCNT_MASK;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_select_transfer_count_auto(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_select_transfer_count_auto(basePointer)
 #define SI32_SPI_B_select_transfer_count_auto(basePointer) \
@@ -1786,8 +3120,20 @@ _SI32_SPI_B_select_transfer_count_auto(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_select_transfer_count_one(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIGMD_CLR = SI32_SPI_B_CONFIGMD_TFRCNT_MASK;
+	basePointer->CONFIGMD_SET = SI32_SPI_B_CONFIGMD_TFRCNT_TRANSFER1_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_select_transfer_count_one(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_select_transfer_count_one(basePointer)
 #define SI32_SPI_B_select_transfer_count_one(basePointer) do{  \
@@ -1801,8 +3147,20 @@ _SI32_SPI_B_select_transfer_count_one(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_select_transfer_count_two(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIGMD_CLR = SI32_SPI_B_CONFIGMD_TFRCNT_MASK;
+	basePointer->CONFIGMD_SET = SI32_SPI_B_CONFIGMD_TFRCNT_TRANSFER2_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_select_transfer_count_two(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_select_transfer_count_two(basePointer)
 #define SI32_SPI_B_select_transfer_count_two(basePointer) do{  \
@@ -1816,8 +3174,20 @@ _SI32_SPI_B_select_transfer_count_two(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_select_transfer_count_three(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIGMD_CLR = SI32_SPI_B_CONFIGMD_TFRCNT_MASK;
+	basePointer->CONFIGMD_SET = SI32_SPI_B_CONFIGMD_TFRCNT_TRANSFER3_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_select_transfer_count_three(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_select_transfer_count_three(basePointer)
 #define SI32_SPI_B_select_transfer_count_three(basePointer) do{  \
@@ -1831,8 +3201,20 @@ _SI32_SPI_B_select_transfer_count_three(SI32_SPI_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SPI_B_select_transfer_count_four(
+   SI32_SPI_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIGMD_CLR = SI32_SPI_B_CONFIGMD_TFRCNT_MASK;
+	basePointer->CONFIGMD_SET = SI32_SPI_B_CONFIGMD_TFRCNT_TRANSFER4_U32;
+   //}}
+}
+#else
 void
 _SI32_SPI_B_select_transfer_count_four(SI32_SPI_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SPI_B_select_transfer_count_four(basePointer)
 #define SI32_SPI_B_select_transfer_count_four(basePointer) do{  \
@@ -57,10 +57,26 @@ extern "C" {
 ///  Valid range is 32 bits.
 ///  Write to CONTROL register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SSG_A_initialize(
+   SI32_SSG_A_Type * basePointer,
+   // Write to CONFIG register.
+   uint32_t config,
+   // Write to CONTROL register.
+   uint32_t control)
+{
+   //{{
+   basePointer->CONFIG.U32 = config;
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_SSG_A_initialize(SI32_SSG_A_Type* /*basePointer*/,
    uint32_t, /*config*/
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_SSG_A_initialize(basePointer, config, control)
 #define SI32_SSG_A_initialize(basePointer, config, control) do{  \
@@ -80,9 +96,22 @@ _SI32_SSG_A_initialize(SI32_SSG_A_Type* /*basePointer*/,
 ///  Valid range is 32 bits.
 ///  Write to CONFIG register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SSG_A_write_config(
+   SI32_SSG_A_Type * basePointer,
+   // Write to CONFIG register.
+   uint32_t config)
+{
+   //{{
+   basePointer->CONFIG.U32 = config;
+   //}}
+}
+#else
 void
 _SI32_SSG_A_write_config(SI32_SSG_A_Type* /*basePointer*/,
    uint32_t /*config*/);
+#endif
 ///
 /// @def SI32_SSG_A_write_config(basePointer, config)
 #define SI32_SSG_A_write_config(basePointer, config) \
@@ -97,8 +126,19 @@ _SI32_SSG_A_write_config(SI32_SSG_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_SSG_A_read_config(
+   SI32_SSG_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONFIG.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_SSG_A_read_config(SI32_SSG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SSG_A_read_config(basePointer)
 #define SI32_SSG_A_read_config(basePointer) \
@@ -116,9 +156,23 @@ _SI32_SSG_A_read_config(SI32_SSG_A_Type* /*basePointer*/);
 ///  Valid range is 12 bits.
 ///  Desired count.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SSG_A_set_conversion_count(
+   SI32_SSG_A_Type * basePointer,
+   // Desired count.
+   uint32_t count)
+{
+   assert(count < 4096);   // count < 2^12
+   //{{
+   basePointer->CONFIG.COUNT = count;
+   //}}
+}
+#else
 void
 _SI32_SSG_A_set_conversion_count(SI32_SSG_A_Type* /*basePointer*/,
    uint32_t /*count*/);
+#endif
 ///
 /// @def SI32_SSG_A_set_conversion_count(basePointer, count)
 #define SI32_SSG_A_set_conversion_count(basePointer, count) \
@@ -130,8 +184,19 @@ _SI32_SSG_A_set_conversion_count(SI32_SSG_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SSG_A_select_speed_normal(
+   SI32_SSG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG.SSEL = SI32_SSG_A_CONFIG_SSEL_NORMAL_VALUE;
+   //}}
+}
+#else
 void
 _SI32_SSG_A_select_speed_normal(SI32_SSG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SSG_A_select_speed_normal(basePointer)
 #define SI32_SSG_A_select_speed_normal(basePointer) \
@@ -143,8 +208,19 @@ _SI32_SSG_A_select_speed_normal(SI32_SSG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SSG_A_select_speed_double(
+   SI32_SSG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG.SSEL = SI32_SSG_A_CONFIG_SSEL_DOUBLE_VALUE;
+   //}}
+}
+#else
 void
 _SI32_SSG_A_select_speed_double(SI32_SSG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SSG_A_select_speed_double(basePointer)
 #define SI32_SSG_A_select_speed_double(basePointer) \
@@ -156,8 +232,19 @@ _SI32_SSG_A_select_speed_double(SI32_SSG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SSG_A_start_phase_generator_freerun(
+   SI32_SSG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG.PHGFREN = SI32_SSG_A_CONFIG_PHGFREN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_SSG_A_start_phase_generator_freerun(SI32_SSG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SSG_A_start_phase_generator_freerun(basePointer)
 #define SI32_SSG_A_start_phase_generator_freerun(basePointer) \
@@ -169,8 +256,19 @@ _SI32_SSG_A_start_phase_generator_freerun(SI32_SSG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SSG_A_stop_phase_generator_freerun(
+   SI32_SSG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG.PHGFREN = SI32_SSG_A_CONFIG_PHGFREN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_SSG_A_stop_phase_generator_freerun(SI32_SSG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SSG_A_stop_phase_generator_freerun(basePointer)
 #define SI32_SSG_A_stop_phase_generator_freerun(basePointer) \
@@ -182,8 +280,19 @@ _SI32_SSG_A_stop_phase_generator_freerun(SI32_SSG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SSG_A_start_pulse_generator_freerun(
+   SI32_SSG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG.PUGFREN = SI32_SSG_A_CONFIG_PUGFREN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_SSG_A_start_pulse_generator_freerun(SI32_SSG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SSG_A_start_pulse_generator_freerun(basePointer)
 #define SI32_SSG_A_start_pulse_generator_freerun(basePointer) \
@@ -195,8 +304,19 @@ _SI32_SSG_A_start_pulse_generator_freerun(SI32_SSG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SSG_A_stop_pulse_generator_freerun(
+   SI32_SSG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG.PUGFREN = SI32_SSG_A_CONFIG_PUGFREN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_SSG_A_stop_pulse_generator_freerun(SI32_SSG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SSG_A_stop_pulse_generator_freerun(basePointer)
 #define SI32_SSG_A_stop_pulse_generator_freerun(basePointer) \
@@ -214,9 +334,22 @@ _SI32_SSG_A_stop_pulse_generator_freerun(SI32_SSG_A_Type* /*basePointer*/);
 ///  Valid range is 32 bits.
 ///  Write to CONTROL register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SSG_A_write_control(
+   SI32_SSG_A_Type * basePointer,
+   // Write to CONTROL register.
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_SSG_A_write_control(SI32_SSG_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_SSG_A_write_control(basePointer, control)
 #define SI32_SSG_A_write_control(basePointer, control) \
@@ -231,8 +364,19 @@ _SI32_SSG_A_write_control(SI32_SSG_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_SSG_A_read_control(
+   SI32_SSG_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_SSG_A_read_control(SI32_SSG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SSG_A_read_control(basePointer)
 #define SI32_SSG_A_read_control(basePointer) \
@@ -244,8 +388,19 @@ _SI32_SSG_A_read_control(SI32_SSG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SSG_A_enable_ex0_output_inversion(
+   SI32_SSG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_SSG_A_CONTROL_EX0INVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SSG_A_enable_ex0_output_inversion(SI32_SSG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SSG_A_enable_ex0_output_inversion(basePointer)
 #define SI32_SSG_A_enable_ex0_output_inversion(basePointer) \
@@ -257,8 +412,19 @@ _SI32_SSG_A_enable_ex0_output_inversion(SI32_SSG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SSG_A_disable_ex0_output_inversion(
+   SI32_SSG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SSG_A_CONTROL_EX0INVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SSG_A_disable_ex0_output_inversion(SI32_SSG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SSG_A_disable_ex0_output_inversion(basePointer)
 #define SI32_SSG_A_disable_ex0_output_inversion(basePointer) \
@@ -270,8 +436,19 @@ _SI32_SSG_A_disable_ex0_output_inversion(SI32_SSG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SSG_A_enable_ex1_output_inversion(
+   SI32_SSG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_SSG_A_CONTROL_EX1INVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SSG_A_enable_ex1_output_inversion(SI32_SSG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SSG_A_enable_ex1_output_inversion(basePointer)
 #define SI32_SSG_A_enable_ex1_output_inversion(basePointer) \
@@ -283,8 +460,19 @@ _SI32_SSG_A_enable_ex1_output_inversion(SI32_SSG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SSG_A_disable_ex1_output_inversion(
+   SI32_SSG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SSG_A_CONTROL_EX1INVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SSG_A_disable_ex1_output_inversion(SI32_SSG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SSG_A_disable_ex1_output_inversion(basePointer)
 #define SI32_SSG_A_disable_ex1_output_inversion(basePointer) \
@@ -296,8 +484,19 @@ _SI32_SSG_A_disable_ex1_output_inversion(SI32_SSG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SSG_A_enable_ex2_output_inversion(
+   SI32_SSG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_SSG_A_CONTROL_EX2INVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SSG_A_enable_ex2_output_inversion(SI32_SSG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SSG_A_enable_ex2_output_inversion(basePointer)
 #define SI32_SSG_A_enable_ex2_output_inversion(basePointer) \
@@ -309,8 +508,19 @@ _SI32_SSG_A_enable_ex2_output_inversion(SI32_SSG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SSG_A_disable_ex2_output_inversion(
+   SI32_SSG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SSG_A_CONTROL_EX2INVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SSG_A_disable_ex2_output_inversion(SI32_SSG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SSG_A_disable_ex2_output_inversion(basePointer)
 #define SI32_SSG_A_disable_ex2_output_inversion(basePointer) \
@@ -322,8 +532,19 @@ _SI32_SSG_A_disable_ex2_output_inversion(SI32_SSG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SSG_A_enable_ex3_output_inversion(
+   SI32_SSG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_SSG_A_CONTROL_EX3INVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SSG_A_enable_ex3_output_inversion(SI32_SSG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SSG_A_enable_ex3_output_inversion(basePointer)
 #define SI32_SSG_A_enable_ex3_output_inversion(basePointer) \
@@ -335,8 +556,19 @@ _SI32_SSG_A_enable_ex3_output_inversion(SI32_SSG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SSG_A_disable_ex3_output_inversion(
+   SI32_SSG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SSG_A_CONTROL_EX3INVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SSG_A_disable_ex3_output_inversion(SI32_SSG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SSG_A_disable_ex3_output_inversion(basePointer)
 #define SI32_SSG_A_disable_ex3_output_inversion(basePointer) \
@@ -348,8 +580,19 @@ _SI32_SSG_A_disable_ex3_output_inversion(SI32_SSG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SSG_A_enable_ex0_output(
+   SI32_SSG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_SSG_A_CONTROL_EX0EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SSG_A_enable_ex0_output(SI32_SSG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SSG_A_enable_ex0_output(basePointer)
 #define SI32_SSG_A_enable_ex0_output(basePointer) \
@@ -361,8 +604,19 @@ _SI32_SSG_A_enable_ex0_output(SI32_SSG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SSG_A_disable_ex0_output(
+   SI32_SSG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SSG_A_CONTROL_EX0EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SSG_A_disable_ex0_output(SI32_SSG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SSG_A_disable_ex0_output(basePointer)
 #define SI32_SSG_A_disable_ex0_output(basePointer) \
@@ -374,8 +628,19 @@ _SI32_SSG_A_disable_ex0_output(SI32_SSG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SSG_A_enable_ex1_output(
+   SI32_SSG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_SSG_A_CONTROL_EX1EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SSG_A_enable_ex1_output(SI32_SSG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SSG_A_enable_ex1_output(basePointer)
 #define SI32_SSG_A_enable_ex1_output(basePointer) \
@@ -387,8 +652,19 @@ _SI32_SSG_A_enable_ex1_output(SI32_SSG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SSG_A_disable_ex1_output(
+   SI32_SSG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SSG_A_CONTROL_EX1EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SSG_A_disable_ex1_output(SI32_SSG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SSG_A_disable_ex1_output(basePointer)
 #define SI32_SSG_A_disable_ex1_output(basePointer) \
@@ -400,8 +676,19 @@ _SI32_SSG_A_disable_ex1_output(SI32_SSG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SSG_A_enable_ex2_output(
+   SI32_SSG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_SSG_A_CONTROL_EX2EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SSG_A_enable_ex2_output(SI32_SSG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SSG_A_enable_ex2_output(basePointer)
 #define SI32_SSG_A_enable_ex2_output(basePointer) \
@@ -413,8 +700,19 @@ _SI32_SSG_A_enable_ex2_output(SI32_SSG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SSG_A_disable_ex2_output(
+   SI32_SSG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SSG_A_CONTROL_EX2EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SSG_A_disable_ex2_output(SI32_SSG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SSG_A_disable_ex2_output(basePointer)
 #define SI32_SSG_A_disable_ex2_output(basePointer) \
@@ -426,8 +724,19 @@ _SI32_SSG_A_disable_ex2_output(SI32_SSG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SSG_A_enable_ex3_output(
+   SI32_SSG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_SSG_A_CONTROL_EX3EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SSG_A_enable_ex3_output(SI32_SSG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SSG_A_enable_ex3_output(basePointer)
 #define SI32_SSG_A_enable_ex3_output(basePointer) \
@@ -439,8 +748,19 @@ _SI32_SSG_A_enable_ex3_output(SI32_SSG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SSG_A_disable_ex3_output(
+   SI32_SSG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_SSG_A_CONTROL_EX3EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SSG_A_disable_ex3_output(SI32_SSG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SSG_A_disable_ex3_output(basePointer)
 #define SI32_SSG_A_disable_ex3_output(basePointer) \
@@ -452,8 +772,19 @@ _SI32_SSG_A_disable_ex3_output(SI32_SSG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_SSG_A_is_active(
+   SI32_SSG_A_Type * basePointer)
+{
+   //{{
+   return (bool) (basePointer->CONTROL.STATUS);
+   //}}
+}
+#else
 bool
 _SI32_SSG_A_is_active(SI32_SSG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SSG_A_is_active(basePointer)
 #define SI32_SSG_A_is_active(basePointer) \
@@ -69,12 +69,34 @@ extern "C" {
 ///  Valid range is 32 bits.
 ///  Write to CAPTURE register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_initialize(
+   SI32_TIMER_A_Type * basePointer,
+   // Write to CONFIG register.
+   uint32_t config,
+   // Write to CLKDIV register.
+   uint32_t clkdiv,
+   // Write to COUNT register.
+   uint32_t count,
+   // Write to CAPTURE register.
+   uint32_t capture)
+{
+   //{{
+   basePointer->CONFIG.U32  = config;
+   basePointer->CLKDIV.U32  = clkdiv;
+   basePointer->COUNT.U32   = count;
+   basePointer->CAPTURE.U32 = capture;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_initialize(SI32_TIMER_A_Type* /*basePointer*/,
    uint32_t, /*config*/
    uint32_t, /*clkdiv*/
    uint32_t, /*count*/
    uint32_t /*capture*/);
+#endif
 ///
 /// @def SI32_TIMER_A_initialize(basePointer, config, clkdiv, count, capture)
 #define SI32_TIMER_A_initialize(basePointer, config, clkdiv, count, capture) do{  \
@@ -98,9 +120,21 @@ _SI32_TIMER_A_initialize(SI32_TIMER_A_Type* /*basePointer*/,
 ///  config
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_write_config(
+   SI32_TIMER_A_Type * basePointer,
+   uint32_t config)
+{
+   //{{
+   basePointer->CONFIG.U32 = config;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_write_config(SI32_TIMER_A_Type* /*basePointer*/,
    uint32_t /*config*/);
+#endif
 ///
 /// @def SI32_TIMER_A_write_config(basePointer, config)
 #define SI32_TIMER_A_write_config(basePointer, config) \
@@ -115,8 +149,19 @@ _SI32_TIMER_A_write_config(SI32_TIMER_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_TIMER_A_read_config(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONFIG.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_TIMER_A_read_config(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_read_config(basePointer)
 #define SI32_TIMER_A_read_config(basePointer) \
@@ -128,8 +173,20 @@ _SI32_TIMER_A_read_config(SI32_TIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_select_low_clock_source_apb_clock(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_LCLK_MASK;
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_LCLK_APB_U32;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_select_low_clock_source_apb_clock(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_select_low_clock_source_apb_clock(basePointer)
 #define SI32_TIMER_A_select_low_clock_source_apb_clock(basePointer) do{  \
@@ -143,8 +200,20 @@ _SI32_TIMER_A_select_low_clock_source_apb_clock(SI32_TIMER_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_select_low_clock_source_external_oscillator(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_LCLK_MASK;
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_LCLK_EXTOSCN_U32;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_select_low_clock_source_external_oscillator(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_select_low_clock_source_external_oscillator(basePointer)
 #define SI32_TIMER_A_select_low_clock_source_external_oscillator(basePointer) do{  \
@@ -158,8 +227,20 @@ _SI32_TIMER_A_select_low_clock_source_external_oscillator(SI32_TIMER_A_Type* /*b
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_select_low_clock_source_timer_clock_divider(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_LCLK_MASK;
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_LCLK_TIMER_CLKDIV_U32;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_select_low_clock_source_timer_clock_divider(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_select_low_clock_source_timer_clock_divider(basePointer)
 #define SI32_TIMER_A_select_low_clock_source_timer_clock_divider(basePointer) do{  \
@@ -173,8 +254,20 @@ _SI32_TIMER_A_select_low_clock_source_timer_clock_divider(SI32_TIMER_A_Type* /*b
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_select_low_clock_source_external_ct_pin(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_LCLK_MASK;
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_LCLK_CT_FALLING_EDGE_U32;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_select_low_clock_source_external_ct_pin(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_select_low_clock_source_external_ct_pin(basePointer)
 #define SI32_TIMER_A_select_low_clock_source_external_ct_pin(basePointer) do{  \
@@ -188,8 +281,19 @@ _SI32_TIMER_A_select_low_clock_source_external_ct_pin(SI32_TIMER_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_enable_low_clock_master_synchronization(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_LMSTREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_enable_low_clock_master_synchronization(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_enable_low_clock_master_synchronization(basePointer)
 #define SI32_TIMER_A_enable_low_clock_master_synchronization(basePointer) \
@@ -201,8 +305,19 @@ _SI32_TIMER_A_enable_low_clock_master_synchronization(SI32_TIMER_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_disable_low_clock_master_synchronization(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_LMSTREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_disable_low_clock_master_synchronization(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_disable_low_clock_master_synchronization(basePointer)
 #define SI32_TIMER_A_disable_low_clock_master_synchronization(basePointer) \
@@ -214,8 +329,19 @@ _SI32_TIMER_A_disable_low_clock_master_synchronization(SI32_TIMER_A_Type* /*base
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_select_split_timer_mode(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_SPLITEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_select_split_timer_mode(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_select_split_timer_mode(basePointer)
 #define SI32_TIMER_A_select_split_timer_mode(basePointer) \
@@ -227,8 +353,19 @@ _SI32_TIMER_A_select_split_timer_mode(SI32_TIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_select_single_timer_mode(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_SPLITEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_select_single_timer_mode(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_select_single_timer_mode(basePointer)
 #define SI32_TIMER_A_select_single_timer_mode(basePointer) \
@@ -240,8 +377,19 @@ _SI32_TIMER_A_select_single_timer_mode(SI32_TIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_enable_low_extra_interrupt(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_LEXIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_enable_low_extra_interrupt(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_enable_low_extra_interrupt(basePointer)
 #define SI32_TIMER_A_enable_low_extra_interrupt(basePointer) \
@@ -253,8 +401,19 @@ _SI32_TIMER_A_enable_low_extra_interrupt(SI32_TIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_disable_low_extra_interrupt(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_LEXIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_disable_low_extra_interrupt(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_disable_low_extra_interrupt(basePointer)
 #define SI32_TIMER_A_disable_low_extra_interrupt(basePointer) \
@@ -266,8 +425,19 @@ _SI32_TIMER_A_disable_low_extra_interrupt(SI32_TIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_enable_low_overflow_interrupt(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_LOVFIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_enable_low_overflow_interrupt(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_enable_low_overflow_interrupt(basePointer)
 #define SI32_TIMER_A_enable_low_overflow_interrupt(basePointer) \
@@ -279,8 +449,19 @@ _SI32_TIMER_A_enable_low_overflow_interrupt(SI32_TIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_disable_low_overflow_interrupt(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_LOVFIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_disable_low_overflow_interrupt(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_disable_low_overflow_interrupt(basePointer)
 #define SI32_TIMER_A_disable_low_overflow_interrupt(basePointer) \
@@ -292,8 +473,19 @@ _SI32_TIMER_A_disable_low_overflow_interrupt(SI32_TIMER_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_TIMER_A_is_low_overflow_interrupt_enabled(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONFIG.LOVFIEN);
+   //}}
+}
+#else
 bool
 _SI32_TIMER_A_is_low_overflow_interrupt_enabled(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_is_low_overflow_interrupt_enabled(basePointer)
 #define SI32_TIMER_A_is_low_overflow_interrupt_enabled(basePointer) \
@@ -305,8 +497,20 @@ _SI32_TIMER_A_is_low_overflow_interrupt_enabled(SI32_TIMER_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_select_low_auto_reload_mode(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_LMD_MASK;
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_LMD_AUTO_RELOAD_U32;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_select_low_auto_reload_mode(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_select_low_auto_reload_mode(basePointer)
 #define SI32_TIMER_A_select_low_auto_reload_mode(basePointer) do{  \
@@ -320,8 +524,20 @@ _SI32_TIMER_A_select_low_auto_reload_mode(SI32_TIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_select_low_up_down_mode(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_LMD_MASK;
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_LMD_UP_DOWN_U32;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_select_low_up_down_mode(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_select_low_up_down_mode(basePointer)
 #define SI32_TIMER_A_select_low_up_down_mode(basePointer) do{  \
@@ -335,8 +551,20 @@ _SI32_TIMER_A_select_low_up_down_mode(SI32_TIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_select_low_falling_edge_capture_mode(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_LMD_MASK;
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_LMD_FALL_CAPTURE_U32;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_select_low_falling_edge_capture_mode(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_select_low_falling_edge_capture_mode(basePointer)
 #define SI32_TIMER_A_select_low_falling_edge_capture_mode(basePointer) do{  \
@@ -350,8 +578,20 @@ _SI32_TIMER_A_select_low_falling_edge_capture_mode(SI32_TIMER_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_select_low_rising_edge_capture_mode(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_LMD_MASK;
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_LMD_RISE_CAPTURE_U32;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_select_low_rising_edge_capture_mode(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_select_low_rising_edge_capture_mode(basePointer)
 #define SI32_TIMER_A_select_low_rising_edge_capture_mode(basePointer) do{  \
@@ -365,8 +605,20 @@ _SI32_TIMER_A_select_low_rising_edge_capture_mode(SI32_TIMER_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_select_low_capture_low_time_mode(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_LMD_MASK;
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_LMD_LOW_CAPTURE_U32;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_select_low_capture_low_time_mode(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_select_low_capture_low_time_mode(basePointer)
 #define SI32_TIMER_A_select_low_capture_low_time_mode(basePointer) do{  \
@@ -380,8 +632,20 @@ _SI32_TIMER_A_select_low_capture_low_time_mode(SI32_TIMER_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_select_low_capture_high_time_mode(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_LMD_MASK;
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_LMD_HIGH_CAPTURE_U32;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_select_low_capture_high_time_mode(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_select_low_capture_high_time_mode(basePointer)
 #define SI32_TIMER_A_select_low_capture_high_time_mode(basePointer) do{  \
@@ -395,8 +659,20 @@ _SI32_TIMER_A_select_low_capture_high_time_mode(SI32_TIMER_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_select_low_duty_cycle_capture_mode(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_LMD_MASK;
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_LMD_DC_CAPTURE_U32;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_select_low_duty_cycle_capture_mode(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_select_low_duty_cycle_capture_mode(basePointer)
 #define SI32_TIMER_A_select_low_duty_cycle_capture_mode(basePointer) do{  \
@@ -410,8 +686,20 @@ _SI32_TIMER_A_select_low_duty_cycle_capture_mode(SI32_TIMER_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_select_low_oneshot_mode(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_LMD_MASK;
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_LMD_ONESHOT_U32;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_select_low_oneshot_mode(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_select_low_oneshot_mode(basePointer)
 #define SI32_TIMER_A_select_low_oneshot_mode(basePointer) do{  \
@@ -425,8 +713,19 @@ _SI32_TIMER_A_select_low_oneshot_mode(SI32_TIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_set_low_state_indicator(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_LSTATE_MASK;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_set_low_state_indicator(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_set_low_state_indicator(basePointer)
 #define SI32_TIMER_A_set_low_state_indicator(basePointer) \
@@ -438,8 +737,19 @@ _SI32_TIMER_A_set_low_state_indicator(SI32_TIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_clear_low_state_indicator(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_LSTATE_MASK;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_clear_low_state_indicator(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_clear_low_state_indicator(basePointer)
 #define SI32_TIMER_A_clear_low_state_indicator(basePointer) \
@@ -455,8 +765,19 @@ _SI32_TIMER_A_clear_low_state_indicator(SI32_TIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_TIMER_A_get_low_state_indicator(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONFIG.LSTATE);
+   //}}
+}
+#else
 bool
 _SI32_TIMER_A_get_low_state_indicator(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_get_low_state_indicator(basePointer)
 #define SI32_TIMER_A_get_low_state_indicator(basePointer) \
@@ -468,8 +789,19 @@ _SI32_TIMER_A_get_low_state_indicator(SI32_TIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_start_low_timer(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_LRUN_MASK;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_start_low_timer(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_start_low_timer(basePointer)
 #define SI32_TIMER_A_start_low_timer(basePointer) \
@@ -481,8 +813,19 @@ _SI32_TIMER_A_start_low_timer(SI32_TIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_stop_low_timer(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_LRUN_MASK;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_stop_low_timer(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_stop_low_timer(basePointer)
 #define SI32_TIMER_A_stop_low_timer(basePointer) \
@@ -494,8 +837,19 @@ _SI32_TIMER_A_stop_low_timer(SI32_TIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_TIMER_A_is_low_extra_interrupt_pending(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   return (bool) (basePointer->CONFIG.LEXI);
+   //}}
+}
+#else
 bool
 _SI32_TIMER_A_is_low_extra_interrupt_pending(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_is_low_extra_interrupt_pending(basePointer)
 #define SI32_TIMER_A_is_low_extra_interrupt_pending(basePointer) \
@@ -507,8 +861,19 @@ _SI32_TIMER_A_is_low_extra_interrupt_pending(SI32_TIMER_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_clear_low_extra_interrupt(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_LEXI_MASK;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_clear_low_extra_interrupt(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_clear_low_extra_interrupt(basePointer)
 #define SI32_TIMER_A_clear_low_extra_interrupt(basePointer) \
@@ -520,8 +885,19 @@ _SI32_TIMER_A_clear_low_extra_interrupt(SI32_TIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_TIMER_A_is_low_overflow_interrupt_pending(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   return (bool) (basePointer->CONFIG.LOVFI);
+   //}}
+}
+#else
 bool
 _SI32_TIMER_A_is_low_overflow_interrupt_pending(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_is_low_overflow_interrupt_pending(basePointer)
 #define SI32_TIMER_A_is_low_overflow_interrupt_pending(basePointer) \
@@ -533,8 +909,19 @@ _SI32_TIMER_A_is_low_overflow_interrupt_pending(SI32_TIMER_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_clear_low_overflow_interrupt(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_LOVFI_MASK;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_clear_low_overflow_interrupt(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_clear_low_overflow_interrupt(basePointer)
 #define SI32_TIMER_A_clear_low_overflow_interrupt(basePointer) \
@@ -546,8 +933,20 @@ _SI32_TIMER_A_clear_low_overflow_interrupt(SI32_TIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_select_high_clock_source_apb_clock(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_HCLK_MASK;
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_HCLK_APB_U32;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_select_high_clock_source_apb_clock(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_select_high_clock_source_apb_clock(basePointer)
 #define SI32_TIMER_A_select_high_clock_source_apb_clock(basePointer) do{  \
@@ -561,8 +960,20 @@ _SI32_TIMER_A_select_high_clock_source_apb_clock(SI32_TIMER_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_select_high_clock_source_external_oscillator(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_HCLK_MASK;
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_HCLK_EXTOSCN_U32;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_select_high_clock_source_external_oscillator(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_select_high_clock_source_external_oscillator(basePointer)
 #define SI32_TIMER_A_select_high_clock_source_external_oscillator(basePointer) do{  \
@@ -576,8 +987,20 @@ _SI32_TIMER_A_select_high_clock_source_external_oscillator(SI32_TIMER_A_Type* /*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_select_high_clock_source_timer_clock_divider(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_HCLK_MASK;
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_HCLK_TIMER_CLKDIV_U32;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_select_high_clock_source_timer_clock_divider(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_select_high_clock_source_timer_clock_divider(basePointer)
 #define SI32_TIMER_A_select_high_clock_source_timer_clock_divider(basePointer) do{  \
@@ -591,8 +1014,20 @@ _SI32_TIMER_A_select_high_clock_source_timer_clock_divider(SI32_TIMER_A_Type* /*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_select_high_clock_source_external_ct_pin(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_HCLK_MASK;
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_HCLK_CT_FALLING_EDGE_U32;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_select_high_clock_source_external_ct_pin(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_select_high_clock_source_external_ct_pin(basePointer)
 #define SI32_TIMER_A_select_high_clock_source_external_ct_pin(basePointer) do{  \
@@ -609,8 +1044,19 @@ _SI32_TIMER_A_select_high_clock_source_external_ct_pin(SI32_TIMER_A_Type* /*base
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_start_master_run_control(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_MSTRUN_MASK;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_start_master_run_control(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_start_master_run_control(basePointer)
 #define SI32_TIMER_A_start_master_run_control(basePointer) \
@@ -625,8 +1071,19 @@ _SI32_TIMER_A_start_master_run_control(SI32_TIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_stop_master_run_control(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_MSTRUN_MASK;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_stop_master_run_control(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_stop_master_run_control(basePointer)
 #define SI32_TIMER_A_stop_master_run_control(basePointer) \
@@ -638,8 +1095,19 @@ _SI32_TIMER_A_stop_master_run_control(SI32_TIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_enable_high_clock_master_synchronization(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_HMSTREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_enable_high_clock_master_synchronization(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_enable_high_clock_master_synchronization(basePointer)
 #define SI32_TIMER_A_enable_high_clock_master_synchronization(basePointer) \
@@ -651,8 +1119,19 @@ _SI32_TIMER_A_enable_high_clock_master_synchronization(SI32_TIMER_A_Type* /*base
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_disable_high_clock_master_synchronization(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_HMSTREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_disable_high_clock_master_synchronization(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_disable_high_clock_master_synchronization(basePointer)
 #define SI32_TIMER_A_disable_high_clock_master_synchronization(basePointer) \
@@ -664,8 +1143,19 @@ _SI32_TIMER_A_disable_high_clock_master_synchronization(SI32_TIMER_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_enable_stall_in_debug_mode(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_DBGMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_enable_stall_in_debug_mode(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_enable_stall_in_debug_mode(basePointer)
 #define SI32_TIMER_A_enable_stall_in_debug_mode(basePointer) \
@@ -677,8 +1167,19 @@ _SI32_TIMER_A_enable_stall_in_debug_mode(SI32_TIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_disable_stall_in_debug_mode(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_DBGMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_disable_stall_in_debug_mode(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_disable_stall_in_debug_mode(basePointer)
 #define SI32_TIMER_A_disable_stall_in_debug_mode(basePointer) \
@@ -690,8 +1191,19 @@ _SI32_TIMER_A_disable_stall_in_debug_mode(SI32_TIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_enable_high_extra_interrupt(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_HEXIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_enable_high_extra_interrupt(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_enable_high_extra_interrupt(basePointer)
 #define SI32_TIMER_A_enable_high_extra_interrupt(basePointer) \
@@ -703,8 +1215,19 @@ _SI32_TIMER_A_enable_high_extra_interrupt(SI32_TIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_disable_high_extra_interrupt(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_HEXIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_disable_high_extra_interrupt(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_disable_high_extra_interrupt(basePointer)
 #define SI32_TIMER_A_disable_high_extra_interrupt(basePointer) \
@@ -716,8 +1239,19 @@ _SI32_TIMER_A_disable_high_extra_interrupt(SI32_TIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_enable_high_overflow_interrupt(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_HOVFIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_enable_high_overflow_interrupt(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_enable_high_overflow_interrupt(basePointer)
 #define SI32_TIMER_A_enable_high_overflow_interrupt(basePointer) \
@@ -729,8 +1263,19 @@ _SI32_TIMER_A_enable_high_overflow_interrupt(SI32_TIMER_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_disable_high_overflow_interrupt(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_HOVFIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_disable_high_overflow_interrupt(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_disable_high_overflow_interrupt(basePointer)
 #define SI32_TIMER_A_disable_high_overflow_interrupt(basePointer) \
@@ -742,8 +1287,19 @@ _SI32_TIMER_A_disable_high_overflow_interrupt(SI32_TIMER_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_TIMER_A_is_high_overflow_interrupt_enabled(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONFIG.HOVFIEN);
+   //}}
+}
+#else
 bool
 _SI32_TIMER_A_is_high_overflow_interrupt_enabled(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_is_high_overflow_interrupt_enabled(basePointer)
 #define SI32_TIMER_A_is_high_overflow_interrupt_enabled(basePointer) \
@@ -755,8 +1311,20 @@ _SI32_TIMER_A_is_high_overflow_interrupt_enabled(SI32_TIMER_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_select_high_auto_reload_mode(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_HMD_MASK;
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_HMD_AUTO_RELOAD_U32;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_select_high_auto_reload_mode(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_select_high_auto_reload_mode(basePointer)
 #define SI32_TIMER_A_select_high_auto_reload_mode(basePointer) do{  \
@@ -770,8 +1338,20 @@ _SI32_TIMER_A_select_high_auto_reload_mode(SI32_TIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_select_high_up_down_mode(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_HMD_MASK;
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_HMD_UP_DOWN_U32;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_select_high_up_down_mode(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_select_high_up_down_mode(basePointer)
 #define SI32_TIMER_A_select_high_up_down_mode(basePointer) do{  \
@@ -785,8 +1365,20 @@ _SI32_TIMER_A_select_high_up_down_mode(SI32_TIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_select_high_falling_edge_capture_mode(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_HMD_MASK;
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_HMD_FALL_CAPTURE_U32;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_select_high_falling_edge_capture_mode(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_select_high_falling_edge_capture_mode(basePointer)
 #define SI32_TIMER_A_select_high_falling_edge_capture_mode(basePointer) do{  \
@@ -800,8 +1392,20 @@ _SI32_TIMER_A_select_high_falling_edge_capture_mode(SI32_TIMER_A_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_select_high_rising_edge_capture_mode(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_HMD_MASK;
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_HMD_RISE_CAPTURE_U32;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_select_high_rising_edge_capture_mode(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_select_high_rising_edge_capture_mode(basePointer)
 #define SI32_TIMER_A_select_high_rising_edge_capture_mode(basePointer) do{  \
@@ -815,8 +1419,20 @@ _SI32_TIMER_A_select_high_rising_edge_capture_mode(SI32_TIMER_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_select_high_capture_low_time_mode(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_HMD_MASK;
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_HMD_LOW_CAPTURE_U32;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_select_high_capture_low_time_mode(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_select_high_capture_low_time_mode(basePointer)
 #define SI32_TIMER_A_select_high_capture_low_time_mode(basePointer) do{  \
@@ -830,8 +1446,20 @@ _SI32_TIMER_A_select_high_capture_low_time_mode(SI32_TIMER_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_select_high_capture_high_time_mode(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_HMD_MASK;
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_HMD_HIGH_CAPTURE_U32;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_select_high_capture_high_time_mode(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_select_high_capture_high_time_mode(basePointer)
 #define SI32_TIMER_A_select_high_capture_high_time_mode(basePointer) do{  \
@@ -845,8 +1473,20 @@ _SI32_TIMER_A_select_high_capture_high_time_mode(SI32_TIMER_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_select_high_duty_cycle_capture_mode(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_HMD_MASK;
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_HMD_DC_CAPTURE_U32;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_select_high_duty_cycle_capture_mode(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_select_high_duty_cycle_capture_mode(basePointer)
 #define SI32_TIMER_A_select_high_duty_cycle_capture_mode(basePointer) do{  \
@@ -860,8 +1500,20 @@ _SI32_TIMER_A_select_high_duty_cycle_capture_mode(SI32_TIMER_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_select_high_oneshot_mode(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_HMD_MASK;
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_HMD_ONESHOT_U32;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_select_high_oneshot_mode(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_select_high_oneshot_mode(basePointer)
 #define SI32_TIMER_A_select_high_oneshot_mode(basePointer) do{  \
@@ -875,8 +1527,20 @@ _SI32_TIMER_A_select_high_oneshot_mode(SI32_TIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_select_square_wave_output_mode(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_HMD_MASK;
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_HMD_TOGGLE_U32;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_select_square_wave_output_mode(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_select_square_wave_output_mode(basePointer)
 #define SI32_TIMER_A_select_square_wave_output_mode(basePointer) do{  \
@@ -890,8 +1554,20 @@ _SI32_TIMER_A_select_square_wave_output_mode(SI32_TIMER_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_select_high_pwm_mode(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_HMD_MASK;
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_HMD_PWM_U32;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_select_high_pwm_mode(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_select_high_pwm_mode(basePointer)
 #define SI32_TIMER_A_select_high_pwm_mode(basePointer) do{  \
@@ -905,8 +1581,19 @@ _SI32_TIMER_A_select_high_pwm_mode(SI32_TIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_set_high_state_indicator(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_HSTATE_MASK;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_set_high_state_indicator(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_set_high_state_indicator(basePointer)
 #define SI32_TIMER_A_set_high_state_indicator(basePointer) \
@@ -918,8 +1605,19 @@ _SI32_TIMER_A_set_high_state_indicator(SI32_TIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_clear_high_state_indicator(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_HSTATE_MASK;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_clear_high_state_indicator(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_clear_high_state_indicator(basePointer)
 #define SI32_TIMER_A_clear_high_state_indicator(basePointer) \
@@ -931,8 +1629,19 @@ _SI32_TIMER_A_clear_high_state_indicator(SI32_TIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_TIMER_A_get_high_state_indicator(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   return (bool) (basePointer->CONFIG.HSTATE);
+   //}}
+}
+#else
 bool
 _SI32_TIMER_A_get_high_state_indicator(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_get_high_state_indicator(basePointer)
 #define SI32_TIMER_A_get_high_state_indicator(basePointer) \
@@ -944,8 +1653,19 @@ _SI32_TIMER_A_get_high_state_indicator(SI32_TIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_start_high_timer(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_TIMER_A_CONFIG_HRUN_MASK;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_start_high_timer(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_start_high_timer(basePointer)
 #define SI32_TIMER_A_start_high_timer(basePointer) \
@@ -957,8 +1677,19 @@ _SI32_TIMER_A_start_high_timer(SI32_TIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_stop_high_timer(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_HRUN_MASK;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_stop_high_timer(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_stop_high_timer(basePointer)
 #define SI32_TIMER_A_stop_high_timer(basePointer) \
@@ -970,8 +1701,19 @@ _SI32_TIMER_A_stop_high_timer(SI32_TIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_TIMER_A_is_high_extra_interrupt_pending(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONFIG.HEXI);
+   //}}
+}
+#else
 bool
 _SI32_TIMER_A_is_high_extra_interrupt_pending(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_is_high_extra_interrupt_pending(basePointer)
 #define SI32_TIMER_A_is_high_extra_interrupt_pending(basePointer) \
@@ -983,8 +1725,19 @@ _SI32_TIMER_A_is_high_extra_interrupt_pending(SI32_TIMER_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_clear_high_extra_interrupt(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_HEXI_MASK;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_clear_high_extra_interrupt(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_clear_high_extra_interrupt(basePointer)
 #define SI32_TIMER_A_clear_high_extra_interrupt(basePointer) \
@@ -996,8 +1749,19 @@ _SI32_TIMER_A_clear_high_extra_interrupt(SI32_TIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_TIMER_A_is_high_overflow_interrupt_pending(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONFIG.HOVFI);
+   //}}
+}
+#else
 bool
 _SI32_TIMER_A_is_high_overflow_interrupt_pending(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_is_high_overflow_interrupt_pending(basePointer)
 #define SI32_TIMER_A_is_high_overflow_interrupt_pending(basePointer) \
@@ -1009,8 +1773,19 @@ _SI32_TIMER_A_is_high_overflow_interrupt_pending(SI32_TIMER_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_clear_high_overflow_interrupt(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_TIMER_A_CONFIG_HOVFI_MASK;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_clear_high_overflow_interrupt(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_clear_high_overflow_interrupt(basePointer)
 #define SI32_TIMER_A_clear_high_overflow_interrupt(basePointer) \
@@ -1030,9 +1805,21 @@ _SI32_TIMER_A_clear_high_overflow_interrupt(SI32_TIMER_A_Type* /*basePointer*/);
 ///  clkdiv
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_write_clkdiv(
+   SI32_TIMER_A_Type * basePointer,
+   uint32_t clkdiv)
+{
+   //{{
+   basePointer->CLKDIV.U32 = clkdiv;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_write_clkdiv(SI32_TIMER_A_Type* /*basePointer*/,
    uint32_t /*clkdiv*/);
+#endif
 ///
 /// @def SI32_TIMER_A_write_clkdiv(basePointer, clkdiv)
 #define SI32_TIMER_A_write_clkdiv(basePointer, clkdiv) \
@@ -1047,8 +1834,19 @@ _SI32_TIMER_A_write_clkdiv(SI32_TIMER_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_TIMER_A_read_clkdiv(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CLKDIV.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_TIMER_A_read_clkdiv(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_read_clkdiv(basePointer)
 #define SI32_TIMER_A_read_clkdiv(basePointer) \
@@ -1065,9 +1863,22 @@ _SI32_TIMER_A_read_clkdiv(SI32_TIMER_A_Type* /*basePointer*/);
 ///  counter
 ///  Valid range is 8 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_set_clock_divider_counter(
+   SI32_TIMER_A_Type * basePointer,
+   uint32_t counter)
+{
+   assert(counter < 256);   // counter < 2^8
+   //{{
+   basePointer->CLKDIV.CLKDIVCT = counter;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_set_clock_divider_counter(SI32_TIMER_A_Type* /*basePointer*/,
    uint32_t /*counter*/);
+#endif
 ///
 /// @def SI32_TIMER_A_set_clock_divider_counter(basePointer, counter)
 #define SI32_TIMER_A_set_clock_divider_counter(basePointer, counter) \
@@ -1084,9 +1895,22 @@ _SI32_TIMER_A_set_clock_divider_counter(SI32_TIMER_A_Type* /*basePointer*/,
 ///  reload
 ///  Valid range is 8 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_set_clock_divider_reload(
+   SI32_TIMER_A_Type * basePointer,
+   uint32_t reload)
+{
+   assert(reload < 256);   // reload < 2^8
+   //{{
+   basePointer->CLKDIV.CLKDIVRL = reload;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_set_clock_divider_reload(SI32_TIMER_A_Type* /*basePointer*/,
    uint32_t /*reload*/);
+#endif
 ///
 /// @def SI32_TIMER_A_set_clock_divider_reload(basePointer, reload)
 #define SI32_TIMER_A_set_clock_divider_reload(basePointer, reload) \
@@ -1106,9 +1930,21 @@ _SI32_TIMER_A_set_clock_divider_reload(SI32_TIMER_A_Type* /*basePointer*/,
 ///  count
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_write_count(
+   SI32_TIMER_A_Type * basePointer,
+   uint32_t count)
+{
+   //{{
+   basePointer->COUNT.U32 = count;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_write_count(SI32_TIMER_A_Type* /*basePointer*/,
    uint32_t /*count*/);
+#endif
 ///
 /// @def SI32_TIMER_A_write_count(basePointer, count)
 #define SI32_TIMER_A_write_count(basePointer, count) \
@@ -1123,8 +1959,19 @@ _SI32_TIMER_A_write_count(SI32_TIMER_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_TIMER_A_read_count(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   return basePointer->COUNT.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_TIMER_A_read_count(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_read_count(basePointer)
 #define SI32_TIMER_A_read_count(basePointer) \
@@ -1141,9 +1988,22 @@ _SI32_TIMER_A_read_count(SI32_TIMER_A_Type* /*basePointer*/);
 ///  count
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_set_high_count(
+   SI32_TIMER_A_Type * basePointer,
+   uint32_t count)
+{
+   assert(count < 65536);   // count < 2^16
+   //{{
+   basePointer->COUNT.HCOUNT = count;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_set_high_count(SI32_TIMER_A_Type* /*basePointer*/,
    uint32_t /*count*/);
+#endif
 ///
 /// @def SI32_TIMER_A_set_high_count(basePointer, count)
 #define SI32_TIMER_A_set_high_count(basePointer, count) \
@@ -1158,8 +2018,19 @@ _SI32_TIMER_A_set_high_count(SI32_TIMER_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_TIMER_A_get_high_count(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   return (basePointer->COUNT.HCOUNT);
+   //}}
+}
+#else
 uint32_t
 _SI32_TIMER_A_get_high_count(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_get_high_count(basePointer)
 #define SI32_TIMER_A_get_high_count(basePointer) \
@@ -1176,9 +2047,22 @@ _SI32_TIMER_A_get_high_count(SI32_TIMER_A_Type* /*basePointer*/);
 ///  count
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_set_low_count(
+   SI32_TIMER_A_Type * basePointer,
+   uint32_t count)
+{
+   assert(count < 65536);   // count < 2^16
+   //{{
+   basePointer->COUNT.LCOUNT = count;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_set_low_count(SI32_TIMER_A_Type* /*basePointer*/,
    uint32_t /*count*/);
+#endif
 ///
 /// @def SI32_TIMER_A_set_low_count(basePointer, count)
 #define SI32_TIMER_A_set_low_count(basePointer, count) \
@@ -1193,8 +2077,19 @@ _SI32_TIMER_A_set_low_count(SI32_TIMER_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_TIMER_A_get_low_count(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   return (basePointer->COUNT.LCOUNT);
+   //}}
+}
+#else
 uint32_t
 _SI32_TIMER_A_get_low_count(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_get_low_count(basePointer)
 #define SI32_TIMER_A_get_low_count(basePointer) \
@@ -1214,9 +2109,21 @@ _SI32_TIMER_A_get_low_count(SI32_TIMER_A_Type* /*basePointer*/);
 ///  capture
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_write_capture(
+   SI32_TIMER_A_Type * basePointer,
+   uint32_t capture)
+{
+   //{{
+   basePointer->CAPTURE.U32 = capture;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_write_capture(SI32_TIMER_A_Type* /*basePointer*/,
    uint32_t /*capture*/);
+#endif
 ///
 /// @def SI32_TIMER_A_write_capture(basePointer, capture)
 #define SI32_TIMER_A_write_capture(basePointer, capture) \
@@ -1231,8 +2138,19 @@ _SI32_TIMER_A_write_capture(SI32_TIMER_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_TIMER_A_read_capture(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CAPTURE.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_TIMER_A_read_capture(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_read_capture(basePointer)
 #define SI32_TIMER_A_read_capture(basePointer) \
@@ -1249,9 +2167,22 @@ _SI32_TIMER_A_read_capture(SI32_TIMER_A_Type* /*basePointer*/);
 ///  reload
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_set_high_reload(
+   SI32_TIMER_A_Type * basePointer,
+   uint32_t reload)
+{
+   assert(reload < 65536);   // reload < 2^16
+   //{{
+   basePointer->CAPTURE.HCCR = reload;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_set_high_reload(SI32_TIMER_A_Type* /*basePointer*/,
    uint32_t /*reload*/);
+#endif
 ///
 /// @def SI32_TIMER_A_set_high_reload(basePointer, reload)
 #define SI32_TIMER_A_set_high_reload(basePointer, reload) \
@@ -1263,8 +2194,19 @@ _SI32_TIMER_A_set_high_reload(SI32_TIMER_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_TIMER_A_get_high_capture(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   return (basePointer->CAPTURE.HCCR);
+   //}}
+}
+#else
 uint32_t
 _SI32_TIMER_A_get_high_capture(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_get_high_capture(basePointer)
 #define SI32_TIMER_A_get_high_capture(basePointer) \
@@ -1281,9 +2223,22 @@ _SI32_TIMER_A_get_high_capture(SI32_TIMER_A_Type* /*basePointer*/);
 ///  reload
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_TIMER_A_set_low_reload(
+   SI32_TIMER_A_Type * basePointer,
+   uint32_t reload)
+{
+   assert(reload < 65536);   // reload < 2^16
+   //{{
+   basePointer->CAPTURE.LCCR = reload;
+   //}}
+}
+#else
 void
 _SI32_TIMER_A_set_low_reload(SI32_TIMER_A_Type* /*basePointer*/,
    uint32_t /*reload*/);
+#endif
 ///
 /// @def SI32_TIMER_A_set_low_reload(basePointer, reload)
 #define SI32_TIMER_A_set_low_reload(basePointer, reload) \
@@ -1295,8 +2250,19 @@ _SI32_TIMER_A_set_low_reload(SI32_TIMER_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_TIMER_A_get_low_capture(
+   SI32_TIMER_A_Type * basePointer)
+{
+   //{{
+   return (basePointer->CAPTURE.LCCR);
+   //}}
+}
+#else
 uint32_t
 _SI32_TIMER_A_get_low_capture(SI32_TIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_TIMER_A_get_low_capture(basePointer)
 #define SI32_TIMER_A_get_low_capture(basePointer) \
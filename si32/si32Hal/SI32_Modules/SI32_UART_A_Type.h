@@ -88,6 +88,36 @@ extern "C" {
 ///  Valid range is 32 bits.
 ///  Write to FIFOCN register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_initialize(
+   SI32_UART_A_Type * basePointer,
+   // Write to CONFIG register.
+   uint32_t config,
+   // Write to MODE register.
+   uint32_t mode,
+   // Write to FLOWCN register.
+   uint32_t flowcn,
+   // Write to CONTROL register.
+   uint32_t control,
+   // Write to IPDELAY register.
+   uint32_t ipdelay,
+   // Write to BAUDRATE register.
+   uint32_t baudrate,
+   // Write to FIFOCN register.
+   uint32_t fifocn)
+{
+   //{{
+   basePointer->CONFIG.U32 = config;
+   basePointer->MODE.U32 = mode;
+   basePointer->FLOWCN.U32 = flowcn;
+   basePointer->CONTROL.U32 = control;
+   basePointer->IPDELAY.U32 = ipdelay;
+   basePointer->BAUDRATE.U32 = baudrate;
+   basePointer->FIFOCN.U32 = fifocn;
+   //}}
+}
+#else
 void
 _SI32_UART_A_initialize(SI32_UART_A_Type* /*basePointer*/,
    uint32_t, /*config*/
@@ -97,6 +127,7 @@ _SI32_UART_A_initialize(SI32_UART_A_Type* /*basePointer*/,
    uint32_t, /*ipdelay*/
    uint32_t, /*baudrate*/
    uint32_t /*fifocn*/);
+#endif
 ///
 /// @def SI32_UART_A_initialize(basePointer, config, mode, flowcn, control, ipdelay, baudrate, fifocn)
 #define SI32_UART_A_initialize(basePointer, config, mode, flowcn, control, ipdelay, baudrate, fifocn) \
@@ -116,9 +147,21 @@ _SI32_UART_A_initialize(SI32_UART_A_Type* /*basePointer*/,
 ///  config
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_write_config(
+   SI32_UART_A_Type * basePointer,
+   uint32_t config)
+{
+   //{{
+   basePointer->CONFIG.U32 = config;
+   //}}
+}
+#else
 void
 _SI32_UART_A_write_config(SI32_UART_A_Type* /*basePointer*/,
    uint32_t /*config*/);
+#endif
 ///
 /// @def SI32_UART_A_write_config(basePointer, config)
 #define SI32_UART_A_write_config(basePointer, config) \
@@ -133,8 +176,19 @@ _SI32_UART_A_write_config(SI32_UART_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_UART_A_read_config(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONFIG.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_UART_A_read_config(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_read_config(basePointer)
 #define SI32_UART_A_read_config(basePointer) \
@@ -146,8 +200,19 @@ _SI32_UART_A_read_config(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enable_rx_start_bit(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_UART_A_CONFIG_RSTRTEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enable_rx_start_bit(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enable_rx_start_bit(basePointer)
 #define SI32_UART_A_enable_rx_start_bit(basePointer) \
@@ -159,8 +224,19 @@ _SI32_UART_A_enable_rx_start_bit(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_disable_rx_start_bit(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_UART_A_CONFIG_RSTRTEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_disable_rx_start_bit(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_disable_rx_start_bit(basePointer)
 #define SI32_UART_A_disable_rx_start_bit(basePointer) \
@@ -172,8 +248,19 @@ _SI32_UART_A_disable_rx_start_bit(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enable_rx_parity_bit(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_UART_A_CONFIG_RPAREN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enable_rx_parity_bit(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enable_rx_parity_bit(basePointer)
 #define SI32_UART_A_enable_rx_parity_bit(basePointer) \
@@ -185,8 +272,19 @@ _SI32_UART_A_enable_rx_parity_bit(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_disable_rx_parity_bit(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_UART_A_CONFIG_RPAREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_disable_rx_parity_bit(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_disable_rx_parity_bit(basePointer)
 #define SI32_UART_A_disable_rx_parity_bit(basePointer) \
@@ -198,8 +296,19 @@ _SI32_UART_A_disable_rx_parity_bit(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enable_rx_stop_bit(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_UART_A_CONFIG_RSTPEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enable_rx_stop_bit(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enable_rx_stop_bit(basePointer)
 #define SI32_UART_A_enable_rx_stop_bit(basePointer) \
@@ -211,8 +320,19 @@ _SI32_UART_A_enable_rx_stop_bit(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_disable_rx_stop_bit(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_UART_A_CONFIG_RSTPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_disable_rx_stop_bit(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_disable_rx_stop_bit(basePointer)
 #define SI32_UART_A_disable_rx_stop_bit(basePointer) \
@@ -233,9 +353,23 @@ _SI32_UART_A_disable_rx_stop_bit(SI32_UART_A_Type* /*basePointer*/);
 ///  bits
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_select_rx_stop_bits(
+   SI32_UART_A_Type * basePointer,
+   SI32_UART_A_STOP_BITS_Enum_Type bits)
+{
+   assert(bits < 4);   // bits < 2^2
+   //{{
+   basePointer->CONFIG_CLR = SI32_UART_A_CONFIG_RSTPMD_MASK;
+   basePointer->CONFIG_SET = bits << SI32_UART_A_CONFIG_RSTPMD_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_UART_A_select_rx_stop_bits(SI32_UART_A_Type* /*basePointer*/,
    SI32_UART_A_STOP_BITS_Enum_Type /*bits*/);
+#endif
 ///
 /// @def SI32_UART_A_select_rx_stop_bits(basePointer, bits)
 #define SI32_UART_A_select_rx_stop_bits(basePointer, bits) do{  \
@@ -257,9 +391,23 @@ _SI32_UART_A_select_rx_stop_bits(SI32_UART_A_Type* /*basePointer*/,
 ///  parity
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_select_rx_parity(
+   SI32_UART_A_Type * basePointer,
+   SI32_UART_A_PARITY_Enum_Type parity)
+{
+   assert(parity < 4);   // parity < 2^2
+   //{{
+   basePointer->CONFIG_CLR = SI32_UART_A_CONFIG_RPARMD_MASK;
+   basePointer->CONFIG_SET = parity << SI32_UART_A_CONFIG_RPARMD_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_UART_A_select_rx_parity(SI32_UART_A_Type* /*basePointer*/,
    SI32_UART_A_PARITY_Enum_Type /*parity*/);
+#endif
 ///
 /// @def SI32_UART_A_select_rx_parity(basePointer, parity)
 #define SI32_UART_A_select_rx_parity(basePointer, parity) do{  \
@@ -282,9 +430,23 @@ _SI32_UART_A_select_rx_parity(SI32_UART_A_Type* /*basePointer*/,
 ///  length
 ///  Valid range is 5 to 10.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_select_rx_data_length(
+   SI32_UART_A_Type * basePointer,
+   SI32_UART_A_DATA_LENGTH_Enum_Type length)
+{
+   assert((length >= 5) && (length <= 10));
+   //{{
+   basePointer->CONFIG_CLR = SI32_UART_A_CONFIG_RDATLN_MASK;
+   basePointer->CONFIG_SET = (length - 5) << SI32_UART_A_CONFIG_RDATLN_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_UART_A_select_rx_data_length(SI32_UART_A_Type* /*basePointer*/,
    SI32_UART_A_DATA_LENGTH_Enum_Type /*length*/);
+#endif
 ///
 /// @def SI32_UART_A_select_rx_data_length(basePointer, length)
 #define SI32_UART_A_select_rx_data_length(basePointer, length) do{  \
@@ -298,8 +460,19 @@ _SI32_UART_A_select_rx_data_length(SI32_UART_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enable_rx_smartcard_parity_response(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_UART_A_CONFIG_RSCEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enable_rx_smartcard_parity_response(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enable_rx_smartcard_parity_response(basePointer)
 #define SI32_UART_A_enable_rx_smartcard_parity_response(basePointer) \
@@ -311,8 +484,19 @@ _SI32_UART_A_enable_rx_smartcard_parity_response(SI32_UART_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_disable_rx_smartcard_parity_response(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_UART_A_CONFIG_RSCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_disable_rx_smartcard_parity_response(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_disable_rx_smartcard_parity_response(basePointer)
 #define SI32_UART_A_disable_rx_smartcard_parity_response(basePointer) \
@@ -324,8 +508,19 @@ _SI32_UART_A_disable_rx_smartcard_parity_response(SI32_UART_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enable_rx_irda_mode(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_UART_A_CONFIG_RIRDAEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enable_rx_irda_mode(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enable_rx_irda_mode(basePointer)
 #define SI32_UART_A_enable_rx_irda_mode(basePointer) \
@@ -337,8 +532,19 @@ _SI32_UART_A_enable_rx_irda_mode(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_disable_rx_irda_mode(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_UART_A_CONFIG_RIRDAEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_disable_rx_irda_mode(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_disable_rx_irda_mode(basePointer)
 #define SI32_UART_A_disable_rx_irda_mode(basePointer) \
@@ -350,8 +556,19 @@ _SI32_UART_A_disable_rx_irda_mode(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enable_rx_signal_inversion(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_UART_A_CONFIG_RINVEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enable_rx_signal_inversion(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enable_rx_signal_inversion(basePointer)
 #define SI32_UART_A_enable_rx_signal_inversion(basePointer) \
@@ -363,8 +580,19 @@ _SI32_UART_A_enable_rx_signal_inversion(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_disable_rx_signal_inversion(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_UART_A_CONFIG_RINVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_disable_rx_signal_inversion(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_disable_rx_signal_inversion(basePointer)
 #define SI32_UART_A_disable_rx_signal_inversion(basePointer) \
@@ -376,8 +604,19 @@ _SI32_UART_A_disable_rx_signal_inversion(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enable_tx_start_bit(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_UART_A_CONFIG_TSTRTEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enable_tx_start_bit(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enable_tx_start_bit(basePointer)
 #define SI32_UART_A_enable_tx_start_bit(basePointer) \
@@ -389,8 +628,19 @@ _SI32_UART_A_enable_tx_start_bit(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_disable_tx_start_bit(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_UART_A_CONFIG_TSTRTEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_disable_tx_start_bit(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_disable_tx_start_bit(basePointer)
 #define SI32_UART_A_disable_tx_start_bit(basePointer) \
@@ -402,8 +652,19 @@ _SI32_UART_A_disable_tx_start_bit(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enable_tx_parity_bit(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_UART_A_CONFIG_TPAREN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enable_tx_parity_bit(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enable_tx_parity_bit(basePointer)
 #define SI32_UART_A_enable_tx_parity_bit(basePointer) \
@@ -415,8 +676,19 @@ _SI32_UART_A_enable_tx_parity_bit(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_disable_tx_parity_bit(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_UART_A_CONFIG_TPAREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_disable_tx_parity_bit(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_disable_tx_parity_bit(basePointer)
 #define SI32_UART_A_disable_tx_parity_bit(basePointer) \
@@ -428,8 +700,19 @@ _SI32_UART_A_disable_tx_parity_bit(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enable_tx_stop_bit(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_UART_A_CONFIG_TSTPEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enable_tx_stop_bit(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enable_tx_stop_bit(basePointer)
 #define SI32_UART_A_enable_tx_stop_bit(basePointer) \
@@ -441,8 +724,19 @@ _SI32_UART_A_enable_tx_stop_bit(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_disable_tx_stop_bit(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_UART_A_CONFIG_TSTPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_disable_tx_stop_bit(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_disable_tx_stop_bit(basePointer)
 #define SI32_UART_A_disable_tx_stop_bit(basePointer) \
@@ -463,9 +757,23 @@ _SI32_UART_A_disable_tx_stop_bit(SI32_UART_A_Type* /*basePointer*/);
 ///  bits
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_select_tx_stop_bits(
+   SI32_UART_A_Type * basePointer,
+   SI32_UART_A_STOP_BITS_Enum_Type bits)
+{
+   assert(bits < 4);   // bits < 2^2
+   //{{
+   basePointer->CONFIG_CLR = SI32_UART_A_CONFIG_TSTPMD_MASK;
+   basePointer->CONFIG_SET = bits << SI32_UART_A_CONFIG_TSTPMD_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_UART_A_select_tx_stop_bits(SI32_UART_A_Type* /*basePointer*/,
    SI32_UART_A_STOP_BITS_Enum_Type /*bits*/);
+#endif
 ///
 /// @def SI32_UART_A_select_tx_stop_bits(basePointer, bits)
 #define SI32_UART_A_select_tx_stop_bits(basePointer, bits) do{  \
@@ -487,9 +795,23 @@ _SI32_UART_A_select_tx_stop_bits(SI32_UART_A_Type* /*basePointer*/,
 ///  parity
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_select_tx_parity(
+   SI32_UART_A_Type * basePointer,
+   SI32_UART_A_PARITY_Enum_Type parity)
+{
+   assert(parity < 4);   // parity < 2^2
+   //{{
+   basePointer->CONFIG_CLR = SI32_UART_A_CONFIG_TPARMD_MASK;
+   basePointer->CONFIG_SET = parity << SI32_UART_A_CONFIG_TPARMD_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_UART_A_select_tx_parity(SI32_UART_A_Type* /*basePointer*/,
    SI32_UART_A_PARITY_Enum_Type /*parity*/);
+#endif
 ///
 /// @def SI32_UART_A_select_tx_parity(basePointer, parity)
 #define SI32_UART_A_select_tx_parity(basePointer, parity) do{  \
@@ -512,9 +834,23 @@ _SI32_UART_A_select_tx_parity(SI32_UART_A_Type* /*basePointer*/,
 ///  length
 ///  Valid range is 5 to 10.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_select_tx_data_length(
+   SI32_UART_A_Type * basePointer,
+   SI32_UART_A_DATA_LENGTH_Enum_Type length)
+{
+   assert((length >= 5) && (length <= 10));
+   //{{
+   basePointer->CONFIG_CLR = SI32_UART_A_CONFIG_TDATLN_MASK;
+   basePointer->CONFIG_SET = (length - 5) << SI32_UART_A_CONFIG_TDATLN_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_UART_A_select_tx_data_length(SI32_UART_A_Type* /*basePointer*/,
    SI32_UART_A_DATA_LENGTH_Enum_Type /*length*/);
+#endif
 ///
 /// @def SI32_UART_A_select_tx_data_length(basePointer, length)
 #define SI32_UART_A_select_tx_data_length(basePointer, length) do{  \
@@ -528,8 +864,19 @@ _SI32_UART_A_select_tx_data_length(SI32_UART_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enable_tx_smartcard_parity_check(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_UART_A_CONFIG_TSCEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enable_tx_smartcard_parity_check(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enable_tx_smartcard_parity_check(basePointer)
 #define SI32_UART_A_enable_tx_smartcard_parity_check(basePointer) \
@@ -541,8 +888,19 @@ _SI32_UART_A_enable_tx_smartcard_parity_check(SI32_UART_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_disable_tx_smartcard_parity_check(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_UART_A_CONFIG_TSCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_disable_tx_smartcard_parity_check(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_disable_tx_smartcard_parity_check(basePointer)
 #define SI32_UART_A_disable_tx_smartcard_parity_check(basePointer) \
@@ -554,8 +912,19 @@ _SI32_UART_A_disable_tx_smartcard_parity_check(SI32_UART_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enable_tx_irda_mode(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_UART_A_CONFIG_TIRDAEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enable_tx_irda_mode(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enable_tx_irda_mode(basePointer)
 #define SI32_UART_A_enable_tx_irda_mode(basePointer) \
@@ -567,8 +936,19 @@ _SI32_UART_A_enable_tx_irda_mode(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_disable_tx_irda_mode(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_UART_A_CONFIG_TIRDAEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_disable_tx_irda_mode(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_disable_tx_irda_mode(basePointer)
 #define SI32_UART_A_disable_tx_irda_mode(basePointer) \
@@ -580,8 +960,19 @@ _SI32_UART_A_disable_tx_irda_mode(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enable_tx_signal_inversion(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_UART_A_CONFIG_TINVEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enable_tx_signal_inversion(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enable_tx_signal_inversion(basePointer)
 #define SI32_UART_A_enable_tx_signal_inversion(basePointer) \
@@ -593,8 +984,19 @@ _SI32_UART_A_enable_tx_signal_inversion(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_disable_tx_signal_inversion(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_UART_A_CONFIG_TINVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_disable_tx_signal_inversion(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_disable_tx_signal_inversion(basePointer)
 #define SI32_UART_A_disable_tx_signal_inversion(basePointer) \
@@ -614,9 +1016,21 @@ _SI32_UART_A_disable_tx_signal_inversion(SI32_UART_A_Type* /*basePointer*/);
 ///  mode
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_write_mode(
+   SI32_UART_A_Type * basePointer,
+   uint32_t mode)
+{
+   //{{
+   basePointer->MODE.U32 = mode;
+   //}}
+}
+#else
 void
 _SI32_UART_A_write_mode(SI32_UART_A_Type* /*basePointer*/,
    uint32_t /*mode*/);
+#endif
 ///
 /// @def SI32_UART_A_write_mode(basePointer, mode)
 #define SI32_UART_A_write_mode(basePointer, mode) \
@@ -631,8 +1045,19 @@ _SI32_UART_A_write_mode(SI32_UART_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_UART_A_read_mode(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   return basePointer->MODE.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_UART_A_read_mode(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_read_mode(basePointer)
 #define SI32_UART_A_read_mode(basePointer) \
@@ -644,8 +1069,19 @@ _SI32_UART_A_read_mode(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enable_stall_in_debug_mode(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_SET = SI32_UART_A_MODE_DBGMD_HALT_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enable_stall_in_debug_mode(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enable_stall_in_debug_mode(basePointer)
 #define SI32_UART_A_enable_stall_in_debug_mode(basePointer) \
@@ -657,8 +1093,19 @@ _SI32_UART_A_enable_stall_in_debug_mode(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_disable_stall_in_debug_mode(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_CLR = SI32_UART_A_MODE_DBGMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_disable_stall_in_debug_mode(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_disable_stall_in_debug_mode(basePointer)
 #define SI32_UART_A_disable_stall_in_debug_mode(basePointer) \
@@ -670,8 +1117,19 @@ _SI32_UART_A_disable_stall_in_debug_mode(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_exit_loopback_mode(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_CLR = SI32_UART_A_MODE_LBMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_exit_loopback_mode(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_exit_loopback_mode(basePointer)
 #define SI32_UART_A_exit_loopback_mode(basePointer) \
@@ -683,8 +1141,20 @@ _SI32_UART_A_exit_loopback_mode(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enter_receive_loopback_mode(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_CLR = SI32_UART_A_MODE_LBMD_MASK;
+   basePointer->MODE_SET = SI32_UART_A_MODE_LBMD_RX_ONLY_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enter_receive_loopback_mode(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enter_receive_loopback_mode(basePointer)
 #define SI32_UART_A_enter_receive_loopback_mode(basePointer) do{  \
@@ -698,8 +1168,20 @@ _SI32_UART_A_enter_receive_loopback_mode(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enter_transmit_loopback_mode(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_CLR = SI32_UART_A_MODE_LBMD_MASK;
+   basePointer->MODE_SET = SI32_UART_A_MODE_LBMD_TX_ONLY_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enter_transmit_loopback_mode(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enter_transmit_loopback_mode(basePointer)
 #define SI32_UART_A_enter_transmit_loopback_mode(basePointer) do{  \
@@ -713,8 +1195,19 @@ _SI32_UART_A_enter_transmit_loopback_mode(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enter_full_loopback_mode(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_SET = SI32_UART_A_MODE_LBMD_BOTH_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enter_full_loopback_mode(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enter_full_loopback_mode(basePointer)
 #define SI32_UART_A_enter_full_loopback_mode(basePointer) \
@@ -726,8 +1219,19 @@ _SI32_UART_A_enter_full_loopback_mode(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enter_half_duplex_mode(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_SET = SI32_UART_A_MODE_DUPLEXMD_HALF_DUPLEX_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enter_half_duplex_mode(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enter_half_duplex_mode(basePointer)
 #define SI32_UART_A_enter_half_duplex_mode(basePointer) \
@@ -739,8 +1243,19 @@ _SI32_UART_A_enter_half_duplex_mode(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enter_full_duplex_mode(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_CLR = SI32_UART_A_MODE_DUPLEXMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enter_full_duplex_mode(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enter_full_duplex_mode(basePointer)
 #define SI32_UART_A_enter_full_duplex_mode(basePointer) \
@@ -752,8 +1267,19 @@ _SI32_UART_A_enter_full_duplex_mode(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enable_idle_tx_tristate(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_SET = SI32_UART_A_MODE_ITSEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enable_idle_tx_tristate(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enable_idle_tx_tristate(basePointer)
 #define SI32_UART_A_enable_idle_tx_tristate(basePointer) \
@@ -765,8 +1291,19 @@ _SI32_UART_A_enable_idle_tx_tristate(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_disable_idle_tx_tristate(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_CLR = SI32_UART_A_MODE_ITSEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_disable_idle_tx_tristate(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_disable_idle_tx_tristate(basePointer)
 #define SI32_UART_A_disable_idle_tx_tristate(basePointer) \
@@ -786,9 +1323,21 @@ _SI32_UART_A_disable_idle_tx_tristate(SI32_UART_A_Type* /*basePointer*/);
 ///  flowcn
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_write_flowcn(
+   SI32_UART_A_Type * basePointer,
+   uint32_t flowcn)
+{
+   //{{
+   basePointer->FLOWCN.U32 = flowcn;
+   //}}
+}
+#else
 void
 _SI32_UART_A_write_flowcn(SI32_UART_A_Type* /*basePointer*/,
    uint32_t /*flowcn*/);
+#endif
 ///
 /// @def SI32_UART_A_write_flowcn(basePointer, flowcn)
 #define SI32_UART_A_write_flowcn(basePointer, flowcn) \
@@ -803,8 +1352,19 @@ _SI32_UART_A_write_flowcn(SI32_UART_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_UART_A_read_flowcn(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   return basePointer->FLOWCN.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_UART_A_read_flowcn(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_read_flowcn(basePointer)
 #define SI32_UART_A_read_flowcn(basePointer) \
@@ -816,8 +1376,19 @@ _SI32_UART_A_read_flowcn(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_clear_rts(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FLOWCN_CLR = SI32_UART_A_FLOWCN_RTS_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_clear_rts(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_clear_rts(basePointer)
 #define SI32_UART_A_clear_rts(basePointer) \
@@ -829,8 +1400,19 @@ _SI32_UART_A_clear_rts(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_set_rts(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FLOWCN_SET = SI32_UART_A_FLOWCN_RTS_HIGH_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_set_rts(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_set_rts(basePointer)
 #define SI32_UART_A_set_rts(basePointer) \
@@ -842,8 +1424,19 @@ _SI32_UART_A_set_rts(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_A_read_rts_output(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->FLOWCN.RTS);
+   //}}
+}
+#else
 bool
 _SI32_UART_A_read_rts_output(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_read_rts_output(basePointer)
 #define SI32_UART_A_read_rts_output(basePointer) \
@@ -855,8 +1448,19 @@ _SI32_UART_A_read_rts_output(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_A_read_rx_input(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->FLOWCN.RX);
+   //}}
+}
+#else
 bool
 _SI32_UART_A_read_rx_input(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_read_rx_input(basePointer)
 #define SI32_UART_A_read_rx_input(basePointer) \
@@ -868,8 +1472,19 @@ _SI32_UART_A_read_rx_input(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enable_rts_inversion(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FLOWCN_SET = SI32_UART_A_FLOWCN_RTSINVEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enable_rts_inversion(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enable_rts_inversion(basePointer)
 #define SI32_UART_A_enable_rts_inversion(basePointer) \
@@ -881,8 +1496,19 @@ _SI32_UART_A_enable_rts_inversion(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_disable_rts_inversion(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FLOWCN_CLR = SI32_UART_A_FLOWCN_RTSINVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_disable_rts_inversion(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_disable_rts_inversion(basePointer)
 #define SI32_UART_A_disable_rts_inversion(basePointer) \
@@ -894,8 +1520,19 @@ _SI32_UART_A_disable_rts_inversion(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_select_rts_deassert_on_full(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FLOWCN_CLR = SI32_UART_A_FLOWCN_RTSTH_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_select_rts_deassert_on_full(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_select_rts_deassert_on_full(basePointer)
 #define SI32_UART_A_select_rts_deassert_on_full(basePointer) \
@@ -907,8 +1544,19 @@ _SI32_UART_A_select_rts_deassert_on_full(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_select_rts_deassert_on_byte_free(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FLOWCN_SET = SI32_UART_A_FLOWCN_RTSTH_ONE_BYTE_FREE_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_select_rts_deassert_on_byte_free(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_select_rts_deassert_on_byte_free(basePointer)
 #define SI32_UART_A_select_rts_deassert_on_byte_free(basePointer) \
@@ -920,8 +1568,19 @@ _SI32_UART_A_select_rts_deassert_on_byte_free(SI32_UART_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enable_rts(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FLOWCN_SET = SI32_UART_A_FLOWCN_RTSEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enable_rts(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enable_rts(basePointer)
 #define SI32_UART_A_enable_rts(basePointer) \
@@ -933,8 +1592,19 @@ _SI32_UART_A_enable_rts(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_disable_rts(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FLOWCN_CLR = SI32_UART_A_FLOWCN_RTSEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_disable_rts(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_disable_rts(basePointer)
 #define SI32_UART_A_disable_rts(basePointer) \
@@ -946,8 +1616,19 @@ _SI32_UART_A_disable_rts(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_A_read_cts_input(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->FLOWCN.CTS);
+   //}}
+}
+#else
 bool
 _SI32_UART_A_read_cts_input(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_read_cts_input(basePointer)
 #define SI32_UART_A_read_cts_input(basePointer) \
@@ -959,8 +1640,19 @@ _SI32_UART_A_read_cts_input(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_A_read_tx_output(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->FLOWCN.TX);
+   //}}
+}
+#else
 bool
 _SI32_UART_A_read_tx_output(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_read_tx_output(basePointer)
 #define SI32_UART_A_read_tx_output(basePointer) \
@@ -972,8 +1664,19 @@ _SI32_UART_A_read_tx_output(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_clear_tx(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FLOWCN_CLR = SI32_UART_A_FLOWCN_TX_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_clear_tx(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_clear_tx(basePointer)
 #define SI32_UART_A_clear_tx(basePointer) \
@@ -985,8 +1688,19 @@ _SI32_UART_A_clear_tx(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_set_tx(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FLOWCN_SET = SI32_UART_A_FLOWCN_TX_HIGH_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_set_tx(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_set_tx(basePointer)
 #define SI32_UART_A_set_tx(basePointer) \
@@ -998,8 +1712,19 @@ _SI32_UART_A_set_tx(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enable_cts_inversion(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FLOWCN_SET = SI32_UART_A_FLOWCN_CTSINVEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enable_cts_inversion(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enable_cts_inversion(basePointer)
 #define SI32_UART_A_enable_cts_inversion(basePointer) \
@@ -1011,8 +1736,19 @@ _SI32_UART_A_enable_cts_inversion(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_disable_cts_inversion(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FLOWCN_CLR = SI32_UART_A_FLOWCN_CTSINVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_disable_cts_inversion(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_disable_cts_inversion(basePointer)
 #define SI32_UART_A_disable_cts_inversion(basePointer) \
@@ -1024,8 +1760,19 @@ _SI32_UART_A_disable_cts_inversion(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enable_cts(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FLOWCN_SET = SI32_UART_A_FLOWCN_CTSEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enable_cts(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enable_cts(basePointer)
 #define SI32_UART_A_enable_cts(basePointer) \
@@ -1037,8 +1784,19 @@ _SI32_UART_A_enable_cts(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_disable_cts(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FLOWCN_CLR = SI32_UART_A_FLOWCN_CTSEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_disable_cts(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_disable_cts(basePointer)
 #define SI32_UART_A_disable_cts(basePointer) \
@@ -1060,9 +1818,23 @@ _SI32_UART_A_disable_cts(SI32_UART_A_Type* /*basePointer*/);
 ///  width
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_select_tx_irda_pulse_width(
+   SI32_UART_A_Type * basePointer,
+   SI32_UART_A_IRDA_PULSE_WIDTH_Enum_Type width)
+{
+   assert(width < 4);   // width < 2^2
+   //{{
+   basePointer->FLOWCN_CLR = SI32_UART_A_FLOWCN_TIRDAPW_MASK;
+   basePointer->FLOWCN_SET = width << SI32_UART_A_FLOWCN_TIRDAPW_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_UART_A_select_tx_irda_pulse_width(SI32_UART_A_Type* /*basePointer*/,
    SI32_UART_A_IRDA_PULSE_WIDTH_Enum_Type /*width*/);
+#endif
 ///
 /// @def SI32_UART_A_select_tx_irda_pulse_width(basePointer, width)
 #define SI32_UART_A_select_tx_irda_pulse_width(basePointer, width) do{  \
@@ -1084,9 +1856,21 @@ _SI32_UART_A_select_tx_irda_pulse_width(SI32_UART_A_Type* /*basePointer*/,
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_write_control(
+   SI32_UART_A_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_UART_A_write_control(SI32_UART_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_UART_A_write_control(basePointer, control)
 #define SI32_UART_A_write_control(basePointer, control) \
@@ -1101,8 +1885,19 @@ _SI32_UART_A_write_control(SI32_UART_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_UART_A_read_control(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_UART_A_read_control(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_read_control(basePointer)
 #define SI32_UART_A_read_control(basePointer) \
@@ -1114,8 +1909,19 @@ _SI32_UART_A_read_control(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_A_is_rx_frame_error_interrupt_pending(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.RFRMERI);
+   //}}
+}
+#else
 bool
 _SI32_UART_A_is_rx_frame_error_interrupt_pending(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_is_rx_frame_error_interrupt_pending(basePointer)
 #define SI32_UART_A_is_rx_frame_error_interrupt_pending(basePointer) \
@@ -1127,8 +1933,19 @@ _SI32_UART_A_is_rx_frame_error_interrupt_pending(SI32_UART_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_clear_rx_frame_error_interrupt(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_UART_A_CONTROL_RFRMERI_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_clear_rx_frame_error_interrupt(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_clear_rx_frame_error_interrupt(basePointer)
 #define SI32_UART_A_clear_rx_frame_error_interrupt(basePointer) \
@@ -1140,8 +1957,19 @@ _SI32_UART_A_clear_rx_frame_error_interrupt(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_A_is_rx_parity_error_interrupt_pending(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.RPARERI);
+   //}}
+}
+#else
 bool
 _SI32_UART_A_is_rx_parity_error_interrupt_pending(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_is_rx_parity_error_interrupt_pending(basePointer)
 #define SI32_UART_A_is_rx_parity_error_interrupt_pending(basePointer) \
@@ -1153,8 +1981,19 @@ _SI32_UART_A_is_rx_parity_error_interrupt_pending(SI32_UART_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_clear_rx_parity_error_interrupt(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_UART_A_CONTROL_RPARERI_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_clear_rx_parity_error_interrupt(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_clear_rx_parity_error_interrupt(basePointer)
 #define SI32_UART_A_clear_rx_parity_error_interrupt(basePointer) \
@@ -1166,8 +2005,19 @@ _SI32_UART_A_clear_rx_parity_error_interrupt(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_A_is_rx_overrun_interrupt_pending(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.ROREI);
+   //}}
+}
+#else
 bool
 _SI32_UART_A_is_rx_overrun_interrupt_pending(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_is_rx_overrun_interrupt_pending(basePointer)
 #define SI32_UART_A_is_rx_overrun_interrupt_pending(basePointer) \
@@ -1179,8 +2029,19 @@ _SI32_UART_A_is_rx_overrun_interrupt_pending(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_clear_rx_overrun_error_interrupt(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_UART_A_CONTROL_ROREI_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_clear_rx_overrun_error_interrupt(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_clear_rx_overrun_error_interrupt(basePointer)
 #define SI32_UART_A_clear_rx_overrun_error_interrupt(basePointer) \
@@ -1192,8 +2053,19 @@ _SI32_UART_A_clear_rx_overrun_error_interrupt(SI32_UART_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_A_is_rx_data_request_interrupt_pending(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.RDREQI);
+   //}}
+}
+#else
 bool
 _SI32_UART_A_is_rx_data_request_interrupt_pending(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_is_rx_data_request_interrupt_pending(basePointer)
 #define SI32_UART_A_is_rx_data_request_interrupt_pending(basePointer) \
@@ -1205,8 +2077,19 @@ _SI32_UART_A_is_rx_data_request_interrupt_pending(SI32_UART_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_clear_rx_data_request_interrupt(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_UART_A_CONTROL_RDREQI_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_clear_rx_data_request_interrupt(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_clear_rx_data_request_interrupt(basePointer)
 #define SI32_UART_A_clear_rx_data_request_interrupt(basePointer) \
@@ -1222,8 +2105,19 @@ _SI32_UART_A_clear_rx_data_request_interrupt(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enable_rx_error_interrupts(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_UART_A_CONTROL_RERIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enable_rx_error_interrupts(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enable_rx_error_interrupts(basePointer)
 #define SI32_UART_A_enable_rx_error_interrupts(basePointer) \
@@ -1239,8 +2133,19 @@ _SI32_UART_A_enable_rx_error_interrupts(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_disable_rx_error_interrupts(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_UART_A_CONTROL_RERIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_disable_rx_error_interrupts(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_disable_rx_error_interrupts(basePointer)
 #define SI32_UART_A_disable_rx_error_interrupts(basePointer) \
@@ -1252,8 +2157,19 @@ _SI32_UART_A_disable_rx_error_interrupts(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_A_is_rx_error_interrupts_enabled(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.RERIEN);
+   //}}
+}
+#else
 bool
 _SI32_UART_A_is_rx_error_interrupts_enabled(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_is_rx_error_interrupts_enabled(basePointer)
 #define SI32_UART_A_is_rx_error_interrupts_enabled(basePointer) \
@@ -1265,8 +2181,19 @@ _SI32_UART_A_is_rx_error_interrupts_enabled(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enable_rx_data_request_interrupt(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_UART_A_CONTROL_RDREQIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enable_rx_data_request_interrupt(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enable_rx_data_request_interrupt(basePointer)
 #define SI32_UART_A_enable_rx_data_request_interrupt(basePointer) \
@@ -1278,8 +2205,19 @@ _SI32_UART_A_enable_rx_data_request_interrupt(SI32_UART_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_disable_rx_data_request_interrupt(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_UART_A_CONTROL_RDREQIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_disable_rx_data_request_interrupt(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_disable_rx_data_request_interrupt(basePointer)
 #define SI32_UART_A_disable_rx_data_request_interrupt(basePointer) \
@@ -1291,8 +2229,19 @@ _SI32_UART_A_disable_rx_data_request_interrupt(SI32_UART_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_A_is_rx_data_request_interrupt_enabled(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.RDREQIEN);
+   //}}
+}
+#else
 bool
 _SI32_UART_A_is_rx_data_request_interrupt_enabled(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_is_rx_data_request_interrupt_enabled(basePointer)
 #define SI32_UART_A_is_rx_data_request_interrupt_enabled(basePointer) \
@@ -1304,8 +2253,19 @@ _SI32_UART_A_is_rx_data_request_interrupt_enabled(SI32_UART_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_exit_match_mode(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_UART_A_CONTROL_MATMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_exit_match_mode(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_exit_match_mode(basePointer)
 #define SI32_UART_A_exit_match_mode(basePointer) \
@@ -1317,8 +2277,20 @@ _SI32_UART_A_exit_match_mode(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enter_match_mode_store_byte(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_UART_A_CONTROL_MATMD_MASK;
+   basePointer->CONTROL_SET = SI32_UART_A_CONTROL_MATMD_MCE_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enter_match_mode_store_byte(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enter_match_mode_store_byte(basePointer)
 #define SI32_UART_A_enter_match_mode_store_byte(basePointer) do{  \
@@ -1332,8 +2304,20 @@ _SI32_UART_A_enter_match_mode_store_byte(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enter_match_mode_generate_frame_error(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_UART_A_CONTROL_MATMD_MASK;
+   basePointer->CONTROL_SET = SI32_UART_A_CONTROL_MATMD_FRAME_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enter_match_mode_generate_frame_error(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enter_match_mode_generate_frame_error(basePointer)
 #define SI32_UART_A_enter_match_mode_generate_frame_error(basePointer) do{  \
@@ -1347,8 +2331,19 @@ _SI32_UART_A_enter_match_mode_generate_frame_error(SI32_UART_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enter_match_mode_store_bit(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_UART_A_CONTROL_MATMD_STORE_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enter_match_mode_store_bit(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enter_match_mode_store_bit(basePointer)
 #define SI32_UART_A_enter_match_mode_store_bit(basePointer) \
@@ -1360,8 +2355,19 @@ _SI32_UART_A_enter_match_mode_store_bit(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enable_rx_autobaud(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_UART_A_CONTROL_RABDEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enable_rx_autobaud(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enable_rx_autobaud(basePointer)
 #define SI32_UART_A_enable_rx_autobaud(basePointer) \
@@ -1373,8 +2379,19 @@ _SI32_UART_A_enable_rx_autobaud(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_disable_rx_autobaud(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_UART_A_CONTROL_RABDEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_disable_rx_autobaud(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_disable_rx_autobaud(basePointer)
 #define SI32_UART_A_disable_rx_autobaud(basePointer) \
@@ -1386,8 +2403,19 @@ _SI32_UART_A_disable_rx_autobaud(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_A_is_rx_busy(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.RBUSYF);
+   //}}
+}
+#else
 bool
 _SI32_UART_A_is_rx_busy(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_is_rx_busy(basePointer)
 #define SI32_UART_A_is_rx_busy(basePointer) \
@@ -1399,8 +2427,19 @@ _SI32_UART_A_is_rx_busy(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_set_rbit(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_UART_A_CONTROL_RBIT_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_set_rbit(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_set_rbit(basePointer)
 #define SI32_UART_A_set_rbit(basePointer) \
@@ -1412,8 +2451,19 @@ _SI32_UART_A_set_rbit(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_clear_rbit(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_UART_A_CONTROL_RBIT_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_clear_rbit(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_clear_rbit(basePointer)
 #define SI32_UART_A_clear_rbit(basePointer) \
@@ -1425,8 +2475,19 @@ _SI32_UART_A_clear_rbit(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_A_read_rbit(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.RBIT);
+   //}}
+}
+#else
 bool
 _SI32_UART_A_read_rbit(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_read_rbit(basePointer)
 #define SI32_UART_A_read_rbit(basePointer) \
@@ -1438,8 +2499,19 @@ _SI32_UART_A_read_rbit(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enable_rx_one_shot(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_UART_A_CONTROL_ROSEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enable_rx_one_shot(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enable_rx_one_shot(basePointer)
 #define SI32_UART_A_enable_rx_one_shot(basePointer) \
@@ -1451,8 +2523,19 @@ _SI32_UART_A_enable_rx_one_shot(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_disable_rx_one_shot(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_UART_A_CONTROL_ROSEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_disable_rx_one_shot(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_disable_rx_one_shot(basePointer)
 #define SI32_UART_A_disable_rx_one_shot(basePointer) \
@@ -1464,8 +2547,19 @@ _SI32_UART_A_disable_rx_one_shot(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enable_rx_inhibit(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_UART_A_CONTROL_RINH_ACTIVE_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enable_rx_inhibit(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enable_rx_inhibit(basePointer)
 #define SI32_UART_A_enable_rx_inhibit(basePointer) \
@@ -1477,8 +2571,19 @@ _SI32_UART_A_enable_rx_inhibit(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_disable_rx_inhibit(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_UART_A_CONTROL_RINH_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_disable_rx_inhibit(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_disable_rx_inhibit(basePointer)
 #define SI32_UART_A_disable_rx_inhibit(basePointer) \
@@ -1490,8 +2595,19 @@ _SI32_UART_A_disable_rx_inhibit(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enable_rx(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_UART_A_CONTROL_REN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enable_rx(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enable_rx(basePointer)
 #define SI32_UART_A_enable_rx(basePointer) \
@@ -1503,8 +2619,19 @@ _SI32_UART_A_enable_rx(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_disable_rx(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_UART_A_CONTROL_REN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_disable_rx(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_disable_rx(basePointer)
 #define SI32_UART_A_disable_rx(basePointer) \
@@ -1516,8 +2643,19 @@ _SI32_UART_A_disable_rx(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_A_is_tx_smartcard_parity_error_interrupt_pending(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.TSCERI);
+   //}}
+}
+#else
 bool
 _SI32_UART_A_is_tx_smartcard_parity_error_interrupt_pending(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_is_tx_smartcard_parity_error_interrupt_pending(basePointer)
 #define SI32_UART_A_is_tx_smartcard_parity_error_interrupt_pending(basePointer) \
@@ -1529,8 +2667,19 @@ _SI32_UART_A_is_tx_smartcard_parity_error_interrupt_pending(SI32_UART_A_Type* /*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_clear_tx_smartcard_parity_error_interrupt(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_UART_A_CONTROL_TSCERI_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_clear_tx_smartcard_parity_error_interrupt(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_clear_tx_smartcard_parity_error_interrupt(basePointer)
 #define SI32_UART_A_clear_tx_smartcard_parity_error_interrupt(basePointer) \
@@ -1542,8 +2691,19 @@ _SI32_UART_A_clear_tx_smartcard_parity_error_interrupt(SI32_UART_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_A_is_tx_data_request_interrupt_pending(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.TDREQI);
+   //}}
+}
+#else
 bool
 _SI32_UART_A_is_tx_data_request_interrupt_pending(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_is_tx_data_request_interrupt_pending(basePointer)
 #define SI32_UART_A_is_tx_data_request_interrupt_pending(basePointer) \
@@ -1555,8 +2715,19 @@ _SI32_UART_A_is_tx_data_request_interrupt_pending(SI32_UART_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_A_is_tx_complete(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.TCPTI);
+   //}}
+}
+#else
 bool
 _SI32_UART_A_is_tx_complete(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_is_tx_complete(basePointer)
 #define SI32_UART_A_is_tx_complete(basePointer) \
@@ -1568,8 +2739,19 @@ _SI32_UART_A_is_tx_complete(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_clear_tx_complete_interrupt(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_UART_A_CONTROL_TCPTI_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_clear_tx_complete_interrupt(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_clear_tx_complete_interrupt(basePointer)
 #define SI32_UART_A_clear_tx_complete_interrupt(basePointer) \
@@ -1581,8 +2763,19 @@ _SI32_UART_A_clear_tx_complete_interrupt(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_select_tx_complete_threshold_end_of_transmission(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_UART_A_CONTROL_TCPTTH_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_select_tx_complete_threshold_end_of_transmission(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_select_tx_complete_threshold_end_of_transmission(basePointer)
 #define SI32_UART_A_select_tx_complete_threshold_end_of_transmission(basePointer) \
@@ -1594,8 +2787,19 @@ _SI32_UART_A_select_tx_complete_threshold_end_of_transmission(SI32_UART_A_Type*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_select_tx_complete_threshold_no_more_data(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_UART_A_CONTROL_TCPTTH_SET_ON_EMPTY_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_select_tx_complete_threshold_no_more_data(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_select_tx_complete_threshold_no_more_data(basePointer)
 #define SI32_UART_A_select_tx_complete_threshold_no_more_data(basePointer) \
@@ -1611,8 +2815,19 @@ _SI32_UART_A_select_tx_complete_threshold_no_more_data(SI32_UART_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enable_tx_error_interrupts(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_UART_A_CONTROL_TERIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enable_tx_error_interrupts(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enable_tx_error_interrupts(basePointer)
 #define SI32_UART_A_enable_tx_error_interrupts(basePointer) \
@@ -1628,8 +2843,19 @@ _SI32_UART_A_enable_tx_error_interrupts(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_disable_tx_error_interrupts(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_UART_A_CONTROL_TERIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_disable_tx_error_interrupts(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_disable_tx_error_interrupts(basePointer)
 #define SI32_UART_A_disable_tx_error_interrupts(basePointer) \
@@ -1641,8 +2867,19 @@ _SI32_UART_A_disable_tx_error_interrupts(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_A_is_tx_error_interrupts_enabled(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.TERIEN);
+   //}}
+}
+#else
 bool
 _SI32_UART_A_is_tx_error_interrupts_enabled(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_is_tx_error_interrupts_enabled(basePointer)
 #define SI32_UART_A_is_tx_error_interrupts_enabled(basePointer) \
@@ -1654,8 +2891,19 @@ _SI32_UART_A_is_tx_error_interrupts_enabled(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enable_tx_data_request_interrupt(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_UART_A_CONTROL_TDREQIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enable_tx_data_request_interrupt(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enable_tx_data_request_interrupt(basePointer)
 #define SI32_UART_A_enable_tx_data_request_interrupt(basePointer) \
@@ -1667,8 +2915,19 @@ _SI32_UART_A_enable_tx_data_request_interrupt(SI32_UART_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_disable_tx_data_request_interrupt(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_UART_A_CONTROL_TDREQIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_disable_tx_data_request_interrupt(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_disable_tx_data_request_interrupt(basePointer)
 #define SI32_UART_A_disable_tx_data_request_interrupt(basePointer) \
@@ -1680,8 +2939,19 @@ _SI32_UART_A_disable_tx_data_request_interrupt(SI32_UART_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_A_is_tx_data_request_interrupt_enabled(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.TDREQIEN);
+   //}}
+}
+#else
 bool
 _SI32_UART_A_is_tx_data_request_interrupt_enabled(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_is_tx_data_request_interrupt_enabled(basePointer)
 #define SI32_UART_A_is_tx_data_request_interrupt_enabled(basePointer) \
@@ -1693,8 +2963,19 @@ _SI32_UART_A_is_tx_data_request_interrupt_enabled(SI32_UART_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enable_tx_complete_interrupt(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_UART_A_CONTROL_TCPTIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enable_tx_complete_interrupt(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enable_tx_complete_interrupt(basePointer)
 #define SI32_UART_A_enable_tx_complete_interrupt(basePointer) \
@@ -1706,8 +2987,19 @@ _SI32_UART_A_enable_tx_complete_interrupt(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_disable_tx_complete_interrupt(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_UART_A_CONTROL_TCPTIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_disable_tx_complete_interrupt(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_disable_tx_complete_interrupt(basePointer)
 #define SI32_UART_A_disable_tx_complete_interrupt(basePointer) \
@@ -1719,8 +3011,19 @@ _SI32_UART_A_disable_tx_complete_interrupt(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_A_is_tx_complete_interrupt_enabled(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.TCPTIEN);
+   //}}
+}
+#else
 bool
 _SI32_UART_A_is_tx_complete_interrupt_enabled(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_is_tx_complete_interrupt_enabled(basePointer)
 #define SI32_UART_A_is_tx_complete_interrupt_enabled(basePointer) \
@@ -1732,8 +3035,19 @@ _SI32_UART_A_is_tx_complete_interrupt_enabled(SI32_UART_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_A_is_tx_busy(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.TBUSYF);
+   //}}
+}
+#else
 bool
 _SI32_UART_A_is_tx_busy(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_is_tx_busy(basePointer)
 #define SI32_UART_A_is_tx_busy(basePointer) \
@@ -1745,8 +3059,19 @@ _SI32_UART_A_is_tx_busy(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_set_tbit(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_UART_A_CONTROL_TBIT_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_set_tbit(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_set_tbit(basePointer)
 #define SI32_UART_A_set_tbit(basePointer) \
@@ -1758,8 +3083,19 @@ _SI32_UART_A_set_tbit(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_clear_tbit(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_UART_A_CONTROL_TBIT_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_clear_tbit(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_clear_tbit(basePointer)
 #define SI32_UART_A_clear_tbit(basePointer) \
@@ -1771,8 +3107,19 @@ _SI32_UART_A_clear_tbit(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enable_tx_inhibit(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_UART_A_CONTROL_TINH_ACTIVE_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enable_tx_inhibit(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enable_tx_inhibit(basePointer)
 #define SI32_UART_A_enable_tx_inhibit(basePointer) \
@@ -1784,8 +3131,19 @@ _SI32_UART_A_enable_tx_inhibit(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_disable_tx_inhibit(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_UART_A_CONTROL_TINH_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_disable_tx_inhibit(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_disable_tx_inhibit(basePointer)
 #define SI32_UART_A_disable_tx_inhibit(basePointer) \
@@ -1797,8 +3155,19 @@ _SI32_UART_A_disable_tx_inhibit(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_enable_tx(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_UART_A_CONTROL_TEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_enable_tx(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_enable_tx(basePointer)
 #define SI32_UART_A_enable_tx(basePointer) \
@@ -1810,8 +3179,19 @@ _SI32_UART_A_enable_tx(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_disable_tx(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_UART_A_CONTROL_TEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_disable_tx(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_disable_tx(basePointer)
 #define SI32_UART_A_disable_tx(basePointer) \
@@ -1831,9 +3211,21 @@ _SI32_UART_A_disable_tx(SI32_UART_A_Type* /*basePointer*/);
 ///  ipdelay
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_write_ipdelay(
+   SI32_UART_A_Type * basePointer,
+   uint32_t ipdelay)
+{
+   //{{
+   basePointer->IPDELAY.U32 = ipdelay;
+   //}}
+}
+#else
 void
 _SI32_UART_A_write_ipdelay(SI32_UART_A_Type* /*basePointer*/,
    uint32_t /*ipdelay*/);
+#endif
 ///
 /// @def SI32_UART_A_write_ipdelay(basePointer, ipdelay)
 #define SI32_UART_A_write_ipdelay(basePointer, ipdelay) \
@@ -1848,8 +3240,19 @@ _SI32_UART_A_write_ipdelay(SI32_UART_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_UART_A_read_ipdelay(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   return basePointer->IPDELAY.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_UART_A_read_ipdelay(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_read_ipdelay(basePointer)
 #define SI32_UART_A_read_ipdelay(basePointer) \
@@ -1869,9 +3272,22 @@ _SI32_UART_A_read_ipdelay(SI32_UART_A_Type* /*basePointer*/);
 ///  ipdelay
 ///  Valid range is 8 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_write_ipdelay_bits(
+   SI32_UART_A_Type * basePointer,
+   uint32_t ipdelay)
+{
+   assert(ipdelay < 256);   // ipdelay < 2^8
+   //{{
+	basePointer->IPDELAY.IPDELAY_BITS = ipdelay;
+   //}}
+}
+#else
 void
 _SI32_UART_A_write_ipdelay_bits(SI32_UART_A_Type* /*basePointer*/,
    uint32_t /*ipdelay*/);
+#endif
 ///
 /// @def SI32_UART_A_write_ipdelay_bits(basePointer, ipdelay)
 #define SI32_UART_A_write_ipdelay_bits(basePointer, ipdelay) \
@@ -1886,8 +3302,19 @@ _SI32_UART_A_write_ipdelay_bits(SI32_UART_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_UART_A_read_ipdelay_bits(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   return basePointer->IPDELAY.IPDELAY_BITS;
+   //}}
+}
+#else
 uint32_t
 _SI32_UART_A_read_ipdelay_bits(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_read_ipdelay_bits(basePointer)
 #define SI32_UART_A_read_ipdelay_bits(basePointer) \
@@ -1907,9 +3334,21 @@ _SI32_UART_A_read_ipdelay_bits(SI32_UART_A_Type* /*basePointer*/);
 ///  baudrate
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_write_baudrate(
+   SI32_UART_A_Type * basePointer,
+   uint32_t baudrate)
+{
+   //{{
+   basePointer->BAUDRATE.U32 = baudrate;
+   //}}
+}
+#else
 void
 _SI32_UART_A_write_baudrate(SI32_UART_A_Type* /*basePointer*/,
    uint32_t /*baudrate*/);
+#endif
 ///
 /// @def SI32_UART_A_write_baudrate(basePointer, baudrate)
 #define SI32_UART_A_write_baudrate(basePointer, baudrate) \
@@ -1924,8 +3363,19 @@ _SI32_UART_A_write_baudrate(SI32_UART_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_UART_A_read_baudrate(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   return basePointer->BAUDRATE.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_UART_A_read_baudrate(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_read_baudrate(basePointer)
 #define SI32_UART_A_read_baudrate(basePointer) \
@@ -1942,9 +3392,22 @@ _SI32_UART_A_read_baudrate(SI32_UART_A_Type* /*basePointer*/);
 ///  rxbaud
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_set_rx_baudrate(
+   SI32_UART_A_Type * basePointer,
+   uwide16_t rxbaud)
+{
+   assert(rxbaud < 65536);   // rxbaud < 2^16
+   //{{
+   basePointer->BAUDRATE.RBAUD = rxbaud;
+   //}}
+}
+#else
 void
 _SI32_UART_A_set_rx_baudrate(SI32_UART_A_Type* /*basePointer*/,
    uwide16_t /*rxbaud*/);
+#endif
 ///
 /// @def SI32_UART_A_set_rx_baudrate(basePointer, rxbaud)
 #define SI32_UART_A_set_rx_baudrate(basePointer, rxbaud) \
@@ -1961,9 +3424,22 @@ _SI32_UART_A_set_rx_baudrate(SI32_UART_A_Type* /*basePointer*/,
 ///  txbaud
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_set_tx_baudrate(
+   SI32_UART_A_Type * basePointer,
+   uwide16_t txbaud)
+{
+   assert(txbaud < 65536);   // txbaud < 2^16
+   //{{
+   basePointer->BAUDRATE.TBAUD = txbaud;
+   //}}
+}
+#else
 void
 _SI32_UART_A_set_tx_baudrate(SI32_UART_A_Type* /*basePointer*/,
    uwide16_t /*txbaud*/);
+#endif
 ///
 /// @def SI32_UART_A_set_tx_baudrate(basePointer, txbaud)
 #define SI32_UART_A_set_tx_baudrate(basePointer, txbaud) \
@@ -1983,9 +3459,21 @@ _SI32_UART_A_set_tx_baudrate(SI32_UART_A_Type* /*basePointer*/,
 ///  fifocn
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_write_fifocn(
+   SI32_UART_A_Type * basePointer,
+   uint32_t fifocn)
+{
+   //{{
+   basePointer->FIFOCN.U32 = fifocn;
+   //}}
+}
+#else
 void
 _SI32_UART_A_write_fifocn(SI32_UART_A_Type* /*basePointer*/,
    uint32_t /*fifocn*/);
+#endif
 ///
 /// @def SI32_UART_A_write_fifocn(basePointer, fifocn)
 #define SI32_UART_A_write_fifocn(basePointer, fifocn) \
@@ -2000,8 +3488,19 @@ _SI32_UART_A_write_fifocn(SI32_UART_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_UART_A_read_fifocn(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   return basePointer->FIFOCN.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_UART_A_read_fifocn(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_read_fifocn(basePointer)
 #define SI32_UART_A_read_fifocn(basePointer) \
@@ -2016,8 +3515,19 @@ _SI32_UART_A_read_fifocn(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_UART_A_read_rx_fifo_count(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   return (uint32_t)(basePointer->FIFOCN.RCNT);
+   //}}
+}
+#else
 uint32_t
 _SI32_UART_A_read_rx_fifo_count(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_read_rx_fifo_count(basePointer)
 #define SI32_UART_A_read_rx_fifo_count(basePointer) \
@@ -2029,8 +3539,19 @@ _SI32_UART_A_read_rx_fifo_count(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_select_rx_fifo_threshold_1(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FIFOCN_CLR = SI32_UART_A_FIFOCN_RFTH_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_select_rx_fifo_threshold_1(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_select_rx_fifo_threshold_1(basePointer)
 #define SI32_UART_A_select_rx_fifo_threshold_1(basePointer) \
@@ -2042,8 +3563,20 @@ _SI32_UART_A_select_rx_fifo_threshold_1(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_select_rx_fifo_threshold_2(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FIFOCN_CLR = SI32_UART_A_FIFOCN_RFTH_MASK;
+   basePointer->FIFOCN_SET = SI32_UART_A_FIFOCN_RFTH_TWO_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_select_rx_fifo_threshold_2(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_select_rx_fifo_threshold_2(basePointer)
 #define SI32_UART_A_select_rx_fifo_threshold_2(basePointer) do{  \
@@ -2057,8 +3590,20 @@ _SI32_UART_A_select_rx_fifo_threshold_2(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_select_rx_fifo_threshold_4(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FIFOCN_CLR = SI32_UART_A_FIFOCN_RFTH_MASK;
+   basePointer->FIFOCN_SET = SI32_UART_A_FIFOCN_RFTH_FOUR_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_select_rx_fifo_threshold_4(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_select_rx_fifo_threshold_4(basePointer)
 #define SI32_UART_A_select_rx_fifo_threshold_4(basePointer) do{  \
@@ -2072,8 +3617,19 @@ _SI32_UART_A_select_rx_fifo_threshold_4(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_flush_rx_fifo(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FIFOCN_SET = SI32_UART_A_FIFOCN_RFIFOFL_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_flush_rx_fifo(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_flush_rx_fifo(basePointer)
 #define SI32_UART_A_flush_rx_fifo(basePointer) \
@@ -2085,8 +3641,19 @@ _SI32_UART_A_flush_rx_fifo(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_A_is_rx_fifo_error_interrupt_pending(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->FIFOCN.RFERI);
+   //}}
+}
+#else
 bool
 _SI32_UART_A_is_rx_fifo_error_interrupt_pending(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_is_rx_fifo_error_interrupt_pending(basePointer)
 #define SI32_UART_A_is_rx_fifo_error_interrupt_pending(basePointer) \
@@ -2098,8 +3665,19 @@ _SI32_UART_A_is_rx_fifo_error_interrupt_pending(SI32_UART_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_clear_rx_fifo_error_interrupt(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FIFOCN_CLR = SI32_UART_A_FIFOCN_RFERI_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_clear_rx_fifo_error_interrupt(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_clear_rx_fifo_error_interrupt(basePointer)
 #define SI32_UART_A_clear_rx_fifo_error_interrupt(basePointer) \
@@ -2111,8 +3689,19 @@ _SI32_UART_A_clear_rx_fifo_error_interrupt(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_A_is_rx_shift_register_full(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->FIFOCN.RSRFULLF);
+   //}}
+}
+#else
 bool
 _SI32_UART_A_is_rx_shift_register_full(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_is_rx_shift_register_full(basePointer)
 #define SI32_UART_A_is_rx_shift_register_full(basePointer) \
@@ -2124,8 +3713,19 @@ _SI32_UART_A_is_rx_shift_register_full(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_UART_A_read_tx_fifo_count(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   return (uint32_t)(basePointer->FIFOCN.TCNT);
+   //}}
+}
+#else
 uint32_t
 _SI32_UART_A_read_tx_fifo_count(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_read_tx_fifo_count(basePointer)
 #define SI32_UART_A_read_tx_fifo_count(basePointer) \
@@ -2137,8 +3737,19 @@ _SI32_UART_A_read_tx_fifo_count(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_select_tx_fifo_threshold_for_request_to_1(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FIFOCN_CLR = SI32_UART_A_FIFOCN_TFTH_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_select_tx_fifo_threshold_for_request_to_1(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_select_tx_fifo_threshold_for_request_to_1(basePointer)
 #define SI32_UART_A_select_tx_fifo_threshold_for_request_to_1(basePointer) \
@@ -2150,8 +3761,20 @@ _SI32_UART_A_select_tx_fifo_threshold_for_request_to_1(SI32_UART_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_select_tx_fifo_threshold_for_request_to_2(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FIFOCN_CLR = SI32_UART_A_FIFOCN_TFTH_MASK;
+   basePointer->FIFOCN_SET = SI32_UART_A_FIFOCN_TFTH_TWO_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_select_tx_fifo_threshold_for_request_to_2(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_select_tx_fifo_threshold_for_request_to_2(basePointer)
 #define SI32_UART_A_select_tx_fifo_threshold_for_request_to_2(basePointer) do{  \
@@ -2165,8 +3788,20 @@ _SI32_UART_A_select_tx_fifo_threshold_for_request_to_2(SI32_UART_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_select_tx_fifo_threshold_for_request_to_4(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FIFOCN_CLR = SI32_UART_A_FIFOCN_TFTH_MASK;
+   basePointer->FIFOCN_SET = SI32_UART_A_FIFOCN_TFTH_FOUR_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_A_select_tx_fifo_threshold_for_request_to_4(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_select_tx_fifo_threshold_for_request_to_4(basePointer)
 #define SI32_UART_A_select_tx_fifo_threshold_for_request_to_4(basePointer) do{  \
@@ -2180,8 +3815,19 @@ _SI32_UART_A_select_tx_fifo_threshold_for_request_to_4(SI32_UART_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_flush_tx_fifo(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FIFOCN_SET = SI32_UART_A_FIFOCN_TFIFOFL_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_flush_tx_fifo(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_flush_tx_fifo(basePointer)
 #define SI32_UART_A_flush_tx_fifo(basePointer) \
@@ -2193,8 +3839,19 @@ _SI32_UART_A_flush_tx_fifo(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_A_is_tx_fifo_error_interrupt_pending(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->FIFOCN.TFERI);
+   //}}
+}
+#else
 bool
 _SI32_UART_A_is_tx_fifo_error_interrupt_pending(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_is_tx_fifo_error_interrupt_pending(basePointer)
 #define SI32_UART_A_is_tx_fifo_error_interrupt_pending(basePointer) \
@@ -2206,8 +3863,19 @@ _SI32_UART_A_is_tx_fifo_error_interrupt_pending(SI32_UART_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_clear_tx_fifo_error_interrupt(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FIFOCN_CLR = SI32_UART_A_FIFOCN_TFERI_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_A_clear_tx_fifo_error_interrupt(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_clear_tx_fifo_error_interrupt(basePointer)
 #define SI32_UART_A_clear_tx_fifo_error_interrupt(basePointer) \
@@ -2219,8 +3887,19 @@ _SI32_UART_A_clear_tx_fifo_error_interrupt(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_A_is_tx_shift_register_full(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->FIFOCN.TSRFULLF);
+   //}}
+}
+#else
 bool
 _SI32_UART_A_is_tx_shift_register_full(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_is_tx_shift_register_full(basePointer)
 #define SI32_UART_A_is_tx_shift_register_full(basePointer) \
@@ -2232,8 +3911,19 @@ _SI32_UART_A_is_tx_shift_register_full(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_UART_A_read_data_u32(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   return (uint32_t)(basePointer->DATA.U32);
+   //}}
+}
+#else
 uint32_t
 _SI32_UART_A_read_data_u32(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_read_data_u32(basePointer)
 #define SI32_UART_A_read_data_u32(basePointer) \
@@ -2245,8 +3935,19 @@ _SI32_UART_A_read_data_u32(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint16_t
+_SI32_UART_A_read_data_u16(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DATA.U16;
+   //}}
+}
+#else
 uint16_t
 _SI32_UART_A_read_data_u16(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_read_data_u16(basePointer)
 #define SI32_UART_A_read_data_u16(basePointer) \
@@ -2258,8 +3959,19 @@ _SI32_UART_A_read_data_u16(SI32_UART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint8_t
+_SI32_UART_A_read_data_u8(
+   SI32_UART_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DATA.U8;
+   //}}
+}
+#else
 uint8_t
 _SI32_UART_A_read_data_u8(SI32_UART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_A_read_data_u8(basePointer)
 #define SI32_UART_A_read_data_u8(basePointer) \
@@ -2276,9 +3988,21 @@ _SI32_UART_A_read_data_u8(SI32_UART_A_Type* /*basePointer*/);
 ///  dataval
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_write_data_u32(
+   SI32_UART_A_Type * basePointer,
+   uint32_t dataval)
+{
+   //{{
+   basePointer->DATA.U32 = dataval;
+   //}}
+}
+#else
 void
 _SI32_UART_A_write_data_u32(SI32_UART_A_Type* /*basePointer*/,
    uint32_t /*dataval*/);
+#endif
 ///
 /// @def SI32_UART_A_write_data_u32(basePointer, dataval)
 #define SI32_UART_A_write_data_u32(basePointer, dataval) \
@@ -2295,9 +4019,22 @@ _SI32_UART_A_write_data_u32(SI32_UART_A_Type* /*basePointer*/,
 ///  dataval
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_write_data_u16(
+   SI32_UART_A_Type * basePointer,
+   uwide16_t dataval)
+{
+   assert(dataval < 65536);   // dataval < 2^16
+   //{{
+   basePointer->DATA.U16 = dataval;
+   //}}
+}
+#else
 void
 _SI32_UART_A_write_data_u16(SI32_UART_A_Type* /*basePointer*/,
    uwide16_t /*dataval*/);
+#endif
 ///
 /// @def SI32_UART_A_write_data_u16(basePointer, dataval)
 #define SI32_UART_A_write_data_u16(basePointer, dataval) \
@@ -2314,9 +4051,22 @@ _SI32_UART_A_write_data_u16(SI32_UART_A_Type* /*basePointer*/,
 ///  dataval
 ///  Valid range is 8 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_A_write_data_u8(
+   SI32_UART_A_Type * basePointer,
+   uwide8_t dataval)
+{
+   assert(dataval < 256);   // dataval < 2^8
+   //{{
+   basePointer->DATA.U8 = dataval;
+   //}}
+}
+#else
 void
 _SI32_UART_A_write_data_u8(SI32_UART_A_Type* /*basePointer*/,
    uwide8_t /*dataval*/);
+#endif
 ///
 /// @def SI32_UART_A_write_data_u8(basePointer, dataval)
 #define SI32_UART_A_write_data_u8(basePointer, dataval) \
@@ -94,6 +94,40 @@ extern "C" {
 ///  Valid range is 32 bits.
 ///  Write to CLKDIV register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_initialize(
+   SI32_UART_B_Type * basePointer,
+   // Write to CONFIG register.
+   uint32_t config,
+   // Write to MODE register.
+   uint32_t mode,
+   // Write to FLOWCN register.
+   uint32_t flowcn,
+   // Write to CONTROL register.
+   uint32_t control,
+   // Write to IPDELAY register.
+   uint32_t ipdelay,
+   // Write to BAUDRATE register.
+   uint32_t baudrate,
+   // Write to FIFOCN register.
+   uint32_t fifocn,
+   // Write to CLKDIV register.
+   uint32_t clkdiv)
+{
+   assert(ipdelay < 256);   // ipdelay < 2^8
+   //{{
+   basePointer->CONFIG.U32 = config;
+   basePointer->MODE.U32 = mode;
+   basePointer->FLOWCN.U32 = flowcn;
+   basePointer->CONTROL.U32 = control;
+   basePointer->IPDELAY.U32 = ipdelay;
+   basePointer->BAUDRATE.U32 = baudrate;
+   basePointer->FIFOCN.U32 = fifocn;
+   basePointer->CLKDIV.U32 = clkdiv;
+   //}}
+}
+#else
 void
 _SI32_UART_B_initialize(SI32_UART_B_Type* /*basePointer*/,
    uint32_t, /*config*/
@@ -104,6 +138,7 @@ _SI32_UART_B_initialize(SI32_UART_B_Type* /*basePointer*/,
    uint32_t, /*baudrate*/
    uint32_t, /*fifocn*/
    uint32_t /*clkdiv*/);
+#endif
 ///
 /// @def SI32_UART_B_initialize(basePointer, config, mode, flowcn, control, ipdelay, baudrate, fifocn, clkdiv)
 #define SI32_UART_B_initialize(basePointer, config, mode, flowcn, control, ipdelay, baudrate, fifocn, clkdiv) \
@@ -123,9 +158,21 @@ _SI32_UART_B_initialize(SI32_UART_B_Type* /*basePointer*/,
 ///  config
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_write_config(
+   SI32_UART_B_Type * basePointer,
+   uint32_t config)
+{
+   //{{
+   basePointer->CONFIG.U32 = config;
+   //}}
+}
+#else
 void
 _SI32_UART_B_write_config(SI32_UART_B_Type* /*basePointer*/,
    uint32_t /*config*/);
+#endif
 ///
 /// @def SI32_UART_B_write_config(basePointer, config)
 #define SI32_UART_B_write_config(basePointer, config) \
@@ -140,8 +187,19 @@ _SI32_UART_B_write_config(SI32_UART_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_UART_B_read_config(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+   return basePointer->CONFIG.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_UART_B_read_config(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_read_config(basePointer)
 #define SI32_UART_B_read_config(basePointer) \
@@ -153,8 +211,19 @@ _SI32_UART_B_read_config(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_enable_rx_start_bit(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_UART_B_CONFIG_RSTRTEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_enable_rx_start_bit(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_enable_rx_start_bit(basePointer)
 #define SI32_UART_B_enable_rx_start_bit(basePointer) \
@@ -166,8 +235,19 @@ _SI32_UART_B_enable_rx_start_bit(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_disable_rx_start_bit(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_UART_B_CONFIG_RSTRTEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_disable_rx_start_bit(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_disable_rx_start_bit(basePointer)
 #define SI32_UART_B_disable_rx_start_bit(basePointer) \
@@ -179,8 +259,19 @@ _SI32_UART_B_disable_rx_start_bit(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_enable_rx_parity_bit(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_SET = SI32_UART_B_CONFIG_RPAREN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_enable_rx_parity_bit(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_enable_rx_parity_bit(basePointer)
 #define SI32_UART_B_enable_rx_parity_bit(basePointer) \
@@ -192,8 +283,19 @@ _SI32_UART_B_enable_rx_parity_bit(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_disable_rx_parity_bit(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_UART_B_CONFIG_RPAREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_disable_rx_parity_bit(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_disable_rx_parity_bit(basePointer)
 #define SI32_UART_B_disable_rx_parity_bit(basePointer) \
@@ -205,8 +307,19 @@ _SI32_UART_B_disable_rx_parity_bit(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_enable_rx_stop_bit(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_UART_B_CONFIG_RSTPEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_enable_rx_stop_bit(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_enable_rx_stop_bit(basePointer)
 #define SI32_UART_B_enable_rx_stop_bit(basePointer) \
@@ -218,8 +331,19 @@ _SI32_UART_B_enable_rx_stop_bit(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_disable_rx_stop_bit(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_UART_B_CONFIG_RSTPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_disable_rx_stop_bit(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_disable_rx_stop_bit(basePointer)
 #define SI32_UART_B_disable_rx_stop_bit(basePointer) \
@@ -240,9 +364,23 @@ _SI32_UART_B_disable_rx_stop_bit(SI32_UART_B_Type* /*basePointer*/);
 ///  bits
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_select_rx_stop_bits(
+   SI32_UART_B_Type * basePointer,
+   SI32_UART_B_STOP_BITS_Enum_Type bits)
+{
+   assert(bits < 4);   // bits < 2^2
+   //{{
+   basePointer->CONFIG_CLR = SI32_UART_B_CONFIG_RSTPMD_MASK;
+   basePointer->CONFIG_SET = bits << SI32_UART_B_CONFIG_RSTPMD_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_UART_B_select_rx_stop_bits(SI32_UART_B_Type* /*basePointer*/,
    SI32_UART_B_STOP_BITS_Enum_Type /*bits*/);
+#endif
 ///
 /// @def SI32_UART_B_select_rx_stop_bits(basePointer, bits)
 #define SI32_UART_B_select_rx_stop_bits(basePointer, bits) do{  \
@@ -264,9 +402,23 @@ _SI32_UART_B_select_rx_stop_bits(SI32_UART_B_Type* /*basePointer*/,
 ///  parity
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_select_rx_parity(
+   SI32_UART_B_Type * basePointer,
+   SI32_UART_B_PARITY_Enum_Type parity)
+{
+   assert(parity < 4);   // parity < 2^2
+   //{{
+   basePointer->CONFIG_CLR = SI32_UART_B_CONFIG_RPARMD_MASK;
+   basePointer->CONFIG_SET = parity << SI32_UART_B_CONFIG_RPARMD_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_UART_B_select_rx_parity(SI32_UART_B_Type* /*basePointer*/,
    SI32_UART_B_PARITY_Enum_Type /*parity*/);
+#endif
 ///
 /// @def SI32_UART_B_select_rx_parity(basePointer, parity)
 #define SI32_UART_B_select_rx_parity(basePointer, parity) do{  \
@@ -289,9 +441,23 @@ _SI32_UART_B_select_rx_parity(SI32_UART_B_Type* /*basePointer*/,
 ///  length
 ///  Valid range is 5 to 10.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_select_rx_data_length(
+   SI32_UART_B_Type * basePointer,
+   SI32_UART_B_DATA_LENGTH_Enum_Type length)
+{
+   assert((length >= 5) && (length <= 10));
+   //{{
+   basePointer->CONFIG_CLR = SI32_UART_B_CONFIG_RDATLN_MASK;
+   basePointer->CONFIG_SET = (length - 5) << SI32_UART_B_CONFIG_RDATLN_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_UART_B_select_rx_data_length(SI32_UART_B_Type* /*basePointer*/,
    SI32_UART_B_DATA_LENGTH_Enum_Type /*length*/);
+#endif
 ///
 /// @def SI32_UART_B_select_rx_data_length(basePointer, length)
 #define SI32_UART_B_select_rx_data_length(basePointer, length) do{  \
@@ -305,8 +471,19 @@ _SI32_UART_B_select_rx_data_length(SI32_UART_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_enable_rx_irda_mode(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_SET = SI32_UART_B_CONFIG_RIRDAEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_enable_rx_irda_mode(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_enable_rx_irda_mode(basePointer)
 #define SI32_UART_B_enable_rx_irda_mode(basePointer) \
@@ -318,8 +495,19 @@ _SI32_UART_B_enable_rx_irda_mode(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_disable_rx_irda_mode(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_CLR = SI32_UART_B_CONFIG_RIRDAEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_disable_rx_irda_mode(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_disable_rx_irda_mode(basePointer)
 #define SI32_UART_B_disable_rx_irda_mode(basePointer) \
@@ -331,8 +519,19 @@ _SI32_UART_B_disable_rx_irda_mode(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_enable_rx_signal_inversion(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_SET = SI32_UART_B_CONFIG_RINVEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_enable_rx_signal_inversion(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_enable_rx_signal_inversion(basePointer)
 #define SI32_UART_B_enable_rx_signal_inversion(basePointer) \
@@ -344,8 +543,19 @@ _SI32_UART_B_enable_rx_signal_inversion(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_disable_rx_signal_inversion(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_CLR = SI32_UART_B_CONFIG_RINVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_disable_rx_signal_inversion(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_disable_rx_signal_inversion(basePointer)
 #define SI32_UART_B_disable_rx_signal_inversion(basePointer) \
@@ -357,8 +567,19 @@ _SI32_UART_B_disable_rx_signal_inversion(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_enable_tx_start_bit(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_SET = SI32_UART_B_CONFIG_TSTRTEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_enable_tx_start_bit(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_enable_tx_start_bit(basePointer)
 #define SI32_UART_B_enable_tx_start_bit(basePointer) \
@@ -370,8 +591,19 @@ _SI32_UART_B_enable_tx_start_bit(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_disable_tx_start_bit(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_CLR = SI32_UART_B_CONFIG_TSTRTEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_disable_tx_start_bit(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_disable_tx_start_bit(basePointer)
 #define SI32_UART_B_disable_tx_start_bit(basePointer) \
@@ -383,8 +615,19 @@ _SI32_UART_B_disable_tx_start_bit(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_enable_tx_parity_bit(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_SET = SI32_UART_B_CONFIG_TPAREN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_enable_tx_parity_bit(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_enable_tx_parity_bit(basePointer)
 #define SI32_UART_B_enable_tx_parity_bit(basePointer) \
@@ -396,8 +639,19 @@ _SI32_UART_B_enable_tx_parity_bit(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_disable_tx_parity_bit(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_CLR = SI32_UART_B_CONFIG_TPAREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_disable_tx_parity_bit(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_disable_tx_parity_bit(basePointer)
 #define SI32_UART_B_disable_tx_parity_bit(basePointer) \
@@ -409,8 +663,19 @@ _SI32_UART_B_disable_tx_parity_bit(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_enable_tx_stop_bit(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_SET = SI32_UART_B_CONFIG_TSTPEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_enable_tx_stop_bit(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_enable_tx_stop_bit(basePointer)
 #define SI32_UART_B_enable_tx_stop_bit(basePointer) \
@@ -422,8 +687,19 @@ _SI32_UART_B_enable_tx_stop_bit(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_disable_tx_stop_bit(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_CLR = SI32_UART_B_CONFIG_TSTPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_disable_tx_stop_bit(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_disable_tx_stop_bit(basePointer)
 #define SI32_UART_B_disable_tx_stop_bit(basePointer) \
@@ -444,9 +720,23 @@ _SI32_UART_B_disable_tx_stop_bit(SI32_UART_B_Type* /*basePointer*/);
 ///  bits
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_select_tx_stop_bits(
+   SI32_UART_B_Type * basePointer,
+   SI32_UART_B_STOP_BITS_Enum_Type bits)
+{
+   assert(bits < 4);   // bits < 2^2
+   //{{
+   basePointer->CONFIG_CLR = SI32_UART_B_CONFIG_TSTPMD_MASK;
+   basePointer->CONFIG_SET = bits << SI32_UART_B_CONFIG_TSTPMD_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_UART_B_select_tx_stop_bits(SI32_UART_B_Type* /*basePointer*/,
    SI32_UART_B_STOP_BITS_Enum_Type /*bits*/);
+#endif
 ///
 /// @def SI32_UART_B_select_tx_stop_bits(basePointer, bits)
 #define SI32_UART_B_select_tx_stop_bits(basePointer, bits) do{  \
@@ -468,9 +758,23 @@ _SI32_UART_B_select_tx_stop_bits(SI32_UART_B_Type* /*basePointer*/,
 ///  parity
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_select_tx_parity(
+   SI32_UART_B_Type * basePointer,
+   SI32_UART_B_PARITY_Enum_Type parity)
+{
+   assert(parity < 4);   // parity < 2^2
+   //{{
+	basePointer->CONFIG_CLR = SI32_UART_B_CONFIG_TPARMD_MASK;
+   basePointer->CONFIG_SET = parity << SI32_UART_B_CONFIG_TPARMD_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_UART_B_select_tx_parity(SI32_UART_B_Type* /*basePointer*/,
    SI32_UART_B_PARITY_Enum_Type /*parity*/);
+#endif
 ///
 /// @def SI32_UART_B_select_tx_parity(basePointer, parity)
 #define SI32_UART_B_select_tx_parity(basePointer, parity) do{  \
@@ -493,9 +797,23 @@ _SI32_UART_B_select_tx_parity(SI32_UART_B_Type* /*basePointer*/,
 ///  length
 ///  Valid range is 5 to 10.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_select_tx_data_length(
+   SI32_UART_B_Type * basePointer,
+   SI32_UART_B_DATA_LENGTH_Enum_Type length)
+{
+   assert((length >= 5) && (length <= 10));
+   //{{
+	basePointer->CONFIG_CLR = SI32_UART_B_CONFIG_TDATLN_MASK;
+   basePointer->CONFIG_SET = (length - 5) << SI32_UART_B_CONFIG_TDATLN_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_UART_B_select_tx_data_length(SI32_UART_B_Type* /*basePointer*/,
    SI32_UART_B_DATA_LENGTH_Enum_Type /*length*/);
+#endif
 ///
 /// @def SI32_UART_B_select_tx_data_length(basePointer, length)
 #define SI32_UART_B_select_tx_data_length(basePointer, length) do{  \
@@ -509,8 +827,19 @@ _SI32_UART_B_select_tx_data_length(SI32_UART_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_enable_tx_irda_mode(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_SET = SI32_UART_B_CONFIG_TIRDAEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_enable_tx_irda_mode(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_enable_tx_irda_mode(basePointer)
 #define SI32_UART_B_enable_tx_irda_mode(basePointer) \
@@ -522,8 +851,19 @@ _SI32_UART_B_enable_tx_irda_mode(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_disable_tx_irda_mode(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_CLR = SI32_UART_B_CONFIG_TIRDAEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_disable_tx_irda_mode(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_disable_tx_irda_mode(basePointer)
 #define SI32_UART_B_disable_tx_irda_mode(basePointer) \
@@ -535,8 +875,19 @@ _SI32_UART_B_disable_tx_irda_mode(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_enable_tx_signal_inversion(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_SET = SI32_UART_B_CONFIG_TINVEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_enable_tx_signal_inversion(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_enable_tx_signal_inversion(basePointer)
 #define SI32_UART_B_enable_tx_signal_inversion(basePointer) \
@@ -548,8 +899,19 @@ _SI32_UART_B_enable_tx_signal_inversion(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_disable_tx_signal_inversion(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_UART_B_CONFIG_TINVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_disable_tx_signal_inversion(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_disable_tx_signal_inversion(basePointer)
 #define SI32_UART_B_disable_tx_signal_inversion(basePointer) \
@@ -569,9 +931,21 @@ _SI32_UART_B_disable_tx_signal_inversion(SI32_UART_B_Type* /*basePointer*/);
 ///  mode
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_write_mode(
+   SI32_UART_B_Type * basePointer,
+   uint32_t mode)
+{
+   //{{
+	basePointer->MODE.U32 = mode;
+   //}}
+}
+#else
 void
 _SI32_UART_B_write_mode(SI32_UART_B_Type* /*basePointer*/,
    uint32_t /*mode*/);
+#endif
 ///
 /// @def SI32_UART_B_write_mode(basePointer, mode)
 #define SI32_UART_B_write_mode(basePointer, mode) \
@@ -586,8 +960,19 @@ _SI32_UART_B_write_mode(SI32_UART_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_UART_B_read_mode(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	return basePointer->MODE.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_UART_B_read_mode(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_read_mode(basePointer)
 #define SI32_UART_B_read_mode(basePointer) \
@@ -599,8 +984,19 @@ _SI32_UART_B_read_mode(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_select_rtc_clock_mode(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_SET = SI32_UART_B_MODE_RTCCKMD_RTC0TCLK_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_select_rtc_clock_mode(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_select_rtc_clock_mode(basePointer)
 #define SI32_UART_B_select_rtc_clock_mode(basePointer) do{  \
@@ -613,8 +1009,19 @@ _SI32_UART_B_select_rtc_clock_mode(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_select_apb_clock_mode(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_CLR = SI32_UART_B_MODE_RTCCKMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_select_apb_clock_mode(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_select_apb_clock_mode(basePointer)
 #define SI32_UART_B_select_apb_clock_mode(basePointer) \
@@ -626,8 +1033,19 @@ _SI32_UART_B_select_apb_clock_mode(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_enter_rtc_baud_rate_mode(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_SET = SI32_UART_B_MODE_RTCBDMD_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_enter_rtc_baud_rate_mode(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_enter_rtc_baud_rate_mode(basePointer)
 #define SI32_UART_B_enter_rtc_baud_rate_mode(basePointer) \
@@ -639,8 +1057,19 @@ _SI32_UART_B_enter_rtc_baud_rate_mode(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_exit_rtc_baud_rate_mode(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_CLR = SI32_UART_B_MODE_RTCBDMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_exit_rtc_baud_rate_mode(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_exit_rtc_baud_rate_mode(basePointer)
 #define SI32_UART_B_exit_rtc_baud_rate_mode(basePointer) \
@@ -652,8 +1081,19 @@ _SI32_UART_B_exit_rtc_baud_rate_mode(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_select_internal_clock_on_demand(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_CLR = SI32_UART_B_MODE_FORCECLK_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_select_internal_clock_on_demand(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_select_internal_clock_on_demand(basePointer)
 #define SI32_UART_B_select_internal_clock_on_demand(basePointer) \
@@ -665,8 +1105,19 @@ _SI32_UART_B_select_internal_clock_on_demand(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_select_internal_clock_always_on(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_SET = SI32_UART_B_MODE_FORCECLK_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_select_internal_clock_always_on(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_select_internal_clock_always_on(basePointer)
 #define SI32_UART_B_select_internal_clock_always_on(basePointer) \
@@ -678,8 +1129,19 @@ _SI32_UART_B_select_internal_clock_always_on(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_B_is_clock_switch_busy(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->MODE.CLKBUSY);
+   //}}
+}
+#else
 bool
 _SI32_UART_B_is_clock_switch_busy(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_is_clock_switch_busy(basePointer)
 #define SI32_UART_B_is_clock_switch_busy(basePointer) \
@@ -691,8 +1153,19 @@ _SI32_UART_B_is_clock_switch_busy(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_enable_rx_clock_switch(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_SET = SI32_UART_B_MODE_RXCLKSW_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_enable_rx_clock_switch(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_enable_rx_clock_switch(basePointer)
 #define SI32_UART_B_enable_rx_clock_switch(basePointer) \
@@ -704,8 +1177,19 @@ _SI32_UART_B_enable_rx_clock_switch(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_disable_rx_clock_switch(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_CLR = SI32_UART_B_MODE_RXCLKSW_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_disable_rx_clock_switch(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_disable_rx_clock_switch(basePointer)
 #define SI32_UART_B_disable_rx_clock_switch(basePointer) \
@@ -717,8 +1201,19 @@ _SI32_UART_B_disable_rx_clock_switch(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_enable_tx_clock_switch(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_SET = SI32_UART_B_MODE_TXCLKSW_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_enable_tx_clock_switch(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_enable_tx_clock_switch(basePointer)
 #define SI32_UART_B_enable_tx_clock_switch(basePointer) \
@@ -730,8 +1225,19 @@ _SI32_UART_B_enable_tx_clock_switch(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_disable_tx_clock_switch(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_CLR = SI32_UART_B_MODE_TXCLKSW_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_disable_tx_clock_switch(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_disable_tx_clock_switch(basePointer)
 #define SI32_UART_B_disable_tx_clock_switch(basePointer) \
@@ -743,8 +1249,19 @@ _SI32_UART_B_disable_tx_clock_switch(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_enable_stall_in_debug_mode(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_SET = SI32_UART_B_MODE_DBGMD_HALT_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_enable_stall_in_debug_mode(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_enable_stall_in_debug_mode(basePointer)
 #define SI32_UART_B_enable_stall_in_debug_mode(basePointer) \
@@ -756,8 +1273,19 @@ _SI32_UART_B_enable_stall_in_debug_mode(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_disable_stall_in_debug_mode(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_CLR = SI32_UART_B_MODE_DBGMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_disable_stall_in_debug_mode(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_disable_stall_in_debug_mode(basePointer)
 #define SI32_UART_B_disable_stall_in_debug_mode(basePointer) \
@@ -769,8 +1297,19 @@ _SI32_UART_B_disable_stall_in_debug_mode(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_exit_loopback_mode(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_CLR = SI32_UART_B_MODE_LBMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_exit_loopback_mode(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_exit_loopback_mode(basePointer)
 #define SI32_UART_B_exit_loopback_mode(basePointer) \
@@ -782,8 +1321,20 @@ _SI32_UART_B_exit_loopback_mode(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_enter_receive_loopback_mode(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_CLR = SI32_UART_B_MODE_LBMD_MASK;
+   basePointer->MODE_SET = SI32_UART_B_MODE_LBMD_RXONLY_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_enter_receive_loopback_mode(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_enter_receive_loopback_mode(basePointer)
 #define SI32_UART_B_enter_receive_loopback_mode(basePointer) do{  \
@@ -797,8 +1348,20 @@ _SI32_UART_B_enter_receive_loopback_mode(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_enter_transmit_loopback_mode(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_CLR = SI32_UART_B_MODE_LBMD_MASK;
+   basePointer->MODE_SET = SI32_UART_B_MODE_LBMD_TXONLY_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_enter_transmit_loopback_mode(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_enter_transmit_loopback_mode(basePointer)
 #define SI32_UART_B_enter_transmit_loopback_mode(basePointer) do{  \
@@ -812,8 +1375,19 @@ _SI32_UART_B_enter_transmit_loopback_mode(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_enter_full_loopback_mode(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_SET = SI32_UART_B_MODE_LBMD_BOTH_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_enter_full_loopback_mode(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_enter_full_loopback_mode(basePointer)
 #define SI32_UART_B_enter_full_loopback_mode(basePointer) \
@@ -825,8 +1399,19 @@ _SI32_UART_B_enter_full_loopback_mode(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_enter_half_duplex_mode(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_SET = SI32_UART_B_MODE_DUPLEXMD_HALF_DUPLEX_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_enter_half_duplex_mode(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_enter_half_duplex_mode(basePointer)
 #define SI32_UART_B_enter_half_duplex_mode(basePointer) \
@@ -838,8 +1423,19 @@ _SI32_UART_B_enter_half_duplex_mode(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_enter_full_duplex_mode(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_CLR = SI32_UART_B_MODE_DUPLEXMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_enter_full_duplex_mode(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_enter_full_duplex_mode(basePointer)
 #define SI32_UART_B_enter_full_duplex_mode(basePointer) \
@@ -851,8 +1447,19 @@ _SI32_UART_B_enter_full_duplex_mode(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_disable_idle_tristate(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_CLR = SI32_UART_B_MODE_ITSEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_disable_idle_tristate(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_disable_idle_tristate(basePointer)
 #define SI32_UART_B_disable_idle_tristate(basePointer) \
@@ -864,8 +1471,19 @@ _SI32_UART_B_disable_idle_tristate(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_enable_idle_tristate(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_SET = SI32_UART_B_MODE_ITSEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_enable_idle_tristate(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_enable_idle_tristate(basePointer)
 #define SI32_UART_B_enable_idle_tristate(basePointer) \
@@ -885,9 +1503,21 @@ _SI32_UART_B_enable_idle_tristate(SI32_UART_B_Type* /*basePointer*/);
 ///  flowcn
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_write_flowcn(
+   SI32_UART_B_Type * basePointer,
+   uint32_t flowcn)
+{
+   //{{
+	basePointer->FLOWCN.U32 = flowcn;
+   //}}
+}
+#else
 void
 _SI32_UART_B_write_flowcn(SI32_UART_B_Type* /*basePointer*/,
    uint32_t /*flowcn*/);
+#endif
 ///
 /// @def SI32_UART_B_write_flowcn(basePointer, flowcn)
 #define SI32_UART_B_write_flowcn(basePointer, flowcn) \
@@ -902,8 +1532,19 @@ _SI32_UART_B_write_flowcn(SI32_UART_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_UART_B_read_flowcn(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	return basePointer->FLOWCN.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_UART_B_read_flowcn(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_read_flowcn(basePointer)
 #define SI32_UART_B_read_flowcn(basePointer) \
@@ -915,8 +1556,19 @@ _SI32_UART_B_read_flowcn(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_B_read_rx_input(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->FLOWCN.RX);
+   //}}
+}
+#else
 bool
 _SI32_UART_B_read_rx_input(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_read_rx_input(basePointer)
 #define SI32_UART_B_read_rx_input(basePointer) \
@@ -928,8 +1580,19 @@ _SI32_UART_B_read_rx_input(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_enable_tx_output(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FLOWCN_SET = SI32_UART_B_FLOWCN_TXOEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_enable_tx_output(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_enable_tx_output(basePointer)
 #define SI32_UART_B_enable_tx_output(basePointer) \
@@ -941,8 +1604,19 @@ _SI32_UART_B_enable_tx_output(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_disable_tx_output(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FLOWCN_CLR = SI32_UART_B_FLOWCN_TXOEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_disable_tx_output(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_disable_tx_output(basePointer)
 #define SI32_UART_B_disable_tx_output(basePointer) \
@@ -954,8 +1628,19 @@ _SI32_UART_B_disable_tx_output(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_B_read_tx_output(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->FLOWCN.TX);
+   //}}
+}
+#else
 bool
 _SI32_UART_B_read_tx_output(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_read_tx_output(basePointer)
 #define SI32_UART_B_read_tx_output(basePointer) \
@@ -967,8 +1652,19 @@ _SI32_UART_B_read_tx_output(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_clear_tx(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FLOWCN_CLR = SI32_UART_B_FLOWCN_TX_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_clear_tx(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_clear_tx(basePointer)
 #define SI32_UART_B_clear_tx(basePointer) \
@@ -980,8 +1676,19 @@ _SI32_UART_B_clear_tx(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_set_tx(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FLOWCN_SET = SI32_UART_B_FLOWCN_TX_HIGH_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_set_tx(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_set_tx(basePointer)
 #define SI32_UART_B_set_tx(basePointer) \
@@ -1003,9 +1710,23 @@ _SI32_UART_B_set_tx(SI32_UART_B_Type* /*basePointer*/);
 ///  width
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_select_tx_irda_pulse_width(
+   SI32_UART_B_Type * basePointer,
+   SI32_UART_B_IRDA_PULSE_WIDTH_Enum_Type width)
+{
+   assert(width < 4);   // width < 2^2
+   //{{
+	basePointer->FLOWCN_CLR = SI32_UART_B_FLOWCN_TIRDAPW_MASK;
+   basePointer->FLOWCN_SET = width << SI32_UART_B_FLOWCN_TIRDAPW_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_UART_B_select_tx_irda_pulse_width(SI32_UART_B_Type* /*basePointer*/,
    SI32_UART_B_IRDA_PULSE_WIDTH_Enum_Type /*width*/);
+#endif
 ///
 /// @def SI32_UART_B_select_tx_irda_pulse_width(basePointer, width)
 #define SI32_UART_B_select_tx_irda_pulse_width(basePointer, width) do{  \
@@ -1027,9 +1748,21 @@ _SI32_UART_B_select_tx_irda_pulse_width(SI32_UART_B_Type* /*basePointer*/,
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_write_control(
+   SI32_UART_B_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+	basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_UART_B_write_control(SI32_UART_B_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_UART_B_write_control(basePointer, control)
 #define SI32_UART_B_write_control(basePointer, control) \
@@ -1044,8 +1777,19 @@ _SI32_UART_B_write_control(SI32_UART_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_UART_B_read_control(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_UART_B_read_control(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_read_control(basePointer)
 #define SI32_UART_B_read_control(basePointer) \
@@ -1057,8 +1801,19 @@ _SI32_UART_B_read_control(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_B_is_rx_frame_error_interrupt_pending(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.RFRMERI);
+   //}}
+}
+#else
 bool
 _SI32_UART_B_is_rx_frame_error_interrupt_pending(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_is_rx_frame_error_interrupt_pending(basePointer)
 #define SI32_UART_B_is_rx_frame_error_interrupt_pending(basePointer) \
@@ -1070,8 +1825,19 @@ _SI32_UART_B_is_rx_frame_error_interrupt_pending(SI32_UART_B_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_clear_rx_frame_error_interrupt(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_UART_B_CONTROL_RFRMERI_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_clear_rx_frame_error_interrupt(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_clear_rx_frame_error_interrupt(basePointer)
 #define SI32_UART_B_clear_rx_frame_error_interrupt(basePointer) \
@@ -1083,8 +1849,19 @@ _SI32_UART_B_clear_rx_frame_error_interrupt(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_B_is_rx_parity_error_interrupt_pending(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.RPARERI);
+   //}}
+}
+#else
 bool
 _SI32_UART_B_is_rx_parity_error_interrupt_pending(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_is_rx_parity_error_interrupt_pending(basePointer)
 #define SI32_UART_B_is_rx_parity_error_interrupt_pending(basePointer) \
@@ -1096,8 +1873,19 @@ _SI32_UART_B_is_rx_parity_error_interrupt_pending(SI32_UART_B_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_clear_rx_parity_error_interrupt(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_UART_B_CONTROL_RPARERI_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_clear_rx_parity_error_interrupt(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_clear_rx_parity_error_interrupt(basePointer)
 #define SI32_UART_B_clear_rx_parity_error_interrupt(basePointer) \
@@ -1109,8 +1897,19 @@ _SI32_UART_B_clear_rx_parity_error_interrupt(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_B_is_rx_overrun_interrupt_pending(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.ROREI);
+   //}}
+}
+#else
 bool
 _SI32_UART_B_is_rx_overrun_interrupt_pending(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_is_rx_overrun_interrupt_pending(basePointer)
 #define SI32_UART_B_is_rx_overrun_interrupt_pending(basePointer) \
@@ -1122,8 +1921,19 @@ _SI32_UART_B_is_rx_overrun_interrupt_pending(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_clear_rx_overrun_error_interrupt(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_UART_B_CONTROL_ROREI_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_clear_rx_overrun_error_interrupt(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_clear_rx_overrun_error_interrupt(basePointer)
 #define SI32_UART_B_clear_rx_overrun_error_interrupt(basePointer) \
@@ -1135,8 +1945,19 @@ _SI32_UART_B_clear_rx_overrun_error_interrupt(SI32_UART_B_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_B_is_rx_data_request_interrupt_pending(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.RDREQI);
+   //}}
+}
+#else
 bool
 _SI32_UART_B_is_rx_data_request_interrupt_pending(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_is_rx_data_request_interrupt_pending(basePointer)
 #define SI32_UART_B_is_rx_data_request_interrupt_pending(basePointer) \
@@ -1148,8 +1969,19 @@ _SI32_UART_B_is_rx_data_request_interrupt_pending(SI32_UART_B_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_clear_rx_data_request_interrupt(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_UART_B_CONTROL_RDREQI_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_clear_rx_data_request_interrupt(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_clear_rx_data_request_interrupt(basePointer)
 #define SI32_UART_B_clear_rx_data_request_interrupt(basePointer) \
@@ -1165,8 +1997,19 @@ _SI32_UART_B_clear_rx_data_request_interrupt(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_enable_rx_error_interrupts(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_SET = SI32_UART_B_CONTROL_RERIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_enable_rx_error_interrupts(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_enable_rx_error_interrupts(basePointer)
 #define SI32_UART_B_enable_rx_error_interrupts(basePointer) \
@@ -1182,8 +2025,19 @@ _SI32_UART_B_enable_rx_error_interrupts(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_disable_rx_error_interrupts(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_UART_B_CONTROL_RERIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_disable_rx_error_interrupts(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_disable_rx_error_interrupts(basePointer)
 #define SI32_UART_B_disable_rx_error_interrupts(basePointer) \
@@ -1195,8 +2049,19 @@ _SI32_UART_B_disable_rx_error_interrupts(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_B_is_rx_error_interrupts_enabled(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.RERIEN);
+   //}}
+}
+#else
 bool
 _SI32_UART_B_is_rx_error_interrupts_enabled(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_is_rx_error_interrupts_enabled(basePointer)
 #define SI32_UART_B_is_rx_error_interrupts_enabled(basePointer) \
@@ -1208,8 +2073,19 @@ _SI32_UART_B_is_rx_error_interrupts_enabled(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_enable_rx_data_request_interrupt(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_SET = SI32_UART_B_CONTROL_RDREQIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_enable_rx_data_request_interrupt(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_enable_rx_data_request_interrupt(basePointer)
 #define SI32_UART_B_enable_rx_data_request_interrupt(basePointer) \
@@ -1221,8 +2097,19 @@ _SI32_UART_B_enable_rx_data_request_interrupt(SI32_UART_B_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_disable_rx_data_request_interrupt(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_UART_B_CONTROL_RDREQIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_disable_rx_data_request_interrupt(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_disable_rx_data_request_interrupt(basePointer)
 #define SI32_UART_B_disable_rx_data_request_interrupt(basePointer) \
@@ -1234,8 +2121,19 @@ _SI32_UART_B_disable_rx_data_request_interrupt(SI32_UART_B_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_B_is_rx_data_request_interrupt_enabled(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.RDREQIEN);
+   //}}
+}
+#else
 bool
 _SI32_UART_B_is_rx_data_request_interrupt_enabled(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_is_rx_data_request_interrupt_enabled(basePointer)
 #define SI32_UART_B_is_rx_data_request_interrupt_enabled(basePointer) \
@@ -1247,8 +2145,19 @@ _SI32_UART_B_is_rx_data_request_interrupt_enabled(SI32_UART_B_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_exit_match_mode(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_UART_B_CONTROL_MATMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_exit_match_mode(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_exit_match_mode(basePointer)
 #define SI32_UART_B_exit_match_mode(basePointer) \
@@ -1260,8 +2169,20 @@ _SI32_UART_B_exit_match_mode(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_enter_match_mode_store_byte(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_UART_B_CONTROL_MATMD_MASK;
+   basePointer->CONTROL_SET = SI32_UART_B_CONTROL_MATMD_MCE_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_enter_match_mode_store_byte(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_enter_match_mode_store_byte(basePointer)
 #define SI32_UART_B_enter_match_mode_store_byte(basePointer) do{  \
@@ -1275,8 +2196,20 @@ _SI32_UART_B_enter_match_mode_store_byte(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_enter_match_mode_generate_frame_error(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_UART_B_CONTROL_MATMD_MASK;
+   basePointer->CONTROL_SET = SI32_UART_B_CONTROL_MATMD_FRAME_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_enter_match_mode_generate_frame_error(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_enter_match_mode_generate_frame_error(basePointer)
 #define SI32_UART_B_enter_match_mode_generate_frame_error(basePointer) do{  \
@@ -1290,8 +2223,19 @@ _SI32_UART_B_enter_match_mode_generate_frame_error(SI32_UART_B_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_enter_match_mode_store_bit(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_SET = SI32_UART_B_CONTROL_MATMD_STORE_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_enter_match_mode_store_bit(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_enter_match_mode_store_bit(basePointer)
 #define SI32_UART_B_enter_match_mode_store_bit(basePointer) \
@@ -1303,8 +2247,19 @@ _SI32_UART_B_enter_match_mode_store_bit(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_enable_rx_autobaud(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_SET = SI32_UART_B_CONTROL_RABDEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_enable_rx_autobaud(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_enable_rx_autobaud(basePointer)
 #define SI32_UART_B_enable_rx_autobaud(basePointer) \
@@ -1316,8 +2271,19 @@ _SI32_UART_B_enable_rx_autobaud(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_disable_rx_autobaud(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_UART_B_CONTROL_RABDEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_disable_rx_autobaud(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_disable_rx_autobaud(basePointer)
 #define SI32_UART_B_disable_rx_autobaud(basePointer) \
@@ -1329,8 +2295,19 @@ _SI32_UART_B_disable_rx_autobaud(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_B_is_rx_busy(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.RBUSYF);
+   //}}
+}
+#else
 bool
 _SI32_UART_B_is_rx_busy(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_is_rx_busy(basePointer)
 #define SI32_UART_B_is_rx_busy(basePointer) \
@@ -1342,8 +2319,19 @@ _SI32_UART_B_is_rx_busy(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_set_rbit(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_SET = SI32_UART_B_CONTROL_RBIT_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_set_rbit(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_set_rbit(basePointer)
 #define SI32_UART_B_set_rbit(basePointer) \
@@ -1355,8 +2343,19 @@ _SI32_UART_B_set_rbit(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_clear_rbit(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_UART_B_CONTROL_RBIT_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_clear_rbit(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_clear_rbit(basePointer)
 #define SI32_UART_B_clear_rbit(basePointer) \
@@ -1368,8 +2367,19 @@ _SI32_UART_B_clear_rbit(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_B_read_rbit(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.RBIT);
+   //}}
+}
+#else
 bool
 _SI32_UART_B_read_rbit(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_read_rbit(basePointer)
 #define SI32_UART_B_read_rbit(basePointer) \
@@ -1381,8 +2391,19 @@ _SI32_UART_B_read_rbit(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_enable_rx_one_shot(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_SET = SI32_UART_B_CONTROL_ROSEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_enable_rx_one_shot(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_enable_rx_one_shot(basePointer)
 #define SI32_UART_B_enable_rx_one_shot(basePointer) \
@@ -1394,8 +2415,19 @@ _SI32_UART_B_enable_rx_one_shot(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_disable_rx_one_shot(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_UART_B_CONTROL_ROSEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_disable_rx_one_shot(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_disable_rx_one_shot(basePointer)
 #define SI32_UART_B_disable_rx_one_shot(basePointer) \
@@ -1407,8 +2439,19 @@ _SI32_UART_B_disable_rx_one_shot(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_enable_rx_inhibit(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_SET = SI32_UART_B_CONTROL_RINH_ACTIVE_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_enable_rx_inhibit(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_enable_rx_inhibit(basePointer)
 #define SI32_UART_B_enable_rx_inhibit(basePointer) \
@@ -1420,8 +2463,19 @@ _SI32_UART_B_enable_rx_inhibit(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_disable_rx_inhibit(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_UART_B_CONTROL_RINH_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_disable_rx_inhibit(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_disable_rx_inhibit(basePointer)
 #define SI32_UART_B_disable_rx_inhibit(basePointer) \
@@ -1433,8 +2487,19 @@ _SI32_UART_B_disable_rx_inhibit(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_enable_rx(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_SET = SI32_UART_B_CONTROL_REN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_enable_rx(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_enable_rx(basePointer)
 #define SI32_UART_B_enable_rx(basePointer) \
@@ -1446,8 +2511,19 @@ _SI32_UART_B_enable_rx(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_disable_rx(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_UART_B_CONTROL_REN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_disable_rx(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_disable_rx(basePointer)
 #define SI32_UART_B_disable_rx(basePointer) \
@@ -1459,8 +2535,19 @@ _SI32_UART_B_disable_rx(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_B_is_tx_data_request_interrupt_pending(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.TDREQI);
+   //}}
+}
+#else
 bool
 _SI32_UART_B_is_tx_data_request_interrupt_pending(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_is_tx_data_request_interrupt_pending(basePointer)
 #define SI32_UART_B_is_tx_data_request_interrupt_pending(basePointer) \
@@ -1472,8 +2559,19 @@ _SI32_UART_B_is_tx_data_request_interrupt_pending(SI32_UART_B_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_B_is_tx_complete(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.TCPTI);
+   //}}
+}
+#else
 bool
 _SI32_UART_B_is_tx_complete(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_is_tx_complete(basePointer)
 #define SI32_UART_B_is_tx_complete(basePointer) \
@@ -1485,8 +2583,19 @@ _SI32_UART_B_is_tx_complete(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_clear_tx_complete_interrupt(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_UART_B_CONTROL_TCPTI_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_clear_tx_complete_interrupt(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_clear_tx_complete_interrupt(basePointer)
 #define SI32_UART_B_clear_tx_complete_interrupt(basePointer) \
@@ -1498,8 +2607,19 @@ _SI32_UART_B_clear_tx_complete_interrupt(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_select_tx_complete_threshold_end_of_transmission(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_UART_B_CONTROL_TCPTTH_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_select_tx_complete_threshold_end_of_transmission(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_select_tx_complete_threshold_end_of_transmission(basePointer)
 #define SI32_UART_B_select_tx_complete_threshold_end_of_transmission(basePointer) \
@@ -1511,8 +2631,19 @@ _SI32_UART_B_select_tx_complete_threshold_end_of_transmission(SI32_UART_B_Type*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_select_tx_complete_threshold_no_more_data(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_SET = SI32_UART_B_CONTROL_TCPTTH_SET_ON_EMPTY_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_select_tx_complete_threshold_no_more_data(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_select_tx_complete_threshold_no_more_data(basePointer)
 #define SI32_UART_B_select_tx_complete_threshold_no_more_data(basePointer) \
@@ -1524,8 +2655,19 @@ _SI32_UART_B_select_tx_complete_threshold_no_more_data(SI32_UART_B_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_enable_tx_data_request_interrupt(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_SET = SI32_UART_B_CONTROL_TDREQIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_enable_tx_data_request_interrupt(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_enable_tx_data_request_interrupt(basePointer)
 #define SI32_UART_B_enable_tx_data_request_interrupt(basePointer) \
@@ -1537,8 +2679,19 @@ _SI32_UART_B_enable_tx_data_request_interrupt(SI32_UART_B_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_disable_tx_data_request_interrupt(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_UART_B_CONTROL_TDREQIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_disable_tx_data_request_interrupt(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_disable_tx_data_request_interrupt(basePointer)
 #define SI32_UART_B_disable_tx_data_request_interrupt(basePointer) \
@@ -1550,8 +2703,19 @@ _SI32_UART_B_disable_tx_data_request_interrupt(SI32_UART_B_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_B_is_tx_data_request_interrupt_enabled(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.TDREQIEN);
+   //}}
+}
+#else
 bool
 _SI32_UART_B_is_tx_data_request_interrupt_enabled(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_is_tx_data_request_interrupt_enabled(basePointer)
 #define SI32_UART_B_is_tx_data_request_interrupt_enabled(basePointer) \
@@ -1563,8 +2727,19 @@ _SI32_UART_B_is_tx_data_request_interrupt_enabled(SI32_UART_B_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_enable_tx_complete_interrupt(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_SET = SI32_UART_B_CONTROL_TCPTIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_enable_tx_complete_interrupt(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_enable_tx_complete_interrupt(basePointer)
 #define SI32_UART_B_enable_tx_complete_interrupt(basePointer) \
@@ -1576,8 +2751,19 @@ _SI32_UART_B_enable_tx_complete_interrupt(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_disable_tx_complete_interrupt(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_UART_B_CONTROL_TCPTIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_disable_tx_complete_interrupt(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_disable_tx_complete_interrupt(basePointer)
 #define SI32_UART_B_disable_tx_complete_interrupt(basePointer) \
@@ -1589,8 +2775,19 @@ _SI32_UART_B_disable_tx_complete_interrupt(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_B_is_tx_complete_interrupt_enabled(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.TCPTIEN);
+   //}}
+}
+#else
 bool
 _SI32_UART_B_is_tx_complete_interrupt_enabled(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_is_tx_complete_interrupt_enabled(basePointer)
 #define SI32_UART_B_is_tx_complete_interrupt_enabled(basePointer) \
@@ -1602,8 +2799,19 @@ _SI32_UART_B_is_tx_complete_interrupt_enabled(SI32_UART_B_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_B_is_tx_busy(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.TBUSYF);
+   //}}
+}
+#else
 bool
 _SI32_UART_B_is_tx_busy(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_is_tx_busy(basePointer)
 #define SI32_UART_B_is_tx_busy(basePointer) \
@@ -1615,8 +2823,19 @@ _SI32_UART_B_is_tx_busy(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_set_tbit(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_SET = SI32_UART_B_CONTROL_TBIT_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_set_tbit(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_set_tbit(basePointer)
 #define SI32_UART_B_set_tbit(basePointer) \
@@ -1628,8 +2847,19 @@ _SI32_UART_B_set_tbit(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_clear_tbit(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_UART_B_CONTROL_TBIT_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_clear_tbit(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_clear_tbit(basePointer)
 #define SI32_UART_B_clear_tbit(basePointer) \
@@ -1641,8 +2871,19 @@ _SI32_UART_B_clear_tbit(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_enable_tx_inhibit(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_SET = SI32_UART_B_CONTROL_TINH_ACTIVE_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_enable_tx_inhibit(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_enable_tx_inhibit(basePointer)
 #define SI32_UART_B_enable_tx_inhibit(basePointer) \
@@ -1654,8 +2895,19 @@ _SI32_UART_B_enable_tx_inhibit(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_disable_tx_inhibit(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_UART_B_CONTROL_TINH_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_disable_tx_inhibit(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_disable_tx_inhibit(basePointer)
 #define SI32_UART_B_disable_tx_inhibit(basePointer) \
@@ -1667,8 +2919,19 @@ _SI32_UART_B_disable_tx_inhibit(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_enable_tx(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_SET = SI32_UART_B_CONTROL_TEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_enable_tx(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_enable_tx(basePointer)
 #define SI32_UART_B_enable_tx(basePointer) \
@@ -1680,8 +2943,19 @@ _SI32_UART_B_enable_tx(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_disable_tx(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_UART_B_CONTROL_TEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_disable_tx(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_disable_tx(basePointer)
 #define SI32_UART_B_disable_tx(basePointer) \
@@ -1701,9 +2975,21 @@ _SI32_UART_B_disable_tx(SI32_UART_B_Type* /*basePointer*/);
 ///  ipdelay
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_write_ipdelay(
+   SI32_UART_B_Type * basePointer,
+   uint32_t ipdelay)
+{
+   //{{
+	basePointer->IPDELAY.U32 = ipdelay;
+   //}}
+}
+#else
 void
 _SI32_UART_B_write_ipdelay(SI32_UART_B_Type* /*basePointer*/,
    uint32_t /*ipdelay*/);
+#endif
 ///
 /// @def SI32_UART_B_write_ipdelay(basePointer, ipdelay)
 #define SI32_UART_B_write_ipdelay(basePointer, ipdelay) \
@@ -1718,8 +3004,19 @@ _SI32_UART_B_write_ipdelay(SI32_UART_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_UART_B_read_ipdelay(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	return basePointer->IPDELAY.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_UART_B_read_ipdelay(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_read_ipdelay(basePointer)
 #define SI32_UART_B_read_ipdelay(basePointer) \
@@ -1739,9 +3036,22 @@ _SI32_UART_B_read_ipdelay(SI32_UART_B_Type* /*basePointer*/);
 ///  ipdelay
 ///  Valid range is 8 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_write_ipdelay_bits(
+   SI32_UART_B_Type * basePointer,
+   uint32_t ipdelay)
+{
+   assert(ipdelay < 256);   // ipdelay < 2^8
+   //{{
+	basePointer->IPDELAY.IPDELAY_BITS = ipdelay;
+   //}}
+}
+#else
 void
 _SI32_UART_B_write_ipdelay_bits(SI32_UART_B_Type* /*basePointer*/,
    uint32_t /*ipdelay*/);
+#endif
 ///
 /// @def SI32_UART_B_write_ipdelay_bits(basePointer, ipdelay)
 #define SI32_UART_B_write_ipdelay_bits(basePointer, ipdelay) \
@@ -1756,8 +3066,19 @@ _SI32_UART_B_write_ipdelay_bits(SI32_UART_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_UART_B_read_ipdelay_bits(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	return basePointer->IPDELAY.IPDELAY_BITS;
+   //}}
+}
+#else
 uint32_t
 _SI32_UART_B_read_ipdelay_bits(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_read_ipdelay_bits(basePointer)
 #define SI32_UART_B_read_ipdelay_bits(basePointer) \
@@ -1777,9 +3098,21 @@ _SI32_UART_B_read_ipdelay_bits(SI32_UART_B_Type* /*basePointer*/);
 ///  baudrate
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_write_baudrate(
+   SI32_UART_B_Type * basePointer,
+   uint32_t baudrate)
+{
+   //{{
+	basePointer->BAUDRATE.U32 = baudrate;
+   //}}
+}
+#else
 void
 _SI32_UART_B_write_baudrate(SI32_UART_B_Type* /*basePointer*/,
    uint32_t /*baudrate*/);
+#endif
 ///
 /// @def SI32_UART_B_write_baudrate(basePointer, baudrate)
 #define SI32_UART_B_write_baudrate(basePointer, baudrate) \
@@ -1794,8 +3127,19 @@ _SI32_UART_B_write_baudrate(SI32_UART_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_UART_B_read_baudrate(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	return basePointer->BAUDRATE.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_UART_B_read_baudrate(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_read_baudrate(basePointer)
 #define SI32_UART_B_read_baudrate(basePointer) \
@@ -1812,9 +3156,22 @@ _SI32_UART_B_read_baudrate(SI32_UART_B_Type* /*basePointer*/);
 ///  rxbaud
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_set_rx_baudrate(
+   SI32_UART_B_Type * basePointer,
+   uwide16_t rxbaud)
+{
+   assert(rxbaud < 65536);   // rxbaud < 2^16
+   //{{
+	basePointer->BAUDRATE.RBAUD = rxbaud;
+   //}}
+}
+#else
 void
 _SI32_UART_B_set_rx_baudrate(SI32_UART_B_Type* /*basePointer*/,
    uwide16_t /*rxbaud*/);
+#endif
 ///
 /// @def SI32_UART_B_set_rx_baudrate(basePointer, rxbaud)
 #define SI32_UART_B_set_rx_baudrate(basePointer, rxbaud) \
@@ -1831,9 +3188,22 @@ _SI32_UART_B_set_rx_baudrate(SI32_UART_B_Type* /*basePointer*/,
 ///  txbaud
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_set_tx_baudrate(
+   SI32_UART_B_Type * basePointer,
+   uwide16_t txbaud)
+{
+   assert(txbaud < 65536);   // txbaud < 2^16
+   //{{
+	basePointer->BAUDRATE.TBAUD = txbaud;
+   //}}
+}
+#else
 void
 _SI32_UART_B_set_tx_baudrate(SI32_UART_B_Type* /*basePointer*/,
    uwide16_t /*txbaud*/);
+#endif
 ///
 /// @def SI32_UART_B_set_tx_baudrate(basePointer, txbaud)
 #define SI32_UART_B_set_tx_baudrate(basePointer, txbaud) \
@@ -1853,9 +3223,21 @@ _SI32_UART_B_set_tx_baudrate(SI32_UART_B_Type* /*basePointer*/,
 ///  fifocn
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_write_fifocn(
+   SI32_UART_B_Type * basePointer,
+   uint32_t fifocn)
+{
+   //{{
+	basePointer->FIFOCN.U32 = fifocn;
+   //}}
+}
+#else
 void
 _SI32_UART_B_write_fifocn(SI32_UART_B_Type* /*basePointer*/,
    uint32_t /*fifocn*/);
+#endif
 ///
 /// @def SI32_UART_B_write_fifocn(basePointer, fifocn)
 #define SI32_UART_B_write_fifocn(basePointer, fifocn) \
@@ -1870,8 +3252,19 @@ _SI32_UART_B_write_fifocn(SI32_UART_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_UART_B_read_fifocn(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	return basePointer->FIFOCN.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_UART_B_read_fifocn(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_read_fifocn(basePointer)
 #define SI32_UART_B_read_fifocn(basePointer) \
@@ -1886,8 +3279,19 @@ _SI32_UART_B_read_fifocn(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_UART_B_read_rx_fifo_count(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	return (uint32_t)(basePointer->FIFOCN.RCNT);
+   //}}
+}
+#else
 uint32_t
 _SI32_UART_B_read_rx_fifo_count(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_read_rx_fifo_count(basePointer)
 #define SI32_UART_B_read_rx_fifo_count(basePointer) \
@@ -1899,8 +3303,19 @@ _SI32_UART_B_read_rx_fifo_count(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_select_rx_fifo_threshold_1(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FIFOCN_CLR = SI32_UART_B_FIFOCN_RFTH_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_select_rx_fifo_threshold_1(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_select_rx_fifo_threshold_1(basePointer)
 #define SI32_UART_B_select_rx_fifo_threshold_1(basePointer) \
@@ -1912,8 +3327,20 @@ _SI32_UART_B_select_rx_fifo_threshold_1(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_select_rx_fifo_threshold_2(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+   basePointer->FIFOCN_CLR = SI32_UART_B_FIFOCN_RFTH_MASK;
+   basePointer->FIFOCN_SET = SI32_UART_B_FIFOCN_RFTH_TWO_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_select_rx_fifo_threshold_2(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_select_rx_fifo_threshold_2(basePointer)
 #define SI32_UART_B_select_rx_fifo_threshold_2(basePointer) do{  \
@@ -1927,8 +3354,20 @@ _SI32_UART_B_select_rx_fifo_threshold_2(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_select_rx_fifo_threshold_4(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+   basePointer->FIFOCN_CLR = SI32_UART_B_FIFOCN_RFTH_MASK;
+   basePointer->FIFOCN_SET = SI32_UART_B_FIFOCN_RFTH_FOUR_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_select_rx_fifo_threshold_4(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_select_rx_fifo_threshold_4(basePointer)
 #define SI32_UART_B_select_rx_fifo_threshold_4(basePointer) do{  \
@@ -1942,8 +3381,19 @@ _SI32_UART_B_select_rx_fifo_threshold_4(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_flush_rx_fifo(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FIFOCN_SET = SI32_UART_B_FIFOCN_RFIFOFL_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_flush_rx_fifo(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_flush_rx_fifo(basePointer)
 #define SI32_UART_B_flush_rx_fifo(basePointer) \
@@ -1955,8 +3405,19 @@ _SI32_UART_B_flush_rx_fifo(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_B_is_rx_fifo_error_interrupt_pending(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->FIFOCN.RFERI);
+   //}}
+}
+#else
 bool
 _SI32_UART_B_is_rx_fifo_error_interrupt_pending(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_is_rx_fifo_error_interrupt_pending(basePointer)
 #define SI32_UART_B_is_rx_fifo_error_interrupt_pending(basePointer) \
@@ -1968,8 +3429,19 @@ _SI32_UART_B_is_rx_fifo_error_interrupt_pending(SI32_UART_B_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_clear_rx_fifo_error_interrupt(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FIFOCN_CLR = SI32_UART_B_FIFOCN_RFERI_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_clear_rx_fifo_error_interrupt(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_clear_rx_fifo_error_interrupt(basePointer)
 #define SI32_UART_B_clear_rx_fifo_error_interrupt(basePointer) \
@@ -1981,8 +3453,19 @@ _SI32_UART_B_clear_rx_fifo_error_interrupt(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_B_is_rx_shift_register_full(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->FIFOCN.RSRFULLF);
+   //}}
+}
+#else
 bool
 _SI32_UART_B_is_rx_shift_register_full(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_is_rx_shift_register_full(basePointer)
 #define SI32_UART_B_is_rx_shift_register_full(basePointer) \
@@ -1994,8 +3477,19 @@ _SI32_UART_B_is_rx_shift_register_full(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_UART_B_read_tx_fifo_count(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	return (uint32_t)(basePointer->FIFOCN.TCNT);
+   //}}
+}
+#else
 uint32_t
 _SI32_UART_B_read_tx_fifo_count(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_read_tx_fifo_count(basePointer)
 #define SI32_UART_B_read_tx_fifo_count(basePointer) \
@@ -2007,8 +3501,19 @@ _SI32_UART_B_read_tx_fifo_count(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_select_tx_fifo_threshold_for_request_to_1(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FIFOCN_CLR = SI32_UART_B_FIFOCN_TFTH_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_select_tx_fifo_threshold_for_request_to_1(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_select_tx_fifo_threshold_for_request_to_1(basePointer)
 #define SI32_UART_B_select_tx_fifo_threshold_for_request_to_1(basePointer) \
@@ -2020,8 +3525,20 @@ _SI32_UART_B_select_tx_fifo_threshold_for_request_to_1(SI32_UART_B_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_select_tx_fifo_threshold_for_request_to_2(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FIFOCN_CLR = SI32_UART_B_FIFOCN_TFTH_MASK;
+   basePointer->FIFOCN_SET = SI32_UART_B_FIFOCN_TFTH_TWO_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_select_tx_fifo_threshold_for_request_to_2(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_select_tx_fifo_threshold_for_request_to_2(basePointer)
 #define SI32_UART_B_select_tx_fifo_threshold_for_request_to_2(basePointer) do{  \
@@ -2035,8 +3552,20 @@ _SI32_UART_B_select_tx_fifo_threshold_for_request_to_2(SI32_UART_B_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_select_tx_fifo_threshold_for_request_to_4(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FIFOCN_CLR = SI32_UART_B_FIFOCN_TFTH_MASK;
+   basePointer->FIFOCN_SET = SI32_UART_B_FIFOCN_TFTH_FOUR_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_select_tx_fifo_threshold_for_request_to_4(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_select_tx_fifo_threshold_for_request_to_4(basePointer)
 #define SI32_UART_B_select_tx_fifo_threshold_for_request_to_4(basePointer) do{  \
@@ -2050,8 +3579,19 @@ _SI32_UART_B_select_tx_fifo_threshold_for_request_to_4(SI32_UART_B_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_flush_tx_fifo(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FIFOCN_SET = SI32_UART_B_FIFOCN_TFIFOFL_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_UART_B_flush_tx_fifo(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_flush_tx_fifo(basePointer)
 #define SI32_UART_B_flush_tx_fifo(basePointer) \
@@ -2063,8 +3603,19 @@ _SI32_UART_B_flush_tx_fifo(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_B_is_tx_fifo_error_interrupt_pending(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->FIFOCN.TFERI);
+   //}}
+}
+#else
 bool
 _SI32_UART_B_is_tx_fifo_error_interrupt_pending(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_is_tx_fifo_error_interrupt_pending(basePointer)
 #define SI32_UART_B_is_tx_fifo_error_interrupt_pending(basePointer) \
@@ -2076,8 +3627,19 @@ _SI32_UART_B_is_tx_fifo_error_interrupt_pending(SI32_UART_B_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_clear_tx_fifo_error_interrupt(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FIFOCN_CLR = SI32_UART_B_FIFOCN_TFERI_MASK;
+   //}}
+}
+#else
 void
 _SI32_UART_B_clear_tx_fifo_error_interrupt(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_clear_tx_fifo_error_interrupt(basePointer)
 #define SI32_UART_B_clear_tx_fifo_error_interrupt(basePointer) \
@@ -2089,8 +3651,19 @@ _SI32_UART_B_clear_tx_fifo_error_interrupt(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_UART_B_is_tx_shift_register_full(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->FIFOCN.TSRFULLF);
+   //}}
+}
+#else
 bool
 _SI32_UART_B_is_tx_shift_register_full(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_is_tx_shift_register_full(basePointer)
 #define SI32_UART_B_is_tx_shift_register_full(basePointer) \
@@ -2102,8 +3675,19 @@ _SI32_UART_B_is_tx_shift_register_full(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_UART_B_read_data_u32(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	return (uint32_t)(basePointer->DATA.U32);
+   //}}
+}
+#else
 uint32_t
 _SI32_UART_B_read_data_u32(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_read_data_u32(basePointer)
 #define SI32_UART_B_read_data_u32(basePointer) \
@@ -2115,8 +3699,19 @@ _SI32_UART_B_read_data_u32(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint16_t
+_SI32_UART_B_read_data_u16(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	return basePointer->DATA.U16;
+   //}}
+}
+#else
 uint16_t
 _SI32_UART_B_read_data_u16(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_read_data_u16(basePointer)
 #define SI32_UART_B_read_data_u16(basePointer) \
@@ -2128,8 +3723,19 @@ _SI32_UART_B_read_data_u16(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint8_t
+_SI32_UART_B_read_data_u8(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	return basePointer->DATA.U8;
+   //}}
+}
+#else
 uint8_t
 _SI32_UART_B_read_data_u8(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_read_data_u8(basePointer)
 #define SI32_UART_B_read_data_u8(basePointer) \
@@ -2146,9 +3752,21 @@ _SI32_UART_B_read_data_u8(SI32_UART_B_Type* /*basePointer*/);
 ///  dataval
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_write_data_u32(
+   SI32_UART_B_Type * basePointer,
+   uint32_t dataval)
+{
+   //{{
+	basePointer->DATA.U32 = dataval;
+   //}}
+}
+#else
 void
 _SI32_UART_B_write_data_u32(SI32_UART_B_Type* /*basePointer*/,
    uint32_t /*dataval*/);
+#endif
 ///
 /// @def SI32_UART_B_write_data_u32(basePointer, dataval)
 #define SI32_UART_B_write_data_u32(basePointer, dataval) \
@@ -2165,9 +3783,22 @@ _SI32_UART_B_write_data_u32(SI32_UART_B_Type* /*basePointer*/,
 ///  dataval
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_write_data_u16(
+   SI32_UART_B_Type * basePointer,
+   uwide16_t dataval)
+{
+   assert(dataval < 65536);   // dataval < 2^16
+   //{{
+	basePointer->DATA.U16 = dataval;
+   //}}
+}
+#else
 void
 _SI32_UART_B_write_data_u16(SI32_UART_B_Type* /*basePointer*/,
    uwide16_t /*dataval*/);
+#endif
 ///
 /// @def SI32_UART_B_write_data_u16(basePointer, dataval)
 #define SI32_UART_B_write_data_u16(basePointer, dataval) \
@@ -2184,9 +3815,22 @@ _SI32_UART_B_write_data_u16(SI32_UART_B_Type* /*basePointer*/,
 ///  dataval
 ///  Valid range is 8 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_write_data_u8(
+   SI32_UART_B_Type * basePointer,
+   uwide8_t dataval)
+{
+   assert(dataval < 256);   // dataval < 2^8
+   //{{
+   basePointer->DATA.U8 = dataval;
+   //}}
+}
+#else
 void
 _SI32_UART_B_write_data_u8(SI32_UART_B_Type* /*basePointer*/,
    uwide8_t /*dataval*/);
+#endif
 ///
 /// @def SI32_UART_B_write_data_u8(basePointer, dataval)
 #define SI32_UART_B_write_data_u8(basePointer, dataval) \
@@ -2206,9 +3850,21 @@ _SI32_UART_B_write_data_u8(SI32_UART_B_Type* /*basePointer*/,
 ///  clkdiv
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_write_clkdiv(
+   SI32_UART_B_Type * basePointer,
+   uint32_t clkdiv)
+{
+   //{{
+	basePointer->CLKDIV.U32 = clkdiv;
+   //}}
+}
+#else
 void
 _SI32_UART_B_write_clkdiv(SI32_UART_B_Type* /*basePointer*/,
    uint32_t /*clkdiv*/);
+#endif
 ///
 /// @def SI32_UART_B_write_clkdiv(basePointer, clkdiv)
 #define SI32_UART_B_write_clkdiv(basePointer, clkdiv) \
@@ -2223,8 +3879,19 @@ _SI32_UART_B_write_clkdiv(SI32_UART_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_UART_B_read_clkdiv(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+   return basePointer->CLKDIV.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_UART_B_read_clkdiv(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_read_clkdiv(basePointer)
 #define SI32_UART_B_read_clkdiv(basePointer) \
@@ -2236,8 +3903,19 @@ _SI32_UART_B_read_clkdiv(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_select_clock_source_apb_div1(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CLKDIV.CLKDIV_BITS = SI32_UART_B_CLKDIV_CLKDIV_DIV1_VALUE;
+   //}}
+}
+#else
 void
 _SI32_UART_B_select_clock_source_apb_div1(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_select_clock_source_apb_div1(basePointer)
 #define SI32_UART_B_select_clock_source_apb_div1(basePointer) \
@@ -2249,8 +3927,19 @@ _SI32_UART_B_select_clock_source_apb_div1(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_select_clock_source_apb_div2(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CLKDIV.CLKDIV_BITS = SI32_UART_B_CLKDIV_CLKDIV_DIV2_VALUE;
+   //}}
+}
+#else
 void
 _SI32_UART_B_select_clock_source_apb_div2(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_select_clock_source_apb_div2(basePointer)
 #define SI32_UART_B_select_clock_source_apb_div2(basePointer) \
@@ -2262,8 +3951,19 @@ _SI32_UART_B_select_clock_source_apb_div2(SI32_UART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_UART_B_select_clock_source_apb_div4(
+   SI32_UART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CLKDIV.CLKDIV_BITS = SI32_UART_B_CLKDIV_CLKDIV_DIV4_VALUE;
+   //}}
+}
+#else
 void
 _SI32_UART_B_select_clock_source_apb_div4(SI32_UART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_UART_B_select_clock_source_apb_div4(basePointer)
 #define SI32_UART_B_select_clock_source_apb_div4(basePointer) \
@@ -88,6 +88,36 @@ extern "C" {
 ///  Valid range is 32 bits.
 ///  Write to FIFOCN register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_initialize(
+   SI32_USART_A_Type * basePointer,
+   // Write to CONFIG register.
+   uint32_t config,
+   // Write to MODE register.
+   uint32_t mode,
+   // Write to FLOWCN register.
+   uint32_t flowcn,
+   // Write to CONTROL register.
+   uint32_t control,
+   // Write to IPDELAY register.
+   uint32_t ipdelay,
+   // Write to BAUDRATE register.
+   uint32_t baudrate,
+   // Write to FIFOCN register.
+   uint32_t fifocn)
+{
+   //{{
+   basePointer->CONFIG.U32 = config;
+   basePointer->MODE.U32 = mode;
+   basePointer->FLOWCN.U32 = flowcn;
+   basePointer->CONTROL.U32 = control;
+   basePointer->IPDELAY.U32 = ipdelay;
+   basePointer->BAUDRATE.U32 = baudrate;
+   basePointer->FIFOCN.U32 = fifocn;
+   //}}
+}
+#else
 void
 _SI32_USART_A_initialize(SI32_USART_A_Type* /*basePointer*/,
    uint32_t, /*config*/
@@ -97,6 +127,7 @@ _SI32_USART_A_initialize(SI32_USART_A_Type* /*basePointer*/,
    uint32_t, /*ipdelay*/
    uint32_t, /*baudrate*/
    uint32_t /*fifocn*/);
+#endif
 ///
 /// @def SI32_USART_A_initialize(basePointer, config, mode, flowcn, control, ipdelay, baudrate, fifocn)
 #define SI32_USART_A_initialize(basePointer, config, mode, flowcn, control, ipdelay, baudrate, fifocn) \
@@ -116,9 +147,21 @@ _SI32_USART_A_initialize(SI32_USART_A_Type* /*basePointer*/,
 ///  config
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_write_config(
+   SI32_USART_A_Type * basePointer,
+   uint32_t config)
+{
+   //{{
+   basePointer->CONFIG.U32 = config;
+   //}}
+}
+#else
 void
 _SI32_USART_A_write_config(SI32_USART_A_Type* /*basePointer*/,
    uint32_t /*config*/);
+#endif
 ///
 /// @def SI32_USART_A_write_config(basePointer, config)
 #define SI32_USART_A_write_config(basePointer, config) \
@@ -133,8 +176,19 @@ _SI32_USART_A_write_config(SI32_USART_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USART_A_read_config(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONFIG.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_USART_A_read_config(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_read_config(basePointer)
 #define SI32_USART_A_read_config(basePointer) \
@@ -146,8 +200,19 @@ _SI32_USART_A_read_config(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enable_rx_start_bit(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_USART_A_CONFIG_RSTRTEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enable_rx_start_bit(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enable_rx_start_bit(basePointer)
 #define SI32_USART_A_enable_rx_start_bit(basePointer) \
@@ -159,8 +224,19 @@ _SI32_USART_A_enable_rx_start_bit(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_disable_rx_start_bit(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_USART_A_CONFIG_RSTRTEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_disable_rx_start_bit(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_disable_rx_start_bit(basePointer)
 #define SI32_USART_A_disable_rx_start_bit(basePointer) \
@@ -172,8 +248,19 @@ _SI32_USART_A_disable_rx_start_bit(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enable_rx_parity_bit(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_USART_A_CONFIG_RPAREN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enable_rx_parity_bit(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enable_rx_parity_bit(basePointer)
 #define SI32_USART_A_enable_rx_parity_bit(basePointer) \
@@ -185,8 +272,19 @@ _SI32_USART_A_enable_rx_parity_bit(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_disable_rx_parity_bit(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_USART_A_CONFIG_RPAREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_disable_rx_parity_bit(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_disable_rx_parity_bit(basePointer)
 #define SI32_USART_A_disable_rx_parity_bit(basePointer) \
@@ -198,8 +296,19 @@ _SI32_USART_A_disable_rx_parity_bit(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enable_rx_stop_bit(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_USART_A_CONFIG_RSTPEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enable_rx_stop_bit(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enable_rx_stop_bit(basePointer)
 #define SI32_USART_A_enable_rx_stop_bit(basePointer) \
@@ -211,8 +320,19 @@ _SI32_USART_A_enable_rx_stop_bit(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_disable_rx_stop_bit(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_USART_A_CONFIG_RSTPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_disable_rx_stop_bit(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_disable_rx_stop_bit(basePointer)
 #define SI32_USART_A_disable_rx_stop_bit(basePointer) \
@@ -233,9 +353,23 @@ _SI32_USART_A_disable_rx_stop_bit(SI32_USART_A_Type* /*basePointer*/);
 ///  bits
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_select_rx_stop_bits(
+   SI32_USART_A_Type * basePointer,
+   SI32_USART_A_STOP_BITS_Enum_Type bits)
+{
+   assert(bits < 4);   // bits < 2^2
+   //{{
+   basePointer->CONFIG_CLR = SI32_USART_A_CONFIG_RSTPMD_MASK;
+   basePointer->CONFIG_SET = bits << SI32_USART_A_CONFIG_RSTPMD_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_USART_A_select_rx_stop_bits(SI32_USART_A_Type* /*basePointer*/,
    SI32_USART_A_STOP_BITS_Enum_Type /*bits*/);
+#endif
 ///
 /// @def SI32_USART_A_select_rx_stop_bits(basePointer, bits)
 #define SI32_USART_A_select_rx_stop_bits(basePointer, bits) do{  \
@@ -257,9 +391,23 @@ _SI32_USART_A_select_rx_stop_bits(SI32_USART_A_Type* /*basePointer*/,
 ///  parity
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_select_rx_parity(
+   SI32_USART_A_Type * basePointer,
+   SI32_USART_A_PARITY_Enum_Type parity)
+{
+   assert(parity < 4);   // parity < 2^2
+   //{{
+   basePointer->CONFIG_CLR = SI32_USART_A_CONFIG_RPARMD_MASK;
+   basePointer->CONFIG_SET = parity << SI32_USART_A_CONFIG_RPARMD_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_USART_A_select_rx_parity(SI32_USART_A_Type* /*basePointer*/,
    SI32_USART_A_PARITY_Enum_Type /*parity*/);
+#endif
 ///
 /// @def SI32_USART_A_select_rx_parity(basePointer, parity)
 #define SI32_USART_A_select_rx_parity(basePointer, parity) do{  \
@@ -282,9 +430,23 @@ _SI32_USART_A_select_rx_parity(SI32_USART_A_Type* /*basePointer*/,
 ///  length
 ///  Valid range is 5 to 10.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_select_rx_data_length(
+   SI32_USART_A_Type * basePointer,
+   SI32_USART_A_DATA_LENGTH_Enum_Type length)
+{
+   assert((length >= 5) && (length <= 10));
+   //{{
+   basePointer->CONFIG_CLR = SI32_USART_A_CONFIG_RDATLN_MASK;
+   basePointer->CONFIG_SET = (length - 5) << SI32_USART_A_CONFIG_RDATLN_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_USART_A_select_rx_data_length(SI32_USART_A_Type* /*basePointer*/,
    SI32_USART_A_DATA_LENGTH_Enum_Type /*length*/);
+#endif
 ///
 /// @def SI32_USART_A_select_rx_data_length(basePointer, length)
 #define SI32_USART_A_select_rx_data_length(basePointer, length) do{  \
@@ -298,8 +460,19 @@ _SI32_USART_A_select_rx_data_length(SI32_USART_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enable_rx_smartcard_parity_response(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_USART_A_CONFIG_RSCEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enable_rx_smartcard_parity_response(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enable_rx_smartcard_parity_response(basePointer)
 #define SI32_USART_A_enable_rx_smartcard_parity_response(basePointer) \
@@ -311,8 +484,19 @@ _SI32_USART_A_enable_rx_smartcard_parity_response(SI32_USART_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_disable_rx_smartcard_parity_response(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_USART_A_CONFIG_RSCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_disable_rx_smartcard_parity_response(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_disable_rx_smartcard_parity_response(basePointer)
 #define SI32_USART_A_disable_rx_smartcard_parity_response(basePointer) \
@@ -324,8 +508,19 @@ _SI32_USART_A_disable_rx_smartcard_parity_response(SI32_USART_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enable_rx_irda_mode(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_USART_A_CONFIG_RIRDAEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enable_rx_irda_mode(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enable_rx_irda_mode(basePointer)
 #define SI32_USART_A_enable_rx_irda_mode(basePointer) \
@@ -337,8 +532,19 @@ _SI32_USART_A_enable_rx_irda_mode(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_disable_rx_irda_mode(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_USART_A_CONFIG_RIRDAEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_disable_rx_irda_mode(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_disable_rx_irda_mode(basePointer)
 #define SI32_USART_A_disable_rx_irda_mode(basePointer) \
@@ -350,8 +556,19 @@ _SI32_USART_A_disable_rx_irda_mode(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enable_rx_signal_inversion(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_USART_A_CONFIG_RINVEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enable_rx_signal_inversion(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enable_rx_signal_inversion(basePointer)
 #define SI32_USART_A_enable_rx_signal_inversion(basePointer) \
@@ -363,8 +580,19 @@ _SI32_USART_A_enable_rx_signal_inversion(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_disable_rx_signal_inversion(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_USART_A_CONFIG_RINVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_disable_rx_signal_inversion(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_disable_rx_signal_inversion(basePointer)
 #define SI32_USART_A_disable_rx_signal_inversion(basePointer) \
@@ -376,8 +604,19 @@ _SI32_USART_A_disable_rx_signal_inversion(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_select_rx_asynchronous_mode(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_USART_A_CONFIG_RSYNCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_select_rx_asynchronous_mode(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_select_rx_asynchronous_mode(basePointer)
 #define SI32_USART_A_select_rx_asynchronous_mode(basePointer) \
@@ -389,8 +628,19 @@ _SI32_USART_A_select_rx_asynchronous_mode(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_select_rx_synchronous_mode(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_USART_A_CONFIG_RSYNCEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_select_rx_synchronous_mode(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_select_rx_synchronous_mode(basePointer)
 #define SI32_USART_A_select_rx_synchronous_mode(basePointer) \
@@ -402,8 +652,19 @@ _SI32_USART_A_select_rx_synchronous_mode(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enable_tx_start_bit(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_USART_A_CONFIG_TSTRTEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enable_tx_start_bit(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enable_tx_start_bit(basePointer)
 #define SI32_USART_A_enable_tx_start_bit(basePointer) \
@@ -415,8 +676,19 @@ _SI32_USART_A_enable_tx_start_bit(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_disable_tx_start_bit(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_USART_A_CONFIG_TSTRTEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_disable_tx_start_bit(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_disable_tx_start_bit(basePointer)
 #define SI32_USART_A_disable_tx_start_bit(basePointer) \
@@ -428,8 +700,19 @@ _SI32_USART_A_disable_tx_start_bit(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enable_tx_parity_bit(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_USART_A_CONFIG_TPAREN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enable_tx_parity_bit(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enable_tx_parity_bit(basePointer)
 #define SI32_USART_A_enable_tx_parity_bit(basePointer) \
@@ -441,8 +724,19 @@ _SI32_USART_A_enable_tx_parity_bit(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_disable_tx_parity_bit(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_USART_A_CONFIG_TPAREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_disable_tx_parity_bit(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_disable_tx_parity_bit(basePointer)
 #define SI32_USART_A_disable_tx_parity_bit(basePointer) \
@@ -454,8 +748,19 @@ _SI32_USART_A_disable_tx_parity_bit(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enable_tx_stop_bit(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_USART_A_CONFIG_TSTPEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enable_tx_stop_bit(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enable_tx_stop_bit(basePointer)
 #define SI32_USART_A_enable_tx_stop_bit(basePointer) \
@@ -467,8 +772,19 @@ _SI32_USART_A_enable_tx_stop_bit(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_disable_tx_stop_bit(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_USART_A_CONFIG_TSTPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_disable_tx_stop_bit(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_disable_tx_stop_bit(basePointer)
 #define SI32_USART_A_disable_tx_stop_bit(basePointer) \
@@ -489,9 +805,23 @@ _SI32_USART_A_disable_tx_stop_bit(SI32_USART_A_Type* /*basePointer*/);
 ///  bits
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_select_tx_stop_bits(
+   SI32_USART_A_Type * basePointer,
+   SI32_USART_A_STOP_BITS_Enum_Type bits)
+{
+   assert(bits < 4);   // bits < 2^2
+   //{{
+   basePointer->CONFIG_CLR = SI32_USART_A_CONFIG_TSTPMD_MASK;
+   basePointer->CONFIG_SET = bits << SI32_USART_A_CONFIG_TSTPMD_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_USART_A_select_tx_stop_bits(SI32_USART_A_Type* /*basePointer*/,
    SI32_USART_A_STOP_BITS_Enum_Type /*bits*/);
+#endif
 ///
 /// @def SI32_USART_A_select_tx_stop_bits(basePointer, bits)
 #define SI32_USART_A_select_tx_stop_bits(basePointer, bits) do{  \
@@ -513,9 +843,23 @@ _SI32_USART_A_select_tx_stop_bits(SI32_USART_A_Type* /*basePointer*/,
 ///  parity
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_select_tx_parity(
+   SI32_USART_A_Type * basePointer,
+   SI32_USART_A_PARITY_Enum_Type parity)
+{
+   assert(parity < 4);   // parity < 2^2
+   //{{
+   basePointer->CONFIG_CLR = SI32_USART_A_CONFIG_TPARMD_MASK;
+   basePointer->CONFIG_SET = parity << SI32_USART_A_CONFIG_TPARMD_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_USART_A_select_tx_parity(SI32_USART_A_Type* /*basePointer*/,
    SI32_USART_A_PARITY_Enum_Type /*parity*/);
+#endif
 ///
 /// @def SI32_USART_A_select_tx_parity(basePointer, parity)
 #define SI32_USART_A_select_tx_parity(basePointer, parity) do{  \
@@ -538,9 +882,23 @@ _SI32_USART_A_select_tx_parity(SI32_USART_A_Type* /*basePointer*/,
 ///  length
 ///  Valid range is 5 to 10.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_select_tx_data_length(
+   SI32_USART_A_Type * basePointer,
+   SI32_USART_A_DATA_LENGTH_Enum_Type length)
+{
+   assert((length >= 5) && (length <= 10));
+   //{{
+   basePointer->CONFIG_CLR = SI32_USART_A_CONFIG_TDATLN_MASK;
+   basePointer->CONFIG_SET = (length - 5) << SI32_USART_A_CONFIG_TDATLN_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_USART_A_select_tx_data_length(SI32_USART_A_Type* /*basePointer*/,
    SI32_USART_A_DATA_LENGTH_Enum_Type /*length*/);
+#endif
 ///
 /// @def SI32_USART_A_select_tx_data_length(basePointer, length)
 #define SI32_USART_A_select_tx_data_length(basePointer, length) do{  \
@@ -554,8 +912,19 @@ _SI32_USART_A_select_tx_data_length(SI32_USART_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enable_tx_smartcard_parity_check(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_USART_A_CONFIG_TSCEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enable_tx_smartcard_parity_check(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enable_tx_smartcard_parity_check(basePointer)
 #define SI32_USART_A_enable_tx_smartcard_parity_check(basePointer) \
@@ -567,8 +936,19 @@ _SI32_USART_A_enable_tx_smartcard_parity_check(SI32_USART_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_disable_tx_smartcard_parity_check(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_USART_A_CONFIG_TSCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_disable_tx_smartcard_parity_check(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_disable_tx_smartcard_parity_check(basePointer)
 #define SI32_USART_A_disable_tx_smartcard_parity_check(basePointer) \
@@ -580,8 +960,19 @@ _SI32_USART_A_disable_tx_smartcard_parity_check(SI32_USART_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enable_tx_irda_mode(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_USART_A_CONFIG_TIRDAEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enable_tx_irda_mode(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enable_tx_irda_mode(basePointer)
 #define SI32_USART_A_enable_tx_irda_mode(basePointer) \
@@ -593,8 +984,19 @@ _SI32_USART_A_enable_tx_irda_mode(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_disable_tx_irda_mode(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_USART_A_CONFIG_TIRDAEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_disable_tx_irda_mode(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_disable_tx_irda_mode(basePointer)
 #define SI32_USART_A_disable_tx_irda_mode(basePointer) \
@@ -606,8 +1008,19 @@ _SI32_USART_A_disable_tx_irda_mode(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enable_tx_signal_inversion(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_USART_A_CONFIG_TINVEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enable_tx_signal_inversion(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enable_tx_signal_inversion(basePointer)
 #define SI32_USART_A_enable_tx_signal_inversion(basePointer) \
@@ -619,8 +1032,19 @@ _SI32_USART_A_enable_tx_signal_inversion(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_disable_tx_signal_inversion(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_USART_A_CONFIG_TINVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_disable_tx_signal_inversion(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_disable_tx_signal_inversion(basePointer)
 #define SI32_USART_A_disable_tx_signal_inversion(basePointer) \
@@ -632,8 +1056,19 @@ _SI32_USART_A_disable_tx_signal_inversion(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_select_tx_asynchronous_mode(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_USART_A_CONFIG_TSYNCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_select_tx_asynchronous_mode(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_select_tx_asynchronous_mode(basePointer)
 #define SI32_USART_A_select_tx_asynchronous_mode(basePointer) \
@@ -645,8 +1080,19 @@ _SI32_USART_A_select_tx_asynchronous_mode(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_select_tx_synchronous_mode(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_USART_A_CONFIG_TSYNCEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_select_tx_synchronous_mode(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_select_tx_synchronous_mode(basePointer)
 #define SI32_USART_A_select_tx_synchronous_mode(basePointer) \
@@ -666,9 +1112,21 @@ _SI32_USART_A_select_tx_synchronous_mode(SI32_USART_A_Type* /*basePointer*/);
 ///  mode
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_write_mode(
+   SI32_USART_A_Type * basePointer,
+   uint32_t mode)
+{
+   //{{
+   basePointer->MODE.U32 = mode;
+   //}}
+}
+#else
 void
 _SI32_USART_A_write_mode(SI32_USART_A_Type* /*basePointer*/,
    uint32_t /*mode*/);
+#endif
 ///
 /// @def SI32_USART_A_write_mode(basePointer, mode)
 #define SI32_USART_A_write_mode(basePointer, mode) \
@@ -683,8 +1141,19 @@ _SI32_USART_A_write_mode(SI32_USART_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USART_A_read_mode(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   return basePointer->MODE.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_USART_A_read_mode(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_read_mode(basePointer)
 #define SI32_USART_A_read_mode(basePointer) \
@@ -696,8 +1165,19 @@ _SI32_USART_A_read_mode(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enable_stall_in_debug_mode(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_SET = SI32_USART_A_MODE_DBGMD_HALT_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enable_stall_in_debug_mode(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enable_stall_in_debug_mode(basePointer)
 #define SI32_USART_A_enable_stall_in_debug_mode(basePointer) \
@@ -709,8 +1189,19 @@ _SI32_USART_A_enable_stall_in_debug_mode(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_disable_stall_in_debug_mode(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_CLR = SI32_USART_A_MODE_DBGMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_disable_stall_in_debug_mode(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_disable_stall_in_debug_mode(basePointer)
 #define SI32_USART_A_disable_stall_in_debug_mode(basePointer) \
@@ -722,8 +1213,19 @@ _SI32_USART_A_disable_stall_in_debug_mode(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_exit_loopback_mode(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_CLR = SI32_USART_A_MODE_LBMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_exit_loopback_mode(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_exit_loopback_mode(basePointer)
 #define SI32_USART_A_exit_loopback_mode(basePointer) \
@@ -735,8 +1237,20 @@ _SI32_USART_A_exit_loopback_mode(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enter_receive_loopback_mode(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_CLR = SI32_USART_A_MODE_LBMD_MASK;
+   basePointer->MODE_SET = SI32_USART_A_MODE_LBMD_RXONLY_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enter_receive_loopback_mode(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enter_receive_loopback_mode(basePointer)
 #define SI32_USART_A_enter_receive_loopback_mode(basePointer) do{  \
@@ -750,8 +1264,20 @@ _SI32_USART_A_enter_receive_loopback_mode(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enter_transmit_loopback_mode(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_CLR = SI32_USART_A_MODE_LBMD_MASK;
+   basePointer->MODE_SET = SI32_USART_A_MODE_LBMD_TXONLY_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enter_transmit_loopback_mode(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enter_transmit_loopback_mode(basePointer)
 #define SI32_USART_A_enter_transmit_loopback_mode(basePointer) do{  \
@@ -765,8 +1291,19 @@ _SI32_USART_A_enter_transmit_loopback_mode(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enter_full_loopback_mode(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_SET = SI32_USART_A_MODE_LBMD_BOTH_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enter_full_loopback_mode(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enter_full_loopback_mode(basePointer)
 #define SI32_USART_A_enter_full_loopback_mode(basePointer) \
@@ -778,8 +1315,19 @@ _SI32_USART_A_enter_full_loopback_mode(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enable_master_generate_clock_during_stop(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_SET = SI32_USART_A_MODE_STPSTCLK_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enable_master_generate_clock_during_stop(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enable_master_generate_clock_during_stop(basePointer)
 #define SI32_USART_A_enable_master_generate_clock_during_stop(basePointer) \
@@ -791,8 +1339,19 @@ _SI32_USART_A_enable_master_generate_clock_during_stop(SI32_USART_A_Type* /*base
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_disable_master_generate_clock_during_stop(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_CLR = SI32_USART_A_MODE_STPSTCLK_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_disable_master_generate_clock_during_stop(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_disable_master_generate_clock_during_stop(basePointer)
 #define SI32_USART_A_disable_master_generate_clock_during_stop(basePointer) \
@@ -804,8 +1363,19 @@ _SI32_USART_A_disable_master_generate_clock_during_stop(SI32_USART_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enable_master_generate_clock_during_start(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_SET = SI32_USART_A_MODE_STRTSTCLK_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enable_master_generate_clock_during_start(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enable_master_generate_clock_during_start(basePointer)
 #define SI32_USART_A_enable_master_generate_clock_during_start(basePointer) \
@@ -817,8 +1387,19 @@ _SI32_USART_A_enable_master_generate_clock_during_start(SI32_USART_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_disable_master_generate_clock_during_start(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_CLR = SI32_USART_A_MODE_STRTSTCLK_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_disable_master_generate_clock_during_start(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_disable_master_generate_clock_during_start(basePointer)
 #define SI32_USART_A_disable_master_generate_clock_during_start(basePointer) \
@@ -830,8 +1411,19 @@ _SI32_USART_A_disable_master_generate_clock_during_start(SI32_USART_A_Type* /*ba
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enable_master_generate_clock_between_transfers(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_SET = SI32_USART_A_MODE_ISTCLK_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enable_master_generate_clock_between_transfers(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enable_master_generate_clock_between_transfers(basePointer)
 #define SI32_USART_A_enable_master_generate_clock_between_transfers(basePointer) \
@@ -843,8 +1435,19 @@ _SI32_USART_A_enable_master_generate_clock_between_transfers(SI32_USART_A_Type*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_disable_master_generate_clock_between_transfers(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_CLR = SI32_USART_A_MODE_ISTCLK_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_disable_master_generate_clock_between_transfers(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_disable_master_generate_clock_between_transfers(basePointer)
 #define SI32_USART_A_disable_master_generate_clock_between_transfers(basePointer) \
@@ -856,8 +1459,19 @@ _SI32_USART_A_disable_master_generate_clock_between_transfers(SI32_USART_A_Type*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enter_half_duplex_mode(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_SET = SI32_USART_A_MODE_DUPLEXMD_HALF_DUPLEX_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enter_half_duplex_mode(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enter_half_duplex_mode(basePointer)
 #define SI32_USART_A_enter_half_duplex_mode(basePointer) \
@@ -869,8 +1483,19 @@ _SI32_USART_A_enter_half_duplex_mode(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enter_full_duplex_mode(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_CLR = SI32_USART_A_MODE_DUPLEXMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enter_full_duplex_mode(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enter_full_duplex_mode(basePointer)
 #define SI32_USART_A_enter_full_duplex_mode(basePointer) \
@@ -882,8 +1507,19 @@ _SI32_USART_A_enter_full_duplex_mode(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_select_sync_clock_low_during_idle(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_CLR = SI32_USART_A_MODE_CLKIDLE_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_select_sync_clock_low_during_idle(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_select_sync_clock_low_during_idle(basePointer)
 #define SI32_USART_A_select_sync_clock_low_during_idle(basePointer) \
@@ -895,8 +1531,19 @@ _SI32_USART_A_select_sync_clock_low_during_idle(SI32_USART_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_select_sync_clock_high_during_idle(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_SET = SI32_USART_A_MODE_CLKIDLE_IDLE_HIGH_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_select_sync_clock_high_during_idle(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_select_sync_clock_high_during_idle(basePointer)
 #define SI32_USART_A_select_sync_clock_high_during_idle(basePointer) \
@@ -908,8 +1555,19 @@ _SI32_USART_A_select_sync_clock_high_during_idle(SI32_USART_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_select_clock_edge_falling(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_CLR = SI32_USART_A_MODE_CLKESEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_select_clock_edge_falling(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_select_clock_edge_falling(basePointer)
 #define SI32_USART_A_select_clock_edge_falling(basePointer) \
@@ -921,8 +1579,19 @@ _SI32_USART_A_select_clock_edge_falling(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_select_clock_edge_rising(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_SET = SI32_USART_A_MODE_CLKESEL_RISING_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_select_clock_edge_rising(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_select_clock_edge_rising(basePointer)
 #define SI32_USART_A_select_clock_edge_rising(basePointer) \
@@ -934,8 +1603,19 @@ _SI32_USART_A_select_clock_edge_rising(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_disable_idle_tristate(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_CLR = SI32_USART_A_MODE_ITSEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_disable_idle_tristate(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_disable_idle_tristate(basePointer)
 #define SI32_USART_A_disable_idle_tristate(basePointer) \
@@ -947,8 +1627,19 @@ _SI32_USART_A_disable_idle_tristate(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enable_idle_tristate(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_SET = SI32_USART_A_MODE_ITSEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enable_idle_tristate(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enable_idle_tristate(basePointer)
 #define SI32_USART_A_enable_idle_tristate(basePointer) \
@@ -960,8 +1651,19 @@ _SI32_USART_A_enable_idle_tristate(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enter_master_mode(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_SET = SI32_USART_A_MODE_OPMD_MASTER_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enter_master_mode(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enter_master_mode(basePointer)
 #define SI32_USART_A_enter_master_mode(basePointer) \
@@ -973,8 +1675,19 @@ _SI32_USART_A_enter_master_mode(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enter_slave_mode(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->MODE_CLR = SI32_USART_A_MODE_OPMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enter_slave_mode(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enter_slave_mode(basePointer)
 #define SI32_USART_A_enter_slave_mode(basePointer) \
@@ -994,9 +1707,21 @@ _SI32_USART_A_enter_slave_mode(SI32_USART_A_Type* /*basePointer*/);
 ///  flowcn
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_write_flowcn(
+   SI32_USART_A_Type * basePointer,
+   uint32_t flowcn)
+{
+   //{{
+   basePointer->FLOWCN.U32 = flowcn;
+   //}}
+}
+#else
 void
 _SI32_USART_A_write_flowcn(SI32_USART_A_Type* /*basePointer*/,
    uint32_t /*flowcn*/);
+#endif
 ///
 /// @def SI32_USART_A_write_flowcn(basePointer, flowcn)
 #define SI32_USART_A_write_flowcn(basePointer, flowcn) \
@@ -1011,8 +1736,19 @@ _SI32_USART_A_write_flowcn(SI32_USART_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USART_A_read_flowcn(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   return basePointer->FLOWCN.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_USART_A_read_flowcn(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_read_flowcn(basePointer)
 #define SI32_USART_A_read_flowcn(basePointer) \
@@ -1024,8 +1760,19 @@ _SI32_USART_A_read_flowcn(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_clear_rts(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FLOWCN_CLR = SI32_USART_A_FLOWCN_RTS_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_clear_rts(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_clear_rts(basePointer)
 #define SI32_USART_A_clear_rts(basePointer) \
@@ -1037,8 +1784,19 @@ _SI32_USART_A_clear_rts(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_set_rts(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FLOWCN_SET = SI32_USART_A_FLOWCN_RTS_HIGH_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_set_rts(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_set_rts(basePointer)
 #define SI32_USART_A_set_rts(basePointer) \
@@ -1050,8 +1808,19 @@ _SI32_USART_A_set_rts(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_A_read_rts_output(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->FLOWCN.RTS);
+   //}}
+}
+#else
 bool
 _SI32_USART_A_read_rts_output(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_read_rts_output(basePointer)
 #define SI32_USART_A_read_rts_output(basePointer) \
@@ -1063,8 +1832,19 @@ _SI32_USART_A_read_rts_output(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_A_read_rx_input(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->FLOWCN.RX);
+   //}}
+}
+#else
 bool
 _SI32_USART_A_read_rx_input(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_read_rx_input(basePointer)
 #define SI32_USART_A_read_rx_input(basePointer) \
@@ -1076,8 +1856,19 @@ _SI32_USART_A_read_rx_input(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enable_rts_inversion(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FLOWCN_SET = SI32_USART_A_FLOWCN_RTSINVEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enable_rts_inversion(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enable_rts_inversion(basePointer)
 #define SI32_USART_A_enable_rts_inversion(basePointer) \
@@ -1089,8 +1880,19 @@ _SI32_USART_A_enable_rts_inversion(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_disable_rts_inversion(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FLOWCN_CLR = SI32_USART_A_FLOWCN_RTSINVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_disable_rts_inversion(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_disable_rts_inversion(basePointer)
 #define SI32_USART_A_disable_rts_inversion(basePointer) \
@@ -1102,8 +1904,19 @@ _SI32_USART_A_disable_rts_inversion(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_select_rts_deassert_on_full(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FLOWCN_CLR = SI32_USART_A_FLOWCN_RTSTH_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_select_rts_deassert_on_full(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_select_rts_deassert_on_full(basePointer)
 #define SI32_USART_A_select_rts_deassert_on_full(basePointer) \
@@ -1115,8 +1928,19 @@ _SI32_USART_A_select_rts_deassert_on_full(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_select_rts_deassert_on_byte_free(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FLOWCN_SET = SI32_USART_A_FLOWCN_RTSTH_ONE_BYTE_FREE_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_select_rts_deassert_on_byte_free(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_select_rts_deassert_on_byte_free(basePointer)
 #define SI32_USART_A_select_rts_deassert_on_byte_free(basePointer) \
@@ -1128,8 +1952,19 @@ _SI32_USART_A_select_rts_deassert_on_byte_free(SI32_USART_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enable_rts(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FLOWCN_SET = SI32_USART_A_FLOWCN_RTSEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enable_rts(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enable_rts(basePointer)
 #define SI32_USART_A_enable_rts(basePointer) \
@@ -1141,8 +1976,19 @@ _SI32_USART_A_enable_rts(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_disable_rts(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FLOWCN_CLR = SI32_USART_A_FLOWCN_RTSEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_disable_rts(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_disable_rts(basePointer)
 #define SI32_USART_A_disable_rts(basePointer) \
@@ -1154,8 +2000,19 @@ _SI32_USART_A_disable_rts(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_A_read_cts_input(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->FLOWCN.CTS);
+   //}}
+}
+#else
 bool
 _SI32_USART_A_read_cts_input(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_read_cts_input(basePointer)
 #define SI32_USART_A_read_cts_input(basePointer) \
@@ -1167,8 +2024,19 @@ _SI32_USART_A_read_cts_input(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_A_read_tx_output(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->FLOWCN.TX);
+   //}}
+}
+#else
 bool
 _SI32_USART_A_read_tx_output(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_read_tx_output(basePointer)
 #define SI32_USART_A_read_tx_output(basePointer) \
@@ -1180,8 +2048,19 @@ _SI32_USART_A_read_tx_output(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_clear_tx(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FLOWCN_CLR = SI32_USART_A_FLOWCN_TX_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_clear_tx(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_clear_tx(basePointer)
 #define SI32_USART_A_clear_tx(basePointer) \
@@ -1193,8 +2072,19 @@ _SI32_USART_A_clear_tx(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_set_tx(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FLOWCN_SET = SI32_USART_A_FLOWCN_TX_HIGH_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_set_tx(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_set_tx(basePointer)
 #define SI32_USART_A_set_tx(basePointer) \
@@ -1206,8 +2096,19 @@ _SI32_USART_A_set_tx(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_set_sync_clock_low(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FLOWCN_CLR = SI32_USART_A_FLOWCN_UCLK_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_set_sync_clock_low(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_set_sync_clock_low(basePointer)
 #define SI32_USART_A_set_sync_clock_low(basePointer) \
@@ -1219,8 +2120,19 @@ _SI32_USART_A_set_sync_clock_low(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_set_sync_clock_high(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FLOWCN_SET = SI32_USART_A_FLOWCN_UCLK_HIGH_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_set_sync_clock_high(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_set_sync_clock_high(basePointer)
 #define SI32_USART_A_set_sync_clock_high(basePointer) \
@@ -1232,8 +2144,19 @@ _SI32_USART_A_set_sync_clock_high(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_A_read_sync_clock(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->FLOWCN.UCLK);
+   //}}
+}
+#else
 bool
 _SI32_USART_A_read_sync_clock(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_read_sync_clock(basePointer)
 #define SI32_USART_A_read_sync_clock(basePointer) \
@@ -1245,8 +2168,19 @@ _SI32_USART_A_read_sync_clock(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enable_cts_inversion(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FLOWCN_SET = SI32_USART_A_FLOWCN_CTSINVEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enable_cts_inversion(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enable_cts_inversion(basePointer)
 #define SI32_USART_A_enable_cts_inversion(basePointer) \
@@ -1258,8 +2192,19 @@ _SI32_USART_A_enable_cts_inversion(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_disable_cts_inversion(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FLOWCN_CLR = SI32_USART_A_FLOWCN_CTSINVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_disable_cts_inversion(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_disable_cts_inversion(basePointer)
 #define SI32_USART_A_disable_cts_inversion(basePointer) \
@@ -1271,8 +2216,19 @@ _SI32_USART_A_disable_cts_inversion(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enable_cts(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FLOWCN_SET = SI32_USART_A_FLOWCN_CTSEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enable_cts(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enable_cts(basePointer)
 #define SI32_USART_A_enable_cts(basePointer) \
@@ -1284,8 +2240,19 @@ _SI32_USART_A_enable_cts(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_disable_cts(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FLOWCN_CLR = SI32_USART_A_FLOWCN_CTSEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_disable_cts(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_disable_cts(basePointer)
 #define SI32_USART_A_disable_cts(basePointer) \
@@ -1307,9 +2274,23 @@ _SI32_USART_A_disable_cts(SI32_USART_A_Type* /*basePointer*/);
 ///  width
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_select_tx_irda_pulse_width(
+   SI32_USART_A_Type * basePointer,
+   uint32_t width)
+{
+   assert(width < 4);   // width < 2^2
+   //{{
+   basePointer->FLOWCN_CLR = SI32_USART_A_FLOWCN_TIRDAPW_MASK;
+   basePointer->FLOWCN_SET = width << SI32_USART_A_FLOWCN_TIRDAPW_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_USART_A_select_tx_irda_pulse_width(SI32_USART_A_Type* /*basePointer*/,
    uint32_t /*width*/);
+#endif
 ///
 /// @def SI32_USART_A_select_tx_irda_pulse_width(basePointer, width)
 #define SI32_USART_A_select_tx_irda_pulse_width(basePointer, width) do{  \
@@ -1331,9 +2312,21 @@ _SI32_USART_A_select_tx_irda_pulse_width(SI32_USART_A_Type* /*basePointer*/,
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_write_control(
+   SI32_USART_A_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_USART_A_write_control(SI32_USART_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_USART_A_write_control(basePointer, control)
 #define SI32_USART_A_write_control(basePointer, control) \
@@ -1348,8 +2341,19 @@ _SI32_USART_A_write_control(SI32_USART_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USART_A_read_control(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_USART_A_read_control(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_read_control(basePointer)
 #define SI32_USART_A_read_control(basePointer) \
@@ -1361,8 +2365,19 @@ _SI32_USART_A_read_control(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_A_is_rx_frame_error_interrupt_pending(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.RFRMERI);
+   //}}
+}
+#else
 bool
 _SI32_USART_A_is_rx_frame_error_interrupt_pending(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_is_rx_frame_error_interrupt_pending(basePointer)
 #define SI32_USART_A_is_rx_frame_error_interrupt_pending(basePointer) \
@@ -1374,8 +2389,19 @@ _SI32_USART_A_is_rx_frame_error_interrupt_pending(SI32_USART_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_clear_rx_frame_error_interrupt(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_USART_A_CONTROL_RFRMERI_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_clear_rx_frame_error_interrupt(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_clear_rx_frame_error_interrupt(basePointer)
 #define SI32_USART_A_clear_rx_frame_error_interrupt(basePointer) \
@@ -1387,8 +2413,19 @@ _SI32_USART_A_clear_rx_frame_error_interrupt(SI32_USART_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_A_is_rx_parity_error_interrupt_pending(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.RPARERI);
+   //}}
+}
+#else
 bool
 _SI32_USART_A_is_rx_parity_error_interrupt_pending(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_is_rx_parity_error_interrupt_pending(basePointer)
 #define SI32_USART_A_is_rx_parity_error_interrupt_pending(basePointer) \
@@ -1400,8 +2437,19 @@ _SI32_USART_A_is_rx_parity_error_interrupt_pending(SI32_USART_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_clear_rx_parity_error_interrupt(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_USART_A_CONTROL_RPARERI_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_clear_rx_parity_error_interrupt(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_clear_rx_parity_error_interrupt(basePointer)
 #define SI32_USART_A_clear_rx_parity_error_interrupt(basePointer) \
@@ -1413,8 +2461,19 @@ _SI32_USART_A_clear_rx_parity_error_interrupt(SI32_USART_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_A_is_rx_overrun_interrupt_pending(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.ROREI);
+   //}}
+}
+#else
 bool
 _SI32_USART_A_is_rx_overrun_interrupt_pending(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_is_rx_overrun_interrupt_pending(basePointer)
 #define SI32_USART_A_is_rx_overrun_interrupt_pending(basePointer) \
@@ -1426,8 +2485,19 @@ _SI32_USART_A_is_rx_overrun_interrupt_pending(SI32_USART_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_clear_rx_overrun_error_interrupt(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_USART_A_CONTROL_ROREI_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_clear_rx_overrun_error_interrupt(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_clear_rx_overrun_error_interrupt(basePointer)
 #define SI32_USART_A_clear_rx_overrun_error_interrupt(basePointer) \
@@ -1439,8 +2509,19 @@ _SI32_USART_A_clear_rx_overrun_error_interrupt(SI32_USART_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_A_is_rx_data_request_interrupt_pending(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.RDREQI);
+   //}}
+}
+#else
 bool
 _SI32_USART_A_is_rx_data_request_interrupt_pending(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_is_rx_data_request_interrupt_pending(basePointer)
 #define SI32_USART_A_is_rx_data_request_interrupt_pending(basePointer) \
@@ -1452,8 +2533,19 @@ _SI32_USART_A_is_rx_data_request_interrupt_pending(SI32_USART_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_clear_rx_data_request_interrupt(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_USART_A_CONTROL_RDREQI_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_clear_rx_data_request_interrupt(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_clear_rx_data_request_interrupt(basePointer)
 #define SI32_USART_A_clear_rx_data_request_interrupt(basePointer) \
@@ -1469,8 +2561,19 @@ _SI32_USART_A_clear_rx_data_request_interrupt(SI32_USART_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enable_rx_error_interrupts(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_USART_A_CONTROL_RERIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enable_rx_error_interrupts(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enable_rx_error_interrupts(basePointer)
 #define SI32_USART_A_enable_rx_error_interrupts(basePointer) \
@@ -1486,8 +2589,19 @@ _SI32_USART_A_enable_rx_error_interrupts(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_disable_rx_error_interrupts(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_USART_A_CONTROL_RERIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_disable_rx_error_interrupts(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_disable_rx_error_interrupts(basePointer)
 #define SI32_USART_A_disable_rx_error_interrupts(basePointer) \
@@ -1499,8 +2613,19 @@ _SI32_USART_A_disable_rx_error_interrupts(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_A_is_rx_error_interrupts_enabled(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.RERIEN);
+   //}}
+}
+#else
 bool
 _SI32_USART_A_is_rx_error_interrupts_enabled(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_is_rx_error_interrupts_enabled(basePointer)
 #define SI32_USART_A_is_rx_error_interrupts_enabled(basePointer) \
@@ -1512,8 +2637,19 @@ _SI32_USART_A_is_rx_error_interrupts_enabled(SI32_USART_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enable_rx_data_request_interrupt(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_USART_A_CONTROL_RDREQIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enable_rx_data_request_interrupt(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enable_rx_data_request_interrupt(basePointer)
 #define SI32_USART_A_enable_rx_data_request_interrupt(basePointer) \
@@ -1525,8 +2661,19 @@ _SI32_USART_A_enable_rx_data_request_interrupt(SI32_USART_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_disable_rx_data_request_interrupt(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_USART_A_CONTROL_RDREQIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_disable_rx_data_request_interrupt(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_disable_rx_data_request_interrupt(basePointer)
 #define SI32_USART_A_disable_rx_data_request_interrupt(basePointer) \
@@ -1538,8 +2685,19 @@ _SI32_USART_A_disable_rx_data_request_interrupt(SI32_USART_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_A_is_rx_data_request_interrupt_enabled(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.RDREQIEN);
+   //}}
+}
+#else
 bool
 _SI32_USART_A_is_rx_data_request_interrupt_enabled(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_is_rx_data_request_interrupt_enabled(basePointer)
 #define SI32_USART_A_is_rx_data_request_interrupt_enabled(basePointer) \
@@ -1551,8 +2709,19 @@ _SI32_USART_A_is_rx_data_request_interrupt_enabled(SI32_USART_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_exit_match_mode(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_USART_A_CONTROL_MATMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_exit_match_mode(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_exit_match_mode(basePointer)
 #define SI32_USART_A_exit_match_mode(basePointer) \
@@ -1564,8 +2733,20 @@ _SI32_USART_A_exit_match_mode(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enter_match_mode_store_byte(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_USART_A_CONTROL_MATMD_MASK;
+   basePointer->CONTROL_SET = SI32_USART_A_CONTROL_MATMD_MCE_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enter_match_mode_store_byte(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enter_match_mode_store_byte(basePointer)
 #define SI32_USART_A_enter_match_mode_store_byte(basePointer) do{  \
@@ -1579,8 +2760,20 @@ _SI32_USART_A_enter_match_mode_store_byte(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enter_match_mode_generate_frame_error(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_USART_A_CONTROL_MATMD_MASK;
+   basePointer->CONTROL_SET = SI32_USART_A_CONTROL_MATMD_FRAME_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enter_match_mode_generate_frame_error(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enter_match_mode_generate_frame_error(basePointer)
 #define SI32_USART_A_enter_match_mode_generate_frame_error(basePointer) do{  \
@@ -1594,8 +2787,19 @@ _SI32_USART_A_enter_match_mode_generate_frame_error(SI32_USART_A_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enter_match_mode_store_bit(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_USART_A_CONTROL_MATMD_STORE_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enter_match_mode_store_bit(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enter_match_mode_store_bit(basePointer)
 #define SI32_USART_A_enter_match_mode_store_bit(basePointer) \
@@ -1607,8 +2811,19 @@ _SI32_USART_A_enter_match_mode_store_bit(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enable_rx_autobaud(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_USART_A_CONTROL_RABDEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enable_rx_autobaud(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enable_rx_autobaud(basePointer)
 #define SI32_USART_A_enable_rx_autobaud(basePointer) \
@@ -1620,8 +2835,19 @@ _SI32_USART_A_enable_rx_autobaud(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_disable_rx_autobaud(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_USART_A_CONTROL_RABDEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_disable_rx_autobaud(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_disable_rx_autobaud(basePointer)
 #define SI32_USART_A_disable_rx_autobaud(basePointer) \
@@ -1633,8 +2859,19 @@ _SI32_USART_A_disable_rx_autobaud(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_A_is_rx_busy(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.RBUSYF);
+   //}}
+}
+#else
 bool
 _SI32_USART_A_is_rx_busy(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_is_rx_busy(basePointer)
 #define SI32_USART_A_is_rx_busy(basePointer) \
@@ -1646,8 +2883,19 @@ _SI32_USART_A_is_rx_busy(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_set_rbit(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_USART_A_CONTROL_RBIT_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_set_rbit(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_set_rbit(basePointer)
 #define SI32_USART_A_set_rbit(basePointer) \
@@ -1659,8 +2907,19 @@ _SI32_USART_A_set_rbit(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_clear_rbit(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_USART_A_CONTROL_RBIT_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_clear_rbit(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_clear_rbit(basePointer)
 #define SI32_USART_A_clear_rbit(basePointer) \
@@ -1672,8 +2931,19 @@ _SI32_USART_A_clear_rbit(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_A_read_rbit(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.RBIT);
+   //}}
+}
+#else
 bool
 _SI32_USART_A_read_rbit(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_read_rbit(basePointer)
 #define SI32_USART_A_read_rbit(basePointer) \
@@ -1685,8 +2955,19 @@ _SI32_USART_A_read_rbit(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enable_rx_one_shot(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_USART_A_CONTROL_ROSEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enable_rx_one_shot(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enable_rx_one_shot(basePointer)
 #define SI32_USART_A_enable_rx_one_shot(basePointer) \
@@ -1698,8 +2979,19 @@ _SI32_USART_A_enable_rx_one_shot(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_disable_rx_one_shot(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_USART_A_CONTROL_ROSEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_disable_rx_one_shot(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_disable_rx_one_shot(basePointer)
 #define SI32_USART_A_disable_rx_one_shot(basePointer) \
@@ -1711,8 +3003,19 @@ _SI32_USART_A_disable_rx_one_shot(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enable_rx_inhibit(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_USART_A_CONTROL_RINH_ACTIVE_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enable_rx_inhibit(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enable_rx_inhibit(basePointer)
 #define SI32_USART_A_enable_rx_inhibit(basePointer) \
@@ -1724,8 +3027,19 @@ _SI32_USART_A_enable_rx_inhibit(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_disable_rx_inhibit(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_USART_A_CONTROL_RINH_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_disable_rx_inhibit(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_disable_rx_inhibit(basePointer)
 #define SI32_USART_A_disable_rx_inhibit(basePointer) \
@@ -1737,8 +3051,19 @@ _SI32_USART_A_disable_rx_inhibit(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enable_rx(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_USART_A_CONTROL_REN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enable_rx(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enable_rx(basePointer)
 #define SI32_USART_A_enable_rx(basePointer) \
@@ -1750,8 +3075,19 @@ _SI32_USART_A_enable_rx(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_disable_rx(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_USART_A_CONTROL_REN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_disable_rx(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_disable_rx(basePointer)
 #define SI32_USART_A_disable_rx(basePointer) \
@@ -1763,8 +3099,19 @@ _SI32_USART_A_disable_rx(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_A_is_tx_smartcard_parity_error_interrupt_pending(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.TSCERI);
+   //}}
+}
+#else
 bool
 _SI32_USART_A_is_tx_smartcard_parity_error_interrupt_pending(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_is_tx_smartcard_parity_error_interrupt_pending(basePointer)
 #define SI32_USART_A_is_tx_smartcard_parity_error_interrupt_pending(basePointer) \
@@ -1776,8 +3123,19 @@ _SI32_USART_A_is_tx_smartcard_parity_error_interrupt_pending(SI32_USART_A_Type*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_clear_tx_smartcard_parity_error_interrupt(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_USART_A_CONTROL_TSCERI_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_clear_tx_smartcard_parity_error_interrupt(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_clear_tx_smartcard_parity_error_interrupt(basePointer)
 #define SI32_USART_A_clear_tx_smartcard_parity_error_interrupt(basePointer) \
@@ -1789,8 +3147,19 @@ _SI32_USART_A_clear_tx_smartcard_parity_error_interrupt(SI32_USART_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_A_is_tx_underrun_interrupt_pending(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.TUREI);
+   //}}
+}
+#else
 bool
 _SI32_USART_A_is_tx_underrun_interrupt_pending(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_is_tx_underrun_interrupt_pending(basePointer)
 #define SI32_USART_A_is_tx_underrun_interrupt_pending(basePointer) \
@@ -1802,8 +3171,19 @@ _SI32_USART_A_is_tx_underrun_interrupt_pending(SI32_USART_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_clear_tx_underrun_interrupt(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_USART_A_CONTROL_TUREI_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_clear_tx_underrun_interrupt(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_clear_tx_underrun_interrupt(basePointer)
 #define SI32_USART_A_clear_tx_underrun_interrupt(basePointer) \
@@ -1815,8 +3195,19 @@ _SI32_USART_A_clear_tx_underrun_interrupt(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_A_is_tx_data_request_interrupt_pending(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.TDREQI);
+   //}}
+}
+#else
 bool
 _SI32_USART_A_is_tx_data_request_interrupt_pending(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_is_tx_data_request_interrupt_pending(basePointer)
 #define SI32_USART_A_is_tx_data_request_interrupt_pending(basePointer) \
@@ -1828,8 +3219,19 @@ _SI32_USART_A_is_tx_data_request_interrupt_pending(SI32_USART_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_A_is_tx_complete(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.TCPTI);
+   //}}
+}
+#else
 bool
 _SI32_USART_A_is_tx_complete(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_is_tx_complete(basePointer)
 #define SI32_USART_A_is_tx_complete(basePointer) \
@@ -1841,8 +3243,19 @@ _SI32_USART_A_is_tx_complete(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_clear_tx_complete_interrupt(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_USART_A_CONTROL_TCPTI_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_clear_tx_complete_interrupt(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_clear_tx_complete_interrupt(basePointer)
 #define SI32_USART_A_clear_tx_complete_interrupt(basePointer) \
@@ -1854,8 +3267,19 @@ _SI32_USART_A_clear_tx_complete_interrupt(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_select_tx_complete_threshold_end_of_transmission(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_USART_A_CONTROL_TCPTTH_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_select_tx_complete_threshold_end_of_transmission(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_select_tx_complete_threshold_end_of_transmission(basePointer)
 #define SI32_USART_A_select_tx_complete_threshold_end_of_transmission(basePointer) \
@@ -1867,8 +3291,19 @@ _SI32_USART_A_select_tx_complete_threshold_end_of_transmission(SI32_USART_A_Type
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_select_tx_complete_threshold_no_more_data(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_USART_A_CONTROL_TCPTTH_SET_ON_EMPTY_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_select_tx_complete_threshold_no_more_data(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_select_tx_complete_threshold_no_more_data(basePointer)
 #define SI32_USART_A_select_tx_complete_threshold_no_more_data(basePointer) \
@@ -1884,8 +3319,19 @@ _SI32_USART_A_select_tx_complete_threshold_no_more_data(SI32_USART_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enable_tx_error_interrupts(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_USART_A_CONTROL_TERIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enable_tx_error_interrupts(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enable_tx_error_interrupts(basePointer)
 #define SI32_USART_A_enable_tx_error_interrupts(basePointer) \
@@ -1901,8 +3347,19 @@ _SI32_USART_A_enable_tx_error_interrupts(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_disable_tx_error_interrupts(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_USART_A_CONTROL_TERIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_disable_tx_error_interrupts(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_disable_tx_error_interrupts(basePointer)
 #define SI32_USART_A_disable_tx_error_interrupts(basePointer) \
@@ -1914,8 +3371,19 @@ _SI32_USART_A_disable_tx_error_interrupts(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_A_is_tx_error_interrupts_enabled(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.TERIEN);
+   //}}
+}
+#else
 bool
 _SI32_USART_A_is_tx_error_interrupts_enabled(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_is_tx_error_interrupts_enabled(basePointer)
 #define SI32_USART_A_is_tx_error_interrupts_enabled(basePointer) \
@@ -1927,8 +3395,19 @@ _SI32_USART_A_is_tx_error_interrupts_enabled(SI32_USART_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enable_tx_data_request_interrupt(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_USART_A_CONTROL_TDREQIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enable_tx_data_request_interrupt(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enable_tx_data_request_interrupt(basePointer)
 #define SI32_USART_A_enable_tx_data_request_interrupt(basePointer) \
@@ -1940,8 +3419,19 @@ _SI32_USART_A_enable_tx_data_request_interrupt(SI32_USART_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_disable_tx_data_request_interrupt(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_USART_A_CONTROL_TDREQIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_disable_tx_data_request_interrupt(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_disable_tx_data_request_interrupt(basePointer)
 #define SI32_USART_A_disable_tx_data_request_interrupt(basePointer) \
@@ -1953,8 +3443,19 @@ _SI32_USART_A_disable_tx_data_request_interrupt(SI32_USART_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_A_is_tx_data_request_interrupt_enabled(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.TDREQIEN);
+   //}}
+}
+#else
 bool
 _SI32_USART_A_is_tx_data_request_interrupt_enabled(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_is_tx_data_request_interrupt_enabled(basePointer)
 #define SI32_USART_A_is_tx_data_request_interrupt_enabled(basePointer) \
@@ -1966,8 +3467,19 @@ _SI32_USART_A_is_tx_data_request_interrupt_enabled(SI32_USART_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enable_tx_complete_interrupt(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_USART_A_CONTROL_TCPTIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enable_tx_complete_interrupt(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enable_tx_complete_interrupt(basePointer)
 #define SI32_USART_A_enable_tx_complete_interrupt(basePointer) \
@@ -1979,8 +3491,19 @@ _SI32_USART_A_enable_tx_complete_interrupt(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_disable_tx_complete_interrupt(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_USART_A_CONTROL_TCPTIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_disable_tx_complete_interrupt(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_disable_tx_complete_interrupt(basePointer)
 #define SI32_USART_A_disable_tx_complete_interrupt(basePointer) \
@@ -1992,8 +3515,19 @@ _SI32_USART_A_disable_tx_complete_interrupt(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_A_is_tx_complete_interrupt_enabled(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.TCPTIEN);
+   //}}
+}
+#else
 bool
 _SI32_USART_A_is_tx_complete_interrupt_enabled(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_is_tx_complete_interrupt_enabled(basePointer)
 #define SI32_USART_A_is_tx_complete_interrupt_enabled(basePointer) \
@@ -2005,8 +3539,19 @@ _SI32_USART_A_is_tx_complete_interrupt_enabled(SI32_USART_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_A_is_tx_busy(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.TBUSYF);
+   //}}
+}
+#else
 bool
 _SI32_USART_A_is_tx_busy(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_is_tx_busy(basePointer)
 #define SI32_USART_A_is_tx_busy(basePointer) \
@@ -2018,8 +3563,19 @@ _SI32_USART_A_is_tx_busy(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_set_tbit(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_USART_A_CONTROL_TBIT_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_set_tbit(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_set_tbit(basePointer)
 #define SI32_USART_A_set_tbit(basePointer) \
@@ -2031,8 +3587,19 @@ _SI32_USART_A_set_tbit(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_clear_tbit(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_USART_A_CONTROL_TBIT_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_clear_tbit(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_clear_tbit(basePointer)
 #define SI32_USART_A_clear_tbit(basePointer) \
@@ -2044,8 +3611,19 @@ _SI32_USART_A_clear_tbit(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enable_tx_inhibit(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_USART_A_CONTROL_TINH_ACTIVE_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enable_tx_inhibit(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enable_tx_inhibit(basePointer)
 #define SI32_USART_A_enable_tx_inhibit(basePointer) \
@@ -2057,8 +3635,19 @@ _SI32_USART_A_enable_tx_inhibit(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_disable_tx_inhibit(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_USART_A_CONTROL_TINH_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_disable_tx_inhibit(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_disable_tx_inhibit(basePointer)
 #define SI32_USART_A_disable_tx_inhibit(basePointer) \
@@ -2070,8 +3659,19 @@ _SI32_USART_A_disable_tx_inhibit(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enable_tx(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_USART_A_CONTROL_TEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enable_tx(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enable_tx(basePointer)
 #define SI32_USART_A_enable_tx(basePointer) \
@@ -2083,8 +3683,19 @@ _SI32_USART_A_enable_tx(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_disable_tx(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_USART_A_CONTROL_TEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_disable_tx(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_disable_tx(basePointer)
 #define SI32_USART_A_disable_tx(basePointer) \
@@ -2104,9 +3715,21 @@ _SI32_USART_A_disable_tx(SI32_USART_A_Type* /*basePointer*/);
 ///  ipdelay
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_write_ipdelay(
+   SI32_USART_A_Type * basePointer,
+   uint32_t ipdelay)
+{
+   //{{
+   basePointer->IPDELAY.U32 = ipdelay;
+   //}}
+}
+#else
 void
 _SI32_USART_A_write_ipdelay(SI32_USART_A_Type* /*basePointer*/,
    uint32_t /*ipdelay*/);
+#endif
 ///
 /// @def SI32_USART_A_write_ipdelay(basePointer, ipdelay)
 #define SI32_USART_A_write_ipdelay(basePointer, ipdelay) \
@@ -2121,8 +3744,19 @@ _SI32_USART_A_write_ipdelay(SI32_USART_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USART_A_read_ipdelay(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+	return basePointer->IPDELAY.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_USART_A_read_ipdelay(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_read_ipdelay(basePointer)
 #define SI32_USART_A_read_ipdelay(basePointer) \
@@ -2142,9 +3776,22 @@ _SI32_USART_A_read_ipdelay(SI32_USART_A_Type* /*basePointer*/);
 ///  ipdelay
 ///  Valid range is 8 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_write_ipdelay_bits(
+   SI32_USART_A_Type * basePointer,
+   uint32_t ipdelay)
+{
+   assert(ipdelay < 256);   // ipdelay < 2^8
+   //{{
+	basePointer->IPDELAY.IPDELAY_BITS = ipdelay;
+   //}}
+}
+#else
 void
 _SI32_USART_A_write_ipdelay_bits(SI32_USART_A_Type* /*basePointer*/,
    uint32_t /*ipdelay*/);
+#endif
 ///
 /// @def SI32_USART_A_write_ipdelay_bits(basePointer, ipdelay)
 #define SI32_USART_A_write_ipdelay_bits(basePointer, ipdelay) \
@@ -2159,8 +3806,19 @@ _SI32_USART_A_write_ipdelay_bits(SI32_USART_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USART_A_read_ipdelay_bits(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+	return basePointer->IPDELAY.IPDELAY_BITS;
+   //}}
+}
+#else
 uint32_t
 _SI32_USART_A_read_ipdelay_bits(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_read_ipdelay_bits(basePointer)
 #define SI32_USART_A_read_ipdelay_bits(basePointer) \
@@ -2180,9 +3838,21 @@ _SI32_USART_A_read_ipdelay_bits(SI32_USART_A_Type* /*basePointer*/);
 ///  baudrate
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_write_baudrate(
+   SI32_USART_A_Type * basePointer,
+   uint32_t baudrate)
+{
+   //{{
+   basePointer->BAUDRATE.U32 = baudrate;
+   //}}
+}
+#else
 void
 _SI32_USART_A_write_baudrate(SI32_USART_A_Type* /*basePointer*/,
    uint32_t /*baudrate*/);
+#endif
 ///
 /// @def SI32_USART_A_write_baudrate(basePointer, baudrate)
 #define SI32_USART_A_write_baudrate(basePointer, baudrate) \
@@ -2197,8 +3867,19 @@ _SI32_USART_A_write_baudrate(SI32_USART_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USART_A_read_baudrate(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   return basePointer->BAUDRATE.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_USART_A_read_baudrate(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_read_baudrate(basePointer)
 #define SI32_USART_A_read_baudrate(basePointer) \
@@ -2215,9 +3896,22 @@ _SI32_USART_A_read_baudrate(SI32_USART_A_Type* /*basePointer*/);
 ///  rxbaud
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_set_rx_baudrate(
+   SI32_USART_A_Type * basePointer,
+   uwide16_t rxbaud)
+{
+   assert(rxbaud < 65536);   // rxbaud < 2^16
+   //{{
+   basePointer->BAUDRATE.RBAUD = rxbaud;
+   //}}
+}
+#else
 void
 _SI32_USART_A_set_rx_baudrate(SI32_USART_A_Type* /*basePointer*/,
    uwide16_t /*rxbaud*/);
+#endif
 ///
 /// @def SI32_USART_A_set_rx_baudrate(basePointer, rxbaud)
 #define SI32_USART_A_set_rx_baudrate(basePointer, rxbaud) \
@@ -2234,9 +3928,22 @@ _SI32_USART_A_set_rx_baudrate(SI32_USART_A_Type* /*basePointer*/,
 ///  txbaud
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_set_tx_baudrate(
+   SI32_USART_A_Type * basePointer,
+   uwide16_t txbaud)
+{
+   assert(txbaud < 65536);   // txbaud < 2^16
+   //{{
+   basePointer->BAUDRATE.TBAUD = txbaud;
+   //}}
+}
+#else
 void
 _SI32_USART_A_set_tx_baudrate(SI32_USART_A_Type* /*basePointer*/,
    uwide16_t /*txbaud*/);
+#endif
 ///
 /// @def SI32_USART_A_set_tx_baudrate(basePointer, txbaud)
 #define SI32_USART_A_set_tx_baudrate(basePointer, txbaud) \
@@ -2256,9 +3963,21 @@ _SI32_USART_A_set_tx_baudrate(SI32_USART_A_Type* /*basePointer*/,
 ///  fifocn
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_write_fifocn(
+   SI32_USART_A_Type * basePointer,
+   uint32_t fifocn)
+{
+   //{{
+   basePointer->FIFOCN.U32 = fifocn;
+   //}}
+}
+#else
 void
 _SI32_USART_A_write_fifocn(SI32_USART_A_Type* /*basePointer*/,
    uint32_t /*fifocn*/);
+#endif
 ///
 /// @def SI32_USART_A_write_fifocn(basePointer, fifocn)
 #define SI32_USART_A_write_fifocn(basePointer, fifocn) \
@@ -2273,8 +3992,19 @@ _SI32_USART_A_write_fifocn(SI32_USART_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USART_A_read_fifocn(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   return basePointer->FIFOCN.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_USART_A_read_fifocn(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_read_fifocn(basePointer)
 #define SI32_USART_A_read_fifocn(basePointer) \
@@ -2289,8 +4019,19 @@ _SI32_USART_A_read_fifocn(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USART_A_read_rx_fifo_count(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   return (uint32_t)(basePointer->FIFOCN.RCNT);
+   //}}
+}
+#else
 uint32_t
 _SI32_USART_A_read_rx_fifo_count(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_read_rx_fifo_count(basePointer)
 #define SI32_USART_A_read_rx_fifo_count(basePointer) \
@@ -2302,8 +4043,19 @@ _SI32_USART_A_read_rx_fifo_count(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_select_rx_fifo_threshold_1(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FIFOCN_CLR = SI32_USART_A_FIFOCN_RFTH_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_select_rx_fifo_threshold_1(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_select_rx_fifo_threshold_1(basePointer)
 #define SI32_USART_A_select_rx_fifo_threshold_1(basePointer) \
@@ -2315,8 +4067,20 @@ _SI32_USART_A_select_rx_fifo_threshold_1(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_select_rx_fifo_threshold_2(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FIFOCN_CLR = SI32_USART_A_FIFOCN_RFTH_MASK;
+   basePointer->FIFOCN_SET = SI32_USART_A_FIFOCN_RFTH_TWO_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_select_rx_fifo_threshold_2(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_select_rx_fifo_threshold_2(basePointer)
 #define SI32_USART_A_select_rx_fifo_threshold_2(basePointer) do{  \
@@ -2330,8 +4094,20 @@ _SI32_USART_A_select_rx_fifo_threshold_2(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_select_rx_fifo_threshold_4(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FIFOCN_CLR = SI32_USART_A_FIFOCN_RFTH_MASK;
+   basePointer->FIFOCN_SET = SI32_USART_A_FIFOCN_RFTH_FOUR_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_select_rx_fifo_threshold_4(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_select_rx_fifo_threshold_4(basePointer)
 #define SI32_USART_A_select_rx_fifo_threshold_4(basePointer) do{  \
@@ -2345,8 +4121,19 @@ _SI32_USART_A_select_rx_fifo_threshold_4(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enable_rx_fifo_dma_request(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FIFOCN_SET = SI32_USART_A_FIFOCN_RDMAEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enable_rx_fifo_dma_request(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enable_rx_fifo_dma_request(basePointer)
 #define SI32_USART_A_enable_rx_fifo_dma_request(basePointer) \
@@ -2358,8 +4145,19 @@ _SI32_USART_A_enable_rx_fifo_dma_request(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_disable_rx_fifo_dma_request(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FIFOCN_CLR = SI32_USART_A_FIFOCN_RDMAEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_disable_rx_fifo_dma_request(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_disable_rx_fifo_dma_request(basePointer)
 #define SI32_USART_A_disable_rx_fifo_dma_request(basePointer) \
@@ -2371,8 +4169,19 @@ _SI32_USART_A_disable_rx_fifo_dma_request(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_flush_rx_fifo(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FIFOCN_SET = SI32_USART_A_FIFOCN_RFIFOFL_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_flush_rx_fifo(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_flush_rx_fifo(basePointer)
 #define SI32_USART_A_flush_rx_fifo(basePointer) \
@@ -2384,8 +4193,19 @@ _SI32_USART_A_flush_rx_fifo(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_A_is_rx_fifo_error_interrupt_pending(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->FIFOCN.RFERI);
+   //}}
+}
+#else
 bool
 _SI32_USART_A_is_rx_fifo_error_interrupt_pending(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_is_rx_fifo_error_interrupt_pending(basePointer)
 #define SI32_USART_A_is_rx_fifo_error_interrupt_pending(basePointer) \
@@ -2397,8 +4217,19 @@ _SI32_USART_A_is_rx_fifo_error_interrupt_pending(SI32_USART_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_clear_rx_fifo_error_interrupt(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FIFOCN_CLR = SI32_USART_A_FIFOCN_RFERI_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_clear_rx_fifo_error_interrupt(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_clear_rx_fifo_error_interrupt(basePointer)
 #define SI32_USART_A_clear_rx_fifo_error_interrupt(basePointer) \
@@ -2410,8 +4241,19 @@ _SI32_USART_A_clear_rx_fifo_error_interrupt(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_A_is_rx_shift_register_full(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->FIFOCN.RSRFULLF);
+   //}}
+}
+#else
 bool
 _SI32_USART_A_is_rx_shift_register_full(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_is_rx_shift_register_full(basePointer)
 #define SI32_USART_A_is_rx_shift_register_full(basePointer) \
@@ -2423,8 +4265,19 @@ _SI32_USART_A_is_rx_shift_register_full(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USART_A_read_tx_fifo_count(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   return (uint32_t)(basePointer->FIFOCN.TCNT);
+   //}}
+}
+#else
 uint32_t
 _SI32_USART_A_read_tx_fifo_count(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_read_tx_fifo_count(basePointer)
 #define SI32_USART_A_read_tx_fifo_count(basePointer) \
@@ -2436,8 +4289,19 @@ _SI32_USART_A_read_tx_fifo_count(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_select_tx_fifo_threshold_for_request_to_1(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FIFOCN_CLR = SI32_USART_A_FIFOCN_TFTH_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_select_tx_fifo_threshold_for_request_to_1(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_select_tx_fifo_threshold_for_request_to_1(basePointer)
 #define SI32_USART_A_select_tx_fifo_threshold_for_request_to_1(basePointer) \
@@ -2449,8 +4313,20 @@ _SI32_USART_A_select_tx_fifo_threshold_for_request_to_1(SI32_USART_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_select_tx_fifo_threshold_for_request_to_2(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FIFOCN_CLR = SI32_USART_A_FIFOCN_TFTH_MASK;
+   basePointer->FIFOCN_SET = SI32_USART_A_FIFOCN_TFTH_TWO_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_select_tx_fifo_threshold_for_request_to_2(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_select_tx_fifo_threshold_for_request_to_2(basePointer)
 #define SI32_USART_A_select_tx_fifo_threshold_for_request_to_2(basePointer) do{  \
@@ -2464,8 +4340,20 @@ _SI32_USART_A_select_tx_fifo_threshold_for_request_to_2(SI32_USART_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_select_tx_fifo_threshold_for_request_to_4(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FIFOCN_CLR = SI32_USART_A_FIFOCN_TFTH_MASK;
+   basePointer->FIFOCN_SET = SI32_USART_A_FIFOCN_TFTH_FOUR_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_select_tx_fifo_threshold_for_request_to_4(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_select_tx_fifo_threshold_for_request_to_4(basePointer)
 #define SI32_USART_A_select_tx_fifo_threshold_for_request_to_4(basePointer) do{  \
@@ -2479,8 +4367,19 @@ _SI32_USART_A_select_tx_fifo_threshold_for_request_to_4(SI32_USART_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_enable_tx_fifo_dma_request(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FIFOCN_SET = SI32_USART_A_FIFOCN_TDMAEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_enable_tx_fifo_dma_request(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_enable_tx_fifo_dma_request(basePointer)
 #define SI32_USART_A_enable_tx_fifo_dma_request(basePointer) \
@@ -2492,8 +4391,19 @@ _SI32_USART_A_enable_tx_fifo_dma_request(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_disable_tx_fifo_dma_request(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FIFOCN_CLR = SI32_USART_A_FIFOCN_TDMAEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_disable_tx_fifo_dma_request(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_disable_tx_fifo_dma_request(basePointer)
 #define SI32_USART_A_disable_tx_fifo_dma_request(basePointer) \
@@ -2505,8 +4415,19 @@ _SI32_USART_A_disable_tx_fifo_dma_request(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_flush_tx_fifo(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FIFOCN_SET = SI32_USART_A_FIFOCN_TFIFOFL_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_A_flush_tx_fifo(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_flush_tx_fifo(basePointer)
 #define SI32_USART_A_flush_tx_fifo(basePointer) \
@@ -2518,8 +4439,19 @@ _SI32_USART_A_flush_tx_fifo(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_A_is_tx_fifo_error_interrupt_pending(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->FIFOCN.TFERI);
+   //}}
+}
+#else
 bool
 _SI32_USART_A_is_tx_fifo_error_interrupt_pending(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_is_tx_fifo_error_interrupt_pending(basePointer)
 #define SI32_USART_A_is_tx_fifo_error_interrupt_pending(basePointer) \
@@ -2531,8 +4463,19 @@ _SI32_USART_A_is_tx_fifo_error_interrupt_pending(SI32_USART_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_clear_tx_fifo_error_interrupt(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   basePointer->FIFOCN_CLR = SI32_USART_A_FIFOCN_TFERI_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_A_clear_tx_fifo_error_interrupt(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_clear_tx_fifo_error_interrupt(basePointer)
 #define SI32_USART_A_clear_tx_fifo_error_interrupt(basePointer) \
@@ -2544,8 +4487,19 @@ _SI32_USART_A_clear_tx_fifo_error_interrupt(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_A_is_tx_shift_register_full(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->FIFOCN.TSRFULLF);
+   //}}
+}
+#else
 bool
 _SI32_USART_A_is_tx_shift_register_full(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_is_tx_shift_register_full(basePointer)
 #define SI32_USART_A_is_tx_shift_register_full(basePointer) \
@@ -2557,8 +4511,19 @@ _SI32_USART_A_is_tx_shift_register_full(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USART_A_read_data_u32(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   return (uint32_t)(basePointer->DATA.U32);
+   //}}
+}
+#else
 uint32_t
 _SI32_USART_A_read_data_u32(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_read_data_u32(basePointer)
 #define SI32_USART_A_read_data_u32(basePointer) \
@@ -2570,8 +4535,19 @@ _SI32_USART_A_read_data_u32(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint16_t
+_SI32_USART_A_read_data_u16(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DATA.U16;
+   //}}
+}
+#else
 uint16_t
 _SI32_USART_A_read_data_u16(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_read_data_u16(basePointer)
 #define SI32_USART_A_read_data_u16(basePointer) \
@@ -2583,8 +4559,19 @@ _SI32_USART_A_read_data_u16(SI32_USART_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint8_t
+_SI32_USART_A_read_data_u8(
+   SI32_USART_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DATA.U8;
+   //}}
+}
+#else
 uint8_t
 _SI32_USART_A_read_data_u8(SI32_USART_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_A_read_data_u8(basePointer)
 #define SI32_USART_A_read_data_u8(basePointer) \
@@ -2601,9 +4588,21 @@ _SI32_USART_A_read_data_u8(SI32_USART_A_Type* /*basePointer*/);
 ///  dataval
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_write_data_u32(
+   SI32_USART_A_Type * basePointer,
+   uint32_t dataval)
+{
+   //{{
+   basePointer->DATA.U32 = dataval;
+   //}}
+}
+#else
 void
 _SI32_USART_A_write_data_u32(SI32_USART_A_Type* /*basePointer*/,
    uint32_t /*dataval*/);
+#endif
 ///
 /// @def SI32_USART_A_write_data_u32(basePointer, dataval)
 #define SI32_USART_A_write_data_u32(basePointer, dataval) \
@@ -2620,9 +4619,22 @@ _SI32_USART_A_write_data_u32(SI32_USART_A_Type* /*basePointer*/,
 ///  dataval
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_write_data_u16(
+   SI32_USART_A_Type * basePointer,
+   uwide16_t dataval)
+{
+   assert(dataval < 65536);   // dataval < 2^16
+   //{{
+   basePointer->DATA.U16 = dataval;
+   //}}
+}
+#else
 void
 _SI32_USART_A_write_data_u16(SI32_USART_A_Type* /*basePointer*/,
    uwide16_t /*dataval*/);
+#endif
 ///
 /// @def SI32_USART_A_write_data_u16(basePointer, dataval)
 #define SI32_USART_A_write_data_u16(basePointer, dataval) \
@@ -2639,9 +4651,22 @@ _SI32_USART_A_write_data_u16(SI32_USART_A_Type* /*basePointer*/,
 ///  dataval
 ///  Valid range is 8 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_A_write_data_u8(
+   SI32_USART_A_Type * basePointer,
+   uwide8_t dataval)
+{
+   assert(dataval < 256);   // dataval < 2^8
+   //{{
+   basePointer->DATA.U8 = dataval;
+   //}}
+}
+#else
 void
 _SI32_USART_A_write_data_u8(SI32_USART_A_Type* /*basePointer*/,
    uwide8_t /*dataval*/);
+#endif
 ///
 /// @def SI32_USART_A_write_data_u8(basePointer, dataval)
 #define SI32_USART_A_write_data_u8(basePointer, dataval) \
@@ -88,6 +88,37 @@ extern "C" {
 ///  Valid range is 32 bits.
 ///  Write to FIFOCN register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_initialize(
+   SI32_USART_B_Type * basePointer,
+   // Write to CONFIG register.
+   uint32_t config,
+   // Write to MODE register.
+   uint32_t mode,
+   // Write to FLOWCN register.
+   uint32_t flowcn,
+   // Write to CONTROL register.
+   uint32_t control,
+   // Write to IPDELAY register.
+   uint32_t ipdelay,
+   // Write to BAUDRATE register.
+   uint32_t baudrate,
+   // Write to FIFOCN register.
+   uint32_t fifocn)
+{
+   assert(ipdelay < 256);   // ipdelay < 2^8
+   //{{
+   basePointer->CONFIG.U32 = config;
+   basePointer->MODE.U32 = mode;
+   basePointer->FLOWCN.U32 = flowcn;
+   basePointer->CONTROL.U32 = control;
+   basePointer->IPDELAY.U32 = ipdelay;
+   basePointer->BAUDRATE.U32 = baudrate;
+   basePointer->FIFOCN.U32 = fifocn;
+   //}}
+}
+#else
 void
 _SI32_USART_B_initialize(SI32_USART_B_Type* /*basePointer*/,
    uint32_t, /*config*/
@@ -97,6 +128,7 @@ _SI32_USART_B_initialize(SI32_USART_B_Type* /*basePointer*/,
    uint32_t, /*ipdelay*/
    uint32_t, /*baudrate*/
    uint32_t /*fifocn*/);
+#endif
 ///
 /// @def SI32_USART_B_initialize(basePointer, config, mode, flowcn, control, ipdelay, baudrate, fifocn)
 #define SI32_USART_B_initialize(basePointer, config, mode, flowcn, control, ipdelay, baudrate, fifocn) \
@@ -116,9 +148,21 @@ _SI32_USART_B_initialize(SI32_USART_B_Type* /*basePointer*/,
 ///  config
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_write_config(
+   SI32_USART_B_Type * basePointer,
+   uint32_t config)
+{
+   //{{
+   basePointer->CONFIG.U32 = config;
+   //}}
+}
+#else
 void
 _SI32_USART_B_write_config(SI32_USART_B_Type* /*basePointer*/,
    uint32_t /*config*/);
+#endif
 ///
 /// @def SI32_USART_B_write_config(basePointer, config)
 #define SI32_USART_B_write_config(basePointer, config) \
@@ -133,8 +177,19 @@ _SI32_USART_B_write_config(SI32_USART_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USART_B_read_config(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+   return basePointer->CONFIG.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_USART_B_read_config(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_read_config(basePointer)
 #define SI32_USART_B_read_config(basePointer) \
@@ -146,8 +201,19 @@ _SI32_USART_B_read_config(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_rx_start_bit(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_USART_B_CONFIG_RSTRTEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_rx_start_bit(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_rx_start_bit(basePointer)
 #define SI32_USART_B_enable_rx_start_bit(basePointer) \
@@ -159,8 +225,19 @@ _SI32_USART_B_enable_rx_start_bit(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_rx_start_bit(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_USART_B_CONFIG_RSTRTEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_rx_start_bit(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_rx_start_bit(basePointer)
 #define SI32_USART_B_disable_rx_start_bit(basePointer) \
@@ -172,8 +249,19 @@ _SI32_USART_B_disable_rx_start_bit(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_rx_parity_bit(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_SET = SI32_USART_B_CONFIG_RPAREN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_rx_parity_bit(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_rx_parity_bit(basePointer)
 #define SI32_USART_B_enable_rx_parity_bit(basePointer) \
@@ -185,8 +273,19 @@ _SI32_USART_B_enable_rx_parity_bit(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_rx_parity_bit(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_USART_B_CONFIG_RPAREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_rx_parity_bit(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_rx_parity_bit(basePointer)
 #define SI32_USART_B_disable_rx_parity_bit(basePointer) \
@@ -198,8 +297,19 @@ _SI32_USART_B_disable_rx_parity_bit(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_rx_stop_bit(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_USART_B_CONFIG_RSTPEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_rx_stop_bit(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_rx_stop_bit(basePointer)
 #define SI32_USART_B_enable_rx_stop_bit(basePointer) \
@@ -211,8 +321,19 @@ _SI32_USART_B_enable_rx_stop_bit(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_rx_stop_bit(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_USART_B_CONFIG_RSTPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_rx_stop_bit(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_rx_stop_bit(basePointer)
 #define SI32_USART_B_disable_rx_stop_bit(basePointer) \
@@ -233,9 +354,23 @@ _SI32_USART_B_disable_rx_stop_bit(SI32_USART_B_Type* /*basePointer*/);
 ///  bits
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_select_rx_stop_bits(
+   SI32_USART_B_Type * basePointer,
+   SI32_USART_B_STOP_BITS_Enum_Type bits)
+{
+   assert(bits < 4);   // bits < 2^2
+   //{{
+   basePointer->CONFIG_CLR = SI32_USART_B_CONFIG_RSTPMD_MASK;
+   basePointer->CONFIG_SET = bits << SI32_USART_B_CONFIG_RSTPMD_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_USART_B_select_rx_stop_bits(SI32_USART_B_Type* /*basePointer*/,
    SI32_USART_B_STOP_BITS_Enum_Type /*bits*/);
+#endif
 ///
 /// @def SI32_USART_B_select_rx_stop_bits(basePointer, bits)
 #define SI32_USART_B_select_rx_stop_bits(basePointer, bits) do{  \
@@ -257,9 +392,23 @@ _SI32_USART_B_select_rx_stop_bits(SI32_USART_B_Type* /*basePointer*/,
 ///  parity
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_select_rx_parity(
+   SI32_USART_B_Type * basePointer,
+   SI32_USART_B_PARITY_Enum_Type parity)
+{
+   assert(parity < 4);   // parity < 2^2
+   //{{
+   basePointer->CONFIG_CLR = SI32_USART_B_CONFIG_RPARMD_MASK;
+   basePointer->CONFIG_SET = parity << SI32_USART_B_CONFIG_RPARMD_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_USART_B_select_rx_parity(SI32_USART_B_Type* /*basePointer*/,
    SI32_USART_B_PARITY_Enum_Type /*parity*/);
+#endif
 ///
 /// @def SI32_USART_B_select_rx_parity(basePointer, parity)
 #define SI32_USART_B_select_rx_parity(basePointer, parity) do{  \
@@ -282,9 +431,23 @@ _SI32_USART_B_select_rx_parity(SI32_USART_B_Type* /*basePointer*/,
 ///  length
 ///  Valid range is 5 to 10.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_select_rx_data_length(
+   SI32_USART_B_Type * basePointer,
+   SI32_USART_B_DATA_LENGTH_Enum_Type length)
+{
+   assert((length >= 5) && (length <= 10));
+   //{{
+   basePointer->CONFIG_CLR = SI32_USART_B_CONFIG_RDATLN_MASK;
+   basePointer->CONFIG_SET = (length - 5) << SI32_USART_B_CONFIG_RDATLN_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_USART_B_select_rx_data_length(SI32_USART_B_Type* /*basePointer*/,
    SI32_USART_B_DATA_LENGTH_Enum_Type /*length*/);
+#endif
 ///
 /// @def SI32_USART_B_select_rx_data_length(basePointer, length)
 #define SI32_USART_B_select_rx_data_length(basePointer, length) do{  \
@@ -298,8 +461,19 @@ _SI32_USART_B_select_rx_data_length(SI32_USART_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_rx_smartcard_parity_response(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_SET = SI32_USART_B_CONFIG_RSCEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_rx_smartcard_parity_response(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_rx_smartcard_parity_response(basePointer)
 #define SI32_USART_B_enable_rx_smartcard_parity_response(basePointer) \
@@ -311,8 +485,19 @@ _SI32_USART_B_enable_rx_smartcard_parity_response(SI32_USART_B_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_rx_smartcard_parity_response(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_CLR = SI32_USART_B_CONFIG_RSCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_rx_smartcard_parity_response(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_rx_smartcard_parity_response(basePointer)
 #define SI32_USART_B_disable_rx_smartcard_parity_response(basePointer) \
@@ -324,8 +509,19 @@ _SI32_USART_B_disable_rx_smartcard_parity_response(SI32_USART_B_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_rx_irda_mode(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_SET = SI32_USART_B_CONFIG_RIRDAEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_rx_irda_mode(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_rx_irda_mode(basePointer)
 #define SI32_USART_B_enable_rx_irda_mode(basePointer) \
@@ -337,8 +533,19 @@ _SI32_USART_B_enable_rx_irda_mode(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_rx_irda_mode(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_CLR = SI32_USART_B_CONFIG_RIRDAEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_rx_irda_mode(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_rx_irda_mode(basePointer)
 #define SI32_USART_B_disable_rx_irda_mode(basePointer) \
@@ -350,8 +557,19 @@ _SI32_USART_B_disable_rx_irda_mode(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_rx_signal_inversion(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_SET = SI32_USART_B_CONFIG_RINVEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_rx_signal_inversion(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_rx_signal_inversion(basePointer)
 #define SI32_USART_B_enable_rx_signal_inversion(basePointer) \
@@ -363,8 +581,19 @@ _SI32_USART_B_enable_rx_signal_inversion(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_rx_signal_inversion(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_CLR = SI32_USART_B_CONFIG_RINVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_rx_signal_inversion(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_rx_signal_inversion(basePointer)
 #define SI32_USART_B_disable_rx_signal_inversion(basePointer) \
@@ -376,8 +605,19 @@ _SI32_USART_B_disable_rx_signal_inversion(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_select_rx_asynchronous_mode(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_CLR = SI32_USART_B_CONFIG_RSYNCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_select_rx_asynchronous_mode(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_select_rx_asynchronous_mode(basePointer)
 #define SI32_USART_B_select_rx_asynchronous_mode(basePointer) \
@@ -389,8 +629,19 @@ _SI32_USART_B_select_rx_asynchronous_mode(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_select_rx_synchronous_mode(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_SET = SI32_USART_B_CONFIG_RSYNCEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_select_rx_synchronous_mode(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_select_rx_synchronous_mode(basePointer)
 #define SI32_USART_B_select_rx_synchronous_mode(basePointer) \
@@ -402,8 +653,19 @@ _SI32_USART_B_select_rx_synchronous_mode(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_tx_start_bit(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_SET = SI32_USART_B_CONFIG_TSTRTEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_tx_start_bit(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_tx_start_bit(basePointer)
 #define SI32_USART_B_enable_tx_start_bit(basePointer) \
@@ -415,8 +677,19 @@ _SI32_USART_B_enable_tx_start_bit(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_tx_start_bit(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_CLR = SI32_USART_B_CONFIG_TSTRTEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_tx_start_bit(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_tx_start_bit(basePointer)
 #define SI32_USART_B_disable_tx_start_bit(basePointer) \
@@ -428,8 +701,19 @@ _SI32_USART_B_disable_tx_start_bit(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_tx_parity_bit(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_SET = SI32_USART_B_CONFIG_TPAREN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_tx_parity_bit(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_tx_parity_bit(basePointer)
 #define SI32_USART_B_enable_tx_parity_bit(basePointer) \
@@ -441,8 +725,19 @@ _SI32_USART_B_enable_tx_parity_bit(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_tx_parity_bit(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_CLR = SI32_USART_B_CONFIG_TPAREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_tx_parity_bit(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_tx_parity_bit(basePointer)
 #define SI32_USART_B_disable_tx_parity_bit(basePointer) \
@@ -454,8 +749,19 @@ _SI32_USART_B_disable_tx_parity_bit(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_tx_stop_bit(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_SET = SI32_USART_B_CONFIG_TSTPEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_tx_stop_bit(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_tx_stop_bit(basePointer)
 #define SI32_USART_B_enable_tx_stop_bit(basePointer) \
@@ -467,8 +773,19 @@ _SI32_USART_B_enable_tx_stop_bit(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_tx_stop_bit(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_CLR = SI32_USART_B_CONFIG_TSTPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_tx_stop_bit(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_tx_stop_bit(basePointer)
 #define SI32_USART_B_disable_tx_stop_bit(basePointer) \
@@ -489,9 +806,23 @@ _SI32_USART_B_disable_tx_stop_bit(SI32_USART_B_Type* /*basePointer*/);
 ///  bits
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_select_tx_stop_bits(
+   SI32_USART_B_Type * basePointer,
+   SI32_USART_B_STOP_BITS_Enum_Type bits)
+{
+   assert(bits < 4);   // bits < 2^2
+   //{{
+   basePointer->CONFIG_CLR = SI32_USART_B_CONFIG_TSTPMD_MASK;
+   basePointer->CONFIG_SET = bits << SI32_USART_B_CONFIG_TSTPMD_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_USART_B_select_tx_stop_bits(SI32_USART_B_Type* /*basePointer*/,
    SI32_USART_B_STOP_BITS_Enum_Type /*bits*/);
+#endif
 ///
 /// @def SI32_USART_B_select_tx_stop_bits(basePointer, bits)
 #define SI32_USART_B_select_tx_stop_bits(basePointer, bits) do{  \
@@ -513,9 +844,23 @@ _SI32_USART_B_select_tx_stop_bits(SI32_USART_B_Type* /*basePointer*/,
 ///  parity
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_select_tx_parity(
+   SI32_USART_B_Type * basePointer,
+   SI32_USART_B_PARITY_Enum_Type parity)
+{
+   assert(parity < 4);   // parity < 2^2
+   //{{
+	basePointer->CONFIG_CLR = SI32_USART_B_CONFIG_TPARMD_MASK;
+   basePointer->CONFIG_SET = parity << SI32_USART_B_CONFIG_TPARMD_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_USART_B_select_tx_parity(SI32_USART_B_Type* /*basePointer*/,
    SI32_USART_B_PARITY_Enum_Type /*parity*/);
+#endif
 ///
 /// @def SI32_USART_B_select_tx_parity(basePointer, parity)
 #define SI32_USART_B_select_tx_parity(basePointer, parity) do{  \
@@ -538,9 +883,23 @@ _SI32_USART_B_select_tx_parity(SI32_USART_B_Type* /*basePointer*/,
 ///  length
 ///  Valid range is 5 to 10.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_select_tx_data_length(
+   SI32_USART_B_Type * basePointer,
+   SI32_USART_B_DATA_LENGTH_Enum_Type length)
+{
+   assert((length >= 5) && (length <= 10));
+   //{{
+	basePointer->CONFIG_CLR = SI32_USART_B_CONFIG_TDATLN_MASK;
+   basePointer->CONFIG_SET = (length - 5) << SI32_USART_B_CONFIG_TDATLN_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_USART_B_select_tx_data_length(SI32_USART_B_Type* /*basePointer*/,
    SI32_USART_B_DATA_LENGTH_Enum_Type /*length*/);
+#endif
 ///
 /// @def SI32_USART_B_select_tx_data_length(basePointer, length)
 #define SI32_USART_B_select_tx_data_length(basePointer, length) do{  \
@@ -554,8 +913,19 @@ _SI32_USART_B_select_tx_data_length(SI32_USART_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_tx_smartcard_parity_check(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_SET = SI32_USART_B_CONFIG_TSCEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_tx_smartcard_parity_check(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_tx_smartcard_parity_check(basePointer)
 #define SI32_USART_B_enable_tx_smartcard_parity_check(basePointer) \
@@ -567,8 +937,19 @@ _SI32_USART_B_enable_tx_smartcard_parity_check(SI32_USART_B_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_tx_smartcard_parity_check(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_CLR = SI32_USART_B_CONFIG_TSCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_tx_smartcard_parity_check(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_tx_smartcard_parity_check(basePointer)
 #define SI32_USART_B_disable_tx_smartcard_parity_check(basePointer) \
@@ -580,8 +961,19 @@ _SI32_USART_B_disable_tx_smartcard_parity_check(SI32_USART_B_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_tx_irda_mode(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_SET = SI32_USART_B_CONFIG_TIRDAEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_tx_irda_mode(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_tx_irda_mode(basePointer)
 #define SI32_USART_B_enable_tx_irda_mode(basePointer) \
@@ -593,8 +985,19 @@ _SI32_USART_B_enable_tx_irda_mode(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_tx_irda_mode(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_CLR = SI32_USART_B_CONFIG_TIRDAEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_tx_irda_mode(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_tx_irda_mode(basePointer)
 #define SI32_USART_B_disable_tx_irda_mode(basePointer) \
@@ -606,8 +1009,19 @@ _SI32_USART_B_disable_tx_irda_mode(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_tx_signal_inversion(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_SET = SI32_USART_B_CONFIG_TINVEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_tx_signal_inversion(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_tx_signal_inversion(basePointer)
 #define SI32_USART_B_enable_tx_signal_inversion(basePointer) \
@@ -619,8 +1033,19 @@ _SI32_USART_B_enable_tx_signal_inversion(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_tx_signal_inversion(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_USART_B_CONFIG_TINVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_tx_signal_inversion(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_tx_signal_inversion(basePointer)
 #define SI32_USART_B_disable_tx_signal_inversion(basePointer) \
@@ -632,8 +1057,19 @@ _SI32_USART_B_disable_tx_signal_inversion(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_select_tx_asynchronous_mode(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_CLR = SI32_USART_B_CONFIG_TSYNCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_select_tx_asynchronous_mode(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_select_tx_asynchronous_mode(basePointer)
 #define SI32_USART_B_select_tx_asynchronous_mode(basePointer) \
@@ -645,8 +1081,19 @@ _SI32_USART_B_select_tx_asynchronous_mode(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_select_tx_synchronous_mode(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONFIG_SET = SI32_USART_B_CONFIG_TSYNCEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_select_tx_synchronous_mode(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_select_tx_synchronous_mode(basePointer)
 #define SI32_USART_B_select_tx_synchronous_mode(basePointer) \
@@ -666,9 +1113,21 @@ _SI32_USART_B_select_tx_synchronous_mode(SI32_USART_B_Type* /*basePointer*/);
 ///  mode
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_write_mode(
+   SI32_USART_B_Type * basePointer,
+   uint32_t mode)
+{
+   //{{
+	basePointer->MODE.U32 = mode;
+   //}}
+}
+#else
 void
 _SI32_USART_B_write_mode(SI32_USART_B_Type* /*basePointer*/,
    uint32_t /*mode*/);
+#endif
 ///
 /// @def SI32_USART_B_write_mode(basePointer, mode)
 #define SI32_USART_B_write_mode(basePointer, mode) \
@@ -683,8 +1142,19 @@ _SI32_USART_B_write_mode(SI32_USART_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USART_B_read_mode(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return basePointer->MODE.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_USART_B_read_mode(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_read_mode(basePointer)
 #define SI32_USART_B_read_mode(basePointer) \
@@ -696,8 +1166,19 @@ _SI32_USART_B_read_mode(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_stall_in_debug_mode(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_SET = SI32_USART_B_MODE_DBGMD_HALT_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_stall_in_debug_mode(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_stall_in_debug_mode(basePointer)
 #define SI32_USART_B_enable_stall_in_debug_mode(basePointer) \
@@ -709,8 +1190,19 @@ _SI32_USART_B_enable_stall_in_debug_mode(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_stall_in_debug_mode(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_CLR = SI32_USART_B_MODE_DBGMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_stall_in_debug_mode(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_stall_in_debug_mode(basePointer)
 #define SI32_USART_B_disable_stall_in_debug_mode(basePointer) \
@@ -722,8 +1214,19 @@ _SI32_USART_B_disable_stall_in_debug_mode(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_exit_loopback_mode(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_CLR = SI32_USART_B_MODE_LBMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_exit_loopback_mode(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_exit_loopback_mode(basePointer)
 #define SI32_USART_B_exit_loopback_mode(basePointer) \
@@ -735,8 +1238,20 @@ _SI32_USART_B_exit_loopback_mode(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enter_receive_loopback_mode(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_CLR = SI32_USART_B_MODE_LBMD_MASK;
+   basePointer->MODE_SET = SI32_USART_B_MODE_LBMD_RXONLY_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enter_receive_loopback_mode(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enter_receive_loopback_mode(basePointer)
 #define SI32_USART_B_enter_receive_loopback_mode(basePointer) do{  \
@@ -750,8 +1265,20 @@ _SI32_USART_B_enter_receive_loopback_mode(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enter_transmit_loopback_mode(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_CLR = SI32_USART_B_MODE_LBMD_MASK;
+   basePointer->MODE_SET = SI32_USART_B_MODE_LBMD_TXONLY_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enter_transmit_loopback_mode(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enter_transmit_loopback_mode(basePointer)
 #define SI32_USART_B_enter_transmit_loopback_mode(basePointer) do{  \
@@ -765,8 +1292,19 @@ _SI32_USART_B_enter_transmit_loopback_mode(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enter_full_loopback_mode(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_SET = SI32_USART_B_MODE_LBMD_BOTH_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enter_full_loopback_mode(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enter_full_loopback_mode(basePointer)
 #define SI32_USART_B_enter_full_loopback_mode(basePointer) \
@@ -778,8 +1316,19 @@ _SI32_USART_B_enter_full_loopback_mode(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_master_generate_clock_during_stop(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_SET = SI32_USART_B_MODE_STPSTCLK_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_master_generate_clock_during_stop(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_master_generate_clock_during_stop(basePointer)
 #define SI32_USART_B_enable_master_generate_clock_during_stop(basePointer) \
@@ -791,8 +1340,19 @@ _SI32_USART_B_enable_master_generate_clock_during_stop(SI32_USART_B_Type* /*base
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_master_generate_clock_during_stop(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_CLR = SI32_USART_B_MODE_STPSTCLK_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_master_generate_clock_during_stop(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_master_generate_clock_during_stop(basePointer)
 #define SI32_USART_B_disable_master_generate_clock_during_stop(basePointer) \
@@ -804,8 +1364,19 @@ _SI32_USART_B_disable_master_generate_clock_during_stop(SI32_USART_B_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_master_generate_clock_during_start(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_SET = SI32_USART_B_MODE_STRTSTCLK_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_master_generate_clock_during_start(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_master_generate_clock_during_start(basePointer)
 #define SI32_USART_B_enable_master_generate_clock_during_start(basePointer) \
@@ -817,8 +1388,19 @@ _SI32_USART_B_enable_master_generate_clock_during_start(SI32_USART_B_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_master_generate_clock_during_start(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_CLR = SI32_USART_B_MODE_STRTSTCLK_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_master_generate_clock_during_start(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_master_generate_clock_during_start(basePointer)
 #define SI32_USART_B_disable_master_generate_clock_during_start(basePointer) \
@@ -830,8 +1412,19 @@ _SI32_USART_B_disable_master_generate_clock_during_start(SI32_USART_B_Type* /*ba
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_master_generate_clock_between_transfers(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_SET = SI32_USART_B_MODE_ISTCLK_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_master_generate_clock_between_transfers(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_master_generate_clock_between_transfers(basePointer)
 #define SI32_USART_B_enable_master_generate_clock_between_transfers(basePointer) \
@@ -843,8 +1436,19 @@ _SI32_USART_B_enable_master_generate_clock_between_transfers(SI32_USART_B_Type*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_master_generate_clock_between_transfers(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_CLR = SI32_USART_B_MODE_ISTCLK_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_master_generate_clock_between_transfers(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_master_generate_clock_between_transfers(basePointer)
 #define SI32_USART_B_disable_master_generate_clock_between_transfers(basePointer) \
@@ -856,8 +1460,19 @@ _SI32_USART_B_disable_master_generate_clock_between_transfers(SI32_USART_B_Type*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enter_half_duplex_mode(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_SET = SI32_USART_B_MODE_DUPLEXMD_HALF_DUPLEX_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enter_half_duplex_mode(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enter_half_duplex_mode(basePointer)
 #define SI32_USART_B_enter_half_duplex_mode(basePointer) \
@@ -869,8 +1484,19 @@ _SI32_USART_B_enter_half_duplex_mode(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enter_full_duplex_mode(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_CLR = SI32_USART_B_MODE_DUPLEXMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enter_full_duplex_mode(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enter_full_duplex_mode(basePointer)
 #define SI32_USART_B_enter_full_duplex_mode(basePointer) \
@@ -882,8 +1508,19 @@ _SI32_USART_B_enter_full_duplex_mode(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_select_sync_clock_low_during_idle(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_CLR = SI32_USART_B_MODE_CLKIDLE_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_select_sync_clock_low_during_idle(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_select_sync_clock_low_during_idle(basePointer)
 #define SI32_USART_B_select_sync_clock_low_during_idle(basePointer) \
@@ -895,8 +1532,19 @@ _SI32_USART_B_select_sync_clock_low_during_idle(SI32_USART_B_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_select_sync_clock_high_during_idle(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_SET = SI32_USART_B_MODE_CLKIDLE_IDLE_HIGH_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_select_sync_clock_high_during_idle(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_select_sync_clock_high_during_idle(basePointer)
 #define SI32_USART_B_select_sync_clock_high_during_idle(basePointer) \
@@ -908,8 +1556,19 @@ _SI32_USART_B_select_sync_clock_high_during_idle(SI32_USART_B_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_select_clock_edge_falling(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_CLR = SI32_USART_B_MODE_CLKESEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_select_clock_edge_falling(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_select_clock_edge_falling(basePointer)
 #define SI32_USART_B_select_clock_edge_falling(basePointer) \
@@ -921,8 +1580,19 @@ _SI32_USART_B_select_clock_edge_falling(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_select_clock_edge_rising(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_SET = SI32_USART_B_MODE_CLKESEL_RISING_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_select_clock_edge_rising(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_select_clock_edge_rising(basePointer)
 #define SI32_USART_B_select_clock_edge_rising(basePointer) \
@@ -934,8 +1604,19 @@ _SI32_USART_B_select_clock_edge_rising(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_idle_tristate(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_CLR = SI32_USART_B_MODE_ITSEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_idle_tristate(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_idle_tristate(basePointer)
 #define SI32_USART_B_disable_idle_tristate(basePointer) \
@@ -947,8 +1628,19 @@ _SI32_USART_B_disable_idle_tristate(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_idle_tristate(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_SET = SI32_USART_B_MODE_ITSEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_idle_tristate(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_idle_tristate(basePointer)
 #define SI32_USART_B_enable_idle_tristate(basePointer) \
@@ -960,8 +1652,19 @@ _SI32_USART_B_enable_idle_tristate(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enter_master_mode(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_SET = SI32_USART_B_MODE_OPMD_MASTER_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enter_master_mode(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enter_master_mode(basePointer)
 #define SI32_USART_B_enter_master_mode(basePointer) \
@@ -973,8 +1676,19 @@ _SI32_USART_B_enter_master_mode(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enter_slave_mode(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->MODE_CLR = SI32_USART_B_MODE_OPMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enter_slave_mode(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enter_slave_mode(basePointer)
 #define SI32_USART_B_enter_slave_mode(basePointer) \
@@ -994,9 +1708,21 @@ _SI32_USART_B_enter_slave_mode(SI32_USART_B_Type* /*basePointer*/);
 ///  flowcn
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_write_flowcn(
+   SI32_USART_B_Type * basePointer,
+   uint32_t flowcn)
+{
+   //{{
+	basePointer->FLOWCN.U32 = flowcn;
+   //}}
+}
+#else
 void
 _SI32_USART_B_write_flowcn(SI32_USART_B_Type* /*basePointer*/,
    uint32_t /*flowcn*/);
+#endif
 ///
 /// @def SI32_USART_B_write_flowcn(basePointer, flowcn)
 #define SI32_USART_B_write_flowcn(basePointer, flowcn) \
@@ -1011,8 +1737,19 @@ _SI32_USART_B_write_flowcn(SI32_USART_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USART_B_read_flowcn(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return basePointer->FLOWCN.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_USART_B_read_flowcn(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_read_flowcn(basePointer)
 #define SI32_USART_B_read_flowcn(basePointer) \
@@ -1024,8 +1761,19 @@ _SI32_USART_B_read_flowcn(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_clear_rts(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FLOWCN_CLR = SI32_USART_B_FLOWCN_RTS_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_clear_rts(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_clear_rts(basePointer)
 #define SI32_USART_B_clear_rts(basePointer) \
@@ -1037,8 +1785,19 @@ _SI32_USART_B_clear_rts(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_set_rts(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FLOWCN_SET = SI32_USART_B_FLOWCN_RTS_HIGH_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_set_rts(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_set_rts(basePointer)
 #define SI32_USART_B_set_rts(basePointer) \
@@ -1050,8 +1809,19 @@ _SI32_USART_B_set_rts(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_B_read_rts_output(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->FLOWCN.RTS);
+   //}}
+}
+#else
 bool
 _SI32_USART_B_read_rts_output(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_read_rts_output(basePointer)
 #define SI32_USART_B_read_rts_output(basePointer) \
@@ -1063,8 +1833,19 @@ _SI32_USART_B_read_rts_output(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_B_read_rx_input(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->FLOWCN.RX);
+   //}}
+}
+#else
 bool
 _SI32_USART_B_read_rx_input(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_read_rx_input(basePointer)
 #define SI32_USART_B_read_rx_input(basePointer) \
@@ -1076,8 +1857,19 @@ _SI32_USART_B_read_rx_input(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_rts_inversion(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FLOWCN_SET = SI32_USART_B_FLOWCN_RTSINVEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_rts_inversion(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_rts_inversion(basePointer)
 #define SI32_USART_B_enable_rts_inversion(basePointer) \
@@ -1089,8 +1881,19 @@ _SI32_USART_B_enable_rts_inversion(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_rts_inversion(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FLOWCN_CLR = SI32_USART_B_FLOWCN_RTSINVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_rts_inversion(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_rts_inversion(basePointer)
 #define SI32_USART_B_disable_rts_inversion(basePointer) \
@@ -1102,8 +1905,19 @@ _SI32_USART_B_disable_rts_inversion(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_select_rts_deassert_on_full(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FLOWCN_CLR = SI32_USART_B_FLOWCN_RTSTH_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_select_rts_deassert_on_full(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_select_rts_deassert_on_full(basePointer)
 #define SI32_USART_B_select_rts_deassert_on_full(basePointer) \
@@ -1115,8 +1929,19 @@ _SI32_USART_B_select_rts_deassert_on_full(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_select_rts_deassert_on_byte_free(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FLOWCN_SET = SI32_USART_B_FLOWCN_RTSTH_ONE_BYTE_FREE_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_select_rts_deassert_on_byte_free(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_select_rts_deassert_on_byte_free(basePointer)
 #define SI32_USART_B_select_rts_deassert_on_byte_free(basePointer) \
@@ -1128,8 +1953,19 @@ _SI32_USART_B_select_rts_deassert_on_byte_free(SI32_USART_B_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_rts(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FLOWCN_SET = SI32_USART_B_FLOWCN_RTSEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_rts(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_rts(basePointer)
 #define SI32_USART_B_enable_rts(basePointer) \
@@ -1141,8 +1977,19 @@ _SI32_USART_B_enable_rts(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_rts(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FLOWCN_CLR = SI32_USART_B_FLOWCN_RTSEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_rts(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_rts(basePointer)
 #define SI32_USART_B_disable_rts(basePointer) \
@@ -1154,8 +2001,19 @@ _SI32_USART_B_disable_rts(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_tx_output(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FLOWCN_SET = SI32_USART_B_FLOWCN_TXOEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_tx_output(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_tx_output(basePointer)
 #define SI32_USART_B_enable_tx_output(basePointer) \
@@ -1167,8 +2025,19 @@ _SI32_USART_B_enable_tx_output(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_tx_output(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FLOWCN_CLR = SI32_USART_B_FLOWCN_TXOEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_tx_output(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_tx_output(basePointer)
 #define SI32_USART_B_disable_tx_output(basePointer) \
@@ -1180,8 +2049,19 @@ _SI32_USART_B_disable_tx_output(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_B_read_cts_input(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->FLOWCN.CTS);
+   //}}
+}
+#else
 bool
 _SI32_USART_B_read_cts_input(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_read_cts_input(basePointer)
 #define SI32_USART_B_read_cts_input(basePointer) \
@@ -1193,8 +2073,19 @@ _SI32_USART_B_read_cts_input(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_B_read_tx_output(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->FLOWCN.TX);
+   //}}
+}
+#else
 bool
 _SI32_USART_B_read_tx_output(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_read_tx_output(basePointer)
 #define SI32_USART_B_read_tx_output(basePointer) \
@@ -1206,8 +2097,19 @@ _SI32_USART_B_read_tx_output(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_clear_tx(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FLOWCN_CLR = SI32_USART_B_FLOWCN_TX_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_clear_tx(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_clear_tx(basePointer)
 #define SI32_USART_B_clear_tx(basePointer) \
@@ -1219,8 +2121,19 @@ _SI32_USART_B_clear_tx(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_set_tx(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FLOWCN_SET = SI32_USART_B_FLOWCN_TX_HIGH_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_set_tx(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_set_tx(basePointer)
 #define SI32_USART_B_set_tx(basePointer) \
@@ -1232,8 +2145,19 @@ _SI32_USART_B_set_tx(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_set_sync_clock_low(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FLOWCN_CLR = SI32_USART_B_FLOWCN_UCLK_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_set_sync_clock_low(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_set_sync_clock_low(basePointer)
 #define SI32_USART_B_set_sync_clock_low(basePointer) \
@@ -1245,8 +2169,19 @@ _SI32_USART_B_set_sync_clock_low(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_set_sync_clock_high(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FLOWCN_SET = SI32_USART_B_FLOWCN_UCLK_HIGH_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_set_sync_clock_high(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_set_sync_clock_high(basePointer)
 #define SI32_USART_B_set_sync_clock_high(basePointer) \
@@ -1258,8 +2193,19 @@ _SI32_USART_B_set_sync_clock_high(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_B_read_sync_clock(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->FLOWCN.UCLK);
+   //}}
+}
+#else
 bool
 _SI32_USART_B_read_sync_clock(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_read_sync_clock(basePointer)
 #define SI32_USART_B_read_sync_clock(basePointer) \
@@ -1271,8 +2217,19 @@ _SI32_USART_B_read_sync_clock(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_cts_inversion(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FLOWCN_SET = SI32_USART_B_FLOWCN_CTSINVEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_cts_inversion(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_cts_inversion(basePointer)
 #define SI32_USART_B_enable_cts_inversion(basePointer) \
@@ -1284,8 +2241,19 @@ _SI32_USART_B_enable_cts_inversion(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_cts_inversion(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FLOWCN_CLR = SI32_USART_B_FLOWCN_CTSINVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_cts_inversion(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_cts_inversion(basePointer)
 #define SI32_USART_B_disable_cts_inversion(basePointer) \
@@ -1297,8 +2265,19 @@ _SI32_USART_B_disable_cts_inversion(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_cts(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FLOWCN_SET = SI32_USART_B_FLOWCN_CTSEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_cts(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_cts(basePointer)
 #define SI32_USART_B_enable_cts(basePointer) \
@@ -1310,8 +2289,19 @@ _SI32_USART_B_enable_cts(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_cts(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+   basePointer->FLOWCN_CLR = SI32_USART_B_FLOWCN_CTSEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_cts(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_cts(basePointer)
 #define SI32_USART_B_disable_cts(basePointer) \
@@ -1333,9 +2323,23 @@ _SI32_USART_B_disable_cts(SI32_USART_B_Type* /*basePointer*/);
 ///  width
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_select_tx_irda_pulse_width(
+   SI32_USART_B_Type * basePointer,
+   SI32_USART_B_IRDA_PULSE_WIDTH_Enum_Type width)
+{
+   assert(width < 4);   // width < 2^2
+   //{{
+	basePointer->FLOWCN_CLR = SI32_USART_B_FLOWCN_TIRDAPW_MASK;
+   basePointer->FLOWCN_SET = width << SI32_USART_B_FLOWCN_TIRDAPW_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_USART_B_select_tx_irda_pulse_width(SI32_USART_B_Type* /*basePointer*/,
    SI32_USART_B_IRDA_PULSE_WIDTH_Enum_Type /*width*/);
+#endif
 ///
 /// @def SI32_USART_B_select_tx_irda_pulse_width(basePointer, width)
 #define SI32_USART_B_select_tx_irda_pulse_width(basePointer, width) do{  \
@@ -1357,9 +2361,21 @@ _SI32_USART_B_select_tx_irda_pulse_width(SI32_USART_B_Type* /*basePointer*/,
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_write_control(
+   SI32_USART_B_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+	basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_USART_B_write_control(SI32_USART_B_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_USART_B_write_control(basePointer, control)
 #define SI32_USART_B_write_control(basePointer, control) \
@@ -1374,8 +2390,19 @@ _SI32_USART_B_write_control(SI32_USART_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USART_B_read_control(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_USART_B_read_control(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_read_control(basePointer)
 #define SI32_USART_B_read_control(basePointer) \
@@ -1387,8 +2414,19 @@ _SI32_USART_B_read_control(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_B_is_rx_frame_error_interrupt_pending(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.RFRMERI);
+   //}}
+}
+#else
 bool
 _SI32_USART_B_is_rx_frame_error_interrupt_pending(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_is_rx_frame_error_interrupt_pending(basePointer)
 #define SI32_USART_B_is_rx_frame_error_interrupt_pending(basePointer) \
@@ -1400,8 +2438,19 @@ _SI32_USART_B_is_rx_frame_error_interrupt_pending(SI32_USART_B_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_clear_rx_frame_error_interrupt(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_USART_B_CONTROL_RFRMERI_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_clear_rx_frame_error_interrupt(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_clear_rx_frame_error_interrupt(basePointer)
 #define SI32_USART_B_clear_rx_frame_error_interrupt(basePointer) \
@@ -1413,8 +2462,19 @@ _SI32_USART_B_clear_rx_frame_error_interrupt(SI32_USART_B_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_B_is_rx_parity_error_interrupt_pending(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.RPARERI);
+   //}}
+}
+#else
 bool
 _SI32_USART_B_is_rx_parity_error_interrupt_pending(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_is_rx_parity_error_interrupt_pending(basePointer)
 #define SI32_USART_B_is_rx_parity_error_interrupt_pending(basePointer) \
@@ -1426,8 +2486,19 @@ _SI32_USART_B_is_rx_parity_error_interrupt_pending(SI32_USART_B_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_clear_rx_parity_error_interrupt(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_USART_B_CONTROL_RPARERI_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_clear_rx_parity_error_interrupt(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_clear_rx_parity_error_interrupt(basePointer)
 #define SI32_USART_B_clear_rx_parity_error_interrupt(basePointer) \
@@ -1439,8 +2510,19 @@ _SI32_USART_B_clear_rx_parity_error_interrupt(SI32_USART_B_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_B_is_rx_overrun_interrupt_pending(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.ROREI);
+   //}}
+}
+#else
 bool
 _SI32_USART_B_is_rx_overrun_interrupt_pending(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_is_rx_overrun_interrupt_pending(basePointer)
 #define SI32_USART_B_is_rx_overrun_interrupt_pending(basePointer) \
@@ -1452,8 +2534,19 @@ _SI32_USART_B_is_rx_overrun_interrupt_pending(SI32_USART_B_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_clear_rx_overrun_error_interrupt(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_USART_B_CONTROL_ROREI_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_clear_rx_overrun_error_interrupt(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_clear_rx_overrun_error_interrupt(basePointer)
 #define SI32_USART_B_clear_rx_overrun_error_interrupt(basePointer) \
@@ -1465,8 +2558,19 @@ _SI32_USART_B_clear_rx_overrun_error_interrupt(SI32_USART_B_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_B_is_rx_data_request_interrupt_pending(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.RDREQI);
+   //}}
+}
+#else
 bool
 _SI32_USART_B_is_rx_data_request_interrupt_pending(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_is_rx_data_request_interrupt_pending(basePointer)
 #define SI32_USART_B_is_rx_data_request_interrupt_pending(basePointer) \
@@ -1478,8 +2582,19 @@ _SI32_USART_B_is_rx_data_request_interrupt_pending(SI32_USART_B_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_clear_rx_data_request_interrupt(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_USART_B_CONTROL_RDREQI_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_clear_rx_data_request_interrupt(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_clear_rx_data_request_interrupt(basePointer)
 #define SI32_USART_B_clear_rx_data_request_interrupt(basePointer) \
@@ -1495,8 +2610,19 @@ _SI32_USART_B_clear_rx_data_request_interrupt(SI32_USART_B_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_rx_error_interrupts(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_SET = SI32_USART_B_CONTROL_RERIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_rx_error_interrupts(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_rx_error_interrupts(basePointer)
 #define SI32_USART_B_enable_rx_error_interrupts(basePointer) \
@@ -1512,8 +2638,19 @@ _SI32_USART_B_enable_rx_error_interrupts(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_rx_error_interrupts(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_USART_B_CONTROL_RERIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_rx_error_interrupts(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_rx_error_interrupts(basePointer)
 #define SI32_USART_B_disable_rx_error_interrupts(basePointer) \
@@ -1525,8 +2662,19 @@ _SI32_USART_B_disable_rx_error_interrupts(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_B_is_rx_error_interrupts_enabled(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.RERIEN);
+   //}}
+}
+#else
 bool
 _SI32_USART_B_is_rx_error_interrupts_enabled(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_is_rx_error_interrupts_enabled(basePointer)
 #define SI32_USART_B_is_rx_error_interrupts_enabled(basePointer) \
@@ -1538,8 +2686,19 @@ _SI32_USART_B_is_rx_error_interrupts_enabled(SI32_USART_B_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_rx_data_request_interrupt(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_SET = SI32_USART_B_CONTROL_RDREQIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_rx_data_request_interrupt(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_rx_data_request_interrupt(basePointer)
 #define SI32_USART_B_enable_rx_data_request_interrupt(basePointer) \
@@ -1551,8 +2710,19 @@ _SI32_USART_B_enable_rx_data_request_interrupt(SI32_USART_B_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_rx_data_request_interrupt(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_USART_B_CONTROL_RDREQIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_rx_data_request_interrupt(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_rx_data_request_interrupt(basePointer)
 #define SI32_USART_B_disable_rx_data_request_interrupt(basePointer) \
@@ -1564,8 +2734,19 @@ _SI32_USART_B_disable_rx_data_request_interrupt(SI32_USART_B_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_B_is_rx_data_request_interrupt_enabled(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.RDREQIEN);
+   //}}
+}
+#else
 bool
 _SI32_USART_B_is_rx_data_request_interrupt_enabled(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_is_rx_data_request_interrupt_enabled(basePointer)
 #define SI32_USART_B_is_rx_data_request_interrupt_enabled(basePointer) \
@@ -1577,8 +2758,19 @@ _SI32_USART_B_is_rx_data_request_interrupt_enabled(SI32_USART_B_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_exit_match_mode(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_USART_B_CONTROL_MATMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_exit_match_mode(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_exit_match_mode(basePointer)
 #define SI32_USART_B_exit_match_mode(basePointer) \
@@ -1590,8 +2782,20 @@ _SI32_USART_B_exit_match_mode(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enter_match_mode_store_byte(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_USART_B_CONTROL_MATMD_MASK;
+   basePointer->CONTROL_SET = SI32_USART_B_CONTROL_MATMD_MCE_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enter_match_mode_store_byte(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enter_match_mode_store_byte(basePointer)
 #define SI32_USART_B_enter_match_mode_store_byte(basePointer) do{  \
@@ -1605,8 +2809,20 @@ _SI32_USART_B_enter_match_mode_store_byte(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enter_match_mode_generate_frame_error(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_USART_B_CONTROL_MATMD_MASK;
+   basePointer->CONTROL_SET = SI32_USART_B_CONTROL_MATMD_FRAME_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enter_match_mode_generate_frame_error(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enter_match_mode_generate_frame_error(basePointer)
 #define SI32_USART_B_enter_match_mode_generate_frame_error(basePointer) do{  \
@@ -1620,8 +2836,19 @@ _SI32_USART_B_enter_match_mode_generate_frame_error(SI32_USART_B_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enter_match_mode_store_bit(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_SET = SI32_USART_B_CONTROL_MATMD_STORE_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enter_match_mode_store_bit(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enter_match_mode_store_bit(basePointer)
 #define SI32_USART_B_enter_match_mode_store_bit(basePointer) \
@@ -1633,8 +2860,19 @@ _SI32_USART_B_enter_match_mode_store_bit(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_rx_autobaud(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_SET = SI32_USART_B_CONTROL_RABDEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_rx_autobaud(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_rx_autobaud(basePointer)
 #define SI32_USART_B_enable_rx_autobaud(basePointer) \
@@ -1646,8 +2884,19 @@ _SI32_USART_B_enable_rx_autobaud(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_rx_autobaud(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_USART_B_CONTROL_RABDEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_rx_autobaud(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_rx_autobaud(basePointer)
 #define SI32_USART_B_disable_rx_autobaud(basePointer) \
@@ -1659,8 +2908,19 @@ _SI32_USART_B_disable_rx_autobaud(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_B_is_rx_busy(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.RBUSYF);
+   //}}
+}
+#else
 bool
 _SI32_USART_B_is_rx_busy(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_is_rx_busy(basePointer)
 #define SI32_USART_B_is_rx_busy(basePointer) \
@@ -1672,8 +2932,19 @@ _SI32_USART_B_is_rx_busy(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_set_rbit(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_SET = SI32_USART_B_CONTROL_RBIT_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_set_rbit(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_set_rbit(basePointer)
 #define SI32_USART_B_set_rbit(basePointer) \
@@ -1685,8 +2956,19 @@ _SI32_USART_B_set_rbit(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_clear_rbit(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_USART_B_CONTROL_RBIT_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_clear_rbit(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_clear_rbit(basePointer)
 #define SI32_USART_B_clear_rbit(basePointer) \
@@ -1698,8 +2980,19 @@ _SI32_USART_B_clear_rbit(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_B_read_rbit(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.RBIT);
+   //}}
+}
+#else
 bool
 _SI32_USART_B_read_rbit(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_read_rbit(basePointer)
 #define SI32_USART_B_read_rbit(basePointer) \
@@ -1711,8 +3004,19 @@ _SI32_USART_B_read_rbit(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_rx_one_shot(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_SET = SI32_USART_B_CONTROL_ROSEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_rx_one_shot(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_rx_one_shot(basePointer)
 #define SI32_USART_B_enable_rx_one_shot(basePointer) \
@@ -1724,8 +3028,19 @@ _SI32_USART_B_enable_rx_one_shot(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_rx_one_shot(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_USART_B_CONTROL_ROSEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_rx_one_shot(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_rx_one_shot(basePointer)
 #define SI32_USART_B_disable_rx_one_shot(basePointer) \
@@ -1737,8 +3052,19 @@ _SI32_USART_B_disable_rx_one_shot(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_rx_inhibit(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_SET = SI32_USART_B_CONTROL_RINH_ACTIVE_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_rx_inhibit(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_rx_inhibit(basePointer)
 #define SI32_USART_B_enable_rx_inhibit(basePointer) \
@@ -1750,8 +3076,19 @@ _SI32_USART_B_enable_rx_inhibit(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_rx_inhibit(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_USART_B_CONTROL_RINH_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_rx_inhibit(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_rx_inhibit(basePointer)
 #define SI32_USART_B_disable_rx_inhibit(basePointer) \
@@ -1763,8 +3100,19 @@ _SI32_USART_B_disable_rx_inhibit(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_rx(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_SET = SI32_USART_B_CONTROL_REN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_rx(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_rx(basePointer)
 #define SI32_USART_B_enable_rx(basePointer) \
@@ -1776,8 +3124,19 @@ _SI32_USART_B_enable_rx(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_rx(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_USART_B_CONTROL_REN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_rx(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_rx(basePointer)
 #define SI32_USART_B_disable_rx(basePointer) \
@@ -1789,8 +3148,19 @@ _SI32_USART_B_disable_rx(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_B_is_tx_smartcard_parity_error_interrupt_pending(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.TSCERI);
+   //}}
+}
+#else
 bool
 _SI32_USART_B_is_tx_smartcard_parity_error_interrupt_pending(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_is_tx_smartcard_parity_error_interrupt_pending(basePointer)
 #define SI32_USART_B_is_tx_smartcard_parity_error_interrupt_pending(basePointer) \
@@ -1802,8 +3172,19 @@ _SI32_USART_B_is_tx_smartcard_parity_error_interrupt_pending(SI32_USART_B_Type*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_clear_tx_smartcard_parity_error_interrupt(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_USART_B_CONTROL_TSCERI_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_clear_tx_smartcard_parity_error_interrupt(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_clear_tx_smartcard_parity_error_interrupt(basePointer)
 #define SI32_USART_B_clear_tx_smartcard_parity_error_interrupt(basePointer) \
@@ -1815,8 +3196,19 @@ _SI32_USART_B_clear_tx_smartcard_parity_error_interrupt(SI32_USART_B_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_B_is_tx_underrun_interrupt_pending(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.TUREI);
+   //}}
+}
+#else
 bool
 _SI32_USART_B_is_tx_underrun_interrupt_pending(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_is_tx_underrun_interrupt_pending(basePointer)
 #define SI32_USART_B_is_tx_underrun_interrupt_pending(basePointer) \
@@ -1828,8 +3220,19 @@ _SI32_USART_B_is_tx_underrun_interrupt_pending(SI32_USART_B_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_clear_tx_underrun_interrupt(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_USART_B_CONTROL_TUREI_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_clear_tx_underrun_interrupt(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_clear_tx_underrun_interrupt(basePointer)
 #define SI32_USART_B_clear_tx_underrun_interrupt(basePointer) \
@@ -1841,8 +3244,19 @@ _SI32_USART_B_clear_tx_underrun_interrupt(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_B_is_tx_data_request_interrupt_pending(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.TDREQI);
+   //}}
+}
+#else
 bool
 _SI32_USART_B_is_tx_data_request_interrupt_pending(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_is_tx_data_request_interrupt_pending(basePointer)
 #define SI32_USART_B_is_tx_data_request_interrupt_pending(basePointer) \
@@ -1854,8 +3268,19 @@ _SI32_USART_B_is_tx_data_request_interrupt_pending(SI32_USART_B_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_B_is_tx_complete(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.TCPTI);
+   //}}
+}
+#else
 bool
 _SI32_USART_B_is_tx_complete(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_is_tx_complete(basePointer)
 #define SI32_USART_B_is_tx_complete(basePointer) \
@@ -1867,8 +3292,19 @@ _SI32_USART_B_is_tx_complete(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_clear_tx_complete_interrupt(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_USART_B_CONTROL_TCPTI_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_clear_tx_complete_interrupt(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_clear_tx_complete_interrupt(basePointer)
 #define SI32_USART_B_clear_tx_complete_interrupt(basePointer) \
@@ -1880,8 +3316,19 @@ _SI32_USART_B_clear_tx_complete_interrupt(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_select_tx_complete_threshold_end_of_transmission(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_USART_B_CONTROL_TCPTTH_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_select_tx_complete_threshold_end_of_transmission(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_select_tx_complete_threshold_end_of_transmission(basePointer)
 #define SI32_USART_B_select_tx_complete_threshold_end_of_transmission(basePointer) \
@@ -1893,8 +3340,19 @@ _SI32_USART_B_select_tx_complete_threshold_end_of_transmission(SI32_USART_B_Type
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_select_tx_complete_threshold_no_more_data(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_SET = SI32_USART_B_CONTROL_TCPTTH_SET_ON_EMPTY_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_select_tx_complete_threshold_no_more_data(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_select_tx_complete_threshold_no_more_data(basePointer)
 #define SI32_USART_B_select_tx_complete_threshold_no_more_data(basePointer) \
@@ -1910,8 +3368,19 @@ _SI32_USART_B_select_tx_complete_threshold_no_more_data(SI32_USART_B_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_tx_error_interrupts(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_SET = SI32_USART_B_CONTROL_TERIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_tx_error_interrupts(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_tx_error_interrupts(basePointer)
 #define SI32_USART_B_enable_tx_error_interrupts(basePointer) \
@@ -1927,8 +3396,19 @@ _SI32_USART_B_enable_tx_error_interrupts(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_tx_error_interrupts(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_USART_B_CONTROL_TERIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_tx_error_interrupts(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_tx_error_interrupts(basePointer)
 #define SI32_USART_B_disable_tx_error_interrupts(basePointer) \
@@ -1940,8 +3420,19 @@ _SI32_USART_B_disable_tx_error_interrupts(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_B_is_tx_error_interrupts_enabled(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.TERIEN);
+   //}}
+}
+#else
 bool
 _SI32_USART_B_is_tx_error_interrupts_enabled(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_is_tx_error_interrupts_enabled(basePointer)
 #define SI32_USART_B_is_tx_error_interrupts_enabled(basePointer) \
@@ -1953,8 +3444,19 @@ _SI32_USART_B_is_tx_error_interrupts_enabled(SI32_USART_B_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_tx_data_request_interrupt(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_SET = SI32_USART_B_CONTROL_TDREQIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_tx_data_request_interrupt(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_tx_data_request_interrupt(basePointer)
 #define SI32_USART_B_enable_tx_data_request_interrupt(basePointer) \
@@ -1966,8 +3468,19 @@ _SI32_USART_B_enable_tx_data_request_interrupt(SI32_USART_B_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_tx_data_request_interrupt(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_USART_B_CONTROL_TDREQIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_tx_data_request_interrupt(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_tx_data_request_interrupt(basePointer)
 #define SI32_USART_B_disable_tx_data_request_interrupt(basePointer) \
@@ -1979,8 +3492,19 @@ _SI32_USART_B_disable_tx_data_request_interrupt(SI32_USART_B_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_B_is_tx_data_request_interrupt_enabled(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.TDREQIEN);
+   //}}
+}
+#else
 bool
 _SI32_USART_B_is_tx_data_request_interrupt_enabled(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_is_tx_data_request_interrupt_enabled(basePointer)
 #define SI32_USART_B_is_tx_data_request_interrupt_enabled(basePointer) \
@@ -1992,8 +3516,19 @@ _SI32_USART_B_is_tx_data_request_interrupt_enabled(SI32_USART_B_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_tx_complete_interrupt(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_SET = SI32_USART_B_CONTROL_TCPTIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_tx_complete_interrupt(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_tx_complete_interrupt(basePointer)
 #define SI32_USART_B_enable_tx_complete_interrupt(basePointer) \
@@ -2005,8 +3540,19 @@ _SI32_USART_B_enable_tx_complete_interrupt(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_tx_complete_interrupt(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_USART_B_CONTROL_TCPTIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_tx_complete_interrupt(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_tx_complete_interrupt(basePointer)
 #define SI32_USART_B_disable_tx_complete_interrupt(basePointer) \
@@ -2018,8 +3564,19 @@ _SI32_USART_B_disable_tx_complete_interrupt(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_B_is_tx_complete_interrupt_enabled(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.TCPTIEN);
+   //}}
+}
+#else
 bool
 _SI32_USART_B_is_tx_complete_interrupt_enabled(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_is_tx_complete_interrupt_enabled(basePointer)
 #define SI32_USART_B_is_tx_complete_interrupt_enabled(basePointer) \
@@ -2031,8 +3588,19 @@ _SI32_USART_B_is_tx_complete_interrupt_enabled(SI32_USART_B_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_B_is_tx_busy(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.TBUSYF);
+   //}}
+}
+#else
 bool
 _SI32_USART_B_is_tx_busy(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_is_tx_busy(basePointer)
 #define SI32_USART_B_is_tx_busy(basePointer) \
@@ -2044,8 +3612,19 @@ _SI32_USART_B_is_tx_busy(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_set_tbit(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_SET = SI32_USART_B_CONTROL_TBIT_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_set_tbit(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_set_tbit(basePointer)
 #define SI32_USART_B_set_tbit(basePointer) \
@@ -2057,8 +3636,19 @@ _SI32_USART_B_set_tbit(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_clear_tbit(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_USART_B_CONTROL_TBIT_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_clear_tbit(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_clear_tbit(basePointer)
 #define SI32_USART_B_clear_tbit(basePointer) \
@@ -2070,8 +3660,19 @@ _SI32_USART_B_clear_tbit(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_tx_inhibit(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_SET = SI32_USART_B_CONTROL_TINH_ACTIVE_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_tx_inhibit(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_tx_inhibit(basePointer)
 #define SI32_USART_B_enable_tx_inhibit(basePointer) \
@@ -2083,8 +3684,19 @@ _SI32_USART_B_enable_tx_inhibit(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_tx_inhibit(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_USART_B_CONTROL_TINH_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_tx_inhibit(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_tx_inhibit(basePointer)
 #define SI32_USART_B_disable_tx_inhibit(basePointer) \
@@ -2096,8 +3708,19 @@ _SI32_USART_B_disable_tx_inhibit(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_tx(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_SET = SI32_USART_B_CONTROL_TEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_tx(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_tx(basePointer)
 #define SI32_USART_B_enable_tx(basePointer) \
@@ -2109,8 +3732,19 @@ _SI32_USART_B_enable_tx(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_tx(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_USART_B_CONTROL_TEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_tx(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_tx(basePointer)
 #define SI32_USART_B_disable_tx(basePointer) \
@@ -2130,9 +3764,21 @@ _SI32_USART_B_disable_tx(SI32_USART_B_Type* /*basePointer*/);
 ///  ipdelay
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_write_ipdelay(
+   SI32_USART_B_Type * basePointer,
+   uint32_t ipdelay)
+{
+   //{{
+	basePointer->IPDELAY.U32 = ipdelay;
+   //}}
+}
+#else
 void
 _SI32_USART_B_write_ipdelay(SI32_USART_B_Type* /*basePointer*/,
    uint32_t /*ipdelay*/);
+#endif
 ///
 /// @def SI32_USART_B_write_ipdelay(basePointer, ipdelay)
 #define SI32_USART_B_write_ipdelay(basePointer, ipdelay) \
@@ -2147,8 +3793,19 @@ _SI32_USART_B_write_ipdelay(SI32_USART_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USART_B_read_ipdelay(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return basePointer->IPDELAY.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_USART_B_read_ipdelay(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_read_ipdelay(basePointer)
 #define SI32_USART_B_read_ipdelay(basePointer) \
@@ -2168,9 +3825,22 @@ _SI32_USART_B_read_ipdelay(SI32_USART_B_Type* /*basePointer*/);
 ///  ipdelay
 ///  Valid range is 8 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_write_ipdelay_bits(
+   SI32_USART_B_Type * basePointer,
+   uint32_t ipdelay)
+{
+   assert(ipdelay < 256);   // ipdelay < 2^8
+   //{{
+	basePointer->IPDELAY.IPDELAY_BITS = ipdelay;
+   //}}
+}
+#else
 void
 _SI32_USART_B_write_ipdelay_bits(SI32_USART_B_Type* /*basePointer*/,
    uint32_t /*ipdelay*/);
+#endif
 ///
 /// @def SI32_USART_B_write_ipdelay_bits(basePointer, ipdelay)
 #define SI32_USART_B_write_ipdelay_bits(basePointer, ipdelay) \
@@ -2185,8 +3855,19 @@ _SI32_USART_B_write_ipdelay_bits(SI32_USART_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USART_B_read_ipdelay_bits(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return basePointer->IPDELAY.IPDELAY_BITS;
+   //}}
+}
+#else
 uint32_t
 _SI32_USART_B_read_ipdelay_bits(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_read_ipdelay_bits(basePointer)
 #define SI32_USART_B_read_ipdelay_bits(basePointer) \
@@ -2206,9 +3887,21 @@ _SI32_USART_B_read_ipdelay_bits(SI32_USART_B_Type* /*basePointer*/);
 ///  baudrate
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_write_baudrate(
+   SI32_USART_B_Type * basePointer,
+   uint32_t baudrate)
+{
+   //{{
+	basePointer->BAUDRATE.U32 = baudrate;
+   //}}
+}
+#else
 void
 _SI32_USART_B_write_baudrate(SI32_USART_B_Type* /*basePointer*/,
    uint32_t /*baudrate*/);
+#endif
 ///
 /// @def SI32_USART_B_write_baudrate(basePointer, baudrate)
 #define SI32_USART_B_write_baudrate(basePointer, baudrate) \
@@ -2223,8 +3916,19 @@ _SI32_USART_B_write_baudrate(SI32_USART_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USART_B_read_baudrate(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return basePointer->BAUDRATE.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_USART_B_read_baudrate(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_read_baudrate(basePointer)
 #define SI32_USART_B_read_baudrate(basePointer) \
@@ -2241,9 +3945,22 @@ _SI32_USART_B_read_baudrate(SI32_USART_B_Type* /*basePointer*/);
 ///  rxbaud
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_set_rx_baudrate(
+   SI32_USART_B_Type * basePointer,
+   uwide16_t rxbaud)
+{
+   assert(rxbaud < 65536);   // rxbaud < 2^16
+   //{{
+	basePointer->BAUDRATE.RBAUD = rxbaud;
+   //}}
+}
+#else
 void
 _SI32_USART_B_set_rx_baudrate(SI32_USART_B_Type* /*basePointer*/,
    uwide16_t /*rxbaud*/);
+#endif
 ///
 /// @def SI32_USART_B_set_rx_baudrate(basePointer, rxbaud)
 #define SI32_USART_B_set_rx_baudrate(basePointer, rxbaud) \
@@ -2260,9 +3977,22 @@ _SI32_USART_B_set_rx_baudrate(SI32_USART_B_Type* /*basePointer*/,
 ///  txbaud
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_set_tx_baudrate(
+   SI32_USART_B_Type * basePointer,
+   uwide16_t txbaud)
+{
+   assert(txbaud < 65536);   // txbaud < 2^16
+   //{{
+	basePointer->BAUDRATE.TBAUD = txbaud;
+   //}}
+}
+#else
 void
 _SI32_USART_B_set_tx_baudrate(SI32_USART_B_Type* /*basePointer*/,
    uwide16_t /*txbaud*/);
+#endif
 ///
 /// @def SI32_USART_B_set_tx_baudrate(basePointer, txbaud)
 #define SI32_USART_B_set_tx_baudrate(basePointer, txbaud) \
@@ -2282,9 +4012,21 @@ _SI32_USART_B_set_tx_baudrate(SI32_USART_B_Type* /*basePointer*/,
 ///  fifocn
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_write_fifocn(
+   SI32_USART_B_Type * basePointer,
+   uint32_t fifocn)
+{
+   //{{
+	basePointer->FIFOCN.U32 = fifocn;
+   //}}
+}
+#else
 void
 _SI32_USART_B_write_fifocn(SI32_USART_B_Type* /*basePointer*/,
    uint32_t /*fifocn*/);
+#endif
 ///
 /// @def SI32_USART_B_write_fifocn(basePointer, fifocn)
 #define SI32_USART_B_write_fifocn(basePointer, fifocn) \
@@ -2299,8 +4041,19 @@ _SI32_USART_B_write_fifocn(SI32_USART_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USART_B_read_fifocn(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return basePointer->FIFOCN.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_USART_B_read_fifocn(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_read_fifocn(basePointer)
 #define SI32_USART_B_read_fifocn(basePointer) \
@@ -2315,8 +4068,19 @@ _SI32_USART_B_read_fifocn(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USART_B_read_rx_fifo_count(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return (uint32_t)(basePointer->FIFOCN.RCNT);
+   //}}
+}
+#else
 uint32_t
 _SI32_USART_B_read_rx_fifo_count(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_read_rx_fifo_count(basePointer)
 #define SI32_USART_B_read_rx_fifo_count(basePointer) \
@@ -2328,8 +4092,19 @@ _SI32_USART_B_read_rx_fifo_count(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_select_rx_fifo_threshold_1(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FIFOCN_CLR = SI32_USART_B_FIFOCN_RFTH_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_select_rx_fifo_threshold_1(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_select_rx_fifo_threshold_1(basePointer)
 #define SI32_USART_B_select_rx_fifo_threshold_1(basePointer) \
@@ -2341,8 +4116,20 @@ _SI32_USART_B_select_rx_fifo_threshold_1(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_select_rx_fifo_threshold_2(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+   basePointer->FIFOCN_CLR = SI32_USART_B_FIFOCN_RFTH_MASK;
+   basePointer->FIFOCN_SET = SI32_USART_B_FIFOCN_RFTH_TWO_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_select_rx_fifo_threshold_2(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_select_rx_fifo_threshold_2(basePointer)
 #define SI32_USART_B_select_rx_fifo_threshold_2(basePointer) do{  \
@@ -2356,8 +4143,20 @@ _SI32_USART_B_select_rx_fifo_threshold_2(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_select_rx_fifo_threshold_4(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+   basePointer->FIFOCN_CLR = SI32_USART_B_FIFOCN_RFTH_MASK;
+   basePointer->FIFOCN_SET = SI32_USART_B_FIFOCN_RFTH_FOUR_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_select_rx_fifo_threshold_4(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_select_rx_fifo_threshold_4(basePointer)
 #define SI32_USART_B_select_rx_fifo_threshold_4(basePointer) do{  \
@@ -2371,8 +4170,19 @@ _SI32_USART_B_select_rx_fifo_threshold_4(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_rx_fifo_dma_request(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FIFOCN_SET = SI32_USART_B_FIFOCN_RDMAEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_rx_fifo_dma_request(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_rx_fifo_dma_request(basePointer)
 #define SI32_USART_B_enable_rx_fifo_dma_request(basePointer) \
@@ -2384,8 +4194,19 @@ _SI32_USART_B_enable_rx_fifo_dma_request(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_rx_fifo_dma_request(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FIFOCN_CLR = SI32_USART_B_FIFOCN_RDMAEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_rx_fifo_dma_request(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_rx_fifo_dma_request(basePointer)
 #define SI32_USART_B_disable_rx_fifo_dma_request(basePointer) \
@@ -2397,8 +4218,19 @@ _SI32_USART_B_disable_rx_fifo_dma_request(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_flush_rx_fifo(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FIFOCN_SET = SI32_USART_B_FIFOCN_RFIFOFL_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_flush_rx_fifo(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_flush_rx_fifo(basePointer)
 #define SI32_USART_B_flush_rx_fifo(basePointer) \
@@ -2410,8 +4242,19 @@ _SI32_USART_B_flush_rx_fifo(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_B_is_rx_fifo_error_interrupt_pending(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->FIFOCN.RFERI);
+   //}}
+}
+#else
 bool
 _SI32_USART_B_is_rx_fifo_error_interrupt_pending(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_is_rx_fifo_error_interrupt_pending(basePointer)
 #define SI32_USART_B_is_rx_fifo_error_interrupt_pending(basePointer) \
@@ -2423,8 +4266,19 @@ _SI32_USART_B_is_rx_fifo_error_interrupt_pending(SI32_USART_B_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_clear_rx_fifo_error_interrupt(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FIFOCN_CLR = SI32_USART_B_FIFOCN_RFERI_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_clear_rx_fifo_error_interrupt(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_clear_rx_fifo_error_interrupt(basePointer)
 #define SI32_USART_B_clear_rx_fifo_error_interrupt(basePointer) \
@@ -2436,8 +4290,19 @@ _SI32_USART_B_clear_rx_fifo_error_interrupt(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_B_is_rx_shift_register_full(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->FIFOCN.RSRFULLF);
+   //}}
+}
+#else
 bool
 _SI32_USART_B_is_rx_shift_register_full(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_is_rx_shift_register_full(basePointer)
 #define SI32_USART_B_is_rx_shift_register_full(basePointer) \
@@ -2449,8 +4314,19 @@ _SI32_USART_B_is_rx_shift_register_full(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USART_B_read_tx_fifo_count(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return (uint32_t)(basePointer->FIFOCN.TCNT);
+   //}}
+}
+#else
 uint32_t
 _SI32_USART_B_read_tx_fifo_count(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_read_tx_fifo_count(basePointer)
 #define SI32_USART_B_read_tx_fifo_count(basePointer) \
@@ -2462,8 +4338,19 @@ _SI32_USART_B_read_tx_fifo_count(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_select_tx_fifo_threshold_for_request_to_1(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FIFOCN_CLR = SI32_USART_B_FIFOCN_TFTH_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_select_tx_fifo_threshold_for_request_to_1(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_select_tx_fifo_threshold_for_request_to_1(basePointer)
 #define SI32_USART_B_select_tx_fifo_threshold_for_request_to_1(basePointer) \
@@ -2475,8 +4362,20 @@ _SI32_USART_B_select_tx_fifo_threshold_for_request_to_1(SI32_USART_B_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_select_tx_fifo_threshold_for_request_to_2(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FIFOCN_CLR = SI32_USART_B_FIFOCN_TFTH_MASK;
+   basePointer->FIFOCN_SET = SI32_USART_B_FIFOCN_TFTH_TWO_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_select_tx_fifo_threshold_for_request_to_2(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_select_tx_fifo_threshold_for_request_to_2(basePointer)
 #define SI32_USART_B_select_tx_fifo_threshold_for_request_to_2(basePointer) do{  \
@@ -2490,8 +4389,20 @@ _SI32_USART_B_select_tx_fifo_threshold_for_request_to_2(SI32_USART_B_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_select_tx_fifo_threshold_for_request_to_4(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FIFOCN_CLR = SI32_USART_B_FIFOCN_TFTH_MASK;
+   basePointer->FIFOCN_SET = SI32_USART_B_FIFOCN_TFTH_FOUR_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_select_tx_fifo_threshold_for_request_to_4(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_select_tx_fifo_threshold_for_request_to_4(basePointer)
 #define SI32_USART_B_select_tx_fifo_threshold_for_request_to_4(basePointer) do{  \
@@ -2505,8 +4416,19 @@ _SI32_USART_B_select_tx_fifo_threshold_for_request_to_4(SI32_USART_B_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_enable_tx_fifo_dma_request(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FIFOCN_SET = SI32_USART_B_FIFOCN_TDMAEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_enable_tx_fifo_dma_request(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_enable_tx_fifo_dma_request(basePointer)
 #define SI32_USART_B_enable_tx_fifo_dma_request(basePointer) \
@@ -2518,8 +4440,19 @@ _SI32_USART_B_enable_tx_fifo_dma_request(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_disable_tx_fifo_dma_request(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FIFOCN_CLR = SI32_USART_B_FIFOCN_TDMAEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_disable_tx_fifo_dma_request(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_disable_tx_fifo_dma_request(basePointer)
 #define SI32_USART_B_disable_tx_fifo_dma_request(basePointer) \
@@ -2531,8 +4464,19 @@ _SI32_USART_B_disable_tx_fifo_dma_request(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_flush_tx_fifo(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FIFOCN_SET = SI32_USART_B_FIFOCN_TFIFOFL_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_USART_B_flush_tx_fifo(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_flush_tx_fifo(basePointer)
 #define SI32_USART_B_flush_tx_fifo(basePointer) \
@@ -2544,8 +4488,19 @@ _SI32_USART_B_flush_tx_fifo(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_B_is_tx_fifo_error_interrupt_pending(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->FIFOCN.TFERI);
+   //}}
+}
+#else
 bool
 _SI32_USART_B_is_tx_fifo_error_interrupt_pending(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_is_tx_fifo_error_interrupt_pending(basePointer)
 #define SI32_USART_B_is_tx_fifo_error_interrupt_pending(basePointer) \
@@ -2557,8 +4512,19 @@ _SI32_USART_B_is_tx_fifo_error_interrupt_pending(SI32_USART_B_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_clear_tx_fifo_error_interrupt(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	basePointer->FIFOCN_CLR = SI32_USART_B_FIFOCN_TFERI_MASK;
+   //}}
+}
+#else
 void
 _SI32_USART_B_clear_tx_fifo_error_interrupt(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_clear_tx_fifo_error_interrupt(basePointer)
 #define SI32_USART_B_clear_tx_fifo_error_interrupt(basePointer) \
@@ -2570,8 +4536,19 @@ _SI32_USART_B_clear_tx_fifo_error_interrupt(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USART_B_is_tx_shift_register_full(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->FIFOCN.TSRFULLF);
+   //}}
+}
+#else
 bool
 _SI32_USART_B_is_tx_shift_register_full(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_is_tx_shift_register_full(basePointer)
 #define SI32_USART_B_is_tx_shift_register_full(basePointer) \
@@ -2583,8 +4560,19 @@ _SI32_USART_B_is_tx_shift_register_full(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USART_B_read_data_u32(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return (uint32_t)(basePointer->DATA.U32);
+   //}}
+}
+#else
 uint32_t
 _SI32_USART_B_read_data_u32(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_read_data_u32(basePointer)
 #define SI32_USART_B_read_data_u32(basePointer) \
@@ -2596,8 +4584,19 @@ _SI32_USART_B_read_data_u32(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint16_t
+_SI32_USART_B_read_data_u16(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return basePointer->DATA.U16;
+   //}}
+}
+#else
 uint16_t
 _SI32_USART_B_read_data_u16(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_read_data_u16(basePointer)
 #define SI32_USART_B_read_data_u16(basePointer) \
@@ -2609,8 +4608,19 @@ _SI32_USART_B_read_data_u16(SI32_USART_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint8_t
+_SI32_USART_B_read_data_u8(
+   SI32_USART_B_Type * basePointer)
+{
+   //{{
+	return basePointer->DATA.U8;
+   //}}
+}
+#else
 uint8_t
 _SI32_USART_B_read_data_u8(SI32_USART_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USART_B_read_data_u8(basePointer)
 #define SI32_USART_B_read_data_u8(basePointer) \
@@ -2627,9 +4637,21 @@ _SI32_USART_B_read_data_u8(SI32_USART_B_Type* /*basePointer*/);
 ///  dataval
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_write_data_u32(
+   SI32_USART_B_Type * basePointer,
+   uint32_t dataval)
+{
+   //{{
+	basePointer->DATA.U32 = dataval;
+   //}}
+}
+#else
 void
 _SI32_USART_B_write_data_u32(SI32_USART_B_Type* /*basePointer*/,
    uint32_t /*dataval*/);
+#endif
 ///
 /// @def SI32_USART_B_write_data_u32(basePointer, dataval)
 #define SI32_USART_B_write_data_u32(basePointer, dataval) \
@@ -2646,9 +4668,22 @@ _SI32_USART_B_write_data_u32(SI32_USART_B_Type* /*basePointer*/,
 ///  dataval
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_write_data_u16(
+   SI32_USART_B_Type * basePointer,
+   uwide16_t dataval)
+{
+   assert(dataval < 65536);   // dataval < 2^16
+   //{{
+	basePointer->DATA.U16 = dataval;
+   //}}
+}
+#else
 void
 _SI32_USART_B_write_data_u16(SI32_USART_B_Type* /*basePointer*/,
    uwide16_t /*dataval*/);
+#endif
 ///
 /// @def SI32_USART_B_write_data_u16(basePointer, dataval)
 #define SI32_USART_B_write_data_u16(basePointer, dataval) \
@@ -2665,9 +4700,22 @@ _SI32_USART_B_write_data_u16(SI32_USART_B_Type* /*basePointer*/,
 ///  dataval
 ///  Valid range is 8 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USART_B_write_data_u8(
+   SI32_USART_B_Type * basePointer,
+   uwide8_t dataval)
+{
+   assert(dataval < 256);   // dataval < 2^8
+   //{{
+   basePointer->DATA.U8 = dataval;
+   //}}
+}
+#else
 void
 _SI32_USART_B_write_data_u8(SI32_USART_B_Type* /*basePointer*/,
    uwide8_t /*dataval*/);
+#endif
 ///
 /// @def SI32_USART_B_write_data_u8(basePointer, dataval)
 #define SI32_USART_B_write_data_u8(basePointer, dataval) \
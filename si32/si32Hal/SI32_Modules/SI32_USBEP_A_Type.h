@@ -73,10 +73,26 @@ extern "C" {
 ///  Valid range is 32 bits.
 ///  Write to EPCONTROL register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_initialize(
+   SI32_USBEP_A_Type * basePointer,
+   // Write to EPMPSIZE register.
+   uint32_t epmpsize,
+   // Write to EPCONTROL register.
+   uint32_t epcontrol)
+{
+   //{{
+   basePointer->EPMPSIZE.U32 = epmpsize;
+   basePointer->EPCONTROL.U32 = epcontrol;
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_initialize(SI32_USBEP_A_Type* /*basePointer*/,
    uint32_t, /*epmpsize*/
    uint32_t /*epcontrol*/);
+#endif
 ///
 /// @def SI32_USBEP_A_initialize(basePointer, epmpsize, epcontrol)
 #define SI32_USBEP_A_initialize(basePointer, epmpsize, epcontrol) do{  \
@@ -98,9 +114,21 @@ _SI32_USBEP_A_initialize(SI32_USBEP_A_Type* /*basePointer*/,
 ///  epmpsize
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_write_epmpsize(
+   SI32_USBEP_A_Type * basePointer,
+   uint32_t epmpsize)
+{
+   //{{
+   basePointer->EPMPSIZE.U32 = epmpsize;
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_write_epmpsize(SI32_USBEP_A_Type* /*basePointer*/,
    uint32_t /*epmpsize*/);
+#endif
 ///
 /// @def SI32_USBEP_A_write_epmpsize(basePointer, epmpsize)
 #define SI32_USBEP_A_write_epmpsize(basePointer, epmpsize) \
@@ -115,8 +143,19 @@ _SI32_USBEP_A_write_epmpsize(SI32_USBEP_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USBEP_A_read_epmpsize(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   return basePointer->EPMPSIZE.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_USBEP_A_read_epmpsize(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_read_epmpsize(basePointer)
 #define SI32_USBEP_A_read_epmpsize(basePointer) \
@@ -135,9 +174,24 @@ _SI32_USBEP_A_read_epmpsize(SI32_USBEP_A_Type* /*basePointer*/);
 ///  Sets size in increments of 8, and a value of 128 is interpreted as
 ///  1023 bytes.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_set_in_max_packet_size(
+   SI32_USBEP_A_Type * basePointer,
+   // Sets size in increments of 8, and a value of 128 is interpreted as
+   // 1023 bytes.
+   uint32_t size)
+{
+   assert(size < 256);   // size < 2^8
+   //{{
+   basePointer->EPMPSIZE.IMAXP = size;
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_set_in_max_packet_size(SI32_USBEP_A_Type* /*basePointer*/,
    uint32_t /*size*/);
+#endif
 ///
 /// @def SI32_USBEP_A_set_in_max_packet_size(basePointer, size)
 #define SI32_USBEP_A_set_in_max_packet_size(basePointer, size) \
@@ -153,8 +207,19 @@ _SI32_USBEP_A_set_in_max_packet_size(SI32_USBEP_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USBEP_A_get_in_max_packet_size(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   return (uint32_t) (basePointer->EPMPSIZE.IMAXP);
+   //}}
+}
+#else
 uint32_t
 _SI32_USBEP_A_get_in_max_packet_size(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_get_in_max_packet_size(basePointer)
 #define SI32_USBEP_A_get_in_max_packet_size(basePointer) \
@@ -173,9 +238,24 @@ _SI32_USBEP_A_get_in_max_packet_size(SI32_USBEP_A_Type* /*basePointer*/);
 ///  Sets size in increments of 8, and a value of 128 is interpreted as
 ///  1023 bytes.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_set_out_max_packet_size(
+   SI32_USBEP_A_Type * basePointer,
+   // Sets size in increments of 8, and a value of 128 is interpreted as
+   // 1023 bytes.
+   uint32_t size)
+{
+   assert(size < 256);   // size < 2^8
+   //{{
+   basePointer->EPMPSIZE.OMAXP = size;
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_set_out_max_packet_size(SI32_USBEP_A_Type* /*basePointer*/,
    uint32_t /*size*/);
+#endif
 ///
 /// @def SI32_USBEP_A_set_out_max_packet_size(basePointer, size)
 #define SI32_USBEP_A_set_out_max_packet_size(basePointer, size) \
@@ -191,8 +271,19 @@ _SI32_USBEP_A_set_out_max_packet_size(SI32_USBEP_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USBEP_A_get_out_max_packet_size(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   return (uint32_t) (basePointer->EPMPSIZE.OMAXP);
+   //}}
+}
+#else
 uint32_t
 _SI32_USBEP_A_get_out_max_packet_size(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_get_out_max_packet_size(basePointer)
 #define SI32_USBEP_A_get_out_max_packet_size(basePointer) \
@@ -212,9 +303,21 @@ _SI32_USBEP_A_get_out_max_packet_size(SI32_USBEP_A_Type* /*basePointer*/);
 ///  epcontrol
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_write_epcontrol(
+   SI32_USBEP_A_Type * basePointer,
+   uint32_t epcontrol)
+{
+   //{{
+   basePointer->EPCONTROL.U32 = epcontrol;
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_write_epcontrol(SI32_USBEP_A_Type* /*basePointer*/,
    uint32_t /*epcontrol*/);
+#endif
 ///
 /// @def SI32_USBEP_A_write_epcontrol(basePointer, epcontrol)
 #define SI32_USBEP_A_write_epcontrol(basePointer, epcontrol) \
@@ -229,8 +332,19 @@ _SI32_USBEP_A_write_epcontrol(SI32_USBEP_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USBEP_A_read_epcontrol(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   return basePointer->EPCONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_USBEP_A_read_epcontrol(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_read_epcontrol(basePointer)
 #define SI32_USBEP_A_read_epcontrol(basePointer) \
@@ -242,8 +356,19 @@ _SI32_USBEP_A_read_epcontrol(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_set_in_packet_ready(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   basePointer->EPCONTROL.U32 = USBEP_EPCONTROL_WRITE(basePointer, SI32_USBEP_A_EPCONTROL_IPRDYI_SET_U32);                                
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_set_in_packet_ready(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_set_in_packet_ready(basePointer)
 #define SI32_USBEP_A_set_in_packet_ready(basePointer) \
@@ -258,8 +383,19 @@ _SI32_USBEP_A_set_in_packet_ready(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USBEP_A_is_in_fifo_empty(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   return (bool) !(basePointer->EPCONTROL.IFIFONEF);
+   //}}
+}
+#else
 bool
 _SI32_USBEP_A_is_in_fifo_empty(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_is_in_fifo_empty(basePointer)
 #define SI32_USBEP_A_is_in_fifo_empty(basePointer) \
@@ -271,8 +407,19 @@ _SI32_USBEP_A_is_in_fifo_empty(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_clear_in_data_underrun(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   basePointer->EPCONTROL.U32  = USBEP_EPCONTROL_CLEAR_MASK( basePointer, SI32_USBEP_A_EPCONTROL_IURF_MASK);
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_clear_in_data_underrun(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_clear_in_data_underrun(basePointer)
 #define SI32_USBEP_A_clear_in_data_underrun(basePointer) \
@@ -289,8 +436,19 @@ _SI32_USBEP_A_clear_in_data_underrun(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USBEP_A_is_in_data_underrun_set(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->EPCONTROL.IURF);
+   //}}
+}
+#else
 bool
 _SI32_USBEP_A_is_in_data_underrun_set(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_is_in_data_underrun_set(basePointer)
 #define SI32_USBEP_A_is_in_data_underrun_set(basePointer) \
@@ -302,8 +460,19 @@ _SI32_USBEP_A_is_in_data_underrun_set(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_flush_in_fifo(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   basePointer->EPCONTROL.U32 = USBEP_EPCONTROL_WRITE(basePointer, SI32_USBEP_A_EPCONTROL_IFIFOFL_SET_U32);
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_flush_in_fifo(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_flush_in_fifo(basePointer)
 #define SI32_USBEP_A_flush_in_fifo(basePointer) \
@@ -314,8 +483,19 @@ _SI32_USBEP_A_flush_in_fifo(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_send_in_stall(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   basePointer->EPCONTROL.U32 = USBEP_EPCONTROL_WRITE(basePointer, SI32_USBEP_A_EPCONTROL_ISDSTL_SET_U32);
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_send_in_stall(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_send_in_stall(basePointer)
 #define SI32_USBEP_A_send_in_stall(basePointer) \
@@ -327,8 +507,19 @@ _SI32_USBEP_A_send_in_stall(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_stop_in_stall(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   basePointer->EPCONTROL.U32 = USBEP_EPCONTROL_WRITE(basePointer, SI32_USBEP_A_EPCONTROL_ISDSTL_NOT_SET_U32);
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_stop_in_stall(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_stop_in_stall(basePointer)
 #define SI32_USBEP_A_stop_in_stall(basePointer) \
@@ -343,8 +534,19 @@ _SI32_USBEP_A_stop_in_stall(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USBEP_A_is_in_stall_sent(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   return (bool) (basePointer->EPCONTROL.ISTSTLI);
+   //}}
+}
+#else
 bool
 _SI32_USBEP_A_is_in_stall_sent(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_is_in_stall_sent(basePointer)
 #define SI32_USBEP_A_is_in_stall_sent(basePointer) \
@@ -356,8 +558,19 @@ _SI32_USBEP_A_is_in_stall_sent(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_clear_in_stall_sent(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   basePointer->EPCONTROL.U32 = USBEP_EPCONTROL_WRITE(basePointer, SI32_USBEP_A_EPCONTROL_ISTSTLI_NOT_SET_U32);
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_clear_in_stall_sent(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_clear_in_stall_sent(basePointer)
 #define SI32_USBEP_A_clear_in_stall_sent(basePointer) \
@@ -369,8 +582,19 @@ _SI32_USBEP_A_clear_in_stall_sent(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_reset_in_data_toggle(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+  basePointer->EPCONTROL.U32 = USBEP_EPCONTROL_WRITE(basePointer, SI32_USBEP_A_EPCONTROL_ICLRDT_RESET_U32);
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_reset_in_data_toggle(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_reset_in_data_toggle(basePointer)
 #define SI32_USBEP_A_reset_in_data_toggle(basePointer) \
@@ -382,8 +606,19 @@ _SI32_USBEP_A_reset_in_data_toggle(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_enable_split_mode(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   basePointer->EPCONTROL.U32 = USBEP_EPCONTROL_WRITE(basePointer, SI32_USBEP_A_EPCONTROL_SPLITEN_ENABLED_U32);
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_enable_split_mode(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_enable_split_mode(basePointer)
 #define SI32_USBEP_A_enable_split_mode(basePointer) \
@@ -395,8 +630,19 @@ _SI32_USBEP_A_enable_split_mode(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_disable_split_mode(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   basePointer->EPCONTROL.U32 = USBEP_EPCONTROL_WRITE(basePointer, SI32_USBEP_A_EPCONTROL_SPLITEN_DISABLED_U32);
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_disable_split_mode(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_disable_split_mode(basePointer)
 #define SI32_USBEP_A_disable_split_mode(basePointer) \
@@ -407,8 +653,19 @@ _SI32_USBEP_A_disable_split_mode(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_select_data_toggle_on_ack(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{ 
+   basePointer->EPCONTROL.FDTEN = USBEP_EPCONTROL_WRITE(basePointer, SI32_USBEP_A_EPCONTROL_FDTEN_DISABLED_U32);
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_select_data_toggle_on_ack(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_select_data_toggle_on_ack(basePointer)
 #define SI32_USBEP_A_select_data_toggle_on_ack(basePointer) \
@@ -420,8 +677,19 @@ _SI32_USBEP_A_select_data_toggle_on_ack(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_select_data_toggle_on_packet(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   basePointer->EPCONTROL.U32 = USBEP_EPCONTROL_WRITE(basePointer, SI32_USBEP_A_EPCONTROL_FDTEN_ENABLED_U32);
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_select_data_toggle_on_packet(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_select_data_toggle_on_packet(basePointer)
 #define SI32_USBEP_A_select_data_toggle_on_packet(basePointer) \
@@ -433,8 +701,19 @@ _SI32_USBEP_A_select_data_toggle_on_packet(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_enable_in_dma(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   basePointer->EPCONTROL.U32 = USBEP_EPCONTROL_WRITE(basePointer, SI32_USBEP_A_EPCONTROL_IDMAEN_ENABLED_U32);
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_enable_in_dma(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_enable_in_dma(basePointer)
 #define SI32_USBEP_A_enable_in_dma(basePointer) \
@@ -446,8 +725,19 @@ _SI32_USBEP_A_enable_in_dma(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_disable_in_dma(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   basePointer->EPCONTROL.U32 = USBEP_EPCONTROL_WRITE(basePointer, SI32_USBEP_A_EPCONTROL_IDMAEN_DISABLED_U32);
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_disable_in_dma(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_disable_in_dma(basePointer)
 #define SI32_USBEP_A_disable_in_dma(basePointer) \
@@ -462,8 +752,19 @@ _SI32_USBEP_A_disable_in_dma(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_set_endpoint_direction_in(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   basePointer->EPCONTROL.U32 = USBEP_EPCONTROL_WRITE(basePointer, SI32_USBEP_A_EPCONTROL_DIRSEL_IN_U32);
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_set_endpoint_direction_in(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_set_endpoint_direction_in(basePointer)
 #define SI32_USBEP_A_set_endpoint_direction_in(basePointer) \
@@ -478,8 +779,19 @@ _SI32_USBEP_A_set_endpoint_direction_in(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_set_endpoint_direction_out(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   basePointer->EPCONTROL.U32 = USBEP_EPCONTROL_WRITE(basePointer, SI32_USBEP_A_EPCONTROL_DIRSEL_OUT_U32);
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_set_endpoint_direction_out(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_set_endpoint_direction_out(basePointer)
 #define SI32_USBEP_A_set_endpoint_direction_out(basePointer) \
@@ -491,8 +803,19 @@ _SI32_USBEP_A_set_endpoint_direction_out(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_select_in_bulk_interrupt_mode(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   basePointer->EPCONTROL.U32 = USBEP_EPCONTROL_WRITE(basePointer, SI32_USBEP_A_EPCONTROL_IISOEN_BULK_INT_U32);
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_select_in_bulk_interrupt_mode(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_select_in_bulk_interrupt_mode(basePointer)
 #define SI32_USBEP_A_select_in_bulk_interrupt_mode(basePointer) \
@@ -504,8 +827,19 @@ _SI32_USBEP_A_select_in_bulk_interrupt_mode(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_select_in_isochronous_mode(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   basePointer->EPCONTROL.U32 = USBEP_EPCONTROL_WRITE(basePointer, SI32_USBEP_A_EPCONTROL_IISOEN_ISO_U32);
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_select_in_isochronous_mode(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_select_in_isochronous_mode(basePointer)
 #define SI32_USBEP_A_select_in_isochronous_mode(basePointer) \
@@ -521,8 +855,19 @@ _SI32_USBEP_A_select_in_isochronous_mode(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_enable_inprdy_auto_set(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   basePointer->EPCONTROL.U32 = USBEP_EPCONTROL_WRITE(basePointer, SI32_USBEP_A_EPCONTROL_AUTOSETEN_ENABLED_U32);
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_enable_inprdy_auto_set(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_enable_inprdy_auto_set(basePointer)
 #define SI32_USBEP_A_enable_inprdy_auto_set(basePointer) \
@@ -538,8 +883,19 @@ _SI32_USBEP_A_enable_inprdy_auto_set(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_disable_inprdy_auto_set(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+  basePointer->EPCONTROL.U32 = USBEP_EPCONTROL_WRITE(basePointer, SI32_USBEP_A_EPCONTROL_AUTOSETEN_DISABLED_U32);
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_disable_inprdy_auto_set(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_disable_inprdy_auto_set(basePointer)
 #define SI32_USBEP_A_disable_inprdy_auto_set(basePointer) \
@@ -551,8 +907,19 @@ _SI32_USBEP_A_disable_inprdy_auto_set(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_clear_outpacket_ready(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   basePointer->EPCONTROL.U32 = USBEP_EPCONTROL_CLEAR_MASK( basePointer, SI32_USBEP_A_EPCONTROL_OPRDYI_MASK);  
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_clear_outpacket_ready(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_clear_outpacket_ready(basePointer)
 #define SI32_USBEP_A_clear_outpacket_ready(basePointer) \
@@ -567,8 +934,19 @@ _SI32_USBEP_A_clear_outpacket_ready(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USBEP_A_is_outpacket_ready(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->EPCONTROL.OPRDYI);
+   //}}
+}
+#else
 bool
 _SI32_USBEP_A_is_outpacket_ready(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_is_outpacket_ready(basePointer)
 #define SI32_USBEP_A_is_outpacket_ready(basePointer) \
@@ -584,8 +962,19 @@ _SI32_USBEP_A_is_outpacket_ready(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USBEP_A_is_out_fifo_full(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->EPCONTROL.OFIFOFF);
+   //}}
+}
+#else
 bool
 _SI32_USBEP_A_is_out_fifo_full(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_is_out_fifo_full(basePointer)
 #define SI32_USBEP_A_is_out_fifo_full(basePointer) \
@@ -597,8 +986,19 @@ _SI32_USBEP_A_is_out_fifo_full(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_clear_out_data_overrun(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   basePointer->EPCONTROL.U32 = USBEP_EPCONTROL_CLEAR_MASK( basePointer, SI32_USBEP_A_EPCONTROL_OORF_MASK);
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_clear_out_data_overrun(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_clear_out_data_overrun(basePointer)
 #define SI32_USBEP_A_clear_out_data_overrun(basePointer) \
@@ -614,8 +1014,19 @@ _SI32_USBEP_A_clear_out_data_overrun(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USBEP_A_has_out_data_overrun_occurred(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   return (bool) (basePointer->EPCONTROL.OORF);
+   //}}
+}
+#else
 bool
 _SI32_USBEP_A_has_out_data_overrun_occurred(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_has_out_data_overrun_occurred(basePointer)
 #define SI32_USBEP_A_has_out_data_overrun_occurred(basePointer) \
@@ -631,8 +1042,19 @@ _SI32_USBEP_A_has_out_data_overrun_occurred(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USBEP_A_has_out_data_error_set_occurred(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   return (bool) (basePointer->EPCONTROL.ODERRF);
+   //}}
+}
+#else
 bool
 _SI32_USBEP_A_has_out_data_error_set_occurred(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_has_out_data_error_set_occurred(basePointer)
 #define SI32_USBEP_A_has_out_data_error_set_occurred(basePointer) \
@@ -644,8 +1066,19 @@ _SI32_USBEP_A_has_out_data_error_set_occurred(SI32_USBEP_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_flush_out_fifo(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   basePointer->EPCONTROL.U32 = USBEP_EPCONTROL_WRITE(basePointer, SI32_USBEP_A_EPCONTROL_OFIFOFL_SET_U32);
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_flush_out_fifo(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_flush_out_fifo(basePointer)
 #define SI32_USBEP_A_flush_out_fifo(basePointer) \
@@ -657,8 +1090,19 @@ _SI32_USBEP_A_flush_out_fifo(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_send_out_stall(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   basePointer->EPCONTROL.U32 = USBEP_EPCONTROL_WRITE(basePointer, SI32_USBEP_A_EPCONTROL_OSDSTL_SEND_U32);
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_send_out_stall(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_send_out_stall(basePointer)
 #define SI32_USBEP_A_send_out_stall(basePointer) \
@@ -670,8 +1114,19 @@ _SI32_USBEP_A_send_out_stall(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_stop_out_stall(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   basePointer->EPCONTROL.U32 = USBEP_EPCONTROL_WRITE(basePointer, SI32_USBEP_A_EPCONTROL_OSDSTL_STOP_U32);
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_stop_out_stall(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_stop_out_stall(basePointer)
 #define SI32_USBEP_A_stop_out_stall(basePointer) \
@@ -686,8 +1141,19 @@ _SI32_USBEP_A_stop_out_stall(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USBEP_A_is_out_stall_sent(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   return (bool) (basePointer->EPCONTROL.OSTSTLI);
+   //}}
+}
+#else
 bool
 _SI32_USBEP_A_is_out_stall_sent(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_is_out_stall_sent(basePointer)
 #define SI32_USBEP_A_is_out_stall_sent(basePointer) \
@@ -699,8 +1165,19 @@ _SI32_USBEP_A_is_out_stall_sent(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_clear_out_stall_sent(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   basePointer->EPCONTROL.U32 = USBEP_EPCONTROL_CLEAR_MASK( basePointer, SI32_USBEP_A_EPCONTROL_OSTSTLI_MASK);
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_clear_out_stall_sent(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_clear_out_stall_sent(basePointer)
 #define SI32_USBEP_A_clear_out_stall_sent(basePointer) \
@@ -712,8 +1189,19 @@ _SI32_USBEP_A_clear_out_stall_sent(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_reset_out_data_toggle(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   basePointer->EPCONTROL.U32 = USBEP_EPCONTROL_WRITE(basePointer, SI32_USBEP_A_EPCONTROL_OCLRDT_RESET_U32);
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_reset_out_data_toggle(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_reset_out_data_toggle(basePointer)
 #define SI32_USBEP_A_reset_out_data_toggle(basePointer) \
@@ -725,8 +1213,19 @@ _SI32_USBEP_A_reset_out_data_toggle(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_enable_out_dma_for_last_packet(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+  basePointer->EPCONTROL.U32 = USBEP_EPCONTROL_WRITE(basePointer, SI32_USBEP_A_EPCONTROL_ODMAMD_NO_DMA_U32);
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_enable_out_dma_for_last_packet(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_enable_out_dma_for_last_packet(basePointer)
 #define SI32_USBEP_A_enable_out_dma_for_last_packet(basePointer) \
@@ -738,8 +1237,19 @@ _SI32_USBEP_A_enable_out_dma_for_last_packet(SI32_USBEP_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_disable_out_dma_for_last_packet(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+  basePointer->EPCONTROL.U32 = USBEP_EPCONTROL_WRITE(basePointer, SI32_USBEP_A_EPCONTROL_ODMAMD_AUTO_DMA_U32);
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_disable_out_dma_for_last_packet(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_disable_out_dma_for_last_packet(basePointer)
 #define SI32_USBEP_A_disable_out_dma_for_last_packet(basePointer) \
@@ -751,8 +1261,19 @@ _SI32_USBEP_A_disable_out_dma_for_last_packet(SI32_USBEP_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_enable_out_dma(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+  basePointer->EPCONTROL.U32 = USBEP_EPCONTROL_WRITE(basePointer, SI32_USBEP_A_EPCONTROL_ODMAEN_ENABLED_U32);
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_enable_out_dma(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_enable_out_dma(basePointer)
 #define SI32_USBEP_A_enable_out_dma(basePointer) \
@@ -764,8 +1285,19 @@ _SI32_USBEP_A_enable_out_dma(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_disable_out_dma(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+  basePointer->EPCONTROL.U32 = USBEP_EPCONTROL_WRITE(basePointer, SI32_USBEP_A_EPCONTROL_ODMAEN_DISABLED_U32);
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_disable_out_dma(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_disable_out_dma(basePointer)
 #define SI32_USBEP_A_disable_out_dma(basePointer) \
@@ -777,8 +1309,19 @@ _SI32_USBEP_A_disable_out_dma(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_enable_out_bulk_interrupt_mode(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   basePointer->EPCONTROL.U32 = USBEP_EPCONTROL_WRITE(basePointer, SI32_USBEP_A_EPCONTROL_OISOEN_BULK_INT_U32);
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_enable_out_bulk_interrupt_mode(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_enable_out_bulk_interrupt_mode(basePointer)
 #define SI32_USBEP_A_enable_out_bulk_interrupt_mode(basePointer) \
@@ -790,8 +1333,19 @@ _SI32_USBEP_A_enable_out_bulk_interrupt_mode(SI32_USBEP_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_enable_out_isochronous_mode(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   basePointer->EPCONTROL.U32 = USBEP_EPCONTROL_WRITE(basePointer, SI32_USBEP_A_EPCONTROL_OISOEN_ISO_U32);
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_enable_out_isochronous_mode(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_enable_out_isochronous_mode(basePointer)
 #define SI32_USBEP_A_enable_out_isochronous_mode(basePointer) \
@@ -803,8 +1357,19 @@ _SI32_USBEP_A_enable_out_isochronous_mode(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_enable_oprdy_auto_clear(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   basePointer->EPCONTROL.U32 = USBEP_EPCONTROL_WRITE(basePointer, SI32_USBEP_A_EPCONTROL_AUTOCLREN_ENABLED_U32);
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_enable_oprdy_auto_clear(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_enable_oprdy_auto_clear(basePointer)
 #define SI32_USBEP_A_enable_oprdy_auto_clear(basePointer) \
@@ -816,8 +1381,19 @@ _SI32_USBEP_A_enable_oprdy_auto_clear(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_disable_oprdy_auto_clear(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   basePointer->EPCONTROL.U32 = USBEP_EPCONTROL_WRITE(basePointer, SI32_USBEP_A_EPCONTROL_AUTOCLREN_DISABLED_U32);
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_disable_oprdy_auto_clear(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_disable_oprdy_auto_clear(basePointer)
 #define SI32_USBEP_A_disable_oprdy_auto_clear(basePointer) \
@@ -833,8 +1409,19 @@ _SI32_USBEP_A_disable_oprdy_auto_clear(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USBEP_A_read_data_count(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   return basePointer->EPCOUNT.COUNT;
+   //}}
+}
+#else
 uint32_t
 _SI32_USBEP_A_read_data_count(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_read_data_count(basePointer)
 #define SI32_USBEP_A_read_data_count(basePointer) \
@@ -854,9 +1441,21 @@ _SI32_USBEP_A_read_data_count(SI32_USBEP_A_Type* /*basePointer*/);
 ///  dataval
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_write_fifo_u32(
+   SI32_USBEP_A_Type * basePointer,
+   uint32_t dataval)
+{
+   //{{
+   basePointer->EPFIFO.U32 = dataval;
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_write_fifo_u32(SI32_USBEP_A_Type* /*basePointer*/,
    uint32_t /*dataval*/);
+#endif
 ///
 /// @def SI32_USBEP_A_write_fifo_u32(basePointer, dataval)
 #define SI32_USBEP_A_write_fifo_u32(basePointer, dataval) \
@@ -876,9 +1475,21 @@ _SI32_USBEP_A_write_fifo_u32(SI32_USBEP_A_Type* /*basePointer*/,
 ///  dataval
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_write_fifo_u16(
+   SI32_USBEP_A_Type * basePointer,
+   uint32_t dataval)
+{
+   //{{
+   basePointer->EPFIFO.U16 = dataval;
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_write_fifo_u16(SI32_USBEP_A_Type* /*basePointer*/,
    uint32_t /*dataval*/);
+#endif
 ///
 /// @def SI32_USBEP_A_write_fifo_u16(basePointer, dataval)
 #define SI32_USBEP_A_write_fifo_u16(basePointer, dataval) \
@@ -898,9 +1509,21 @@ _SI32_USBEP_A_write_fifo_u16(SI32_USBEP_A_Type* /*basePointer*/,
 ///  dataval
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USBEP_A_write_fifo_u8(
+   SI32_USBEP_A_Type * basePointer,
+   uint32_t dataval)
+{
+   //{{
+   basePointer->EPFIFO.U8 = dataval;
+   //}}
+}
+#else
 void
 _SI32_USBEP_A_write_fifo_u8(SI32_USBEP_A_Type* /*basePointer*/,
    uint32_t /*dataval*/);
+#endif
 ///
 /// @def SI32_USBEP_A_write_fifo_u8(basePointer, dataval)
 #define SI32_USBEP_A_write_fifo_u8(basePointer, dataval) \
@@ -915,8 +1538,19 @@ _SI32_USBEP_A_write_fifo_u8(SI32_USBEP_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USBEP_A_read_fifo_u32(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   return basePointer->EPFIFO.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_USBEP_A_read_fifo_u32(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_read_fifo_u32(basePointer)
 #define SI32_USBEP_A_read_fifo_u32(basePointer) \
@@ -931,8 +1565,19 @@ _SI32_USBEP_A_read_fifo_u32(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USBEP_A_read_fifo_u16(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   return basePointer->EPFIFO.U16;
+   //}}
+}
+#else
 uint32_t
 _SI32_USBEP_A_read_fifo_u16(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_read_fifo_u16(basePointer)
 #define SI32_USBEP_A_read_fifo_u16(basePointer) \
@@ -947,8 +1592,19 @@ _SI32_USBEP_A_read_fifo_u16(SI32_USBEP_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USBEP_A_read_fifo_u8(
+   SI32_USBEP_A_Type * basePointer)
+{
+   //{{
+   return basePointer->EPFIFO.U8;
+   //}}
+}
+#else
 uint32_t
 _SI32_USBEP_A_read_fifo_u8(SI32_USBEP_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USBEP_A_read_fifo_u8(basePointer)
 #define SI32_USBEP_A_read_fifo_u8(basePointer) \
@@ -117,6 +117,51 @@ extern "C" {
 ///  Valid range is 32 bits.
 ///  Write to EP0CONTROL register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_initialize(
+   SI32_USB_A_Type * basePointer,
+   // Write to FADDR register.
+   uint32_t faddr,
+   // Write to POWER register.
+   uint32_t power,
+   // Write to IOINT register.
+   uint32_t ioint,
+   // Write to CMINT register.
+   uint32_t cmint,
+   // Write to IOINTE register.
+   uint32_t iointe,
+   // Write to CMINTEPE register.
+   uint32_t cmintepe,
+   // Write to CRCONTROL register.
+   uint32_t crcontrol,
+   // Write to TCONTROL register.
+   uint32_t tcontrol,
+   // Write to CLKSEL register.
+   uint32_t clksel,
+   // Write to OSCCONTROL register.
+   uint32_t osccontrol,
+   // Write to DMACONTROL register.
+   uint32_t dmacontrol,
+   // Write to EP0CONTROL register.
+   uint32_t ep0control)
+{
+   //{{
+   basePointer->FADDR.U32 = faddr;
+   basePointer->POWER.U32 = power;
+   basePointer->IOINT.U32 = ioint;
+   basePointer->CMINT.U32 = cmint;
+   basePointer->IOINTE.U32 = iointe;
+   basePointer->CMINTEPE.U32 = cmintepe;
+   basePointer->CRCONTROL.U32 = crcontrol;
+   basePointer->TCONTROL.U32 = tcontrol;
+   basePointer->CLKSEL.U32 = clksel;
+   basePointer->OSCCONTROL.U32 = osccontrol;
+   basePointer->DMACONTROL.U32 = dmacontrol;
+   basePointer->EP0CONTROL.U32 = ep0control;
+   //}}
+}
+#else
 void
 _SI32_USB_A_initialize(SI32_USB_A_Type* /*basePointer*/,
    uint32_t, /*faddr*/
@@ -131,6 +176,7 @@ _SI32_USB_A_initialize(SI32_USB_A_Type* /*basePointer*/,
    uint32_t, /*osccontrol*/
    uint32_t, /*dmacontrol*/
    uint32_t /*ep0control*/);
+#endif
 ///
 /// @def SI32_USB_A_initialize(basePointer, faddr, power, ioint, cmint, iointe, cmintepe, crcontrol, tcontrol, clksel, osccontrol, dmacontrol, ep0control)
 #define SI32_USB_A_initialize(basePointer, faddr, power, ioint, cmint, iointe, cmintepe, crcontrol, tcontrol, clksel, osccontrol, dmacontrol, ep0control) do{  \
@@ -162,9 +208,21 @@ _SI32_USB_A_initialize(SI32_USB_A_Type* /*basePointer*/,
 ///  faddr
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_write_faddr(
+   SI32_USB_A_Type * basePointer,
+   uint32_t faddr)
+{
+   //{{
+   basePointer->FADDR.U32 = faddr;
+   //}}
+}
+#else
 void
 _SI32_USB_A_write_faddr(SI32_USB_A_Type* /*basePointer*/,
    uint32_t /*faddr*/);
+#endif
 ///
 /// @def SI32_USB_A_write_faddr(basePointer, faddr)
 #define SI32_USB_A_write_faddr(basePointer, faddr) \
@@ -179,8 +237,19 @@ _SI32_USB_A_write_faddr(SI32_USB_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USB_A_read_faddr(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return basePointer->FADDR.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_USB_A_read_faddr(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_read_faddr(basePointer)
 #define SI32_USB_A_read_faddr(basePointer) \
@@ -196,8 +265,19 @@ _SI32_USB_A_read_faddr(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_function_address_updating(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->FADDR.FADDRUPD);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_function_address_updating(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_function_address_updating(basePointer)
 #define SI32_USB_A_is_function_address_updating(basePointer) \
@@ -217,9 +297,21 @@ _SI32_USB_A_is_function_address_updating(SI32_USB_A_Type* /*basePointer*/);
 ///  power
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_write_power(
+   SI32_USB_A_Type * basePointer,
+   uint32_t power)
+{
+   //{{
+   basePointer->POWER.U32 = power;
+   //}}
+}
+#else
 void
 _SI32_USB_A_write_power(SI32_USB_A_Type* /*basePointer*/,
    uint32_t /*power*/);
+#endif
 ///
 /// @def SI32_USB_A_write_power(basePointer, power)
 #define SI32_USB_A_write_power(basePointer, power) \
@@ -234,8 +326,19 @@ _SI32_USB_A_write_power(SI32_USB_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USB_A_read_power(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return basePointer->POWER.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_USB_A_read_power(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_read_power(basePointer)
 #define SI32_USB_A_read_power(basePointer) \
@@ -247,8 +350,19 @@ _SI32_USB_A_read_power(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_enable_suspend_detection(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->POWER.SUSDEN = SI32_USB_A_POWER_SUSDEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_enable_suspend_detection(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_enable_suspend_detection(basePointer)
 #define SI32_USB_A_enable_suspend_detection(basePointer) \
@@ -260,8 +374,19 @@ _SI32_USB_A_enable_suspend_detection(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_disable_suspend_detection(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->POWER.SUSDEN = SI32_USB_A_POWER_SUSDEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_disable_suspend_detection(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_disable_suspend_detection(basePointer)
 #define SI32_USB_A_disable_suspend_detection(basePointer) \
@@ -276,8 +401,19 @@ _SI32_USB_A_disable_suspend_detection(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_suspend_detected(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->POWER.SUSMDF);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_suspend_detected(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_suspend_detected(basePointer)
 #define SI32_USB_A_is_suspend_detected(basePointer) \
@@ -293,8 +429,19 @@ _SI32_USB_A_is_suspend_detected(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_generate_resume_signaling(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->POWER.RESUME = SI32_USB_A_POWER_RESUME_GENERATE_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_generate_resume_signaling(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_generate_resume_signaling(basePointer)
 #define SI32_USB_A_generate_resume_signaling(basePointer) \
@@ -306,8 +453,19 @@ _SI32_USB_A_generate_resume_signaling(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_stop_resume_signaling(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->POWER.RESUME = SI32_USB_A_POWER_RESUME_STOP_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_stop_resume_signaling(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_stop_resume_signaling(basePointer)
 #define SI32_USB_A_stop_resume_signaling(basePointer) \
@@ -322,8 +480,19 @@ _SI32_USB_A_stop_resume_signaling(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_reset_detected(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->POWER.RSTDETF);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_reset_detected(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_reset_detected(basePointer)
 #define SI32_USB_A_is_reset_detected(basePointer) \
@@ -335,8 +504,19 @@ _SI32_USB_A_is_reset_detected(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_enable_module(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->POWER.USBINH = SI32_USB_A_POWER_USBINH_INACTIVE_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_enable_module(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_enable_module(basePointer)
 #define SI32_USB_A_enable_module(basePointer) \
@@ -348,8 +528,19 @@ _SI32_USB_A_enable_module(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_disable_module(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->POWER.USBINH = SI32_USB_A_POWER_USBINH_ACTIVE_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_disable_module(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_disable_module(basePointer)
 #define SI32_USB_A_disable_module(basePointer) \
@@ -361,8 +552,19 @@ _SI32_USB_A_disable_module(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_enable_signal_dither(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->POWER.DITHEN = SI32_USB_A_POWER_DITHEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_enable_signal_dither(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_enable_signal_dither(basePointer)
 #define SI32_USB_A_enable_signal_dither(basePointer) \
@@ -374,8 +576,19 @@ _SI32_USB_A_enable_signal_dither(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_disable_signal_dither(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->POWER.DITHEN = SI32_USB_A_POWER_DITHEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_disable_signal_dither(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_disable_signal_dither(basePointer)
 #define SI32_USB_A_disable_signal_dither(basePointer) \
@@ -391,8 +604,19 @@ _SI32_USB_A_disable_signal_dither(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_send_isochronous_packet_on_in(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->POWER.ISOUPDMD = SI32_USB_A_POWER_ISOUPDMD_SEND_ON_IN_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_send_isochronous_packet_on_in(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_send_isochronous_packet_on_in(basePointer)
 #define SI32_USB_A_send_isochronous_packet_on_in(basePointer) \
@@ -409,8 +633,19 @@ _SI32_USB_A_send_isochronous_packet_on_in(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_send_isochronous_packet_on_sof(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->POWER.ISOUPDMD = SI32_USB_A_POWER_ISOUPDMD_SEND_ON_SOF_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_send_isochronous_packet_on_sof(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_send_isochronous_packet_on_sof(basePointer)
 #define SI32_USB_A_send_isochronous_packet_on_sof(basePointer) \
@@ -430,9 +665,21 @@ _SI32_USB_A_send_isochronous_packet_on_sof(SI32_USB_A_Type* /*basePointer*/);
 ///  ioint
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_write_ioint(
+   SI32_USB_A_Type * basePointer,
+   uint32_t ioint)
+{
+   //{{
+   basePointer->IOINT.U32 = ioint;
+   //}}
+}
+#else
 void
 _SI32_USB_A_write_ioint(SI32_USB_A_Type* /*basePointer*/,
    uint32_t /*ioint*/);
+#endif
 ///
 /// @def SI32_USB_A_write_ioint(basePointer, ioint)
 #define SI32_USB_A_write_ioint(basePointer, ioint) \
@@ -447,8 +694,19 @@ _SI32_USB_A_write_ioint(SI32_USB_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USB_A_read_ioint(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return basePointer->IOINT.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_USB_A_read_ioint(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_read_ioint(basePointer)
 #define SI32_USB_A_read_ioint(basePointer) \
@@ -460,8 +718,19 @@ _SI32_USB_A_read_ioint(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_clear_ep0_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->IOINT.U32 = SI32_USB_A_IOINT_EP0I_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_USB_A_clear_ep0_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_clear_ep0_interrupt(basePointer)
 #define SI32_USB_A_clear_ep0_interrupt(basePointer) \
@@ -473,8 +742,19 @@ _SI32_USB_A_clear_ep0_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_ep0_interrupt_pending(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->IOINT.EP0I);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_ep0_interrupt_pending(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_ep0_interrupt_pending(basePointer)
 #define SI32_USB_A_is_ep0_interrupt_pending(basePointer) \
@@ -486,8 +766,19 @@ _SI32_USB_A_is_ep0_interrupt_pending(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_clear_ep1_in_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->IOINT.U32 = SI32_USB_A_IOINT_IN1I_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_USB_A_clear_ep1_in_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_clear_ep1_in_interrupt(basePointer)
 #define SI32_USB_A_clear_ep1_in_interrupt(basePointer) \
@@ -499,8 +790,19 @@ _SI32_USB_A_clear_ep1_in_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_ep1_in_interrupt_pending(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->IOINT.IN1I);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_ep1_in_interrupt_pending(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_ep1_in_interrupt_pending(basePointer)
 #define SI32_USB_A_is_ep1_in_interrupt_pending(basePointer) \
@@ -512,8 +814,19 @@ _SI32_USB_A_is_ep1_in_interrupt_pending(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_clear_ep2_in_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->IOINT.U32 = SI32_USB_A_IOINT_IN2I_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_USB_A_clear_ep2_in_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_clear_ep2_in_interrupt(basePointer)
 #define SI32_USB_A_clear_ep2_in_interrupt(basePointer) \
@@ -525,8 +838,19 @@ _SI32_USB_A_clear_ep2_in_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_ep2_in_interrupt_pending(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->IOINT.IN2I);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_ep2_in_interrupt_pending(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_ep2_in_interrupt_pending(basePointer)
 #define SI32_USB_A_is_ep2_in_interrupt_pending(basePointer) \
@@ -538,8 +862,19 @@ _SI32_USB_A_is_ep2_in_interrupt_pending(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_clear_ep3_in_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->IOINT.U32 = SI32_USB_A_IOINT_IN3I_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_USB_A_clear_ep3_in_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_clear_ep3_in_interrupt(basePointer)
 #define SI32_USB_A_clear_ep3_in_interrupt(basePointer) \
@@ -551,8 +886,19 @@ _SI32_USB_A_clear_ep3_in_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_ep3_in_interrupt_pending(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->IOINT.IN3I);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_ep3_in_interrupt_pending(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_ep3_in_interrupt_pending(basePointer)
 #define SI32_USB_A_is_ep3_in_interrupt_pending(basePointer) \
@@ -564,8 +910,19 @@ _SI32_USB_A_is_ep3_in_interrupt_pending(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_clear_ep4_in_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->IOINT.U32 = SI32_USB_A_IOINT_IN4I_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_USB_A_clear_ep4_in_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_clear_ep4_in_interrupt(basePointer)
 #define SI32_USB_A_clear_ep4_in_interrupt(basePointer) \
@@ -577,8 +934,19 @@ _SI32_USB_A_clear_ep4_in_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_ep4_in_interrupt_pending(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->IOINT.IN4I);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_ep4_in_interrupt_pending(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_ep4_in_interrupt_pending(basePointer)
 #define SI32_USB_A_is_ep4_in_interrupt_pending(basePointer) \
@@ -590,8 +958,19 @@ _SI32_USB_A_is_ep4_in_interrupt_pending(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_clear_ep1_out_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->IOINT.U32 = SI32_USB_A_IOINT_OUT1I_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_USB_A_clear_ep1_out_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_clear_ep1_out_interrupt(basePointer)
 #define SI32_USB_A_clear_ep1_out_interrupt(basePointer) \
@@ -603,8 +982,19 @@ _SI32_USB_A_clear_ep1_out_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_ep1_out_interrupt_pending(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->IOINT.OUT1I);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_ep1_out_interrupt_pending(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_ep1_out_interrupt_pending(basePointer)
 #define SI32_USB_A_is_ep1_out_interrupt_pending(basePointer) \
@@ -616,8 +1006,19 @@ _SI32_USB_A_is_ep1_out_interrupt_pending(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_clear_ep2_out_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->IOINT.U32 = SI32_USB_A_IOINT_OUT2I_SET_U32;
+   //}}
+}
+#else
 void
 _SI32_USB_A_clear_ep2_out_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_clear_ep2_out_interrupt(basePointer)
 #define SI32_USB_A_clear_ep2_out_interrupt(basePointer) \
@@ -629,8 +1030,19 @@ _SI32_USB_A_clear_ep2_out_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_ep2_out_interrupt_pending(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->IOINT.OUT2I);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_ep2_out_interrupt_pending(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_ep2_out_interrupt_pending(basePointer)
 #define SI32_USB_A_is_ep2_out_interrupt_pending(basePointer) \
@@ -642,8 +1054,19 @@ _SI32_USB_A_is_ep2_out_interrupt_pending(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_clear_ep3_out_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->IOINT.U32 = SI32_USB_A_IOINT_OUT3I_SET_U32;;
+   //}}
+}
+#else
 void
 _SI32_USB_A_clear_ep3_out_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_clear_ep3_out_interrupt(basePointer)
 #define SI32_USB_A_clear_ep3_out_interrupt(basePointer) \
@@ -655,8 +1078,19 @@ _SI32_USB_A_clear_ep3_out_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_ep3_out_interrupt_pending(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->IOINT.OUT3I);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_ep3_out_interrupt_pending(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_ep3_out_interrupt_pending(basePointer)
 #define SI32_USB_A_is_ep3_out_interrupt_pending(basePointer) \
@@ -668,8 +1102,19 @@ _SI32_USB_A_is_ep3_out_interrupt_pending(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_clear_ep4_out_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->IOINT.U32 = SI32_USB_A_IOINT_OUT4I_SET_U32;;
+   //}}
+}
+#else
 void
 _SI32_USB_A_clear_ep4_out_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_clear_ep4_out_interrupt(basePointer)
 #define SI32_USB_A_clear_ep4_out_interrupt(basePointer) \
@@ -681,8 +1126,19 @@ _SI32_USB_A_clear_ep4_out_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_ep4_out_interrupt_pending(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->IOINT.OUT4I);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_ep4_out_interrupt_pending(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_ep4_out_interrupt_pending(basePointer)
 #define SI32_USB_A_is_ep4_out_interrupt_pending(basePointer) \
@@ -702,9 +1158,21 @@ _SI32_USB_A_is_ep4_out_interrupt_pending(SI32_USB_A_Type* /*basePointer*/);
 ///  cmint
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_write_cmint(
+   SI32_USB_A_Type * basePointer,
+   uint32_t cmint)
+{
+   //{{
+   basePointer->CMINT.U32 = cmint;
+   //}}
+}
+#else
 void
 _SI32_USB_A_write_cmint(SI32_USB_A_Type* /*basePointer*/,
    uint32_t /*cmint*/);
+#endif
 ///
 /// @def SI32_USB_A_write_cmint(basePointer, cmint)
 #define SI32_USB_A_write_cmint(basePointer, cmint) \
@@ -719,8 +1187,19 @@ _SI32_USB_A_write_cmint(SI32_USB_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USB_A_read_cmint(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CMINT.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_USB_A_read_cmint(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_read_cmint(basePointer)
 #define SI32_USB_A_read_cmint(basePointer) \
@@ -732,8 +1211,19 @@ _SI32_USB_A_read_cmint(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_clear_suspend_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CMINT.SUSI = SI32_USB_A_CMINT_SUSI_SET_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_clear_suspend_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_clear_suspend_interrupt(basePointer)
 #define SI32_USB_A_clear_suspend_interrupt(basePointer) \
@@ -745,8 +1235,19 @@ _SI32_USB_A_clear_suspend_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_suspend_interrupt_pending(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CMINT.SUSI);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_suspend_interrupt_pending(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_suspend_interrupt_pending(basePointer)
 #define SI32_USB_A_is_suspend_interrupt_pending(basePointer) \
@@ -758,8 +1259,19 @@ _SI32_USB_A_is_suspend_interrupt_pending(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_clear_resume_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CMINT.RESI = SI32_USB_A_CMINT_RESI_SET_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_clear_resume_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_clear_resume_interrupt(basePointer)
 #define SI32_USB_A_clear_resume_interrupt(basePointer) \
@@ -771,8 +1283,19 @@ _SI32_USB_A_clear_resume_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_resume_interrupt_pending(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CMINT.RESI);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_resume_interrupt_pending(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_resume_interrupt_pending(basePointer)
 #define SI32_USB_A_is_resume_interrupt_pending(basePointer) \
@@ -784,8 +1307,19 @@ _SI32_USB_A_is_resume_interrupt_pending(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_clear_reset_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CMINT.RSTI = SI32_USB_A_CMINT_RSTI_SET_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_clear_reset_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_clear_reset_interrupt(basePointer)
 #define SI32_USB_A_clear_reset_interrupt(basePointer) \
@@ -797,8 +1331,19 @@ _SI32_USB_A_clear_reset_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_reset_interrupt_pending(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CMINT.RSTI);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_reset_interrupt_pending(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_reset_interrupt_pending(basePointer)
 #define SI32_USB_A_is_reset_interrupt_pending(basePointer) \
@@ -810,8 +1355,19 @@ _SI32_USB_A_is_reset_interrupt_pending(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_clear_start_of_frame_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CMINT.SOFI = SI32_USB_A_CMINT_SOFI_SET_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_clear_start_of_frame_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_clear_start_of_frame_interrupt(basePointer)
 #define SI32_USB_A_clear_start_of_frame_interrupt(basePointer) \
@@ -823,8 +1379,19 @@ _SI32_USB_A_clear_start_of_frame_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_start_of_frame_interrupt_pending(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CMINT.SOFI);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_start_of_frame_interrupt_pending(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_start_of_frame_interrupt_pending(basePointer)
 #define SI32_USB_A_is_start_of_frame_interrupt_pending(basePointer) \
@@ -844,9 +1411,21 @@ _SI32_USB_A_is_start_of_frame_interrupt_pending(SI32_USB_A_Type* /*basePointer*/
 ///  iointe
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_write_iointe(
+   SI32_USB_A_Type * basePointer,
+   uint32_t iointe)
+{
+   //{{
+   basePointer->IOINTE.U32 = iointe;
+   //}}
+}
+#else
 void
 _SI32_USB_A_write_iointe(SI32_USB_A_Type* /*basePointer*/,
    uint32_t /*iointe*/);
+#endif
 ///
 /// @def SI32_USB_A_write_iointe(basePointer, iointe)
 #define SI32_USB_A_write_iointe(basePointer, iointe) \
@@ -861,8 +1440,19 @@ _SI32_USB_A_write_iointe(SI32_USB_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USB_A_read_iointe(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return basePointer->IOINTE.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_USB_A_read_iointe(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_read_iointe(basePointer)
 #define SI32_USB_A_read_iointe(basePointer) \
@@ -874,8 +1464,19 @@ _SI32_USB_A_read_iointe(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_enable_ep0_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->IOINTE.EP0IEN = SI32_USB_A_IOINTE_EP0IEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_enable_ep0_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_enable_ep0_interrupt(basePointer)
 #define SI32_USB_A_enable_ep0_interrupt(basePointer) \
@@ -887,8 +1488,19 @@ _SI32_USB_A_enable_ep0_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_disable_ep0_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->IOINTE.EP0IEN = SI32_USB_A_IOINTE_EP0IEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_disable_ep0_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_disable_ep0_interrupt(basePointer)
 #define SI32_USB_A_disable_ep0_interrupt(basePointer) \
@@ -900,8 +1512,19 @@ _SI32_USB_A_disable_ep0_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_ep0_interrupt_enabled(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->IOINTE.EP0IEN);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_ep0_interrupt_enabled(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_ep0_interrupt_enabled(basePointer)
 #define SI32_USB_A_is_ep0_interrupt_enabled(basePointer) \
@@ -913,8 +1536,19 @@ _SI32_USB_A_is_ep0_interrupt_enabled(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_enable_ep1_in_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->IOINTE.IN1IEN = SI32_USB_A_IOINTE_IN1IEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_enable_ep1_in_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_enable_ep1_in_interrupt(basePointer)
 #define SI32_USB_A_enable_ep1_in_interrupt(basePointer) \
@@ -926,8 +1560,19 @@ _SI32_USB_A_enable_ep1_in_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_disable_ep1_in_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->IOINTE.IN1IEN = SI32_USB_A_IOINTE_IN1IEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_disable_ep1_in_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_disable_ep1_in_interrupt(basePointer)
 #define SI32_USB_A_disable_ep1_in_interrupt(basePointer) \
@@ -939,8 +1584,19 @@ _SI32_USB_A_disable_ep1_in_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_ep1_in_interrupt_enabled(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->IOINTE.IN1IEN);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_ep1_in_interrupt_enabled(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_ep1_in_interrupt_enabled(basePointer)
 #define SI32_USB_A_is_ep1_in_interrupt_enabled(basePointer) \
@@ -952,8 +1608,19 @@ _SI32_USB_A_is_ep1_in_interrupt_enabled(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_enable_ep2_in_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->IOINTE.IN2IEN = SI32_USB_A_IOINTE_IN2IEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_enable_ep2_in_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_enable_ep2_in_interrupt(basePointer)
 #define SI32_USB_A_enable_ep2_in_interrupt(basePointer) \
@@ -965,8 +1632,19 @@ _SI32_USB_A_enable_ep2_in_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_disable_ep2_in_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->IOINTE.IN2IEN = SI32_USB_A_IOINTE_IN2IEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_disable_ep2_in_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_disable_ep2_in_interrupt(basePointer)
 #define SI32_USB_A_disable_ep2_in_interrupt(basePointer) \
@@ -978,8 +1656,19 @@ _SI32_USB_A_disable_ep2_in_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_ep2_in_interrupt_enabled(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->IOINTE.IN2IEN);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_ep2_in_interrupt_enabled(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_ep2_in_interrupt_enabled(basePointer)
 #define SI32_USB_A_is_ep2_in_interrupt_enabled(basePointer) \
@@ -991,8 +1680,19 @@ _SI32_USB_A_is_ep2_in_interrupt_enabled(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_enable_ep3_in_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->IOINTE.IN3IEN = SI32_USB_A_IOINTE_IN3IEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_enable_ep3_in_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_enable_ep3_in_interrupt(basePointer)
 #define SI32_USB_A_enable_ep3_in_interrupt(basePointer) \
@@ -1004,8 +1704,19 @@ _SI32_USB_A_enable_ep3_in_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_disable_ep3_in_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->IOINTE.IN3IEN = SI32_USB_A_IOINTE_IN3IEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_disable_ep3_in_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_disable_ep3_in_interrupt(basePointer)
 #define SI32_USB_A_disable_ep3_in_interrupt(basePointer) \
@@ -1017,8 +1728,19 @@ _SI32_USB_A_disable_ep3_in_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_ep3_in_interrupt_enabled(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->IOINTE.IN3IEN);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_ep3_in_interrupt_enabled(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_ep3_in_interrupt_enabled(basePointer)
 #define SI32_USB_A_is_ep3_in_interrupt_enabled(basePointer) \
@@ -1030,8 +1752,19 @@ _SI32_USB_A_is_ep3_in_interrupt_enabled(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_enable_ep4_in_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->IOINTE.IN4IEN = SI32_USB_A_IOINTE_IN4IEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_enable_ep4_in_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_enable_ep4_in_interrupt(basePointer)
 #define SI32_USB_A_enable_ep4_in_interrupt(basePointer) \
@@ -1043,8 +1776,19 @@ _SI32_USB_A_enable_ep4_in_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_disable_ep4_in_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->IOINTE.IN4IEN = SI32_USB_A_IOINTE_IN4IEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_disable_ep4_in_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_disable_ep4_in_interrupt(basePointer)
 #define SI32_USB_A_disable_ep4_in_interrupt(basePointer) \
@@ -1056,8 +1800,19 @@ _SI32_USB_A_disable_ep4_in_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_ep4_in_interrupt_enabled(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->IOINTE.IN4IEN);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_ep4_in_interrupt_enabled(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_ep4_in_interrupt_enabled(basePointer)
 #define SI32_USB_A_is_ep4_in_interrupt_enabled(basePointer) \
@@ -1069,8 +1824,19 @@ _SI32_USB_A_is_ep4_in_interrupt_enabled(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_enable_ep1_out_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->IOINTE.OUT1IEN = SI32_USB_A_IOINTE_OUT1IEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_enable_ep1_out_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_enable_ep1_out_interrupt(basePointer)
 #define SI32_USB_A_enable_ep1_out_interrupt(basePointer) \
@@ -1082,8 +1848,19 @@ _SI32_USB_A_enable_ep1_out_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_disable_ep1_out_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->IOINTE.OUT1IEN = SI32_USB_A_IOINTE_OUT1IEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_disable_ep1_out_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_disable_ep1_out_interrupt(basePointer)
 #define SI32_USB_A_disable_ep1_out_interrupt(basePointer) \
@@ -1095,8 +1872,19 @@ _SI32_USB_A_disable_ep1_out_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_ep1_out_interrupt_enabled(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->IOINTE.OUT1IEN);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_ep1_out_interrupt_enabled(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_ep1_out_interrupt_enabled(basePointer)
 #define SI32_USB_A_is_ep1_out_interrupt_enabled(basePointer) \
@@ -1108,8 +1896,19 @@ _SI32_USB_A_is_ep1_out_interrupt_enabled(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_enable_ep2_out_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->IOINTE.OUT2IEN = SI32_USB_A_IOINTE_OUT2IEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_enable_ep2_out_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_enable_ep2_out_interrupt(basePointer)
 #define SI32_USB_A_enable_ep2_out_interrupt(basePointer) \
@@ -1121,8 +1920,19 @@ _SI32_USB_A_enable_ep2_out_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_disable_ep2_out_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->IOINTE.OUT2IEN = SI32_USB_A_IOINTE_OUT2IEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_disable_ep2_out_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_disable_ep2_out_interrupt(basePointer)
 #define SI32_USB_A_disable_ep2_out_interrupt(basePointer) \
@@ -1134,8 +1944,19 @@ _SI32_USB_A_disable_ep2_out_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_ep2_out_interrupt_enabled(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->IOINTE.OUT2IEN);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_ep2_out_interrupt_enabled(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_ep2_out_interrupt_enabled(basePointer)
 #define SI32_USB_A_is_ep2_out_interrupt_enabled(basePointer) \
@@ -1147,8 +1968,19 @@ _SI32_USB_A_is_ep2_out_interrupt_enabled(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_enable_ep3_out_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->IOINTE.OUT3IEN = SI32_USB_A_IOINTE_OUT3IEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_enable_ep3_out_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_enable_ep3_out_interrupt(basePointer)
 #define SI32_USB_A_enable_ep3_out_interrupt(basePointer) \
@@ -1160,8 +1992,19 @@ _SI32_USB_A_enable_ep3_out_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_disable_ep3_out_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->IOINTE.OUT3IEN = SI32_USB_A_IOINTE_OUT3IEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_disable_ep3_out_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_disable_ep3_out_interrupt(basePointer)
 #define SI32_USB_A_disable_ep3_out_interrupt(basePointer) \
@@ -1173,8 +2016,19 @@ _SI32_USB_A_disable_ep3_out_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_ep3_out_interrupt_enabled(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->IOINTE.OUT3IEN);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_ep3_out_interrupt_enabled(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_ep3_out_interrupt_enabled(basePointer)
 #define SI32_USB_A_is_ep3_out_interrupt_enabled(basePointer) \
@@ -1186,8 +2040,19 @@ _SI32_USB_A_is_ep3_out_interrupt_enabled(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_enable_ep4_out_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->IOINTE.OUT4IEN = SI32_USB_A_IOINTE_OUT4IEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_enable_ep4_out_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_enable_ep4_out_interrupt(basePointer)
 #define SI32_USB_A_enable_ep4_out_interrupt(basePointer) \
@@ -1199,8 +2064,19 @@ _SI32_USB_A_enable_ep4_out_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_disable_ep4_out_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->IOINTE.OUT4IEN = SI32_USB_A_IOINTE_OUT4IEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_disable_ep4_out_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_disable_ep4_out_interrupt(basePointer)
 #define SI32_USB_A_disable_ep4_out_interrupt(basePointer) \
@@ -1212,8 +2088,19 @@ _SI32_USB_A_disable_ep4_out_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_ep4_out_interrupt_enabled(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->IOINTE.OUT4IEN);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_ep4_out_interrupt_enabled(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_ep4_out_interrupt_enabled(basePointer)
 #define SI32_USB_A_is_ep4_out_interrupt_enabled(basePointer) \
@@ -1233,9 +2120,21 @@ _SI32_USB_A_is_ep4_out_interrupt_enabled(SI32_USB_A_Type* /*basePointer*/);
 ///  cmintepe
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_write_cmintepe(
+   SI32_USB_A_Type * basePointer,
+   uint32_t cmintepe)
+{
+   //{{
+   basePointer->CMINTEPE.U32 = cmintepe;
+   //}}
+}
+#else
 void
 _SI32_USB_A_write_cmintepe(SI32_USB_A_Type* /*basePointer*/,
    uint32_t /*cmintepe*/);
+#endif
 ///
 /// @def SI32_USB_A_write_cmintepe(basePointer, cmintepe)
 #define SI32_USB_A_write_cmintepe(basePointer, cmintepe) \
@@ -1250,8 +2149,19 @@ _SI32_USB_A_write_cmintepe(SI32_USB_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USB_A_read_cmintepe(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CMINTEPE.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_USB_A_read_cmintepe(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_read_cmintepe(basePointer)
 #define SI32_USB_A_read_cmintepe(basePointer) \
@@ -1263,8 +2173,19 @@ _SI32_USB_A_read_cmintepe(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_enable_suspend_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CMINTEPE.SUSIEN = SI32_USB_A_CMINTEPE_SUSIEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_enable_suspend_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_enable_suspend_interrupt(basePointer)
 #define SI32_USB_A_enable_suspend_interrupt(basePointer) \
@@ -1276,8 +2197,19 @@ _SI32_USB_A_enable_suspend_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_disable_suspend_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CMINTEPE.SUSIEN = SI32_USB_A_CMINTEPE_SUSIEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_disable_suspend_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_disable_suspend_interrupt(basePointer)
 #define SI32_USB_A_disable_suspend_interrupt(basePointer) \
@@ -1289,8 +2221,19 @@ _SI32_USB_A_disable_suspend_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_suspend_interrupt_enabled(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CMINTEPE.SUSIEN);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_suspend_interrupt_enabled(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_suspend_interrupt_enabled(basePointer)
 #define SI32_USB_A_is_suspend_interrupt_enabled(basePointer) \
@@ -1302,8 +2245,19 @@ _SI32_USB_A_is_suspend_interrupt_enabled(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_enable_resume_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CMINTEPE.RESIEN = SI32_USB_A_CMINTEPE_RESIEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_enable_resume_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_enable_resume_interrupt(basePointer)
 #define SI32_USB_A_enable_resume_interrupt(basePointer) \
@@ -1315,8 +2269,19 @@ _SI32_USB_A_enable_resume_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_disable_resume_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CMINTEPE.RESIEN = SI32_USB_A_CMINTEPE_RESIEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_disable_resume_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_disable_resume_interrupt(basePointer)
 #define SI32_USB_A_disable_resume_interrupt(basePointer) \
@@ -1328,8 +2293,19 @@ _SI32_USB_A_disable_resume_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_resume_interrupt_enabled(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CMINTEPE.RESIEN);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_resume_interrupt_enabled(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_resume_interrupt_enabled(basePointer)
 #define SI32_USB_A_is_resume_interrupt_enabled(basePointer) \
@@ -1341,8 +2317,19 @@ _SI32_USB_A_is_resume_interrupt_enabled(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_enable_reset_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CMINTEPE.RSTIEN = SI32_USB_A_CMINTEPE_RSTIEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_enable_reset_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_enable_reset_interrupt(basePointer)
 #define SI32_USB_A_enable_reset_interrupt(basePointer) \
@@ -1354,8 +2341,19 @@ _SI32_USB_A_enable_reset_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_disable_reset_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CMINTEPE.RSTIEN = SI32_USB_A_CMINTEPE_RSTIEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_disable_reset_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_disable_reset_interrupt(basePointer)
 #define SI32_USB_A_disable_reset_interrupt(basePointer) \
@@ -1367,8 +2365,19 @@ _SI32_USB_A_disable_reset_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_reset_interrupt_enabled(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CMINTEPE.RSTIEN);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_reset_interrupt_enabled(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_reset_interrupt_enabled(basePointer)
 #define SI32_USB_A_is_reset_interrupt_enabled(basePointer) \
@@ -1380,8 +2389,19 @@ _SI32_USB_A_is_reset_interrupt_enabled(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_enable_start_of_frame_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CMINTEPE.SOFIEN = SI32_USB_A_CMINTEPE_SOFIEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_enable_start_of_frame_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_enable_start_of_frame_interrupt(basePointer)
 #define SI32_USB_A_enable_start_of_frame_interrupt(basePointer) \
@@ -1393,8 +2413,19 @@ _SI32_USB_A_enable_start_of_frame_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_disable_start_of_frame_interrupt(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CMINTEPE.SOFIEN = SI32_USB_A_CMINTEPE_SOFIEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_disable_start_of_frame_interrupt(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_disable_start_of_frame_interrupt(basePointer)
 #define SI32_USB_A_disable_start_of_frame_interrupt(basePointer) \
@@ -1406,8 +2437,19 @@ _SI32_USB_A_disable_start_of_frame_interrupt(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_start_of_frame_interrupt_enabled(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CMINTEPE.SOFIEN);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_start_of_frame_interrupt_enabled(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_start_of_frame_interrupt_enabled(basePointer)
 #define SI32_USB_A_is_start_of_frame_interrupt_enabled(basePointer) \
@@ -1419,8 +2461,19 @@ _SI32_USB_A_is_start_of_frame_interrupt_enabled(SI32_USB_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_enable_ep0(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CMINTEPE.EP0EN = SI32_USB_A_CMINTEPE_EP0EN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_enable_ep0(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_enable_ep0(basePointer)
 #define SI32_USB_A_enable_ep0(basePointer) \
@@ -1435,8 +2488,19 @@ _SI32_USB_A_enable_ep0(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_disable_ep0(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+	basePointer->CMINTEPE.EP0EN = SI32_USB_A_CMINTEPE_EP0EN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_disable_ep0(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_disable_ep0(basePointer)
 #define SI32_USB_A_disable_ep0(basePointer) \
@@ -1448,8 +2512,19 @@ _SI32_USB_A_disable_ep0(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_ep0_enabled(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CMINTEPE.EP0EN);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_ep0_enabled(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_ep0_enabled(basePointer)
 #define SI32_USB_A_is_ep0_enabled(basePointer) \
@@ -1461,8 +2536,19 @@ _SI32_USB_A_is_ep0_enabled(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_enable_ep1(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CMINTEPE.EP1EN = SI32_USB_A_CMINTEPE_EP1EN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_enable_ep1(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_enable_ep1(basePointer)
 #define SI32_USB_A_enable_ep1(basePointer) \
@@ -1477,8 +2563,19 @@ _SI32_USB_A_enable_ep1(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_disable_ep1(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CMINTEPE.EP1EN = SI32_USB_A_CMINTEPE_EP1EN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_disable_ep1(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_disable_ep1(basePointer)
 #define SI32_USB_A_disable_ep1(basePointer) \
@@ -1490,8 +2587,19 @@ _SI32_USB_A_disable_ep1(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_ep1_enabled(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CMINTEPE.EP1EN);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_ep1_enabled(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_ep1_enabled(basePointer)
 #define SI32_USB_A_is_ep1_enabled(basePointer) \
@@ -1503,8 +2611,19 @@ _SI32_USB_A_is_ep1_enabled(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_enable_ep2(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CMINTEPE.EP2EN = SI32_USB_A_CMINTEPE_EP2EN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_enable_ep2(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_enable_ep2(basePointer)
 #define SI32_USB_A_enable_ep2(basePointer) \
@@ -1519,8 +2638,19 @@ _SI32_USB_A_enable_ep2(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_disable_ep2(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CMINTEPE.EP2EN = SI32_USB_A_CMINTEPE_EP2EN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_disable_ep2(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_disable_ep2(basePointer)
 #define SI32_USB_A_disable_ep2(basePointer) \
@@ -1532,8 +2662,19 @@ _SI32_USB_A_disable_ep2(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_ep2_enabled(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CMINTEPE.EP2EN);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_ep2_enabled(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_ep2_enabled(basePointer)
 #define SI32_USB_A_is_ep2_enabled(basePointer) \
@@ -1545,8 +2686,19 @@ _SI32_USB_A_is_ep2_enabled(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_enable_ep3(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CMINTEPE.EP3EN = SI32_USB_A_CMINTEPE_EP3EN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_enable_ep3(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_enable_ep3(basePointer)
 #define SI32_USB_A_enable_ep3(basePointer) \
@@ -1561,8 +2713,19 @@ _SI32_USB_A_enable_ep3(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_disable_ep3(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CMINTEPE.EP3EN = SI32_USB_A_CMINTEPE_EP3EN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_disable_ep3(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_disable_ep3(basePointer)
 #define SI32_USB_A_disable_ep3(basePointer) \
@@ -1574,8 +2737,19 @@ _SI32_USB_A_disable_ep3(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_ep3_enabled(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CMINTEPE.EP3EN);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_ep3_enabled(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_ep3_enabled(basePointer)
 #define SI32_USB_A_is_ep3_enabled(basePointer) \
@@ -1587,8 +2761,19 @@ _SI32_USB_A_is_ep3_enabled(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_enable_ep4(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CMINTEPE.EP4EN = SI32_USB_A_CMINTEPE_EP4EN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_enable_ep4(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_enable_ep4(basePointer)
 #define SI32_USB_A_enable_ep4(basePointer) \
@@ -1603,8 +2788,19 @@ _SI32_USB_A_enable_ep4(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_disable_ep4(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CMINTEPE.EP4EN = SI32_USB_A_CMINTEPE_EP4EN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_disable_ep4(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_disable_ep4(basePointer)
 #define SI32_USB_A_disable_ep4(basePointer) \
@@ -1616,8 +2812,19 @@ _SI32_USB_A_disable_ep4(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_ep4_enabled(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CMINTEPE.EP4EN);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_ep4_enabled(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_ep4_enabled(basePointer)
 #define SI32_USB_A_is_ep4_enabled(basePointer) \
@@ -1637,9 +2844,21 @@ _SI32_USB_A_is_ep4_enabled(SI32_USB_A_Type* /*basePointer*/);
 ///  crcontrol
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_write_crcontrol(
+   SI32_USB_A_Type * basePointer,
+   uint32_t crcontrol)
+{
+   //{{
+   basePointer->CRCONTROL.U32 = crcontrol;
+   //}}
+}
+#else
 void
 _SI32_USB_A_write_crcontrol(SI32_USB_A_Type* /*basePointer*/,
    uint32_t /*crcontrol*/);
+#endif
 ///
 /// @def SI32_USB_A_write_crcontrol(basePointer, crcontrol)
 #define SI32_USB_A_write_crcontrol(basePointer, crcontrol) \
@@ -1654,8 +2873,19 @@ _SI32_USB_A_write_crcontrol(SI32_USB_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USB_A_read_crcontrol(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CRCONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_USB_A_read_crcontrol(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_read_crcontrol(basePointer)
 #define SI32_USB_A_read_crcontrol(basePointer) \
@@ -1667,8 +2897,19 @@ _SI32_USB_A_read_crcontrol(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_enable_open_loop_mode(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CRCONTROL.OLEN = SI32_USB_A_CRCONTROL_OLEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_enable_open_loop_mode(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_enable_open_loop_mode(basePointer)
 #define SI32_USB_A_enable_open_loop_mode(basePointer) \
@@ -1680,8 +2921,19 @@ _SI32_USB_A_enable_open_loop_mode(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_disable_open_loop_mode(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CRCONTROL.OLEN = SI32_USB_A_CRCONTROL_OLEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_disable_open_loop_mode(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_disable_open_loop_mode(basePointer)
 #define SI32_USB_A_disable_open_loop_mode(basePointer) \
@@ -1693,8 +2945,19 @@ _SI32_USB_A_disable_open_loop_mode(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_select_clock_recovery_mode_full_speed(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CRCONTROL.LSCRMD = SI32_USB_A_CRCONTROL_LSCRMD_FULL_SPEED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_select_clock_recovery_mode_full_speed(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_select_clock_recovery_mode_full_speed(basePointer)
 #define SI32_USB_A_select_clock_recovery_mode_full_speed(basePointer) \
@@ -1706,8 +2969,19 @@ _SI32_USB_A_select_clock_recovery_mode_full_speed(SI32_USB_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_select_clock_recovery_mode_low_speed(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CRCONTROL.LSCRMD = SI32_USB_A_CRCONTROL_LSCRMD_LOW_SPEED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_select_clock_recovery_mode_low_speed(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_select_clock_recovery_mode_low_speed(basePointer)
 #define SI32_USB_A_select_clock_recovery_mode_low_speed(basePointer) \
@@ -1719,8 +2993,19 @@ _SI32_USB_A_select_clock_recovery_mode_low_speed(SI32_USB_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_select_clock_recovery_single_step_cal(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CRCONTROL.CRSSEN = SI32_USB_A_CRCONTROL_CRSSEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_select_clock_recovery_single_step_cal(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_select_clock_recovery_single_step_cal(basePointer)
 #define SI32_USB_A_select_clock_recovery_single_step_cal(basePointer) \
@@ -1732,8 +3017,19 @@ _SI32_USB_A_select_clock_recovery_single_step_cal(SI32_USB_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_select_clock_recovery_normal_cal(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CRCONTROL.CRSSEN = SI32_USB_A_CRCONTROL_CRSSEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_select_clock_recovery_normal_cal(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_select_clock_recovery_normal_cal(basePointer)
 #define SI32_USB_A_select_clock_recovery_normal_cal(basePointer) \
@@ -1745,8 +3041,19 @@ _SI32_USB_A_select_clock_recovery_normal_cal(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_enable_clock_recovery(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CRCONTROL.CREN = SI32_USB_A_CRCONTROL_CREN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_enable_clock_recovery(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_enable_clock_recovery(basePointer)
 #define SI32_USB_A_enable_clock_recovery(basePointer) \
@@ -1758,8 +3065,19 @@ _SI32_USB_A_enable_clock_recovery(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_disable_clock_recovery(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CRCONTROL.CREN = SI32_USB_A_CRCONTROL_CREN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_disable_clock_recovery(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_disable_clock_recovery(basePointer)
 #define SI32_USB_A_disable_clock_recovery(basePointer) \
@@ -1779,9 +3097,21 @@ _SI32_USB_A_disable_clock_recovery(SI32_USB_A_Type* /*basePointer*/);
 ///  tcontrol
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_write_tcontrol(
+   SI32_USB_A_Type * basePointer,
+   uint32_t tcontrol)
+{
+   //{{
+  basePointer->TCONTROL.U32 = tcontrol;
+   //}}
+}
+#else
 void
 _SI32_USB_A_write_tcontrol(SI32_USB_A_Type* /*basePointer*/,
    uint32_t /*tcontrol*/);
+#endif
 ///
 /// @def SI32_USB_A_write_tcontrol(basePointer, tcontrol)
 #define SI32_USB_A_write_tcontrol(basePointer, tcontrol) \
@@ -1796,8 +3126,19 @@ _SI32_USB_A_write_tcontrol(SI32_USB_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USB_A_read_tcontrol(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return basePointer->TCONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_USB_A_read_tcontrol(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_read_tcontrol(basePointer)
 #define SI32_USB_A_read_tcontrol(basePointer) \
@@ -1809,8 +3150,19 @@ _SI32_USB_A_read_tcontrol(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_select_transceiver_full_speed(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->TCONTROL.SSEL = SI32_USB_A_TCONTROL_SSEL_FULL_SPEED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_select_transceiver_full_speed(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_select_transceiver_full_speed(basePointer)
 #define SI32_USB_A_select_transceiver_full_speed(basePointer) \
@@ -1822,8 +3174,19 @@ _SI32_USB_A_select_transceiver_full_speed(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_select_transceiver_low_speed(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->TCONTROL.SSEL = SI32_USB_A_TCONTROL_SSEL_LOW_SPEED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_select_transceiver_low_speed(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_select_transceiver_low_speed(basePointer)
 #define SI32_USB_A_select_transceiver_low_speed(basePointer) \
@@ -1835,8 +3198,19 @@ _SI32_USB_A_select_transceiver_low_speed(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_enable_transceiver(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->TCONTROL.PHYEN = SI32_USB_A_TCONTROL_PHYEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_enable_transceiver(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_enable_transceiver(basePointer)
 #define SI32_USB_A_enable_transceiver(basePointer) \
@@ -1848,8 +3222,19 @@ _SI32_USB_A_enable_transceiver(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_disable_transceiver(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->TCONTROL.PHYEN = SI32_USB_A_TCONTROL_PHYEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_disable_transceiver(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_disable_transceiver(basePointer)
 #define SI32_USB_A_disable_transceiver(basePointer) \
@@ -1861,8 +3246,19 @@ _SI32_USB_A_disable_transceiver(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_enable_internal_pull_up(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->TCONTROL.PUEN = SI32_USB_A_TCONTROL_PUEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_enable_internal_pull_up(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_enable_internal_pull_up(basePointer)
 #define SI32_USB_A_enable_internal_pull_up(basePointer) \
@@ -1874,8 +3270,19 @@ _SI32_USB_A_enable_internal_pull_up(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_disable_internal_pull_up(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->TCONTROL.PUEN = SI32_USB_A_TCONTROL_PUEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_disable_internal_pull_up(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_disable_internal_pull_up(basePointer)
 #define SI32_USB_A_disable_internal_pull_up(basePointer) \
@@ -1895,9 +3302,21 @@ _SI32_USB_A_disable_internal_pull_up(SI32_USB_A_Type* /*basePointer*/);
 ///  clksel
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_write_clksel(
+   SI32_USB_A_Type * basePointer,
+   uint32_t clksel)
+{
+   //{{
+   basePointer->CLKSEL.U32 = clksel;
+   //}}
+}
+#else
 void
 _SI32_USB_A_write_clksel(SI32_USB_A_Type* /*basePointer*/,
    uint32_t /*clksel*/);
+#endif
 ///
 /// @def SI32_USB_A_write_clksel(basePointer, clksel)
 #define SI32_USB_A_write_clksel(basePointer, clksel) \
@@ -1912,8 +3331,19 @@ _SI32_USB_A_write_clksel(SI32_USB_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USB_A_read_clksel(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CLKSEL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_USB_A_read_clksel(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_read_clksel(basePointer)
 #define SI32_USB_A_read_clksel(basePointer) \
@@ -1925,8 +3355,19 @@ _SI32_USB_A_read_clksel(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_select_usb_clock_48mhz(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CLKSEL.CLKSEL_BITS = SI32_USB_A_CLKSEL_CLKSEL_USBNOSC_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_select_usb_clock_48mhz(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_select_usb_clock_48mhz(basePointer)
 #define SI32_USB_A_select_usb_clock_48mhz(basePointer) \
@@ -1938,8 +3379,19 @@ _SI32_USB_A_select_usb_clock_48mhz(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_select_usb_clock_pll(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CLKSEL.CLKSEL_BITS = SI32_USB_A_CLKSEL_CLKSEL_PLLNOSC_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_select_usb_clock_pll(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_select_usb_clock_pll(basePointer)
 #define SI32_USB_A_select_usb_clock_pll(basePointer) \
@@ -1951,8 +3403,19 @@ _SI32_USB_A_select_usb_clock_pll(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_select_usb_clock_external_oscillator(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CLKSEL.CLKSEL_BITS = SI32_USB_A_CLKSEL_CLKSEL_EXTOSCN_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_select_usb_clock_external_oscillator(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_select_usb_clock_external_oscillator(basePointer)
 #define SI32_USB_A_select_usb_clock_external_oscillator(basePointer) \
@@ -1964,8 +3427,19 @@ _SI32_USB_A_select_usb_clock_external_oscillator(SI32_USB_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_select_clock_divider_1(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CLKSEL.CLKDIV = SI32_USB_A_CLKSEL_CLKDIV_DIV1_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_select_clock_divider_1(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_select_clock_divider_1(basePointer)
 #define SI32_USB_A_select_clock_divider_1(basePointer) \
@@ -1977,8 +3451,19 @@ _SI32_USB_A_select_clock_divider_1(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_select_clock_divider_2(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CLKSEL.CLKDIV = SI32_USB_A_CLKSEL_CLKDIV_DIV2_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_select_clock_divider_2(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_select_clock_divider_2(basePointer)
 #define SI32_USB_A_select_clock_divider_2(basePointer) \
@@ -1990,8 +3475,19 @@ _SI32_USB_A_select_clock_divider_2(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_select_clock_divider_4(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CLKSEL.CLKDIV = SI32_USB_A_CLKSEL_CLKDIV_DIV4_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_select_clock_divider_4(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_select_clock_divider_4(basePointer)
 #define SI32_USB_A_select_clock_divider_4(basePointer) \
@@ -2003,8 +3499,19 @@ _SI32_USB_A_select_clock_divider_4(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_select_clock_divider_8(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CLKSEL.CLKDIV = SI32_USB_A_CLKSEL_CLKDIV_DIV8_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_select_clock_divider_8(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_select_clock_divider_8(basePointer)
 #define SI32_USB_A_select_clock_divider_8(basePointer) \
@@ -2016,8 +3523,19 @@ _SI32_USB_A_select_clock_divider_8(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_reset_module(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->CLKSEL.RESET = SI32_USB_A_CLKSEL_RESET_SET_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_reset_module(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_reset_module(basePointer)
 #define SI32_USB_A_reset_module(basePointer) \
@@ -2037,9 +3555,21 @@ _SI32_USB_A_reset_module(SI32_USB_A_Type* /*basePointer*/);
 ///  osccontrol
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_write_osccontrol(
+   SI32_USB_A_Type * basePointer,
+   uint32_t osccontrol)
+{
+   //{{
+   basePointer->OSCCONTROL.U32 = osccontrol;
+   //}}
+}
+#else
 void
 _SI32_USB_A_write_osccontrol(SI32_USB_A_Type* /*basePointer*/,
    uint32_t /*osccontrol*/);
+#endif
 ///
 /// @def SI32_USB_A_write_osccontrol(basePointer, osccontrol)
 #define SI32_USB_A_write_osccontrol(basePointer, osccontrol) \
@@ -2054,8 +3584,19 @@ _SI32_USB_A_write_osccontrol(SI32_USB_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USB_A_read_osccontrol(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return basePointer->OSCCONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_USB_A_read_osccontrol(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_read_osccontrol(basePointer)
 #define SI32_USB_A_read_osccontrol(basePointer) \
@@ -2071,8 +3612,19 @@ _SI32_USB_A_read_osccontrol(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_suspend_usb_oscillator(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->OSCCONTROL_SET = SI32_USB_A_OSCCONTROL_SUSPEND_MASK;
+   //}}
+}
+#else
 void
 _SI32_USB_A_suspend_usb_oscillator(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_suspend_usb_oscillator(basePointer)
 #define SI32_USB_A_suspend_usb_oscillator(basePointer) \
@@ -2087,8 +3639,19 @@ _SI32_USB_A_suspend_usb_oscillator(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_oscillator_ready(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->OSCCONTROL.SUSPEND);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_oscillator_ready(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_oscillator_ready(basePointer)
 #define SI32_USB_A_is_oscillator_ready(basePointer) \
@@ -2100,8 +3663,19 @@ _SI32_USB_A_is_oscillator_ready(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_enable_usb_oscillator(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->OSCCONTROL_SET = SI32_USB_A_OSCCONTROL_OSCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USB_A_enable_usb_oscillator(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_enable_usb_oscillator(basePointer)
 #define SI32_USB_A_enable_usb_oscillator(basePointer) \
@@ -2113,8 +3687,19 @@ _SI32_USB_A_enable_usb_oscillator(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_disable_usb_oscillator(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->OSCCONTROL_CLR = SI32_USB_A_OSCCONTROL_OSCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USB_A_disable_usb_oscillator(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_disable_usb_oscillator(basePointer)
 #define SI32_USB_A_disable_usb_oscillator(basePointer) \
@@ -2134,9 +3719,21 @@ _SI32_USB_A_disable_usb_oscillator(SI32_USB_A_Type* /*basePointer*/);
 ///  afadjust
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_write_afadjust(
+   SI32_USB_A_Type * basePointer,
+   uint32_t afadjust)
+{
+   //{{
+   basePointer->AFADJUST.U32 = afadjust;
+   //}}
+}
+#else
 void
 _SI32_USB_A_write_afadjust(SI32_USB_A_Type* /*basePointer*/,
    uint32_t /*afadjust*/);
+#endif
 ///
 /// @def SI32_USB_A_write_afadjust(basePointer, afadjust)
 #define SI32_USB_A_write_afadjust(basePointer, afadjust) \
@@ -2151,8 +3748,19 @@ _SI32_USB_A_write_afadjust(SI32_USB_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USB_A_read_afadjust(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return basePointer->AFADJUST.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_USB_A_read_afadjust(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_read_afadjust(basePointer)
 #define SI32_USB_A_read_afadjust(basePointer) \
@@ -2164,8 +3772,19 @@ _SI32_USB_A_read_afadjust(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_enable_oscillator_dither(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->AFADJUST_SET = SI32_USB_A_AFADJUST_DITHEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USB_A_enable_oscillator_dither(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_enable_oscillator_dither(basePointer)
 #define SI32_USB_A_enable_oscillator_dither(basePointer) \
@@ -2177,8 +3796,19 @@ _SI32_USB_A_enable_oscillator_dither(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_disable_oscillator_dither(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->AFADJUST_CLR = SI32_USB_A_AFADJUST_DITHEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_USB_A_disable_oscillator_dither(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_disable_oscillator_dither(basePointer)
 #define SI32_USB_A_disable_oscillator_dither(basePointer) \
@@ -2198,9 +3828,21 @@ _SI32_USB_A_disable_oscillator_dither(SI32_USB_A_Type* /*basePointer*/);
 ///  dmacontrol
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_write_dmacontrol(
+   SI32_USB_A_Type * basePointer,
+   uint32_t dmacontrol)
+{
+   //{{
+   basePointer->DMACONTROL.U32 = dmacontrol;
+   //}}
+}
+#else
 void
 _SI32_USB_A_write_dmacontrol(SI32_USB_A_Type* /*basePointer*/,
    uint32_t /*dmacontrol*/);
+#endif
 ///
 /// @def SI32_USB_A_write_dmacontrol(basePointer, dmacontrol)
 #define SI32_USB_A_write_dmacontrol(basePointer, dmacontrol) \
@@ -2215,8 +3857,19 @@ _SI32_USB_A_write_dmacontrol(SI32_USB_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USB_A_read_dmacontrol(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DMACONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_USB_A_read_dmacontrol(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_read_dmacontrol(basePointer)
 #define SI32_USB_A_read_dmacontrol(basePointer) \
@@ -2228,8 +3881,19 @@ _SI32_USB_A_read_dmacontrol(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_clear_dma_error(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->DMACONTROL.TERRF = SI32_USB_A_DMACONTROL_TERRF_NOT_SET_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_clear_dma_error(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_clear_dma_error(basePointer)
 #define SI32_USB_A_clear_dma_error(basePointer) \
@@ -2244,8 +3908,19 @@ _SI32_USB_A_clear_dma_error(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_dma_error_set(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->DMACONTROL.TERRF);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_dma_error_set(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_dma_error_set(basePointer)
 #define SI32_USB_A_is_dma_error_set(basePointer) \
@@ -2260,8 +3935,19 @@ _SI32_USB_A_is_dma_error_set(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_dma_busy(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->DMACONTROL.DBUSYF);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_dma_busy(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_dma_busy(basePointer)
 #define SI32_USB_A_is_dma_busy(basePointer) \
@@ -2273,8 +3959,19 @@ _SI32_USB_A_is_dma_busy(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_flush_dma_buffer(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->DMACONTROL.DFIFOFL = SI32_USB_A_DMACONTROL_DFIFOFL_SET_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_flush_dma_buffer(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_flush_dma_buffer(basePointer)
 #define SI32_USB_A_flush_dma_buffer(basePointer) \
@@ -2294,9 +3991,21 @@ _SI32_USB_A_flush_dma_buffer(SI32_USB_A_Type* /*basePointer*/);
 ///  ep0control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_write_ep0control(
+   SI32_USB_A_Type * basePointer,
+   uint32_t ep0control)
+{
+   //{{
+   basePointer->EP0CONTROL.U32 = ep0control;
+   //}}
+}
+#else
 void
 _SI32_USB_A_write_ep0control(SI32_USB_A_Type* /*basePointer*/,
    uint32_t /*ep0control*/);
+#endif
 ///
 /// @def SI32_USB_A_write_ep0control(basePointer, ep0control)
 #define SI32_USB_A_write_ep0control(basePointer, ep0control) \
@@ -2311,8 +4020,19 @@ _SI32_USB_A_write_ep0control(SI32_USB_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USB_A_read_ep0control(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return basePointer->EP0CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_USB_A_read_ep0control(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_read_ep0control(basePointer)
 #define SI32_USB_A_read_ep0control(basePointer) \
@@ -2327,8 +4047,19 @@ _SI32_USB_A_read_ep0control(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_out_packet_ready_ep0(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->EP0CONTROL.OPRDYI);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_out_packet_ready_ep0(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_out_packet_ready_ep0(basePointer)
 #define SI32_USB_A_is_out_packet_ready_ep0(basePointer) \
@@ -2344,8 +4075,19 @@ _SI32_USB_A_is_out_packet_ready_ep0(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_set_in_packet_ready_ep0(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->EP0CONTROL.IPRDYI = SI32_USB_A_EP0CONTROL_IPRDYI_SET_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_set_in_packet_ready_ep0(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_set_in_packet_ready_ep0(basePointer)
 #define SI32_USB_A_set_in_packet_ready_ep0(basePointer) \
@@ -2360,8 +4102,19 @@ _SI32_USB_A_set_in_packet_ready_ep0(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_stall_sent_ep0(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->EP0CONTROL.STSTLI);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_stall_sent_ep0(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_stall_sent_ep0(basePointer)
 #define SI32_USB_A_is_stall_sent_ep0(basePointer) \
@@ -2373,8 +4126,19 @@ _SI32_USB_A_is_stall_sent_ep0(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_clear_stall_sent_ep0(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->EP0CONTROL.STSTLI = SI32_USB_A_EP0CONTROL_STSTLI_NOT_SET_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_clear_stall_sent_ep0(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_clear_stall_sent_ep0(basePointer)
 #define SI32_USB_A_clear_stall_sent_ep0(basePointer) \
@@ -2386,8 +4150,19 @@ _SI32_USB_A_clear_stall_sent_ep0(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_set_data_end_ep0(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->EP0CONTROL.DEND = SI32_USB_A_EP0CONTROL_DEND_SET_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_set_data_end_ep0(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_set_data_end_ep0(basePointer)
 #define SI32_USB_A_set_data_end_ep0(basePointer) \
@@ -2399,8 +4174,19 @@ _SI32_USB_A_set_data_end_ep0(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_USB_A_is_setup_end_early_ep0(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->EP0CONTROL.SUENDI);
+   //}}
+}
+#else
 bool
 _SI32_USB_A_is_setup_end_early_ep0(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_is_setup_end_early_ep0(basePointer)
 #define SI32_USB_A_is_setup_end_early_ep0(basePointer) \
@@ -2412,8 +4198,19 @@ _SI32_USB_A_is_setup_end_early_ep0(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_send_stall_ep0(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->EP0CONTROL.SDSTL = SI32_USB_A_EP0CONTROL_SDSTL_SET_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_send_stall_ep0(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_send_stall_ep0(basePointer)
 #define SI32_USB_A_send_stall_ep0(basePointer) \
@@ -2428,8 +4225,19 @@ _SI32_USB_A_send_stall_ep0(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_clear_out_packet_ready_ep0(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->EP0CONTROL.OPRDYIS = SI32_USB_A_EP0CONTROL_OPRDYIS_SET_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_clear_out_packet_ready_ep0(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_clear_out_packet_ready_ep0(basePointer)
 #define SI32_USB_A_clear_out_packet_ready_ep0(basePointer) \
@@ -2444,8 +4252,19 @@ _SI32_USB_A_clear_out_packet_ready_ep0(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_clear_setup_end_early_ep0(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   basePointer->EP0CONTROL.SUENDIS = SI32_USB_A_EP0CONTROL_SUENDIS_SET_VALUE;
+   //}}
+}
+#else
 void
 _SI32_USB_A_clear_setup_end_early_ep0(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_clear_setup_end_early_ep0(basePointer)
 #define SI32_USB_A_clear_setup_end_early_ep0(basePointer) \
@@ -2460,8 +4279,19 @@ _SI32_USB_A_clear_setup_end_early_ep0(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USB_A_read_ep0_count(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return (uint32_t)(basePointer->EP0COUNT.U32);
+   //}}
+}
+#else
 uint32_t
 _SI32_USB_A_read_ep0_count(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_read_ep0_count(basePointer)
 #define SI32_USB_A_read_ep0_count(basePointer) \
@@ -2480,9 +4310,21 @@ _SI32_USB_A_read_ep0_count(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  dataval
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_write_ep0_fifo_u32(
+   SI32_USB_A_Type * basePointer,
+   uint32_t dataval)
+{
+   //{{
+   basePointer->EP0FIFO.U32 = dataval;
+   //}}
+}
+#else
 void
 _SI32_USB_A_write_ep0_fifo_u32(SI32_USB_A_Type* /*basePointer*/,
    uint32_t /*dataval*/);
+#endif
 ///
 /// @def SI32_USB_A_write_ep0_fifo_u32(basePointer, dataval)
 #define SI32_USB_A_write_ep0_fifo_u32(basePointer, dataval) \
@@ -2501,9 +4343,21 @@ _SI32_USB_A_write_ep0_fifo_u32(SI32_USB_A_Type* /*basePointer*/,
 /// @param[in]
 ///  dataval
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_write_ep0_fifo_u16(
+   SI32_USB_A_Type * basePointer,
+   uint16_t dataval)
+{
+   //{{
+   basePointer->EP0FIFO.U16 = dataval;
+   //}}
+}
+#else
 void
 _SI32_USB_A_write_ep0_fifo_u16(SI32_USB_A_Type* /*basePointer*/,
    uint16_t /*dataval*/);
+#endif
 ///
 /// @def SI32_USB_A_write_ep0_fifo_u16(basePointer, dataval)
 #define SI32_USB_A_write_ep0_fifo_u16(basePointer, dataval) \
@@ -2522,9 +4376,21 @@ _SI32_USB_A_write_ep0_fifo_u16(SI32_USB_A_Type* /*basePointer*/,
 /// @param[in]
 ///  dataval
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_USB_A_write_ep0_fifo_u8(
+   SI32_USB_A_Type * basePointer,
+   uint8_t dataval)
+{
+   //{{
+   basePointer->EP0FIFO.U8 = dataval;
+   //}}
+}
+#else
 void
 _SI32_USB_A_write_ep0_fifo_u8(SI32_USB_A_Type* /*basePointer*/,
    uint8_t /*dataval*/);
+#endif
 ///
 /// @def SI32_USB_A_write_ep0_fifo_u8(basePointer, dataval)
 #define SI32_USB_A_write_ep0_fifo_u8(basePointer, dataval) \
@@ -2539,8 +4405,19 @@ _SI32_USB_A_write_ep0_fifo_u8(SI32_USB_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_USB_A_read_ep0_fifo_u32(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return (basePointer->EP0FIFO.U32);
+   //}}
+}
+#else
 uint32_t
 _SI32_USB_A_read_ep0_fifo_u32(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_read_ep0_fifo_u32(basePointer)
 #define SI32_USB_A_read_ep0_fifo_u32(basePointer) \
@@ -2555,8 +4432,19 @@ _SI32_USB_A_read_ep0_fifo_u32(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint16_t
+_SI32_USB_A_read_ep0_fifo_u16(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return (basePointer->EP0FIFO.U16);
+   //}}
+}
+#else
 uint16_t
 _SI32_USB_A_read_ep0_fifo_u16(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_read_ep0_fifo_u16(basePointer)
 #define SI32_USB_A_read_ep0_fifo_u16(basePointer) \
@@ -2571,8 +4459,19 @@ _SI32_USB_A_read_ep0_fifo_u16(SI32_USB_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint8_t
+_SI32_USB_A_read_ep0_fifo_u8(
+   SI32_USB_A_Type * basePointer)
+{
+   //{{
+   return (basePointer->EP0FIFO.U8);
+   //}}
+}
+#else
 uint8_t
 _SI32_USB_A_read_ep0_fifo_u8(SI32_USB_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_USB_A_read_ep0_fifo_u8(basePointer)
 #define SI32_USB_A_read_ep0_fifo_u8(basePointer) \
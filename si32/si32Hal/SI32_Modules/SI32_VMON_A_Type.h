@@ -53,9 +53,21 @@ extern "C" {
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VMON_A_initialize(
+   SI32_VMON_A_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+	basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_VMON_A_initialize(SI32_VMON_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_VMON_A_initialize(basePointer, control)
 #define SI32_VMON_A_initialize(basePointer, control) \
@@ -75,9 +87,21 @@ _SI32_VMON_A_initialize(SI32_VMON_A_Type* /*basePointer*/,
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VMON_A_write_control(
+   SI32_VMON_A_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_VMON_A_write_control(SI32_VMON_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_VMON_A_write_control(basePointer, control)
 #define SI32_VMON_A_write_control(basePointer, control) \
@@ -92,8 +116,19 @@ _SI32_VMON_A_write_control(SI32_VMON_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_VMON_A_read_control(
+   SI32_VMON_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_VMON_A_read_control(SI32_VMON_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VMON_A_read_control(basePointer)
 #define SI32_VMON_A_read_control(basePointer) \
@@ -105,8 +140,19 @@ _SI32_VMON_A_read_control(SI32_VMON_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VMON_A_enable_vreg_supply_monitor(
+   SI32_VMON_A_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_SET = SI32_VMON_A_CONTROL_VREGINSEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_VMON_A_enable_vreg_supply_monitor(SI32_VMON_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VMON_A_enable_vreg_supply_monitor(basePointer)
 #define SI32_VMON_A_enable_vreg_supply_monitor(basePointer) \
@@ -118,8 +164,19 @@ _SI32_VMON_A_enable_vreg_supply_monitor(SI32_VMON_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VMON_A_disable_vreg_supply_monitor(
+   SI32_VMON_A_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_VMON_A_CONTROL_VREGINSEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_VMON_A_disable_vreg_supply_monitor(SI32_VMON_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VMON_A_disable_vreg_supply_monitor(basePointer)
 #define SI32_VMON_A_disable_vreg_supply_monitor(basePointer) \
@@ -131,8 +188,19 @@ _SI32_VMON_A_disable_vreg_supply_monitor(SI32_VMON_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_VMON_A_is_vreg_low_interrupt_pending(
+   SI32_VMON_A_Type * basePointer)
+{
+   //{{
+	return !(bool)(basePointer->CONTROL.VREGINLI);
+   //}}
+}
+#else
 bool
 _SI32_VMON_A_is_vreg_low_interrupt_pending(SI32_VMON_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VMON_A_is_vreg_low_interrupt_pending(basePointer)
 #define SI32_VMON_A_is_vreg_low_interrupt_pending(basePointer) \
@@ -144,8 +212,19 @@ _SI32_VMON_A_is_vreg_low_interrupt_pending(SI32_VMON_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_VMON_A_is_vdd_above_reset_threshold(
+   SI32_VMON_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.VDDRSTF);
+   //}}
+}
+#else
 bool
 _SI32_VMON_A_is_vdd_above_reset_threshold(SI32_VMON_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VMON_A_is_vdd_above_reset_threshold(basePointer)
 #define SI32_VMON_A_is_vdd_above_reset_threshold(basePointer) \
@@ -157,8 +236,19 @@ _SI32_VMON_A_is_vdd_above_reset_threshold(SI32_VMON_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_VMON_A_is_vdd_low_interrupt_pending(
+   SI32_VMON_A_Type * basePointer)
+{
+   //{{
+	return !(bool)(basePointer->CONTROL.VDDLI);
+   //}}
+}
+#else
 bool
 _SI32_VMON_A_is_vdd_low_interrupt_pending(SI32_VMON_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VMON_A_is_vdd_low_interrupt_pending(basePointer)
 #define SI32_VMON_A_is_vdd_low_interrupt_pending(basePointer) \
@@ -170,8 +260,19 @@ _SI32_VMON_A_is_vdd_low_interrupt_pending(SI32_VMON_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VMON_A_select_vdd_high_threshold(
+   SI32_VMON_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_VMON_A_CONTROL_VDDHITHEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_VMON_A_select_vdd_high_threshold(SI32_VMON_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VMON_A_select_vdd_high_threshold(basePointer)
 #define SI32_VMON_A_select_vdd_high_threshold(basePointer) \
@@ -183,8 +284,19 @@ _SI32_VMON_A_select_vdd_high_threshold(SI32_VMON_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VMON_A_select_vdd_standard_threshold(
+   SI32_VMON_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_VMON_A_CONTROL_VDDHITHEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_VMON_A_select_vdd_standard_threshold(SI32_VMON_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VMON_A_select_vdd_standard_threshold(basePointer)
 #define SI32_VMON_A_select_vdd_standard_threshold(basePointer) \
@@ -196,8 +308,19 @@ _SI32_VMON_A_select_vdd_standard_threshold(SI32_VMON_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VMON_A_enable_vdd_low_interrupt(
+   SI32_VMON_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_VMON_A_CONTROL_VDDLIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_VMON_A_enable_vdd_low_interrupt(SI32_VMON_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VMON_A_enable_vdd_low_interrupt(basePointer)
 #define SI32_VMON_A_enable_vdd_low_interrupt(basePointer) \
@@ -209,8 +332,19 @@ _SI32_VMON_A_enable_vdd_low_interrupt(SI32_VMON_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VMON_A_disable_vdd_low_interrupt(
+   SI32_VMON_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_VMON_A_CONTROL_VDDLIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_VMON_A_disable_vdd_low_interrupt(SI32_VMON_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VMON_A_disable_vdd_low_interrupt(basePointer)
 #define SI32_VMON_A_disable_vdd_low_interrupt(basePointer) \
@@ -222,8 +356,19 @@ _SI32_VMON_A_disable_vdd_low_interrupt(SI32_VMON_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_VMON_A_is_vdd_low_interrupt_enabled(
+   SI32_VMON_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.VDDLIEN);
+   //}}
+}
+#else
 bool
 _SI32_VMON_A_is_vdd_low_interrupt_enabled(SI32_VMON_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VMON_A_is_vdd_low_interrupt_enabled(basePointer)
 #define SI32_VMON_A_is_vdd_low_interrupt_enabled(basePointer) \
@@ -235,8 +380,19 @@ _SI32_VMON_A_is_vdd_low_interrupt_enabled(SI32_VMON_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VMON_A_enable_vreg_low_interrupt(
+   SI32_VMON_A_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_SET = SI32_VMON_A_CONTROL_VREGINLIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_VMON_A_enable_vreg_low_interrupt(SI32_VMON_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VMON_A_enable_vreg_low_interrupt(basePointer)
 #define SI32_VMON_A_enable_vreg_low_interrupt(basePointer) \
@@ -248,8 +404,19 @@ _SI32_VMON_A_enable_vreg_low_interrupt(SI32_VMON_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VMON_A_disable_vreg_low_interrupt(
+   SI32_VMON_A_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_VMON_A_CONTROL_VREGINLIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_VMON_A_disable_vreg_low_interrupt(SI32_VMON_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VMON_A_disable_vreg_low_interrupt(basePointer)
 #define SI32_VMON_A_disable_vreg_low_interrupt(basePointer) \
@@ -261,8 +428,19 @@ _SI32_VMON_A_disable_vreg_low_interrupt(SI32_VMON_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_VMON_A_is_vreg_low_interrupt_enabled(
+   SI32_VMON_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.VREGINLIEN);
+   //}}
+}
+#else
 bool
 _SI32_VMON_A_is_vreg_low_interrupt_enabled(SI32_VMON_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VMON_A_is_vreg_low_interrupt_enabled(basePointer)
 #define SI32_VMON_A_is_vreg_low_interrupt_enabled(basePointer) \
@@ -274,8 +452,19 @@ _SI32_VMON_A_is_vreg_low_interrupt_enabled(SI32_VMON_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VMON_A_enable_vdd_supply_monitor(
+   SI32_VMON_A_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_SET = SI32_VMON_A_CONTROL_VMONEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_VMON_A_enable_vdd_supply_monitor(SI32_VMON_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VMON_A_enable_vdd_supply_monitor(basePointer)
 #define SI32_VMON_A_enable_vdd_supply_monitor(basePointer) \
@@ -287,8 +476,19 @@ _SI32_VMON_A_enable_vdd_supply_monitor(SI32_VMON_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VMON_A_disable_vdd_supply_monitor(
+   SI32_VMON_A_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL_CLR = SI32_VMON_A_CONTROL_VMONEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_VMON_A_disable_vdd_supply_monitor(SI32_VMON_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VMON_A_disable_vdd_supply_monitor(basePointer)
 #define SI32_VMON_A_disable_vdd_supply_monitor(basePointer) \
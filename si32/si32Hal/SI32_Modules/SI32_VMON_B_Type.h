@@ -53,9 +53,21 @@ extern "C" {
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VMON_B_initialize(
+   SI32_VMON_B_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_VMON_B_initialize(SI32_VMON_B_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_VMON_B_initialize(basePointer, control)
 #define SI32_VMON_B_initialize(basePointer, control) \
@@ -75,9 +87,21 @@ _SI32_VMON_B_initialize(SI32_VMON_B_Type* /*basePointer*/,
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VMON_B_write_control(
+   SI32_VMON_B_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_VMON_B_write_control(SI32_VMON_B_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_VMON_B_write_control(basePointer, control)
 #define SI32_VMON_B_write_control(basePointer, control) \
@@ -92,8 +116,19 @@ _SI32_VMON_B_write_control(SI32_VMON_B_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_VMON_B_read_control(
+   SI32_VMON_B_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_VMON_B_read_control(SI32_VMON_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VMON_B_read_control(basePointer)
 #define SI32_VMON_B_read_control(basePointer) \
@@ -105,8 +140,19 @@ _SI32_VMON_B_read_control(SI32_VMON_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_VMON_B_is_vbat_above_reset_threshold(
+   SI32_VMON_B_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.VBATRSTF;
+   //}}
+}
+#else
 bool
 _SI32_VMON_B_is_vbat_above_reset_threshold(SI32_VMON_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VMON_B_is_vbat_above_reset_threshold(basePointer)
 #define SI32_VMON_B_is_vbat_above_reset_threshold(basePointer) \
@@ -118,8 +164,19 @@ _SI32_VMON_B_is_vbat_above_reset_threshold(SI32_VMON_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_VMON_B_is_vbat_low_interrupt_pending(
+   SI32_VMON_B_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.VBATLI;
+   //}}
+}
+#else
 bool
 _SI32_VMON_B_is_vbat_low_interrupt_pending(SI32_VMON_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VMON_B_is_vbat_low_interrupt_pending(basePointer)
 #define SI32_VMON_B_is_vbat_low_interrupt_pending(basePointer) \
@@ -131,8 +188,19 @@ _SI32_VMON_B_is_vbat_low_interrupt_pending(SI32_VMON_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VMON_B_select_vbat_high_threshold(
+   SI32_VMON_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_VMON_B_CONTROL_VBATHITHEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_VMON_B_select_vbat_high_threshold(SI32_VMON_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VMON_B_select_vbat_high_threshold(basePointer)
 #define SI32_VMON_B_select_vbat_high_threshold(basePointer) \
@@ -144,8 +212,19 @@ _SI32_VMON_B_select_vbat_high_threshold(SI32_VMON_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VMON_B_select_vbat_standard_threshold(
+   SI32_VMON_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_VMON_B_CONTROL_VBATHITHEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_VMON_B_select_vbat_standard_threshold(SI32_VMON_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VMON_B_select_vbat_standard_threshold(basePointer)
 #define SI32_VMON_B_select_vbat_standard_threshold(basePointer) \
@@ -157,8 +236,19 @@ _SI32_VMON_B_select_vbat_standard_threshold(SI32_VMON_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VMON_B_enable_vbat_low_interrupt(
+   SI32_VMON_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_VMON_B_CONTROL_VBATLIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_VMON_B_enable_vbat_low_interrupt(SI32_VMON_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VMON_B_enable_vbat_low_interrupt(basePointer)
 #define SI32_VMON_B_enable_vbat_low_interrupt(basePointer) \
@@ -170,8 +260,19 @@ _SI32_VMON_B_enable_vbat_low_interrupt(SI32_VMON_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VMON_B_disable_vbat_low_interrupt(
+   SI32_VMON_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_VMON_B_CONTROL_VBATLIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_VMON_B_disable_vbat_low_interrupt(SI32_VMON_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VMON_B_disable_vbat_low_interrupt(basePointer)
 #define SI32_VMON_B_disable_vbat_low_interrupt(basePointer) \
@@ -183,8 +284,19 @@ _SI32_VMON_B_disable_vbat_low_interrupt(SI32_VMON_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_VMON_B_is_vbat_low_interrupt_enabled(
+   SI32_VMON_B_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.VBATLIEN;
+   //}}
+}
+#else
 bool
 _SI32_VMON_B_is_vbat_low_interrupt_enabled(SI32_VMON_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VMON_B_is_vbat_low_interrupt_enabled(basePointer)
 #define SI32_VMON_B_is_vbat_low_interrupt_enabled(basePointer) \
@@ -196,8 +308,19 @@ _SI32_VMON_B_is_vbat_low_interrupt_enabled(SI32_VMON_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VMON_B_enable_vbat_supply_monitor(
+   SI32_VMON_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_VMON_B_CONTROL_VMONEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_VMON_B_enable_vbat_supply_monitor(SI32_VMON_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VMON_B_enable_vbat_supply_monitor(basePointer)
 #define SI32_VMON_B_enable_vbat_supply_monitor(basePointer) \
@@ -209,8 +332,19 @@ _SI32_VMON_B_enable_vbat_supply_monitor(SI32_VMON_B_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VMON_B_disable_vbat_supply_monitor(
+   SI32_VMON_B_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_VMON_B_CONTROL_VMONEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_VMON_B_disable_vbat_supply_monitor(SI32_VMON_B_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VMON_B_disable_vbat_supply_monitor(basePointer)
 #define SI32_VMON_B_disable_vbat_supply_monitor(basePointer) \
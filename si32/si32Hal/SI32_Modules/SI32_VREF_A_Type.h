@@ -53,9 +53,21 @@ extern "C" {
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VREF_A_initialize(
+   SI32_VREF_A_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_VREF_A_initialize(SI32_VREF_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_VREF_A_initialize(basePointer, control)
 #define SI32_VREF_A_initialize(basePointer, control) \
@@ -75,9 +87,21 @@ _SI32_VREF_A_initialize(SI32_VREF_A_Type* /*basePointer*/,
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VREF_A_write_control(
+   SI32_VREF_A_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_VREF_A_write_control(SI32_VREF_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_VREF_A_write_control(basePointer, control)
 #define SI32_VREF_A_write_control(basePointer, control) \
@@ -92,8 +116,19 @@ _SI32_VREF_A_write_control(SI32_VREF_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_VREF_A_read_control(
+   SI32_VREF_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_VREF_A_read_control(SI32_VREF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VREF_A_read_control(basePointer)
 #define SI32_VREF_A_read_control(basePointer) \
@@ -105,8 +140,19 @@ _SI32_VREF_A_read_control(SI32_VREF_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VREF_A_select_1p2_volts(
+   SI32_VREF_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_VREF_A_CONTROL_VREF2X_MASK;
+   //}}
+}
+#else
 void
 _SI32_VREF_A_select_1p2_volts(SI32_VREF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VREF_A_select_1p2_volts(basePointer)
 #define SI32_VREF_A_select_1p2_volts(basePointer) \
@@ -118,8 +164,19 @@ _SI32_VREF_A_select_1p2_volts(SI32_VREF_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VREF_A_select_2p4_volts(
+   SI32_VREF_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_VREF_A_CONTROL_VREF2X_MASK;
+   //}}
+}
+#else
 void
 _SI32_VREF_A_select_2p4_volts(SI32_VREF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VREF_A_select_2p4_volts(basePointer)
 #define SI32_VREF_A_select_2p4_volts(basePointer) \
@@ -131,8 +188,19 @@ _SI32_VREF_A_select_2p4_volts(SI32_VREF_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VREF_A_enable_temperature_sensor(
+   SI32_VREF_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_VREF_A_CONTROL_TEMPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_VREF_A_enable_temperature_sensor(SI32_VREF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VREF_A_enable_temperature_sensor(basePointer)
 #define SI32_VREF_A_enable_temperature_sensor(basePointer) \
@@ -144,8 +212,19 @@ _SI32_VREF_A_enable_temperature_sensor(SI32_VREF_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VREF_A_disable_temperature_sensor(
+   SI32_VREF_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_VREF_A_CONTROL_TEMPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_VREF_A_disable_temperature_sensor(SI32_VREF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VREF_A_disable_temperature_sensor(basePointer)
 #define SI32_VREF_A_disable_temperature_sensor(basePointer) \
@@ -157,8 +236,19 @@ _SI32_VREF_A_disable_temperature_sensor(SI32_VREF_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VREF_A_enable_voltage_reference(
+   SI32_VREF_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_VREF_A_CONTROL_VREFEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_VREF_A_enable_voltage_reference(SI32_VREF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VREF_A_enable_voltage_reference(basePointer)
 #define SI32_VREF_A_enable_voltage_reference(basePointer) \
@@ -170,8 +260,19 @@ _SI32_VREF_A_enable_voltage_reference(SI32_VREF_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VREF_A_disable_voltage_reference(
+   SI32_VREF_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_VREF_A_CONTROL_VREFEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_VREF_A_disable_voltage_reference(SI32_VREF_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VREF_A_disable_voltage_reference(basePointer)
 #define SI32_VREF_A_disable_voltage_reference(basePointer) \
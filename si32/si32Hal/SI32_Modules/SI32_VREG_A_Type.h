@@ -53,9 +53,21 @@ extern "C" {
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VREG_A_initialize(
+   SI32_VREG_A_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_VREG_A_initialize(SI32_VREG_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_VREG_A_initialize(basePointer, control)
 #define SI32_VREG_A_initialize(basePointer, control) \
@@ -75,9 +87,21 @@ _SI32_VREG_A_initialize(SI32_VREG_A_Type* /*basePointer*/,
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VREG_A_write_control(
+   SI32_VREG_A_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_VREG_A_write_control(SI32_VREG_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_VREG_A_write_control(basePointer, control)
 #define SI32_VREG_A_write_control(basePointer, control) \
@@ -92,8 +116,19 @@ _SI32_VREG_A_write_control(SI32_VREG_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_VREG_A_read_control(
+   SI32_VREG_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_VREG_A_read_control(SI32_VREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VREG_A_read_control(basePointer)
 #define SI32_VREG_A_read_control(basePointer) \
@@ -105,8 +140,19 @@ _SI32_VREG_A_read_control(SI32_VREG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_VREG_A_is_vbus_valid(
+   SI32_VREG_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.VBUSVLDF;
+   //}}
+}
+#else
 bool
 _SI32_VREG_A_is_vbus_valid(SI32_VREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VREG_A_is_vbus_valid(basePointer)
 #define SI32_VREG_A_is_vbus_valid(basePointer) \
@@ -118,8 +164,19 @@ _SI32_VREG_A_is_vbus_valid(SI32_VREG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VREG_A_enter_suspend_mode(
+   SI32_VREG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_VREG_A_CONTROL_SUSEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_VREG_A_enter_suspend_mode(SI32_VREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VREG_A_enter_suspend_mode(basePointer)
 #define SI32_VREG_A_enter_suspend_mode(basePointer) \
@@ -131,8 +188,19 @@ _SI32_VREG_A_enter_suspend_mode(SI32_VREG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VREG_A_exit_suspend_mode(
+   SI32_VREG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_VREG_A_CONTROL_SUSEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_VREG_A_exit_suspend_mode(SI32_VREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VREG_A_exit_suspend_mode(basePointer)
 #define SI32_VREG_A_exit_suspend_mode(basePointer) \
@@ -144,8 +212,19 @@ _SI32_VREG_A_exit_suspend_mode(SI32_VREG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VREG_A_enable_band_gap(
+   SI32_VREG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_VREG_A_CONTROL_BGDIS_MASK;
+   //}}
+}
+#else
 void
 _SI32_VREG_A_enable_band_gap(SI32_VREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VREG_A_enable_band_gap(basePointer)
 #define SI32_VREG_A_enable_band_gap(basePointer) \
@@ -157,8 +236,19 @@ _SI32_VREG_A_enable_band_gap(SI32_VREG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VREG_A_disable_band_gap(
+   SI32_VREG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_VREG_A_CONTROL_BGDIS_ACTIVE_U32;
+   //}}
+}
+#else
 void
 _SI32_VREG_A_disable_band_gap(SI32_VREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VREG_A_disable_band_gap(basePointer)
 #define SI32_VREG_A_disable_band_gap(basePointer) \
@@ -170,8 +260,19 @@ _SI32_VREG_A_disable_band_gap(SI32_VREG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VREG_A_enable_vreg_sense(
+   SI32_VREG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_VREG_A_CONTROL_SENSEEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_VREG_A_enable_vreg_sense(SI32_VREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VREG_A_enable_vreg_sense(basePointer)
 #define SI32_VREG_A_enable_vreg_sense(basePointer) \
@@ -183,8 +284,19 @@ _SI32_VREG_A_enable_vreg_sense(SI32_VREG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VREG_A_disable_vreg_sense(
+   SI32_VREG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_VREG_A_CONTROL_SENSEEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_VREG_A_disable_vreg_sense(SI32_VREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VREG_A_disable_vreg_sense(basePointer)
 #define SI32_VREG_A_disable_vreg_sense(basePointer) \
@@ -196,8 +308,19 @@ _SI32_VREG_A_disable_vreg_sense(SI32_VREG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_VREG_A_is_vbus_invalid_interrupt_pending(
+   SI32_VREG_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.VBUSIVLDI);
+   //}}
+}
+#else
 bool
 _SI32_VREG_A_is_vbus_invalid_interrupt_pending(SI32_VREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VREG_A_is_vbus_invalid_interrupt_pending(basePointer)
 #define SI32_VREG_A_is_vbus_invalid_interrupt_pending(basePointer) \
@@ -209,8 +332,19 @@ _SI32_VREG_A_is_vbus_invalid_interrupt_pending(SI32_VREG_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VREG_A_clear_vbus_invalid_interrupt(
+   SI32_VREG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_VREG_A_CONTROL_VBUSIVLDI_MASK;
+   //}}
+}
+#else
 void
 _SI32_VREG_A_clear_vbus_invalid_interrupt(SI32_VREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VREG_A_clear_vbus_invalid_interrupt(basePointer)
 #define SI32_VREG_A_clear_vbus_invalid_interrupt(basePointer) \
@@ -222,8 +356,19 @@ _SI32_VREG_A_clear_vbus_invalid_interrupt(SI32_VREG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VREG_A_enable_vbus_invalid_interrupt(
+   SI32_VREG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_VREG_A_CONTROL_VBUSIVLDIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_VREG_A_enable_vbus_invalid_interrupt(SI32_VREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VREG_A_enable_vbus_invalid_interrupt(basePointer)
 #define SI32_VREG_A_enable_vbus_invalid_interrupt(basePointer) \
@@ -235,8 +380,19 @@ _SI32_VREG_A_enable_vbus_invalid_interrupt(SI32_VREG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VREG_A_disable_vbus_invalid_interrupt(
+   SI32_VREG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_VREG_A_CONTROL_VBUSIVLDIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_VREG_A_disable_vbus_invalid_interrupt(SI32_VREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VREG_A_disable_vbus_invalid_interrupt(basePointer)
 #define SI32_VREG_A_disable_vbus_invalid_interrupt(basePointer) \
@@ -248,8 +404,19 @@ _SI32_VREG_A_disable_vbus_invalid_interrupt(SI32_VREG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_VREG_A_is_vbus_invalid_interrupt_enabled(
+   SI32_VREG_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.VBUSIVLDIEN);
+   //}}
+}
+#else
 bool
 _SI32_VREG_A_is_vbus_invalid_interrupt_enabled(SI32_VREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VREG_A_is_vbus_invalid_interrupt_enabled(basePointer)
 #define SI32_VREG_A_is_vbus_invalid_interrupt_enabled(basePointer) \
@@ -261,8 +428,19 @@ _SI32_VREG_A_is_vbus_invalid_interrupt_enabled(SI32_VREG_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VREG_A_enable_voltage_regulator(
+   SI32_VREG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_VREG_A_CONTROL_VREGDIS_MASK;
+   //}}
+}
+#else
 void
 _SI32_VREG_A_enable_voltage_regulator(SI32_VREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VREG_A_enable_voltage_regulator(basePointer)
 #define SI32_VREG_A_enable_voltage_regulator(basePointer) \
@@ -274,8 +452,19 @@ _SI32_VREG_A_enable_voltage_regulator(SI32_VREG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_VREG_A_disable_voltage_regulator(
+   SI32_VREG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_VREG_A_CONTROL_VREGDIS_ACTIVE_U32;
+   //}}
+}
+#else
 void
 _SI32_VREG_A_disable_voltage_regulator(SI32_VREG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_VREG_A_disable_voltage_regulator(basePointer)
 #define SI32_VREG_A_disable_voltage_regulator(basePointer) \
@@ -57,10 +57,30 @@ extern "C" {
 ///  Valid range is 32 bits.
 ///  Write to THRESHOLD register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_WDTIMER_A_initialize(
+   SI32_WDTIMER_A_Type * basePointer,
+   // Write to CONTROL register.
+   uint32_t control,
+   // Write to THRESHOLD register.
+   uint32_t threshold)
+{
+   //{{
+   basePointer->WDTKEY.U32 = SI32_WDTIMER_A_WDTKEY_KEY_ATTN_U32;
+   basePointer->WDTKEY.U32 = SI32_WDTIMER_A_WDTKEY_KEY_WRITE_U32;
+   basePointer->CONTROL.U32 = control;
+   basePointer->WDTKEY.U32 = SI32_WDTIMER_A_WDTKEY_KEY_ATTN_U32;
+   basePointer->WDTKEY.U32 = SI32_WDTIMER_A_WDTKEY_KEY_WRITE_U32;
+   basePointer->THRESHOLD.U32 = threshold;
+   //}}
+}
+#else
 void
 _SI32_WDTIMER_A_initialize(SI32_WDTIMER_A_Type* /*basePointer*/,
    uint32_t, /*control*/
    uint32_t /*threshold*/);
+#endif
 ///
 /// @def SI32_WDTIMER_A_initialize(basePointer, control, threshold)
 #define SI32_WDTIMER_A_initialize(basePointer, control, threshold) do{  \
@@ -86,9 +106,23 @@ _SI32_WDTIMER_A_initialize(SI32_WDTIMER_A_Type* /*basePointer*/,
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_WDTIMER_A_write_control(
+   SI32_WDTIMER_A_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+	basePointer->WDTKEY.U32 = SI32_WDTIMER_A_WDTKEY_KEY_ATTN_U32;
+   basePointer->WDTKEY.U32 = SI32_WDTIMER_A_WDTKEY_KEY_WRITE_U32;
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_WDTIMER_A_write_control(SI32_WDTIMER_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_WDTIMER_A_write_control(basePointer, control)
 #define SI32_WDTIMER_A_write_control(basePointer, control) do{  \
@@ -106,8 +140,19 @@ _SI32_WDTIMER_A_write_control(SI32_WDTIMER_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_WDTIMER_A_read_control(
+   SI32_WDTIMER_A_Type * basePointer)
+{
+   //{{
+	return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_WDTIMER_A_read_control(SI32_WDTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_WDTIMER_A_read_control(basePointer)
 #define SI32_WDTIMER_A_read_control(basePointer) \
@@ -119,8 +164,21 @@ _SI32_WDTIMER_A_read_control(SI32_WDTIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_WDTIMER_A_enable_early_warning_interrupt(
+   SI32_WDTIMER_A_Type * basePointer)
+{
+   //{{
+	basePointer->WDTKEY.U32 = SI32_WDTIMER_A_WDTKEY_KEY_ATTN_U32;
+   basePointer->WDTKEY.U32 = SI32_WDTIMER_A_WDTKEY_KEY_WRITE_U32;
+   basePointer->CONTROL_SET = SI32_WDTIMER_A_CONTROL_EWIEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_WDTIMER_A_enable_early_warning_interrupt(SI32_WDTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_WDTIMER_A_enable_early_warning_interrupt(basePointer)
 #define SI32_WDTIMER_A_enable_early_warning_interrupt(basePointer) do{  \
@@ -135,8 +193,21 @@ _SI32_WDTIMER_A_enable_early_warning_interrupt(SI32_WDTIMER_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_WDTIMER_A_disable_early_warning_interrupt(
+   SI32_WDTIMER_A_Type * basePointer)
+{
+   //{{
+	basePointer->WDTKEY.U32 = SI32_WDTIMER_A_WDTKEY_KEY_ATTN_U32;
+   basePointer->WDTKEY.U32 = SI32_WDTIMER_A_WDTKEY_KEY_WRITE_U32;
+   basePointer->CONTROL_CLR = SI32_WDTIMER_A_CONTROL_EWIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_WDTIMER_A_disable_early_warning_interrupt(SI32_WDTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_WDTIMER_A_disable_early_warning_interrupt(basePointer)
 #define SI32_WDTIMER_A_disable_early_warning_interrupt(basePointer) do{  \
@@ -151,8 +222,19 @@ _SI32_WDTIMER_A_disable_early_warning_interrupt(SI32_WDTIMER_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_WDTIMER_A_is_early_warning_interrupt_enabled(
+   SI32_WDTIMER_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->CONTROL.EWIEN);
+   //}}
+}
+#else
 bool
 _SI32_WDTIMER_A_is_early_warning_interrupt_enabled(SI32_WDTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_WDTIMER_A_is_early_warning_interrupt_enabled(basePointer)
 #define SI32_WDTIMER_A_is_early_warning_interrupt_enabled(basePointer) \
@@ -164,8 +246,21 @@ _SI32_WDTIMER_A_is_early_warning_interrupt_enabled(SI32_WDTIMER_A_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_WDTIMER_A_enable_stall_in_debug_mode(
+   SI32_WDTIMER_A_Type * basePointer)
+{
+   //{{
+	basePointer->WDTKEY.U32 = SI32_WDTIMER_A_WDTKEY_KEY_ATTN_U32;
+   basePointer->WDTKEY.U32 = SI32_WDTIMER_A_WDTKEY_KEY_WRITE_U32;
+   basePointer->CONTROL_SET = SI32_WDTIMER_A_CONTROL_DBGMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_WDTIMER_A_enable_stall_in_debug_mode(SI32_WDTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_WDTIMER_A_enable_stall_in_debug_mode(basePointer)
 #define SI32_WDTIMER_A_enable_stall_in_debug_mode(basePointer) do{  \
@@ -180,8 +275,21 @@ _SI32_WDTIMER_A_enable_stall_in_debug_mode(SI32_WDTIMER_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_WDTIMER_A_disable_stall_in_debug_mode(
+   SI32_WDTIMER_A_Type * basePointer)
+{
+   //{{
+	basePointer->WDTKEY.U32 = SI32_WDTIMER_A_WDTKEY_KEY_ATTN_U32;
+   basePointer->WDTKEY.U32 = SI32_WDTIMER_A_WDTKEY_KEY_WRITE_U32;
+   basePointer->CONTROL_CLR = SI32_WDTIMER_A_CONTROL_DBGMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_WDTIMER_A_disable_stall_in_debug_mode(SI32_WDTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_WDTIMER_A_disable_stall_in_debug_mode(basePointer)
 #define SI32_WDTIMER_A_disable_stall_in_debug_mode(basePointer) do{  \
@@ -200,8 +308,19 @@ _SI32_WDTIMER_A_disable_stall_in_debug_mode(SI32_WDTIMER_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_WDTIMER_A_received_attention_key(
+   SI32_WDTIMER_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->STATUS.KEYSTS);
+   //}}
+}
+#else
 bool
 _SI32_WDTIMER_A_received_attention_key(SI32_WDTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_WDTIMER_A_received_attention_key(basePointer)
 #define SI32_WDTIMER_A_received_attention_key(basePointer) \
@@ -217,8 +336,19 @@ _SI32_WDTIMER_A_received_attention_key(SI32_WDTIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_WDTIMER_A_is_module_writable(
+   SI32_WDTIMER_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->STATUS.PRIVSTS);
+   //}}
+}
+#else
 bool
 _SI32_WDTIMER_A_is_module_writable(SI32_WDTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_WDTIMER_A_is_module_writable(basePointer)
 #define SI32_WDTIMER_A_is_module_writable(basePointer) \
@@ -234,8 +364,19 @@ _SI32_WDTIMER_A_is_module_writable(SI32_WDTIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_WDTIMER_A_is_early_warning_interrupt_pending(
+   SI32_WDTIMER_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->STATUS.EWI);
+   //}}
+}
+#else
 bool
 _SI32_WDTIMER_A_is_early_warning_interrupt_pending(SI32_WDTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_WDTIMER_A_is_early_warning_interrupt_pending(basePointer)
 #define SI32_WDTIMER_A_is_early_warning_interrupt_pending(basePointer) \
@@ -247,8 +388,21 @@ _SI32_WDTIMER_A_is_early_warning_interrupt_pending(SI32_WDTIMER_A_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_WDTIMER_A_clear_early_warning_interrupt(
+   SI32_WDTIMER_A_Type * basePointer)
+{
+   //{{
+	basePointer->WDTKEY.U32 = SI32_WDTIMER_A_WDTKEY_KEY_ATTN_U32;
+   basePointer->WDTKEY.U32 = SI32_WDTIMER_A_WDTKEY_KEY_WRITE_U32;
+   basePointer->STATUS_CLR = SI32_WDTIMER_A_STATUS_EWI_MASK;
+   //}}
+}
+#else
 void
 _SI32_WDTIMER_A_clear_early_warning_interrupt(SI32_WDTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_WDTIMER_A_clear_early_warning_interrupt(basePointer)
 #define SI32_WDTIMER_A_clear_early_warning_interrupt(basePointer) do{  \
@@ -267,8 +421,19 @@ _SI32_WDTIMER_A_clear_early_warning_interrupt(SI32_WDTIMER_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_WDTIMER_A_is_counter_less_than_reset_threshold(
+   SI32_WDTIMER_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->STATUS.RTHF);
+   //}}
+}
+#else
 bool
 _SI32_WDTIMER_A_is_counter_less_than_reset_threshold(SI32_WDTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_WDTIMER_A_is_counter_less_than_reset_threshold(basePointer)
 #define SI32_WDTIMER_A_is_counter_less_than_reset_threshold(basePointer) \
@@ -285,8 +450,19 @@ _SI32_WDTIMER_A_is_counter_less_than_reset_threshold(SI32_WDTIMER_A_Type* /*base
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_WDTIMER_A_is_threshold_update_pending(
+   SI32_WDTIMER_A_Type * basePointer)
+{
+   //{{
+	return (bool)(basePointer->STATUS.UPDSTS);
+   //}}
+}
+#else
 bool
 _SI32_WDTIMER_A_is_threshold_update_pending(SI32_WDTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_WDTIMER_A_is_threshold_update_pending(basePointer)
 #define SI32_WDTIMER_A_is_threshold_update_pending(basePointer) \
@@ -306,9 +482,23 @@ _SI32_WDTIMER_A_is_threshold_update_pending(SI32_WDTIMER_A_Type* /*basePointer*/
 ///  threshold
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_WDTIMER_A_write_threshold(
+   SI32_WDTIMER_A_Type * basePointer,
+   uint32_t threshold)
+{
+   //{{
+	basePointer->WDTKEY.U32 = SI32_WDTIMER_A_WDTKEY_KEY_ATTN_U32;
+	basePointer->WDTKEY.U32 = SI32_WDTIMER_A_WDTKEY_KEY_WRITE_U32;
+   basePointer->THRESHOLD.U32 = threshold;
+   //}}
+}
+#else
 void
 _SI32_WDTIMER_A_write_threshold(SI32_WDTIMER_A_Type* /*basePointer*/,
    uint32_t /*threshold*/);
+#endif
 ///
 /// @def SI32_WDTIMER_A_write_threshold(basePointer, threshold)
 #define SI32_WDTIMER_A_write_threshold(basePointer, threshold) do{  \
@@ -326,8 +516,19 @@ _SI32_WDTIMER_A_write_threshold(SI32_WDTIMER_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_WDTIMER_A_read_threshold(
+   SI32_WDTIMER_A_Type * basePointer)
+{
+   //{{
+	return basePointer->THRESHOLD.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_WDTIMER_A_read_threshold(SI32_WDTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_WDTIMER_A_read_threshold(basePointer)
 #define SI32_WDTIMER_A_read_threshold(basePointer) \
@@ -349,9 +550,27 @@ _SI32_WDTIMER_A_read_threshold(SI32_WDTIMER_A_Type* /*basePointer*/);
 ///  count
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_WDTIMER_A_set_early_warning_threshold(
+   SI32_WDTIMER_A_Type * basePointer,
+   uint32_t count)
+{
+   assert(count < 65536);   // count < 2^16
+   //{{
+	basePointer->WDTKEY.U32 = SI32_WDTIMER_A_WDTKEY_KEY_ATTN_U32;
+   basePointer->WDTKEY.U32 = SI32_WDTIMER_A_WDTKEY_KEY_WRITE_U32;
+   basePointer->THRESHOLD.U32 &= ~SI32_WDTIMER_A_THRESHOLD_EWTH_MASK;
+   basePointer->WDTKEY.U32 = SI32_WDTIMER_A_WDTKEY_KEY_ATTN_U32;
+   basePointer->WDTKEY.U32 = SI32_WDTIMER_A_WDTKEY_KEY_WRITE_U32;
+   basePointer->THRESHOLD.U32 |= count;
+   //}}
+}
+#else
 void
 _SI32_WDTIMER_A_set_early_warning_threshold(SI32_WDTIMER_A_Type* /*basePointer*/,
    uint32_t /*count*/);
+#endif
 ///
 /// @def SI32_WDTIMER_A_set_early_warning_threshold(basePointer, count)
 #define SI32_WDTIMER_A_set_early_warning_threshold(basePointer, count) do{  \
@@ -373,8 +592,19 @@ _SI32_WDTIMER_A_set_early_warning_threshold(SI32_WDTIMER_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_WDTIMER_A_get_early_warning_threshold(
+   SI32_WDTIMER_A_Type * basePointer)
+{
+   //{{
+	return basePointer->THRESHOLD.EWTH;
+   //}}
+}
+#else
 uint32_t
 _SI32_WDTIMER_A_get_early_warning_threshold(SI32_WDTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_WDTIMER_A_get_early_warning_threshold(basePointer)
 #define SI32_WDTIMER_A_get_early_warning_threshold(basePointer) \
@@ -395,9 +625,27 @@ _SI32_WDTIMER_A_get_early_warning_threshold(SI32_WDTIMER_A_Type* /*basePointer*/
 ///  count
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_WDTIMER_A_set_reset_threshold(
+   SI32_WDTIMER_A_Type * basePointer,
+   uint32_t count)
+{
+   assert(count < 65536);   // count < 2^16
+   //{{
+	basePointer->WDTKEY.U32 = SI32_WDTIMER_A_WDTKEY_KEY_ATTN_U32;
+   basePointer->WDTKEY.U32 = SI32_WDTIMER_A_WDTKEY_KEY_WRITE_U32;
+   basePointer->THRESHOLD.U32 &= ~SI32_WDTIMER_A_THRESHOLD_RTH_MASK;
+   basePointer->WDTKEY.U32 = SI32_WDTIMER_A_WDTKEY_KEY_ATTN_U32;
+   basePointer->WDTKEY.U32 = SI32_WDTIMER_A_WDTKEY_KEY_WRITE_U32;
+   basePointer->THRESHOLD.U32 |= count << SI32_WDTIMER_A_THRESHOLD_RTH_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_WDTIMER_A_set_reset_threshold(SI32_WDTIMER_A_Type* /*basePointer*/,
    uint32_t /*count*/);
+#endif
 ///
 /// @def SI32_WDTIMER_A_set_reset_threshold(basePointer, count)
 #define SI32_WDTIMER_A_set_reset_threshold(basePointer, count) do{  \
@@ -419,8 +667,19 @@ _SI32_WDTIMER_A_set_reset_threshold(SI32_WDTIMER_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_WDTIMER_A_get_reset_threshold(
+   SI32_WDTIMER_A_Type * basePointer)
+{
+   //{{
+	return basePointer->THRESHOLD.RTH;
+   //}}
+}
+#else
 uint32_t
 _SI32_WDTIMER_A_get_reset_threshold(SI32_WDTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_WDTIMER_A_get_reset_threshold(basePointer)
 #define SI32_WDTIMER_A_get_reset_threshold(basePointer) \
@@ -435,8 +694,20 @@ _SI32_WDTIMER_A_get_reset_threshold(SI32_WDTIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_WDTIMER_A_reset_counter(
+   SI32_WDTIMER_A_Type * basePointer)
+{
+   //{{
+	basePointer->WDTKEY.U32 = SI32_WDTIMER_A_WDTKEY_KEY_ATTN_U32;
+   basePointer->WDTKEY.U32 = SI32_WDTIMER_A_WDTKEY_KEY_RESET_U32;
+   //}}
+}
+#else
 void
 _SI32_WDTIMER_A_reset_counter(SI32_WDTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_WDTIMER_A_reset_counter(basePointer)
 #define SI32_WDTIMER_A_reset_counter(basePointer) do{  \
@@ -453,8 +724,20 @@ _SI32_WDTIMER_A_reset_counter(SI32_WDTIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_WDTIMER_A_stop_counter(
+   SI32_WDTIMER_A_Type * basePointer)
+{
+   //{{
+	basePointer->WDTKEY.U32 = SI32_WDTIMER_A_WDTKEY_KEY_ATTN_U32;
+   basePointer->WDTKEY.U32 = SI32_WDTIMER_A_WDTKEY_KEY_DISABLE_U32;
+   //}}
+}
+#else
 void
 _SI32_WDTIMER_A_stop_counter(SI32_WDTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_WDTIMER_A_stop_counter(basePointer)
 #define SI32_WDTIMER_A_stop_counter(basePointer) do{  \
@@ -471,8 +754,20 @@ _SI32_WDTIMER_A_stop_counter(SI32_WDTIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_WDTIMER_A_start_counter(
+   SI32_WDTIMER_A_Type * basePointer)
+{
+   //{{
+	basePointer->WDTKEY.U32 = SI32_WDTIMER_A_WDTKEY_KEY_ATTN_U32;
+   basePointer->WDTKEY.U32 = SI32_WDTIMER_A_WDTKEY_KEY_START_U32;
+   //}}
+}
+#else
 void
 _SI32_WDTIMER_A_start_counter(SI32_WDTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_WDTIMER_A_start_counter(basePointer)
 #define SI32_WDTIMER_A_start_counter(basePointer) do{  \
@@ -489,8 +784,20 @@ _SI32_WDTIMER_A_start_counter(SI32_WDTIMER_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_WDTIMER_A_lock_until_reset(
+   SI32_WDTIMER_A_Type * basePointer)
+{
+   //{{
+	basePointer->WDTKEY.U32 = SI32_WDTIMER_A_WDTKEY_KEY_ATTN_U32;
+   basePointer->WDTKEY.U32 = SI32_WDTIMER_A_WDTKEY_KEY_LOCK_U32;
+   //}}
+}
+#else
 void
 _SI32_WDTIMER_A_lock_until_reset(SI32_WDTIMER_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_WDTIMER_A_lock_until_reset(basePointer)
 #define SI32_WDTIMER_A_lock_until_reset(basePointer) do{  \
@@ -25,6 +25,13 @@
 
 #include <stdint.h>
 
+// Define SI32_HAL_INLINE to get the _SI32_* module accessors as static
+// inline functions in the module headers. The module sources define
+// SI32_HAL_OUT_OF_LINE so that the out-of-line functions are still built.
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+#include <assert.h>
+#endif
+
 typedef int32_t wide8_t;
 
 typedef uint32_t uwide8_t;
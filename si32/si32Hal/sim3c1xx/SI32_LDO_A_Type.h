@@ -55,9 +55,21 @@ extern "C" {
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LDO_A_write_control(
+   SI32_LDO_A_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_LDO_A_write_control(SI32_LDO_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_LDO_A_write_control(basePointer, control)
 #define SI32_LDO_A_write_control(basePointer, control) \
@@ -72,8 +84,19 @@ _SI32_LDO_A_write_control(SI32_LDO_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_LDO_A_read_control(
+   SI32_LDO_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_LDO_A_read_control(SI32_LDO_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LDO_A_read_control(basePointer)
 #define SI32_LDO_A_read_control(basePointer) \
@@ -85,8 +108,19 @@ _SI32_LDO_A_read_control(SI32_LDO_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LDO_A_select_high_bias(
+   SI32_LDO_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LDO_A_CONTROL_LDOIBIAS_MASK;
+   //}}
+}
+#else
 void
 _SI32_LDO_A_select_high_bias(SI32_LDO_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LDO_A_select_high_bias(basePointer)
 #define SI32_LDO_A_select_high_bias(basePointer) \
@@ -98,8 +132,19 @@ _SI32_LDO_A_select_high_bias(SI32_LDO_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LDO_A_select_low_bias(
+   SI32_LDO_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LDO_A_CONTROL_LDOIBIAS_LOWBIAS_U32;
+   //}}
+}
+#else
 void
 _SI32_LDO_A_select_low_bias(SI32_LDO_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LDO_A_select_low_bias(basePointer)
 #define SI32_LDO_A_select_low_bias(basePointer) \
@@ -111,8 +156,19 @@ _SI32_LDO_A_select_low_bias(SI32_LDO_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LDO_A_enable_bias(
+   SI32_LDO_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LDO_A_CONTROL_LDOAEN_ENABLE_U32;
+   //}}
+}
+#else
 void
 _SI32_LDO_A_enable_bias(SI32_LDO_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LDO_A_enable_bias(basePointer)
 #define SI32_LDO_A_enable_bias(basePointer) \
@@ -124,8 +180,19 @@ _SI32_LDO_A_enable_bias(SI32_LDO_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LDO_A_disable_bias(
+   SI32_LDO_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LDO_A_CONTROL_LDOAEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_LDO_A_disable_bias(SI32_LDO_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LDO_A_disable_bias(basePointer)
 #define SI32_LDO_A_disable_bias(basePointer) \
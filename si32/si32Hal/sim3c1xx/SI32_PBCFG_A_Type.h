@@ -83,6 +83,27 @@ extern "C" {
 ///  pbkey
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_initialize(
+   SI32_PBCFG_A_Type * basePointer,
+   uint32_t control0,
+   uint32_t control1,
+   uint32_t xbar0l,
+   uint32_t xbar0h,
+   uint32_t xbar1,
+   uint32_t pbkey)
+{
+   //{{
+   basePointer->CONTROL0.U32 = control0;
+   basePointer->CONTROL1.U32 = control1;
+   basePointer->XBAR0L.U32   = xbar0l;
+   basePointer->XBAR0H.U32   = xbar0h;
+   basePointer->XBAR1.U32    = xbar1;
+   basePointer->PBKEY.U32    = pbkey;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_initialize(SI32_PBCFG_A_Type* /*basePointer*/,
    uint32_t, /*control0*/
@@ -91,6 +112,7 @@ _SI32_PBCFG_A_initialize(SI32_PBCFG_A_Type* /*basePointer*/,
    uint32_t, /*xbar0h*/
    uint32_t, /*xbar1*/
    uint32_t /*pbkey*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_initialize(basePointer, control0, control1, xbar0l, xbar0h, xbar1, pbkey)
 #define SI32_PBCFG_A_initialize(basePointer, control0, control1, xbar0l, xbar0h, xbar1, pbkey) do{  \
@@ -116,9 +138,21 @@ _SI32_PBCFG_A_initialize(SI32_PBCFG_A_Type* /*basePointer*/,
 ///  control0
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_write_control0(
+   SI32_PBCFG_A_Type * basePointer,
+   uint32_t control0)
+{
+   //{{
+   basePointer->CONTROL0.U32 = control0;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_write_control0(SI32_PBCFG_A_Type* /*basePointer*/,
    uint32_t /*control0*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_write_control0(basePointer, control0)
 #define SI32_PBCFG_A_write_control0(basePointer, control0) \
@@ -133,8 +167,19 @@ _SI32_PBCFG_A_write_control0(SI32_PBCFG_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PBCFG_A_read_control0(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL0.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PBCFG_A_read_control0(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_read_control0(basePointer)
 #define SI32_PBCFG_A_read_control0(basePointer) \
@@ -155,9 +200,25 @@ _SI32_PBCFG_A_read_control0(SI32_PBCFG_A_Type* /*basePointer*/);
 ///  Valid range is 4 bits.
 ///  Pin to use as INT0 (0 = INT0.0, ..., 15 = INT0.15).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_select_interrupt_0_pin(
+   SI32_PBCFG_A_Type * basePointer,
+   // Pin to use as INT0 (0 = INT0.0, ..., 15 = INT0.15).
+   uint32_t source)
+{
+   assert(source < 16);   // source < 2^4
+   //{{
+   basePointer->CONTROL0_CLR = SI32_PBCFG_A_CONTROL0_INT0SEL_MASK;
+   basePointer->CONTROL0_SET =
+      source << SI32_PBCFG_A_CONTROL0_INT0SEL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_select_interrupt_0_pin(SI32_PBCFG_A_Type* /*basePointer*/,
    uint32_t /*source*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_select_interrupt_0_pin(basePointer, source)
 #define SI32_PBCFG_A_select_interrupt_0_pin(basePointer, source) do{  \
@@ -172,8 +233,19 @@ _SI32_PBCFG_A_select_interrupt_0_pin(SI32_PBCFG_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_set_interrupt_0_polarity_low(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL0_CLR = SI32_PBCFG_A_CONTROL0_INT0POL_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_set_interrupt_0_polarity_low(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_set_interrupt_0_polarity_low(basePointer)
 #define SI32_PBCFG_A_set_interrupt_0_polarity_low(basePointer) \
@@ -185,8 +257,19 @@ _SI32_PBCFG_A_set_interrupt_0_polarity_low(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_set_interrupt_0_polarity_high(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL0_SET = SI32_PBCFG_A_CONTROL0_INT0POL_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_set_interrupt_0_polarity_high(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_set_interrupt_0_polarity_high(basePointer)
 #define SI32_PBCFG_A_set_interrupt_0_polarity_high(basePointer) \
@@ -198,8 +281,19 @@ _SI32_PBCFG_A_set_interrupt_0_polarity_high(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_select_interrupt_0_sensitivity_level(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL0_CLR = SI32_PBCFG_A_CONTROL0_INT0MD_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_select_interrupt_0_sensitivity_level(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_select_interrupt_0_sensitivity_level(basePointer)
 #define SI32_PBCFG_A_select_interrupt_0_sensitivity_level(basePointer) \
@@ -211,8 +305,19 @@ _SI32_PBCFG_A_select_interrupt_0_sensitivity_level(SI32_PBCFG_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_select_interrupt_0_sensitivity_edge(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL0_SET = SI32_PBCFG_A_CONTROL0_INT0MD_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_select_interrupt_0_sensitivity_edge(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_select_interrupt_0_sensitivity_edge(basePointer)
 #define SI32_PBCFG_A_select_interrupt_0_sensitivity_edge(basePointer) \
@@ -224,8 +329,19 @@ _SI32_PBCFG_A_select_interrupt_0_sensitivity_edge(SI32_PBCFG_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_enable_interrupt_0(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL0_SET = SI32_PBCFG_A_CONTROL0_INT0EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_enable_interrupt_0(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_enable_interrupt_0(basePointer)
 #define SI32_PBCFG_A_enable_interrupt_0(basePointer) \
@@ -237,8 +353,19 @@ _SI32_PBCFG_A_enable_interrupt_0(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_disable_interrupt_0(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL0_CLR = SI32_PBCFG_A_CONTROL0_INT0EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_disable_interrupt_0(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_disable_interrupt_0(basePointer)
 #define SI32_PBCFG_A_disable_interrupt_0(basePointer) \
@@ -259,9 +386,25 @@ _SI32_PBCFG_A_disable_interrupt_0(SI32_PBCFG_A_Type* /*basePointer*/);
 ///  Valid range is 4 bits.
 ///  Pin to use as INT1 (0 = INT1.0, ..., 15 = INT1.15).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_select_interrupt_1_pin(
+   SI32_PBCFG_A_Type * basePointer,
+   // Pin to use as INT1 (0 = INT1.0, ..., 15 = INT1.15).
+   uint32_t source)
+{
+   assert(source < 16);   // source < 2^4
+   //{{
+   basePointer->CONTROL0_CLR = SI32_PBCFG_A_CONTROL0_INT1SEL_MASK;
+   basePointer->CONTROL0_SET =
+      source << SI32_PBCFG_A_CONTROL0_INT1SEL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_select_interrupt_1_pin(SI32_PBCFG_A_Type* /*basePointer*/,
    uint32_t /*source*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_select_interrupt_1_pin(basePointer, source)
 #define SI32_PBCFG_A_select_interrupt_1_pin(basePointer, source) do{  \
@@ -276,8 +419,19 @@ _SI32_PBCFG_A_select_interrupt_1_pin(SI32_PBCFG_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_set_interrupt_1_polarity_low(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL0_CLR = SI32_PBCFG_A_CONTROL0_INT1POL_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_set_interrupt_1_polarity_low(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_set_interrupt_1_polarity_low(basePointer)
 #define SI32_PBCFG_A_set_interrupt_1_polarity_low(basePointer) \
@@ -289,8 +443,19 @@ _SI32_PBCFG_A_set_interrupt_1_polarity_low(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_set_interrupt_1_polarity_high(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL0_SET = SI32_PBCFG_A_CONTROL0_INT1POL_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_set_interrupt_1_polarity_high(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_set_interrupt_1_polarity_high(basePointer)
 #define SI32_PBCFG_A_set_interrupt_1_polarity_high(basePointer) \
@@ -302,8 +467,19 @@ _SI32_PBCFG_A_set_interrupt_1_polarity_high(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_select_interrupt_1_sensitivity_level(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL0_CLR = SI32_PBCFG_A_CONTROL0_INT1MD_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_select_interrupt_1_sensitivity_level(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_select_interrupt_1_sensitivity_level(basePointer)
 #define SI32_PBCFG_A_select_interrupt_1_sensitivity_level(basePointer) \
@@ -315,8 +491,19 @@ _SI32_PBCFG_A_select_interrupt_1_sensitivity_level(SI32_PBCFG_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_select_interrupt_1_sensitivity_edge(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL0_SET = SI32_PBCFG_A_CONTROL0_INT1MD_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_select_interrupt_1_sensitivity_edge(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_select_interrupt_1_sensitivity_edge(basePointer)
 #define SI32_PBCFG_A_select_interrupt_1_sensitivity_edge(basePointer) \
@@ -328,8 +515,19 @@ _SI32_PBCFG_A_select_interrupt_1_sensitivity_edge(SI32_PBCFG_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_enable_interrupt_1(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL0_SET = SI32_PBCFG_A_CONTROL0_INT1EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_enable_interrupt_1(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_enable_interrupt_1(basePointer)
 #define SI32_PBCFG_A_enable_interrupt_1(basePointer) \
@@ -341,8 +539,19 @@ _SI32_PBCFG_A_enable_interrupt_1(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_disable_interrupt_1(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL0_CLR = SI32_PBCFG_A_CONTROL0_INT1EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_disable_interrupt_1(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_disable_interrupt_1(basePointer)
 #define SI32_PBCFG_A_disable_interrupt_1(basePointer) \
@@ -359,9 +568,24 @@ _SI32_PBCFG_A_disable_interrupt_1(SI32_PBCFG_A_Type* /*basePointer*/);
 ///  timer
 ///  Valid range is 5 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_set_pulse_generator_timer(
+   SI32_PBCFG_A_Type * basePointer,
+   uint32_t timer)
+{
+   assert(timer < 32);   // timer < 2^5
+   //{{
+   basePointer->CONTROL0_CLR = SI32_PBCFG_A_CONTROL0_PGTIMER_MASK;
+   basePointer->CONTROL0_SET =
+      timer << SI32_PBCFG_A_CONTROL0_PGTIMER_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_set_pulse_generator_timer(SI32_PBCFG_A_Type* /*basePointer*/,
    uint32_t /*timer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_set_pulse_generator_timer(basePointer, timer)
 #define SI32_PBCFG_A_set_pulse_generator_timer(basePointer, timer) do{  \
@@ -376,8 +600,19 @@ _SI32_PBCFG_A_set_pulse_generator_timer(SI32_PBCFG_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PBCFG_A_get_pulse_generator_timer(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL0.PGTIMER;
+   //}}
+}
+#else
 uint32_t
 _SI32_PBCFG_A_get_pulse_generator_timer(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_get_pulse_generator_timer(basePointer)
 #define SI32_PBCFG_A_get_pulse_generator_timer(basePointer) \
@@ -389,8 +624,19 @@ _SI32_PBCFG_A_get_pulse_generator_timer(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PBCFG_A_is_pulse_generator_timer_done(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL0.PGDONEF);
+   //}}
+}
+#else
 bool
 _SI32_PBCFG_A_is_pulse_generator_timer_done(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_is_pulse_generator_timer_done(basePointer)
 #define SI32_PBCFG_A_is_pulse_generator_timer_done(basePointer) \
@@ -410,9 +656,21 @@ _SI32_PBCFG_A_is_pulse_generator_timer_done(SI32_PBCFG_A_Type* /*basePointer*/);
 ///  control1
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_write_control1(
+   SI32_PBCFG_A_Type * basePointer,
+   uint32_t control1)
+{
+   //{{
+   basePointer->CONTROL1.U32 = control1;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_write_control1(SI32_PBCFG_A_Type* /*basePointer*/,
    uint32_t /*control1*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_write_control1(basePointer, control1)
 #define SI32_PBCFG_A_write_control1(basePointer, control1) \
@@ -427,8 +685,19 @@ _SI32_PBCFG_A_write_control1(SI32_PBCFG_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PBCFG_A_read_control1(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL1.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PBCFG_A_read_control1(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_read_control1(basePointer)
 #define SI32_PBCFG_A_read_control1(basePointer) \
@@ -440,8 +709,19 @@ _SI32_PBCFG_A_read_control1(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_enable_jtag(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL1_SET = SI32_PBCFG_A_CONTROL1_JTAGEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_enable_jtag(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_enable_jtag(basePointer)
 #define SI32_PBCFG_A_enable_jtag(basePointer) \
@@ -453,8 +733,19 @@ _SI32_PBCFG_A_enable_jtag(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_disable_jtag(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL1_CLR = SI32_PBCFG_A_CONTROL1_JTAGEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_disable_jtag(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_disable_jtag(basePointer)
 #define SI32_PBCFG_A_disable_jtag(basePointer) \
@@ -466,8 +757,19 @@ _SI32_PBCFG_A_disable_jtag(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_enable_etm(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL1_SET = SI32_PBCFG_A_CONTROL1_ETMEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_enable_etm(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_enable_etm(basePointer)
 #define SI32_PBCFG_A_enable_etm(basePointer) \
@@ -479,8 +781,19 @@ _SI32_PBCFG_A_enable_etm(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_disable_etm(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL1_CLR = SI32_PBCFG_A_CONTROL1_ETMEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_disable_etm(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_disable_etm(basePointer)
 #define SI32_PBCFG_A_disable_etm(basePointer) \
@@ -492,8 +805,19 @@ _SI32_PBCFG_A_disable_etm(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_enable_emif_be0_pin(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL1_SET = SI32_PBCFG_A_CONTROL1_EMIFBE0BEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_enable_emif_be0_pin(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_enable_emif_be0_pin(basePointer)
 #define SI32_PBCFG_A_enable_emif_be0_pin(basePointer) \
@@ -505,8 +829,19 @@ _SI32_PBCFG_A_enable_emif_be0_pin(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_disable_emif_be0_pin(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL1_CLR = SI32_PBCFG_A_CONTROL1_EMIFBE0BEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_disable_emif_be0_pin(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_disable_emif_be0_pin(basePointer)
 #define SI32_PBCFG_A_disable_emif_be0_pin(basePointer) \
@@ -518,8 +853,19 @@ _SI32_PBCFG_A_disable_emif_be0_pin(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_enable_emif_cs1_pin(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL1_SET = SI32_PBCFG_A_CONTROL1_EMIFCS1EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_enable_emif_cs1_pin(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_enable_emif_cs1_pin(basePointer)
 #define SI32_PBCFG_A_enable_emif_cs1_pin(basePointer) \
@@ -531,8 +877,19 @@ _SI32_PBCFG_A_enable_emif_cs1_pin(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_disable_emif_cs1_pin(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL1_CLR = SI32_PBCFG_A_CONTROL1_EMIFCS1EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_disable_emif_cs1_pin(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_disable_emif_cs1_pin(basePointer)
 #define SI32_PBCFG_A_disable_emif_cs1_pin(basePointer) \
@@ -544,8 +901,19 @@ _SI32_PBCFG_A_disable_emif_cs1_pin(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_enable_emif(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL1_SET = SI32_PBCFG_A_CONTROL1_EMIFEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_enable_emif(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_enable_emif(basePointer)
 #define SI32_PBCFG_A_enable_emif(basePointer) \
@@ -557,8 +925,19 @@ _SI32_PBCFG_A_enable_emif(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_disable_emif(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL1_CLR = SI32_PBCFG_A_CONTROL1_EMIFEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_disable_emif(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_disable_emif(basePointer)
 #define SI32_PBCFG_A_disable_emif(basePointer) \
@@ -580,9 +959,25 @@ _SI32_PBCFG_A_disable_emif(SI32_PBCFG_A_Type* /*basePointer*/);
 ///  Valid range is 0 to 16.
 ///  Range is 8 to 24 address lines.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_set_emif_width(
+   SI32_PBCFG_A_Type * basePointer,
+   // Range is 8 to 24 address lines.
+   uint32_t addrwidth)
+{
+   assert(addrwidth <= 16);
+   //{{
+   basePointer->CONTROL1_CLR = SI32_PBCFG_A_CONTROL1_EMIFWIDTH_MASK;
+   basePointer->CONTROL1_SET =
+      (addrwidth) << SI32_PBCFG_A_CONTROL1_EMIFWIDTH_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_set_emif_width(SI32_PBCFG_A_Type* /*basePointer*/,
    uint32_t /*addrwidth*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_set_emif_width(basePointer, addrwidth)
 #define SI32_PBCFG_A_set_emif_width(basePointer, addrwidth) do{  \
@@ -603,8 +998,19 @@ _SI32_PBCFG_A_set_emif_width(SI32_PBCFG_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PBCFG_A_get_emif_width(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL1.EMIFWIDTH + 8;
+   //}}
+}
+#else
 uint32_t
 _SI32_PBCFG_A_get_emif_width(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_get_emif_width(basePointer)
 #define SI32_PBCFG_A_get_emif_width(basePointer) \
@@ -616,8 +1022,21 @@ _SI32_PBCFG_A_get_emif_width(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_select_port_match_mode_pin_match(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL1_CLR = SI32_PBCFG_A_CONTROL1_MATMD_MASK;
+   basePointer->CONTROL1_SET =
+      SI32_PBCFG_A_CONTROL1_MATMD_PINMATCH_U32;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_select_port_match_mode_pin_match(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_select_port_match_mode_pin_match(basePointer)
 #define SI32_PBCFG_A_select_port_match_mode_pin_match(basePointer) do{  \
@@ -632,8 +1051,21 @@ _SI32_PBCFG_A_select_port_match_mode_pin_match(SI32_PBCFG_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_select_port_match_mode_capsense_tx(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL1_CLR = SI32_PBCFG_A_CONTROL1_MATMD_MASK;
+   basePointer->CONTROL1_SET =
+      SI32_PBCFG_A_CONTROL1_MATMD_CAPSENSE_TX_U32;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_select_port_match_mode_capsense_tx(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_select_port_match_mode_capsense_tx(basePointer)
 #define SI32_PBCFG_A_select_port_match_mode_capsense_tx(basePointer) do{  \
@@ -648,8 +1080,21 @@ _SI32_PBCFG_A_select_port_match_mode_capsense_tx(SI32_PBCFG_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_select_port_match_mode_capsense_rx(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL1_CLR = SI32_PBCFG_A_CONTROL1_MATMD_MASK;
+   basePointer->CONTROL1_SET =
+      SI32_PBCFG_A_CONTROL1_MATMD_CAPSENSE_RX_U32;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_select_port_match_mode_capsense_rx(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_select_port_match_mode_capsense_rx(basePointer)
 #define SI32_PBCFG_A_select_port_match_mode_capsense_rx(basePointer) do{  \
@@ -664,8 +1109,19 @@ _SI32_PBCFG_A_select_port_match_mode_capsense_rx(SI32_PBCFG_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_select_external_regulator_reset_from_all_sources(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL1_CLR = SI32_PBCFG_A_CONTROL1_EVREGRMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_select_external_regulator_reset_from_all_sources(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_select_external_regulator_reset_from_all_sources(basePointer)
 #define SI32_PBCFG_A_select_external_regulator_reset_from_all_sources(basePointer) \
@@ -677,8 +1133,19 @@ _SI32_PBCFG_A_select_external_regulator_reset_from_all_sources(SI32_PBCFG_A_Type
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_select_external_regulator_reset_from_power_on(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL1_SET = SI32_PBCFG_A_CONTROL1_EVREGRMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_select_external_regulator_reset_from_power_on(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_select_external_regulator_reset_from_power_on(basePointer)
 #define SI32_PBCFG_A_select_external_regulator_reset_from_power_on(basePointer) \
@@ -694,8 +1161,19 @@ _SI32_PBCFG_A_select_external_regulator_reset_from_power_on(SI32_PBCFG_A_Type* /
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_unlock_port_registers(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL1_CLR = SI32_PBCFG_A_CONTROL1_LOCK_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_unlock_port_registers(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_unlock_port_registers(basePointer)
 #define SI32_PBCFG_A_unlock_port_registers(basePointer) \
@@ -711,8 +1189,19 @@ _SI32_PBCFG_A_unlock_port_registers(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_lock_port_registers(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL1_SET = SI32_PBCFG_A_CONTROL1_LOCK_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_lock_port_registers(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_lock_port_registers(basePointer)
 #define SI32_PBCFG_A_lock_port_registers(basePointer) \
@@ -732,9 +1221,21 @@ _SI32_PBCFG_A_lock_port_registers(SI32_PBCFG_A_Type* /*basePointer*/);
 ///  xbar0l
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_write_xbar0l(
+   SI32_PBCFG_A_Type * basePointer,
+   uint32_t xbar0l)
+{
+   //{{
+   basePointer->XBAR0L.U32 = xbar0l;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_write_xbar0l(SI32_PBCFG_A_Type* /*basePointer*/,
    uint32_t /*xbar0l*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_write_xbar0l(basePointer, xbar0l)
 #define SI32_PBCFG_A_write_xbar0l(basePointer, xbar0l) \
@@ -749,8 +1250,19 @@ _SI32_PBCFG_A_write_xbar0l(SI32_PBCFG_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PBCFG_A_read_xbar0l(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   return basePointer->XBAR0L.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PBCFG_A_read_xbar0l(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_read_xbar0l(basePointer)
 #define SI32_PBCFG_A_read_xbar0l(basePointer) \
@@ -771,9 +1283,22 @@ _SI32_PBCFG_A_read_xbar0l(SI32_PBCFG_A_Type* /*basePointer*/);
 ///  Valid range is 32 bits.
 ///  Peripherals to enable.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_enable_xbar0l_peripherals(
+   SI32_PBCFG_A_Type * basePointer,
+   // Peripherals to enable.
+   uint32_t mask)
+{
+   //{{
+   basePointer->XBAR0L_SET = mask;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_enable_xbar0l_peripherals(SI32_PBCFG_A_Type* /*basePointer*/,
    uint32_t /*mask*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_enable_xbar0l_peripherals(basePointer, mask)
 #define SI32_PBCFG_A_enable_xbar0l_peripherals(basePointer, mask) \
@@ -794,9 +1319,22 @@ _SI32_PBCFG_A_enable_xbar0l_peripherals(SI32_PBCFG_A_Type* /*basePointer*/,
 ///  Valid range is 32 bits.
 ///  Peripherals to disable.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_disable_xbar0l_peripherals(
+   SI32_PBCFG_A_Type * basePointer,
+   // Peripherals to disable.
+   uint32_t mask)
+{
+   //{{
+   basePointer->XBAR0L_CLR = mask;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_disable_xbar0l_peripherals(SI32_PBCFG_A_Type* /*basePointer*/,
    uint32_t /*mask*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_disable_xbar0l_peripherals(basePointer, mask)
 #define SI32_PBCFG_A_disable_xbar0l_peripherals(basePointer, mask) \
@@ -817,9 +1355,44 @@ _SI32_PBCFG_A_disable_xbar0l_peripherals(SI32_PBCFG_A_Type* /*basePointer*/,
 ///  Valid range is 8 bits.
 ///  See Support.h for signal definitions.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_enable_xbar0_signal(
+   SI32_PBCFG_A_Type * basePointer,
+   // See Support.h for signal definitions.
+   SI32_PBCFG_A_XBAR0_Enum_Type signal)
+{
+   assert(signal < 256);   // signal < 2^8
+   //{{
+   uint32_t n = signal & 0x1F;
+   switch (signal & 0xE0)
+   {
+   case 0x00:
+       basePointer->XBAR0L_SET = 1 << n;
+       break;
+   case 0x20:
+       basePointer->XBAR0H_SET = 1 << n;
+       break;
+   case 0x80:
+       basePointer->XBAR0L_CLR = SI32_PBCFG_A_XBAR0L_EPCA0EN_MASK;
+       basePointer->XBAR0L_SET = n << SI32_PBCFG_A_XBAR0L_EPCA0EN_SHIFT;
+       break;
+   case 0xA0:
+       basePointer->XBAR0L_CLR = SI32_PBCFG_A_XBAR0L_PCA0EN_MASK;
+       basePointer->XBAR0L_SET = n << SI32_PBCFG_A_XBAR0L_PCA0EN_SHIFT;
+       break;
+   case 0xC0:
+       basePointer->XBAR0L_CLR = SI32_PBCFG_A_XBAR0L_PCA1EN_MASK;
+       basePointer->XBAR0L_SET = n << SI32_PBCFG_A_XBAR0L_PCA1EN_SHIFT;
+       break;
+   }
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_enable_xbar0_signal(SI32_PBCFG_A_Type* /*basePointer*/,
    SI32_PBCFG_A_XBAR0_Enum_Type /*signal*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_enable_xbar0_signal(basePointer, signal)
 #define SI32_PBCFG_A_enable_xbar0_signal(basePointer, signal) \
@@ -840,9 +1413,41 @@ _SI32_PBCFG_A_enable_xbar0_signal(SI32_PBCFG_A_Type* /*basePointer*/,
 ///  Valid range is 8 bits.
 ///  See Support.h for signal definitions.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_disable_xbar0_signal(
+   SI32_PBCFG_A_Type * basePointer,
+   // See Support.h for signal definitions.
+   SI32_PBCFG_A_XBAR0_Enum_Type signal)
+{
+   assert(signal < 256);   // signal < 2^8
+   //{{
+   uint32_t n = signal & 0x1F;
+   switch (signal & 0xE0)
+   {
+   case 0x00:
+       basePointer->XBAR0L_CLR = 1 << n;
+       break;
+   case 0x20:
+       basePointer->XBAR0H_CLR = 1 << n;
+       break;
+   case 0x80:
+       basePointer->XBAR0L_CLR = SI32_PBCFG_A_XBAR0L_EPCA0EN_MASK;
+       break;
+   case 0xA0:
+       basePointer->XBAR0L_CLR = SI32_PBCFG_A_XBAR0L_PCA0EN_MASK;
+       break;
+   case 0xC0:
+       basePointer->XBAR0L_CLR = SI32_PBCFG_A_XBAR0L_PCA1EN_MASK;
+       break;
+   }
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_disable_xbar0_signal(SI32_PBCFG_A_Type* /*basePointer*/,
    SI32_PBCFG_A_XBAR0_Enum_Type /*signal*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_disable_xbar0_signal(basePointer, signal)
 #define SI32_PBCFG_A_disable_xbar0_signal(basePointer, signal) \
@@ -862,9 +1467,21 @@ _SI32_PBCFG_A_disable_xbar0_signal(SI32_PBCFG_A_Type* /*basePointer*/,
 ///  xbar0h
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_write_xbar0h(
+   SI32_PBCFG_A_Type * basePointer,
+   uint32_t xbar0h)
+{
+   //{{
+   basePointer->XBAR0H.U32 = xbar0h;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_write_xbar0h(SI32_PBCFG_A_Type* /*basePointer*/,
    uint32_t /*xbar0h*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_write_xbar0h(basePointer, xbar0h)
 #define SI32_PBCFG_A_write_xbar0h(basePointer, xbar0h) \
@@ -879,8 +1496,19 @@ _SI32_PBCFG_A_write_xbar0h(SI32_PBCFG_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PBCFG_A_read_xbar0h(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   return basePointer->XBAR0H.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PBCFG_A_read_xbar0h(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_read_xbar0h(basePointer)
 #define SI32_PBCFG_A_read_xbar0h(basePointer) \
@@ -901,9 +1529,22 @@ _SI32_PBCFG_A_read_xbar0h(SI32_PBCFG_A_Type* /*basePointer*/);
 ///  Valid range is 32 bits.
 ///  Peripherals to enable.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_enable_xbar0h_peripherals(
+   SI32_PBCFG_A_Type * basePointer,
+   // Peripherals to enable.
+   uint32_t mask)
+{
+   //{{
+   basePointer->XBAR0H_SET = mask;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_enable_xbar0h_peripherals(SI32_PBCFG_A_Type* /*basePointer*/,
    uint32_t /*mask*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_enable_xbar0h_peripherals(basePointer, mask)
 #define SI32_PBCFG_A_enable_xbar0h_peripherals(basePointer, mask) \
@@ -924,9 +1565,22 @@ _SI32_PBCFG_A_enable_xbar0h_peripherals(SI32_PBCFG_A_Type* /*basePointer*/,
 ///  Valid range is 32 bits.
 ///  Peripherals to disable.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_disable_xbar0h_peripherals(
+   SI32_PBCFG_A_Type * basePointer,
+   // Peripherals to disable.
+   uint32_t mask)
+{
+   //{{
+   basePointer->XBAR0H_CLR = mask;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_disable_xbar0h_peripherals(SI32_PBCFG_A_Type* /*basePointer*/,
    uint32_t /*mask*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_disable_xbar0h_peripherals(basePointer, mask)
 #define SI32_PBCFG_A_disable_xbar0h_peripherals(basePointer, mask) \
@@ -938,8 +1592,19 @@ _SI32_PBCFG_A_disable_xbar0h_peripherals(SI32_PBCFG_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_enable_crossbar_0(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->XBAR0H_SET = SI32_PBCFG_A_XBAR0H_XBAR0EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_enable_crossbar_0(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_enable_crossbar_0(basePointer)
 #define SI32_PBCFG_A_enable_crossbar_0(basePointer) \
@@ -951,8 +1616,19 @@ _SI32_PBCFG_A_enable_crossbar_0(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_disable_crossbar_0(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->XBAR0H_CLR = SI32_PBCFG_A_XBAR0H_XBAR0EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_disable_crossbar_0(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_disable_crossbar_0(basePointer)
 #define SI32_PBCFG_A_disable_crossbar_0(basePointer) \
@@ -972,9 +1648,21 @@ _SI32_PBCFG_A_disable_crossbar_0(SI32_PBCFG_A_Type* /*basePointer*/);
 ///  xbar1
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_write_xbar1(
+   SI32_PBCFG_A_Type * basePointer,
+   uint32_t xbar1)
+{
+   //{{
+   basePointer->XBAR1.U32 = xbar1;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_write_xbar1(SI32_PBCFG_A_Type* /*basePointer*/,
    uint32_t /*xbar1*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_write_xbar1(basePointer, xbar1)
 #define SI32_PBCFG_A_write_xbar1(basePointer, xbar1) \
@@ -989,8 +1677,19 @@ _SI32_PBCFG_A_write_xbar1(SI32_PBCFG_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PBCFG_A_read_xbar1(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   return basePointer->XBAR1.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PBCFG_A_read_xbar1(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_read_xbar1(basePointer)
 #define SI32_PBCFG_A_read_xbar1(basePointer) \
@@ -1011,9 +1710,22 @@ _SI32_PBCFG_A_read_xbar1(SI32_PBCFG_A_Type* /*basePointer*/);
 ///  Valid range is 32 bits.
 ///  Peripherals to enable.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_enable_xbar1_peripherals(
+   SI32_PBCFG_A_Type * basePointer,
+   // Peripherals to enable.
+   uint32_t mask)
+{
+   //{{
+   basePointer->XBAR1_SET = mask;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_enable_xbar1_peripherals(SI32_PBCFG_A_Type* /*basePointer*/,
    uint32_t /*mask*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_enable_xbar1_peripherals(basePointer, mask)
 #define SI32_PBCFG_A_enable_xbar1_peripherals(basePointer, mask) \
@@ -1034,9 +1746,22 @@ _SI32_PBCFG_A_enable_xbar1_peripherals(SI32_PBCFG_A_Type* /*basePointer*/,
 ///  Valid range is 32 bits.
 ///  Peripherals to disable.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_disable_xbar1_peripherals(
+   SI32_PBCFG_A_Type * basePointer,
+   // Peripherals to disable.
+   uint32_t mask)
+{
+   //{{
+   basePointer->XBAR1_CLR = mask;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_disable_xbar1_peripherals(SI32_PBCFG_A_Type* /*basePointer*/,
    uint32_t /*mask*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_disable_xbar1_peripherals(basePointer, mask)
 #define SI32_PBCFG_A_disable_xbar1_peripherals(basePointer, mask) \
@@ -1057,9 +1782,32 @@ _SI32_PBCFG_A_disable_xbar1_peripherals(SI32_PBCFG_A_Type* /*basePointer*/,
 ///  Valid range is 8 bits.
 ///  See Support.h for signal definitions.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_enable_xbar1_signal(
+   SI32_PBCFG_A_Type * basePointer,
+   // See Support.h for signal definitions.
+   SI32_PBCFG_A_XBAR1_Enum_Type signal)
+{
+   assert(signal < 256);   // signal < 2^8
+   //{{
+   uint32_t n = signal & 0x1F;
+   if (signal & 0x80)
+   {
+       basePointer->XBAR1_CLR = SI32_PBCFG_A_XBAR1_SSG0EN_MASK;
+       basePointer->XBAR1_SET = n << SI32_PBCFG_A_XBAR1_SSG0EN_SHIFT;
+   }
+   else
+   {
+       basePointer->XBAR1_SET = 1 << n;
+   }
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_enable_xbar1_signal(SI32_PBCFG_A_Type* /*basePointer*/,
    SI32_PBCFG_A_XBAR1_Enum_Type /*signal*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_enable_xbar1_signal(basePointer, signal)
 #define SI32_PBCFG_A_enable_xbar1_signal(basePointer, signal) \
@@ -1080,9 +1828,30 @@ _SI32_PBCFG_A_enable_xbar1_signal(SI32_PBCFG_A_Type* /*basePointer*/,
 ///  Valid range is 8 bits.
 ///  See Support.h for signal definitions.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_disable_xbar1_signal(
+   SI32_PBCFG_A_Type * basePointer,
+   // See Support.h for signal definitions.
+   SI32_PBCFG_A_XBAR1_Enum_Type signal)
+{
+   assert(signal < 256);   // signal < 2^8
+   //{{
+   if (signal & 0x80)
+   {
+       basePointer->XBAR1_CLR = SI32_PBCFG_A_XBAR1_SSG0EN_MASK;
+   }
+   else
+   {
+       basePointer->XBAR1_CLR = 1 << (signal & 0x1F);
+   }
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_disable_xbar1_signal(SI32_PBCFG_A_Type* /*basePointer*/,
    SI32_PBCFG_A_XBAR1_Enum_Type /*signal*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_disable_xbar1_signal(basePointer, signal)
 #define SI32_PBCFG_A_disable_xbar1_signal(basePointer, signal) \
@@ -1094,8 +1863,19 @@ _SI32_PBCFG_A_disable_xbar1_signal(SI32_PBCFG_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_enable_crossbar_1(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->XBAR1_SET = SI32_PBCFG_A_XBAR1_XBAR1EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_enable_crossbar_1(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_enable_crossbar_1(basePointer)
 #define SI32_PBCFG_A_enable_crossbar_1(basePointer) \
@@ -1107,8 +1887,19 @@ _SI32_PBCFG_A_enable_crossbar_1(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_disable_crossbar_1(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->XBAR1_CLR = SI32_PBCFG_A_XBAR1_XBAR1EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_disable_crossbar_1(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_disable_crossbar_1(basePointer)
 #define SI32_PBCFG_A_disable_crossbar_1(basePointer) \
@@ -1128,9 +1919,21 @@ _SI32_PBCFG_A_disable_crossbar_1(SI32_PBCFG_A_Type* /*basePointer*/);
 ///  pbkey
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_write_pbkey(
+   SI32_PBCFG_A_Type * basePointer,
+   uint32_t pbkey)
+{
+   //{{
+   basePointer->PBKEY.U32 = pbkey;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_write_pbkey(SI32_PBCFG_A_Type* /*basePointer*/,
    uint32_t /*pbkey*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_write_pbkey(basePointer, pbkey)
 #define SI32_PBCFG_A_write_pbkey(basePointer, pbkey) \
@@ -1145,8 +1948,19 @@ _SI32_PBCFG_A_write_pbkey(SI32_PBCFG_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PBCFG_A_read_pbkey(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   return basePointer->PBKEY.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PBCFG_A_read_pbkey(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_read_pbkey(basePointer)
 #define SI32_PBCFG_A_read_pbkey(basePointer) \
@@ -1158,8 +1972,33 @@ _SI32_PBCFG_A_read_pbkey(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_unlock_ports(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   if (basePointer->PBKEY.U32 == SI32_PBCFG_A_PBKEY_KEY_UNLOCKED_U32)
+   {
+      return;
+   }
+   if (basePointer->PBKEY.U32 == SI32_PBCFG_A_PBKEY_KEY_INTERMEDIATE_U32)
+   {
+      basePointer->PBKEY.U32 = 0xF1;
+      return;
+   }
+   if (basePointer->PBKEY.U32 == SI32_PBCFG_A_PBKEY_KEY_LOCKED_U32)
+   {
+      basePointer->PBKEY.U32 = 0xA5;
+      basePointer->PBKEY.U32 = 0xF1;
+      return;
+   }
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_unlock_ports(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_unlock_ports(basePointer)
 #define SI32_PBCFG_A_unlock_ports(basePointer) \
@@ -1171,8 +2010,20 @@ _SI32_PBCFG_A_unlock_ports(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_lock_ports(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   // Any incorrect sequence value to PBKEY will lock the interface
+   basePointer->PBKEY.U32 = 0x00;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_lock_ports(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_lock_ports(basePointer)
 #define SI32_PBCFG_A_lock_ports(basePointer) \
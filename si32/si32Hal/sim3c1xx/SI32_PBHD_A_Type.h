@@ -98,6 +98,39 @@ extern "C" {
 ///  Valid range is 32 bits.
 ///  Writes to PBLOCK register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_initialize(
+   SI32_PBHD_A_Type * basePointer,
+   // Write to PB register.
+   uint32_t pb,
+   // Write to PBMDSEL register.
+   uint32_t pbmdsel,
+   // Write to PBDEN register.
+   uint32_t pbden,
+   // Write to PBDRV register.
+   uint32_t pbdrv,
+   // Write to PBILIMIT register.
+   uint32_t pbilimit,
+   // Write to PBFSEL register.
+   uint32_t pbfsel,
+   // Write to PBSS register.
+   uint32_t pbss,
+   // Writes to PBLOCK register.
+   uint32_t pblock)
+{
+   //{{
+   basePointer->PB.U32       = pb;
+   basePointer->PBMDSEL.U32  = pbmdsel;
+   basePointer->PBDEN.U32    = pbden;
+   basePointer->PBDRV.U32    = pbdrv;
+   basePointer->PBILIMIT.U32 = pbilimit;
+   basePointer->PBFSEL.U32   = pbfsel;
+   basePointer->PBSS.U32     = pbss;
+   basePointer->PBLOCK.U32   = pblock;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_initialize(SI32_PBHD_A_Type* /*basePointer*/,
    uint32_t, /*pb*/
@@ -108,6 +141,7 @@ _SI32_PBHD_A_initialize(SI32_PBHD_A_Type* /*basePointer*/,
    uint32_t, /*pbfsel*/
    uint32_t, /*pbss*/
    uint32_t /*pblock*/);
+#endif
 ///
 /// @def SI32_PBHD_A_initialize(basePointer, pb, pbmdsel, pbden, pbdrv, pbilimit, pbfsel, pbss, pblock)
 #define SI32_PBHD_A_initialize(basePointer, pb, pbmdsel, pbden, pbdrv, pbilimit, pbfsel, pbss, pblock) do{  \
@@ -135,9 +169,21 @@ _SI32_PBHD_A_initialize(SI32_PBHD_A_Type* /*basePointer*/,
 ///  pb
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_write_pb(
+   SI32_PBHD_A_Type * basePointer,
+   uint32_t pb)
+{
+   //{{
+   basePointer->PB.U32 = pb;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_write_pb(SI32_PBHD_A_Type* /*basePointer*/,
    uint32_t /*pb*/);
+#endif
 ///
 /// @def SI32_PBHD_A_write_pb(basePointer, pb)
 #define SI32_PBHD_A_write_pb(basePointer, pb) \
@@ -152,8 +198,19 @@ _SI32_PBHD_A_write_pb(SI32_PBHD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PBHD_A_read_pb(
+   SI32_PBHD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->PB.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PBHD_A_read_pb(SI32_PBHD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBHD_A_read_pb(basePointer)
 #define SI32_PBHD_A_read_pb(basePointer) \
@@ -174,9 +231,23 @@ _SI32_PBHD_A_read_pb(SI32_PBHD_A_Type* /*basePointer*/);
 ///  Valid range is 6 bits.
 ///  Mask for pin writes : 1 = set pin to high.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_write_pins_high(
+   SI32_PBHD_A_Type * basePointer,
+   // Mask for pin writes : 1 = set pin to high.
+   uint32_t pin_mask)
+{
+   assert(pin_mask < 64);   // pin_mask < 2^6
+   //{{
+   basePointer->PB_SET = pin_mask;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_write_pins_high(SI32_PBHD_A_Type* /*basePointer*/,
    uint32_t /*pin_mask*/);
+#endif
 ///
 /// @def SI32_PBHD_A_write_pins_high(basePointer, pin_mask)
 #define SI32_PBHD_A_write_pins_high(basePointer, pin_mask) \
@@ -197,9 +268,23 @@ _SI32_PBHD_A_write_pins_high(SI32_PBHD_A_Type* /*basePointer*/,
 ///  Valid range is 6 bits.
 ///  Mask for pin writes : 1 = clear pin to low.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_write_pins_low(
+   SI32_PBHD_A_Type * basePointer,
+   // Mask for pin writes : 1 = clear pin to low.
+   uint32_t pin_mask)
+{
+   assert(pin_mask < 64);   // pin_mask < 2^6
+   //{{
+   basePointer->PB_CLR = pin_mask;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_write_pins_low(SI32_PBHD_A_Type* /*basePointer*/,
    uint32_t /*pin_mask*/);
+#endif
 ///
 /// @def SI32_PBHD_A_write_pins_low(basePointer, pin_mask)
 #define SI32_PBHD_A_write_pins_low(basePointer, pin_mask) \
@@ -226,10 +311,27 @@ _SI32_PBHD_A_write_pins_low(SI32_PBHD_A_Type* /*basePointer*/,
 ///  Valid range is 6 bits.
 ///  Mask value : 1 = write, 0 = ignore.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_write_pins_masked(
+   SI32_PBHD_A_Type * basePointer,
+   // Values for latch.
+   uint32_t pin_value,
+   // Mask value : 1 = write, 0 = ignore.
+   uint32_t pin_mask)
+{
+   assert(pin_value < 64);   // pin_value < 2^6
+   assert(pin_mask < 64);   // pin_mask < 2^6
+   //{{
+   basePointer->PB_MSK = (pin_mask<<16)|(pin_value);
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_write_pins_masked(SI32_PBHD_A_Type* /*basePointer*/,
    uint32_t, /*pin_value*/
    uint32_t /*pin_mask*/);
+#endif
 ///
 /// @def SI32_PBHD_A_write_pins_masked(basePointer, pin_value, pin_mask)
 #define SI32_PBHD_A_write_pins_masked(basePointer, pin_value, pin_mask) \
@@ -250,9 +352,23 @@ _SI32_PBHD_A_write_pins_masked(SI32_PBHD_A_Type* /*basePointer*/,
 ///  Valid range is 6 bits.
 ///  Mask for pin toggles : 1 = toggle pin.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_toggle_pins(
+   SI32_PBHD_A_Type * basePointer,
+   // Mask for pin toggles : 1 = toggle pin.
+   uint32_t pin_mask)
+{
+   assert(pin_mask < 64);   // pin_mask < 2^6
+   //{{
+   basePointer->PB_MSK = (pin_mask<<16)|(~(basePointer->PB.U32) & 0xFFFF);
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_toggle_pins(SI32_PBHD_A_Type* /*basePointer*/,
    uint32_t /*pin_mask*/);
+#endif
 ///
 /// @def SI32_PBHD_A_toggle_pins(basePointer, pin_mask)
 #define SI32_PBHD_A_toggle_pins(basePointer, pin_mask) \
@@ -267,8 +383,19 @@ _SI32_PBHD_A_toggle_pins(SI32_PBHD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PBHD_A_read_pins(
+   SI32_PBHD_A_Type * basePointer)
+{
+   //{{
+   return (basePointer->PBPIN.U32);
+   //}}
+}
+#else
 uint32_t
 _SI32_PBHD_A_read_pins(SI32_PBHD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBHD_A_read_pins(basePointer)
 #define SI32_PBHD_A_read_pins(basePointer) \
@@ -289,9 +416,23 @@ _SI32_PBHD_A_read_pins(SI32_PBHD_A_Type* /*basePointer*/);
 ///  Valid range is 6 bits.
 ///  Number of the pin to read : 0 = pin 0.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PBHD_A_read_pin(
+   SI32_PBHD_A_Type * basePointer,
+   // Number of the pin to read : 0 = pin 0.
+   uint32_t pin_number)
+{
+   assert(pin_number < 64);   // pin_number < 2^6
+   //{{
+   return ((basePointer->PBPIN.U32) >> pin_number) & 1;
+   //}}
+}
+#else
 uint32_t
 _SI32_PBHD_A_read_pin(SI32_PBHD_A_Type* /*basePointer*/,
    uint32_t /*pin_number*/);
+#endif
 ///
 /// @def SI32_PBHD_A_read_pin(basePointer, pin_number)
 #define SI32_PBHD_A_read_pin(basePointer, pin_number) \
@@ -311,9 +452,21 @@ _SI32_PBHD_A_read_pin(SI32_PBHD_A_Type* /*basePointer*/,
 ///  pbmdsel
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_write_pbmdsel(
+   SI32_PBHD_A_Type * basePointer,
+   uint32_t pbmdsel)
+{
+   //{{
+   basePointer->PBMDSEL.U32 = pbmdsel;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_write_pbmdsel(SI32_PBHD_A_Type* /*basePointer*/,
    uint32_t /*pbmdsel*/);
+#endif
 ///
 /// @def SI32_PBHD_A_write_pbmdsel(basePointer, pbmdsel)
 #define SI32_PBHD_A_write_pbmdsel(basePointer, pbmdsel) \
@@ -328,8 +481,19 @@ _SI32_PBHD_A_write_pbmdsel(SI32_PBHD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PBHD_A_read_pbmdsel(
+   SI32_PBHD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->PBMDSEL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PBHD_A_read_pbmdsel(SI32_PBHD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBHD_A_read_pbmdsel(basePointer)
 #define SI32_PBHD_A_read_pbmdsel(basePointer) \
@@ -350,9 +514,27 @@ _SI32_PBHD_A_read_pbmdsel(SI32_PBHD_A_Type* /*basePointer*/);
 ///  Valid range is 6 bits.
 ///  Selects which pins to configure digital push-pull.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_set_pins_push_pull_output(
+   SI32_PBHD_A_Type * basePointer,
+   // Selects which pins to configure digital push-pull.
+   uint32_t pin_mask)
+{
+   assert(pin_mask < 64);   // pin_mask < 2^6
+   //{{
+	basePointer->PBMDSEL_SET = pin_mask;
+   basePointer->PBDEN_SET =
+      pin_mask << SI32_PBHD_A_PBDEN_PBNDEN_SHIFT;
+   basePointer->PBDEN_SET =
+      pin_mask << SI32_PBHD_A_PBDEN_PBPDEN_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_set_pins_push_pull_output(SI32_PBHD_A_Type* /*basePointer*/,
    uint32_t /*pin_mask*/);
+#endif
 ///
 /// @def SI32_PBHD_A_set_pins_push_pull_output(basePointer, pin_mask)
 #define SI32_PBHD_A_set_pins_push_pull_output(basePointer, pin_mask) do{  \
@@ -378,9 +560,28 @@ _SI32_PBHD_A_set_pins_push_pull_output(SI32_PBHD_A_Type* /*basePointer*/,
 ///  Valid range is 6 bits.
 ///  Selects which pins to configure open-drain input.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_set_pins_digital_input(
+   SI32_PBHD_A_Type * basePointer,
+   // Selects which pins to configure open-drain input.
+   uint32_t pin_mask)
+{
+   assert(pin_mask < 64);   // pin_mask < 2^6
+   //{{
+   basePointer->PBMDSEL_SET = pin_mask;
+   basePointer->PBDEN_SET =
+      pin_mask << SI32_PBHD_A_PBDEN_PBNDEN_SHIFT;
+   basePointer->PBDEN_CLR =
+      pin_mask << SI32_PBHD_A_PBDEN_PBPDEN_SHIFT;
+   basePointer->PB_SET = pin_mask;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_set_pins_digital_input(SI32_PBHD_A_Type* /*basePointer*/,
    uint32_t /*pin_mask*/);
+#endif
 ///
 /// @def SI32_PBHD_A_set_pins_digital_input(basePointer, pin_mask)
 #define SI32_PBHD_A_set_pins_digital_input(basePointer, pin_mask) do{  \
@@ -407,9 +608,27 @@ _SI32_PBHD_A_set_pins_digital_input(SI32_PBHD_A_Type* /*basePointer*/,
 ///  Valid range is 6 bits.
 ///  Selects which pins to configure as analog.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_set_pins_analog(
+   SI32_PBHD_A_Type * basePointer,
+   // Selects which pins to configure as analog.
+   uint32_t pin_mask)
+{
+   assert(pin_mask < 64);   // pin_mask < 2^6
+   //{{
+   basePointer->PBMDSEL_CLR = pin_mask;
+   basePointer->PBDEN_CLR =
+      pin_mask << SI32_PBHD_A_PBDEN_PBNDEN_SHIFT;
+   basePointer->PBDEN_CLR =
+      pin_mask << SI32_PBHD_A_PBDEN_PBPDEN_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_set_pins_analog(SI32_PBHD_A_Type* /*basePointer*/,
    uint32_t /*pin_mask*/);
+#endif
 ///
 /// @def SI32_PBHD_A_set_pins_analog(basePointer, pin_mask)
 #define SI32_PBHD_A_set_pins_analog(basePointer, pin_mask) do{  \
@@ -435,9 +654,28 @@ _SI32_PBHD_A_set_pins_analog(SI32_PBHD_A_Type* /*basePointer*/,
 ///  Valid range is 6 bits.
 ///  Selects which pins to configure as weak pulldown.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_set_pins_weak_pulldown(
+   SI32_PBHD_A_Type * basePointer,
+   // Selects which pins to configure as weak pulldown.
+   uint32_t pin_mask)
+{
+   assert(pin_mask < 64);   // pin_mask < 2^6
+   //{{
+   basePointer->PBMDSEL_SET = pin_mask;
+   basePointer->PBDEN_SET =
+      pin_mask << SI32_PBHD_A_PBDEN_PBPDEN_SHIFT;
+   basePointer->PBDEN_CLR =
+      pin_mask << SI32_PBHD_A_PBDEN_PBNDEN_SHIFT;
+   basePointer->PB_CLR = pin_mask;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_set_pins_weak_pulldown(SI32_PBHD_A_Type* /*basePointer*/,
    uint32_t /*pin_mask*/);
+#endif
 ///
 /// @def SI32_PBHD_A_set_pins_weak_pulldown(basePointer, pin_mask)
 #define SI32_PBHD_A_set_pins_weak_pulldown(basePointer, pin_mask) do{  \
@@ -463,9 +701,21 @@ _SI32_PBHD_A_set_pins_weak_pulldown(SI32_PBHD_A_Type* /*basePointer*/,
 ///  pbden
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_write_pbden(
+   SI32_PBHD_A_Type * basePointer,
+   uint32_t pbden)
+{
+   //{{
+   basePointer->PBDEN.U32 = pbden;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_write_pbden(SI32_PBHD_A_Type* /*basePointer*/,
    uint32_t /*pbden*/);
+#endif
 ///
 /// @def SI32_PBHD_A_write_pbden(basePointer, pbden)
 #define SI32_PBHD_A_write_pbden(basePointer, pbden) \
@@ -480,8 +730,19 @@ _SI32_PBHD_A_write_pbden(SI32_PBHD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PBHD_A_read_pbden(
+   SI32_PBHD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->PBDEN.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PBHD_A_read_pbden(SI32_PBHD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBHD_A_read_pbden(basePointer)
 #define SI32_PBHD_A_read_pbden(basePointer) \
@@ -499,9 +760,23 @@ _SI32_PBHD_A_read_pbden(SI32_PBHD_A_Type* /*basePointer*/);
 ///  Valid range is 6 bits.
 ///  Each bit corresponds to a pin.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_enable_n_channel_drivers(
+   SI32_PBHD_A_Type * basePointer,
+   // Each bit corresponds to a pin.
+   uint32_t pin_mask)
+{
+   assert(pin_mask < 64);   // pin_mask < 2^6
+   //{{
+   basePointer->PBDEN.PBNDEN |= pin_mask;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_enable_n_channel_drivers(SI32_PBHD_A_Type* /*basePointer*/,
    uint32_t /*pin_mask*/);
+#endif
 ///
 /// @def SI32_PBHD_A_enable_n_channel_drivers(basePointer, pin_mask)
 #define SI32_PBHD_A_enable_n_channel_drivers(basePointer, pin_mask) \
@@ -519,9 +794,23 @@ _SI32_PBHD_A_enable_n_channel_drivers(SI32_PBHD_A_Type* /*basePointer*/,
 ///  Valid range is 6 bits.
 ///  Each bit corresponds to a pin.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_disable_n_channel_drivers(
+   SI32_PBHD_A_Type * basePointer,
+   // Each bit corresponds to a pin.
+   uint32_t pin_mask)
+{
+   assert(pin_mask < 64);   // pin_mask < 2^6
+   //{{
+   basePointer->PBDEN.PBNDEN &= ~pin_mask;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_disable_n_channel_drivers(SI32_PBHD_A_Type* /*basePointer*/,
    uint32_t /*pin_mask*/);
+#endif
 ///
 /// @def SI32_PBHD_A_disable_n_channel_drivers(basePointer, pin_mask)
 #define SI32_PBHD_A_disable_n_channel_drivers(basePointer, pin_mask) \
@@ -539,9 +828,23 @@ _SI32_PBHD_A_disable_n_channel_drivers(SI32_PBHD_A_Type* /*basePointer*/,
 ///  Valid range is 6 bits.
 ///  Each bit corresponds to a pin.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_enable_p_channel_drivers(
+   SI32_PBHD_A_Type * basePointer,
+   // Each bit corresponds to a pin.
+   uint32_t pin_mask)
+{
+   assert(pin_mask < 64);   // pin_mask < 2^6
+   //{{
+   basePointer->PBDEN.PBPDEN |= pin_mask;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_enable_p_channel_drivers(SI32_PBHD_A_Type* /*basePointer*/,
    uint32_t /*pin_mask*/);
+#endif
 ///
 /// @def SI32_PBHD_A_enable_p_channel_drivers(basePointer, pin_mask)
 #define SI32_PBHD_A_enable_p_channel_drivers(basePointer, pin_mask) \
@@ -559,9 +862,23 @@ _SI32_PBHD_A_enable_p_channel_drivers(SI32_PBHD_A_Type* /*basePointer*/,
 ///  Valid range is 6 bits.
 ///  Each bit corresponds to a pin.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_disable_p_channel_drivers(
+   SI32_PBHD_A_Type * basePointer,
+   // Each bit corresponds to a pin.
+   uint32_t pin_mask)
+{
+   assert(pin_mask < 64);   // pin_mask < 2^6
+   //{{
+   basePointer->PBDEN.PBPDEN &= ~pin_mask;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_disable_p_channel_drivers(SI32_PBHD_A_Type* /*basePointer*/,
    uint32_t /*pin_mask*/);
+#endif
 ///
 /// @def SI32_PBHD_A_disable_p_channel_drivers(basePointer, pin_mask)
 #define SI32_PBHD_A_disable_p_channel_drivers(basePointer, pin_mask) \
@@ -581,9 +898,21 @@ _SI32_PBHD_A_disable_p_channel_drivers(SI32_PBHD_A_Type* /*basePointer*/,
 ///  pbdrv
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_write_pbdrv(
+   SI32_PBHD_A_Type * basePointer,
+   uint32_t pbdrv)
+{
+   //{{
+   basePointer->PBDRV.U32 = pbdrv;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_write_pbdrv(SI32_PBHD_A_Type* /*basePointer*/,
    uint32_t /*pbdrv*/);
+#endif
 ///
 /// @def SI32_PBHD_A_write_pbdrv(basePointer, pbdrv)
 #define SI32_PBHD_A_write_pbdrv(basePointer, pbdrv) \
@@ -598,8 +927,19 @@ _SI32_PBHD_A_write_pbdrv(SI32_PBHD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PBHD_A_read_pbdrv(
+   SI32_PBHD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->PBDRV.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PBHD_A_read_pbdrv(SI32_PBHD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBHD_A_read_pbdrv(basePointer)
 #define SI32_PBHD_A_read_pbdrv(basePointer) \
@@ -616,9 +956,22 @@ _SI32_PBHD_A_read_pbdrv(SI32_PBHD_A_Type* /*basePointer*/);
 ///  pin_mask
 ///  Valid range is 6 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_set_pins_high_drive_strength(
+   SI32_PBHD_A_Type * basePointer,
+   uint32_t pin_mask)
+{
+   assert(pin_mask < 64);   // pin_mask < 2^6
+   //{{
+   basePointer->PBDRV_SET = pin_mask << SI32_PBHD_A_PBDRV_PBDRV_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_set_pins_high_drive_strength(SI32_PBHD_A_Type* /*basePointer*/,
    uint32_t /*pin_mask*/);
+#endif
 ///
 /// @def SI32_PBHD_A_set_pins_high_drive_strength(basePointer, pin_mask)
 #define SI32_PBHD_A_set_pins_high_drive_strength(basePointer, pin_mask) \
@@ -635,9 +988,22 @@ _SI32_PBHD_A_set_pins_high_drive_strength(SI32_PBHD_A_Type* /*basePointer*/,
 ///  pin_mask
 ///  Valid range is 6 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_set_pins_low_drive_strength(
+   SI32_PBHD_A_Type * basePointer,
+   uint32_t pin_mask)
+{
+   assert(pin_mask < 64);   // pin_mask < 2^6
+   //{{
+   basePointer->PBDRV_CLR = pin_mask << SI32_PBHD_A_PBDRV_PBDRV_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_set_pins_low_drive_strength(SI32_PBHD_A_Type* /*basePointer*/,
    uint32_t /*pin_mask*/);
+#endif
 ///
 /// @def SI32_PBHD_A_set_pins_low_drive_strength(basePointer, pin_mask)
 #define SI32_PBHD_A_set_pins_low_drive_strength(basePointer, pin_mask) \
@@ -649,8 +1015,19 @@ _SI32_PBHD_A_set_pins_low_drive_strength(SI32_PBHD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_enable_pullup_resistors(
+   SI32_PBHD_A_Type * basePointer)
+{
+   //{{
+   basePointer->PBDRV_SET = SI32_PBHD_A_PBDRV_PBPUEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_enable_pullup_resistors(SI32_PBHD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBHD_A_enable_pullup_resistors(basePointer)
 #define SI32_PBHD_A_enable_pullup_resistors(basePointer) \
@@ -662,8 +1039,19 @@ _SI32_PBHD_A_enable_pullup_resistors(SI32_PBHD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_disable_pullup_resistors(
+   SI32_PBHD_A_Type * basePointer)
+{
+   //{{
+   basePointer->PBDRV_CLR = SI32_PBHD_A_PBDRV_PBPUEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_disable_pullup_resistors(SI32_PBHD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBHD_A_disable_pullup_resistors(basePointer)
 #define SI32_PBHD_A_disable_pullup_resistors(basePointer) \
@@ -675,8 +1063,19 @@ _SI32_PBHD_A_disable_pullup_resistors(SI32_PBHD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_select_low_power_port_mode(
+   SI32_PBHD_A_Type * basePointer)
+{
+   //{{
+   basePointer->PBDRV_SET = SI32_PBHD_A_PBDRV_PBLVMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_select_low_power_port_mode(SI32_PBHD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBHD_A_select_low_power_port_mode(basePointer)
 #define SI32_PBHD_A_select_low_power_port_mode(basePointer) \
@@ -688,8 +1087,19 @@ _SI32_PBHD_A_select_low_power_port_mode(SI32_PBHD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_select_normal_power_port_mode(
+   SI32_PBHD_A_Type * basePointer)
+{
+   //{{
+   basePointer->PBDRV_CLR = SI32_PBHD_A_PBDRV_PBLVMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_select_normal_power_port_mode(SI32_PBHD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBHD_A_select_normal_power_port_mode(basePointer)
 #define SI32_PBHD_A_select_normal_power_port_mode(basePointer) \
@@ -709,9 +1119,23 @@ _SI32_PBHD_A_select_normal_power_port_mode(SI32_PBHD_A_Type* /*basePointer*/);
 ///  rate
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_select_slew_rate(
+   SI32_PBHD_A_Type * basePointer,
+   SI32_PBHD_A_Slew_Enum_Type rate)
+{
+   assert(rate < 4);   // rate < 2^2
+   //{{
+   basePointer->PBDRV_CLR = SI32_PBHD_A_PBDRV_PBSLEW_MASK;
+   basePointer->PBDRV_SET = rate << SI32_PBHD_A_PBDRV_PBSLEW_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_select_slew_rate(SI32_PBHD_A_Type* /*basePointer*/,
    SI32_PBHD_A_Slew_Enum_Type /*rate*/);
+#endif
 ///
 /// @def SI32_PBHD_A_select_slew_rate(basePointer, rate)
 #define SI32_PBHD_A_select_slew_rate(basePointer, rate) do{  \
@@ -725,8 +1149,19 @@ _SI32_PBHD_A_select_slew_rate(SI32_PBHD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_enable_bias(
+   SI32_PBHD_A_Type * basePointer)
+{
+   //{{
+   basePointer->PBDRV_SET = SI32_PBHD_A_PBDRV_PBBIASEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_enable_bias(SI32_PBHD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBHD_A_enable_bias(basePointer)
 #define SI32_PBHD_A_enable_bias(basePointer) \
@@ -738,8 +1173,19 @@ _SI32_PBHD_A_enable_bias(SI32_PBHD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_disable_bias(
+   SI32_PBHD_A_Type * basePointer)
+{
+   //{{
+   basePointer->PBDRV_CLR = SI32_PBHD_A_PBDRV_PBBIASEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_disable_bias(SI32_PBHD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBHD_A_disable_bias(basePointer)
 #define SI32_PBHD_A_disable_bias(basePointer) \
@@ -751,8 +1197,19 @@ _SI32_PBHD_A_disable_bias(SI32_PBHD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_enable_drivers(
+   SI32_PBHD_A_Type * basePointer)
+{
+   //{{
+   basePointer->PBDRV_SET = SI32_PBHD_A_PBDRV_PBDRVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_enable_drivers(SI32_PBHD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBHD_A_enable_drivers(basePointer)
 #define SI32_PBHD_A_enable_drivers(basePointer) \
@@ -764,8 +1221,19 @@ _SI32_PBHD_A_enable_drivers(SI32_PBHD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_disable_drivers(
+   SI32_PBHD_A_Type * basePointer)
+{
+   //{{
+   basePointer->PBDRV_CLR = SI32_PBHD_A_PBDRV_PBDRVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_disable_drivers(SI32_PBHD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBHD_A_disable_drivers(basePointer)
 #define SI32_PBHD_A_disable_drivers(basePointer) \
@@ -777,8 +1245,19 @@ _SI32_PBHD_A_disable_drivers(SI32_PBHD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_enable_vddhd_tracking(
+   SI32_PBHD_A_Type * basePointer)
+{
+   //{{
+   basePointer->PBDRV_SET = SI32_PBHD_A_PBDRV_PBVTRKEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_enable_vddhd_tracking(SI32_PBHD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBHD_A_enable_vddhd_tracking(basePointer)
 #define SI32_PBHD_A_enable_vddhd_tracking(basePointer) \
@@ -790,8 +1269,19 @@ _SI32_PBHD_A_enable_vddhd_tracking(SI32_PBHD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_disable_vddhd_tracking(
+   SI32_PBHD_A_Type * basePointer)
+{
+   //{{
+   basePointer->PBDRV_CLR = SI32_PBHD_A_PBDRV_PBVTRKEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_disable_vddhd_tracking(SI32_PBHD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBHD_A_disable_vddhd_tracking(basePointer)
 #define SI32_PBHD_A_disable_vddhd_tracking(basePointer) \
@@ -811,9 +1301,21 @@ _SI32_PBHD_A_disable_vddhd_tracking(SI32_PBHD_A_Type* /*basePointer*/);
 ///  ilimit
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_write_pbilimit(
+   SI32_PBHD_A_Type * basePointer,
+   uint32_t ilimit)
+{
+   //{{
+   basePointer->PBILIMIT.U32 = ilimit;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_write_pbilimit(SI32_PBHD_A_Type* /*basePointer*/,
    uint32_t /*ilimit*/);
+#endif
 ///
 /// @def SI32_PBHD_A_write_pbilimit(basePointer, ilimit)
 #define SI32_PBHD_A_write_pbilimit(basePointer, ilimit) \
@@ -828,8 +1330,19 @@ _SI32_PBHD_A_write_pbilimit(SI32_PBHD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PBHD_A_read_pbilimit(
+   SI32_PBHD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->PBILIMIT.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PBHD_A_read_pbilimit(SI32_PBHD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBHD_A_read_pbilimit(basePointer)
 #define SI32_PBHD_A_read_pbilimit(basePointer) \
@@ -847,9 +1360,25 @@ _SI32_PBHD_A_read_pbilimit(SI32_PBHD_A_Type* /*basePointer*/);
 ///  Valid range is 6 bits.
 ///  Each bit corresponds to a pin.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_enable_pin_current_limit(
+   SI32_PBHD_A_Type * basePointer,
+   // Each bit corresponds to a pin.
+   uint32_t pins)
+{
+   assert(pins < 64);   // pins < 2^6
+   //{{
+   basePointer->PBILIMIT_CLR = SI32_PBHD_A_PBILIMIT_PBILEN_MASK;
+   basePointer->PBILIMIT_SET =
+      pins << SI32_PBHD_A_PBILIMIT_PBILEN_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_enable_pin_current_limit(SI32_PBHD_A_Type* /*basePointer*/,
    uint32_t /*pins*/);
+#endif
 ///
 /// @def SI32_PBHD_A_enable_pin_current_limit(basePointer, pins)
 #define SI32_PBHD_A_enable_pin_current_limit(basePointer, pins) do{  \
@@ -870,9 +1399,24 @@ _SI32_PBHD_A_enable_pin_current_limit(SI32_PBHD_A_Type* /*basePointer*/,
 ///  Valid range is 6 bits.
 ///  Each bit corresponds to a pin.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_disable_pin_current_limit(
+   SI32_PBHD_A_Type * basePointer,
+   // Each bit corresponds to a pin.
+   uint32_t pins)
+{
+   assert(pins < 64);   // pins < 2^6
+   //{{
+   basePointer->PBILIMIT_CLR =
+      pins << SI32_PBHD_A_PBILIMIT_PBILEN_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_disable_pin_current_limit(SI32_PBHD_A_Type* /*basePointer*/,
    uint32_t /*pins*/);
+#endif
 ///
 /// @def SI32_PBHD_A_disable_pin_current_limit(basePointer, pins)
 #define SI32_PBHD_A_disable_pin_current_limit(basePointer, pins) do{  \
@@ -892,9 +1436,25 @@ _SI32_PBHD_A_disable_pin_current_limit(SI32_PBHD_A_Type* /*basePointer*/,
 ///  Valid range is 4 bits.
 ///  See Electrical Specifications for limit values.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_select_nchannel_current_limit(
+   SI32_PBHD_A_Type * basePointer,
+   // See Electrical Specifications for limit values.
+   uint32_t limit)
+{
+   assert(limit < 16);   // limit < 2^4
+   //{{
+   basePointer->PBILIMIT_CLR = SI32_PBHD_A_PBILIMIT_NILIMIT_MASK;
+   basePointer->PBILIMIT_SET =
+      limit << SI32_PBHD_A_PBILIMIT_NILIMIT_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_select_nchannel_current_limit(SI32_PBHD_A_Type* /*basePointer*/,
    uint32_t /*limit*/);
+#endif
 ///
 /// @def SI32_PBHD_A_select_nchannel_current_limit(basePointer, limit)
 #define SI32_PBHD_A_select_nchannel_current_limit(basePointer, limit) do{  \
@@ -915,9 +1475,25 @@ _SI32_PBHD_A_select_nchannel_current_limit(SI32_PBHD_A_Type* /*basePointer*/,
 ///  Valid range is 4 bits.
 ///  See Electrical Specifications for limit values.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_select_pchannel_current_limit(
+   SI32_PBHD_A_Type * basePointer,
+   // See Electrical Specifications for limit values.
+   uint32_t limit)
+{
+   assert(limit < 16);   // limit < 2^4
+   //{{
+   basePointer->PBILIMIT_CLR = SI32_PBHD_A_PBILIMIT_PILIMIT_MASK;
+   basePointer->PBILIMIT_SET =
+      limit << SI32_PBHD_A_PBILIMIT_PILIMIT_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_select_pchannel_current_limit(SI32_PBHD_A_Type* /*basePointer*/,
    uint32_t /*limit*/);
+#endif
 ///
 /// @def SI32_PBHD_A_select_pchannel_current_limit(basePointer, limit)
 #define SI32_PBHD_A_select_pchannel_current_limit(basePointer, limit) do{  \
@@ -940,9 +1516,21 @@ _SI32_PBHD_A_select_pchannel_current_limit(SI32_PBHD_A_Type* /*basePointer*/,
 ///  pbfsel
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_write_pbfsel(
+   SI32_PBHD_A_Type * basePointer,
+   uint32_t pbfsel)
+{
+   //{{
+   basePointer->PBFSEL.U32 = pbfsel;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_write_pbfsel(SI32_PBHD_A_Type* /*basePointer*/,
    uint32_t /*pbfsel*/);
+#endif
 ///
 /// @def SI32_PBHD_A_write_pbfsel(basePointer, pbfsel)
 #define SI32_PBHD_A_write_pbfsel(basePointer, pbfsel) \
@@ -957,8 +1545,19 @@ _SI32_PBHD_A_write_pbfsel(SI32_PBHD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PBHD_A_read_pbfsel(
+   SI32_PBHD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->PBFSEL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PBHD_A_read_pbfsel(SI32_PBHD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBHD_A_read_pbfsel(basePointer)
 #define SI32_PBHD_A_read_pbfsel(basePointer) \
@@ -978,9 +1577,22 @@ _SI32_PBHD_A_read_pbfsel(SI32_PBHD_A_Type* /*basePointer*/);
 ///  function
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_select_pin0_function(
+   SI32_PBHD_A_Type * basePointer,
+   SI32_PBHD_A_Function_Enum_Type function)
+{
+   assert(function < 4);   // function < 2^2
+   //{{
+   basePointer->PBFSEL.PB0SEL = function;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_select_pin0_function(SI32_PBHD_A_Type* /*basePointer*/,
    SI32_PBHD_A_Function_Enum_Type /*function*/);
+#endif
 ///
 /// @def SI32_PBHD_A_select_pin0_function(basePointer, function)
 #define SI32_PBHD_A_select_pin0_function(basePointer, function) \
@@ -1000,9 +1612,22 @@ _SI32_PBHD_A_select_pin0_function(SI32_PBHD_A_Type* /*basePointer*/,
 ///  function
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_select_pin1_function(
+   SI32_PBHD_A_Type * basePointer,
+   SI32_PBHD_A_Function_Enum_Type function)
+{
+   assert(function < 4);   // function < 2^2
+   //{{
+   basePointer->PBFSEL.PB1SEL = function;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_select_pin1_function(SI32_PBHD_A_Type* /*basePointer*/,
    SI32_PBHD_A_Function_Enum_Type /*function*/);
+#endif
 ///
 /// @def SI32_PBHD_A_select_pin1_function(basePointer, function)
 #define SI32_PBHD_A_select_pin1_function(basePointer, function) \
@@ -1022,9 +1647,22 @@ _SI32_PBHD_A_select_pin1_function(SI32_PBHD_A_Type* /*basePointer*/,
 ///  function
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_select_pin2_function(
+   SI32_PBHD_A_Type * basePointer,
+   SI32_PBHD_A_Function_Enum_Type function)
+{
+   assert(function < 4);   // function < 2^2
+   //{{
+   basePointer->PBFSEL.PB2SEL = function;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_select_pin2_function(SI32_PBHD_A_Type* /*basePointer*/,
    SI32_PBHD_A_Function_Enum_Type /*function*/);
+#endif
 ///
 /// @def SI32_PBHD_A_select_pin2_function(basePointer, function)
 #define SI32_PBHD_A_select_pin2_function(basePointer, function) \
@@ -1044,9 +1682,22 @@ _SI32_PBHD_A_select_pin2_function(SI32_PBHD_A_Type* /*basePointer*/,
 ///  function
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_select_pin3_function(
+   SI32_PBHD_A_Type * basePointer,
+   SI32_PBHD_A_Function_Enum_Type function)
+{
+   assert(function < 4);   // function < 2^2
+   //{{
+   basePointer->PBFSEL.PB3SEL = function;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_select_pin3_function(SI32_PBHD_A_Type* /*basePointer*/,
    SI32_PBHD_A_Function_Enum_Type /*function*/);
+#endif
 ///
 /// @def SI32_PBHD_A_select_pin3_function(basePointer, function)
 #define SI32_PBHD_A_select_pin3_function(basePointer, function) \
@@ -1066,9 +1717,22 @@ _SI32_PBHD_A_select_pin3_function(SI32_PBHD_A_Type* /*basePointer*/,
 ///  function
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_select_pin4_function(
+   SI32_PBHD_A_Type * basePointer,
+   SI32_PBHD_A_Function_Enum_Type function)
+{
+   assert(function < 4);   // function < 2^2
+   //{{
+   basePointer->PBFSEL.PB4SEL = function;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_select_pin4_function(SI32_PBHD_A_Type* /*basePointer*/,
    SI32_PBHD_A_Function_Enum_Type /*function*/);
+#endif
 ///
 /// @def SI32_PBHD_A_select_pin4_function(basePointer, function)
 #define SI32_PBHD_A_select_pin4_function(basePointer, function) \
@@ -1088,9 +1752,22 @@ _SI32_PBHD_A_select_pin4_function(SI32_PBHD_A_Type* /*basePointer*/,
 ///  function
 ///  Valid range is 3 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_select_pin5_function(
+   SI32_PBHD_A_Type * basePointer,
+   SI32_PBHD_A_Function_Enum_Type function)
+{
+   assert(function < 8);   // function < 2^3
+   //{{
+   basePointer->PBFSEL.PB5SEL = function;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_select_pin5_function(SI32_PBHD_A_Type* /*basePointer*/,
    SI32_PBHD_A_Function_Enum_Type /*function*/);
+#endif
 ///
 /// @def SI32_PBHD_A_select_pin5_function(basePointer, function)
 #define SI32_PBHD_A_select_pin5_function(basePointer, function) \
@@ -1110,9 +1787,21 @@ _SI32_PBHD_A_select_pin5_function(SI32_PBHD_A_Type* /*basePointer*/,
 ///  pbss
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_write_pbss(
+   SI32_PBHD_A_Type * basePointer,
+   uint32_t pbss)
+{
+   //{{
+   basePointer->PBSS.U32 = pbss;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_write_pbss(SI32_PBHD_A_Type* /*basePointer*/,
    uint32_t /*pbss*/);
+#endif
 ///
 /// @def SI32_PBHD_A_write_pbss(basePointer, pbss)
 #define SI32_PBHD_A_write_pbss(basePointer, pbss) \
@@ -1127,8 +1816,19 @@ _SI32_PBHD_A_write_pbss(SI32_PBHD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PBHD_A_read_pbss(
+   SI32_PBHD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->PBSS.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PBHD_A_read_pbss(SI32_PBHD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBHD_A_read_pbss(basePointer)
 #define SI32_PBHD_A_read_pbss(basePointer) \
@@ -1148,9 +1848,24 @@ _SI32_PBHD_A_read_pbss(SI32_PBHD_A_Type* /*basePointer*/);
 ///  safe_state
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_select_pin0_safe_state(
+   SI32_PBHD_A_Type * basePointer,
+   SI32_PBHD_A_Safe_State_Enum_Type safe_state)
+{
+   assert(safe_state < 4);   // safe_state < 2^2
+   //{{
+   basePointer->PBSS_CLR = SI32_PBHD_A_PBSS_PB0SSSEL_MASK;
+   basePointer->PBSS_SET =
+      safe_state << SI32_PBHD_A_PBSS_PB0SSSEL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_select_pin0_safe_state(SI32_PBHD_A_Type* /*basePointer*/,
    SI32_PBHD_A_Safe_State_Enum_Type /*safe_state*/);
+#endif
 ///
 /// @def SI32_PBHD_A_select_pin0_safe_state(basePointer, safe_state)
 #define SI32_PBHD_A_select_pin0_safe_state(basePointer, safe_state) do{  \
@@ -1173,9 +1888,24 @@ _SI32_PBHD_A_select_pin0_safe_state(SI32_PBHD_A_Type* /*basePointer*/,
 ///  safe_state
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_select_pin1_safe_state(
+   SI32_PBHD_A_Type * basePointer,
+   SI32_PBHD_A_Safe_State_Enum_Type safe_state)
+{
+   assert(safe_state < 4);   // safe_state < 2^2
+   //{{
+   basePointer->PBSS_CLR = SI32_PBHD_A_PBSS_PB1SSSEL_MASK;
+   basePointer->PBSS_SET =
+      safe_state << SI32_PBHD_A_PBSS_PB1SSSEL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_select_pin1_safe_state(SI32_PBHD_A_Type* /*basePointer*/,
    SI32_PBHD_A_Safe_State_Enum_Type /*safe_state*/);
+#endif
 ///
 /// @def SI32_PBHD_A_select_pin1_safe_state(basePointer, safe_state)
 #define SI32_PBHD_A_select_pin1_safe_state(basePointer, safe_state) do{  \
@@ -1198,9 +1928,24 @@ _SI32_PBHD_A_select_pin1_safe_state(SI32_PBHD_A_Type* /*basePointer*/,
 ///  safe_state
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_select_pin2_safe_state(
+   SI32_PBHD_A_Type * basePointer,
+   SI32_PBHD_A_Safe_State_Enum_Type safe_state)
+{
+   assert(safe_state < 4);   // safe_state < 2^2
+   //{{
+   basePointer->PBSS_CLR = SI32_PBHD_A_PBSS_PB2SSSEL_MASK;
+   basePointer->PBSS_SET =
+      safe_state << SI32_PBHD_A_PBSS_PB2SSSEL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_select_pin2_safe_state(SI32_PBHD_A_Type* /*basePointer*/,
    SI32_PBHD_A_Safe_State_Enum_Type /*safe_state*/);
+#endif
 ///
 /// @def SI32_PBHD_A_select_pin2_safe_state(basePointer, safe_state)
 #define SI32_PBHD_A_select_pin2_safe_state(basePointer, safe_state) do{  \
@@ -1223,9 +1968,24 @@ _SI32_PBHD_A_select_pin2_safe_state(SI32_PBHD_A_Type* /*basePointer*/,
 ///  safe_state
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_select_pin3_safe_state(
+   SI32_PBHD_A_Type * basePointer,
+   SI32_PBHD_A_Safe_State_Enum_Type safe_state)
+{
+   assert(safe_state < 4);   // safe_state < 2^2
+   //{{
+   basePointer->PBSS_CLR = SI32_PBHD_A_PBSS_PB3SSSEL_MASK;
+   basePointer->PBSS_SET =
+      safe_state << SI32_PBHD_A_PBSS_PB3SSSEL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_select_pin3_safe_state(SI32_PBHD_A_Type* /*basePointer*/,
    SI32_PBHD_A_Safe_State_Enum_Type /*safe_state*/);
+#endif
 ///
 /// @def SI32_PBHD_A_select_pin3_safe_state(basePointer, safe_state)
 #define SI32_PBHD_A_select_pin3_safe_state(basePointer, safe_state) do{  \
@@ -1248,9 +2008,24 @@ _SI32_PBHD_A_select_pin3_safe_state(SI32_PBHD_A_Type* /*basePointer*/,
 ///  safe_state
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_select_pin4_safe_state(
+   SI32_PBHD_A_Type * basePointer,
+   SI32_PBHD_A_Safe_State_Enum_Type safe_state)
+{
+   assert(safe_state < 4);   // safe_state < 2^2
+   //{{
+   basePointer->PBSS_CLR = SI32_PBHD_A_PBSS_PB4SSSEL_MASK;
+   basePointer->PBSS_SET =
+      safe_state << SI32_PBHD_A_PBSS_PB4SSSEL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_select_pin4_safe_state(SI32_PBHD_A_Type* /*basePointer*/,
    SI32_PBHD_A_Safe_State_Enum_Type /*safe_state*/);
+#endif
 ///
 /// @def SI32_PBHD_A_select_pin4_safe_state(basePointer, safe_state)
 #define SI32_PBHD_A_select_pin4_safe_state(basePointer, safe_state) do{  \
@@ -1273,9 +2048,24 @@ _SI32_PBHD_A_select_pin4_safe_state(SI32_PBHD_A_Type* /*basePointer*/,
 ///  safe_state
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_select_pin5_safe_state(
+   SI32_PBHD_A_Type * basePointer,
+   SI32_PBHD_A_Safe_State_Enum_Type safe_state)
+{
+   assert(safe_state < 4);   // safe_state < 2^2
+   //{{
+   basePointer->PBSS_CLR = SI32_PBHD_A_PBSS_PB5SSSEL_MASK;
+   basePointer->PBSS_SET =
+      safe_state << SI32_PBHD_A_PBSS_PB5SSSEL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_select_pin5_safe_state(SI32_PBHD_A_Type* /*basePointer*/,
    SI32_PBHD_A_Safe_State_Enum_Type /*safe_state*/);
+#endif
 ///
 /// @def SI32_PBHD_A_select_pin5_safe_state(basePointer, safe_state)
 #define SI32_PBHD_A_select_pin5_safe_state(basePointer, safe_state) do{  \
@@ -1293,8 +2083,19 @@ _SI32_PBHD_A_select_pin5_safe_state(SI32_PBHD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_enter_safe_state(
+   SI32_PBHD_A_Type * basePointer)
+{
+   //{{
+   basePointer->PBSS_SET = SI32_PBHD_A_PBSS_SSMDEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_enter_safe_state(SI32_PBHD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBHD_A_enter_safe_state(basePointer)
 #define SI32_PBHD_A_enter_safe_state(basePointer) \
@@ -1309,8 +2110,19 @@ _SI32_PBHD_A_enter_safe_state(SI32_PBHD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_exit_safe_state(
+   SI32_PBHD_A_Type * basePointer)
+{
+   //{{
+   basePointer->PBSS_CLR = SI32_PBHD_A_PBSS_SSMDEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_exit_safe_state(SI32_PBHD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBHD_A_exit_safe_state(basePointer)
 #define SI32_PBHD_A_exit_safe_state(basePointer) \
@@ -1328,8 +2140,19 @@ _SI32_PBHD_A_exit_safe_state(SI32_PBHD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PBHD_A_is_port_in_safe_state(
+   SI32_PBHD_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->PBSS.SSMDEN);
+   //}}
+}
+#else
 bool
 _SI32_PBHD_A_is_port_in_safe_state(SI32_PBHD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBHD_A_is_port_in_safe_state(basePointer)
 #define SI32_PBHD_A_is_port_in_safe_state(basePointer) \
@@ -1341,8 +2164,19 @@ _SI32_PBHD_A_is_port_in_safe_state(SI32_PBHD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_enable_kill_signal_deglitch(
+   SI32_PBHD_A_Type * basePointer)
+{
+   //{{
+   basePointer->PBSS_CLR = SI32_PBHD_A_PBSS_PBSSSMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_enable_kill_signal_deglitch(SI32_PBHD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBHD_A_enable_kill_signal_deglitch(basePointer)
 #define SI32_PBHD_A_enable_kill_signal_deglitch(basePointer) \
@@ -1354,8 +2188,19 @@ _SI32_PBHD_A_enable_kill_signal_deglitch(SI32_PBHD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_disable_kill_signal_deglitch(
+   SI32_PBHD_A_Type * basePointer)
+{
+   //{{
+   basePointer->PBSS_SET = SI32_PBHD_A_PBSS_PBSSSMD_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_disable_kill_signal_deglitch(SI32_PBHD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBHD_A_disable_kill_signal_deglitch(basePointer)
 #define SI32_PBHD_A_disable_kill_signal_deglitch(basePointer) \
@@ -1375,9 +2220,21 @@ _SI32_PBHD_A_disable_kill_signal_deglitch(SI32_PBHD_A_Type* /*basePointer*/);
 ///  pblock
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBHD_A_write_pblock(
+   SI32_PBHD_A_Type * basePointer,
+   uint32_t pblock)
+{
+   //{{
+   basePointer->PBLOCK.U32 = pblock;
+   //}}
+}
+#else
 void
 _SI32_PBHD_A_write_pblock(SI32_PBHD_A_Type* /*basePointer*/,
    uint32_t /*pblock*/);
+#endif
 ///
 /// @def SI32_PBHD_A_write_pblock(basePointer, pblock)
 #define SI32_PBHD_A_write_pblock(basePointer, pblock) \
@@ -1392,8 +2249,19 @@ _SI32_PBHD_A_write_pblock(SI32_PBHD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PBHD_A_read_pblock(
+   SI32_PBHD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->PBLOCK.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PBHD_A_read_pblock(SI32_PBHD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBHD_A_read_pblock(basePointer)
 #define SI32_PBHD_A_read_pblock(basePointer) \
@@ -75,6 +75,30 @@ extern "C" {
 ///  pwpol
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_initialize(
+   SI32_PMU_A_Type * basePointer,
+   uint32_t control,
+   uint32_t config,
+   uint32_t wakeen,
+   uwide16_t pwen,
+   uwide16_t pwpol)
+{
+   assert(control < 32);   // control < 2^5
+   assert(config < 65536);   // config < 2^16
+   assert(wakeen < 512);   // wakeen < 2^9
+   assert(pwen < 65536);   // pwen < 2^16
+   assert(pwpol < 65536);   // pwpol < 2^16
+   //{{
+   basePointer->CONTROL.U32 = control;
+   basePointer->CONFIG.U32 = config;
+   basePointer->WAKEEN.U32 = wakeen;
+   basePointer->PWEN.U32 = pwen;
+   basePointer->PWPOL.U32 = pwpol;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_initialize(SI32_PMU_A_Type* /*basePointer*/,
    uint32_t, /*control*/
@@ -82,6 +106,7 @@ _SI32_PMU_A_initialize(SI32_PMU_A_Type* /*basePointer*/,
    uint32_t, /*wakeen*/
    uwide16_t, /*pwen*/
    uwide16_t /*pwpol*/);
+#endif
 ///
 /// @def SI32_PMU_A_initialize(basePointer, control, config, wakeen, pwen, pwpol)
 #define SI32_PMU_A_initialize(basePointer, control, config, wakeen, pwen, pwpol) do{  \
@@ -101,8 +126,19 @@ _SI32_PMU_A_initialize(SI32_PMU_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PMU_A_read_control(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PMU_A_read_control(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_read_control(basePointer)
 #define SI32_PMU_A_read_control(basePointer) \
@@ -122,9 +158,22 @@ _SI32_PMU_A_read_control(SI32_PMU_A_Type* /*basePointer*/);
 ///  control
 ///  Valid range is 5 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_write_control(
+   SI32_PMU_A_Type * basePointer,
+   uint32_t control)
+{
+   assert(control < 32);   // control < 2^5
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_write_control(SI32_PMU_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_PMU_A_write_control(basePointer, control)
 #define SI32_PMU_A_write_control(basePointer, control) \
@@ -139,8 +188,21 @@ _SI32_PMU_A_write_control(SI32_PMU_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_clear_wakeup_flags(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+     basePointer->CONTROL_CLR = SI32_PMU_A_CONTROL_WAKECLR_MASK;
+     basePointer->STATUS_CLR  = SI32_PMU_A_STATUS_PORF_MASK
+                              | SI32_PMU_A_STATUS_PM9EF_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_clear_wakeup_flags(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_clear_wakeup_flags(basePointer)
 #define SI32_PMU_A_clear_wakeup_flags(basePointer) do{  \
@@ -158,8 +220,19 @@ _SI32_PMU_A_clear_wakeup_flags(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_clear_por_flag(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+     basePointer->STATUS_CLR  = SI32_PMU_A_STATUS_PORF_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_clear_por_flag(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_clear_por_flag(basePointer)
 #define SI32_PMU_A_clear_por_flag(basePointer) \
@@ -171,8 +244,19 @@ _SI32_PMU_A_clear_por_flag(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_clear_pmu_level_shifter_hold(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PMU_A_CONTROL_PERILPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_clear_pmu_level_shifter_hold(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_clear_pmu_level_shifter_hold(basePointer)
 #define SI32_PMU_A_clear_pmu_level_shifter_hold(basePointer) \
@@ -184,8 +268,19 @@ _SI32_PMU_A_clear_pmu_level_shifter_hold(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_clear_pin_level_shifter_hold(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PMU_A_CONTROL_PINLPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_clear_pin_level_shifter_hold(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_clear_pin_level_shifter_hold(basePointer)
 #define SI32_PMU_A_clear_pin_level_shifter_hold(basePointer) \
@@ -197,8 +292,19 @@ _SI32_PMU_A_clear_pin_level_shifter_hold(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_pin_wake(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_PMU_A_CONTROL_PWAKEEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_pin_wake(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_pin_wake(basePointer)
 #define SI32_PMU_A_enable_pin_wake(basePointer) \
@@ -210,8 +316,19 @@ _SI32_PMU_A_enable_pin_wake(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_pin_wake(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PMU_A_CONTROL_PWAKEEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_pin_wake(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_pin_wake(basePointer)
 #define SI32_PMU_A_disable_pin_wake(basePointer) \
@@ -223,8 +340,19 @@ _SI32_PMU_A_disable_pin_wake(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_asleep_pin_out(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_PMU_A_CONTROL_PMUASLPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_asleep_pin_out(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_asleep_pin_out(basePointer)
 #define SI32_PMU_A_enable_asleep_pin_out(basePointer) \
@@ -236,8 +364,19 @@ _SI32_PMU_A_enable_asleep_pin_out(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_asleep_pin_out(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PMU_A_CONTROL_PMUASLPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_asleep_pin_out(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_asleep_pin_out(basePointer)
 #define SI32_PMU_A_disable_asleep_pin_out(basePointer) \
@@ -252,8 +391,19 @@ _SI32_PMU_A_disable_asleep_pin_out(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide16_t
+_SI32_PMU_A_read_config(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONFIG.U32;
+   //}}
+}
+#else
 uwide16_t
 _SI32_PMU_A_read_config(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_read_config(basePointer)
 #define SI32_PMU_A_read_config(basePointer) \
@@ -273,9 +423,22 @@ _SI32_PMU_A_read_config(SI32_PMU_A_Type* /*basePointer*/);
 ///  config
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_write_config(
+   SI32_PMU_A_Type * basePointer,
+   uwide16_t config)
+{
+   assert(config < 65536);   // config < 2^16
+   //{{
+   basePointer->CONFIG.U32 = config;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_write_config(SI32_PMU_A_Type* /*basePointer*/,
    uwide16_t /*config*/);
+#endif
 ///
 /// @def SI32_PMU_A_write_config(basePointer, config)
 #define SI32_PMU_A_write_config(basePointer, config) \
@@ -287,8 +450,19 @@ _SI32_PMU_A_write_config(SI32_PMU_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_rtc0_fail_reset(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_PMU_A_CONFIG_RTC0FREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_rtc0_fail_reset(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_rtc0_fail_reset(basePointer)
 #define SI32_PMU_A_enable_rtc0_fail_reset(basePointer) \
@@ -300,8 +474,19 @@ _SI32_PMU_A_enable_rtc0_fail_reset(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_rtc0_fail_reset(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_PMU_A_CONFIG_RTC0FREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_rtc0_fail_reset(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_rtc0_fail_reset(basePointer)
 #define SI32_PMU_A_disable_rtc0_fail_reset(basePointer) \
@@ -313,8 +498,19 @@ _SI32_PMU_A_disable_rtc0_fail_reset(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_rtc0_alarm_reset(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_PMU_A_CONFIG_RTC0AREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_rtc0_alarm_reset(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_rtc0_alarm_reset(basePointer)
 #define SI32_PMU_A_enable_rtc0_alarm_reset(basePointer) \
@@ -326,8 +522,19 @@ _SI32_PMU_A_enable_rtc0_alarm_reset(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_rtc0_alarm_reset(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_PMU_A_CONFIG_RTC0AREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_rtc0_alarm_reset(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_rtc0_alarm_reset(basePointer)
 #define SI32_PMU_A_disable_rtc0_alarm_reset(basePointer) \
@@ -339,8 +546,19 @@ _SI32_PMU_A_disable_rtc0_alarm_reset(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_comparator0_reset(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_PMU_A_CONFIG_CMP0REN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_comparator0_reset(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_comparator0_reset(basePointer)
 #define SI32_PMU_A_enable_comparator0_reset(basePointer) \
@@ -352,8 +570,19 @@ _SI32_PMU_A_enable_comparator0_reset(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_comparator0_reset(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_PMU_A_CONFIG_CMP0REN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_comparator0_reset(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_comparator0_reset(basePointer)
 #define SI32_PMU_A_disable_comparator0_reset(basePointer) \
@@ -365,8 +594,19 @@ _SI32_PMU_A_disable_comparator0_reset(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_pin_wake_reset(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_PMU_A_CONFIG_PWAKEREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_pin_wake_reset(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_pin_wake_reset(basePointer)
 #define SI32_PMU_A_enable_pin_wake_reset(basePointer) \
@@ -378,8 +618,19 @@ _SI32_PMU_A_enable_pin_wake_reset(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_pin_wake_reset(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_PMU_A_CONFIG_PWAKEREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_pin_wake_reset(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_pin_wake_reset(basePointer)
 #define SI32_PMU_A_disable_pin_wake_reset(basePointer) \
@@ -391,8 +642,19 @@ _SI32_PMU_A_disable_pin_wake_reset(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_lptimer0_reset(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_PMU_A_CONFIG_LPT0REN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_lptimer0_reset(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_lptimer0_reset(basePointer)
 #define SI32_PMU_A_enable_lptimer0_reset(basePointer) \
@@ -404,8 +666,19 @@ _SI32_PMU_A_enable_lptimer0_reset(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_lptimer0_reset(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_PMU_A_CONFIG_LPT0REN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_lptimer0_reset(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_lptimer0_reset(basePointer)
 #define SI32_PMU_A_disable_lptimer0_reset(basePointer) \
@@ -420,8 +693,19 @@ _SI32_PMU_A_disable_lptimer0_reset(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PMU_A_read_status(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PMU_A_read_status(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_read_status(basePointer)
 #define SI32_PMU_A_read_status(basePointer) \
@@ -433,8 +717,19 @@ _SI32_PMU_A_read_status(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PMU_A_is_wakeup_event_flag_set(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   return (bool) basePointer->STATUS.PM9EF;
+   //}}
+}
+#else
 bool
 _SI32_PMU_A_is_wakeup_event_flag_set(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_is_wakeup_event_flag_set(basePointer)
 #define SI32_PMU_A_is_wakeup_event_flag_set(basePointer) \
@@ -446,8 +741,19 @@ _SI32_PMU_A_is_wakeup_event_flag_set(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PMU_A_is_pin_wakeup_event_flag_set(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   return (bool) basePointer->STATUS.PWAKEF;
+   //}}
+}
+#else
 bool
 _SI32_PMU_A_is_pin_wakeup_event_flag_set(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_is_pin_wakeup_event_flag_set(basePointer)
 #define SI32_PMU_A_is_pin_wakeup_event_flag_set(basePointer) \
@@ -459,8 +765,19 @@ _SI32_PMU_A_is_pin_wakeup_event_flag_set(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PMU_A_is_power_on_reset_event_flag_set(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   return (bool) basePointer->STATUS.PORF;
+   //}}
+}
+#else
 bool
 _SI32_PMU_A_is_power_on_reset_event_flag_set(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_is_power_on_reset_event_flag_set(basePointer)
 #define SI32_PMU_A_is_power_on_reset_event_flag_set(basePointer) \
@@ -472,8 +789,52 @@ _SI32_PMU_A_is_power_on_reset_event_flag_set(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline SI32_PMU_Wakeup_Enum_Type
+_SI32_PMU_A_get_last_wakeup_source(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   SI32_PMU_Wakeup_Enum_Type last_wake;
+   if (!basePointer->STATUS.PM9EF)
+   {
+      last_wake = SI32_NO_WAKEUP;
+   }
+   else if (basePointer->WAKESTATUS.RSTWF && basePointer->WAKEEN.RSTWEN)
+   {
+      last_wake = SI32_RESET_WAKEUP;
+   }
+   else if (basePointer->WAKESTATUS.PWAKEWF && basePointer->WAKEEN.PWAKEWEN)
+   {
+      last_wake = SI32_PIN_WAKEUP;
+   }
+   else if (basePointer->WAKESTATUS.LPT0WF && basePointer->WAKEEN.LPT0WEN)
+   {
+      last_wake = SI32_LPTIMER0_WAKEUP;
+   }
+   else if (basePointer->WAKESTATUS.CMP0WF && basePointer->WAKEEN.CMP0WEN)
+   {
+      last_wake = SI32_CMP0_WAKEUP;
+   }
+   else if (basePointer->WAKESTATUS.RTC0AWF && basePointer->WAKEEN.RTC0AWEN)
+   {
+      last_wake = SI32_RTC0_ALARM_WAKEUP;
+   }
+   else if (basePointer->WAKESTATUS.RTC0FWF && basePointer->WAKEEN.RTC0FWEN)
+   {
+      last_wake = SI32_RTC0_FAIL_WAKEUP;
+   }
+   else
+   {
+      last_wake = SI32_WAKEUP_ERROR;
+   }
+   return last_wake;
+   //}}
+}
+#else
 SI32_PMU_Wakeup_Enum_Type
 _SI32_PMU_A_get_last_wakeup_source(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_get_last_wakeup_source(basePointer)
 #define SI32_PMU_A_get_last_wakeup_source(basePointer) \
@@ -488,8 +849,19 @@ _SI32_PMU_A_get_last_wakeup_source(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PMU_A_read_wakeen(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   return basePointer->WAKEEN.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PMU_A_read_wakeen(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_read_wakeen(basePointer)
 #define SI32_PMU_A_read_wakeen(basePointer) \
@@ -509,9 +881,22 @@ _SI32_PMU_A_read_wakeen(SI32_PMU_A_Type* /*basePointer*/);
 ///  wakeen
 ///  Valid range is 9 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_write_wakeen(
+   SI32_PMU_A_Type * basePointer,
+   uint32_t wakeen)
+{
+   assert(wakeen < 512);   // wakeen < 2^9
+   //{{
+   basePointer->WAKEEN.U32 = wakeen;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_write_wakeen(SI32_PMU_A_Type* /*basePointer*/,
    uint32_t /*wakeen*/);
+#endif
 ///
 /// @def SI32_PMU_A_write_wakeen(basePointer, wakeen)
 #define SI32_PMU_A_write_wakeen(basePointer, wakeen) \
@@ -523,8 +908,19 @@ _SI32_PMU_A_write_wakeen(SI32_PMU_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_rtc0_fail_wake_event(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->WAKEEN_SET = SI32_PMU_A_WAKEEN_RTC0FWEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_rtc0_fail_wake_event(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_rtc0_fail_wake_event(basePointer)
 #define SI32_PMU_A_enable_rtc0_fail_wake_event(basePointer) \
@@ -536,8 +932,19 @@ _SI32_PMU_A_enable_rtc0_fail_wake_event(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_rtc0_fail_wake_event(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->WAKEEN_CLR = SI32_PMU_A_WAKEEN_RTC0FWEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_rtc0_fail_wake_event(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_rtc0_fail_wake_event(basePointer)
 #define SI32_PMU_A_disable_rtc0_fail_wake_event(basePointer) \
@@ -549,8 +956,19 @@ _SI32_PMU_A_disable_rtc0_fail_wake_event(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_rtc0_alarm_wake_event(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->WAKEEN_SET = SI32_PMU_A_WAKEEN_RTC0AWEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_rtc0_alarm_wake_event(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_rtc0_alarm_wake_event(basePointer)
 #define SI32_PMU_A_enable_rtc0_alarm_wake_event(basePointer) \
@@ -562,8 +980,19 @@ _SI32_PMU_A_enable_rtc0_alarm_wake_event(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_rtc0_alarm_wake_event(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->WAKEEN_CLR = SI32_PMU_A_WAKEEN_RTC0AWEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_rtc0_alarm_wake_event(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_rtc0_alarm_wake_event(basePointer)
 #define SI32_PMU_A_disable_rtc0_alarm_wake_event(basePointer) \
@@ -575,8 +1004,19 @@ _SI32_PMU_A_disable_rtc0_alarm_wake_event(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_comparator0_wake_event(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->WAKEEN_SET = SI32_PMU_A_WAKEEN_CMP0WEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_comparator0_wake_event(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_comparator0_wake_event(basePointer)
 #define SI32_PMU_A_enable_comparator0_wake_event(basePointer) \
@@ -588,8 +1028,19 @@ _SI32_PMU_A_enable_comparator0_wake_event(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_comparator0_wake_event(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->WAKEEN_CLR = SI32_PMU_A_WAKEEN_CMP0WEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_comparator0_wake_event(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_comparator0_wake_event(basePointer)
 #define SI32_PMU_A_disable_comparator0_wake_event(basePointer) \
@@ -601,8 +1052,19 @@ _SI32_PMU_A_disable_comparator0_wake_event(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_pin_wake_event(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->WAKEEN_SET = SI32_PMU_A_WAKEEN_PWAKEWEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_pin_wake_event(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_pin_wake_event(basePointer)
 #define SI32_PMU_A_enable_pin_wake_event(basePointer) \
@@ -614,8 +1076,19 @@ _SI32_PMU_A_enable_pin_wake_event(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_pin_wake_event(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->WAKEEN_CLR = SI32_PMU_A_WAKEEN_PWAKEWEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_pin_wake_event(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_pin_wake_event(basePointer)
 #define SI32_PMU_A_disable_pin_wake_event(basePointer) \
@@ -627,8 +1100,19 @@ _SI32_PMU_A_disable_pin_wake_event(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_lptimer0_wake_event(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->WAKEEN_SET = SI32_PMU_A_WAKEEN_LPT0WEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_lptimer0_wake_event(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_lptimer0_wake_event(basePointer)
 #define SI32_PMU_A_enable_lptimer0_wake_event(basePointer) \
@@ -640,8 +1124,19 @@ _SI32_PMU_A_enable_lptimer0_wake_event(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_lptimer0_wake_event(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->WAKEEN_CLR = SI32_PMU_A_WAKEEN_LPT0WEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_lptimer0_wake_event(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_lptimer0_wake_event(basePointer)
 #define SI32_PMU_A_disable_lptimer0_wake_event(basePointer) \
@@ -653,8 +1148,19 @@ _SI32_PMU_A_disable_lptimer0_wake_event(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_reset_pin_wake_event(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->WAKEEN_SET = SI32_PMU_A_WAKEEN_RSTWEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_reset_pin_wake_event(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_reset_pin_wake_event(basePointer)
 #define SI32_PMU_A_enable_reset_pin_wake_event(basePointer) \
@@ -666,8 +1172,19 @@ _SI32_PMU_A_enable_reset_pin_wake_event(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_reset_pin_wake_event(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->WAKEEN_CLR = SI32_PMU_A_WAKEEN_RSTWEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_reset_pin_wake_event(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_reset_pin_wake_event(basePointer)
 #define SI32_PMU_A_disable_reset_pin_wake_event(basePointer) \
@@ -682,8 +1199,19 @@ _SI32_PMU_A_disable_reset_pin_wake_event(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide16_t
+_SI32_PMU_A_read_pwen(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   return basePointer->PWEN.U32;
+   //}}
+}
+#else
 uwide16_t
 _SI32_PMU_A_read_pwen(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_read_pwen(basePointer)
 #define SI32_PMU_A_read_pwen(basePointer) \
@@ -703,9 +1231,22 @@ _SI32_PMU_A_read_pwen(SI32_PMU_A_Type* /*basePointer*/);
 ///  pwen
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_write_pwen(
+   SI32_PMU_A_Type * basePointer,
+   uwide16_t pwen)
+{
+   assert(pwen < 65536);   // pwen < 2^16
+   //{{
+   basePointer->PWEN.U32 = pwen;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_write_pwen(SI32_PMU_A_Type* /*basePointer*/,
    uwide16_t /*pwen*/);
+#endif
 ///
 /// @def SI32_PMU_A_write_pwen(basePointer, pwen)
 #define SI32_PMU_A_write_pwen(basePointer, pwen) \
@@ -720,8 +1261,19 @@ _SI32_PMU_A_write_pwen(SI32_PMU_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide16_t
+_SI32_PMU_A_read_pwpol(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   return basePointer->PWPOL.U32;
+   //}}
+}
+#else
 uwide16_t
 _SI32_PMU_A_read_pwpol(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_read_pwpol(basePointer)
 #define SI32_PMU_A_read_pwpol(basePointer) \
@@ -741,9 +1293,22 @@ _SI32_PMU_A_read_pwpol(SI32_PMU_A_Type* /*basePointer*/);
 ///  pwpol
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_write_pwpol(
+   SI32_PMU_A_Type * basePointer,
+   uwide16_t pwpol)
+{
+   assert(pwpol < 65536);   // pwpol < 2^16
+   //{{
+   basePointer->PWPOL.U32 = pwpol;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_write_pwpol(SI32_PMU_A_Type* /*basePointer*/,
    uwide16_t /*pwpol*/);
+#endif
 ///
 /// @def SI32_PMU_A_write_pwpol(basePointer, pwpol)
 #define SI32_PMU_A_write_pwpol(basePointer, pwpol) \
@@ -767,10 +1332,28 @@ _SI32_PMU_A_write_pwpol(SI32_PMU_A_Type* /*basePointer*/,
 ///  Valid range is 16 bits.
 ///  Write to PWPOL register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_set_pin_wake_events(
+   SI32_PMU_A_Type * basePointer,
+   // Write to PWEN register.
+   uwide16_t pwen,
+   // Write to PWPOL register.
+   uwide16_t pwpol)
+{
+   assert(pwen < 65536);   // pwen < 2^16
+   assert(pwpol < 65536);   // pwpol < 2^16
+   //{{
+   basePointer->PWEN.U32 = pwen;
+   basePointer->PWPOL.U32 = pwpol;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_set_pin_wake_events(SI32_PMU_A_Type* /*basePointer*/,
    uwide16_t, /*pwen*/
    uwide16_t /*pwpol*/);
+#endif
 ///
 /// @def SI32_PMU_A_set_pin_wake_events(basePointer, pwen, pwpol)
 #define SI32_PMU_A_set_pin_wake_events(basePointer, pwen, pwpol) do{  \
@@ -784,8 +1367,19 @@ _SI32_PMU_A_set_pin_wake_events(SI32_PMU_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PMU_A_is_rtc0_fail_wakeup_flag_set(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+  return (bool) basePointer->WAKESTATUS.RTC0FWF;
+   //}}
+}
+#else
 bool
 _SI32_PMU_A_is_rtc0_fail_wakeup_flag_set(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_is_rtc0_fail_wakeup_flag_set(basePointer)
 #define SI32_PMU_A_is_rtc0_fail_wakeup_flag_set(basePointer) \
@@ -797,8 +1391,19 @@ _SI32_PMU_A_is_rtc0_fail_wakeup_flag_set(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PMU_A_is_rtc0_alarm_wakeup_flag_set(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+  return (bool) basePointer->WAKESTATUS.RTC0AWF;
+   //}}
+}
+#else
 bool
 _SI32_PMU_A_is_rtc0_alarm_wakeup_flag_set(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_is_rtc0_alarm_wakeup_flag_set(basePointer)
 #define SI32_PMU_A_is_rtc0_alarm_wakeup_flag_set(basePointer) \
@@ -810,8 +1415,19 @@ _SI32_PMU_A_is_rtc0_alarm_wakeup_flag_set(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PMU_A_is_comparator0_wakeup_flag_set(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+  return (bool) basePointer->WAKESTATUS.CMP0WF;
+   //}}
+}
+#else
 bool
 _SI32_PMU_A_is_comparator0_wakeup_flag_set(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_is_comparator0_wakeup_flag_set(basePointer)
 #define SI32_PMU_A_is_comparator0_wakeup_flag_set(basePointer) \
@@ -823,8 +1439,19 @@ _SI32_PMU_A_is_comparator0_wakeup_flag_set(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PMU_A_is_pin_wakeup_flag_set(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   return (bool) basePointer->WAKESTATUS.PWAKEWF;
+   //}}
+}
+#else
 bool
 _SI32_PMU_A_is_pin_wakeup_flag_set(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_is_pin_wakeup_flag_set(basePointer)
 #define SI32_PMU_A_is_pin_wakeup_flag_set(basePointer) \
@@ -836,8 +1463,19 @@ _SI32_PMU_A_is_pin_wakeup_flag_set(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PMU_A_is_lptimer0_wakeup_flag_set(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   return (bool) basePointer->WAKESTATUS.LPT0WF;
+   //}}
+}
+#else
 bool
 _SI32_PMU_A_is_lptimer0_wakeup_flag_set(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_is_lptimer0_wakeup_flag_set(basePointer)
 #define SI32_PMU_A_is_lptimer0_wakeup_flag_set(basePointer) \
@@ -849,8 +1487,19 @@ _SI32_PMU_A_is_lptimer0_wakeup_flag_set(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PMU_A_is_reset_pin_wakeup_flag_set(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   return (bool) basePointer->WAKESTATUS.RSTWF;
+   //}}
+}
+#else
 bool
 _SI32_PMU_A_is_reset_pin_wakeup_flag_set(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_is_reset_pin_wakeup_flag_set(basePointer)
 #define SI32_PMU_A_is_reset_pin_wakeup_flag_set(basePointer) \
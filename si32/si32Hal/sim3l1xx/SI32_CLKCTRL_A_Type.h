@@ -81,6 +81,27 @@ extern "C" {
 ///  config
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_initialize(
+   SI32_CLKCTRL_A_Type * basePointer,
+   uint32_t control,
+   uint32_t ahbclkg,
+   uint32_t apbclkg0,
+   uint32_t apbclkg1,
+   uint32_t pm3cn,
+   uint32_t config)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   basePointer->AHBCLKG.U32 = ahbclkg;
+   basePointer->APBCLKG0.U32 = apbclkg0;
+   basePointer->APBCLKG1.U32 = apbclkg1;
+   basePointer->PM3CN.U32 = pm3cn;
+   basePointer->CONFIG.U32 = config;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_initialize(SI32_CLKCTRL_A_Type* /*basePointer*/,
    uint32_t, /*control*/
@@ -89,6 +110,7 @@ _SI32_CLKCTRL_A_initialize(SI32_CLKCTRL_A_Type* /*basePointer*/,
    uint32_t, /*apbclkg1*/
    uint32_t, /*pm3cn*/
    uint32_t /*config*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_initialize(basePointer, control, ahbclkg, apbclkg0, apbclkg1, pm3cn, config)
 #define SI32_CLKCTRL_A_initialize(basePointer, control, ahbclkg, apbclkg0, apbclkg1, pm3cn, config) do{  \
@@ -114,9 +136,21 @@ _SI32_CLKCTRL_A_initialize(SI32_CLKCTRL_A_Type* /*basePointer*/,
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_write_control(
+   SI32_CLKCTRL_A_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_write_control(SI32_CLKCTRL_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_write_control(basePointer, control)
 #define SI32_CLKCTRL_A_write_control(basePointer, control) \
@@ -131,8 +165,19 @@ _SI32_CLKCTRL_A_write_control(SI32_CLKCTRL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_CLKCTRL_A_read_control(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_CLKCTRL_A_read_control(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_read_control(basePointer)
 #define SI32_CLKCTRL_A_read_control(basePointer) \
@@ -144,8 +189,20 @@ _SI32_CLKCTRL_A_read_control(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_ahb_source_low_power_oscillator(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.AHBSEL =
+      SI32_CLKCTRL_A_CONTROL_AHBSEL_LPOSC0_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_ahb_source_low_power_oscillator(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_ahb_source_low_power_oscillator(basePointer)
 #define SI32_CLKCTRL_A_select_ahb_source_low_power_oscillator(basePointer) do{  \
@@ -159,8 +216,20 @@ _SI32_CLKCTRL_A_select_ahb_source_low_power_oscillator(SI32_CLKCTRL_A_Type* /*ba
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_ahb_source_low_frequency_oscillator(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.AHBSEL =
+      SI32_CLKCTRL_A_CONTROL_AHBSEL_LFOSC0_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_ahb_source_low_frequency_oscillator(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_ahb_source_low_frequency_oscillator(basePointer)
 #define SI32_CLKCTRL_A_select_ahb_source_low_frequency_oscillator(basePointer) do{  \
@@ -174,8 +243,20 @@ _SI32_CLKCTRL_A_select_ahb_source_low_frequency_oscillator(SI32_CLKCTRL_A_Type*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_ahb_source_rtc0tclk(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.AHBSEL =
+      SI32_CLKCTRL_A_CONTROL_AHBSEL_RTC0TCLK_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_ahb_source_rtc0tclk(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_ahb_source_rtc0tclk(basePointer)
 #define SI32_CLKCTRL_A_select_ahb_source_rtc0tclk(basePointer) do{  \
@@ -189,8 +270,20 @@ _SI32_CLKCTRL_A_select_ahb_source_rtc0tclk(SI32_CLKCTRL_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_ahb_source_external_oscillator(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.AHBSEL =
+      SI32_CLKCTRL_A_CONTROL_AHBSEL_EXTOSC0_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_ahb_source_external_oscillator(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_ahb_source_external_oscillator(basePointer)
 #define SI32_CLKCTRL_A_select_ahb_source_external_oscillator(basePointer) do{  \
@@ -204,8 +297,20 @@ _SI32_CLKCTRL_A_select_ahb_source_external_oscillator(SI32_CLKCTRL_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_ahb_source_viorfclock(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.AHBSEL =
+      SI32_CLKCTRL_A_CONTROL_AHBSEL_VIORFCLK_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_ahb_source_viorfclock(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_ahb_source_viorfclock(basePointer)
 #define SI32_CLKCTRL_A_select_ahb_source_viorfclock(basePointer) do{  \
@@ -219,8 +324,20 @@ _SI32_CLKCTRL_A_select_ahb_source_viorfclock(SI32_CLKCTRL_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_ahb_source_pll(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.AHBSEL =
+      SI32_CLKCTRL_A_CONTROL_AHBSEL_PLL0OSC_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_ahb_source_pll(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_ahb_source_pll(basePointer)
 #define SI32_CLKCTRL_A_select_ahb_source_pll(basePointer) do{  \
@@ -234,8 +351,20 @@ _SI32_CLKCTRL_A_select_ahb_source_pll(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_ahb_source_divided_low_power_oscillator(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.AHBSEL =
+      SI32_CLKCTRL_A_CONTROL_AHBSEL_LPOSC0_DIV_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_ahb_source_divided_low_power_oscillator(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_ahb_source_divided_low_power_oscillator(basePointer)
 #define SI32_CLKCTRL_A_select_ahb_source_divided_low_power_oscillator(basePointer) do{  \
@@ -256,9 +385,24 @@ _SI32_CLKCTRL_A_select_ahb_source_divided_low_power_oscillator(SI32_CLKCTRL_A_Ty
 ///  AHB divide amount is 2 ^ divider (0 = divide by 1, ..., 7 = divide by
 ///  128).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_ahb_divider(
+   SI32_CLKCTRL_A_Type * basePointer,
+   // AHB divide amount is 2 ^ divider (0 = divide by 1, ..., 7 = divide by
+   // 128).
+   uint32_t divider)
+{
+   assert(divider <= 7);
+   //{{
+   basePointer->CONTROL.AHBDIV = divider;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_ahb_divider(SI32_CLKCTRL_A_Type* /*basePointer*/,
    uint32_t /*divider*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_ahb_divider(basePointer, divider)
 #define SI32_CLKCTRL_A_select_ahb_divider(basePointer, divider) \
@@ -273,8 +417,20 @@ _SI32_CLKCTRL_A_select_ahb_divider(SI32_CLKCTRL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_apb_divider_1(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.APBDIV =
+      SI32_CLKCTRL_A_CONTROL_APBDIV_DIV1_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_apb_divider_1(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_apb_divider_1(basePointer)
 #define SI32_CLKCTRL_A_select_apb_divider_1(basePointer) do{  \
@@ -291,8 +447,20 @@ _SI32_CLKCTRL_A_select_apb_divider_1(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_apb_divider_2(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.APBDIV =
+      SI32_CLKCTRL_A_CONTROL_APBDIV_DIV2_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_apb_divider_2(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_apb_divider_2(basePointer)
 #define SI32_CLKCTRL_A_select_apb_divider_2(basePointer) do{  \
@@ -309,8 +477,20 @@ _SI32_CLKCTRL_A_select_apb_divider_2(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_external_clock_dual_edge(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.EXTESEL =
+      SI32_CLKCTRL_A_CONTROL_EXTESEL_BOTH_EDGES_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_external_clock_dual_edge(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_external_clock_dual_edge(basePointer)
 #define SI32_CLKCTRL_A_select_external_clock_dual_edge(basePointer) do{  \
@@ -327,8 +507,20 @@ _SI32_CLKCTRL_A_select_external_clock_dual_edge(SI32_CLKCTRL_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_external_clock_rising_edge(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.EXTESEL =
+      SI32_CLKCTRL_A_CONTROL_EXTESEL_RISING_ONLY_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_external_clock_rising_edge(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_external_clock_rising_edge(basePointer)
 #define SI32_CLKCTRL_A_select_external_clock_rising_edge(basePointer) do{  \
@@ -342,8 +534,19 @@ _SI32_CLKCTRL_A_select_external_clock_rising_edge(SI32_CLKCTRL_A_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_CLKCTRL_A_are_system_clocks_busy(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.OBUSYF);
+   //}}
+}
+#else
 bool
 _SI32_CLKCTRL_A_are_system_clocks_busy(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_are_system_clocks_busy(basePointer)
 #define SI32_CLKCTRL_A_are_system_clocks_busy(basePointer) \
@@ -355,8 +558,20 @@ _SI32_CLKCTRL_A_are_system_clocks_busy(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_enable_viorfclk_in(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.U32 |=
+      SI32_CLKCTRL_A_CONTROL_VIORFCLKEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_enable_viorfclk_in(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_enable_viorfclk_in(basePointer)
 #define SI32_CLKCTRL_A_enable_viorfclk_in(basePointer) do{  \
@@ -370,8 +585,20 @@ _SI32_CLKCTRL_A_enable_viorfclk_in(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_disable_viorfclk_in(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.U32 &=
+      ~SI32_CLKCTRL_A_CONTROL_VIORFCLKEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_disable_viorfclk_in(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_disable_viorfclk_in(basePointer)
 #define SI32_CLKCTRL_A_disable_viorfclk_in(basePointer) do{  \
@@ -385,8 +612,20 @@ _SI32_CLKCTRL_A_disable_viorfclk_in(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_enable_extosc_in(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.U32 |=
+      SI32_CLKCTRL_A_CONTROL_EXTOSCEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_enable_extosc_in(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_enable_extosc_in(basePointer)
 #define SI32_CLKCTRL_A_enable_extosc_in(basePointer) do{  \
@@ -400,8 +639,20 @@ _SI32_CLKCTRL_A_enable_extosc_in(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_disable_extosc_in(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.U32 &=
+      ~SI32_CLKCTRL_A_CONTROL_EXTOSCEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_disable_extosc_in(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_disable_extosc_in(basePointer)
 #define SI32_CLKCTRL_A_disable_extosc_in(basePointer) do{  \
@@ -423,9 +674,21 @@ _SI32_CLKCTRL_A_disable_extosc_in(SI32_CLKCTRL_A_Type* /*basePointer*/);
 ///  ahbclkg
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_write_ahbclkg(
+   SI32_CLKCTRL_A_Type * basePointer,
+   uint32_t ahbclkg)
+{
+   //{{
+   basePointer->AHBCLKG.U32 = ahbclkg;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_write_ahbclkg(SI32_CLKCTRL_A_Type* /*basePointer*/,
    uint32_t /*ahbclkg*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_write_ahbclkg(basePointer, ahbclkg)
 #define SI32_CLKCTRL_A_write_ahbclkg(basePointer, ahbclkg) \
@@ -440,8 +703,19 @@ _SI32_CLKCTRL_A_write_ahbclkg(SI32_CLKCTRL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_CLKCTRL_A_read_ahbclkg(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   return basePointer->AHBCLKG.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_CLKCTRL_A_read_ahbclkg(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_read_ahbclkg(basePointer)
 #define SI32_CLKCTRL_A_read_ahbclkg(basePointer) \
@@ -453,8 +727,20 @@ _SI32_CLKCTRL_A_read_ahbclkg(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_enable_ahb_to_ram(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->AHBCLKG_SET =
+      SI32_CLKCTRL_A_AHBCLKG_RAMCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_enable_ahb_to_ram(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_enable_ahb_to_ram(basePointer)
 #define SI32_CLKCTRL_A_enable_ahb_to_ram(basePointer) do{  \
@@ -468,8 +754,20 @@ _SI32_CLKCTRL_A_enable_ahb_to_ram(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_disable_ahb_to_ram(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->AHBCLKG_CLR =
+      SI32_CLKCTRL_A_AHBCLKG_RAMCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_disable_ahb_to_ram(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_disable_ahb_to_ram(basePointer)
 #define SI32_CLKCTRL_A_disable_ahb_to_ram(basePointer) do{  \
@@ -483,8 +781,20 @@ _SI32_CLKCTRL_A_disable_ahb_to_ram(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_enable_ahb_to_dma_controller(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->AHBCLKG_SET =
+      SI32_CLKCTRL_A_AHBCLKG_DMACEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_enable_ahb_to_dma_controller(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_enable_ahb_to_dma_controller(basePointer)
 #define SI32_CLKCTRL_A_enable_ahb_to_dma_controller(basePointer) do{  \
@@ -498,8 +808,20 @@ _SI32_CLKCTRL_A_enable_ahb_to_dma_controller(SI32_CLKCTRL_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_disable_ahb_to_dma_controller(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->AHBCLKG_CLR =
+      SI32_CLKCTRL_A_AHBCLKG_DMACEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_disable_ahb_to_dma_controller(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_disable_ahb_to_dma_controller(basePointer)
 #define SI32_CLKCTRL_A_disable_ahb_to_dma_controller(basePointer) do{  \
@@ -513,8 +835,20 @@ _SI32_CLKCTRL_A_disable_ahb_to_dma_controller(SI32_CLKCTRL_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_enable_ahb_to_flash_controller(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->AHBCLKG_SET =
+      SI32_CLKCTRL_A_AHBCLKG_FLASHCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_enable_ahb_to_flash_controller(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_enable_ahb_to_flash_controller(basePointer)
 #define SI32_CLKCTRL_A_enable_ahb_to_flash_controller(basePointer) do{  \
@@ -528,8 +862,20 @@ _SI32_CLKCTRL_A_enable_ahb_to_flash_controller(SI32_CLKCTRL_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_disable_ahb_to_flash_controller(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->AHBCLKG_CLR =
+      SI32_CLKCTRL_A_AHBCLKG_FLASHCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_disable_ahb_to_flash_controller(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_disable_ahb_to_flash_controller(basePointer)
 #define SI32_CLKCTRL_A_disable_ahb_to_flash_controller(basePointer) do{  \
@@ -543,8 +889,20 @@ _SI32_CLKCTRL_A_disable_ahb_to_flash_controller(SI32_CLKCTRL_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_enable_ahb_to_dtm0(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->AHBCLKG_SET =
+      SI32_CLKCTRL_A_AHBCLKG_DTM0EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_enable_ahb_to_dtm0(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_enable_ahb_to_dtm0(basePointer)
 #define SI32_CLKCTRL_A_enable_ahb_to_dtm0(basePointer) do{  \
@@ -558,8 +916,20 @@ _SI32_CLKCTRL_A_enable_ahb_to_dtm0(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_disable_ahb_to_dtm0(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->AHBCLKG_CLR =
+      SI32_CLKCTRL_A_AHBCLKG_DTM0EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_disable_ahb_to_dtm0(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_disable_ahb_to_dtm0(basePointer)
 #define SI32_CLKCTRL_A_disable_ahb_to_dtm0(basePointer) do{  \
@@ -573,8 +943,20 @@ _SI32_CLKCTRL_A_disable_ahb_to_dtm0(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_enable_ahb_to_dtm1(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->AHBCLKG_SET =
+      SI32_CLKCTRL_A_AHBCLKG_DTM1EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_enable_ahb_to_dtm1(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_enable_ahb_to_dtm1(basePointer)
 #define SI32_CLKCTRL_A_enable_ahb_to_dtm1(basePointer) do{  \
@@ -588,8 +970,20 @@ _SI32_CLKCTRL_A_enable_ahb_to_dtm1(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_disable_ahb_to_dtm1(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->AHBCLKG_CLR =
+      SI32_CLKCTRL_A_AHBCLKG_DTM1EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_disable_ahb_to_dtm1(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_disable_ahb_to_dtm1(basePointer)
 #define SI32_CLKCTRL_A_disable_ahb_to_dtm1(basePointer) do{  \
@@ -603,8 +997,20 @@ _SI32_CLKCTRL_A_disable_ahb_to_dtm1(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_enable_ahb_to_dtm2(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->AHBCLKG_SET =
+      SI32_CLKCTRL_A_AHBCLKG_DTM2EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_enable_ahb_to_dtm2(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_enable_ahb_to_dtm2(basePointer)
 #define SI32_CLKCTRL_A_enable_ahb_to_dtm2(basePointer) do{  \
@@ -618,8 +1024,20 @@ _SI32_CLKCTRL_A_enable_ahb_to_dtm2(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_disable_ahb_to_dtm2(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->AHBCLKG_CLR =
+      SI32_CLKCTRL_A_AHBCLKG_DTM2EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_disable_ahb_to_dtm2(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_disable_ahb_to_dtm2(basePointer)
 #define SI32_CLKCTRL_A_disable_ahb_to_dtm2(basePointer) do{  \
@@ -633,8 +1051,25 @@ _SI32_CLKCTRL_A_disable_ahb_to_dtm2(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_enable_ahb_to_all_modules(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->AHBCLKG_SET =
+      SI32_CLKCTRL_A_AHBCLKG_RAMCEN_MASK
+      | SI32_CLKCTRL_A_AHBCLKG_DMACEN_MASK
+      | SI32_CLKCTRL_A_AHBCLKG_FLASHCEN_MASK
+      | SI32_CLKCTRL_A_AHBCLKG_DTM0EN_MASK
+      | SI32_CLKCTRL_A_AHBCLKG_DTM1EN_MASK
+      | SI32_CLKCTRL_A_AHBCLKG_DTM2EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_enable_ahb_to_all_modules(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_enable_ahb_to_all_modules(basePointer)
 #define SI32_CLKCTRL_A_enable_ahb_to_all_modules(basePointer) do{  \
@@ -661,9 +1096,21 @@ _SI32_CLKCTRL_A_enable_ahb_to_all_modules(SI32_CLKCTRL_A_Type* /*basePointer*/);
 ///  apbclkg0
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_write_apbclkg0(
+   SI32_CLKCTRL_A_Type * basePointer,
+   uint32_t apbclkg0)
+{
+   //{{
+   basePointer->APBCLKG0.U32 = apbclkg0;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_write_apbclkg0(SI32_CLKCTRL_A_Type* /*basePointer*/,
    uint32_t /*apbclkg0*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_write_apbclkg0(basePointer, apbclkg0)
 #define SI32_CLKCTRL_A_write_apbclkg0(basePointer, apbclkg0) \
@@ -678,8 +1125,19 @@ _SI32_CLKCTRL_A_write_apbclkg0(SI32_CLKCTRL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_CLKCTRL_A_read_apbclkg0(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   return basePointer->APBCLKG0.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_CLKCTRL_A_read_apbclkg0(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_read_apbclkg0(basePointer)
 #define SI32_CLKCTRL_A_read_apbclkg0(basePointer) \
@@ -699,9 +1157,21 @@ _SI32_CLKCTRL_A_read_apbclkg0(SI32_CLKCTRL_A_Type* /*basePointer*/);
 ///  apbclkg1
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_write_apbclkg1(
+   SI32_CLKCTRL_A_Type * basePointer,
+   uint32_t apbclkg1)
+{
+   //{{
+   basePointer->APBCLKG1.U32 = apbclkg1;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_write_apbclkg1(SI32_CLKCTRL_A_Type* /*basePointer*/,
    uint32_t /*apbclkg1*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_write_apbclkg1(basePointer, apbclkg1)
 #define SI32_CLKCTRL_A_write_apbclkg1(basePointer, apbclkg1) \
@@ -716,8 +1186,19 @@ _SI32_CLKCTRL_A_write_apbclkg1(SI32_CLKCTRL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_CLKCTRL_A_read_apbclkg1(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   return basePointer->APBCLKG1.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_CLKCTRL_A_read_apbclkg1(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_read_apbclkg1(basePointer)
 #define SI32_CLKCTRL_A_read_apbclkg1(basePointer) \
@@ -738,9 +1219,22 @@ _SI32_CLKCTRL_A_read_apbclkg1(SI32_CLKCTRL_A_Type* /*basePointer*/);
 ///  Valid range is 32 bits.
 ///  See Support.h for module mask definitions.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_enable_apb_to_modules_0(
+   SI32_CLKCTRL_A_Type * basePointer,
+   // See Support.h for module mask definitions.
+   uint32_t mask)
+{
+   //{{
+   basePointer->APBCLKG0_SET = mask;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_enable_apb_to_modules_0(SI32_CLKCTRL_A_Type* /*basePointer*/,
    uint32_t /*mask*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_enable_apb_to_modules_0(basePointer, mask)
 #define SI32_CLKCTRL_A_enable_apb_to_modules_0(basePointer, mask) \
@@ -761,9 +1255,22 @@ _SI32_CLKCTRL_A_enable_apb_to_modules_0(SI32_CLKCTRL_A_Type* /*basePointer*/,
 ///  Valid range is 32 bits.
 ///  See Support.h for module mask definitions.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_disable_apb_to_modules_0(
+   SI32_CLKCTRL_A_Type * basePointer,
+   // See Support.h for module mask definitions.
+   uint32_t mask)
+{
+   //{{
+   basePointer->APBCLKG0_CLR = mask;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_disable_apb_to_modules_0(SI32_CLKCTRL_A_Type* /*basePointer*/,
    uint32_t /*mask*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_disable_apb_to_modules_0(basePointer, mask)
 #define SI32_CLKCTRL_A_disable_apb_to_modules_0(basePointer, mask) \
@@ -784,9 +1291,22 @@ _SI32_CLKCTRL_A_disable_apb_to_modules_0(SI32_CLKCTRL_A_Type* /*basePointer*/,
 ///  Valid range is 32 bits.
 ///  See Support.h for module mask definitions.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_enable_apb_to_modules_1(
+   SI32_CLKCTRL_A_Type * basePointer,
+   // See Support.h for module mask definitions.
+   uint32_t mask)
+{
+   //{{
+   basePointer->APBCLKG1_SET = mask;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_enable_apb_to_modules_1(SI32_CLKCTRL_A_Type* /*basePointer*/,
    uint32_t /*mask*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_enable_apb_to_modules_1(basePointer, mask)
 #define SI32_CLKCTRL_A_enable_apb_to_modules_1(basePointer, mask) \
@@ -807,9 +1327,22 @@ _SI32_CLKCTRL_A_enable_apb_to_modules_1(SI32_CLKCTRL_A_Type* /*basePointer*/,
 ///  Valid range is 32 bits.
 ///  See Support.h for module mask definitions.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_disable_apb_to_modules_1(
+   SI32_CLKCTRL_A_Type * basePointer,
+   // See Support.h for module mask definitions.
+   uint32_t mask)
+{
+   //{{
+   basePointer->APBCLKG1_CLR = mask;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_disable_apb_to_modules_1(SI32_CLKCTRL_A_Type* /*basePointer*/,
    uint32_t /*mask*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_disable_apb_to_modules_1(basePointer, mask)
 #define SI32_CLKCTRL_A_disable_apb_to_modules_1(basePointer, mask) \
@@ -821,8 +1354,49 @@ _SI32_CLKCTRL_A_disable_apb_to_modules_1(SI32_CLKCTRL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_enable_apb_to_all_modules(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->APBCLKG0_SET =
+      SI32_CLKCTRL_A_APBCLKG0_PLL0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_ENCDEC0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_DCDC0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_LCD0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_DTM2CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_DTM1CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_DTM0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_ACCTR0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_LPT0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_IDAC0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_CRC0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_AES0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_CMP1CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_CMP0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_ADC0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_TIMER2CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_TIMER1CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_TIMER0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_EPCA0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_I2C0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_SPI1CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_SPI0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_UART0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_USART0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_PB0CEN_MASK
+	  | SI32_CLKCTRL_A_APBCLKG0_FLCTRLCEN_MASK;
+
+   basePointer->APBCLKG1_SET =
+      SI32_CLKCTRL_A_APBCLKG1_MISC0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG1_MISC1CEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_enable_apb_to_all_modules(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_enable_apb_to_all_modules(basePointer)
 #define SI32_CLKCTRL_A_enable_apb_to_all_modules(basePointer) do{  \
@@ -865,8 +1439,49 @@ _SI32_CLKCTRL_A_enable_apb_to_all_modules(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_disable_apb_to_all_modules(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+      basePointer->APBCLKG0_CLR =
+      SI32_CLKCTRL_A_APBCLKG0_PLL0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_ENCDEC0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_DCDC0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_LCD0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_DTM2CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_DTM1CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_DTM0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_ACCTR0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_LPT0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_IDAC0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_CRC0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_AES0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_CMP1CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_CMP0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_ADC0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_TIMER2CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_TIMER1CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_TIMER0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_EPCA0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_I2C0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_SPI1CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_SPI0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_UART0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_USART0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_PB0CEN_MASK
+	  | SI32_CLKCTRL_A_APBCLKG0_FLCTRLCEN_MASK;
+
+       basePointer->APBCLKG1_CLR =
+         SI32_CLKCTRL_A_APBCLKG1_MISC0CEN_MASK
+         | SI32_CLKCTRL_A_APBCLKG1_MISC1CEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_disable_apb_to_all_modules(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_disable_apb_to_all_modules(basePointer)
 #define SI32_CLKCTRL_A_disable_apb_to_all_modules(basePointer) do{  \
@@ -917,9 +1532,21 @@ _SI32_CLKCTRL_A_disable_apb_to_all_modules(SI32_CLKCTRL_A_Type* /*basePointer*/)
 ///  pm3cn
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_write_pm3cn(
+   SI32_CLKCTRL_A_Type * basePointer,
+   uint32_t pm3cn)
+{
+   //{{
+   basePointer->PM3CN.U32 = pm3cn;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_write_pm3cn(SI32_CLKCTRL_A_Type* /*basePointer*/,
    uint32_t /*pm3cn*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_write_pm3cn(basePointer, pm3cn)
 #define SI32_CLKCTRL_A_write_pm3cn(basePointer, pm3cn) \
@@ -934,8 +1561,19 @@ _SI32_CLKCTRL_A_write_pm3cn(SI32_CLKCTRL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_CLKCTRL_A_read_pm3cn(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   return basePointer->PM3CN.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_CLKCTRL_A_read_pm3cn(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_read_pm3cn(basePointer)
 #define SI32_CLKCTRL_A_read_pm3cn(basePointer) \
@@ -947,8 +1585,20 @@ _SI32_CLKCTRL_A_read_pm3cn(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_enter_fast_wake_mode(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->PM3CN.PM3CEN =
+      SI32_CLKCTRL_A_PM3CN_PM3CEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_enter_fast_wake_mode(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_enter_fast_wake_mode(basePointer)
 #define SI32_CLKCTRL_A_enter_fast_wake_mode(basePointer) do{  \
@@ -962,8 +1612,20 @@ _SI32_CLKCTRL_A_enter_fast_wake_mode(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_exit_fast_wake_mode(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->PM3CN.PM3CEN =
+      SI32_CLKCTRL_A_PM3CN_PM3CEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_exit_fast_wake_mode(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_exit_fast_wake_mode(basePointer)
 #define SI32_CLKCTRL_A_exit_fast_wake_mode(basePointer) do{  \
@@ -977,8 +1639,20 @@ _SI32_CLKCTRL_A_exit_fast_wake_mode(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_fast_wake_clock_source_low_power_oscillator(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->PM3CN.PM3CSEL =
+      SI32_CLKCTRL_A_PM3CN_PM3CSEL_LPOSC0_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_fast_wake_clock_source_low_power_oscillator(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_fast_wake_clock_source_low_power_oscillator(basePointer)
 #define SI32_CLKCTRL_A_select_fast_wake_clock_source_low_power_oscillator(basePointer) do{  \
@@ -992,8 +1666,20 @@ _SI32_CLKCTRL_A_select_fast_wake_clock_source_low_power_oscillator(SI32_CLKCTRL_
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_fast_wake_clock_source_low_frequency_oscillator(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->PM3CN.PM3CSEL =
+      SI32_CLKCTRL_A_PM3CN_PM3CSEL_LFOSC0_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_fast_wake_clock_source_low_frequency_oscillator(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_fast_wake_clock_source_low_frequency_oscillator(basePointer)
 #define SI32_CLKCTRL_A_select_fast_wake_clock_source_low_frequency_oscillator(basePointer) do{  \
@@ -1007,8 +1693,20 @@ _SI32_CLKCTRL_A_select_fast_wake_clock_source_low_frequency_oscillator(SI32_CLKC
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_fast_wake_clock_source_rtc0tclk(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->PM3CN.PM3CSEL =
+      SI32_CLKCTRL_A_PM3CN_PM3CSEL_RTC0TCLK_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_fast_wake_clock_source_rtc0tclk(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_fast_wake_clock_source_rtc0tclk(basePointer)
 #define SI32_CLKCTRL_A_select_fast_wake_clock_source_rtc0tclk(basePointer) do{  \
@@ -1022,8 +1720,20 @@ _SI32_CLKCTRL_A_select_fast_wake_clock_source_rtc0tclk(SI32_CLKCTRL_A_Type* /*ba
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_fast_wake_clock_source_external_oscillator(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->PM3CN.PM3CSEL =
+      SI32_CLKCTRL_A_PM3CN_PM3CSEL_EXTOSC0_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_fast_wake_clock_source_external_oscillator(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_fast_wake_clock_source_external_oscillator(basePointer)
 #define SI32_CLKCTRL_A_select_fast_wake_clock_source_external_oscillator(basePointer) do{  \
@@ -1037,8 +1747,20 @@ _SI32_CLKCTRL_A_select_fast_wake_clock_source_external_oscillator(SI32_CLKCTRL_A
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_fast_wake_clock_source_viorfclk(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->PM3CN.PM3CSEL =
+      SI32_CLKCTRL_A_PM3CN_PM3CSEL_VIORFCLK_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_fast_wake_clock_source_viorfclk(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_fast_wake_clock_source_viorfclk(basePointer)
 #define SI32_CLKCTRL_A_select_fast_wake_clock_source_viorfclk(basePointer) do{  \
@@ -1052,8 +1774,20 @@ _SI32_CLKCTRL_A_select_fast_wake_clock_source_viorfclk(SI32_CLKCTRL_A_Type* /*ba
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_fast_wake_clock_source_pll(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->PM3CN.PM3CSEL =
+      SI32_CLKCTRL_A_PM3CN_PM3CSEL_PLL0OSC_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_fast_wake_clock_source_pll(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_fast_wake_clock_source_pll(basePointer)
 #define SI32_CLKCTRL_A_select_fast_wake_clock_source_pll(basePointer) do{  \
@@ -1067,8 +1801,20 @@ _SI32_CLKCTRL_A_select_fast_wake_clock_source_pll(SI32_CLKCTRL_A_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_fast_wake_clock_source_divided_low_power_oscillator(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->PM3CN.PM3CSEL =
+      SI32_CLKCTRL_A_PM3CN_PM3CSEL_LPOSC0_DIV_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_fast_wake_clock_source_divided_low_power_oscillator(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_fast_wake_clock_source_divided_low_power_oscillator(basePointer)
 #define SI32_CLKCTRL_A_select_fast_wake_clock_source_divided_low_power_oscillator(basePointer) do{  \
@@ -1090,9 +1836,21 @@ _SI32_CLKCTRL_A_select_fast_wake_clock_source_divided_low_power_oscillator(SI32_
 ///  config
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_write_config(
+   SI32_CLKCTRL_A_Type * basePointer,
+   uint32_t config)
+{
+   //{{
+   basePointer->CONFIG.U32 = config;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_write_config(SI32_CLKCTRL_A_Type* /*basePointer*/,
    uint32_t /*config*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_write_config(basePointer, config)
 #define SI32_CLKCTRL_A_write_config(basePointer, config) \
@@ -1107,8 +1865,19 @@ _SI32_CLKCTRL_A_write_config(SI32_CLKCTRL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_CLKCTRL_A_read_config(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONFIG.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_CLKCTRL_A_read_config(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_read_config(basePointer)
 #define SI32_CLKCTRL_A_read_config(basePointer) \
@@ -1120,8 +1889,19 @@ _SI32_CLKCTRL_A_read_config(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_enable_power_mode_8(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_CLKCTRL_A_CONFIG_PMSEL_PM8_EN_U32;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_enable_power_mode_8(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_enable_power_mode_8(basePointer)
 #define SI32_CLKCTRL_A_enable_power_mode_8(basePointer) \
@@ -1133,8 +1913,19 @@ _SI32_CLKCTRL_A_enable_power_mode_8(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_disable_power_mode_8(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_CLKCTRL_A_CONFIG_PMSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_disable_power_mode_8(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_disable_power_mode_8(basePointer)
 #define SI32_CLKCTRL_A_disable_power_mode_8(basePointer) \
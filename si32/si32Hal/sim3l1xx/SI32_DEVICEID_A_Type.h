@@ -53,8 +53,26 @@ extern "C" {
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline SI32_DEVICEID_Type
+_SI32_DEVICEID_A_read_device_id(
+   SI32_DEVICEID_A_Type * basePointer)
+{
+   //{{
+   SI32_DEVICEID_Type id;
+
+	id.deviceid[0] = basePointer->DEVICEID0.U32;
+	id.deviceid[1] = basePointer->DEVICEID1.U32;
+	id.deviceid[2] = basePointer->DEVICEID2.U32;
+   id.deviceid[3] = basePointer->DEVICEID3.U32;
+
+   return id;
+   //}}
+}
+#else
 SI32_DEVICEID_Type
 _SI32_DEVICEID_A_read_device_id(SI32_DEVICEID_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DEVICEID_A_read_device_id(basePointer)
 #define SI32_DEVICEID_A_read_device_id(basePointer) \
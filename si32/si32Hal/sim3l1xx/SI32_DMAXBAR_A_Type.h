@@ -60,10 +60,26 @@ extern "C" {
 ///  Valid range is 32 bits.
 ///  Write to DMAXBAR1 register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DMAXBAR_A_initialize(
+   SI32_DMAXBAR_A_Type * basePointer,
+   // Write to DMAXBAR0 register.
+   uint32_t dmaxbar0,
+   // Write to DMAXBAR1 register.
+   uint32_t dmaxbar1)
+{
+   //{{
+   basePointer->DMAXBAR0.U32 = dmaxbar0;
+   basePointer->DMAXBAR1.U32 = dmaxbar1;
+   //}}
+}
+#else
 void
 _SI32_DMAXBAR_A_initialize(SI32_DMAXBAR_A_Type* /*basePointer*/,
    uint32_t, /*dmaxbar0*/
    uint32_t /*dmaxbar1*/);
+#endif
 ///
 /// @def SI32_DMAXBAR_A_initialize(basePointer, dmaxbar0, dmaxbar1)
 #define SI32_DMAXBAR_A_initialize(basePointer, dmaxbar0, dmaxbar1) do{  \
@@ -80,8 +96,19 @@ _SI32_DMAXBAR_A_initialize(SI32_DMAXBAR_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_DMAXBAR_A_read_dmaxbar0(
+   SI32_DMAXBAR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DMAXBAR0.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_DMAXBAR_A_read_dmaxbar0(SI32_DMAXBAR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DMAXBAR_A_read_dmaxbar0(basePointer)
 #define SI32_DMAXBAR_A_read_dmaxbar0(basePointer) \
@@ -101,9 +128,21 @@ _SI32_DMAXBAR_A_read_dmaxbar0(SI32_DMAXBAR_A_Type* /*basePointer*/);
 ///  dmaxbar0
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DMAXBAR_A_write_dmaxbar0(
+   SI32_DMAXBAR_A_Type * basePointer,
+   uint32_t dmaxbar0)
+{
+   //{{
+   basePointer->DMAXBAR0.U32 = dmaxbar0;
+   //}}
+}
+#else
 void
 _SI32_DMAXBAR_A_write_dmaxbar0(SI32_DMAXBAR_A_Type* /*basePointer*/,
    uint32_t /*dmaxbar0*/);
+#endif
 ///
 /// @def SI32_DMAXBAR_A_write_dmaxbar0(basePointer, dmaxbar0)
 #define SI32_DMAXBAR_A_write_dmaxbar0(basePointer, dmaxbar0) \
@@ -118,8 +157,19 @@ _SI32_DMAXBAR_A_write_dmaxbar0(SI32_DMAXBAR_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_DMAXBAR_A_read_dmaxbar1(
+   SI32_DMAXBAR_A_Type * basePointer)
+{
+   //{{
+   return basePointer->DMAXBAR1.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_DMAXBAR_A_read_dmaxbar1(SI32_DMAXBAR_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_DMAXBAR_A_read_dmaxbar1(basePointer)
 #define SI32_DMAXBAR_A_read_dmaxbar1(basePointer) \
@@ -139,9 +189,21 @@ _SI32_DMAXBAR_A_read_dmaxbar1(SI32_DMAXBAR_A_Type* /*basePointer*/);
 ///  dmaxbar1
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_DMAXBAR_A_write_dmaxbar1(
+   SI32_DMAXBAR_A_Type * basePointer,
+   uint32_t dmaxbar1)
+{
+   //{{
+   basePointer->DMAXBAR1.U32 = dmaxbar1;
+   //}}
+}
+#else
 void
 _SI32_DMAXBAR_A_write_dmaxbar1(SI32_DMAXBAR_A_Type* /*basePointer*/,
    uint32_t /*dmaxbar1*/);
+#endif
 ///
 /// @def SI32_DMAXBAR_A_write_dmaxbar1(basePointer, dmaxbar1)
 #define SI32_DMAXBAR_A_write_dmaxbar1(basePointer, dmaxbar1) \
@@ -165,9 +227,36 @@ _SI32_DMAXBAR_A_write_dmaxbar1(SI32_DMAXBAR_A_Type* /*basePointer*/,
 ///  chnsel
 ///  See SI32_DMAXBAR_A_Support.h for encodings.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_DMAXBAR_A_select_channel_peripheral(
+   SI32_DMAXBAR_A_Type * basePointer,
+   // See SI32_DMAXBAR_A_Support.h for encodings.
+   SI32_DMAXBAR_CHNSEL_Enum_Type chnsel)
+{
+   //{{
+   uint32_t shift = (chnsel & 0x70) >> 2;
+   uint32_t mask = 0xF << shift;
+   uint32_t value = (chnsel & 0xF) << shift;
+
+   if (chnsel & 0x80)
+   {
+   //Channels 8-15 are in register 1
+     basePointer->DMAXBAR1_CLR = mask;
+     basePointer->DMAXBAR1_SET = value;
+   } else {
+   //Channels 0-7 are in register 0
+     basePointer->DMAXBAR0_CLR = mask;
+     basePointer->DMAXBAR0_SET = value;
+   }
+   return SI32_DMAXBAR_CHANNEL_OF(chnsel);
+   //}}
+}
+#else
 uint32_t
 _SI32_DMAXBAR_A_select_channel_peripheral(SI32_DMAXBAR_A_Type* /*basePointer*/,
    SI32_DMAXBAR_CHNSEL_Enum_Type /*chnsel*/);
+#endif
 ///
 /// @def SI32_DMAXBAR_A_select_channel_peripheral(basePointer, chnsel)
 #define SI32_DMAXBAR_A_select_channel_peripheral(basePointer, chnsel) \
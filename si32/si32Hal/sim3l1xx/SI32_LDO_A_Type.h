@@ -55,9 +55,21 @@ extern "C" {
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LDO_A_write_control(
+   SI32_LDO_A_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_LDO_A_write_control(SI32_LDO_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_LDO_A_write_control(basePointer, control)
 #define SI32_LDO_A_write_control(basePointer, control) \
@@ -72,8 +84,19 @@ _SI32_LDO_A_write_control(SI32_LDO_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_LDO_A_read_control(
+   SI32_LDO_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_LDO_A_read_control(SI32_LDO_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LDO_A_read_control(basePointer)
 #define SI32_LDO_A_read_control(basePointer) \
@@ -85,8 +108,19 @@ _SI32_LDO_A_read_control(SI32_LDO_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LDO_A_select_digital_source_vbat_pin(
+   SI32_LDO_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LDO_A_CONTROL_DLDOSSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_LDO_A_select_digital_source_vbat_pin(SI32_LDO_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LDO_A_select_digital_source_vbat_pin(basePointer)
 #define SI32_LDO_A_select_digital_source_vbat_pin(basePointer) \
@@ -98,8 +132,19 @@ _SI32_LDO_A_select_digital_source_vbat_pin(SI32_LDO_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LDO_A_select_digital_source_dcdc_output(
+   SI32_LDO_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LDO_A_CONTROL_DLDOSSEL_DCDC_U32;
+   //}}
+}
+#else
 void
 _SI32_LDO_A_select_digital_source_dcdc_output(SI32_LDO_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LDO_A_select_digital_source_dcdc_output(basePointer)
 #define SI32_LDO_A_select_digital_source_dcdc_output(basePointer) \
@@ -111,8 +156,19 @@ _SI32_LDO_A_select_digital_source_dcdc_output(SI32_LDO_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LDO_A_select_digital_bias_high(
+   SI32_LDO_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LDO_A_CONTROL_DLDOBSEL_HIGH_U32;
+   //}}
+}
+#else
 void
 _SI32_LDO_A_select_digital_bias_high(SI32_LDO_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LDO_A_select_digital_bias_high(basePointer)
 #define SI32_LDO_A_select_digital_bias_high(basePointer) \
@@ -124,8 +180,19 @@ _SI32_LDO_A_select_digital_bias_high(SI32_LDO_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LDO_A_select_digital_bias_low(
+   SI32_LDO_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LDO_A_CONTROL_DLDOBSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_LDO_A_select_digital_bias_low(SI32_LDO_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LDO_A_select_digital_bias_low(basePointer)
 #define SI32_LDO_A_select_digital_bias_low(basePointer) \
@@ -146,9 +213,22 @@ _SI32_LDO_A_select_digital_bias_low(SI32_LDO_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 5 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LDO_A_set_digital_output_value(
+   SI32_LDO_A_Type * basePointer,
+   uint32_t value)
+{
+   assert(value < 32);   // value < 2^5
+   //{{
+   basePointer->CONTROL.DLDOOVAL = value;
+   //}}
+}
+#else
 void
 _SI32_LDO_A_set_digital_output_value(SI32_LDO_A_Type* /*basePointer*/,
    uint32_t /*value*/);
+#endif
 ///
 /// @def SI32_LDO_A_set_digital_output_value(basePointer, value)
 #define SI32_LDO_A_set_digital_output_value(basePointer, value) \
@@ -163,8 +243,19 @@ _SI32_LDO_A_set_digital_output_value(SI32_LDO_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_LDO_A_get_digital_output_value(
+   SI32_LDO_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.DLDOOVAL;
+   //}}
+}
+#else
 uint32_t
 _SI32_LDO_A_get_digital_output_value(SI32_LDO_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LDO_A_get_digital_output_value(basePointer)
 #define SI32_LDO_A_get_digital_output_value(basePointer) \
@@ -176,8 +267,19 @@ _SI32_LDO_A_get_digital_output_value(SI32_LDO_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LDO_A_select_memory_source_vbat_pin(
+   SI32_LDO_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LDO_A_CONTROL_MLDOSSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_LDO_A_select_memory_source_vbat_pin(SI32_LDO_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LDO_A_select_memory_source_vbat_pin(basePointer)
 #define SI32_LDO_A_select_memory_source_vbat_pin(basePointer) \
@@ -189,8 +291,19 @@ _SI32_LDO_A_select_memory_source_vbat_pin(SI32_LDO_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LDO_A_select_memory_source_dcdc_output(
+   SI32_LDO_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LDO_A_CONTROL_MLDOSSEL_DCDC_U32;
+   //}}
+}
+#else
 void
 _SI32_LDO_A_select_memory_source_dcdc_output(SI32_LDO_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LDO_A_select_memory_source_dcdc_output(basePointer)
 #define SI32_LDO_A_select_memory_source_dcdc_output(basePointer) \
@@ -202,8 +315,19 @@ _SI32_LDO_A_select_memory_source_dcdc_output(SI32_LDO_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LDO_A_select_memory_bias_high(
+   SI32_LDO_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LDO_A_CONTROL_MLDOBSEL_HIGH_U32;
+   //}}
+}
+#else
 void
 _SI32_LDO_A_select_memory_bias_high(SI32_LDO_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LDO_A_select_memory_bias_high(basePointer)
 #define SI32_LDO_A_select_memory_bias_high(basePointer) \
@@ -215,8 +339,19 @@ _SI32_LDO_A_select_memory_bias_high(SI32_LDO_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LDO_A_select_memory_bias_low(
+   SI32_LDO_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LDO_A_CONTROL_MLDOBSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_LDO_A_select_memory_bias_low(SI32_LDO_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LDO_A_select_memory_bias_low(basePointer)
 #define SI32_LDO_A_select_memory_bias_low(basePointer) \
@@ -237,9 +372,22 @@ _SI32_LDO_A_select_memory_bias_low(SI32_LDO_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 5 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LDO_A_set_memory_output_value(
+   SI32_LDO_A_Type * basePointer,
+   uint32_t value)
+{
+   assert(value < 32);   // value < 2^5
+   //{{
+   basePointer->CONTROL.MLDOOVAL = value;
+   //}}
+}
+#else
 void
 _SI32_LDO_A_set_memory_output_value(SI32_LDO_A_Type* /*basePointer*/,
    uint32_t /*value*/);
+#endif
 ///
 /// @def SI32_LDO_A_set_memory_output_value(basePointer, value)
 #define SI32_LDO_A_set_memory_output_value(basePointer, value) \
@@ -254,8 +402,19 @@ _SI32_LDO_A_set_memory_output_value(SI32_LDO_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_LDO_A_get_memory_output_value(
+   SI32_LDO_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.MLDOOVAL;
+   //}}
+}
+#else
 uint32_t
 _SI32_LDO_A_get_memory_output_value(SI32_LDO_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LDO_A_get_memory_output_value(basePointer)
 #define SI32_LDO_A_get_memory_output_value(basePointer) \
@@ -267,8 +426,19 @@ _SI32_LDO_A_get_memory_output_value(SI32_LDO_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LDO_A_select_analog_source_vbat_pin(
+   SI32_LDO_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LDO_A_CONTROL_ALDOSSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_LDO_A_select_analog_source_vbat_pin(SI32_LDO_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LDO_A_select_analog_source_vbat_pin(basePointer)
 #define SI32_LDO_A_select_analog_source_vbat_pin(basePointer) \
@@ -280,8 +450,19 @@ _SI32_LDO_A_select_analog_source_vbat_pin(SI32_LDO_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LDO_A_select_analog_source_dcdc_output(
+   SI32_LDO_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LDO_A_CONTROL_ALDOSSEL_DCDC_U32;
+   //}}
+}
+#else
 void
 _SI32_LDO_A_select_analog_source_dcdc_output(SI32_LDO_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LDO_A_select_analog_source_dcdc_output(basePointer)
 #define SI32_LDO_A_select_analog_source_dcdc_output(basePointer) \
@@ -293,8 +474,19 @@ _SI32_LDO_A_select_analog_source_dcdc_output(SI32_LDO_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LDO_A_select_analog_bias_high(
+   SI32_LDO_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_LDO_A_CONTROL_ALDOBSEL_HIGH_U32;
+   //}}
+}
+#else
 void
 _SI32_LDO_A_select_analog_bias_high(SI32_LDO_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LDO_A_select_analog_bias_high(basePointer)
 #define SI32_LDO_A_select_analog_bias_high(basePointer) \
@@ -306,8 +498,19 @@ _SI32_LDO_A_select_analog_bias_high(SI32_LDO_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LDO_A_select_analog_bias_low(
+   SI32_LDO_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_LDO_A_CONTROL_ALDOBSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_LDO_A_select_analog_bias_low(SI32_LDO_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LDO_A_select_analog_bias_low(basePointer)
 #define SI32_LDO_A_select_analog_bias_low(basePointer) \
@@ -328,9 +531,22 @@ _SI32_LDO_A_select_analog_bias_low(SI32_LDO_A_Type* /*basePointer*/);
 ///  value
 ///  Valid range is 5 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_LDO_A_set_analog_output_value(
+   SI32_LDO_A_Type * basePointer,
+   uint32_t value)
+{
+   assert(value < 32);   // value < 2^5
+   //{{
+   basePointer->CONTROL.ALDOOVAL = value;
+   //}}
+}
+#else
 void
 _SI32_LDO_A_set_analog_output_value(SI32_LDO_A_Type* /*basePointer*/,
    uint32_t /*value*/);
+#endif
 ///
 /// @def SI32_LDO_A_set_analog_output_value(basePointer, value)
 #define SI32_LDO_A_set_analog_output_value(basePointer, value) \
@@ -345,8 +561,19 @@ _SI32_LDO_A_set_analog_output_value(SI32_LDO_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_LDO_A_get_analog_output_value(
+   SI32_LDO_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.ALDOOVAL;
+   //}}
+}
+#else
 uint32_t
 _SI32_LDO_A_get_analog_output_value(SI32_LDO_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_LDO_A_get_analog_output_value(basePointer)
 #define SI32_LDO_A_get_analog_output_value(basePointer) \
@@ -74,12 +74,30 @@ extern "C" {
 ///  pbkey
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_initialize(
+   SI32_PBCFG_A_Type * basePointer,
+   uint32_t control0,
+   uint32_t control1,
+   uint32_t xbar0,
+   uint32_t pbkey)
+{
+   //{{
+   basePointer->CONTROL0.U32 = control0;
+   basePointer->CONTROL1.U32 = control1;
+   basePointer->XBAR0.U32    = xbar0;
+   basePointer->PBKEY.U32    = pbkey;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_initialize(SI32_PBCFG_A_Type* /*basePointer*/,
    uint32_t, /*control0*/
    uint32_t, /*control1*/
    uint32_t, /*xbar0*/
    uint32_t /*pbkey*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_initialize(basePointer, control0, control1, xbar0, pbkey)
 #define SI32_PBCFG_A_initialize(basePointer, control0, control1, xbar0, pbkey) do{  \
@@ -103,9 +121,21 @@ _SI32_PBCFG_A_initialize(SI32_PBCFG_A_Type* /*basePointer*/,
 ///  control0
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_write_control0(
+   SI32_PBCFG_A_Type * basePointer,
+   uint32_t control0)
+{
+   //{{
+   basePointer->CONTROL0.U32 = control0;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_write_control0(SI32_PBCFG_A_Type* /*basePointer*/,
    uint32_t /*control0*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_write_control0(basePointer, control0)
 #define SI32_PBCFG_A_write_control0(basePointer, control0) \
@@ -120,8 +150,19 @@ _SI32_PBCFG_A_write_control0(SI32_PBCFG_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PBCFG_A_read_control0(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL0.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PBCFG_A_read_control0(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_read_control0(basePointer)
 #define SI32_PBCFG_A_read_control0(basePointer) \
@@ -142,9 +183,25 @@ _SI32_PBCFG_A_read_control0(SI32_PBCFG_A_Type* /*basePointer*/);
 ///  Valid range is 4 bits.
 ///  Pin to use as INT0 (0 = INT0.0, ..., 15 = INT0.15).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_select_interrupt_0_pin(
+   SI32_PBCFG_A_Type * basePointer,
+   // Pin to use as INT0 (0 = INT0.0, ..., 15 = INT0.15).
+   uint32_t source)
+{
+   assert(source < 16);   // source < 2^4
+   //{{
+   basePointer->CONTROL0_CLR = SI32_PBCFG_A_CONTROL0_INT0SEL_MASK;
+   basePointer->CONTROL0_SET =
+      source << SI32_PBCFG_A_CONTROL0_INT0SEL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_select_interrupt_0_pin(SI32_PBCFG_A_Type* /*basePointer*/,
    uint32_t /*source*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_select_interrupt_0_pin(basePointer, source)
 #define SI32_PBCFG_A_select_interrupt_0_pin(basePointer, source) do{  \
@@ -159,8 +216,19 @@ _SI32_PBCFG_A_select_interrupt_0_pin(SI32_PBCFG_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_set_interrupt_0_polarity_low(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL0_CLR = SI32_PBCFG_A_CONTROL0_INT0POL_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_set_interrupt_0_polarity_low(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_set_interrupt_0_polarity_low(basePointer)
 #define SI32_PBCFG_A_set_interrupt_0_polarity_low(basePointer) \
@@ -172,8 +240,19 @@ _SI32_PBCFG_A_set_interrupt_0_polarity_low(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_set_interrupt_0_polarity_high(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL0_SET = SI32_PBCFG_A_CONTROL0_INT0POL_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_set_interrupt_0_polarity_high(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_set_interrupt_0_polarity_high(basePointer)
 #define SI32_PBCFG_A_set_interrupt_0_polarity_high(basePointer) \
@@ -185,8 +264,19 @@ _SI32_PBCFG_A_set_interrupt_0_polarity_high(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_select_interrupt_0_level_mode(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL0_CLR = SI32_PBCFG_A_CONTROL0_INT0MD_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_select_interrupt_0_level_mode(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_select_interrupt_0_level_mode(basePointer)
 #define SI32_PBCFG_A_select_interrupt_0_level_mode(basePointer) \
@@ -198,8 +288,20 @@ _SI32_PBCFG_A_select_interrupt_0_level_mode(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_select_interrupt_0_rising_edge_mode(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL0_SET = SI32_PBCFG_A_CONTROL0_INT0MD_EDGE_U32 | 
+		SI32_PBCFG_A_CONTROL0_INT0POL_HIGH_U32;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_select_interrupt_0_rising_edge_mode(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_select_interrupt_0_rising_edge_mode(basePointer)
 #define SI32_PBCFG_A_select_interrupt_0_rising_edge_mode(basePointer) do{  \
@@ -213,8 +315,20 @@ _SI32_PBCFG_A_select_interrupt_0_rising_edge_mode(SI32_PBCFG_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_select_interrupt_0_falling_edge_mode(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL0_SET = SI32_PBCFG_A_CONTROL0_INT0MD_EDGE_U32;
+	basePointer->CONTROL0_CLR =	SI32_PBCFG_A_CONTROL0_INT0POL_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_select_interrupt_0_falling_edge_mode(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_select_interrupt_0_falling_edge_mode(basePointer)
 #define SI32_PBCFG_A_select_interrupt_0_falling_edge_mode(basePointer) do{  \
@@ -228,8 +342,19 @@ _SI32_PBCFG_A_select_interrupt_0_falling_edge_mode(SI32_PBCFG_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_select_interrupt_0_dual_edge_mode(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL0_SET = SI32_PBCFG_A_CONTROL0_INT0MD_DUAL_EDGE_U32;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_select_interrupt_0_dual_edge_mode(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_select_interrupt_0_dual_edge_mode(basePointer)
 #define SI32_PBCFG_A_select_interrupt_0_dual_edge_mode(basePointer) \
@@ -241,8 +366,19 @@ _SI32_PBCFG_A_select_interrupt_0_dual_edge_mode(SI32_PBCFG_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_enable_interrupt_0(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL0_SET = SI32_PBCFG_A_CONTROL0_INT0EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_enable_interrupt_0(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_enable_interrupt_0(basePointer)
 #define SI32_PBCFG_A_enable_interrupt_0(basePointer) \
@@ -254,8 +390,19 @@ _SI32_PBCFG_A_enable_interrupt_0(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_disable_interrupt_0(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL0_CLR = SI32_PBCFG_A_CONTROL0_INT0EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_disable_interrupt_0(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_disable_interrupt_0(basePointer)
 #define SI32_PBCFG_A_disable_interrupt_0(basePointer) \
@@ -276,9 +423,25 @@ _SI32_PBCFG_A_disable_interrupt_0(SI32_PBCFG_A_Type* /*basePointer*/);
 ///  Valid range is 4 bits.
 ///  Pin to use as INT1 (0 = INT1.0, ..., 15 = INT1.15).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_select_interrupt_1_pin(
+   SI32_PBCFG_A_Type * basePointer,
+   // Pin to use as INT1 (0 = INT1.0, ..., 15 = INT1.15).
+   uint32_t source)
+{
+   assert(source < 16);   // source < 2^4
+   //{{
+   basePointer->CONTROL0_CLR = SI32_PBCFG_A_CONTROL0_INT1SEL_MASK;
+   basePointer->CONTROL0_SET =
+      source << SI32_PBCFG_A_CONTROL0_INT1SEL_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_select_interrupt_1_pin(SI32_PBCFG_A_Type* /*basePointer*/,
    uint32_t /*source*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_select_interrupt_1_pin(basePointer, source)
 #define SI32_PBCFG_A_select_interrupt_1_pin(basePointer, source) do{  \
@@ -293,8 +456,19 @@ _SI32_PBCFG_A_select_interrupt_1_pin(SI32_PBCFG_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_set_interrupt_1_polarity_low(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL0_CLR = SI32_PBCFG_A_CONTROL0_INT1POL_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_set_interrupt_1_polarity_low(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_set_interrupt_1_polarity_low(basePointer)
 #define SI32_PBCFG_A_set_interrupt_1_polarity_low(basePointer) \
@@ -306,8 +480,19 @@ _SI32_PBCFG_A_set_interrupt_1_polarity_low(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_set_interrupt_1_polarity_high(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL0_SET = SI32_PBCFG_A_CONTROL0_INT1POL_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_set_interrupt_1_polarity_high(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_set_interrupt_1_polarity_high(basePointer)
 #define SI32_PBCFG_A_set_interrupt_1_polarity_high(basePointer) \
@@ -319,8 +504,19 @@ _SI32_PBCFG_A_set_interrupt_1_polarity_high(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_select_interrupt_1_level_mode(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL0_CLR = SI32_PBCFG_A_CONTROL0_INT1MD_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_select_interrupt_1_level_mode(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_select_interrupt_1_level_mode(basePointer)
 #define SI32_PBCFG_A_select_interrupt_1_level_mode(basePointer) \
@@ -332,8 +528,20 @@ _SI32_PBCFG_A_select_interrupt_1_level_mode(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_select_interrupt_1_rising_edge_mode(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL0_SET = SI32_PBCFG_A_CONTROL0_INT1MD_EDGE_U32 | 
+		SI32_PBCFG_A_CONTROL0_INT1POL_HIGH_U32;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_select_interrupt_1_rising_edge_mode(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_select_interrupt_1_rising_edge_mode(basePointer)
 #define SI32_PBCFG_A_select_interrupt_1_rising_edge_mode(basePointer) do{  \
@@ -347,8 +555,20 @@ _SI32_PBCFG_A_select_interrupt_1_rising_edge_mode(SI32_PBCFG_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_select_interrupt_1_falling_edge_mode(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL0_SET = SI32_PBCFG_A_CONTROL0_INT1MD_EDGE_U32;
+	basePointer->CONTROL0_CLR =	SI32_PBCFG_A_CONTROL0_INT1POL_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_select_interrupt_1_falling_edge_mode(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_select_interrupt_1_falling_edge_mode(basePointer)
 #define SI32_PBCFG_A_select_interrupt_1_falling_edge_mode(basePointer) do{  \
@@ -362,8 +582,19 @@ _SI32_PBCFG_A_select_interrupt_1_falling_edge_mode(SI32_PBCFG_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_select_interrupt_1_dual_edge_mode(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL0_SET = SI32_PBCFG_A_CONTROL0_INT1MD_DUAL_EDGE_U32;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_select_interrupt_1_dual_edge_mode(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_select_interrupt_1_dual_edge_mode(basePointer)
 #define SI32_PBCFG_A_select_interrupt_1_dual_edge_mode(basePointer) \
@@ -375,8 +606,19 @@ _SI32_PBCFG_A_select_interrupt_1_dual_edge_mode(SI32_PBCFG_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_enable_interrupt_1(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL0_SET = SI32_PBCFG_A_CONTROL0_INT1EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_enable_interrupt_1(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_enable_interrupt_1(basePointer)
 #define SI32_PBCFG_A_enable_interrupt_1(basePointer) \
@@ -388,8 +630,19 @@ _SI32_PBCFG_A_enable_interrupt_1(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_disable_interrupt_1(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL0_CLR = SI32_PBCFG_A_CONTROL0_INT1EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_disable_interrupt_1(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_disable_interrupt_1(basePointer)
 #define SI32_PBCFG_A_disable_interrupt_1(basePointer) \
@@ -406,9 +659,24 @@ _SI32_PBCFG_A_disable_interrupt_1(SI32_PBCFG_A_Type* /*basePointer*/);
 ///  timer
 ///  Valid range is 5 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_set_pulse_generator_timer(
+   SI32_PBCFG_A_Type * basePointer,
+   uint32_t timer)
+{
+   assert(timer < 32);   // timer < 2^5
+   //{{
+   basePointer->CONTROL0_CLR = SI32_PBCFG_A_CONTROL0_PGTIMER_MASK;
+   basePointer->CONTROL0_SET =
+      timer << SI32_PBCFG_A_CONTROL0_PGTIMER_SHIFT;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_set_pulse_generator_timer(SI32_PBCFG_A_Type* /*basePointer*/,
    uint32_t /*timer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_set_pulse_generator_timer(basePointer, timer)
 #define SI32_PBCFG_A_set_pulse_generator_timer(basePointer, timer) do{  \
@@ -423,8 +691,19 @@ _SI32_PBCFG_A_set_pulse_generator_timer(SI32_PBCFG_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PBCFG_A_get_pulse_generator_timer(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL0.PGTIMER;
+   //}}
+}
+#else
 uint32_t
 _SI32_PBCFG_A_get_pulse_generator_timer(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_get_pulse_generator_timer(basePointer)
 #define SI32_PBCFG_A_get_pulse_generator_timer(basePointer) \
@@ -436,8 +715,19 @@ _SI32_PBCFG_A_get_pulse_generator_timer(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PBCFG_A_is_pulse_generator_timer_done(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL0.PGDONEF);
+   //}}
+}
+#else
 bool
 _SI32_PBCFG_A_is_pulse_generator_timer_done(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_is_pulse_generator_timer_done(basePointer)
 #define SI32_PBCFG_A_is_pulse_generator_timer_done(basePointer) \
@@ -457,9 +747,21 @@ _SI32_PBCFG_A_is_pulse_generator_timer_done(SI32_PBCFG_A_Type* /*basePointer*/);
 ///  control1
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_write_control1(
+   SI32_PBCFG_A_Type * basePointer,
+   uint32_t control1)
+{
+   //{{
+   basePointer->CONTROL1.U32 = control1;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_write_control1(SI32_PBCFG_A_Type* /*basePointer*/,
    uint32_t /*control1*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_write_control1(basePointer, control1)
 #define SI32_PBCFG_A_write_control1(basePointer, control1) \
@@ -474,8 +776,19 @@ _SI32_PBCFG_A_write_control1(SI32_PBCFG_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PBCFG_A_read_control1(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL1.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PBCFG_A_read_control1(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_read_control1(basePointer)
 #define SI32_PBCFG_A_read_control1(basePointer) \
@@ -487,8 +800,19 @@ _SI32_PBCFG_A_read_control1(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_enable_jtag(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL1_SET = SI32_PBCFG_A_CONTROL1_JTAGEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_enable_jtag(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_enable_jtag(basePointer)
 #define SI32_PBCFG_A_enable_jtag(basePointer) \
@@ -500,8 +824,19 @@ _SI32_PBCFG_A_enable_jtag(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_disable_jtag(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL1_CLR = SI32_PBCFG_A_CONTROL1_JTAGEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_disable_jtag(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_disable_jtag(basePointer)
 #define SI32_PBCFG_A_disable_jtag(basePointer) \
@@ -513,8 +848,19 @@ _SI32_PBCFG_A_disable_jtag(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_enable_etm(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL1_SET = SI32_PBCFG_A_CONTROL1_ETMEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_enable_etm(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_enable_etm(basePointer)
 #define SI32_PBCFG_A_enable_etm(basePointer) \
@@ -526,8 +872,19 @@ _SI32_PBCFG_A_enable_etm(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_disable_etm(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL1_CLR = SI32_PBCFG_A_CONTROL1_ETMEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_disable_etm(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_disable_etm(basePointer)
 #define SI32_PBCFG_A_disable_etm(basePointer) \
@@ -542,8 +899,19 @@ _SI32_PBCFG_A_disable_etm(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_enable_swv(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL1_SET = SI32_PBCFG_A_CONTROL1_SWVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_enable_swv(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_enable_swv(basePointer)
 #define SI32_PBCFG_A_enable_swv(basePointer) \
@@ -558,8 +926,19 @@ _SI32_PBCFG_A_enable_swv(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_disable_swv(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL1_CLR = SI32_PBCFG_A_CONTROL1_SWVEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_disable_swv(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_disable_swv(basePointer)
 #define SI32_PBCFG_A_disable_swv(basePointer) \
@@ -575,8 +954,19 @@ _SI32_PBCFG_A_disable_swv(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_enable_spi1_on_crossbar(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL1_SET = SI32_PBCFG_A_CONTROL1_SPI1SEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_enable_spi1_on_crossbar(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_enable_spi1_on_crossbar(basePointer)
 #define SI32_PBCFG_A_enable_spi1_on_crossbar(basePointer) \
@@ -592,8 +982,19 @@ _SI32_PBCFG_A_enable_spi1_on_crossbar(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_disable_spi1_on_crossbar(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL1_CLR = SI32_PBCFG_A_CONTROL1_SPI1SEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_disable_spi1_on_crossbar(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_disable_spi1_on_crossbar(basePointer)
 #define SI32_PBCFG_A_disable_spi1_on_crossbar(basePointer) \
@@ -605,8 +1006,19 @@ _SI32_PBCFG_A_disable_spi1_on_crossbar(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_enable_port_match_interrupt(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL1_SET = SI32_PBCFG_A_CONTROL1_PMATCHEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_enable_port_match_interrupt(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_enable_port_match_interrupt(basePointer)
 #define SI32_PBCFG_A_enable_port_match_interrupt(basePointer) \
@@ -618,8 +1030,19 @@ _SI32_PBCFG_A_enable_port_match_interrupt(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_disable_port_match_interrupt(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL1_CLR = SI32_PBCFG_A_CONTROL1_PMATCHEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_disable_port_match_interrupt(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_disable_port_match_interrupt(basePointer)
 #define SI32_PBCFG_A_disable_port_match_interrupt(basePointer) \
@@ -631,8 +1054,19 @@ _SI32_PBCFG_A_disable_port_match_interrupt(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_enable_low_power_timer_output0(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL1_CLR = SI32_PBCFG_A_CONTROL1_LPTOSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_enable_low_power_timer_output0(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @defSI32_PBCFG_A_enable_low_power_timer_output0(basePointer)
 #define SI32_PBCFG_A_enable_low_power_timer_output0(basePointer) \
@@ -644,8 +1078,19 @@ _SI32_PBCFG_A_enable_low_power_timer_output0(SI32_PBCFG_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_enable_low_power_timer_output1(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+	basePointer->CONTROL1_SET = SI32_PBCFG_A_CONTROL1_LPTOSEL_MASK;	   
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_enable_low_power_timer_output1(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_enable_low_power_timer_output1(basePointer)
 #define SI32_PBCFG_A_enable_low_power_timer_output1(basePointer) \
@@ -660,8 +1105,19 @@ _SI32_PBCFG_A_enable_low_power_timer_output1(SI32_PBCFG_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_unlock_port_registers(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL1_CLR = SI32_PBCFG_A_CONTROL1_LOCK_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_unlock_port_registers(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_unlock_port_registers(basePointer)
 #define SI32_PBCFG_A_unlock_port_registers(basePointer) \
@@ -676,8 +1132,19 @@ _SI32_PBCFG_A_unlock_port_registers(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_lock_port_registers(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL1_SET = SI32_PBCFG_A_CONTROL1_LOCK_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_lock_port_registers(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_lock_port_registers(basePointer)
 #define SI32_PBCFG_A_lock_port_registers(basePointer) \
@@ -697,9 +1164,21 @@ _SI32_PBCFG_A_lock_port_registers(SI32_PBCFG_A_Type* /*basePointer*/);
 ///  xbar0
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_write_xbar0(
+   SI32_PBCFG_A_Type * basePointer,
+   uint32_t xbar0)
+{
+   //{{
+   basePointer->XBAR0.U32 = xbar0;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_write_xbar0(SI32_PBCFG_A_Type* /*basePointer*/,
    uint32_t /*xbar0*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_write_xbar0(basePointer, xbar0)
 #define SI32_PBCFG_A_write_xbar0(basePointer, xbar0) \
@@ -714,8 +1193,19 @@ _SI32_PBCFG_A_write_xbar0(SI32_PBCFG_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PBCFG_A_read_xbar0(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   return basePointer->XBAR0.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PBCFG_A_read_xbar0(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_read_xbar0(basePointer)
 #define SI32_PBCFG_A_read_xbar0(basePointer) \
@@ -736,9 +1226,22 @@ _SI32_PBCFG_A_read_xbar0(SI32_PBCFG_A_Type* /*basePointer*/);
 ///  Valid range is 32 bits.
 ///  Peripherals to enable.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_enable_xbar0_peripherals(
+   SI32_PBCFG_A_Type * basePointer,
+   // Peripherals to enable.
+   uint32_t mask)
+{
+   //{{
+   basePointer->XBAR0_SET = mask;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_enable_xbar0_peripherals(SI32_PBCFG_A_Type* /*basePointer*/,
    uint32_t /*mask*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_enable_xbar0_peripherals(basePointer, mask)
 #define SI32_PBCFG_A_enable_xbar0_peripherals(basePointer, mask) \
@@ -759,9 +1262,22 @@ _SI32_PBCFG_A_enable_xbar0_peripherals(SI32_PBCFG_A_Type* /*basePointer*/,
 ///  Valid range is 32 bits.
 ///  Peripherals to disable.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_disable_xbar0_peripherals(
+   SI32_PBCFG_A_Type * basePointer,
+   // Peripherals to disable.
+   uint32_t mask)
+{
+   //{{
+   basePointer->XBAR0_CLR = mask;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_disable_xbar0_peripherals(SI32_PBCFG_A_Type* /*basePointer*/,
    uint32_t /*mask*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_disable_xbar0_peripherals(basePointer, mask)
 #define SI32_PBCFG_A_disable_xbar0_peripherals(basePointer, mask) \
@@ -782,9 +1298,32 @@ _SI32_PBCFG_A_disable_xbar0_peripherals(SI32_PBCFG_A_Type* /*basePointer*/,
 ///  Valid range is 8 bits.
 ///  See Support.h for signal definitions.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_enable_xbar0_signal(
+   SI32_PBCFG_A_Type * basePointer,
+   // See Support.h for signal definitions.
+   SI32_PBCFG_A_XBAR0_Enum_Type signal)
+{
+   assert(signal < 256);   // signal < 2^8
+   //{{
+   uint32_t n = signal & 0x1F;
+   if (signal & 0x80)
+   {
+       basePointer->XBAR0_CLR = SI32_PBCFG_A_XBAR0_EPCA0EN_MASK;
+       basePointer->XBAR0_SET = n << SI32_PBCFG_A_XBAR0_EPCA0EN_SHIFT;
+   }
+   else
+   {
+       basePointer->XBAR0_SET = 1 << n;
+   }
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_enable_xbar0_signal(SI32_PBCFG_A_Type* /*basePointer*/,
    SI32_PBCFG_A_XBAR0_Enum_Type /*signal*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_enable_xbar0_signal(basePointer, signal)
 #define SI32_PBCFG_A_enable_xbar0_signal(basePointer, signal) \
@@ -805,9 +1344,30 @@ _SI32_PBCFG_A_enable_xbar0_signal(SI32_PBCFG_A_Type* /*basePointer*/,
 ///  Valid range is 8 bits.
 ///  See Support.h for signal definitions.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_disable_xbar0_signal(
+   SI32_PBCFG_A_Type * basePointer,
+   // See Support.h for signal definitions.
+   SI32_PBCFG_A_XBAR0_Enum_Type signal)
+{
+   assert(signal < 256);   // signal < 2^8
+   //{{
+   if (signal & 0x80)
+   {
+       basePointer->XBAR0_CLR = SI32_PBCFG_A_XBAR0_EPCA0EN_MASK;
+   }
+   else
+   {
+       basePointer->XBAR0_CLR = 1 << (signal & 0x1F);
+   }
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_disable_xbar0_signal(SI32_PBCFG_A_Type* /*basePointer*/,
    SI32_PBCFG_A_XBAR0_Enum_Type /*signal*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_disable_xbar0_signal(basePointer, signal)
 #define SI32_PBCFG_A_disable_xbar0_signal(basePointer, signal) \
@@ -819,8 +1379,19 @@ _SI32_PBCFG_A_disable_xbar0_signal(SI32_PBCFG_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_enable_crossbar_0(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->XBAR0_SET = SI32_PBCFG_A_XBAR0_XBAR0EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_enable_crossbar_0(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_enable_crossbar_0(basePointer)
 #define SI32_PBCFG_A_enable_crossbar_0(basePointer) \
@@ -832,8 +1403,19 @@ _SI32_PBCFG_A_enable_crossbar_0(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_disable_crossbar_0(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   basePointer->XBAR0_CLR = SI32_PBCFG_A_XBAR0_XBAR0EN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_disable_crossbar_0(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_disable_crossbar_0(basePointer)
 #define SI32_PBCFG_A_disable_crossbar_0(basePointer) \
@@ -853,9 +1435,21 @@ _SI32_PBCFG_A_disable_crossbar_0(SI32_PBCFG_A_Type* /*basePointer*/);
 ///  pbkey
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_write_pbkey(
+   SI32_PBCFG_A_Type * basePointer,
+   uint32_t pbkey)
+{
+   //{{
+   basePointer->PBKEY.U32 = pbkey;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_write_pbkey(SI32_PBCFG_A_Type* /*basePointer*/,
    uint32_t /*pbkey*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_write_pbkey(basePointer, pbkey)
 #define SI32_PBCFG_A_write_pbkey(basePointer, pbkey) \
@@ -870,8 +1464,19 @@ _SI32_PBCFG_A_write_pbkey(SI32_PBCFG_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PBCFG_A_read_pbkey(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   return basePointer->PBKEY.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PBCFG_A_read_pbkey(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_read_pbkey(basePointer)
 #define SI32_PBCFG_A_read_pbkey(basePointer) \
@@ -883,8 +1488,33 @@ _SI32_PBCFG_A_read_pbkey(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_unlock_ports(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   if (basePointer->PBKEY.U32 == SI32_PBCFG_A_PBKEY_KEY_UNLOCKED_U32)
+   {
+      return;
+   }
+   if (basePointer->PBKEY.U32 == SI32_PBCFG_A_PBKEY_KEY_INTERMEDIATE_U32)
+   {
+      basePointer->PBKEY.U32 = 0xF1;
+      return;
+   }
+   if (basePointer->PBKEY.U32 == SI32_PBCFG_A_PBKEY_KEY_LOCKED_U32)
+   {
+      basePointer->PBKEY.U32 = 0xA5;
+      basePointer->PBKEY.U32 = 0xF1;
+      return;
+   }
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_unlock_ports(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_unlock_ports(basePointer)
 #define SI32_PBCFG_A_unlock_ports(basePointer) \
@@ -896,8 +1526,20 @@ _SI32_PBCFG_A_unlock_ports(SI32_PBCFG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBCFG_A_lock_ports(
+   SI32_PBCFG_A_Type * basePointer)
+{
+   //{{
+   // Any incorrect sequence value to PBKEY will lock the interface
+   basePointer->PBKEY.U32 = 0x00;
+   //}}
+}
+#else
 void
 _SI32_PBCFG_A_lock_ports(SI32_PBCFG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBCFG_A_lock_ports(basePointer)
 #define SI32_PBCFG_A_lock_ports(basePointer) \
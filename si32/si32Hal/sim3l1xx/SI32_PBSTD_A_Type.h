@@ -89,6 +89,36 @@ extern "C" {
 ///  Valid range is 32 bits.
 ///  Write to PMEN register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBSTD_A_initialize(
+   SI32_PBSTD_A_Type * basePointer,
+   // Write to PB register.
+   uint32_t pb,
+   // Write to PBMDSEL register.
+   uint32_t pbmdsel,
+   // Write to PBSKIPEN register.
+   uint32_t pbskipen,
+   // Write to PBOUTMD register.
+   uint32_t pboutmd,
+   // Write to PBDRV register.
+   uint32_t pbdrv,
+   // Write to PM register.
+   uint32_t pm,
+   // Write to PMEN register.
+   uint32_t pmen)
+{
+   //{{
+   basePointer->PB.U32       = pb;
+   basePointer->PBMDSEL.U32  = pbmdsel;
+   basePointer->PBSKIPEN.U32 = pbskipen;
+   basePointer->PBOUTMD.U32  = pboutmd;
+   basePointer->PBDRV.U32    = pbdrv;
+   basePointer->PM.U32       = pm;
+   basePointer->PMEN.U32     = pmen;
+   //}}
+}
+#else
 void
 _SI32_PBSTD_A_initialize(SI32_PBSTD_A_Type* /*basePointer*/,
    uint32_t, /*pb*/
@@ -98,6 +128,7 @@ _SI32_PBSTD_A_initialize(SI32_PBSTD_A_Type* /*basePointer*/,
    uint32_t, /*pbdrv*/
    uint32_t, /*pm*/
    uint32_t /*pmen*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_initialize(basePointer, pb, pbmdsel, pbskipen, pboutmd, pbdrv, pm, pmen)
 #define SI32_PBSTD_A_initialize(basePointer, pb, pbmdsel, pbskipen, pboutmd, pbdrv, pm, pmen) do{  \
@@ -124,9 +155,21 @@ _SI32_PBSTD_A_initialize(SI32_PBSTD_A_Type* /*basePointer*/,
 ///  pb
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBSTD_A_write_pb(
+   SI32_PBSTD_A_Type * basePointer,
+   uint32_t pb)
+{
+   //{{
+   basePointer->PB.U32 = pb;
+   //}}
+}
+#else
 void
 _SI32_PBSTD_A_write_pb(SI32_PBSTD_A_Type* /*basePointer*/,
    uint32_t /*pb*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_write_pb(basePointer, pb)
 #define SI32_PBSTD_A_write_pb(basePointer, pb) \
@@ -141,8 +184,19 @@ _SI32_PBSTD_A_write_pb(SI32_PBSTD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PBSTD_A_read_pb(
+   SI32_PBSTD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->PB.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PBSTD_A_read_pb(SI32_PBSTD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_read_pb(basePointer)
 #define SI32_PBSTD_A_read_pb(basePointer) \
@@ -163,9 +217,23 @@ _SI32_PBSTD_A_read_pb(SI32_PBSTD_A_Type* /*basePointer*/);
 ///  Valid range is 16 bits.
 ///  Mask for pin writes : 1 = set pin to high.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBSTD_A_write_pins_high(
+   SI32_PBSTD_A_Type * basePointer,
+   // Mask for pin writes : 1 = set pin to high.
+   uint32_t pin_mask)
+{
+   assert(pin_mask < 65536);   // pin_mask < 2^16
+   //{{
+   basePointer->PB_SET = pin_mask;
+   //}}
+}
+#else
 void
 _SI32_PBSTD_A_write_pins_high(SI32_PBSTD_A_Type* /*basePointer*/,
    uint32_t /*pin_mask*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_write_pins_high(basePointer, pin_mask)
 #define SI32_PBSTD_A_write_pins_high(basePointer, pin_mask) \
@@ -186,9 +254,23 @@ _SI32_PBSTD_A_write_pins_high(SI32_PBSTD_A_Type* /*basePointer*/,
 ///  Valid range is 16 bits.
 ///  Mask for pin writes : 1 = clear pin to low.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBSTD_A_write_pins_low(
+   SI32_PBSTD_A_Type * basePointer,
+   // Mask for pin writes : 1 = clear pin to low.
+   uint32_t pin_mask)
+{
+   assert(pin_mask < 65536);   // pin_mask < 2^16
+   //{{
+   basePointer->PB_CLR = pin_mask;
+   //}}
+}
+#else
 void
 _SI32_PBSTD_A_write_pins_low(SI32_PBSTD_A_Type* /*basePointer*/,
    uint32_t /*pin_mask*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_write_pins_low(basePointer, pin_mask)
 #define SI32_PBSTD_A_write_pins_low(basePointer, pin_mask) \
@@ -215,10 +297,27 @@ _SI32_PBSTD_A_write_pins_low(SI32_PBSTD_A_Type* /*basePointer*/,
 ///  Valid range is 16 bits.
 ///  Mask value : 1 = write, 0 = ignore.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBSTD_A_write_pins_masked(
+   SI32_PBSTD_A_Type * basePointer,
+   // Values for latch.
+   uint32_t pin_value,
+   // Mask value : 1 = write, 0 = ignore.
+   uint32_t pin_mask)
+{
+   assert(pin_value < 65536);   // pin_value < 2^16
+   assert(pin_mask < 65536);   // pin_mask < 2^16
+   //{{
+   basePointer->PB_MSK = (pin_mask<<16)|(pin_value);
+   //}}
+}
+#else
 void
 _SI32_PBSTD_A_write_pins_masked(SI32_PBSTD_A_Type* /*basePointer*/,
    uint32_t, /*pin_value*/
    uint32_t /*pin_mask*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_write_pins_masked(basePointer, pin_value, pin_mask)
 #define SI32_PBSTD_A_write_pins_masked(basePointer, pin_value, pin_mask) \
@@ -239,9 +338,23 @@ _SI32_PBSTD_A_write_pins_masked(SI32_PBSTD_A_Type* /*basePointer*/,
 ///  Valid range is 16 bits.
 ///  Mask for pin toggles : 1 = toggle pin.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBSTD_A_toggle_pins(
+   SI32_PBSTD_A_Type * basePointer,
+   // Mask for pin toggles : 1 = toggle pin.
+   uint32_t pin_mask)
+{
+   assert(pin_mask < 65536);   // pin_mask < 2^16
+   //{{
+   basePointer->PB_MSK = (pin_mask<<16)|(~(basePointer->PB.U32) & 0xFFFF);
+   //}}
+}
+#else
 void
 _SI32_PBSTD_A_toggle_pins(SI32_PBSTD_A_Type* /*basePointer*/,
    uint32_t /*pin_mask*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_toggle_pins(basePointer, pin_mask)
 #define SI32_PBSTD_A_toggle_pins(basePointer, pin_mask) \
@@ -256,8 +369,19 @@ _SI32_PBSTD_A_toggle_pins(SI32_PBSTD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PBSTD_A_read_pins(
+   SI32_PBSTD_A_Type * basePointer)
+{
+   //{{
+   return (basePointer->PBPIN.U32);
+   //}}
+}
+#else
 uint32_t
 _SI32_PBSTD_A_read_pins(SI32_PBSTD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_read_pins(basePointer)
 #define SI32_PBSTD_A_read_pins(basePointer) \
@@ -278,9 +402,23 @@ _SI32_PBSTD_A_read_pins(SI32_PBSTD_A_Type* /*basePointer*/);
 ///  Valid range is 16 bits.
 ///  Number of the pin to read : 0 = pin 0.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PBSTD_A_read_pin(
+   SI32_PBSTD_A_Type * basePointer,
+   // Number of the pin to read : 0 = pin 0.
+   uint32_t pin_number)
+{
+   assert(pin_number < 65536);   // pin_number < 2^16
+   //{{
+   return ((basePointer->PBPIN.U32) >> pin_number) & 1;
+   //}}
+}
+#else
 uint32_t
 _SI32_PBSTD_A_read_pin(SI32_PBSTD_A_Type* /*basePointer*/,
    uint32_t /*pin_number*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_read_pin(basePointer, pin_number)
 #define SI32_PBSTD_A_read_pin(basePointer, pin_number) \
@@ -300,9 +438,21 @@ _SI32_PBSTD_A_read_pin(SI32_PBSTD_A_Type* /*basePointer*/,
 ///  pbmdsel
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBSTD_A_write_pbmdsel(
+   SI32_PBSTD_A_Type * basePointer,
+   uint32_t pbmdsel)
+{
+   //{{
+   basePointer->PBMDSEL.U32 = pbmdsel;
+   //}}
+}
+#else
 void
 _SI32_PBSTD_A_write_pbmdsel(SI32_PBSTD_A_Type* /*basePointer*/,
    uint32_t /*pbmdsel*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_write_pbmdsel(basePointer, pbmdsel)
 #define SI32_PBSTD_A_write_pbmdsel(basePointer, pbmdsel) \
@@ -317,8 +467,19 @@ _SI32_PBSTD_A_write_pbmdsel(SI32_PBSTD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PBSTD_A_read_pbmdsel(
+   SI32_PBSTD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->PBMDSEL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PBSTD_A_read_pbmdsel(SI32_PBSTD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_read_pbmdsel(basePointer)
 #define SI32_PBSTD_A_read_pbmdsel(basePointer) \
@@ -339,9 +500,24 @@ _SI32_PBSTD_A_read_pbmdsel(SI32_PBSTD_A_Type* /*basePointer*/);
 ///  Valid range is 16 bits.
 ///  Selects which pins to configure digital push-pull.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBSTD_A_set_pins_push_pull_output(
+   SI32_PBSTD_A_Type * basePointer,
+   // Selects which pins to configure digital push-pull.
+   uwide16_t pin_mask)
+{
+   assert(pin_mask < 65536);   // pin_mask < 2^16
+   //{{
+   basePointer->PBOUTMD_SET = pin_mask;
+   basePointer->PBMDSEL_SET = pin_mask;
+   //}}
+}
+#else
 void
 _SI32_PBSTD_A_set_pins_push_pull_output(SI32_PBSTD_A_Type* /*basePointer*/,
    uwide16_t /*pin_mask*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_set_pins_push_pull_output(basePointer, pin_mask)
 #define SI32_PBSTD_A_set_pins_push_pull_output(basePointer, pin_mask) do{  \
@@ -364,9 +540,25 @@ _SI32_PBSTD_A_set_pins_push_pull_output(SI32_PBSTD_A_Type* /*basePointer*/,
 ///  Valid range is 16 bits.
 ///  Selects which pins to configure open-drain input.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBSTD_A_set_pins_digital_input(
+   SI32_PBSTD_A_Type * basePointer,
+   // Selects which pins to configure open-drain input.
+   uwide16_t pin_mask)
+{
+   assert(pin_mask < 65536);   // pin_mask < 2^16
+   //{{
+   basePointer->PBOUTMD_CLR = pin_mask;
+   basePointer->PB_SET      = pin_mask;
+   basePointer->PBMDSEL_SET = pin_mask;
+   //}}
+}
+#else
 void
 _SI32_PBSTD_A_set_pins_digital_input(SI32_PBSTD_A_Type* /*basePointer*/,
    uwide16_t /*pin_mask*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_set_pins_digital_input(basePointer, pin_mask)
 #define SI32_PBSTD_A_set_pins_digital_input(basePointer, pin_mask) do{  \
@@ -390,9 +582,24 @@ _SI32_PBSTD_A_set_pins_digital_input(SI32_PBSTD_A_Type* /*basePointer*/,
 ///  Valid range is 16 bits.
 ///  Selects which pins to configure as analog.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBSTD_A_set_pins_analog(
+   SI32_PBSTD_A_Type * basePointer,
+   // Selects which pins to configure as analog.
+   uwide16_t pin_mask)
+{
+   assert(pin_mask < 65536);   // pin_mask < 2^16
+   //{{
+   basePointer->PBMDSEL_CLR = pin_mask;
+   basePointer->PB_SET      = pin_mask;
+   //}}
+}
+#else
 void
 _SI32_PBSTD_A_set_pins_analog(SI32_PBSTD_A_Type* /*basePointer*/,
    uwide16_t /*pin_mask*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_set_pins_analog(basePointer, pin_mask)
 #define SI32_PBSTD_A_set_pins_analog(basePointer, pin_mask) do{  \
@@ -414,9 +621,21 @@ _SI32_PBSTD_A_set_pins_analog(SI32_PBSTD_A_Type* /*basePointer*/,
 ///  pbskipen
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBSTD_A_write_pbskipen(
+   SI32_PBSTD_A_Type * basePointer,
+   uint32_t pbskipen)
+{
+   //{{
+   basePointer->PBSKIPEN.U32 = pbskipen;
+   //}}
+}
+#else
 void
 _SI32_PBSTD_A_write_pbskipen(SI32_PBSTD_A_Type* /*basePointer*/,
    uint32_t /*pbskipen*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_write_pbskipen(basePointer, pbskipen)
 #define SI32_PBSTD_A_write_pbskipen(basePointer, pbskipen) \
@@ -431,8 +650,19 @@ _SI32_PBSTD_A_write_pbskipen(SI32_PBSTD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PBSTD_A_read_pbskipen(
+   SI32_PBSTD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->PBSKIPEN.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PBSTD_A_read_pbskipen(SI32_PBSTD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_read_pbskipen(basePointer)
 #define SI32_PBSTD_A_read_pbskipen(basePointer) \
@@ -452,9 +682,21 @@ _SI32_PBSTD_A_read_pbskipen(SI32_PBSTD_A_Type* /*basePointer*/);
 ///  pboutmd
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBSTD_A_write_pboutmd(
+   SI32_PBSTD_A_Type * basePointer,
+   uint32_t pboutmd)
+{
+   //{{
+   basePointer->PBOUTMD.U32 = pboutmd;
+   //}}
+}
+#else
 void
 _SI32_PBSTD_A_write_pboutmd(SI32_PBSTD_A_Type* /*basePointer*/,
    uint32_t /*pboutmd*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_write_pboutmd(basePointer, pboutmd)
 #define SI32_PBSTD_A_write_pboutmd(basePointer, pboutmd) \
@@ -469,8 +711,19 @@ _SI32_PBSTD_A_write_pboutmd(SI32_PBSTD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PBSTD_A_read_pboutmd(
+   SI32_PBSTD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->PBOUTMD.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PBSTD_A_read_pboutmd(SI32_PBSTD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_read_pboutmd(basePointer)
 #define SI32_PBSTD_A_read_pboutmd(basePointer) \
@@ -490,9 +743,21 @@ _SI32_PBSTD_A_read_pboutmd(SI32_PBSTD_A_Type* /*basePointer*/);
 ///  pbdrv
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBSTD_A_write_pbdrv(
+   SI32_PBSTD_A_Type * basePointer,
+   uint32_t pbdrv)
+{
+   //{{
+   basePointer->PBDRV.U32 = pbdrv;
+   //}}
+}
+#else
 void
 _SI32_PBSTD_A_write_pbdrv(SI32_PBSTD_A_Type* /*basePointer*/,
    uint32_t /*pbdrv*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_write_pbdrv(basePointer, pbdrv)
 #define SI32_PBSTD_A_write_pbdrv(basePointer, pbdrv) \
@@ -507,8 +772,19 @@ _SI32_PBSTD_A_write_pbdrv(SI32_PBSTD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PBSTD_A_read_pbdrv(
+   SI32_PBSTD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->PBDRV.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PBSTD_A_read_pbdrv(SI32_PBSTD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_read_pbdrv(basePointer)
 #define SI32_PBSTD_A_read_pbdrv(basePointer) \
@@ -529,9 +805,23 @@ _SI32_PBSTD_A_read_pbdrv(SI32_PBSTD_A_Type* /*basePointer*/);
 ///  Valid range is 16 bits.
 ///  Selects which pins to configure drive high.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBSTD_A_set_pins_high_drive_strength(
+   SI32_PBSTD_A_Type * basePointer,
+   // Selects which pins to configure drive high.
+   uwide16_t pin_mask)
+{
+   assert(pin_mask < 65536);   // pin_mask < 2^16
+   //{{
+   basePointer->PBDRV_SET = pin_mask;
+   //}}
+}
+#else
 void
 _SI32_PBSTD_A_set_pins_high_drive_strength(SI32_PBSTD_A_Type* /*basePointer*/,
    uwide16_t /*pin_mask*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_set_pins_high_drive_strength(basePointer, pin_mask)
 #define SI32_PBSTD_A_set_pins_high_drive_strength(basePointer, pin_mask) \
@@ -552,9 +842,23 @@ _SI32_PBSTD_A_set_pins_high_drive_strength(SI32_PBSTD_A_Type* /*basePointer*/,
 ///  Valid range is 16 bits.
 ///  Selects which pins to configure drive low.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBSTD_A_set_pins_low_drive_strength(
+   SI32_PBSTD_A_Type * basePointer,
+   // Selects which pins to configure drive low.
+   uwide16_t pin_mask)
+{
+   assert(pin_mask < 65536);   // pin_mask < 2^16
+   //{{
+   basePointer->PBDRV_CLR = pin_mask;
+   //}}
+}
+#else
 void
 _SI32_PBSTD_A_set_pins_low_drive_strength(SI32_PBSTD_A_Type* /*basePointer*/,
    uwide16_t /*pin_mask*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_set_pins_low_drive_strength(basePointer, pin_mask)
 #define SI32_PBSTD_A_set_pins_low_drive_strength(basePointer, pin_mask) \
@@ -566,8 +870,19 @@ _SI32_PBSTD_A_set_pins_low_drive_strength(SI32_PBSTD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBSTD_A_enable_pullup_resistors(
+   SI32_PBSTD_A_Type * basePointer)
+{
+   //{{
+   basePointer->PBDRV_SET = SI32_PBSTD_A_PBDRV_PBPUEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBSTD_A_enable_pullup_resistors(SI32_PBSTD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_enable_pullup_resistors(basePointer)
 #define SI32_PBSTD_A_enable_pullup_resistors(basePointer) \
@@ -579,8 +894,19 @@ _SI32_PBSTD_A_enable_pullup_resistors(SI32_PBSTD_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBSTD_A_disable_pullup_resistors(
+   SI32_PBSTD_A_Type * basePointer)
+{
+   //{{
+   basePointer->PBDRV_CLR = SI32_PBSTD_A_PBDRV_PBPUEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PBSTD_A_disable_pullup_resistors(SI32_PBSTD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_disable_pullup_resistors(basePointer)
 #define SI32_PBSTD_A_disable_pullup_resistors(basePointer) \
@@ -600,9 +926,21 @@ _SI32_PBSTD_A_disable_pullup_resistors(SI32_PBSTD_A_Type* /*basePointer*/);
 ///  pm
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBSTD_A_write_pm(
+   SI32_PBSTD_A_Type * basePointer,
+   uint32_t pm)
+{
+   //{{
+   basePointer->PM.U32 = pm;
+   //}}
+}
+#else
 void
 _SI32_PBSTD_A_write_pm(SI32_PBSTD_A_Type* /*basePointer*/,
    uint32_t /*pm*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_write_pm(basePointer, pm)
 #define SI32_PBSTD_A_write_pm(basePointer, pm) \
@@ -617,8 +955,19 @@ _SI32_PBSTD_A_write_pm(SI32_PBSTD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PBSTD_A_read_pm(
+   SI32_PBSTD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->PM.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PBSTD_A_read_pm(SI32_PBSTD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_read_pm(basePointer)
 #define SI32_PBSTD_A_read_pm(basePointer) \
@@ -636,9 +985,23 @@ _SI32_PBSTD_A_read_pm(SI32_PBSTD_A_Type* /*basePointer*/);
 ///  Valid range is 16 bits.
 ///  Number of the pin to set the port match value high : 0 = pin 0.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBSTD_A_set_port_match_pin_value(
+   SI32_PBSTD_A_Type * basePointer,
+   // Number of the pin to set the port match value high : 0 = pin 0.
+   uint32_t pin_number)
+{
+   assert(pin_number < 65536);   // pin_number < 2^16
+   //{{
+   basePointer->PM_SET = (1 << pin_number);
+   //}}
+}
+#else
 void
 _SI32_PBSTD_A_set_port_match_pin_value(SI32_PBSTD_A_Type* /*basePointer*/,
    uint32_t /*pin_number*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_set_port_match_pin_value(basePointer, pin_number)
 #define SI32_PBSTD_A_set_port_match_pin_value(basePointer, pin_number) \
@@ -656,9 +1019,23 @@ _SI32_PBSTD_A_set_port_match_pin_value(SI32_PBSTD_A_Type* /*basePointer*/,
 ///  Valid range is 16 bits.
 ///  Number of the pin to set the port match value low : 0 = pin 0.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBSTD_A_clear_port_match_pin_value(
+   SI32_PBSTD_A_Type * basePointer,
+   // Number of the pin to set the port match value low : 0 = pin 0.
+   uint32_t pin_number)
+{
+   assert(pin_number < 65536);   // pin_number < 2^16
+   //{{
+   basePointer->PM_CLR = (1 << pin_number);
+   //}}
+}
+#else
 void
 _SI32_PBSTD_A_clear_port_match_pin_value(SI32_PBSTD_A_Type* /*basePointer*/,
    uint32_t /*pin_number*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_clear_port_match_pin_value(basePointer, pin_number)
 #define SI32_PBSTD_A_clear_port_match_pin_value(basePointer, pin_number) \
@@ -678,9 +1055,21 @@ _SI32_PBSTD_A_clear_port_match_pin_value(SI32_PBSTD_A_Type* /*basePointer*/,
 ///  pmen
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBSTD_A_write_pmen(
+   SI32_PBSTD_A_Type * basePointer,
+   uint32_t pmen)
+{
+   //{{
+   basePointer->PMEN.U32 = pmen;
+   //}}
+}
+#else
 void
 _SI32_PBSTD_A_write_pmen(SI32_PBSTD_A_Type* /*basePointer*/,
    uint32_t /*pmen*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_write_pmen(basePointer, pmen)
 #define SI32_PBSTD_A_write_pmen(basePointer, pmen) \
@@ -695,8 +1084,19 @@ _SI32_PBSTD_A_write_pmen(SI32_PBSTD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PBSTD_A_read_pmen(
+   SI32_PBSTD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->PMEN.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PBSTD_A_read_pmen(SI32_PBSTD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_read_pmen(basePointer)
 #define SI32_PBSTD_A_read_pmen(basePointer) \
@@ -714,9 +1114,23 @@ _SI32_PBSTD_A_read_pmen(SI32_PBSTD_A_Type* /*basePointer*/);
 ///  Valid range is 16 bits.
 ///  Number of the pin to enable port match : 0 = pin 0.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBSTD_A_enable_port_match_pin(
+   SI32_PBSTD_A_Type * basePointer,
+   // Number of the pin to enable port match : 0 = pin 0.
+   uint32_t pin_number)
+{
+   assert(pin_number < 65536);   // pin_number < 2^16
+   //{{
+   basePointer->PMEN_SET = (1 << pin_number);
+   //}}
+}
+#else
 void
 _SI32_PBSTD_A_enable_port_match_pin(SI32_PBSTD_A_Type* /*basePointer*/,
    uint32_t /*pin_number*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_enable_port_match_pin(basePointer, pin_number)
 #define SI32_PBSTD_A_enable_port_match_pin(basePointer, pin_number) \
@@ -734,9 +1148,23 @@ _SI32_PBSTD_A_enable_port_match_pin(SI32_PBSTD_A_Type* /*basePointer*/,
 ///  Valid range is 16 bits.
 ///  Number of the pin to disable port match : 0 = pin 0.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBSTD_A_disable_port_match_pin(
+   SI32_PBSTD_A_Type * basePointer,
+   // Number of the pin to disable port match : 0 = pin 0.
+   uint32_t pin_number)
+{
+   assert(pin_number < 65536);   // pin_number < 2^16
+   //{{
+   basePointer->PMEN_CLR = (1 << pin_number);
+   //}}
+}
+#else
 void
 _SI32_PBSTD_A_disable_port_match_pin(SI32_PBSTD_A_Type* /*basePointer*/,
    uint32_t /*pin_number*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_disable_port_match_pin(basePointer, pin_number)
 #define SI32_PBSTD_A_disable_port_match_pin(basePointer, pin_number) \
@@ -756,9 +1184,21 @@ _SI32_PBSTD_A_disable_port_match_pin(SI32_PBSTD_A_Type* /*basePointer*/,
 ///  pbpgen
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBSTD_A_write_pbpgmask(
+   SI32_PBSTD_A_Type * basePointer,
+   uint32_t pbpgen)
+{
+   //{{
+   basePointer->PBPGEN.U32 = pbpgen;
+   //}}
+}
+#else
 void
 _SI32_PBSTD_A_write_pbpgmask(SI32_PBSTD_A_Type* /*basePointer*/,
    uint32_t /*pbpgen*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_write_pbpgmask(basePointer, pbpgen)
 #define SI32_PBSTD_A_write_pbpgmask(basePointer, pbpgen) \
@@ -773,8 +1213,19 @@ _SI32_PBSTD_A_write_pbpgmask(SI32_PBSTD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PBSTD_A_read_pbpgmask(
+   SI32_PBSTD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->PBPGEN.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PBSTD_A_read_pbpgmask(SI32_PBSTD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_read_pbpgmask(basePointer)
 #define SI32_PBSTD_A_read_pbpgmask(basePointer) \
@@ -794,9 +1245,21 @@ _SI32_PBSTD_A_read_pbpgmask(SI32_PBSTD_A_Type* /*basePointer*/);
 ///  pbpgphase
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PBSTD_A_write_pbpgphase(
+   SI32_PBSTD_A_Type * basePointer,
+   uint32_t pbpgphase)
+{
+   //{{
+   basePointer->PBPGPHASE.U32 = pbpgphase;
+   //}}
+}
+#else
 void
 _SI32_PBSTD_A_write_pbpgphase(SI32_PBSTD_A_Type* /*basePointer*/,
    uint32_t /*pbpgphase*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_write_pbpgphase(basePointer, pbpgphase)
 #define SI32_PBSTD_A_write_pbpgphase(basePointer, pbpgphase) \
@@ -811,8 +1274,19 @@ _SI32_PBSTD_A_write_pbpgphase(SI32_PBSTD_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PBSTD_A_read_pbpgphase(
+   SI32_PBSTD_A_Type * basePointer)
+{
+   //{{
+   return basePointer->PBPGPHASE.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PBSTD_A_read_pbpgphase(SI32_PBSTD_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PBSTD_A_read_pbpgphase(basePointer)
 #define SI32_PBSTD_A_read_pbpgphase(basePointer) \
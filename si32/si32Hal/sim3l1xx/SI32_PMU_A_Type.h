@@ -73,6 +73,32 @@ extern "C" {
 ///  pwpol
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_initialize(
+   SI32_PMU_A_Type * basePointer,
+   uint32_t control,
+   uint32_t config,
+   uint32_t wakeen,
+   uwide16_t pwen,
+   uwide16_t pwpol)
+{
+   assert(control < 16777216);   // control < 2^24
+   assert(config < 65536);   // config < 2^16
+   assert(wakeen < 512);   // wakeen < 2^9
+   assert(pwen < 65536);   // pwen < 2^16
+   assert(pwpol < 65536);   // pwpol < 2^16
+   //{{
+   basePointer->CONTROL.U32 = control & 0x00FF0079;
+   basePointer->CONFIG.U32 =
+      (((basePointer->CONFIG.U32)&~0x00000D70)
+      |(config&0x00000D70));
+   basePointer->WAKEEN.U32 = wakeen;
+   basePointer->PWEN.U32 = pwen;
+   basePointer->PWPOL.U32 = pwpol;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_initialize(SI32_PMU_A_Type* /*basePointer*/,
    uint32_t, /*control*/
@@ -80,6 +106,7 @@ _SI32_PMU_A_initialize(SI32_PMU_A_Type* /*basePointer*/,
    uint32_t, /*wakeen*/
    uwide16_t, /*pwen*/
    uwide16_t /*pwpol*/);
+#endif
 ///
 /// @def SI32_PMU_A_initialize(basePointer, control, config, wakeen, pwen, pwpol)
 #define SI32_PMU_A_initialize(basePointer, control, config, wakeen, pwen, pwpol) do{  \
@@ -101,8 +128,19 @@ _SI32_PMU_A_initialize(SI32_PMU_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PMU_A_read_control(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PMU_A_read_control(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_read_control(basePointer)
 #define SI32_PMU_A_read_control(basePointer) \
@@ -122,9 +160,22 @@ _SI32_PMU_A_read_control(SI32_PMU_A_Type* /*basePointer*/);
 ///  control
 ///  Valid range is 24 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_write_control(
+   SI32_PMU_A_Type * basePointer,
+   uint32_t control)
+{
+   assert(control < 16777216);   // control < 2^24
+   //{{
+   basePointer->CONTROL.U32 = control & 0x00FF0079;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_write_control(SI32_PMU_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_PMU_A_write_control(basePointer, control)
 #define SI32_PMU_A_write_control(basePointer, control) \
@@ -139,8 +190,21 @@ _SI32_PMU_A_write_control(SI32_PMU_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_clear_wakeup_flags(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+     basePointer->CONTROL_CLR = SI32_PMU_A_CONTROL_WAKECLR_MASK;
+     basePointer->STATUS_CLR  = (SI32_PMU_A_STATUS_PM8EF_MASK
+         | SI32_PMU_A_STATUS_PORF_MASK);
+   //}}
+}
+#else
 void
 _SI32_PMU_A_clear_wakeup_flags(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_clear_wakeup_flags(basePointer)
 #define SI32_PMU_A_clear_wakeup_flags(basePointer) do{  \
@@ -155,8 +219,19 @@ _SI32_PMU_A_clear_wakeup_flags(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_pin_wake(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_PMU_A_CONTROL_PWAKEEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_pin_wake(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_pin_wake(basePointer)
 #define SI32_PMU_A_enable_pin_wake(basePointer) \
@@ -168,8 +243,19 @@ _SI32_PMU_A_enable_pin_wake(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_pin_wake(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PMU_A_CONTROL_PWAKEEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_pin_wake(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_pin_wake(basePointer)
 #define SI32_PMU_A_disable_pin_wake(basePointer) \
@@ -181,8 +267,19 @@ _SI32_PMU_A_disable_pin_wake(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_asleep_pin_out(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_PMU_A_CONTROL_PMUASLPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_asleep_pin_out(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_asleep_pin_out(basePointer)
 #define SI32_PMU_A_enable_asleep_pin_out(basePointer) \
@@ -194,8 +291,19 @@ _SI32_PMU_A_enable_asleep_pin_out(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_asleep_pin_out(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PMU_A_CONTROL_PMUASLPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_asleep_pin_out(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_asleep_pin_out(basePointer)
 #define SI32_PMU_A_disable_asleep_pin_out(basePointer) \
@@ -207,8 +315,19 @@ _SI32_PMU_A_disable_asleep_pin_out(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_low_power_charge_pump_monitor(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_PMU_A_CONTROL_CPMONEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_low_power_charge_pump_monitor(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_low_power_charge_pump_monitor(basePointer)
 #define SI32_PMU_A_enable_low_power_charge_pump_monitor(basePointer) \
@@ -220,8 +339,19 @@ _SI32_PMU_A_enable_low_power_charge_pump_monitor(SI32_PMU_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_low_power_charge_pump_monitor(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PMU_A_CONTROL_CPMONEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_low_power_charge_pump_monitor(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_low_power_charge_pump_monitor(basePointer)
 #define SI32_PMU_A_disable_low_power_charge_pump_monitor(basePointer) \
@@ -233,8 +363,19 @@ _SI32_PMU_A_disable_low_power_charge_pump_monitor(SI32_PMU_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_low_power_charge_pump_monitor_interrupt(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_PMU_A_CONTROL_CPMONIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_low_power_charge_pump_monitor_interrupt(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_low_power_charge_pump_monitor_interrupt(basePointer)
 #define SI32_PMU_A_enable_low_power_charge_pump_monitor_interrupt(basePointer) \
@@ -246,8 +387,19 @@ _SI32_PMU_A_enable_low_power_charge_pump_monitor_interrupt(SI32_PMU_A_Type* /*ba
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_low_power_charge_pump_monitor_interrupt(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PMU_A_CONTROL_CPMONIEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_low_power_charge_pump_monitor_interrupt(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_low_power_charge_pump_monitor_interrupt(basePointer)
 #define SI32_PMU_A_disable_low_power_charge_pump_monitor_interrupt(basePointer) \
@@ -259,8 +411,19 @@ _SI32_PMU_A_disable_low_power_charge_pump_monitor_interrupt(SI32_PMU_A_Type* /*b
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_ram_0_retention(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_PMU_A_CONTROL_RAM0REN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_ram_0_retention(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_ram_0_retention(basePointer)
 #define SI32_PMU_A_enable_ram_0_retention(basePointer) \
@@ -272,8 +435,19 @@ _SI32_PMU_A_enable_ram_0_retention(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_ram_0_retention(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PMU_A_CONTROL_RAM0REN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_ram_0_retention(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_ram_0_retention(basePointer)
 #define SI32_PMU_A_disable_ram_0_retention(basePointer) \
@@ -285,8 +459,19 @@ _SI32_PMU_A_disable_ram_0_retention(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_ram_1_retention(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_PMU_A_CONTROL_RAM1REN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_ram_1_retention(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_ram_1_retention(basePointer)
 #define SI32_PMU_A_enable_ram_1_retention(basePointer) \
@@ -298,8 +483,19 @@ _SI32_PMU_A_enable_ram_1_retention(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_ram_1_retention(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PMU_A_CONTROL_RAM1REN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_ram_1_retention(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_ram_1_retention(basePointer)
 #define SI32_PMU_A_disable_ram_1_retention(basePointer) \
@@ -311,8 +507,19 @@ _SI32_PMU_A_disable_ram_1_retention(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_ram_2_retention(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_PMU_A_CONTROL_RAM2REN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_ram_2_retention(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_ram_2_retention(basePointer)
 #define SI32_PMU_A_enable_ram_2_retention(basePointer) \
@@ -324,8 +531,19 @@ _SI32_PMU_A_enable_ram_2_retention(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_ram_2_retention(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PMU_A_CONTROL_RAM2REN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_ram_2_retention(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_ram_2_retention(basePointer)
 #define SI32_PMU_A_disable_ram_2_retention(basePointer) \
@@ -337,8 +555,19 @@ _SI32_PMU_A_disable_ram_2_retention(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_ram_3_retention(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_PMU_A_CONTROL_RAM3REN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_ram_3_retention(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_ram_3_retention(basePointer)
 #define SI32_PMU_A_enable_ram_3_retention(basePointer) \
@@ -350,8 +579,19 @@ _SI32_PMU_A_enable_ram_3_retention(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_ram_3_retention(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PMU_A_CONTROL_RAM3REN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_ram_3_retention(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_ram_3_retention(basePointer)
 #define SI32_PMU_A_disable_ram_3_retention(basePointer) \
@@ -363,8 +603,19 @@ _SI32_PMU_A_disable_ram_3_retention(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_ram_4_retention(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_PMU_A_CONTROL_RAM4REN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_ram_4_retention(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_ram_4_retention(basePointer)
 #define SI32_PMU_A_enable_ram_4_retention(basePointer) \
@@ -376,8 +627,19 @@ _SI32_PMU_A_enable_ram_4_retention(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_ram_4_retention(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PMU_A_CONTROL_RAM4REN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_ram_4_retention(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_ram_4_retention(basePointer)
 #define SI32_PMU_A_disable_ram_4_retention(basePointer) \
@@ -389,8 +651,19 @@ _SI32_PMU_A_disable_ram_4_retention(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_ram_5_retention(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_PMU_A_CONTROL_RAM5REN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_ram_5_retention(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_ram_5_retention(basePointer)
 #define SI32_PMU_A_enable_ram_5_retention(basePointer) \
@@ -402,8 +675,19 @@ _SI32_PMU_A_enable_ram_5_retention(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_ram_5_retention(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PMU_A_CONTROL_RAM5REN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_ram_5_retention(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_ram_5_retention(basePointer)
 #define SI32_PMU_A_disable_ram_5_retention(basePointer) \
@@ -415,8 +699,19 @@ _SI32_PMU_A_disable_ram_5_retention(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_ram_6_retention(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_PMU_A_CONTROL_RAM6REN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_ram_6_retention(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_ram_6_retention(basePointer)
 #define SI32_PMU_A_enable_ram_6_retention(basePointer) \
@@ -428,8 +723,19 @@ _SI32_PMU_A_enable_ram_6_retention(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_ram_6_retention(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+    basePointer->CONTROL_CLR = SI32_PMU_A_CONTROL_RAM6REN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_ram_6_retention(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_ram_6_retention(basePointer)
 #define SI32_PMU_A_disable_ram_6_retention(basePointer) \
@@ -441,8 +747,19 @@ _SI32_PMU_A_disable_ram_6_retention(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_ram_7_retention(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_SET = SI32_PMU_A_CONTROL_RAM7REN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_ram_7_retention(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_ram_7_retention(basePointer)
 #define SI32_PMU_A_enable_ram_7_retention(basePointer) \
@@ -454,8 +771,19 @@ _SI32_PMU_A_enable_ram_7_retention(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_ram_7_retention(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL_CLR = SI32_PMU_A_CONTROL_RAM7REN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_ram_7_retention(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_ram_7_retention(basePointer)
 #define SI32_PMU_A_disable_ram_7_retention(basePointer) \
@@ -475,9 +803,24 @@ _SI32_PMU_A_disable_ram_7_retention(SI32_PMU_A_Type* /*basePointer*/);
 ///  mask
 ///  Valid range is 8 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_set_ram_retention_enable_mask(
+   SI32_PMU_A_Type * basePointer,
+   uwide8_t mask)
+{
+   assert(mask < 256);   // mask < 2^8
+   //{{
+   basePointer->CONTROL.U32 =
+      ((basePointer->CONTROL.U32) & 0xFF00FFFF)
+      |(mask<<SI32_PMU_A_CONTROL_RAM0REN_SHIFT);
+   //}}
+}
+#else
 void
 _SI32_PMU_A_set_ram_retention_enable_mask(SI32_PMU_A_Type* /*basePointer*/,
    uwide8_t /*mask*/);
+#endif
 ///
 /// @def SI32_PMU_A_set_ram_retention_enable_mask(basePointer, mask)
 #define SI32_PMU_A_set_ram_retention_enable_mask(basePointer, mask) do{  \
@@ -495,8 +838,19 @@ _SI32_PMU_A_set_ram_retention_enable_mask(SI32_PMU_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide16_t
+_SI32_PMU_A_read_config(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONFIG.U32;
+   //}}
+}
+#else
 uwide16_t
 _SI32_PMU_A_read_config(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_read_config(basePointer)
 #define SI32_PMU_A_read_config(basePointer) \
@@ -516,9 +870,24 @@ _SI32_PMU_A_read_config(SI32_PMU_A_Type* /*basePointer*/);
 ///  config
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_write_config(
+   SI32_PMU_A_Type * basePointer,
+   uwide16_t config)
+{
+   assert(config < 65536);   // config < 2^16
+   //{{
+   basePointer->CONFIG.U32 =
+      (((basePointer->CONFIG.U32)&~0x00000D70)
+      |(config&0x00000D70));
+   //}}
+}
+#else
 void
 _SI32_PMU_A_write_config(SI32_PMU_A_Type* /*basePointer*/,
    uwide16_t /*config*/);
+#endif
 ///
 /// @def SI32_PMU_A_write_config(basePointer, config)
 #define SI32_PMU_A_write_config(basePointer, config) do{  \
@@ -533,8 +902,19 @@ _SI32_PMU_A_write_config(SI32_PMU_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_select_vdrv_connected_to_vbat(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG.VDRVSMD = SI32_PMU_A_CONFIG_VDRVSMD_VBAT_VALUE;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_select_vdrv_connected_to_vbat(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_select_vdrv_connected_to_vbat(basePointer)
 #define SI32_PMU_A_select_vdrv_connected_to_vbat(basePointer) \
@@ -546,8 +926,19 @@ _SI32_PMU_A_select_vdrv_connected_to_vbat(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_select_vdrv_connected_to_vdc(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG.VDRVSMD = SI32_PMU_A_CONFIG_VDRVSMD_VDC_VALUE;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_select_vdrv_connected_to_vdc(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_select_vdrv_connected_to_vdc(basePointer)
 #define SI32_PMU_A_select_vdrv_connected_to_vdc(basePointer) \
@@ -559,8 +950,19 @@ _SI32_PMU_A_select_vdrv_connected_to_vdc(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_select_vdrv_high_impedence(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG.VDRVSMD = SI32_PMU_A_CONFIG_VDRVSMD_HIGHZ_VALUE;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_select_vdrv_high_impedence(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_select_vdrv_high_impedence(basePointer)
 #define SI32_PMU_A_select_vdrv_high_impedence(basePointer) \
@@ -572,8 +974,19 @@ _SI32_PMU_A_select_vdrv_high_impedence(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_low_power_charge_pump(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_PMU_A_CONFIG_CPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_low_power_charge_pump(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_low_power_charge_pump(basePointer)
 #define SI32_PMU_A_enable_low_power_charge_pump(basePointer) \
@@ -585,8 +998,19 @@ _SI32_PMU_A_enable_low_power_charge_pump(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_low_power_charge_pump(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_PMU_A_CONFIG_CPEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_low_power_charge_pump(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_low_power_charge_pump(basePointer)
 #define SI32_PMU_A_disable_low_power_charge_pump(basePointer) \
@@ -603,9 +1027,22 @@ _SI32_PMU_A_disable_low_power_charge_pump(SI32_PMU_A_Type* /*basePointer*/);
 ///  load
 ///  Valid range is 2 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_set_low_power_charge_pump_load(
+   SI32_PMU_A_Type * basePointer,
+   uwide8_t load)
+{
+   assert(load < 4);   // load < 2^2
+   //{{
+   basePointer->CONFIG.CPLOAD = load;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_set_low_power_charge_pump_load(SI32_PMU_A_Type* /*basePointer*/,
    uwide8_t /*load*/);
+#endif
 ///
 /// @def SI32_PMU_A_set_low_power_charge_pump_load(basePointer, load)
 #define SI32_PMU_A_set_low_power_charge_pump_load(basePointer, load) \
@@ -620,8 +1057,19 @@ _SI32_PMU_A_set_low_power_charge_pump_load(SI32_PMU_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PMU_A_read_status(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   return basePointer->STATUS.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PMU_A_read_status(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_read_status(basePointer)
 #define SI32_PMU_A_read_status(basePointer) \
@@ -633,8 +1081,19 @@ _SI32_PMU_A_read_status(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PMU_A_is_power_mode_8_exit_flag_set(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   return (bool) basePointer->STATUS.PM8EF;
+   //}}
+}
+#else
 bool
 _SI32_PMU_A_is_power_mode_8_exit_flag_set(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_is_power_mode_8_exit_flag_set(basePointer)
 #define SI32_PMU_A_is_power_mode_8_exit_flag_set(basePointer) \
@@ -646,8 +1105,19 @@ _SI32_PMU_A_is_power_mode_8_exit_flag_set(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PMU_A_is_pin_wakeup_event_flag_set(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   return (bool) basePointer->STATUS.PWAKEF;
+   //}}
+}
+#else
 bool
 _SI32_PMU_A_is_pin_wakeup_event_flag_set(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_is_pin_wakeup_event_flag_set(basePointer)
 #define SI32_PMU_A_is_pin_wakeup_event_flag_set(basePointer) \
@@ -659,8 +1129,19 @@ _SI32_PMU_A_is_pin_wakeup_event_flag_set(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PMU_A_is_power_on_reset_event_flag_set(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   return (bool) basePointer->STATUS.PORF;
+   //}}
+}
+#else
 bool
 _SI32_PMU_A_is_power_on_reset_event_flag_set(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_is_power_on_reset_event_flag_set(basePointer)
 #define SI32_PMU_A_is_power_on_reset_event_flag_set(basePointer) \
@@ -672,8 +1153,19 @@ _SI32_PMU_A_is_power_on_reset_event_flag_set(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PMU_A_is_low_power_charge_pump_voltage_above_threshold(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   return (bool) basePointer->STATUS.CPSTS;
+   //}}
+}
+#else
 bool
 _SI32_PMU_A_is_low_power_charge_pump_voltage_above_threshold(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_is_low_power_charge_pump_voltage_above_threshold(basePointer)
 #define SI32_PMU_A_is_low_power_charge_pump_voltage_above_threshold(basePointer) \
@@ -688,8 +1180,19 @@ _SI32_PMU_A_is_low_power_charge_pump_voltage_above_threshold(SI32_PMU_A_Type* /*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_PMU_A_read_wakeen(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   return basePointer->WAKEEN.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_PMU_A_read_wakeen(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_read_wakeen(basePointer)
 #define SI32_PMU_A_read_wakeen(basePointer) \
@@ -709,9 +1212,22 @@ _SI32_PMU_A_read_wakeen(SI32_PMU_A_Type* /*basePointer*/);
 ///  wakeen
 ///  Valid range is 9 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_write_wakeen(
+   SI32_PMU_A_Type * basePointer,
+   uint32_t wakeen)
+{
+   assert(wakeen < 512);   // wakeen < 2^9
+   //{{
+   basePointer->WAKEEN.U32 = wakeen;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_write_wakeen(SI32_PMU_A_Type* /*basePointer*/,
    uint32_t /*wakeen*/);
+#endif
 ///
 /// @def SI32_PMU_A_write_wakeen(basePointer, wakeen)
 #define SI32_PMU_A_write_wakeen(basePointer, wakeen) \
@@ -723,8 +1239,19 @@ _SI32_PMU_A_write_wakeen(SI32_PMU_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_rtc0_fail_wake_event(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->WAKEEN_SET = SI32_PMU_A_WAKEEN_RTC0FWEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_rtc0_fail_wake_event(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_rtc0_fail_wake_event(basePointer)
 #define SI32_PMU_A_enable_rtc0_fail_wake_event(basePointer) \
@@ -736,8 +1263,19 @@ _SI32_PMU_A_enable_rtc0_fail_wake_event(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_rtc0_fail_wake_event(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->WAKEEN_CLR = SI32_PMU_A_WAKEEN_RTC0FWEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_rtc0_fail_wake_event(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_rtc0_fail_wake_event(basePointer)
 #define SI32_PMU_A_disable_rtc0_fail_wake_event(basePointer) \
@@ -749,8 +1287,19 @@ _SI32_PMU_A_disable_rtc0_fail_wake_event(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_rtc0_alarm_wake_event(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->WAKEEN_SET = SI32_PMU_A_WAKEEN_RTC0A0WEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_rtc0_alarm_wake_event(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_rtc0_alarm_wake_event(basePointer)
 #define SI32_PMU_A_enable_rtc0_alarm_wake_event(basePointer) \
@@ -762,8 +1311,19 @@ _SI32_PMU_A_enable_rtc0_alarm_wake_event(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_rtc0_alarm_wake_event(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->WAKEEN_CLR = SI32_PMU_A_WAKEEN_RTC0A0WEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_rtc0_alarm_wake_event(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_rtc0_alarm_wake_event(basePointer)
 #define SI32_PMU_A_disable_rtc0_alarm_wake_event(basePointer) \
@@ -775,8 +1335,19 @@ _SI32_PMU_A_disable_rtc0_alarm_wake_event(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_comparator0_wake_event(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->WAKEEN_SET = SI32_PMU_A_WAKEEN_CMP0WEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_comparator0_wake_event(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_comparator0_wake_event(basePointer)
 #define SI32_PMU_A_enable_comparator0_wake_event(basePointer) \
@@ -788,8 +1359,19 @@ _SI32_PMU_A_enable_comparator0_wake_event(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_comparator0_wake_event(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->WAKEEN_CLR = SI32_PMU_A_WAKEEN_CMP0WEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_comparator0_wake_event(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_comparator0_wake_event(basePointer)
 #define SI32_PMU_A_disable_comparator0_wake_event(basePointer) \
@@ -801,8 +1383,19 @@ _SI32_PMU_A_disable_comparator0_wake_event(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_advanced_capture_counter_wake_event(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->WAKEEN_SET = SI32_PMU_A_WAKEEN_ACC0WEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_advanced_capture_counter_wake_event(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_advanced_capture_counter_wake_event(basePointer)
 #define SI32_PMU_A_enable_advanced_capture_counter_wake_event(basePointer) \
@@ -814,8 +1407,19 @@ _SI32_PMU_A_enable_advanced_capture_counter_wake_event(SI32_PMU_A_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_advanced_capture_counter_wake_event(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->WAKEEN_CLR = SI32_PMU_A_WAKEEN_ACC0WEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_advanced_capture_counter_wake_event(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_advanced_capture_counter_wake_event(basePointer)
 #define SI32_PMU_A_disable_advanced_capture_counter_wake_event(basePointer) \
@@ -827,8 +1431,19 @@ _SI32_PMU_A_disable_advanced_capture_counter_wake_event(SI32_PMU_A_Type* /*baseP
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_lcd_vbat_monitor_wake_event(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->WAKEEN_SET = SI32_PMU_A_WAKEEN_LCDMONWEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_lcd_vbat_monitor_wake_event(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_lcd_vbat_monitor_wake_event(basePointer)
 #define SI32_PMU_A_enable_lcd_vbat_monitor_wake_event(basePointer) \
@@ -840,8 +1455,19 @@ _SI32_PMU_A_enable_lcd_vbat_monitor_wake_event(SI32_PMU_A_Type* /*basePointer*/)
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_lcd_vbat_monitor_wake_event(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->WAKEEN_CLR = SI32_PMU_A_WAKEEN_LCDMONWEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_lcd_vbat_monitor_wake_event(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_lcd_vbat_monitor_wake_event(basePointer)
 #define SI32_PMU_A_disable_lcd_vbat_monitor_wake_event(basePointer) \
@@ -853,8 +1479,19 @@ _SI32_PMU_A_disable_lcd_vbat_monitor_wake_event(SI32_PMU_A_Type* /*basePointer*/
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_pin_wake_event(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->WAKEEN_SET = SI32_PMU_A_WAKEEN_PWAKEWEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_pin_wake_event(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_pin_wake_event(basePointer)
 #define SI32_PMU_A_enable_pin_wake_event(basePointer) \
@@ -866,8 +1503,19 @@ _SI32_PMU_A_enable_pin_wake_event(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_pin_wake_event(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->WAKEEN_CLR = SI32_PMU_A_WAKEEN_PWAKEWEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_pin_wake_event(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_pin_wake_event(basePointer)
 #define SI32_PMU_A_disable_pin_wake_event(basePointer) \
@@ -879,8 +1527,19 @@ _SI32_PMU_A_disable_pin_wake_event(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_lptimer0_wake_event(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->WAKEEN_SET = SI32_PMU_A_WAKEEN_LPT0WEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_lptimer0_wake_event(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_lptimer0_wake_event(basePointer)
 #define SI32_PMU_A_enable_lptimer0_wake_event(basePointer) \
@@ -892,8 +1551,19 @@ _SI32_PMU_A_enable_lptimer0_wake_event(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_lptimer0_wake_event(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->WAKEEN_CLR = SI32_PMU_A_WAKEEN_LPT0WEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_lptimer0_wake_event(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_lptimer0_wake_event(basePointer)
 #define SI32_PMU_A_disable_lptimer0_wake_event(basePointer) \
@@ -905,8 +1575,19 @@ _SI32_PMU_A_disable_lptimer0_wake_event(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_uart0_wake_event(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->WAKEEN_SET = SI32_PMU_A_WAKEEN_UART0WEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_uart0_wake_event(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_uart0_wake_event(basePointer)
 #define SI32_PMU_A_enable_uart0_wake_event(basePointer) \
@@ -918,8 +1599,19 @@ _SI32_PMU_A_enable_uart0_wake_event(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_uart0_wake_event(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->WAKEEN_CLR = SI32_PMU_A_WAKEEN_UART0WEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_uart0_wake_event(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_uart0_wake_event(basePointer)
 #define SI32_PMU_A_disable_uart0_wake_event(basePointer) \
@@ -931,8 +1623,19 @@ _SI32_PMU_A_disable_uart0_wake_event(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_enable_low_power_charge_pump_wake_event(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->WAKEEN_SET = SI32_PMU_A_WAKEEN_CPFWEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_enable_low_power_charge_pump_wake_event(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_enable_low_power_charge_pump_wake_event(basePointer)
 #define SI32_PMU_A_enable_low_power_charge_pump_wake_event(basePointer) \
@@ -944,8 +1647,19 @@ _SI32_PMU_A_enable_low_power_charge_pump_wake_event(SI32_PMU_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_disable_low_power_charge_pump_wake_event(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   basePointer->WAKEEN_CLR = SI32_PMU_A_WAKEEN_CPFWEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_disable_low_power_charge_pump_wake_event(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_disable_low_power_charge_pump_wake_event(basePointer)
 #define SI32_PMU_A_disable_low_power_charge_pump_wake_event(basePointer) \
@@ -957,8 +1671,64 @@ _SI32_PMU_A_disable_low_power_charge_pump_wake_event(SI32_PMU_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline SI32_PMU_Wakeup_Enum_Type
+_SI32_PMU_A_get_last_wakeup_source(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   SI32_PMU_Wakeup_Enum_Type last_wake;
+   if (!basePointer->STATUS.PM8EF)
+   {
+      last_wake = SI32_NO_WAKEUP;
+   }
+   else if (basePointer->WAKESTATUS.RSTWF)
+   {
+      last_wake = SI32_RESET_WAKEUP;
+   }
+   else if (basePointer->WAKESTATUS.PWAKEWF && basePointer->WAKEEN.PWAKEWEN)
+   {
+      last_wake = SI32_PIN_WAKEUP;
+   }
+   else if (basePointer->WAKESTATUS.LPT0WF && basePointer->WAKEEN.LPT0WEN)
+   {
+      last_wake = SI32_LPTIMER0_WAKEUP;
+   }
+   else if (basePointer->WAKESTATUS.CMP0WF && basePointer->WAKEEN.CMP0WEN)
+   {
+      last_wake = SI32_CMP0_WAKEUP;
+   }
+   else if (basePointer->WAKESTATUS.RTC0A0WF && basePointer->WAKEEN.RTC0A0WEN)
+   {
+      last_wake = SI32_RTC0_ALARM_WAKEUP;
+   }
+   else if (basePointer->WAKESTATUS.RTC0FWF && basePointer->WAKEEN.RTC0FWEN)
+   {
+      last_wake = SI32_RTC0_FAIL_WAKEUP;
+   }
+   else if (basePointer->WAKESTATUS.ACC0WF && basePointer->WAKEEN.ACC0WEN)
+   {
+      last_wake = SI32_ADVANCED_CAPTURE_COUNTER_WAKEUP;
+   }
+   else if (basePointer->WAKESTATUS.LCDMONWF && basePointer->WAKEEN.LCDMONWEN)
+   {
+      last_wake = SI32_LCD_MONITOR_WAKEUP;
+   }
+   else if (basePointer->WAKESTATUS.UART0WF && basePointer->WAKEEN.UART0WEN)
+   {
+      last_wake = SI32_UART0_WAKEUP;
+   }
+   else
+   {
+      last_wake = SI32_WAKEUP_ERROR;
+   }
+   return last_wake;
+   //}}
+}
+#else
 SI32_PMU_Wakeup_Enum_Type
 _SI32_PMU_A_get_last_wakeup_source(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_get_last_wakeup_source(basePointer)
 #define SI32_PMU_A_get_last_wakeup_source(basePointer) \
@@ -970,8 +1740,19 @@ _SI32_PMU_A_get_last_wakeup_source(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PMU_A_is_rtc0_fail_wakeup_flag_set(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+  return (bool) basePointer->WAKESTATUS.RTC0FWF;
+   //}}
+}
+#else
 bool
 _SI32_PMU_A_is_rtc0_fail_wakeup_flag_set(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_is_rtc0_fail_wakeup_flag_set(basePointer)
 #define SI32_PMU_A_is_rtc0_fail_wakeup_flag_set(basePointer) \
@@ -983,8 +1764,19 @@ _SI32_PMU_A_is_rtc0_fail_wakeup_flag_set(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PMU_A_is_rtc0_alarm_wakeup_flag_set(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+  return (bool) basePointer->WAKESTATUS.RTC0A0WF;
+   //}}
+}
+#else
 bool
 _SI32_PMU_A_is_rtc0_alarm_wakeup_flag_set(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_is_rtc0_alarm_wakeup_flag_set(basePointer)
 #define SI32_PMU_A_is_rtc0_alarm_wakeup_flag_set(basePointer) \
@@ -996,8 +1788,19 @@ _SI32_PMU_A_is_rtc0_alarm_wakeup_flag_set(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PMU_A_is_comparator0_wakeup_flag_set(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+  return (bool) basePointer->WAKESTATUS.CMP0WF;
+   //}}
+}
+#else
 bool
 _SI32_PMU_A_is_comparator0_wakeup_flag_set(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_is_comparator0_wakeup_flag_set(basePointer)
 #define SI32_PMU_A_is_comparator0_wakeup_flag_set(basePointer) \
@@ -1009,8 +1812,19 @@ _SI32_PMU_A_is_comparator0_wakeup_flag_set(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PMU_A_is_advance_capture_counter_wakeup_flag_set(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+  return (bool) basePointer->WAKESTATUS.ACC0WF;
+   //}}
+}
+#else
 bool
 _SI32_PMU_A_is_advance_capture_counter_wakeup_flag_set(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_is_advance_capture_counter_wakeup_flag_set(basePointer)
 #define SI32_PMU_A_is_advance_capture_counter_wakeup_flag_set(basePointer) \
@@ -1022,8 +1836,19 @@ _SI32_PMU_A_is_advance_capture_counter_wakeup_flag_set(SI32_PMU_A_Type* /*basePo
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PMU_A_is_lcd_monitor_wakeup_flag_set(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+  return (bool) basePointer->WAKESTATUS.LCDMONWF;
+   //}}
+}
+#else
 bool
 _SI32_PMU_A_is_lcd_monitor_wakeup_flag_set(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_is_lcd_monitor_wakeup_flag_set(basePointer)
 #define SI32_PMU_A_is_lcd_monitor_wakeup_flag_set(basePointer) \
@@ -1035,8 +1860,19 @@ _SI32_PMU_A_is_lcd_monitor_wakeup_flag_set(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PMU_A_is_pin_wakeup_flag_set(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   return (bool) basePointer->WAKESTATUS.PWAKEWF;
+   //}}
+}
+#else
 bool
 _SI32_PMU_A_is_pin_wakeup_flag_set(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_is_pin_wakeup_flag_set(basePointer)
 #define SI32_PMU_A_is_pin_wakeup_flag_set(basePointer) \
@@ -1048,8 +1884,19 @@ _SI32_PMU_A_is_pin_wakeup_flag_set(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PMU_A_is_lptimer0_wakeup_flag_set(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   return (bool) basePointer->WAKESTATUS.LPT0WF;
+   //}}
+}
+#else
 bool
 _SI32_PMU_A_is_lptimer0_wakeup_flag_set(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_is_lptimer0_wakeup_flag_set(basePointer)
 #define SI32_PMU_A_is_lptimer0_wakeup_flag_set(basePointer) \
@@ -1061,8 +1908,19 @@ _SI32_PMU_A_is_lptimer0_wakeup_flag_set(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PMU_A_is_uart_wakeup_flag_set(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   return (bool) basePointer->WAKESTATUS.UART0WF;
+   //}}
+}
+#else
 bool
 _SI32_PMU_A_is_uart_wakeup_flag_set(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_is_uart_wakeup_flag_set(basePointer)
 #define SI32_PMU_A_is_uart_wakeup_flag_set(basePointer) \
@@ -1074,8 +1932,19 @@ _SI32_PMU_A_is_uart_wakeup_flag_set(SI32_PMU_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_PMU_A_is_low_power_charge_pump_wakeup_flag_set(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   return (bool) basePointer->WAKESTATUS.CPFWF;
+   //}}
+}
+#else
 bool
 _SI32_PMU_A_is_low_power_charge_pump_wakeup_flag_set(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_is_low_power_charge_pump_wakeup_flag_set(basePointer)
 #define SI32_PMU_A_is_low_power_charge_pump_wakeup_flag_set(basePointer) \
@@ -1090,8 +1959,19 @@ _SI32_PMU_A_is_low_power_charge_pump_wakeup_flag_set(SI32_PMU_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide16_t
+_SI32_PMU_A_read_pwen(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   return basePointer->PWEN.U32;
+   //}}
+}
+#else
 uwide16_t
 _SI32_PMU_A_read_pwen(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_read_pwen(basePointer)
 #define SI32_PMU_A_read_pwen(basePointer) \
@@ -1111,9 +1991,22 @@ _SI32_PMU_A_read_pwen(SI32_PMU_A_Type* /*basePointer*/);
 ///  pwen
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_write_pwen(
+   SI32_PMU_A_Type * basePointer,
+   uwide16_t pwen)
+{
+   assert(pwen < 65536);   // pwen < 2^16
+   //{{
+   basePointer->PWEN.U32 = pwen;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_write_pwen(SI32_PMU_A_Type* /*basePointer*/,
    uwide16_t /*pwen*/);
+#endif
 ///
 /// @def SI32_PMU_A_write_pwen(basePointer, pwen)
 #define SI32_PMU_A_write_pwen(basePointer, pwen) \
@@ -1128,8 +2021,19 @@ _SI32_PMU_A_write_pwen(SI32_PMU_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uwide16_t
+_SI32_PMU_A_read_pwpol(
+   SI32_PMU_A_Type * basePointer)
+{
+   //{{
+   return basePointer->PWPOL.U32;
+   //}}
+}
+#else
 uwide16_t
 _SI32_PMU_A_read_pwpol(SI32_PMU_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_PMU_A_read_pwpol(basePointer)
 #define SI32_PMU_A_read_pwpol(basePointer) \
@@ -1149,9 +2053,22 @@ _SI32_PMU_A_read_pwpol(SI32_PMU_A_Type* /*basePointer*/);
 ///  pwpol
 ///  Valid range is 16 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_write_pwpol(
+   SI32_PMU_A_Type * basePointer,
+   uwide16_t pwpol)
+{
+   assert(pwpol < 65536);   // pwpol < 2^16
+   //{{
+   basePointer->PWPOL.U32 = pwpol;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_write_pwpol(SI32_PMU_A_Type* /*basePointer*/,
    uwide16_t /*pwpol*/);
+#endif
 ///
 /// @def SI32_PMU_A_write_pwpol(basePointer, pwpol)
 #define SI32_PMU_A_write_pwpol(basePointer, pwpol) \
@@ -1175,10 +2092,28 @@ _SI32_PMU_A_write_pwpol(SI32_PMU_A_Type* /*basePointer*/,
 ///  Valid range is 16 bits.
 ///  Write to PWPOL register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_PMU_A_set_pin_wake_events(
+   SI32_PMU_A_Type * basePointer,
+   // Write to PWEN register.
+   uwide16_t pwen,
+   // Write to PWPOL register.
+   uwide16_t pwpol)
+{
+   assert(pwen < 65536);   // pwen < 2^16
+   assert(pwpol < 65536);   // pwpol < 2^16
+   //{{
+   basePointer->PWEN.U32 = pwen;
+   basePointer->PWPOL.U32 = pwpol;
+   //}}
+}
+#else
 void
 _SI32_PMU_A_set_pin_wake_events(SI32_PMU_A_Type* /*basePointer*/,
    uwide16_t, /*pwen*/
    uwide16_t /*pwpol*/);
+#endif
 ///
 /// @def SI32_PMU_A_set_pin_wake_events(basePointer, pwen, pwpol)
 #define SI32_PMU_A_set_pin_wake_events(basePointer, pwen, pwpol) do{  \
@@ -55,9 +55,21 @@ extern "C" {
 ///  config
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SCONFIG_A_initialize(
+   SI32_SCONFIG_A_Type * basePointer,
+   uint32_t config)
+{
+   //{{
+   basePointer->CONFIG.U32 = config;
+   //}}
+}
+#else
 void
 _SI32_SCONFIG_A_initialize(SI32_SCONFIG_A_Type* /*basePointer*/,
    uint32_t /*config*/);
+#endif
 ///
 /// @def SI32_SCONFIG_A_initialize(basePointer, config)
 #define SI32_SCONFIG_A_initialize(basePointer, config) \
@@ -77,9 +89,21 @@ _SI32_SCONFIG_A_initialize(SI32_SCONFIG_A_Type* /*basePointer*/,
 ///  config
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SCONFIG_A_write_config(
+   SI32_SCONFIG_A_Type * basePointer,
+   uint32_t config)
+{
+   //{{
+   basePointer->CONFIG.U32 = config;
+   //}}
+}
+#else
 void
 _SI32_SCONFIG_A_write_config(SI32_SCONFIG_A_Type* /*basePointer*/,
    uint32_t /*config*/);
+#endif
 ///
 /// @def SI32_SCONFIG_A_write_config(basePointer, config)
 #define SI32_SCONFIG_A_write_config(basePointer, config) \
@@ -94,8 +118,19 @@ _SI32_SCONFIG_A_write_config(SI32_SCONFIG_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_SCONFIG_A_read_config(
+   SI32_SCONFIG_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONFIG.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_SCONFIG_A_read_config(SI32_SCONFIG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SCONFIG_A_read_config(basePointer)
 #define SI32_SCONFIG_A_read_config(basePointer) \
@@ -110,8 +145,19 @@ _SI32_SCONFIG_A_read_config(SI32_SCONFIG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SCONFIG_A_enter_fast_dma_mode(
+   SI32_SCONFIG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SCONFIG_A_CONFIG_FDMAEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SCONFIG_A_enter_fast_dma_mode(SI32_SCONFIG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SCONFIG_A_enter_fast_dma_mode(basePointer)
 #define SI32_SCONFIG_A_enter_fast_dma_mode(basePointer) \
@@ -126,8 +172,19 @@ _SI32_SCONFIG_A_enter_fast_dma_mode(SI32_SCONFIG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SCONFIG_A_exit_fast_dma_mode(
+   SI32_SCONFIG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SCONFIG_A_CONFIG_FDMAEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SCONFIG_A_exit_fast_dma_mode(SI32_SCONFIG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SCONFIG_A_exit_fast_dma_mode(basePointer)
 #define SI32_SCONFIG_A_exit_fast_dma_mode(basePointer) \
@@ -139,8 +196,19 @@ _SI32_SCONFIG_A_exit_fast_dma_mode(SI32_SCONFIG_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SCONFIG_A_enable_power_mode_8_debugging(
+   SI32_SCONFIG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_SCONFIG_A_CONFIG_PM8DBGEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SCONFIG_A_enable_power_mode_8_debugging(SI32_SCONFIG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SCONFIG_A_enable_power_mode_8_debugging(basePointer)
 #define SI32_SCONFIG_A_enable_power_mode_8_debugging(basePointer) \
@@ -152,8 +220,19 @@ _SI32_SCONFIG_A_enable_power_mode_8_debugging(SI32_SCONFIG_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_SCONFIG_A_disable_power_mode_8_debugging(
+   SI32_SCONFIG_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_SCONFIG_A_CONFIG_PM8DBGEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_SCONFIG_A_disable_power_mode_8_debugging(SI32_SCONFIG_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_SCONFIG_A_disable_power_mode_8_debugging(basePointer)
 #define SI32_SCONFIG_A_disable_power_mode_8_debugging(basePointer) \
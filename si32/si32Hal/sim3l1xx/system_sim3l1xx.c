@@ -26,6 +26,41 @@
 // boot oscillator is 20MHz
 uint32_t SystemCoreClock = 20000000;
 
+// APB clock, the boot clock is not divided
+uint32_t SystemAPBClock = 20000000;
+
+//------------------------------------------------------------------------------
+// Oscillator frequencies in Hz, 0 for an unknown frequency.
+// Define si32HalOption_extosc0_frequency to the frequency of the external
+// oscillator to have it taken into account, and likewise
+// si32HalOption_viorfclk_frequency for the VIORF clock.
+#if defined(si32HalOption_extosc0_frequency)
+# define EXTOSC0_FREQUENCY  si32HalOption_extosc0_frequency
+#else
+# define EXTOSC0_FREQUENCY  0
+#endif
+#if defined(si32HalOption_viorfclk_frequency)
+# define VIORFCLK_FREQUENCY  si32HalOption_viorfclk_frequency
+#else
+# define VIORFCLK_FREQUENCY  0
+#endif
+#define LPOSC0_FREQUENCY      20000000
+#define LPOSC0_DIV_FREQUENCY  2500000
+#define LFOSC0_FREQUENCY      16400
+#define RTC0_FREQUENCY        32768
+
+// Clock register fields SystemCoreClock and SystemAPBClock were computed
+// from. The clock control value is not a valid one until the first update.
+#define CLOCK_CONTROL_FIELDS (SI32_CLKCTRL_A_CONTROL_AHBSEL_MASK \
+                            | SI32_CLKCTRL_A_CONTROL_AHBDIV_MASK \
+                            | SI32_CLKCTRL_A_CONTROL_APBDIV_MASK)
+#define PLL_CONTROL_FIELDS   (SI32_PLL_A_CONTROL_REFSEL_MASK \
+                            | SI32_PLL_A_CONTROL_OUTMD_MASK)
+
+static uint32_t cachedClockControl = 0xFFFFFFFF;
+static uint32_t cachedPllDivider = 0;
+static uint32_t cachedPllControl = 0;
+
 //------------------------------------------------------------------------------
 void SystemInit(void)
 {
@@ -59,12 +94,126 @@ void SystemInit(void)
 
   // invoke the application's system initialization.
   mySystemInit();
+
+  // pick up the clock settings made by the application.
+  SystemCoreClockUpdate();
+}
+
+//------------------------------------------------------------------------------
+static uint32_t get_pll_frequency(const struct SI32_PLL_A_Struct* pll)
+{
+  uint32_t reference;
+
+  // The output frequency is only known when locked to the reference.
+  if ((pll->CONTROL.OUTMD != SI32_PLL_A_CONTROL_OUTMD_FLL_VALUE)
+  &&  (pll->CONTROL.OUTMD != SI32_PLL_A_CONTROL_OUTMD_PLL_VALUE))
+  {
+    return 0;
+  }
+
+  switch (pll->CONTROL.REFSEL)
+  {
+    case SI32_PLL_A_CONTROL_REFSEL_RTC0OSC_VALUE:
+      reference = RTC0_FREQUENCY;
+      break;
+    case SI32_PLL_A_CONTROL_REFSEL_LPOSC0DIV_VALUE:
+      reference = LPOSC0_DIV_FREQUENCY;
+      break;
+    case SI32_PLL_A_CONTROL_REFSEL_EXTOSC0_VALUE:
+      reference = EXTOSC0_FREQUENCY;
+      break;
+    case SI32_PLL_A_CONTROL_REFSEL_LPOSC0_VALUE:
+      reference = LPOSC0_FREQUENCY;
+      break;
+    default:
+      reference = 0;
+      break;
+  }
+
+  // FDCO = FREF * (N + 1) / (M + 1)
+  return (uint32_t)(((uint64_t)reference * (pll->DIVIDER.N + 1)) / (pll->DIVIDER.M + 1));
+}
+
+//------------------------------------------------------------------------------
+void SystemClockEvaluate(const struct SI32_CLKCTRL_A_Struct* clkctrl,
+                         const struct SI32_PLL_A_Struct* pll,
+                         uint32_t* ahbClock,
+                         uint32_t* apbClock)
+{
+  uint32_t source;
+
+  switch (clkctrl->CONTROL.AHBSEL)
+  {
+    case SI32_CLKCTRL_A_CONTROL_AHBSEL_LPOSC0_VALUE:
+      source = LPOSC0_FREQUENCY;
+      break;
+    case SI32_CLKCTRL_A_CONTROL_AHBSEL_LFOSC0_VALUE:
+      source = LFOSC0_FREQUENCY;
+      break;
+    case SI32_CLKCTRL_A_CONTROL_AHBSEL_RTC0TCLK_VALUE:
+      source = RTC0_FREQUENCY;
+      break;
+    case SI32_CLKCTRL_A_CONTROL_AHBSEL_EXTOSC0_VALUE:
+      source = EXTOSC0_FREQUENCY;
+      break;
+    case SI32_CLKCTRL_A_CONTROL_AHBSEL_VIORFCLK_VALUE:
+      source = VIORFCLK_FREQUENCY;
+      break;
+    case SI32_CLKCTRL_A_CONTROL_AHBSEL_LPOSC0_DIV_VALUE:
+      source = LPOSC0_DIV_FREQUENCY;
+      break;
+    case SI32_CLKCTRL_A_CONTROL_AHBSEL_PLL0OSC_VALUE:
+      source = get_pll_frequency(pll);
+      break;
+    default:
+      source = 0;
+      break;
+  }
+
+  // AHBDIV divides by 2^AHBDIV, APBDIV by 2^APBDIV.
+  *ahbClock = source >> clkctrl->CONTROL.AHBDIV;
+  *apbClock = *ahbClock >> clkctrl->CONTROL.APBDIV;
 }
 
 //------------------------------------------------------------------------------
 void SystemCoreClockUpdate(void)
 {
-  // TBD - examine the clock registers and compute the system core clock value.
+  uint32_t clockControl = SI32_CLKCTRL_0->CONTROL.U32 & CLOCK_CONTROL_FIELDS;
+  uint32_t pllDivider = 0;
+  uint32_t pllControl = 0;
+  uint32_t ahbClock;
+  uint32_t apbClock;
+
+  // The PLL registers only matter when the PLL drives the AHB clock.
+  if ((clockControl & SI32_CLKCTRL_A_CONTROL_AHBSEL_MASK) == SI32_CLKCTRL_A_CONTROL_AHBSEL_PLL0OSC_U32)
+  {
+    pllDivider = SI32_PLL_0->DIVIDER.U32;
+    pllControl = SI32_PLL_0->CONTROL.U32 & PLL_CONTROL_FIELDS;
+  }
+
+  // Skip the evaluation if no clock setting changed since the last update.
+  if ((clockControl == cachedClockControl)
+  &&  (pllDivider == cachedPllDivider)
+  &&  (pllControl == cachedPllControl))
+  {
+    return;
+  }
+
+  SystemClockEvaluate(SI32_CLKCTRL_0, SI32_PLL_0, &ahbClock, &apbClock);
+
+  // Keep the last known frequencies if the clock source frequency is not
+  // known, and evaluate again on the next update.
+  if (ahbClock == 0)
+  {
+    cachedClockControl = 0xFFFFFFFF;
+    return;
+  }
+
+  SystemCoreClock = ahbClock;
+  SystemAPBClock = apbClock;
+  cachedClockControl = clockControl;
+  cachedPllDivider = pllDivider;
+  cachedPllControl = pllControl;
 }
 
 //-eof--------------------------------------------------------------------------
@@ -40,6 +40,9 @@ extern "C" {
 // examined to configure the debugger.
 extern uint32_t SystemCoreClock;
 
+// Contains the APB clock frequency. It is updated along with SystemCoreClock.
+extern uint32_t SystemAPBClock;
+
 // Refer to the CMSIS_V2P00 specification for detailed documentation.
 // Setup the microcontroller system.
 // For systems with variable clock speed it also updates the variable SystemCoreClock.
@@ -52,8 +55,20 @@ extern void mySystemInit(void);
 // Updates the variable SystemCoreClock and must be called whenever the core
 // clock is changed during program execution. SystemCoreClockUpdate() evaluates
 // the clock register settings and calculates the current core clock.
+// The clock registers are only evaluated again when they changed since the
+// last call.
 extern void SystemCoreClockUpdate(void);
 
+// Computes the AHB and APB clock frequencies from the given clock control and
+// PLL registers. A frequency is 0 when the frequency of the clock source is
+// not known. SystemCoreClockUpdate() uses it with SI32_CLKCTRL_0 and SI32_PLL_0.
+struct SI32_CLKCTRL_A_Struct;
+struct SI32_PLL_A_Struct;
+extern void SystemClockEvaluate(const struct SI32_CLKCTRL_A_Struct* clkctrl,
+                                const struct SI32_PLL_A_Struct* pll,
+                                uint32_t* ahbClock,
+                                uint32_t* apbClock);
+
 #ifdef __cplusplus
 }
 #endif
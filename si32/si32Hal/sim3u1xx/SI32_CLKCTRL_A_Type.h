@@ -76,6 +76,25 @@ extern "C" {
 ///  pm3cn
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_initialize(
+   SI32_CLKCTRL_A_Type * basePointer,
+   uint32_t control,
+   uint32_t ahbclkg,
+   uint32_t apbclkg0,
+   uint32_t apbclkg1,
+   uint32_t pm3cn)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   basePointer->AHBCLKG.U32 = ahbclkg;
+   basePointer->APBCLKG0.U32 = apbclkg0;
+   basePointer->APBCLKG1.U32 = apbclkg1;
+   basePointer->PM3CN.U32 = pm3cn;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_initialize(SI32_CLKCTRL_A_Type* /*basePointer*/,
    uint32_t, /*control*/
@@ -83,6 +102,7 @@ _SI32_CLKCTRL_A_initialize(SI32_CLKCTRL_A_Type* /*basePointer*/,
    uint32_t, /*apbclkg0*/
    uint32_t, /*apbclkg1*/
    uint32_t /*pm3cn*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_initialize(basePointer, control, ahbclkg, apbclkg0, apbclkg1, pm3cn)
 #define SI32_CLKCTRL_A_initialize(basePointer, control, ahbclkg, apbclkg0, apbclkg1, pm3cn) do{  \
@@ -107,9 +127,21 @@ _SI32_CLKCTRL_A_initialize(SI32_CLKCTRL_A_Type* /*basePointer*/,
 ///  control
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_write_control(
+   SI32_CLKCTRL_A_Type * basePointer,
+   uint32_t control)
+{
+   //{{
+   basePointer->CONTROL.U32 = control;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_write_control(SI32_CLKCTRL_A_Type* /*basePointer*/,
    uint32_t /*control*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_write_control(basePointer, control)
 #define SI32_CLKCTRL_A_write_control(basePointer, control) \
@@ -124,8 +156,19 @@ _SI32_CLKCTRL_A_write_control(SI32_CLKCTRL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_CLKCTRL_A_read_control(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONTROL.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_CLKCTRL_A_read_control(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_read_control(basePointer)
 #define SI32_CLKCTRL_A_read_control(basePointer) \
@@ -137,8 +180,20 @@ _SI32_CLKCTRL_A_read_control(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_ahb_source_low_power_oscillator(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.AHBSEL =
+      SI32_CLKCTRL_A_CONTROL_AHBSEL_LPOSC0_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_ahb_source_low_power_oscillator(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_ahb_source_low_power_oscillator(basePointer)
 #define SI32_CLKCTRL_A_select_ahb_source_low_power_oscillator(basePointer) do{  \
@@ -152,8 +207,20 @@ _SI32_CLKCTRL_A_select_ahb_source_low_power_oscillator(SI32_CLKCTRL_A_Type* /*ba
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_ahb_source_low_frequency_oscillator(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.AHBSEL =
+      SI32_CLKCTRL_A_CONTROL_AHBSEL_LFOSC0_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_ahb_source_low_frequency_oscillator(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_ahb_source_low_frequency_oscillator(basePointer)
 #define SI32_CLKCTRL_A_select_ahb_source_low_frequency_oscillator(basePointer) do{  \
@@ -167,8 +234,20 @@ _SI32_CLKCTRL_A_select_ahb_source_low_frequency_oscillator(SI32_CLKCTRL_A_Type*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_ahb_source_rtc_oscillator(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.AHBSEL =
+      SI32_CLKCTRL_A_CONTROL_AHBSEL_RTC0OSC_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_ahb_source_rtc_oscillator(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_ahb_source_rtc_oscillator(basePointer)
 #define SI32_CLKCTRL_A_select_ahb_source_rtc_oscillator(basePointer) do{  \
@@ -182,8 +261,20 @@ _SI32_CLKCTRL_A_select_ahb_source_rtc_oscillator(SI32_CLKCTRL_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_ahb_source_external_oscillator(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.AHBSEL =
+      SI32_CLKCTRL_A_CONTROL_AHBSEL_EXTOSC0_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_ahb_source_external_oscillator(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_ahb_source_external_oscillator(basePointer)
 #define SI32_CLKCTRL_A_select_ahb_source_external_oscillator(basePointer) do{  \
@@ -197,8 +288,20 @@ _SI32_CLKCTRL_A_select_ahb_source_external_oscillator(SI32_CLKCTRL_A_Type* /*bas
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_ahb_source_usb_oscillator(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.AHBSEL =
+      SI32_CLKCTRL_A_CONTROL_AHBSEL_USB0OSC_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_ahb_source_usb_oscillator(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_ahb_source_usb_oscillator(basePointer)
 #define SI32_CLKCTRL_A_select_ahb_source_usb_oscillator(basePointer) do{  \
@@ -212,8 +315,20 @@ _SI32_CLKCTRL_A_select_ahb_source_usb_oscillator(SI32_CLKCTRL_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_ahb_source_pll(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.AHBSEL =
+      SI32_CLKCTRL_A_CONTROL_AHBSEL_PLL0OSC_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_ahb_source_pll(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_ahb_source_pll(basePointer)
 #define SI32_CLKCTRL_A_select_ahb_source_pll(basePointer) do{  \
@@ -227,8 +342,20 @@ _SI32_CLKCTRL_A_select_ahb_source_pll(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_ahb_source_divided_low_power_oscillator(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.AHBSEL =
+      SI32_CLKCTRL_A_CONTROL_AHBSEL_LPOSC0_DIV_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_ahb_source_divided_low_power_oscillator(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_ahb_source_divided_low_power_oscillator(basePointer)
 #define SI32_CLKCTRL_A_select_ahb_source_divided_low_power_oscillator(basePointer) do{  \
@@ -249,9 +376,24 @@ _SI32_CLKCTRL_A_select_ahb_source_divided_low_power_oscillator(SI32_CLKCTRL_A_Ty
 ///  AHB divide amount is 2 ^ divider (0 = divide by 1, ..., 7 = divide by
 ///  128).
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_ahb_divider(
+   SI32_CLKCTRL_A_Type * basePointer,
+   // AHB divide amount is 2 ^ divider (0 = divide by 1, ..., 7 = divide by
+   // 128).
+   uint32_t divider)
+{
+   assert(divider <= 7);
+   //{{
+   basePointer->CONTROL.AHBDIV = divider;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_ahb_divider(SI32_CLKCTRL_A_Type* /*basePointer*/,
    uint32_t /*divider*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_ahb_divider(basePointer, divider)
 #define SI32_CLKCTRL_A_select_ahb_divider(basePointer, divider) \
@@ -266,8 +408,20 @@ _SI32_CLKCTRL_A_select_ahb_divider(SI32_CLKCTRL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_apb_divider_1(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.APBDIV =
+      SI32_CLKCTRL_A_CONTROL_APBDIV_DIV1_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_apb_divider_1(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_apb_divider_1(basePointer)
 #define SI32_CLKCTRL_A_select_apb_divider_1(basePointer) do{  \
@@ -284,8 +438,20 @@ _SI32_CLKCTRL_A_select_apb_divider_1(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_apb_divider_2(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.APBDIV =
+      SI32_CLKCTRL_A_CONTROL_APBDIV_DIV2_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_apb_divider_2(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_apb_divider_2(basePointer)
 #define SI32_CLKCTRL_A_select_apb_divider_2(basePointer) do{  \
@@ -302,8 +468,20 @@ _SI32_CLKCTRL_A_select_apb_divider_2(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_external_clock_dual_edge(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.EXTESEL =
+      SI32_CLKCTRL_A_CONTROL_EXTESEL_BOTH_EDGES_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_external_clock_dual_edge(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_external_clock_dual_edge(basePointer)
 #define SI32_CLKCTRL_A_select_external_clock_dual_edge(basePointer) do{  \
@@ -320,8 +498,20 @@ _SI32_CLKCTRL_A_select_external_clock_dual_edge(SI32_CLKCTRL_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_external_clock_rising_edge(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONTROL.EXTESEL =
+      SI32_CLKCTRL_A_CONTROL_EXTESEL_RISING_ONLY_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_external_clock_rising_edge(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_external_clock_rising_edge(basePointer)
 #define SI32_CLKCTRL_A_select_external_clock_rising_edge(basePointer) do{  \
@@ -335,8 +525,19 @@ _SI32_CLKCTRL_A_select_external_clock_rising_edge(SI32_CLKCTRL_A_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline bool
+_SI32_CLKCTRL_A_are_system_clocks_busy(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   return (bool)(basePointer->CONTROL.OBUSYF);
+   //}}
+}
+#else
 bool
 _SI32_CLKCTRL_A_are_system_clocks_busy(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_are_system_clocks_busy(basePointer)
 #define SI32_CLKCTRL_A_are_system_clocks_busy(basePointer) \
@@ -356,9 +557,21 @@ _SI32_CLKCTRL_A_are_system_clocks_busy(SI32_CLKCTRL_A_Type* /*basePointer*/);
 ///  ahbclkg
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_write_ahbclkg(
+   SI32_CLKCTRL_A_Type * basePointer,
+   uint32_t ahbclkg)
+{
+   //{{
+   basePointer->AHBCLKG.U32 = ahbclkg;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_write_ahbclkg(SI32_CLKCTRL_A_Type* /*basePointer*/,
    uint32_t /*ahbclkg*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_write_ahbclkg(basePointer, ahbclkg)
 #define SI32_CLKCTRL_A_write_ahbclkg(basePointer, ahbclkg) \
@@ -373,8 +586,19 @@ _SI32_CLKCTRL_A_write_ahbclkg(SI32_CLKCTRL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_CLKCTRL_A_read_ahbclkg(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   return basePointer->AHBCLKG.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_CLKCTRL_A_read_ahbclkg(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_read_ahbclkg(basePointer)
 #define SI32_CLKCTRL_A_read_ahbclkg(basePointer) \
@@ -386,8 +610,20 @@ _SI32_CLKCTRL_A_read_ahbclkg(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_enable_ahb_to_ram(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->AHBCLKG_SET =
+      SI32_CLKCTRL_A_AHBCLKG_RAMCEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_enable_ahb_to_ram(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_enable_ahb_to_ram(basePointer)
 #define SI32_CLKCTRL_A_enable_ahb_to_ram(basePointer) do{  \
@@ -401,8 +637,20 @@ _SI32_CLKCTRL_A_enable_ahb_to_ram(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_disable_ahb_to_ram(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->AHBCLKG_CLR =
+      SI32_CLKCTRL_A_AHBCLKG_RAMCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_disable_ahb_to_ram(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_disable_ahb_to_ram(basePointer)
 #define SI32_CLKCTRL_A_disable_ahb_to_ram(basePointer) do{  \
@@ -416,8 +664,20 @@ _SI32_CLKCTRL_A_disable_ahb_to_ram(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_enable_ahb_to_dma_controller(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->AHBCLKG_SET =
+      SI32_CLKCTRL_A_AHBCLKG_DMACEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_enable_ahb_to_dma_controller(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_enable_ahb_to_dma_controller(basePointer)
 #define SI32_CLKCTRL_A_enable_ahb_to_dma_controller(basePointer) do{  \
@@ -431,8 +691,20 @@ _SI32_CLKCTRL_A_enable_ahb_to_dma_controller(SI32_CLKCTRL_A_Type* /*basePointer*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_disable_ahb_to_dma_controller(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->AHBCLKG_CLR =
+      SI32_CLKCTRL_A_AHBCLKG_DMACEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_disable_ahb_to_dma_controller(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_disable_ahb_to_dma_controller(basePointer)
 #define SI32_CLKCTRL_A_disable_ahb_to_dma_controller(basePointer) do{  \
@@ -446,8 +718,20 @@ _SI32_CLKCTRL_A_disable_ahb_to_dma_controller(SI32_CLKCTRL_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_enable_ahb_to_flash_controller(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->AHBCLKG_SET =
+      SI32_CLKCTRL_A_AHBCLKG_FLASHCEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_enable_ahb_to_flash_controller(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_enable_ahb_to_flash_controller(basePointer)
 #define SI32_CLKCTRL_A_enable_ahb_to_flash_controller(basePointer) do{  \
@@ -461,8 +745,20 @@ _SI32_CLKCTRL_A_enable_ahb_to_flash_controller(SI32_CLKCTRL_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_disable_ahb_to_flash_controller(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->AHBCLKG_CLR =
+      SI32_CLKCTRL_A_AHBCLKG_FLASHCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_disable_ahb_to_flash_controller(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_disable_ahb_to_flash_controller(basePointer)
 #define SI32_CLKCTRL_A_disable_ahb_to_flash_controller(basePointer) do{  \
@@ -476,8 +772,20 @@ _SI32_CLKCTRL_A_disable_ahb_to_flash_controller(SI32_CLKCTRL_A_Type* /*basePoint
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_enable_ahb_to_emif(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->AHBCLKG_SET =
+      SI32_CLKCTRL_A_AHBCLKG_EMIF0CEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_enable_ahb_to_emif(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_enable_ahb_to_emif(basePointer)
 #define SI32_CLKCTRL_A_enable_ahb_to_emif(basePointer) do{  \
@@ -491,8 +799,20 @@ _SI32_CLKCTRL_A_enable_ahb_to_emif(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_disable_ahb_to_emif(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->AHBCLKG_CLR =
+      SI32_CLKCTRL_A_AHBCLKG_EMIF0CEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_disable_ahb_to_emif(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_disable_ahb_to_emif(basePointer)
 #define SI32_CLKCTRL_A_disable_ahb_to_emif(basePointer) do{  \
@@ -506,8 +826,20 @@ _SI32_CLKCTRL_A_disable_ahb_to_emif(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_enable_ahb_to_usb_buffer(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->AHBCLKG_SET =
+      SI32_CLKCTRL_A_AHBCLKG_USB0BCEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_enable_ahb_to_usb_buffer(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_enable_ahb_to_usb_buffer(basePointer)
 #define SI32_CLKCTRL_A_enable_ahb_to_usb_buffer(basePointer) do{  \
@@ -521,8 +853,20 @@ _SI32_CLKCTRL_A_enable_ahb_to_usb_buffer(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_disable_ahb_to_usb_buffer(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->AHBCLKG_CLR =
+      SI32_CLKCTRL_A_AHBCLKG_USB0BCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_disable_ahb_to_usb_buffer(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_disable_ahb_to_usb_buffer(basePointer)
 #define SI32_CLKCTRL_A_disable_ahb_to_usb_buffer(basePointer) do{  \
@@ -536,8 +880,24 @@ _SI32_CLKCTRL_A_disable_ahb_to_usb_buffer(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_enable_ahb_to_all_modules(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->AHBCLKG_SET =
+      SI32_CLKCTRL_A_AHBCLKG_RAMCEN_ENABLED_U32
+      | SI32_CLKCTRL_A_AHBCLKG_DMACEN_ENABLED_U32
+      | SI32_CLKCTRL_A_AHBCLKG_FLASHCEN_ENABLED_U32
+      | SI32_CLKCTRL_A_AHBCLKG_EMIF0CEN_ENABLED_U32
+      | SI32_CLKCTRL_A_AHBCLKG_USB0BCEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_enable_ahb_to_all_modules(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_enable_ahb_to_all_modules(basePointer)
 #define SI32_CLKCTRL_A_enable_ahb_to_all_modules(basePointer) do{  \
@@ -555,8 +915,24 @@ _SI32_CLKCTRL_A_enable_ahb_to_all_modules(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_disable_ahb_to_all_modules(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->AHBCLKG_CLR =
+      SI32_CLKCTRL_A_AHBCLKG_RAMCEN_MASK
+      | SI32_CLKCTRL_A_AHBCLKG_DMACEN_MASK
+      | SI32_CLKCTRL_A_AHBCLKG_FLASHCEN_MASK
+      | SI32_CLKCTRL_A_AHBCLKG_EMIF0CEN_MASK
+      | SI32_CLKCTRL_A_AHBCLKG_USB0BCEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_disable_ahb_to_all_modules(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_disable_ahb_to_all_modules(basePointer)
 #define SI32_CLKCTRL_A_disable_ahb_to_all_modules(basePointer) do{  \
@@ -582,9 +958,21 @@ _SI32_CLKCTRL_A_disable_ahb_to_all_modules(SI32_CLKCTRL_A_Type* /*basePointer*/)
 ///  apbclkg0
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_write_apbclkg0(
+   SI32_CLKCTRL_A_Type * basePointer,
+   uint32_t apbclkg0)
+{
+   //{{
+   basePointer->APBCLKG0.U32 = apbclkg0;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_write_apbclkg0(SI32_CLKCTRL_A_Type* /*basePointer*/,
    uint32_t /*apbclkg0*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_write_apbclkg0(basePointer, apbclkg0)
 #define SI32_CLKCTRL_A_write_apbclkg0(basePointer, apbclkg0) \
@@ -599,8 +987,19 @@ _SI32_CLKCTRL_A_write_apbclkg0(SI32_CLKCTRL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_CLKCTRL_A_read_apbclkg0(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   return basePointer->APBCLKG0.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_CLKCTRL_A_read_apbclkg0(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_read_apbclkg0(basePointer)
 #define SI32_CLKCTRL_A_read_apbclkg0(basePointer) \
@@ -620,9 +1019,21 @@ _SI32_CLKCTRL_A_read_apbclkg0(SI32_CLKCTRL_A_Type* /*basePointer*/);
 ///  apbclkg1
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_write_apbclkg1(
+   SI32_CLKCTRL_A_Type * basePointer,
+   uint32_t apbclkg1)
+{
+   //{{
+   basePointer->APBCLKG1.U32 = apbclkg1;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_write_apbclkg1(SI32_CLKCTRL_A_Type* /*basePointer*/,
    uint32_t /*apbclkg1*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_write_apbclkg1(basePointer, apbclkg1)
 #define SI32_CLKCTRL_A_write_apbclkg1(basePointer, apbclkg1) \
@@ -637,8 +1048,19 @@ _SI32_CLKCTRL_A_write_apbclkg1(SI32_CLKCTRL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_CLKCTRL_A_read_apbclkg1(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   return basePointer->APBCLKG1.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_CLKCTRL_A_read_apbclkg1(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_read_apbclkg1(basePointer)
 #define SI32_CLKCTRL_A_read_apbclkg1(basePointer) \
@@ -659,9 +1081,22 @@ _SI32_CLKCTRL_A_read_apbclkg1(SI32_CLKCTRL_A_Type* /*basePointer*/);
 ///  Valid range is 32 bits.
 ///  See Support.h for module mask definitions.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_enable_apb_to_modules_0(
+   SI32_CLKCTRL_A_Type * basePointer,
+   // See Support.h for module mask definitions.
+   uint32_t mask)
+{
+   //{{
+   basePointer->APBCLKG0_SET = mask;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_enable_apb_to_modules_0(SI32_CLKCTRL_A_Type* /*basePointer*/,
    uint32_t /*mask*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_enable_apb_to_modules_0(basePointer, mask)
 #define SI32_CLKCTRL_A_enable_apb_to_modules_0(basePointer, mask) \
@@ -682,9 +1117,22 @@ _SI32_CLKCTRL_A_enable_apb_to_modules_0(SI32_CLKCTRL_A_Type* /*basePointer*/,
 ///  Valid range is 32 bits.
 ///  See Support.h for module mask definitions.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_disable_apb_to_modules_0(
+   SI32_CLKCTRL_A_Type * basePointer,
+   // See Support.h for module mask definitions.
+   uint32_t mask)
+{
+   //{{
+   basePointer->APBCLKG0_CLR = mask;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_disable_apb_to_modules_0(SI32_CLKCTRL_A_Type* /*basePointer*/,
    uint32_t /*mask*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_disable_apb_to_modules_0(basePointer, mask)
 #define SI32_CLKCTRL_A_disable_apb_to_modules_0(basePointer, mask) \
@@ -705,9 +1153,22 @@ _SI32_CLKCTRL_A_disable_apb_to_modules_0(SI32_CLKCTRL_A_Type* /*basePointer*/,
 ///  Valid range is 32 bits.
 ///  See Support.h for module mask definitions.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_enable_apb_to_modules_1(
+   SI32_CLKCTRL_A_Type * basePointer,
+   // See Support.h for module mask definitions.
+   uint32_t mask)
+{
+   //{{
+   basePointer->APBCLKG1_SET = mask;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_enable_apb_to_modules_1(SI32_CLKCTRL_A_Type* /*basePointer*/,
    uint32_t /*mask*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_enable_apb_to_modules_1(basePointer, mask)
 #define SI32_CLKCTRL_A_enable_apb_to_modules_1(basePointer, mask) \
@@ -728,9 +1189,22 @@ _SI32_CLKCTRL_A_enable_apb_to_modules_1(SI32_CLKCTRL_A_Type* /*basePointer*/,
 ///  Valid range is 32 bits.
 ///  See Support.h for module mask definitions.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_disable_apb_to_modules_1(
+   SI32_CLKCTRL_A_Type * basePointer,
+   // See Support.h for module mask definitions.
+   uint32_t mask)
+{
+   //{{
+   basePointer->APBCLKG1_CLR = mask;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_disable_apb_to_modules_1(SI32_CLKCTRL_A_Type* /*basePointer*/,
    uint32_t /*mask*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_disable_apb_to_modules_1(basePointer, mask)
 #define SI32_CLKCTRL_A_disable_apb_to_modules_1(basePointer, mask) \
@@ -742,8 +1216,55 @@ _SI32_CLKCTRL_A_disable_apb_to_modules_1(SI32_CLKCTRL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_enable_apb_to_all_modules(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->APBCLKG0_SET =
+      SI32_CLKCTRL_A_APBCLKG0_PLL0CEN_ENABLED_U32
+      | SI32_CLKCTRL_A_APBCLKG0_PB0CEN_ENABLED_U32
+      | SI32_CLKCTRL_A_APBCLKG0_USART0CEN_ENABLED_U32
+      | SI32_CLKCTRL_A_APBCLKG0_USART1CEN_ENABLED_U32
+      | SI32_CLKCTRL_A_APBCLKG0_UART0CEN_ENABLED_U32
+      | SI32_CLKCTRL_A_APBCLKG0_UART1CEN_ENABLED_U32
+      | SI32_CLKCTRL_A_APBCLKG0_SPI0CEN_ENABLED_U32
+      | SI32_CLKCTRL_A_APBCLKG0_SPI1CEN_ENABLED_U32
+      | SI32_CLKCTRL_A_APBCLKG0_SPI2CEN_ENABLED_U32
+      | SI32_CLKCTRL_A_APBCLKG0_I2C0CEN_ENABLED_U32
+      | SI32_CLKCTRL_A_APBCLKG0_I2C1CEN_ENABLED_U32
+      | SI32_CLKCTRL_A_APBCLKG0_EPCA0CEN_ENABLED_U32
+      | SI32_CLKCTRL_A_APBCLKG0_PCA0CEN_ENABLED_U32
+      | SI32_CLKCTRL_A_APBCLKG0_PCA1CEN_ENABLED_U32
+      | SI32_CLKCTRL_A_APBCLKG0_SSG0CEN_ENABLED_U32
+      | SI32_CLKCTRL_A_APBCLKG0_TIMER0CEN_ENABLED_U32
+      | SI32_CLKCTRL_A_APBCLKG0_TIMER1CEN_ENABLED_U32
+      | SI32_CLKCTRL_A_APBCLKG0_ADC0CEN_ENABLED_U32
+      | SI32_CLKCTRL_A_APBCLKG0_ADC1CEN_ENABLED_U32
+      | SI32_CLKCTRL_A_APBCLKG0_CMP0CEN_ENABLED_U32
+      | SI32_CLKCTRL_A_APBCLKG0_CMP1CEN_ENABLED_U32
+      | SI32_CLKCTRL_A_APBCLKG0_CS0CEN_ENABLED_U32
+      | SI32_CLKCTRL_A_APBCLKG0_AES0CEN_ENABLED_U32
+      | SI32_CLKCTRL_A_APBCLKG0_CRC0CEN_ENABLED_U32
+      | SI32_CLKCTRL_A_APBCLKG0_IDAC0CEN_ENABLED_U32
+      | SI32_CLKCTRL_A_APBCLKG0_IDAC1CEN_ENABLED_U32
+      | SI32_CLKCTRL_A_APBCLKG0_LPT0CEN_ENABLED_U32
+      | SI32_CLKCTRL_A_APBCLKG0_I2S0CEN_ENABLED_U32
+      | SI32_CLKCTRL_A_APBCLKG0_USB0CEN_ENABLED_U32
+      | SI32_CLKCTRL_A_APBCLKG0_EVREGCEN_ENABLED_U32
+      | SI32_CLKCTRL_A_APBCLKG0_FLCTRLCEN_ENABLED_U32;
+
+   basePointer->APBCLKG1_SET =
+      SI32_CLKCTRL_A_APBCLKG1_MISC0CEN_ENABLED_U32
+      | SI32_CLKCTRL_A_APBCLKG1_MISC1CEN_ENABLED_U32
+      | SI32_CLKCTRL_A_APBCLKG1_MISC2CEN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_enable_apb_to_all_modules(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_enable_apb_to_all_modules(basePointer)
 #define SI32_CLKCTRL_A_enable_apb_to_all_modules(basePointer) do{  \
@@ -792,8 +1313,55 @@ _SI32_CLKCTRL_A_enable_apb_to_all_modules(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_disable_apb_to_all_modules(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->APBCLKG0_CLR =
+      SI32_CLKCTRL_A_APBCLKG0_PLL0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_PB0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_USART0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_USART1CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_UART0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_UART1CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_SPI0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_SPI1CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_SPI2CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_I2C0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_I2C1CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_EPCA0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_PCA0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_PCA1CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_SSG0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_TIMER0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_TIMER1CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_ADC0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_ADC1CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_CMP0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_CMP1CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_CS0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_AES0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_CRC0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_IDAC0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_IDAC1CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_LPT0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_I2S0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_USB0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_EVREGCEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG0_FLCTRLCEN_MASK;
+
+    basePointer->APBCLKG1_CLR =
+      SI32_CLKCTRL_A_APBCLKG1_MISC0CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG1_MISC1CEN_MASK
+      | SI32_CLKCTRL_A_APBCLKG1_MISC2CEN_MASK;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_disable_apb_to_all_modules(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_disable_apb_to_all_modules(basePointer)
 #define SI32_CLKCTRL_A_disable_apb_to_all_modules(basePointer) do{  \
@@ -850,9 +1418,21 @@ _SI32_CLKCTRL_A_disable_apb_to_all_modules(SI32_CLKCTRL_A_Type* /*basePointer*/)
 ///  pm3cn
 ///  Valid range is 32 bits.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_write_pm3cn(
+   SI32_CLKCTRL_A_Type * basePointer,
+   uint32_t pm3cn)
+{
+   //{{
+   basePointer->PM3CN.U32 = pm3cn;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_write_pm3cn(SI32_CLKCTRL_A_Type* /*basePointer*/,
    uint32_t /*pm3cn*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_write_pm3cn(basePointer, pm3cn)
 #define SI32_CLKCTRL_A_write_pm3cn(basePointer, pm3cn) \
@@ -867,8 +1447,19 @@ _SI32_CLKCTRL_A_write_pm3cn(SI32_CLKCTRL_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_CLKCTRL_A_read_pm3cn(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   return basePointer->PM3CN.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_CLKCTRL_A_read_pm3cn(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_read_pm3cn(basePointer)
 #define SI32_CLKCTRL_A_read_pm3cn(basePointer) \
@@ -880,8 +1471,20 @@ _SI32_CLKCTRL_A_read_pm3cn(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_enter_fast_wake_mode(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->PM3CN.PM3CEN =
+      SI32_CLKCTRL_A_PM3CN_PM3CEN_ENABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_enter_fast_wake_mode(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_enter_fast_wake_mode(basePointer)
 #define SI32_CLKCTRL_A_enter_fast_wake_mode(basePointer) do{  \
@@ -895,8 +1498,20 @@ _SI32_CLKCTRL_A_enter_fast_wake_mode(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_exit_fast_wake_mode(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->PM3CN.PM3CEN =
+      SI32_CLKCTRL_A_PM3CN_PM3CEN_DISABLED_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_exit_fast_wake_mode(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_exit_fast_wake_mode(basePointer)
 #define SI32_CLKCTRL_A_exit_fast_wake_mode(basePointer) do{  \
@@ -910,8 +1525,20 @@ _SI32_CLKCTRL_A_exit_fast_wake_mode(SI32_CLKCTRL_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_fast_wake_clock_source_low_power_oscillator(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->PM3CN.PM3CSEL =
+      SI32_CLKCTRL_A_PM3CN_PM3CSEL_LPOSC0_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_fast_wake_clock_source_low_power_oscillator(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_fast_wake_clock_source_low_power_oscillator(basePointer)
 #define SI32_CLKCTRL_A_select_fast_wake_clock_source_low_power_oscillator(basePointer) do{  \
@@ -925,8 +1552,20 @@ _SI32_CLKCTRL_A_select_fast_wake_clock_source_low_power_oscillator(SI32_CLKCTRL_
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_fast_wake_clock_source_low_frequency_oscillator(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->PM3CN.PM3CSEL =
+      SI32_CLKCTRL_A_PM3CN_PM3CSEL_LFOSC0_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_fast_wake_clock_source_low_frequency_oscillator(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_fast_wake_clock_source_low_frequency_oscillator(basePointer)
 #define SI32_CLKCTRL_A_select_fast_wake_clock_source_low_frequency_oscillator(basePointer) do{  \
@@ -940,8 +1579,20 @@ _SI32_CLKCTRL_A_select_fast_wake_clock_source_low_frequency_oscillator(SI32_CLKC
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_fast_wake_clock_source_rtc_oscillator(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->PM3CN.PM3CSEL =
+      SI32_CLKCTRL_A_PM3CN_PM3CSEL_RTC0OSC_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_fast_wake_clock_source_rtc_oscillator(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_fast_wake_clock_source_rtc_oscillator(basePointer)
 #define SI32_CLKCTRL_A_select_fast_wake_clock_source_rtc_oscillator(basePointer) do{  \
@@ -955,8 +1606,20 @@ _SI32_CLKCTRL_A_select_fast_wake_clock_source_rtc_oscillator(SI32_CLKCTRL_A_Type
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_fast_wake_clock_source_external_oscillator(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->PM3CN.PM3CSEL =
+      SI32_CLKCTRL_A_PM3CN_PM3CSEL_EXTOSC0_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_fast_wake_clock_source_external_oscillator(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_fast_wake_clock_source_external_oscillator(basePointer)
 #define SI32_CLKCTRL_A_select_fast_wake_clock_source_external_oscillator(basePointer) do{  \
@@ -970,8 +1633,20 @@ _SI32_CLKCTRL_A_select_fast_wake_clock_source_external_oscillator(SI32_CLKCTRL_A
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_fast_wake_clock_source_usb_oscillator(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->PM3CN.PM3CSEL =
+      SI32_CLKCTRL_A_PM3CN_PM3CSEL_USB0OSC_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_fast_wake_clock_source_usb_oscillator(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_fast_wake_clock_source_usb_oscillator(basePointer)
 #define SI32_CLKCTRL_A_select_fast_wake_clock_source_usb_oscillator(basePointer) do{  \
@@ -985,8 +1660,20 @@ _SI32_CLKCTRL_A_select_fast_wake_clock_source_usb_oscillator(SI32_CLKCTRL_A_Type
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_fast_wake_clock_source_pll(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->PM3CN.PM3CSEL =
+      SI32_CLKCTRL_A_PM3CN_PM3CSEL_PLL0OSC_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_fast_wake_clock_source_pll(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_fast_wake_clock_source_pll(basePointer)
 #define SI32_CLKCTRL_A_select_fast_wake_clock_source_pll(basePointer) do{  \
@@ -1000,8 +1687,20 @@ _SI32_CLKCTRL_A_select_fast_wake_clock_source_pll(SI32_CLKCTRL_A_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_CLKCTRL_A_select_fast_wake_clock_source_divided_low_power_oscillator(
+   SI32_CLKCTRL_A_Type * basePointer)
+{
+   //{{
+   basePointer->PM3CN.PM3CSEL =
+      SI32_CLKCTRL_A_PM3CN_PM3CSEL_LPOSC0_DIV_VALUE;
+   //}}
+}
+#else
 void
 _SI32_CLKCTRL_A_select_fast_wake_clock_source_divided_low_power_oscillator(SI32_CLKCTRL_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_CLKCTRL_A_select_fast_wake_clock_source_divided_low_power_oscillator(basePointer)
 #define SI32_CLKCTRL_A_select_fast_wake_clock_source_divided_low_power_oscillator(basePointer) do{  \
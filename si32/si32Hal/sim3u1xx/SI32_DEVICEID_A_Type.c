@@ -27,6 +27,9 @@
 // HAL Source: 0.4
 // Version: 2
 
+// Build the out-of-line accessors even when SI32_HAL_INLINE is defined.
+#define SI32_HAL_OUT_OF_LINE
+
 #include <assert.h>
 #include "si32WideTypes.h"
 #include "SI32_DEVICEID_A_Type.h"
@@ -56,9 +56,22 @@ extern "C" {
 ///  Valid range is 32 bits.
 ///  Write to RESETEN register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RSTSRC_A_initialize(
+   SI32_RSTSRC_A_Type * basePointer,
+   // Write to RESETEN register.
+   uint32_t reseten)
+{
+   //{{
+   basePointer->RESETEN.U32 = reseten;
+   //}}
+}
+#else
 void
 _SI32_RSTSRC_A_initialize(SI32_RSTSRC_A_Type* /*basePointer*/,
    uint32_t /*reseten*/);
+#endif
 ///
 /// @def SI32_RSTSRC_A_initialize(basePointer, reseten)
 #define SI32_RSTSRC_A_initialize(basePointer, reseten) \
@@ -76,9 +89,22 @@ _SI32_RSTSRC_A_initialize(SI32_RSTSRC_A_Type* /*basePointer*/,
 ///  Valid range is 32 bits.
 ///  Write to RESETEN register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RSTSRC_A_write_reseten(
+   SI32_RSTSRC_A_Type * basePointer,
+   // Write to RESETEN register.
+   uint32_t reseten)
+{
+   //{{
+   basePointer->RESETEN.U32 = reseten;
+   //}}
+}
+#else
 void
 _SI32_RSTSRC_A_write_reseten(SI32_RSTSRC_A_Type* /*basePointer*/,
    uint32_t /*reseten*/);
+#endif
 ///
 /// @def SI32_RSTSRC_A_write_reseten(basePointer, reseten)
 #define SI32_RSTSRC_A_write_reseten(basePointer, reseten) \
@@ -93,8 +119,19 @@ _SI32_RSTSRC_A_write_reseten(SI32_RSTSRC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_RSTSRC_A_read_reseten(
+   SI32_RSTSRC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->RESETEN.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_RSTSRC_A_read_reseten(SI32_RSTSRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RSTSRC_A_read_reseten(basePointer)
 #define SI32_RSTSRC_A_read_reseten(basePointer) \
@@ -106,8 +143,19 @@ _SI32_RSTSRC_A_read_reseten(SI32_RSTSRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RSTSRC_A_enable_vdd_monitor_reset_source(
+   SI32_RSTSRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->RESETEN_SET = SI32_RSTSRC_A_RESETEN_VMONREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_RSTSRC_A_enable_vdd_monitor_reset_source(SI32_RSTSRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RSTSRC_A_enable_vdd_monitor_reset_source(basePointer)
 #define SI32_RSTSRC_A_enable_vdd_monitor_reset_source(basePointer) \
@@ -119,8 +167,19 @@ _SI32_RSTSRC_A_enable_vdd_monitor_reset_source(SI32_RSTSRC_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RSTSRC_A_disable_vdd_monitor_reset_source(
+   SI32_RSTSRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->RESETEN_CLR = SI32_RSTSRC_A_RESETEN_VMONREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_RSTSRC_A_disable_vdd_monitor_reset_source(SI32_RSTSRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RSTSRC_A_disable_vdd_monitor_reset_source(basePointer)
 #define SI32_RSTSRC_A_disable_vdd_monitor_reset_source(basePointer) \
@@ -132,8 +191,19 @@ _SI32_RSTSRC_A_disable_vdd_monitor_reset_source(SI32_RSTSRC_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RSTSRC_A_enable_missing_clock_detector_reset_source(
+   SI32_RSTSRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->RESETEN_SET  = SI32_RSTSRC_A_RESETEN_MCDREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_RSTSRC_A_enable_missing_clock_detector_reset_source(SI32_RSTSRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RSTSRC_A_enable_missing_clock_detector_reset_source(basePointer)
 #define SI32_RSTSRC_A_enable_missing_clock_detector_reset_source(basePointer) \
@@ -145,8 +215,19 @@ _SI32_RSTSRC_A_enable_missing_clock_detector_reset_source(SI32_RSTSRC_A_Type* /*
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RSTSRC_A_disable_missing_clock_detector_reset_source(
+   SI32_RSTSRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->RESETEN_CLR = SI32_RSTSRC_A_RESETEN_MCDREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_RSTSRC_A_disable_missing_clock_detector_reset_source(SI32_RSTSRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RSTSRC_A_disable_missing_clock_detector_reset_source(basePointer)
 #define SI32_RSTSRC_A_disable_missing_clock_detector_reset_source(basePointer) \
@@ -158,8 +239,19 @@ _SI32_RSTSRC_A_disable_missing_clock_detector_reset_source(SI32_RSTSRC_A_Type* /
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RSTSRC_A_enable_watchdog_timer_reset_source(
+   SI32_RSTSRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->RESETEN_SET = SI32_RSTSRC_A_RESETEN_WDTREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_RSTSRC_A_enable_watchdog_timer_reset_source(SI32_RSTSRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RSTSRC_A_enable_watchdog_timer_reset_source(basePointer)
 #define SI32_RSTSRC_A_enable_watchdog_timer_reset_source(basePointer) \
@@ -171,8 +263,19 @@ _SI32_RSTSRC_A_enable_watchdog_timer_reset_source(SI32_RSTSRC_A_Type* /*basePoin
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RSTSRC_A_disable_watchdog_timer_reset_source(
+   SI32_RSTSRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->RESETEN_CLR = SI32_RSTSRC_A_RESETEN_WDTREN_MASK;
+   //}}
+}
+#else
 void
 _SI32_RSTSRC_A_disable_watchdog_timer_reset_source(SI32_RSTSRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RSTSRC_A_disable_watchdog_timer_reset_source(basePointer)
 #define SI32_RSTSRC_A_disable_watchdog_timer_reset_source(basePointer) \
@@ -184,8 +287,19 @@ _SI32_RSTSRC_A_disable_watchdog_timer_reset_source(SI32_RSTSRC_A_Type* /*basePoi
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RSTSRC_A_enable_comparator0_reset_source(
+   SI32_RSTSRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->RESETEN_SET = SI32_RSTSRC_A_RESETEN_CMP0REN_MASK;
+   //}}
+}
+#else
 void
 _SI32_RSTSRC_A_enable_comparator0_reset_source(SI32_RSTSRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RSTSRC_A_enable_comparator0_reset_source(basePointer)
 #define SI32_RSTSRC_A_enable_comparator0_reset_source(basePointer) \
@@ -197,8 +311,19 @@ _SI32_RSTSRC_A_enable_comparator0_reset_source(SI32_RSTSRC_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RSTSRC_A_disable_comparator0_reset_source(
+   SI32_RSTSRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->RESETEN_CLR = SI32_RSTSRC_A_RESETEN_CMP0REN_MASK;
+   //}}
+}
+#else
 void
 _SI32_RSTSRC_A_disable_comparator0_reset_source(SI32_RSTSRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RSTSRC_A_disable_comparator0_reset_source(basePointer)
 #define SI32_RSTSRC_A_disable_comparator0_reset_source(basePointer) \
@@ -210,8 +335,19 @@ _SI32_RSTSRC_A_disable_comparator0_reset_source(SI32_RSTSRC_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RSTSRC_A_enable_comparator1_reset_source(
+   SI32_RSTSRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->RESETEN_SET = SI32_RSTSRC_A_RESETEN_CMP1REN_MASK;
+   //}}
+}
+#else
 void
 _SI32_RSTSRC_A_enable_comparator1_reset_source(SI32_RSTSRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RSTSRC_A_enable_comparator1_reset_source(basePointer)
 #define SI32_RSTSRC_A_enable_comparator1_reset_source(basePointer) \
@@ -223,8 +359,19 @@ _SI32_RSTSRC_A_enable_comparator1_reset_source(SI32_RSTSRC_A_Type* /*basePointer
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RSTSRC_A_disable_comparator1_reset_source(
+   SI32_RSTSRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->RESETEN_CLR = SI32_RSTSRC_A_RESETEN_CMP1REN_MASK;
+   //}}
+}
+#else
 void
 _SI32_RSTSRC_A_disable_comparator1_reset_source(SI32_RSTSRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RSTSRC_A_disable_comparator1_reset_source(basePointer)
 #define SI32_RSTSRC_A_disable_comparator1_reset_source(basePointer) \
@@ -236,8 +383,19 @@ _SI32_RSTSRC_A_disable_comparator1_reset_source(SI32_RSTSRC_A_Type* /*basePointe
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RSTSRC_A_enable_usb0_reset_source(
+   SI32_RSTSRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->RESETEN_SET = SI32_RSTSRC_A_RESETEN_USB0REN_MASK;
+   //}}
+}
+#else
 void
 _SI32_RSTSRC_A_enable_usb0_reset_source(SI32_RSTSRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RSTSRC_A_enable_usb0_reset_source(basePointer)
 #define SI32_RSTSRC_A_enable_usb0_reset_source(basePointer) \
@@ -249,8 +407,19 @@ _SI32_RSTSRC_A_enable_usb0_reset_source(SI32_RSTSRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RSTSRC_A_disable_usb0_reset_source(
+   SI32_RSTSRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->RESETEN_CLR = SI32_RSTSRC_A_RESETEN_USB0REN_MASK;
+   //}}
+}
+#else
 void
 _SI32_RSTSRC_A_disable_usb0_reset_source(SI32_RSTSRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RSTSRC_A_disable_usb0_reset_source(basePointer)
 #define SI32_RSTSRC_A_disable_usb0_reset_source(basePointer) \
@@ -262,8 +431,19 @@ _SI32_RSTSRC_A_disable_usb0_reset_source(SI32_RSTSRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RSTSRC_A_enable_rtc0_reset_source(
+   SI32_RSTSRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->RESETEN_SET = SI32_RSTSRC_A_RESETEN_RTC0REN_MASK;
+   //}}
+}
+#else
 void
 _SI32_RSTSRC_A_enable_rtc0_reset_source(SI32_RSTSRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RSTSRC_A_enable_rtc0_reset_source(basePointer)
 #define SI32_RSTSRC_A_enable_rtc0_reset_source(basePointer) \
@@ -275,8 +455,19 @@ _SI32_RSTSRC_A_enable_rtc0_reset_source(SI32_RSTSRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RSTSRC_A_disable_rtc0_reset_source(
+   SI32_RSTSRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->RESETEN_CLR = SI32_RSTSRC_A_RESETEN_RTC0REN_MASK;
+   //}}
+}
+#else
 void
 _SI32_RSTSRC_A_disable_rtc0_reset_source(SI32_RSTSRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RSTSRC_A_disable_rtc0_reset_source(basePointer)
 #define SI32_RSTSRC_A_disable_rtc0_reset_source(basePointer) \
@@ -288,8 +479,19 @@ _SI32_RSTSRC_A_disable_rtc0_reset_source(SI32_RSTSRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RSTSRC_A_generate_software_reset(
+   SI32_RSTSRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->RESETEN_SET = SI32_RSTSRC_A_RESETEN_SWREN_ENABLED_U32;
+   //}}
+}
+#else
 void
 _SI32_RSTSRC_A_generate_software_reset(SI32_RSTSRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RSTSRC_A_generate_software_reset(basePointer)
 #define SI32_RSTSRC_A_generate_software_reset(basePointer) \
@@ -304,8 +506,105 @@ _SI32_RSTSRC_A_generate_software_reset(SI32_RSTSRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline SI32_RSTSRC_Enum_Type
+_SI32_RSTSRC_A_get_last_reset_source(
+   SI32_RSTSRC_A_Type * basePointer)
+{
+   //{{
+   SI32_RSTSRC_Enum_Type last_reset_source;
+
+   // First Check for a POR
+   // If this bit is set, all other flags are indeterminate
+   if (basePointer->RESETFLAG.PORRF ==
+       SI32_RSTSRC_A_RESETFLAG_PORRF_SET_VALUE)
+   {
+      last_reset_source = SI32_POWER_ON_RESET;
+   }
+   // Now check VMON
+   // If this bit is set, all other flags are indeterminate
+   else if (basePointer->RESETFLAG.VMONRF ==
+            SI32_RSTSRC_A_RESETFLAG_VMONRF_SET_VALUE)
+   {
+      last_reset_source = SI32_VDD_MON_RESET;
+   }
+   // If last reset was caused by neither WAKEUP nor VDD Monitor, check the
+   // rest of the flags.
+   else
+   {
+      // PMU Wake
+      if (basePointer->RESETFLAG.WAKERF ==
+          SI32_RSTSRC_A_RESETFLAG_WAKERF_SET_VALUE)
+      {
+         last_reset_source = SI32_PMU_WAKEUP_RESET;
+      }
+      // Pin
+      else if (basePointer->RESETFLAG.PINRF ==
+               SI32_RSTSRC_A_RESETFLAG_PINRF_SET_VALUE)
+      {
+         last_reset_source = SI32_PIN_RESET;
+      }
+      // Core
+      else if (basePointer->RESETFLAG.CORERF ==
+               SI32_RSTSRC_A_RESETFLAG_CORERF_SET_VALUE)
+      {
+         last_reset_source = SI32_CORE_RESET;
+      }
+      // Missing Clock Detector
+      else if (basePointer->RESETFLAG.MCDRF ==
+               SI32_RSTSRC_A_RESETFLAG_MCDRF_SET_VALUE)
+      {
+         last_reset_source = SI32_MCD_RESET;
+      }
+      // Watchdog Timer
+      else if (basePointer->RESETFLAG.WDTRF ==
+               SI32_RSTSRC_A_RESETFLAG_WDTRF_SET_VALUE)
+      {
+         last_reset_source = SI32_WDT_RESET;
+      }
+      // Software Reset
+      else if (basePointer->RESETFLAG.SWRF ==
+               SI32_RSTSRC_A_RESETFLAG_SWRF_SET_VALUE)
+      {
+         last_reset_source = SI32_SW_RESET;
+      }
+      // Comparator 0
+      else if (basePointer->RESETFLAG.CMP0RF ==
+               SI32_RSTSRC_A_RESETFLAG_CMP0RF_SET_VALUE)
+      {
+         last_reset_source = SI32_CMP0_RESET;
+      }
+      // Comparator 1
+      else if (basePointer->RESETFLAG.CMP1RF ==
+               SI32_RSTSRC_A_RESETFLAG_CMP1RF_SET_VALUE)
+      {
+         last_reset_source = SI32_CMP1_RESET;
+      }
+      // USB0
+      else if (basePointer->RESETFLAG.USB0RF ==
+               SI32_RSTSRC_A_RESETFLAG_USB0RF_SET_VALUE)
+      {
+         last_reset_source = SI32_USB0_RESET;
+      }
+      // RTC0
+      else if (basePointer->RESETFLAG.RTC0RF ==
+               SI32_RSTSRC_A_RESETFLAG_RTC0RF_SET_VALUE)
+      {
+         last_reset_source = SI32_RTC0_RESET;
+      }
+      else
+      {
+         last_reset_source = SI32_RESET_ERROR;
+      }
+   }
+
+   return last_reset_source;
+   //}}
+}
+#else
 SI32_RSTSRC_Enum_Type
 _SI32_RSTSRC_A_get_last_reset_source(SI32_RSTSRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RSTSRC_A_get_last_reset_source(basePointer)
 #define SI32_RSTSRC_A_get_last_reset_source(basePointer) \
@@ -323,9 +622,22 @@ _SI32_RSTSRC_A_get_last_reset_source(SI32_RSTSRC_A_Type* /*basePointer*/);
 ///  Valid range is 32 bits.
 ///  Write to CONFIG register.
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RSTSRC_A_write_config(
+   SI32_RSTSRC_A_Type * basePointer,
+   // Write to CONFIG register.
+   uint32_t config)
+{
+   //{{
+   basePointer->CONFIG.U32 = config;
+   //}}
+}
+#else
 void
 _SI32_RSTSRC_A_write_config(SI32_RSTSRC_A_Type* /*basePointer*/,
    uint32_t /*config*/);
+#endif
 ///
 /// @def SI32_RSTSRC_A_write_config(basePointer, config)
 #define SI32_RSTSRC_A_write_config(basePointer, config) \
@@ -340,8 +652,19 @@ _SI32_RSTSRC_A_write_config(SI32_RSTSRC_A_Type* /*basePointer*/,
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline uint32_t
+_SI32_RSTSRC_A_read_config(
+   SI32_RSTSRC_A_Type * basePointer)
+{
+   //{{
+   return basePointer->CONFIG.U32;
+   //}}
+}
+#else
 uint32_t
 _SI32_RSTSRC_A_read_config(SI32_RSTSRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RSTSRC_A_read_config(basePointer)
 #define SI32_RSTSRC_A_read_config(basePointer) \
@@ -353,8 +676,19 @@ _SI32_RSTSRC_A_read_config(SI32_RSTSRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RSTSRC_A_enable_power_mode_9(
+   SI32_RSTSRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_SET = SI32_RSTSRC_A_CONFIG_PMSEL_PM9_EN_U32;
+   //}}
+}
+#else
 void
 _SI32_RSTSRC_A_enable_power_mode_9(SI32_RSTSRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RSTSRC_A_enable_power_mode_9(basePointer)
 #define SI32_RSTSRC_A_enable_power_mode_9(basePointer) \
@@ -366,8 +700,19 @@ _SI32_RSTSRC_A_enable_power_mode_9(SI32_RSTSRC_A_Type* /*basePointer*/);
 /// @param[in]
 ///  basePointer
 ///
+#if defined(SI32_HAL_INLINE) && !defined(SI32_HAL_OUT_OF_LINE)
+static inline void
+_SI32_RSTSRC_A_disable_power_mode_9(
+   SI32_RSTSRC_A_Type * basePointer)
+{
+   //{{
+   basePointer->CONFIG_CLR = SI32_RSTSRC_A_CONFIG_PMSEL_MASK;
+   //}}
+}
+#else
 void
 _SI32_RSTSRC_A_disable_power_mode_9(SI32_RSTSRC_A_Type* /*basePointer*/);
+#endif
 ///
 /// @def SI32_RSTSRC_A_disable_power_mode_9(basePointer)
 #define SI32_RSTSRC_A_disable_power_mode_9(basePointer) \
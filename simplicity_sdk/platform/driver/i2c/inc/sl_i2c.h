@@ -38,6 +38,7 @@ extern "C" {
 #include "sl_device_peripheral.h"
 #include "sl_device_i2c.h"
 #include "sl_device_gpio.h"
+#include "sl_slist.h"
 
 #if defined(SL_COMPONENT_CATALOG_PRESENT)
 #include "sl_component_catalog.h"
@@ -142,6 +143,27 @@ typedef void *sl_i2c_handle_t;  /// i2c instance handle
  ******************************************************************************/
 typedef sl_status_t (*sl_i2c_irq_callback_t)(sl_i2c_event_t transfer_event, void *context);
 
+/***************************************************************************//**
+ * I2C queued transaction descriptor.
+ *
+ * A descriptor is owned by the driver from sl_i2c_queue_transaction() until its
+ * callback is called or it is removed with sl_i2c_cancel_transaction(). The
+ * buffers must stay valid for the same time.
+ ******************************************************************************/
+typedef struct {
+  sl_slist_node_t node;                 /// Queue link, used by the driver.
+  uint16_t follower_address;            /// 7-bit or 10-bit follower address.
+  sl_i2c_transfer_seq_t transfer_seq;   /// SL_I2C_WRITE, SL_I2C_READ or SL_I2C_WRITE_READ.
+  const uint8_t *tx_buffer;             /// Transmit data buffer (write and write-read).
+  uint16_t tx_len;                      /// Transmit data length.
+  uint8_t *rx_buffer;                   /// Receive data buffer (read and write-read).
+  uint16_t rx_len;                      /// Receive data length.
+  uint8_t priority;                     /// Higher values run first, equal values run in submission order.
+  sl_i2c_irq_callback_t callback;       /// Called from interrupt context on completion, may be NULL.
+  void *context;                        /// User-defined context for the callback.
+  sl_i2c_event_t transfer_event;        /// Result of the transaction, set before the callback.
+} sl_i2c_transaction_t;
+
 /***************************************************************************//**
  * This function initializes the I2C Module.
  *
@@ -301,6 +323,45 @@ sl_status_t sl_i2c_receive_non_blocking(sl_i2c_handle_t i2c_handle,
                                         sl_i2c_irq_callback_t i2c_callback,
                                         void *context);
 
+/***************************************************************************//**
+ * Queue a transaction on a Leader mode I2C instance.
+ *
+ * Queued transactions run back-to-back from interrupt context using DMA, in
+ * priority order, each to its own follower address. A write-read transaction
+ * uses a repeated start between the write and the read phase. The transaction
+ * starts immediately if the queue is idle.
+ *
+ * @note  The queue must not be mixed with the other transfer APIs on the same
+ *        instance. sl_i2c_send_blocking(), sl_i2c_receive_blocking(),
+ *        sl_i2c_transfer(), sl_i2c_send_non_blocking(),
+ *        sl_i2c_receive_non_blocking(), sl_i2c_set_follower_address() and
+ *        sl_i2c_deinit() return SL_STATUS_BUSY while queued transactions are
+ *        pending.
+ *
+ * @param[in] i2c_handle         I2C Instance handle.
+ * @param[in] transaction        A pointer to the transaction descriptor.
+ *
+ * @return  SL_STATUS_OK if the transaction was queued,
+ *          SL_STATUS_INVALID_PARAMETER if the descriptor is not valid or the
+ *          instance is not in Leader mode,
+ *          SL_STATUS_BUSY if the descriptor is already queued.
+ ******************************************************************************/
+sl_status_t sl_i2c_queue_transaction(sl_i2c_handle_t i2c_handle,
+                                     sl_i2c_transaction_t *transaction);
+
+/***************************************************************************//**
+ * Remove a transaction from the queue before it starts.
+ *
+ * @param[in] i2c_handle         I2C Instance handle.
+ * @param[in] transaction        A pointer to the transaction descriptor.
+ *
+ * @return  SL_STATUS_OK if the transaction was removed, its callback is not called,
+ *          SL_STATUS_BUSY if the transaction is already on the bus,
+ *          SL_STATUS_NOT_FOUND if the transaction is not queued.
+ ******************************************************************************/
+sl_status_t sl_i2c_cancel_transaction(sl_i2c_handle_t i2c_handle,
+                                      sl_i2c_transaction_t *transaction);
+
 /** @} (end addtogroup i2c driver) */
 #ifdef __cplusplus
 }
@@ -94,6 +94,8 @@ static sl_status_t i2c_follower_mode_blocking_state_machine(sli_i2c_instance_t *
 static void i2c_leader_mode_non_blocking_dispatch_interrupt(sli_i2c_instance_t *sl_i2c_instance);
 static void i2c_follower_mode_non_blocking_dispatch_interrupt(sli_i2c_instance_t *sl_i2c_instance);
 static void i2c_common_irq_handler(sli_i2c_instance_t *sl_i2c_instance);
+static void i2c_queue_start(sli_i2c_instance_t *sl_i2c_instance, sl_i2c_transaction_t *transaction);
+static void i2c_queue_complete(sli_i2c_instance_t *sl_i2c_instance);
 
 /*******************************************************************************
  *****************************   GLOBAL VARIABLES   ****************************
@@ -228,6 +230,12 @@ sl_status_t sl_i2c_deinit(sl_i2c_handle_t i2c_handle)
   sli_i2c_instance_t *sl_i2c_instance = (sli_i2c_instance_t *)i2c_handle;
   I2C_TypeDef *i2c_base_addr = sl_i2c_instance->i2c_base_addr;
 
+  // Queued transactions still reference the instance
+  if (sl_i2c_instance->queue.active != NULL) {
+    CORE_EXIT_ATOMIC();
+    return SL_STATUS_BUSY;
+  }
+
   // Get peripheral information
   i2c_get_peripheral_instance(i2c_base_addr, &i2c_peripheral);
 
@@ -373,6 +381,12 @@ sl_status_t sl_i2c_set_follower_address(sl_i2c_handle_t i2c_handle,
   // Get the I2C instance from the handle
   sli_i2c_instance_t *sl_i2c_instance = (sli_i2c_instance_t *)i2c_handle;
 
+  // Queued transactions restore their own follower address when done
+  if (sl_i2c_instance->queue.active != NULL) {
+    CORE_EXIT_ATOMIC();
+    return SL_STATUS_BUSY;
+  }
+
   // Validate and determine the address type (7-bit or 10-bit)
   if (follower_address <= 0x7F) {
     sl_i2c_instance->is_10bit_addr = false;
@@ -467,6 +481,12 @@ sl_status_t sl_i2c_send_blocking(sl_i2c_handle_t i2c_handle,
     return SL_STATUS_INVALID_PARAMETER;
   }
 
+  // The bus belongs to the transaction queue until it drains
+  if (sl_i2c_instance->queue.active != NULL) {
+    CORE_EXIT_ATOMIC();
+    return SL_STATUS_BUSY;
+  }
+
   // Initialize transaction parameters
   sl_i2c_instance->tx_buffer = tx_buffer;
   sl_i2c_instance->tx_len = tx_len;
@@ -523,6 +543,12 @@ sl_status_t sl_i2c_receive_blocking(sl_i2c_handle_t i2c_handle,
     return SL_STATUS_INVALID_PARAMETER;
   }
 
+  // The bus belongs to the transaction queue until it drains
+  if (sl_i2c_instance->queue.active != NULL) {
+    CORE_EXIT_ATOMIC();
+    return SL_STATUS_BUSY;
+  }
+
   // Initialize the I2C instance for receiving data
   sl_i2c_instance->rx_buffer = rx_buffer;
   sl_i2c_instance->rx_len = rx_len;
@@ -580,6 +606,12 @@ sl_status_t sl_i2c_transfer(sl_i2c_handle_t i2c_handle,
     return SL_STATUS_INVALID_PARAMETER;
   }
 
+  // The bus belongs to the transaction queue until it drains
+  if (sl_i2c_instance->queue.active != NULL) {
+    CORE_EXIT_ATOMIC();
+    return SL_STATUS_BUSY;
+  }
+
   // Set up I2C instance for the transfer operation
   sl_i2c_instance->tx_buffer = tx_buffer;
   sl_i2c_instance->tx_len = tx_len;
@@ -634,6 +666,12 @@ sl_status_t sl_i2c_send_non_blocking(sl_i2c_handle_t i2c_handle,
     return SL_STATUS_INVALID_PARAMETER;
   }
 
+  // The bus belongs to the transaction queue until it drains
+  if (sl_i2c_instance->queue.active != NULL) {
+    CORE_EXIT_ATOMIC();
+    return SL_STATUS_BUSY;
+  }
+
   // Initialize the I2C instance structure
   sl_i2c_instance->tx_buffer = tx_buffer;
   sl_i2c_instance->tx_len = tx_len;
@@ -691,6 +729,12 @@ sl_status_t sl_i2c_receive_non_blocking(sl_i2c_handle_t i2c_handle,
     return SL_STATUS_INVALID_PARAMETER;
   }
 
+  // The bus belongs to the transaction queue until it drains
+  if (sl_i2c_instance->queue.active != NULL) {
+    CORE_EXIT_ATOMIC();
+    return SL_STATUS_BUSY;
+  }
+
   // Fill the internal instance structure for the non-blocking receive
   sl_i2c_instance->rx_buffer = rx_buffer;
   sl_i2c_instance->rx_len = rx_len;
@@ -715,6 +759,74 @@ sl_status_t sl_i2c_receive_non_blocking(sl_i2c_handle_t i2c_handle,
   return SL_STATUS_OK;
 }
 
+/***************************************************************************//**
+ * This function queues a transaction on a Leader mode I2C instance.
+ * Queued transactions run back-to-back from the I2C interrupt.
+ ******************************************************************************/
+sl_status_t sl_i2c_queue_transaction(sl_i2c_handle_t i2c_handle,
+                                     sl_i2c_transaction_t *transaction)
+{
+  CORE_DECLARE_IRQ_STATE;
+  sl_i2c_transaction_t *start = NULL;
+  sl_status_t status;
+
+  // Null pointer validation
+  if (i2c_handle == NULL || transaction == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+  // Descriptor validation
+  status = sli_i2c_queue_validate(transaction);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  CORE_ENTER_ATOMIC();
+
+  // Get the I2C instance from the handle
+  sli_i2c_instance_t *sl_i2c_instance = (sli_i2c_instance_t *)i2c_handle;
+
+  // Ensure the operating mode is in Leader mode
+  if (sl_i2c_instance->operating_mode != SL_I2C_LEADER_MODE) {
+    CORE_EXIT_ATOMIC();
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  status = sli_i2c_queue_submit(&sl_i2c_instance->queue, transaction, &start);
+  if (start != NULL) {
+    // Keep the instance follower address for when the queue drains
+    sl_i2c_instance->queue_follower_address = sl_i2c_instance->follower_address;
+    sl_i2c_instance->queue_is_10bit_addr = sl_i2c_instance->is_10bit_addr;
+    i2c_queue_start(sl_i2c_instance, start);
+  }
+
+  CORE_EXIT_ATOMIC();
+  return status;
+}
+
+/***************************************************************************//**
+ * This function removes a transaction from the queue before it starts.
+ ******************************************************************************/
+sl_status_t sl_i2c_cancel_transaction(sl_i2c_handle_t i2c_handle,
+                                      sl_i2c_transaction_t *transaction)
+{
+  CORE_DECLARE_IRQ_STATE;
+  sl_status_t status;
+
+  // Null pointer validation
+  if (i2c_handle == NULL || transaction == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  CORE_ENTER_ATOMIC();
+
+  // Get the I2C instance from the handle
+  sli_i2c_instance_t *sl_i2c_instance = (sli_i2c_instance_t *)i2c_handle;
+  status = sli_i2c_queue_cancel(&sl_i2c_instance->queue, transaction);
+
+  CORE_EXIT_ATOMIC();
+  return status;
+}
+
 /*******************************************************************************
  **************************   INTERNAL FUNCTIONS   *****************************
  ******************************************************************************/
@@ -879,7 +991,7 @@ sl_status_t sli_i2c_dma_transfer_init(sli_i2c_instance_t *i2c_instance)
   if (i2c_instance->transfer_seq == SL_I2C_WRITE) {
     data_buffer = i2c_instance->tx_buffer;
     data_len = i2c_instance->tx_len;
-  } else {  // SL_I2C_READ
+  } else {  // SL_I2C_READ or SL_I2C_WRITE_READ, the write phase is fed from the interrupt
     data_buffer = i2c_instance->rx_buffer;
     data_len = i2c_instance->rx_len;
   }
@@ -940,7 +1052,7 @@ sl_status_t sli_i2c_dma_transfer_init(sli_i2c_instance_t *i2c_instance)
     if (is_10bit_addr) {
       addr_buffer[0] = ((((follower_address << 1) >> 8) & 0x06) | (SL_I2C_FIRST_BYTE_10BIT_ADDR_MASK));
       addr_buffer[1] = ((follower_address << 1) & 0xFF);
-      if (i2c_instance->transfer_seq == SL_I2C_READ) {
+      if (i2c_instance->transfer_seq != SL_I2C_WRITE) {
         addr_buffer[2] = addr_buffer[0] | 1;
       }
       addr_buffer_count = 2;
@@ -948,6 +1060,9 @@ sl_status_t sli_i2c_dma_transfer_init(sli_i2c_instance_t *i2c_instance)
       addr_buffer[0] = ((follower_address << 1) & SL_I2C_7BIT_FOLLOWER_ADDRESS_MASK);
       if (i2c_instance->transfer_seq == SL_I2C_READ) {
         addr_buffer[0] |= 1;
+      } else if (i2c_instance->transfer_seq == SL_I2C_WRITE_READ) {
+        // Read address sent after the repeated start
+        addr_buffer[1] = addr_buffer[0] | 1;
       }
       addr_buffer_count = 1;
     }
@@ -957,7 +1072,7 @@ sl_status_t sli_i2c_dma_transfer_init(sli_i2c_instance_t *i2c_instance)
       (i2c_base_addr)->CTRL_SET = I2C_CTRL_AUTOSE;
       i2c_instance->tx_desc[0] = (LDMA_Descriptor_t)LDMA_DESCRIPTOR_LINKREL_M2P_BYTE((void*)(addr_buffer), &((i2c_base_addr)->TXDATA), addr_buffer_count, 1);
       i2c_instance->tx_desc[1] = (LDMA_Descriptor_t)LDMA_DESCRIPTOR_SINGLE_M2P_BYTE((void*)data_buffer, &((i2c_base_addr)->TXDATA), data_len);
-    } else if (i2c_instance->transfer_seq == SL_I2C_READ) {
+    } else {  // SL_I2C_READ or SL_I2C_WRITE_READ
       (i2c_base_addr)->CTRL_SET = I2C_CTRL_AUTOACK;
       i2c_instance->tx_desc[0] = (LDMA_Descriptor_t)LDMA_DESCRIPTOR_SINGLE_M2P_BYTE((void*)(addr_buffer), &((i2c_base_addr)->TXDATA), addr_buffer_count);
       // For 10 bit and 7 bit, receive operations are similar
@@ -977,7 +1092,7 @@ sl_status_t sli_i2c_dma_transfer_init(sli_i2c_instance_t *i2c_instance)
       (i2c_base_addr)->CTRL_SET = I2C_CTRL_AUTOSE;
       i2c_instance->tx_desc[0] = (sl_hal_ldma_descriptor_t)SL_HAL_LDMA_DESCRIPTOR_LINKREL_M2P(SL_HAL_LDMA_CTRL_SIZE_BYTE, (void*)(addr_buffer), &(i2c_base_addr)->TXDATA, addr_buffer_count, 1);
       i2c_instance->tx_desc[1] = (sl_hal_ldma_descriptor_t)SL_HAL_LDMA_DESCRIPTOR_SINGLE_M2P(SL_HAL_LDMA_CTRL_SIZE_BYTE, (void*)data_buffer, &((i2c_base_addr)->TXDATA), data_len);
-    } else if (i2c_instance->transfer_seq == SL_I2C_READ) {
+    } else {  // SL_I2C_READ or SL_I2C_WRITE_READ
       (i2c_base_addr)->CTRL_SET = I2C_CTRL_AUTOACK;
       i2c_instance->tx_desc[0] = (sl_hal_ldma_descriptor_t)SL_HAL_LDMA_DESCRIPTOR_SINGLE_M2P(SL_HAL_LDMA_CTRL_SIZE_BYTE, (void*)(addr_buffer), &((i2c_base_addr)->TXDATA), addr_buffer_count);
       // For 10 bit and 7 bit, receive operations are similar
@@ -997,7 +1112,7 @@ sl_status_t sli_i2c_dma_transfer_init(sli_i2c_instance_t *i2c_instance)
                              &tx_cfg,
                              (void*)&(i2c_instance->tx_desc),
                              NULL, NULL);
-    if (i2c_instance->transfer_seq == SL_I2C_READ) {
+    if (i2c_instance->transfer_seq != SL_I2C_WRITE) {
       DMADRV_LdmaStartTransfer(dma_channel->dma_rx_channel,
                                &rx_cfg,
                                (void*)&(i2c_instance->rx_desc),
@@ -1592,6 +1707,9 @@ static void i2c_leader_mode_non_blocking_dispatch_interrupt(sli_i2c_instance_t *
       DMADRV_StopTransfer(sl_i2c_instance->dma_channel.dma_tx_channel);
     } else if (sl_i2c_instance->transfer_seq == SL_I2C_READ) {
       DMADRV_StopTransfer(sl_i2c_instance->dma_channel.dma_rx_channel);
+    } else if (sl_i2c_instance->transfer_seq == SL_I2C_WRITE_READ) {
+      DMADRV_StopTransfer(sl_i2c_instance->dma_channel.dma_tx_channel);
+      DMADRV_StopTransfer(sl_i2c_instance->dma_channel.dma_rx_channel);
     }
 
     (i2c_base_addr)->CTRL = _I2C_CTRL_RESETVALUE;
@@ -1599,7 +1717,9 @@ static void i2c_leader_mode_non_blocking_dispatch_interrupt(sli_i2c_instance_t *
     if (sl_i2c_instance->transfer_event == SL_I2C_EVENT_IN_PROGRESS) {
       sl_i2c_instance->transfer_event = SL_I2C_EVENT_COMPLETED;
     }
-    if (sl_i2c_instance->callback) {
+    if (sl_i2c_instance->queue.active != NULL) {
+      i2c_queue_complete(sl_i2c_instance);
+    } else if (sl_i2c_instance->callback) {
       sl_i2c_instance->callback(sl_i2c_instance->transfer_event, sl_i2c_instance->context);
     }
   } else if (pending_irq & I2C_IF_NACK) {
@@ -1610,6 +1730,10 @@ static void i2c_leader_mode_non_blocking_dispatch_interrupt(sli_i2c_instance_t *
       case SLI_I2C_STATE_REPEATED_ADDR_WAIT_FOR_ACK_OR_NACK:
         sl_i2c_instance->transfer_event = SL_I2C_EVENT_INVALID_ADDR;
         break;
+
+      case SLI_I2C_STATE_WAIT_FOR_ACK_OR_NACK:
+        sl_i2c_instance->transfer_event = SL_I2C_EVENT_NACK_RECEIVED;
+        break;
     }
     sl_hal_i2c_stop_cmd(i2c_base_addr);
   } else if (pending_irq & I2C_IF_ACK) {
@@ -1619,6 +1743,11 @@ static void i2c_leader_mode_non_blocking_dispatch_interrupt(sli_i2c_instance_t *
       case SLI_I2C_STATE_ADDR_WAIT_FOR_ACK_OR_NACK:
         if (sl_i2c_instance->is_10bit_addr) {
           sl_i2c_instance->state = SLI_I2C_STATE_ADDR_2ND_BYTE_10BIT_WAIT_FOR_ACK_OR_NACK;
+        } else if (sl_i2c_instance->transfer_seq == SL_I2C_WRITE_READ) {
+          // The write phase is sent one byte per ACK, the bus is held between bytes
+          sl_i2c_instance->transfer_event = SL_I2C_EVENT_IN_PROGRESS;
+          sl_hal_i2c_tx(i2c_base_addr, sl_i2c_instance->tx_buffer[sl_i2c_instance->tx_offset++]);
+          sl_i2c_instance->state = SLI_I2C_STATE_WAIT_FOR_ACK_OR_NACK;
         } else {
           sl_hal_i2c_disable_interrupts(i2c_base_addr, I2C_IEN_ACK);
           sl_i2c_instance->transfer_event = SL_I2C_EVENT_IN_PROGRESS;
@@ -1633,11 +1762,26 @@ static void i2c_leader_mode_non_blocking_dispatch_interrupt(sli_i2c_instance_t *
           sl_hal_i2c_start_cmd(i2c_base_addr);
           sl_hal_i2c_tx(i2c_base_addr, sl_i2c_instance->addr_buffer[2]);
           sl_i2c_instance->state = SLI_I2C_STATE_REPEATED_ADDR_WAIT_FOR_ACK_OR_NACK;
+        } else if (sl_i2c_instance->transfer_seq == SL_I2C_WRITE_READ) {
+          sl_i2c_instance->transfer_event = SL_I2C_EVENT_IN_PROGRESS;
+          sl_hal_i2c_tx(i2c_base_addr, sl_i2c_instance->tx_buffer[sl_i2c_instance->tx_offset++]);
+          sl_i2c_instance->state = SLI_I2C_STATE_WAIT_FOR_ACK_OR_NACK;
+        }
+        break;
+
+      case SLI_I2C_STATE_WAIT_FOR_ACK_OR_NACK:
+        if (sl_i2c_instance->tx_offset < sl_i2c_instance->tx_len) {
+          sl_hal_i2c_tx(i2c_base_addr, sl_i2c_instance->tx_buffer[sl_i2c_instance->tx_offset++]);
+        } else {
+          // Write phase done, turn the bus around without releasing it
+          sl_hal_i2c_start_cmd(i2c_base_addr);
+          sl_hal_i2c_tx(i2c_base_addr, sl_i2c_instance->addr_buffer[sl_i2c_instance->is_10bit_addr ? 2 : 1]);
+          sl_i2c_instance->state = SLI_I2C_STATE_REPEATED_ADDR_WAIT_FOR_ACK_OR_NACK;
         }
         break;
 
       case SLI_I2C_STATE_REPEATED_ADDR_WAIT_FOR_ACK_OR_NACK:
-        if (sl_i2c_instance->transfer_seq == SL_I2C_READ) {
+        if (sl_i2c_instance->transfer_seq != SL_I2C_WRITE) {
           sl_hal_i2c_disable_interrupts(i2c_base_addr, I2C_IEN_ACK);
           sl_i2c_instance->transfer_event = SL_I2C_EVENT_IN_PROGRESS;
         }
@@ -1653,6 +1797,71 @@ static void i2c_leader_mode_non_blocking_dispatch_interrupt(sli_i2c_instance_t *
     sl_hal_i2c_clear_interrupts(i2c_base_addr, _I2C_IF_MASK);
     // Abort on error
     (i2c_base_addr)->CMD = I2C_CMD_ABORT;
+
+    // An abort ends without a stop condition, move the queue on from here
+    if (sl_i2c_instance->queue.active != NULL) {
+      sl_hal_i2c_disable_interrupts(i2c_base_addr, _I2C_IEN_MASK);
+      DMADRV_StopTransfer(sl_i2c_instance->dma_channel.dma_tx_channel);
+      DMADRV_StopTransfer(sl_i2c_instance->dma_channel.dma_rx_channel);
+      (i2c_base_addr)->CTRL = _I2C_CTRL_RESETVALUE;
+      i2c_queue_complete(sl_i2c_instance);
+    }
+  }
+}
+
+/***************************************************************************//**
+ * Put a queued transaction on the bus.
+ *
+ * @param sl_i2c_instance Pointer to the I2C instance structure.
+ * @param transaction     Pointer to the transaction to start.
+ ******************************************************************************/
+static void i2c_queue_start(sli_i2c_instance_t *sl_i2c_instance,
+                            sl_i2c_transaction_t *transaction)
+{
+  sl_i2c_instance->follower_address = (transaction->follower_address << 1);
+  sl_i2c_instance->is_10bit_addr = (transaction->follower_address > 0x7F);
+  sl_i2c_instance->tx_buffer = transaction->tx_buffer;
+  sl_i2c_instance->tx_len = transaction->tx_len;
+  sl_i2c_instance->tx_offset = 0;
+  sl_i2c_instance->rx_buffer = transaction->rx_buffer;
+  sl_i2c_instance->rx_len = transaction->rx_len;
+  sl_i2c_instance->rx_offset = 0;
+  sl_i2c_instance->transfer_seq = transaction->transfer_seq;
+  sl_i2c_instance->transfer_mode = SLI_I2C_NON_BLOCKING_TRANSFER;
+  sl_i2c_instance->callback = NULL;
+  sl_i2c_instance->context = NULL;
+  sl_i2c_instance->transfer_event = SL_I2C_EVENT_IDLE;
+  sl_i2c_instance->state = SLI_I2C_STATE_ADDR_WAIT_FOR_ACK_OR_NACK;
+  memset(sl_i2c_instance->addr_buffer, 0, sizeof(sl_i2c_instance->addr_buffer));
+
+  sli_i2c_dma_transfer_init(sl_i2c_instance);
+}
+
+/***************************************************************************//**
+ * Complete the active queued transaction, start the next one and notify the
+ * user of the completed one.
+ *
+ * @details The next transaction is started before the callback runs so the bus
+ *          does not wait on user code. Once the queue drains, the follower
+ *          address configured on the instance is restored.
+ *
+ * @param sl_i2c_instance Pointer to the I2C instance structure.
+ ******************************************************************************/
+static void i2c_queue_complete(sli_i2c_instance_t *sl_i2c_instance)
+{
+  sl_i2c_transaction_t *done = sl_i2c_instance->queue.active;
+  sl_i2c_transaction_t *next = sli_i2c_queue_complete(&sl_i2c_instance->queue,
+                                                      sl_i2c_instance->transfer_event);
+
+  if (next != NULL) {
+    i2c_queue_start(sl_i2c_instance, next);
+  } else {
+    sl_i2c_instance->follower_address = sl_i2c_instance->queue_follower_address;
+    sl_i2c_instance->is_10bit_addr = sl_i2c_instance->queue_is_10bit_addr;
+  }
+
+  if (done->callback != NULL) {
+    done->callback(done->transfer_event, done->context);
   }
 }
 
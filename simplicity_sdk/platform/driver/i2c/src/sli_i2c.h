@@ -34,6 +34,7 @@
 #include "dmadrv.h"
 #include "sl_i2c.h"
 #include "sl_status.h"
+#include "sli_i2c_queue.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -116,6 +117,9 @@ typedef struct {
   uint8_t addr_buffer[3];                            /// Address buffer.
   sl_i2c_irq_callback_t callback;                    /// I2C Callback.
   void *context;                                     /// User-defined context.
+  sli_i2c_queue_t queue;                             /// Queued transactions (Leader mode).
+  uint16_t queue_follower_address;                   /// Follower address restored when the queue drains.
+  bool queue_is_10bit_addr;                          /// Address type restored when the queue drains.
 } sli_i2c_instance_t;
 
 /***************************************************************************//**
@@ -0,0 +1,165 @@
+/***************************************************************************//**
+ * @file
+ * @brief I2C Driver transaction queue scheduler.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <stddef.h>
+
+#include "sli_i2c_queue.h"
+
+/*******************************************************************************
+ **************************   INTERNAL FUNCTIONS   *****************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * This function validates a transaction descriptor.
+ ******************************************************************************/
+sl_status_t sli_i2c_queue_validate(const sl_i2c_transaction_t *transaction)
+{
+  if (transaction == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+  if (transaction->follower_address > 0x3FF) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  switch (transaction->transfer_seq) {
+    case SL_I2C_WRITE:
+      if (transaction->tx_buffer == NULL || transaction->tx_len == 0) {
+        return SL_STATUS_INVALID_PARAMETER;
+      }
+      break;
+
+    case SL_I2C_READ:
+      if (transaction->rx_buffer == NULL || transaction->rx_len == 0) {
+        return SL_STATUS_INVALID_PARAMETER;
+      }
+      break;
+
+    case SL_I2C_WRITE_READ:
+      if (transaction->tx_buffer == NULL || transaction->tx_len == 0
+          || transaction->rx_buffer == NULL || transaction->rx_len == 0) {
+        return SL_STATUS_INVALID_PARAMETER;
+      }
+      break;
+
+    default:
+      return SL_STATUS_INVALID_PARAMETER;
+  }
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * This function adds a transaction to the queue.
+ ******************************************************************************/
+sl_status_t sli_i2c_queue_submit(sli_i2c_queue_t *queue,
+                                 sl_i2c_transaction_t *transaction,
+                                 sl_i2c_transaction_t **start)
+{
+  sl_slist_node_t *iterator;
+  sl_slist_node_t *pos = NULL;
+
+  *start = NULL;
+
+  if (transaction == queue->active) {
+    return SL_STATUS_BUSY;
+  }
+  SL_SLIST_FOR_EACH(queue->pending, iterator) {
+    if (iterator == &transaction->node) {
+      return SL_STATUS_BUSY;
+    }
+  }
+
+  transaction->transfer_event = SL_I2C_EVENT_IDLE;
+
+  if (queue->active == NULL) {
+    // An idle queue has no pending transactions, start right away.
+    transaction->transfer_event = SL_I2C_EVENT_IN_PROGRESS;
+    queue->active = transaction;
+    *start = transaction;
+    return SL_STATUS_OK;
+  }
+
+  // Insert after the last transaction of equal or higher priority.
+  SL_SLIST_FOR_EACH(queue->pending, iterator) {
+    sl_i2c_transaction_t *entry = SL_SLIST_ENTRY(iterator, sl_i2c_transaction_t, node);
+    if (entry->priority < transaction->priority) {
+      break;
+    }
+    pos = iterator;
+  }
+  if (pos == NULL) {
+    sl_slist_push(&queue->pending, &transaction->node);
+  } else {
+    sl_slist_insert(&transaction->node, pos);
+  }
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * This function completes the active transaction and selects the next one.
+ ******************************************************************************/
+sl_i2c_transaction_t *sli_i2c_queue_complete(sli_i2c_queue_t *queue,
+                                             sl_i2c_event_t transfer_event)
+{
+  sl_slist_node_t *node;
+
+  if (queue->active != NULL) {
+    queue->active->transfer_event = transfer_event;
+  }
+
+  node = sl_slist_pop(&queue->pending);
+  if (node == NULL) {
+    queue->active = NULL;
+  } else {
+    queue->active = SL_SLIST_ENTRY(node, sl_i2c_transaction_t, node);
+    queue->active->transfer_event = SL_I2C_EVENT_IN_PROGRESS;
+  }
+  return queue->active;
+}
+
+/***************************************************************************//**
+ * This function removes a pending transaction from the queue.
+ ******************************************************************************/
+sl_status_t sli_i2c_queue_cancel(sli_i2c_queue_t *queue,
+                                 sl_i2c_transaction_t *transaction)
+{
+  sl_slist_node_t *iterator;
+
+  if (transaction == queue->active) {
+    return SL_STATUS_BUSY;
+  }
+  SL_SLIST_FOR_EACH(queue->pending, iterator) {
+    if (iterator == &transaction->node) {
+      sl_slist_remove(&queue->pending, &transaction->node);
+      transaction->transfer_event = SL_I2C_EVENT_IDLE;
+      return SL_STATUS_OK;
+    }
+  }
+  return SL_STATUS_NOT_FOUND;
+}
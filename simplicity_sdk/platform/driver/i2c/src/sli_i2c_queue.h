@@ -0,0 +1,109 @@
+/***************************************************************************//**
+ * @file
+ * @brief I2C Driver transaction queue scheduler.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SLI_I2C_QUEUE_H
+#define SLI_I2C_QUEUE_H
+
+#include "sl_status.h"
+#include "sl_slist.h"
+#include "sl_i2c.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+ *******************************   STRUCTS   ***********************************
+ ******************************************************************************/
+/**
+ * @struct sli_i2c_queue_t
+ * @brief Transaction queue of an I2C instance.
+ *
+ * @note The scheduler only orders and hands over transactions, it does not
+ *       touch the peripheral. The driver starts the transaction returned by
+ *       sli_i2c_queue_submit() and sli_i2c_queue_complete() on the bus. Callers
+ *       serialize access, the driver does so with CORE_ATOMIC sections and the
+ *       I2C interrupt.
+ */
+typedef struct {
+  sl_slist_node_t *pending;                          /// Transactions waiting, highest priority first.
+  sl_i2c_transaction_t *active;                      /// Transaction on the bus, or NULL.
+} sli_i2c_queue_t;
+
+/***************************************************************************//**
+ * This function validates a transaction descriptor.
+ *
+ * @param[in] transaction   A pointer to the transaction descriptor.
+ *
+ * @return  return status.
+ ******************************************************************************/
+sl_status_t sli_i2c_queue_validate(const sl_i2c_transaction_t *transaction);
+
+/***************************************************************************//**
+ * This function adds a transaction to the queue.
+ *
+ * @param[in] queue         A pointer to the queue.
+ * @param[in] transaction   A pointer to a validated transaction descriptor.
+ * @param[out] start        Set to the transaction to start on the bus when the
+ *                          queue was idle, NULL otherwise.
+ *
+ * @return  SL_STATUS_OK, or SL_STATUS_BUSY if the descriptor is already queued.
+ ******************************************************************************/
+sl_status_t sli_i2c_queue_submit(sli_i2c_queue_t *queue,
+                                 sl_i2c_transaction_t *transaction,
+                                 sl_i2c_transaction_t **start);
+
+/***************************************************************************//**
+ * This function completes the active transaction and selects the next one.
+ *
+ * @param[in] queue           A pointer to the queue.
+ * @param[in] transfer_event  Result of the active transaction.
+ *
+ * @return  The next transaction to start on the bus, or NULL if the queue is empty.
+ ******************************************************************************/
+sl_i2c_transaction_t *sli_i2c_queue_complete(sli_i2c_queue_t *queue,
+                                             sl_i2c_event_t transfer_event);
+
+/***************************************************************************//**
+ * This function removes a pending transaction from the queue.
+ *
+ * @param[in] queue         A pointer to the queue.
+ * @param[in] transaction   A pointer to the transaction descriptor.
+ *
+ * @return  return status.
+ ******************************************************************************/
+sl_status_t sli_i2c_queue_cancel(sli_i2c_queue_t *queue,
+                                 sl_i2c_transaction_t *transaction);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SLI_I2C_QUEUE_H
@@ -35,6 +35,10 @@
 #include "sl_enum.h"
 #include "em_eusart_compat.h"
 #include <stdbool.h>
+#include <stddef.h>
+#if defined(EUSART_PRESENT) && defined(LDMA_PRESENT) && (LDMA_COUNT == 1)
+#include "em_ldma.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -63,8 +67,21 @@ extern "C" {
 ///  EUSART has a wide selection of operating modes, frame formats, and baud rates.
 ///  All features are supported through the API of this module.
 ///
-/// This module does not support DMA configuration. UARTDRV and SPIDRV drivers
-/// provide full support for DMA and more.
+/// Apart from the buffer transfer API below, this module does not support DMA
+/// configuration. UARTDRV and SPIDRV drivers provide full support for DMA and
+/// more.
+///
+///  EUSART_TransferSubmit() moves whole buffers instead of single frames. The
+///  TX FIFO is kept filled and the RX FIFO drained from the FIFO level
+///  interrupts, and transfers of at least EUSART_TRANSFER_DMA_THRESHOLD frames
+///  are moved by two LDMA channels when configured with
+///  EUSART_TransferDmaConfig(). Transfers are queued and completed in order,
+///  each through its own callback. In SPI main mode, a transfer with csHold set
+///  streams straight into the next queued FIFO mode transfer so the automatic
+///  chip select stays asserted between them. The application must call
+///  EUSART_TransferIRQHandler() from the EUSART RX and TX interrupt handlers,
+///  and from the LDMA interrupt handler when DMA is used. The RX FIFO
+///  watermark must be left at one frame.
 ///
 ///@n @section eusart_example Example
 ///
@@ -683,6 +700,57 @@ typedef struct {
 #endif
 } EUSART_DaliInit_TypeDef;
 
+#if defined(EUSART_PRESENT)
+/// Transfers of at least this many frames use LDMA when configured with
+/// EUSART_TransferDmaConfig().
+#if !defined(EUSART_TRANSFER_DMA_THRESHOLD)
+#define EUSART_TRANSFER_DMA_THRESHOLD   32U
+#endif
+
+struct EUSART_Transfer;
+
+/// Buffer transfer completion callback, called from interrupt context.
+typedef void (*EUSART_TransferCallback_TypeDef)(struct EUSART_Transfer *transfer);
+
+/// Buffer transfer. The structure is owned by the EUSART driver from the call
+/// to EUSART_TransferSubmit() until its callback is called.
+typedef struct EUSART_Transfer {
+  /// Frames to transmit, uint8_t elements for frames of up to 8 data bits and
+  /// uint16_t elements otherwise. If NULL, txDummy is transmitted in SPI mode
+  /// and nothing is transmitted in UART mode.
+  const void *txBuffer;
+
+  /// Buffer for received frames, same element size as txBuffer. If NULL,
+  /// received frames are discarded in SPI mode and nothing is received in
+  /// UART mode.
+  void *rxBuffer;
+
+  /// Number of frames to transfer.
+  size_t count;
+
+  /// Frame transmitted in SPI mode when txBuffer is NULL.
+  uint16_t txDummy;
+
+  /// SPI main mode only. Start feeding the next queued transfer into the TX
+  /// FIFO before this one completes, so that the automatic chip select is held
+  /// between them. FIFO mode only: neither this transfer nor the next one may
+  /// use LDMA, which EUSART_TransferSubmit() asserts.
+  bool csHold;
+
+  /// Completion callback, may be NULL.
+  EUSART_TransferCallback_TypeDef callback;
+
+  /// User data, not used by the driver.
+  void *userData;
+
+  /** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+  size_t txIndex;
+  size_t rxIndex;
+  struct EUSART_Transfer *next;
+  /** @endcond */
+} EUSART_Transfer_TypeDef;
+#endif /* EUSART_PRESENT */
+
 /// Default configuration for EUSART initialization structure in UART mode with high-frequency clock.
 #define EUSART_UART_INIT_DEFAULT_HF                                                                   \
   {                                                                                                   \
@@ -1030,6 +1098,61 @@ void EUSART_TxExt(EUSART_TypeDef *eusart, uint16_t data);
  ******************************************************************************/
 uint16_t EUSART_Spi_TxRx(EUSART_TypeDef *eusart, uint16_t data);
 
+/***************************************************************************//**
+ * Queue a buffer transfer.
+ *
+ * @param eusart Pointer to the EUSART peripheral register block.
+ * @param transfer Transfer to queue. Only the public fields need to be set.
+ *
+ * @note The transfer starts immediately if the queue is empty, otherwise when
+ *       the preceding transfers have completed. This function may be called
+ *       from a transfer callback.
+ * @note In SPI mode, every transmitted frame yields a received frame. In UART
+ *       mode, the transmit and receive directions are independent and a
+ *       transmit-only transfer completes once the last frame has been shifted
+ *       out.
+ * @note csHold is only supported between FIFO mode transfers. A transfer with
+ *       csHold set, or queued behind one, must be shorter than
+ *       EUSART_TRANSFER_DMA_THRESHOLD frames when LDMA is configured.
+ ******************************************************************************/
+void EUSART_TransferSubmit(EUSART_TypeDef *eusart,
+                           EUSART_Transfer_TypeDef *transfer);
+
+/***************************************************************************//**
+ * Check whether buffer transfers are queued or ongoing.
+ *
+ * @param eusart Pointer to the EUSART peripheral register block.
+ *
+ * @return True if a transfer has not completed yet.
+ ******************************************************************************/
+bool EUSART_TransferBusy(EUSART_TypeDef *eusart);
+
+/***************************************************************************//**
+ * Advance buffer transfers.
+ *
+ * @param eusart Pointer to the EUSART peripheral register block.
+ *
+ * @note Call from the EUSART RX and TX interrupt handlers, and from the LDMA
+ *       interrupt handler when LDMA is used for transfers. The done interrupt
+ *       flags of the configured LDMA channels are cleared by this function.
+ ******************************************************************************/
+void EUSART_TransferIRQHandler(EUSART_TypeDef *eusart);
+
+#if defined(LDMA_PRESENT) && (LDMA_COUNT == 1)
+/***************************************************************************//**
+ * Configure the LDMA channels used for large buffer transfers.
+ *
+ * @param eusart Pointer to the EUSART peripheral register block.
+ * @param txCh LDMA channel feeding the TX FIFO, or -1 to use FIFO interrupts
+ *             for all transfers.
+ * @param rxCh LDMA channel draining the RX FIFO.
+ *
+ * @note LDMA_Init() must have been called. Must not be called while transfers
+ *       are ongoing.
+ ******************************************************************************/
+void EUSART_TransferDmaConfig(EUSART_TypeDef *eusart, int txCh, int rxCh);
+#endif
+
 #if defined(EUSART_DALICFG_DALIEN)
 /***************************************************************************//**
  * Transmit one DALI frame.
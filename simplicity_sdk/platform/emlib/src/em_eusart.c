@@ -31,6 +31,7 @@
 #include "em_eusart.h"
 #if defined(EUART_PRESENT) || defined(EUSART_PRESENT)
 #include "em_cmu.h"
+#include "em_core.h"
 #include <stddef.h>
 
 /*******************************************************************************
@@ -54,6 +55,27 @@ static uint8_t dali_tx_nb_packets[EUSART_COUNT];
 static uint8_t dali_rx_nb_packets[EUSART_COUNT];
 #endif /* EUSART_DALICFG_DALIEN */
 
+#if defined(EUSART_PRESENT)
+/// Buffer transfer queue of one EUSART instance.
+typedef struct {
+  EUSART_Transfer_TypeDef *head;   ///< Oldest transfer not completed yet.
+  EUSART_Transfer_TypeDef *tail;   ///< Last queued transfer.
+  EUSART_Transfer_TypeDef *txCur;  ///< Transfer being fed into the TX FIFO.
+  uint32_t inFlight;               ///< SPI frames transmitted but not read back.
+#if defined(LDMA_PRESENT) && (LDMA_COUNT == 1)
+  bool dmaEnabled;                 ///< LDMA channels are configured.
+  bool dmaActive;                  ///< The head transfer is moved by LDMA.
+  int dmaTxCh;                     ///< LDMA channel feeding the TX FIFO.
+  int dmaRxCh;                     ///< LDMA channel draining the RX FIFO.
+  size_t dmaChunk;                 ///< Frames in the ongoing LDMA transfer.
+  uint16_t dmaDiscard;             ///< Sink for discarded RX frames.
+  LDMA_Descriptor_t dmaDesc[2];    ///< TX and RX descriptors.
+#endif
+} EUSART_TransferState_TypeDef;
+
+static EUSART_TransferState_TypeDef transfer_state[EUSART_COUNT];
+#endif /* EUSART_PRESENT */
+
 /*******************************************************************************
  **************************   LOCAL FUNCTIONS   ********************************
  ******************************************************************************/
@@ -68,6 +90,15 @@ static void EUSART_AsyncInitCommon(EUSART_TypeDef *eusart,
 #if defined(EUSART_PRESENT)
 static void EUSART_SyncInitCommon(EUSART_TypeDef *eusart,
                                   const EUSART_SpiInit_TypeDef  *init);
+
+static void eusart_transfer_begin(EUSART_TypeDef *eusart,
+                                  EUSART_TransferState_TypeDef *state,
+                                  bool spi);
+static EUSART_Transfer_TypeDef *eusart_transfer_process(EUSART_TypeDef *eusart);
+#if defined(LDMA_PRESENT) && (LDMA_COUNT == 1)
+__STATIC_INLINE bool eusart_transfer_uses_dma(const EUSART_TransferState_TypeDef *state,
+                                              const EUSART_Transfer_TypeDef *transfer);
+#endif
 #endif
 
 /***************************************************************************//**
@@ -531,6 +562,107 @@ uint32_t EUSART_Dali_Rx(EUSART_TypeDef *eusart)
 }
 
 #endif /* EUSART_DALICFG_DALIEN */
+
+/***************************************************************************//**
+ * Queues a buffer transfer.
+ ******************************************************************************/
+void EUSART_TransferSubmit(EUSART_TypeDef *eusart,
+                           EUSART_Transfer_TypeDef *transfer)
+{
+  EUSART_TransferState_TypeDef *state;
+  bool idle;
+  CORE_DECLARE_IRQ_STATE;
+
+  // Make sure the module exists on the selected chip.
+  EFM_ASSERT(EUSART_REF_VALID(eusart));
+  EFM_ASSERT(transfer != NULL);
+  // Reception relies on RXFL being set whenever the RX FIFO is not empty.
+  EFM_ASSERT((eusart->CFG1 & _EUSART_CFG1_RXFIW_MASK) == EUSART_CFG1_RXFIW_ONEFRAME);
+
+  state = &transfer_state[EUSART_NUM(eusart)];
+  transfer->txIndex = 0;
+  transfer->rxIndex = 0;
+  transfer->next = NULL;
+
+  CORE_ENTER_ATOMIC();
+#if defined(LDMA_PRESENT) && (LDMA_COUNT == 1)
+  // csHold chains FIFO mode transfers only.
+  EFM_ASSERT(!transfer->csHold || !eusart_transfer_uses_dma(state, transfer));
+  EFM_ASSERT((state->tail == NULL) || !state->tail->csHold
+             || !eusart_transfer_uses_dma(state, transfer));
+#endif
+  idle = (state->head == NULL);
+  if (idle) {
+    state->head = transfer;
+    state->tail = transfer;
+    state->txCur = transfer;
+    eusart_transfer_begin(eusart, state,
+                          (eusart->CFG0 & _EUSART_CFG0_SYNC_MASK) != 0U);
+  } else {
+    state->tail->next = transfer;
+    state->tail = transfer;
+  }
+  CORE_EXIT_ATOMIC();
+
+  if (idle) {
+    // Start the transfer.
+    EUSART_TransferIRQHandler(eusart);
+  }
+}
+
+/***************************************************************************//**
+ * Checks whether buffer transfers are queued or ongoing.
+ ******************************************************************************/
+bool EUSART_TransferBusy(EUSART_TypeDef *eusart)
+{
+  EFM_ASSERT(EUSART_REF_VALID(eusart));
+
+  return transfer_state[EUSART_NUM(eusart)].head != NULL;
+}
+
+/***************************************************************************//**
+ * Advances buffer transfers from interrupt context.
+ ******************************************************************************/
+void EUSART_TransferIRQHandler(EUSART_TypeDef *eusart)
+{
+  EUSART_Transfer_TypeDef *done;
+  CORE_DECLARE_IRQ_STATE;
+
+  EFM_ASSERT(EUSART_REF_VALID(eusart));
+
+  // Callbacks are called outside of the atomic section. They may queue new
+  // transfers, the queue is therefore processed again after each completion.
+  do {
+    CORE_ENTER_ATOMIC();
+    done = eusart_transfer_process(eusart);
+    CORE_EXIT_ATOMIC();
+
+    if ((done != NULL) && (done->callback != NULL)) {
+      done->callback(done);
+    }
+  } while (done != NULL);
+}
+
+#if defined(LDMA_PRESENT) && (LDMA_COUNT == 1)
+/***************************************************************************//**
+ * Configures the LDMA channels used for large buffer transfers.
+ ******************************************************************************/
+void EUSART_TransferDmaConfig(EUSART_TypeDef *eusart, int txCh, int rxCh)
+{
+  EUSART_TransferState_TypeDef *state;
+
+  EFM_ASSERT(EUSART_REF_VALID(eusart));
+  EFM_ASSERT(!EUSART_TransferBusy(eusart));
+  EFM_ASSERT((txCh < 0) || ((txCh < (int)DMA_CHAN_COUNT)
+                            && (rxCh >= 0) && (rxCh < (int)DMA_CHAN_COUNT)
+                            && (rxCh != txCh)));
+
+  state = &transfer_state[EUSART_NUM(eusart)];
+  state->dmaEnabled = (txCh >= 0);
+  state->dmaTxCh = txCh;
+  state->dmaRxCh = rxCh;
+}
+#endif
 #endif /* EUSART_PRESENT */
 
 /***************************************************************************//**
@@ -1395,4 +1527,374 @@ __STATIC_INLINE void EUSART_Disable(EUSART_TypeDef *eusart)
   }
 }
 
+#if defined(EUSART_PRESENT)
+/***************************************************************************//**
+ * Gets the number of frames a transfer transmits.
+ *
+ * @param transfer Transfer.
+ * @param spi True if the EUSART is in SPI mode.
+ *
+ * @return Number of frames to write to the TX FIFO.
+ ******************************************************************************/
+__STATIC_INLINE size_t eusart_transfer_tx_count(const EUSART_Transfer_TypeDef *transfer,
+                                                bool spi)
+{
+  return (spi || (transfer->txBuffer != NULL)) ? transfer->count : 0U;
+}
+
+/***************************************************************************//**
+ * Gets the number of frames a transfer receives.
+ *
+ * @param transfer Transfer.
+ * @param spi True if the EUSART is in SPI mode.
+ *
+ * @return Number of frames to read from the RX FIFO.
+ ******************************************************************************/
+__STATIC_INLINE size_t eusart_transfer_rx_count(const EUSART_Transfer_TypeDef *transfer,
+                                                bool spi)
+{
+  return (spi || (transfer->rxBuffer != NULL)) ? transfer->count : 0U;
+}
+
+#if defined(LDMA_PRESENT) && (LDMA_COUNT == 1)
+/***************************************************************************//**
+ * Gets the LDMA request signal of an EUSART FIFO.
+ *
+ * @param eusart Pointer to the EUSART peripheral register block.
+ * @param tx True for the TX FIFO level signal, false for the RX FIFO level
+ *           signal.
+ *
+ * @return LDMA peripheral signal.
+ ******************************************************************************/
+static LDMA_PeripheralSignal_t eusart_transfer_dma_signal(EUSART_TypeDef *eusart,
+                                                          bool tx)
+{
+  switch (EUSART_NUM(eusart)) {
+#if defined(LDMAXBAR_CH_REQSEL_SIGSEL_EUSART0TXFL)
+    case 0:
+      return tx ? ldmaPeripheralSignal_EUSART0_TXFL : ldmaPeripheralSignal_EUSART0_RXFL;
+#endif
+#if defined(LDMAXBAR_CH_REQSEL_SIGSEL_EUSART1TXFL)
+    case 1:
+      return tx ? ldmaPeripheralSignal_EUSART1_TXFL : ldmaPeripheralSignal_EUSART1_RXFL;
+#endif
+#if defined(LDMAXBAR_CH_REQSEL_SIGSEL_EUSART2TXFL)
+    case 2:
+      return tx ? ldmaPeripheralSignal_EUSART2_TXFL : ldmaPeripheralSignal_EUSART2_RXFL;
+#endif
+#if defined(LDMAXBAR_CH_REQSEL_SIGSEL_EUSART3TXFL)
+    case 3:
+      return tx ? ldmaPeripheralSignal_EUSART3_TXFL : ldmaPeripheralSignal_EUSART3_RXFL;
+#endif
+#if defined(LDMAXBAR_CH_REQSEL_SIGSEL_EUSART4TXFL)
+    case 4:
+      return tx ? ldmaPeripheralSignal_EUSART4_TXFL : ldmaPeripheralSignal_EUSART4_RXFL;
+#endif
+    default:
+      EFM_ASSERT(false);
+      return ldmaPeripheralSignal_NONE;
+  }
+}
+
+/***************************************************************************//**
+ * Checks whether a transfer is moved by LDMA.
+ *
+ * @param state Transfer state of the EUSART instance.
+ * @param transfer Transfer.
+ *
+ * @return True if the transfer uses LDMA.
+ ******************************************************************************/
+__STATIC_INLINE bool eusart_transfer_uses_dma(const EUSART_TransferState_TypeDef *state,
+                                              const EUSART_Transfer_TypeDef *transfer)
+{
+  return state->dmaEnabled && (transfer->count >= EUSART_TRANSFER_DMA_THRESHOLD);
+}
+
+/***************************************************************************//**
+ * Starts LDMA for the next chunk of the head transfer.
+ *
+ * @param eusart Pointer to the EUSART peripheral register block.
+ * @param state Transfer state of the EUSART instance.
+ * @param spi True if the EUSART is in SPI mode.
+ ******************************************************************************/
+static void eusart_transfer_dma_start(EUSART_TypeDef *eusart,
+                                      EUSART_TransferState_TypeDef *state,
+                                      bool spi)
+{
+  EUSART_Transfer_TypeDef *transfer = state->head;
+  bool wide = (eusart->FRAMECFG & _EUSART_FRAMECFG_DATABITS_MASK)
+              > _EUSART_FRAMECFG_DATABITS_EIGHT;
+  size_t width = wide ? 2U : 1U;
+  size_t index = transfer->rxIndex;
+  LDMA_TransferCfg_t rxCfg =
+    LDMA_TRANSFER_CFG_PERIPHERAL(eusart_transfer_dma_signal(eusart, false));
+  LDMA_TransferCfg_t txCfg =
+    LDMA_TRANSFER_CFG_PERIPHERAL(eusart_transfer_dma_signal(eusart, true));
+
+  // Both directions move the same frames, so the receive index is
+  // representative for full duplex transfers as well.
+  if (eusart_transfer_rx_count(transfer, spi) == 0U) {
+    index = transfer->txIndex;
+  }
+  state->dmaChunk = transfer->count - index;
+  if (state->dmaChunk > LDMA_DESCRIPTOR_MAX_XFER_SIZE) {
+    state->dmaChunk = LDMA_DESCRIPTOR_MAX_XFER_SIZE;
+  }
+  state->dmaActive = true;
+  // Completion is signaled by the LDMA, except for the final TXC wait.
+  eusart->IEN_CLR = EUSART_IEN_TXFL | EUSART_IEN_RXFL | EUSART_IEN_TXC;
+
+  if (eusart_transfer_rx_count(transfer, spi) != 0U) {
+    if (transfer->rxBuffer != NULL) {
+      state->dmaDesc[1] = (LDMA_Descriptor_t)
+                          LDMA_DESCRIPTOR_SINGLE_P2M_BYTE(&eusart->RXDATA,
+                                                          (uint8_t *)transfer->rxBuffer + (index * width),
+                                                          state->dmaChunk);
+    } else {
+      state->dmaDesc[1] = (LDMA_Descriptor_t)
+                          LDMA_DESCRIPTOR_SINGLE_P2M_BYTE(&eusart->RXDATA,
+                                                          &state->dmaDiscard,
+                                                          state->dmaChunk);
+      state->dmaDesc[1].xfer.dstInc = ldmaCtrlDstIncNone;
+    }
+    state->dmaDesc[1].xfer.size = wide ? ldmaCtrlSizeHalf : ldmaCtrlSizeByte;
+    LDMA_StartTransfer(state->dmaRxCh, &rxCfg, &state->dmaDesc[1]);
+  }
+
+  if (eusart_transfer_tx_count(transfer, spi) != 0U) {
+    if (transfer->txBuffer != NULL) {
+      state->dmaDesc[0] = (LDMA_Descriptor_t)
+                          LDMA_DESCRIPTOR_SINGLE_M2P_BYTE((const uint8_t *)transfer->txBuffer + (index * width),
+                                                          &eusart->TXDATA,
+                                                          state->dmaChunk);
+    } else {
+      state->dmaDesc[0] = (LDMA_Descriptor_t)
+                          LDMA_DESCRIPTOR_SINGLE_M2P_BYTE(&transfer->txDummy,
+                                                          &eusart->TXDATA,
+                                                          state->dmaChunk);
+      state->dmaDesc[0].xfer.srcInc = ldmaCtrlSrcIncNone;
+    }
+    state->dmaDesc[0].xfer.size = wide ? ldmaCtrlSizeHalf : ldmaCtrlSizeByte;
+    LDMA_StartTransfer(state->dmaTxCh, &txCfg, &state->dmaDesc[0]);
+  }
+}
+
+/***************************************************************************//**
+ * Advances an LDMA moved head transfer.
+ *
+ * @param eusart Pointer to the EUSART peripheral register block.
+ * @param state Transfer state of the EUSART instance.
+ * @param spi True if the EUSART is in SPI mode.
+ *
+ * @return True if all frames of the head transfer have been moved.
+ ******************************************************************************/
+static bool eusart_transfer_dma_process(EUSART_TypeDef *eusart,
+                                        EUSART_TransferState_TypeDef *state,
+                                        bool spi)
+{
+  EUSART_Transfer_TypeDef *transfer = state->head;
+  size_t txCount = eusart_transfer_tx_count(transfer, spi);
+  size_t rxCount = eusart_transfer_rx_count(transfer, spi);
+  bool rxDone = (rxCount == 0U) || LDMA_TransferDone(state->dmaRxCh);
+  bool txDone = (txCount == 0U) || LDMA_TransferDone(state->dmaTxCh);
+  uint32_t doneFlags = 0U;
+
+  // Acknowledge the channel done interrupts that brought us here, otherwise
+  // the LDMA interrupt is taken again as soon as it returns. A channel stays
+  // done until it is restarted, so a flag is never lost by clearing it early.
+  if ((rxCount != 0U) && rxDone) {
+    doneFlags |= 1UL << state->dmaRxCh;
+  }
+  if ((txCount != 0U) && txDone) {
+    doneFlags |= 1UL << state->dmaTxCh;
+  }
+  LDMA_IntClear(doneFlags);
+
+  if (!rxDone || !txDone) {
+    return false;
+  }
+
+  transfer->txIndex += (txCount != 0U) ? state->dmaChunk : 0U;
+  transfer->rxIndex += (rxCount != 0U) ? state->dmaChunk : 0U;
+  if ((transfer->txIndex < txCount) || (transfer->rxIndex < rxCount)) {
+    eusart_transfer_dma_start(eusart, state, spi);
+    return false;
+  }
+  state->dmaActive = false;
+  return true;
+}
+#endif /* defined(LDMA_PRESENT) && (LDMA_COUNT == 1) */
+
+/***************************************************************************//**
+ * Starts the head transfer once it is also the transfer fed to the TX FIFO.
+ *
+ * @param eusart Pointer to the EUSART peripheral register block.
+ * @param state Transfer state of the EUSART instance.
+ * @param spi True if the EUSART is in SPI mode.
+ *
+ * @note FIFO mode transfers are started by the next call to
+ *       eusart_transfer_process().
+ ******************************************************************************/
+static void eusart_transfer_begin(EUSART_TypeDef *eusart,
+                                  EUSART_TransferState_TypeDef *state,
+                                  bool spi)
+{
+#if defined(LDMA_PRESENT) && (LDMA_COUNT == 1)
+  if ((state->head != NULL) && eusart_transfer_uses_dma(state, state->head)) {
+    eusart_transfer_dma_start(eusart, state, spi);
+  }
+#else
+  (void)eusart;
+  (void)state;
+  (void)spi;
+#endif
+}
+
+/***************************************************************************//**
+ * Removes the completed head transfer from the queue and starts the next one.
+ *
+ * @param eusart Pointer to the EUSART peripheral register block.
+ * @param state Transfer state of the EUSART instance.
+ * @param spi True if the EUSART is in SPI mode.
+ *
+ * @return The completed transfer.
+ ******************************************************************************/
+static EUSART_Transfer_TypeDef *eusart_transfer_complete(EUSART_TypeDef *eusart,
+                                                         EUSART_TransferState_TypeDef *state,
+                                                         bool spi)
+{
+  EUSART_Transfer_TypeDef *done = state->head;
+
+  state->head = done->next;
+  if (state->head == NULL) {
+    state->tail = NULL;
+    eusart->IEN_CLR = EUSART_IEN_TXFL | EUSART_IEN_RXFL | EUSART_IEN_TXC;
+  }
+  // Transfers already streamed under csHold keep their progress.
+  if (state->txCur == done) {
+    state->txCur = state->head;
+    eusart_transfer_begin(eusart, state, spi);
+  }
+  done->next = NULL;
+
+  return done;
+}
+
+/***************************************************************************//**
+ * Moves frames between the FIFOs and the queued transfers.
+ *
+ * @param eusart Pointer to the EUSART peripheral register block.
+ *
+ * @return A transfer that has completed and was removed from the queue, or
+ *         NULL if none did. The caller calls the callback and calls this
+ *         function again until NULL is returned.
+ ******************************************************************************/
+static EUSART_Transfer_TypeDef *eusart_transfer_process(EUSART_TypeDef *eusart)
+{
+  EUSART_TransferState_TypeDef *state = &transfer_state[EUSART_NUM(eusart)];
+  EUSART_Transfer_TypeDef *transfer = state->head;
+  EUSART_Transfer_TypeDef *tx;
+  bool spi = (eusart->CFG0 & _EUSART_CFG0_SYNC_MASK) != 0U;
+  bool wide = (eusart->FRAMECFG & _EUSART_FRAMECFG_DATABITS_MASK)
+              > _EUSART_FRAMECFG_DATABITS_EIGHT;
+  uint32_t depth = EUSART_FIFO_DEPTH(EUSART_NUM(eusart));
+  uint32_t ien = 0U;
+  uint16_t frame;
+
+  if (transfer == NULL) {
+    return NULL;
+  }
+  // Level flags are re-evaluated below from STATUS.
+  eusart->IF_CLR = EUSART_IF_TXFL | EUSART_IF_RXFL | EUSART_IF_TXC;
+
+#if defined(LDMA_PRESENT) && (LDMA_COUNT == 1)
+  if (state->dmaActive) {
+    if (!eusart_transfer_dma_process(eusart, state, spi)) {
+      return NULL;
+    }
+    if (spi || (eusart_transfer_tx_count(transfer, spi) == 0U)
+        || ((eusart->STATUS & EUSART_STATUS_TXC) != 0U)) {
+      return eusart_transfer_complete(eusart, state, spi);
+    }
+    // Transmit-only UART transfer, wait until the last frame is shifted out.
+    eusart->IEN_SET = EUSART_IEN_TXC;
+    return NULL;
+  }
+#endif
+
+  // Drain the RX FIFO into the oldest transfer.
+  while ((transfer->rxIndex < eusart_transfer_rx_count(transfer, spi))
+         && ((eusart->STATUS & EUSART_STATUS_RXFL) != 0U)) {
+    frame = (uint16_t)eusart->RXDATA;
+    if (transfer->rxBuffer != NULL) {
+      if (wide) {
+        ((uint16_t *)transfer->rxBuffer)[transfer->rxIndex] = frame;
+      } else {
+        ((uint8_t *)transfer->rxBuffer)[transfer->rxIndex] = (uint8_t)frame;
+      }
+    }
+    transfer->rxIndex++;
+    if (spi) {
+      state->inFlight--;
+    }
+  }
+
+  // Keep the TX FIFO filled. In SPI mode, every frame written produces a
+  // received frame, so the frames in flight are bounded by the RX FIFO size.
+  while ((tx = state->txCur) != NULL) {
+    if (tx->txIndex >= eusart_transfer_tx_count(tx, spi)) {
+      if (spi && tx->csHold && (tx->next != NULL)
+#if defined(LDMA_PRESENT) && (LDMA_COUNT == 1)
+          && !eusart_transfer_uses_dma(state, tx)
+          && !eusart_transfer_uses_dma(state, tx->next)
+#endif
+          ) {
+        state->txCur = tx->next;
+        continue;
+      }
+      break;
+    }
+    if ((((eusart->STATUS & _EUSART_STATUS_TXFCNT_MASK) >> _EUSART_STATUS_TXFCNT_SHIFT) >= depth)
+        || (spi && (state->inFlight >= EUSART_RX_FIFO_SIZE))) {
+      break;
+    }
+    if (tx->txBuffer == NULL) {
+      frame = tx->txDummy;
+    } else if (wide) {
+      frame = ((const uint16_t *)tx->txBuffer)[tx->txIndex];
+    } else {
+      frame = ((const uint8_t *)tx->txBuffer)[tx->txIndex];
+    }
+    eusart->TXDATA = (uint32_t)frame;
+    tx->txIndex++;
+    if (spi) {
+      state->inFlight++;
+    }
+  }
+
+  if ((transfer->rxIndex >= eusart_transfer_rx_count(transfer, spi))
+      && (transfer->txIndex >= eusart_transfer_tx_count(transfer, spi))) {
+    if (spi || (eusart_transfer_tx_count(transfer, spi) == 0U)
+        || ((eusart->STATUS & EUSART_STATUS_TXC) != 0U)) {
+      return eusart_transfer_complete(eusart, state, spi);
+    }
+    // Transmit-only UART transfer, wait until the last frame is shifted out.
+    ien |= EUSART_IEN_TXC;
+  }
+
+  if (transfer->rxIndex < eusart_transfer_rx_count(transfer, spi)) {
+    ien |= EUSART_IEN_RXFL;
+  }
+  // In SPI mode, reception paces transmission.
+  tx = state->txCur;
+  if (!spi && (tx != NULL) && (tx->txIndex < eusart_transfer_tx_count(tx, spi))) {
+    ien |= EUSART_IEN_TXFL;
+  }
+  eusart->IEN_CLR = (EUSART_IEN_TXFL | EUSART_IEN_RXFL | EUSART_IEN_TXC) & ~ien;
+  eusart->IEN_SET = ien;
+
+  return NULL;
+}
+#endif /* EUSART_PRESENT */
+
 #endif /* defined(EUART_PRESENT) || defined(EUSART_PRESENT) */
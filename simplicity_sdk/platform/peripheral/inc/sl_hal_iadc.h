@@ -37,6 +37,9 @@
 #if defined(IADC_COUNT) && (IADC_COUNT > 0)
 
 #include <stdbool.h>
+#if defined(LDMA_PRESENT)
+#include "sl_hal_ldma.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -420,6 +423,20 @@ typedef struct {
   uint8_t  id;     ///< ID of FIFO entry; Scan table entry id or single indicator (0x20).
 } sl_hal_iadc_result_t;
 
+#if defined(LDMA_PRESENT)
+/// IADC scan FIFO stream, drained by an LDMA channel into a RAM ring buffer.
+typedef struct {
+  uint32_t                 *buffer;      ///< Ring buffer for raw scan FIFO words.
+  uint32_t                 size;         ///< Number of words in the ring buffer, 2 to SL_HAL_LDMA_DESCRIPTOR_MAX_XFER_SIZE.
+  LDMA_TypeDef             *ldma;        ///< LDMA instance draining the scan FIFO.
+  uint32_t                 channel;      ///< LDMA channel draining the scan FIFO.
+  /// @cond DO_NOT_INCLUDE_WITH_DOXYGEN
+  uint32_t                 read_index;   // Next ring buffer word to be read.
+  sl_hal_ldma_descriptor_t descriptor;   // Self-linked descriptor covering the ring.
+  /// @endcond
+} sl_hal_iadc_scan_stream_t;
+#endif
+
 // Default IADC config for scan table.
 #define SL_HAL_IADC_SCANTABLE_DEFAULT     \
   {                                       \
@@ -910,6 +927,150 @@ sl_hal_iadc_result_t sl_hal_iadc_read_scan_result(IADC_TypeDef*iadc);
  ******************************************************************************/
 sl_hal_iadc_result_t sl_hal_iadc_pull_scan_fifo_result(IADC_TypeDef *iadc);
 
+/***************************************************************************//**
+ * @brief
+ *   Decode a block of raw FIFO words into results.
+ *
+ * @details
+ *   Gives the same results as @ref sl_hal_iadc_pull_scan_fifo_result() and
+ *   @ref sl_hal_iadc_read_single_fifo_result() for each word, but the
+ *   alignment is only evaluated once for the whole block, and each word is
+ *   decoded without branches.
+ *
+ * @param[in] raw_data
+ *   Raw FIFO words, e.g. read with @ref sl_hal_iadc_scan_stream_read().
+ *
+ * @param[out] results
+ *   Array of count decoded results.
+ *
+ * @param[in] count
+ *   Number of words to decode.
+ *
+ * @param[in] alignment
+ *   Alignment the words were converted with.
+ ******************************************************************************/
+void sl_hal_iadc_decode_results(const uint32_t *raw_data,
+                                sl_hal_iadc_result_t *results,
+                                uint32_t count,
+                                sl_hal_iadc_alignment_t alignment);
+
+/***************************************************************************//**
+ * @brief
+ *   Decode a block of raw scan FIFO words and sort the data per scan table
+ *   entry.
+ *
+ * @details
+ *   The words must carry the scan table entry ID, i.e. show_id must be set in
+ *   @ref sl_hal_iadc_init_scan_t. The data of entry n is appended at
+ *   data[n * entry_capacity + entry_count[n]] and entry_count[n] is
+ *   incremented. Words with an ID that is not a scan table entry, and words
+ *   for entries that already hold entry_capacity results, are dropped.
+ *
+ * @param[in] raw_data
+ *   Raw scan FIFO words.
+ *
+ * @param[in] count
+ *   Number of words to decode.
+ *
+ * @param[in] alignment
+ *   Alignment the words were converted with.
+ *
+ * @param[out] data
+ *   Result array of IADC0_ENTRIES * entry_capacity words.
+ *
+ * @param[in] entry_capacity
+ *   Number of results that fit in data for each scan table entry.
+ *
+ * @param[in,out] entry_count
+ *   Array of IADC0_ENTRIES result counts, one per scan table entry. Must be
+ *   cleared by the caller before the first call.
+ *
+ * @return
+ *   Number of dropped words.
+ ******************************************************************************/
+uint32_t sl_hal_iadc_sort_scan_results(const uint32_t *raw_data,
+                                       uint32_t count,
+                                       sl_hal_iadc_alignment_t alignment,
+                                       uint32_t *data,
+                                       uint32_t entry_capacity,
+                                       uint32_t *entry_count);
+
+#if defined(LDMA_PRESENT)
+/***************************************************************************//**
+ * @brief
+ *   Start draining the scan FIFO into a RAM ring buffer.
+ *
+ * @details
+ *   An LDMA channel, triggered by the scan FIFO DMA request, moves raw scan
+ *   FIFO words into stream->buffer. The descriptor links to itself, so the
+ *   channel wraps around the ring buffer without CPU involvement and without
+ *   interrupts. The DMA request is raised when the FIFO holds the data valid
+ *   level configured in @ref sl_hal_iadc_init_scan_t. Set fifo_dma_wakeup to
+ *   keep draining in EM2.
+ *
+ *   Read the words with @ref sl_hal_iadc_scan_stream_read() often enough that
+ *   the ring does not overflow. Older words are silently overwritten.
+ *
+ * @note
+ *   The LDMA must be initialized with @ref sl_hal_ldma_init() before calling
+ *   this function.
+ *
+ * @param[in] iadc
+ *   Pointer to IADC peripheral register block.
+ *
+ * @param[in] stream
+ *   Stream with buffer, size, ldma and channel set. Must remain valid until
+ *   @ref sl_hal_iadc_scan_stream_stop() is called.
+ ******************************************************************************/
+void sl_hal_iadc_scan_stream_start(IADC_TypeDef *iadc,
+                                   sl_hal_iadc_scan_stream_t *stream);
+
+/***************************************************************************//**
+ * @brief
+ *   Stop draining the scan FIFO.
+ *
+ * @param[in] stream
+ *   Stream started with @ref sl_hal_iadc_scan_stream_start().
+ ******************************************************************************/
+void sl_hal_iadc_scan_stream_stop(sl_hal_iadc_scan_stream_t *stream);
+
+/***************************************************************************//**
+ * @brief
+ *   Get the number of raw words in the ring buffer not read yet.
+ *
+ * @param[in] stream
+ *   Stream started with @ref sl_hal_iadc_scan_stream_start().
+ *
+ * @return
+ *   Number of words, at most stream->size - 1.
+ ******************************************************************************/
+uint32_t sl_hal_iadc_scan_stream_get_available(const sl_hal_iadc_scan_stream_t *stream);
+
+/***************************************************************************//**
+ * @brief
+ *   Read raw scan FIFO words from the ring buffer.
+ *
+ * @details
+ *   Decode the words with @ref sl_hal_iadc_decode_results() or
+ *   @ref sl_hal_iadc_sort_scan_results().
+ *
+ * @param[in] stream
+ *   Stream started with @ref sl_hal_iadc_scan_stream_start().
+ *
+ * @param[out] raw_data
+ *   Buffer for at least max_count words.
+ *
+ * @param[in] max_count
+ *   Maximum number of words to read.
+ *
+ * @return
+ *   Number of words read.
+ ******************************************************************************/
+uint32_t sl_hal_iadc_scan_stream_read(sl_hal_iadc_scan_stream_t *stream,
+                                      uint32_t *raw_data,
+                                      uint32_t max_count);
+#endif
+
 /***************************************************************************//**
  * @brief
  *   Get reference voltage selection.
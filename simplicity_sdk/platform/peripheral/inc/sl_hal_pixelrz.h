@@ -41,6 +41,10 @@ extern "C" {
 #include <stdbool.h>
 #include "sl_assert.h"
 #include "sl_enum.h"
+#include "sl_status.h"
+#if defined(LDMA_PRESENT)
+#include "sl_hal_ldma.h"
+#endif
 
 /***************************************************************************//**
  * @addtogroup pixelrz PIXELRZ - Serial Pixel Interface
@@ -54,6 +58,9 @@ extern "C" {
 /// Check if PIXELRZ instance is valid.
 #define SL_HAL_PIXELRZ_REF_VALID(pixelrz_ref)    (PIXELRZ_NUM(pixelrz_ref) != -1)
 
+/// Maximum number of pixels in a frame.
+#define SL_HAL_PIXELRZ_MAX_PIXELS                512
+
 /*******************************************************************************
  ********************************   ENUMS   ************************************
  ******************************************************************************/
@@ -79,6 +86,18 @@ SL_ENUM(sl_hal_pixelrz_trigger_t) {
   SL_HAL_PIXELRZ_TRIG_PRS = _PIXELRZ_CFG_TRIGSEL_PRS
 };
 
+/// Order in which the color components of a pixel are sent to the LED.
+SL_ENUM(sl_hal_pixelrz_color_order_t) {
+  /// Green, red, blue. 24 bits per pixel.
+  SL_HAL_PIXELRZ_COLOR_ORDER_GRB,
+
+  /// Red, green, blue. 24 bits per pixel.
+  SL_HAL_PIXELRZ_COLOR_ORDER_RGB,
+
+  /// Green, red, blue, white. 32 bits per pixel.
+  SL_HAL_PIXELRZ_COLOR_ORDER_GRBW
+};
+
 /*******************************************************************************
  *******************************   STRUCTS   ***********************************
  ******************************************************************************/
@@ -190,6 +209,108 @@ typedef struct {
     { 0, 0 },                     /* Reset symbol high/low times */ \
   }
 
+/// Addressable LED type. Holds the symbol timings of the LED and the symbol
+/// configuration computed from them for the last PIXELRZ clock frequency used.
+typedef struct {
+  /// Zero symbol high time in nanoseconds.
+  uint16_t t0_high_ns;
+
+  /// Zero symbol low time in nanoseconds.
+  uint16_t t0_low_ns;
+
+  /// One symbol high time in nanoseconds.
+  uint16_t t1_high_ns;
+
+  /// One symbol low time in nanoseconds.
+  uint16_t t1_low_ns;
+
+  /// Reset (latch) low time in nanoseconds.
+  uint32_t reset_low_ns;
+
+  /// Color order of the LED.
+  sl_hal_pixelrz_color_order_t color_order;
+
+  /// PIXELRZ clock frequency of the cached symbols, 0 if none are cached.
+  uint32_t cached_freq;
+
+  /// Cached zero symbol.
+  sl_hal_pixelrz_symbol_t zero_symbol;
+
+  /// Cached one symbol.
+  sl_hal_pixelrz_symbol_t one_symbol;
+
+  /// Cached reset symbol.
+  sl_hal_pixelrz_symbol_t reset_symbol;
+} sl_hal_pixelrz_led_type_t;
+
+/// WS2812B LED type.
+#define SL_HAL_PIXELRZ_LED_TYPE_WS2812B                                \
+  {                                                                    \
+    400,                             /* Zero symbol high time. */      \
+    850,                             /* Zero symbol low time. */       \
+    800,                             /* One symbol high time. */       \
+    450,                             /* One symbol low time. */        \
+    60000,                           /* Reset low time. */             \
+    SL_HAL_PIXELRZ_COLOR_ORDER_GRB,  /* Green, red, blue. */           \
+    0,                               /* No cached symbols. */          \
+    { 0, 0 },                        /* Zero symbol high/low times */  \
+    { 0, 0 },                        /* One symbol high/low times */   \
+    { 0, 0 },                        /* Reset symbol high/low times */ \
+  }
+
+/// SK6812 RGBW LED type.
+#define SL_HAL_PIXELRZ_LED_TYPE_SK6812_RGBW                            \
+  {                                                                    \
+    300,                             /* Zero symbol high time. */      \
+    900,                             /* Zero symbol low time. */       \
+    600,                             /* One symbol high time. */       \
+    600,                             /* One symbol low time. */        \
+    80000,                           /* Reset low time. */             \
+    SL_HAL_PIXELRZ_COLOR_ORDER_GRBW, /* Green, red, blue, white. */    \
+    0,                               /* No cached symbols. */          \
+    { 0, 0 },                        /* Zero symbol high/low times */  \
+    { 0, 0 },                        /* One symbol high/low times */   \
+    { 0, 0 },                        /* Reset symbol high/low times */ \
+  }
+
+#if defined(LDMA_PRESENT)
+/// LED strip streamed from double-buffered frames through LDMA.
+typedef struct {
+  /// PIXELRZ peripheral driving the strip.
+  PIXELRZ_TypeDef *pixelrz;
+
+  /// LDMA feeding the PIXELRZ FIFO.
+  LDMA_TypeDef *ldma;
+
+  /// LDMA channel used to feed the PIXELRZ FIFO.
+  uint32_t channel;
+
+  /// LDMA transfer configuration.
+  sl_hal_ldma_transfer_config_t transfer_config;
+
+  /// LDMA descriptor of the frame being sent.
+  sl_hal_ldma_descriptor_t descriptor;
+
+  /// Number of pixels in the strip.
+  uint16_t pixel_count;
+
+  /// Color order of the LEDs.
+  sl_hal_pixelrz_color_order_t color_order;
+
+  /// Frame buffers, one PIXELRZ word per pixel.
+  uint32_t *frame[2];
+
+  /// Index of the frame buffer being drawn into.
+  uint8_t back;
+
+  /// A frame has been handed to the LDMA.
+  bool started;
+
+  /// Number of frames shown.
+  uint32_t frame_count;
+} sl_hal_pixelrz_strip_t;
+#endif
+
 /*******************************************************************************
  *****************************   PROTOTYPES   **********************************
  ******************************************************************************/
@@ -227,6 +348,172 @@ sl_hal_pixelrz_symbol_t sl_hal_pixelrz_get_symbol_configuration(float time_high_
                                                                 float time_low_us,
                                                                 uint32_t freq);
 
+/***************************************************************************//**
+ * @brief
+ *   Apply the symbol timings of an LED type to a PIXELRZ configuration.
+ *
+ * @details
+ *   Sets the zero, one and reset symbols and the pixel width. The symbols are
+ *   computed with integer arithmetic and cached in the LED type, so they are
+ *   only computed again when the clock frequency changes.
+ *
+ * @param[in,out] init
+ *   A pointer to the PIXELRZ initialization structure to update.
+ *
+ * @param[in,out] led_type
+ *   A pointer to the LED type, holding the symbol cache.
+ *
+ * @param[in] freq
+ *   PIXELRZ source clock frequency.
+ ******************************************************************************/
+void sl_hal_pixelrz_apply_led_type(sl_hal_pixelrz_config_t *init,
+                                   sl_hal_pixelrz_led_type_t *led_type,
+                                   uint32_t freq);
+
+/***************************************************************************//**
+ * @brief
+ *   Convert a frame of pixel colors into PIXELRZ words.
+ *
+ * @details
+ *   Each pixel is placed in the low bits of its own 32-bit word, first
+ *   component in the most significant position. This matches a configuration
+ *   with 32-bit memory alignment and MSB first. The brightness is applied in
+ *   the same pass.
+ *
+ * @param[out] words
+ *   Destination, one word per pixel.
+ *
+ * @param[in] pixels
+ *   Pixel colors as red, green, blue bytes, followed by a white byte for
+ *   @ref SL_HAL_PIXELRZ_COLOR_ORDER_GRBW.
+ *
+ * @param[in] pixel_count
+ *   Number of pixels.
+ *
+ * @param[in] color_order
+ *   Color order of the LEDs.
+ *
+ * @param[in] brightness
+ *   Brightness scale, 255 for full brightness.
+ ******************************************************************************/
+void sl_hal_pixelrz_encode_frame(uint32_t *words,
+                                 const uint8_t *pixels,
+                                 uint16_t pixel_count,
+                                 sl_hal_pixelrz_color_order_t color_order,
+                                 uint8_t brightness);
+
+#if defined(LDMA_PRESENT)
+/***************************************************************************//**
+ * @brief
+ *   Initialize an LED strip streamed through LDMA.
+ *
+ * @note
+ *   The PIXELRZ must be initialized with @ref sl_hal_pixelrz_init() for
+ *   32-bit memory alignment, MSB first, and the pixel count and width of the
+ *   strip. The LDMA must be initialized. Both frame buffers must hold
+ *   pixel_count words and stay valid while the strip is in use.
+ *
+ * @param[out] strip
+ *   A pointer to the strip.
+ *
+ * @param[in] pixelrz
+ *   Pointer to the PIXELRZ peripheral register block.
+ *
+ * @param[in] ldma
+ *   A LDMA peripheral module.
+ *
+ * @param[in] channel
+ *   LDMA channel to use.
+ *
+ * @param[in] signal
+ *   LDMA request signal of the PIXELRZ TX FIFO.
+ *
+ * @param[in] led_type
+ *   A pointer to the LED type of the strip.
+ *
+ * @param[in] pixel_count
+ *   Number of pixels in the strip.
+ *
+ * @param[in] frame0
+ *   First frame buffer.
+ *
+ * @param[in] frame1
+ *   Second frame buffer.
+ ******************************************************************************/
+void sl_hal_pixelrz_strip_init(sl_hal_pixelrz_strip_t *strip,
+                               PIXELRZ_TypeDef *pixelrz,
+                               LDMA_TypeDef *ldma,
+                               uint32_t channel,
+                               sl_hal_ldma_peripheral_signal_t signal,
+                               const sl_hal_pixelrz_led_type_t *led_type,
+                               uint16_t pixel_count,
+                               uint32_t *frame0,
+                               uint32_t *frame1);
+
+/***************************************************************************//**
+ * @brief
+ *   Encode a frame of pixel colors into the frame buffer being drawn into.
+ *
+ * @details
+ *   The frame buffer being sent is not touched, so this can run while the
+ *   previous frame is still streaming.
+ *
+ * @param[in] strip
+ *   A pointer to the strip.
+ *
+ * @param[in] pixels
+ *   Pixel colors, see @ref sl_hal_pixelrz_encode_frame().
+ *
+ * @param[in] brightness
+ *   Brightness scale, 255 for full brightness.
+ ******************************************************************************/
+void sl_hal_pixelrz_strip_draw(sl_hal_pixelrz_strip_t *strip,
+                               const uint8_t *pixels,
+                               uint8_t brightness);
+
+/***************************************************************************//**
+ * @brief
+ *   Get the frame buffer being drawn into, to write PIXELRZ words directly.
+ *
+ * @param[in] strip
+ *   A pointer to the strip.
+ *
+ * @return
+ *   The back frame buffer, pixel_count words.
+ ******************************************************************************/
+uint32_t *sl_hal_pixelrz_strip_get_back_buffer(sl_hal_pixelrz_strip_t *strip);
+
+/***************************************************************************//**
+ * @brief
+ *   Check whether the previous frame is still being handed to the PIXELRZ.
+ *
+ * @param[in] strip
+ *   A pointer to the strip.
+ *
+ * @return
+ *   True if the LDMA is still feeding the previous frame.
+ ******************************************************************************/
+bool sl_hal_pixelrz_strip_is_busy(sl_hal_pixelrz_strip_t *strip);
+
+/***************************************************************************//**
+ * @brief
+ *   Show the frame drawn into the back buffer.
+ *
+ * @details
+ *   Swaps the frame buffers and starts the LDMA transfer of the new frame to
+ *   the PIXELRZ FIFO. With software trigger, the frame transmission is
+ *   triggered as well. This is the only CPU involvement per frame.
+ *
+ * @param[in] strip
+ *   A pointer to the strip.
+ *
+ * @return
+ *   SL_STATUS_OK if the frame was started, SL_STATUS_BUSY if the previous
+ *   frame is still being transferred.
+ ******************************************************************************/
+sl_status_t sl_hal_pixelrz_strip_show(sl_hal_pixelrz_strip_t *strip);
+#endif
+
 /***************************************************************************//**
  * @brief
  *   Wait for ongoing sync of register(s) to the low-frequency domain to complete.
@@ -635,6 +922,40 @@ __INLINE uint32_t sl_hal_pixelrz_get_enabled_pending_interrupts(PIXELRZ_TypeDef
  *
  *  @endcode
  *
+ *  Animations can stream whole frames through LDMA. The symbols of an LED
+ *  type are computed once per clock frequency, and each frame costs one call
+ *  to encode it and one to show it. The PIXELRZ must use 32-bit memory
+ *  alignment and MSB first.
+ *
+ *  @code{.c}
+ *  {
+ *    static sl_hal_pixelrz_led_type_t ws2812b = SL_HAL_PIXELRZ_LED_TYPE_WS2812B;
+ *    static uint32_t frames[2][PIXELRZ_PIXEL_COUNT];
+ *    static sl_hal_pixelrz_strip_t strip;
+ *    uint8_t colors[PIXELRZ_PIXEL_COUNT * 3];
+ *
+ *    init_serial.msb_first_enable = true;
+ *    init_serial.memalign_32b_enable = true;
+ *    init_serial.pixel_number = PIXELRZ_PIXEL_COUNT;
+ *    sl_hal_pixelrz_apply_led_type(&init_serial, &ws2812b, freq);
+ *    sl_hal_pixelrz_init(PIXELRZ0, &init_serial);
+ *    sl_hal_pixelrz_enable(PIXELRZ0);
+ *
+ *    sl_hal_pixelrz_strip_init(&strip, PIXELRZ0, LDMA0, 0,
+ *                              SL_HAL_LDMA_PERIPHERAL_SIGNAL_PIXELRZ0REQ_TXF,
+ *                              &ws2812b, PIXELRZ_PIXEL_COUNT,
+ *                              frames[0], frames[1]);
+ *
+ *    while (1) {
+ *      // Render the next frame into colors[] while the previous one streams.
+ *      sl_hal_pixelrz_strip_draw(&strip, colors, 255);
+ *      while (sl_hal_pixelrz_strip_show(&strip) == SL_STATUS_BUSY) {
+ *      }
+ *    }
+ *  }
+ *
+ *  @endcode
+ *
  * @} (end addtogroup pixelrz)
  ******************************************************************************/
 /* *INDENT-ON* */
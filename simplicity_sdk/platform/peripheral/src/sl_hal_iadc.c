@@ -36,6 +36,7 @@
 #include "sl_common.h"
 #include "sl_hal_system.h"
 #include <stddef.h>
+#include <string.h>
 
 /*******************************************************************************
  ******************************   DEFINES   ************************************
@@ -107,6 +108,27 @@
 static sl_hal_iadc_result_t sl_hal_iadc_convert_raw_data_to_result(uint32_t raw_data,
                                                                    sl_hal_iadc_alignment_t alignment);
 
+/***************************************************************************//**
+ * @brief
+ *   Get the shifts used to decode raw FIFO words with a given alignment.
+ *
+ * @details
+ *   A right aligned word holds the ID in bits 31:24 and a 24 bit two's
+ *   complement value in bits 23:0. A left aligned word holds the data in
+ *   bits 31:8 and the ID in bits 7:0. Both are decoded branch-free as
+ *     data = ((((raw >> data_shift) & 0xFFFFFF) ^ sign_bit) - sign_bit) << data_shift
+ *     id   = (raw >> id_shift) & 0xFF
+ *
+ * @param[in] alignment The alignment mode of the IADC data.
+ * @param[out] data_shift Position of the data field.
+ * @param[out] sign_bit Sign bit of a right aligned value, 0 if left aligned.
+ * @param[out] id_shift Position of the ID field.
+ ******************************************************************************/
+static void sl_hal_iadc_get_decode_shifts(sl_hal_iadc_alignment_t alignment,
+                                          uint32_t *data_shift,
+                                          uint32_t *sign_bit,
+                                          uint32_t *id_shift);
+
 /*******************************************************************************
  **************************   GLOBAL FUNCTIONS   *******************************
  ******************************************************************************/
@@ -915,6 +937,129 @@ uint32_t sl_hal_iadc_get_reference_voltage(sl_hal_iadc_voltage_reference_t refer
   return ref_voltage;
 }
 
+/***************************************************************************//**
+ * Decode a block of raw FIFO words into results.
+ ******************************************************************************/
+void sl_hal_iadc_decode_results(const uint32_t *raw_data,
+                                sl_hal_iadc_result_t *results,
+                                uint32_t count,
+                                sl_hal_iadc_alignment_t alignment)
+{
+  uint32_t data_shift, sign_bit, id_shift;
+
+  sl_hal_iadc_get_decode_shifts(alignment, &data_shift, &sign_bit, &id_shift);
+
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t raw = raw_data[i];
+
+    results[i].data = ((((raw >> data_shift) & 0x00FFFFFFUL) ^ sign_bit) - sign_bit)
+                      << data_shift;
+    results[i].id   = (uint8_t)(raw >> id_shift);
+  }
+}
+
+/***************************************************************************//**
+ * Decode a block of raw scan FIFO words and sort the data per scan table
+ * entry.
+ ******************************************************************************/
+uint32_t sl_hal_iadc_sort_scan_results(const uint32_t *raw_data,
+                                       uint32_t count,
+                                       sl_hal_iadc_alignment_t alignment,
+                                       uint32_t *data,
+                                       uint32_t entry_capacity,
+                                       uint32_t *entry_count)
+{
+  uint32_t data_shift, sign_bit, id_shift;
+  uint32_t dropped = 0;
+
+  sl_hal_iadc_get_decode_shifts(alignment, &data_shift, &sign_bit, &id_shift);
+
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t raw = raw_data[i];
+    uint32_t id  = (raw >> id_shift) & 0xFFUL;
+
+    if ((id >= IADC0_ENTRIES) || (entry_count[id] >= entry_capacity)) {
+      dropped++;
+      continue;
+    }
+    data[(id * entry_capacity) + entry_count[id]] =
+      ((((raw >> data_shift) & 0x00FFFFFFUL) ^ sign_bit) - sign_bit) << data_shift;
+    entry_count[id]++;
+  }
+
+  return dropped;
+}
+
+#if defined(LDMA_PRESENT)
+/***************************************************************************//**
+ * Start draining the scan FIFO into a RAM ring buffer.
+ ******************************************************************************/
+void sl_hal_iadc_scan_stream_start(IADC_TypeDef *iadc,
+                                   sl_hal_iadc_scan_stream_t *stream)
+{
+  sl_hal_ldma_transfer_config_t transfer_config =
+    SL_HAL_LDMA_TRANSFER_CFG_PERIPHERAL(SL_HAL_LDMA_PERIPHERAL_SIGNAL_IADC0_IADC_SCAN);
+  sl_hal_ldma_descriptor_t descriptor =
+    SL_HAL_LDMA_DESCRIPTOR_LINKREL_P2M(SL_HAL_LDMA_CTRL_SIZE_WORD,
+                                       &iadc->SCANFIFODATA,
+                                       stream->buffer,
+                                       stream->size,
+                                       0);
+
+  EFM_ASSERT(iadc == IADC0);
+  EFM_ASSERT(stream->buffer != NULL);
+  EFM_ASSERT((stream->size >= 2UL)
+             && (stream->size <= SL_HAL_LDMA_DESCRIPTOR_MAX_XFER_SIZE));
+
+  stream->read_index = 0;
+  stream->descriptor = descriptor;
+
+  sl_hal_ldma_init_transfer(stream->ldma, stream->channel, &transfer_config, &stream->descriptor);
+  sl_hal_ldma_start_transfer(stream->ldma, stream->channel);
+}
+
+/***************************************************************************//**
+ * Stop draining the scan FIFO.
+ ******************************************************************************/
+void sl_hal_iadc_scan_stream_stop(sl_hal_iadc_scan_stream_t *stream)
+{
+  sl_hal_ldma_stop_transfer(stream->ldma, stream->channel);
+}
+
+/***************************************************************************//**
+ * Get the number of raw words in the ring buffer not read yet.
+ ******************************************************************************/
+uint32_t sl_hal_iadc_scan_stream_get_available(const sl_hal_iadc_scan_stream_t *stream)
+{
+  uint32_t write_index = (stream->ldma->CH[stream->channel].DST - (uint32_t)stream->buffer)
+                         / sizeof(uint32_t);
+
+  if (write_index >= stream->size) {
+    write_index = 0;
+  }
+
+  return (write_index + stream->size - stream->read_index) % stream->size;
+}
+
+/***************************************************************************//**
+ * Read raw scan FIFO words from the ring buffer.
+ ******************************************************************************/
+uint32_t sl_hal_iadc_scan_stream_read(sl_hal_iadc_scan_stream_t *stream,
+                                      uint32_t *raw_data,
+                                      uint32_t max_count)
+{
+  uint32_t count = SL_MIN(sl_hal_iadc_scan_stream_get_available(stream), max_count);
+  uint32_t first = SL_MIN(count, stream->size - stream->read_index);
+
+  memcpy(raw_data, &stream->buffer[stream->read_index], first * sizeof(uint32_t));
+  memcpy(&raw_data[first], stream->buffer, (count - first) * sizeof(uint32_t));
+
+  stream->read_index = (stream->read_index + count) % stream->size;
+
+  return count;
+}
+#endif
+
 static sl_hal_iadc_result_t sl_hal_iadc_convert_raw_data_to_result(uint32_t raw_data,
                                                                    sl_hal_iadc_alignment_t alignment)
 {
@@ -952,4 +1097,29 @@ static sl_hal_iadc_result_t sl_hal_iadc_convert_raw_data_to_result(uint32_t raw_
   return result;
 }
 
+static void sl_hal_iadc_get_decode_shifts(sl_hal_iadc_alignment_t alignment,
+                                          uint32_t *data_shift,
+                                          uint32_t *sign_bit,
+                                          uint32_t *id_shift)
+{
+  switch (alignment) {
+    case SL_HAL_IADC_ALIGNMENT_LEFT_12:
+#if defined(IADC_SINGLEFIFOCFG_ALIGNMENT_RIGHT16)
+    case SL_HAL_IADC_ALIGNMENT_LEFT_16:
+#endif
+#if defined(IADC_SINGLEFIFOCFG_ALIGNMENT_RIGHT20)
+    case SL_HAL_IADC_ALIGNMENT_LEFT_20:
+#endif
+      *data_shift = 8;
+      *sign_bit   = 0;
+      *id_shift   = 0;
+      break;
+    default:
+      *data_shift = 0;
+      *sign_bit   = 0x00800000UL;
+      *id_shift   = 24;
+      break;
+  }
+}
+
 #endif /* defined(IADC_COUNT) && (IADC_COUNT > 0) */
@@ -42,6 +42,19 @@
  * @{
  ******************************************************************************/
 
+/*******************************************************************************
+ **************************   LOCAL FUNCTIONS   ********************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * @brief
+ *   Convert a time in nanoseconds to PIXELRZ clock cycles.
+ ******************************************************************************/
+static uint16_t ns_to_cycles(uint32_t time_ns, uint32_t freq)
+{
+  return (uint16_t)(((uint64_t)time_ns * freq) / 1000000000ULL);
+}
+
 /*******************************************************************************
  **************************   GLOBAL FUNCTIONS   *******************************
  ******************************************************************************/
@@ -124,5 +137,187 @@ sl_hal_pixelrz_symbol_t sl_hal_pixelrz_get_symbol_configuration(float time_high_
   return symbol;
 }
 
+/***************************************************************************//**
+ * @brief
+ *   Apply the symbol timings of an LED type to a PIXELRZ configuration.
+ ******************************************************************************/
+void sl_hal_pixelrz_apply_led_type(sl_hal_pixelrz_config_t *init,
+                                   sl_hal_pixelrz_led_type_t *led_type,
+                                   uint32_t freq)
+{
+  EFM_ASSERT(init);
+  EFM_ASSERT(led_type);
+  EFM_ASSERT(freq > 0);
+
+  if (led_type->cached_freq != freq) {
+    led_type->zero_symbol.high_time = ns_to_cycles(led_type->t0_high_ns, freq);
+    led_type->zero_symbol.low_time = ns_to_cycles(led_type->t0_low_ns, freq);
+    led_type->one_symbol.high_time = ns_to_cycles(led_type->t1_high_ns, freq);
+    led_type->one_symbol.low_time = ns_to_cycles(led_type->t1_low_ns, freq);
+    led_type->reset_symbol.high_time = 0;
+    led_type->reset_symbol.low_time = ns_to_cycles(led_type->reset_low_ns, freq);
+    led_type->cached_freq = freq;
+  }
+
+  init->zero_symbol = led_type->zero_symbol;
+  init->one_symbol = led_type->one_symbol;
+  init->reset_symbol = led_type->reset_symbol;
+  init->pixel_width = (led_type->color_order == SL_HAL_PIXELRZ_COLOR_ORDER_GRBW) ? 32 : 24;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Convert a frame of pixel colors into PIXELRZ words.
+ ******************************************************************************/
+void sl_hal_pixelrz_encode_frame(uint32_t *words,
+                                 const uint8_t *pixels,
+                                 uint16_t pixel_count,
+                                 sl_hal_pixelrz_color_order_t color_order,
+                                 uint8_t brightness)
+{
+  uint32_t scale = (uint32_t)brightness + 1U;
+  uint32_t r, g, b, w;
+
+  EFM_ASSERT(words);
+  EFM_ASSERT(pixels);
+
+  switch (color_order) {
+    case SL_HAL_PIXELRZ_COLOR_ORDER_GRB:
+      for (uint16_t i = 0; i < pixel_count; i++, pixels += 3) {
+        r = (pixels[0] * scale) >> 8;
+        g = (pixels[1] * scale) >> 8;
+        b = (pixels[2] * scale) >> 8;
+        words[i] = (g << 16) | (r << 8) | b;
+      }
+      break;
+
+    case SL_HAL_PIXELRZ_COLOR_ORDER_RGB:
+      for (uint16_t i = 0; i < pixel_count; i++, pixels += 3) {
+        r = (pixels[0] * scale) >> 8;
+        g = (pixels[1] * scale) >> 8;
+        b = (pixels[2] * scale) >> 8;
+        words[i] = (r << 16) | (g << 8) | b;
+      }
+      break;
+
+    case SL_HAL_PIXELRZ_COLOR_ORDER_GRBW:
+      for (uint16_t i = 0; i < pixel_count; i++, pixels += 4) {
+        r = (pixels[0] * scale) >> 8;
+        g = (pixels[1] * scale) >> 8;
+        b = (pixels[2] * scale) >> 8;
+        w = (pixels[3] * scale) >> 8;
+        words[i] = (g << 24) | (r << 16) | (b << 8) | w;
+      }
+      break;
+
+    default:
+      EFM_ASSERT(false);
+      break;
+  }
+}
+
+#if defined(LDMA_PRESENT)
+/***************************************************************************//**
+ * @brief
+ *   Initialize an LED strip streamed through LDMA.
+ ******************************************************************************/
+void sl_hal_pixelrz_strip_init(sl_hal_pixelrz_strip_t *strip,
+                               PIXELRZ_TypeDef *pixelrz,
+                               LDMA_TypeDef *ldma,
+                               uint32_t channel,
+                               sl_hal_ldma_peripheral_signal_t signal,
+                               const sl_hal_pixelrz_led_type_t *led_type,
+                               uint16_t pixel_count,
+                               uint32_t *frame0,
+                               uint32_t *frame1)
+{
+  sl_hal_ldma_transfer_config_t transfer_config = SL_HAL_LDMA_TRANSFER_CFG_PERIPHERAL(signal);
+  sl_hal_ldma_descriptor_t descriptor = SL_HAL_LDMA_DESCRIPTOR_SINGLE_M2P(SL_HAL_LDMA_CTRL_SIZE_WORD,
+                                                                         frame0,
+                                                                         &pixelrz->TXDATA,
+                                                                         pixel_count);
+
+  EFM_ASSERT(strip);
+  EFM_ASSERT(SL_HAL_PIXELRZ_REF_VALID(pixelrz));
+  EFM_ASSERT(led_type);
+  EFM_ASSERT((pixel_count > 0) && (pixel_count <= SL_HAL_PIXELRZ_MAX_PIXELS));
+  EFM_ASSERT(frame0 && frame1 && (frame0 != frame1));
+
+  strip->pixelrz = pixelrz;
+  strip->ldma = ldma;
+  strip->channel = channel;
+  strip->transfer_config = transfer_config;
+  strip->descriptor = descriptor;
+  strip->pixel_count = pixel_count;
+  strip->color_order = led_type->color_order;
+  strip->frame[0] = frame0;
+  strip->frame[1] = frame1;
+  strip->back = 0;
+  strip->started = false;
+  strip->frame_count = 0;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Encode a frame of pixel colors into the frame buffer being drawn into.
+ ******************************************************************************/
+void sl_hal_pixelrz_strip_draw(sl_hal_pixelrz_strip_t *strip,
+                               const uint8_t *pixels,
+                               uint8_t brightness)
+{
+  sl_hal_pixelrz_encode_frame(strip->frame[strip->back],
+                              pixels,
+                              strip->pixel_count,
+                              strip->color_order,
+                              brightness);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Get the frame buffer being drawn into.
+ ******************************************************************************/
+uint32_t *sl_hal_pixelrz_strip_get_back_buffer(sl_hal_pixelrz_strip_t *strip)
+{
+  return strip->frame[strip->back];
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Check whether the previous frame is still being handed to the PIXELRZ.
+ ******************************************************************************/
+bool sl_hal_pixelrz_strip_is_busy(sl_hal_pixelrz_strip_t *strip)
+{
+  return strip->started && !sl_hal_ldma_transfer_is_done(strip->ldma, strip->channel);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Show the frame drawn into the back buffer.
+ ******************************************************************************/
+sl_status_t sl_hal_pixelrz_strip_show(sl_hal_pixelrz_strip_t *strip)
+{
+  if (sl_hal_pixelrz_strip_is_busy(strip)) {
+    return SL_STATUS_BUSY;
+  }
+
+  // The frame drawn becomes the one being sent, drawing moves to the other.
+  strip->descriptor.xfer.src_addr = (uint32_t)strip->frame[strip->back];
+  strip->back ^= 1;
+
+  sl_hal_ldma_init_transfer(strip->ldma, strip->channel, &strip->transfer_config, &strip->descriptor);
+  sl_hal_ldma_start_transfer(strip->ldma, strip->channel);
+  strip->started = true;
+
+  if ((strip->pixelrz->CFG & _PIXELRZ_CFG_TRIGSEL_MASK)
+      == ((uint32_t)SL_HAL_PIXELRZ_TRIG_SW << _PIXELRZ_CFG_TRIGSEL_SHIFT)) {
+    sl_hal_pixelrz_enable_tx(strip->pixelrz);
+  }
+
+  strip->frame_count++;
+
+  return SL_STATUS_OK;
+}
+#endif
+
 /** @} (end addtogroup pixelrz) */
 #endif /* defined(PIXELRZ_COUNT) && (PIXELRZ_COUNT > 0) */
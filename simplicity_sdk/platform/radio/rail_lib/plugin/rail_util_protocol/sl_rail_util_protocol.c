@@ -47,25 +47,31 @@ static RAIL_Status_t sl_rail_util_protocol_config_proprietary(RAIL_Handle_t hand
 }
 
 #if RAIL_SUPPORTS_PROTOCOL_BLE && SL_RAIL_UTIL_PROTOCOL_BLE_ENABLE
+// Override BLE's default timings to get rid of the default rx search timeout
+static const RAIL_StateTiming_t sl_rail_util_protocol_ble_timings = {
+  .idleToRx = SL_RAIL_UTIL_PROTOCOL_BLE_TIMING_IDLE_TO_RX_US,
+  .txToRx = SL_RAIL_UTIL_PROTOCOL_BLE_TIMING_TX_TO_RX_US,
+  .idleToTx = SL_RAIL_UTIL_PROTOCOL_BLE_TIMING_IDLE_TO_TX_US,
+  .rxToTx = SL_RAIL_UTIL_PROTOCOL_BLE_TIMING_RX_TO_TX_US,
+  .rxSearchTimeout = SL_RAIL_UTIL_PROTOCOL_BLE_TIMING_RX_SEARCH_TIMEOUT_AFTER_IDLE_ENABLE
+                     ? SL_RAIL_UTIL_PROTOCOL_BLE_TIMING_RX_SEARCH_TIMEOUT_AFTER_IDLE_US
+                     : 0U,
+  .txToRxSearchTimeout = SL_RAIL_UTIL_PROTOCOL_BLE_TIMING_RX_SEARCH_TIMEOUT_AFTER_TX_ENABLE
+                         ? SL_RAIL_UTIL_PROTOCOL_BLE_TIMING_RX_SEARCH_TIMEOUT_AFTER_TX_US
+                         : 0U,
+};
+
 static RAIL_Status_t sl_rail_util_protocol_config_ble(RAIL_Handle_t handle,
-                                                      sl_rail_util_protocol_type_t protocol)
+                                                      sl_rail_util_protocol_type_t protocol,
+                                                      bool init)
 {
   RAIL_Status_t status;
-  // Override BLE's default timings to get rid of the default rx search timeout
-  RAIL_StateTiming_t timings = {
-    .idleToRx = SL_RAIL_UTIL_PROTOCOL_BLE_TIMING_IDLE_TO_RX_US,
-    .txToRx = SL_RAIL_UTIL_PROTOCOL_BLE_TIMING_TX_TO_RX_US,
-    .idleToTx = SL_RAIL_UTIL_PROTOCOL_BLE_TIMING_IDLE_TO_TX_US,
-    .rxToTx = SL_RAIL_UTIL_PROTOCOL_BLE_TIMING_RX_TO_TX_US,
-    .rxSearchTimeout = SL_RAIL_UTIL_PROTOCOL_BLE_TIMING_RX_SEARCH_TIMEOUT_AFTER_IDLE_ENABLE
-                       ? SL_RAIL_UTIL_PROTOCOL_BLE_TIMING_RX_SEARCH_TIMEOUT_AFTER_IDLE_US
-                       : 0U,
-    .txToRxSearchTimeout = SL_RAIL_UTIL_PROTOCOL_BLE_TIMING_RX_SEARCH_TIMEOUT_AFTER_TX_ENABLE
-                           ? SL_RAIL_UTIL_PROTOCOL_BLE_TIMING_RX_SEARCH_TIMEOUT_AFTER_TX_US
-                           : 0U,
-  };
+  // RAIL_SetStateTiming() writes back the timings actually applied
+  RAIL_StateTiming_t timings = sl_rail_util_protocol_ble_timings;
 
-  (void) RAIL_BLE_Init(handle);
+  if (init) {
+    (void) RAIL_BLE_Init(handle);
+  }
   switch (protocol) {
     case SL_RAIL_UTIL_PROTOCOL_BLE_1MBPS:
       status = RAIL_BLE_ConfigPhy1MbpsViterbi(handle);
@@ -97,54 +103,58 @@ static RAIL_Status_t sl_rail_util_protocol_config_ble(RAIL_Handle_t handle,
 #endif
 
 #if RAIL_SUPPORTS_IEEE802154_BAND_2P4 && SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_ENABLE
+static const RAIL_IEEE802154_Config_t sl_rail_util_protocol_ieee802154_2p4ghz_config = {
+  .addresses = NULL,
+  .ackConfig = {
+    .enable = SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_AUTO_ACK_ENABLE,
+    .ackTimeout = SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_AUTO_ACK_TIMEOUT_US,
+    .rxTransitions = {
+      .success = SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_AUTO_ACK_RX_TRANSITION_STATE,
+      .error = RAIL_RF_STATE_IDLE // this parameter ignored
+    },
+    .txTransitions = {
+      .success = SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_AUTO_ACK_TX_TRANSITION_STATE,
+      .error = RAIL_RF_STATE_IDLE // this parameter ignored
+    }
+  },
+  .timings = {
+    .idleToTx = SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_TIMING_IDLE_TO_TX_US,
+    .idleToRx = SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_TIMING_IDLE_TO_RX_US,
+    .rxToTx = SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_TIMING_RX_TO_TX_US,
+    // Make txToRx slightly lower than desired to make sure we get to
+    // RX in time.
+    .txToRx = SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_TIMING_TX_TO_RX_US,
+    .rxSearchTimeout = SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_TIMING_RX_SEARCH_TIMEOUT_AFTER_IDLE_ENABLE
+                       ? SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_TIMING_RX_SEARCH_TIMEOUT_AFTER_IDLE_US
+                       : 0,
+    .txToRxSearchTimeout = SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_TIMING_RX_SEARCH_TIMEOUT_AFTER_TX_ENABLE
+                           ? SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_TIMING_RX_SEARCH_TIMEOUT_AFTER_TX_US
+                           : 0
+  },
+  .framesMask = 0U // enable appropriate mask bits
+                | (SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_ACCEPT_BEACON_FRAME_ENABLE
+                   ? RAIL_IEEE802154_ACCEPT_BEACON_FRAMES : 0U)
+                | (SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_ACCEPT_DATA_FRAME_ENABLE
+                   ? RAIL_IEEE802154_ACCEPT_DATA_FRAMES : 0U)
+                | (SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_ACCEPT_ACK_FRAME_ENABLE
+                   ? RAIL_IEEE802154_ACCEPT_ACK_FRAMES : 0U)
+                | (SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_ACCEPT_COMMAND_FRAME_ENABLE
+                   ? RAIL_IEEE802154_ACCEPT_COMMAND_FRAMES : 0U),
+  // Enable promiscous mode since no PANID or destination address is
+  // specified.
+  .promiscuousMode = SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_PROMISCUOUS_MODE_ENABLE,
+  .isPanCoordinator = SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_PAN_COORDINATOR_ENABLE,
+  .defaultFramePendingInOutgoingAcks = SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_DEFAULT_FRAME_PENDING_STATE,
+};
+
 static RAIL_Status_t sl_rail_util_protocol_config_ieee802154_2p4ghz(RAIL_Handle_t handle,
-                                                                    sl_rail_util_protocol_type_t protocol)
+                                                                    sl_rail_util_protocol_type_t protocol,
+                                                                    bool init)
 {
   RAIL_Status_t status;
-  RAIL_IEEE802154_Config_t config = {
-    .addresses = NULL,
-    .ackConfig = {
-      .enable = SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_AUTO_ACK_ENABLE,
-      .ackTimeout = SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_AUTO_ACK_TIMEOUT_US,
-      .rxTransitions = {
-        .success = SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_AUTO_ACK_RX_TRANSITION_STATE,
-        .error = RAIL_RF_STATE_IDLE // this parameter ignored
-      },
-      .txTransitions = {
-        .success = SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_AUTO_ACK_TX_TRANSITION_STATE,
-        .error = RAIL_RF_STATE_IDLE // this parameter ignored
-      }
-    },
-    .timings = {
-      .idleToTx = SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_TIMING_IDLE_TO_TX_US,
-      .idleToRx = SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_TIMING_IDLE_TO_RX_US,
-      .rxToTx = SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_TIMING_RX_TO_TX_US,
-      // Make txToRx slightly lower than desired to make sure we get to
-      // RX in time.
-      .txToRx = SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_TIMING_TX_TO_RX_US,
-      .rxSearchTimeout = SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_TIMING_RX_SEARCH_TIMEOUT_AFTER_IDLE_ENABLE
-                         ? SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_TIMING_RX_SEARCH_TIMEOUT_AFTER_IDLE_US
-                         : 0,
-      .txToRxSearchTimeout = SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_TIMING_RX_SEARCH_TIMEOUT_AFTER_TX_ENABLE
-                             ? SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_TIMING_RX_SEARCH_TIMEOUT_AFTER_TX_US
-                             : 0
-    },
-    .framesMask = 0U // enable appropriate mask bits
-                  | (SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_ACCEPT_BEACON_FRAME_ENABLE
-                     ? RAIL_IEEE802154_ACCEPT_BEACON_FRAMES : 0U)
-                  | (SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_ACCEPT_DATA_FRAME_ENABLE
-                     ? RAIL_IEEE802154_ACCEPT_DATA_FRAMES : 0U)
-                  | (SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_ACCEPT_ACK_FRAME_ENABLE
-                     ? RAIL_IEEE802154_ACCEPT_ACK_FRAMES : 0U)
-                  | (SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_ACCEPT_COMMAND_FRAME_ENABLE
-                     ? RAIL_IEEE802154_ACCEPT_COMMAND_FRAMES : 0U),
-    // Enable promiscous mode since no PANID or destination address is
-    // specified.
-    .promiscuousMode = SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_PROMISCUOUS_MODE_ENABLE,
-    .isPanCoordinator = SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_PAN_COORDINATOR_ENABLE,
-    .defaultFramePendingInOutgoingAcks = SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_DEFAULT_FRAME_PENDING_STATE,
-  };
-  status = RAIL_IEEE802154_Init(handle, &config);
+  status = init
+           ? RAIL_IEEE802154_Init(handle, &sl_rail_util_protocol_ieee802154_2p4ghz_config)
+           : RAIL_STATUS_NO_ERROR;
   if (RAIL_STATUS_NO_ERROR == status) {
     switch (protocol) {
       case SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ:
@@ -174,54 +184,58 @@ static RAIL_Status_t sl_rail_util_protocol_config_ieee802154_2p4ghz(RAIL_Handle_
 #endif // RAIL_FEAT_2G4_RADIO
 
 #if RAIL_SUPPORTS_SUBGHZ_BAND && SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_ENABLE
+static const RAIL_IEEE802154_Config_t sl_rail_util_protocol_ieee802154_gb868_config = {
+  .addresses = NULL,
+  .ackConfig = {
+    .enable = SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_AUTO_ACK_ENABLE,
+    .ackTimeout = SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_AUTO_ACK_TIMEOUT_US,
+    .rxTransitions = {
+      .success = SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_AUTO_ACK_RX_TRANSITION_STATE,
+      .error = RAIL_RF_STATE_IDLE // this parameter ignored
+    },
+    .txTransitions = {
+      .success = SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_AUTO_ACK_TX_TRANSITION_STATE,
+      .error = RAIL_RF_STATE_IDLE // this parameter ignored
+    }
+  },
+  .timings = {
+    .idleToTx = SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_TIMING_IDLE_TO_TX_US,
+    .idleToRx = SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_TIMING_IDLE_TO_RX_US,
+    .rxToTx = SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_TIMING_RX_TO_TX_US,
+    // Make txToRx slightly lower than desired to make sure we get to
+    // RX in time.
+    .txToRx = SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_TIMING_TX_TO_RX_US,
+    .rxSearchTimeout = SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_TIMING_RX_SEARCH_TIMEOUT_AFTER_IDLE_ENABLE
+                       ? SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_TIMING_RX_SEARCH_TIMEOUT_AFTER_IDLE_US
+                       : 0,
+    .txToRxSearchTimeout = SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_TIMING_RX_SEARCH_TIMEOUT_AFTER_TX_ENABLE
+                           ? SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_TIMING_RX_SEARCH_TIMEOUT_AFTER_TX_US
+                           : 0
+  },
+  .framesMask = 0U // enable appropriate mask bits
+                | (SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_ACCEPT_BEACON_FRAME_ENABLE
+                   ? RAIL_IEEE802154_ACCEPT_BEACON_FRAMES : 0U)
+                | (SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_ACCEPT_DATA_FRAME_ENABLE
+                   ? RAIL_IEEE802154_ACCEPT_DATA_FRAMES : 0U)
+                | (SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_ACCEPT_ACK_FRAME_ENABLE
+                   ? RAIL_IEEE802154_ACCEPT_ACK_FRAMES : 0U)
+                | (SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_ACCEPT_COMMAND_FRAME_ENABLE
+                   ? RAIL_IEEE802154_ACCEPT_COMMAND_FRAMES : 0U),
+  // Enable promiscous mode since no PANID or destination address is
+  // specified.
+  .promiscuousMode = SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_PROMISCUOUS_MODE_ENABLE,
+  .isPanCoordinator = SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_PAN_COORDINATOR_ENABLE,
+  .defaultFramePendingInOutgoingAcks = SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_DEFAULT_FRAME_PENDING_STATE,
+};
+
 static RAIL_Status_t sl_rail_util_protocol_config_ieee802154_gb868(RAIL_Handle_t handle,
-                                                                   sl_rail_util_protocol_type_t protocol)
+                                                                   sl_rail_util_protocol_type_t protocol,
+                                                                   bool init)
 {
   RAIL_Status_t status;
-  RAIL_IEEE802154_Config_t config = {
-    .addresses = NULL,
-    .ackConfig = {
-      .enable = SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_AUTO_ACK_ENABLE,
-      .ackTimeout = SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_AUTO_ACK_TIMEOUT_US,
-      .rxTransitions = {
-        .success = SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_AUTO_ACK_RX_TRANSITION_STATE,
-        .error = RAIL_RF_STATE_IDLE // this parameter ignored
-      },
-      .txTransitions = {
-        .success = SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_AUTO_ACK_TX_TRANSITION_STATE,
-        .error = RAIL_RF_STATE_IDLE // this parameter ignored
-      }
-    },
-    .timings = {
-      .idleToTx = SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_TIMING_IDLE_TO_TX_US,
-      .idleToRx = SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_TIMING_IDLE_TO_RX_US,
-      .rxToTx = SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_TIMING_RX_TO_TX_US,
-      // Make txToRx slightly lower than desired to make sure we get to
-      // RX in time.
-      .txToRx = SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_TIMING_TX_TO_RX_US,
-      .rxSearchTimeout = SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_TIMING_RX_SEARCH_TIMEOUT_AFTER_IDLE_ENABLE
-                         ? SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_TIMING_RX_SEARCH_TIMEOUT_AFTER_IDLE_US
-                         : 0,
-      .txToRxSearchTimeout = SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_TIMING_RX_SEARCH_TIMEOUT_AFTER_TX_ENABLE
-                             ? SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_TIMING_RX_SEARCH_TIMEOUT_AFTER_TX_US
-                             : 0
-    },
-    .framesMask = 0U // enable appropriate mask bits
-                  | (SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_ACCEPT_BEACON_FRAME_ENABLE
-                     ? RAIL_IEEE802154_ACCEPT_BEACON_FRAMES : 0U)
-                  | (SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_ACCEPT_DATA_FRAME_ENABLE
-                     ? RAIL_IEEE802154_ACCEPT_DATA_FRAMES : 0U)
-                  | (SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_ACCEPT_ACK_FRAME_ENABLE
-                     ? RAIL_IEEE802154_ACCEPT_ACK_FRAMES : 0U)
-                  | (SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_ACCEPT_COMMAND_FRAME_ENABLE
-                     ? RAIL_IEEE802154_ACCEPT_COMMAND_FRAMES : 0U),
-    // Enable promiscous mode since no PANID or destination address is
-    // specified.
-    .promiscuousMode = SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_PROMISCUOUS_MODE_ENABLE,
-    .isPanCoordinator = SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_PAN_COORDINATOR_ENABLE,
-    .defaultFramePendingInOutgoingAcks = SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_DEFAULT_FRAME_PENDING_STATE,
-  };
-  status = RAIL_IEEE802154_Init(handle, &config);
+  status = init
+           ? RAIL_IEEE802154_Init(handle, &sl_rail_util_protocol_ieee802154_gb868_config)
+           : RAIL_STATUS_NO_ERROR;
   if (RAIL_STATUS_NO_ERROR == status) {
     switch (protocol) {
       case SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_915MHZ:
@@ -245,48 +259,52 @@ static RAIL_Status_t sl_rail_util_protocol_config_ieee802154_gb868(RAIL_Handle_t
 #endif // RAIL_FEAT_SUBGIG_RADIO
 
 #if RAIL_SUPPORTS_SUBGHZ_BAND && SL_RAIL_UTIL_PROTOCOL_ZWAVE_ENABLE
+static const RAIL_ZWAVE_Config_t sl_rail_util_protocol_zwave_config = {
+  .options = 0U // enable appropriate mask bits
+             | (SL_RAIL_UTIL_PROTOCOL_ZWAVE_PROMISCUOUS_MODE_ENABLE
+                ? RAIL_ZWAVE_OPTION_PROMISCUOUS_MODE : 0U)
+             | (SL_RAIL_UTIL_PROTOCOL_ZWAVE_DETECT_BEAM_FRAME_ENABLE
+                ? RAIL_ZWAVE_OPTION_DETECT_BEAM_FRAMES : 0U)
+             | (SL_RAIL_UTIL_PROTOCOL_ZWAVE_NODE_ID_FILTERING_ENABLE
+                ? RAIL_ZWAVE_OPTION_NODE_ID_FILTERING : 0U)
+             | (SL_RAIL_UTIL_PROTOCOL_ZWAVE_PROMISCUOUS_BEAM_MODE_ENABLE
+                ? RAIL_ZWAVE_OPTION_PROMISCUOUS_BEAM_MODE : 0U),
+  .ackConfig = {
+    .enable = SL_RAIL_UTIL_PROTOCOL_ZWAVE_AUTO_ACK_ENABLE,
+    .ackTimeout = SL_RAIL_UTIL_PROTOCOL_ZWAVE_AUTO_ACK_TIMEOUT_US,
+    .rxTransitions = {
+      .success = SL_RAIL_UTIL_PROTOCOL_ZWAVE_AUTO_ACK_RX_TRANSITION_STATE,
+      .error = RAIL_RF_STATE_IDLE // this parameter ignored
+    },
+    .txTransitions = {
+      .success = SL_RAIL_UTIL_PROTOCOL_ZWAVE_AUTO_ACK_TX_TRANSITION_STATE,
+      .error = RAIL_RF_STATE_IDLE // this parameter ignored
+    }
+  },
+  .timings = {
+    .idleToTx = SL_RAIL_UTIL_PROTOCOL_ZWAVE_TIMING_IDLE_TO_TX_US,
+    .idleToRx = SL_RAIL_UTIL_PROTOCOL_ZWAVE_TIMING_IDLE_TO_RX_US,
+    .rxToTx = SL_RAIL_UTIL_PROTOCOL_ZWAVE_TIMING_RX_TO_TX_US,
+    // Make txToRx slightly lower than desired to make sure we get to
+    // RX in time.
+    .txToRx = SL_RAIL_UTIL_PROTOCOL_ZWAVE_TIMING_TX_TO_RX_US,
+    .rxSearchTimeout = SL_RAIL_UTIL_PROTOCOL_ZWAVE_TIMING_RX_SEARCH_TIMEOUT_AFTER_IDLE_ENABLE
+                       ? SL_RAIL_UTIL_PROTOCOL_ZWAVE_TIMING_RX_SEARCH_TIMEOUT_AFTER_IDLE_US
+                       : 0,
+    .txToRxSearchTimeout = SL_RAIL_UTIL_PROTOCOL_ZWAVE_TIMING_RX_SEARCH_TIMEOUT_AFTER_TX_ENABLE
+                           ? SL_RAIL_UTIL_PROTOCOL_ZWAVE_TIMING_RX_SEARCH_TIMEOUT_AFTER_TX_US
+                           : 0
+  }
+};
+
 static RAIL_Status_t sl_rail_util_protocol_config_zwave(RAIL_Handle_t handle,
-                                                        sl_rail_util_protocol_type_t protocol)
+                                                        sl_rail_util_protocol_type_t protocol,
+                                                        bool init)
 {
   RAIL_Status_t status;
-  RAIL_ZWAVE_Config_t config = {
-    .options = 0U // enable appropriate mask bits
-               | (SL_RAIL_UTIL_PROTOCOL_ZWAVE_PROMISCUOUS_MODE_ENABLE
-                  ? RAIL_ZWAVE_OPTION_PROMISCUOUS_MODE : 0U)
-               | (SL_RAIL_UTIL_PROTOCOL_ZWAVE_DETECT_BEAM_FRAME_ENABLE
-                  ? RAIL_ZWAVE_OPTION_DETECT_BEAM_FRAMES : 0U)
-               | (SL_RAIL_UTIL_PROTOCOL_ZWAVE_NODE_ID_FILTERING_ENABLE
-                  ? RAIL_ZWAVE_OPTION_NODE_ID_FILTERING : 0U)
-               | (SL_RAIL_UTIL_PROTOCOL_ZWAVE_PROMISCUOUS_BEAM_MODE_ENABLE
-                  ? RAIL_ZWAVE_OPTION_PROMISCUOUS_BEAM_MODE : 0U),
-    .ackConfig = {
-      .enable = SL_RAIL_UTIL_PROTOCOL_ZWAVE_AUTO_ACK_ENABLE,
-      .ackTimeout = SL_RAIL_UTIL_PROTOCOL_ZWAVE_AUTO_ACK_TIMEOUT_US,
-      .rxTransitions = {
-        .success = SL_RAIL_UTIL_PROTOCOL_ZWAVE_AUTO_ACK_RX_TRANSITION_STATE,
-        .error = RAIL_RF_STATE_IDLE // this parameter ignored
-      },
-      .txTransitions = {
-        .success = SL_RAIL_UTIL_PROTOCOL_ZWAVE_AUTO_ACK_TX_TRANSITION_STATE,
-        .error = RAIL_RF_STATE_IDLE // this parameter ignored
-      }
-    },
-    .timings = {
-      .idleToTx = SL_RAIL_UTIL_PROTOCOL_ZWAVE_TIMING_IDLE_TO_TX_US,
-      .idleToRx = SL_RAIL_UTIL_PROTOCOL_ZWAVE_TIMING_IDLE_TO_RX_US,
-      .rxToTx = SL_RAIL_UTIL_PROTOCOL_ZWAVE_TIMING_RX_TO_TX_US,
-      // Make txToRx slightly lower than desired to make sure we get to
-      // RX in time.
-      .txToRx = SL_RAIL_UTIL_PROTOCOL_ZWAVE_TIMING_TX_TO_RX_US,
-      .rxSearchTimeout = SL_RAIL_UTIL_PROTOCOL_ZWAVE_TIMING_RX_SEARCH_TIMEOUT_AFTER_IDLE_ENABLE
-                         ? SL_RAIL_UTIL_PROTOCOL_ZWAVE_TIMING_RX_SEARCH_TIMEOUT_AFTER_IDLE_US
-                         : 0,
-      .txToRxSearchTimeout = SL_RAIL_UTIL_PROTOCOL_ZWAVE_TIMING_RX_SEARCH_TIMEOUT_AFTER_TX_ENABLE
-                             ? SL_RAIL_UTIL_PROTOCOL_ZWAVE_TIMING_RX_SEARCH_TIMEOUT_AFTER_TX_US
-                             : 0
-    }
-  };
-  status = RAIL_ZWAVE_Init(handle, &config);
+  status = init
+           ? RAIL_ZWAVE_Init(handle, &sl_rail_util_protocol_zwave_config)
+           : RAIL_STATUS_NO_ERROR;
   if (RAIL_STATUS_NO_ERROR == status) {
     switch (protocol) {
       case SL_RAIL_UTIL_PROTOCOL_ZWAVE_ANZ: // Australia
@@ -347,7 +365,8 @@ static RAIL_Status_t sl_rail_util_protocol_config_zwave(RAIL_Handle_t handle,
         break;
     }
   }
-  if (RAIL_STATUS_NO_ERROR == status) {
+  // A region change keeps the node ID already in use
+  if (init && (RAIL_STATUS_NO_ERROR == status)) {
     status = RAIL_ZWAVE_SetNodeId(handle, RAIL_ZWAVE_NODE_ID_DEFAULT);
   }
   if (RAIL_STATUS_NO_ERROR != status) {
@@ -374,31 +393,42 @@ static RAIL_Status_t sl_rail_util_protocol_config_sidewalk(RAIL_Handle_t handle,
 }
 #endif // RAIL_SUPPORTS_PROTOCOL_SIDEWALK && SL_RAIL_UTIL_PROTOCOL_SIDEWALK_ENABLE
 
-RAIL_Status_t sl_rail_util_protocol_config(RAIL_Handle_t handle,
-                                           sl_rail_util_protocol_type_t protocol)
+// Protocols sharing a RAIL protocol initialization
+typedef enum {
+  SL_RAIL_UTIL_PROTOCOL_FAMILY_INVALID,
+  SL_RAIL_UTIL_PROTOCOL_FAMILY_PROPRIETARY,
+  SL_RAIL_UTIL_PROTOCOL_FAMILY_BLE,
+  SL_RAIL_UTIL_PROTOCOL_FAMILY_IEEE802154_2P4GHZ,
+  SL_RAIL_UTIL_PROTOCOL_FAMILY_IEEE802154_GB868,
+  SL_RAIL_UTIL_PROTOCOL_FAMILY_ZWAVE,
+  SL_RAIL_UTIL_PROTOCOL_FAMILY_SIDEWALK,
+} sl_rail_util_protocol_family_t;
+
+// Family of a protocol, SL_RAIL_UTIL_PROTOCOL_FAMILY_INVALID if not enabled
+static sl_rail_util_protocol_family_t sl_rail_util_protocol_family(sl_rail_util_protocol_type_t protocol)
 {
   switch (protocol) {
     case SL_RAIL_UTIL_PROTOCOL_PROPRIETARY:
-      return sl_rail_util_protocol_config_proprietary(handle);
+      return SL_RAIL_UTIL_PROTOCOL_FAMILY_PROPRIETARY;
 #if RAIL_SUPPORTS_PROTOCOL_BLE && SL_RAIL_UTIL_PROTOCOL_BLE_ENABLE
     case SL_RAIL_UTIL_PROTOCOL_BLE_1MBPS:
     case SL_RAIL_UTIL_PROTOCOL_BLE_2MBPS:
     case SL_RAIL_UTIL_PROTOCOL_BLE_CODED_125KBPS:
     case SL_RAIL_UTIL_PROTOCOL_BLE_CODED_500KBPS:
     case SL_RAIL_UTIL_PROTOCOL_BLE_QUUPPA_1MBPS:
-      return sl_rail_util_protocol_config_ble(handle, protocol);
+      return SL_RAIL_UTIL_PROTOCOL_FAMILY_BLE;
 #endif
 #if RAIL_SUPPORTS_IEEE802154_BAND_2P4  && SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_ENABLE
     case SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ:
     case SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_ANTDIV:
     case SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_COEX:
     case SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_ANTDIV_COEX:
-      return sl_rail_util_protocol_config_ieee802154_2p4ghz(handle, protocol);
+      return SL_RAIL_UTIL_PROTOCOL_FAMILY_IEEE802154_2P4GHZ;
 #endif
 #if RAIL_SUPPORTS_SUBGHZ_BAND && SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_ENABLE
     case SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_915MHZ:
     case SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_863MHZ:
-      return sl_rail_util_protocol_config_ieee802154_gb868(handle, protocol);
+      return SL_RAIL_UTIL_PROTOCOL_FAMILY_IEEE802154_GB868;
 #endif
 #if RAIL_SUPPORTS_SUBGHZ_BAND && SL_RAIL_UTIL_PROTOCOL_ZWAVE_ENABLE
     case SL_RAIL_UTIL_PROTOCOL_ZWAVE_ANZ: // Australia
@@ -418,13 +448,152 @@ RAIL_Status_t sl_rail_util_protocol_config(RAIL_Handle_t handle,
     case SL_RAIL_UTIL_PROTOCOL_ZWAVE_EU_LR1: // European Union, Long Range 1
     case SL_RAIL_UTIL_PROTOCOL_ZWAVE_EU_LR2: // European Union, Long Range 2
     case SL_RAIL_UTIL_PROTOCOL_ZWAVE_EU_LR_END_DEVICE: // EU, LR End Device
-      return sl_rail_util_protocol_config_zwave(handle, protocol);
+      return SL_RAIL_UTIL_PROTOCOL_FAMILY_ZWAVE;
 #endif
 #if RAIL_SUPPORTS_PROTOCOL_SIDEWALK && SL_RAIL_UTIL_PROTOCOL_SIDEWALK_ENABLE
     case SL_RAIL_UTIL_PROTOCOL_SIDEWALK_2GFSK_50KBPS:
+      return SL_RAIL_UTIL_PROTOCOL_FAMILY_SIDEWALK;
+#endif
+    default:
+      return SL_RAIL_UTIL_PROTOCOL_FAMILY_INVALID;
+  }
+}
+
+// Configure a protocol. Without init, the family of the protocol must already
+// be initialized on the handle and only the PHY or region is applied.
+static RAIL_Status_t sl_rail_util_protocol_apply(RAIL_Handle_t handle,
+                                                 sl_rail_util_protocol_type_t protocol,
+                                                 bool init)
+{
+  switch (sl_rail_util_protocol_family(protocol)) {
+    case SL_RAIL_UTIL_PROTOCOL_FAMILY_PROPRIETARY:
+      (void) init;
+      return sl_rail_util_protocol_config_proprietary(handle);
+#if RAIL_SUPPORTS_PROTOCOL_BLE && SL_RAIL_UTIL_PROTOCOL_BLE_ENABLE
+    case SL_RAIL_UTIL_PROTOCOL_FAMILY_BLE:
+      return sl_rail_util_protocol_config_ble(handle, protocol, init);
+#endif
+#if RAIL_SUPPORTS_IEEE802154_BAND_2P4  && SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_ENABLE
+    case SL_RAIL_UTIL_PROTOCOL_FAMILY_IEEE802154_2P4GHZ:
+      return sl_rail_util_protocol_config_ieee802154_2p4ghz(handle, protocol, init);
+#endif
+#if RAIL_SUPPORTS_SUBGHZ_BAND && SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_ENABLE
+    case SL_RAIL_UTIL_PROTOCOL_FAMILY_IEEE802154_GB868:
+      return sl_rail_util_protocol_config_ieee802154_gb868(handle, protocol, init);
+#endif
+#if RAIL_SUPPORTS_SUBGHZ_BAND && SL_RAIL_UTIL_PROTOCOL_ZWAVE_ENABLE
+    case SL_RAIL_UTIL_PROTOCOL_FAMILY_ZWAVE:
+      return sl_rail_util_protocol_config_zwave(handle, protocol, init);
+#endif
+#if RAIL_SUPPORTS_PROTOCOL_SIDEWALK && SL_RAIL_UTIL_PROTOCOL_SIDEWALK_ENABLE
+    case SL_RAIL_UTIL_PROTOCOL_FAMILY_SIDEWALK:
       return sl_rail_util_protocol_config_sidewalk(handle, protocol);
 #endif
     default:
       return RAIL_STATUS_INVALID_PARAMETER;
   }
 }
+
+// Undo the protocol initialization of a family
+static void sl_rail_util_protocol_deinit(RAIL_Handle_t handle,
+                                         sl_rail_util_protocol_family_t family)
+{
+  switch (family) {
+#if RAIL_SUPPORTS_PROTOCOL_BLE && SL_RAIL_UTIL_PROTOCOL_BLE_ENABLE
+    case SL_RAIL_UTIL_PROTOCOL_FAMILY_BLE:
+      (void) RAIL_BLE_Deinit(handle);
+      break;
+#endif
+#if (RAIL_SUPPORTS_IEEE802154_BAND_2P4 && SL_RAIL_UTIL_PROTOCOL_IEEE802154_2P4GHZ_ENABLE) \
+  || (RAIL_SUPPORTS_SUBGHZ_BAND && SL_RAIL_UTIL_PROTOCOL_IEEE802154_GB868_ENABLE)
+    case SL_RAIL_UTIL_PROTOCOL_FAMILY_IEEE802154_2P4GHZ:
+    case SL_RAIL_UTIL_PROTOCOL_FAMILY_IEEE802154_GB868:
+      (void) RAIL_IEEE802154_Deinit(handle);
+      break;
+#endif
+#if RAIL_SUPPORTS_SUBGHZ_BAND && SL_RAIL_UTIL_PROTOCOL_ZWAVE_ENABLE
+    case SL_RAIL_UTIL_PROTOCOL_FAMILY_ZWAVE:
+      (void) RAIL_ZWAVE_Deinit(handle);
+      break;
+#endif
+    default:
+      (void) handle;
+      break;
+  }
+}
+
+RAIL_Status_t sl_rail_util_protocol_config(RAIL_Handle_t handle,
+                                           sl_rail_util_protocol_type_t protocol)
+{
+  return sl_rail_util_protocol_apply(handle, protocol, true);
+}
+
+void sl_rail_util_protocol_context_init(sl_rail_util_protocol_context_t *context,
+                                        RAIL_Handle_t handle)
+{
+  context->handle = handle;
+  context->protocol = SL_RAIL_UTIL_PROTOCOL_PROPRIETARY;
+  context->applied = false;
+  sl_rail_util_protocol_context_clear_stats(context);
+}
+
+bool sl_rail_util_protocol_is_supported(sl_rail_util_protocol_type_t protocol)
+{
+  return sl_rail_util_protocol_family(protocol) != SL_RAIL_UTIL_PROTOCOL_FAMILY_INVALID;
+}
+
+RAIL_Status_t sl_rail_util_protocol_context_switch(sl_rail_util_protocol_context_t *context,
+                                                   sl_rail_util_protocol_type_t protocol)
+{
+  RAIL_Status_t status = RAIL_STATUS_NO_ERROR;
+  RAIL_Time_t start = RAIL_GetTime();
+  RAIL_Time_t elapsed;
+  sl_rail_util_protocol_family_t family = sl_rail_util_protocol_family(protocol);
+  sl_rail_util_protocol_family_t current = context->applied
+                                           ? sl_rail_util_protocol_family(context->protocol)
+                                           : SL_RAIL_UTIL_PROTOCOL_FAMILY_INVALID;
+
+  if (family == SL_RAIL_UTIL_PROTOCOL_FAMILY_INVALID) {
+    return RAIL_STATUS_INVALID_PARAMETER;
+  }
+
+  if (context->applied && (context->protocol == protocol)) {
+    // Nothing to apply
+    context->unchanged_count++;
+    return RAIL_STATUS_NO_ERROR;
+  }
+
+  if (family == current) {
+    // Same protocol initialization, only apply the PHY or region
+    status = sl_rail_util_protocol_apply(context->handle, protocol, false);
+    context->fast_switch_count++;
+  } else {
+    if (current != SL_RAIL_UTIL_PROTOCOL_FAMILY_INVALID) {
+      sl_rail_util_protocol_deinit(context->handle, current);
+    }
+    status = sl_rail_util_protocol_apply(context->handle, protocol, true);
+    context->full_switch_count++;
+  }
+
+  // On failure the protocol has been deinitialized, start over next time
+  context->applied = (RAIL_STATUS_NO_ERROR == status);
+  context->protocol = protocol;
+
+  elapsed = RAIL_GetTime() - start;
+  context->last_switch_us = elapsed;
+  context->total_switch_us += elapsed;
+  if (elapsed > context->max_switch_us) {
+    context->max_switch_us = elapsed;
+  }
+  return status;
+}
+
+void sl_rail_util_protocol_context_clear_stats(sl_rail_util_protocol_context_t *context)
+{
+  context->full_switch_count = 0U;
+  context->fast_switch_count = 0U;
+  context->unchanged_count = 0U;
+  context->last_switch_us = 0U;
+  context->max_switch_us = 0U;
+  context->total_switch_us = 0U;
+}
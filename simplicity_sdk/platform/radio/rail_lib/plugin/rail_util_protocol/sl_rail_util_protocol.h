@@ -49,6 +49,66 @@ extern "C" {
 RAIL_Status_t sl_rail_util_protocol_config(RAIL_Handle_t handle,
                                            sl_rail_util_protocol_type_t protocol);
 
+/**
+ * State of a RAIL handle switched between protocols.
+ *
+ * The protocol configurations are built once at compile time. Switching to a
+ * protocol of the family already initialized on the handle, for instance
+ * between BLE PHYs, between 2.4 GHz IEEE 802.15.4 radio configurations or
+ * between Z-Wave regions, only applies the PHY or region. Switching to the
+ * protocol already in use does nothing.
+ */
+typedef struct sl_rail_util_protocol_context {
+  RAIL_Handle_t handle;                  ///< RAIL handle being switched
+  sl_rail_util_protocol_type_t protocol; ///< Protocol last applied
+  bool applied;                          ///< Whether protocol is applied
+  uint32_t full_switch_count;            ///< Switches with protocol initialization
+  uint32_t fast_switch_count;            ///< Switches applying only the PHY or region
+  uint32_t unchanged_count;              ///< Switches to the protocol in use
+  uint32_t last_switch_us;               ///< Duration of the last switch
+  uint32_t max_switch_us;                ///< Longest switch
+  uint64_t total_switch_us;              ///< Sum of all switch durations
+} sl_rail_util_protocol_context_t;
+
+/**
+ * Check whether a protocol is enabled in this configuration.
+ *
+ * @param[in] protocol The radio configuration type to check.
+ * @return true if the protocol can be configured.
+ */
+bool sl_rail_util_protocol_is_supported(sl_rail_util_protocol_type_t protocol);
+
+/**
+ * Initialize a protocol switching context.
+ *
+ * @param[out] context The context to initialize.
+ * @param[in] handle The RAIL handle the context switches.
+ */
+void sl_rail_util_protocol_context_init(sl_rail_util_protocol_context_t *context,
+                                        RAIL_Handle_t handle);
+
+/**
+ * Switch the radio of a context to a protocol, applying only what differs
+ * from the protocol in use.
+ *
+ * Switching to another protocol family deinitializes the previous one first.
+ * The channel configuration of SL_RAIL_UTIL_PROTOCOL_PROPRIETARY is owned by
+ * the application and must be applied again after switching to it.
+ *
+ * @param[in] context The protocol switching context.
+ * @param[in] protocol The radio configuration type to switch to.
+ * @return A status code indicating success of the function call.
+ */
+RAIL_Status_t sl_rail_util_protocol_context_switch(sl_rail_util_protocol_context_t *context,
+                                                   sl_rail_util_protocol_type_t protocol);
+
+/**
+ * Clear the switch statistics of a context.
+ *
+ * @param[in] context The protocol switching context.
+ */
+void sl_rail_util_protocol_context_clear_stats(sl_rail_util_protocol_context_t *context);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,74 @@
+/***************************************************************************//**
+ * @file
+ * @brief Coulomb Counter configuration file.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+#ifndef SL_COULOMB_COUNTER_CONFIG_H
+#define SL_COULOMB_COUNTER_CONFIG_H
+
+// <h>Coulomb Counter Configuration
+
+// <o SL_COULOMB_COUNTER_TAG_COUNT> Number of consumption tags <1-32>
+// <i> Tag 0 collects the consumption while no other tag is active.
+// <i> Default: 4
+#define SL_COULOMB_COUNTER_TAG_COUNT  4
+
+// <o SL_COULOMB_COUNTER_SAMPLE_PERIOD_MS> Sampling period in milliseconds <0-3600000>
+// <i> The counters are sampled periodically so that they never wrap more than
+// <i> once between two samples. Set to 0 to only sample on energy mode
+// <i> transitions and explicit calls.
+// <i> Default: 60000
+#define SL_COULOMB_COUNTER_SAMPLE_PERIOD_MS  60000
+
+// <q SL_COULOMB_COUNTER_AUTO_CALIBRATE> Calibrate at initialization
+// <i> Default: 1
+#define SL_COULOMB_COUNTER_AUTO_CALIBRATE  1
+
+// <o SL_COULOMB_COUNTER_CAL_LOAD_LOW> Low calibration load
+// <SL_HAL_DCDC_COULOMB_COUNTER_CAL_LOAD0=> 0.25 mA
+// <SL_HAL_DCDC_COULOMB_COUNTER_CAL_LOAD1=> 0.50 mA
+// <SL_HAL_DCDC_COULOMB_COUNTER_CAL_LOAD2=> 1.00 mA
+// <SL_HAL_DCDC_COULOMB_COUNTER_CAL_LOAD3=> 1.50 mA
+// <i> Default: SL_HAL_DCDC_COULOMB_COUNTER_CAL_LOAD1
+#define SL_COULOMB_COUNTER_CAL_LOAD_LOW  SL_HAL_DCDC_COULOMB_COUNTER_CAL_LOAD1
+
+// <o SL_COULOMB_COUNTER_CAL_LOAD_HIGH> High calibration load
+// <SL_HAL_DCDC_COULOMB_COUNTER_CAL_LOAD4=> 2.00 mA
+// <SL_HAL_DCDC_COULOMB_COUNTER_CAL_LOAD5=> 4.00 mA
+// <SL_HAL_DCDC_COULOMB_COUNTER_CAL_LOAD6=> 6.00 mA
+// <SL_HAL_DCDC_COULOMB_COUNTER_CAL_LOAD7=> 8.00 mA
+// <i> Default: SL_HAL_DCDC_COULOMB_COUNTER_CAL_LOAD5
+#define SL_COULOMB_COUNTER_CAL_LOAD_HIGH  SL_HAL_DCDC_COULOMB_COUNTER_CAL_LOAD5
+
+// </h>
+
+#endif /* SL_COULOMB_COUNTER_CONFIG_H */
+
+// <<< end of configuration section >>>
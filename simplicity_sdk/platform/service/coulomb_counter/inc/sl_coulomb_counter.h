@@ -0,0 +1,153 @@
+/***************************************************************************//**
+ * @file
+ * @brief Coulomb Counter API definition.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * @addtogroup coulomb_counter Coulomb Counter
+ * @brief Coulomb Counter
+ * @details
+ * ## Overview
+ *
+ * The Coulomb Counter is a platform service that turns the pulse counts of
+ * the DC-DC coulomb counter into charge, so that a device can keep track of
+ * its own battery consumption in the field.
+ *
+ * ## Calibration
+ *
+ * The charge delivered per DC-DC pulse depends on the device and on the DC-DC
+ * settings of the energy mode. It is measured for the EM0/1 and EM2/3
+ * settings by running the DC-DC with two of the on-chip calibration loads,
+ * whose currents are measured in production and stored in DEVINFO. The slope
+ * between the two points gives the charge per pulse, independently of the
+ * current drawn by the device itself. Calibration runs at initialization when
+ * SL_COULOMB_COUNTER_AUTO_CALIBRATE is enabled, and can be repeated with
+ * sl_coulomb_counter_calibrate(), for example after a temperature change.
+ *
+ * ## Attribution
+ *
+ * The consumption is attributed to the energy modes EM0, EM1 and EM2/3 and
+ * to user-defined tags. When the Power Manager is present, the counters are
+ * sampled on every energy mode transition so that the EM0/1 counter can be
+ * split between EM0 and EM1. Tags are selected with
+ * sl_coulomb_counter_set_tag(), for example around a radio transmission.
+ *
+ * ## Overflow
+ *
+ * The hardware counters wrap around. When the Sleeptimer is present, the
+ * counters are sampled every SL_COULOMB_COUNTER_SAMPLE_PERIOD_MS
+ * milliseconds so that they never wrap more than once between samples.
+ * Otherwise, sl_coulomb_counter_sample() must be called often enough by the
+ * application.
+ *
+ * The conversion and attribution are done by the functions of
+ * sl_coulomb_counter_accounting.h, which do not access the hardware.
+ *
+ * @{
+ ******************************************************************************/
+
+#ifndef SL_COULOMB_COUNTER_H
+#define SL_COULOMB_COUNTER_H
+
+#include "sl_status.h"
+#include "sl_coulomb_counter_accounting.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ * Initialize the Coulomb Counter and start counting.
+ *
+ * @return Status Code.
+ ******************************************************************************/
+sl_status_t sl_coulomb_counter_init(void);
+
+/***************************************************************************//**
+ * Calibrate the charge per pulse.
+ *
+ * @return SL_STATUS_OK if the calibration succeeded, SL_STATUS_FAIL if the
+ *         measured points were not usable. The previous calibration is kept
+ *         on failure.
+ *
+ * @note Counting is paused during calibration so that the calibration loads
+ *       are not accounted for. The calibration takes a few milliseconds.
+ ******************************************************************************/
+sl_status_t sl_coulomb_counter_calibrate(void);
+
+/***************************************************************************//**
+ * Sample the counters and account for the pulses since the last sample.
+ ******************************************************************************/
+void sl_coulomb_counter_sample(void);
+
+/***************************************************************************//**
+ * Select the tag charged for the consumption from now on.
+ *
+ * @param  tag  Tag, below SL_COULOMB_COUNTER_TAG_COUNT.
+ *
+ * @return Previously active tag, to restore it afterwards.
+ ******************************************************************************/
+sl_coulomb_counter_tag_t sl_coulomb_counter_set_tag(sl_coulomb_counter_tag_t tag);
+
+/***************************************************************************//**
+ * Get the charge consumed in an energy mode.
+ *
+ * @param  em  Energy mode.
+ *
+ * @return Charge in microamp-hours.
+ ******************************************************************************/
+uint32_t sl_coulomb_counter_get_em_charge_uah(sl_coulomb_counter_em_t em);
+
+/***************************************************************************//**
+ * Get the charge consumed while a tag was active.
+ *
+ * @param  tag  Tag.
+ *
+ * @return Charge in microamp-hours.
+ ******************************************************************************/
+uint32_t sl_coulomb_counter_get_tag_charge_uah(sl_coulomb_counter_tag_t tag);
+
+/***************************************************************************//**
+ * Get the total charge consumed since initialization.
+ *
+ * @return Charge in microamp-hours.
+ ******************************************************************************/
+uint32_t sl_coulomb_counter_get_total_charge_uah(void);
+
+/***************************************************************************//**
+ * Clear the charges accounted so far.
+ ******************************************************************************/
+void sl_coulomb_counter_clear(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} (end addtogroup coulomb_counter) */
+
+#endif /* SL_COULOMB_COUNTER_H */
@@ -0,0 +1,156 @@
+/***************************************************************************//**
+ * @file
+ * @brief Coulomb Counter charge conversion and attribution.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_COULOMB_COUNTER_ACCOUNTING_H
+#define SL_COULOMB_COUNTER_ACCOUNTING_H
+
+#include <stdint.h>
+#include "sl_coulomb_counter_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ * @addtogroup coulomb_counter
+ * @{
+ ******************************************************************************/
+
+/// Tag collecting the consumption while no other tag is active.
+#define SL_COULOMB_COUNTER_TAG_NONE  0
+
+/// Charge in picocoulombs per microamp-hour.
+#define SL_COULOMB_COUNTER_PC_PER_UAH  3600000000ULL
+
+/// Energy modes the consumption is attributed to.
+typedef enum {
+  SL_COULOMB_COUNTER_EM0 = 0,     ///< Run mode.
+  SL_COULOMB_COUNTER_EM1,         ///< Sleep mode.
+  SL_COULOMB_COUNTER_EM2,         ///< Deep sleep and stop modes.
+  SL_COULOMB_COUNTER_EM_COUNT     ///< Number of energy modes.
+} sl_coulomb_counter_em_t;
+
+/// Consumption tag, below SL_COULOMB_COUNTER_TAG_COUNT.
+typedef uint8_t sl_coulomb_counter_tag_t;
+
+/// Accounting state.
+///
+/// The coulomb counter has one counter for EM0/1 and one for EM2/3. The
+/// EM0/1 count is split between EM0 and EM1 by sampling on every energy mode
+/// transition. All charges are in picocoulombs.
+typedef struct {
+  uint32_t charge_per_pulse_pc[2];                        ///< Charge per pulse, EM0/1 and EM2/3 counters.
+  uint32_t last_count[2];                                 ///< Counter values at the last sample.
+  uint64_t em_charge_pc[SL_COULOMB_COUNTER_EM_COUNT];     ///< Charge per energy mode.
+  uint64_t tag_charge_pc[SL_COULOMB_COUNTER_TAG_COUNT];   ///< Charge per tag.
+  sl_coulomb_counter_em_t active_em;                      ///< Mode charged for the EM0/1 counter.
+  sl_coulomb_counter_tag_t active_tag;                    ///< Tag charged.
+  uint32_t samples;                                       ///< Number of samples taken.
+} sl_coulomb_counter_accounting_t;
+
+/***************************************************************************//**
+ * Compute the DC-DC pulse rate measured by a calibration run.
+ *
+ * @param pulses     Number of DC-DC pulses counted by the calibration down-counter.
+ * @param ref_count  Number of reference clock cycles counted meanwhile.
+ * @param ref_freq   Reference clock frequency in Hz.
+ *
+ * @return Pulse rate in millihertz, 0 if ref_count is 0.
+ ******************************************************************************/
+uint32_t sl_coulomb_counter_calc_pulse_rate(uint32_t pulses,
+                                            uint32_t ref_count,
+                                            uint32_t ref_freq);
+
+/***************************************************************************//**
+ * Compute the charge per pulse from two calibration points.
+ *
+ * @details
+ * The slope between the two points cancels the current drawn by the device
+ * itself during calibration.
+ *
+ * @param load_low_ua     Low calibration load current in microamps.
+ * @param rate_low_mhz    Pulse rate with the low load, in millihertz.
+ * @param load_high_ua    High calibration load current in microamps.
+ * @param rate_high_mhz   Pulse rate with the high load, in millihertz.
+ *
+ * @return Charge per pulse in picocoulombs, 0 if the points do not give a
+ *         positive slope.
+ ******************************************************************************/
+uint32_t sl_coulomb_counter_calc_charge_per_pulse(uint32_t load_low_ua,
+                                                  uint32_t rate_low_mhz,
+                                                  uint32_t load_high_ua,
+                                                  uint32_t rate_high_mhz);
+
+/***************************************************************************//**
+ * Initialize the accounting state.
+ *
+ * @details
+ * Clears all charges. The charge per pulse must be set afterwards.
+ *
+ * @param acc        Accounting state.
+ * @param em0_count  Current value of the EM0/1 counter.
+ * @param em2_count  Current value of the EM2/3 counter.
+ ******************************************************************************/
+void sl_coulomb_counter_accounting_init(sl_coulomb_counter_accounting_t *acc,
+                                        uint32_t em0_count,
+                                        uint32_t em2_count);
+
+/***************************************************************************//**
+ * Account for the pulses counted since the last sample.
+ *
+ * @details
+ * The EM0/1 pulses are charged to the active energy mode, the EM2/3 pulses to
+ * EM2, and both to the active tag. The counters may wrap once between two
+ * samples.
+ *
+ * @param acc        Accounting state.
+ * @param em0_count  Current value of the EM0/1 counter.
+ * @param em2_count  Current value of the EM2/3 counter.
+ ******************************************************************************/
+void sl_coulomb_counter_accounting_update(sl_coulomb_counter_accounting_t *acc,
+                                          uint32_t em0_count,
+                                          uint32_t em2_count);
+
+/***************************************************************************//**
+ * Convert a charge to microamp-hours.
+ *
+ * @param charge_pc  Charge in picocoulombs.
+ *
+ * @return Charge in microamp-hours, rounded down.
+ ******************************************************************************/
+uint32_t sl_coulomb_counter_pc_to_uah(uint64_t charge_pc);
+
+/** @} (end addtogroup coulomb_counter) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SL_COULOMB_COUNTER_ACCOUNTING_H */
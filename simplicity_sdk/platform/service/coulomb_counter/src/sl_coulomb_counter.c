@@ -0,0 +1,360 @@
+/***************************************************************************//**
+ * @file
+ * @brief Coulomb Counter implementation.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#if defined(SL_COMPONENT_CATALOG_PRESENT)
+#include "sl_component_catalog.h"
+#endif
+#include "sl_coulomb_counter.h"
+#include "sl_hal_dcdc_coulomb_counter.h"
+#include "sl_assert.h"
+#include "sl_core.h"
+#include "em_cmu.h"
+
+#if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
+#include "sl_power_manager.h"
+#endif
+#if defined(SL_CATALOG_SLEEPTIMER_PRESENT)
+#include "sl_sleeptimer.h"
+#endif
+
+#if defined(DCDC_COUNT) && (DCDC_COUNT > 0) && defined(DCDC_CCCTRL_CCEN)
+
+/*******************************************************************************
+ *********************************   DEFINES   *********************************
+ ******************************************************************************/
+
+// Number of DC-DC pulses timed by each calibration measurement.
+#define CAL_PULSES  100
+
+// Counter index of each DC-DC energy mode setting.
+#define COUNTER_EM0  0
+#define COUNTER_EM2  1
+
+/*******************************************************************************
+ ***************************  LOCAL VARIABLES   ********************************
+ ******************************************************************************/
+
+static sl_coulomb_counter_accounting_t accounting;
+
+#if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
+static void on_em_transition(sl_power_manager_em_t from,
+                             sl_power_manager_em_t to);
+
+static sl_power_manager_em_transition_event_handle_t em_event_handle;
+static const sl_power_manager_em_transition_event_info_t em_event_info = {
+  .event_mask = SL_POWER_MANAGER_EVENT_TRANSITION_LEAVING_EM0
+                | SL_POWER_MANAGER_EVENT_TRANSITION_LEAVING_EM1
+                | SL_POWER_MANAGER_EVENT_TRANSITION_LEAVING_EM2,
+  .on_event = on_em_transition
+};
+#endif
+
+#if defined(SL_CATALOG_SLEEPTIMER_PRESENT) && (SL_COULOMB_COUNTER_SAMPLE_PERIOD_MS > 0)
+static sl_sleeptimer_timer_handle_t sample_timer;
+#endif
+
+/*******************************************************************************
+ **************************   LOCAL FUNCTIONS   ********************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Measure the DC-DC pulse rate with a calibration load.
+ ******************************************************************************/
+static uint32_t measure_pulse_rate(sl_hal_dcdc_coulomb_counter_emode_t emode,
+                                   sl_hal_dcdc_coulomb_counter_calibration_load_level_t load_level)
+{
+  sl_hal_dcdc_coulomb_counter_calibration_config_t config = DCDC_COULOMB_COUNTER_CALIBRATION_CONFIG_DEFAULT;
+  uint32_t ref_count;
+
+  config.cal_count = CAL_PULSES;
+  config.cal_emode = emode;
+  config.cal_load_level = load_level;
+
+  sl_hal_dcdc_coulomb_counter_cal_init(config);
+  sl_hal_dcdc_coulomb_counter_cal_start();
+  ref_count = CMU_CalibrateCountGet();
+  sl_hal_dcdc_coulomb_counter_cal_stop();
+
+  return sl_coulomb_counter_calc_pulse_rate(CAL_PULSES,
+                                            ref_count,
+                                            sl_hal_dcdc_coulomb_counter_get_cal_reference_freq());
+}
+
+/***************************************************************************//**
+ * Get a calibration load current in microamps.
+ ******************************************************************************/
+static uint32_t get_cal_load_current_ua(sl_hal_dcdc_coulomb_counter_calibration_load_level_t load_level)
+{
+  // DEVINFO stores the load currents with a 200 nA LSB.
+  return ((uint32_t)sl_hal_dcdc_coulomb_counter_get_cal_load_current(load_level) + 2U) / 5U;
+}
+
+/***************************************************************************//**
+ * Measure the charge per pulse for one DC-DC energy mode setting.
+ ******************************************************************************/
+static uint32_t measure_charge_per_pulse(sl_hal_dcdc_coulomb_counter_emode_t emode)
+{
+  uint32_t rate_low = measure_pulse_rate(emode, SL_COULOMB_COUNTER_CAL_LOAD_LOW);
+  uint32_t rate_high = measure_pulse_rate(emode, SL_COULOMB_COUNTER_CAL_LOAD_HIGH);
+
+  return sl_coulomb_counter_calc_charge_per_pulse(get_cal_load_current_ua(SL_COULOMB_COUNTER_CAL_LOAD_LOW),
+                                                  rate_low,
+                                                  get_cal_load_current_ua(SL_COULOMB_COUNTER_CAL_LOAD_HIGH),
+                                                  rate_high);
+}
+
+/***************************************************************************//**
+ * Sample the counters. Must be called with interrupts disabled.
+ ******************************************************************************/
+static void sample_counters(void)
+{
+  sl_coulomb_counter_accounting_update(&accounting,
+                                       sl_hal_dcdc_coulomb_counter_get_count(SL_HAL_DCDC_COULOMB_COUNTER_EM0),
+                                       sl_hal_dcdc_coulomb_counter_get_count(SL_HAL_DCDC_COULOMB_COUNTER_EM2));
+}
+
+#if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
+/***************************************************************************//**
+ * Split the EM0/1 counter between EM0 and EM1 on energy mode transitions.
+ ******************************************************************************/
+static void on_em_transition(sl_power_manager_em_t from,
+                             sl_power_manager_em_t to)
+{
+  (void)from;
+
+  sample_counters();
+
+  // The EM0/1 counter only runs again in EM0 after a deep sleep.
+  accounting.active_em = (to == SL_POWER_MANAGER_EM1) ? SL_COULOMB_COUNTER_EM1 : SL_COULOMB_COUNTER_EM0;
+}
+#endif
+
+#if defined(SL_CATALOG_SLEEPTIMER_PRESENT) && (SL_COULOMB_COUNTER_SAMPLE_PERIOD_MS > 0)
+/***************************************************************************//**
+ * Periodic sampling, keeps the counters from wrapping twice between samples.
+ ******************************************************************************/
+static void on_sample_timeout(sl_sleeptimer_timer_handle_t *handle,
+                              void *data)
+{
+  (void)handle;
+  (void)data;
+
+  sl_coulomb_counter_sample();
+}
+#endif
+
+/*******************************************************************************
+ **************************   GLOBAL FUNCTIONS   *******************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Initialize the Coulomb Counter and start counting.
+ ******************************************************************************/
+sl_status_t sl_coulomb_counter_init(void)
+{
+  sl_hal_dcdc_coulomb_counter_config_t config = DCDC_COULOMB_COUNTER_CONFIG_DEFAULT;
+  sl_status_t status = SL_STATUS_OK;
+
+  sl_hal_dcdc_coulomb_counter_init(&config);
+  sl_hal_dcdc_coulomb_counter_enable();
+
+#if (SL_COULOMB_COUNTER_AUTO_CALIBRATE == 1)
+  status = sl_coulomb_counter_calibrate();
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+#endif
+
+  sl_hal_dcdc_coulomb_counter_clear_counters();
+  sl_hal_dcdc_coulomb_counter_wait_clear_counters();
+  sl_coulomb_counter_clear();
+
+  sl_hal_dcdc_coulomb_counter_start();
+  sl_hal_dcdc_coulomb_counter_wait_start();
+
+#if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
+  sl_power_manager_subscribe_em_transition_event(&em_event_handle, &em_event_info);
+#endif
+
+#if defined(SL_CATALOG_SLEEPTIMER_PRESENT) && (SL_COULOMB_COUNTER_SAMPLE_PERIOD_MS > 0)
+  status = sl_sleeptimer_start_periodic_timer_ms(&sample_timer,
+                                                 SL_COULOMB_COUNTER_SAMPLE_PERIOD_MS,
+                                                 on_sample_timeout,
+                                                 NULL,
+                                                 0,
+                                                 0);
+#endif
+
+  return status;
+}
+
+/***************************************************************************//**
+ * Calibrate the charge per pulse.
+ ******************************************************************************/
+sl_status_t sl_coulomb_counter_calibrate(void)
+{
+  bool running = (sl_hal_dcdc_coulomb_counter_get_status() & _DCDC_CCSTATUS_CCRUNNING_MASK) != 0U;
+  uint32_t charge_per_pulse_em0;
+  uint32_t charge_per_pulse_em2;
+  CORE_DECLARE_IRQ_STATE;
+
+  // Account for everything counted so far with the current calibration.
+  if (running) {
+    sl_coulomb_counter_sample();
+    sl_hal_dcdc_coulomb_counter_stop();
+    sl_hal_dcdc_coulomb_counter_wait_stop();
+  }
+
+  charge_per_pulse_em0 = measure_charge_per_pulse(SL_HAL_DCDC_COULOMB_COUNTER_EM0);
+  charge_per_pulse_em2 = measure_charge_per_pulse(SL_HAL_DCDC_COULOMB_COUNTER_EM2);
+
+  if (running) {
+    sl_hal_dcdc_coulomb_counter_start();
+    sl_hal_dcdc_coulomb_counter_wait_start();
+  }
+
+  if ((charge_per_pulse_em0 == 0U) || (charge_per_pulse_em2 == 0U)) {
+    return SL_STATUS_FAIL;
+  }
+
+  CORE_ENTER_ATOMIC();
+  accounting.charge_per_pulse_pc[COUNTER_EM0] = charge_per_pulse_em0;
+  accounting.charge_per_pulse_pc[COUNTER_EM2] = charge_per_pulse_em2;
+  CORE_EXIT_ATOMIC();
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Sample the counters and account for the pulses since the last sample.
+ ******************************************************************************/
+void sl_coulomb_counter_sample(void)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+  sample_counters();
+  CORE_EXIT_ATOMIC();
+}
+
+/***************************************************************************//**
+ * Select the tag charged for the consumption from now on.
+ ******************************************************************************/
+sl_coulomb_counter_tag_t sl_coulomb_counter_set_tag(sl_coulomb_counter_tag_t tag)
+{
+  sl_coulomb_counter_tag_t previous;
+  CORE_DECLARE_IRQ_STATE;
+
+  EFM_ASSERT(tag < SL_COULOMB_COUNTER_TAG_COUNT);
+
+  CORE_ENTER_ATOMIC();
+  sample_counters();
+  previous = accounting.active_tag;
+  accounting.active_tag = tag;
+  CORE_EXIT_ATOMIC();
+
+  return previous;
+}
+
+/***************************************************************************//**
+ * Get the charge consumed in an energy mode.
+ ******************************************************************************/
+uint32_t sl_coulomb_counter_get_em_charge_uah(sl_coulomb_counter_em_t em)
+{
+  uint64_t charge;
+  CORE_DECLARE_IRQ_STATE;
+
+  EFM_ASSERT(em < SL_COULOMB_COUNTER_EM_COUNT);
+
+  CORE_ENTER_ATOMIC();
+  sample_counters();
+  charge = accounting.em_charge_pc[em];
+  CORE_EXIT_ATOMIC();
+
+  return sl_coulomb_counter_pc_to_uah(charge);
+}
+
+/***************************************************************************//**
+ * Get the charge consumed while a tag was active.
+ ******************************************************************************/
+uint32_t sl_coulomb_counter_get_tag_charge_uah(sl_coulomb_counter_tag_t tag)
+{
+  uint64_t charge;
+  CORE_DECLARE_IRQ_STATE;
+
+  EFM_ASSERT(tag < SL_COULOMB_COUNTER_TAG_COUNT);
+
+  CORE_ENTER_ATOMIC();
+  sample_counters();
+  charge = accounting.tag_charge_pc[tag];
+  CORE_EXIT_ATOMIC();
+
+  return sl_coulomb_counter_pc_to_uah(charge);
+}
+
+/***************************************************************************//**
+ * Get the total charge consumed since initialization.
+ ******************************************************************************/
+uint32_t sl_coulomb_counter_get_total_charge_uah(void)
+{
+  uint64_t charge = 0;
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+  sample_counters();
+  for (uint8_t em = 0; em < SL_COULOMB_COUNTER_EM_COUNT; em++) {
+    charge += accounting.em_charge_pc[em];
+  }
+  CORE_EXIT_ATOMIC();
+
+  return sl_coulomb_counter_pc_to_uah(charge);
+}
+
+/***************************************************************************//**
+ * Clear the charges accounted so far.
+ ******************************************************************************/
+void sl_coulomb_counter_clear(void)
+{
+  sl_coulomb_counter_accounting_t previous;
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+  previous = accounting;
+  sl_coulomb_counter_accounting_init(&accounting,
+                                     sl_hal_dcdc_coulomb_counter_get_count(SL_HAL_DCDC_COULOMB_COUNTER_EM0),
+                                     sl_hal_dcdc_coulomb_counter_get_count(SL_HAL_DCDC_COULOMB_COUNTER_EM2));
+  accounting.charge_per_pulse_pc[COUNTER_EM0] = previous.charge_per_pulse_pc[COUNTER_EM0];
+  accounting.charge_per_pulse_pc[COUNTER_EM2] = previous.charge_per_pulse_pc[COUNTER_EM2];
+  accounting.active_em = previous.active_em;
+  accounting.active_tag = previous.active_tag;
+  CORE_EXIT_ATOMIC();
+}
+
+#endif /* defined(DCDC_COUNT) && (DCDC_COUNT > 0) && defined(DCDC_CCCTRL_CCEN) */
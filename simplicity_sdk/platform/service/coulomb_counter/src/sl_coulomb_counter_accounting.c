@@ -0,0 +1,104 @@
+/***************************************************************************//**
+ * @file
+ * @brief Coulomb Counter charge conversion and attribution.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include "sl_coulomb_counter_accounting.h"
+
+/***************************************************************************//**
+ * Compute the DC-DC pulse rate measured by a calibration run.
+ ******************************************************************************/
+uint32_t sl_coulomb_counter_calc_pulse_rate(uint32_t pulses,
+                                            uint32_t ref_count,
+                                            uint32_t ref_freq)
+{
+  if (ref_count == 0U) {
+    return 0U;
+  }
+
+  return (uint32_t)(((uint64_t)pulses * ref_freq * 1000U) / ref_count);
+}
+
+/***************************************************************************//**
+ * Compute the charge per pulse from two calibration points.
+ ******************************************************************************/
+uint32_t sl_coulomb_counter_calc_charge_per_pulse(uint32_t load_low_ua,
+                                                  uint32_t rate_low_mhz,
+                                                  uint32_t load_high_ua,
+                                                  uint32_t rate_high_mhz)
+{
+  if ((load_high_ua <= load_low_ua) || (rate_high_mhz <= rate_low_mhz)) {
+    return 0U;
+  }
+
+  // uA / (pulse/s) is uC per pulse, scaled to pC and for the mHz rates.
+  return (uint32_t)(((uint64_t)(load_high_ua - load_low_ua) * 1000000000ULL)
+                    / (rate_high_mhz - rate_low_mhz));
+}
+
+/***************************************************************************//**
+ * Initialize the accounting state.
+ ******************************************************************************/
+void sl_coulomb_counter_accounting_init(sl_coulomb_counter_accounting_t *acc,
+                                        uint32_t em0_count,
+                                        uint32_t em2_count)
+{
+  *acc = (sl_coulomb_counter_accounting_t){ 0 };
+  acc->last_count[0] = em0_count;
+  acc->last_count[1] = em2_count;
+  acc->active_em = SL_COULOMB_COUNTER_EM0;
+  acc->active_tag = SL_COULOMB_COUNTER_TAG_NONE;
+}
+
+/***************************************************************************//**
+ * Account for the pulses counted since the last sample.
+ ******************************************************************************/
+void sl_coulomb_counter_accounting_update(sl_coulomb_counter_accounting_t *acc,
+                                          uint32_t em0_count,
+                                          uint32_t em2_count)
+{
+  // Unsigned differences stay correct across a single counter wrap.
+  uint64_t em0_charge = (uint64_t)(em0_count - acc->last_count[0]) * acc->charge_per_pulse_pc[0];
+  uint64_t em2_charge = (uint64_t)(em2_count - acc->last_count[1]) * acc->charge_per_pulse_pc[1];
+
+  acc->last_count[0] = em0_count;
+  acc->last_count[1] = em2_count;
+
+  acc->em_charge_pc[acc->active_em] += em0_charge;
+  acc->em_charge_pc[SL_COULOMB_COUNTER_EM2] += em2_charge;
+  acc->tag_charge_pc[acc->active_tag] += em0_charge + em2_charge;
+  acc->samples++;
+}
+
+/***************************************************************************//**
+ * Convert a charge to microamp-hours.
+ ******************************************************************************/
+uint32_t sl_coulomb_counter_pc_to_uah(uint64_t charge_pc)
+{
+  return (uint32_t)(charge_pc / SL_COULOMB_COUNTER_PC_PER_UAH);
+}
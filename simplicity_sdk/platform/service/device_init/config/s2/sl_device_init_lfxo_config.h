@@ -61,6 +61,12 @@
 // <cmuLfxoStartupDelay_32KCycles=> 32K cycles
 // <i> Default: cmuLfxoStartupDelay_4KCycles
 #define SL_DEVICE_INIT_LFXO_TIMEOUT           cmuLfxoStartupDelay_4KCycles
+
+// <o SL_DEVICE_INIT_LFXO_READY_TIMEOUT_MS> Ready Wait Timeout [ms] <1-10000>
+// <i> Longest time sl_device_init_lfxo_wait_ready() waits for the crystal
+// <i> to become ready before giving up.
+// <i> Default: 2000
+#define SL_DEVICE_INIT_LFXO_READY_TIMEOUT_MS  2000
 // <<< end of configuration section >>>
 
 #endif // SL_DEVICE_INIT_LFXO_CONFIG_H
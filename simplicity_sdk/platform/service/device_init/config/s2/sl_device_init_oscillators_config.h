@@ -0,0 +1,61 @@
+/***************************************************************************//**
+ * @file
+ * @brief DEVICE_INIT_OSCILLATORS Config
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_DEVICE_INIT_OSCILLATORS_CONFIG_H
+#define SL_DEVICE_INIT_OSCILLATORS_CONFIG_H
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+// <q SL_DEVICE_INIT_OSCILLATORS_LFXO> Start LFXO
+// <i> Start the LFXO first and let it come up in the background.
+// <i> Requires the Device Init: LFXO component.
+// <i> Default: 1
+#define SL_DEVICE_INIT_OSCILLATORS_LFXO           1
+
+// <q SL_DEVICE_INIT_OSCILLATORS_HFXO> Start HFXO
+// <i> Requires the Device Init: HFXO component.
+// <i> Default: 1
+#define SL_DEVICE_INIT_OSCILLATORS_HFXO           1
+
+// <q SL_DEVICE_INIT_OSCILLATORS_DPLL> Lock DPLL
+// <i> Lock the DPLL once its reference clock is ready.
+// <i> Requires the Device Init: DPLL component.
+// <i> Default: 0
+#define SL_DEVICE_INIT_OSCILLATORS_DPLL           0
+
+// <q SL_DEVICE_INIT_OSCILLATORS_BOOT_TIMING> Record boot timing
+// <i> Record the cycle count at each oscillator milestone using the DWT
+// <i> cycle counter.
+// <i> Default: 0
+#define SL_DEVICE_INIT_OSCILLATORS_BOOT_TIMING    0
+
+// <<< end of configuration section >>>
+
+#endif // SL_DEVICE_INIT_OSCILLATORS_CONFIG_H
@@ -31,6 +31,7 @@
 #define SL_DEVICE_INIT_LFXO_H
 
 #include "sl_status.h"
+#include <stdbool.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -73,6 +74,47 @@ extern "C" {
  */
 sl_status_t sl_device_init_lfxo(void);
 
+/**
+ * Initialize LFXO and start it without waiting for it to be ready
+ *
+ * @details
+ * Configure the low frequency crystal oscillator like sl_device_init_lfxo(),
+ * and force it on so that the crystal starts up while the rest of the device
+ * initialization runs. The LFXO start-up time is several orders of magnitude
+ * longer than that of the other oscillators, so starting it first takes it
+ * off the boot critical path.
+ *
+ * Call sl_device_init_lfxo_wait_ready() before anything that needs a running
+ * LFXO, such as a DPLL referenced to it.
+ *
+ * @return Status code
+ * @retval SL_STATUS_OK LFXO initialized and started
+ */
+sl_status_t sl_device_init_lfxo_start(void);
+
+/**
+ * Wait for the LFXO started by sl_device_init_lfxo_start() to be ready
+ *
+ * @details
+ * Busy-waits on the LFXO ready flag, then returns the oscillator to on-demand
+ * operation. The wait is bounded by SL_DEVICE_INIT_LFXO_READY_TIMEOUT_MS, so a
+ * missing or broken crystal does not hang the boot.
+ *
+ * @return Status code
+ * @retval SL_STATUS_OK LFXO is ready
+ * @retval SL_STATUS_TIMEOUT LFXO did not become ready in time
+ * @retval SL_STATUS_NOT_INITIALIZED LFXO was not started with
+ *         sl_device_init_lfxo_start(), or was already waited for
+ */
+sl_status_t sl_device_init_lfxo_wait_ready(void);
+
+/**
+ * Check whether the LFXO is ready
+ *
+ * @return true if the LFXO ready flag is set
+ */
+bool sl_device_init_lfxo_is_ready(void);
+
 /**
  * @} device_init_lfxo
  * @} device_init
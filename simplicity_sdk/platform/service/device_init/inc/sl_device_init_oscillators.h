@@ -0,0 +1,125 @@
+/***************************************************************************//**
+ * @file
+ * @brief Device initialization for oscillators started in parallel.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+#ifndef SL_DEVICE_INIT_OSCILLATORS_H
+#define SL_DEVICE_INIT_OSCILLATORS_H
+
+#include <stdint.h>
+#include "sl_status.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup device_init
+ * @{
+ * @addtogroup device_init_oscillators Parallel Oscillator Initialization
+ * @brief Start the configured oscillators in parallel.
+ * @details
+ * Brings up the LFXO, HFXO and DPLL as a single step instead of one after the
+ * other, using settings in the configuration header
+ * `sl_device_init_oscillators_config.h` and the configuration headers of the
+ * individual oscillator components.
+ *
+ * The LFXO is started first and comes up in the background, since its
+ * start-up time is far longer than that of the other oscillators. The HFXO is
+ * then initialized, and the DPLL is locked once its reference clock is ready.
+ * The initialization only waits for the LFXO before locking a DPLL that uses
+ * it as reference. Otherwise, the wait is deferred to
+ * sl_device_init_oscillators_join(), which can be called after the rest of
+ * the device initialization.
+ *
+ * Use this component in place of the individual LFXO, HFXO and DPLL entries
+ * of the platform init sequence.
+ * @{
+ */
+
+/// Cycle counts at the oscillator milestones, relative to the start of
+/// sl_device_init_oscillators_start(). The counts are in CPU clock cycles,
+/// which run at the DPLL frequency after the DPLL has locked. Zero means the
+/// milestone was not reached.
+typedef struct {
+  uint32_t hfxo_ready;   ///< HFXO ready
+  uint32_t lfxo_ready;   ///< LFXO ready, once waited for
+  uint32_t dpll_locked;  ///< DPLL locked
+  uint32_t start_done;   ///< sl_device_init_oscillators_start() returned
+  uint32_t join_done;    ///< sl_device_init_oscillators_join() returned
+} sl_device_init_oscillators_timing_t;
+
+/**
+ * Start the configured oscillators
+ *
+ * @details
+ * Starts the LFXO without waiting for it, initializes the HFXO, and locks the
+ * DPLL. Waits for the LFXO only if the DPLL is referenced to it. Stops at
+ * the first oscillator that fails and returns its status.
+ *
+ * @return Status code
+ * @retval SL_STATUS_OK Oscillators started successfully
+ * @retval SL_STATUS_FAIL DPLL failed to lock
+ * @retval SL_STATUS_TIMEOUT LFXO referenced by the DPLL did not become ready
+ */
+sl_status_t sl_device_init_oscillators_start(void);
+
+/**
+ * Wait for the oscillators started by sl_device_init_oscillators_start()
+ *
+ * @details
+ * Waits for the LFXO to be ready if this has not been done already. Call it
+ * before anything that needs a running LFXO, for example before a wireless
+ * stack schedules events on the low frequency clock.
+ *
+ * @return Status code
+ * @retval SL_STATUS_OK All oscillators are ready
+ * @retval SL_STATUS_TIMEOUT LFXO did not become ready in time. It is left
+ *         forced on, and a later call waits for it again.
+ */
+sl_status_t sl_device_init_oscillators_join(void);
+
+/**
+ * Get the boot timing recorded by the oscillator initialization
+ *
+ * @note Only recorded when `SL_DEVICE_INIT_OSCILLATORS_BOOT_TIMING` is
+ *       enabled. All counts are zero otherwise.
+ *
+ * @return Pointer to the recorded cycle counts
+ */
+const sl_device_init_oscillators_timing_t *sl_device_init_oscillators_timing_get(void);
+
+/**
+ * @} device_init_oscillators
+ * @} device_init
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SL_DEVICE_INIT_OSCILLATORS_H
@@ -36,12 +36,13 @@
 #define MFG_CTUNE_ADDR 0x0FE0009CUL
 #define MFG_CTUNE_VAL  (*((uint8_t *) (MFG_CTUNE_ADDR)))
 
-sl_status_t sl_device_init_lfxo(void)
+static void lfxo_configure(bool force_enable)
 {
   CMU_LFXOInit_TypeDef lfxoInit = CMU_LFXOINIT_DEFAULT;
 
   lfxoInit.mode = SL_DEVICE_INIT_LFXO_MODE;
   lfxoInit.timeout = SL_DEVICE_INIT_LFXO_TIMEOUT;
+  lfxoInit.forceEn = force_enable;
 
   int ctune = -1;
 
@@ -65,6 +66,52 @@ sl_status_t sl_device_init_lfxo(void)
   lfxoInit.capTune = ctune;
   CMU_LFXOInit(&lfxoInit);
   CMU_LFXOPrecisionSet(SL_DEVICE_INIT_LFXO_PRECISION);
+}
+
+sl_status_t sl_device_init_lfxo(void)
+{
+  lfxo_configure(false);
+
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_device_init_lfxo_start(void)
+{
+  // Force the oscillator on so that the crystal starts up right away instead
+  // of on the first request from a clock tree
+  lfxo_configure(true);
+
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_device_init_lfxo_wait_ready(void)
+{
+  uint32_t polls;
+
+  if ((LFXO->CTRL & LFXO_CTRL_FORCEEN) == 0U) {
+    return SL_STATUS_NOT_INITIALIZED;
+  }
+
+  // Each poll takes at least one core clock cycle, so this bounds the wait
+  // to no less than the configured time
+  polls = (SystemCoreClockGet() / 1000U) * SL_DEVICE_INIT_LFXO_READY_TIMEOUT_MS;
+
+  while ((LFXO->STATUS & LFXO_STATUS_RDY) == 0U) {
+    if (polls == 0U) {
+      // Leave the oscillator forced on, the crystal may still start
+      return SL_STATUS_TIMEOUT;
+    }
+    polls--;
+  }
+
+  // Hand the oscillator back to on-demand operation, clock requests keep it
+  // running from here on
+  LFXO->CTRL_CLR = LFXO_CTRL_FORCEEN;
 
   return SL_STATUS_OK;
 }
+
+bool sl_device_init_lfxo_is_ready(void)
+{
+  return (LFXO->STATUS & LFXO_STATUS_RDY) != 0U;
+}
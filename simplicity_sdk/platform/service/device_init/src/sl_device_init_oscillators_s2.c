@@ -0,0 +1,154 @@
+/***************************************************************************//**
+ * @file
+ * @brief Device initialization for oscillators started in parallel.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+#include "sl_device_init_oscillators.h"
+#include "sl_device_init_oscillators_config.h"
+
+#include "em_device.h"
+#include "em_cmu.h"
+
+#if (SL_DEVICE_INIT_OSCILLATORS_LFXO == 1)
+#include "sl_device_init_lfxo.h"
+#endif
+#if (SL_DEVICE_INIT_OSCILLATORS_HFXO == 1)
+#include "sl_device_init_hfxo.h"
+#endif
+#if (SL_DEVICE_INIT_OSCILLATORS_DPLL == 1)
+#include "sl_device_init_dpll.h"
+#include "sl_device_init_dpll_config.h"
+#endif
+
+#include <stdbool.h>
+
+// The DPLL can only lock once the LFXO is running when referenced to it
+#if (SL_DEVICE_INIT_OSCILLATORS_DPLL == 1) && (SL_DEVICE_INIT_OSCILLATORS_LFXO == 1)
+#define DPLL_NEEDS_LFXO  (SL_DEVICE_INIT_DPLL_REFCLK == cmuSelect_LFXO)
+#else
+#define DPLL_NEEDS_LFXO  false
+#endif
+
+static sl_device_init_oscillators_timing_t timing;
+
+#if (SL_DEVICE_INIT_OSCILLATORS_LFXO == 1)
+static bool lfxo_pending = false;
+#endif
+
+#if (SL_DEVICE_INIT_OSCILLATORS_BOOT_TIMING == 1)
+static uint32_t timing_start;
+
+static void timing_begin(void)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  timing_start = DWT->CYCCNT;
+}
+
+#define TIMING_MARK(milestone)  (timing.milestone = DWT->CYCCNT - timing_start)
+#else
+#define timing_begin()
+#define TIMING_MARK(milestone)
+#endif
+
+#if (SL_DEVICE_INIT_OSCILLATORS_LFXO == 1)
+static sl_status_t lfxo_join(void)
+{
+  sl_status_t status;
+
+  if (lfxo_pending) {
+    status = sl_device_init_lfxo_wait_ready();
+    if (status != SL_STATUS_OK) {
+      // Still pending, a later join waits again
+      return status;
+    }
+    lfxo_pending = false;
+    TIMING_MARK(lfxo_ready);
+  }
+
+  return SL_STATUS_OK;
+}
+#endif
+
+sl_status_t sl_device_init_oscillators_start(void)
+{
+  sl_status_t status = SL_STATUS_OK;
+
+  timing_begin();
+
+#if (SL_DEVICE_INIT_OSCILLATORS_LFXO == 1)
+  // Slowest oscillator first, it keeps starting up while the rest runs
+  status = sl_device_init_lfxo_start();
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+  lfxo_pending = true;
+#endif
+
+#if (SL_DEVICE_INIT_OSCILLATORS_HFXO == 1)
+  status = sl_device_init_hfxo();
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+  TIMING_MARK(hfxo_ready);
+#endif
+
+#if (SL_DEVICE_INIT_OSCILLATORS_DPLL == 1)
+#if (SL_DEVICE_INIT_OSCILLATORS_LFXO == 1)
+  if (DPLL_NEEDS_LFXO) {
+    status = lfxo_join();
+    if (status != SL_STATUS_OK) {
+      return status;
+    }
+  }
+#endif
+  status = sl_device_init_dpll();
+  TIMING_MARK(dpll_locked);
+#endif
+
+  TIMING_MARK(start_done);
+
+  return status;
+}
+
+sl_status_t sl_device_init_oscillators_join(void)
+{
+  sl_status_t status = SL_STATUS_OK;
+
+#if (SL_DEVICE_INIT_OSCILLATORS_LFXO == 1)
+  status = lfxo_join();
+#endif
+
+  TIMING_MARK(join_done);
+
+  return status;
+}
+
+const sl_device_init_oscillators_timing_t *sl_device_init_oscillators_timing_get(void)
+{
+  return &timing;
+}
@@ -0,0 +1,93 @@
+/***************************************************************************//**
+ * @file
+ * @brief Keyscan service configuration file.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+#ifndef SL_KEYSCAN_SERVICE_CONFIG_H
+#define SL_KEYSCAN_SERVICE_CONFIG_H
+
+// <h>Keyscan Configuration
+
+// <o SL_KEYSCAN_SERVICE_COLUMN_NUMBER> Number of columns <1-8>
+// <i> Default: 3
+#define SL_KEYSCAN_SERVICE_COLUMN_NUMBER  3
+
+// <o SL_KEYSCAN_SERVICE_ROW_NUMBER> Number of rows <3-6>
+// <i> Default: 6
+#define SL_KEYSCAN_SERVICE_ROW_NUMBER  6
+
+// <o SL_KEYSCAN_SERVICE_CLOCK_DIVIDER> Scan clock divider <0-131071>
+// <i> Default: 79999
+#define SL_KEYSCAN_SERVICE_CLOCK_DIVIDER  79999
+
+// <o SL_KEYSCAN_SERVICE_SCAN_DELAY> Scan delay
+// <SL_HAL_KEYSCAN_DELAY_2MS=> 2 ms
+// <SL_HAL_KEYSCAN_DELAY_4MS=> 4 ms
+// <SL_HAL_KEYSCAN_DELAY_8MS=> 8 ms
+// <SL_HAL_KEYSCAN_DELAY_16MS=> 16 ms
+// <SL_HAL_KEYSCAN_DELAY_32MS=> 32 ms
+// <i> Default: SL_HAL_KEYSCAN_DELAY_2MS
+#define SL_KEYSCAN_SERVICE_SCAN_DELAY  SL_HAL_KEYSCAN_DELAY_2MS
+
+// <o SL_KEYSCAN_SERVICE_DEBOUNCE_DELAY> Debounce delay
+// <SL_HAL_KEYSCAN_DELAY_2MS=> 2 ms
+// <SL_HAL_KEYSCAN_DELAY_4MS=> 4 ms
+// <SL_HAL_KEYSCAN_DELAY_8MS=> 8 ms
+// <SL_HAL_KEYSCAN_DELAY_16MS=> 16 ms
+// <SL_HAL_KEYSCAN_DELAY_32MS=> 32 ms
+// <i> Default: SL_HAL_KEYSCAN_DELAY_8MS
+#define SL_KEYSCAN_SERVICE_DEBOUNCE_DELAY  SL_HAL_KEYSCAN_DELAY_8MS
+
+// <o SL_KEYSCAN_SERVICE_STABLE_DELAY> Row stable delay
+// <SL_HAL_KEYSCAN_DELAY_2MS=> 2 ms
+// <SL_HAL_KEYSCAN_DELAY_4MS=> 4 ms
+// <SL_HAL_KEYSCAN_DELAY_8MS=> 8 ms
+// <SL_HAL_KEYSCAN_DELAY_16MS=> 16 ms
+// <SL_HAL_KEYSCAN_DELAY_32MS=> 32 ms
+// <i> Default: SL_HAL_KEYSCAN_DELAY_2MS
+#define SL_KEYSCAN_SERVICE_STABLE_DELAY  SL_HAL_KEYSCAN_DELAY_2MS
+
+// <o SL_KEYSCAN_SERVICE_EVENT_QUEUE_SIZE> Event queue size <2-256>
+// <i> Must be a power of two. Events that do not fit are dropped and counted.
+// <i> Default: 16
+#define SL_KEYSCAN_SERVICE_EVENT_QUEUE_SIZE  16
+
+// <q SL_KEYSCAN_SERVICE_GHOST_FILTER> Ghost key filtering
+// <i> Enable for key matrices without a diode per key. New presses that
+// <i> complete a rectangle of pressed keys are held back until the rectangle
+// <i> is broken, since one of its corners may be a ghost.
+// <i> Default: 1
+#define SL_KEYSCAN_SERVICE_GHOST_FILTER  1
+
+// </h>
+
+#endif /* SL_KEYSCAN_SERVICE_CONFIG_H */
+
+// <<< end of configuration section >>>
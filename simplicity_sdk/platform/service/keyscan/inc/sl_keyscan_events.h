@@ -0,0 +1,206 @@
+/***************************************************************************//**
+ * @file
+ * @brief Keyscan key state tracking and event queue.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_KEYSCAN_EVENTS_H
+#define SL_KEYSCAN_EVENTS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sl_status.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ * @addtogroup keyscan_service
+ * @{
+ ******************************************************************************/
+
+/// Maximum number of columns of a key matrix.
+#define SL_KEYSCAN_MAX_COLUMNS  8
+
+/// Maximum number of rows of a key matrix.
+#define SL_KEYSCAN_MAX_ROWS     6
+
+/// Key event types.
+typedef enum {
+  SL_KEYSCAN_EVENT_PRESS = 0,     ///< Key pressed.
+  SL_KEYSCAN_EVENT_RELEASE,       ///< Key released.
+} sl_keyscan_event_type_t;
+
+/// Key event.
+typedef struct {
+  uint32_t timestamp;             ///< Time of the scan that detected the event.
+  uint8_t column;                 ///< Key column.
+  uint8_t row;                    ///< Key row.
+  sl_keyscan_event_type_t type;   ///< Press or release.
+} sl_keyscan_event_t;
+
+/// Event ring.
+///
+/// Single producer, single consumer. The producer only writes head and the
+/// consumer only writes tail, so no critical section is needed as long as
+/// each side stays in its own context.
+typedef struct {
+  sl_keyscan_event_t *events;     ///< Event storage.
+  uint16_t size;                  ///< Number of events, a power of two.
+  volatile uint16_t head;         ///< Free-running write index.
+  volatile uint16_t tail;         ///< Free-running read index.
+  volatile uint32_t dropped;      ///< Events dropped because the ring was full.
+} sl_keyscan_event_ring_t;
+
+/// Key state tracker.
+///
+/// A matrix holds one byte per column with one bit per row, set when the key
+/// is pressed.
+typedef struct {
+  uint8_t column_count;                       ///< Number of columns.
+  uint8_t row_mask;                           ///< Mask of the row bits in use.
+  bool ghost_filter;                          ///< Hold back presses that may be ghosts.
+  uint8_t stable[SL_KEYSCAN_MAX_COLUMNS];     ///< Key state reported so far.
+  uint8_t scan[SL_KEYSCAN_MAX_COLUMNS];       ///< Scan in progress.
+} sl_keyscan_tracker_t;
+
+/***************************************************************************//**
+ * Initialize an event ring.
+ *
+ * @param ring    Event ring.
+ * @param events  Event storage.
+ * @param size    Number of events in the storage, a power of two.
+ *
+ * @return SL_STATUS_OK, or SL_STATUS_INVALID_PARAMETER if size is not a
+ *         power of two.
+ ******************************************************************************/
+sl_status_t sl_keyscan_event_ring_init(sl_keyscan_event_ring_t *ring,
+                                       sl_keyscan_event_t *events,
+                                       uint16_t size);
+
+/***************************************************************************//**
+ * Take the oldest event from an event ring.
+ *
+ * @param ring   Event ring.
+ * @param event  Event taken.
+ *
+ * @return true if an event was taken, false if the ring is empty.
+ ******************************************************************************/
+bool sl_keyscan_event_ring_pop(sl_keyscan_event_ring_t *ring,
+                               sl_keyscan_event_t *event);
+
+/***************************************************************************//**
+ * Get the number of events in an event ring.
+ *
+ * @param ring   Event ring.
+ *
+ * @return Number of events waiting.
+ ******************************************************************************/
+uint16_t sl_keyscan_event_ring_count(const sl_keyscan_event_ring_t *ring);
+
+/***************************************************************************//**
+ * Initialize a key state tracker with all keys released.
+ *
+ * @param tracker       Key state tracker.
+ * @param column_count  Number of columns, up to SL_KEYSCAN_MAX_COLUMNS.
+ * @param row_count     Number of rows, up to SL_KEYSCAN_MAX_ROWS.
+ * @param ghost_filter  Hold back presses that may be ghosts.
+ ******************************************************************************/
+void sl_keyscan_tracker_init(sl_keyscan_tracker_t *tracker,
+                             uint8_t column_count,
+                             uint8_t row_count,
+                             bool ghost_filter);
+
+/***************************************************************************//**
+ * Record the pressed rows of one column of the scan in progress.
+ *
+ * @param tracker  Key state tracker.
+ * @param column   Column scanned.
+ * @param rows     Pressed rows, one bit per row.
+ ******************************************************************************/
+void sl_keyscan_tracker_set_column(sl_keyscan_tracker_t *tracker,
+                                   uint8_t column,
+                                   uint8_t rows);
+
+/***************************************************************************//**
+ * Complete the scan in progress.
+ *
+ * @details
+ * Compares the scan with the reported key state and queues one event per key
+ * that changed. Releases are queued before presses. The scan in progress is
+ * cleared for the next one.
+ *
+ * @param tracker    Key state tracker.
+ * @param ring       Event ring to queue the events in.
+ * @param timestamp  Time of the scan.
+ *
+ * @return Number of events queued, not counting the dropped ones.
+ ******************************************************************************/
+uint32_t sl_keyscan_tracker_end_scan(sl_keyscan_tracker_t *tracker,
+                                     sl_keyscan_event_ring_t *ring,
+                                     uint32_t timestamp);
+
+/***************************************************************************//**
+ * Release all pressed keys.
+ *
+ * @details
+ * Used when the keypad reports that no key is pressed.
+ *
+ * @param tracker    Key state tracker.
+ * @param ring       Event ring to queue the events in.
+ * @param timestamp  Time of the release.
+ *
+ * @return Number of events queued, not counting the dropped ones.
+ ******************************************************************************/
+uint32_t sl_keyscan_tracker_release_all(sl_keyscan_tracker_t *tracker,
+                                        sl_keyscan_event_ring_t *ring,
+                                        uint32_t timestamp);
+
+/***************************************************************************//**
+ * Find the keys that may be ghosts in a key matrix.
+ *
+ * @details
+ * Without a diode per key, three pressed corners of a rectangle make the
+ * fourth one read as pressed. Every key on a rectangle of pressed keys is
+ * flagged, since it is not possible to tell which corner is the ghost.
+ *
+ * @param matrix        Pressed keys, one byte per column.
+ * @param column_count  Number of columns.
+ * @param ghost         Keys that may be ghosts, one byte per column.
+ ******************************************************************************/
+void sl_keyscan_find_ghosts(const uint8_t *matrix,
+                            uint8_t column_count,
+                            uint8_t *ghost);
+
+/** @} (end addtogroup keyscan_service) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SL_KEYSCAN_EVENTS_H */
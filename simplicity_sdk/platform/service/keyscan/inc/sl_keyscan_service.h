@@ -0,0 +1,181 @@
+/***************************************************************************//**
+ * @file
+ * @brief Keyscan service with timestamped key events.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_KEYSCAN_SERVICE_H
+#define SL_KEYSCAN_SERVICE_H
+
+#if defined(SL_COMPONENT_CATALOG_PRESENT)
+#include "sl_component_catalog.h"
+#endif
+#include <stdbool.h>
+#include <stdint.h>
+#include "sl_status.h"
+#include "sl_keyscan_events.h"
+
+#if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
+#include "sl_power_manager.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ * @addtogroup keyscan_service Keyscan Service
+ * @brief Key press and release events from the KEYSCAN peripheral.
+ * @details
+ * ## Overview
+ *
+ *   The service handles the KEYSCAN interrupt. The rows reported for each
+ *   column are collected until the scan completes, then compared with the
+ *   previous key state. Each press and release is queued as an event stamped
+ *   with the sleeptimer tick count of the scan. The queue is a lock-free ring
+ *   written by the interrupt and read by the application.
+ *
+ *   Ghost keys of matrices without diodes are filtered: a new press that
+ *   completes a rectangle of pressed keys is held back until the rectangle is
+ *   broken, since any corner of it may be a ghost.
+ *
+ *   In bare-metal applications, sl_keyscan_service_sleep_on_isr_exit() lets the
+ *   system go back to sleep after a KEYSCAN interrupt that did not complete
+ *   any event, so the application only wakes up for full key events.
+ *
+ *   The KEYSCAN column and row pins must be routed by the application before
+ *   sl_keyscan_service_start() is called.
+ *
+ * ## Example
+ *
+ * @code{.c}
+ * sl_keyscan_event_t event;
+ *
+ * sl_keyscan_service_init();
+ * sl_keyscan_service_start();
+ *
+ * while (1) {
+ *   while (sl_keyscan_service_get_event(&event) == SL_STATUS_OK) {
+ *     handle_key(event.column, event.row, event.type == SL_KEYSCAN_EVENT_PRESS);
+ *   }
+ *   sl_power_manager_sleep();
+ * }
+ * @endcode
+ * @{
+ ******************************************************************************/
+
+/// Callback called from interrupt context when new events are queued.
+typedef void (*sl_keyscan_service_event_callback_t)(void);
+
+/***************************************************************************//**
+ * Initialize the keyscan service.
+ *
+ * @details
+ * Configures the KEYSCAN peripheral from sl_keyscan_config.h and clears the
+ * key state and the event queue. Scanning is not started.
+ *
+ * @return SL_STATUS_OK, or SL_STATUS_INVALID_CONFIGURATION if the
+ *         configuration is out of range.
+ ******************************************************************************/
+sl_status_t sl_keyscan_service_init(void);
+
+/***************************************************************************//**
+ * Start scanning the keypad.
+ ******************************************************************************/
+void sl_keyscan_service_start(void);
+
+/***************************************************************************//**
+ * Stop scanning the keypad.
+ *
+ * @details
+ * Keys still pressed are released, and the matching events are queued.
+ ******************************************************************************/
+void sl_keyscan_service_stop(void);
+
+/***************************************************************************//**
+ * Take the oldest key event.
+ *
+ * @param event  Event taken.
+ *
+ * @return SL_STATUS_OK, or SL_STATUS_EMPTY if no event is waiting.
+ ******************************************************************************/
+sl_status_t sl_keyscan_service_get_event(sl_keyscan_event_t *event);
+
+/***************************************************************************//**
+ * Get the number of key events waiting.
+ *
+ * @return Number of events.
+ ******************************************************************************/
+uint16_t sl_keyscan_service_get_event_count(void);
+
+/***************************************************************************//**
+ * Get the number of key events dropped because the queue was full.
+ *
+ * @return Number of events dropped since initialization.
+ ******************************************************************************/
+uint32_t sl_keyscan_service_get_dropped_count(void);
+
+/***************************************************************************//**
+ * Get the reported state of a key.
+ *
+ * @param column  Key column.
+ * @param row     Key row.
+ *
+ * @return true if the key is pressed.
+ ******************************************************************************/
+bool sl_keyscan_service_is_key_pressed(uint8_t column,
+                                      uint8_t row);
+
+/***************************************************************************//**
+ * Set the callback called when new events are queued.
+ *
+ * @param callback  Callback, or NULL to remove it.
+ ******************************************************************************/
+void sl_keyscan_service_set_event_callback(sl_keyscan_service_event_callback_t callback);
+
+#if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
+/***************************************************************************//**
+ * Tell whether the system may go back to sleep after a KEYSCAN interrupt.
+ *
+ * @details
+ * Meant to be called from sl_power_manager_sleep_on_isr_exit() in bare-metal
+ * applications.
+ *
+ * @return SL_POWER_MANAGER_WAKEUP if events were queued since the last call,
+ *         SL_POWER_MANAGER_SLEEP if KEYSCAN interrupts ran without queuing any,
+ *         SL_POWER_MANAGER_IGNORE otherwise.
+ ******************************************************************************/
+sl_power_manager_on_isr_exit_t sl_keyscan_service_sleep_on_isr_exit(void);
+#endif
+
+/** @} (end addtogroup keyscan_service) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SL_KEYSCAN_SERVICE_H */
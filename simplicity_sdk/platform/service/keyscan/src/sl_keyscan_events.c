@@ -0,0 +1,262 @@
+/***************************************************************************//**
+ * @file
+ * @brief Keyscan key state tracking and event queue.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <stddef.h>
+#include "sl_keyscan_events.h"
+
+/*******************************************************************************
+ **************************   LOCAL FUNCTIONS   ********************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Queue an event, or count it as dropped if the ring is full.
+ *
+ * The event is written through a volatile pointer so that it is complete in
+ * memory before head publishes it to the consumer.
+ ******************************************************************************/
+static uint32_t ring_push(sl_keyscan_event_ring_t *ring,
+                          uint32_t timestamp,
+                          uint8_t column,
+                          uint8_t row,
+                          sl_keyscan_event_type_t type)
+{
+  uint16_t head = ring->head;
+  volatile sl_keyscan_event_t *slot;
+
+  if ((uint16_t)(head - ring->tail) >= ring->size) {
+    ring->dropped++;
+    return 0;
+  }
+
+  slot = &ring->events[head & (ring->size - 1)];
+  slot->timestamp = timestamp;
+  slot->column = column;
+  slot->row = row;
+  slot->type = type;
+  ring->head = head + 1;
+  return 1;
+}
+
+/***************************************************************************//**
+ * Queue one event per bit set in a column change mask.
+ ******************************************************************************/
+static uint32_t queue_column_events(sl_keyscan_event_ring_t *ring,
+                                    uint32_t timestamp,
+                                    uint8_t column,
+                                    uint8_t rows,
+                                    sl_keyscan_event_type_t type)
+{
+  uint32_t queued = 0;
+  uint8_t row;
+
+  for (row = 0; rows != 0; row++, rows >>= 1) {
+    if (rows & 1) {
+      queued += ring_push(ring, timestamp, column, row, type);
+    }
+  }
+  return queued;
+}
+
+/*******************************************************************************
+ **************************   GLOBAL FUNCTIONS   *******************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Initialize an event ring.
+ ******************************************************************************/
+sl_status_t sl_keyscan_event_ring_init(sl_keyscan_event_ring_t *ring,
+                                       sl_keyscan_event_t *events,
+                                       uint16_t size)
+{
+  if (events == NULL || size == 0 || (size & (size - 1)) != 0) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  ring->events = events;
+  ring->size = size;
+  ring->head = 0;
+  ring->tail = 0;
+  ring->dropped = 0;
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Take the oldest event from an event ring.
+ ******************************************************************************/
+bool sl_keyscan_event_ring_pop(sl_keyscan_event_ring_t *ring,
+                               sl_keyscan_event_t *event)
+{
+  uint16_t tail = ring->tail;
+  volatile sl_keyscan_event_t *slot;
+
+  if (tail == ring->head) {
+    return false;
+  }
+
+  slot = &ring->events[tail & (ring->size - 1)];
+  event->timestamp = slot->timestamp;
+  event->column = slot->column;
+  event->row = slot->row;
+  event->type = slot->type;
+  ring->tail = tail + 1;
+  return true;
+}
+
+/***************************************************************************//**
+ * Get the number of events in an event ring.
+ ******************************************************************************/
+uint16_t sl_keyscan_event_ring_count(const sl_keyscan_event_ring_t *ring)
+{
+  return (uint16_t)(ring->head - ring->tail);
+}
+
+/***************************************************************************//**
+ * Initialize a key state tracker with all keys released.
+ ******************************************************************************/
+void sl_keyscan_tracker_init(sl_keyscan_tracker_t *tracker,
+                             uint8_t column_count,
+                             uint8_t row_count,
+                             bool ghost_filter)
+{
+  uint8_t column;
+
+  if (column_count > SL_KEYSCAN_MAX_COLUMNS) {
+    column_count = SL_KEYSCAN_MAX_COLUMNS;
+  }
+  if (row_count > SL_KEYSCAN_MAX_ROWS) {
+    row_count = SL_KEYSCAN_MAX_ROWS;
+  }
+
+  tracker->column_count = column_count;
+  tracker->row_mask = (uint8_t)((1U << row_count) - 1U);
+  tracker->ghost_filter = ghost_filter;
+  for (column = 0; column < SL_KEYSCAN_MAX_COLUMNS; column++) {
+    tracker->stable[column] = 0;
+    tracker->scan[column] = 0;
+  }
+}
+
+/***************************************************************************//**
+ * Record the pressed rows of one column of the scan in progress.
+ ******************************************************************************/
+void sl_keyscan_tracker_set_column(sl_keyscan_tracker_t *tracker,
+                                   uint8_t column,
+                                   uint8_t rows)
+{
+  if (column < tracker->column_count) {
+    tracker->scan[column] = rows & tracker->row_mask;
+  }
+}
+
+/***************************************************************************//**
+ * Complete the scan in progress.
+ ******************************************************************************/
+uint32_t sl_keyscan_tracker_end_scan(sl_keyscan_tracker_t *tracker,
+                                     sl_keyscan_event_ring_t *ring,
+                                     uint32_t timestamp)
+{
+  uint8_t ghost[SL_KEYSCAN_MAX_COLUMNS] = { 0 };
+  uint8_t next[SL_KEYSCAN_MAX_COLUMNS];
+  uint32_t queued = 0;
+  uint8_t column;
+
+  if (tracker->ghost_filter) {
+    sl_keyscan_find_ghosts(tracker->scan, tracker->column_count, ghost);
+  }
+
+  for (column = 0; column < tracker->column_count; column++) {
+    // A key already reported as pressed is real, only new presses on a
+    // rectangle are held back.
+    next[column] = tracker->scan[column] & ~(ghost[column] & ~tracker->stable[column]);
+    tracker->scan[column] = 0;
+  }
+
+  // Releases first, so that a consumer tracking the pressed keys never sees
+  // more keys held than there are.
+  for (column = 0; column < tracker->column_count; column++) {
+    queued += queue_column_events(ring, timestamp, column,
+                                  tracker->stable[column] & ~next[column],
+                                  SL_KEYSCAN_EVENT_RELEASE);
+  }
+  for (column = 0; column < tracker->column_count; column++) {
+    queued += queue_column_events(ring, timestamp, column,
+                                  next[column] & ~tracker->stable[column],
+                                  SL_KEYSCAN_EVENT_PRESS);
+    tracker->stable[column] = next[column];
+  }
+  return queued;
+}
+
+/***************************************************************************//**
+ * Release all pressed keys.
+ ******************************************************************************/
+uint32_t sl_keyscan_tracker_release_all(sl_keyscan_tracker_t *tracker,
+                                        sl_keyscan_event_ring_t *ring,
+                                        uint32_t timestamp)
+{
+  uint32_t queued = 0;
+  uint8_t column;
+
+  for (column = 0; column < tracker->column_count; column++) {
+    queued += queue_column_events(ring, timestamp, column,
+                                  tracker->stable[column],
+                                  SL_KEYSCAN_EVENT_RELEASE);
+    tracker->stable[column] = 0;
+    tracker->scan[column] = 0;
+  }
+  return queued;
+}
+
+/***************************************************************************//**
+ * Find the keys that may be ghosts in a key matrix.
+ ******************************************************************************/
+void sl_keyscan_find_ghosts(const uint8_t *matrix,
+                            uint8_t column_count,
+                            uint8_t *ghost)
+{
+  uint8_t first;
+  uint8_t second;
+  uint8_t common;
+
+  for (first = 0; first < column_count; first++) {
+    ghost[first] = 0;
+  }
+
+  for (first = 0; first < column_count; first++) {
+    for (second = first + 1; second < column_count; second++) {
+      common = matrix[first] & matrix[second];
+      // Two or more shared rows form at least one rectangle.
+      if ((common & (common - 1)) != 0) {
+        ghost[first] |= common;
+        ghost[second] |= common;
+      }
+    }
+  }
+}
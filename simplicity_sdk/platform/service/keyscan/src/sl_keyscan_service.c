@@ -0,0 +1,272 @@
+/***************************************************************************//**
+ * @file
+ * @brief Keyscan service with timestamped key events.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#if defined(SL_COMPONENT_CATALOG_PRESENT)
+#include "sl_component_catalog.h"
+#endif
+#include "sl_keyscan_service.h"
+#include "sl_keyscan_service_config.h"
+#include "sl_hal_keyscan.h"
+#include "sl_clock_manager.h"
+#include "sl_interrupt_manager.h"
+#include "sl_core.h"
+
+#if defined(SL_CATALOG_SLEEPTIMER_PRESENT)
+#include "sl_sleeptimer.h"
+#endif
+
+#if defined(KEYSCAN_COUNT) && (KEYSCAN_COUNT > 0)
+
+#if (SL_KEYSCAN_SERVICE_EVENT_QUEUE_SIZE == 0) \
+  || ((SL_KEYSCAN_SERVICE_EVENT_QUEUE_SIZE & (SL_KEYSCAN_SERVICE_EVENT_QUEUE_SIZE - 1)) != 0)
+#error "SL_KEYSCAN_SERVICE_EVENT_QUEUE_SIZE must be a power of two"
+#endif
+
+/*******************************************************************************
+ ***************************  LOCAL VARIABLES   ********************************
+ ******************************************************************************/
+
+static sl_keyscan_event_t event_buffer[SL_KEYSCAN_SERVICE_EVENT_QUEUE_SIZE];
+static sl_keyscan_event_ring_t event_ring;
+static sl_keyscan_tracker_t tracker;
+static sl_keyscan_service_event_callback_t event_callback;
+
+#if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
+// KEYSCAN interrupts since the last sleep on ISR exit decision, and whether
+// any of them queued events.
+static volatile bool isr_ran;
+static volatile bool events_queued;
+#endif
+
+/*******************************************************************************
+ **************************   LOCAL FUNCTIONS   ********************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Get the timestamp of the events.
+ ******************************************************************************/
+static uint32_t get_timestamp(void)
+{
+#if defined(SL_CATALOG_SLEEPTIMER_PRESENT)
+  return sl_sleeptimer_get_tick_count();
+#else
+  return 0;
+#endif
+}
+
+/*******************************************************************************
+ **************************   GLOBAL FUNCTIONS   *******************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Initialize the keyscan service.
+ ******************************************************************************/
+sl_status_t sl_keyscan_service_init(void)
+{
+  sl_hal_keyscan_config_t config = KEYSCAN_CONFIG_DEFAULT;
+
+  if ((SL_KEYSCAN_SERVICE_COLUMN_NUMBER < 1)
+      || (SL_KEYSCAN_SERVICE_COLUMN_NUMBER > KEYSCAN_COLNUM)
+      || (SL_KEYSCAN_SERVICE_COLUMN_NUMBER > SL_KEYSCAN_MAX_COLUMNS)
+      || (SL_KEYSCAN_SERVICE_ROW_NUMBER < 1)
+      || (SL_KEYSCAN_SERVICE_ROW_NUMBER > KEYSCAN_ROWNUM)
+      || (SL_KEYSCAN_SERVICE_ROW_NUMBER > SL_KEYSCAN_MAX_ROWS)) {
+    return SL_STATUS_INVALID_CONFIGURATION;
+  }
+
+  sl_clock_manager_enable_bus_clock(SL_BUS_CLOCK_KEYSCAN);
+
+  sl_interrupt_manager_disable_irq(KEYSCAN_IRQn);
+
+  config.clock_divider = SL_KEYSCAN_SERVICE_CLOCK_DIVIDER;
+  config.column_number = SL_KEYSCAN_SERVICE_COLUMN_NUMBER;
+  config.row_number = SL_KEYSCAN_SERVICE_ROW_NUMBER;
+  config.scan_delay = SL_KEYSCAN_SERVICE_SCAN_DELAY;
+  config.debounce_delay = SL_KEYSCAN_SERVICE_DEBOUNCE_DELAY;
+  config.stable_delay = SL_KEYSCAN_SERVICE_STABLE_DELAY;
+  config.single_press_enable = false;
+  config.auto_start_enable = false;
+  sl_hal_keyscan_init(&config);
+
+  sl_keyscan_event_ring_init(&event_ring, event_buffer, SL_KEYSCAN_SERVICE_EVENT_QUEUE_SIZE);
+  sl_keyscan_tracker_init(&tracker,
+                          SL_KEYSCAN_SERVICE_COLUMN_NUMBER,
+                          SL_KEYSCAN_SERVICE_ROW_NUMBER,
+                          SL_KEYSCAN_SERVICE_GHOST_FILTER);
+#if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
+  isr_ran = false;
+  events_queued = false;
+#endif
+
+  sl_hal_keyscan_clear_interrupts(_KEYSCAN_IF_MASK);
+  sl_hal_keyscan_enable_interrupts(KEYSCAN_IEN_KEY | KEYSCAN_IEN_SCANNED | KEYSCAN_IEN_NOKEY);
+  sl_interrupt_manager_clear_irq_pending(KEYSCAN_IRQn);
+  sl_interrupt_manager_enable_irq(KEYSCAN_IRQn);
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Start scanning the keypad.
+ ******************************************************************************/
+void sl_keyscan_service_start(void)
+{
+  sl_hal_keyscan_enable();
+  sl_hal_keyscan_wait_sync();
+  sl_hal_keyscan_start_scan();
+}
+
+/***************************************************************************//**
+ * Stop scanning the keypad.
+ ******************************************************************************/
+void sl_keyscan_service_stop(void)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  sl_hal_keyscan_disable();
+  sl_hal_keyscan_wait_ready();
+
+  // The interrupt is the only producer, keep it out while releasing
+  CORE_ENTER_ATOMIC();
+  sl_keyscan_tracker_release_all(&tracker, &event_ring, get_timestamp());
+  CORE_EXIT_ATOMIC();
+}
+
+/***************************************************************************//**
+ * Take the oldest key event.
+ ******************************************************************************/
+sl_status_t sl_keyscan_service_get_event(sl_keyscan_event_t *event)
+{
+  if (event == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  if (!sl_keyscan_event_ring_pop(&event_ring, event)) {
+    return SL_STATUS_EMPTY;
+  }
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Get the number of key events waiting.
+ ******************************************************************************/
+uint16_t sl_keyscan_service_get_event_count(void)
+{
+  return sl_keyscan_event_ring_count(&event_ring);
+}
+
+/***************************************************************************//**
+ * Get the number of key events dropped because the queue was full.
+ ******************************************************************************/
+uint32_t sl_keyscan_service_get_dropped_count(void)
+{
+  return event_ring.dropped;
+}
+
+/***************************************************************************//**
+ * Get the reported state of a key.
+ ******************************************************************************/
+bool sl_keyscan_service_is_key_pressed(uint8_t column,
+                                      uint8_t row)
+{
+  if ((column >= tracker.column_count) || (row >= SL_KEYSCAN_MAX_ROWS)) {
+    return false;
+  }
+  return (tracker.stable[column] & (1U << row)) != 0;
+}
+
+/***************************************************************************//**
+ * Set the callback called when new events are queued.
+ ******************************************************************************/
+void sl_keyscan_service_set_event_callback(sl_keyscan_service_event_callback_t callback)
+{
+  event_callback = callback;
+}
+
+#if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
+/***************************************************************************//**
+ * Tell whether the system may go back to sleep after a KEYSCAN interrupt.
+ ******************************************************************************/
+sl_power_manager_on_isr_exit_t sl_keyscan_service_sleep_on_isr_exit(void)
+{
+  sl_power_manager_on_isr_exit_t answer = SL_POWER_MANAGER_IGNORE;
+
+  if (events_queued) {
+    answer = SL_POWER_MANAGER_WAKEUP;
+  } else if (isr_ran) {
+    answer = SL_POWER_MANAGER_SLEEP;
+  }
+  events_queued = false;
+  isr_ran = false;
+  return answer;
+}
+#endif
+
+/***************************************************************************//**
+ * KEYSCAN interrupt handler.
+ *
+ * A KEY interrupt reports the rows of one column of the scan in progress. The
+ * events are only produced once the scan completes, or when the keypad reports
+ * that no key is pressed anymore.
+ ******************************************************************************/
+void KEYSCAN_IRQHandler(void)
+{
+  uint32_t flags = sl_hal_keyscan_get_enabled_interrupts();
+  uint32_t status;
+  uint32_t queued = 0;
+
+  sl_hal_keyscan_clear_interrupts(flags);
+
+  if (flags & KEYSCAN_IF_KEY) {
+    status = sl_hal_keyscan_get_status();
+    // Rows read low on pressed keys
+    sl_keyscan_tracker_set_column(&tracker,
+                                  (uint8_t)((status & _KEYSCAN_STATUS_COL_MASK) >> _KEYSCAN_STATUS_COL_SHIFT),
+                                  (uint8_t)~((status & _KEYSCAN_STATUS_ROW_MASK) >> _KEYSCAN_STATUS_ROW_SHIFT));
+  }
+  if (flags & KEYSCAN_IF_SCANNED) {
+    queued += sl_keyscan_tracker_end_scan(&tracker, &event_ring, get_timestamp());
+  }
+  if (flags & KEYSCAN_IF_NOKEY) {
+    queued += sl_keyscan_tracker_release_all(&tracker, &event_ring, get_timestamp());
+  }
+
+#if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
+  isr_ran = true;
+  if (queued > 0) {
+    events_queued = true;
+  }
+#endif
+  if ((queued > 0) && (event_callback != NULL)) {
+    event_callback();
+  }
+}
+
+#endif /* defined(KEYSCAN_COUNT) && (KEYSCAN_COUNT > 0) */
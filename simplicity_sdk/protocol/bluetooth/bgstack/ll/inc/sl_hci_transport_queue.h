@@ -0,0 +1,177 @@
+/***************************************************************************//**
+ * @brief In-place receive assembly and batched transmit for HCI transports.
+ *
+ * Helpers for HCI transports built on the common HCI transport API. The
+ * receive side lets the transport DMA H4 packets directly into a buffer and
+ * hands each complete packet to the HCI in a single call. The transmit side
+ * stages outbound HCI messages so that several of them leave in one transport
+ * write, without waiting for the host link between messages.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_HCI_TRANSPORT_QUEUE_H
+#define SL_HCI_TRANSPORT_QUEUE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <sl_status.h>
+
+/***************************************************************************//**
+ * @addtogroup sl_hci_transport_queue HCI transport receive assembly and transmit batching
+ * @{
+ ******************************************************************************/
+
+/// H4 packet indicators
+#define SL_HCI_TRANSPORT_H4_COMMAND   0x01
+#define SL_HCI_TRANSPORT_H4_ACL       0x02
+#define SL_HCI_TRANSPORT_H4_SCO       0x03
+#define SL_HCI_TRANSPORT_H4_EVENT     0x04
+#define SL_HCI_TRANSPORT_H4_ISO       0x05
+
+/**
+ * Receive assembly state.
+ *
+ * The transport reads the bytes it is asked for by
+ * sl_hci_transport_rx_get_buffer() straight into the returned location, for
+ * example with a DMA transfer of exactly that length, and reports them with
+ * sl_hci_transport_rx_commit(). The packet indicator and header are read
+ * first, then the payload, so the packet is assembled in place and no copy is
+ * made by the transport.
+ */
+typedef struct {
+  uint8_t *buffer;   ///< Buffer holding the packet being received
+  uint16_t size;     ///< Size of the buffer
+  uint16_t length;   ///< Bytes received so far
+  uint16_t expected; ///< Total bytes of the packet, or of the part known so far
+  bool header_done;  ///< Header received, expected covers the whole packet
+} sl_hci_transport_rx_t;
+
+/**
+ * Start a transport write of a batch of HCI messages.
+ * The transport calls sl_hci_transport_tx_write_done() once the data has been
+ * written.
+ * @param[in] data Data to write. Valid until the write is done.
+ * @param[in] len Length of the data.
+ * @return SL_STATUS_OK if the write was started. Otherwise the data stays
+ *         queued and the write is retried from sl_hci_transport_tx_process(). */
+typedef sl_status_t (*sl_hci_transport_write_t)(const uint8_t *data, uint16_t len);
+
+/**
+ * Transmit batching state.
+ *
+ * The buffer is split in two halves. One half is being written by the
+ * transport while the other one collects the next messages. The HCI is told
+ * that a message is transmitted as soon as it has been staged, so it can
+ * produce the next one while the transport is still busy, and the messages
+ * staged meanwhile leave in one write. A write refused by the transport
+ * leaves its messages staged. sl_hci_transport_tx_process() retries it.
+ */
+typedef struct {
+  uint8_t *buffer;                ///< Staging buffer
+  uint16_t half_size;             ///< Size of each half of the buffer
+  uint16_t staged;                ///< Bytes collected in the staging half
+  uint8_t stage;                  ///< Index of the staging half
+  bool writing;                   ///< Transport write in progress
+  bool complete_pending;          ///< Transmit complete to signal to the HCI
+  uint8_t *pending_data;          ///< Message waiting for room, or NULL
+  int16_t pending_len;            ///< Length of the waiting message
+  sl_hci_transport_write_t write; ///< Transport write function
+  uint32_t batches;               ///< Number of transport writes started
+  uint32_t messages;              ///< Number of messages transmitted
+} sl_hci_transport_tx_t;
+
+/**
+ * Initialize receive assembly.
+ * @param[out] rx Receive state.
+ * @param[in] buffer Buffer for a complete H4 packet, including the packet
+ *       indicator.
+ * @param[in] size Size of the buffer. */
+void sl_hci_transport_rx_init(sl_hci_transport_rx_t *rx, uint8_t *buffer, uint16_t size);
+
+/**
+ * Get the location and length of the next bytes to receive.
+ * @param[in] rx Receive state.
+ * @param[out] len Number of bytes to read next. Reading exactly this many
+ *       bytes before committing keeps the packet boundaries known.
+ * @return Where to write the next bytes. */
+uint8_t *sl_hci_transport_rx_get_buffer(sl_hci_transport_rx_t *rx, uint16_t *len);
+
+/**
+ * Report bytes written at the location given by sl_hci_transport_rx_get_buffer().
+ * Once a packet is complete, it is given to the HCI with
+ * hci_common_transport_receive() as a single last fragment.
+ * @param[in] rx Receive state.
+ * @param[in] len Number of bytes written.
+ * @return SL_STATUS_OK if the bytes were accepted,
+ *         SL_STATUS_INVALID_PARAMETER on an unknown packet indicator,
+ *         SL_STATUS_WOULD_OVERFLOW if the packet does not fit the buffer,
+ *         SL_STATUS_NO_MORE_RESOURCE if the HCI was out of memory.
+ *         The partial packet is dropped on any error. */
+sl_status_t sl_hci_transport_rx_commit(sl_hci_transport_rx_t *rx, uint16_t len);
+
+/**
+ * Initialize transmit batching.
+ * @param[out] tx Transmit state.
+ * @param[in] buffer Staging buffer, split in two halves. Each half must fit
+ *       the largest HCI message.
+ * @param[in] size Size of the buffer.
+ * @param[in] write Transport write function. */
+void sl_hci_transport_tx_init(sl_hci_transport_tx_t *tx,
+                              uint8_t *buffer,
+                              uint16_t size,
+                              sl_hci_transport_write_t write);
+
+/**
+ * Queue an HCI message for transmission.
+ * Call from the transport implementation of hci_common_transport_transmit().
+ * The message is copied into the staging half, and a transport write is
+ * started if none is in progress. If the staging half is full, the message
+ * is kept by reference until there is room. Completion is reported by
+ * sl_hci_transport_tx_process() once the message has been staged.
+ * @param[in] tx Transmit state.
+ * @param[in] data Message given by the HCI.
+ * @param[in] len Length of the message.
+ * @return 0 on success, or non-zero if the message can never fit. */
+uint32_t sl_hci_transport_tx_enqueue(sl_hci_transport_tx_t *tx, uint8_t *data, int16_t len);
+
+/**
+ * Report that the transport write started by the write function is done.
+ * Starts the write of the messages staged meanwhile, if any.
+ * @param[in] tx Transmit state. */
+void sl_hci_transport_tx_write_done(sl_hci_transport_tx_t *tx);
+
+/**
+ * Signal the pending transmit completion to the HCI.
+ * Call from the transport process action, outside of
+ * hci_common_transport_transmit(), so that the HCI is not re-entered.
+ * Also retries a transport write that the write function refused.
+ * @param[in] tx Transmit state. */
+void sl_hci_transport_tx_process(sl_hci_transport_tx_t *tx);
+
+/** @} end sl_hci_transport_queue */
+
+#endif // SL_HCI_TRANSPORT_QUEUE_H
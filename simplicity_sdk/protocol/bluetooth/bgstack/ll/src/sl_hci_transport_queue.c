@@ -0,0 +1,263 @@
+/***************************************************************************//**
+ * @file
+ * @brief In-place receive assembly and batched transmit for HCI transports
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from the
+ * use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software in a
+ *    product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <stddef.h>
+#include <string.h>
+#include "sl_core.h"
+#include "sl_hci_common_transport.h"
+#include "sl_hci_transport_queue.h"
+
+// Length of the header following the H4 packet indicator, 0 if unknown
+static uint16_t rx_header_length(uint8_t indicator)
+{
+  switch (indicator) {
+    case SL_HCI_TRANSPORT_H4_COMMAND:
+      return 3;
+    case SL_HCI_TRANSPORT_H4_ACL:
+      return 4;
+    case SL_HCI_TRANSPORT_H4_SCO:
+      return 3;
+    case SL_HCI_TRANSPORT_H4_EVENT:
+      return 2;
+    case SL_HCI_TRANSPORT_H4_ISO:
+      return 4;
+    default:
+      return 0;
+  }
+}
+
+// Payload length from the header following the H4 packet indicator
+static uint16_t rx_payload_length(const uint8_t *packet)
+{
+  switch (packet[0]) {
+    case SL_HCI_TRANSPORT_H4_COMMAND:
+    case SL_HCI_TRANSPORT_H4_SCO:
+      return packet[3];
+    case SL_HCI_TRANSPORT_H4_ACL:
+      return (uint16_t)(packet[3] | (packet[4] << 8));
+    case SL_HCI_TRANSPORT_H4_EVENT:
+      return packet[2];
+    case SL_HCI_TRANSPORT_H4_ISO:
+      // Upper bits of the ISO data length field are reserved
+      return (uint16_t)((packet[3] | (packet[4] << 8)) & 0x3fff);
+    default:
+      return 0;
+  }
+}
+
+static void rx_reset(sl_hci_transport_rx_t *rx)
+{
+  rx->length = 0;
+  rx->expected = 1;
+  rx->header_done = false;
+}
+
+void sl_hci_transport_rx_init(sl_hci_transport_rx_t *rx, uint8_t *buffer, uint16_t size)
+{
+  rx->buffer = buffer;
+  rx->size = size;
+  rx_reset(rx);
+}
+
+uint8_t *sl_hci_transport_rx_get_buffer(sl_hci_transport_rx_t *rx, uint16_t *len)
+{
+  *len = (uint16_t)(rx->expected - rx->length);
+  return &rx->buffer[rx->length];
+}
+
+sl_status_t sl_hci_transport_rx_commit(sl_hci_transport_rx_t *rx, uint16_t len)
+{
+  uint16_t header_len;
+  uint32_t total;
+  int16_t ret;
+
+  if (len > (uint16_t)(rx->expected - rx->length)) {
+    rx_reset(rx);
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  rx->length += len;
+  if (rx->length < rx->expected) {
+    return SL_STATUS_OK;
+  }
+
+  if (!rx->header_done) {
+    header_len = rx_header_length(rx->buffer[0]);
+    if (header_len == 0) {
+      rx_reset(rx);
+      return SL_STATUS_INVALID_PARAMETER;
+    }
+    if (rx->length == 1) {
+      // Packet indicator received, read the header next
+      rx->expected = (uint16_t)(1 + header_len);
+      return SL_STATUS_OK;
+    }
+
+    // Header received, the whole packet length is now known
+    total = 1u + header_len + rx_payload_length(rx->buffer);
+    if (total > rx->size) {
+      rx_reset(rx);
+      return SL_STATUS_WOULD_OVERFLOW;
+    }
+    rx->expected = (uint16_t)total;
+    rx->header_done = true;
+    if (rx->length < rx->expected) {
+      return SL_STATUS_OK;
+    }
+  }
+
+  // The packet is complete, hand it over in one piece
+  ret = hci_common_transport_receive(rx->buffer, (int16_t)rx->length, true);
+  rx_reset(rx);
+  if (ret == -1) {
+    return SL_STATUS_NO_MORE_RESOURCE;
+  } else if (ret != 0) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  return SL_STATUS_OK;
+}
+
+// Start writing the staged messages if the transport is idle.
+// Called with interrupts masked.
+static void tx_start_write(sl_hci_transport_tx_t *tx)
+{
+  uint8_t *data;
+  uint16_t len;
+
+  if (tx->writing || (tx->staged == 0)) {
+    return;
+  }
+
+  data = &tx->buffer[tx->stage * tx->half_size];
+  len = tx->staged;
+  tx->writing = true;
+  tx->stage ^= 1;
+  tx->staged = 0;
+  if (tx->write(data, len) != SL_STATUS_OK) {
+    // Keep the messages staged, sl_hci_transport_tx_process() retries
+    tx->stage ^= 1;
+    tx->staged = len;
+    tx->writing = false;
+    return;
+  }
+  tx->batches++;
+}
+
+// Copy the waiting message into the staging half if it fits.
+// Called with interrupts masked.
+static void tx_stage_pending(sl_hci_transport_tx_t *tx)
+{
+  if ((tx->pending_data == NULL)
+      || ((uint32_t)tx->staged + (uint32_t)tx->pending_len > tx->half_size)) {
+    return;
+  }
+
+  memcpy(&tx->buffer[tx->stage * tx->half_size + tx->staged],
+         tx->pending_data,
+         (size_t)tx->pending_len);
+  tx->staged += (uint16_t)tx->pending_len;
+  tx->pending_data = NULL;
+  tx->pending_len = 0;
+  tx->messages++;
+  // The message is safe in the staging half, the HCI may send the next one
+  tx->complete_pending = true;
+}
+
+void sl_hci_transport_tx_init(sl_hci_transport_tx_t *tx,
+                              uint8_t *buffer,
+                              uint16_t size,
+                              sl_hci_transport_write_t write)
+{
+  tx->buffer = buffer;
+  tx->half_size = size / 2;
+  tx->staged = 0;
+  tx->stage = 0;
+  tx->writing = false;
+  tx->complete_pending = false;
+  tx->pending_data = NULL;
+  tx->pending_len = 0;
+  tx->write = write;
+  tx->batches = 0;
+  tx->messages = 0;
+}
+
+uint32_t sl_hci_transport_tx_enqueue(sl_hci_transport_tx_t *tx, uint8_t *data, int16_t len)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  if ((data == NULL) || (len <= 0) || ((uint16_t)len > tx->half_size)) {
+    return 1;
+  }
+
+  CORE_ENTER_ATOMIC();
+  if (tx->pending_data != NULL) {
+    // The HCI sends the next message only after the transmit complete
+    CORE_EXIT_ATOMIC();
+    return 1;
+  }
+  tx->pending_data = data;
+  tx->pending_len = len;
+  tx_stage_pending(tx);
+  tx_start_write(tx);
+  // A full staging half has been handed to the transport, retry
+  tx_stage_pending(tx);
+  CORE_EXIT_ATOMIC();
+
+  return 0;
+}
+
+void sl_hci_transport_tx_write_done(sl_hci_transport_tx_t *tx)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+  tx->writing = false;
+  tx_stage_pending(tx);
+  tx_start_write(tx);
+  tx_stage_pending(tx);
+  CORE_EXIT_ATOMIC();
+}
+
+void sl_hci_transport_tx_process(sl_hci_transport_tx_t *tx)
+{
+  bool complete;
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+  // Retry a write the transport refused earlier
+  tx_start_write(tx);
+  tx_stage_pending(tx);
+  complete = tx->complete_pending;
+  tx->complete_pending = false;
+  CORE_EXIT_ATOMIC();
+
+  if (complete) {
+    hci_common_transport_transmit_complete(0);
+  }
+}
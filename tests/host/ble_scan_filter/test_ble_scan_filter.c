@@ -0,0 +1,362 @@
+/*
+ * Host replay test of the advertising report filter in
+ * wiseconnect/components/device/silabs/si91x/wireless/ble/src/rsi_ble_scan_filter.c.
+ *
+ * Hand-made reports check each filter stage: the duplicate cache and its
+ * RSSI, data and refresh triggers, the allow list, the AD structure patterns
+ * and the batching. A recorded-like stream of noisy advertisers then checks
+ * that every report is accounted for. The lock hooks, provided by the driver
+ * on the target, check that every entry point takes the lock and that the
+ * batch callback runs with it held.
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include "rsi_ble_scan_filter.c"
+
+#define ADV_IND  0x00
+#define SCAN_RSP 0x04
+
+static int failures;
+
+#define CHECK(cond)                                                   \
+  do {                                                                \
+    if (!(cond)) {                                                    \
+      printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+      failures++;                                                     \
+    }                                                                 \
+  } while (0)
+
+static rsi_ble_scan_filter_t filter;
+
+static unsigned int lock_depth;
+static unsigned int lock_calls;
+
+// Delivered reports
+static rsi_ble_event_adv_report_t delivered[64];
+static unsigned int delivered_cnt;
+static unsigned int batch_calls;
+static uint16_t last_batch_cnt;
+
+void rsi_ble_scan_filter_lock(void)
+{
+  // The driver mutex is not recursive.
+  CHECK(lock_depth == 0);
+  lock_depth++;
+  lock_calls++;
+}
+
+void rsi_ble_scan_filter_unlock(void)
+{
+  CHECK(lock_depth == 1);
+  lock_depth--;
+}
+
+static void on_batch(const rsi_ble_event_adv_report_t *reports, uint16_t count)
+{
+  CHECK(lock_depth == 1);
+  CHECK(count > 0 && count <= RSI_BLE_SCAN_FILTER_BATCH_SIZE);
+  batch_calls++;
+  last_batch_cnt = count;
+  for (uint16_t i = 0; i < count; i++) {
+    if (delivered_cnt < sizeof(delivered) / sizeof(delivered[0])) {
+      delivered[delivered_cnt] = reports[i];
+    }
+    delivered_cnt++;
+  }
+}
+
+static void setup(uint8_t rssi_threshold, uint8_t report_on_data_change, uint32_t refresh_ms, uint32_t batch_window_ms)
+{
+  rsi_ble_scan_filter_config_t config;
+
+  memset(&config, 0, sizeof(config));
+  config.rssi_threshold        = rssi_threshold;
+  config.report_on_data_change = report_on_data_change;
+  config.refresh_ms            = refresh_ms;
+  config.batch_window_ms       = batch_window_ms;
+  rsi_ble_scan_filter_init(&filter, &config, on_batch);
+  delivered_cnt  = 0;
+  batch_calls    = 0;
+  last_batch_cnt = 0;
+}
+
+static rsi_ble_event_adv_report_t report(uint8_t addr, uint8_t report_type, int8_t rssi, const uint8_t *adv, uint8_t len)
+{
+  rsi_ble_event_adv_report_t r;
+
+  memset(&r, 0, sizeof(r));
+  r.dev_addr_type = 0;
+  memset(r.dev_addr, addr, RSI_DEV_ADDR_LEN);
+  r.report_type  = report_type;
+  r.rssi         = rssi;
+  r.adv_data_len = len;
+  memcpy(r.adv_data, adv, len);
+  return r;
+}
+
+static void feed(const rsi_ble_event_adv_report_t *r, uint32_t now_ms)
+{
+  rsi_ble_scan_filter_process(&filter, r, now_ms);
+  CHECK(lock_depth == 0);
+}
+
+static const uint8_t flags_adv[] = { 0x02, 0x01, 0x06 };
+static const uint8_t beacon_adv[] = { 0x02, 0x01, 0x06, 0x05, 0xFF, 0x4C, 0x00, 0x02, 0x15 };
+static const uint8_t other_adv[] = { 0x02, 0x01, 0x06, 0x05, 0xFF, 0x59, 0x00, 0x02, 0x15 };
+
+static void test_duplicates(void)
+{
+  rsi_ble_event_adv_report_t r = report(1, ADV_IND, -60, flags_adv, sizeof(flags_adv));
+
+  setup(6, 1, 1000, 0);
+  feed(&r, 0);
+  feed(&r, 10);
+  CHECK(delivered_cnt == 1);
+  CHECK(filter.stats.duplicates == 1);
+
+  // RSSI moves below, then at the threshold
+  r.rssi = -65;
+  feed(&r, 20);
+  CHECK(delivered_cnt == 1);
+  r.rssi = -54;
+  feed(&r, 30);
+  CHECK(delivered_cnt == 2);
+
+  // Changed advertising data
+  r = report(1, ADV_IND, -54, beacon_adv, sizeof(beacon_adv));
+  feed(&r, 40);
+  CHECK(delivered_cnt == 3);
+  feed(&r, 50);
+  CHECK(delivered_cnt == 3);
+
+  // Refresh, measured from the last delivery
+  feed(&r, 1039);
+  CHECK(delivered_cnt == 3);
+  feed(&r, 1040);
+  CHECK(delivered_cnt == 4);
+
+  // A scan response is remembered apart from the advertisement
+  r.report_type = SCAN_RSP;
+  feed(&r, 1050);
+  CHECK(delivered_cnt == 5);
+  CHECK(delivered[4].report_type == SCAN_RSP);
+
+  // A forgotten advertiser is reported again
+  rsi_ble_scan_filter_reset_cache(&filter);
+  CHECK(lock_depth == 0);
+  feed(&r, 1060);
+  CHECK(delivered_cnt == 6);
+
+  CHECK(filter.stats.received == 10);
+  CHECK(filter.stats.delivered == 6);
+  CHECK(filter.stats.duplicates == 4);
+  CHECK(filter.stats.batches == 6);
+  CHECK(batch_calls == 6);
+}
+
+static void test_ignored_changes(void)
+{
+  rsi_ble_event_adv_report_t r = report(2, ADV_IND, -60, flags_adv, sizeof(flags_adv));
+
+  // Nothing but the first report of an advertiser is delivered
+  setup(0, 0, 0, 0);
+  feed(&r, 0);
+  r.rssi = -20;
+  feed(&r, 10);
+  r = report(2, ADV_IND, -20, beacon_adv, sizeof(beacon_adv));
+  feed(&r, 100000);
+  CHECK(delivered_cnt == 1);
+  CHECK(filter.stats.duplicates == 2);
+}
+
+static void test_allow_list(void)
+{
+  uint8_t addr[RSI_DEV_ADDR_LEN];
+  rsi_ble_event_adv_report_t r;
+
+  setup(0, 0, 0, 0);
+  filter.config.min_rssi = -80;
+  memset(addr, 3, sizeof(addr));
+  CHECK(rsi_ble_scan_filter_add_allow_list(&filter, 0, addr) == RSI_SUCCESS);
+  CHECK(rsi_ble_scan_filter_add_allow_list(NULL, 0, addr) == RSI_ERROR_INVALID_PARAM);
+
+  r = report(4, ADV_IND, -60, flags_adv, sizeof(flags_adv));
+  feed(&r, 0);
+  r = report(3, ADV_IND, -81, flags_adv, sizeof(flags_adv));
+  feed(&r, 0);
+  CHECK(delivered_cnt == 0);
+  CHECK(filter.stats.filtered == 2);
+
+  // Same address, other address type
+  r = report(3, ADV_IND, -80, flags_adv, sizeof(flags_adv));
+  r.dev_addr_type = 1;
+  feed(&r, 0);
+  CHECK(delivered_cnt == 0);
+
+  r.dev_addr_type = 0;
+  feed(&r, 0);
+  CHECK(delivered_cnt == 1);
+
+  for (int i = 1; i < RSI_BLE_SCAN_FILTER_MAX_ALLOW_LIST; i++) {
+    CHECK(rsi_ble_scan_filter_add_allow_list(&filter, 0, addr) == RSI_SUCCESS);
+  }
+  CHECK(rsi_ble_scan_filter_add_allow_list(&filter, 0, addr) == RSI_ERROR_BLE_DEV_BUF_FULL);
+}
+
+static void test_patterns(void)
+{
+  static const uint8_t apple[] = { 0x4C, 0x00 };
+  static const uint8_t ibeacon[] = { 0x02, 0x15 };
+  static const uint8_t truncated[] = { 0x02, 0x01, 0x06, 0x09, 0xFF, 0x4C, 0x00, 0x02, 0x15 };
+  static const uint8_t empty_ad[] = { 0x00, 0x05, 0xFF, 0x4C, 0x00, 0x02, 0x15 };
+  uint8_t long_pattern[RSI_BLE_SCAN_FILTER_MAX_PATTERN_LEN + 1] = { 0 };
+  rsi_ble_event_adv_report_t r;
+
+  setup(0, 0, 0, 0);
+  CHECK(rsi_ble_scan_filter_add_pattern(&filter, 0xFF, 0, sizeof(apple), apple) == RSI_SUCCESS);
+  CHECK(rsi_ble_scan_filter_add_pattern(&filter, 0xFF, 0, 0, apple) == RSI_ERROR_INVALID_PARAM);
+  CHECK(rsi_ble_scan_filter_add_pattern(&filter, 0xFF, 0, sizeof(long_pattern), long_pattern)
+        == RSI_ERROR_INVALID_PARAM);
+  CHECK(rsi_ble_scan_filter_add_pattern(&filter, 0xFF, RSI_MAX_ADV_REPORT_SIZE - 1, 2, apple)
+        == RSI_ERROR_INVALID_PARAM);
+
+  r = report(5, ADV_IND, -60, other_adv, sizeof(other_adv));
+  feed(&r, 0);
+  r = report(6, ADV_IND, -60, flags_adv, sizeof(flags_adv));
+  feed(&r, 0);
+  CHECK(delivered_cnt == 0);
+
+  r = report(7, ADV_IND, -60, beacon_adv, sizeof(beacon_adv));
+  feed(&r, 0);
+  CHECK(delivered_cnt == 1);
+
+  // Malformed AD structures end the walk without reading past the data
+  r = report(8, ADV_IND, -60, truncated, sizeof(truncated));
+  feed(&r, 0);
+  r = report(9, ADV_IND, -60, empty_ad, sizeof(empty_ad));
+  feed(&r, 0);
+  r = report(10, ADV_IND, -60, beacon_adv, sizeof(beacon_adv));
+  r.adv_data_len = 6;
+  feed(&r, 0);
+  CHECK(delivered_cnt == 1);
+
+  // An out of range length is clipped to the report size
+  r = report(11, ADV_IND, -60, beacon_adv, sizeof(beacon_adv));
+  r.adv_data_len = 0xFF;
+  feed(&r, 0);
+  CHECK(delivered_cnt == 2);
+
+  // A pattern at an offset, any pattern matching is enough
+  CHECK(rsi_ble_scan_filter_add_pattern(&filter, 0xFF, 2, sizeof(ibeacon), ibeacon) == RSI_SUCCESS);
+  r = report(12, ADV_IND, -60, other_adv, sizeof(other_adv));
+  feed(&r, 0);
+  CHECK(delivered_cnt == 3);
+  CHECK(filter.stats.filtered == 5);
+}
+
+static void test_batching(void)
+{
+  rsi_ble_event_adv_report_t r;
+
+  setup(0, 0, 0, 100);
+  for (uint8_t i = 0; i < 3; i++) {
+    r = report((uint8_t)(20 + i), ADV_IND, -60, flags_adv, sizeof(flags_adv));
+    feed(&r, 10U * i);
+  }
+  CHECK(batch_calls == 0);
+
+  // The window starts at the first pending report
+  rsi_ble_scan_filter_poll(&filter, 99);
+  CHECK(batch_calls == 0);
+  rsi_ble_scan_filter_poll(&filter, 100);
+  CHECK(lock_depth == 0);
+  CHECK(batch_calls == 1);
+  CHECK(last_batch_cnt == 3);
+  CHECK(delivered[0].dev_addr[0] == 20 && delivered[2].dev_addr[0] == 22);
+
+  // Nothing pending, nothing delivered
+  rsi_ble_scan_filter_poll(&filter, 1000);
+  rsi_ble_scan_filter_flush(&filter);
+  CHECK(batch_calls == 1);
+
+  // A full batch is delivered at once
+  for (uint8_t i = 0; i < RSI_BLE_SCAN_FILTER_BATCH_SIZE + 2; i++) {
+    r = report((uint8_t)(30 + i), ADV_IND, -60, flags_adv, sizeof(flags_adv));
+    feed(&r, 200);
+  }
+  CHECK(batch_calls == 2);
+  CHECK(last_batch_cnt == RSI_BLE_SCAN_FILTER_BATCH_SIZE);
+
+  // A report after the window delivers the pending ones first
+  r = report(50, ADV_IND, -60, flags_adv, sizeof(flags_adv));
+  feed(&r, 300);
+  CHECK(batch_calls == 3);
+  CHECK(last_batch_cnt == 2);
+
+  rsi_ble_scan_filter_flush(&filter);
+  CHECK(lock_depth == 0);
+  CHECK(batch_calls == 4);
+  CHECK(last_batch_cnt == 1);
+  CHECK(delivered_cnt == 3 + RSI_BLE_SCAN_FILTER_BATCH_SIZE + 2 + 1);
+  CHECK(filter.stats.batches == batch_calls);
+  CHECK(filter.stats.delivered == delivered_cnt);
+}
+
+static void test_replay(void)
+{
+  uint32_t seed = 1;
+  rsi_ble_event_adv_report_t r;
+  unsigned int reports = 0;
+
+  // 24 advertisers, each advertising every 100 ms with +-3 dB of RSSI noise,
+  // for 10 s.
+  setup(8, 1, 2000, 50);
+  for (uint32_t now_ms = 0; now_ms < 10000; now_ms += 25) {
+    for (uint8_t adv = 0; adv < 24; adv++) {
+      if ((adv % 4) != ((now_ms / 25) % 4)) {
+        continue;
+      }
+      seed = seed * 1103515245U + 12345U;
+      r = report((uint8_t)(100 + adv), ADV_IND, (int8_t)(-70 + (int)((seed >> 16) % 7) - 3), flags_adv,
+                 sizeof(flags_adv));
+      feed(&r, now_ms);
+      reports++;
+    }
+    rsi_ble_scan_filter_poll(&filter, now_ms);
+  }
+  rsi_ble_scan_filter_flush(&filter);
+
+  CHECK(filter.stats.received == reports);
+  CHECK(filter.stats.received == filter.stats.filtered + filter.stats.duplicates + filter.stats.delivered);
+  CHECK(filter.stats.delivered == delivered_cnt);
+  CHECK(filter.stats.batches == batch_calls);
+  CHECK(filter.batch_cnt == 0);
+  // Noise alone never crosses the threshold, so deliveries come from the
+  // first sighting, the refresh and the few evictions of probe collisions.
+  CHECK(filter.stats.delivered >= 24U * 5U);
+  CHECK(filter.stats.delivered * 4U < reports);
+  printf("test_ble_scan_filter: replay: %u reports, %lu delivered in %lu batches\n",
+         reports,
+         (unsigned long)filter.stats.delivered,
+         (unsigned long)filter.stats.batches);
+}
+
+int main(void)
+{
+  test_duplicates();
+  test_ignored_changes();
+  test_allow_list();
+  test_patterns();
+  test_batching();
+  test_replay();
+  CHECK(lock_calls > 0);
+  CHECK(lock_depth == 0);
+
+  if (failures != 0) {
+    printf("test_ble_scan_filter: %d check(s) failed\n", failures);
+    return 1;
+  }
+  printf("test_ble_scan_filter: passed\n");
+  return 0;
+}
@@ -0,0 +1,218 @@
+/*
+ * Host loopback test of the HCI transport queue in
+ * simplicity_sdk/protocol/bluetooth/bgstack/ll/src/sl_hci_transport_queue.c.
+ *
+ * A simulated HCI sends H4 events and ACL packets through the transmit
+ * batching as fast as completions allow. A simulated UART, slower than the
+ * HCI, moves each transport write into a loopback byte stream. The stream is
+ * read back in uneven pieces through the receive assembly, which must hand
+ * over every packet intact and in order.
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include "sl_hci_transport_queue.c"
+
+#define MESSAGES        200U
+#define MAX_MESSAGE     (1U + 4U + 200U)
+#define UART_BYTES_TICK 32U
+#define MAX_TICKS       100000U
+
+static int failures;
+
+#define CHECK(cond)                                                   \
+  do {                                                                \
+    if (!(cond)) {                                                    \
+      printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+      failures++;                                                     \
+    }                                                                 \
+  } while (0)
+
+static sl_hci_transport_tx_t tx;
+static sl_hci_transport_rx_t rx;
+static uint8_t tx_buffer[2 * MAX_MESSAGE];
+static uint8_t rx_buffer[MAX_MESSAGE];
+
+// HCI side
+static uint8_t hci_message[MAX_MESSAGE];
+static bool hci_ready;
+static bool in_enqueue;
+static unsigned int received;
+
+// UART side
+static const uint8_t *uart_data;
+static uint16_t uart_len;
+static unsigned int uart_ticks;
+static unsigned int refuse_every;
+static unsigned int write_attempts;
+static uint8_t loopback[MESSAGES * MAX_MESSAGE];
+static size_t loopback_head;
+static size_t loopback_tail;
+
+static unsigned int atomic_depth;
+
+CORE_irqState_t CORE_EnterAtomic(void)
+{
+  atomic_depth++;
+  return 0;
+}
+
+void CORE_ExitAtomic(CORE_irqState_t irqState)
+{
+  (void)irqState;
+  atomic_depth--;
+}
+
+// Build message n, alternating events and ACL packets of varying length
+static uint16_t make_message(unsigned int n, uint8_t *msg)
+{
+  uint16_t payload;
+  uint16_t header;
+  uint16_t i;
+
+  if ((n % 2U) == 0U) {
+    payload = (uint16_t)(1U + ((n * 37U) % 60U));
+    msg[0] = SL_HCI_TRANSPORT_H4_EVENT;
+    msg[1] = 0x3e;
+    msg[2] = (uint8_t)payload;
+    header = 3;
+  } else {
+    payload = (uint16_t)(1U + ((n * 53U) % 200U));
+    msg[0] = SL_HCI_TRANSPORT_H4_ACL;
+    msg[1] = 0x01;
+    msg[2] = 0x20;
+    msg[3] = (uint8_t)payload;
+    msg[4] = (uint8_t)(payload >> 8);
+    header = 5;
+  }
+  for (i = 0; i < payload; i++) {
+    msg[header + i] = (uint8_t)(n + i);
+  }
+  return (uint16_t)(header + payload);
+}
+
+int16_t sl_btctrl_hci_receive(uint8_t *data, int16_t len, bool lastFragment)
+{
+  uint8_t expected[MAX_MESSAGE];
+  uint16_t expected_len = make_message(received, expected);
+
+  CHECK(lastFragment);
+  CHECK(len == (int16_t)expected_len);
+  CHECK(memcmp(data, expected, expected_len) == 0);
+  received++;
+  return 0;
+}
+
+void sl_btctrl_hci_transmit_complete(uint32_t status)
+{
+  CHECK(status == 0U);
+  // The HCI must not be re-entered from the transmit call
+  CHECK(!in_enqueue);
+  CHECK(atomic_depth == 0U);
+  hci_ready = true;
+}
+
+static sl_status_t uart_write(const uint8_t *data, uint16_t len)
+{
+  CHECK(uart_data == NULL);
+  write_attempts++;
+  if ((refuse_every != 0U) && ((write_attempts % refuse_every) == 0U)) {
+    return SL_STATUS_FAIL;
+  }
+  uart_data = data;
+  uart_len = len;
+  uart_ticks = 1U + (len / UART_BYTES_TICK);
+  return SL_STATUS_OK;
+}
+
+static void uart_tick(void)
+{
+  if ((uart_data == NULL) || (--uart_ticks != 0U)) {
+    return;
+  }
+  memcpy(&loopback[loopback_head], uart_data, uart_len);
+  loopback_head += uart_len;
+  uart_data = NULL;
+  sl_hci_transport_tx_write_done(&tx);
+}
+
+// Read the loopback stream in pieces of at most chunk bytes
+static void host_receive(size_t chunk)
+{
+  uint8_t *dst;
+  uint16_t len;
+
+  while (loopback_tail < loopback_head) {
+    dst = sl_hci_transport_rx_get_buffer(&rx, &len);
+    if (len > chunk) {
+      len = (uint16_t)chunk;
+    }
+    if (len > loopback_head - loopback_tail) {
+      len = (uint16_t)(loopback_head - loopback_tail);
+    }
+    memcpy(dst, &loopback[loopback_tail], len);
+    loopback_tail += len;
+    CHECK(sl_hci_transport_rx_commit(&rx, len) == SL_STATUS_OK);
+  }
+}
+
+static void run(const char *name, unsigned int refuse)
+{
+  unsigned int sent = 0;
+  unsigned int tick;
+  uint16_t len;
+
+  sl_hci_transport_tx_init(&tx, tx_buffer, sizeof(tx_buffer), uart_write);
+  sl_hci_transport_rx_init(&rx, rx_buffer, sizeof(rx_buffer));
+  hci_ready = true;
+  received = 0;
+  uart_data = NULL;
+  refuse_every = refuse;
+  write_attempts = 0;
+  loopback_head = 0;
+  loopback_tail = 0;
+
+  for (tick = 0; (tick < MAX_TICKS) && (received < MESSAGES); tick++) {
+    // The HCI produces at most one message per tick
+    if (hci_ready && (sent < MESSAGES)) {
+      hci_ready = false;
+      len = make_message(sent, hci_message);
+      in_enqueue = true;
+      CHECK(sl_hci_transport_tx_enqueue(&tx, hci_message, (int16_t)len) == 0U);
+      in_enqueue = false;
+      sent++;
+    }
+    uart_tick();
+    sl_hci_transport_tx_process(&tx);
+    host_receive(1U + (tick % 7U) * 13U);
+  }
+
+  CHECK(received == MESSAGES);
+  CHECK(tx.messages == MESSAGES);
+  CHECK(atomic_depth == 0U);
+  // Messages staged while the UART is busy leave together
+  CHECK(tx.batches <= MESSAGES / 2U);
+  printf("test_hci_transport_queue: %s: %u messages in %lu writes, %u ticks\n",
+         name, received, (unsigned long)tx.batches, tick);
+}
+
+int main(void)
+{
+  uint8_t big[MAX_MESSAGE + 1];
+
+  run("loopback", 0);
+  // Every third write is refused and must be retried by the process call,
+  // including after the HCI has nothing left to send.
+  run("refused writes", 3);
+
+  sl_hci_transport_tx_init(&tx, tx_buffer, sizeof(tx_buffer), uart_write);
+  CHECK(sl_hci_transport_tx_enqueue(&tx, big, (int16_t)sizeof(big)) != 0U);
+  CHECK(sl_hci_transport_tx_enqueue(&tx, NULL, 1) != 0U);
+
+  if (failures != 0) {
+    printf("test_hci_transport_queue: %d check(s) failed\n", failures);
+    return 1;
+  }
+  printf("test_hci_transport_queue: passed\n");
+  return 0;
+}
@@ -0,0 +1,12 @@
+/*
+ * Host stand-in for the CMSIS-RTOS2 header. The WiSeConnect BLE headers only
+ * need the object handle types to compile on the host. No kernel function
+ * is declared, so a test that reaches one fails to build.
+ */
+#ifndef HOST_CMSIS_OS2_H
+#define HOST_CMSIS_OS2_H
+
+typedef void *osMutexId_t;
+typedef void *osSemaphoreId_t;
+
+#endif
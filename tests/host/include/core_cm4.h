@@ -0,0 +1,2 @@
+/* Host stand-in, see host_core_cm.h. */
+#include "host_core_cm.h"
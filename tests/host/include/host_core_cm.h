@@ -0,0 +1,52 @@
+/*
+ * Host stand-in for the CMSIS core headers. The device headers only need the
+ * register qualifiers and a few intrinsics to compile on the host. Nothing
+ * in here touches a real core register.
+ */
+#ifndef HOST_CORE_CM_H
+#define HOST_CORE_CM_H
+
+#include <stdint.h>
+
+#define __I                     volatile const
+#define __O                     volatile
+#define __IO                    volatile
+#define __IM                    volatile const
+#define __OM                    volatile
+#define __IOM                   volatile
+
+#define __ASM                   __asm
+#define __INLINE                inline
+#define __STATIC_INLINE         static inline
+#define __STATIC_FORCEINLINE    static inline
+#define __WEAK                  __attribute__((weak))
+#define __PACKED                __attribute__((packed))
+#define __ALIGNED(x)            __attribute__((aligned(x)))
+#define __USED                  __attribute__((used))
+
+#define __NOP()                 do {} while (0)
+#define __DSB()                 do {} while (0)
+#define __ISB()                 do {} while (0)
+#define __DMB()                 do {} while (0)
+#define __CLZ(x)                ((uint8_t)((x) == 0U ? 32U : (uint32_t)__builtin_clz(x)))
+#define __REV(x)                __builtin_bswap32(x)
+
+static inline uint32_t __get_PRIMASK(void)
+{
+  return 0;
+}
+
+static inline void __set_PRIMASK(uint32_t primask)
+{
+  (void)primask;
+}
+
+static inline void __disable_irq(void)
+{
+}
+
+static inline void __enable_irq(void)
+{
+}
+
+#endif /* HOST_CORE_CM_H */
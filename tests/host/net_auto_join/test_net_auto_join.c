@@ -0,0 +1,223 @@
+/*
+ * Host test of the auto-join ranking and backoff in
+ * wiseconnect/components/service/network_manager/src/sli_net_auto_join.c.
+ *
+ * Scan results in the layout the NWP reports them are matched against
+ * stored client profiles. The candidates must be the visible profiles only,
+ * each with the strongest RSSI of its network, in priority then RSSI order.
+ * The backoff must double from AUTO_JOIN_BACKOFF_MIN_MS up to
+ * AUTO_JOIN_BACKOFF_MAX_MS and stay within its jitter bounds.
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include "sli_net_auto_join.c"
+
+#define PROFILES    6U
+#define MAX_RESULTS 16U
+
+static int failures;
+
+#define CHECK(cond)                                                   \
+  do {                                                                \
+    if (!(cond)) {                                                    \
+      printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+      failures++;                                                     \
+    }                                                                 \
+  } while (0)
+
+// Room for the scan_info entries following the header
+static union {
+  sl_wifi_scan_result_t result;
+  uint8_t bytes[sizeof(sl_wifi_scan_result_t) + MAX_RESULTS * sizeof(((sl_wifi_scan_result_t *)0)->scan_info[0])];
+} scan;
+
+static sl_net_wifi_client_profile_t profiles[PROFILES];
+static sli_net_auto_join_candidate_t candidates[PROFILES];
+
+static void set_profile(uint8_t id, const char *ssid, uint8_t priority)
+{
+  memset(&profiles[id], 0, sizeof(profiles[id]));
+  profiles[id].config.ssid.length = (uint8_t)strlen(ssid);
+  memcpy(profiles[id].config.ssid.value, ssid, strlen(ssid));
+  profiles[id].priority = priority;
+}
+
+static void add_bss(const char *ssid, uint8_t bssid_last, uint8_t channel, uint8_t rssi_magnitude)
+{
+  uint32_t i = scan.result.scan_count++;
+
+  memset(&scan.result.scan_info[i], 0, sizeof(scan.result.scan_info[i]));
+  memcpy(scan.result.scan_info[i].ssid, ssid, strlen(ssid));
+  scan.result.scan_info[i].bssid[0]   = 0x02;
+  scan.result.scan_info[i].bssid[5]   = bssid_last;
+  scan.result.scan_info[i].rf_channel = channel;
+  scan.result.scan_info[i].rssi_val   = rssi_magnitude;
+}
+
+static void reset(void)
+{
+  memset(&scan, 0, sizeof(scan));
+  memset(profiles, 0, sizeof(profiles));
+  memset(candidates, 0xA5, sizeof(candidates));
+}
+
+static uint8_t rank(const sl_wifi_scan_result_t *results)
+{
+  return sli_net_rank_auto_join_candidates(results, profiles, PROFILES, candidates);
+}
+
+static void test_ranking(void)
+{
+  uint8_t count;
+
+  reset();
+  set_profile(0, "office", 2);
+  set_profile(1, "home", 1);
+  set_profile(2, "cafe", 1);
+  set_profile(3, "away", 0);
+  // Profile 4 is not stored
+  set_profile(5, "lab", 2);
+
+  // Two BSSs of "home", the strongest one counts
+  add_bss("home", 1, 1, 70);
+  add_bss("home", 2, 6, 45);
+  add_bss("cafe", 3, 11, 50);
+  add_bss("office", 4, 1, 60);
+  add_bss("lab", 5, 6, 30);
+  add_bss("neighbour", 6, 6, 20);
+
+  count = rank(&scan.result);
+  CHECK(count == 4);
+  CHECK(candidates[0].profile_id == 1 && candidates[0].rssi == -45 && candidates[0].priority == 1);
+  CHECK(candidates[1].profile_id == 2 && candidates[1].rssi == -50);
+  CHECK(candidates[2].profile_id == 5 && candidates[2].rssi == -30);
+  CHECK(candidates[3].profile_id == 0 && candidates[3].rssi == -60);
+
+  // Equal priority and RSSI keep the profile order
+  reset();
+  set_profile(3, "b", 0);
+  set_profile(1, "a", 0);
+  add_bss("b", 1, 1, 40);
+  add_bss("a", 2, 1, 40);
+  count = rank(&scan.result);
+  CHECK(count == 2);
+  CHECK(candidates[0].profile_id == 1 && candidates[1].profile_id == 3);
+}
+
+static void test_matching(void)
+{
+  static const char full[] = "0123456789abcdef0123456789abcdef";
+  uint8_t count;
+
+  reset();
+  set_profile(0, "home", 0);
+  set_profile(1, full, 0);
+
+  // Neither a prefix nor an extension of the SSID matches
+  add_bss("hom", 1, 1, 40);
+  add_bss("home2", 2, 1, 40);
+  count = rank(&scan.result);
+  CHECK(count == 0);
+
+  // A 32 byte SSID fills the profile
+  add_bss(full, 3, 1, 40);
+  count = rank(&scan.result);
+  CHECK(count == 1 && candidates[0].profile_id == 1);
+
+  // A pinned BSSID only matches that BSS
+  reset();
+  set_profile(0, "home", 0);
+  profiles[0].config.bssid.octet[0] = 0x02;
+  profiles[0].config.bssid.octet[5] = 2;
+  add_bss("home", 1, 1, 30);
+  add_bss("home", 2, 1, 60);
+  count = rank(&scan.result);
+  CHECK(count == 1 && candidates[0].rssi == -60);
+
+  // So does a pinned channel
+  reset();
+  set_profile(0, "home", 0);
+  profiles[0].config.channel.channel = 6;
+  add_bss("home", 1, 1, 30);
+  add_bss("home", 2, 6, 55);
+  count = rank(&scan.result);
+  CHECK(count == 1 && candidates[0].rssi == -55);
+
+  profiles[0].config.channel.channel = 11;
+  count = rank(&scan.result);
+  CHECK(count == 0);
+
+  // An empty scan has no candidate
+  reset();
+  set_profile(0, "home", 0);
+  count = rank(&scan.result);
+  CHECK(count == 0);
+}
+
+static void test_failed_scan(void)
+{
+  uint8_t count;
+
+  reset();
+  set_profile(0, "office", 2);
+  set_profile(2, "home", 1);
+  set_profile(5, "away", 1);
+
+  // Every stored profile is a candidate, in priority order
+  count = rank(NULL);
+  CHECK(count == 3);
+  CHECK(candidates[0].profile_id == 2 && candidates[0].rssi == SLI_NET_AUTO_JOIN_UNKNOWN_RSSI);
+  CHECK(candidates[1].profile_id == 5);
+  CHECK(candidates[2].profile_id == 0);
+}
+
+static void test_backoff(void)
+{
+  uint32_t expected = AUTO_JOIN_BACKOFF_MIN_MS;
+
+  for (uint32_t retry = 0; retry < 40; retry++) {
+    // No jitter, then the largest jitter
+    CHECK(sli_net_get_auto_join_backoff(retry, 0) == expected);
+    CHECK(sli_net_get_auto_join_backoff(retry, expected / 2) == expected - expected / 2);
+    CHECK(sli_net_get_auto_join_backoff(retry, expected / 2 + 1) == expected);
+    if (expected < AUTO_JOIN_BACKOFF_MAX_MS) {
+      expected <<= 1;
+      if (expected > AUTO_JOIN_BACKOFF_MAX_MS) {
+        expected = AUTO_JOIN_BACKOFF_MAX_MS;
+      }
+    }
+  }
+  CHECK(expected == AUTO_JOIN_BACKOFF_MAX_MS);
+  CHECK(sli_net_get_auto_join_backoff(UINT32_MAX, 0) == AUTO_JOIN_BACKOFF_MAX_MS);
+
+  // Any random value keeps the delay within half of the nominal one
+  uint32_t random = 1;
+  for (uint32_t i = 0; i < 10000; i++) {
+    uint32_t retry = i % 8;
+    uint32_t delay;
+
+    random ^= random << 13;
+    random ^= random >> 17;
+    random ^= random << 5;
+    delay = sli_net_get_auto_join_backoff(retry, random);
+    CHECK(delay <= AUTO_JOIN_BACKOFF_MAX_MS);
+    CHECK(delay >= AUTO_JOIN_BACKOFF_MIN_MS / 2);
+    CHECK(delay >= sli_net_get_auto_join_backoff(retry, 0) / 2);
+  }
+}
+
+int main(void)
+{
+  test_ranking();
+  test_matching();
+  test_failed_scan();
+  test_backoff();
+
+  if (failures != 0) {
+    printf("test_net_auto_join: %d check(s) failed\n", failures);
+    return 1;
+  }
+  printf("test_net_auto_join: passed\n");
+  return 0;
+}
@@ -0,0 +1,87 @@
+#!/bin/sh
+# Build and run the host tests.
+#
+# Usage: tests/host/run.sh [test...]
+#
+# Each test is a single C file that includes the source under test, so that
+# static helpers can be reached and register blocks can be replaced by RAM
+# mocks. CC defaults to cc.
+
+set -e
+
+root=$(cd "$(dirname "$0")/../.." && pwd)
+host="$root/tests/host"
+CC=${CC:-cc}
+out=$(mktemp -d)
+trap 'rm -rf "$out"' EXIT
+
+CFLAGS="-std=c99 -Wall -Wextra -Werror -ffunction-sections -fdata-sections -I$host/include"
+LDFLAGS="-Wl,--gc-sections"
+
+gecko="-I$root/gecko/emlib/inc -I$root/gecko/emlib/src -I$root/gecko/common/inc"
+sdk="$root/simplicity_sdk"
+
+# build <test> <flags...>, BIN names the executable when a test is built
+# several times.
+build() {
+  name=$1
+  bin=${BIN:-$name}
+  shift
+  echo "CC    $bin"
+  # shellcheck disable=SC2086
+  $CC $CFLAGS "$@" "$host/$name/test_$name.c" $LDFLAGS -o "$out/$bin"
+  "$out/$bin"
+}
+
+timer_capture() {
+  # The capture ring position is read back from a 32-bit LDMA register.
+  build timer_capture -DEFR32MG12P332F1024GL125 -Wno-pointer-to-int-cast \
+    -I"$root/gecko/Device/SiliconLabs/EFR32MG12P/Include" $gecko
+}
+
+hci_transport_queue() {
+  ll="$sdk/protocol/bluetooth/bgstack/ll"
+  build hci_transport_queue -I"$sdk/platform/common/inc" -I"$ll/inc" -I"$ll/src"
+}
+
+si32_inline_accessors() {
+  hal="$root/si32/si32Hal"
+  for device in sim3c1xx sim3l1xx sim3u1xx; do
+    mkdir -p "$out/$device"
+    python3 "$host/si32_inline_accessors/gen_accessors.py" "$out/$device" \
+      "$hal/SI32_Modules" "$hal/$device"
+    # The DMA descriptors hold 32-bit addresses.
+    BIN=si32_inline_accessors_$device build si32_inline_accessors \
+      -Wno-pointer-to-int-cast -I"$out/$device" -I"$hal/SI32_Modules" -I"$hal/$device" \
+      "$host/si32_inline_accessors/out_of_line.c"
+  done
+}
+
+si32_system_clock() {
+  hal="$root/si32/si32Hal"
+  for device in sim3c1xx sim3l1xx sim3u1xx; do
+    BIN=si32_system_clock_$device build si32_system_clock \
+      -Dsi32HalOption_disable_pin_reset_delay -DSYSTEM_SOURCE="\"system_$device.c\"" \
+      -I"$hal/SI32_Modules" -I"$hal/$device"
+  done
+}
+
+ble_scan_filter() {
+  wisc="$root/wiseconnect/components"
+  si91x="$wisc/device/silabs/si91x/wireless"
+  build ble_scan_filter -I"$si91x/ble/inc" -I"$si91x/ble/src" -I"$si91x/inc" -I"$wisc/protocol/wifi/inc" \
+    -I"$wisc/common/inc" -I"$sdk/platform/common/inc"
+}
+
+net_auto_join() {
+  wisc="$root/wiseconnect/components"
+  build net_auto_join -I"$wisc/service/network_manager/inc" -I"$wisc/service/network_manager/src" \
+    -I"$wisc/common/inc" -I"$wisc/protocol/wifi/inc" -I"$wisc/device/silabs/si91x/wireless/inc" \
+    -I"$sdk/platform/common/inc"
+}
+
+all="timer_capture hci_transport_queue si32_inline_accessors si32_system_clock ble_scan_filter net_auto_join"
+
+for t in ${*:-$all}; do
+  $t
+done
@@ -0,0 +1,59 @@
+/*
+ * Wrappers shared by both halves of the si32 inline accessor test. Each
+ * ACCESSOR() line of the generated accessors.inc becomes a function
+ * CALL_PREFIX<accessor>(block) that calls the accessor on the register block
+ * and returns its result folded into 32 bits.
+ */
+#ifndef ACCESSOR_CALL_H
+#define ACCESSOR_CALL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Source of the structure arguments
+extern const uint32_t ARG_PATTERN[16];
+
+static inline uint32_t fold(const void *data, size_t size)
+{
+  const uint8_t *bytes = data;
+  uint32_t hash = 2166136261U;
+  size_t i;
+
+  for (i = 0; i < size; i++) {
+    hash = (hash ^ bytes[i]) * 16777619U;
+  }
+  return hash;
+}
+
+#define CALL_NAME2(prefix, name) prefix##name
+#define CALL_NAME(prefix, name) CALL_NAME2(prefix, name)
+
+#define ACCESSOR(type, kind, ret, name, args) ACCESSOR_##kind(type, ret, name, args)
+
+#define ACCESSOR_VOID(type, ret, name, args)             \
+  CALL_STORAGE uint32_t CALL_NAME(CALL_PREFIX, name)(void *block); \
+  CALL_STORAGE uint32_t CALL_NAME(CALL_PREFIX, name)(void *block)  \
+  {                                                    \
+    type *p = block;                                   \
+    name args;                                         \
+    return 0;                                          \
+  }
+
+#define ACCESSOR_VALUE(type, ret, name, args)            \
+  CALL_STORAGE uint32_t CALL_NAME(CALL_PREFIX, name)(void *block); \
+  CALL_STORAGE uint32_t CALL_NAME(CALL_PREFIX, name)(void *block)  \
+  {                                                    \
+    type *p = block;                                   \
+    return (uint32_t)name args;                        \
+  }
+
+#define ACCESSOR_STRUCT(type, ret, name, args)           \
+  CALL_STORAGE uint32_t CALL_NAME(CALL_PREFIX, name)(void *block); \
+  CALL_STORAGE uint32_t CALL_NAME(CALL_PREFIX, name)(void *block)  \
+  {                                                    \
+    type *p = block;                                   \
+    ret result = name args;                            \
+    return fold(&result, sizeof(result));              \
+  }
+
+#endif // ACCESSOR_CALL_H
@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+"""Generate the accessor calls of the si32 inline accessor test.
+
+Usage: gen_accessors.py <output dir> <SI32_Modules dir> <device dir>
+
+Covers the modules listed by the device header, plus the device specific
+modules. Writes accessors.inc, one ACCESSOR() line per static inline accessor
+of their SI32_*_Type.h headers, type_headers.inc, which includes the headers,
+and type_sources.inc, which includes the matching SI32_*_Type.c. Arguments
+are derived from a fixed pattern and kept inside the range asserted by the
+accessor, so both forms see the same valid call. Structure arguments are
+read from the ARG_PATTERN words and structure results are hashed.
+"""
+
+import os
+import re
+import sys
+
+ASSERT_LT = re.compile(r"assert\((\w+) < (\w+)\);")
+ASSERT_LE = re.compile(r"assert\((\w+) <= (\w+)\);")
+ASSERT_RANGE = re.compile(r"assert\(\((\w+) >= (\w+)\) && \(\1 <= (\w+)\)\);")
+PARAM = re.compile(r"^\s*(.*?)\s*(\w+)\s*[,)]\s*$")
+MODULE = re.compile(r"#include <SI32_(\w+)_Registers.h>")
+
+
+def is_struct(ctype):
+    return ctype.endswith("_Type") and not ctype.endswith("_Enum_Type")
+
+
+def module_headers(mods, device):
+    """List the (directory, Type.h) pairs of the modules of a device."""
+    name = os.path.basename(os.path.normpath(device))
+    headers = [(device, f) for f in sorted(os.listdir(device)) if f.endswith("_Type.h")]
+    for module in MODULE.findall(open(os.path.join(device, name + ".h")).read()):
+        header = "SI32_%s_Type.h" % module
+        if os.path.exists(os.path.join(mods, header)):
+            headers.append((mods, header))
+    return sorted(headers, key=lambda h: h[1])
+
+
+def parse(path):
+    """Yield (base type, return type, name, [(type, name)], {name: (lo, hi)})."""
+    lines = open(path).read().splitlines()
+    i = 0
+    while i < len(lines):
+        if not lines[i].startswith("static inline "):
+            i += 1
+            continue
+        ret = lines[i][len("static inline "):].strip()
+        name = lines[i + 1].strip().rstrip("(")
+        params = []
+        i += 2
+        while not lines[i].startswith("{"):
+            if not lines[i].strip().startswith("//"):
+                m = PARAM.match(lines[i])
+                params.append((m.group(1), m.group(2)))
+            i += 1
+        bounds = {}
+        while not lines[i].startswith("}"):
+            line = lines[i].strip()
+            m = ASSERT_RANGE.match(line)
+            if m:
+                bounds[m.group(1)] = (m.group(2), m.group(3))
+            m = ASSERT_LE.match(line)
+            if m:
+                bounds[m.group(1)] = ("0", m.group(2))
+            m = ASSERT_LT.match(line)
+            if m:
+                bounds[m.group(1)] = ("0", "(%s) - 1" % m.group(2))
+            i += 1
+        yield params[0][0].rstrip(" *"), ret, name, params[1:], bounds
+
+
+def main():
+    out, mods, device = sys.argv[1:4]
+    headers = module_headers(mods, device)
+    calls = []
+    skipped = 0
+    seed = 0x9e3779b9
+    for d, header in headers:
+        for base, ret, name, params, bounds in parse(os.path.join(d, header)):
+            if any("*" in ptype for ptype, _ in params):
+                # Pointers other than the register block are not exercised
+                skipped += 1
+                continue
+            args = ["p"]
+            for ptype, pname in params:
+                seed = (seed * 1103515245 + 12345) & 0xffffffff
+                if is_struct(ptype):
+                    args.append("*(const %s *)ARG_PATTERN" % ptype)
+                    continue
+                if pname in bounds:
+                    lo, hi = bounds[pname]
+                    value = "(%s) + (0x%08xU %% ((uint32_t)(%s) - (uint32_t)(%s) + 1U))" % (lo, seed, hi, lo)
+                else:
+                    value = "0x%08xU" % seed
+                args.append("(%s)(%s)" % (ptype, value))
+            kind = "VOID" if ret == "void" else "STRUCT" if is_struct(ret) else "VALUE"
+            calls.append("ACCESSOR(%s, %s, %s, %s, (%s))" % (base, kind, ret, name, ", ".join(args)))
+
+    with open(os.path.join(out, "accessors.inc"), "w") as f:
+        f.write("// Generated by gen_accessors.py, %d accessors, %d skipped\n"
+                % (len(calls), skipped))
+        f.write("\n".join(calls) + "\n")
+    with open(os.path.join(out, "type_headers.inc"), "w") as f:
+        for _, header in headers:
+            f.write('#include "%s"\n' % header)
+    with open(os.path.join(out, "type_sources.inc"), "w") as f:
+        for d, header in headers:
+            source = header[:-2] + ".c"
+            if os.path.exists(os.path.join(d, source)):
+                f.write('#include "%s"\n' % source)
+
+
+if __name__ == "__main__":
+    main()
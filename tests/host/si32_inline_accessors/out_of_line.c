@@ -0,0 +1,28 @@
+/*
+ * Out-of-line half of the si32 inline accessor test. Builds the
+ * SI32_*_Type.c files as shipped and wraps each generated accessor call in
+ * an ool_<accessor>() function.
+ */
+#include <stdint.h>
+
+// The vendor Type.c files range-check unsigned arguments against 0, leave a
+// few parameters unused and fall through some switch cases.
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wimplicit-fallthrough"
+#include "type_sources.inc"
+
+#define CALL_PREFIX ool
+#define CALL_STORAGE
+#include "accessor_call.h"
+
+const uint32_t ARG_PATTERN[16] = {
+  0x01234567, 0x89abcdef, 0xfedcba98, 0x76543210,
+  0x0f1e2d3c, 0x4b5a6978, 0x8796a5b4, 0xc3d2e1f0,
+  0xdeadbeef, 0xcafef00d, 0x13579bdf, 0x2468ace0,
+  0x55aa55aa, 0xa55aa55a, 0x00ff00ff, 0xff00ff00,
+};
+
+#include "accessors.inc"
+
+const void *const out_of_line_reference = (const void *)_SI32_DMACTRL_A_enable_channel;
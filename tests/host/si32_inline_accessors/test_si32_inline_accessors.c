@@ -0,0 +1,110 @@
+/*
+ * Host compile test of the si32 header-inline accessor mode.
+ *
+ * Every accessor of the modules of a device is called once in its static
+ * inline form, from the SI32_*_Type.h headers with SI32_HAL_INLINE defined,
+ * and once in its out-of-line form, from out_of_line.c. gen_accessors.py
+ * generates the calls. Each call runs
+ * against its own copy of a mock register block filled with the same
+ * pattern. Both forms must return the same value and leave the same
+ * register contents.
+ */
+#define SI32_HAL_INLINE
+
+#include <stdio.h>
+#include <string.h>
+
+// The vendor body of _SI32_CRC_A_get_polynomial() lacks its break
+// statements. Both forms share it, so it does not affect the comparison.
+#pragma GCC diagnostic ignored "-Wimplicit-fallthrough"
+#include "type_headers.inc"
+
+#define CALL_PREFIX inl
+#define CALL_STORAGE static
+#include "accessor_call.h"
+
+#include "accessors.inc"
+
+typedef uint32_t (*accessor_call_t)(void *block);
+
+typedef struct {
+  const char *name;
+  size_t size;
+  accessor_call_t out_of_line;
+  accessor_call_t inline_call;
+} accessor_test_t;
+
+#undef ACCESSOR
+#define ACCESSOR(type, kind, ret, name, args) \
+  uint32_t ool##name(void *block);
+
+#include "accessors.inc"
+
+#undef ACCESSOR
+#define ACCESSOR(type, kind, ret, name, args) \
+  { #name, sizeof(type), ool##name, inl##name },
+
+static const accessor_test_t accessors[] = {
+#include "accessors.inc"
+};
+
+// Address of the exported _SI32_DMACTRL_A_enable_channel
+extern const void *const out_of_line_reference;
+
+// Large enough for the biggest module register block
+static uint32_t block_a[1024];
+static uint32_t block_b[1024];
+
+static void fill(uint32_t *block, size_t words, uint32_t seed)
+{
+  size_t i;
+
+  for (i = 0; i < words; i++) {
+    seed = seed * 1664525U + 1013904223U;
+    block[i] = seed;
+  }
+}
+
+int main(void)
+{
+  size_t count = sizeof(accessors) / sizeof(accessors[0]);
+  size_t i;
+  int failures = 0;
+
+  for (i = 0; i < count; i++) {
+    const accessor_test_t *t = &accessors[i];
+    uint32_t ret_a;
+    uint32_t ret_b;
+
+    if (t->size > sizeof(block_a)) {
+      printf("%s: register block of %lu bytes is too large\n",
+             t->name, (unsigned long)t->size);
+      failures++;
+      continue;
+    }
+    fill(block_a, sizeof(block_a) / sizeof(block_a[0]), (uint32_t)i);
+    memcpy(block_b, block_a, sizeof(block_a));
+
+    ret_a = t->out_of_line(block_a);
+    ret_b = t->inline_call(block_b);
+    if ((ret_a != ret_b) || (memcmp(block_a, block_b, t->size) != 0)) {
+      printf("%s: inline and out-of-line forms differ\n", t->name);
+      failures++;
+    }
+  }
+
+  // The header must really provide its own definition in inline mode,
+  // otherwise the comparison above would call the same function twice.
+  if ((const void *)_SI32_DMACTRL_A_enable_channel == out_of_line_reference) {
+    printf("SI32_HAL_INLINE did not select the inline definitions\n");
+    failures++;
+  }
+
+  if (failures != 0) {
+    printf("test_si32_inline_accessors: %d of %lu accessors failed\n",
+           failures, (unsigned long)count);
+    return 1;
+  }
+  printf("test_si32_inline_accessors: %lu accessors passed\n", (unsigned long)count);
+  return 0;
+}
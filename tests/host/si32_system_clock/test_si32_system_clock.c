@@ -0,0 +1,245 @@
+/*
+ * Host test of the clock evaluation in si32/si32Hal/<device>/system_<device>.c.
+ *
+ * The clock control and PLL blocks are RAM mocks. SystemCoreClockUpdate must
+ * follow every change of the AHB source, the dividers and, when the PLL drives
+ * the AHB clock, the PLL settings, skip the evaluation when none of them
+ * changed, and keep the last frequencies when the source frequency is unknown.
+ *
+ * SYSTEM_SOURCE names the system file of the device on the include path.
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include "si32_device.h"
+
+static SI32_CLKCTRL_A_Type mockClkctrl;
+static SI32_PLL_A_Type mockPll;
+
+#undef SI32_CLKCTRL_0
+#define SI32_CLKCTRL_0 (&mockClkctrl)
+#undef SI32_PLL_0
+#define SI32_PLL_0 (&mockPll)
+
+#include SYSTEM_SOURCE
+
+#define SENTINEL 1U
+
+static int failures;
+static unsigned int initCalls;
+
+#define CHECK(cond)                                                   \
+  do {                                                                \
+    if (!(cond)) {                                                    \
+      printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+      failures++;                                                     \
+    }                                                                 \
+  } while (0)
+
+void mySystemInit(void)
+{
+  initCalls++;
+}
+
+static void set_clock(uint32_t ahbsel, uint32_t ahbdiv, uint32_t apbdiv)
+{
+  mockClkctrl.CONTROL.AHBSEL = ahbsel;
+  mockClkctrl.CONTROL.AHBDIV = ahbdiv;
+  mockClkctrl.CONTROL.APBDIV = apbdiv;
+}
+
+static void set_pll(uint32_t refsel, uint32_t outmd, uint32_t n, uint32_t m)
+{
+  mockPll.CONTROL.REFSEL = refsel;
+  mockPll.CONTROL.OUTMD = outmd;
+  mockPll.DIVIDER.N = n;
+  mockPll.DIVIDER.M = m;
+}
+
+// Marks the frequencies so that a skipped evaluation can be told apart.
+static void mark(void)
+{
+  SystemCoreClock = SENTINEL;
+  SystemAPBClock = SENTINEL;
+}
+
+static void test_reset(void)
+{
+  memset(&mockClkctrl, 0, sizeof(mockClkctrl));
+  memset(&mockPll, 0, sizeof(mockPll));
+
+  CHECK(SystemCoreClock == 20000000U);
+  CHECK(SystemAPBClock == 20000000U);
+
+  SystemInit();
+  CHECK(initCalls == 1U);
+  CHECK(SystemCoreClock == 20000000U);
+  CHECK(SystemAPBClock == 20000000U);
+}
+
+static void test_dividers(void)
+{
+  set_clock(SI32_CLKCTRL_A_CONTROL_AHBSEL_LPOSC0_VALUE, 1, 1);
+  SystemCoreClockUpdate();
+  CHECK(SystemCoreClock == 10000000U);
+  CHECK(SystemAPBClock == 5000000U);
+
+  set_clock(SI32_CLKCTRL_A_CONTROL_AHBSEL_LPOSC0_DIV_VALUE, 0, 0);
+  SystemCoreClockUpdate();
+  CHECK(SystemCoreClock == 2500000U);
+  CHECK(SystemAPBClock == 2500000U);
+
+  set_clock(SI32_CLKCTRL_A_CONTROL_AHBSEL_LFOSC0_VALUE, 0, 1);
+  SystemCoreClockUpdate();
+  CHECK(SystemCoreClock == 16400U);
+  CHECK(SystemAPBClock == 8200U);
+
+#if defined(SI32_CLKCTRL_A_CONTROL_AHBSEL_RTC0OSC_VALUE)
+  set_clock(SI32_CLKCTRL_A_CONTROL_AHBSEL_RTC0OSC_VALUE, 0, 0);
+  SystemCoreClockUpdate();
+  CHECK(SystemCoreClock == 32768U);
+#endif
+
+#if defined(SI32_CLKCTRL_A_CONTROL_AHBSEL_USB0OSC_VALUE)
+  set_clock(SI32_CLKCTRL_A_CONTROL_AHBSEL_USB0OSC_VALUE, 1, 0);
+  SystemCoreClockUpdate();
+  CHECK(SystemCoreClock == 24000000U);
+  CHECK(SystemAPBClock == 24000000U);
+#endif
+}
+
+static void test_cache(void)
+{
+  set_clock(SI32_CLKCTRL_A_CONTROL_AHBSEL_LPOSC0_VALUE, 0, 1);
+  SystemCoreClockUpdate();
+  CHECK(SystemCoreClock == 20000000U);
+  CHECK(SystemAPBClock == 10000000U);
+
+  // Nothing changed, the evaluation is skipped.
+  mark();
+  SystemCoreClockUpdate();
+  CHECK(SystemCoreClock == SENTINEL);
+  CHECK(SystemAPBClock == SENTINEL);
+
+  // The PLL does not drive the AHB clock, its settings do not matter.
+  set_pll(SI32_PLL_A_CONTROL_REFSEL_LPOSC0DIV_VALUE, SI32_PLL_A_CONTROL_OUTMD_PLL_VALUE, 31, 0);
+  SystemCoreClockUpdate();
+  CHECK(SystemCoreClock == SENTINEL);
+
+  // Changing a divider does.
+  mockClkctrl.CONTROL.APBDIV = 0;
+  SystemCoreClockUpdate();
+  CHECK(SystemCoreClock == 20000000U);
+  CHECK(SystemAPBClock == 20000000U);
+}
+
+static void test_pll(void)
+{
+  // 2.5 MHz * (31 + 1) / (0 + 1)
+  set_pll(SI32_PLL_A_CONTROL_REFSEL_LPOSC0DIV_VALUE, SI32_PLL_A_CONTROL_OUTMD_PLL_VALUE, 31, 0);
+  set_clock(SI32_CLKCTRL_A_CONTROL_AHBSEL_PLL0OSC_VALUE, 0, 1);
+  SystemCoreClockUpdate();
+  CHECK(SystemCoreClock == 80000000U);
+  CHECK(SystemAPBClock == 40000000U);
+
+  mark();
+  SystemCoreClockUpdate();
+  CHECK(SystemCoreClock == SENTINEL);
+
+  // A new divider is picked up while the PLL drives the AHB clock.
+  // 20 MHz * (3 + 1) / (1 + 1)
+  set_pll(SI32_PLL_A_CONTROL_REFSEL_LPOSC0_VALUE, SI32_PLL_A_CONTROL_OUTMD_FLL_VALUE, 3, 1);
+  SystemCoreClockUpdate();
+  CHECK(SystemCoreClock == 40000000U);
+  CHECK(SystemAPBClock == 20000000U);
+
+  // 32768 Hz * (1464 + 1) / (0 + 1)
+  set_pll(SI32_PLL_A_CONTROL_REFSEL_RTC0OSC_VALUE, SI32_PLL_A_CONTROL_OUTMD_PLL_VALUE, 1464, 0);
+  SystemCoreClockUpdate();
+  CHECK(SystemCoreClock == 48005120U);
+
+#if defined(SI32_CLKCTRL_A_CONTROL_AHBSEL_USB0OSC_VALUE)
+  // 48 MHz * (0 + 1) / (1 + 1)
+  set_pll(SI32_PLL_A_CONTROL_REFSEL_USBOSC0_VALUE, SI32_PLL_A_CONTROL_OUTMD_PLL_VALUE, 0, 1);
+  SystemCoreClockUpdate();
+  CHECK(SystemCoreClock == 24000000U);
+#endif
+}
+
+static void test_unknown(void)
+{
+  set_pll(SI32_PLL_A_CONTROL_REFSEL_LPOSC0DIV_VALUE, SI32_PLL_A_CONTROL_OUTMD_PLL_VALUE, 31, 0);
+  set_clock(SI32_CLKCTRL_A_CONTROL_AHBSEL_PLL0OSC_VALUE, 0, 0);
+  SystemCoreClockUpdate();
+  CHECK(SystemCoreClock == 80000000U);
+
+  // An unlocked PLL has no known frequency, the last values are kept.
+  mockPll.CONTROL.OUTMD = SI32_PLL_A_CONTROL_OUTMD_DCO_VALUE;
+  SystemCoreClockUpdate();
+  CHECK(SystemCoreClock == 80000000U);
+  CHECK(SystemAPBClock == 80000000U);
+
+  // The unknown state is not cached, going back to the settings of the last
+  // known frequencies evaluates again.
+  mark();
+  mockPll.CONTROL.OUTMD = SI32_PLL_A_CONTROL_OUTMD_PLL_VALUE;
+  SystemCoreClockUpdate();
+  CHECK(SystemCoreClock == 80000000U);
+  CHECK(SystemAPBClock == 80000000U);
+
+  mockPll.DIVIDER.N = 15;
+  SystemCoreClockUpdate();
+  CHECK(SystemCoreClock == 40000000U);
+
+  // No external oscillator frequency is configured.
+  set_clock(SI32_CLKCTRL_A_CONTROL_AHBSEL_EXTOSC0_VALUE, 0, 0);
+  SystemCoreClockUpdate();
+  CHECK(SystemCoreClock == 40000000U);
+
+  set_clock(SI32_CLKCTRL_A_CONTROL_AHBSEL_LPOSC0_VALUE, 0, 0);
+  SystemCoreClockUpdate();
+  CHECK(SystemCoreClock == 20000000U);
+}
+
+static void test_evaluate(void)
+{
+  SI32_CLKCTRL_A_Type clkctrl;
+  SI32_PLL_A_Type pll;
+  uint32_t ahbClock;
+  uint32_t apbClock;
+
+  // Only the given blocks are read, the global frequencies are left alone.
+  memset(&clkctrl, 0, sizeof(clkctrl));
+  memset(&pll, 0, sizeof(pll));
+  clkctrl.CONTROL.AHBSEL = SI32_CLKCTRL_A_CONTROL_AHBSEL_PLL0OSC_VALUE;
+  clkctrl.CONTROL.AHBDIV = 2;
+  clkctrl.CONTROL.APBDIV = 1;
+  pll.CONTROL.REFSEL = SI32_PLL_A_CONTROL_REFSEL_LPOSC0_VALUE;
+  pll.CONTROL.OUTMD = SI32_PLL_A_CONTROL_OUTMD_PLL_VALUE;
+  pll.DIVIDER.N = 3;
+  pll.DIVIDER.M = 0;
+
+  mark();
+  SystemClockEvaluate(&clkctrl, &pll, &ahbClock, &apbClock);
+  CHECK(ahbClock == 20000000U);
+  CHECK(apbClock == 10000000U);
+  CHECK(SystemCoreClock == SENTINEL);
+  CHECK(SystemAPBClock == SENTINEL);
+}
+
+int main(void)
+{
+  test_reset();
+  test_dividers();
+  test_cache();
+  test_pll();
+  test_unknown();
+  test_evaluate();
+
+  if (failures != 0) {
+    printf("test_si32_system_clock: %d check(s) failed\n", failures);
+    return 1;
+  }
+  printf("test_si32_system_clock: passed\n");
+  return 0;
+}
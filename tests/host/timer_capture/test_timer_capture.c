@@ -0,0 +1,209 @@
+/*
+ * Host test of the TIMER capture statistics layer in gecko/emlib/src/em_timer.c.
+ *
+ * TIMER_CaptureStats*() are fed synthetic capture streams directly.
+ * TIMER_CaptureProcess() replays the same streams through its two rings; the
+ * LDMA register block is replaced by a RAM copy whose DST registers stand
+ * for the write position of the channels.
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include "em_device.h"
+#include "em_timer.h"
+
+#undef LDMA
+static LDMA_TypeDef mockLdma;
+#define LDMA (&mockLdma)
+
+#include "em_timer.c"
+
+#define RING_SIZE 8U
+
+static int failures;
+
+#define CHECK(cond)                                              \
+  do {                                                           \
+    if (!(cond)) {                                               \
+      printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+      failures++;                                                \
+    }                                                            \
+  } while (0)
+
+/* Periods and high times of a 1 kHz, 25 % duty signal at 1 MHz with jitter. */
+static const uint32_t periods[] = {
+  1000, 998, 1003, 1000, 999, 1001, 1002, 997, 1000, 1000,
+  1001, 999, 1000, 1000, 998, 1002, 1000, 1000, 999, 1001,
+};
+
+static const uint32_t highs[] = {
+  250, 249, 251, 250, 250, 250, 251, 249, 250, 250,
+  250, 250, 249, 251, 250, 250, 250, 250, 250, 250,
+};
+
+#define STREAM_LEN (sizeof(periods) / sizeof(periods[0]))
+
+static int stats_equal(const TIMER_CaptureStats_TypeDef *a,
+                       const TIMER_CaptureStats_TypeDef *b)
+{
+  return (a->periods == b->periods)
+         && (a->periodMin == b->periodMin)
+         && (a->periodMax == b->periodMax)
+         && (a->periodSum == b->periodSum)
+         && (a->highs == b->highs)
+         && (a->highSum == b->highSum);
+}
+
+static void test_empty(void)
+{
+  TIMER_CaptureStats_TypeDef stats;
+
+  TIMER_CaptureStatsClear(&stats);
+  CHECK(stats.periods == 0U);
+  CHECK(stats.periodMin == UINT32_MAX);
+  CHECK(stats.periodMax == 0U);
+  CHECK(TIMER_CaptureStatsFreqGet(&stats, 1000000U) == 0U);
+  CHECK(TIMER_CaptureStatsDutyGet(&stats) == 0U);
+}
+
+static void test_batches(void)
+{
+  TIMER_CaptureStats_TypeDef whole;
+  TIMER_CaptureStats_TypeDef split;
+  unsigned int i;
+
+  TIMER_CaptureStatsClear(&whole);
+  TIMER_CaptureStatsUpdate(&whole, periods, STREAM_LEN, highs, STREAM_LEN);
+  CHECK(whole.periods == STREAM_LEN);
+  CHECK(whole.highs == STREAM_LEN);
+  CHECK(whole.periodMin == 997U);
+  CHECK(whole.periodMax == 1003U);
+  CHECK(whole.periodSum == 20000U);
+  CHECK(TIMER_CaptureStatsFreqGet(&whole, 1000000U) == 1000000U);
+  CHECK(TIMER_CaptureStatsDutyGet(&whole) == 250U);
+
+  /* Uneven batches, periods and high times split at different places. */
+  TIMER_CaptureStatsClear(&split);
+  for (i = 0; i < STREAM_LEN; i += 3U) {
+    unsigned int n = (STREAM_LEN - i < 3U) ? STREAM_LEN - i : 3U;
+    TIMER_CaptureStatsUpdate(&split, &periods[i], n, NULL, 0);
+  }
+  TIMER_CaptureStatsUpdate(&split, NULL, 0, highs, 7);
+  TIMER_CaptureStatsUpdate(&split, NULL, 0, &highs[7], STREAM_LEN - 7U);
+  CHECK(stats_equal(&whole, &split));
+}
+
+static void test_duty_limits(void)
+{
+  TIMER_CaptureStats_TypeDef stats;
+  const uint32_t period = 100;
+  const uint32_t high = 150;
+
+  /* A high time captured across a period change may exceed the period. */
+  TIMER_CaptureStatsClear(&stats);
+  TIMER_CaptureStatsUpdate(&stats, &period, 1, &high, 1);
+  CHECK(TIMER_CaptureStatsDutyGet(&stats) == 1000U);
+
+  /* No high time yet. */
+  TIMER_CaptureStatsClear(&stats);
+  TIMER_CaptureStatsUpdate(&stats, &period, 1, NULL, 0);
+  CHECK(TIMER_CaptureStatsDutyGet(&stats) == 0U);
+}
+
+static void test_long_run(void)
+{
+  TIMER_CaptureStats_TypeDef stats;
+
+  /* Four billion 1 MHz periods at 48 MHz. The period count times the
+     scaled timer frequency no longer fits in 64 bits. */
+  TIMER_CaptureStatsClear(&stats);
+  stats.periods = 4000000000U;
+  stats.periodSum = (uint64_t)stats.periods * 48U;
+  CHECK(TIMER_CaptureStatsFreqGet(&stats, 48000000U) == 1000000000U);
+
+  /* Sub-tick periods saturate instead of wrapping. */
+  stats.periods = 100U;
+  stats.periodSum = 1U;
+  CHECK(TIMER_CaptureStatsFreqGet(&stats, 48000000U) == UINT32_MAX);
+}
+
+/* Let the mock LDMA channel write the next captures into its ring. */
+static void ring_write(unsigned int ch, uint32_t *ring, uint16_t *write,
+                       const uint32_t *values, unsigned int count)
+{
+  unsigned int i;
+
+  for (i = 0; i < count; i++) {
+    ring[*write] = values[i];
+    *write = (uint16_t)((*write + 1U) % RING_SIZE);
+  }
+  mockLdma.CH[ch].DST = (uint32_t)(uintptr_t)&ring[*write];
+}
+
+static void test_replay(void)
+{
+  static uint32_t periodRing[RING_SIZE];
+  static uint32_t highRing[RING_SIZE];
+  TIMER_Capture_TypeDef capture;
+  TIMER_CaptureStats_TypeDef stats;
+  TIMER_CaptureStats_TypeDef expected;
+  const uint32_t firstPeriod = 12345;
+  const uint32_t firstHigh = 321;
+  uint16_t periodWrite = 0;
+  uint16_t highWrite = 0;
+  unsigned int i;
+  unsigned int n;
+
+  memset(&capture, 0, sizeof(capture));
+  capture.periodDmaCh = 0;
+  capture.highDmaCh = 1;
+  capture.periodBuffer = periodRing;
+  capture.highBuffer = highRing;
+  capture.size = RING_SIZE;
+  mockLdma.CH[0].DST = (uint32_t)(uintptr_t)periodRing;
+  mockLdma.CH[1].DST = (uint32_t)(uintptr_t)highRing;
+
+  TIMER_CaptureStatsClear(&stats);
+  TIMER_CaptureProcess(&capture, &stats);
+  CHECK(stats.periods == 0U);
+
+  /* The first capture of each channel covers a partial period only. */
+  ring_write(0, periodRing, &periodWrite, &firstPeriod, 1);
+  ring_write(1, highRing, &highWrite, &firstHigh, 1);
+
+  /* Feed the rings in uneven steps so that both wrap several times and the
+     two channels are processed at different positions. */
+  for (i = 0; i < STREAM_LEN; i += n) {
+    n = ((i / 5U) % 2U == 0U) ? 5U : 3U;
+    if (n > STREAM_LEN - i) {
+      n = STREAM_LEN - i;
+    }
+    ring_write(0, periodRing, &periodWrite, &periods[i], n);
+    ring_write(1, highRing, &highWrite, &highs[i], (n > 1U) ? n - 1U : n);
+    TIMER_CaptureProcess(&capture, &stats);
+    if (n > 1U) {
+      ring_write(1, highRing, &highWrite, &highs[i + n - 1U], 1);
+    }
+  }
+  TIMER_CaptureProcess(&capture, &stats);
+
+  TIMER_CaptureStatsClear(&expected);
+  TIMER_CaptureStatsUpdate(&expected, periods, STREAM_LEN, highs, STREAM_LEN);
+  CHECK(stats_equal(&stats, &expected));
+}
+
+int main(void)
+{
+  test_empty();
+  test_batches();
+  test_duty_limits();
+  test_long_run();
+  test_replay();
+
+  if (failures != 0) {
+    printf("test_timer_capture: %d check(s) failed\n", failures);
+    return 1;
+  }
+  printf("test_timer_capture: passed\n");
+  return 0;
+}
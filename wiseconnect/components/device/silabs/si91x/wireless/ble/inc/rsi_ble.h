@@ -2469,6 +2469,11 @@ struct rsi_ble_cb_s {
    */
   rsi_ble_on_adv_report_event_t ble_on_adv_report_event;
 
+  /**
+   * @brief Scan filter the advertising reports are routed through, see rsi_ble_scan_filter.h.
+   */
+  struct rsi_ble_scan_filter_s *ble_scan_filter;
+
   /**
    * @brief Connection status event callback.
    */
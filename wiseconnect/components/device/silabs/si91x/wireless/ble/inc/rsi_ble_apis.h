@@ -3681,6 +3681,72 @@ int32_t rsi_ble_set_wo_resp_notify_buf_info(const uint8_t *dev_addr, uint8_t buf
  */
 int32_t rsi_ble_notify_value(const uint8_t *dev_addr, uint16_t handle, uint16_t data_len, const uint8_t *p_data);
 
+/*==============================================*/
+/**
+ * @fn         int32_t rsi_ble_notify_value_queued(const uint8_t *dev_addr, uint16_t handle,
+ *                                                 uint16_t data_len, const uint8_t *p_data)
+ * @brief      Queue a notification of the local value to the remote device. This is a non-blocking API.
+ *             The queued notifications and write commands of all the connections are sent in turn as soon as the
+ *             remote device has an available buffer, without waiting for the response of the previous ones.
+ *             If the API returns RSI_ERROR_BLE_DEV_BUF_FULL  (-31) error then RSI_BLE_MAX_QUEUED_CMDS_PER_CONN commands are
+ *             already queued for the remote device, wait until the \ref rsi_ble_on_le_more_data_req_t event gets received from the module.
+ * @pre Pre-conditions:
+ *        - \ref rsi_ble_connect() API needs to be called before this API.
+ * @param[in]  dev_addr - remote device address
+ * @param[in]  handle 	- local attribute handle
+ * @param[in]  data_len - attribute value length
+ * @param[in]  p_data 	- attribute value
+ * @return The following values are returned:
+ *             - 0		-	Success 
+ *             - Non-Zero Value	-	Failure 
+ *             - -2  -  Invalid Arguments 
+ *             - -19  -  Remote device not connected 
+ *             - -31  -  Too many commands queued for the remote device 
+ * @note       The status of the queued commands reported by the module is given by \ref rsi_ble_get_queued_cmd_status().
+ * @note       Do not mix this API with \ref rsi_ble_notify_value() for the same attribute, the order of the notifications is not kept.
+ */
+int32_t rsi_ble_notify_value_queued(const uint8_t *dev_addr, uint16_t handle, uint16_t data_len, const uint8_t *p_data);
+
+/*==============================================*/
+/**
+ * @fn         int32_t rsi_ble_set_att_cmd_queued(const uint8_t *dev_addr, uint16_t handle,
+ *                                                uint8_t data_len, const uint8_t *p_data)
+ * @brief      Queue a write of the attribute value of the remote device, without waiting for an ACK from the remote device.
+ *             This is a non-blocking API, see \ref rsi_ble_notify_value_queued().
+ * @pre Pre-conditions:
+ *        - \ref rsi_ble_connect() API needs to be called before this API.
+ * @param[in]  dev_addr - remote device address
+ * @param[in]  handle 	- attribute value handle
+ * @param[in]  data_len - attribute value length
+ * @param[in]  p_data 	- attribute value
+ * @return The following values are returned:
+ *             - 0		-	Success 
+ *             - Non-Zero Value	-	Failure 
+ *             - -2  -  Invalid Arguments 
+ *             - -19  -  Remote device not connected 
+ *             - -31  -  Too many commands queued for the remote device 
+ */
+int32_t rsi_ble_set_att_cmd_queued(const uint8_t *dev_addr, uint16_t handle, uint8_t data_len, const uint8_t *p_data);
+
+/*==============================================*/
+/**
+ * @fn         uint8_t rsi_ble_get_queued_cmd_count(const uint8_t *dev_addr)
+ * @brief      Get the number of queued notifications and write commands still waiting for a buffer of the remote device.
+ * @param[in]  dev_addr - remote device address
+ * @return     Number of queued commands, 0 if the remote device is not connected.
+ */
+uint8_t rsi_ble_get_queued_cmd_count(const uint8_t *dev_addr);
+
+/*==============================================*/
+/**
+ * @fn         int32_t rsi_ble_get_queued_cmd_status(void)
+ * @brief      Get and clear the status of the first queued notification or write command that failed since the last call.
+ * @return The following values are returned:
+ *             - 0		-	Success 
+ *             - Non-Zero Value	-	Failure status of the module, or -4 if the command could not be sent 
+ */
+int32_t rsi_ble_get_queued_cmd_status(void);
+
 /*==============================================*/
 /**
  * @fn         int32_t rsi_ble_indicate_value(const uint8_t *dev_addr, uint16_t handle,
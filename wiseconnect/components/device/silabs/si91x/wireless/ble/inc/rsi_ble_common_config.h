@@ -227,6 +227,14 @@ the number of peripherals has been updated to 1, and the number of connection ev
 #define RSI_BLE_NUM_CONN_EVENTS     8
 #define RSI_BLE_MAX_NBR_PERIPHERALS 1
 #endif
+#ifndef RSI_BLE_MAX_QUEUED_CMDS_PER_CONN
+#define RSI_BLE_MAX_QUEUED_CMDS_PER_CONN \
+  8 ///< Maximum number of queued notifications and write commands waiting for a buffer of a connection.
+#endif
+#ifndef RSI_BLE_MAX_QUEUED_CMDS_IN_FLIGHT
+#define RSI_BLE_MAX_QUEUED_CMDS_IN_FLIGHT \
+  4 ///< Maximum number of queued notifications and write commands sent to the module and waiting for their response. Each one holds a command buffer, and some are sent from the bus RX thread, so keep the command buffer pool larger than this.
+#endif
 /* Number of BLE GATT RECORD SIZE IN (n*16 BYTES), eg:(0x40*16) = 1024 bytes */
 #ifndef RSI_BLE_NUM_REC_BYTES
 #define RSI_BLE_NUM_REC_BYTES 0x40 ///< Defines the number of bytes to be received in a BLE operation.
@@ -0,0 +1,328 @@
+/*******************************************************************************
+ * @file  rsi_ble_scan_filter.h
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef RSI_BLE_SCAN_FILTER_H
+#define RSI_BLE_SCAN_FILTER_H
+
+#include "rsi_ble_apis.h"
+
+/******************************************************
+ * *                      Macros
+ * ******************************************************/
+#ifndef RSI_BLE_SCAN_FILTER_CACHE_SIZE
+#define RSI_BLE_SCAN_FILTER_CACHE_SIZE 32 ///< Number of advertisers remembered by the duplicate cache, must be a power of 2. Evicted advertisers are reported again.
+#endif
+#ifndef RSI_BLE_SCAN_FILTER_CACHE_PROBES
+#define RSI_BLE_SCAN_FILTER_CACHE_PROBES 4 ///< Number of cache slots searched for an advertiser before the oldest one is replaced.
+#endif
+#ifndef RSI_BLE_SCAN_FILTER_MAX_ALLOW_LIST
+#define RSI_BLE_SCAN_FILTER_MAX_ALLOW_LIST 8 ///< Maximum number of addresses in the scan filter allow list.
+#endif
+#ifndef RSI_BLE_SCAN_FILTER_MAX_PATTERNS
+#define RSI_BLE_SCAN_FILTER_MAX_PATTERNS 4 ///< Maximum number of AD structure patterns in the scan filter.
+#endif
+#ifndef RSI_BLE_SCAN_FILTER_MAX_PATTERN_LEN
+#define RSI_BLE_SCAN_FILTER_MAX_PATTERN_LEN 16 ///< Maximum length of an AD structure pattern.
+#endif
+#ifndef RSI_BLE_SCAN_FILTER_BATCH_SIZE
+#define RSI_BLE_SCAN_FILTER_BATCH_SIZE 8 ///< Maximum number of advertising reports delivered in one batch.
+#endif
+
+/******************************************************
+ * *                 Type Definitions
+ * ******************************************************/
+/** @addtogroup BT-LOW-ENERGY8
+* @{
+*/
+/**
+ * @typedef    void (*rsi_ble_on_adv_report_batch_t)(const rsi_ble_event_adv_report_t *reports, uint16_t count);
+ * @brief      Callback function for a batch of filtered advertise reports.
+ *             This callback function is called whenever the scan filter delivers a batch, from the BLE event context
+ *             or from the context calling `rsi_ble_scan_filter_poll` or `rsi_ble_scan_filter_flush`. It is called
+ *             with the scan filter lock held, so it must not call the scan filter functions.
+ *             It has to be registered using the `rsi_ble_scan_filter_init` API.
+ * @param[out] reports - Array of the filtered advertise reports, in the order they were received.
+ * @param[out] count - Number of reports in the array.
+ * @return The following values are returned:
+ *      void
+ */
+typedef void (*rsi_ble_on_adv_report_batch_t)(const rsi_ble_event_adv_report_t *reports, uint16_t count);
+/** @} */
+
+/**
+ * @brief Structure representing the scan filter configuration.
+ */
+typedef struct rsi_ble_scan_filter_config_s {
+  /** Minimum RSSI change, in dB, that reports a known advertiser again. 0 ignores RSSI changes */
+  uint8_t rssi_threshold;
+  /** Report a known advertiser again when its advertising data changes. 0 ignores data changes */
+  uint8_t report_on_data_change;
+  /** Minimum RSSI, in dBm, of a delivered report. Weaker reports are dropped. 0 accepts every RSSI */
+  int8_t min_rssi;
+  /** Time, in milliseconds, after which a known advertiser is reported again. 0 reports it only on a change */
+  uint32_t refresh_ms;
+  /** Time, in milliseconds, that reports are collected before a batch is delivered. 0 delivers every report on its own */
+  uint32_t batch_window_ms;
+} rsi_ble_scan_filter_config_t;
+
+/**
+ * @brief Structure representing an AD structure pattern of the scan filter.
+ */
+typedef struct rsi_ble_scan_filter_pattern_s {
+  /** AD type the pattern applies to */
+  uint8_t ad_type;
+  /** Offset of the pattern in the AD data */
+  uint8_t offset;
+  /** Length of the pattern */
+  uint8_t len;
+  /** Pattern data */
+  uint8_t data[RSI_BLE_SCAN_FILTER_MAX_PATTERN_LEN];
+} rsi_ble_scan_filter_pattern_t;
+
+/**
+ * @brief Structure representing an advertiser remembered by the scan filter.
+ */
+typedef struct rsi_ble_scan_filter_entry_s {
+  /** Entry is in use */
+  uint8_t used;
+  /** Address type of the advertiser */
+  uint8_t dev_addr_type;
+  /** Address of the advertiser */
+  uint8_t dev_addr[RSI_DEV_ADDR_LEN];
+  /** Entry holds a scan response */
+  uint8_t scan_rsp;
+  /** RSSI of the last delivered report */
+  int8_t rssi;
+  /** Hash of the advertising data of the last delivered report */
+  uint32_t data_hash;
+  /** Time of the last delivered report */
+  uint32_t reported_ms;
+  /** Time of the last received report */
+  uint32_t seen_ms;
+} rsi_ble_scan_filter_entry_t;
+
+/**
+ * @brief Structure representing the scan filter counters.
+ */
+typedef struct rsi_ble_scan_filter_stats_s {
+  /** Reports given to the filter */
+  uint32_t received;
+  /** Reports dropped by the allow list, the pattern filters or the RSSI floor */
+  uint32_t filtered;
+  /** Reports dropped as duplicates */
+  uint32_t duplicates;
+  /** Reports delivered */
+  uint32_t delivered;
+  /** Batches delivered */
+  uint32_t batches;
+} rsi_ble_scan_filter_stats_t;
+
+/**
+ * @brief Structure representing a scan filter.
+ *        The structure is owned by the application and must stay valid while it is registered.
+ */
+typedef struct rsi_ble_scan_filter_s {
+  /** Filter configuration */
+  rsi_ble_scan_filter_config_t config;
+  /** Callback receiving the batches */
+  rsi_ble_on_adv_report_batch_t batch_cb;
+  /** Allow list addresses */
+  uint8_t allow_list[RSI_BLE_SCAN_FILTER_MAX_ALLOW_LIST][RSI_DEV_ADDR_LEN];
+  /** Allow list address types */
+  uint8_t allow_list_type[RSI_BLE_SCAN_FILTER_MAX_ALLOW_LIST];
+  /** Number of allow list addresses, 0 accepts every address */
+  uint8_t allow_list_cnt;
+  /** Number of patterns, 0 accepts every report */
+  uint8_t pattern_cnt;
+  /** AD structure patterns, a report is accepted when any of them matches */
+  rsi_ble_scan_filter_pattern_t patterns[RSI_BLE_SCAN_FILTER_MAX_PATTERNS];
+  /** Duplicate cache, indexed by a hash of the advertiser address */
+  rsi_ble_scan_filter_entry_t cache[RSI_BLE_SCAN_FILTER_CACHE_SIZE];
+  /** Reports waiting for delivery */
+  rsi_ble_event_adv_report_t batch[RSI_BLE_SCAN_FILTER_BATCH_SIZE];
+  /** Number of reports waiting for delivery */
+  uint16_t batch_cnt;
+  /** Time of the first report waiting for delivery */
+  uint32_t batch_start_ms;
+  /** Filter counters */
+  rsi_ble_scan_filter_stats_t stats;
+} rsi_ble_scan_filter_t;
+
+/******************************************************
+ * *              Function Declarations
+ * ******************************************************/
+/** @addtogroup BT-LOW-ENERGY1
+* @{
+*/
+/*==============================================*/
+/**
+ * @fn         void rsi_ble_scan_filter_init(rsi_ble_scan_filter_t *filter,
+ *                                           const rsi_ble_scan_filter_config_t *config,
+ *                                           rsi_ble_on_adv_report_batch_t batch_cb)
+ * @brief      Initialize a scan filter with an empty cache, allow list and pattern list.
+ * @param[in]  filter - Scan filter to initialize.
+ * @param[in]  config - Filter configuration.
+ * @param[in]  batch_cb - Callback receiving the filtered advertise reports.
+ * @return     void
+ * @note       Apart from `rsi_ble_scan_filter_lock` and `rsi_ble_scan_filter_unlock`, the filter does not use any
+ *             OS service, so it can be fed with recorded reports on a host.
+ * @note       The filter must be initialized, and its allow list and patterns added, before it is registered.
+ */
+void rsi_ble_scan_filter_init(rsi_ble_scan_filter_t *filter,
+                              const rsi_ble_scan_filter_config_t *config,
+                              rsi_ble_on_adv_report_batch_t batch_cb);
+
+/*==============================================*/
+/**
+ * @fn         int32_t rsi_ble_scan_filter_add_allow_list(rsi_ble_scan_filter_t *filter,
+ *                                                        uint8_t dev_addr_type,
+ *                                                        const uint8_t *dev_addr)
+ * @brief      Add an address to the allow list of a scan filter. Once the list is not empty, only reports
+ *             of the listed addresses are delivered.
+ * @param[in]  filter - Scan filter.
+ * @param[in]  dev_addr_type - Address type of the advertiser.
+ * @param[in]  dev_addr - Address of the advertiser.
+ * @return The following values are returned:
+ *             - 0 - Success \n
+ *             - Non-Zero Value - Failure \n
+ *             - -2 - Invalid parameters \n
+ *             - -31 - Allow list is full
+ */
+int32_t rsi_ble_scan_filter_add_allow_list(rsi_ble_scan_filter_t *filter,
+                                           uint8_t dev_addr_type,
+                                           const uint8_t *dev_addr);
+
+/*==============================================*/
+/**
+ * @fn         int32_t rsi_ble_scan_filter_add_pattern(rsi_ble_scan_filter_t *filter,
+ *                                                     uint8_t ad_type,
+ *                                                     uint8_t offset,
+ *                                                     uint8_t len,
+ *                                                     const uint8_t *data)
+ * @brief      Add an AD structure pattern to a scan filter. Once a pattern is added, only reports with an AD
+ *             structure of type ad_type holding data at offset are delivered.
+ * @param[in]  filter - Scan filter.
+ * @param[in]  ad_type - AD type, for example 0xFF for manufacturer specific data.
+ * @param[in]  offset - Offset of the pattern in the AD data.
+ * @param[in]  len - Length of the pattern, at most RSI_BLE_SCAN_FILTER_MAX_PATTERN_LEN.
+ * @param[in]  data - Pattern data.
+ * @return The following values are returned:
+ *             - 0 - Success \n
+ *             - Non-Zero Value - Failure \n
+ *             - -2 - Invalid parameters \n
+ *             - -31 - Pattern list is full
+ */
+int32_t rsi_ble_scan_filter_add_pattern(rsi_ble_scan_filter_t *filter,
+                                        uint8_t ad_type,
+                                        uint8_t offset,
+                                        uint8_t len,
+                                        const uint8_t *data);
+
+/*==============================================*/
+/**
+ * @fn         void rsi_ble_scan_filter_reset_cache(rsi_ble_scan_filter_t *filter)
+ * @brief      Forget every advertiser of a scan filter, so that the next report of each one is delivered.
+ * @param[in]  filter - Scan filter.
+ * @return     void
+ * @note       Runs with the scan filter lock held.
+ */
+void rsi_ble_scan_filter_reset_cache(rsi_ble_scan_filter_t *filter);
+
+/*==============================================*/
+/**
+ * @fn         void rsi_ble_scan_filter_process(rsi_ble_scan_filter_t *filter,
+ *                                              const rsi_ble_event_adv_report_t *report,
+ *                                              uint32_t now_ms)
+ * @brief      Run an advertise report through a scan filter. A surviving report is added to the pending batch,
+ *             which is delivered once it is full or its window has elapsed.
+ * @param[in]  filter - Scan filter.
+ * @param[in]  report - Advertise report.
+ * @param[in]  now_ms - Current time in milliseconds.
+ * @return     void
+ * @note       Runs with the scan filter lock held.
+ */
+void rsi_ble_scan_filter_process(rsi_ble_scan_filter_t *filter,
+                                 const rsi_ble_event_adv_report_t *report,
+                                 uint32_t now_ms);
+
+/*==============================================*/
+/**
+ * @fn         void rsi_ble_scan_filter_poll(rsi_ble_scan_filter_t *filter, uint32_t now_ms)
+ * @brief      Deliver the pending batch of a scan filter if its window has elapsed.
+ * @param[in]  filter - Scan filter.
+ * @param[in]  now_ms - Current time in milliseconds.
+ * @return     void
+ * @note       Runs with the scan filter lock held, so it can be called from an application thread while the
+ *             filter is registered.
+ */
+void rsi_ble_scan_filter_poll(rsi_ble_scan_filter_t *filter, uint32_t now_ms);
+
+/*==============================================*/
+/**
+ * @fn         void rsi_ble_scan_filter_flush(rsi_ble_scan_filter_t *filter)
+ * @brief      Deliver the pending batch of a scan filter now.
+ * @param[in]  filter - Scan filter.
+ * @return     void
+ * @note       Runs with the scan filter lock held, so it can be called from an application thread while the
+ *             filter is registered.
+ */
+void rsi_ble_scan_filter_flush(rsi_ble_scan_filter_t *filter);
+
+/*==============================================*/
+/**
+ * @fn         void rsi_ble_scan_filter_register(rsi_ble_scan_filter_t *filter)
+ * @brief      Route the advertise reports of the module through a scan filter instead of the
+ *             `rsi_ble_on_adv_report_event_t` callback.
+ * @param[in]  filter - Scan filter, NULL to deliver the reports to the callback again.
+ * @return     void
+ * @note       The filter runs in the BLE event context. Reports pending when scanning stops are delivered
+ *             by calling `rsi_ble_scan_filter_flush` after the scan is stopped.
+ * @note       A filter is unregistered after the scan is stopped, a report being processed may still use it.
+ */
+void rsi_ble_scan_filter_register(rsi_ble_scan_filter_t *filter);
+
+/*==============================================*/
+/**
+ * @fn         void rsi_ble_scan_filter_lock(void)
+ * @brief      Take the lock serializing the scan filter functions between the BLE event context and the
+ *             application threads. Provided by the driver, the scan filter functions take it themselves.
+ * @return     void
+ */
+void rsi_ble_scan_filter_lock(void);
+
+/*==============================================*/
+/**
+ * @fn         void rsi_ble_scan_filter_unlock(void)
+ * @brief      Release the lock taken by `rsi_ble_scan_filter_lock`.
+ * @return     void
+ */
+void rsi_ble_scan_filter_unlock(void);
+/** @} */
+
+#endif
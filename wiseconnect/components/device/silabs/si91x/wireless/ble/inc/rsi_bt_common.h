@@ -279,6 +279,10 @@ typedef struct rsi_remote_ble_info_s {
   uint8_t mode;
   /** Mutex handle for avail_buf_info update */
   osMutexId_t ble_buff_mutex;
+  /** Queued notifications and write commands waiting for an available buffer */
+  sli_si91x_buffer_queue_t queued_cmds;
+  /** Number of commands in queued_cmds */
+  uint8_t queued_cnt;
 } rsi_remote_ble_info_t;
 // Driver BT/BLE/PROP_PROTOCOL control block
 /**
@@ -329,6 +333,16 @@ typedef struct rsi_bt_cb_s {
   uint8_t cmd_status;
   /** Variable to save remote information index */
   uint8_t remote_ble_index;
+  /** Remote information index found by the last lookup, checked first by the next one */
+  uint8_t remote_ble_last_index;
+  /** Remote information index served first by the next round of queued commands */
+  uint8_t queued_next_index;
+  /** Queued commands sent to the module, only updated by the sending task */
+  volatile uint32_t queued_sent;
+  /** Queued commands whose response was received, only updated by the receiving task */
+  volatile uint32_t queued_done;
+  /** Status of the first queued command that failed */
+  volatile int32_t queued_status;
   /** Driver BT control block asynchronous status */
   volatile int32_t async_status;
 } rsi_bt_cb_t;
@@ -0,0 +1,349 @@
+/*******************************************************************************
+ * @file  rsi_ble_scan_filter.c
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+/*
+  Include files
+ */
+#include "rsi_ble_scan_filter.h"
+#include "sl_si91x_status.h"
+#include <string.h>
+
+#define RSI_BLE_ADV_REPORT_TYPE_SCAN_RSP 0x04
+#define RSI_BLE_SCAN_FILTER_FNV_OFFSET   2166136261UL
+#define RSI_BLE_SCAN_FILTER_FNV_PRIME    16777619UL
+
+#if (RSI_BLE_SCAN_FILTER_CACHE_SIZE & (RSI_BLE_SCAN_FILTER_CACHE_SIZE - 1)) != 0
+#error "RSI_BLE_SCAN_FILTER_CACHE_SIZE must be a power of 2"
+#endif
+
+/*==============================================*/
+/**
+ * @brief      Compute the FNV-1a hash of a buffer.
+ * @param[in]  hash - Hash to continue from.
+ * @param[in]  data - Buffer.
+ * @param[in]  len - Buffer length.
+ * @return     Hash of the buffer.
+ */
+static uint32_t rsi_ble_scan_filter_hash(uint32_t hash, const uint8_t *data, uint16_t len)
+{
+  for (uint16_t i = 0; i < len; i++) {
+    hash ^= data[i];
+    hash *= RSI_BLE_SCAN_FILTER_FNV_PRIME;
+  }
+  return hash;
+}
+
+/*==============================================*/
+/**
+ * @brief      Check a report against the allow list.
+ * @param[in]  filter - Scan filter.
+ * @param[in]  report - Advertise report.
+ * @return     1 if the report is accepted, 0 otherwise.
+ */
+static uint8_t rsi_ble_scan_filter_allowed(const rsi_ble_scan_filter_t *filter, const rsi_ble_event_adv_report_t *report)
+{
+  if (filter->allow_list_cnt == 0) {
+    return 1;
+  }
+  for (uint8_t i = 0; i < filter->allow_list_cnt; i++) {
+    if ((filter->allow_list_type[i] == report->dev_addr_type)
+        && (memcmp(filter->allow_list[i], report->dev_addr, RSI_DEV_ADDR_LEN) == 0)) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/*==============================================*/
+/**
+ * @brief      Check the AD structures of a report against the patterns.
+ * @param[in]  filter - Scan filter.
+ * @param[in]  report - Advertise report.
+ * @param[in]  adv_data_len - Length of the advertising data.
+ * @return     1 if the report is accepted, 0 otherwise.
+ */
+static uint8_t rsi_ble_scan_filter_match(const rsi_ble_scan_filter_t *filter,
+                                         const rsi_ble_event_adv_report_t *report,
+                                         uint8_t adv_data_len)
+{
+  uint16_t inx = 0;
+
+  if (filter->pattern_cnt == 0) {
+    return 1;
+  }
+  // Walk the AD structures: length, type, data
+  while (inx + 1 < adv_data_len) {
+    uint8_t ad_len = report->adv_data[inx];
+    if ((ad_len == 0) || ((inx + 1 + ad_len) > adv_data_len)) {
+      break;
+    }
+    const uint8_t *ad_data = &report->adv_data[inx + 2];
+    uint8_t ad_data_len    = (uint8_t)(ad_len - 1);
+    for (uint8_t i = 0; i < filter->pattern_cnt; i++) {
+      const rsi_ble_scan_filter_pattern_t *pattern = &filter->patterns[i];
+      if ((pattern->ad_type == report->adv_data[inx + 1]) && ((pattern->offset + pattern->len) <= ad_data_len)
+          && (memcmp(&ad_data[pattern->offset], pattern->data, pattern->len) == 0)) {
+        return 1;
+      }
+    }
+    inx = (uint16_t)(inx + 1 + ad_len);
+  }
+  return 0;
+}
+
+/*==============================================*/
+/**
+ * @brief      Look up the cache entry of an advertiser, taking a free or the oldest probed slot for a new one.
+ * @param[in]  filter - Scan filter.
+ * @param[in]  report - Advertise report.
+ * @param[out] is_new - Set to 1 if the entry was taken for this advertiser.
+ * @return     Cache entry.
+ */
+static rsi_ble_scan_filter_entry_t *rsi_ble_scan_filter_lookup(rsi_ble_scan_filter_t *filter,
+                                                               const rsi_ble_event_adv_report_t *report,
+                                                               uint8_t *is_new)
+{
+  uint8_t scan_rsp                    = (report->report_type == RSI_BLE_ADV_REPORT_TYPE_SCAN_RSP);
+  uint32_t hash                       = RSI_BLE_SCAN_FILTER_FNV_OFFSET;
+  rsi_ble_scan_filter_entry_t *victim = NULL;
+  rsi_ble_scan_filter_entry_t *entry  = NULL;
+  uint8_t key[RSI_DEV_ADDR_LEN + 2]   = { 0 };
+
+  key[0] = report->dev_addr_type;
+  key[1] = scan_rsp;
+  memcpy(&key[2], report->dev_addr, RSI_DEV_ADDR_LEN);
+  hash = rsi_ble_scan_filter_hash(hash, key, sizeof(key));
+  // The low bits of an FNV-1a hash only depend on the low bits of the key bytes, fold the high bits in
+  hash ^= hash >> 16;
+
+  for (uint8_t probe = 0; probe < RSI_BLE_SCAN_FILTER_CACHE_PROBES; probe++) {
+    entry = &filter->cache[(hash + probe) & (RSI_BLE_SCAN_FILTER_CACHE_SIZE - 1)];
+    if (!entry->used) {
+      if (victim == NULL || victim->used) {
+        victim = entry;
+      }
+      continue;
+    }
+    if ((entry->dev_addr_type == report->dev_addr_type) && (entry->scan_rsp == scan_rsp)
+        && (memcmp(entry->dev_addr, report->dev_addr, RSI_DEV_ADDR_LEN) == 0)) {
+      *is_new = 0;
+      return entry;
+    }
+    if ((victim == NULL) || (victim->used && ((int32_t)(entry->seen_ms - victim->seen_ms) < 0))) {
+      victim = entry;
+    }
+  }
+
+  memset(victim, 0, sizeof(*victim));
+  victim->used          = 1;
+  victim->dev_addr_type = report->dev_addr_type;
+  victim->scan_rsp      = scan_rsp;
+  memcpy(victim->dev_addr, report->dev_addr, RSI_DEV_ADDR_LEN);
+  *is_new = 1;
+  return victim;
+}
+
+/*==============================================*/
+/**
+ * @brief      Deliver the pending batch. The caller holds the scan filter lock.
+ * @param[in]  filter - Scan filter.
+ * @return     void
+ */
+static void rsi_ble_scan_filter_deliver_batch(rsi_ble_scan_filter_t *filter)
+{
+  uint16_t batch_cnt = filter->batch_cnt;
+
+  if (batch_cnt == 0) {
+    return;
+  }
+  filter->stats.batches++;
+  if (filter->batch_cb != NULL) {
+    filter->batch_cb(filter->batch, batch_cnt);
+  }
+  filter->batch_cnt = 0;
+}
+
+/*==============================================*/
+/**
+ * @brief      Deliver the pending batch if its window has elapsed. The caller holds the scan filter lock.
+ * @param[in]  filter - Scan filter.
+ * @param[in]  now_ms - Current time in milliseconds.
+ * @return     void
+ */
+static void rsi_ble_scan_filter_poll_batch(rsi_ble_scan_filter_t *filter, uint32_t now_ms)
+{
+  if ((filter->batch_cnt != 0) && ((uint32_t)(now_ms - filter->batch_start_ms) >= filter->config.batch_window_ms)) {
+    rsi_ble_scan_filter_deliver_batch(filter);
+  }
+}
+
+/*==============================================*/
+/**
+ * @brief      Deliver a single report, or add it to the pending batch.
+ * @param[in]  filter - Scan filter.
+ * @param[in]  report - Advertise report.
+ * @param[in]  now_ms - Current time in milliseconds.
+ * @return     void
+ * @note       The caller holds the scan filter lock.
+ */
+static void rsi_ble_scan_filter_deliver(rsi_ble_scan_filter_t *filter,
+                                        const rsi_ble_event_adv_report_t *report,
+                                        uint32_t now_ms)
+{
+  filter->stats.delivered++;
+  if (filter->config.batch_window_ms == 0) {
+    filter->stats.batches++;
+    if (filter->batch_cb != NULL) {
+      filter->batch_cb(report, 1);
+    }
+    return;
+  }
+  if (filter->batch_cnt == 0) {
+    filter->batch_start_ms = now_ms;
+  }
+  memcpy(&filter->batch[filter->batch_cnt++], report, sizeof(rsi_ble_event_adv_report_t));
+  if (filter->batch_cnt == RSI_BLE_SCAN_FILTER_BATCH_SIZE) {
+    rsi_ble_scan_filter_deliver_batch(filter);
+  }
+}
+
+void rsi_ble_scan_filter_init(rsi_ble_scan_filter_t *filter,
+                              const rsi_ble_scan_filter_config_t *config,
+                              rsi_ble_on_adv_report_batch_t batch_cb)
+{
+  memset(filter, 0, sizeof(rsi_ble_scan_filter_t));
+  memcpy(&filter->config, config, sizeof(rsi_ble_scan_filter_config_t));
+  filter->batch_cb = batch_cb;
+}
+
+int32_t rsi_ble_scan_filter_add_allow_list(rsi_ble_scan_filter_t *filter,
+                                           uint8_t dev_addr_type,
+                                           const uint8_t *dev_addr)
+{
+  if ((filter == NULL) || (dev_addr == NULL)) {
+    return RSI_ERROR_INVALID_PARAM;
+  }
+  if (filter->allow_list_cnt >= RSI_BLE_SCAN_FILTER_MAX_ALLOW_LIST) {
+    return RSI_ERROR_BLE_DEV_BUF_FULL;
+  }
+  filter->allow_list_type[filter->allow_list_cnt] = dev_addr_type;
+  memcpy(filter->allow_list[filter->allow_list_cnt], dev_addr, RSI_DEV_ADDR_LEN);
+  filter->allow_list_cnt++;
+  return RSI_SUCCESS;
+}
+
+int32_t rsi_ble_scan_filter_add_pattern(rsi_ble_scan_filter_t *filter,
+                                        uint8_t ad_type,
+                                        uint8_t offset,
+                                        uint8_t len,
+                                        const uint8_t *data)
+{
+  if ((filter == NULL) || (data == NULL) || (len == 0) || (len > RSI_BLE_SCAN_FILTER_MAX_PATTERN_LEN)
+      || ((offset + len) > RSI_MAX_ADV_REPORT_SIZE)) {
+    return RSI_ERROR_INVALID_PARAM;
+  }
+  if (filter->pattern_cnt >= RSI_BLE_SCAN_FILTER_MAX_PATTERNS) {
+    return RSI_ERROR_BLE_DEV_BUF_FULL;
+  }
+  rsi_ble_scan_filter_pattern_t *pattern = &filter->patterns[filter->pattern_cnt];
+  pattern->ad_type                       = ad_type;
+  pattern->offset                        = offset;
+  pattern->len                           = len;
+  memcpy(pattern->data, data, len);
+  filter->pattern_cnt++;
+  return RSI_SUCCESS;
+}
+
+void rsi_ble_scan_filter_reset_cache(rsi_ble_scan_filter_t *filter)
+{
+  rsi_ble_scan_filter_lock();
+  memset(filter->cache, 0, sizeof(filter->cache));
+  rsi_ble_scan_filter_unlock();
+}
+
+void rsi_ble_scan_filter_process(rsi_ble_scan_filter_t *filter,
+                                 const rsi_ble_event_adv_report_t *report,
+                                 uint32_t now_ms)
+{
+  uint8_t is_new                     = 0;
+  uint8_t adv_data_len               = report->adv_data_len;
+  rsi_ble_scan_filter_entry_t *entry = NULL;
+  uint32_t data_hash                 = 0;
+
+  rsi_ble_scan_filter_lock();
+  rsi_ble_scan_filter_poll_batch(filter, now_ms);
+  filter->stats.received++;
+
+  if (adv_data_len > RSI_MAX_ADV_REPORT_SIZE) {
+    adv_data_len = RSI_MAX_ADV_REPORT_SIZE;
+  }
+  if (((filter->config.min_rssi != 0) && (report->rssi < filter->config.min_rssi))
+      || !rsi_ble_scan_filter_allowed(filter, report) || !rsi_ble_scan_filter_match(filter, report, adv_data_len)) {
+    filter->stats.filtered++;
+    rsi_ble_scan_filter_unlock();
+    return;
+  }
+
+  data_hash      = rsi_ble_scan_filter_hash(RSI_BLE_SCAN_FILTER_FNV_OFFSET, &adv_data_len, 1);
+  data_hash      = rsi_ble_scan_filter_hash(data_hash, report->adv_data, adv_data_len);
+  entry          = rsi_ble_scan_filter_lookup(filter, report, &is_new);
+  entry->seen_ms = now_ms;
+
+  if (!is_new) {
+    int16_t rssi_delta = (int16_t)(report->rssi - entry->rssi);
+    if (rssi_delta < 0) {
+      rssi_delta = (int16_t)-rssi_delta;
+    }
+    if (!((filter->config.rssi_threshold != 0) && (rssi_delta >= filter->config.rssi_threshold))
+        && !(filter->config.report_on_data_change && (data_hash != entry->data_hash))
+        && !((filter->config.refresh_ms != 0) && ((uint32_t)(now_ms - entry->reported_ms) >= filter->config.refresh_ms))) {
+      filter->stats.duplicates++;
+      rsi_ble_scan_filter_unlock();
+      return;
+    }
+  }
+  entry->rssi        = report->rssi;
+  entry->data_hash   = data_hash;
+  entry->reported_ms = now_ms;
+  rsi_ble_scan_filter_deliver(filter, report, now_ms);
+  rsi_ble_scan_filter_unlock();
+}
+
+void rsi_ble_scan_filter_poll(rsi_ble_scan_filter_t *filter, uint32_t now_ms)
+{
+  rsi_ble_scan_filter_lock();
+  rsi_ble_scan_filter_poll_batch(filter, now_ms);
+  rsi_ble_scan_filter_unlock();
+}
+
+void rsi_ble_scan_filter_flush(rsi_ble_scan_filter_t *filter)
+{
+  rsi_ble_scan_filter_lock();
+  rsi_ble_scan_filter_deliver_batch(filter);
+  rsi_ble_scan_filter_unlock();
+}
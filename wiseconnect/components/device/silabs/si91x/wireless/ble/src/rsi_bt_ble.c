@@ -40,6 +40,7 @@
 
 #include "rsi_bt_common.h"
 #include "rsi_ble.h"
+#include "rsi_ble_scan_filter.h"
 #include "stdio.h"
 
 #include "sl_si91x_host_interface.h"
@@ -72,10 +73,15 @@ int32_t rsi_driver_process_bt_resp(
 void rsi_ble_on_chip_memory_status_callbacks_register(chip_ble_buffers_stats_handler_t ble_on_chip_memory_status_event);
 uint16_t rsi_bt_prepare_common_pkt(uint16_t cmd_type, void *cmd_struct, sl_wifi_system_packet_t *pkt);
 uint16_t rsi_bt_prepare_le_pkt(uint16_t cmd_type, void *cmd_struct, sl_wifi_system_packet_t *pkt);
+static uint8_t rsi_ble_get_remote_dev_index(rsi_bt_cb_t *le_cb, const uint8_t *remote_dev_bd_addr);
+static void rsi_ble_send_queued_cmds(rsi_bt_cb_t *le_cb);
 
 /*
  Global Variables
  */
+// Serializes the registered scan filter between the BLE event context and the application threads
+static osMutexId_t ble_scan_filter_mutex;
+
 /** @addtogroup DRIVER14
 * @{
 */
@@ -227,6 +233,11 @@ void rsi_bt_common_tx_done(sl_wifi_system_packet_t *pkt)
   // Get Command response Type
   rsp_type = rsi_bytes2R_to_uint16(host_desc + RSI_BT_RSP_TYPE_OFFSET);
 
+  // Notifications and write commands are always sent with a sync response, queued ones must not post bt_sem
+  if ((rsp_type == RSI_BLE_CMD_NOTIFY) || (rsp_type == RSI_BLE_REQ_WRITE_NO_ACK)) {
+    return;
+  }
+
   // Get the protocol Type
   protocol_type = (uint8_t)rsi_bt_get_proto_type(rsp_type, &bt_cb);
 
@@ -301,22 +312,23 @@ void rsi_ble_update_le_dev_buf(const rsi_ble_event_le_dev_buf_ind_t *rsi_ble_eve
 
   SL_PRINTF(SL_RSI_BT_UPDATE_LE_DEV_BUF_TRIGGER, BLUETOOTH, LOG_INFO);
   rsi_bt_cb_t *le_cb = rsi_driver_cb->ble_cb;
+  uint8_t inx        = rsi_ble_get_remote_dev_index(le_cb, rsi_ble_event_le_dev_buf_ind->remote_dev_bd_addr);
 
-  for (uint8_t inx = 0; inx < (RSI_BLE_MAX_NBR_PERIPHERALS + RSI_BLE_MAX_NBR_CENTRALS); inx++) {
-    if (!memcmp(rsi_ble_event_le_dev_buf_ind->remote_dev_bd_addr,
-                le_cb->remote_ble_info[inx].remote_dev_bd_addr,
-                RSI_DEV_ADDR_LEN)) {
-      if (le_cb->remote_ble_info[inx].ble_buff_mutex) {
-        osMutexAcquire(le_cb->remote_ble_info[inx].ble_buff_mutex, 0xFFFFFFFFUL);
-      }
+  if (inx == MAX_REMOTE_BLE_DEVICES) {
+    return;
+  }
 
-      le_cb->remote_ble_info[inx].avail_buf_cnt += rsi_ble_event_le_dev_buf_ind->avail_buf_cnt;
-      if (le_cb->remote_ble_info[inx].ble_buff_mutex) {
-        osMutexRelease(le_cb->remote_ble_info[inx].ble_buff_mutex);
-      }
-      break;
-    }
+  if (le_cb->remote_ble_info[inx].ble_buff_mutex) {
+    osMutexAcquire(le_cb->remote_ble_info[inx].ble_buff_mutex, 0xFFFFFFFFUL);
+  }
+
+  le_cb->remote_ble_info[inx].avail_buf_cnt += rsi_ble_event_le_dev_buf_ind->avail_buf_cnt;
+  if (le_cb->remote_ble_info[inx].ble_buff_mutex) {
+    osMutexRelease(le_cb->remote_ble_info[inx].ble_buff_mutex);
   }
+
+  // Use the freed buffers for the queued commands
+  rsi_ble_send_queued_cmds(le_cb);
 }
 
 /**
@@ -341,7 +353,9 @@ void rsi_add_remote_ble_dev_info(const rsi_ble_event_enhance_conn_status_t *remo
       le_cb->remote_ble_info[inx].max_buf_cnt    = 1;
       le_cb->remote_ble_info[inx].avail_buf_cnt  = 1;
       le_cb->remote_ble_info[inx].mode           = 1;
+      le_cb->remote_ble_info[inx].queued_cnt     = 0;
       le_cb->remote_ble_info[inx].ble_buff_mutex = osMutexNew(NULL);
+      memset(&le_cb->remote_ble_info[inx].queued_cmds, 0, sizeof(sli_si91x_buffer_queue_t));
       break;
     }
   }
@@ -359,10 +373,22 @@ void rsi_remove_remote_ble_dev_info(const rsi_ble_event_disconnect_t *remote_dev
 {
 
   SL_PRINTF(SL_RSI_REMOVE_REMOTE_BLE_DEV_INFO_TRIGGER, BLUETOOTH, LOG_INFO);
-  rsi_bt_cb_t *le_cb = rsi_driver_cb->ble_cb;
+  rsi_bt_cb_t *le_cb       = rsi_driver_cb->ble_cb;
+  sl_wifi_buffer_t *buffer = NULL;
 
   for (uint8_t inx = 0; inx < (RSI_BLE_MAX_NBR_PERIPHERALS + RSI_BLE_MAX_NBR_CENTRALS); inx++) {
     if (!memcmp(remote_dev_info->dev_addr, le_cb->remote_ble_info[inx].remote_dev_bd_addr, RSI_DEV_ADDR_LEN)) {
+      // Drop the commands still queued for the device
+      if (le_cb->remote_ble_info[inx].ble_buff_mutex) {
+        osMutexAcquire(le_cb->remote_ble_info[inx].ble_buff_mutex, 0xFFFFFFFFUL);
+      }
+      while (sli_si91x_remove_from_queue(&le_cb->remote_ble_info[inx].queued_cmds, &buffer) == SL_STATUS_OK) {
+        sli_si91x_host_free_buffer(buffer);
+      }
+      le_cb->remote_ble_info[inx].queued_cnt = 0;
+      if (le_cb->remote_ble_info[inx].ble_buff_mutex) {
+        osMutexRelease(le_cb->remote_ble_info[inx].ble_buff_mutex);
+      }
       memset(le_cb->remote_ble_info[inx].remote_dev_bd_addr, 0, RSI_DEV_ADDR_LEN);
       le_cb->remote_ble_info[inx].used                 = 0;
       le_cb->remote_ble_info[inx].avail_buf_cnt        = 0;
@@ -380,6 +406,182 @@ void rsi_remove_remote_ble_dev_info(const rsi_ble_event_disconnect_t *remote_dev
   }
 }
 
+/**
+ * @brief       Get the index of a remote BLE device info in global ble cb structure
+ * @param[in]   le_cb              - BLE control block
+ * @param[in]   remote_dev_bd_addr - Remote device address
+ * @return      Index of the remote device info \n
+ *              MAX_REMOTE_BLE_DEVICES - Remote device not connected
+ *
+ */
+
+static uint8_t rsi_ble_get_remote_dev_index(rsi_bt_cb_t *le_cb, const uint8_t *remote_dev_bd_addr)
+{
+  uint8_t inx = le_cb->remote_ble_last_index;
+
+  // The commands and buffer indications of a data stream all target the same device
+  if ((inx < (RSI_BLE_MAX_NBR_PERIPHERALS + RSI_BLE_MAX_NBR_CENTRALS)) && le_cb->remote_ble_info[inx].used
+      && !memcmp(remote_dev_bd_addr, le_cb->remote_ble_info[inx].remote_dev_bd_addr, RSI_DEV_ADDR_LEN)) {
+    return inx;
+  }
+
+  for (inx = 0; inx < (RSI_BLE_MAX_NBR_PERIPHERALS + RSI_BLE_MAX_NBR_CENTRALS); inx++) {
+    if (le_cb->remote_ble_info[inx].used
+        && !memcmp(remote_dev_bd_addr, le_cb->remote_ble_info[inx].remote_dev_bd_addr, RSI_DEV_ADDR_LEN)) {
+      le_cb->remote_ble_last_index = inx;
+      return inx;
+    }
+  }
+
+  return MAX_REMOTE_BLE_DEVICES;
+}
+
+/**
+ * @brief       Send the queued notifications and write commands for which the remote devices have an available buffer
+ * @param[in]   le_cb - BLE control block
+ * @return      void
+ * @note        Also called from the bus RX thread, on command responses and buffer indications. There, the queue
+ *              node allocated by \ref sli_si91x_driver_send_bt_command can wait up to
+ *              SLI_WIFI_ALLOCATE_COMMAND_BUFFER_WAIT_TIME for a free buffer, which holds off the reception
+ *              meanwhile. RSI_BLE_MAX_QUEUED_CMDS_IN_FLIGHT bounds the nodes held by this path, so the command
+ *              buffer pool must leave room for them.
+ *
+ */
+
+static void rsi_ble_send_queued_cmds(rsi_bt_cb_t *le_cb)
+{
+  const uint8_t max_remote_devices = (RSI_BLE_MAX_NBR_PERIPHERALS + RSI_BLE_MAX_NBR_CENTRALS);
+  sl_wifi_buffer_t *buffer         = NULL;
+  const sl_wifi_system_packet_t *pkt;
+  rsi_remote_ble_info_t *remote_dev_info;
+  uint8_t idle_cnt = 0;
+  uint8_t inx;
+
+  // A blocking command in progress sends the queued commands once it is done, as its response must come after theirs
+  if ((le_cb->bt_cmd_sem == NULL) || (osSemaphoreAcquire(le_cb->bt_cmd_sem, 0) != osOK)) {
+    return;
+  }
+
+  // Serve the remote devices in turn, one command each, until none of them can send
+  while ((idle_cnt < max_remote_devices)
+         && ((le_cb->queued_sent - le_cb->queued_done) < RSI_BLE_MAX_QUEUED_CMDS_IN_FLIGHT)) {
+    inx                      = le_cb->queued_next_index;
+    remote_dev_info          = &le_cb->remote_ble_info[inx];
+    le_cb->queued_next_index = (inx + 1 == max_remote_devices) ? 0 : (inx + 1);
+    buffer                   = NULL;
+
+    if (remote_dev_info->used && remote_dev_info->queued_cnt) {
+      if (remote_dev_info->ble_buff_mutex) {
+        osMutexAcquire(remote_dev_info->ble_buff_mutex, 0xFFFFFFFFUL);
+      }
+      if ((remote_dev_info->avail_buf_cnt != 0)
+          && (sli_si91x_remove_from_queue(&remote_dev_info->queued_cmds, &buffer) == SL_STATUS_OK)) {
+        remote_dev_info->avail_buf_cnt -= 1;
+        remote_dev_info->queued_cnt -= 1;
+      }
+      if (remote_dev_info->ble_buff_mutex) {
+        osMutexRelease(remote_dev_info->ble_buff_mutex);
+      }
+    }
+
+    if (buffer == NULL) {
+      idle_cnt++;
+      continue;
+    }
+    idle_cnt = 0;
+
+    // Count the command before it is sent, as its response can come right after
+    pkt = sl_si91x_host_get_buffer_data(buffer, 0, NULL);
+    le_cb->queued_sent++;
+    if (sli_si91x_driver_send_bt_command(rsi_bytes2R_to_uint16(&pkt->desc[2]), SLI_SI91X_BT_CMD, buffer, 0)
+        != SL_STATUS_OK) {
+      le_cb->queued_sent--;
+      // The command is dropped, give its buffer back to the remote device
+      if (remote_dev_info->ble_buff_mutex) {
+        osMutexAcquire(remote_dev_info->ble_buff_mutex, 0xFFFFFFFFUL);
+      }
+      if (remote_dev_info->used) {
+        remote_dev_info->avail_buf_cnt += 1;
+      }
+      if (remote_dev_info->ble_buff_mutex) {
+        osMutexRelease(remote_dev_info->ble_buff_mutex);
+      }
+      if (le_cb->queued_status == RSI_SUCCESS) {
+        le_cb->queued_status = RSI_ERROR_PKT_ALLOCATION_FAILURE;
+      }
+    }
+  }
+
+  osSemaphoreRelease(le_cb->bt_cmd_sem);
+}
+
+/**
+ * @brief       Queue a notification or write command until the remote device has an available buffer
+ * @param[in]   cmd          - Type of the command to send
+ * @param[in]   dev_addr     - Remote device address
+ * @param[in]   cmd_struct   - Pointer of the packet structure to send
+ * @param[in]   payload_size - Size of the packet structure
+ * @return      0              - Success \n
+ *              Non-Zero Value - Failure
+ *
+ */
+
+static int32_t rsi_ble_queue_cmd(uint16_t cmd, const uint8_t *dev_addr, const void *cmd_struct, uint16_t payload_size)
+{
+  rsi_bt_cb_t *le_cb           = rsi_driver_cb->ble_cb;
+  sl_wifi_system_packet_t *pkt = NULL;
+  sl_wifi_buffer_t *buffer     = NULL;
+  int32_t status               = RSI_SUCCESS;
+  rsi_remote_ble_info_t *remote_dev_info;
+  uint8_t inx;
+
+  inx = rsi_ble_get_remote_dev_index(le_cb, dev_addr);
+  if (inx == MAX_REMOTE_BLE_DEVICES) {
+    return RSI_ERROR_NOT_IN_CONNECTED_STATE;
+  }
+  remote_dev_info = &le_cb->remote_ble_info[inx];
+  if (remote_dev_info->queued_cnt >= RSI_BLE_MAX_QUEUED_CMDS_PER_CONN) {
+    return RSI_ERROR_BLE_DEV_BUF_FULL;
+  }
+
+  // Allocate command buffer from ble pool
+  sli_si91x_allocate_command_buffer(&buffer,
+                                    (void **)&pkt,
+                                    sizeof(sl_wifi_system_packet_t) + RSI_BLE_CMD_LEN,
+                                    SLI_WIFI_ALLOCATE_COMMAND_BUFFER_WAIT_TIME);
+  if (pkt == NULL) {
+    return RSI_ERROR_PKT_ALLOCATION_FAILURE;
+  }
+
+  memset(pkt->desc, 0, sizeof(pkt->desc));
+  memcpy(pkt->data, cmd_struct, payload_size);
+  rsi_uint16_to_2bytes(pkt->desc, (payload_size & 0xFFF));
+  rsi_uint16_to_2bytes(&pkt->desc[2], cmd);
+
+  if (remote_dev_info->ble_buff_mutex) {
+    osMutexAcquire(remote_dev_info->ble_buff_mutex, 0xFFFFFFFFUL);
+  }
+  if (!remote_dev_info->used) {
+    status = RSI_ERROR_NOT_IN_CONNECTED_STATE;
+  } else if (remote_dev_info->queued_cnt >= RSI_BLE_MAX_QUEUED_CMDS_PER_CONN) {
+    status = RSI_ERROR_BLE_DEV_BUF_FULL;
+  } else {
+    sli_si91x_add_to_queue(&remote_dev_info->queued_cmds, buffer);
+    remote_dev_info->queued_cnt += 1;
+  }
+  if (remote_dev_info->ble_buff_mutex) {
+    osMutexRelease(remote_dev_info->ble_buff_mutex);
+  }
+
+  if (status != RSI_SUCCESS) {
+    sli_si91x_host_free_buffer(buffer);
+    return status;
+  }
+
+  rsi_ble_send_queued_cmds(le_cb);
+  return RSI_SUCCESS;
+}
+
 /**
  * @brief       Process BT RX packets
  * @param[in ]  bt_cb    - BT control block
@@ -421,6 +623,17 @@ int32_t rsi_driver_process_bt_resp(
   // Get Status
   status = rsi_bytes2R_to_uint16(host_desc + RSI_BT_STATUS_OFFSET);
 
+  // The responses of the queued commands come in order, before the one of any blocking command sent after them
+  if (((rsp_type == RSI_BLE_CMD_NOTIFY) || (rsp_type == RSI_BLE_REQ_WRITE_NO_ACK))
+      && (bt_cb->queued_sent != bt_cb->queued_done)) {
+    if ((status != RSI_SUCCESS) && (bt_cb->queued_status == RSI_SUCCESS)) {
+      bt_cb->queued_status = status;
+    }
+    bt_cb->queued_done++;
+    rsi_ble_send_queued_cmds(bt_cb);
+    return status;
+  }
+
   // Check bt_cb for any task is waiting for response
   if (bt_cb->expected_response_type == rsp_type) {
     // Update the status in bt_cb
@@ -583,6 +796,12 @@ int8_t rsi_bt_cb_init(rsi_bt_cb_t *bt_cb, uint16_t protocol_type)
   osSemaphoreRelease(bt_cb->bt_cmd_sem);
   bt_cb->app_buffer = 0;
 
+  bt_cb->remote_ble_last_index = 0;
+  bt_cb->queued_next_index     = 0;
+  bt_cb->queued_sent           = 0;
+  bt_cb->queued_done           = 0;
+  bt_cb->queued_status         = RSI_SUCCESS;
+
   return retval;
 }
 
@@ -683,6 +902,52 @@ void rsi_ble_gap_register_callbacks(rsi_ble_on_adv_report_event_t ble_on_adv_rep
   ble_specific_cb->ble_on_conn_update_complete_event       = ble_on_conn_update_complete_event;
   ble_specific_cb->ble_on_remote_conn_params_request_event = ble_on_remote_conn_params_request_event;
 }
+
+/*==============================================*/
+/**
+ * @brief      Route the advertise reports through a scan filter.
+ * @param[in]  filter - Scan filter, NULL to deliver the reports to the advertise report callback.
+ * @return      void
+ */
+
+void rsi_ble_scan_filter_register(rsi_ble_scan_filter_t *filter)
+{
+  // Get ble cb struct pointer
+  rsi_ble_cb_t *ble_specific_cb = rsi_driver_cb->ble_cb->bt_global_cb->ble_specific_cb;
+
+  if (ble_scan_filter_mutex == NULL) {
+    ble_scan_filter_mutex = osMutexNew(NULL);
+  }
+  rsi_ble_scan_filter_lock();
+  ble_specific_cb->ble_scan_filter = filter;
+  rsi_ble_scan_filter_unlock();
+}
+
+/*==============================================*/
+/**
+ * @brief      Take the scan filter lock. Nothing is locked until a filter was registered once.
+ * @return      void
+ */
+
+void rsi_ble_scan_filter_lock(void)
+{
+  if (ble_scan_filter_mutex != NULL) {
+    osMutexAcquire(ble_scan_filter_mutex, 0xFFFFFFFFUL);
+  }
+}
+
+/*==============================================*/
+/**
+ * @brief      Release the scan filter lock.
+ * @return      void
+ */
+
+void rsi_ble_scan_filter_unlock(void)
+{
+  if (ble_scan_filter_mutex != NULL) {
+    osMutexRelease(ble_scan_filter_mutex);
+  }
+}
 /*==============================================*/
 /**
  * @brief      Register GAP Extended responses/events callbacks.
@@ -1016,7 +1281,11 @@ void rsi_ble_callbacks_handler(rsi_bt_cb_t *ble_cb, uint16_t rsp_type, uint8_t *
   // Check each cmd_type like decode_resp_handler and call the respective callback
   switch (rsp_type) {
     case RSI_BLE_EVENT_ADV_REPORT: {
-      if (ble_specific_cb->ble_on_adv_report_event != NULL) {
+      if (ble_specific_cb->ble_scan_filter != NULL) {
+        // The scan filter keeps time in milliseconds, not kernel ticks
+        uint32_t now_ms = (uint32_t)((uint64_t)osKernelGetTickCount() * 1000 / osKernelGetTickFreq());
+        rsi_ble_scan_filter_process(ble_specific_cb->ble_scan_filter, (rsi_ble_event_adv_report_t *)payload, now_ms);
+      } else if (ble_specific_cb->ble_on_adv_report_event != NULL) {
         ble_specific_cb->ble_on_adv_report_event((rsi_ble_event_adv_report_t *)payload);
       }
     } break;
@@ -2092,6 +2361,21 @@ uint16_t rsi_bt_prepare_le_pkt(uint16_t cmd_type, void *cmd_struct, sl_wifi_syst
   return payload_size;
 }
 
+/**
+ * @brief       Release the command semaphore and send the commands queued meanwhile
+ * @param[in]   bt_cb - BT control block
+ * @return      void
+ *
+ */
+
+static void rsi_bt_release_cmd_sem(rsi_bt_cb_t *bt_cb)
+{
+  osSemaphoreRelease(bt_cb->bt_cmd_sem);
+  if (bt_cb == rsi_driver_cb->ble_cb) {
+    rsi_ble_send_queued_cmds(bt_cb);
+  }
+}
+
 /**
  * @brief       Fill commands and places into Bt TX queue
  * @param[in]   cmd          - Type of the command to send
@@ -2156,7 +2440,7 @@ int32_t rsi_bt_driver_send_cmd(uint16_t cmd, void *cmd_struct, void *resp)
                                              calculate_timeout_ms);
   // If allocation of packet fails
   if (pkt == NULL) {
-    osSemaphoreRelease(bt_cb->bt_cmd_sem);
+    rsi_bt_release_cmd_sem(bt_cb);
 
     // Return packet allocation failure error
     SL_PRINTF(SL_RSI_ERROR_PKT_ALLOCATION_FAILURE, BLUETOOTH, LOG_ERROR, "COMMAND: %2x", cmd);
@@ -2207,7 +2491,7 @@ int32_t rsi_bt_driver_send_cmd(uint16_t cmd, void *cmd_struct, void *resp)
 
     bt_cb->buf_status = SI_LE_BUFFER_AVL;
     bt_cb->cmd_status = 0;
-    osSemaphoreRelease(bt_cb->bt_cmd_sem);
+    rsi_bt_release_cmd_sem(bt_cb);
     SL_PRINTF(SL_RSI_BLE_ERROR, BLUETOOTH, LOG_ERROR, "Status: %4x", status);
 
     return status;
@@ -2250,7 +2534,7 @@ int32_t rsi_bt_driver_send_cmd(uint16_t cmd, void *cmd_struct, void *resp)
   bt_cb->sync_rsp = 0;
 
   // Post the semaphore which is waiting on driver_send API
-  osSemaphoreRelease(bt_cb->bt_cmd_sem);
+  rsi_bt_release_cmd_sem(bt_cb);
 
   // Return status
   return status;
@@ -2258,3 +2542,94 @@ int32_t rsi_bt_driver_send_cmd(uint16_t cmd, void *cmd_struct, void *resp)
 /** @} */
 
 /*==============================================*/
+/**
+ * @brief       Queue a notification of the local value to the remote device. This is a non-blocking API.
+ * @param[in]   dev_addr - remote device address
+ * @param[in]   handle   - local attribute handle
+ * @param[in]   data_len - attribute value length
+ * @param[in]   p_data   - attribute value
+ * @return      0              - Success \n
+ *              Non-Zero Value - Failure
+ *
+ */
+
+int32_t rsi_ble_notify_value_queued(const uint8_t *dev_addr, uint16_t handle, uint16_t data_len, const uint8_t *p_data)
+{
+  rsi_ble_notify_att_value_t ble_notify = { 0 };
+
+  if ((dev_addr == NULL) || (p_data == NULL) || (data_len > RSI_DEV_ATT_LEN)) {
+    return RSI_ERROR_INVALID_PARAM;
+  }
+
+  memcpy(ble_notify.dev_addr, dev_addr, RSI_DEV_ADDR_LEN);
+  ble_notify.handle   = handle;
+  ble_notify.data_len = data_len;
+  memcpy(ble_notify.data, p_data, data_len);
+
+  return rsi_ble_queue_cmd(RSI_BLE_CMD_NOTIFY, dev_addr, &ble_notify, sizeof(rsi_ble_notify_att_value_t));
+}
+
+/*==============================================*/
+/**
+ * @brief       Queue a write of the attribute value of the remote device, without waiting for an ACK from it.
+ *              This is a non-blocking API.
+ * @param[in]   dev_addr - remote device address
+ * @param[in]   handle   - attribute value handle
+ * @param[in]   data_len - attribute value length
+ * @param[in]   p_data   - attribute value
+ * @return      0              - Success \n
+ *              Non-Zero Value - Failure
+ *
+ */
+
+int32_t rsi_ble_set_att_cmd_queued(const uint8_t *dev_addr, uint16_t handle, uint8_t data_len, const uint8_t *p_data)
+{
+  rsi_ble_set_att_cmd_t set_att_cmd = { 0 };
+
+  if ((dev_addr == NULL) || (p_data == NULL) || (data_len > RSI_DEV_ATT_LEN)) {
+    return RSI_ERROR_INVALID_PARAM;
+  }
+
+  memcpy(set_att_cmd.dev_addr, dev_addr, RSI_DEV_ADDR_LEN);
+  rsi_uint16_to_2bytes(set_att_cmd.handle, handle);
+  set_att_cmd.length = data_len;
+  memcpy(set_att_cmd.att_value, p_data, data_len);
+
+  return rsi_ble_queue_cmd(RSI_BLE_REQ_WRITE_NO_ACK, dev_addr, &set_att_cmd, sizeof(rsi_ble_set_att_cmd_t));
+}
+
+/*==============================================*/
+/**
+ * @brief       Get the number of queued notifications and write commands still waiting for a buffer of the remote device
+ * @param[in]   dev_addr - remote device address
+ * @return      Number of queued commands
+ *
+ */
+
+uint8_t rsi_ble_get_queued_cmd_count(const uint8_t *dev_addr)
+{
+  rsi_bt_cb_t *le_cb = rsi_driver_cb->ble_cb;
+  uint8_t inx        = rsi_ble_get_remote_dev_index(le_cb, dev_addr);
+
+  return (inx == MAX_REMOTE_BLE_DEVICES) ? 0 : le_cb->remote_ble_info[inx].queued_cnt;
+}
+
+/*==============================================*/
+/**
+ * @brief       Get and clear the status of the first queued command that failed since the last call
+ * @param[in]   void
+ * @return      0              - Success \n
+ *              Non-Zero Value - Failure
+ *
+ */
+
+int32_t rsi_ble_get_queued_cmd_status(void)
+{
+  rsi_bt_cb_t *le_cb = rsi_driver_cb->ble_cb;
+  int32_t status     = le_cb->queued_status;
+
+  le_cb->queued_status = RSI_SUCCESS;
+  return status;
+}
+
+/*==============================================*/
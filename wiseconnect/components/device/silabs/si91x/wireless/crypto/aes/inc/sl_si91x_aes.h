@@ -60,6 +60,13 @@
  */
 #define SL_SI91X_AES_LAST_CHUNK BIT(2)
 
+/**
+ * @brief Number of chunk requests an AES session keeps queued to the NWP.
+ */
+#ifndef SL_SI91X_AES_SESSION_DEPTH
+#define SL_SI91X_AES_SESSION_DEPTH 4
+#endif
+
 /**
  * @brief Enumeration defines the AES modes supported by the SI91X device.
  *
@@ -164,6 +171,33 @@ typedef struct {
   uint8_t chunk_flag;                   ///< Flag to indicate chunk number
 } sli_si91x_psa_aes_multipart_config_t;
 
+/**
+ * @brief Structure defines a chunk request queued by an AES session.
+ */
+typedef struct {
+  uint8_t *output;   ///< Where the result of the chunk is written
+  uint16_t length;   ///< Length of the chunk
+  uint8_t packet_id; ///< Driver identifier of the request
+} sli_si91x_aes_session_chunk_t;
+
+/**
+ * @brief Structure defines an AES session.
+ * 
+ * This structure holds the operation parameters and key configuration of a message
+ * processed by @ref sl_si91x_aes_session_update, and the chunk requests queued to the NWP.
+ */
+typedef struct {
+  sl_si91x_aes_mode_t aes_mode;                                    ///< AES Mode
+  sl_si91x_aes_type_t encrypt_decrypt;                             ///< Encryption or decryption
+  uint8_t iv[SL_SI91X_IV_SIZE];                                    ///< Initialization vector
+  sl_si91x_aes_key_config_t key_config;                            ///< Key configuration
+  uint16_t msg_length;                                             ///< Total length of the message
+  uint16_t offset;                                                 ///< Length of the message already submitted
+  sli_si91x_aes_session_chunk_t chunk[SL_SI91X_AES_SESSION_DEPTH]; ///< Queued chunk requests
+  uint8_t chunk_head;                                              ///< Oldest queued chunk request
+  uint8_t chunk_count;                                             ///< Number of queued chunk requests
+} sl_si91x_aes_session_t;
+
 /** @} */
 
 /******************************************************
@@ -217,4 +251,49 @@ sl_status_t sl_si91x_aes_multipart(const sl_si91x_aes_config_t *config,
                                    uint16_t chunk_length,
                                    uint8_t aes_flags,
                                    uint8_t *output);
+
+#ifndef SL_SI91X_SIDE_BAND_CRYPTO
+/***************************************************************************/
+/**
+ * @brief 
+ *   To start an AES session for a message processed in one or more calls to @ref sl_si91x_aes_session_update.
+ * @param[out] session 
+ *   Session object of type @ref sl_si91x_aes_session_t.
+ * @param[in] config 
+ *   Configuration object of type @ref sl_si91x_aes_config_t. The message pointer is not used and msg_length is the total length of the message.
+ *   The IV and key configuration are copied into the session.
+ * @return
+ *   sl_status_t.
+ * For more information on status codes, refer to 
+ * [SL STATUS DOCUMENTATION](https://docs.silabs.com/gecko-platform/latest/platform-common/status).
+ ******************************************************************************/
+sl_status_t sl_si91x_aes_session_start(sl_si91x_aes_session_t *session, const sl_si91x_aes_config_t *config);
+
+/***************************************************************************/
+/**
+ * @brief 
+ *   To encrypt or decrypt the next part of the message of an AES session. This is a blocking API.
+ * @param[in] session 
+ *   Session object started with @ref sl_si91x_aes_session_start.
+ * @param[in] input 
+ *   Next part of the message.
+ * @param[in] length 
+ *   Length of the part in bytes, a multiple of SL_SI91X_AES_BLOCK_SIZE.
+ * @param[out] output 
+ *   Buffer to store the output, at least length bytes.
+ * @note
+ *   The part is split into chunks of SLI_SI91X_MAX_DATA_SIZE_IN_BYTES_FOR_AES bytes, and up to SL_SI91X_AES_SESSION_DEPTH chunk requests are
+ *   queued to the NWP at once so that the next chunk is ready when the previous one completes. The result of each chunk is written to output directly.
+ * @note
+ *   If this function fails, the session must be started again.
+ * @return
+ *   sl_status_t.
+ * For more information on status codes, refer to 
+ * [SL STATUS DOCUMENTATION](https://docs.silabs.com/gecko-platform/latest/platform-common/status).
+ ******************************************************************************/
+sl_status_t sl_si91x_aes_session_update(sl_si91x_aes_session_t *session,
+                                        const uint8_t *input,
+                                        uint16_t length,
+                                        uint8_t *output);
+#endif
 /** @} */
@@ -37,6 +37,8 @@
 #include "sl_si91x_crypto_thread.h"
 #endif
 #include "sl_si91x_driver.h"
+#include "sl_si91x_core_utilities.h"
+#include <stddef.h>
 #include <string.h>
 
 #define SLI_SI91X_MAX_DATA_SIZE_IN_BYTES_FOR_AES 1408
@@ -100,6 +102,195 @@ static sl_status_t sli_si91x_aes_pending(const sl_si91x_aes_config_t *config,
   return status;
 }
 
+
+static sl_status_t sli_si91x_aes_session_submit(sl_si91x_aes_session_t *session,
+                                                const uint8_t *input,
+                                                uint16_t chunk_length,
+                                                uint8_t aes_flags,
+                                                uint8_t *output)
+{
+  sl_status_t status               = SL_STATUS_FAIL;
+  sl_wifi_buffer_t *buffer         = NULL;
+  sl_wifi_system_packet_t *packet  = NULL;
+  sli_si91x_aes_request_t *request = NULL;
+  uint8_t packet_id                = 0;
+  uint32_t request_length =
+    sizeof(sli_si91x_aes_request_t) - SLI_SI91X_MAX_DATA_SIZE_IN_BYTES_FOR_AES + chunk_length;
+
+  // Build the request in the command buffer, so the chunk is copied only once
+  status = sli_si91x_allocate_command_buffer(&buffer,
+                                             (void **)&packet,
+                                             sizeof(sl_wifi_system_packet_t) + request_length,
+                                             SLI_WIFI_ALLOCATE_COMMAND_BUFFER_WAIT_TIME);
+  VERIFY_STATUS_AND_RETURN(status);
+
+  memset(packet->desc, 0, sizeof(packet->desc));
+  request = (sli_si91x_aes_request_t *)packet->data;
+  memset(request, 0, offsetof(sli_si91x_aes_request_t, msg));
+
+  request->algorithm_type       = AES;
+  request->algorithm_sub_type   = (uint8_t)session->aes_mode;
+  request->aes_flags            = aes_flags;
+  request->total_msg_length     = session->msg_length;
+  request->current_chunk_length = chunk_length;
+  request->encrypt_decryption   = session->encrypt_decrypt;
+  memcpy(request->IV, session->iv, SL_SI91X_IV_SIZE);
+  memcpy(request->msg, input, chunk_length);
+
+#if defined(SLI_SI917B0) || defined(SLI_SI915)
+  request->key_info.key_type                         = session->key_config.b0.key_type;
+  request->key_info.key_detail.key_size              = session->key_config.b0.key_size;
+  request->key_info.key_detail.key_spec.key_slot     = session->key_config.b0.key_slot;
+  request->key_info.key_detail.key_spec.wrap_iv_mode = session->key_config.b0.wrap_iv_mode;
+  memcpy(request->key_info.key_detail.key_spec.wrap_iv, session->key_config.b0.wrap_iv, SL_SI91X_IV_SIZE);
+  memcpy(request->key_info.key_detail.key_spec.key_buffer,
+         session->key_config.b0.key_buffer,
+         SL_SI91X_KEY_BUFFER_SIZE);
+#else
+  request->key_length = session->key_config.a0.key_length;
+  memcpy(request->key, session->key_config.a0.key, request->key_length);
+#endif
+
+  packet->length  = request_length & 0xFFF;
+  packet->command = SLI_COMMON_REQ_ENCRYPT_CRYPTO;
+
+  // Queue the request without waiting, its response is collected by sli_si91x_aes_session_retire
+  status = sli_si91x_driver_queue_command_packet(SLI_COMMON_REQ_ENCRYPT_CRYPTO,
+                                                 SI91X_COMMON_CMD,
+                                                 buffer,
+                                                 SL_SI91X_WAIT_FOR_RESPONSE(32000),
+                                                 NULL,
+                                                 true,
+                                                 &packet_id);
+  VERIFY_STATUS_AND_RETURN(status);
+
+  sli_si91x_aes_session_chunk_t *chunk =
+    &session->chunk[(session->chunk_head + session->chunk_count) % SL_SI91X_AES_SESSION_DEPTH];
+  chunk->output    = output;
+  chunk->length    = chunk_length;
+  chunk->packet_id = packet_id;
+  session->chunk_count++;
+  return SL_STATUS_OK;
+}
+
+static sl_status_t sli_si91x_aes_session_retire(sl_si91x_aes_session_t *session)
+{
+  sl_status_t status                         = SL_STATUS_FAIL;
+  sl_wifi_buffer_t *buffer                   = NULL;
+  const sl_wifi_system_packet_t *packet      = NULL;
+  const sli_si91x_aes_session_chunk_t *chunk = &session->chunk[session->chunk_head];
+
+  session->chunk_head = (uint8_t)((session->chunk_head + 1) % SL_SI91X_AES_SESSION_DEPTH);
+  session->chunk_count--;
+
+  // Responses of the common queue come back in order, so the oldest request completes first
+  status = sli_si91x_driver_wait_for_command_packet(SI91X_COMMON_CMD,
+                                                    chunk->packet_id,
+                                                    SL_SI91X_WAIT_FOR_RESPONSE(32000),
+                                                    &buffer);
+  if (status != SL_STATUS_OK) {
+    if (buffer != NULL)
+      sli_si91x_host_free_buffer(buffer);
+  }
+  VERIFY_STATUS_AND_RETURN(status);
+
+  packet = sl_si91x_host_get_buffer_data(buffer, 0, NULL);
+  memcpy(chunk->output, packet->data, (packet->length < chunk->length) ? packet->length : chunk->length);
+  sli_si91x_host_free_buffer(buffer);
+  return status;
+}
+
+sl_status_t sl_si91x_aes_session_start(sl_si91x_aes_session_t *session, const sl_si91x_aes_config_t *config)
+{
+  SL_VERIFY_POINTER_OR_RETURN(session, SL_STATUS_NULL_POINTER);
+  SL_VERIFY_POINTER_OR_RETURN(config, SL_STATUS_NULL_POINTER);
+
+  if (((config->aes_mode == SL_SI91X_AES_CBC) || (config->aes_mode == SL_SI91X_AES_CTR)) && (config->iv == NULL)) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  if (config->msg_length % SL_SI91X_AES_BLOCK_SIZE) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  memset(session, 0, sizeof(sl_si91x_aes_session_t));
+  session->aes_mode        = config->aes_mode;
+  session->encrypt_decrypt = config->encrypt_decrypt;
+  session->key_config      = config->key_config;
+  session->msg_length      = config->msg_length;
+  if (config->iv != NULL) {
+    memcpy(session->iv, config->iv, SL_SI91X_IV_SIZE);
+  }
+
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_si91x_aes_session_update(sl_si91x_aes_session_t *session,
+                                        const uint8_t *input,
+                                        uint16_t length,
+                                        uint8_t *output)
+{
+  uint16_t chunk_len = 0;
+  uint8_t aes_flags  = 0;
+  sl_status_t status = SL_STATUS_OK;
+
+  SL_VERIFY_POINTER_OR_RETURN(session, SL_STATUS_NULL_POINTER);
+  SL_VERIFY_POINTER_OR_RETURN(input, SL_STATUS_NULL_POINTER);
+  SL_VERIFY_POINTER_OR_RETURN(output, SL_STATUS_NULL_POINTER);
+
+  if ((length % SL_SI91X_AES_BLOCK_SIZE) || (length > (session->msg_length - session->offset))) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+#if defined(SLI_MULTITHREAD_DEVICE_SI91X)
+  if (crypto_aes_mutex == NULL) {
+    crypto_aes_mutex = sl_si91x_crypto_threadsafety_init(crypto_aes_mutex);
+  }
+  mutex_result = sl_si91x_crypto_mutex_acquire(crypto_aes_mutex);
+#endif
+
+  while ((length != 0) || (session->chunk_count != 0)) {
+    // Keep the queue full, and collect the oldest response once it is
+    if ((length != 0) && (session->chunk_count < SL_SI91X_AES_SESSION_DEPTH)) {
+      chunk_len = (length > SLI_SI91X_MAX_DATA_SIZE_IN_BYTES_FOR_AES) ? SLI_SI91X_MAX_DATA_SIZE_IN_BYTES_FOR_AES : length;
+      if ((session->offset + chunk_len) == session->msg_length) {
+        aes_flags = LAST_CHUNK;
+      } else {
+        aes_flags = MIDDLE_CHUNK;
+      }
+      if (session->offset == 0) {
+        aes_flags = (aes_flags == LAST_CHUNK) ? (FIRST_CHUNK | LAST_CHUNK) : FIRST_CHUNK;
+      }
+
+      status = sli_si91x_aes_session_submit(session, input, chunk_len, aes_flags, output);
+      if (status != SL_STATUS_OK) {
+        break;
+      }
+
+      session->offset += chunk_len;
+      input += chunk_len;
+      output += chunk_len;
+      length -= chunk_len;
+    } else {
+      status = sli_si91x_aes_session_retire(session);
+      if (status != SL_STATUS_OK) {
+        break;
+      }
+    }
+  }
+
+  // Collect the responses still queued so that they do not block the common queue
+  while (session->chunk_count != 0) {
+    (void)sli_si91x_aes_session_retire(session);
+  }
+
+#if defined(SLI_MULTITHREAD_DEVICE_SI91X)
+  mutex_result = sl_si91x_crypto_mutex_release(crypto_aes_mutex);
+#endif
+
+  return status;
+}
+
 #else
 static sl_status_t sli_si91x_aes_side_band(const sl_si91x_aes_config_t *config, uint8_t *output)
 {
@@ -139,9 +330,6 @@ static sl_status_t sli_si91x_aes_side_band(const sl_si91x_aes_config_t *config,
 
 sl_status_t sl_si91x_aes(sl_si91x_aes_config_t *config, uint8_t *output)
 {
-  uint16_t chunk_len = 0;
-  uint16_t offset    = 0;
-  uint8_t aes_flags  = 0;
   sl_status_t status = SL_STATUS_FAIL;
 
   SL_VERIFY_POINTER_OR_RETURN(config->msg, SL_STATUS_NULL_POINTER);
@@ -157,64 +345,20 @@ sl_status_t sl_si91x_aes(sl_si91x_aes_config_t *config, uint8_t *output)
   uint16_t total_length = config->msg_length;
 
 #ifdef SL_SI91X_SIDE_BAND_CRYPTO
-  (void)chunk_len;
-  (void)offset;
-  (void)aes_flags;
   (void)total_length;
 
   status = sli_si91x_aes_side_band(config, output);
   return status;
 #else
+  sl_si91x_aes_session_t session;
 
-#if defined(SLI_MULTITHREAD_DEVICE_SI91X)
-  if (crypto_aes_mutex == NULL) {
-    crypto_aes_mutex = sl_si91x_crypto_threadsafety_init(crypto_aes_mutex);
-  }
-  mutex_result = sl_si91x_crypto_mutex_acquire(crypto_aes_mutex);
-#endif
-
-  while (total_length) {
-    // Check total length
-    if (total_length > SLI_SI91X_MAX_DATA_SIZE_IN_BYTES_FOR_AES) {
-      chunk_len = SLI_SI91X_MAX_DATA_SIZE_IN_BYTES_FOR_AES;
-      if (offset == 0) {
-        // Make aes_flags as first chunk
-        aes_flags |= FIRST_CHUNK;
-      } else {
-        // Make aes_flags as last chunk
-        aes_flags = MIDDLE_CHUNK;
-      }
-    } else {
-      chunk_len = total_length;
-      aes_flags = LAST_CHUNK;
-      if (offset == 0) {
-        // If the total length is less than 1408 and offset is zero, make aes_flags as both first chunk as well as last chunk
-        aes_flags |= FIRST_CHUNK;
-      }
-    }
-
-    // Send the current chunk length message
-    status = sli_si91x_aes_pending(config, chunk_len, aes_flags, output);
-    if (status != SL_STATUS_OK) {
-#if defined(SLI_MULTITHREAD_DEVICE_SI91X)
-      mutex_result = sl_si91x_crypto_mutex_release(crypto_aes_mutex);
-#endif
-      return status;
-    }
-
-    // Increment the offset value
-    offset += chunk_len;
-    config->msg += chunk_len;
-
-    output += chunk_len;
+  status = sl_si91x_aes_session_start(&session, config);
+  VERIFY_STATUS_AND_RETURN(status);
 
-    // Decrement the total message length
-    total_length -= chunk_len;
-  }
+  status = sl_si91x_aes_session_update(&session, config->msg, total_length, output);
+  VERIFY_STATUS_AND_RETURN(status);
 
-#if defined(SLI_MULTITHREAD_DEVICE_SI91X)
-  mutex_result = sl_si91x_crypto_mutex_release(crypto_aes_mutex);
-#endif
+  config->msg += total_length;
 
   return status;
 #endif
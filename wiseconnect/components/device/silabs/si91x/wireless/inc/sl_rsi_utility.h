@@ -74,6 +74,23 @@
 #ifndef SL_SI91X_EVENT_HANDLER_STACK_SIZE
 #define SL_SI91X_EVENT_HANDLER_STACK_SIZE 1536
 #endif
+
+/**
+ * Number of commands of the common, WLAN and network command queues that can wait for their response at the same time,
+ * from 1 (one command at a time) to SLI_SI91X_MAX_COMMANDS_IN_FLIGHT. Commands flagged with SI91X_PACKET_SERIALIZE,
+ * such as join and power save requests, are always alone in flight.
+ * These values can be overridden by defining new values in your project or adding -D<name>=<new value> to your
+ * compiler command line options.
+ */
+#ifndef SL_SI91X_COMMON_CMD_WINDOW_SIZE
+#define SL_SI91X_COMMON_CMD_WINDOW_SIZE 1
+#endif
+#ifndef SL_SI91X_WLAN_CMD_WINDOW_SIZE
+#define SL_SI91X_WLAN_CMD_WINDOW_SIZE 1
+#endif
+#ifndef SL_SI91X_NETWORK_CMD_WINDOW_SIZE
+#define SL_SI91X_NETWORK_CMD_WINDOW_SIZE 1
+#endif
 typedef bool (*sli_si91x_wifi_buffer_comparator)(const sl_wifi_buffer_t *buffer, const void *userdata);
 
 typedef struct {
@@ -94,6 +111,10 @@ void sli_handle_wifi_beacon(sl_wifi_system_packet_t *packet);
 sl_status_t sli_wifi_get_stored_scan_results(sl_wifi_interface_t interface,
                                              sl_wifi_extended_scan_result_parameters_t *extended_scan_parameters);
 void sli_wifi_flush_scan_results_database(void);
+/* Function used to run a scan on all channels and wait for its results */
+sl_status_t sli_wifi_scan_and_wait(sl_wifi_interface_t interface,
+                                   sl_wifi_scan_result_t *scan_results,
+                                   uint32_t max_scan_result_count);
 
 typedef void (*sli_si91x_host_atomic_action_function_t)(void *user_data);
 typedef uint8_t (*sli_si91x_compare_function_t)(sl_wifi_buffer_t *node, void *user_data);
@@ -358,6 +379,27 @@ sl_status_t sli_si91x_flush_queue_based_on_type(sli_si91x_command_queue_t *queue
 /* Function used to check whether queue is empty or not */
 uint32_t sli_si91x_host_queue_status(const sli_si91x_buffer_queue_t *queue);
 
+/* Function used to clear the commands in flight of the specified queue */
+void sli_si91x_command_window_reset(sli_si91x_command_queue_t *queue, uint8_t size);
+
+/* Function used to check whether the next TX command of the specified queue can be sent */
+bool sli_si91x_command_window_is_open(const sli_si91x_command_queue_t *queue);
+
+/* Function used to record a command sent to the NWP that waits for its response */
+void sli_si91x_command_window_push(sli_si91x_command_queue_t *queue, const sli_si91x_command_trace_t *trace);
+
+/* Function used to load the command in flight at the specified index into the queue trace */
+bool sli_si91x_command_window_load(sli_si91x_command_queue_t *queue, uint8_t index);
+
+/* Function used to load the command in flight a response frame belongs to into the queue trace */
+void sli_si91x_command_window_select(sli_si91x_command_queue_t *queue, uint16_t frame_type);
+
+/* Function used to drop the loaded command once its response has been handled */
+bool sli_si91x_command_window_release(sli_si91x_command_queue_t *queue);
+
+/* Function used to stop waiting for the commands in flight whose response timed out */
+uint8_t sli_si91x_command_window_expire(sli_si91x_command_queue_t *queue);
+
 // These aren't host APIs. These should go into a wifi bus API header
 /* Function used to set buffer pointer to point to specified memory address */
 sl_status_t sl_si91x_bus_read_memory(uint32_t addr, uint16_t length, uint8_t *buffer);
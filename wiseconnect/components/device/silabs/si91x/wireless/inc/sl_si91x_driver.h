@@ -148,6 +148,61 @@ sl_status_t sli_si91x_driver_send_command(uint32_t command,
                                           void *sdk_context,
                                           sl_wifi_buffer_t **data_buffer);
 
+/***************************************************************************/ /**
+ * @brief
+ *   Queue a command packet to the NWP without waiting for its response.
+ * @param[in] command
+ *   Command type to be sent to NWP firmware.
+ * @param[in] command_type
+ *   @ref sli_si91x_command_type_t Command type
+ * @param[in] buffer
+ *   [sl_wifi_buffer_t](../wiseconnect-api-reference-guide-wi-fi/sl-wifi-buffer-t) Command packet buffer. The driver owns it once this function is called.
+ * @param[in] wait_period
+ *   @ref sli_si91x_wait_period_t Timeout for the command response, counted from now.
+ * @param[in] sdk_context
+ *   Pointer to the context.
+ * @param[in] keep_response_packet
+ *   Keep the response packet for @ref sli_si91x_driver_wait_for_command_packet.
+ * @param[out] packet_id
+ *   Identifier to pass to @ref sli_si91x_driver_wait_for_command_packet.
+ * @pre Pre-conditions:
+ * - 
+ *   @ref sl_si91x_driver_init should be called before this API.
+ * @return
+ *   sl_status_t. See https://docs.silabs.com/gecko-platform/latest/platform-common/status for details.
+ * @note
+ *   Responses of a command queue are returned in order, so several commands queued by the same thread must be waited for in the order they were queued.
+ ******************************************************************************/
+sl_status_t sli_si91x_driver_queue_command_packet(uint32_t command,
+                                                  sli_si91x_command_type_t command_type,
+                                                  sl_wifi_buffer_t *buffer,
+                                                  sli_si91x_wait_period_t wait_period,
+                                                  void *sdk_context,
+                                                  bool keep_response_packet,
+                                                  uint8_t *packet_id);
+
+/***************************************************************************/ /**
+ * @brief
+ *   Wait for the response of a command queued with @ref sli_si91x_driver_queue_command_packet.
+ * @param[in] command_type
+ *   @ref sli_si91x_command_type_t Command type the command was queued with.
+ * @param[in] packet_id
+ *   Identifier returned by @ref sli_si91x_driver_queue_command_packet.
+ * @param[in] wait_period
+ *   @ref sli_si91x_wait_period_t Timeout for the command response.
+ * @param[out] data_buffer
+ *   [sl_wifi_buffer_t](../wiseconnect-api-reference-guide-wi-fi/sl-wifi-buffer-t) Pointer to a data buffer pointer for the response data to be returned in, or NULL.
+ * @pre Pre-conditions:
+ * - 
+ *   @ref sl_si91x_driver_init should be called before this API.
+ * @return
+ *   sl_status_t. See https://docs.silabs.com/gecko-platform/latest/platform-common/status for details.
+ ******************************************************************************/
+sl_status_t sli_si91x_driver_wait_for_command_packet(sli_si91x_command_type_t command_type,
+                                                     uint8_t packet_id,
+                                                     sli_si91x_wait_period_t wait_period,
+                                                     sl_wifi_buffer_t **data_buffer);
+
 /***************************************************************************/ /**
  * @brief
  *   Register a function and optional argument for scan results callback.
@@ -53,6 +53,14 @@ typedef struct sl_si91x_fdset_s {
 /// Flag to indicate that host would receive the response from firmware in asynchronous manner.
 #define SI91X_PACKET_WITH_ASYNC_RESPONSE (1 << 4)
 
+/// Flag to indicate that no other command of the same queue can be in flight together with this command.
+#define SI91X_PACKET_SERIALIZE (1 << 5)
+
+/// Maximum number of commands of a command queue waiting for their response at the same time.
+#ifndef SLI_SI91X_MAX_COMMANDS_IN_FLIGHT
+#define SLI_SI91X_MAX_COMMANDS_IN_FLIGHT 4
+#endif
+
 /// Si91x specific command type
 typedef enum {
   SI91X_COMMON_CMD      = 0, ///< SI91X Common Command
@@ -207,6 +215,26 @@ typedef struct {
 /// The summation of all three ratios should max 10 and the ratio should be in decimal value.
 typedef sl_wifi_system_dynamic_pool_t sl_si91x_dynamic_pool;
 
+/// Structure to represent a command waiting for its response
+typedef struct {
+  uint16_t frame_type;        ///< Type of the frame associated with the command
+  uint16_t packet_id;         ///< ID of the packet associated with the command
+  uint8_t flags;              ///< Flags associated with the command
+  uint8_t firmware_queue_id;  ///< ID of the firmware queue for the command
+  bool expired;               ///< Indicates the command timed out, its response is dropped when it arrives
+  uint32_t command_tickcount; ///< Command tick count
+  uint32_t command_timeout;   ///< Command timeout
+  void *sdk_context;          ///< Context data associated with the command
+} sli_si91x_command_trace_t;
+
+/// Structure to represent the commands of a command queue waiting for their response
+typedef struct {
+  sli_si91x_command_trace_t trace[SLI_SI91X_MAX_COMMANDS_IN_FLIGHT]; ///< Commands, oldest first
+  uint8_t count;                                                     ///< Number of commands
+  uint8_t size;                                                      ///< Maximum number of commands not expired
+  uint8_t loaded;                                                    ///< Command loaded in the command queue
+} sli_si91x_command_window_t;
+
 /// Structure to represent a command queue
 typedef struct {
   sli_si91x_buffer_queue_t tx_queue;    ///< TX queue
@@ -226,4 +254,5 @@ typedef struct {
   uint32_t command_timeout;             ///< Command timeout
   void *sdk_context;                    ///< Context data associated with the command
   bool is_queue_initialiazed;           ///< indicates queue is initialiazed or not.
+  sli_si91x_command_window_t *window;   ///< Commands in flight when the queue is not sequential, or NULL
 } sli_si91x_command_queue_t;
@@ -1427,13 +1427,19 @@ sl_status_t sli_si91x_flush_queue_based_on_type(sli_si91x_command_queue_t *queue
   // Enter atomic section to prevent race conditions
   CORE_irqState_t state = CORE_EnterAtomic();
 
-  // Check if the queue is not the BT command queue and has a command in flight
-  if (queue != &cmd_queues[SLI_SI91X_BT_CMD] && queue->command_in_flight) {
+  // Check if the queue is not the BT command queue and has commands in flight
+  uint8_t index = 0;
+  while (queue != &cmd_queues[SLI_SI91X_BT_CMD] && sli_si91x_command_window_load(queue, index)) {
     status = sli_handle_command_in_flight_packet(queue, event_mask, frame_status, compare_function, user_data);
     if (status != SL_STATUS_OK) {
+      sli_si91x_command_window_release(queue);
       CORE_ExitAtomic(state);
       return status;
     }
+    // Skip the commands kept by the compare function
+    if (!sli_si91x_command_window_release(queue)) {
+      index++;
+    }
   }
 
   status = sli_flush_tx_queue(queue, event_mask, frame_status, compare_function, user_data);
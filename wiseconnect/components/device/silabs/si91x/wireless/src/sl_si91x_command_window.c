@@ -0,0 +1,261 @@
+/***************************************************************************/ /**
+ * @file
+ * @brief Commands in flight of the SI91X command queues
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+#include "sl_si91x_types.h"
+#include "sl_si91x_constants.h"
+#include "sl_rsi_utility.h"
+#include <string.h>
+
+/******************************************************
+ *                    Constants
+ ******************************************************/
+// Commands that cannot share the queue with any other command
+#define SLI_SI91X_COMMAND_WINDOW_EXCLUSIVE (SI91X_PACKET_SERIALIZE | SI91X_PACKET_GLOBAL_QUEUE_BLOCK)
+
+/******************************************************
+ *             Static Function Definitions
+ ******************************************************/
+// A queue without a window, or with the sequential flag set, keeps a single command in flight in its trace fields
+static inline bool sli_si91x_command_window_enabled(const sli_si91x_command_queue_t *queue)
+{
+  return (queue->window != NULL) && (queue->sequential == false);
+}
+
+static uint8_t sli_si91x_command_window_active_count(const sli_si91x_command_window_t *window)
+{
+  uint8_t active = 0;
+
+  for (uint8_t index = 0; index < window->count; index++) {
+    if (!window->trace[index].expired) {
+      active++;
+    }
+  }
+  return active;
+}
+
+static void sli_si91x_command_window_remove(sli_si91x_command_window_t *window, uint8_t index)
+{
+  memmove(&window->trace[index],
+          &window->trace[index + 1],
+          (window->count - index - 1) * sizeof(sli_si91x_command_trace_t));
+  window->count--;
+}
+
+// Load the oldest command into the trace fields, or clear them if no command is in flight
+static void sli_si91x_command_window_load_oldest(sli_si91x_command_queue_t *queue)
+{
+  if (!sli_si91x_command_window_load(queue, 0)) {
+    queue->command_in_flight = false;
+    queue->frame_type        = 0;
+    queue->command_tickcount = 0;
+    queue->command_timeout   = 0;
+  }
+}
+
+static bool sli_si91x_command_window_match(const sli_si91x_command_trace_t *trace, uint16_t frame_type)
+{
+  // The IPv6 configuration response does not use the request frame type
+  return (trace->frame_type == frame_type)
+         || ((trace->frame_type == SLI_WLAN_REQ_IPCONFV6) && (frame_type == SLI_WLAN_RSP_IPCONFV6));
+}
+
+/******************************************************
+ *               Function Definitions
+ ******************************************************/
+void sli_si91x_command_window_reset(sli_si91x_command_queue_t *queue, uint8_t size)
+{
+  if (queue->window == NULL) {
+    return;
+  }
+
+  if (size > SLI_SI91X_MAX_COMMANDS_IN_FLIGHT) {
+    size = SLI_SI91X_MAX_COMMANDS_IN_FLIGHT;
+  }
+  memset(queue->window, 0, sizeof(sli_si91x_command_window_t));
+  queue->window->size = (size == 0) ? 1 : size;
+  queue->sequential   = (queue->window->size == 1);
+}
+
+bool sli_si91x_command_window_is_open(const sli_si91x_command_queue_t *queue)
+{
+  const sli_si91x_command_window_t *window = queue->window;
+
+  if (!sli_si91x_command_window_enabled(queue)) {
+    return !queue->command_in_flight;
+  }
+
+  if (window->count == 0) {
+    return true;
+  }
+
+  // Keep a slot for the response of every command, even when nobody waits for it anymore
+  if ((window->count == SLI_SI91X_MAX_COMMANDS_IN_FLIGHT)
+      || (sli_si91x_command_window_active_count(window) >= window->size)) {
+    return false;
+  }
+
+  // A serializing command waits for the commands in flight, and blocks the queue until its response
+  for (uint8_t index = 0; index < window->count; index++) {
+    if (window->trace[index].flags & SLI_SI91X_COMMAND_WINDOW_EXCLUSIVE) {
+      return false;
+    }
+  }
+  if (queue->tx_queue.head != NULL) {
+    const sli_si91x_queue_packet_t *node = sl_si91x_host_get_buffer_data(queue->tx_queue.head, 0, NULL);
+    if (node->flags & SLI_SI91X_COMMAND_WINDOW_EXCLUSIVE) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void sli_si91x_command_window_push(sli_si91x_command_queue_t *queue, const sli_si91x_command_trace_t *trace)
+{
+  sli_si91x_command_window_t *window = queue->window;
+
+  if (!sli_si91x_command_window_enabled(queue) || (window->count == SLI_SI91X_MAX_COMMANDS_IN_FLIGHT)) {
+    // Mark the command as in flight
+    queue->command_in_flight = true;
+    queue->packet_id         = trace->packet_id;
+    queue->firmware_queue_id = trace->firmware_queue_id;
+    queue->frame_type        = trace->frame_type;
+    queue->flags             = trace->flags;
+    queue->command_timeout   = trace->command_timeout;
+    queue->command_tickcount = trace->command_tickcount;
+    queue->sdk_context       = trace->sdk_context;
+    return;
+  }
+
+  window->trace[window->count]         = *trace;
+  window->trace[window->count].expired = false;
+  window->count++;
+  if (window->count == 1) {
+    sli_si91x_command_window_load(queue, 0);
+  }
+}
+
+bool sli_si91x_command_window_load(sli_si91x_command_queue_t *queue, uint8_t index)
+{
+  sli_si91x_command_window_t *window = queue->window;
+
+  if (!sli_si91x_command_window_enabled(queue)) {
+    return (index == 0) && queue->command_in_flight;
+  }
+
+  if (index >= window->count) {
+    return false;
+  }
+
+  const sli_si91x_command_trace_t *trace = &window->trace[index];
+  window->loaded                         = index;
+  queue->command_in_flight               = true;
+  queue->packet_id                       = trace->packet_id;
+  queue->firmware_queue_id               = trace->firmware_queue_id;
+  queue->frame_type                      = trace->frame_type;
+  queue->flags                           = trace->flags;
+  queue->command_tickcount               = trace->command_tickcount;
+  queue->sdk_context                     = trace->sdk_context;
+  // The response of an expired command is dropped, as nobody waits for it anymore
+  queue->command_timeout = trace->expired ? 0 : trace->command_timeout;
+  return true;
+}
+
+void sli_si91x_command_window_select(sli_si91x_command_queue_t *queue, uint16_t frame_type)
+{
+  const sli_si91x_command_window_t *window = queue->window;
+  uint8_t index                            = 0;
+
+  if (!sli_si91x_command_window_enabled(queue)) {
+    return;
+  }
+
+  // Responses of commands of the same frame type come back in order, so the oldest one is the match. A frame that
+  // matches no command, such as an asynchronous event, is handled with the oldest command loaded, as it would be with
+  // a single command in flight.
+  for (uint8_t candidate = 0; candidate < window->count; candidate++) {
+    if (sli_si91x_command_window_match(&window->trace[candidate], frame_type)) {
+      index = candidate;
+      break;
+    }
+  }
+  sli_si91x_command_window_load(queue, index);
+}
+
+bool sli_si91x_command_window_release(sli_si91x_command_queue_t *queue)
+{
+  sli_si91x_command_window_t *window = queue->window;
+
+  if (!sli_si91x_command_window_enabled(queue)) {
+    return !queue->command_in_flight;
+  }
+
+  if (window->count == 0) {
+    return false;
+  }
+
+  // The response handlers clear the in flight flag or the frame type of the command they complete
+  bool completed = (queue->command_in_flight == false) || (queue->frame_type == 0);
+  if (completed) {
+    sli_si91x_command_window_remove(window, window->loaded);
+  }
+  sli_si91x_command_window_load_oldest(queue);
+  return completed;
+}
+
+uint8_t sli_si91x_command_window_expire(sli_si91x_command_queue_t *queue)
+{
+  sli_si91x_command_window_t *window = queue->window;
+  uint8_t expired                    = 0;
+
+  if (!sli_si91x_command_window_enabled(queue)) {
+    return 0;
+  }
+
+  for (uint8_t index = 0; index < window->count; index++) {
+    sli_si91x_command_trace_t *trace = &window->trace[index];
+    // Only a command with a waiting thread has a timeout, a serializing one keeps the queue until its response
+    if (trace->expired || !(trace->flags & SI91X_PACKET_RESPONSE_STATUS)
+        || (trace->flags & SLI_SI91X_COMMAND_WINDOW_EXCLUSIVE)
+        || (sl_si91x_host_elapsed_time(trace->command_tickcount) <= trace->command_timeout)) {
+      continue;
+    }
+    trace->expired = true;
+    expired++;
+  }
+
+  // Give up on the oldest expired commands when they fill the window
+  while ((window->count == SLI_SI91X_MAX_COMMANDS_IN_FLIGHT) && window->trace[0].expired) {
+    sli_si91x_command_window_remove(window, 0);
+  }
+
+  if (expired != 0) {
+    sli_si91x_command_window_load_oldest(queue);
+  }
+  return expired;
+}
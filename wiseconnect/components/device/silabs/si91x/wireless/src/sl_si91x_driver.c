@@ -1092,22 +1092,19 @@ sl_status_t sli_si91x_driver_wait_for_response_packet(sli_si91x_buffer_queue_t *
   return SL_STATUS_OK; // Return success status
 }
 
-sl_status_t sli_si91x_driver_send_command_packet(uint32_t command,
-                                                 sli_si91x_command_type_t command_type,
-                                                 sl_wifi_buffer_t *buffer,
-                                                 sli_si91x_wait_period_t wait_period,
-                                                 void *sdk_context,
-                                                 sl_wifi_buffer_t **data_buffer)
+sl_status_t sli_si91x_driver_queue_command_packet(uint32_t command,
+                                                  sli_si91x_command_type_t command_type,
+                                                  sl_wifi_buffer_t *buffer,
+                                                  sli_si91x_wait_period_t wait_period,
+                                                  void *sdk_context,
+                                                  bool keep_response_packet,
+                                                  uint8_t *packet_id)
 {
-  uint16_t firmware_status;
   sli_si91x_queue_packet_t *node = NULL;
   sl_status_t status;
   sl_wifi_buffer_t *packet;
-  sl_wifi_buffer_t *response;
-  uint8_t flags                     = 0;
-  uint16_t data_length              = 0;
-  sli_si91x_wait_period_t wait_time = 0;
-  static uint8_t command_packet_id  = 0;
+  uint8_t flags                   = 0;
+  static uint8_t command_packet_id = 0;
 
   // Allocate a command packet and set flags based on the command type
   status = sli_si91x_allocate_command_buffer(&packet,
@@ -1134,7 +1131,7 @@ sl_status_t sli_si91x_driver_send_command_packet(uint32_t command,
     // If not an immediate return, set the SI91X_PACKET_RESPONSE_STATUS flag
     flags |= SI91X_PACKET_RESPONSE_STATUS;
     // Additionally, set the SI91X_PACKET_RESPONSE_PACKET flag if the SLI_SI91X_WAIT_FOR_RESPONSE_BIT is set in wait_period
-    if (data_buffer != NULL) {
+    if (keep_response_packet) {
       flags |= ((wait_period & SLI_SI91X_WAIT_FOR_RESPONSE_BIT) ? SI91X_PACKET_RESPONSE_PACKET : 0);
     }
   }
@@ -1144,7 +1141,15 @@ sl_status_t sli_si91x_driver_send_command_packet(uint32_t command,
     case SLI_COMMON_REQ_PWRMODE:
     case SLI_COMMON_REQ_OPERMODE:
     case SLI_COMMON_REQ_SOFT_RESET:
-      flags |= SI91X_PACKET_GLOBAL_QUEUE_BLOCK;
+      flags |= SI91X_PACKET_GLOBAL_QUEUE_BLOCK | SI91X_PACKET_SERIALIZE;
+      break;
+    case SLI_WLAN_REQ_BAND:
+    case SLI_WLAN_REQ_INIT:
+    case SLI_WLAN_REQ_JOIN:
+    case SLI_WLAN_REQ_DISCONNECT:
+    case SLI_WLAN_REQ_AP_STOP:
+      // Connection state changes are not pipelined with other commands of the queue
+      flags |= SI91X_PACKET_SERIALIZE;
       break;
     default:
       break;
@@ -1191,10 +1196,23 @@ sl_status_t sli_si91x_driver_send_command_packet(uint32_t command,
   sl_si91x_host_set_bus_event(SL_SI91X_TX_PENDING_FLAG(command_type));
   CORE_ExitAtomic(state);
 
-  // Check if the command should return immediately or wait for a response
-  if (wait_period == SLI_SI91X_RETURN_IMMEDIATELY) {
-    return SL_STATUS_IN_PROGRESS;
+  if (packet_id != NULL) {
+    *packet_id = this_packet_id;
   }
+  return SL_STATUS_OK;
+}
+
+sl_status_t sli_si91x_driver_wait_for_command_packet(sli_si91x_command_type_t command_type,
+                                                     uint8_t packet_id,
+                                                     sli_si91x_wait_period_t wait_period,
+                                                     sl_wifi_buffer_t **data_buffer)
+{
+  uint16_t firmware_status;
+  sli_si91x_queue_packet_t *node = NULL;
+  sl_status_t status;
+  sl_wifi_buffer_t *response;
+  uint16_t data_length              = 0;
+  sli_si91x_wait_period_t wait_time = 0;
 
   // Calculate the wait time based on wait_period
   if ((wait_period & SLI_SI91X_WAIT_FOR_EVER) == SLI_SI91X_WAIT_FOR_EVER) {
@@ -1207,7 +1225,7 @@ sl_status_t sli_si91x_driver_send_command_packet(uint32_t command,
   status = sli_si91x_driver_wait_for_response_packet(&cmd_queues[command_type].rx_queue,
                                                      si91x_events,
                                                      SL_SI91X_RESPONSE_FLAG(command_type),
-                                                     this_packet_id,
+                                                     packet_id,
                                                      wait_time,
                                                      &response);
   // Check if the status is SL_STATUS_TIMEOUT, indicating a timeout has occurred
@@ -1215,7 +1233,7 @@ sl_status_t sli_si91x_driver_send_command_packet(uint32_t command,
     // Declare a temporary packet pointer to hold the packet to be removed
     sl_wifi_buffer_t *temp_packet;
     sl_status_t temp_status = sli_si91x_remove_buffer_from_queue_by_comparator(&cmd_queues[command_type].tx_queue,
-                                                                               &this_packet_id,
+                                                                               &packet_id,
                                                                                sli_si91x_packet_identification_function,
                                                                                &temp_packet);
 
@@ -1252,6 +1270,31 @@ sl_status_t sli_si91x_driver_send_command_packet(uint32_t command,
   return sli_convert_and_save_firmware_status(firmware_status);
 }
 
+sl_status_t sli_si91x_driver_send_command_packet(uint32_t command,
+                                                 sli_si91x_command_type_t command_type,
+                                                 sl_wifi_buffer_t *buffer,
+                                                 sli_si91x_wait_period_t wait_period,
+                                                 void *sdk_context,
+                                                 sl_wifi_buffer_t **data_buffer)
+{
+  uint8_t packet_id;
+  sl_status_t status = sli_si91x_driver_queue_command_packet(command,
+                                                             command_type,
+                                                             buffer,
+                                                             wait_period,
+                                                             sdk_context,
+                                                             (data_buffer != NULL),
+                                                             &packet_id);
+  VERIFY_STATUS_AND_RETURN(status);
+
+  // Check if the command should return immediately or wait for a response
+  if (wait_period == SLI_SI91X_RETURN_IMMEDIATELY) {
+    return SL_STATUS_IN_PROGRESS;
+  }
+
+  return sli_si91x_driver_wait_for_command_packet(command_type, packet_id, wait_period, data_buffer);
+}
+
 static sl_status_t sl_si91x_driver_send_data_packet(sl_wifi_buffer_t *buffer, uint32_t wait_time)
 {
   UNUSED_PARAMETER(wait_time);
@@ -513,6 +513,60 @@ sl_status_t sl_wifi_get_stored_scan_results(sl_wifi_interface_t interface,
   return sli_wifi_get_stored_scan_results(interface, extended_scan_parameters);
 }
 
+sl_status_t sli_wifi_scan_and_wait(sl_wifi_interface_t interface,
+                                   sl_wifi_scan_result_t *scan_results,
+                                   uint32_t max_scan_result_count)
+{
+  sl_status_t status;
+  sl_wifi_buffer_t *buffer          = NULL;
+  sli_si91x_req_scan_t scan_request = { 0 };
+
+  if (!device_initialized) {
+    return SL_STATUS_NOT_INITIALIZED;
+  }
+
+  if (!sl_wifi_is_interface_up(interface)) {
+    return SL_STATUS_WIFI_INTERFACE_NOT_UP;
+  }
+
+  SL_VERIFY_POINTER_OR_RETURN(scan_results, SL_STATUS_NULL_POINTER);
+  scan_results->scan_count = 0;
+
+  // Scan all channels, as a standard scan without a callback
+  sl_wifi_max_tx_power_t wifi_max_tx_power = sli_get_max_tx_power();
+  scan_request.scan_feature_bitmap         = (uint8_t)(wifi_max_tx_power.scan_tx_power << 3);
+
+  status = sli_si91x_driver_send_command(SLI_WLAN_REQ_SCAN,
+                                         SLI_SI91X_WLAN_CMD,
+                                         &scan_request,
+                                         sizeof(scan_request),
+                                         SL_SI91X_WAIT_FOR_RESPONSE(60000),
+                                         NULL,
+                                         &buffer);
+  if ((status != SL_STATUS_OK) && (buffer != NULL)) {
+    sli_si91x_host_free_buffer(buffer);
+  }
+  if (status == SL_STATUS_SI91X_NO_AP_FOUND) {
+    return SL_STATUS_OK;
+  }
+  VERIFY_STATUS_AND_RETURN(status);
+
+  const sl_wifi_system_packet_t *packet = sl_si91x_host_get_buffer_data(buffer, 0, NULL);
+  const sl_wifi_scan_result_t *result   = (const sl_wifi_scan_result_t *)packet->data;
+  uint32_t scan_count                   = 0;
+
+  if (packet->length >= sizeof(sl_wifi_scan_result_t)) {
+    scan_count = (packet->length - sizeof(sl_wifi_scan_result_t)) / sizeof(result->scan_info[0]);
+    scan_count = MIN(scan_count, result->scan_count);
+    scan_count = MIN(scan_count, max_scan_result_count);
+  }
+  memcpy(scan_results->scan_info, result->scan_info, scan_count * sizeof(result->scan_info[0]));
+  scan_results->scan_count = scan_count;
+
+  sli_si91x_host_free_buffer(buffer);
+  return SL_STATUS_OK;
+}
+
 sl_status_t sli_configure_scan_request(const sl_wifi_client_configuration_t *ap,
                                        sli_si91x_req_scan_t *scan_request,
                                        sl_wifi_interface_t interface)
@@ -40,6 +40,8 @@
 #define MAX_WIFI_AP_PROFILES     2 ///< Maximum number of Wi-Fi access point profiles.
 
 #define AUTO_JOIN_RETRY_COUNT 3 ///< Number of retries for auto-join.
+#define AUTO_JOIN_BACKOFF_MIN_MS 1000  ///< Delay in ms before the first auto-join retry, doubled for each retry.
+#define AUTO_JOIN_BACKOFF_MAX_MS 30000 ///< Maximum delay in ms between auto-join retries.
 
 #define NETWORK_MANAGER_CONNECT_CMD         BIT(0) ///< Command to connect the network manager.
 #define NETWORK_MANAGER_DISCONNECT_CMD      BIT(1) ///< Command to disconnect the network manager.
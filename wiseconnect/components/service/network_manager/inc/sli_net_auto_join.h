@@ -0,0 +1,76 @@
+/***************************************************************************/ /**
+ * @file
+ * @brief Network manager auto-join candidate selection and retry backoff
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2022 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+#pragma once
+#include "sl_net_wifi_types.h"
+
+/**
+ * @brief Auto-join candidate.
+ *
+ * @details
+ * A stored Wi-Fi client profile whose network was found by the auto-join scan.
+ */
+typedef struct {
+  uint8_t profile_id; ///< Profile ID of the candidate
+  uint8_t priority;   ///< Priority of the profile (0 = highest, 255 = lowest)
+  int16_t rssi;       ///< Strongest RSSI in dBm at which the network of the profile was scanned
+} sli_net_auto_join_candidate_t;
+
+/**
+ * @brief Match scan results against stored client profiles and rank the visible ones.
+ *
+ * @param[in] scan_results Scan results, or NULL when the scan failed. Every stored profile is then a candidate
+ *                         with an RSSI of -128.
+ * @param[in] profiles Client profiles indexed by profile ID. A profile with an empty SSID is not stored.
+ * @param[in] profile_count Number of profiles.
+ * @param[out] candidates Candidates, at least profile_count entries. Sorted by priority, then by RSSI, strongest first.
+ * @return Number of candidates.
+ *
+ * @details
+ * A profile matches a scanned network when the SSID is equal and, if set in the profile, the BSSID and channel
+ * are equal too.
+ * The function does not use any OS service, so recorded scan results can be replayed on a host.
+ */
+uint8_t sli_net_rank_auto_join_candidates(const sl_wifi_scan_result_t *scan_results,
+                                          const sl_net_wifi_client_profile_t profiles[],
+                                          uint8_t profile_count,
+                                          sli_net_auto_join_candidate_t candidates[]);
+
+/**
+ * @brief Get the delay before an auto-join retry.
+ *
+ * @param[in] retry Retry number, starting at 0.
+ * @param[in] random Random value used for the jitter.
+ * @return Delay in milliseconds.
+ *
+ * @details
+ * The delay is AUTO_JOIN_BACKOFF_MIN_MS doubled for each retry and capped at AUTO_JOIN_BACKOFF_MAX_MS. A random jitter
+ * of up to half of it is removed, so that devices recovering from the same outage do not retry in lockstep.
+ */
+uint32_t sli_net_get_auto_join_backoff(uint32_t retry, uint32_t random);
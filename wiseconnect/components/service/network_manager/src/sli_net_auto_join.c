@@ -0,0 +1,141 @@
+/***************************************************************************/ /**
+ * @file
+ * @brief Network manager auto-join candidate selection and retry backoff
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2022 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+#include "sli_net_auto_join.h"
+#include "sl_net_constants.h"
+#include <string.h>
+
+#define SLI_NET_AUTO_JOIN_UNKNOWN_RSSI (-128)
+
+static bool sli_is_zero_bssid(const sl_mac_address_t *bssid)
+{
+  for (uint8_t i = 0; i < sizeof(bssid->octet); i++) {
+    if (bssid->octet[i] != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool sli_profile_matches_scan_info(const sl_net_wifi_client_profile_t *profile,
+                                          const uint8_t ssid[],
+                                          size_t ssid_size,
+                                          const uint8_t bssid[],
+                                          uint8_t rf_channel)
+{
+  const sl_wifi_client_configuration_t *config = &profile->config;
+
+  // The scanned SSID is null terminated, the profile SSID is not
+  if ((config->ssid.length >= ssid_size) || (ssid[config->ssid.length] != '\0')
+      || (memcmp(ssid, config->ssid.value, config->ssid.length) != 0)) {
+    return false;
+  }
+  if (!sli_is_zero_bssid(&config->bssid) && (memcmp(bssid, config->bssid.octet, sizeof(config->bssid.octet)) != 0)) {
+    return false;
+  }
+  if ((config->channel.channel != 0) && (config->channel.channel != rf_channel)) {
+    return false;
+  }
+  return true;
+}
+
+static bool sli_is_better_candidate(const sli_net_auto_join_candidate_t *a, const sli_net_auto_join_candidate_t *b)
+{
+  if (a->priority != b->priority) {
+    return a->priority < b->priority;
+  }
+  if (a->rssi != b->rssi) {
+    return a->rssi > b->rssi;
+  }
+  return a->profile_id < b->profile_id;
+}
+
+uint8_t sli_net_rank_auto_join_candidates(const sl_wifi_scan_result_t *scan_results,
+                                          const sl_net_wifi_client_profile_t profiles[],
+                                          uint8_t profile_count,
+                                          sli_net_auto_join_candidate_t candidates[])
+{
+  uint8_t candidate_count = 0;
+
+  for (uint8_t profile_id = 0; profile_id < profile_count; profile_id++) {
+    const sl_net_wifi_client_profile_t *profile = &profiles[profile_id];
+    int16_t rssi                                = SLI_NET_AUTO_JOIN_UNKNOWN_RSSI;
+    bool visible                                = (scan_results == NULL);
+
+    if (profile->config.ssid.length == 0) {
+      continue;
+    }
+
+    // Keep the strongest of the BSSs advertising the network
+    for (uint32_t i = 0; (scan_results != NULL) && (i < scan_results->scan_count); i++) {
+      if (sli_profile_matches_scan_info(profile,
+                                        scan_results->scan_info[i].ssid,
+                                        sizeof(scan_results->scan_info[i].ssid),
+                                        scan_results->scan_info[i].bssid,
+                                        scan_results->scan_info[i].rf_channel)) {
+        // The scan reports the RSSI magnitude
+        int16_t scanned_rssi = (int16_t)(-scan_results->scan_info[i].rssi_val);
+        if (!visible || (scanned_rssi > rssi)) {
+          rssi = scanned_rssi;
+        }
+        visible = true;
+      }
+    }
+    if (!visible) {
+      continue;
+    }
+
+    // Insert the candidate in rank order
+    sli_net_auto_join_candidate_t candidate = { .profile_id = profile_id, .priority = profile->priority, .rssi = rssi };
+    uint8_t position                        = candidate_count;
+    while ((position > 0) && sli_is_better_candidate(&candidate, &candidates[position - 1])) {
+      candidates[position] = candidates[position - 1];
+      position--;
+    }
+    candidates[position] = candidate;
+    candidate_count++;
+  }
+
+  return candidate_count;
+}
+
+uint32_t sli_net_get_auto_join_backoff(uint32_t retry, uint32_t random)
+{
+  uint32_t delay = AUTO_JOIN_BACKOFF_MIN_MS;
+
+  while ((retry > 0) && (delay < AUTO_JOIN_BACKOFF_MAX_MS)) {
+    delay <<= 1;
+    retry--;
+  }
+  if (delay > AUTO_JOIN_BACKOFF_MAX_MS) {
+    delay = AUTO_JOIN_BACKOFF_MAX_MS;
+  }
+
+  return delay - (random % (delay / 2 + 1));
+}
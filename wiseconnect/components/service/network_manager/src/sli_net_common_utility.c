@@ -41,6 +41,8 @@
 #endif
 #include "sli_wifi_constants.h"
 #include "sli_net_types.h"
+#include "sli_net_auto_join.h"
+#include "sl_rsi_utility.h"
 #include "cmsis_types.h"
 
 sl_net_event_handler_t net_event_handler = NULL;
@@ -67,6 +69,13 @@ extern sl_net_event_handler_t net_event_handler;
 extern sl_net_wifi_lwip_context_t *wifi_client_context;
 #endif
 
+// Auto-join state, only used by the network manager thread
+static sl_net_wifi_client_profile_t auto_join_profiles[MAX_WIFI_CLIENT_PROFILES];
+static uint8_t __aligned(4) auto_join_scan_buffer[sizeof(sl_wifi_scan_result_t)
+                                                  + (SL_WIFI_MAX_SCANNED_AP
+                                                     * sizeof(((sl_wifi_scan_result_t *)0)->scan_info[0]))];
+static uint32_t auto_join_jitter_state;
+
 sl_status_t sli_net_register_event_handler(sl_net_event_handler_t function)
 {
   net_event_handler = function;
@@ -221,51 +230,6 @@ sl_status_t sli_handle_auto_join(sl_net_interface_t interface, sl_net_wifi_clien
   return status;
 }
 
-// Partition function for QuickSort
-static int sli_partition_profile_ids(uint8_t profile_ids[], uint8_t priorities[], int low, int high)
-{
-  uint8_t pivot = priorities[high]; // Choose the last element as the pivot
-  int i         = low - 1;
-
-  for (int j = low; j < high; j++) {
-    if (priorities[j] < pivot) { // Compare priorities
-      i++;
-      // Swap profile IDs
-      uint8_t temp_id = profile_ids[i];
-      profile_ids[i]  = profile_ids[j];
-      profile_ids[j]  = temp_id;
-
-      // Swap priorities
-      uint8_t temp_priority = priorities[i];
-      priorities[i]         = priorities[j];
-      priorities[j]         = temp_priority;
-    }
-  }
-
-  // Swap profile IDs and priorities for the pivot
-  uint8_t temp_id    = profile_ids[i + 1];
-  profile_ids[i + 1] = profile_ids[high];
-  profile_ids[high]  = temp_id;
-
-  uint8_t temp_priority = priorities[i + 1];
-  priorities[i + 1]     = priorities[high];
-  priorities[high]      = temp_priority;
-
-  return i + 1; // Return the pivot index
-}
-
-static void sli_quicksort_profile_ids(uint8_t profile_ids[], uint8_t priorities[], int low, int high)
-{
-  if (low < high) {
-    // Partition the array and get the pivot index
-    int pivot_index = sli_partition_profile_ids(profile_ids, priorities, low, high);
-
-    // Recursively sort elements before and after the partition
-    sli_quicksort_profile_ids(profile_ids, priorities, low, pivot_index - 1);
-    sli_quicksort_profile_ids(profile_ids, priorities, pivot_index + 1, high);
-  }
-}
-
 static void sli_notify_net_event_handler(sl_net_event_t event, sl_status_t status, void *data, size_t data_size)
 {
   if (net_event_handler) {
@@ -288,75 +252,93 @@ static int sli_get_iterate_profiles_count()
   }
 }
 
-static sl_status_t sli_fetch_and_sort_profiles(sl_net_interface_t interface,
-                                               uint8_t sorted_profile_ids[],
-                                               uint8_t priorities[])
+static void sli_fetch_profiles(sl_net_interface_t interface)
 {
-  sl_status_t status;
-
-  // Fetch all profile IDs and their priorities
+  // Fetch all profiles, a profile that cannot be fetched is left empty and never tried
   for (uint8_t profile_id = 0; profile_id < MAX_WIFI_CLIENT_PROFILES; profile_id++) {
-    sl_net_wifi_client_profile_t profile;
-    status = sl_net_get_profile(interface, profile_id, &profile);
-    if (status == SL_STATUS_OK) {
-      sorted_profile_ids[profile_id] = profile_id;       // Store the profile ID
-      priorities[profile_id]         = profile.priority; // Store the priority
-    } else {
-      // If fetching a profile fails, set priority to a high value to deprioritize it
-      sorted_profile_ids[profile_id] = profile_id;
-      priorities[profile_id]         = UINT8_MAX;
+    sl_status_t status = sl_net_get_profile(interface, profile_id, &auto_join_profiles[profile_id]);
+    if (status != SL_STATUS_OK) {
+      memset(&auto_join_profiles[profile_id], 0, sizeof(auto_join_profiles[profile_id]));
     }
   }
+}
 
-  // Sort profile IDs based on their priorities using QuickSort
-  sli_quicksort_profile_ids(sorted_profile_ids, priorities, 0, MAX_WIFI_CLIENT_PROFILES - 1);
+static uint8_t sli_scan_and_rank_profiles(sli_net_auto_join_candidate_t candidates[])
+{
+  sl_wifi_scan_result_t *scan_results = (sl_wifi_scan_result_t *)auto_join_scan_buffer;
 
-  return SL_STATUS_OK;
+  // One scan shows which of the stored networks are in range
+  sl_status_t status = sli_wifi_scan_and_wait(SL_WIFI_CLIENT_INTERFACE, scan_results, SL_WIFI_MAX_SCANNED_AP);
+  if (status != SL_STATUS_OK) {
+    SL_DEBUG_LOG("\r\nAuto-join scan failed: 0x%lx, trying all profiles\r\n", status);
+    scan_results = NULL;
+  }
+
+  return sli_net_rank_auto_join_candidates(scan_results, auto_join_profiles, MAX_WIFI_CLIENT_PROFILES, candidates);
 }
 
-static bool sli_attempt_connection_to_profiles(const uint8_t sorted_profile_ids[],
+static uint32_t sli_get_auto_join_jitter(void)
+{
+  // xorshift32, seeded from the tick count so that devices do not share a sequence
+  if (auto_join_jitter_state == 0) {
+    auto_join_jitter_state = osKernelGetTickCount() | 1;
+  }
+  auto_join_jitter_state ^= auto_join_jitter_state << 13;
+  auto_join_jitter_state ^= auto_join_jitter_state >> 17;
+  auto_join_jitter_state ^= auto_join_jitter_state << 5;
+  return auto_join_jitter_state;
+}
+
+static bool sli_attempt_connection_to_profiles(const sli_net_auto_join_candidate_t candidates[],
+                                               uint8_t candidate_count,
                                                sl_net_event_t event,
                                                sl_status_t *status)
 {
-  for (int i = 0; i < MAX_WIFI_CLIENT_PROFILES; i++) {
-    *status = sl_net_up(SL_NET_WIFI_CLIENT_INTERFACE, sorted_profile_ids[i]); // Use profile ID
+  for (uint8_t i = 0; i < candidate_count; i++) {
+    *status = sl_net_up(SL_NET_WIFI_CLIENT_INTERFACE, candidates[i].profile_id); // Use profile ID
     if (*status == SL_STATUS_OK) {
-      SL_DEBUG_LOG("\r\nSuccess to set up Wi-Fi for Profile ID %d\r\n", sorted_profile_ids[i]);
+      SL_DEBUG_LOG("\r\nSuccess to set up Wi-Fi for Profile ID %d\r\n", candidates[i].profile_id);
       sl_net_auto_join_status_t join_status = SL_NET_AUTO_JOIN_CONNECTED;
       sli_notify_net_event_handler(event, *status, &join_status, sizeof(int));
       return true;
     } else {
-      SL_DEBUG_LOG("\r\nFailed to set up Wi-Fi for Profile ID %d: 0x%lx\r\n", sorted_profile_ids[i], *status);
+      SL_DEBUG_LOG("\r\nFailed to set up Wi-Fi for Profile ID %d: 0x%lx\r\n", candidates[i].profile_id, *status);
     }
   }
   return false;
 }
 
-static bool sli_connect_to_sorted_wifi_profiles(const uint8_t sorted_profile_ids[],
-                                                int iterate_profiles_count,
-                                                sl_net_event_t event)
+static bool sli_connect_to_sorted_wifi_profiles(int iterate_profiles_count, sl_net_event_t event)
 {
   sl_status_t status;
-  bool ap_connected = false;
+  sli_net_auto_join_candidate_t candidates[MAX_WIFI_CLIENT_PROFILES];
 
-  while (iterate_profiles_count > 0) {
-    ap_connected = sli_attempt_connection_to_profiles(sorted_profile_ids, event, &status);
-    if (ap_connected) {
-      break;
+  for (int retry = 0; retry < iterate_profiles_count; retry++) {
+    if (retry > 0) {
+      uint32_t delay = sli_net_get_auto_join_backoff((uint32_t)(retry - 1), sli_get_auto_join_jitter());
+      SL_DEBUG_LOG("\r\nRetrying to set up Wi-Fi in %lu ms...\r\n", delay);
+      osDelay(delay);
     }
 
-    SL_DEBUG_LOG("\r\nRetrying to set up Wi-Fi...\r\n");
-    osDelay(30000); // Wait for 30 seconds before retrying
-    iterate_profiles_count--;
+    uint8_t candidate_count = sli_scan_and_rank_profiles(candidates);
+    if ((candidate_count == 0) && (retry == iterate_profiles_count - 1)) {
+      // Hidden networks never show up in the scan, so the last retry tries every profile
+      candidate_count =
+        sli_net_rank_auto_join_candidates(NULL, auto_join_profiles, MAX_WIFI_CLIENT_PROFILES, candidates);
+    }
+    if (candidate_count == 0) {
+      SL_DEBUG_LOG("\r\nNo stored network in range\r\n");
+      continue;
+    }
+    if (sli_attempt_connection_to_profiles(candidates, candidate_count, event, &status)) {
+      return true;
+    }
   }
 
-  return ap_connected;
+  return false;
 }
 
-static bool sli_handle_disconnect_or_failure_event(const sli_network_manager_message_t *message,
-                                                   uint8_t sorted_profile_ids[],
-                                                   uint8_t priorities[],
-                                                   sl_net_event_t event)
+static bool sli_handle_disconnect_or_failure_event(const sli_network_manager_message_t *message, sl_net_event_t event)
 {
   sl_status_t status = SL_STATUS_OK;
   if (!(message->event_flags & (NETWORK_MANAGER_DISCONNECT_CMD | NETWORK_MANAGER_CONNECT_FAILURE_CMD))) {
@@ -369,14 +351,10 @@ static bool sli_handle_disconnect_or_failure_event(const sli_network_manager_mes
     sli_notify_net_event_handler(event, status, &join_status, sizeof(int));
   }
 
-  status = sli_fetch_and_sort_profiles(message->interface, sorted_profile_ids, priorities);
-  if (status != SL_STATUS_OK) {
-    SL_DEBUG_LOG("\r\nFailed to fetch and sort profiles: 0x%lx\r\n", status);
-    return true;
-  }
+  sli_fetch_profiles(message->interface);
 
   int iterate_profiles_count = sli_get_iterate_profiles_count();
-  bool ap_connected          = sli_connect_to_sorted_wifi_profiles(sorted_profile_ids, iterate_profiles_count, event);
+  bool ap_connected          = sli_connect_to_sorted_wifi_profiles(iterate_profiles_count, event);
 
   if (ap_connected) {
     osEventFlagsSet(auto_join_event_flag, AUTO_JOIN_SUCCESS_FLAG);
@@ -405,8 +383,6 @@ void sli_network_manager_event_handler(const void *arg)
 {
   UNUSED_PARAMETER(arg);
   sli_network_manager_message_t message;
-  uint8_t sorted_profile_ids[MAX_WIFI_CLIENT_PROFILES];
-  uint8_t priorities[MAX_WIFI_CLIENT_PROFILES];
   sl_net_event_t event = SL_NET_AUTO_JOIN_EVENT;
 
   while (1) {
@@ -414,7 +390,7 @@ void sli_network_manager_event_handler(const void *arg)
       continue; // Skip if message retrieval fails
     }
 
-    if (sli_handle_disconnect_or_failure_event(&message, sorted_profile_ids, priorities, event) == true) {
+    if (sli_handle_disconnect_or_failure_event(&message, event) == true) {
       continue; // Handle disconnect or failure event
     }
 
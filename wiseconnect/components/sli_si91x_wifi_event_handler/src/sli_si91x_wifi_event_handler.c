@@ -227,14 +227,14 @@ static sl_status_t bus_write_frame(sli_si91x_command_queue_t *queue,
     if (SI91X_PACKET_WITH_ASYNC_RESPONSE != (node->flags & SI91X_PACKET_WITH_ASYNC_RESPONSE)) {
       // Update trace information with packet details
       // If the packet doesn't have an async response, mark the command as in flight
-      queue->command_in_flight = true;
-      queue->packet_id         = node->host_packet->id;
-      queue->firmware_queue_id = node->firmware_queue_id;
-      queue->frame_type        = packet->command;
-      queue->flags             = node->flags;
-      queue->command_timeout   = node->command_timeout;
-      queue->command_tickcount = node->command_tickcount;
-      queue->sdk_context       = node->sdk_context;
+      sli_si91x_command_trace_t trace = { .frame_type        = packet->command,
+                                          .packet_id         = node->host_packet->id,
+                                          .flags             = node->flags,
+                                          .firmware_queue_id = node->firmware_queue_id,
+                                          .command_tickcount = node->command_tickcount,
+                                          .command_timeout   = node->command_timeout,
+                                          .sdk_context       = node->sdk_context };
+      sli_si91x_command_window_push(queue, &trace);
     }
   }
 #ifdef SLI_SI91X_MCU_INTERFACE
@@ -544,6 +544,11 @@ static inline void sli_si91x_wifi_handle_rx_events(uint32_t *event)
                  frame_status,
                  (response->length & (~(0xF000))));
 
+    // Load the trace of the command this frame responds to
+    for (int i = 0; i < SI91X_CMD_MAX; i++) {
+      sli_si91x_command_window_select(&cmd_queues[i], frame_type);
+    }
+
     switch (queue_id) {
       case SLI_WLAN_MGMT_Q: {
         // Erase queue ID as it overlays with the length field which is only 24-bit
@@ -1398,6 +1403,11 @@ static inline void sli_si91x_wifi_handle_rx_events(uint32_t *event)
         break;
       }
     }
+
+    // Drop the command completed by this frame and load the trace of the oldest one left
+    for (int i = 0; i < SI91X_CMD_MAX; i++) {
+      sli_si91x_command_window_release(&cmd_queues[i]);
+    }
     sli_submit_rx_buffer();
   } else {
     *event &= ~SL_SI91X_NCP_HOST_BUS_RX_EVENT; // Reset the event flag
@@ -1414,7 +1424,8 @@ static inline void sli_si91x_wifi_handle_tx_event(uint32_t *event)
       if (!(*event & (SL_SI91X_TX_PENDING_FLAG(i)))) {
         continue;
       }
-      if (cmd_queues[i].command_in_flight == true) {
+      sli_si91x_command_window_expire(&cmd_queues[i]);
+      if (!sli_si91x_command_window_is_open(&cmd_queues[i])) {
         tx_command_queues_command_in_flight_status |= SL_SI91X_TX_PENDING_FLAG(i);
         continue;
       } else {
@@ -1513,12 +1524,21 @@ static inline void sli_si91x_wifi_handle_tx_event(uint32_t *event)
 void sli_wifi_event_handler_init(void)
 {
   // Array to track the status of commands in flight
+  static sli_si91x_command_window_t command_windows[SI91X_CMD_MAX];
 
   cmd_queues[SI91X_COMMON_CMD].sequential      = true;
   cmd_queues[SLI_SI91X_WLAN_CMD].sequential    = true;
   cmd_queues[SLI_SI91X_NETWORK_CMD].sequential = true;
   cmd_queues[SLI_SI91X_BT_CMD].sequential      = true;
   cmd_queues[SLI_SI91X_SOCKET_CMD].sequential  = true;
+
+  // The responses of the BT and socket queues are not matched by frame type, so they stay sequential
+  cmd_queues[SI91X_COMMON_CMD].window      = &command_windows[SI91X_COMMON_CMD];
+  cmd_queues[SLI_SI91X_WLAN_CMD].window    = &command_windows[SLI_SI91X_WLAN_CMD];
+  cmd_queues[SLI_SI91X_NETWORK_CMD].window = &command_windows[SLI_SI91X_NETWORK_CMD];
+  sli_si91x_command_window_reset(&cmd_queues[SI91X_COMMON_CMD], SL_SI91X_COMMON_CMD_WINDOW_SIZE);
+  sli_si91x_command_window_reset(&cmd_queues[SLI_SI91X_WLAN_CMD], SL_SI91X_WLAN_CMD_WINDOW_SIZE);
+  sli_si91x_command_window_reset(&cmd_queues[SLI_SI91X_NETWORK_CMD], SL_SI91X_NETWORK_CMD_WINDOW_SIZE);
 }
 
 void sli_wifi_event_handler_deinit(void)